@@ -1,11 +1,14 @@
 from helper import *
 
 import ast
+import re
 import time
 
 class ArchConvertion:
     def __init__(self, arch):
         self.arch = arch
+        self.expr_tpl = []
+        self.expr_tpl_idx = {}
 
     def GetArchName(self):
         return self.arch['architecture_information']['name'].capitalize()
@@ -48,6 +51,81 @@ class ArchConvertion:
     def _GenerateRead(self, var_name, addr, sz):
         return 'u%d %s;\nif (!rBinStrm.Read(%s, %s))\n  return false;\n\n' % (sz, var_name, addr, var_name)
 
+    # Expression templates
+    #
+    # Expressions which don't depend on the decoded bytes (registers, constants, ...) are built once
+    # by the architecture and shared by every decoded instruction. Since instructions may reference
+    # the same template several times, templates must never be modified. Variables are excluded since
+    # the compiler resolves their size in place.
+
+    tpl_const_arg = re.compile(r'^(&m_CpuInfo|nullptr|true|false|-?0x[0-9a-fA-F]+|-?\d+|"[^"]*"|[A-Z][A-Za-z0-9]*_\w+|\w+Expression::\w+|@T\d+@)$')
+    tpl_inner_call = re.compile(r'Expr::Make\w+\(([^()]*)\)')
+    tpl_mutable_call = ( 'Expr::MakeVar(', )
+
+    def _GetTemplateName(self, idx):
+        return 'm_ExprTemplates[%#04x]' % idx
+
+    def _SplitTemplateArguments(self, args):
+        res = []
+        depth = 0
+        cur = ''
+        for c in args:
+            if c in '({':
+                depth += 1
+            elif c in ')}':
+                depth -= 1
+            if c == ',' and depth == 0:
+                res.append(cur.strip())
+                cur = ''
+                continue
+            cur += c
+        if len(cur.strip()) != 0:
+            res.append(cur.strip())
+        return res
+
+    # Replaces each constant Expr::Make* call found in code with a reference to a template
+    def _TemplateExpressions(self, code):
+        kept = []
+
+        # innermost calls are handled first, thus a call is constant if all its arguments are constant
+        def replace_call(m):
+            args = self._SplitTemplateArguments(m.group(1))
+            if not m.group(0).startswith(self.tpl_mutable_call) and len(args) != 0 and all(self.tpl_const_arg.match(' '.join(x.split())) for x in args):
+                expr = m.group(0)[:m.start(1) - m.start(0)] + ', '.join(' '.join(x.split()) for x in args) + ')'
+                if not expr in self.expr_tpl_idx:
+                    self.expr_tpl_idx[expr] = len(self.expr_tpl)
+                    self.expr_tpl.append(expr)
+                return '@T%d@' % self.expr_tpl_idx[expr]
+            kept.append(m.group(0))
+            return '@K%d@' % (len(kept) - 1)
+
+        while True:
+            new_code = self.tpl_inner_call.sub(replace_call, code)
+            if new_code == code:
+                break
+            code = new_code
+
+        def expand(code):
+            code = re.sub(r'@T(\d+)@', lambda m: self._GetTemplateName(int(m.group(1))), code)
+            return re.sub(r'@K(\d+)@', lambda m: expand(kept[int(m.group(1))]), code)
+        return expand(code)
+
+    def _IsTemplate(self, code):
+        return re.match(r'^m_ExprTemplates\[0x[0-9a-f]+\]$', code.strip()) != None
+
+    def _GenerateTemplateDefinition(self):
+        res = ''
+        res += 'Expression::SPType m_ExprTemplates[%#x];\n' % max(len(self.expr_tpl), 1)
+        res += 'void _InitializeExpressionTemplates(void);\n'
+        return res
+
+    def _GenerateTemplateInitialization(self):
+        res = ''
+        for idx, expr in enumerate(self.expr_tpl):
+            expr = re.sub(r'@T(\d+)@', lambda m: self._GetTemplateName(int(m.group(1))), expr)
+            res += '%s = %s;\n' % (self._GetTemplateName(idx), expr)
+        return 'void %sArchitecture::_InitializeExpressionTemplates(void)\n' % self.GetArchName() + self._GenerateBrace(res)
+
     def _ConvertSemanticToCode(self, opcd, sem, id_mapper):
         class CodeBlock:
             CMT_TYPE = 0
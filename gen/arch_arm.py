@@ -6,25 +6,25 @@ import compiler
 import ast
 import string
 
+# Raised when an operand uses a field which is not part of the encoding, the next alternative is tried
+class ArmFieldError(Exception):
+    def __init__(self, insn, field):
+        Exception.__init__(self, 'Field "%s" not found in "%s"' % (field, insn['format']))
+
 class ArmArchConvertion(ArchConvertion):
     def __init__(self, arch):
         ArchConvertion.__init__(self, arch)
         self.all_mnemo = set()
 
-        self.id_mapper = {
-        'nf':'ARM_FlNf','cf':'ARM_FlCf','vf':'ARM_FlVf','zf':'ARM_FlZf',
-        'r0':'ARM_Reg0','r1':'ARM_Reg1','r2':'ARM_Reg2','r3':'ARM_Reg3',
-        'r4':'ARM_Reg4','r5':'ARM_Reg5','r6':'ARM_Reg6','r7':'ARM_Reg7',
-        'r8':'ARM_Reg8','r9':'ARM_Reg9','r10':'ARM_Reg10','r11':'ARM_Reg11',
-        'r12':'ARM_Reg12','r13':'ARM_Reg13','r14':'ARM_Reg14','r15':'ARM_Reg15',
-        'sp':'ARM_RegSP', 'lr':'ARM_RegLR', 'pc':'ARM_RegPC',
-        }
-
         all_instructions = self.arch['instruction']
 
         self.arm_insns = []
         self.thumb_insns = []
 
+        # decision tree dispatcher parameters
+        self.dispatch_field_max_width = 4
+        self.dispatch_leaf_max_size = 4
+
         for insn in all_instructions:
 
             # We need to flatten the encoding array
@@ -33,13 +33,16 @@ class ArmArchConvertion(ArchConvertion):
             # Check if instruction is valid
             self._ARM_VerifyInstruction(insn)
 
-            # Gather all mnemonics
-            self.all_mnemo.add(self._ARM_GetMnemonic(insn).capitalize())
-
+            # Only ARM and Thumb encodings are decoded
             if insn['mode'][0] == 'A':
                 self.arm_insns.append(insn)
             elif insn['mode'][0] == 'T':
                 self.thumb_insns.append(insn)
+            else:
+                continue
+
+            # Gather all mnemonics
+            self.all_mnemo.add(self._ARM_GetMnemonic(insn).capitalize())
 
         self.arm_insns.sort(key=lambda insn: insn['encoding'])
         self.thumb_insns.sort(key=lambda insn: insn['encoding'])
@@ -92,148 +95,394 @@ class ArmArchConvertion(ArchConvertion):
     def _ARM_GetSize(self, insn):
         return len(insn['encoding'])
 
-    def _ARM_ExtractField(self, insn):
+    # Splits the format into the mnemonic fields (e.g. {S}, <c>, .<dt>, .W) and the operands, operands
+    # are separated by the commas which are not enclosed in brackets or braces
+    def _ARM_SplitFormat(self, insn):
         fmt = insn['format']
-        fields = []
 
         off = fmt.find(' ')
         if off == -1:
             off = len(fmt)
-
-        full_mnem = fmt[:off]
+        full_mnem = fmt[len(self._ARM_GetMnemonic(insn)):off]
         all_oprds = fmt[off+1:]
 
-        # mnem{field}
-        beg = full_mnem.find('{')
-        end = full_mnem.find('}')
-        if beg != -1 and end != -1:
-            fields.append(full_mnem[beg+1:end])
-            full_mnem[end+1:]
-
-        # mnem<field0><field1>
-        # TODO handle .field
+        mnem_fields = []
         while len(full_mnem):
-            beg = full_mnem.find('<')
-            end = full_mnem.find('>')
-
-            if beg == -1:
-                break
-            if end == -1:
-                raise Exception('Unclose field %s' % insn)
-            fields.append(full_mnem[beg+1:end])
+            end = 0
+            if full_mnem[0] == '{':
+                depth = 0
+                for end in range(len(full_mnem)):
+                    if full_mnem[end] == '{':
+                        depth += 1
+                    elif full_mnem[end] == '}':
+                        depth -= 1
+                        if depth == 0:
+                            break
+            elif full_mnem[0] == '<' or full_mnem.startswith('.<'):
+                end = full_mnem.find('>')
+            else:
+                while end + 1 < len(full_mnem) and not full_mnem[end + 1] in '{<.':
+                    end += 1
+            mnem_fields.append(full_mnem[:end+1])
             full_mnem = full_mnem[end+1:]
 
-        oprds = re.findall('\[[^\]]*\]|\([^\)]*\)|\"[^\"]*\"|\S+', all_oprds)
-        e = len(oprds)
-        i = 0
-        while i < e:
-            # TODO: do this in the regexp...
-            oprd = oprds[i].strip(' ,')
-
-            if len(oprd) == 0:
-                i += 1
+        oprds = []
+        depth = 0
+        cur = ''
+        for c in all_oprds:
+            if c in '[{':
+                depth += 1
+            elif c in ']}':
+                depth -= 1
+            if c == ',' and depth == 0:
+                oprds.append(cur.strip())
+                cur = ''
                 continue
-
-            if oprd.endswith('{!}'):
-                fields.append('{!}')
-                oprd = oprd[:-3]
-                if len(oprd) == 0:
-                    i += 1
-                    continue
-
-            if oprd == '!':
-                fields.append('!')
-            elif oprd.startswith('#<') and oprd[-1] == '>':
-                fields.append(oprd[2:-1])
-            elif oprd[0] == '<' and oprd[-1] == '>':
-                fields.append(oprd[1:-1])
-            elif oprd[-1] == '{':
-                fields.append(oprds[i].strip() + ',' + oprds[i+1].strip())
-            elif oprd[0] == '[' and not ']' in oprd:
-                fields.append(oprds[i].strip() + ',' + oprds[i+1].strip())
-            else:
-                fields.append(oprd)
-            i += 1
-
-        return fields
+            cur += c
+        if len(cur.strip()):
+            oprds.append(cur.strip())
+
+        # post-indexed offsets follow the memory operand (e.g. [<Rn>] {,#<disp>})
+        idx = 0
+        while idx < len(oprds):
+            m = re.match('^(\[[^\]]*\]) ?({,.*})$', oprds[idx])
+            if m != None:
+                oprds[idx:idx+1] = [ m.group(1), m.group(2) ]
+            idx += 1
+
+        # some operands are described as a whole (e.g. <Rm>, <type> <Rs>)
+        idx = 0
+        while idx + 1 < len(oprds):
+            oprd = '%s, %s' % (oprds[idx], oprds[idx + 1])
+            if oprd in self.arch['operand']:
+                oprds[idx:idx+2] = [ oprd ]
+            idx += 1
+
+        return mnem_fields, oprds
 
     def _ARM_ExtractBits(self, insn, pattern):
         res = [] # beg, end
         enc = insn['encoding']
-        beg = 0
-        end = 0
-        off = 0
+        beg = None
 
-        found = False
+        off = 0
         for bitfield in enc[::-1]:
-            if bitfield == pattern and not found:
+            if bitfield == pattern and beg == None:
                 beg = off
-                found = True
-            elif bitfield != pattern and found:
-                end = off - 1
-                found = False
-                res.append((beg, end))
+            elif bitfield != pattern and beg != None:
+                res.append((beg, off - 1))
+                beg = None
             off += 1
 
-        if end == 0 and enc[0] == pattern:
-            end = len(enc) - 1
-            res.append((beg, end))
+        if beg != None:
+            res.append((beg, off - 1))
 
         return res
 
-    def _ARM_GenerateExtractBits(self, insn, pattern, scale = 0):
+    def _ARM_GetFieldWidth(self, insn, pattern):
+        return sum(end - beg + 1 for beg, end in self._ARM_ExtractBits(insn, pattern))
+
+    # Extracts a field, when it's split in the encoding, the lowest part comes first (e.g. i:imm3:imm8)
+    def _ARM_GenerateExtractBits(self, insn, pattern):
         bits = self._ARM_ExtractBits(insn, pattern)
+        if len(bits) == 0:
+            raise ArmFieldError(insn, pattern)
         res = []
 
-        zx_bit = 0
-        off = 0
+        scale = 0
         for beg, end in bits:
 
             scale_str = ''
-            if zx_bit != 0:
-                scale_str = ' << %d' % zx_bit
+            if scale != 0:
+                scale_str = ' << %d' % scale
 
             if beg == end:
                 res.append('ExtractBit<%d>(Opcode)%s' % (beg, scale_str))
             else:
                 res.append('ExtractBits<%d, %d>(Opcode)%s' % (beg, end, scale_str))
 
-            zx_bit += end - beg + 1
+            scale += end - beg + 1
 
-        scale_str = ''
-        if scale != 0:
-            scale_str = ' << %d' % scale_str
-        return '(%s)%s' % (' | '.join(res), scale_str)
+        return '(%s) /* %s */' % (' | '.join(res), pattern)
 
-    def _ARM_GenerateExtractBitsSigned(self, insn, pattern, scale = 0):
-        bits = self._ARM_ExtractBits(insn, pattern)
+    # Concatenates fields, the first one is the most significant (e.g. D:Vd)
+    def _ARM_GenerateConcatBits(self, insn, patterns):
         res = []
+        scale = 0
+        for pattern in patterns[::-1]:
+            field = self._ARM_GenerateExtractBits(insn, pattern)
+            if scale != 0:
+                field = '%s << %d' % (field, scale)
+            res.append(field)
+            scale += self._ARM_GetFieldWidth(insn, pattern)
+        return ' | '.join(res[::-1])
+
+    def _ARM_GetAccessBitSize(self, insn):
+        mnem = self._ARM_GetMnemonic(insn).upper()
+        m = re.match('^(LD|ST)(R|REX|A|AEX|L|LEX)(S?)(B|H|D)?T?$', mnem)
+        if m == None:
+            return 32
+        return { None: 32, 'B': 8, 'H': 16, 'D': 64 }[m.group(4)]
+
+    # Mnemonic fields which add a suffix when their bit is set, some encodings use another name for the
+    # bit (e.g. SMUAD{X} uses M, STC{L} uses D)
+    mnem_field_alias = { 'X': 'M', 'L': 'D', 'N': 'op' }
+
+    # SMLA<x><y>: bottom or top half of the operands
+    mnem_half_bit = { '<x>': 'N', '<y>': 'M' }
+
+    def _ARM_GenerateMnemonicField(self, insn, field):
+        enc = insn['encoding']
 
-        sx_bit = 0
-        off = 0
-        for beg, end in bits:
+        if field == '<c>':
+            if 'c' in enc:
+                return 'rInsn.SetTestedFlags(arm::ConditionFromValue(%s));\n' % self._ARM_GenerateExtractBits(insn, 'c')
+            if insn['mode'][0] == 'T':
+                return 'rInsn.AddAttribute(ARM_Attribute_SupportItBlock);\n'
+            return ''
+
+        m = re.match('^{([A-Z])}$', field)
+        if m != None:
+            name = m.group(1)
+
+            # R was renamed from W for PLDW (see arm.yaml), ARM encodings set it for PLD, Thumb ones for PLDW
+            if self._ARM_GetMnemonic(insn) == 'PLD' and name == 'R' and 'R' in enc:
+                cond = self._ARM_GenerateExtractBits(insn, 'R')
+                if insn['mode'][0] == 'A':
+                    cond = '!%s' % cond
+                return self._GenerateCondition('if', cond, 'rInsn.AddMnemonicSuffix("w");')
+
+            bit = name
+            if not bit in enc:
+                bit = self.mnem_field_alias.get(name)
+            if bit == None or not bit in enc:
+                return '// FIXME: not_implemented: "field %s";\n' % field
+            return self._GenerateCondition('if', self._ARM_GenerateExtractBits(insn, bit), 'rInsn.AddMnemonicSuffix("%s");' % name.lower())
+
+        if field in self.mnem_half_bit and self.mnem_half_bit[field] in enc:
+            return self._GenerateCondition('if', self._ARM_GenerateExtractBits(insn, self.mnem_half_bit[field]), 'rInsn.AddMnemonicSuffix("t");') +\
+                   self._GenerateCondition('else', None, 'rInsn.AddMnemonicSuffix("b");')
+
+        # the element size is encoded in 2 bits, arm.yaml uses the immediate letter for it
+        if field in [ '.<dt>', '.<size>', '<size>' ] and self._ARM_GetFieldWidth(insn, 'i') == 2:
+            cases = [ ('%#x' % idx, 'rInsn.AddMnemonicSuffix("%d");\n' % size, True) for idx, size in enumerate([ 8, 16, 32, 64 ]) ]
+            res = self._GenerateSwitch(self._ARM_GenerateExtractBits(insn, 'i'), cases[:-1], cases[-1][1])
+            if field[0] == '.':
+                res = 'rInsn.AddMnemonicSuffix(".");\n' + res
+            return res
 
-            scale_str = ''
-            if sx_bit != 0:
-                scale_str = ' << %d' % sx_bit
+        if '<' in field or '{' in field:
+            return '// FIXME: not_implemented: "field %s";\n' % field
+
+        return 'rInsn.AddMnemonicSuffix("%s");\n' % field.lower()
+
+    def _ARM_GenerateOperandCode(self, insn, oprd_sem):
+        class OprdVisitor(ast.NodeVisitor):
+            def __init__(self, parent, insn):
+                ast.NodeVisitor.__init__(self)
+                self.parent = parent
+                self.insn = insn
+
+            def _Field(self, *patterns):
+                return self.parent._ARM_GenerateConcatBits(self.insn, patterns)
+
+            # field or constant (e.g. the shift type of LSL #<imm>)
+            def _FieldOrValue(self, arg):
+                if arg.isdigit():
+                    return arg
+                return self._Field(arg)
+
+            def _Reg(self, reg_type, value):
+                return 'Expr::MakeId(arm::RegisterFromValue("%s", %s), &m_CpuInfo)' % (reg_type, value)
+
+            def _Imm(self, value):
+                return 'Expr::MakeBitVector(32, %s)' % value
+
+            # displacements of 16-bit Thumb and coprocessor loads and stores are scaled
+            def _DispScale(self):
+                mnem = self.parent._ARM_GetMnemonic(self.insn).upper()
+                if self.parent._ARM_GetSize(self.insn) == 16:
+                    if mnem == 'CB':
+                        return 1
+                    if mnem == 'ADR':
+                        return 2
+                    return { 8: 0, 16: 1, 32: 2, 64: 2 }[self.parent._ARM_GetAccessBitSize(self.insn)]
+                if re.match('^(VLDR|VSTR|LDC2?|STC2?)$', mnem):
+                    return 2
+                if re.match('^(LDRD|STRD)$', mnem) and self.insn['mode'][0] == 'T':
+                    return 2
+                return 0
+
+            def generic_visit(self, node):
+                raise Exception('generic:', type(node).__name__)
+
+            def visit_Module(self, node):
+                assert(len(node.body) == 1)
+                return self.visit(node.body[0])
+
+            def visit_Expr(self, node):
+                return self.visit(node.value)
+
+            def visit_Call(self, node):
+                func_name = node.func.id
+                args = [ self.visit(arg) for arg in node.args ]
+                enc = self.insn['encoding']
+
+                if func_name == 'id':
+                    return 'Expr::MakeId(%s, &m_CpuInfo)' % args[0]
+
+                if func_name == 'reg':
+                    return self._Reg('GPR32', self._Field(*args))
+
+                # the second register of a pair is implicit in ARM encodings (e.g. LDRD A1)
+                if func_name == 'reg_pair':
+                    return self._Reg('GPR32', '%s + 1' % self._Field(*args))
+
+                if func_name == 'sreg':
+                    return self._Reg('FPR32', self._Field(*args))
+                if func_name == 'dreg':
+                    return self._Reg('SIMDR64', self._Field(*args))
+                if func_name == 'qreg':
+                    return self._Reg('SIMDR128', self._Field(*args))
+
+                if func_name == 'reg_list':
+                    return 'Expr::MakeVecId(arm::RegisterList(%d, %s), &m_CpuInfo)' % (self.parent._ARM_GetFieldWidth(self.insn, args[0]), self._Field(args[0]))
+
+                if func_name == 'imm':
+                    return self._Imm(self._Field(args[0]))
+
+                if func_name == 'disp':
+                    # branches with J1/J2 use thumb_branch
+                    if 'J1' in enc:
+                        raise ArmFieldError(self.insn, 'J1')
+                    scale = self._DispScale()
+                    if scale == 0:
+                        return self._Imm(self._Field(args[0]))
+                    return self._Imm('%s << %d' % (self._Field(args[0]), scale))
+
+                if func_name in [ 'arm_expand_imm', 'arm_expand_imm_c' ]:
+                    return self._Imm('arm::ArmExpandImm(%s)' % self._Field(args[0]))
+
+                # imm24:H:'0' for BLX, imm24:'00' otherwise
+                if func_name == 'arm_branch':
+                    if 'H' in enc:
+                        return self._Imm('SignExtend<u32, 26>(%s << 2 | %s << 1)' % (self._Field(args[0]), self._Field('H')))
+                    return self._Imm('SignExtend<u32, 26>(%s << 2)' % self._Field(args[0]))
+
+                # imm:'0' for 16-bit encodings, S:J2:J1:imm6:imm11:'0' for the conditional 32-bit encoding,
+                # S:I1:I2:imm10:imm11:'0' with I1 = NOT(J1 EOR S) and I2 = NOT(J2 EOR S) otherwise (BLX drops
+                # the lowest bit of imm11)
+                if func_name == 'thumb_branch':
+                    imm = self._Field(args[0])
+                    width = self.parent._ARM_GetFieldWidth(self.insn, args[0])
+                    if not 'J1' in enc:
+                        return self._Imm('SignExtend<u32, %d>(%s << 1)' % (width + 1, imm))
+                    s, j1, j2 = self._Field('S'), self._Field('J1'), self._Field('J2')
+                    if 'c' in enc:
+                        return self._Imm('SignExtend<u32, 21>(%s << 20 | %s << 19 | %s << 18 | %s << 1)' % (s, j2, j1, imm))
+                    return self._Imm('SignExtend<u32, 25>(%s << 24 | (~(%s ^ %s) & 1) << 23 | (~(%s ^ %s) & 1) << 22 | %s << %d)' % (s, j1, s, j2, s, imm, 22 - width))
+
+                if func_name == 'mem':
+                    return 'Expr::MakeMem(%d, nullptr, %s)' % (self.parent._ARM_GetAccessBitSize(self.insn), args[0])
+
+                # the offset is added when U is set, the operation is resolved once the operand is complete
+                # (see _ARM_GenerateOperand)
+                if func_name == 'u_add_sub':
+                    if not 'U' in enc:
+                        raise ArmFieldError(self.insn, 'U')
+                    return '%s @U@ %s' % (args[0], args[1])
+
+                if func_name == 'u_neg':
+                    if not 'U' in enc:
+                        raise ArmFieldError(self.insn, 'U')
+                    return '@N@%s' % args[0]
+
+                # SSAT and USAT only encode the highest bit of the shift type
+                if func_name == 'register_shift':
+                    shift_type = self._FieldOrValue(args[1])
+                    if args[1] == 'sh':
+                        shift_type = '%s << 1' % shift_type
+                    return 'arm::DecodeImmShiftWithSource(&m_CpuInfo, %s, %s, %s)' % (args[0], shift_type, self._FieldOrValue(args[2]))
+
+                if func_name == 'register_shift_reg':
+                    return 'arm::DecodeRegShiftWithSources(%s, %s, %s)' % (args[0], self._Field(args[1]), args[2])
+
+                raise Exception('call %s' % func_name)
+
+            def visit_Name(self, node):
+                reg_mapper = { 'pc': 'ARM_Reg_Pc', 'sp': 'ARM_Reg_Sp', 'lr': 'ARM_Reg_Lr' }
+                if node.id in reg_mapper:
+                    return reg_mapper[node.id]
+                raise Exception('name: %s' % node.id)
+
+            def visit_Str(self, node):
+                return node.s
+
+            def visit_Num(self, node):
+                return str(node.n)
+
+            def visit_Constant(self, node):
+                return str(node.value)
+
+            def visit_BinOp(self, node):
+                ops = { 'Add': '+', 'Sub': '-' }
+                op = type(node.op).__name__
+                if not op in ops:
+                    raise Exception('binop %s' % op)
+                return '%s %s %s' % (self.visit(node.left), ops[op], self.visit(node.right))
+
+        return OprdVisitor(self, insn).visit(ast.parse(oprd_sem))
+
+    # Operands are described in the operand section of arm.yaml, each one lists alternatives and the
+    # first one whose fields are all encoded is used (e.g. Rt2 is implicit in LDRD A1)
+    def _ARM_GenerateOperand(self, insn, oprd):
+        res = ''
+        oprd_handler = self.arch['operand']
+        enc = insn['encoding']
 
-            if beg == end:
-                res.append('ExtractBit<%d>(Opcode)%s' % (beg, scale_str))
+        if oprd.endswith('{!}'):
+            oprd = oprd[:-3]
+            if 'W' in enc:
+                res += self._GenerateCondition('if', self._ARM_GenerateExtractBits(insn, 'W'), 'rInsn.AddAttribute(ARM_Attribute_WriteBack);')
             else:
-                res.append('ExtractBits<%d, %d>(Opcode)%s' % (beg, end, scale_str))
+                res += '// FIXME: not_implemented: "field {!}";\n'
+        elif oprd.endswith('!'):
+            oprd = oprd[:-1]
+            res += 'rInsn.AddAttribute(ARM_Attribute_WriteBack);\n'
+
+        if re.match('^#-?\d+$', oprd):
+            return res + 'rInsn.AddOperand(Expr::MakeBitVector(32, %s));\n' % oprd[1:]
+
+        names = [ oprd ]
+        m = re.match('^#?<(\w+)>$', oprd)
+        if m != None:
+            names.append(m.group(1))
 
-            sx_bit += end - beg + 1
+        for name in names:
+            if not name in oprd_handler:
+                continue
+            for oprd_sem in oprd_handler[name]:
+                try:
+                    oprd_expr = self._ARM_GenerateOperandCode(insn, oprd_sem)
+                except ArmFieldError:
+                    continue
+
+                if '@U@' in oprd_expr or '@N@' in oprd_expr:
+                    return res + self._GenerateCondition('if', self._ARM_GenerateExtractBits(insn, 'U'),
+                            'rInsn.AddOperand(%s);' % oprd_expr.replace('@U@', '+').replace('@N@', '')) +\
+                        self._GenerateCondition('else', None,
+                            'rInsn.AddOperand(%s);' % oprd_expr.replace('@U@', '-').replace('@N@', '-'))
+
+                return res + 'rInsn.AddOperand(%s);\n' % oprd_expr
 
-        scale_str = ''
-        if scale != 0:
-            scale_str = ' << %d' % scale_str
-        return 'SignExtend<s64, %d>(%s)%s' % (sx_bit, ' | '.join(res), scale_str)
+        return res + '// FIXME: not_implemented: "operand %s";\n' % oprd
 
     def _ARM_GenerateInstruction(self, insn):
-        res = ''
-        res += 'rInsn.SetName("%s");\n' % self._ARM_GetMnemonic(insn)
-        res += 'rInsn.SetOpcode(ARM_Opcode_%s);\n' % self._ARM_GetMnemonic(insn).capitalize()
-        res += 'rInsn.Size() += %d;\n' % (self._ARM_GetSize(insn) / 8)
+        dec = '// decoder\n'
+        mnem = self._ARM_GetMnemonic(insn)
+        dec += 'rInsn.SetFormat("%s");\n' % insn['format']
+        dec += 'rInsn.Size() = %d;\n' % (self._ARM_GetSize(insn) // 8)
+        dec += 'rInsn.SetOpcode(ARM_Opcode_%s);\n' % mnem.capitalize()
 
         ## Handle SubType (jmp / call)
         map_op_type = { 'jmp' : 'Instruction::JumpType', 'call' : 'Instruction::CallType' }
@@ -243,330 +492,22 @@ class ArmArchConvertion(ArchConvertion):
                 attrs.append(map_op_type[attr])
 
         if len(attrs):
-            res += 'rInsn.SubType() |= %s;\n' % ' | '.join(attrs)
+            dec += 'rInsn.SubType() |= %s;\n' % ' | '.join(attrs)
 
-        field_mapper = { 'c': ('c', 'rInsn.SetTestedFlags(%s);\n') }
-        insn_fields = self._ARM_ExtractField(insn)
+        dec += 'rInsn.SetMnemonic("%s");\n' % mnem.lower()
 
-        oprd_handler = self.arch['operand']
+        mnem_fields, oprds = self._ARM_SplitFormat(insn)
+        for field in mnem_fields:
+            dec += self._ARM_GenerateMnemonicField(insn, field)
+        for oprd in oprds:
+            dec += self._ARM_GenerateOperand(insn, oprd)
 
-        oprd_no = 0
-        for field in insn_fields:
+        # the semantic of arm.yaml still uses the former expression API
+        sem = '// semantic\n'
+        sem += '// FIXME: not_implemented: "";\n'
 
-            # {!} is changed to 'W' (write_back) since '!' is not a valid yaml label
-            if field == '{!}':
-                field = 'W'
-
-            res += '\n// field: %s\n' % field
-
-            # Test condition bits
-            if field == 'c':
-                if not 'c' in insn['encoding']:
-                    res += '// TODO: unable to find conditional bits\n'
-                    continue
-                res += Indent('u8 CondField = %s;\n' % self._ARM_GenerateExtractBits(insn, 'c'), 0)
-                res += Indent('rInsn.SetTestedFlags(CondField);\n', 0)
-                res += Indent(self._GenerateCondition('if', 'CondField != 0xe',
-                        'rInsn.SubType() |= Instruction::ConditionalType;'), 0)
-
-            elif field == '!':
-                res += 'rInsn.Prefix() |= ARM_Prefix_W;\n'
-
-            elif field == 'W':
-                if not 'W' in insn['encoding']:
-                    res += Indent(self._GenerateCondition('if', '%s != 15' % self._ARM_GenerateExtractBits(insn, 'm'),
-                        'rInsn.Prefix() |= ARM_Prefix_W;'), 0)
-                else:
-                    res += Indent(self._GenerateCondition('if', self._ARM_GenerateExtractBits(insn, 'W'),
-                        'rInsn.Prefix() |= ARM_Prefix_W;'), 0)
-
-            elif field == 'S':
-                res += Indent(self._GenerateCondition('if', self._ARM_GenerateExtractBits(insn, 'S'),
-                    'rInsn.Prefix() |= ARM_Prefix_S;'), 0)
-
-            elif field[0] == '#' and field[1:].isdigit():
-                res += 'auto spOprd%d = Expr::MakeBitVector(32, %s);\n' % (oprd_no, field[1:])
-                res += self._GenerateCondition('if', 'spOprd%d == nullptr' % oprd_no, 'return false;')
-                res += 'rInsn.AddOperand(spOprd%d);\n' % oprd_no
-                oprd_no += 1
-
-            elif field in oprd_handler:
-                class OprdVisitor(ast.NodeVisitor):
-                    def __init__(self, parent, insn):
-                        self.parent = parent
-                        self.insn = insn
-                        ast.NodeVisitor.__init__(self)
-                        self.var_expr = []
-                        self.res = []
-
-                    def _ARM_GetAccessBitSizeFromMnemonic(self):
-                        mnem = self.parent._ARM_GetMnemonic(self.insn).lower()
-                        if mnem[-1] == 't': # Translation
-                            mnem = mnem[:-1]
-                        if mnem[-1] == 'b':
-                            return 8
-                        if mnem[-1] == 'h':
-                            return 16
-                        if mnem[-1] == 'd':
-                            return 64
-                        return 32
-
-                    def generic_visit(self, node):
-                        raise Exception('generic:', type(node).__name__)
-
-                    def visit_Module(self, node):
-                        for b in node.body:
-                            self.visit(b)
-
-                    def visit_Call(self, node):
-                        res = ''
-                        func_name = self.visit(node.func)
-                        func_args = []
-
-                        for arg in node.args:
-                            func_args.append(self.visit(arg))
-
-                        if func_name == 'id':
-                            assert(len(func_args) == 1)
-                            id_expr = 'Expr::MakeId(%s, &m_CpuInfo)' % func_args[0]
-                            res += id_expr
-                            self.res.append(id_expr)
-                            return res
-
-                        if func_name in [ 'arm_expand_imm', 'arm_expand_imm_c' ]:
-                            imm_expr = 'Expr::MakeBitVector(32, UnsignedRotateRight(ExtractBits<0, 7>(Opcode), ExtractBits<8, 11>(Opcode) << 1))'
-                            res += imm_expr
-                            self.res.append(imm_expr)
-                            return res
-
-                        if func_name == 'imm':
-                            assert(len(func_args) == 1)
-                            imm_expr = 'Expr::MakeBitVector(32, %s)' % self.parent._ARM_GenerateExtractBits(self.insn, func_args[0])
-                            res += imm_expr
-                            self.res.append(imm_expr)
-                            return res
-
-                        if func_name == 'disp':
-                            assert(len(func_args) == 1)
-                            disp = func_args[0]
-                            imm_expr = 'Expr::MakeBitVector(32, %s)' % self.parent._ARM_GenerateExtractBitsSigned(self.insn, disp)
-                            res += imm_expr
-                            self.res.append(imm_expr)
-                            return res
-
-                        if func_name == 'arm_branch':
-                            assert(len(func_args) == 1)
-                            branch_expr = 'Expr::MakeBitVector(32, %s << 2)' % self.parent._ARM_GenerateExtractBitsSigned(self.insn, func_args[0])
-                            res += branch_expr
-                            self.res.append(branch_expr)
-                            return res
-
-                        if func_name == 'thumb_branch':
-                            assert(len(func_args) == 1)
-                            branch_expr = 'Expr::MakeBitVector(32, %s << 1)' % self.parent._ARM_GenerateExtractBitsSigned(self.insn, func_args[0])
-                            res += branch_expr
-                            self.res.append(branch_expr)
-                            return res
-
-                        if func_name == 'reg':
-                            assert(len(func_args) == 1)
-                            reg_name = func_args[0].capitalize()
-                            self.var_expr.append('u32 Reg%s = %s;\n' % (reg_name, self.parent._ARM_GenerateExtractBits(self.insn, func_args[0])))
-                            if 'could_jmp' in self.insn['attribute'] and reg_name[0].lower() in [ 'd', 't' ]:
-                                self.var_expr.append(self.parent._GenerateCondition('if', 'Reg%s + ARM_RegR0 == ARM_RegPC' % reg_name, 'rInsn.SubType() |= Instruction::JumpType;'))
-                            if 'could_ret' in self.insn['attribute'] and reg_name[0].lower() in [ 'd', 't' ]:
-                                self.var_expr.append(self.parent._GenerateCondition('if', 'Reg%s + ARM_RegR0 == ARM_RegPC' % reg_name, 'rInsn.SubType() |= Instruction::ReturnType;'))
-                            reg_expr = 'Expr::MakeId(Reg%s + ARM_RegR0, &m_CpuInfo)' % reg_name
-                            self.res.append(reg_expr)
-                            return reg_expr
-
-                        if func_name == 'reg_list':
-                            assert(len(func_args) == 1)
-                            self.var_expr.append('u32 RegList = %s;\n' % self.parent._ARM_GenerateExtractBits(self.insn, func_args[0]))
-                            self.var_expr.append('Expression::LSPType IdExprs;\n')
-                            self.var_expr.append('std::vector<u32> VecId;\n')
-                            self.var_expr.append('for (u8 RegIdx = 0; RegIdx < 16; ++RegIdx)\n')
-                            self.var_expr.append('{\n')
-                            if_stmt = [ 'VecId.push_back(RegIdx + ARM_RegR0);' ]
-                            if 'could_jmp' in self.insn['attribute'] and func_args[0][0] in [ 'd', 'r' ]:
-                                if_stmt.append(self.parent._GenerateCondition('if', 'RegIdx + ARM_RegR0 == ARM_RegPC', 'rInsn.SubType() |= Instruction::JumpType;'))
-                            if 'could_ret' in self.insn['attribute'] and func_args[0][0] in [ 'd', 'r' ]:
-                                if_stmt.append(self.parent._GenerateCondition('if', 'RegIdx + ARM_RegR0 == ARM_RegPC', 'rInsn.SubType() |= Instruction::ReturnType;'))
-                            self.var_expr.append(Indent(self.parent._GenerateCondition('if', 'RegList & (1 << RegIdx)', '\n'.join(if_stmt))))
-                            self.var_expr.append('}\n')
-                            vec_reg_expr = 'Expr::MakeVecId(VecId, &m_CpuInfo);\n'
-                            self.res.append(vec_reg_expr)
-                            return vec_reg_expr
-
-                        if func_name == 'mem':
-                            assert(len(func_args) == 1)
-                            offset = func_args[0]
-                            self.res.pop()
-
-                            mem_expr = 'Expr::MakeMem(%d, %s, %s, %s)' %\
-                            (self._ARM_GetAccessBitSizeFromMnemonic(), 'nullptr', offset, 'true')
-                            self.res.append(mem_expr)
-                            return mem_expr
-
-                        if func_name == 'u_add_sub':
-                            assert(len(func_args) == 2)
-
-                            left = func_args[0]
-                            right = func_args[1]
-                            self.res.pop()
-                            self.res.pop()
-
-                            self.var_expr.append('auto OpType = (%s) ? OperationExpression::OpAdd : OperationExpression::OpSub;\n' % self.parent._ARM_GenerateExtractBits(insn, 'U'))
-                            op_expr = 'Expr::MakeBinOp(OpType,\n%s,\n%s)' % (Indent(left), Indent(right))
-                            self.res.append(op_expr)
-                            return op_expr
-
-                        if func_name == 'register_shift':
-                            # // DecodeImmShift()
-                            # // ================
-                            # (SRType, integer) DecodeImmShift(bits(2) type, bits(5) imm5)
-                            # case type of
-                            # when '00'
-                            #     shift_t = SRType_LSL; shift_n = UInt(imm5);
-                            # when '01'
-                            #     shift_t = SRType_LSR; shift_n = if imm5 == '00000' then 32 else UInt(imm5);
-                            # when '10'
-                            #     shift_t = SRType_ASR; shift_n = if imm5 == '00000' then 32 else UInt(imm5);
-                            # when '11'
-                            #     if imm5 == '00000' then
-                            #         shift_t = SRType_RRX; shift_n = 1;
-                            #     else
-                            #         shift_t = SRType_ROR; shift_n = UInt(imm5);
-                            # return (shift_t, shift_n);
-                            # RRX is tedious to implement: http://reverseengineering.stackexchange.com/questions/6065/semantics-of-the-rrx-shift-instruction-in-arm-and-carry-flag-updates
-                            decode_reg   = func_args[0]
-                            self.res.pop()
-                            decode_shift = self.parent._ARM_GenerateExtractBits(insn, func_args[1])
-                            if func_args[1] == 'sh':
-                                decode_shift += ' << 1'
-                            decode_imm   = self.parent._ARM_GenerateExtractBits(insn, func_args[2])
-                            self.var_expr.append('auto ShiftType = OperationExpression::OpUnk;\n')
-                            self.var_expr.append('u32 ShiftVal = 0;\n')
-                            self.var_expr.append(self.parent._GenerateSwitch(decode_shift,
-                                [
-                                (0, 'ShiftType = OperationExpression::OpLls;\nShiftVal = %s;\n' % decode_imm, True),
-                                (1, 'ShiftType = OperationExpression::OpLrs;\nShiftVal = (%s == 0x0) ? 32 : %s;\n' % (decode_imm, decode_imm), True),
-                                (2, 'ShiftType = OperationExpression::OpArs;\nShiftVal = (%s == 0x0) ? 32 : %s;\n' % (decode_imm, decode_imm), True),
-                                (3, self.parent._GenerateCondition('if', '%s == 0' % decode_imm, 'ShiftType = OperationExpression::OpRor;\nShiftVal = 1;\n') +
-                                    self.parent._GenerateCondition('else', None, 'ShiftType = OperationExpression::OpRor;\nShiftVal = %s;\n' % decode_imm), True),
-                                ],
-                                'return false;\n'
-                                ))
-                            op_expr = 'Expr::MakeBinOp(ShiftType,\n%s,\n%s)' % (
-                                Indent(decode_reg),
-                                Indent('Expr::MakeBitVector(32, ShiftVal)'))
-                            self.res.append(op_expr)
-                            return op_expr
-
-                        raise Exception('call %s' % func_name)
-
-                    def visit_Attribute(self, node):
-                        attr_name  = node.attr
-                        value_name = self.visit(node.value)
-
-                        raise Exception('attr %s' % attr_name)
-
-                    def visit_Name(self, node):
-                        node_name = node.id
-
-                        if node_name in [ 'id', 'imm', 'disp', 'reg', 'reg_list', 'mem', 'u_add_sub', 'register_shift' ]:
-                            return node_name
-
-                        if node_name.endswith('_branch'):
-                            return node_name
-
-                        if node_name.startswith('check_'):
-                            return node_name
-
-                        if node_name == 'sp':
-                            return 'ARM_RegSP'
-                        if node_name == 'pc':
-                            return 'ARM_RegPC'
-
-                        if node_name.startswith('arm_'):
-                            return node_name
-
-                        raise Exception('name: %s' % node_name)
-
-                    def visit_Str(self, node):
-                        return node.s
-
-                    def visit_Num(self, node):
-                        return str(node.n)
-
-                    def visit_Assign(self, node):
-                        assert(len(node.targets) == 1)
-                        target_name = self.visit(node.targets[0])
-                        value_name  = self.visit(node.value)
-
-                        raise Exception('assign %s' % target_name)
-
-                    def visit_AugAssign(self, node):
-                        oper_name   = self.visit(node.op)
-                        target_name = self.visit(node.target)
-                        value_name  = self.visit(node.value)
-                        raise Exception('AugAssign', oprd_name, target_name, value_name)
-
-                    def visit_BinOp(self, node):
-                        op = self.visit(node.op)
-                        left = self.visit(node.left)
-                        right = self.visit(node.right)
-                        self.res.pop()
-                        self.res.pop()
-
-                        op_expr = 'Expr::MakeBinOp(%s,\n%s,\n%s)' % (op, Indent(left), Indent(right))
-                        self.res.append(op_expr)
-                        return op_expr
-
-                    def visit_Add(self, node):
-                        return 'OperationExpression::OpAdd'
-
-                    def visit_Expr(self, node):
-                        return self.visit(node.value)
-
-                v = OprdVisitor(self, insn)
-                oprd_code = oprd_handler[field]
-                for oprd_sem in oprd_code:
-                    nodes = ast.parse(oprd_sem)
-                    v.visit(nodes)
-
-                    # Generate used variables
-                    if len(v.var_expr) != 0:
-                        res += '/* Variables expression */\n'
-                    for var in v.var_expr:
-                        res += var
-
-                    if len(v.res) == 0:
-                        res += '/* unhandled operand %s */\n' % field
-                        v.res.append('Expr::MakeSys("stop", 0)')
-
-                    assert(len(v.res) == 1)
-
-                res += 'auto spOprd%d = %s;\n' % (oprd_no, v.res[0])
-                res += self._GenerateCondition('if', 'spOprd%d == nullptr' % oprd_no, 'return false;')
-                res += 'rInsn.AddOperand(spOprd%d);\n' % oprd_no
-
-                oprd_no += 1
-
-            else:
-                res += '/* unhandled field %s */\n' % field
-                res += 'auto spOprd%d = %s;\n' % (oprd_no, 'Expr::MakeSys("stop", 0)')
-                res += self._GenerateCondition('if', 'spOprd%d == nullptr' % oprd_no, 'return false;')
-                res += 'rInsn.AddOperand(spOprd%d);\n' % oprd_no
-                oprd_no += 1
-
-
-        if 'semantic' in insn:
-            res += self._ConvertSemanticToCode(insn, insn['semantic'], self.id_mapper)
-
-        res += 'return true;\n'
-
-        return self._ARM_GenerateMethodPrototype(insn, False) + '\n' + self._GenerateBrace(res)
+        return self._ARM_GenerateMethodPrototype(insn, False) + '\n' + self._GenerateBrace(
+                self._GenerateBrace(dec) + self._GenerateBrace(sem) + 'return true;\n')
 
     def _ARM_GenerateInstructionComment(self, insn):
         return '// %s - %s - %s\n' % (insn['format'], insn['attribute'], insn['encoding'])
@@ -586,11 +527,144 @@ class ArmArchConvertion(ArchConvertion):
 
         return meth_fmt % self._ARM_GenerateMethodName(insn)
 
+    # Returns (mask, value, insn) tuples in matching order, 16-bit encodings are moved to the upper half
+    # of Opcode32 so ARM and Thumb instructions can be dispatched on the same 32-bit word.
+    def _ARM_GetDispatchPatterns(self, insns):
+        insns_dict = {}
+
+        # regroup instructions with the same mask
+        for insn in insns:
+            mask = self._ARM_GetMask(insn)
+            if not mask in insns_dict:
+                insns_dict[mask] = []
+            insns_dict[mask].append(insn)
+
+        # order by number of 0 and 1 in order to handle alias correctly
+        def get_bit_count(elem):
+            return 32 - bin(elem[0]).count('1')
+        insns_list = sorted(insns_dict.items(), key=get_bit_count)
+
+        res = []
+        for mask, insn_list in insns_list:
+            for insn in insn_list:
+                shift = 32 - self._ARM_GetSize(insn)
+                res.append((mask << shift, self._ARM_GetValue(insn) << shift, insn))
+        return res
+
+    # Selects the bit field which splits the remaining patterns the best. For each field, the cost is the
+    # number of candidates left on average once the field is known: a pattern which fixes n bits of a field
+    # of w bits is kept in 2**(w-n) of the 2**w cases.
+    def _ARM_SelectDecisionField(self, patterns, known_mask):
+        best = None
+        for width in range(1, self.dispatch_field_max_width + 1):
+            for low in range(0, 33 - width):
+                field_mask = ((1 << width) - 1) << low
+                if field_mask & known_mask:
+                    continue
+                cost = 0.0
+                for mask, value, insn in patterns:
+                    cost += 1.0 / (1 << bin(mask & field_mask).count('1'))
+                if best == None or cost < best[0]:
+                    best = (cost, low, width)
+        return best
+
+    # Builds a decision tree, a node is either ('leaf', patterns) or ('switch', low, width, children)
+    # where children maps each value of the field to a node. Patterns keep their matching order in each
+    # leaf, thus a leaf can test them one after the other like the linear dispatcher.
+    def _ARM_BuildDecisionTree(self, patterns, known_mask = 0x0, known_value = 0x0):
+        if len(patterns) <= self.dispatch_leaf_max_size:
+            return ('leaf', patterns)
+
+        field = self._ARM_SelectDecisionField(patterns, known_mask)
+        if field == None or field[0] >= len(patterns):
+            return ('leaf', patterns)
+
+        cost, low, width = field
+        field_mask = ((1 << width) - 1) << low
+        children = []
+        for field_value in range(1 << width):
+            cur_value = known_value | (field_value << low)
+            cur_patterns = [ x for x in patterns if (cur_value & x[0] & field_mask) == (x[1] & field_mask) ]
+            children.append(self._ARM_BuildDecisionTree(cur_patterns, known_mask | field_mask, cur_value))
+        return ('switch', low, width, children)
+
+    # Returns the statement which handles insn once it's matched: the handler is called, or only returned
+    # when select is set (dispatch-only benchmark)
+    def _ARM_GenerateHandlerStatement(self, insn, bit, prefix, select):
+        if select:
+            return 'return &ArmArchitecture::%s;' % self._ARM_GenerateMethodName(insn)
+        return 'return %s%s(rBinStrm, Offset, Opcode%d, rInsn);' % (prefix, self._ARM_GenerateMethodName(insn), bit)
+
+    def _ARM_GenerateDecisionTree(self, node, prefix = '', select = False):
+        if node[0] == 'leaf':
+            res = ''
+            for mask, value, insn in node[1]:
+                bit = self._ARM_GetSize(insn)
+                shift = 32 - bit
+                res += self._GenerateCondition('if', '(Opcode%d & %#010x) == %#010x' % (bit, mask >> shift, value >> shift),
+                        self._ARM_GenerateInstructionComment(insn) + self._ARM_GenerateHandlerStatement(insn, bit, prefix, select))
+            return res + ('return nullptr;\n' if select else 'return false;\n')
+
+        _, low, width, children = node
+
+        # children which share the same code are merged, the most frequent one becomes the default case
+        codes = []
+        labels = {}
+        for field_value, child in enumerate(children):
+            code = self._ARM_GenerateDecisionTree(child, prefix, select)
+            if not code in labels:
+                codes.append(code)
+                labels[code] = []
+            labels[code].append(field_value)
+        default = max(codes, key=lambda code: len(labels[code]))
+
+        cases = []
+        for code in codes:
+            if code == default:
+                continue
+            cases.append((':\ncase '.join('%#x' % x for x in labels[code]), code, False))
+        return self._GenerateSwitch('(Opcode32 >> %d) & %#x' % (low, (1 << width) - 1), cases, default)
+
+    def _ARM_GenerateDispatcher(self, insns, prefix = '', select = False):
+        return self._ARM_GenerateDecisionTree(self._ARM_BuildDecisionTree(self._ARM_GetDispatchPatterns(insns)), prefix, select)
+
+    # Generates the former dispatcher which tests each mask one after the other, it's only used by
+    # medusa_bench_arm_decode as the baseline of the decision tree
+    def _ARM_GenerateCascade(self, insns, select = False):
+        res = ''
+        insns_dict = {}
+
+        # regroup instructions with the same mask
+        for insn in insns:
+            mask = self._ARM_GetMask(insn)
+            if not mask in insns_dict:
+                insns_dict[mask] = []
+            insns_dict[mask].append(insn)
+
+        # order by number of 0 and 1 in order to handle alias correctly
+        def get_bit_count(elem):
+            return 32 - bin(elem[0]).count('1')
+        insns_list = sorted(insns_dict.items(), key=get_bit_count)
+
+        for mask, insn_list in insns_list:
+            bit = self._ARM_GetSize(insn_list[0])
+            if len(insn_list) == 1:
+                value = self._ARM_GetValue(insn_list[0])
+                res += self._GenerateCondition('if', '(Opcode%d & %#010x) == %#010x' % (bit, mask, value), self._ARM_GenerateInstructionComment(insn_list[0]) + self._ARM_GenerateHandlerStatement(insn_list[0], bit, 'rArch.', select))
+            else:
+                cases = []
+                for insn in insn_list:
+                    value = self._ARM_GetValue(insn)
+                    cases.append( ('%#010x' % value, self._ARM_GenerateInstructionComment(insn) + self._ARM_GenerateHandlerStatement(insn, bit, 'rArch.', select) + '\n', False) )
+                res += self._GenerateSwitch('Opcode%d & %#010x' % (bit, mask), cases, 'break;\n')
+
+        return res
+
     def GenerateHeader(self):
         res = ''
         res += 'static char const *m_Mnemonic[%#x];\n' % (len(self.all_mnemo) + 1)
 
-        for insn in sorted(self.arch['instruction'], key=lambda a:self._ARM_GetMnemonic(a)):
+        for insn in sorted(self.arm_insns + self.thumb_insns, key=lambda a:self._ARM_GetMnemonic(a)):
             res += self._ARM_GenerateMethodPrototype(insn, True) + ';\n'
 
         res += 'bool DisassembleArm(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn);\n'
@@ -601,50 +675,22 @@ class ArmArchConvertion(ArchConvertion):
     def GenerateSource(self):
         res = ''
 
+        res += '#include "arm_helper.hpp"\n'
+
         res += 'bool ArmArchitecture::Disassemble(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)\n'
         res += self._GenerateBrace(
                 'rInsn.SetArchitectureTag(GetTag());\n'+
-                'rInsn.Mode() = Mode;\n\n'+
+                'rInsn.SetMode(Mode);\n\n'+
                 self._GenerateSwitch('Mode',
                     [('ARM_ModeArm',   'return DisassembleArm(rBinStrm, Offset, rInsn);\n',   False),
                      ('ARM_ModeThumb', 'return DisassembleThumb(rBinStrm, Offset, rInsn);\n', False)],
                     'return false;\n')
                 )
 
-        def _ARM_GenerateDispatcher(arm, insns):
-            res = ''
-            insns_dict = {}
-
-            # regroup instructions with the same mask
-            for insn in insns:
-                mask = arm._ARM_GetMask(insn)
-                if not mask in insns_dict:
-                    insns_dict[mask] = []
-                insns_dict[mask].append(insn)
-
-            # order by number of 0 and 1 in order to handle alias correctly
-            def get_bit_count(elem):
-                return 32 - bin(elem[0]).count('1')
-            insns_list = sorted(insns_dict.items(), key=get_bit_count)
-
-            for mask, insn_list in insns_list:
-                bit = len(insn_list[0]['encoding'])
-                if len(insn_list) == 1:
-                    value = arm._ARM_GetValue(insn_list[0])
-                    res += arm._GenerateCondition('if', '(Opcode%d & %#010x) == %#010x' % (bit, mask, value), self._ARM_GenerateInstructionComment(insn_list[0]) + 'return %s(rBinStrm, Offset, Opcode%d, rInsn);' % (arm._ARM_GenerateMethodName(insn_list[0]), bit))
-                else:
-                    cases = []
-                    for insn in insn_list:
-                        value = arm._ARM_GetValue(insn)
-                        cases.append( ('%#010x' % value, self._ARM_GenerateInstructionComment(insn) + 'return %s(rBinStrm, Offset, Opcode%d, rInsn);\n' % (arm._ARM_GenerateMethodName(insn), bit), False) )
-                    res += arm._GenerateSwitch('Opcode%d & %#010x' % (bit, mask), cases, 'break;\n')
-
-            return res
-
         res += 'bool ArmArchitecture::DisassembleArm(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)\n'
         res += self._GenerateBrace(
                 self._GenerateRead('Opcode32', 'Offset', 32)+
-                _ARM_GenerateDispatcher(self, self.arm_insns)+
+                self._ARM_GenerateDispatcher(self.arm_insns)+
                 'return false;\n'
                 )
 
@@ -654,7 +700,7 @@ class ArmArchConvertion(ArchConvertion):
                 self._GenerateRead('Opcode16High', '(Offset + 2) & ~1', 16)+
                 Indent('u16 Opcode16 = Opcode16Low;\n', 0)+
                 Indent('u32 Opcode32 = ((Opcode16Low << 16) | Opcode16High);\n', 0)+
-                _ARM_GenerateDispatcher(self, self.thumb_insns)+
+                self._ARM_GenerateDispatcher(self.thumb_insns)+
                 'return false;\n'
                 )
 
@@ -664,6 +710,54 @@ class ArmArchConvertion(ArchConvertion):
 
         return res
 
+    # Generates the former dispatcher for src/bench, it calls the same handlers as Disassemble
+    def GenerateBenchmarkSource(self):
+        res = ''
+
+        res += 'bool BenchDisassembleArmCascade(ArmArchitecture& rArch, BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)\n'
+        res += self._GenerateBrace(
+                self._GenerateRead('Opcode32', 'Offset', 32)+
+                self._ARM_GenerateCascade(self.arm_insns)+
+                'return false;\n'
+                )
+
+        res += 'bool BenchDisassembleThumbCascade(ArmArchitecture& rArch, BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)\n'
+        res += self._GenerateBrace(
+                self._GenerateRead('Opcode16Low', 'Offset & ~1', 16)+
+                self._GenerateRead('Opcode16High', '(Offset + 2) & ~1', 16)+
+                Indent('u16 Opcode16 = Opcode16Low;\n', 0)+
+                Indent('u32 Opcode32 = ((Opcode16Low << 16) | Opcode16High);\n', 0)+
+                self._ARM_GenerateCascade(self.thumb_insns)+
+                'return false;\n'
+                )
+
+        res += 'bool BenchDisassembleCascade(ArmArchitecture& rArch, BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)\n'
+        res += self._GenerateBrace(
+                'rInsn.SetArchitectureTag(rArch.GetTag());\n'+
+                'rInsn.SetMode(Mode);\n\n'+
+                self._GenerateSwitch('Mode',
+                    [('ARM_ModeArm',   'return BenchDisassembleArmCascade(rArch, rBinStrm, Offset, rInsn);\n',   False),
+                     ('ARM_ModeThumb', 'return BenchDisassembleThumbCascade(rArch, rBinStrm, Offset, rInsn);\n', False)],
+                    'return false;\n')
+                )
+
+        # Dispatch-only variants of both dispatchers, they return the matched handler without calling it
+        res += 'typedef bool (ArmArchitecture::*BenchHandlerType)(BinaryStream const& rBinStrm, OffsetType Offset, u32 Opcode, Instruction& rInsn);\n'
+        arm_read = self._GenerateRead('Opcode32', 'Offset', 32)
+        thumb_read = (
+                self._GenerateRead('Opcode16Low', 'Offset & ~1', 16)+
+                self._GenerateRead('Opcode16High', '(Offset + 2) & ~1', 16)+
+                Indent('u16 Opcode16 = Opcode16Low;\n', 0)+
+                Indent('u32 Opcode32 = ((Opcode16Low << 16) | Opcode16High);\n', 0))
+        for mode, insns, read in [ ('Arm', self.arm_insns, arm_read), ('Thumb', self.thumb_insns, thumb_read) ]:
+            read = read.replace('return false;', 'return nullptr;')
+            res += 'BenchHandlerType BenchSelect%sTree(BinaryStream const& rBinStrm, OffsetType Offset)\n' % mode
+            res += self._GenerateBrace(read + self._ARM_GenerateDispatcher(insns, select = True) + 'return nullptr;\n')
+            res += 'BenchHandlerType BenchSelect%sCascade(BinaryStream const& rBinStrm, OffsetType Offset)\n' % mode
+            res += self._GenerateBrace(read + self._ARM_GenerateCascade(insns, select = True) + 'return nullptr;\n')
+
+        return res
+
     def GenerateOpcodeEnum(self):
         res = ',\n'.join('ARM_Opcode_%s' % x.capitalize() for x in ['unknown'] + sorted(self.all_mnemo)) + '\n'
         return 'enum ARM_Opcode\n' + self._GenerateBrace(res)[:-1] + ';\n'
@@ -34,6 +34,10 @@ class St62ArchConvertion(ArchConvertion):
     def GenerateHeader(self):
         res = ''
 
+        # templates are gathered while instructions and operands are generated
+        self.GenerateSource()
+        self.GenerateOperandCode()
+
         res += 'private:\n'
         res += Indent('typedef bool (%sArchitecture:: *TDisassembler)(BinaryStream const&, OffsetType, Instruction&, u8);\n' % self.GetArchName())
 
@@ -45,6 +49,9 @@ class St62ArchConvertion(ArchConvertion):
                 opcd_no += 1
             res += '\n'
 
+        res += Indent(self._GenerateTemplateDefinition())
+        res += '\n'
+
         return res
 
     def GenerateSource(self):
@@ -142,12 +149,12 @@ class St62ArchConvertion(ArchConvertion):
         if 'semantic' in opcd:
             if 'semantic_alt' in opcd:
                 res += 'if (Value & 0x10)\n'
-                res += self._ConvertSemanticToCode(opcd, opcd['semantic_alt'], self.id_mapper)
+                res += self._TemplateExpressions(self._ConvertSemanticToCode(opcd, opcd['semantic_alt'], self.id_mapper))
                 res += 'else\n'
-            res += self._ConvertSemanticToCode(opcd, opcd['semantic'], self.id_mapper)
+            res += self._TemplateExpressions(self._ConvertSemanticToCode(opcd, opcd['semantic'], self.id_mapper))
 
         else:
-            res += self._ConvertSemanticToCode(opcd, None, self.id_mapper)
+            res += self._TemplateExpressions(self._ConvertSemanticToCode(opcd, None, self.id_mapper))
         res += 'return true;\n'
         return res
 
@@ -326,7 +333,7 @@ class St62ArchConvertion(ArchConvertion):
             body = ''
             for oprd_sem in oprd_code:
                 nodes = ast.parse(oprd_sem)
-                s = v.visit(nodes)
+                s = self._TemplateExpressions(v.visit(nodes))
                 body += '// operand%d: %s\n%s' % (oprd_no, oprd_sem, s)
 
                 if not is_decoder and 'Oprd' in s:
@@ -343,4 +350,6 @@ class St62ArchConvertion(ArchConvertion):
                 body += 'return true;\n'
             res += self._GenerateBrace(body) + '\n'
 
+        res += self._GenerateTemplateInitialization()
+
         return res
@@ -9,6 +9,8 @@ class X86ArchConvertion(ArchConvertion):
         self.all_mnemo = set()
         self.all_oprd = set()
         self.all_dec = set()
+        self.dec_tbl = None
+        self.len_tbl = None
 
         self.id_mapper = {
         'cf':'X86_FlCf', 'pf':'X86_FlPf', 'af':'X86_FlAf', 'zf':'X86_FlZf',
@@ -35,10 +37,11 @@ class X86ArchConvertion(ArchConvertion):
         'r12':'X86_Reg_R12', 'r13':'X86_Reg_R13', 'r14':'X86_Reg_R14', 'r15':'X86_Reg_R15' }
 
     # Architecture dependant methods
+    # Decoders are specialized on the mode (X86_Bit_*), see X86Architecture::Disassemble
     def _X86_GenerateMethodName(self, type_name, opcd_no, in_class = False):
-        meth_fmt = 'bool %s(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)'
+        meth_fmt = 'template<u8 Mode> bool %s(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)'
         if in_class == False:
-            meth_fmt = 'bool %sArchitecture::%%s(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)' % self.GetArchName()
+            meth_fmt = 'template<u8 Mode>\nbool %sArchitecture::%%s(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)' % self.GetArchName()
 
         if opcd_no == None:
             return meth_fmt % 'Invalid'
@@ -164,7 +167,7 @@ class X86ArchConvertion(ArchConvertion):
             res += 'rInsn.Size()++;\n'
             if 'mnemonic' in opcd:
                 res += 'rInsn.Prefix() |= X86_Prefix_%s;\n' % opcd['mnemonic']
-            res += 'return Disassemble(rBinStrm, Offset, rInsn, Mode);\n'
+            res += 'return _Disassemble<Mode>(rBinStrm, Offset, rInsn);\n'
             return res
 
         if 'suffix' in opcd:
@@ -274,10 +277,14 @@ class X86ArchConvertion(ArchConvertion):
         if len(cond) == 0:
             return None
 
+        # Alternatives must not leak into the other conditions
+        if len(cond) > 1:
+            cond = [ '(%s)' % x if ' || ' in x else x for x in cond ]
+
         return ' && '.join(cond)
 
     def _X86_GenerateOperandMethod(self, oprd):
-        res = 'Operand__%s(rBinStrm, Offset, rInsn, Mode)' % '_'.join(oprd)
+        res = 'Operand__%s<Mode>(rBinStrm, Offset, rInsn)' % '_'.join(oprd)
         self.all_oprd.add('_'.join(oprd))
         return res
 
@@ -286,13 +293,13 @@ class X86ArchConvertion(ArchConvertion):
         tbl_off = ''
 
         if ref.startswith('table_FP'):
-            tbl_off = '- 0xc0'
+            tbl_off = ' - 0xc0'
 
         if ref.startswith('table_'):
             res += self._GenerateRead('Opcode', 'Offset', 8)
             res += 'rInsn.Size()++;\n'
-            res += self._GenerateCondition('if', 'Opcode + 1 > sizeof(m_%s)' % ref.capitalize(), 'return false;')
-            res += 'return (this->*m_%s[Opcode%s])(rBinStrm, Offset + 1, rInsn, Mode);\n' % (ref.capitalize(), tbl_off)
+            res += self._GenerateCondition('if', 'Opcode%s >= sizeof(m_%s) / sizeof(*m_%s)' % (tbl_off, ref.capitalize(), ref.capitalize()), 'return false;')
+            res += 'return _Decode<Mode>(m_%s[Opcode%s], rBinStrm, Offset + 1, rInsn);\n' % (ref.capitalize(), tbl_off)
 
         elif ref.startswith('group_'):
             grp = self.arch['instruction']['group'][ref]
@@ -340,59 +347,393 @@ class X86ArchConvertion(ArchConvertion):
         return res
 
 
-    def GenerateHeader(self):
-        res = ''
+    # Decode tables
+    def _X86_IsDataDriven(self, opcd):
+        # Only unconditional instructions are described by a decode entry,
+        # the remaining ones keep a dedicated handler
+        if 'sub_opcodes' in opcd or 'reference' in opcd:
+            return False
+        for key in [ 'cpu_model', 'attr', 'prefix', 'suffix' ]:
+            if key in opcd:
+                return False
+        if 'invalid' in opcd:
+            return True
+        if 'constraint' in opcd and opcd['constraint'].startswith('pfx'):
+            return False
+        return 'mnemonic' in opcd
 
-        res += 'private:\n'
-        res += Indent('typedef bool (%sArchitecture:: *TDisassembler)(BinaryStream const&, OffsetType, Instruction&, u8);\n' % self.GetArchName())
+    def _X86_GenerateDecodeEntry(self, opcd):
+        if 'invalid' in opcd:
+            return ('X86_Opcode_Unknown', 0, 0, 0, '0', 'DecodeInvalid')
 
-        for name in sorted(self.arch['instruction']['table']):
-            if 'FP' in name:  opcd_no = 0xc0
-            else:             opcd_no = 0x00
+        flags = []
+        if 'constraint' in opcd and (opcd['constraint'] == 'd64' or opcd['constraint'] == 'df64'):
+            flags.append('DecodeD64')
 
-            res += Indent('static const TDisassembler m_%s[%#x];\n' % (name.capitalize(), 0x100 - opcd_no))
-            for opcd in self.arch['instruction']['table'][name]:
-                res += Indent('%s;\n' % self._X86_GenerateMethodName(name, opcd_no, True))
-                opcd_no += 1
-            res += '\n'
+        mnem = opcd['mnemonic'].capitalize()
+        self.all_mnemo.add(mnem)
 
-        return res
+        conv_optype = { 'jmp':'Instruction::JumpType', 'call':'Instruction::CallType', 'ret':'Instruction::ReturnType', 'cond':'Instruction::ConditionalType' }
+        sub_type = '0'
+        if 'operation_type' in opcd:
+            sub_type = ' | '.join(conv_optype[x] for x in opcd['operation_type'])
 
-    def GenerateSource(self):
-	tbl = {}
-	res = ''
-        arch_name = self.GetArchName()
+        oprd_no = 0
+        if 'operand' in opcd:
+            oprd_name = '_'.join(opcd['operand'])
+            self.all_oprd.add(oprd_name)
+            if not oprd_name in self.dec_oprd:
+                self.dec_oprd.append(oprd_name)
+            oprd_no = self.dec_oprd.index(oprd_name)
+
+        # Identical semantics are shared between opcodes
+        sem_code = self._ConvertSemanticToCode(opcd, opcd.get('semantic'), self.id_mapper)
+        sem_no = 0
+        if len(sem_code) != 0:
+            if not sem_code in self.dec_sem_no:
+                self.dec_sem_no[sem_code] = len(self.dec_sem)
+                self.dec_sem.append(sem_code)
+            sem_no = self.dec_sem_no[sem_code]
+
+        if len(flags) == 0:
+            flags.append('0')
+        return ('X86_Opcode_%s' % mnem, oprd_no, sem_no, 0, sub_type, ' | '.join(flags))
+
+    def _X86_BuildDecodeTables(self):
+        if self.dec_tbl != None:
+            return self.dec_tbl
+
+        self.dec_tbl = {}
+        self.dec_hnd = []
+        self.dec_oprd = [ None ]
+        self.dec_sem = [ None ]
+        self.dec_sem_no = {}
 
         for name in sorted(self.arch['instruction']['table']):
             if 'FP' in name:  opcd_no = 0xc0
             else:             opcd_no = 0x00
 
-            res += 'const %sArchitecture::TDisassembler %sArchitecture::m_%s[%#x] =\n' % (arch_name, arch_name, name.capitalize(), 0x100 - opcd_no)
-            res += '{\n'
-            tbl_elm = []
+            entries = []
             for opcd in self.arch['instruction']['table'][name]:
-                tbl_elm.append(Indent('&%sArchitecture::%s_%02x\n' % (arch_name, name.capitalize(), opcd_no))[:-1])
+                if self._X86_IsDataDriven(opcd):
+                    entries.append((opcd_no, None, self._X86_GenerateDecodeEntry(opcd)))
+                else:
+                    hnd_name = '%s_%02x' % (name.capitalize(), opcd_no)
+                    entries.append((opcd_no, opcd, ('X86_Opcode_Unknown', 0, 0, len(self.dec_hnd), '0', 'DecodeHandler')))
+                    self.dec_hnd.append(hnd_name)
                 opcd_no += 1
-            res += ',\n'.join(tbl_elm)
-            res += '\n};\n\n'
+            self.dec_tbl[name] = entries
+
+        return self.dec_tbl
+
+    # Length tables
+    len_imm_kind = { '': 'LengthImmNone', 'b': 'LengthImmB', 'bb': 'LengthImmBB', 'w': 'LengthImmW', 'wb': 'LengthImmWB',
+            'z': 'LengthImmZ', 'v': 'LengthImmV', 'o': 'LengthImmMoffs', 'p': 'LengthImmFarPtr' }
+    len_imm_oprd = { 'Ib': 'b', 'Ibs': 'b', 'Ibsq': 'b', 'Jb': 'b', 'Lx': 'b', 'Iw': 'w', 'Iz': 'z', 'Izsq': 'z', 'Jz': 'z',
+            'Iv': 'v', 'Ob': 'o', 'Ov': 'o', 'Ap': 'p' }
+    len_reg_oprd = [ '1', '3', 'AL', 'AH', 'AX', 'BL', 'BH', 'CL', 'CH', 'DL', 'DH', 'DX', 'CS', 'DS', 'ES', 'SS', 'FS', 'GS' ]
+    len_prefix = { 'OpSize': 'LengthPrefixOpSize', 'AdSize': 'LengthPrefixAdSize' }
+
+    def _X86_GetOperandLength(self, oprd):
+        modrm = False
+        imm = ''
+        for o in oprd:
+            if o in self.len_imm_oprd:
+                imm += self.len_imm_oprd[o]
+            elif o in self.len_reg_oprd or o in [ 'b', 'w', 'x' ] or o[0] in 'eHBXYr' or o.startswith('d64_') or o.startswith('ST'):
+                pass
+            elif o[0] in 'EGMRCDSTVWUPQNm':
+                modrm = True
+            else:
+                raise Exception('Unknown operand %s' % o)
+        return (modrm, imm)
 
-            tbl[name] = res
-            res = ''
+    def _X86_GetLengthAlternatives(self, opcd, oprd = None):
+        if 'sub_opcodes' in opcd:
+            res = []
+            for sub_opcd in opcd['sub_opcodes']:
+                res += self._X86_GetLengthAlternatives(sub_opcd, oprd)
+            return res
 
-        for name in sorted(self.arch['instruction']['table']):
-            if 'FP' in name: opcd_no = 0xc0
-            else:            opcd_no = 0x00
+        attr = opcd.get('attr', [])
+        if 'invalid' in opcd:
+            return [ ('inv', attr) ]
+        if 'constraint' in opcd and opcd['constraint'].startswith('pfx'):
+            return [ ('pfx', attr, opcd.get('mnemonic')) ]
+        if 'reference' in opcd:
+            return [ ('ref', attr, opcd['reference'], opcd.get('operand')) ]
 
+        conv_optype = { 'jmp':'Instruction::JumpType', 'call':'Instruction::CallType', 'ret':'Instruction::ReturnType', 'cond':'Instruction::ConditionalType' }
+        sub_type = '0'
+        if 'operation_type' in opcd:
+            sub_type = ' | '.join(conv_optype[x] for x in opcd['operation_type'])
+        if 'operand' in opcd:
+            oprd = opcd['operand']
+        modrm, imm = self._X86_GetOperandLength(oprd or [])
+        # the suffix is stored in the ModR/M byte
+        if 'suffix' in opcd:
+            modrm = True
+        return [ ('insn', attr, modrm, imm, sub_type) ]
+
+    def _X86_GenerateLengthEntry(self, alts, in_group = False):
+        # Returns (flags, immediate, sub type, index)
+        def Entry(flags, imm = '', sub_type = '0', idx = '0'):
+            if len(flags) == 0:
+                flags = [ '0' ]
+            return (' | '.join(flags), self.len_imm_kind[imm], sub_type, idx)
+
+        valid = [ x for x in alts if x[0] != 'inv' ]
+        if len(valid) == 0:
+            return Entry([ 'LengthInvalid' ])
+
+        # Prefixes only exist in the first table, REX and VEX are prefixes only in 64-bit mode
+        pfx = [ x for x in valid if x[0] == 'pfx' ]
+        insn = [ x for x in valid if x[0] == 'insn' ]
+        if len(pfx) != 0 and in_group:
+            return Entry([ 'LengthSlow' ])
+        if len(pfx) != 0:
+            pfx_kind = 'LengthPrefixOther'
+            if pfx[0][2] in self.len_prefix:
+                pfx_kind = self.len_prefix[pfx[0][2]]
+            elif pfx[0][2].startswith('REX'):
+                pfx_kind = 'LengthPrefixRexW' if 'w' in pfx[0][2][4:] else 'LengthPrefixRex'
+            if len(insn) == 0:
+                return Entry([ 'LengthPrefix' ], idx = pfx_kind)
+            if not 'm64' in pfx[0][1] or len(set(x[2:4] for x in insn)) != 1:
+                return Entry([ 'LengthSlow' ])
+            flags = [ 'LengthPrefix64' ]
+            if insn[0][2]:
+                flags.append('LengthModRm')
+            return Entry(flags, insn[0][3], insn[0][4], pfx_kind)
+
+        refs = [ x for x in valid if x[0] == 'ref' ]
+        if len(refs) != 0:
+            if len(refs) != 1 or len(insn) != 0:
+                return Entry([ 'LengthSlow' ])
+            ref = refs[0][2]
+            if ref.startswith('table_'):
+                return Entry([ 'LengthEscape' ], idx = 'LengthTable_%s' % ref[6:])
+            if ref.startswith('fpu'):
+                return Entry([ 'LengthModRm' ])
+            # group: one entry per ModR/M.reg
+            grp = []
+            for opcd_g in self.arch['instruction']['group'][ref]:
+                if type(opcd_g) == list:
+                    opcd_g = { 'sub_opcodes': opcd_g }
+                grp.append(self._X86_GenerateLengthEntry(self._X86_GetLengthAlternatives(opcd_g, refs[0][3]), True))
+            while len(grp) != 8:
+                grp.append(Entry([ 'LengthInvalid' ]))
+            if not grp in self.len_grp:
+                self.len_grp.append(grp)
+            return Entry([ 'LengthModRm', 'LengthGroup' ], idx = '%#04x' % self.len_grp.index(grp))
+
+        # Forms which depend on mandatory prefixes, cpu model or vendor are left to the full decoder
+        if len(set(x[2:] for x in insn)) != 1:
+            return Entry([ 'LengthSlow' ])
+        flags = []
+        if insn[0][2]:
+            flags.append('LengthModRm')
+        if all('nm64' in x[1] for x in insn):
+            flags.append('LengthNo64')
+        return Entry(flags, insn[0][3], insn[0][4])
+
+    def _X86_BuildLengthTables(self):
+        # Generating the source updates groups operands, so length tables are built once from the original description
+        if self.len_tbl != None:
+            return self.len_tbl
+
+        self.len_grp = []
+        len_tbl = {}
+        for name in sorted(self.arch['instruction']['table']):
+            if 'FP' in name:
+                continue
+            entries = []
             for opcd in self.arch['instruction']['table'][name]:
+                entries.append(self._X86_GenerateLengthEntry(self._X86_GetLengthAlternatives(opcd)))
+            len_tbl[name] = entries
+        self.len_tbl = len_tbl
+        return self.len_tbl
+
+    def GenerateLengthSource(self):
+        res = ''
+        arch_name = self.GetArchName()
+        len_tbl = self._X86_BuildLengthTables()
+
+        def Table(decl, entries):
+            res = '%s =\n{\n' % decl if decl else '{\n'
+            for opcd_no, entry in enumerate(entries):
+                sep = ',' if opcd_no + 1 != len(entries) else ' '
+                res += Indent('{ %s, %s, %s, %s }' % entry + sep + ' /* %02x */\n' % opcd_no)
+            return res + '}'
+
+        for name in sorted(len_tbl):
+            res += Table('const %sArchitecture::LengthEntry %sArchitecture::m_Length_%s[%#x]' % (arch_name, arch_name, name.capitalize(), len(len_tbl[name])), len_tbl[name])
+            res += ';\n\n'
+
+        grps = []
+        for grp in self.len_grp:
+            grps.append(Indent(Table('', grp).strip()))
+        res += 'const %sArchitecture::LengthEntry %sArchitecture::m_LengthGroup[%#x][8] =\n{\n' % (arch_name, arch_name, len(self.len_grp))
+        res += ',\n'.join(grps)
+        res += '\n};\n\n'
+
+        res += 'const %sArchitecture::LengthEntry* const %sArchitecture::m_LengthTable[LengthTableCount] =\n{\n' % (arch_name, arch_name)
+        res += ',\n'.join(Indent('m_Length_%s' % x.capitalize()) for x in sorted(len_tbl))
+        res += '\n};\n'
+
+        return res
+
+    def GenerateLengthHeader(self):
+        res = ''
+        tbl_names = sorted(x for x in self.arch['instruction']['table'] if not 'FP' in x)
+
+        res += Indent('enum LengthFlag\n')
+        res += Indent(self._GenerateBrace(
+            'LengthModRm    = 1 << 0, //!< a ModR/M byte follows the opcode, in a group it tells if this byte is part of the instruction\n'+
+            'LengthPrefix   = 1 << 1, //!< the byte is a prefix, m_Index holds its LengthPrefixKind\n'+
+            'LengthPrefix64 = 1 << 2, //!< same as LengthPrefix but only in 64-bit mode\n'+
+            'LengthNo64     = 1 << 3, //!< the opcode is not valid in 64-bit mode\n'+
+            'LengthInvalid  = 1 << 4, //!< the opcode is not valid\n'+
+            'LengthEscape   = 1 << 5, //!< the next byte is looked up in m_LengthTable[m_Index]\n'+
+            'LengthGroup    = 1 << 6, //!< ModR/M.reg selects the entry in m_LengthGroup[m_Index]\n'+
+            'LengthSlow     = 1 << 7, //!< the length depends on mandatory prefixes or cpu model, the full decoder is used\n')[:-1] + ';\n')
+        res += '\n'
+        res += Indent('enum LengthImmediate\n')
+        res += Indent(self._GenerateBrace(
+            'LengthImmNone, LengthImmB, LengthImmBB, LengthImmW, LengthImmWB,\n'+
+            'LengthImmZ,      //!< 16 or 32-bit depending on the operand size\n'+
+            'LengthImmV,      //!< 16, 32 or 64-bit depending on the operand size\n'+
+            'LengthImmMoffs,  //!< depends on the address size\n'+
+            'LengthImmFarPtr, //!< segment and offset, the offset depends on the address size\n')[:-1] + ';\n')
+        res += '\n'
+        res += Indent('enum LengthPrefixKind\n')
+        res += Indent(self._GenerateBrace(
+            'LengthPrefixOther, LengthPrefixOpSize, LengthPrefixAdSize, LengthPrefixRex, LengthPrefixRexW\n')[:-1] + ';\n')
+        res += '\n'
+        res += Indent('enum LengthTable\n')
+        res += Indent(self._GenerateBrace(
+            ',\n'.join('LengthTable_%s' % x[6:] for x in tbl_names) + ',\n' + 'LengthTableCount\n')[:-1] + ';\n')
+        res += '\n'
+        res += Indent('struct LengthEntry\n')
+        res += Indent(self._GenerateBrace(
+            'u8 m_Flags;     //!< LengthFlag\n'+
+            'u8 m_Immediate; //!< LengthImmediate\n'+
+            'u8 m_SubType;   //!< Instruction::*Type\n'+
+            'u8 m_Index;     //!< LengthPrefixKind, LengthTable or group index depending on m_Flags\n')[:-1] + ';\n')
+        res += '\n'
+        for name in tbl_names:
+            res += Indent('static const LengthEntry m_Length_%s[0x100];\n' % name.capitalize())
+        self._X86_BuildLengthTables()
+        res += Indent('static const LengthEntry m_LengthGroup[%#x][8];\n' % len(self.len_grp))
+        res += Indent('static const LengthEntry* const m_LengthTable[LengthTableCount];\n')
+        res += '\n'
+        return res
+
+    def GenerateHeader(self):
+        res = ''
+        dec_tbl = self._X86_BuildDecodeTables()
+
+        res += 'private:\n'
+        res += Indent('typedef bool (%sArchitecture:: *TDisassembler)(BinaryStream const&, OffsetType, Instruction&);\n' % self.GetArchName())
+        res += Indent('typedef void (%sArchitecture:: *TSemanticBuilder)(Instruction&, u8);\n' % self.GetArchName())
+        res += '\n'
+        res += Indent('enum DecodeFlag\n')
+        res += Indent(self._GenerateBrace(
+            'DecodeInvalid = 1 << 0, //!< the opcode is not valid\n'+
+            'DecodeHandler = 1 << 1, //!< the opcode needs a dedicated handler\n'+
+            'DecodeD64     = 1 << 2, //!< the operand size defaults to 64-bit in long mode\n')[:-1] + ';\n')
+        res += '\n'
+        res += Indent('struct DecodeEntry\n')
+        res += Indent(self._GenerateBrace(
+            'u16 m_Opcode;   //!< X86_Opcode_*\n'+
+            'u16 m_Operand;  //!< index in DecodeTable::m_OperandDecoder, 0 means no operand\n'+
+            'u16 m_Semantic; //!< index in m_SemanticBuilder, 0 means no semantic\n'+
+            'u16 m_Handler;  //!< index in DecodeTable::m_Handler if DecodeHandler is set\n'+
+            'u8  m_SubType;  //!< Instruction::*Type\n'+
+            'u8  m_Flags;    //!< DecodeFlag\n')[:-1] + ';\n')
+        res += '\n'
+
+        for name in sorted(dec_tbl):
+            res += Indent('static const DecodeEntry m_%s[%#x];\n' % (name.capitalize(), len(dec_tbl[name])))
+            for opcd_no, opcd, entry in dec_tbl[name]:
+                if opcd != None:
+                    res += Indent('%s;\n' % self._X86_GenerateMethodName(name, opcd_no, True))
+            res += '\n'
+
+        res += Indent('template<u8 Mode> struct DecodeTable\n')
+        res += Indent(self._GenerateBrace(
+            'static const TDisassembler    m_Handler[%#x];\n' % len(self.dec_hnd)+
+            'static const TDisassembler    m_OperandDecoder[%#x];\n' % len(self.dec_oprd))[:-1] + ';\n')
+        res += Indent('static const TSemanticBuilder m_SemanticBuilder[%#x];\n' % len(self.dec_sem))
+        for sem_no in range(1, len(self.dec_sem)):
+            res += Indent('void Semantic_%03x(Instruction& rInsn, u8 Mode);\n' % sem_no)
+        res += '\n'
+
+        res += self.GenerateLengthHeader()
+
+        return res
+
+    def GenerateSource(self):
+        tbl = {}
+        res = ''
+        arch_name = self.GetArchName()
+        dec_tbl = self._X86_BuildDecodeTables()
+
+        for name in sorted(dec_tbl):
+            res += 'const %sArchitecture::DecodeEntry %sArchitecture::m_%s[%#x] =\n' % (arch_name, arch_name, name.capitalize(), len(dec_tbl[name]))
+            res += '{\n'
+            for opcd_no, opcd, entry in dec_tbl[name]:
+                sep = ','
+                if opcd_no == dec_tbl[name][-1][0]:
+                    sep = ' '
+                res += Indent('{ %s, %#05x, %#05x, %#05x, %s, %s }' % entry + sep + ' /* %02x */\n' % opcd_no)
+            res += '};\n\n'
+
+            hnd_names = []
+            for opcd_no, opcd, entry in dec_tbl[name]:
+                if opcd == None:
+                    continue
                 res += self._X86_GenerateInstructionComment(opcd)
                 res += '%s\n' % self._X86_GenerateMethodName(name, opcd_no, False)
                 res += self._GenerateBrace(Indent(self._X86_GenerateInstruction(opcd)))
                 res += '\n'
-                opcd_no += 1
+                hnd_names.append('%s_%02x' % (name.capitalize(), opcd_no))
 
-            tbl[name] += res
+            for hnd_name in hnd_names:
+                res += 'X86_INSTANTIATE_DISASSEMBLER(%s);\n' % hnd_name
+
+            tbl[name] = res
             res = ''
 
+        res += 'template<u8 Mode>\n'
+        res += 'const %sArchitecture::TDisassembler %sArchitecture::DecodeTable<Mode>::m_Handler[%#x] =\n' % (arch_name, arch_name, len(self.dec_hnd))
+        res += '{\n'
+        res += ',\n'.join(Indent('&%sArchitecture::%s<Mode>' % (arch_name, x)) for x in self.dec_hnd)
+        res += '\n};\n\n'
+
+        res += 'template<u8 Mode>\n'
+        res += 'const %sArchitecture::TDisassembler %sArchitecture::DecodeTable<Mode>::m_OperandDecoder[%#x] =\n' % (arch_name, arch_name, len(self.dec_oprd))
+        res += '{\n'
+        res += ',\n'.join(Indent('nullptr' if x == None else '&%sArchitecture::Operand__%s<Mode>' % (arch_name, x)) for x in self.dec_oprd)
+        res += '\n};\n\n'
+
+        for mode in [ 'X86_Bit_16', 'X86_Bit_32', 'X86_Bit_64' ]:
+            res += 'template struct %sArchitecture::DecodeTable<%s>;\n' % (arch_name, mode)
+        res += '\n'
+
+        res += 'const %sArchitecture::TSemanticBuilder %sArchitecture::m_SemanticBuilder[%#x] =\n' % (arch_name, arch_name, len(self.dec_sem))
+        res += '{\n'
+        res += ',\n'.join(Indent('nullptr' if sem_no == 0 else '&%sArchitecture::Semantic_%03x' % (arch_name, sem_no)) for sem_no in range(len(self.dec_sem)))
+        res += '\n};\n\n'
+
+        for sem_no in range(1, len(self.dec_sem)):
+            res += 'void %sArchitecture::Semantic_%03x(Instruction& rInsn, u8 Mode)\n' % (arch_name, sem_no)
+            res += self.dec_sem[sem_no]
+            res += '\n'
+
+        tbl['decoder'] = res
+        tbl['length'] = self.GenerateLengthSource()
+
         return tbl
 
     def GenerateOpcodeEnum(self):
@@ -409,9 +750,9 @@ class X86ArchConvertion(ArchConvertion):
         for oprd_name in self.arch['operand']:
             oprd_name = str(oprd_name)
             if oprd_name.startswith('decode_'):
-                res += Indent('Expression::SPType %s(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode);\n' % (oprd_name[0].upper() + oprd_name[1:]))
+                res += Indent('template<u8 Mode> Expression::SPType %s(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn);\n' % (oprd_name[0].upper() + oprd_name[1:]))
             else:
-                res += Indent('bool Operand__%s(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode);\n' % (oprd_name))
+                res += Indent('template<u8 Mode> bool Operand__%s(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn);\n' % (oprd_name))
         return res
 
     def GenerateOperandCode(self):
@@ -573,7 +914,7 @@ class X86ArchConvertion(ArchConvertion):
 
                 if func_name == 'call':
                     assert(len(func_args) == 1)
-                    return 'return __%s(rBinStrm, Offset, rInsn, Mode);' % func_args[0]
+                    return 'return __%s<Mode>(rBinStrm, Offset, rInsn);' % func_args[0]
 
                 if func_name.startswith('read_'):
                     read_type = func_name[5]
@@ -696,7 +1037,7 @@ class X86ArchConvertion(ArchConvertion):
                     return node_name
 
                 if node_name.startswith('decode_'):
-                    return '%s(rBinStrm, Offset, rInsn, Mode)' % (node_name[0].upper() + node_name[1:])
+                    return '%s<Mode>(rBinStrm, Offset, rInsn)' % (node_name[0].upper() + node_name[1:])
 
                 if node_name == 'next_operand':
                     return '(rInsn.GetSize() - LastLen)'
@@ -755,6 +1096,7 @@ class X86ArchConvertion(ArchConvertion):
             def visit_Expr(self, node):
                 return self.visit(node.value)
 
+        oprd_names = []
         for oprd in sorted(self.arch['operand'].items(), key = lambda x: x[0]):
             oprd_name = str(oprd[0])
             oprd_code = oprd[1]
@@ -766,10 +1108,13 @@ class X86ArchConvertion(ArchConvertion):
 
             if is_decoder:
                 res += '/* decoder %s */\n' % oprd_code
-                res += 'Expression::SPType %sArchitecture::%s(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)\n' % (self.GetArchName(), oprd_name[0].upper() + oprd_name[1:])
+                res += 'template<u8 Mode>\n'
+                res += 'Expression::SPType %sArchitecture::%s(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)\n' % (self.GetArchName(), oprd_name[0].upper() + oprd_name[1:])
             else:
                 res += '/* operand %s */\n' % oprd_code
-                res += 'bool %sArchitecture::Operand__%s(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)\n' % (self.GetArchName(), oprd_name)
+                res += 'template<u8 Mode>\n'
+                res += 'bool %sArchitecture::Operand__%s(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)\n' % (self.GetArchName(), oprd_name)
+                oprd_names.append(oprd_name)
 
             v = OprdVisitor(self)
             oprd_no = 0
@@ -793,4 +1138,8 @@ class X86ArchConvertion(ArchConvertion):
                 body += 'return true;\n'
             res += self._GenerateBrace(body) + '\n'
 
+        # operands are used by the handlers and the decode tables
+        for oprd_name in oprd_names:
+            res += 'X86_INSTANTIATE_DISASSEMBLER(Operand__%s);\n' % oprd_name
+
         return res
@@ -120,9 +120,13 @@ class Z80ArchConvertion(ArchConvertion):
 
                 for expr in v.var_expr[:-1]:
                     res += expr
-            res += 'auto spOprd%d = %s;\n' % (oprd_no, v.var_expr[-1])
-            res += self._GenerateCondition('if', 'spOprd%d == nullptr' % oprd_no, 'return false;')
-            res += 'rInsn.AddOperand(spOprd%d);\n' % oprd_no
+            oprd_expr = self._TemplateExpressions(v.var_expr[-1])
+            if self._IsTemplate(oprd_expr):
+                res += 'rInsn.AddOperand(%s);\n' % oprd_expr
+            else:
+                res += 'auto spOprd%d = %s;\n' % (oprd_no, oprd_expr)
+                res += self._GenerateCondition('if', 'spOprd%d == nullptr' % oprd_no, 'return false;')
+                res += 'rInsn.AddOperand(spOprd%d);\n' % oprd_no
 
             oprd_no += 1
         return res
@@ -135,7 +139,7 @@ class Z80ArchConvertion(ArchConvertion):
         for insn in sorted(tbl, key = lambda i: i['opcode']):
             case_stmt = ''
             if 'reference' in insn:
-                case_stmt += 'rInsn.Size() += %d;\n' % (depth + 1)
+                # the nested dispatcher accounts for its own opcode byte
                 case_stmt += self._GenerateBrace(self._Z80_GenerateDispatcher(self.arch['instruction'][insn['reference']], depth + 1))
             else:
                 case_stmt += 'rInsn.SetName("%s");\n' % insn['mnemonic']
@@ -167,12 +171,16 @@ class Z80ArchConvertion(ArchConvertion):
 
 
     def GenerateHeader(self):
-        return ''
+        # templates are gathered while the dispatcher is generated
+        self.GenerateSource()
+        return self._GenerateTemplateDefinition()
 
     def GenerateSource(self):
         dispatcher = self._Z80_GenerateDispatcher(self.arch['instruction']['table'], 0)
 
-        return 'bool Z80Architecture::Disassemble(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)\n{\n%s}\n' % Indent(dispatcher)
+        res = 'bool Z80Architecture::Disassemble(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)\n{\n%s}\n' % Indent(dispatcher)
+        res += self._GenerateTemplateInitialization()
+        return res
 
     def GenerateOpcodeEnum(self):
         return ''
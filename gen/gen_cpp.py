@@ -53,5 +53,12 @@ def main():
             arch_cpp.write('#include "%s_architecture.hpp"\n' % arch_name)
             arch_cpp.write(src)
 
+        # the baseline of a benchmark, it goes to src/bench
+        if hasattr(conv, 'GenerateBenchmarkSource'):
+            bench_cpp = open('bench_%s_dispatch.cpp' % arch_name, 'w')
+            bench_cpp.write(conv.GenerateBanner())
+            bench_cpp.write('#include "%s_architecture.hpp"\n' % arch_name)
+            bench_cpp.write(conv.GenerateBenchmarkSource())
+
 if __name__ == "__main__":
     main()
@@ -0,0 +1,63 @@
+#ifndef MEDUSA_ANALYSIS_CACHE_HPP
+#define MEDUSA_ANALYSIS_CACHE_HPP
+
+#include "medusa/namespace.hpp"
+#include "medusa/types.hpp"
+#include "medusa/export.hpp"
+#include "medusa/address.hpp"
+#include "medusa/binary_stream.hpp"
+#include "medusa/memory_area.hpp"
+
+#include <string>
+#include <vector>
+
+MEDUSA_NAMESPACE_BEGIN
+
+class Document;
+
+//! AnalysisCache keeps the result of an analysis on disk (cells, functions, labels, cross references and comments).
+//! One entry is stored for the whole file and one for each memory area, both are keyed by the SHA1 of their content.
+//! A memory area key also contains its base address, since cross references are stored as absolute addresses.
+//! A complete hit on the whole file allows to skip the analysis, a memory area shared by several files is only reused.
+class MEDUSA_EXPORT AnalysisCache
+{
+public:
+  //! The cache is disabled if rCachePath is empty.
+  AnalysisCache(Path const& rCachePath);
+
+  bool IsEnabled(void) const { return !m_CachePath.empty(); }
+
+  /*! This method hashes [Offset, Offset + Length) chunk by chunk using several threads.
+   * \return Returns the SHA1 of all chunk digests, thus it differs from BinaryStream::GetSha1.
+   */
+  static std::string ComputeKey(BinaryStream const& rBinStrm, OffsetType Offset, u64 Length, u32 ThreadCount = 0);
+
+  /*! This method restores cached results into rDoc, memory areas must be mapped already.
+   * \param rFileKey is the key of the whole binary stream, @see ComputeKey.
+   * \param rComplete is set to true if the whole file was found in the cache.
+   * \return Returns true if at least one memory area was restored.
+   */
+  bool Load(Document& rDoc, std::string const& rFileKey, bool& rComplete) const;
+
+  //! This method saves the content of rDoc for the whole file and for each memory area.
+  bool Store(Document const& rDoc) const;
+
+private:
+  struct AreaEntry
+  {
+    MemoryArea  m_MemoryArea;
+    std::string m_Key;
+  };
+  typedef std::vector<AreaEntry> AreaEntryVector;
+
+  void _GetAreaEntries(Document const& rDoc, std::string const& rFileKey, AreaEntryVector& rAreaEntries) const;
+  bool _LoadArea(Document& rDoc, MemoryArea const& rMemArea, std::string const& rKey) const;
+  bool _StoreArea(Document const& rDoc, MemoryArea const& rMemArea, std::string const& rKey) const;
+  Path _GetEntryPath(std::string const& rKey, char const* pExtension) const;
+
+  Path m_CachePath;
+};
+
+MEDUSA_NAMESPACE_END
+
+#endif // !MEDUSA_ANALYSIS_CACHE_HPP
@@ -16,6 +16,7 @@
 #include "medusa/character.hpp"
 #include "medusa/value.hpp"
 #include "medusa/instruction.hpp"
+#include "medusa/instruction_buffer.hpp"
 #include "medusa/string.hpp"
 
 #include "medusa/function.hpp"
@@ -43,6 +44,13 @@ public:
   typedef std::tuple<const char*, u8>   NamedMode;
   typedef std::vector<NamedMode>        NamedModeVector;
 
+  //! InsnClass holds what a length only decoder returns
+  struct InsnClass
+  {
+    u16 m_Length;  //!< size of the instruction in bytes
+    u8  m_SubType; //!< Instruction::*Type
+  };
+
   Architecture(Tag ArchTag);
 
   //! This method returns the name of the current architecture.
@@ -57,6 +65,18 @@ public:
   //! This method disassembles one instruction.
   virtual bool Disassemble(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode);
 
+  /*! This method disassembles straight-line code and appends instructions to rInsnBuf.
+   * It stops after MaxInsns instructions or, if StopOnBranch is set, after a jump, a call or a return.
+   * \return Returns false if an instruction can't be decoded, the previous ones are kept in rInsnBuf.
+   */
+  virtual bool DisassembleBlock(BinaryStream const& rBinStrm, OffsetType Offset, u8 Mode, u32 MaxInsns, bool StopOnBranch, InstructionBuffer& rInsnBuf);
+
+  /*! This method only computes the length and the kind of one instruction.
+   * It is meant for sweeps and function sizing where operands and semantic are not needed,
+   * the default implementation relies on Disassemble.
+   */
+  virtual bool DecodeLength(BinaryStream const& rBinStrm, OffsetType Offset, u8 Mode, InsnClass& rInsnCls);
+
   //! This method returns all available mode
   virtual NamedModeVector GetModes(void) const = 0;
   u8 GetModeByName(std::string const &rModeName) const;
@@ -172,6 +192,24 @@ public:
     PrintData          & rPrintData) const;
 
 protected:
+  //! This method implements DisassembleBlock, architectures give their own Disassemble to avoid a virtual call per instruction.
+  template<typename DisasmType>
+  bool _DisassembleBlock(BinaryStream const& rBinStrm, OffsetType Offset, u8 Mode, u32 MaxInsns, bool StopOnBranch, InstructionBuffer& rInsnBuf, DisasmType Disasm)
+  {
+    for (u32 InsnNo = 0; InsnNo < MaxInsns; ++InsnNo)
+    {
+      auto spInsn = rInsnBuf.MakeInstruction();
+      if (!Disasm(rBinStrm, Offset, *spInsn, Mode) || spInsn->GetSize() == 0)
+        return false;
+      rInsnBuf.PushBack(spInsn);
+
+      if (StopOnBranch && (spInsn->GetSubType() & (Instruction::JumpType | Instruction::CallType | Instruction::ReturnType)))
+        break;
+      Offset += spInsn->GetSize();
+    }
+    return true;
+  }
+
   Tag                m_Tag;
 };
 
@@ -0,0 +1,80 @@
+#ifndef MEDUSA_ARENA_HPP
+#define MEDUSA_ARENA_HPP
+
+#include "medusa/namespace.hpp"
+#include "medusa/types.hpp"
+#include "medusa/export.hpp"
+
+#include <memory>
+#include <vector>
+
+MEDUSA_NAMESPACE_BEGIN
+
+//! Arena carves memory from chunks with a bump pointer, nothing is released before the whole arena.
+//! Chunks grow from 4 KiB to 64 KiB, a small arena only keeps a small chunk alive.
+//! The trade-off is that one live object pins every chunk of its arena: objects which outlive the arena
+//! owner (e.g. instructions stored in the document) keep all the used chunks alive. Trim releases the
+//! unused chunks before such an arena is handed off.
+//! An arena is not thread-safe, it is meant to be filled by one thread at a time.
+class MEDUSA_EXPORT Arena
+{
+public:
+  Arena(void);
+  ~Arena(void);
+
+  void* Allocate(size_t Size, size_t Align);
+
+  //! This method makes the chunks available again, it must not be called while an allocation is in use.
+  void Rewind(void);
+
+  //! This method releases the chunks which do not hold any allocation yet.
+  void Trim(void);
+
+  //! This method returns the number of bytes reserved by the chunks.
+  size_t GetReservedSize(void) const;
+
+private:
+  Arena(Arena const&);
+  Arena& operator=(Arena const&);
+
+  static size_t const MinChunkSize = 0x1000;
+  static size_t const MaxChunkSize = 0x10000;
+
+  struct Chunk
+  {
+    std::unique_ptr<u8[]> m_spData;
+    size_t                m_Size;
+  };
+
+  std::vector<Chunk> m_Chunks;
+  size_t             m_CurChunk;
+  size_t             m_CurOff;
+};
+
+//! ArenaAllocator is meant to be used with std::allocate_shared. The allocator is copied in
+//! the control block of each shared pointer, thus the arena lives as long as one of its object is referenced.
+template<typename T>
+struct ArenaAllocator
+{
+  typedef T value_type;
+
+  ArenaAllocator(std::shared_ptr<Arena> const& rspArena) : m_spArena(rspArena) {}
+  template<typename U> ArenaAllocator(ArenaAllocator<U> const& rAlloc) : m_spArena(rAlloc.m_spArena) {}
+
+  T* allocate(size_t Count)
+  {
+    return static_cast<T*>(m_spArena->Allocate(Count * sizeof(T), alignof(T)));
+  }
+
+  // Memory is only reclaimed when the whole arena is released or rewound
+  void deallocate(T*, size_t) {}
+
+  template<typename U> bool operator==(ArenaAllocator<U> const& rAlloc) const { return m_spArena == rAlloc.m_spArena; }
+  template<typename U> bool operator!=(ArenaAllocator<U> const& rAlloc) const { return m_spArena != rAlloc.m_spArena; }
+
+  std::shared_ptr<Arena> m_spArena;
+};
+
+MEDUSA_NAMESPACE_END
+
+#endif // !MEDUSA_ARENA_HPP
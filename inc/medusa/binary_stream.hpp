@@ -12,6 +12,12 @@
 #include <string>
 #include <cstring>
 #include <memory>
+#include <mutex>
+#include <atomic>
+#include <vector>
+#include <type_traits>
+#include <unordered_map>
+#include <algorithm>
 
 #include <boost/type_traits.hpp>
 #include <boost/filesystem/path.hpp>
@@ -128,38 +134,79 @@ public:
   template<typename T, size_t N>
   bool Read(OffsetType Position, T (&rData)[N]) const
   {
-    for (size_t i = 0; i < N; ++i)
-    {
-      if (Read(Position, rData[i]) == false)
-        return false;
-      Position += sizeof(T);
-    }
+    return ReadArray(Position, N, rData);
+  }
+
+  //! This method reads Count integers at once and performs a swap if needed.
+  template<typename T>
+  bool ReadArray(OffsetType Position, size_t Count, T* pData) const
+  {
+    return ReadArray(Position, Count, pData, m_Endianness);
+  }
+
+  //! This method reads Count integers at once and performs a swap if Endianness is not the host one.
+  template<typename T>
+  bool ReadArray(OffsetType Position, size_t Count, T* pData, EEndianness Endianness) const
+  {
+    static_assert(std::is_integral<T>::value, "ReadArray only handles integer types");
+
+    if (Count > static_cast<size_t>(-1) / sizeof(T))
+      return false;
+    if (!Read(Position, static_cast<void*>(pData), Count * sizeof(T)))
+      return false;
+    if (sizeof(T) != 1 && TestEndian(Endianness))
+      EndianSwapArray(pData, Count);
     return true;
   }
 
-  u16 StringLength(OffsetType Position) const
+  //! This method returns Count integers directly from the mapped buffer without copy.
+  //! It returns nullptr if a swap is needed, the data are misaligned or not mapped,
+  //! in this case, ReadArray must be used instead.
+  template<typename T>
+  T const* View(OffsetType Position, size_t Count) const
   {
-    if (Position > m_Size)
-      return 0;
-    auto Limit = static_cast<OffsetType>(m_Size) - Position; // TODO m_Size should be u64?
-    if (Limit == 0)
+    static_assert(std::is_integral<T>::value, "View only handles integer types");
+
+    if (m_pBuffer == nullptr || (sizeof(T) != 1 && TestEndian(m_Endianness)))
+      return nullptr;
+    if (Count > static_cast<size_t>(-1) / sizeof(T))
+      return nullptr;
+    u64 Length = Count * sizeof(T);
+    if (Position + Length < Position || Position + Length > m_Size)
+      return nullptr;
+
+    auto pData = reinterpret_cast<u8 const*>(m_pBuffer) + Position;
+    if (reinterpret_cast<uintptr_t>(pData) % std::alignment_of<T>::value != 0)
+      return nullptr;
+    return reinterpret_cast<T const*>(pData);
+  }
+
+  //! This method returns the length of the null-terminated string at Position, or 0 if it is not terminated.
+  u64 StringLength(OffsetType Position) const
+  {
+    if (Position >= m_Size)
       return 0;
+    auto Limit = m_Size - Position;
+
+    // In windowed mode, the string is located through the mapped view
+    if (m_pBuffer == nullptr)
+      return _StringLength(Position, Limit);
+
     char const* pDst = static_cast<char const*>(m_pBuffer) + Position;
-    auto StrLen = static_cast<u16>(::strnlen(pDst, Limit));
-    if (pDst[StrLen] != '\0')
+    auto const* pEnd = static_cast<char const*>(::memchr(pDst, '\0', static_cast<size_t>(Limit)));
+    if (pEnd == nullptr)
       return 0;
-    return StrLen;
+    return static_cast<u64>(pEnd - pDst);
   }
 
   bool Read(OffsetType Position, std::string& rString) const
   {
-    u16 StrLen = StringLength(Position);
+    u64 StrLen = StringLength(Position);
     if (StrLen == 0)
       return false;
 
-    char const* pDst = static_cast<char const*>(m_pBuffer) + Position;
-    rString.assign(pDst, StrLen);
-    return true;
+    rString.resize(static_cast<std::string::size_type>(StrLen));
+    return Read(Position, &rString[0], static_cast<size_t>(StrLen));
   }
 
   //! This method reads a buffer, no swap will be performed.
@@ -171,12 +218,12 @@ public:
   //! This method reads a buffer, no swap will be performed.
   bool Read(OffsetType Position, u8* pData, size_t Length) const
   {
-    if (m_pBuffer == nullptr)
-      return false;
-
     if (Position + Length < Position || Position + Length > m_Size)
       return false;
 
+    if (m_pBuffer == nullptr)
+      return _ReadWindow(Position, pData, Length);
+
     u8 const* pDataPosition = reinterpret_cast<u8 const*>(m_pBuffer) + Position;
     memcpy(pData, pDataPosition, Length);
     return true;
@@ -222,12 +269,12 @@ public:
 
   bool Write(OffsetType Position, u8 const* pData, size_t Length)
   {
-    if (m_pBuffer == nullptr)
-      return false;
-
     if (Position + Length < Position || Position + Length > m_Size)
       return false;
 
+    if (m_pBuffer == nullptr)
+      return _WriteWindow(Position, pData, Length);
+
     u8* pDataPosition = reinterpret_cast<u8*>(m_pBuffer) + Position;
     ::memcpy(pDataPosition, pData, Length);
     return true;
@@ -235,41 +282,70 @@ public:
 
   bool Write(OffsetType Position, int Val, size_t Length)
   {
-    if (m_pBuffer == nullptr)
-      return false;
-
     if (Position + Length < Position || Position + Length > m_Size)
       return false;
 
+    if (m_pBuffer == nullptr)
+      return _FillWindow(Position, static_cast<u8>(Val), Length);
+
     u8* pDataPosition = reinterpret_cast<u8*>(m_pBuffer)+Position;
     ::memset(pDataPosition, Val, Length);
     return true;
   }
 
-  u32         GetSize(void)   const { return m_Size;    }
+  u64         GetSize(void)   const { return m_Size;    }
+
+  //! This method returns the whole mapped buffer, or nullptr if the stream is windowed (see IsWindowed).
   void*       GetBuffer(void)       { return m_pBuffer; }
   void const* GetBuffer(void) const { return m_pBuffer; }
 
-  std::string const &GetSha1(void) const
+  //! This method returns true if the content is only reachable through Read (sliding views).
+  bool IsWindowed(void) const { return m_pBuffer == nullptr && m_Size != 0; }
+
+  std::string const &GetSha1(void) const;
+
+protected:
+  //! This method is called by Read when no whole buffer is available, it must copy Length bytes at Position to pData.
+  virtual bool _ReadWindow(OffsetType Position, void* pData, u64 Length) const { return false; }
+
+  //! This method is called by StringLength when no whole buffer is available.
+  virtual u64 _StringLength(OffsetType Position, u64 Limit) const { return 0; }
+
+  //! This method is called by Write when no whole buffer is available, read-only streams keep the default.
+  virtual bool _WriteWindow(OffsetType Position, void const* pData, u64 Length) { return false; }
+
+  bool _FillWindow(OffsetType Position, u8 Val, u64 Length)
   {
-    if (m_Sha1.empty())
-      m_Sha1 = Sha1(m_pBuffer, m_Size);
-    return m_Sha1;
+    u8 Chunk[0x1000];
+    ::memset(Chunk, Val, sizeof(Chunk));
+    while (Length != 0)
+    {
+      auto ChunkLen = std::min<u64>(Length, sizeof(Chunk));
+      if (!_WriteWindow(Position, Chunk, ChunkLen))
+        return false;
+      Position += ChunkLen;
+      Length -= ChunkLen;
+    }
+    return true;
   }
 
-protected:
   template <typename DataType>
   bool ReadGeneric(OffsetType Position, DataType& rData) const
   {
-    if (m_pBuffer == nullptr)
-      return false;
-
-    if (Position + sizeof(DataType) > m_Size)
+    if (Position + sizeof(DataType) < Position || Position + sizeof(DataType) > m_Size)
       return false;
 
-    u8 const* pDataPosition = reinterpret_cast<u8 const*>(m_pBuffer) + Position;
+    if (m_pBuffer == nullptr)
+    {
+      if (!_ReadWindow(Position, &rData, sizeof(DataType)))
+        return false;
+    }
+    else
+    {
+      u8 const* pDataPosition = reinterpret_cast<u8 const*>(m_pBuffer) + Position;
+      ::memcpy(&rData, pDataPosition, sizeof(DataType));
+    }
 
-    rData = *reinterpret_cast<DataType const*>(pDataPosition);
     if (TestEndian(m_Endianness))
       EndianSwap(rData);
     return true;
@@ -278,11 +354,16 @@ protected:
   template <typename DataType>
   bool WriteGeneric(OffsetType Position, DataType& rData)
   {
-    if (m_pBuffer == nullptr)
+    if (Position + sizeof(DataType) < Position || Position + sizeof(DataType) > m_Size)
       return false;
 
-    if (Position + sizeof(DataType) > m_Size)
-      return false;
+    if (m_pBuffer == nullptr)
+    {
+      typename boost::remove_const<DataType>::type Data = rData;
+      if (TestEndian(m_Endianness))
+        EndianSwap(Data);
+      return _WriteWindow(Position, &Data, sizeof(Data));
+    }
 
     typename boost::remove_const<DataType>::type* pDataPosition
       = reinterpret_cast< typename boost::remove_const<DataType>::type* >(m_pBuffer) + Position;
@@ -295,16 +376,25 @@ protected:
 
   Path                m_Path;
   void*               m_pBuffer;
-  u32                 m_Size;
+  u64                 m_Size;
   EEndianness         m_Endianness;
   mutable std::string m_Sha1;
 };
 
 //! FileBinaryStream is a generic class for file access.
+//! The file is mapped at once when possible, otherwise (or on request) it is
+//! accessed through a few sliding views so huge files don't exhaust the
+//! address space.
 class MEDUSA_EXPORT FileBinaryStream : public BinaryStream
 {
 public:
-  FileBinaryStream(Path const& rFilePath = Path());
+  //! Size of each sliding view when the windowed mode is used without explicit size.
+  static u64 const DefaultWindowSize = 0x4000000; // 64 MiB
+  //! Maximum number of views kept mapped at the same time in windowed mode.
+  static u32 const MaxViewCount      = 4;
+
+  //! If WindowSize is 0, the whole file is mapped unless it fails, otherwise it is windowed.
+  FileBinaryStream(Path const& rFilePath = Path(), u64 WindowSize = 0);
   virtual ~FileBinaryStream(void);
 
   FileBinaryStream(FileBinaryStream&& mBinStrm)
@@ -334,23 +424,66 @@ public:
 
       m_MapHandle = mBinStrm.m_MapHandle;
       mBinStrm.m_MapHandle = INVALID_MAP_VALUE;
+
+      m_WindowSize = mBinStrm.m_WindowSize;
+      mBinStrm.m_WindowSize = 0x0;
+
+      m_Views = std::move(mBinStrm.m_Views);
+      m_ViewClock = mBinStrm.m_ViewClock;
     }
     return *this;
   }
 
-  void Open(boost::filesystem::path const& rFilePath);
+  void Open(boost::filesystem::path const& rFilePath, u64 WindowSize = 0);
   void Close(void);
 
+  //! This method returns the size of sliding views, or 0 if the whole file is mapped.
+  u64 GetWindowSize(void) const { return m_WindowSize; }
+
 protected:
-  FileHandleType m_FileHandle;
-  MapHandleType  m_MapHandle;
+  struct MappedView
+  {
+    OffsetType m_Offset;
+    u64        m_Size;
+    u8 const*  m_pData;
+    u64        m_LastUse;
+  };
+
+  virtual bool _ReadWindow(OffsetType Position, void* pData, u64 Length) const;
+  virtual u64  _StringLength(OffsetType Position, u64 Limit) const;
+
+  // The caller must hold m_ViewMutex
+  MappedView const* _GetView(OffsetType Position, u64 Length) const;
+  void              _UnmapAllViews(void);
+
+  // Platform specific, the offset must be aligned on GetMapGranularity
+  static u64  _GetMapGranularity(void);
+  void const* _MapRegion(OffsetType Offset, u64 Size) const;
+  void        _UnmapRegion(void const* pData, u64 Size) const;
+
+  typedef std::mutex MutexType;
+
+  FileHandleType                  m_FileHandle;
+  MapHandleType                   m_MapHandle;
+  u64                             m_WindowSize;
+  mutable MutexType               m_ViewMutex;
+  mutable std::vector<MappedView> m_Views;
+  mutable u64                     m_ViewClock;
 };
 
-//! MemoryBinaryStream handle memory from a raw pointer but its duplicated first.
+//! MemoryBinaryStream handle memory from a raw pointer.
+//! By default the memory is duplicated first, in view mode the caller keeps the
+//! ownership and must keep the memory alive while the stream is used.
 class MEDUSA_EXPORT MemoryBinaryStream : public BinaryStream
 {
 public:
-  MemoryBinaryStream(void const* pMem = nullptr, u32 MemSize = 0);
+  enum OpenMode
+  {
+    CopyMode, //!< the stream owns a copy of the memory
+    ViewMode, //!< the stream directly uses the memory, writes modify it
+  };
+
+  MemoryBinaryStream(void const* pMem = nullptr, u64 MemSize = 0, OpenMode Mode = CopyMode);
   virtual ~MemoryBinaryStream(void);
 
   MemoryBinaryStream(MemoryBinaryStream&& mBinStrm)
@@ -374,12 +507,76 @@ public:
       mBinStrm.m_Endianness = EndianUnknown;
 
       m_Sha1 = std::move(mBinStrm.m_Sha1);
+
+      m_IsOwner = mBinStrm.m_IsOwner;
+      mBinStrm.m_IsOwner = false;
     }
     return *this;
   }
 
-  void Open(void const* pMem, u32 MemSize);
+  void Open(void const* pMem, u64 MemSize, OpenMode Mode = CopyMode);
   void Close(void);
+
+  bool IsOwner(void) const { return m_IsOwner; }
+
+private:
+  bool m_IsOwner;
+};
+
+//! OverlayBinaryStream gives a private and writable view on a read-only binary stream.
+//! Pages are copied from the underlying stream only when they're written (copy-on-write),
+//! other pages are read from it directly and bytes after BaseSize are read as zero.
+//! The overlay holds a reference on the underlying stream, reads don't lock while no page is copied.
+class MEDUSA_EXPORT OverlayBinaryStream : public BinaryStream
+{
+public:
+  typedef std::shared_ptr<OverlayBinaryStream> SPType;
+
+  static u32 const PageSize = 0x1000;
+
+  OverlayBinaryStream(BinaryStream::SPType spBaseBinStrm, OffsetType BaseOffset, u64 BaseSize, u64 Size);
+  virtual ~OverlayBinaryStream(void);
+
+  void Close(void);
+
+  //! This method returns the number of pages which have been copied.
+  size_t GetDirtyPageCount(void) const;
+
+  //! This method drops all modifications, buffers returned by GetPageBuffer are released.
+  void Revert(void);
+
+  //! This method returns the private copy of the page PageIdx, it's copied from the underlying stream if needed.
+  //! The buffer can be read and written directly, it's valid until the overlay is reverted or closed.
+  u8* GetPageBuffer(u64 PageIdx);
+
+  //! This method returns the bytes [Position, Position + Length) without copying them: from the private copy if
+  //! their page has been written, from the underlying buffer otherwise. The bytes must not be written and they must
+  //! be in a single page; nullptr is returned if they aren't backed by a buffer (windowed stream, after BaseSize).
+  //! The pointer on the underlying buffer is stale once the page is copied.
+  u8 const* GetReadBuffer(OffsetType Position, u64 Length) const;
+
+protected:
+  virtual bool _ReadWindow(OffsetType Position, void* pData, u64 Length) const;
+  virtual u64  _StringLength(OffsetType Position, u64 Limit) const;
+  virtual bool _WriteWindow(OffsetType Position, void const* pData, u64 Length);
+
+private:
+  bool _ReadBase(OffsetType Position, u8* pData, u64 Length) const;
+
+  // The caller must hold m_PageMutex
+  bool _ReadPage(u64 PageIdx, u32 PageOff, u8* pData, u32 Length) const;
+  u8*  _GetDirtyPage(u64 PageIdx);
+
+  typedef std::mutex MutexType;
+  typedef std::unordered_map<u64, std::unique_ptr<u8[]>> PageMapType;
+
+  BinaryStream::SPType m_spBaseBinStrm; // Kept alive since the overlay can outlive the document
+  OffsetType           m_BaseOffset;
+  u64                  m_BaseSize;
+  u8 const*            m_pBaseBuffer; // nullptr if the underlying stream is windowed
+  mutable MutexType    m_PageMutex;
+  PageMapType          m_DirtyPages;
+  std::atomic<bool>    m_IsDirty;     // Set while m_DirtyPages isn't empty
 };
 
 MEDUSA_NAMESPACE_END
@@ -12,6 +12,8 @@
 #include <string>
 #include <unordered_map>
 #include <functional>
+#include <memory>
+#include <cstring>
 
 MEDUSA_NAMESPACE_BEGIN
 
@@ -48,6 +50,29 @@ public:
   virtual void* GetContextAddress(void) = 0;
   virtual u16   GetRegisterOffset(u32 Register) = 0;
 
+  //! A register descriptor locates a register of up to 64-bit in the context returned by GetContextAddress:
+  //! the register is stored in a container of m_ContainerSize bytes at m_Offset, starting at bit m_Shift.
+  struct RegisterDescriptor
+  {
+    enum Flag : u8
+    {
+      ClearContainer = 0x1, //!< Writing the register clears the rest of its container
+    };
+
+    u16 m_Offset;
+    u8  m_ContainerSize;   // 0 if the register isn't in the context
+    u8  m_Shift;
+    u16 m_BitSize;
+    u8  m_Flags;
+  };
+
+  //! This method returns the descriptor of Reg, or nullptr if the register isn't described.
+  virtual RegisterDescriptor const* GetRegisterDescriptor(u32 Reg) const { return nullptr; }
+
+  //! These methods access a register of up to 64-bit in a context, the value is zero-extended.
+  static u64  LoadRegister(RegisterDescriptor const& rRegDesc, void const* pCtxt);
+  static void StoreRegister(RegisterDescriptor const& rRegDesc, void* pCtxt, u64 Val);
+
   virtual void  GetRegisters(RegisterList& RegList) const = 0;
 
   virtual bool Translate(Address const& rLogicalAddress, u64& rLinearAddress) const;
@@ -68,6 +93,10 @@ public:
   CpuInformation const& GetCpuInformation(void) const { return m_rCpuInfo; }
 
 protected:
+  //! These methods implement ReadRegister and WriteRegister with the descriptor of the register.
+  static bool _ReadRegister(RegisterDescriptor const* pRegDesc, void const* pCtxt, void* pVal, u32 BitSize);
+  static bool _WriteRegister(RegisterDescriptor const* pRegDesc, void* pCtxt, void const* pVal, u32 BitSize);
+
   CpuInformation const& m_rCpuInfo;
   typedef std::unordered_map<Address, u64> AddressMap;
   AddressMap m_AddressMap;
@@ -75,6 +104,41 @@ protected:
   mutable std::mutex m_CpuLock;
 };
 
+inline u64 CpuContext::LoadRegister(RegisterDescriptor const& rRegDesc, void const* pCtxt)
+{
+  auto pCont = static_cast<u8 const*>(pCtxt) + rRegDesc.m_Offset;
+  u64 Cont;
+  switch (rRegDesc.m_ContainerSize)
+  {
+  case 1:  { u8  Val; memcpy(&Val, pCont, sizeof(Val)); Cont = Val; break; }
+  case 2:  { u16 Val; memcpy(&Val, pCont, sizeof(Val)); Cont = Val; break; }
+  case 4:  { u32 Val; memcpy(&Val, pCont, sizeof(Val)); Cont = Val; break; }
+  case 8:  { u64 Val; memcpy(&Val, pCont, sizeof(Val)); Cont = Val; break; }
+  default: return 0;
+  }
+  Cont >>= rRegDesc.m_Shift;
+  if (rRegDesc.m_BitSize < 64)
+    Cont &= (1ULL << rRegDesc.m_BitSize) - 1;
+  return Cont;
+}
+
+inline void CpuContext::StoreRegister(RegisterDescriptor const& rRegDesc, void* pCtxt, u64 Val)
+{
+  auto pCont = static_cast<u8*>(pCtxt) + rRegDesc.m_Offset;
+  u64 Mask = rRegDesc.m_BitSize < 64 ? (1ULL << rRegDesc.m_BitSize) - 1 : ~0ULL;
+  Val = (Val & Mask) << rRegDesc.m_Shift;
+  Mask <<= rRegDesc.m_Shift;
+  bool Clear = (rRegDesc.m_Flags & RegisterDescriptor::ClearContainer) != 0;
+  switch (rRegDesc.m_ContainerSize)
+  {
+  case 1:  { u8  Cont; memcpy(&Cont, pCont, sizeof(Cont)); Cont = static_cast<u8 >(Clear ? Val : (Cont & ~Mask) | Val); memcpy(pCont, &Cont, sizeof(Cont)); break; }
+  case 2:  { u16 Cont; memcpy(&Cont, pCont, sizeof(Cont)); Cont = static_cast<u16>(Clear ? Val : (Cont & ~Mask) | Val); memcpy(pCont, &Cont, sizeof(Cont)); break; }
+  case 4:  { u32 Cont; memcpy(&Cont, pCont, sizeof(Cont)); Cont = static_cast<u32>(Clear ? Val : (Cont & ~Mask) | Val); memcpy(pCont, &Cont, sizeof(Cont)); break; }
+  case 8:  { u64 Cont; memcpy(&Cont, pCont, sizeof(Cont)); Cont = static_cast<u64>(Clear ? Val : (Cont & ~Mask) | Val); memcpy(pCont, &Cont, sizeof(Cont)); break; }
+  default: break;
+  }
+}
+
 template<> MEDUSA_EXPORT bool CpuContext::ReadRegister<bool>(u32 Reg, bool& rVal) const;
 template<> MEDUSA_EXPORT bool CpuContext::WriteRegister<bool>(u32 Reg, bool const& rVal);
 
@@ -84,14 +148,18 @@ template<> MEDUSA_EXPORT bool CpuContext::WriteRegister<BitVector>(u32 Reg, BitV
 class MEDUSA_EXPORT MemoryContext
 {
 public:
+  //! A chunk is either backed by its own memory or by an overlay on the document binary stream.
   struct MemoryChunk
   {
-    u64                        m_LinearAddress;
-    MemoryArea::Access         m_Flags;
-    MemoryBinaryStream::SPType m_spMemStrm;
+    u64                  m_LinearAddress;
+    MemoryArea::Access   m_Flags;
+    BinaryStream::SPType m_spMemStrm;
 
     MemoryChunk(u64 LinAddr = 0x0, void* Buffer = nullptr, u32 Size = 0x0, MemoryArea::Access Flags = MemoryArea::Access::NoAccess)
-      : m_LinearAddress(LinAddr), m_spMemStrm(std::make_shared<MemoryBinaryStream>(Buffer, Size)), m_Flags(Flags) {}
+      : m_LinearAddress(LinAddr), m_Flags(Flags), m_spMemStrm(std::make_shared<MemoryBinaryStream>(Buffer, Size)) {}
+
+    MemoryChunk(u64 LinAddr, BinaryStream::SPType spBinStrm, MemoryArea::Access Flags)
+      : m_LinearAddress(LinAddr), m_Flags(Flags), m_spMemStrm(spBinStrm) {}
 
     bool operator<(MemoryChunk const& rMemChunk) const
     { return m_LinearAddress < rMemChunk.m_LinearAddress; }
@@ -103,7 +171,24 @@ public:
     { return m_LinearAddress == LinAddr; }
   };
 
-  MemoryContext(CpuInformation const& rCpuInfo) : m_rCpuInfo(rCpuInfo) {}
+  //! Memory is mapped by pages of 4 KiB in a radix page table, each page has its own access flags.
+  static u32 const PageShift = 12;
+  static u32 const PageSize  = 1 << PageShift;
+
+  //! A page refers to the part of the chunk which covers it.
+  struct Page
+  {
+    BinaryStream*      m_pMemStrm; // nullptr if the page isn't mapped
+    u8*                m_pRaw;     // Raw memory of the first mapped byte, overlay chunks are mapped by FindWritablePage
+    u8 const*          m_pReadRaw; // Same as m_pRaw, but clean overlay pages are mapped on the underlying buffer by FindPage
+    u64                m_StrmOff;  // Offset of the first mapped byte in the chunk
+    u16                m_Begin;    // Mapped bytes of the page are [m_Begin, m_End)
+    u16                m_End;
+    MemoryArea::Access m_Flags;
+    bool               m_Split;    // Several chunks cover the page, chunks must be searched
+  };
+
+  MemoryContext(CpuInformation const& rCpuInfo);
   ~MemoryContext(void);
 
   typedef std::function<void (MemoryChunk const& rMemChunk)> CallbackType;
@@ -126,10 +211,32 @@ public:
   virtual bool FindMemory(u64 LinAddr, void*& prAddr, u32& rOffset, u32& rSize, MemoryArea::Access& rFlags) const;
 
   virtual bool AllocateMemory(u64 LinAddr, u32 Size, MemoryArea::Access Flags, void** ppRawMemory);
-  virtual bool ProtectMemory(u64 LinAddr, MemoryArea::Access Flags); // TODO: add protection by pages
+  virtual bool ProtectMemory(u64 LinAddr, MemoryArea::Access Flags);
+  //! This method sets the access flags of every page overlapping [LinAddr, LinAddr + Size).
+  //! Granting the Write access maps the pages of overlay chunks on their private copies, like FindWritablePage.
+  virtual bool ProtectMemory(u64 LinAddr, u32 Size, MemoryArea::Access Flags);
   virtual bool FreeMemory(u64 LinAddr);
   virtual bool MapDocument(Document const& rDoc, CpuContext const* pCpuCtxt);
 
+  //! If access checking is enabled, reading requires the Read flag and writing requires the Write flag.
+  void SetAccessCheck(bool AccessCheck) { m_AccessCheck = AccessCheck; }
+  bool HasAccessCheck(void) const       { return m_AccessCheck;        }
+
+  //! A context which isn't shared between threads is accessed without locking.
+  void SetShared(bool Shared) { m_Shared = Shared; }
+  bool IsShared(void) const   { return m_Shared;   }
+
+  //! This method returns the page containing LinAddr, or nullptr if it isn't mapped.
+  //! The page is valid until the page table is modified, which changes the generation.
+  //! A page of an overlay chunk is mapped for reading only, on the underlying buffer until the overlay page is copied.
+  //! Although it's const, this method fills the page table entry lazily: m_pReadRaw is set on the first lookup.
+  Page const* FindPage(u64 LinAddr) const;
+  //! This method returns the page containing LinAddr like FindPage, a page of an overlay chunk is mapped on the private
+  //! copy of the overlay page (the page is copied if needed), so m_pRaw can be written directly.
+  //! Mapping a page which was mapped on the underlying buffer changes the generation.
+  Page const* FindWritablePage(u64 LinAddr);
+  u32         GetGeneration(void) const { return m_Generation; }
+
   virtual std::string ToString(void) const;
 
 protected:
@@ -138,12 +245,59 @@ protected:
   CpuInformation const& m_rCpuInfo;
 
   typedef std::vector<MemoryChunk> MemoryChunksType;
-  MemoryChunksType m_Memories;
+  mutable MemoryChunksType m_Memories; // overlay chunks are flatten when a raw pointer is requested
   mutable std::recursive_mutex m_MemoryLock;
 
 private:
   MemoryContext(MemoryContext const&);
   MemoryContext const& operator=(MemoryContext const&);
+
+  std::unique_lock<std::recursive_mutex> _Lock(void) const;
+  bool  _GetPiece(u64 LinAddr, u32 Size, MemoryArea::Access Access, BinaryStream*& rpMemStrm, u8*& rpRaw, u64& rStrmOff, u32& rPieceSize) const;
+  Page* _GetPage(u64 LinAddr, bool Create) const;
+  void  _UpdatePages(u64 LinAddr, u64 Size) const;
+  bool  _MapOverlayPage(Page& rPage, bool Write) const;
+
+  struct PageTableNode;
+  std::unique_ptr<PageTableNode> m_spPageTable;
+  mutable u32                    m_Generation;
+  bool                           m_AccessCheck;
+  bool                           m_Shared;
+};
+
+//! MemoryTlb is a small direct-mapped cache of the pages of a memory context, it belongs to one emulator so it's
+//! not locked. Entries are dropped when the page table of the memory context changes. The cache is bypassed if
+//! the memory context is shared between threads.
+class MEDUSA_EXPORT MemoryTlb
+{
+public:
+  MemoryTlb(void);
+
+  bool Read(MemoryContext const& rMemCtxt, u64 LinAddr, void* pVal, u32 Size);
+  bool Write(MemoryContext& rMemCtxt, u64 LinAddr, void const* pVal, u32 Size);
+
+  //! This method returns the raw memory of Size bytes at LinAddr if they're in a single chunk.
+  //! It returns nullptr if the memory isn't mapped or doesn't allow Access.
+  //! Without the Write access, the returned memory can be shared with the document and must not be written.
+  void* GetRawMemory(MemoryContext& rMemCtxt, u64 LinAddr, u32 Size, MemoryArea::Access Access);
+
+  void Flush(void);
+
+private:
+  static u32 const NumberOfEntries = 64;
+
+  struct Entry
+  {
+    u64                 m_PageAddr; // Tag, an unaligned address marks an invalid entry
+    MemoryContext::Page m_Page;
+  };
+
+  MemoryContext::Page const* _Lookup(MemoryContext const& rMemCtxt, u64 LinAddr);
+  MemoryContext::Page const* _LookupWritable(MemoryContext& rMemCtxt, u64 LinAddr);
+
+  MemoryContext const* m_pMemCtxt;
+  u32                  m_Generation;
+  Entry                m_Entries[NumberOfEntries];
 };
 
 template<> MEDUSA_EXPORT bool MemoryContext::ReadMemory<BitVector>(u64 LinAddr, BitVector& rVal) const;
@@ -48,6 +48,8 @@ public:
   // BinaryStream
   Database& SetBinaryStream(BinaryStream::SPType spBinStrm);
   BinaryStream& GetBinaryStream(void);
+  //! This method is used by objects which can outlive the database, like mapped memory.
+  BinaryStream::SPType GetSharedBinaryStream(void) { return m_spBinStrm; }
 
   // Architecture
   virtual bool RegisterArchitectureTag(Tag ArchitectureTag) = 0;
@@ -15,6 +15,8 @@
 #include "medusa/database.hpp"
 
 #include <set>
+#include <tuple>
+#include <vector>
 #include <mutex>
 #include <boost/bimap.hpp>
 #include <boost/thread/mutex.hpp>
@@ -116,6 +118,7 @@ public:
   // Binary Stream
 
   BinaryStream& GetBinaryStream(void) const { return m_spDatabase->GetBinaryStream(); }
+  BinaryStream::SPType GetSharedBinaryStream(void) const { return m_spDatabase->GetSharedBinaryStream(); }
 
   // Label
 
@@ -149,6 +152,9 @@ public:
                      
   u8                  GetCellType(Address const& rAddr) const;
   u8                  GetCellSubType(Address const& rAddr) const;
+
+                      //! This method returns the raw data of a cell, unlike GetCell instructions are not disassembled.
+  bool                GetCellData(Address const& rAddr, CellData& rCellData) const;
                      
                       /*! This method adds a new cell.
                        * \param rAddr is the address of the new cell.
@@ -158,6 +164,14 @@ public:
                        */
   bool                SetCell(Address const& rAddr, Cell::SPType spCell, bool Force = false);
   bool                SetCellWithLabel(Address const& rAddr, Cell::SPType spCell, Label const& rLabel, bool Force = false);
+
+  typedef std::tuple<Address, Cell::SPType, Label> CellWithLabel;
+                      /*! This method adds several cells with their label at once.
+                       * \param rCellsWithLabels contains the address, the cell and the label of each new cell.
+                       * \param Force makes the old cells to be deleted.
+                       * \return Returns the number of cells added, subscribers are notified only once.
+                       */
+  u32                 SetCellsWithLabels(std::vector<CellWithLabel> const& rCellsWithLabels, bool Force = false);
   bool                SetArchitecture(Address const& rAddr, Tag TagArch, u8 Mode, Database::SetArchitectureModeType SetArchMode);
                      
   bool                DeleteCell(Address const& rAddr);
@@ -260,6 +274,8 @@ public:
 private:
   void RemoveLabelIfNeeded(Address const& rAddr);
 
+  bool _SetCellWithLabel(Address const& rAddr, Cell::SPType spCell, Label const& rLabel, bool Force, Address::Vector& rErasedAddresses);
+
   bool _ApplyStructure(Address const& rAddr, StructureDetail const& rStructDtl);
   bool _ApplyTypedValue(Address const& rParentAddr, Address const& rTpValAddr, TypedValueDetail const& rTpValDtl);
   bool _ApplyType(Address const& rAddr, TypeDetail::SPType const& rspTpDtl);
@@ -10,9 +10,11 @@
 #include "medusa/document.hpp"
 #include "medusa/instruction.hpp"
 #include "medusa/architecture.hpp"
+#include "medusa/ir.hpp"
 
 #include <unordered_map>
 #include <functional>
+#include <vector>
 
 MEDUSA_NAMESPACE_BEGIN
 
@@ -84,6 +86,14 @@ public:
 
   virtual bool InvalidateCache(void);
 
+  //! By default, flags overwritten before being tested are not computed: in the same block, or in every
+  //! successor if the block ends with a direct jump. Hooks and the instruction callback are considered to
+  //! test every flag, as well as calls, returns and indirect branches, so they always observe the flags of
+  //! the last executed instruction. Blocks are built again when hooks are modified.
+  //! In precise flags mode every flag is computed, the context is exact after each block.
+  void SetPreciseFlags(bool PreciseFlags);
+  bool HasPreciseFlags(void) const { return m_PreciseFlags; }
+
 protected:
   Emulator(CpuInformation const* pCpuInfo, CpuContext* pCpuCtxt, MemoryContext *pMemCtxt);
 
@@ -93,7 +103,31 @@ protected:
   // Semantic cache
   bool _IsSemanticCached(Address const& rAddress) const;
   bool _CacheSemantic(Address const& rAddress, Expression::VSPType& rExprs);
+  //! This method drops the semantic of a block, and the blocks whose dead flags were computed from it.
   bool _InvalidSemantic(Address const& rAddress);
+  //! This method drops every cached semantic along with the blocks built from them.
+  void _InvalidSemantics(void);
+  //! This method drops the blocks an emulator builds from the semantic, it may be called by a hook.
+  virtual void _ResetBlocks(void);
+  //! This method returns the cached semantic of the block at rAddress, it's disassembled and cached if needed.
+  //! It returns nullptr if no semantic is available.
+  Expression::VSPType const* _GetSemantic(Address const& rAddress);
+
+  // Dead flag elimination
+  struct InstructionFlags
+  {
+    size_t m_FirstExprIdx;  // Index of the first semantic expression of the instruction in the block
+    size_t m_NrOfExprs;
+    u32    m_TestedFlags;
+    u32    m_ModifiedFlags; // Updated, cleared or fixed flags
+  };
+  typedef std::vector<InstructionFlags> InstructionFlagsVector;
+  //! This method stores the successors of a block ended by rInsn, it returns false if one of them isn't known statically.
+  bool _GetStaticSuccessors(Address const& rInsnAddr, Instruction const& rInsn, Architecture const& rArch, std::vector<Address>& rSuccAddrs) const;
+  //! This method returns the flags written before being read by every successor, none if rSuccAddrs is empty.
+  FlagLiveness::FlagSetType _GetDeadFlagsOnExit(std::vector<Address> const& rSuccAddrs);
+  //! This method removes the assignments of flags which are dead, it returns the number of removed expressions.
+  u32 _EliminateDeadFlags(Expression::VSPType& rExprs, InstructionFlagsVector const& rInsnsFlags, FlagLiveness::FlagSetType const& rDeadFlagsOnExit) const;
 
   struct HookInformation
   {
@@ -111,6 +145,17 @@ protected:
 
   typedef std::unordered_map<Address, Expression::VSPType> SemanticCacheType;
   SemanticCacheType m_SemCache;
+  bool              m_PreciseFlags;
+  // Blocks whose dead flags depend on the code of a successor, indexed by the successor address
+  typedef std::unordered_map<Address, std::vector<Address>> FlagsPredecessorsType;
+  FlagsPredecessorsType m_FlagsPreds;
+
+  // Pages of m_pMemCtxt recently accessed by this emulator
+  MemoryTlb         m_MemTlb;
+
+private:
+  void _WalkFlags(Expression::VSPType const& rExprs, InstructionFlagsVector const& rInsnsFlags, FlagLiveness& rLiveness, std::vector<bool>* pDeadExprs) const;
+  bool _IsFlagsBarrier(SystemExpression const& rSysExpr) const;
 };
 
 typedef Emulator* (*TGetEmulator)(CpuInformation const* pCpuInfo, CpuContext* pCpuCtxt, MemoryContext* pMemCtxt);
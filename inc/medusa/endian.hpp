@@ -6,6 +6,8 @@
 #include "medusa/export.hpp"
 #include <boost/detail/endian.hpp>
 
+#include <cstddef>
+
 MEDUSA_NAMESPACE_BEGIN
 
 enum EEndianness
@@ -75,6 +77,23 @@ template<> inline void EndianSwap<s64>(s64& rData)
     (rData << 56);
 }
 
+//! These functions swap Count elements in place (vectorized when possible).
+MEDUSA_EXPORT void EndianSwapArray(u16* pData, size_t Count);
+MEDUSA_EXPORT void EndianSwapArray(u32* pData, size_t Count);
+MEDUSA_EXPORT void EndianSwapArray(u64* pData, size_t Count);
+
+inline void EndianSwapArray(u8*, size_t) {}
+inline void EndianSwapArray(s8*, size_t) {}
+
+inline void EndianSwapArray(s16* pData, size_t Count)
+{ EndianSwapArray(reinterpret_cast<u16*>(pData), Count); }
+
+inline void EndianSwapArray(s32* pData, size_t Count)
+{ EndianSwapArray(reinterpret_cast<u32*>(pData), Count); }
+
+inline void EndianSwapArray(s64* pData, size_t Count)
+{ EndianSwapArray(reinterpret_cast<u64*>(pData), Count); }
+
 MEDUSA_NAMESPACE_END
 
 #endif // MEDUSA_ENDIAN_HPP
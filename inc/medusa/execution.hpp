@@ -27,6 +27,7 @@ public:
   bool Execute(Address const& rAddr);
 
   bool InvalidateCache(void);
+  bool SetPreciseFlags(bool PreciseFlags);
 
   bool HookInstruction(Emulator::HookCallback HkCb);
   bool HookFunction(std::string const& rFuncName, Emulator::HookCallback HkCb);
@@ -8,6 +8,7 @@
 #include "medusa/information.hpp"
 #include "medusa/context.hpp"
 
+#include <functional>
 #include <list>
 
 MEDUSA_NAMESPACE_BEGIN
@@ -222,9 +223,9 @@ private:
 
 class MEDUSA_EXPORT ConditionExpression : public Expression
 {
-public:
-  typedef std::shared_ptr<ConditionExpression> SPType;
+  DECL_EXPR(ConditionExpression, Expression::Cond, Expression)
 
+public:
   enum Type
   {
     CondUnk,
@@ -265,7 +266,7 @@ protected:
 
 class MEDUSA_EXPORT TernaryConditionExpression : public ConditionExpression
 {
-  DECL_EXPR(TernaryConditionExpression, Expression::TernaryCond, Expression)
+  DECL_EXPR(TernaryConditionExpression, Expression::TernaryCond, ConditionExpression)
 
 public:
   TernaryConditionExpression(Type CondType, Expression::SPType spRefExpr, Expression::SPType spTestExpr, Expression::SPType spTrueExpr, Expression::SPType spFalseExpr);
@@ -288,7 +289,7 @@ protected:
 
 class MEDUSA_EXPORT IfElseConditionExpression : public ConditionExpression
 {
-  DECL_EXPR(IfElseConditionExpression, Expression::IfElseCond, Expression)
+  DECL_EXPR(IfElseConditionExpression, Expression::IfElseCond, ConditionExpression)
 
 public:
   IfElseConditionExpression(Type CondType, Expression::SPType spRefExpr, Expression::SPType spTestExpr, Expression::SPType spThenExpr, Expression::SPType spElseExpr);
@@ -311,7 +312,7 @@ protected:
 
 class MEDUSA_EXPORT WhileConditionExpression : public ConditionExpression
 {
-  DECL_EXPR(WhileConditionExpression, Expression::WhileCond, Expression)
+  DECL_EXPR(WhileConditionExpression, Expression::WhileCond, ConditionExpression)
 
 public:
   WhileConditionExpression(Type CondType, Expression::SPType spRefExpr, Expression::SPType spTestExpr, Expression::SPType spBodyExpr);
@@ -817,6 +818,12 @@ namespace Expr
   MEDUSA_EXPORT Expression::SPType MakeSys(std::string const& rName, Address const& rAddr);
 
   MEDUSA_EXPORT bool TestKind(Expression::Kind Kind, Expression::SPType spExpr);
+
+  //! This function calls rTransform on each child of rspExpr, in order, and returns the node with the returned children.
+  //! The node is only rebuilt if one of its children was replaced, otherwise rspExpr is returned.
+  //! If rTransform returns nullptr, the function stops and returns nullptr.
+  typedef std::function<Expression::SPType (Expression::SPType const& rspChildExpr)> ChildTransformType;
+  MEDUSA_EXPORT Expression::SPType TransformChildren(Expression::SPType const& rspExpr, ChildTransformType const& rTransform);
 }
 
 
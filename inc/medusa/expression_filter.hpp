@@ -20,6 +20,11 @@ namespace medusa
       return false;
     }
 
+    //! These methods describe the root of the matched expressions, RewriteEngine uses them to dispatch its rules.
+    //! Expression::Unknown matches any kind of expression and -1 any operation.
+    virtual Expression::Kind GetRootKind(void) const { return Expression::Unknown; }
+    virtual int GetRootOperation(void) const { return -1; }
+
     operator SPType(void)
     {
       return nullptr;
@@ -121,6 +126,8 @@ namespace medusa
         return true;
       }
 
+      virtual Expression::Kind GetRootKind(void) const { return Expression::Mem; }
+
       operator SPType(void)
       {
         return std::make_shared<Memory>(m_PatternName, m_spBasePattern, m_spOffsetPattern);
@@ -150,6 +157,8 @@ namespace medusa
         return true;
       }
 
+      virtual Expression::Kind GetRootKind(void) const { return Expression::UnOp; }
+
       operator SPType(void)
       {
         return std::make_shared<AnyUnary>(m_PatternName, m_spPattern);
@@ -182,6 +191,9 @@ namespace medusa
         return true;
       }
 
+      virtual Expression::Kind GetRootKind(void) const { return Expression::UnOp; }
+      virtual int GetRootOperation(void) const { return Op; }
+
       operator SPType(void)
       {
         return std::make_shared<Unary>(m_PatternName, m_spPattern);
@@ -221,6 +233,8 @@ namespace medusa
         return true;
       }
 
+      virtual Expression::Kind GetRootKind(void) const { return Expression::BinOp; }
+
       operator SPType(void)
       {
         return std::make_shared<AnyBinary>(m_PatternName, m_spLeftPattern, m_spRightPattern);
@@ -257,6 +271,9 @@ namespace medusa
         return true;
       }
 
+      virtual Expression::Kind GetRootKind(void) const { return Expression::BinOp; }
+      virtual int GetRootOperation(void) const { return Op; }
+
       operator SPType(void)
       {
         return std::make_shared<Binary>(m_PatternName, m_spLeftPattern, m_spRightPattern);
@@ -298,6 +315,8 @@ namespace medusa
       virtual bool Filter(NamedExpressionType& rNamedExprs, Expression::SPType spExpr) const
       {
         auto spCondExpr = expr_cast<ConditionExpression>(spExpr);
+        if (spCondExpr == nullptr)
+          return false;
         if (!m_spRefPattern->Filter(rNamedExprs, spCondExpr->GetReferenceExpression()))
           return false;
         if (!m_spTestPattern->Filter(rNamedExprs, spCondExpr->GetTestExpression()))
@@ -328,6 +347,8 @@ namespace medusa
       virtual bool Filter(NamedExpressionType& rNamedExprs, Expression::SPType spExpr) const
       {
         auto spCondExpr = expr_cast<ConditionExpression>(spExpr);
+        if (spCondExpr == nullptr)
+          return false;
         if (spCondExpr->GetType() != Cond)
           return false;
         if (!m_spRefPattern->Filter(rNamedExprs, spCondExpr->GetReferenceExpression()))
@@ -383,6 +404,8 @@ namespace medusa
         return true;
       }
 
+      virtual Expression::Kind GetRootKind(void) const { return Expression::TernaryCond; }
+
       operator SPType(void)
       {
         return std::make_shared<Ternary>(m_PatternName, m_spCondPattern, m_spTruePattern, m_spFalsePattern);
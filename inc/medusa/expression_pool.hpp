@@ -0,0 +1,72 @@
+#ifndef MEDUSA_EXPRESSION_POOL_HPP
+#define MEDUSA_EXPRESSION_POOL_HPP
+
+#include "medusa/namespace.hpp"
+#include "medusa/export.hpp"
+#include "medusa/types.hpp"
+#include "medusa/expression.hpp"
+
+#include <unordered_map>
+
+MEDUSA_NAMESPACE_BEGIN
+
+//! ExpressionPool hash-conses expressions: structurally identical trees are interned as the same node,
+//! so two interned expressions are equal if and only if their pointers are equal, and results of
+//! visitors can be memoized using the node address as key.
+//! The structural hash and the bit size of each interned node are computed once when it is interned.
+//! Unlike Expression::Compare, interning is exact: bitvectors of different bit sizes are different nodes.
+//! Interned nodes are shared, they must not be modified afterwards (e.g. with UpdateChild).
+//! Nodes are reference counted by the pool: a node is kept alive while it is interned by a caller or
+//! it is the child of another node, Release drops the reference taken by Intern.
+class MEDUSA_EXPORT ExpressionPool
+{
+public:
+  ExpressionPool(void);
+  ~ExpressionPool(void);
+
+  //! This method returns the interned node structurally identical to spExpr.
+  //! spExpr itself is interned if the pool does not contain it yet and all its children are already interned,
+  //! otherwise a new node is built on top of the interned children.
+  //! Each call takes a reference on the returned node.
+  Expression::SPType Intern(Expression::SPType spExpr);
+
+  //! This method returns the interned node structurally identical to spExpr, or nullptr if there is none.
+  //! Unlike Intern, the pool is left untouched.
+  Expression::SPType Find(Expression::SPType spExpr) const;
+
+  //! This method drops a reference taken by Intern, spExpr and its children are removed once they are unreferenced.
+  void Release(Expression::SPType spExpr);
+
+  //! This method returns true if spExpr is a node of this pool.
+  bool Contains(Expression::SPType spExpr) const;
+
+  //! These methods return the cached values of an interned node, spExpr must be a node of this pool.
+  u64 GetHash(Expression::SPType spExpr) const;
+  u32 GetBitSize(Expression::SPType spExpr) const;
+
+  size_t GetSize(void) const { return m_Nodes.size(); }
+  void Clear(void);
+
+private:
+  struct NodeInformation
+  {
+    u64 m_Hash;
+    u32 m_BitSize;
+    u32 m_RefCount; // Interned parents and references taken by Intern
+  };
+
+  class Interner;
+  class Finder;
+
+  Expression::SPType _InternNode(Expression::SPType spNodeExpr);
+  Expression::SPType _FindNode(Expression::SPType spNodeExpr, u64 Hash) const;
+  u64 _ComputeHash(Expression::SPType spExpr) const;
+  bool _IsShallowIdentical(Expression::SPType spLeftExpr, Expression::SPType spRightExpr) const;
+
+  std::unordered_map<Expression const*, NodeInformation> m_Nodes;
+  std::unordered_multimap<u64, Expression::SPType>        m_Buckets;
+};
+
+MEDUSA_NAMESPACE_END
+
+#endif // !MEDUSA_EXPRESSION_POOL_HPP
@@ -2,9 +2,46 @@
 #define MEDUSA_EXPRESSION_SIMPLIFIER_HPP
 
 #include "medusa/expression.hpp"
+#include "medusa/expression_filter.hpp"
 
 MEDUSA_NAMESPACE_BEGIN
 
+//! RewriteEngine applies rewrite rules to every node of an expression until none of them matches anymore.
+//! The matching automaton only dispatches on the first level: rules are indexed by the kind and the operation
+//! of their pattern root, and the rest of the pattern is matched on each candidate node. The engine works on
+//! a worklist: each node is visited once, and only the nodes created by a rewrite are visited again.
+//! Unchanged subtrees are shared between the input and the result.
+class MEDUSA_EXPORT RewriteEngine
+{
+public:
+  //! A rewrite returns the new expression, or nullptr if the matched expression must be kept.
+  typedef std::function<Expression::SPType(NamedExpressionType const& rNamedExprs, Expression::SPType spExpr)> RewriteType;
+
+  RewriteEngine(u32 MaxRewriteCount = 0x10000);
+
+  void AddRule(ExpressionPattern::SPType spPattern, RewriteType Rewrite);
+
+  //! This method rewrites rspExpr, it returns false if the maximum number of rewrites is reached.
+  bool Execute(Expression::SPType& rspExpr);
+
+  u32 GetRewriteCount(void) const { return m_RewriteCount; }
+
+private:
+  struct Rule
+  {
+    ExpressionPattern::SPType m_spPattern;
+    RewriteType               m_Rewrite;
+  };
+
+  std::vector<u32> const& _GetRules(Expression::SPType spExpr);
+  Expression::SPType _ApplyRules(Expression::SPType spExpr);
+
+  std::vector<Rule>                         m_Rules;
+  std::unordered_map<u32, std::vector<u32>> m_Dispatch; // kind and operation to rules
+  u32                                       m_MaxRewriteCount;
+  u32                                       m_RewriteCount;
+};
+
 class MEDUSA_EXPORT ExpressionSimplifier
 {
 public:
@@ -64,25 +101,27 @@ protected:
 class MEDUSA_EXPORT ConstantPropagation : public ExpressionSimplifier
 {
 public:
-  ConstantPropagation(Expression::SPType spExpr);
+  ConstantPropagation(Expression::SPType& rspExpr);
 
   virtual bool _RunOnce(void);
   virtual bool _Finalize(void);
 
 protected:
-  Expression::SPType m_spExpr;
+  Expression::SPType& m_rspExpr;
 };
 
 class MEDUSA_EXPORT ExpressionRewriter : public ExpressionSimplifier
 {
 public:
-  ExpressionRewriter(Expression::SPType& rspExpr);
+  //! By default only the root of rspExpr is rewritten, RewriteSubExpressions rewrites every node with RewriteEngine.
+  ExpressionRewriter(Expression::SPType& rspExpr, bool RewriteSubExpressions = false);
 
 protected:
   virtual bool _RunOnce(void);
   virtual bool _Finalize(void);
 
   Expression::SPType& m_rspExpr;
+  bool                m_RewriteSubExpressions;
 };
 
 MEDUSA_NAMESPACE_END
@@ -3,6 +3,7 @@
 
 #include "medusa/expression.hpp"
 #include "medusa/expression_simplifier.hpp"
+#include "medusa/expression_pool.hpp"
 #include "medusa/architecture.hpp"
 
 MEDUSA_NAMESPACE_BEGIN
@@ -28,6 +29,45 @@ public:
   virtual Expression::SPType VisitSymbolic(SymbolicExpression::SPType spSymExpr);
 };
 
+//! ExpressionTransformer rewrites an expression bottom-up, it switches on the kind of each node
+//! instead of relying on the double dispatch of Expression::Visit.
+//! Unlike CloneVisitor, a node is only rebuilt when at least one of its children was replaced, otherwise
+//! the original node is returned (see Expr::TransformChildren). Unchanged subtrees are thus shared with the transformed expression and
+//! must not be modified afterwards (e.g. with UpdateChild).
+//! A transformer can also be used as a visitor, Visit returns the transformed expression.
+class MEDUSA_EXPORT ExpressionTransformer : public ExpressionVisitor
+{
+public:
+  //! This method returns the transformed expression, or nullptr if the transformation failed.
+  Expression::SPType Transform(Expression::SPType spExpr);
+
+  virtual Expression::SPType VisitSystem(SystemExpression::SPType spSysExpr);
+  virtual Expression::SPType VisitBind(BindExpression::SPType spBindExpr);
+  virtual Expression::SPType VisitCondition(ConditionExpression::SPType spCondExpr);
+  virtual Expression::SPType VisitTernaryCondition(TernaryConditionExpression::SPType spTernExpr);
+  virtual Expression::SPType VisitIfElseCondition(IfElseConditionExpression::SPType spIfElseExpr);
+  virtual Expression::SPType VisitWhileCondition(WhileConditionExpression::SPType spWhileExpr);
+  virtual Expression::SPType VisitAssignment(AssignmentExpression::SPType spAssignExpr);
+  virtual Expression::SPType VisitUnaryOperation(UnaryOperationExpression::SPType spOpExpr);
+  virtual Expression::SPType VisitBinaryOperation(BinaryOperationExpression::SPType spOpExpr);
+  virtual Expression::SPType VisitBitVector(BitVectorExpression::SPType spIntExpr);
+  virtual Expression::SPType VisitIdentifier(IdentifierExpression::SPType spIdExpr);
+  virtual Expression::SPType VisitVectorIdentifier(VectorIdentifierExpression::SPType spVecIdExpr);
+  virtual Expression::SPType VisitTrack(TrackExpression::SPType spTrkExpr);
+  virtual Expression::SPType VisitVariable(VariableExpression::SPType spVarExpr);
+  virtual Expression::SPType VisitMemory(MemoryExpression::SPType spMemExpr);
+  virtual Expression::SPType VisitSymbolic(SymbolicExpression::SPType spSymExpr);
+
+protected:
+  //! This method is called before the children of spExpr are transformed.
+  //! Returning an expression replaces spExpr and skips its children, nullptr lets the traversal continue.
+  virtual Expression::SPType _PreTransform(Expression::SPType spExpr) { return nullptr; }
+
+  //! This method is called once the children are transformed, spExpr is the original node if none of them was replaced.
+  //! Returning nullptr aborts the transformation.
+  virtual Expression::SPType _PostTransform(Expression::SPType spExpr) { return spExpr; }
+};
+
 class MEDUSA_EXPORT FilterVisitor : public ExpressionVisitor
 {
 public:
@@ -156,6 +196,7 @@ public:
 protected:
   void _InsertExpression(Expression::SPType spKeyExpr, Expression::SPType spValExpr);
   bool _RemoveExpression(Expression::SPType spKeyExpr);
+  Expression::SPType _GetKey(Expression::SPType spKeyExpr) const;
   bool _EvaluateCondition(u8 CondOp, BitVectorExpression::SPType spConstRefExpr, BitVectorExpression::SPType spConstTestExpr, bool& rRes) const;
 
   typedef std::vector<std::pair<Expression::SPType, Expression::SPType>> SymbolicContextType;
@@ -172,6 +213,29 @@ protected:
   bool                              m_Update;
   Address                           m_CurAddr;
   u8                                m_CurPos;
+
+  // Keys of the symbolic context without annotation, interned once instead of being cloned on each lookup.
+  // The original key is kept alive so its address cannot be reused by another expression.
+  // The pool is shared by copies and forks of the visitor, so they must be used by the same thread,
+  // a key is released once it left the context of all of them.
+  class KeyCache
+  {
+  public:
+    KeyCache(void);
+    KeyCache(KeyCache const& rKeyCache);
+    KeyCache& operator=(KeyCache Copy);
+    ~KeyCache(void);
+
+    Expression::SPType Get(Expression::SPType spKeyExpr);
+    Expression::SPType Find(Expression::SPType spExpr) const;
+    void               Remove(Expression::SPType spKeyExpr);
+
+  private:
+    typedef std::unordered_map<Expression const*, std::pair<Expression::SPType, Expression::SPType>> KeyMapType;
+    std::shared_ptr<ExpressionPool> m_spExprPool;
+    KeyMapType                      m_Keys;
+  };
+  mutable KeyCache                  m_Keys;
 };
 
 //! Visit an expression and convert IdentifierExpression to TrackExpression.
@@ -215,25 +279,28 @@ private:
   bool m_Result;
 };
 
-class MEDUSA_EXPORT NormalizeIdentifier : public CloneVisitor
+class MEDUSA_EXPORT NormalizeIdentifier : public ExpressionTransformer
 {
 public:
   NormalizeIdentifier(CpuInformation const& rCpuinfo, u8 Mode);
 
-  virtual Expression::SPType VisitAssignment(AssignmentExpression::SPType spAssignExpr);
-  virtual Expression::SPType VisitIdentifier(IdentifierExpression::SPType spIdExpr);
-
 protected:
+  virtual Expression::SPType _PreTransform(Expression::SPType spExpr);
+
   CpuInformation const& m_rCpuInfo;
   u8 m_Mode;
 };
 
-class MEDUSA_EXPORT IdentifierToVariable : public CloneVisitor
+//! IdentifierToVariable replaces identifiers with variables, the variables of the input are copied
+//! so the result can be modified (e.g. SetBitSize) without altering shared subtrees.
+class MEDUSA_EXPORT IdentifierToVariable : public ExpressionTransformer
 {
 public:
-  virtual Expression::SPType VisitIdentifier(IdentifierExpression::SPType spIdExpr);
   std::set<u32> const& GetUsedId(void) { return m_UsedId; }
 
+protected:
+  virtual Expression::SPType _PreTransform(Expression::SPType spExpr);
+
 private:
   std::set<u32> m_UsedId;
 };
@@ -6,8 +6,14 @@
 #include "medusa/types.hpp"
 #include "medusa/address.hpp"
 
+#include <memory>
+#include <mutex>
+#include <vector>
+
 MEDUSA_NAMESPACE_BEGIN
 
+class Expression;
+
 class MEDUSA_EXPORT CpuInformation
 {
 public:
@@ -25,8 +31,16 @@ public:
   };
 
   CpuInformation(Tag ArchTag = MEDUSA_ARCH_UNK) : m_ArchTag(ArchTag) {}
+  // Identifier expressions are bound to their own CpuInformation, so they are not copied
+  CpuInformation(CpuInformation const& rCpuInfo) : m_ArchTag(rCpuInfo.m_ArchTag) {}
+  CpuInformation& operator=(CpuInformation const& rCpuInfo) { m_ArchTag = rCpuInfo.m_ArchTag; return *this; }
+
   Tag          GetArchitectureTag(void) const { return m_ArchTag; }
 
+  //! Returns the shared identifier expression for Id. These nodes are immutable,
+  //! so every instruction and semantic may reference the same one.
+  std::shared_ptr<Expression> GetIdentifierExpression(u32 Id) const;
+
   virtual char const* ConvertIdentifierToName(u32 Id)                   const = 0;
   virtual u32         ConvertNameToIdentifier(std::string const& rName) const = 0;
   virtual u32         GetRegisterByType(Type RegType, u8 Mode)          const = 0;
@@ -38,6 +52,12 @@ public:
 
 protected:
   Tag m_ArchTag;
+
+private:
+  typedef std::mutex MutexType;
+
+  mutable MutexType                                m_IdExprMutex;
+  mutable std::vector<std::shared_ptr<Expression>> m_IdExprs;
 };
 
 MEDUSA_NAMESPACE_END
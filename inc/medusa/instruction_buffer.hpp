@@ -0,0 +1,60 @@
+#ifndef MEDUSA_INSTRUCTION_BUFFER_HPP
+#define MEDUSA_INSTRUCTION_BUFFER_HPP
+
+#include "medusa/namespace.hpp"
+#include "medusa/types.hpp"
+#include "medusa/export.hpp"
+#include "medusa/instruction.hpp"
+#include "medusa/arena.hpp"
+
+#include <memory>
+#include <vector>
+
+MEDUSA_NAMESPACE_BEGIN
+
+//! InstructionBuffer receives instructions decoded by Architecture::DisassembleBlock.
+//! Instructions and their cell data are carved from chunks owned by an arena. Each instruction
+//! keeps a reference on the arena, so it can outlive the buffer (e.g. once it is stored in a document).
+//! When no instruction allocated from the arena is alive anymore, Clear reuses its chunks.
+class MEDUSA_EXPORT InstructionBuffer
+{
+public:
+  typedef std::vector<Instruction::SPType> VSPType;
+  typedef VSPType::const_iterator          ConstIterator;
+
+  InstructionBuffer(void);
+  ~InstructionBuffer(void);
+
+  //! This method returns an empty instruction allocated from the arena, it is not appended to the buffer.
+  Instruction::SPType MakeInstruction(void);
+
+  void PushBack(Instruction::SPType const& rspInsn) { m_Insns.push_back(rspInsn); }
+
+  //! This method drops instructions starting from Size.
+  void Truncate(size_t Size) { if (Size < m_Insns.size()) m_Insns.resize(Size); }
+
+  //! This method empties the buffer, the arena is rewound if no instruction is referenced elsewhere,
+  //! otherwise the unused chunks are trimmed and a new arena is used. The previous one is released along
+  //! with its last instruction, until then the chunks it used stay allocated (at most 64 KiB each).
+  void Clear(void);
+
+  size_t GetSize(void) const { return m_Insns.size(); }
+  bool   IsEmpty(void) const { return m_Insns.empty(); }
+
+  Instruction::SPType const& operator[](size_t Idx) const { return m_Insns[Idx]; }
+  Instruction::SPType const& Back(void)             const { return m_Insns.back(); }
+
+  ConstIterator begin(void) const { return m_Insns.begin(); }
+  ConstIterator end(void)   const { return m_Insns.end();   }
+
+private:
+  InstructionBuffer(InstructionBuffer const&);
+  InstructionBuffer& operator=(InstructionBuffer const&);
+
+  std::shared_ptr<Arena> m_spArena;
+  VSPType                m_Insns;
+};
+
+MEDUSA_NAMESPACE_END
+
+#endif // !MEDUSA_INSTRUCTION_BUFFER_HPP
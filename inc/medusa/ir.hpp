@@ -0,0 +1,167 @@
+#ifndef MEDUSA_IR_HPP
+#define MEDUSA_IR_HPP
+
+#include "medusa/namespace.hpp"
+#include "medusa/types.hpp"
+#include "medusa/export.hpp"
+#include "medusa/expression.hpp"
+#include "medusa/information.hpp"
+
+#include <map>
+#include <set>
+#include <string>
+#include <vector>
+
+MEDUSA_NAMESPACE_BEGIN
+
+//! IrInstruction is a three-address instruction of the linear IR.
+//! Values are virtual registers in SSA form: each one is defined by a single instruction and its bit size
+//! is known by the block, so operand widths are computed once when semantic expressions are lowered.
+//! Flags are 1-bit registers, writing them uses WriteFlag instead of WriteReg.
+struct MEDUSA_EXPORT IrInstruction
+{
+  enum Type : u8
+  {
+    Unknown,
+    Const,     //!< %dst = constants[Imm]
+    ReadReg,   //!< %dst = register Imm
+    WriteReg,  //!< register Imm = %src0
+    WriteFlag, //!< flag Imm = %src0
+    Load,      //!< %dst = memory[%src1:%src0], %src1 is the optional base
+    Store,     //!< memory[%src1:%src0] = %src2
+    AddressOf, //!< %dst = address of %src1:%src0, the memory is not dereferenced
+    UnOp,      //!< %dst = Operation %src0
+    BinOp,     //!< %dst = %src0 Operation %src1
+    Cmp,       //!< %dst = %src0 Condition %src1, %dst is 1-bit
+    Select,    //!< %dst = %src0 ? %src1 : %src2
+    Sys,       //!< system expressions[Imm]
+  };
+
+  static u32 const NoValue = 0xffffffff;
+
+  u8  m_Type;
+  u8  m_Operation; //!< OperationExpression::Type or ConditionExpression::Type
+  u32 m_Dst;
+  u32 m_Src[3];
+  u32 m_Imm;
+
+  bool HasSideEffect(void) const;
+};
+
+//! FlagLiveness is the backward liveness analysis of flags shared by IrBlock and the emulators.
+//! While a block is walked backward, it tracks the dead flags: flags which are written again before being read.
+//! At the end of a block, the dead flags are the ones every successor writes before reading them.
+class MEDUSA_EXPORT FlagLiveness
+{
+public:
+  typedef std::set<u32> FlagSetType;
+
+  FlagLiveness(CpuInformation const* pCpuInfo, FlagSetType const& rDeadFlagsOnExit = FlagSetType());
+
+  //! This method records a write of FlagId, it returns false if the written value is never read.
+  bool Write(u32 FlagId);
+  //! This method records a read of RegId, flags aliased with it become live.
+  void Read(u32 RegId);
+  //! This method makes every flag live, e.g. for a system expression or an instruction which tests flags.
+  void ReadAll(void) { m_DeadFlags.clear(); }
+
+  FlagSetType const& GetDeadFlags(void) const { return m_DeadFlags; }
+
+private:
+  CpuInformation const* m_pCpuInfo;
+  FlagSetType           m_DeadFlags;
+};
+
+//! IrBlock holds the linear IR of a basic block: instructions, bit sizes of values, constants and
+//! system expressions are stored in contiguous arrays.
+class MEDUSA_EXPORT IrBlock
+{
+public:
+  typedef std::vector<IrInstruction> InstructionVector;
+
+  IrBlock(CpuInformation const* pCpuInfo = nullptr);
+
+  CpuInformation const*    GetCpuInformation(void) const { return m_pCpuInfo; }
+  InstructionVector const& GetInstructions(void)   const { return m_Insns; }
+  u32                      GetNumberOfValues(void) const { return static_cast<u32>(m_ValueBitSizes.size()); }
+  u32                      GetValueBitSize(u32 Value) const;
+  BitVector const&         GetConstant(u32 ConstIdx) const { return m_Consts[ConstIdx]; }
+  Expression::SPType       GetSystem(u32 SysIdx)     const { return m_SysExprs[SysIdx]; }
+
+  //! These methods append an instruction and return the defined value, or IrInstruction::NoValue.
+  u32  EmitConst(BitVector const& rValue);
+  u32  EmitReadReg(u32 RegId);
+  void EmitWriteReg(u32 RegId, u32 SrcVal);
+  u32  EmitLoad(u32 AccessSizeInBit, u32 OffVal, u32 BaseVal);
+  void EmitStore(u32 OffVal, u32 BaseVal, u32 SrcVal);
+  u32  EmitAddressOf(u32 AccessSizeInBit, u32 OffVal, u32 BaseVal);
+  u32  EmitUnOp(OperationExpression::Type OpType, u32 SrcVal);
+  u32  EmitBinOp(OperationExpression::Type OpType, u32 LeftVal, u32 RightVal, u32 BitSize);
+  u32  EmitCmp(ConditionExpression::Type CondType, u32 RefVal, u32 TestVal);
+  u32  EmitSelect(u32 CondVal, u32 TrueVal, u32 FalseVal);
+  void EmitSys(Expression::SPType spSysExpr);
+
+  //! This method returns true if every value is defined once before being used and bit sizes are consistent,
+  //! otherwise rError describes the first invalid instruction.
+  bool Verify(std::string& rError) const;
+
+  //! This method removes writes of flags which are written again before being read, then the computations
+  //! which are no longer used. System instructions are considered to read every flag. rDeadFlagsOnExit holds
+  //! the flags written by every successor before being read, by default every flag is live at the end of the block.
+  //! It returns the number of removed instructions.
+  u32 EliminateDeadFlags(FlagLiveness::FlagSetType const& rDeadFlagsOnExit = FlagLiveness::FlagSetType());
+
+  std::string ToString(void) const;
+  std::string ToString(IrInstruction const& rInsn) const;
+
+  void Clear(void);
+
+private:
+  u32  _AddValue(u32 BitSize);
+  bool _IsFlag(u32 RegId) const;
+  std::string _GetRegisterName(u32 RegId) const;
+
+  CpuInformation const*           m_pCpuInfo;
+  InstructionVector               m_Insns;
+  std::vector<u16>                m_ValueBitSizes;
+  std::vector<BitVector>          m_Consts;
+  Expression::VSPType             m_SysExprs;
+};
+
+//! IrBuilder lowers semantic expressions into an IrBlock.
+//! Registers are read once: the value written or read last is reused until a system expression,
+//! since a hook may modify the context. Variables are bound to the value assigned last.
+//! If/else expressions are predicated: both branches are lowered and the written registers, flags and
+//! variables are merged with Select. Memory can't be accessed in a branch since the access would happen
+//! even if the branch is not taken.
+//! While loops, vector identifiers, symbolic expressions and memory accesses under if/else can't be lowered.
+class MEDUSA_EXPORT IrBuilder
+{
+public:
+  IrBuilder(IrBlock& rBlock);
+
+  bool Lower(Expression::SPType spExpr);
+  bool Lower(Expression::VSPType const& rExprs);
+  bool Lower(Expression::LSPType const& rExprs);
+
+private:
+  u32  _LowerValue(Expression::SPType spExpr);
+  bool _LowerAssignment(AssignmentExpression::SPType spAssignExpr);
+  bool _LowerIfElse(IfElseConditionExpression::SPType spIfElseExpr);
+  bool _LowerMemoryAddress(MemoryExpression::SPType spMemExpr, u32& rOffVal, u32& rBaseVal);
+  u32  _GetRegister(u32 RegId);
+  void _SetRegister(u32 RegId, u32 Val);
+
+  typedef std::map<u32, u32>         RegisterMapType;
+  typedef std::map<std::string, u32> VariableMapType;
+
+  IrBlock&        m_rBlock;
+  RegisterMapType m_Regs;
+  VariableMapType m_Vars;
+  u32             m_PredVal;   // Condition of the branch being lowered, NoValue outside if/else
+  std::set<u32>   m_PredRegs;  // Registers written in the branches being lowered, their writes are deferred
+};
+
+MEDUSA_NAMESPACE_END
+
+#endif // !MEDUSA_IR_HPP
@@ -130,6 +130,8 @@ public:
   bool                            AddTask(std::string const& rTaskName, Address const& rAddr);
   bool                            AddTask(std::string const& rTaskName, Address const& rAddr, Architecture& rArch, u8 Mode);
 private:
+  void                            _StartAnalyzer(Database::SPType spDatabase, OperatingSystem::SPType spOperatingSystem);
+
   TaskManager        m_TaskManager;
   Document           m_Document;
 
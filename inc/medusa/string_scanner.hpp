@@ -0,0 +1,80 @@
+#ifndef MEDUSA_STRING_SCANNER_HPP
+#define MEDUSA_STRING_SCANNER_HPP
+
+#include "medusa/namespace.hpp"
+#include "medusa/types.hpp"
+#include "medusa/export.hpp"
+#include "medusa/binary_stream.hpp"
+
+#include <string>
+#include <vector>
+
+MEDUSA_NAMESPACE_BEGIN
+
+class Document;
+
+//! StringScanner sweeps raw memory to find candidate strings.
+//! Bytes are classified by blocks (SSE2/AVX2 when available) and large
+//! ranges are split into chunks which are scanned in parallel.
+class MEDUSA_EXPORT StringScanner
+{
+public:
+  enum Encoding : u8
+  {
+    AsciiEncoding   = 1 << 0, //!< printable ascii characters only
+    Utf8Encoding    = 1 << 1, //!< printable ascii with at least one valid multibyte sequence
+    Utf16LeEncoding = 1 << 2,
+    Utf16BeEncoding = 1 << 3,
+    AllEncodings    = AsciiEncoding | Utf8Encoding | Utf16LeEncoding | Utf16BeEncoding,
+  };
+
+  struct Candidate
+  {
+    OffsetType  m_Offset;     //!< offset of the first character in the binary stream
+    u32         m_RawLength;  //!< length in bytes, the terminator is not included
+    u8          m_Encoding;
+    bool        m_Terminated; //!< true if the string is followed by a null character
+    std::string m_Value;      //!< the string converted to utf-8
+  };
+
+  typedef std::vector<Candidate> CandidateVector;
+
+  //! Per byte bitmaps computed for each scanned window (opaque)
+  struct Classification;
+
+  //! The longest raw string a cell can hold (terminator included)
+  static u32 const MaxRawLength = 0xfffe;
+
+  StringScanner(u32 MinLength = 4, u8 Encodings = AllEncodings, bool TerminatedOnly = false);
+
+  void SetMinLength(u32 MinLength)           { m_MinLength      = MinLength;      }
+  void SetEncodings(u8 Encodings)            { m_Encodings      = Encodings;      }
+  void SetTerminatedOnly(bool TerminatedOnly) { m_TerminatedOnly = TerminatedOnly; }
+  //! ThreadCount set to 0 uses all available cores.
+  void SetThreadCount(u32 ThreadCount)       { m_ThreadCount    = ThreadCount;    }
+
+  //! This method returns candidates located in [Offset, Offset + Length) sorted by offset.
+  CandidateVector Scan(BinaryStream const& rBinStrm, OffsetType Offset, u64 Length) const;
+
+  //! This method scans every readable mapped memory area and creates string cells for candidates.
+  //! Code is never overwritten and UTF-16BE candidates are skipped since no cell can represent them.
+  //! \return Returns the number of created strings.
+  u32 CreateStrings(Document& rDoc) const;
+
+private:
+  void _ScanChunk(u8 const* pWindow, OffsetType WindowOffset, u64 WindowLength,
+    OffsetType ChunkOffset, u64 ChunkLength, CandidateVector& rCandidates) const;
+  void _ScanBytes(Classification const& rCls, u8 const* pWindow, OffsetType WindowOffset, u64 WindowLength,
+    u64 ChunkBegin, u64 ChunkEnd, CandidateVector& rCandidates) const;
+  void _ScanWords(Classification const& rCls, u8 const* pWindow, OffsetType WindowOffset, u64 WindowLength,
+    u64 ChunkBegin, u64 ChunkEnd, bool BigEndian, CandidateVector& rCandidates) const;
+
+  u32  m_MinLength;
+  u8   m_Encodings;
+  bool m_TerminatedOnly;
+  u32  m_ThreadCount;
+};
+
+MEDUSA_NAMESPACE_END
+
+#endif // !MEDUSA_STRING_SCANNER_HPP
@@ -68,47 +68,66 @@ typedef boost::multiprecision::number<boost::multiprecision::cpp_int_backend<
 // boost::multiprecision::cpp_int doesn't support arbitrary unsigned int
 typedef ap_int ap_uint;
 
+// Values up to 64-bit are kept in a u64, ap_int is only used for wider values
 class MEDUSA_EXPORT BitVector
 {
 public:
-  BitVector(void) : m_BitSize(0), m_Value() {}
-  explicit BitVector(s8 Value)     : m_BitSize(8),    m_Value(Value) { _Adjust(); }
-  explicit BitVector(u8 Value)     : m_BitSize(8),    m_Value(Value) { _Adjust(); }
-  explicit BitVector(s16 Value)    : m_BitSize(16),   m_Value(Value) { _Adjust(); }
-  explicit BitVector(u16 Value)    : m_BitSize(16),   m_Value(Value) { _Adjust(); }
-  explicit BitVector(s32 Value)    : m_BitSize(32),   m_Value(Value) { _Adjust(); }
-  explicit BitVector(u32 Value)    : m_BitSize(32),   m_Value(Value) { _Adjust(); }
-  explicit BitVector(s64 Value)    : m_BitSize(64),   m_Value(Value) { _Adjust(); }
-  explicit BitVector(u64 Value)    : m_BitSize(64),   m_Value(Value) { _Adjust(); }
-  explicit BitVector(s128 Value)   : m_BitSize(128),  m_Value(Value) { _Adjust(); }
-  explicit BitVector(u128 Value)   : m_BitSize(128),  m_Value(Value) { _Adjust(); }
-  explicit BitVector(s256 Value)   : m_BitSize(256),  m_Value(Value) { _Adjust(); }
-  explicit BitVector(u256 Value)   : m_BitSize(256),  m_Value(Value) { _Adjust(); }
-  explicit BitVector(s512 Value)   : m_BitSize(512),  m_Value(Value) { _Adjust(); }
-  explicit BitVector(u512 Value)   : m_BitSize(512),  m_Value(Value) { _Adjust(); }
-  explicit BitVector(s1024 Value)  : m_BitSize(1024), m_Value(Value) { _Adjust(); }
-  explicit BitVector(u1024 Value)  : m_BitSize(1024), m_Value(Value) { _Adjust(); }
+  BitVector(void) : m_BitSize(0), m_SmallValue(0), m_Value() {}
+  explicit BitVector(s8 Value)     : m_BitSize(8),    m_SmallValue(static_cast<u8>(Value)),  m_Value() {}
+  explicit BitVector(u8 Value)     : m_BitSize(8),    m_SmallValue(Value),                   m_Value() {}
+  explicit BitVector(s16 Value)    : m_BitSize(16),   m_SmallValue(static_cast<u16>(Value)), m_Value() {}
+  explicit BitVector(u16 Value)    : m_BitSize(16),   m_SmallValue(Value),                   m_Value() {}
+  explicit BitVector(s32 Value)    : m_BitSize(32),   m_SmallValue(static_cast<u32>(Value)), m_Value() {}
+  explicit BitVector(u32 Value)    : m_BitSize(32),   m_SmallValue(Value),                   m_Value() {}
+  explicit BitVector(s64 Value)    : m_BitSize(64),   m_SmallValue(static_cast<u64>(Value)), m_Value() {}
+  explicit BitVector(u64 Value)    : m_BitSize(64),   m_SmallValue(Value),                   m_Value() {}
+  explicit BitVector(s128 Value)   : m_BitSize(128),  m_SmallValue(0), m_Value(Value) { _Adjust(); }
+  explicit BitVector(u128 Value)   : m_BitSize(128),  m_SmallValue(0), m_Value(Value) { _Adjust(); }
+  explicit BitVector(s256 Value)   : m_BitSize(256),  m_SmallValue(0), m_Value(Value) { _Adjust(); }
+  explicit BitVector(u256 Value)   : m_BitSize(256),  m_SmallValue(0), m_Value(Value) { _Adjust(); }
+  explicit BitVector(s512 Value)   : m_BitSize(512),  m_SmallValue(0), m_Value(Value) { _Adjust(); }
+  explicit BitVector(u512 Value)   : m_BitSize(512),  m_SmallValue(0), m_Value(Value) { _Adjust(); }
+  explicit BitVector(s1024 Value)  : m_BitSize(1024), m_SmallValue(0), m_Value(Value) { _Adjust(); }
+  explicit BitVector(u1024 Value)  : m_BitSize(1024), m_SmallValue(0), m_Value(Value) { _Adjust(); }
 
   explicit BitVector(float Value)  : BitVector(*reinterpret_cast<u32*>(&Value)) {}
   explicit BitVector(double Value) : BitVector(*reinterpret_cast<u64*>(&Value)) {}
 
-  explicit BitVector(u16 BitSize, ap_int Value) : m_BitSize(BitSize), m_Value(Value) { _Adjust(); }
+  explicit BitVector(u16 BitSize, ap_int Value) : m_BitSize(BitSize), m_SmallValue(0), m_Value() { _SetValue(Value); }
+
+  // Builtin integers don't need to go through ap_int
+  template<typename _Ty>
+  explicit BitVector(u16 BitSize, _Ty Value, typename std::enable_if<std::is_integral<_Ty>::value>::type* = nullptr)
+    : m_BitSize(BitSize), m_SmallValue(static_cast<u64>(Value) & _MakeMask(BitSize)), m_Value()
+  {
+    if (!_IsSmall())
+    {
+      m_SmallValue = 0;
+      _SetValue(ap_int(Value));
+    }
+  }
 
   template<typename _Ty>
   typename std::enable_if<std::is_same<_Ty, bool>::value, bool>::type ConvertTo(void) const
   {
+    if (_IsSmall())
+      return m_SmallValue != 0;
     return m_Value.convert_to<u8>() ? true : false;
   }
 
   template<typename _Ty>
   typename std::enable_if<boost::multiprecision::is_signed_number<_Ty>::value, _Ty>::type ConvertTo(void) const
   {
+    if (_IsSmall())
+      return static_cast<_Ty>(m_SmallValue);
     return m_Value.convert_to<_Ty>();
   }
 
   template<typename _Ty>
   typename std::enable_if<boost::multiprecision::is_unsigned_number<_Ty>::value, _Ty>::type ConvertTo(void) const
   {
+    if (_IsSmall())
+      return static_cast<_Ty>(m_SmallValue);
 
     auto Res = static_cast<_Ty>(m_Value.convert_to<typename std::make_signed<_Ty>::type>());
     if (Res == 0)
@@ -136,6 +155,12 @@ public:
   ap_int  GetSignedValue(void) const;
   ap_uint GetUnsignedValue(void) const;
 
+  bool IsZero(void) const { return _IsSmall() ? m_SmallValue == 0 : m_Value.is_zero(); }
+
+  //! These methods return a negative value, zero or a positive value if this is lower, equal or greater than rVal
+  int UCmp(BitVector const& rVal) const;
+  int SCmp(BitVector const& rVal) const;
+
   // Unary
 
   BitVector  Not(void) const;
@@ -240,10 +265,17 @@ public:
   BitVector& FModAssign(BitVector const& rVal);
 
 private:
-  void _Adjust(void);
+  bool       _IsSmall(void) const { return m_BitSize <= 64; }
+  static u64 _MakeMask(u16 BitSize) { return BitSize >= 64 ? ~static_cast<u64>(0) : (static_cast<u64>(1) << BitSize) - 1; }
+  s64        _GetSmallSignedValue(void) const;
+  ap_int     _GetValue(void) const { return _IsSmall() ? ap_int(m_SmallValue) : m_Value; }
+  void       _SetValue(ap_int const& rValue);
+  void       _Resize(u16 NewBitSize);
+  void       _Adjust(void);
 
   u16    m_BitSize;
-  ap_int m_Value;
+  u64    m_SmallValue; //!< used if m_BitSize <= 64
+  ap_int m_Value;      //!< used if m_BitSize > 64
 };
 
 template<> float  BitVector::ConvertTo<float> (void) const;
@@ -8,6 +8,7 @@
 #include <medusa/log.hpp>
 
 #include <string>
+#include <functional>
 
 
 MEDUSA_NAMESPACE_BEGIN
@@ -19,6 +20,8 @@ std::string MEDUSA_EXPORT Base64Encode(std::string const &rRawData);
 std::string MEDUSA_EXPORT Base64Decode(std::string const &rBase64Data);
 
 std::string MEDUSA_EXPORT Sha1(void const *pData, size_t Length);
+//! This function hashes data provided chunk by chunk, it stops when rNextChunk returns false.
+std::string MEDUSA_EXPORT Sha1(std::function<bool(void const*& rpChunk, size_t& rChunkLength)> const& rNextChunk);
 Id          MEDUSA_EXPORT Sha1(std::string const &Name);
 
 Id          MEDUSA_EXPORT RandomId(void);
@@ -119,70 +119,37 @@ u32 ArmArchitecture::ARMCpuInformation::GetSizeOfRegisterInBit(u32 Id) const
 
 bool ArmArchitecture::ARMCpuContext::ReadRegister(u32 Reg, void* pVal, u32 BitSize) const
 {
-#define READ_FLAG(fl) if (BitSize != 1) return false; *reinterpret_cast<u8*>(pVal) = (m_Context.CPSR & fl ? 1 : 0);
-#define READ_REGISTER(idx) if (BitSize != 32) return false; memcpy(pVal, &m_Context.Registers[idx], 4)
-  switch (Reg)
-  {
-  case ARM_Fl_Nf: READ_FLAG(ARM_CSPR_N); break;
-  case ARM_Fl_Cf: READ_FLAG(ARM_CSPR_C); break;
-  case ARM_Fl_Vf: READ_FLAG(ARM_CSPR_V); break;
-  case ARM_Fl_Zf: READ_FLAG(ARM_CSPR_Z); break;
-
-  case ARM_Reg_R0:  READ_REGISTER(0);  break;
-  case ARM_Reg_R1:  READ_REGISTER(1);  break;
-  case ARM_Reg_R2:  READ_REGISTER(2);  break;
-  case ARM_Reg_R3:  READ_REGISTER(3);  break;
-  case ARM_Reg_R4:  READ_REGISTER(4);  break;
-  case ARM_Reg_R5:  READ_REGISTER(5);  break;
-  case ARM_Reg_R6:  READ_REGISTER(6);  break;
-  case ARM_Reg_R7:  READ_REGISTER(7);  break;
-  case ARM_Reg_R8:  READ_REGISTER(8);  break;
-  case ARM_Reg_R9:  READ_REGISTER(9);  break;
-  case ARM_Reg_R10: READ_REGISTER(10); break;
-  case ARM_Reg_R11: READ_REGISTER(11); break;
-  case ARM_Reg_R12: READ_REGISTER(12); break;
-  case ARM_Reg_R13: READ_REGISTER(13); break;
-  case ARM_Reg_R14: READ_REGISTER(14); break;
-  case ARM_Reg_R15: READ_REGISTER(15); break;
-  default: return false;
-  }
-#undef READ_REGISTER
-#undef READ_FLAG
-  return true;
+  return _ReadRegister(GetRegisterDescriptor(Reg), &m_Context, pVal, BitSize);
 }
 
 bool ArmArchitecture::ARMCpuContext::WriteRegister(u32 Reg, void const* pVal, u32 BitSize)
 {
-#define WRITE_FLAG(fl) if (BitSize != 1) return false; if (reinterpret_cast<u8 const*>(pVal)) m_Context.CPSR |= fl; else m_Context.CPSR &= ~fl;
-#define WRITE_REGISTER(idx) if (BitSize != 32) return false; memcpy(&m_Context.Registers[idx], pVal, 4)
-  switch (Reg)
+  return _WriteRegister(GetRegisterDescriptor(Reg), &m_Context, pVal, BitSize);
+}
+
+CpuContext::RegisterDescriptor const* ArmArchitecture::ARMCpuContext::GetRegisterDescriptor(u32 Reg) const
+{
+  // Flags are bits of CPSR, registers are stored in order
+#define DESC_FLAG(bit)  { static_cast<u16>(offsetof(Context, CPSR)), sizeof(u32), bit, 1, 0 }
+#define DESC_REG(idx)   { static_cast<u16>(offsetof(Context, Registers) + idx * sizeof(u32)), sizeof(u32), 0, 32, 0 }
+  static RegisterDescriptor const s_RegDescs[] =
   {
-  case ARM_Fl_Nf: WRITE_FLAG(ARM_CSPR_N); break;
-  case ARM_Fl_Cf: WRITE_FLAG(ARM_CSPR_C); break;
-  case ARM_Fl_Vf: WRITE_FLAG(ARM_CSPR_V); break;
-  case ARM_Fl_Zf: WRITE_FLAG(ARM_CSPR_Z); break;
-
-  case ARM_Reg_R0:  WRITE_REGISTER(0);  break;
-  case ARM_Reg_R1:  WRITE_REGISTER(1);  break;
-  case ARM_Reg_R2:  WRITE_REGISTER(2);  break;
-  case ARM_Reg_R3:  WRITE_REGISTER(3);  break;
-  case ARM_Reg_R4:  WRITE_REGISTER(4);  break;
-  case ARM_Reg_R5:  WRITE_REGISTER(5);  break;
-  case ARM_Reg_R6:  WRITE_REGISTER(6);  break;
-  case ARM_Reg_R7:  WRITE_REGISTER(7);  break;
-  case ARM_Reg_R8:  WRITE_REGISTER(8);  break;
-  case ARM_Reg_R9:  WRITE_REGISTER(9);  break;
-  case ARM_Reg_R10: WRITE_REGISTER(10); break;
-  case ARM_Reg_R11: WRITE_REGISTER(11); break;
-  case ARM_Reg_R12: WRITE_REGISTER(12); break;
-  case ARM_Reg_R13: WRITE_REGISTER(13); break;
-  case ARM_Reg_R14: WRITE_REGISTER(14); break;
-  case ARM_Reg_R15: WRITE_REGISTER(15); break;
-  default: return false;
-  }
-#undef WRITE_REGISTER
-#undef READ_REGISTER
-  return true;
+    { 0, 0, 0, 0, 0 }, // ARM_Id_Unknown
+    DESC_FLAG(31),     // ARM_Fl_Nf
+    DESC_FLAG(29),     // ARM_Fl_Cf
+    DESC_FLAG(28),     // ARM_Fl_Vf
+    DESC_FLAG(30),     // ARM_Fl_Zf
+    DESC_REG(0),  DESC_REG(1),  DESC_REG(2),  DESC_REG(3),
+    DESC_REG(4),  DESC_REG(5),  DESC_REG(6),  DESC_REG(7),
+    DESC_REG(8),  DESC_REG(9),  DESC_REG(10), DESC_REG(11),
+    DESC_REG(12), DESC_REG(13), DESC_REG(14), DESC_REG(15),
+  };
+#undef DESC_REG
+#undef DESC_FLAG
+
+  if (Reg == ARM_Id_Unknown || Reg >= sizeof(s_RegDescs) / sizeof(*s_RegDescs))
+    return nullptr;
+  return &s_RegDescs[Reg];
 }
 
 bool ArmArchitecture::ARMCpuContext::Translate(Address const& rLogicalAddress, u64& rLinearAddress) const
@@ -326,6 +293,13 @@ Address ArmArchitecture::CurrentAddress(Address const& rAddr, Instruction const&
   return rAddr + PcOff;
 }
 
+bool ArmArchitecture::DisassembleBlock(BinaryStream const& rBinStrm, OffsetType Offset, u8 Mode, u32 MaxInsns, bool StopOnBranch, InstructionBuffer& rInsnBuf)
+{
+  return _DisassembleBlock(rBinStrm, Offset, Mode, MaxInsns, StopOnBranch, rInsnBuf,
+    [this](BinaryStream const& rInsnStrm, OffsetType InsnOff, Instruction& rInsn, u8 InsnMode)
+  { return ArmArchitecture::Disassemble(rInsnStrm, InsnOff, rInsn, InsnMode); });
+}
+
 namespace
 {
   class OperandFormatter : public ExpressionVisitor
@@ -56,11 +56,12 @@ class ArmArchitecture : public Architecture
     virtual void* GetRegisterAddress(u32 Register);
     virtual void* GetContextAddress(void);
     virtual u16   GetRegisterOffset(u32 Register);
+    virtual RegisterDescriptor const* GetRegisterDescriptor(u32 Reg) const;
 
     virtual void  GetRegisters(RegisterList& RegList) const;
 
   private:
-    struct
+    struct Context
     {
       u32 Registers[16];
       u32 CPSR; //http://infocenter.arm.com/help/index.jsp?topic=/com.arm.doc.ddi0210c/CIHIAAGE.html
@@ -76,6 +77,7 @@ public:
   virtual Address               CurrentAddress(Address const& rAddr, Instruction const& rInsn) const;
   virtual EEndianness           GetEndianness(void)                                    { return LittleEndian; }
   virtual bool                  Disassemble(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode);
+  virtual bool                  DisassembleBlock(BinaryStream const& rBinStrm, OffsetType Offset, u8 Mode, u32 MaxInsns, bool StopOnBranch, InstructionBuffer& rInsnBuf);
   virtual NamedModeVector       GetModes(void) const
   {
     NamedModeVector ArmModes;
@@ -0,0 +1,314 @@
+/* This file has been automatically generated, you must _NOT_ edit it directly. (Mon Oct 19 06:06:05 2026) */
+#include "arm_architecture.hpp"
+const char *ArmArchitecture::m_Mnemonic[0x135] =
+{
+  "unknown",
+  "adc",
+  "adcs",
+  "add",
+  "adds",
+  "addw",
+  "adr",
+  "and",
+  "ands",
+  "asr",
+  "asrs",
+  "b",
+  "bfc",
+  "bfi",
+  "bic",
+  "bics",
+  "bkpt",
+  "bl",
+  "blx",
+  "bx",
+  "bxj",
+  "cb",
+  "cdp",
+  "cdp2",
+  "clrex",
+  "clz",
+  "cmn",
+  "cmp",
+  "dbg",
+  "dmb",
+  "dsb",
+  "eor",
+  "eors",
+  "fldmx",
+  "fstmx",
+  "isb",
+  "it",
+  "ldc",
+  "ldc2",
+  "ldm",
+  "ldmda",
+  "ldmdb",
+  "ldmib",
+  "ldr",
+  "ldrb",
+  "ldrbt",
+  "ldrd",
+  "ldrex",
+  "ldrexb",
+  "ldrexd",
+  "ldrexh",
+  "ldrh",
+  "ldrht",
+  "ldrsb",
+  "ldrsbt",
+  "ldrsh",
+  "ldrsht",
+  "ldrt",
+  "lsl",
+  "lsls",
+  "lsr",
+  "lsrs",
+  "mcr",
+  "mcr2",
+  "mcrr",
+  "mcrr2",
+  "mla",
+  "mls",
+  "mov",
+  "movs",
+  "movt",
+  "movw",
+  "mrc",
+  "mrc2",
+  "mrrc",
+  "mrrc2",
+  "mrs",
+  "msr",
+  "mul",
+  "muls",
+  "mvn",
+  "mvns",
+  "nop",
+  "orn",
+  "orr",
+  "orrs",
+  "pkhtb",
+  "pld",
+  "pli",
+  "pop",
+  "push",
+  "qadd",
+  "qadd16",
+  "qadd8",
+  "qasx",
+  "qdadd",
+  "qdsub",
+  "qsax",
+  "qsub",
+  "qsub16",
+  "qsub8",
+  "rbit",
+  "rev",
+  "rev16",
+  "revsh",
+  "ror",
+  "rors",
+  "rrx",
+  "rsb",
+  "rsbs",
+  "rsc",
+  "sadd16",
+  "sadd8",
+  "sasx",
+  "sbc",
+  "sbcs",
+  "sbfx",
+  "sdiv",
+  "sel",
+  "setend",
+  "sev",
+  "shadd16",
+  "shadd8",
+  "shasx",
+  "shsax",
+  "shsub16",
+  "shsub8",
+  "smla",
+  "smlad",
+  "smlal",
+  "smlald",
+  "smlaw",
+  "smlsd",
+  "smlsld",
+  "smmla",
+  "smmls",
+  "smmul",
+  "smuad",
+  "smul",
+  "smull",
+  "smulw",
+  "smusd",
+  "ssat",
+  "ssat16",
+  "ssax",
+  "ssub16",
+  "ssub8",
+  "stc",
+  "stc2",
+  "stm",
+  "stmda",
+  "stmdb",
+  "stmib",
+  "str",
+  "strb",
+  "strbt",
+  "strd",
+  "strex",
+  "strexb",
+  "strexd",
+  "strexh",
+  "strh",
+  "strht",
+  "strt",
+  "sub",
+  "subs",
+  "subw",
+  "svc",
+  "swp",
+  "sxtab",
+  "sxtab16",
+  "sxtah",
+  "sxtb",
+  "sxtb16",
+  "sxth",
+  "tbh",
+  "teq",
+  "tst",
+  "uadd16",
+  "uadd8",
+  "uasx",
+  "ubfx",
+  "udiv",
+  "uhadd16",
+  "uhadd8",
+  "uhasx",
+  "uhsax",
+  "uhsub16",
+  "uhsub8",
+  "umaal",
+  "umlal",
+  "umull",
+  "uqadd16",
+  "uqadd8",
+  "uqasx",
+  "uqsax",
+  "uqsub16",
+  "uqsub8",
+  "usad8",
+  "usada8",
+  "usat",
+  "usat16",
+  "usax",
+  "usub16",
+  "usub8",
+  "uxtab",
+  "uxtab16",
+  "uxtah",
+  "uxtb",
+  "uxtb16",
+  "uxth",
+  "v",
+  "vaba",
+  "vabal",
+  "vabd",
+  "vabdl",
+  "vabs",
+  "vadd",
+  "vaddhn",
+  "vaddl",
+  "vaddw",
+  "vand",
+  "vbic",
+  "vceq",
+  "vcge",
+  "vcgt",
+  "vcle",
+  "vcls",
+  "vclt",
+  "vclz",
+  "vcmp",
+  "vcnt",
+  "vcvt",
+  "vdiv",
+  "vdup",
+  "veor",
+  "vext",
+  "vh",
+  "vld1",
+  "vldm",
+  "vldr",
+  "vmov",
+  "vmovl",
+  "vmovn",
+  "vmrs",
+  "vmsr",
+  "vmul",
+  "vmull",
+  "vmvn",
+  "vneg",
+  "vnmla",
+  "vnmls",
+  "vnmul",
+  "vorn",
+  "vorr",
+  "vp",
+  "vpadal",
+  "vpadd",
+  "vpaddl",
+  "vpop",
+  "vpush",
+  "vqabs",
+  "vqadd",
+  "vqd",
+  "vqdmulh",
+  "vqdmull",
+  "vqmov",
+  "vqneg",
+  "vqrdmulh",
+  "vqrshl",
+  "vqrshr",
+  "vqshl",
+  "vqshr",
+  "vqsub",
+  "vraddhn",
+  "vrecpe",
+  "vrecps",
+  "vrev",
+  "vrhadd",
+  "vrshl",
+  "vrshr",
+  "vrshrn",
+  "vrsqrte",
+  "vrsqrts",
+  "vrsra",
+  "vrsubhn",
+  "vshl",
+  "vshll",
+  "vshr",
+  "vshrn",
+  "vsli",
+  "vsqrt",
+  "vsra",
+  "vsri",
+  "vst1",
+  "vstm",
+  "vstr",
+  "vsub",
+  "vsubhn",
+  "vsubl",
+  "vsubw",
+  "vswp",
+  "vtrn",
+  "vtst",
+  "vuzp",
+  "vzip",
+  "wfe",
+  "wfi",
+  "yield"
+};
@@ -0,0 +1,2 @@
+/* This file has been automatically generated, you must _NOT_ edit it directly. (Mon Oct 19 06:06:05 2026) */
+#include "arm_architecture.hpp"
@@ -86,63 +86,40 @@ u32 St62Architecture::ST62CpuInformation::GetSizeOfRegisterInBit(u32 Id) const
 
 bool St62Architecture::St62CpuContext::ReadRegister(u32 Reg, void* pVal, u32 BitSize) const
 {
-#define READ_F(flg)        if (BitSize != 1)  return false; *reinterpret_cast<bool*>(pVal) = (m_Context.flg) ? true : false;
-#define READ_REGISTER(reg) if (BitSize != 8)  return false; *reinterpret_cast<u8  *>(pVal) = m_Context.reg;
-#define READ_PC(reg)       if (BitSize != 16) return false; *reinterpret_cast<u16 *>(pVal) = m_Context.reg;
-  switch (Reg)
-  {
-  case ST62_Flg_Z: READ_F(ZF); break;
-  case ST62_Flg_C: READ_F(CF); break;
-
-
-  case ST62_Reg_A: READ_REGISTER(A); break;
-  case ST62_Reg_X: READ_REGISTER(X); break;
-  case ST62_Reg_Y: READ_REGISTER(Y); break;
-  case ST62_Reg_V: READ_REGISTER(V); break;
-  case ST62_Reg_W: READ_REGISTER(W); break;
-  case ST62_Reg_Pc:READ_PC(Pc); break;
-  case ST62_Reg_Stk0:READ_PC(Stk[0]); break;
-  case ST62_Reg_Stk1:READ_PC(Stk[1]); break;
-  case ST62_Reg_Stk2:READ_PC(Stk[2]); break;
-  case ST62_Reg_Stk3:READ_PC(Stk[3]); break;
-  case ST62_Reg_Stk4:READ_PC(Stk[4]); break;
-  case ST62_Reg_Stk5:READ_PC(Stk[5]); break;
-  default: return false;
-  }
-#undef READ_REGISTER
-#undef READ_F
-  return true;
+  return _ReadRegister(GetRegisterDescriptor(Reg), &m_Context, pVal, BitSize);
 }
 
 bool St62Architecture::St62CpuContext::WriteRegister(u32 Reg, void const* pVal, u32 BitSize)
 {
-#define WRITE_F(flg)        if (BitSize != 1)  return false; m_Context.flg = *reinterpret_cast<u8 const*>(pVal) ? true : false;
-#define WRITE_REGISTER(reg) if (BitSize != 8)  return false; m_Context.reg = *reinterpret_cast<u8 const*>(pVal);
-#define WRITE_PC(reg)       if (BitSize != 16) return false; m_Context.reg = *reinterpret_cast<u16 const*>(pVal);
-  switch (Reg)
+  return _WriteRegister(GetRegisterDescriptor(Reg), &m_Context, pVal, BitSize);
+}
+
+CpuContext::RegisterDescriptor const* St62Architecture::St62CpuContext::GetRegisterDescriptor(u32 Reg) const
+{
+#define DESC(reg, bits) { static_cast<u16>(offsetof(Context, reg)), bits == 1 ? sizeof(bool) : bits / 8, 0, bits, RegisterDescriptor::ClearContainer }
+  static RegisterDescriptor const s_RegDescs[] =
   {
-  case ST62_Flg_Z: WRITE_F(ZF); break;
-  case ST62_Flg_C: WRITE_F(CF); break;
-
-
-  case ST62_Reg_A: WRITE_REGISTER(A); break;
-  case ST62_Reg_X: WRITE_REGISTER(X); break;
-  case ST62_Reg_Y: WRITE_REGISTER(Y); break;
-  case ST62_Reg_V: WRITE_REGISTER(V); break;
-  case ST62_Reg_W: WRITE_REGISTER(W); break;
-  case ST62_Reg_Pc:WRITE_PC(Pc); break;
-  case ST62_Reg_Stk0:WRITE_PC(Stk[0]); break;
-  case ST62_Reg_Stk1:WRITE_PC(Stk[1]); break;
-  case ST62_Reg_Stk2:WRITE_PC(Stk[2]); break;
-  case ST62_Reg_Stk3:WRITE_PC(Stk[3]); break;
-  case ST62_Reg_Stk4:WRITE_PC(Stk[4]); break;
-  case ST62_Reg_Stk5:WRITE_PC(Stk[5]); break;
-  default: return false;
-  }
-#undef WRITE_REGISTER
-#undef WRITE_F
-#undef WRITE_PC
-  return true;
+    { 0, 0, 0, 0, 0 }, // ST62_Reg_Unknown
+    DESC(CF, 1),       // ST62_Flg_C
+    DESC(ZF, 1),       // ST62_Flg_Z
+    DESC(A, 8),
+    DESC(X, 8),
+    DESC(Y, 8),
+    DESC(V, 8),
+    DESC(W, 8),
+    DESC(Pc, 16),
+    DESC(Stk[0], 16),
+    DESC(Stk[1], 16),
+    DESC(Stk[2], 16),
+    DESC(Stk[3], 16),
+    DESC(Stk[4], 16),
+    DESC(Stk[5], 16),
+  };
+#undef DESC
+
+  if (Reg == ST62_Reg_Unknown || Reg >= sizeof(s_RegDescs) / sizeof(*s_RegDescs))
+    return nullptr;
+  return &s_RegDescs[Reg];
 }
 
 bool St62Architecture::St62CpuContext::Translate(Address const& rLogicalAddress, u64& rLinearAddress) const
@@ -287,6 +264,13 @@ bool St62Architecture::Disassemble(BinaryStream const& rBinStrm, OffsetType Offs
   return Res;
 }
 
+bool St62Architecture::DisassembleBlock(BinaryStream const& rBinStrm, OffsetType Offset, u8 Mode, u32 MaxInsns, bool StopOnBranch, InstructionBuffer& rInsnBuf)
+{
+  return _DisassembleBlock(rBinStrm, Offset, Mode, MaxInsns, StopOnBranch, rInsnBuf,
+    [this](BinaryStream const& rInsnStrm, OffsetType InsnOff, Instruction& rInsn, u8 InsnMode)
+  { return St62Architecture::Disassemble(rInsnStrm, InsnOff, rInsn, InsnMode); });
+}
+
 namespace
 {
   class OperandFormatter : public ExpressionVisitor
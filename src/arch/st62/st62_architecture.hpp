@@ -52,6 +52,7 @@ private:
     virtual void* GetRegisterAddress(u32 Register);
     virtual void* GetContextAddress(void);
     virtual u16   GetRegisterOffset(u32 Register);
+    virtual RegisterDescriptor const* GetRegisterDescriptor(u32 Reg) const;
 
     virtual void  GetRegisters(RegisterList& RegList) const;
 
@@ -79,11 +80,12 @@ private:
   };
 
 public:
-  St62Architecture(void) : Architecture(MEDUSA_ARCH_TAG('S','T','6')) {}
+  St62Architecture(void) : Architecture(MEDUSA_ARCH_TAG('S','T','6')) { _InitializeExpressionTemplates(); }
 
   virtual std::string           GetName(void) const { return "ST62"; }
   virtual bool                  Translate(Address const& rVirtAddr, OffsetType& rPhyslOff) { return false; }
   virtual bool                  Disassemble(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode);
+  virtual bool                  DisassembleBlock(BinaryStream const& rBinStrm, OffsetType Offset, u8 Mode, u32 MaxInsns, bool StopOnBranch, InstructionBuffer& rInsnBuf);
   virtual NamedModeVector       GetModes(void) const
   {
     NamedModeVector Modes;
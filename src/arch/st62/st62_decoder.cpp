@@ -7,8 +7,10 @@ Expression::SPType St62Architecture::__Decode_ext(BinaryStream const& rBinStrm,
   u16 Address;
 
   ++rInsn.Size();
-  rBinStrm.Read(Offset, High);
-  rBinStrm.Read(Offset+1, Low);
+  if (!rBinStrm.Read(Offset, High))
+    return nullptr;
+  if (!rBinStrm.Read(Offset+1, Low))
+    return nullptr;
 
   Address= (u16)((High & 0xF0) >> 4) | ((u16)Low<<4);
 
@@ -21,7 +23,9 @@ Expression::SPType St62Architecture::__Decode_pcr(BinaryStream const& rBinStrm,
   u16 Address;
   u16 Offs;
 
-  rBinStrm.Read(Offset, Byte);
+  if (!rBinStrm.Read(Offset, Byte))
+
+    return nullptr;
   Offs = (Byte>>3) & 0xF;
 
   if (Byte & 0x80) {
@@ -39,7 +43,8 @@ Expression::SPType St62Architecture::__Decode_ee(BinaryStream const& rBinStrm, O
 
   Offset++;
   ++rInsn.Size();
-  rBinStrm.Read(Offset, Byte);
+  if (!rBinStrm.Read(Offset, Byte))
+    return nullptr;
 
   Address= Offset + Byte + 1;
 
@@ -52,7 +57,8 @@ Expression::SPType St62Architecture::__Decode_direct(BinaryStream const& rBinStr
 
   Offset++;
   ++rInsn.Size();
-  rBinStrm.Read(Offset, Value);
+  if (!rBinStrm.Read(Offset, Value))
+    return nullptr;
 
   switch(Value)
  {
@@ -77,7 +83,8 @@ Expression::SPType St62Architecture::__Decode_imm(BinaryStream const& rBinStrm,
 
   Offset++;
   ++rInsn.Size();
-  rBinStrm.Read(Offset, Value);
+  if (!rBinStrm.Read(Offset, Value))
+    return nullptr;
 
   return Expr::MakeBitVector(8, Value);
 }
@@ -88,7 +95,9 @@ Expression::SPType St62Architecture::__Decode_bitdirect(BinaryStream const& rBin
 
   u8 Value;
 
-  rBinStrm.Read(Offset, Value);
+  if (!rBinStrm.Read(Offset, Value))
+
+    return nullptr;
   Value >>= 5;
 
   return Expr::MakeBitVector(8, map_bit[Value & 7]);
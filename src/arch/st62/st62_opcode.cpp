@@ -124,8 +124,8 @@ bool St62Architecture::Table_1_00(BinaryStream const& rBinStrm, OffsetType Offse
       /* semantic: if __expr and zf.id == int1(0): program.id = op0.val */
       AllExpr.push_back(Expr::MakeIfElseCond(
         ConditionExpression::CondEq,
-        Expr::MakeId(ST62_Flg_Z, &m_CpuInfo),
-        Expr::MakeBitVector(1, 0x0),
+        m_ExprTemplates[0x00],
+        m_ExprTemplates[0x01],
         Expr::MakeAssign(
           Expr::MakeId(m_CpuInfo.GetRegisterByType(CpuInformation::ProgramPointerRegister, rInsn.GetMode()), &m_CpuInfo),
           rInsn.GetOperand(0)), nullptr)
@@ -161,28 +161,18 @@ bool St62Architecture::Table_1_01(BinaryStream const& rBinStrm, OffsetType Offse
     {
       Expression::LSPType AllExpr;
       /* semantic: stk5.id = stk4.id */
-      AllExpr.push_back(Expr::MakeAssign(
-        Expr::MakeId(ST62_Reg_Stk5, &m_CpuInfo),
-        Expr::MakeId(ST62_Reg_Stk4, &m_CpuInfo)));
+      AllExpr.push_back(m_ExprTemplates[0x08]);
       /* semantic: stk4.id = stk3.id */
-      AllExpr.push_back(Expr::MakeAssign(
-        Expr::MakeId(ST62_Reg_Stk4, &m_CpuInfo),
-        Expr::MakeId(ST62_Reg_Stk3, &m_CpuInfo)));
+      AllExpr.push_back(m_ExprTemplates[0x09]);
       /* semantic: stk3.id = stk2.id */
-      AllExpr.push_back(Expr::MakeAssign(
-        Expr::MakeId(ST62_Reg_Stk3, &m_CpuInfo),
-        Expr::MakeId(ST62_Reg_Stk2, &m_CpuInfo)));
+      AllExpr.push_back(m_ExprTemplates[0x0a]);
       /* semantic: stk2.id = stk1.id */
-      AllExpr.push_back(Expr::MakeAssign(
-        Expr::MakeId(ST62_Reg_Stk2, &m_CpuInfo),
-        Expr::MakeId(ST62_Reg_Stk1, &m_CpuInfo)));
+      AllExpr.push_back(m_ExprTemplates[0x0b]);
       /* semantic: stk1.id = stk0.id */
-      AllExpr.push_back(Expr::MakeAssign(
-        Expr::MakeId(ST62_Reg_Stk1, &m_CpuInfo),
-        Expr::MakeId(ST62_Reg_Stk0, &m_CpuInfo)));
+      AllExpr.push_back(m_ExprTemplates[0x0c]);
       /* semantic: stk0.id = program.id */
       AllExpr.push_back(Expr::MakeAssign(
-        Expr::MakeId(ST62_Reg_Stk0, &m_CpuInfo),
+        m_ExprTemplates[0x07],
         Expr::MakeId(m_CpuInfo.GetRegisterByType(CpuInformation::ProgramPointerRegister, rInsn.GetMode()), &m_CpuInfo)));
       /* semantic: program.id = op0.val */
       AllExpr.push_back(Expr::MakeAssign(
@@ -217,8 +207,8 @@ bool St62Architecture::Table_1_02(BinaryStream const& rBinStrm, OffsetType Offse
       /* semantic: if __expr and cf.id == int1(0): program.id = op0.val */
       AllExpr.push_back(Expr::MakeIfElseCond(
         ConditionExpression::CondEq,
-        Expr::MakeId(ST62_Flg_C, &m_CpuInfo),
-        Expr::MakeBitVector(1, 0x0),
+        m_ExprTemplates[0x0d],
+        m_ExprTemplates[0x01],
         Expr::MakeAssign(
           Expr::MakeId(m_CpuInfo.GetRegisterByType(CpuInformation::ProgramPointerRegister, rInsn.GetMode()), &m_CpuInfo),
           rInsn.GetOperand(0)), nullptr)
@@ -275,16 +265,16 @@ bool St62Architecture::Table_1_03(BinaryStream const& rBinStrm, OffsetType Offse
       rInsn.SetUpdatedFlags(ST62_Flg_C);
       /* semantic: cf.id = bit_cast(op1.val >> op0.val, int1(1)) */
       AllExpr.push_back(Expr::MakeAssign(
-        Expr::MakeId(ST62_Flg_C, &m_CpuInfo),
+        m_ExprTemplates[0x0d],
         Expr::MakeBinOp(OperationExpression::OpBcast, Expr::MakeBinOp(
           OperationExpression::OpLrs,
           rInsn.GetOperand(1),
-          rInsn.GetOperand(0)), Expr::MakeBitVector(1, 0x1))));
+          rInsn.GetOperand(0)), m_ExprTemplates[0x0e])));
       /* semantic: if __expr and cf.id == int1(1): program.id = op2.val */
       AllExpr.push_back(Expr::MakeIfElseCond(
         ConditionExpression::CondEq,
-        Expr::MakeId(ST62_Flg_C, &m_CpuInfo),
-        Expr::MakeBitVector(1, 0x1),
+        m_ExprTemplates[0x0d],
+        m_ExprTemplates[0x0e],
         Expr::MakeAssign(
           Expr::MakeId(m_CpuInfo.GetRegisterByType(CpuInformation::ProgramPointerRegister, rInsn.GetMode()), &m_CpuInfo),
           rInsn.GetOperand(2)), nullptr)
@@ -298,16 +288,16 @@ bool St62Architecture::Table_1_03(BinaryStream const& rBinStrm, OffsetType Offse
       rInsn.SetUpdatedFlags(ST62_Flg_C);
       /* semantic: cf.id = bit_cast(op1.val >> op0.val, int1(1)) */
       AllExpr.push_back(Expr::MakeAssign(
-        Expr::MakeId(ST62_Flg_C, &m_CpuInfo),
+        m_ExprTemplates[0x0d],
         Expr::MakeBinOp(OperationExpression::OpBcast, Expr::MakeBinOp(
           OperationExpression::OpLrs,
           rInsn.GetOperand(1),
-          rInsn.GetOperand(0)), Expr::MakeBitVector(1, 0x1))));
+          rInsn.GetOperand(0)), m_ExprTemplates[0x0e])));
       /* semantic: if __expr and cf.id == int1(0): program.id = op2.val */
       AllExpr.push_back(Expr::MakeIfElseCond(
         ConditionExpression::CondEq,
-        Expr::MakeId(ST62_Flg_C, &m_CpuInfo),
-        Expr::MakeBitVector(1, 0x0),
+        m_ExprTemplates[0x0d],
+        m_ExprTemplates[0x01],
         Expr::MakeAssign(
           Expr::MakeId(m_CpuInfo.GetRegisterByType(CpuInformation::ProgramPointerRegister, rInsn.GetMode()), &m_CpuInfo),
           rInsn.GetOperand(2)), nullptr)
@@ -379,8 +369,8 @@ bool St62Architecture::Table_1_06(BinaryStream const& rBinStrm, OffsetType Offse
       /* semantic: if __expr and cf.id == int1(1): program.id = op0.val */
       AllExpr.push_back(Expr::MakeIfElseCond(
         ConditionExpression::CondEq,
-        Expr::MakeId(ST62_Flg_C, &m_CpuInfo),
-        Expr::MakeBitVector(1, 0x1),
+        m_ExprTemplates[0x0d],
+        m_ExprTemplates[0x0e],
         Expr::MakeAssign(
           Expr::MakeId(m_CpuInfo.GetRegisterByType(CpuInformation::ProgramPointerRegister, rInsn.GetMode()), &m_CpuInfo),
           rInsn.GetOperand(0)), nullptr)
@@ -430,8 +420,8 @@ bool St62Architecture::Table_1_08(BinaryStream const& rBinStrm, OffsetType Offse
       /* semantic: if __expr and zf.id == int1(0): program.id = op0.val */
       AllExpr.push_back(Expr::MakeIfElseCond(
         ConditionExpression::CondEq,
-        Expr::MakeId(ST62_Flg_Z, &m_CpuInfo),
-        Expr::MakeBitVector(1, 0x0),
+        m_ExprTemplates[0x00],
+        m_ExprTemplates[0x01],
         Expr::MakeAssign(
           Expr::MakeId(m_CpuInfo.GetRegisterByType(CpuInformation::ProgramPointerRegister, rInsn.GetMode()), &m_CpuInfo),
           rInsn.GetOperand(0)), nullptr)
@@ -493,8 +483,8 @@ bool St62Architecture::Table_1_0a(BinaryStream const& rBinStrm, OffsetType Offse
       /* semantic: if __expr and cf.id == int1(0): program.id = op0.val */
       AllExpr.push_back(Expr::MakeIfElseCond(
         ConditionExpression::CondEq,
-        Expr::MakeId(ST62_Flg_C, &m_CpuInfo),
-        Expr::MakeBitVector(1, 0x0),
+        m_ExprTemplates[0x0d],
+        m_ExprTemplates[0x01],
         Expr::MakeAssign(
           Expr::MakeId(m_CpuInfo.GetRegisterByType(CpuInformation::ProgramPointerRegister, rInsn.GetMode()), &m_CpuInfo),
           rInsn.GetOperand(0)), nullptr)
@@ -546,7 +536,7 @@ bool St62Architecture::Table_1_0b(BinaryStream const& rBinStrm, OffsetType Offse
           rInsn.GetOperand(1),
           Expr::MakeBinOp(
             OperationExpression::OpLls,
-            Expr::MakeBitVector(8, 0x1),
+            m_ExprTemplates[0x0f],
             rInsn.GetOperand(0)))));
       rInsn.SetSemantic(AllExpr);
     }
@@ -564,7 +554,7 @@ bool St62Architecture::Table_1_0b(BinaryStream const& rBinStrm, OffsetType Offse
             OperationExpression::OpNot,
             Expr::MakeBinOp(
               OperationExpression::OpLls,
-              Expr::MakeBitVector(8, 0x1),
+              m_ExprTemplates[0x0f],
               rInsn.GetOperand(0))))));
       rInsn.SetSemantic(AllExpr);
     }
@@ -595,8 +585,8 @@ bool St62Architecture::Table_1_0c(BinaryStream const& rBinStrm, OffsetType Offse
       /* semantic: if __expr and zf.id == int1(1): program.id = op0.val */
       AllExpr.push_back(Expr::MakeIfElseCond(
         ConditionExpression::CondEq,
-        Expr::MakeId(ST62_Flg_Z, &m_CpuInfo),
-        Expr::MakeBitVector(1, 0x1),
+        m_ExprTemplates[0x00],
+        m_ExprTemplates[0x0e],
         Expr::MakeAssign(
           Expr::MakeId(m_CpuInfo.GetRegisterByType(CpuInformation::ProgramPointerRegister, rInsn.GetMode()), &m_CpuInfo),
           rInsn.GetOperand(0)), nullptr)
@@ -646,8 +636,8 @@ bool St62Architecture::Table_1_0e(BinaryStream const& rBinStrm, OffsetType Offse
       /* semantic: if __expr and cf.id == int1(1): program.id = op0.val */
       AllExpr.push_back(Expr::MakeIfElseCond(
         ConditionExpression::CondEq,
-        Expr::MakeId(ST62_Flg_C, &m_CpuInfo),
-        Expr::MakeBitVector(1, 0x1),
+        m_ExprTemplates[0x0d],
+        m_ExprTemplates[0x0e],
         Expr::MakeAssign(
           Expr::MakeId(m_CpuInfo.GetRegisterByType(CpuInformation::ProgramPointerRegister, rInsn.GetMode()), &m_CpuInfo),
           rInsn.GetOperand(0)), nullptr)
@@ -725,11 +715,11 @@ bool St62Architecture::Table_5_01(BinaryStream const& rBinStrm, OffsetType Offse
           Expr::MakeVar("op1", VariableExpression::Use))));
       /* semantic: call('zero_flag') */
       AllExpr.push_back(Expr::MakeAssign(
-        Expr::MakeId(ST62_Flg_Z, &m_CpuInfo),
+        m_ExprTemplates[0x00],
         Expr::MakeTernaryCond(ConditionExpression::CondEq,
         Expr::MakeVar("res", VariableExpression::Use),
         Expr::MakeBitVector(rInsn.GetOperand(0)->GetBitSize(), 0x0),
-        Expr::MakeBitVector(1, 0x1), Expr::MakeBitVector(1, 0x0))));
+        m_ExprTemplates[0x0e], m_ExprTemplates[0x01])));
       /* semantic: op0.val = res.val */
       AllExpr.push_back(Expr::MakeAssign(
         rInsn.GetOperand(0),
@@ -787,11 +777,11 @@ bool St62Architecture::Table_5_03(BinaryStream const& rBinStrm, OffsetType Offse
         rInsn.GetOperand(1)));
       /* semantic: call('zero_flag') */
       AllExpr.push_back(Expr::MakeAssign(
-        Expr::MakeId(ST62_Flg_Z, &m_CpuInfo),
+        m_ExprTemplates[0x00],
         Expr::MakeTernaryCond(ConditionExpression::CondEq,
         Expr::MakeVar("res", VariableExpression::Use),
         Expr::MakeBitVector(rInsn.GetOperand(0)->GetBitSize(), 0x0),
-        Expr::MakeBitVector(1, 0x1), Expr::MakeBitVector(1, 0x0))));
+        m_ExprTemplates[0x0e], m_ExprTemplates[0x01])));
       /* semantic: op0.val = res.val */
       AllExpr.push_back(Expr::MakeAssign(
         rInsn.GetOperand(0),
@@ -855,11 +845,11 @@ bool St62Architecture::Table_5_05(BinaryStream const& rBinStrm, OffsetType Offse
           Expr::MakeVar("op1", VariableExpression::Use))));
       /* semantic: call('zero_flag') */
       AllExpr.push_back(Expr::MakeAssign(
-        Expr::MakeId(ST62_Flg_Z, &m_CpuInfo),
+        m_ExprTemplates[0x00],
         Expr::MakeTernaryCond(ConditionExpression::CondEq,
         Expr::MakeVar("res", VariableExpression::Use),
         Expr::MakeBitVector(rInsn.GetOperand(0)->GetBitSize(), 0x0),
-        Expr::MakeBitVector(1, 0x1), Expr::MakeBitVector(1, 0x0))));
+        m_ExprTemplates[0x0e], m_ExprTemplates[0x01])));
       /* semantic: op0.val = res.val */
       AllExpr.push_back(Expr::MakeAssign(
         rInsn.GetOperand(0),
@@ -917,11 +907,11 @@ bool St62Architecture::Table_5_07(BinaryStream const& rBinStrm, OffsetType Offse
         rInsn.GetOperand(1)));
       /* semantic: call('zero_flag') */
       AllExpr.push_back(Expr::MakeAssign(
-        Expr::MakeId(ST62_Flg_Z, &m_CpuInfo),
+        m_ExprTemplates[0x00],
         Expr::MakeTernaryCond(ConditionExpression::CondEq,
         Expr::MakeVar("res", VariableExpression::Use),
         Expr::MakeBitVector(rInsn.GetOperand(0)->GetBitSize(), 0x0),
-        Expr::MakeBitVector(1, 0x1), Expr::MakeBitVector(1, 0x0))));
+        m_ExprTemplates[0x0e], m_ExprTemplates[0x01])));
       /* semantic: op0.val = res.val */
       AllExpr.push_back(Expr::MakeAssign(
         rInsn.GetOperand(0),
@@ -985,11 +975,11 @@ bool St62Architecture::Table_5_09(BinaryStream const& rBinStrm, OffsetType Offse
           Expr::MakeVar("op1", VariableExpression::Use))));
       /* semantic: call('zero_flag') */
       AllExpr.push_back(Expr::MakeAssign(
-        Expr::MakeId(ST62_Flg_Z, &m_CpuInfo),
+        m_ExprTemplates[0x00],
         Expr::MakeTernaryCond(ConditionExpression::CondEq,
         Expr::MakeVar("res", VariableExpression::Use),
         Expr::MakeBitVector(rInsn.GetOperand(0)->GetBitSize(), 0x0),
-        Expr::MakeBitVector(1, 0x1), Expr::MakeBitVector(1, 0x0))));
+        m_ExprTemplates[0x0e], m_ExprTemplates[0x01])));
       /* semantic: op0.val = res.val */
       AllExpr.push_back(Expr::MakeAssign(
         rInsn.GetOperand(0),
@@ -1047,11 +1037,11 @@ bool St62Architecture::Table_5_0b(BinaryStream const& rBinStrm, OffsetType Offse
         rInsn.GetOperand(1)));
       /* semantic: call('zero_flag') */
       AllExpr.push_back(Expr::MakeAssign(
-        Expr::MakeId(ST62_Flg_Z, &m_CpuInfo),
+        m_ExprTemplates[0x00],
         Expr::MakeTernaryCond(ConditionExpression::CondEq,
         Expr::MakeVar("res", VariableExpression::Use),
         Expr::MakeBitVector(rInsn.GetOperand(0)->GetBitSize(), 0x0),
-        Expr::MakeBitVector(1, 0x1), Expr::MakeBitVector(1, 0x0))));
+        m_ExprTemplates[0x0e], m_ExprTemplates[0x01])));
       /* semantic: op0.val = res.val */
       AllExpr.push_back(Expr::MakeAssign(
         rInsn.GetOperand(0),
@@ -1115,11 +1105,11 @@ bool St62Architecture::Table_5_0d(BinaryStream const& rBinStrm, OffsetType Offse
           Expr::MakeVar("op1", VariableExpression::Use))));
       /* semantic: call('zero_flag') */
       AllExpr.push_back(Expr::MakeAssign(
-        Expr::MakeId(ST62_Flg_Z, &m_CpuInfo),
+        m_ExprTemplates[0x00],
         Expr::MakeTernaryCond(ConditionExpression::CondEq,
         Expr::MakeVar("res", VariableExpression::Use),
         Expr::MakeBitVector(rInsn.GetOperand(0)->GetBitSize(), 0x0),
-        Expr::MakeBitVector(1, 0x1), Expr::MakeBitVector(1, 0x0))));
+        m_ExprTemplates[0x0e], m_ExprTemplates[0x01])));
       /* semantic: op0.val = res.val */
       AllExpr.push_back(Expr::MakeAssign(
         rInsn.GetOperand(0),
@@ -1177,11 +1167,11 @@ bool St62Architecture::Table_5_0f(BinaryStream const& rBinStrm, OffsetType Offse
         rInsn.GetOperand(1)));
       /* semantic: call('zero_flag') */
       AllExpr.push_back(Expr::MakeAssign(
-        Expr::MakeId(ST62_Flg_Z, &m_CpuInfo),
+        m_ExprTemplates[0x00],
         Expr::MakeTernaryCond(ConditionExpression::CondEq,
         Expr::MakeVar("res", VariableExpression::Use),
         Expr::MakeBitVector(rInsn.GetOperand(0)->GetBitSize(), 0x0),
-        Expr::MakeBitVector(1, 0x1), Expr::MakeBitVector(1, 0x0))));
+        m_ExprTemplates[0x0e], m_ExprTemplates[0x01])));
       /* semantic: op0.val = res.val */
       AllExpr.push_back(Expr::MakeAssign(
         rInsn.GetOperand(0),
@@ -1228,11 +1218,11 @@ bool St62Architecture::Table_7_00(BinaryStream const& rBinStrm, OffsetType Offse
         rInsn.GetOperand(1)));
       /* semantic: call('zero_flag') */
       AllExpr.push_back(Expr::MakeAssign(
-        Expr::MakeId(ST62_Flg_Z, &m_CpuInfo),
+        m_ExprTemplates[0x00],
         Expr::MakeTernaryCond(ConditionExpression::CondEq,
         Expr::MakeVar("res", VariableExpression::Use),
         Expr::MakeBitVector(rInsn.GetOperand(0)->GetBitSize(), 0x0),
-        Expr::MakeBitVector(1, 0x1), Expr::MakeBitVector(1, 0x0))));
+        m_ExprTemplates[0x0e], m_ExprTemplates[0x01])));
       /* semantic: op0.val = res.val */
       AllExpr.push_back(Expr::MakeAssign(
         rInsn.GetOperand(0),
@@ -1279,11 +1269,11 @@ bool St62Architecture::Table_7_01(BinaryStream const& rBinStrm, OffsetType Offse
         rInsn.GetOperand(1)));
       /* semantic: call('zero_flag') */
       AllExpr.push_back(Expr::MakeAssign(
-        Expr::MakeId(ST62_Flg_Z, &m_CpuInfo),
+        m_ExprTemplates[0x00],
         Expr::MakeTernaryCond(ConditionExpression::CondEq,
         Expr::MakeVar("res", VariableExpression::Use),
         Expr::MakeBitVector(rInsn.GetOperand(0)->GetBitSize(), 0x0),
-        Expr::MakeBitVector(1, 0x1), Expr::MakeBitVector(1, 0x0))));
+        m_ExprTemplates[0x0e], m_ExprTemplates[0x01])));
       /* semantic: op0.val = res.val */
       AllExpr.push_back(Expr::MakeAssign(
         rInsn.GetOperand(0),
@@ -1333,11 +1323,11 @@ bool St62Architecture::Table_7_02(BinaryStream const& rBinStrm, OffsetType Offse
       /* semantic: cf.id = ite(op0.val < op1.val, int1(1), int1(0))
       free_var('res') */
       AllExpr.push_back(Expr::MakeAssign(
-        Expr::MakeId(ST62_Flg_C, &m_CpuInfo),
+        m_ExprTemplates[0x0d],
         Expr::MakeTernaryCond(ConditionExpression::CondUlt,
         rInsn.GetOperand(0),
         rInsn.GetOperand(1),
-        Expr::MakeBitVector(1, 0x1), Expr::MakeBitVector(1, 0x0))));
+        m_ExprTemplates[0x0e], m_ExprTemplates[0x01])));
       AllExpr.push_back(Expr::MakeVar("res", VariableExpression::Free));
       rInsn.SetSemantic(AllExpr);
     }
@@ -1382,11 +1372,11 @@ bool St62Architecture::Table_7_03(BinaryStream const& rBinStrm, OffsetType Offse
       /* semantic: cf.id = ite(op0.val < op1.val, int1(1), int1(0))
       free_var('res') */
       AllExpr.push_back(Expr::MakeAssign(
-        Expr::MakeId(ST62_Flg_C, &m_CpuInfo),
+        m_ExprTemplates[0x0d],
         Expr::MakeTernaryCond(ConditionExpression::CondUlt,
         rInsn.GetOperand(0),
         rInsn.GetOperand(1),
-        Expr::MakeBitVector(1, 0x1), Expr::MakeBitVector(1, 0x0))));
+        m_ExprTemplates[0x0e], m_ExprTemplates[0x01])));
       AllExpr.push_back(Expr::MakeVar("res", VariableExpression::Free));
       rInsn.SetSemantic(AllExpr);
     }
@@ -1432,14 +1422,14 @@ bool St62Architecture::Table_7_04(BinaryStream const& rBinStrm, OffsetType Offse
           rInsn.GetOperand(1))));
       /* semantic: call('zero_flag') */
       AllExpr.push_back(Expr::MakeAssign(
-        Expr::MakeId(ST62_Flg_Z, &m_CpuInfo),
+        m_ExprTemplates[0x00],
         Expr::MakeTernaryCond(ConditionExpression::CondEq,
         Expr::MakeVar("res", VariableExpression::Use),
         Expr::MakeBitVector(rInsn.GetOperand(0)->GetBitSize(), 0x0),
-        Expr::MakeBitVector(1, 0x1), Expr::MakeBitVector(1, 0x0))));
+        m_ExprTemplates[0x0e], m_ExprTemplates[0x01])));
       /* semantic: call('carry_flag_add') */
       AllExpr.push_back(Expr::MakeAssign(
-        Expr::MakeId(ST62_Flg_C, &m_CpuInfo),
+        m_ExprTemplates[0x0d],
         Expr::MakeBinOp(OperationExpression::OpBcast, Expr::MakeBinOp(
           OperationExpression::OpLrs,
           Expr::MakeBinOp(
@@ -1464,7 +1454,7 @@ bool St62Architecture::Table_7_04(BinaryStream const& rBinStrm, OffsetType Offse
           Expr::MakeBinOp(
             OperationExpression::OpSub,
             Expr::MakeBitVector(rInsn.GetOperand(0)->GetBitSize(), rInsn.GetOperand(0)->GetBitSize()),
-            Expr::MakeBitVector(rInsn.GetOperand(0)->GetBitSize(), 0x1))), Expr::MakeBitVector(1, 0x1))));
+            Expr::MakeBitVector(rInsn.GetOperand(0)->GetBitSize(), 0x1))), m_ExprTemplates[0x0e])));
       /* semantic: op0.val = res */
       AllExpr.push_back(Expr::MakeAssign(
         rInsn.GetOperand(0),
@@ -1515,14 +1505,14 @@ bool St62Architecture::Table_7_05(BinaryStream const& rBinStrm, OffsetType Offse
           rInsn.GetOperand(1))));
       /* semantic: call('zero_flag') */
       AllExpr.push_back(Expr::MakeAssign(
-        Expr::MakeId(ST62_Flg_Z, &m_CpuInfo),
+        m_ExprTemplates[0x00],
         Expr::MakeTernaryCond(ConditionExpression::CondEq,
         Expr::MakeVar("res", VariableExpression::Use),
         Expr::MakeBitVector(rInsn.GetOperand(0)->GetBitSize(), 0x0),
-        Expr::MakeBitVector(1, 0x1), Expr::MakeBitVector(1, 0x0))));
+        m_ExprTemplates[0x0e], m_ExprTemplates[0x01])));
       /* semantic: call('carry_flag_add') */
       AllExpr.push_back(Expr::MakeAssign(
-        Expr::MakeId(ST62_Flg_C, &m_CpuInfo),
+        m_ExprTemplates[0x0d],
         Expr::MakeBinOp(OperationExpression::OpBcast, Expr::MakeBinOp(
           OperationExpression::OpLrs,
           Expr::MakeBinOp(
@@ -1547,7 +1537,7 @@ bool St62Architecture::Table_7_05(BinaryStream const& rBinStrm, OffsetType Offse
           Expr::MakeBinOp(
             OperationExpression::OpSub,
             Expr::MakeBitVector(rInsn.GetOperand(0)->GetBitSize(), rInsn.GetOperand(0)->GetBitSize()),
-            Expr::MakeBitVector(rInsn.GetOperand(0)->GetBitSize(), 0x1))), Expr::MakeBitVector(1, 0x1))));
+            Expr::MakeBitVector(rInsn.GetOperand(0)->GetBitSize(), 0x1))), m_ExprTemplates[0x0e])));
       /* semantic: op0.val = res */
       AllExpr.push_back(Expr::MakeAssign(
         rInsn.GetOperand(0),
@@ -1602,11 +1592,11 @@ bool St62Architecture::Table_7_06(BinaryStream const& rBinStrm, OffsetType Offse
           Expr::MakeVar("op1", VariableExpression::Use))));
       /* semantic: call('zero_flag') */
       AllExpr.push_back(Expr::MakeAssign(
-        Expr::MakeId(ST62_Flg_Z, &m_CpuInfo),
+        m_ExprTemplates[0x00],
         Expr::MakeTernaryCond(ConditionExpression::CondEq,
         Expr::MakeVar("res", VariableExpression::Use),
         Expr::MakeBitVector(rInsn.GetOperand(0)->GetBitSize(), 0x0),
-        Expr::MakeBitVector(1, 0x1), Expr::MakeBitVector(1, 0x0))));
+        m_ExprTemplates[0x0e], m_ExprTemplates[0x01])));
       /* semantic: op0.val = res.val */
       AllExpr.push_back(Expr::MakeAssign(
         rInsn.GetOperand(0),
@@ -1664,11 +1654,11 @@ bool St62Architecture::Table_7_08(BinaryStream const& rBinStrm, OffsetType Offse
         rInsn.GetOperand(1)));
       /* semantic: call('zero_flag') */
       AllExpr.push_back(Expr::MakeAssign(
-        Expr::MakeId(ST62_Flg_Z, &m_CpuInfo),
+        m_ExprTemplates[0x00],
         Expr::MakeTernaryCond(ConditionExpression::CondEq,
         Expr::MakeVar("res", VariableExpression::Use),
         Expr::MakeBitVector(rInsn.GetOperand(0)->GetBitSize(), 0x0),
-        Expr::MakeBitVector(1, 0x1), Expr::MakeBitVector(1, 0x0))));
+        m_ExprTemplates[0x0e], m_ExprTemplates[0x01])));
       /* semantic: op0.val = res.val */
       AllExpr.push_back(Expr::MakeAssign(
         rInsn.GetOperand(0),
@@ -1728,11 +1718,11 @@ bool St62Architecture::Table_7_0a(BinaryStream const& rBinStrm, OffsetType Offse
       /* semantic: call('zero_flag')
       op0.val = res */
       AllExpr.push_back(Expr::MakeAssign(
-        Expr::MakeId(ST62_Flg_Z, &m_CpuInfo),
+        m_ExprTemplates[0x00],
         Expr::MakeTernaryCond(ConditionExpression::CondEq,
         Expr::MakeVar("res", VariableExpression::Use),
         Expr::MakeBitVector(rInsn.GetOperand(0)->GetBitSize(), 0x0),
-        Expr::MakeBitVector(1, 0x1), Expr::MakeBitVector(1, 0x0))));
+        m_ExprTemplates[0x0e], m_ExprTemplates[0x01])));
       AllExpr.push_back(Expr::MakeAssign(
         rInsn.GetOperand(0),
         Expr::MakeVar("res", VariableExpression::Use)));
@@ -1782,11 +1772,11 @@ bool St62Architecture::Table_7_0b(BinaryStream const& rBinStrm, OffsetType Offse
       /* semantic: call('zero_flag')
       op0.val = res */
       AllExpr.push_back(Expr::MakeAssign(
-        Expr::MakeId(ST62_Flg_Z, &m_CpuInfo),
+        m_ExprTemplates[0x00],
         Expr::MakeTernaryCond(ConditionExpression::CondEq,
         Expr::MakeVar("res", VariableExpression::Use),
         Expr::MakeBitVector(rInsn.GetOperand(0)->GetBitSize(), 0x0),
-        Expr::MakeBitVector(1, 0x1), Expr::MakeBitVector(1, 0x0))));
+        m_ExprTemplates[0x0e], m_ExprTemplates[0x01])));
       AllExpr.push_back(Expr::MakeAssign(
         rInsn.GetOperand(0),
         Expr::MakeVar("res", VariableExpression::Use)));
@@ -1836,19 +1826,19 @@ bool St62Architecture::Table_7_0c(BinaryStream const& rBinStrm, OffsetType Offse
           rInsn.GetOperand(1))));
       /* semantic: call('zero_flag') */
       AllExpr.push_back(Expr::MakeAssign(
-        Expr::MakeId(ST62_Flg_Z, &m_CpuInfo),
+        m_ExprTemplates[0x00],
         Expr::MakeTernaryCond(ConditionExpression::CondEq,
         Expr::MakeVar("res", VariableExpression::Use),
         Expr::MakeBitVector(rInsn.GetOperand(0)->GetBitSize(), 0x0),
-        Expr::MakeBitVector(1, 0x1), Expr::MakeBitVector(1, 0x0))));
+        m_ExprTemplates[0x0e], m_ExprTemplates[0x01])));
       /* semantic: cf.id = ite(op0.val < op1.val, int1(1), int1(0))
       op0.val = res */
       AllExpr.push_back(Expr::MakeAssign(
-        Expr::MakeId(ST62_Flg_C, &m_CpuInfo),
+        m_ExprTemplates[0x0d],
         Expr::MakeTernaryCond(ConditionExpression::CondUlt,
         rInsn.GetOperand(0),
         rInsn.GetOperand(1),
-        Expr::MakeBitVector(1, 0x1), Expr::MakeBitVector(1, 0x0))));
+        m_ExprTemplates[0x0e], m_ExprTemplates[0x01])));
       AllExpr.push_back(Expr::MakeAssign(
         rInsn.GetOperand(0),
         Expr::MakeVar("res", VariableExpression::Use)));
@@ -1898,19 +1888,19 @@ bool St62Architecture::Table_7_0d(BinaryStream const& rBinStrm, OffsetType Offse
           rInsn.GetOperand(1))));
       /* semantic: call('zero_flag') */
       AllExpr.push_back(Expr::MakeAssign(
-        Expr::MakeId(ST62_Flg_Z, &m_CpuInfo),
+        m_ExprTemplates[0x00],
         Expr::MakeTernaryCond(ConditionExpression::CondEq,
         Expr::MakeVar("res", VariableExpression::Use),
         Expr::MakeBitVector(rInsn.GetOperand(0)->GetBitSize(), 0x0),
-        Expr::MakeBitVector(1, 0x1), Expr::MakeBitVector(1, 0x0))));
+        m_ExprTemplates[0x0e], m_ExprTemplates[0x01])));
       /* semantic: cf.id = ite(op0.val < op1.val, int1(1), int1(0))
       op0.val = res */
       AllExpr.push_back(Expr::MakeAssign(
-        Expr::MakeId(ST62_Flg_C, &m_CpuInfo),
+        m_ExprTemplates[0x0d],
         Expr::MakeTernaryCond(ConditionExpression::CondUlt,
         rInsn.GetOperand(0),
         rInsn.GetOperand(1),
-        Expr::MakeBitVector(1, 0x1), Expr::MakeBitVector(1, 0x0))));
+        m_ExprTemplates[0x0e], m_ExprTemplates[0x01])));
       AllExpr.push_back(Expr::MakeAssign(
         rInsn.GetOperand(0),
         Expr::MakeVar("res", VariableExpression::Use)));
@@ -1964,11 +1954,11 @@ bool St62Architecture::Table_7_0e(BinaryStream const& rBinStrm, OffsetType Offse
           Expr::MakeVar("op1", VariableExpression::Use))));
       /* semantic: call('zero_flag') */
       AllExpr.push_back(Expr::MakeAssign(
-        Expr::MakeId(ST62_Flg_Z, &m_CpuInfo),
+        m_ExprTemplates[0x00],
         Expr::MakeTernaryCond(ConditionExpression::CondEq,
         Expr::MakeVar("res", VariableExpression::Use),
         Expr::MakeBitVector(rInsn.GetOperand(0)->GetBitSize(), 0x0),
-        Expr::MakeBitVector(1, 0x1), Expr::MakeBitVector(1, 0x0))));
+        m_ExprTemplates[0x0e], m_ExprTemplates[0x01])));
       /* semantic: op0.val = res.val */
       AllExpr.push_back(Expr::MakeAssign(
         rInsn.GetOperand(0),
@@ -2024,11 +2014,11 @@ bool St62Architecture::Table_d_00(BinaryStream const& rBinStrm, OffsetType Offse
         rInsn.GetOperand(1)));
       /* semantic: call('zero_flag') */
       AllExpr.push_back(Expr::MakeAssign(
-        Expr::MakeId(ST62_Flg_Z, &m_CpuInfo),
+        m_ExprTemplates[0x00],
         Expr::MakeTernaryCond(ConditionExpression::CondEq,
         Expr::MakeVar("res", VariableExpression::Use),
         Expr::MakeBitVector(rInsn.GetOperand(0)->GetBitSize(), 0x0),
-        Expr::MakeBitVector(1, 0x1), Expr::MakeBitVector(1, 0x0))));
+        m_ExprTemplates[0x0e], m_ExprTemplates[0x01])));
       /* semantic: op0.val = res.val */
       AllExpr.push_back(Expr::MakeAssign(
         rInsn.GetOperand(0),
@@ -2086,14 +2076,14 @@ bool St62Architecture::Table_d_02(BinaryStream const& rBinStrm, OffsetType Offse
       AllExpr.push_back(Expr::MakeVar("res", VariableExpression::Alloc, rInsn.GetOperand(0)->GetBitSize()));
       /* semantic: cf.id = bit_cast(op0.val >> (int(op0.bit, op0.bit) - int(op0.bit, 1)), int1(1)) */
       AllExpr.push_back(Expr::MakeAssign(
-        Expr::MakeId(ST62_Flg_C, &m_CpuInfo),
+        m_ExprTemplates[0x0d],
         Expr::MakeBinOp(OperationExpression::OpBcast, Expr::MakeBinOp(
           OperationExpression::OpLrs,
           rInsn.GetOperand(0),
           Expr::MakeBinOp(
             OperationExpression::OpSub,
             Expr::MakeBitVector(rInsn.GetOperand(0)->GetBitSize(), rInsn.GetOperand(0)->GetBitSize()),
-            Expr::MakeBitVector(rInsn.GetOperand(0)->GetBitSize(), 0x1))), Expr::MakeBitVector(1, 0x1))));
+            Expr::MakeBitVector(rInsn.GetOperand(0)->GetBitSize(), 0x1))), m_ExprTemplates[0x0e])));
       /* semantic: res = ~op0.val */
       AllExpr.push_back(Expr::MakeAssign(
         Expr::MakeVar("res", VariableExpression::Use),
@@ -2107,11 +2097,11 @@ bool St62Architecture::Table_d_02(BinaryStream const& rBinStrm, OffsetType Offse
       /* semantic: call('zero_flag')
       free_var('res') */
       AllExpr.push_back(Expr::MakeAssign(
-        Expr::MakeId(ST62_Flg_Z, &m_CpuInfo),
+        m_ExprTemplates[0x00],
         Expr::MakeTernaryCond(ConditionExpression::CondEq,
         Expr::MakeVar("res", VariableExpression::Use),
         Expr::MakeBitVector(rInsn.GetOperand(0)->GetBitSize(), 0x0),
-        Expr::MakeBitVector(1, 0x1), Expr::MakeBitVector(1, 0x0))));
+        m_ExprTemplates[0x0e], m_ExprTemplates[0x01])));
       AllExpr.push_back(Expr::MakeVar("res", VariableExpression::Free));
       rInsn.SetSemantic(AllExpr);
     }
@@ -2153,11 +2143,11 @@ bool St62Architecture::Table_d_03(BinaryStream const& rBinStrm, OffsetType Offse
         rInsn.GetOperand(1)));
       /* semantic: call('zero_flag') */
       AllExpr.push_back(Expr::MakeAssign(
-        Expr::MakeId(ST62_Flg_Z, &m_CpuInfo),
+        m_ExprTemplates[0x00],
         Expr::MakeTernaryCond(ConditionExpression::CondEq,
         Expr::MakeVar("res", VariableExpression::Use),
         Expr::MakeBitVector(rInsn.GetOperand(0)->GetBitSize(), 0x0),
-        Expr::MakeBitVector(1, 0x1), Expr::MakeBitVector(1, 0x0))));
+        m_ExprTemplates[0x0e], m_ExprTemplates[0x01])));
       /* semantic: op0.val = res.val */
       AllExpr.push_back(Expr::MakeAssign(
         rInsn.GetOperand(0),
@@ -2193,27 +2183,17 @@ bool St62Architecture::Table_d_04(BinaryStream const& rBinStrm, OffsetType Offse
       /* semantic: program.id = stk0.id */
       AllExpr.push_back(Expr::MakeAssign(
         Expr::MakeId(m_CpuInfo.GetRegisterByType(CpuInformation::ProgramPointerRegister, rInsn.GetMode()), &m_CpuInfo),
-        Expr::MakeId(ST62_Reg_Stk0, &m_CpuInfo)));
+        m_ExprTemplates[0x07]));
       /* semantic: stk0.id = stk1.id */
-      AllExpr.push_back(Expr::MakeAssign(
-        Expr::MakeId(ST62_Reg_Stk0, &m_CpuInfo),
-        Expr::MakeId(ST62_Reg_Stk1, &m_CpuInfo)));
+      AllExpr.push_back(m_ExprTemplates[0x10]);
       /* semantic: stk1.id = stk2.id */
-      AllExpr.push_back(Expr::MakeAssign(
-        Expr::MakeId(ST62_Reg_Stk1, &m_CpuInfo),
-        Expr::MakeId(ST62_Reg_Stk2, &m_CpuInfo)));
+      AllExpr.push_back(m_ExprTemplates[0x11]);
       /* semantic: stk2.id = stk3.id */
-      AllExpr.push_back(Expr::MakeAssign(
-        Expr::MakeId(ST62_Reg_Stk2, &m_CpuInfo),
-        Expr::MakeId(ST62_Reg_Stk3, &m_CpuInfo)));
+      AllExpr.push_back(m_ExprTemplates[0x12]);
       /* semantic: stk3.id = stk4.id */
-      AllExpr.push_back(Expr::MakeAssign(
-        Expr::MakeId(ST62_Reg_Stk3, &m_CpuInfo),
-        Expr::MakeId(ST62_Reg_Stk4, &m_CpuInfo)));
+      AllExpr.push_back(m_ExprTemplates[0x13]);
       /* semantic: stk4.id = stk5.id */
-      AllExpr.push_back(Expr::MakeAssign(
-        Expr::MakeId(ST62_Reg_Stk4, &m_CpuInfo),
-        Expr::MakeId(ST62_Reg_Stk5, &m_CpuInfo)));
+      AllExpr.push_back(m_ExprTemplates[0x14]);
       rInsn.SetSemantic(AllExpr);
     }
     return true;
@@ -2262,11 +2242,11 @@ bool St62Architecture::Table_d_05(BinaryStream const& rBinStrm, OffsetType Offse
           Expr::MakeVar("op1", VariableExpression::Use))));
       /* semantic: call('zero_flag') */
       AllExpr.push_back(Expr::MakeAssign(
-        Expr::MakeId(ST62_Flg_Z, &m_CpuInfo),
+        m_ExprTemplates[0x00],
         Expr::MakeTernaryCond(ConditionExpression::CondEq,
         Expr::MakeVar("res", VariableExpression::Use),
         Expr::MakeBitVector(rInsn.GetOperand(0)->GetBitSize(), 0x0),
-        Expr::MakeBitVector(1, 0x1), Expr::MakeBitVector(1, 0x0))));
+        m_ExprTemplates[0x0e], m_ExprTemplates[0x01])));
       /* semantic: op0.val = res.val */
       AllExpr.push_back(Expr::MakeAssign(
         rInsn.GetOperand(0),
@@ -2326,11 +2306,11 @@ bool St62Architecture::Table_d_07(BinaryStream const& rBinStrm, OffsetType Offse
         rInsn.GetOperand(1)));
       /* semantic: call('zero_flag') */
       AllExpr.push_back(Expr::MakeAssign(
-        Expr::MakeId(ST62_Flg_Z, &m_CpuInfo),
+        m_ExprTemplates[0x00],
         Expr::MakeTernaryCond(ConditionExpression::CondEq,
         Expr::MakeVar("res", VariableExpression::Use),
         Expr::MakeBitVector(rInsn.GetOperand(0)->GetBitSize(), 0x0),
-        Expr::MakeBitVector(1, 0x1), Expr::MakeBitVector(1, 0x0))));
+        m_ExprTemplates[0x0e], m_ExprTemplates[0x01])));
       /* semantic: op0.val = res.val */
       AllExpr.push_back(Expr::MakeAssign(
         rInsn.GetOperand(0),
@@ -2394,11 +2374,11 @@ bool St62Architecture::Table_d_09(BinaryStream const& rBinStrm, OffsetType Offse
           Expr::MakeVar("op1", VariableExpression::Use))));
       /* semantic: call('zero_flag') */
       AllExpr.push_back(Expr::MakeAssign(
-        Expr::MakeId(ST62_Flg_Z, &m_CpuInfo),
+        m_ExprTemplates[0x00],
         Expr::MakeTernaryCond(ConditionExpression::CondEq,
         Expr::MakeVar("res", VariableExpression::Use),
         Expr::MakeBitVector(rInsn.GetOperand(0)->GetBitSize(), 0x0),
-        Expr::MakeBitVector(1, 0x1), Expr::MakeBitVector(1, 0x0))));
+        m_ExprTemplates[0x0e], m_ExprTemplates[0x01])));
       /* semantic: op0.val = res.val */
       AllExpr.push_back(Expr::MakeAssign(
         rInsn.GetOperand(0),
@@ -2441,14 +2421,14 @@ bool St62Architecture::Table_d_0a(BinaryStream const& rBinStrm, OffsetType Offse
       AllExpr.push_back(Expr::MakeVar("res", VariableExpression::Alloc, rInsn.GetOperand(0)->GetBitSize()));
       /* semantic: cf.id = bit_cast(op0.val >> (int(op0.bit, op0.bit) - int(op0.bit, 1)), int1(1)) */
       AllExpr.push_back(Expr::MakeAssign(
-        Expr::MakeId(ST62_Flg_C, &m_CpuInfo),
+        m_ExprTemplates[0x0d],
         Expr::MakeBinOp(OperationExpression::OpBcast, Expr::MakeBinOp(
           OperationExpression::OpLrs,
           rInsn.GetOperand(0),
           Expr::MakeBinOp(
             OperationExpression::OpSub,
             Expr::MakeBitVector(rInsn.GetOperand(0)->GetBitSize(), rInsn.GetOperand(0)->GetBitSize()),
-            Expr::MakeBitVector(rInsn.GetOperand(0)->GetBitSize(), 0x1))), Expr::MakeBitVector(1, 0x1))));
+            Expr::MakeBitVector(rInsn.GetOperand(0)->GetBitSize(), 0x1))), m_ExprTemplates[0x0e])));
       /* semantic: res.val = op0.val << int(op0.bit, 1) + bit_cast(cf.id, int(op0.bit, op0.bit)) */
       AllExpr.push_back(Expr::MakeAssign(
         Expr::MakeVar("res", VariableExpression::Use),
@@ -2458,7 +2438,7 @@ bool St62Architecture::Table_d_0a(BinaryStream const& rBinStrm, OffsetType Offse
           Expr::MakeBinOp(
             OperationExpression::OpAdd,
             Expr::MakeBitVector(rInsn.GetOperand(0)->GetBitSize(), 0x1),
-            Expr::MakeBinOp(OperationExpression::OpBcast, Expr::MakeId(ST62_Flg_C, &m_CpuInfo), Expr::MakeBitVector(rInsn.GetOperand(0)->GetBitSize(), rInsn.GetOperand(0)->GetBitSize()))))));
+            Expr::MakeBinOp(OperationExpression::OpBcast, m_ExprTemplates[0x0d], Expr::MakeBitVector(rInsn.GetOperand(0)->GetBitSize(), rInsn.GetOperand(0)->GetBitSize()))))));
       /* semantic: op0.val = res.val */
       AllExpr.push_back(Expr::MakeAssign(
         rInsn.GetOperand(0),
@@ -2505,11 +2485,11 @@ bool St62Architecture::Table_d_0b(BinaryStream const& rBinStrm, OffsetType Offse
         rInsn.GetOperand(1)));
       /* semantic: call('zero_flag') */
       AllExpr.push_back(Expr::MakeAssign(
-        Expr::MakeId(ST62_Flg_Z, &m_CpuInfo),
+        m_ExprTemplates[0x00],
         Expr::MakeTernaryCond(ConditionExpression::CondEq,
         Expr::MakeVar("res", VariableExpression::Use),
         Expr::MakeBitVector(rInsn.GetOperand(0)->GetBitSize(), 0x0),
-        Expr::MakeBitVector(1, 0x1), Expr::MakeBitVector(1, 0x0))));
+        m_ExprTemplates[0x0e], m_ExprTemplates[0x01])));
       /* semantic: op0.val = res.val */
       AllExpr.push_back(Expr::MakeAssign(
         rInsn.GetOperand(0),
@@ -2543,27 +2523,17 @@ bool St62Architecture::Table_d_0c(BinaryStream const& rBinStrm, OffsetType Offse
       /* semantic: program.id = stk0.id */
       AllExpr.push_back(Expr::MakeAssign(
         Expr::MakeId(m_CpuInfo.GetRegisterByType(CpuInformation::ProgramPointerRegister, rInsn.GetMode()), &m_CpuInfo),
-        Expr::MakeId(ST62_Reg_Stk0, &m_CpuInfo)));
+        m_ExprTemplates[0x07]));
       /* semantic: stk0.id = stk1.id */
-      AllExpr.push_back(Expr::MakeAssign(
-        Expr::MakeId(ST62_Reg_Stk0, &m_CpuInfo),
-        Expr::MakeId(ST62_Reg_Stk1, &m_CpuInfo)));
+      AllExpr.push_back(m_ExprTemplates[0x10]);
       /* semantic: stk1.id = stk2.id */
-      AllExpr.push_back(Expr::MakeAssign(
-        Expr::MakeId(ST62_Reg_Stk1, &m_CpuInfo),
-        Expr::MakeId(ST62_Reg_Stk2, &m_CpuInfo)));
+      AllExpr.push_back(m_ExprTemplates[0x11]);
       /* semantic: stk2.id = stk3.id */
-      AllExpr.push_back(Expr::MakeAssign(
-        Expr::MakeId(ST62_Reg_Stk2, &m_CpuInfo),
-        Expr::MakeId(ST62_Reg_Stk3, &m_CpuInfo)));
+      AllExpr.push_back(m_ExprTemplates[0x12]);
       /* semantic: stk3.id = stk4.id */
-      AllExpr.push_back(Expr::MakeAssign(
-        Expr::MakeId(ST62_Reg_Stk3, &m_CpuInfo),
-        Expr::MakeId(ST62_Reg_Stk4, &m_CpuInfo)));
+      AllExpr.push_back(m_ExprTemplates[0x13]);
       /* semantic: stk4.id = stk5.id */
-      AllExpr.push_back(Expr::MakeAssign(
-        Expr::MakeId(ST62_Reg_Stk4, &m_CpuInfo),
-        Expr::MakeId(ST62_Reg_Stk5, &m_CpuInfo)));
+      AllExpr.push_back(m_ExprTemplates[0x14]);
       rInsn.SetSemantic(AllExpr);
     }
     return true;
@@ -2612,11 +2582,11 @@ bool St62Architecture::Table_d_0d(BinaryStream const& rBinStrm, OffsetType Offse
           Expr::MakeVar("op1", VariableExpression::Use))));
       /* semantic: call('zero_flag') */
       AllExpr.push_back(Expr::MakeAssign(
-        Expr::MakeId(ST62_Flg_Z, &m_CpuInfo),
+        m_ExprTemplates[0x00],
         Expr::MakeTernaryCond(ConditionExpression::CondEq,
         Expr::MakeVar("res", VariableExpression::Use),
         Expr::MakeBitVector(rInsn.GetOperand(0)->GetBitSize(), 0x0),
-        Expr::MakeBitVector(1, 0x1), Expr::MakeBitVector(1, 0x0))));
+        m_ExprTemplates[0x0e], m_ExprTemplates[0x01])));
       /* semantic: op0.val = res.val */
       AllExpr.push_back(Expr::MakeAssign(
         rInsn.GetOperand(0),
@@ -2676,11 +2646,11 @@ bool St62Architecture::Table_d_0f(BinaryStream const& rBinStrm, OffsetType Offse
         rInsn.GetOperand(1)));
       /* semantic: call('zero_flag') */
       AllExpr.push_back(Expr::MakeAssign(
-        Expr::MakeId(ST62_Flg_Z, &m_CpuInfo),
+        m_ExprTemplates[0x00],
         Expr::MakeTernaryCond(ConditionExpression::CondEq,
         Expr::MakeVar("res", VariableExpression::Use),
         Expr::MakeBitVector(rInsn.GetOperand(0)->GetBitSize(), 0x0),
-        Expr::MakeBitVector(1, 0x1), Expr::MakeBitVector(1, 0x0))));
+        m_ExprTemplates[0x0e], m_ExprTemplates[0x01])));
       /* semantic: op0.val = res.val */
       AllExpr.push_back(Expr::MakeAssign(
         rInsn.GetOperand(0),
@@ -2727,11 +2697,11 @@ bool St62Architecture::Table_f_00(BinaryStream const& rBinStrm, OffsetType Offse
         rInsn.GetOperand(1)));
       /* semantic: call('zero_flag') */
       AllExpr.push_back(Expr::MakeAssign(
-        Expr::MakeId(ST62_Flg_Z, &m_CpuInfo),
+        m_ExprTemplates[0x00],
         Expr::MakeTernaryCond(ConditionExpression::CondEq,
         Expr::MakeVar("res", VariableExpression::Use),
         Expr::MakeBitVector(rInsn.GetOperand(0)->GetBitSize(), 0x0),
-        Expr::MakeBitVector(1, 0x1), Expr::MakeBitVector(1, 0x0))));
+        m_ExprTemplates[0x0e], m_ExprTemplates[0x01])));
       /* semantic: op0.val = res.val */
       AllExpr.push_back(Expr::MakeAssign(
         rInsn.GetOperand(0),
@@ -2778,11 +2748,11 @@ bool St62Architecture::Table_f_01(BinaryStream const& rBinStrm, OffsetType Offse
         rInsn.GetOperand(1)));
       /* semantic: call('zero_flag') */
       AllExpr.push_back(Expr::MakeAssign(
-        Expr::MakeId(ST62_Flg_Z, &m_CpuInfo),
+        m_ExprTemplates[0x00],
         Expr::MakeTernaryCond(ConditionExpression::CondEq,
         Expr::MakeVar("res", VariableExpression::Use),
         Expr::MakeBitVector(rInsn.GetOperand(0)->GetBitSize(), 0x0),
-        Expr::MakeBitVector(1, 0x1), Expr::MakeBitVector(1, 0x0))));
+        m_ExprTemplates[0x0e], m_ExprTemplates[0x01])));
       /* semantic: op0.val = res.val */
       AllExpr.push_back(Expr::MakeAssign(
         rInsn.GetOperand(0),
@@ -2832,11 +2802,11 @@ bool St62Architecture::Table_f_02(BinaryStream const& rBinStrm, OffsetType Offse
       /* semantic: cf.id = ite(op0.val < op1.val, int1(1), int1(0))
       free_var('res') */
       AllExpr.push_back(Expr::MakeAssign(
-        Expr::MakeId(ST62_Flg_C, &m_CpuInfo),
+        m_ExprTemplates[0x0d],
         Expr::MakeTernaryCond(ConditionExpression::CondUlt,
         rInsn.GetOperand(0),
         rInsn.GetOperand(1),
-        Expr::MakeBitVector(1, 0x1), Expr::MakeBitVector(1, 0x0))));
+        m_ExprTemplates[0x0e], m_ExprTemplates[0x01])));
       AllExpr.push_back(Expr::MakeVar("res", VariableExpression::Free));
       rInsn.SetSemantic(AllExpr);
     }
@@ -2881,11 +2851,11 @@ bool St62Architecture::Table_f_03(BinaryStream const& rBinStrm, OffsetType Offse
       /* semantic: cf.id = ite(op0.val < op1.val, int1(1), int1(0))
       free_var('res') */
       AllExpr.push_back(Expr::MakeAssign(
-        Expr::MakeId(ST62_Flg_C, &m_CpuInfo),
+        m_ExprTemplates[0x0d],
         Expr::MakeTernaryCond(ConditionExpression::CondUlt,
         rInsn.GetOperand(0),
         rInsn.GetOperand(1),
-        Expr::MakeBitVector(1, 0x1), Expr::MakeBitVector(1, 0x0))));
+        m_ExprTemplates[0x0e], m_ExprTemplates[0x01])));
       AllExpr.push_back(Expr::MakeVar("res", VariableExpression::Free));
       rInsn.SetSemantic(AllExpr);
     }
@@ -2931,14 +2901,14 @@ bool St62Architecture::Table_f_04(BinaryStream const& rBinStrm, OffsetType Offse
           rInsn.GetOperand(1))));
       /* semantic: call('zero_flag') */
       AllExpr.push_back(Expr::MakeAssign(
-        Expr::MakeId(ST62_Flg_Z, &m_CpuInfo),
+        m_ExprTemplates[0x00],
         Expr::MakeTernaryCond(ConditionExpression::CondEq,
         Expr::MakeVar("res", VariableExpression::Use),
         Expr::MakeBitVector(rInsn.GetOperand(0)->GetBitSize(), 0x0),
-        Expr::MakeBitVector(1, 0x1), Expr::MakeBitVector(1, 0x0))));
+        m_ExprTemplates[0x0e], m_ExprTemplates[0x01])));
       /* semantic: call('carry_flag_add') */
       AllExpr.push_back(Expr::MakeAssign(
-        Expr::MakeId(ST62_Flg_C, &m_CpuInfo),
+        m_ExprTemplates[0x0d],
         Expr::MakeBinOp(OperationExpression::OpBcast, Expr::MakeBinOp(
           OperationExpression::OpLrs,
           Expr::MakeBinOp(
@@ -2963,7 +2933,7 @@ bool St62Architecture::Table_f_04(BinaryStream const& rBinStrm, OffsetType Offse
           Expr::MakeBinOp(
             OperationExpression::OpSub,
             Expr::MakeBitVector(rInsn.GetOperand(0)->GetBitSize(), rInsn.GetOperand(0)->GetBitSize()),
-            Expr::MakeBitVector(rInsn.GetOperand(0)->GetBitSize(), 0x1))), Expr::MakeBitVector(1, 0x1))));
+            Expr::MakeBitVector(rInsn.GetOperand(0)->GetBitSize(), 0x1))), m_ExprTemplates[0x0e])));
       /* semantic: op0.val = res */
       AllExpr.push_back(Expr::MakeAssign(
         rInsn.GetOperand(0),
@@ -3014,14 +2984,14 @@ bool St62Architecture::Table_f_05(BinaryStream const& rBinStrm, OffsetType Offse
           rInsn.GetOperand(1))));
       /* semantic: call('zero_flag') */
       AllExpr.push_back(Expr::MakeAssign(
-        Expr::MakeId(ST62_Flg_Z, &m_CpuInfo),
+        m_ExprTemplates[0x00],
         Expr::MakeTernaryCond(ConditionExpression::CondEq,
         Expr::MakeVar("res", VariableExpression::Use),
         Expr::MakeBitVector(rInsn.GetOperand(0)->GetBitSize(), 0x0),
-        Expr::MakeBitVector(1, 0x1), Expr::MakeBitVector(1, 0x0))));
+        m_ExprTemplates[0x0e], m_ExprTemplates[0x01])));
       /* semantic: call('carry_flag_add') */
       AllExpr.push_back(Expr::MakeAssign(
-        Expr::MakeId(ST62_Flg_C, &m_CpuInfo),
+        m_ExprTemplates[0x0d],
         Expr::MakeBinOp(OperationExpression::OpBcast, Expr::MakeBinOp(
           OperationExpression::OpLrs,
           Expr::MakeBinOp(
@@ -3046,7 +3016,7 @@ bool St62Architecture::Table_f_05(BinaryStream const& rBinStrm, OffsetType Offse
           Expr::MakeBinOp(
             OperationExpression::OpSub,
             Expr::MakeBitVector(rInsn.GetOperand(0)->GetBitSize(), rInsn.GetOperand(0)->GetBitSize()),
-            Expr::MakeBitVector(rInsn.GetOperand(0)->GetBitSize(), 0x1))), Expr::MakeBitVector(1, 0x1))));
+            Expr::MakeBitVector(rInsn.GetOperand(0)->GetBitSize(), 0x1))), m_ExprTemplates[0x0e])));
       /* semantic: op0.val = res */
       AllExpr.push_back(Expr::MakeAssign(
         rInsn.GetOperand(0),
@@ -3101,11 +3071,11 @@ bool St62Architecture::Table_f_06(BinaryStream const& rBinStrm, OffsetType Offse
           Expr::MakeVar("op1", VariableExpression::Use))));
       /* semantic: call('zero_flag') */
       AllExpr.push_back(Expr::MakeAssign(
-        Expr::MakeId(ST62_Flg_Z, &m_CpuInfo),
+        m_ExprTemplates[0x00],
         Expr::MakeTernaryCond(ConditionExpression::CondEq,
         Expr::MakeVar("res", VariableExpression::Use),
         Expr::MakeBitVector(rInsn.GetOperand(0)->GetBitSize(), 0x0),
-        Expr::MakeBitVector(1, 0x1), Expr::MakeBitVector(1, 0x0))));
+        m_ExprTemplates[0x0e], m_ExprTemplates[0x01])));
       /* semantic: op0.val = res.val */
       AllExpr.push_back(Expr::MakeAssign(
         rInsn.GetOperand(0),
@@ -3162,11 +3132,11 @@ bool St62Architecture::Table_f_07(BinaryStream const& rBinStrm, OffsetType Offse
           Expr::MakeVar("op1", VariableExpression::Use))));
       /* semantic: call('zero_flag') */
       AllExpr.push_back(Expr::MakeAssign(
-        Expr::MakeId(ST62_Flg_Z, &m_CpuInfo),
+        m_ExprTemplates[0x00],
         Expr::MakeTernaryCond(ConditionExpression::CondEq,
         Expr::MakeVar("res", VariableExpression::Use),
         Expr::MakeBitVector(rInsn.GetOperand(0)->GetBitSize(), 0x0),
-        Expr::MakeBitVector(1, 0x1), Expr::MakeBitVector(1, 0x0))));
+        m_ExprTemplates[0x0e], m_ExprTemplates[0x01])));
       /* semantic: op0.val = res.val */
       AllExpr.push_back(Expr::MakeAssign(
         rInsn.GetOperand(0),
@@ -3215,11 +3185,11 @@ bool St62Architecture::Table_f_08(BinaryStream const& rBinStrm, OffsetType Offse
         rInsn.GetOperand(1)));
       /* semantic: call('zero_flag') */
       AllExpr.push_back(Expr::MakeAssign(
-        Expr::MakeId(ST62_Flg_Z, &m_CpuInfo),
+        m_ExprTemplates[0x00],
         Expr::MakeTernaryCond(ConditionExpression::CondEq,
         Expr::MakeVar("res", VariableExpression::Use),
         Expr::MakeBitVector(rInsn.GetOperand(0)->GetBitSize(), 0x0),
-        Expr::MakeBitVector(1, 0x1), Expr::MakeBitVector(1, 0x0))));
+        m_ExprTemplates[0x0e], m_ExprTemplates[0x01])));
       /* semantic: op0.val = res.val */
       AllExpr.push_back(Expr::MakeAssign(
         rInsn.GetOperand(0),
@@ -3266,11 +3236,11 @@ bool St62Architecture::Table_f_09(BinaryStream const& rBinStrm, OffsetType Offse
         rInsn.GetOperand(1)));
       /* semantic: call('zero_flag') */
       AllExpr.push_back(Expr::MakeAssign(
-        Expr::MakeId(ST62_Flg_Z, &m_CpuInfo),
+        m_ExprTemplates[0x00],
         Expr::MakeTernaryCond(ConditionExpression::CondEq,
         Expr::MakeVar("res", VariableExpression::Use),
         Expr::MakeBitVector(rInsn.GetOperand(0)->GetBitSize(), 0x0),
-        Expr::MakeBitVector(1, 0x1), Expr::MakeBitVector(1, 0x0))));
+        m_ExprTemplates[0x0e], m_ExprTemplates[0x01])));
       /* semantic: op0.val = res.val */
       AllExpr.push_back(Expr::MakeAssign(
         rInsn.GetOperand(0),
@@ -3321,11 +3291,11 @@ bool St62Architecture::Table_f_0a(BinaryStream const& rBinStrm, OffsetType Offse
       /* semantic: call('zero_flag')
       op0.val = res */
       AllExpr.push_back(Expr::MakeAssign(
-        Expr::MakeId(ST62_Flg_Z, &m_CpuInfo),
+        m_ExprTemplates[0x00],
         Expr::MakeTernaryCond(ConditionExpression::CondEq,
         Expr::MakeVar("res", VariableExpression::Use),
         Expr::MakeBitVector(rInsn.GetOperand(0)->GetBitSize(), 0x0),
-        Expr::MakeBitVector(1, 0x1), Expr::MakeBitVector(1, 0x0))));
+        m_ExprTemplates[0x0e], m_ExprTemplates[0x01])));
       AllExpr.push_back(Expr::MakeAssign(
         rInsn.GetOperand(0),
         Expr::MakeVar("res", VariableExpression::Use)));
@@ -3375,11 +3345,11 @@ bool St62Architecture::Table_f_0b(BinaryStream const& rBinStrm, OffsetType Offse
       /* semantic: call('zero_flag')
       op0.val = res */
       AllExpr.push_back(Expr::MakeAssign(
-        Expr::MakeId(ST62_Flg_Z, &m_CpuInfo),
+        m_ExprTemplates[0x00],
         Expr::MakeTernaryCond(ConditionExpression::CondEq,
         Expr::MakeVar("res", VariableExpression::Use),
         Expr::MakeBitVector(rInsn.GetOperand(0)->GetBitSize(), 0x0),
-        Expr::MakeBitVector(1, 0x1), Expr::MakeBitVector(1, 0x0))));
+        m_ExprTemplates[0x0e], m_ExprTemplates[0x01])));
       AllExpr.push_back(Expr::MakeAssign(
         rInsn.GetOperand(0),
         Expr::MakeVar("res", VariableExpression::Use)));
@@ -3429,19 +3399,19 @@ bool St62Architecture::Table_f_0c(BinaryStream const& rBinStrm, OffsetType Offse
           rInsn.GetOperand(1))));
       /* semantic: call('zero_flag') */
       AllExpr.push_back(Expr::MakeAssign(
-        Expr::MakeId(ST62_Flg_Z, &m_CpuInfo),
+        m_ExprTemplates[0x00],
         Expr::MakeTernaryCond(ConditionExpression::CondEq,
         Expr::MakeVar("res", VariableExpression::Use),
         Expr::MakeBitVector(rInsn.GetOperand(0)->GetBitSize(), 0x0),
-        Expr::MakeBitVector(1, 0x1), Expr::MakeBitVector(1, 0x0))));
+        m_ExprTemplates[0x0e], m_ExprTemplates[0x01])));
       /* semantic: cf.id = ite(op0.val < op1.val, int1(1), int1(0))
       op0.val = res */
       AllExpr.push_back(Expr::MakeAssign(
-        Expr::MakeId(ST62_Flg_C, &m_CpuInfo),
+        m_ExprTemplates[0x0d],
         Expr::MakeTernaryCond(ConditionExpression::CondUlt,
         rInsn.GetOperand(0),
         rInsn.GetOperand(1),
-        Expr::MakeBitVector(1, 0x1), Expr::MakeBitVector(1, 0x0))));
+        m_ExprTemplates[0x0e], m_ExprTemplates[0x01])));
       AllExpr.push_back(Expr::MakeAssign(
         rInsn.GetOperand(0),
         Expr::MakeVar("res", VariableExpression::Use)));
@@ -3491,19 +3461,19 @@ bool St62Architecture::Table_f_0d(BinaryStream const& rBinStrm, OffsetType Offse
           rInsn.GetOperand(1))));
       /* semantic: call('zero_flag') */
       AllExpr.push_back(Expr::MakeAssign(
-        Expr::MakeId(ST62_Flg_Z, &m_CpuInfo),
+        m_ExprTemplates[0x00],
         Expr::MakeTernaryCond(ConditionExpression::CondEq,
         Expr::MakeVar("res", VariableExpression::Use),
         Expr::MakeBitVector(rInsn.GetOperand(0)->GetBitSize(), 0x0),
-        Expr::MakeBitVector(1, 0x1), Expr::MakeBitVector(1, 0x0))));
+        m_ExprTemplates[0x0e], m_ExprTemplates[0x01])));
       /* semantic: cf.id = ite(op0.val < op1.val, int1(1), int1(0))
       op0.val = res */
       AllExpr.push_back(Expr::MakeAssign(
-        Expr::MakeId(ST62_Flg_C, &m_CpuInfo),
+        m_ExprTemplates[0x0d],
         Expr::MakeTernaryCond(ConditionExpression::CondUlt,
         rInsn.GetOperand(0),
         rInsn.GetOperand(1),
-        Expr::MakeBitVector(1, 0x1), Expr::MakeBitVector(1, 0x0))));
+        m_ExprTemplates[0x0e], m_ExprTemplates[0x01])));
       AllExpr.push_back(Expr::MakeAssign(
         rInsn.GetOperand(0),
         Expr::MakeVar("res", VariableExpression::Use)));
@@ -3557,11 +3527,11 @@ bool St62Architecture::Table_f_0e(BinaryStream const& rBinStrm, OffsetType Offse
           Expr::MakeVar("op1", VariableExpression::Use))));
       /* semantic: call('zero_flag') */
       AllExpr.push_back(Expr::MakeAssign(
-        Expr::MakeId(ST62_Flg_Z, &m_CpuInfo),
+        m_ExprTemplates[0x00],
         Expr::MakeTernaryCond(ConditionExpression::CondEq,
         Expr::MakeVar("res", VariableExpression::Use),
         Expr::MakeBitVector(rInsn.GetOperand(0)->GetBitSize(), 0x0),
-        Expr::MakeBitVector(1, 0x1), Expr::MakeBitVector(1, 0x0))));
+        m_ExprTemplates[0x0e], m_ExprTemplates[0x01])));
       /* semantic: op0.val = res.val */
       AllExpr.push_back(Expr::MakeAssign(
         rInsn.GetOperand(0),
@@ -3618,11 +3588,11 @@ bool St62Architecture::Table_f_0f(BinaryStream const& rBinStrm, OffsetType Offse
           Expr::MakeVar("op1", VariableExpression::Use))));
       /* semantic: call('zero_flag') */
       AllExpr.push_back(Expr::MakeAssign(
-        Expr::MakeId(ST62_Flg_Z, &m_CpuInfo),
+        m_ExprTemplates[0x00],
         Expr::MakeTernaryCond(ConditionExpression::CondEq,
         Expr::MakeVar("res", VariableExpression::Use),
         Expr::MakeBitVector(rInsn.GetOperand(0)->GetBitSize(), 0x0),
-        Expr::MakeBitVector(1, 0x1), Expr::MakeBitVector(1, 0x0))));
+        m_ExprTemplates[0x0e], m_ExprTemplates[0x01])));
       /* semantic: op0.val = res.val */
       AllExpr.push_back(Expr::MakeAssign(
         rInsn.GetOperand(0),
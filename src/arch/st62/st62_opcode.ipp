@@ -124,6 +124,9 @@ private:
   bool Table_f_0e(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode);
   bool Table_f_0f(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode);
 
+  Expression::SPType m_ExprTemplates[0x1d];
+  void _InitializeExpressionTemplates(void);
+
   bool Operand__A(BinaryStream const& rBinStrm, OffsetType& Offset, Instruction& rInsn, u8 Mode);
   Expression::SPType Decode_imm(BinaryStream const& rBinStrm, OffsetType& Offset, Instruction& rInsn, u8 Mode);
   bool Operand__ee(BinaryStream const& rBinStrm, OffsetType& Offset, Instruction& rInsn, u8 Mode);
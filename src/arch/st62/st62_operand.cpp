@@ -76,35 +76,35 @@ bool St62Architecture::Operand__bitdirect(BinaryStream const& rBinStrm, OffsetTy
 Expression::SPType St62Architecture::Decode_A(BinaryStream const& rBinStrm, OffsetType& Offset, Instruction& rInsn, u8 Mode)
 {
   // operand0: reg('A')
-  return Expr::MakeId(ST62_Reg_A, &m_CpuInfo);
+  return m_ExprTemplates[0x15];
 }
 
 /* decoder ["reg('V')"] */
 Expression::SPType St62Architecture::Decode_V(BinaryStream const& rBinStrm, OffsetType& Offset, Instruction& rInsn, u8 Mode)
 {
   // operand0: reg('V')
-  return Expr::MakeId(ST62_Reg_V, &m_CpuInfo);
+  return m_ExprTemplates[0x16];
 }
 
 /* decoder ["reg('W')"] */
 Expression::SPType St62Architecture::Decode_W(BinaryStream const& rBinStrm, OffsetType& Offset, Instruction& rInsn, u8 Mode)
 {
   // operand0: reg('W')
-  return Expr::MakeId(ST62_Reg_W, &m_CpuInfo);
+  return m_ExprTemplates[0x17];
 }
 
 /* decoder ["reg('X')"] */
 Expression::SPType St62Architecture::Decode_X(BinaryStream const& rBinStrm, OffsetType& Offset, Instruction& rInsn, u8 Mode)
 {
   // operand0: reg('X')
-  return Expr::MakeId(ST62_Reg_X, &m_CpuInfo);
+  return m_ExprTemplates[0x18];
 }
 
 /* decoder ["reg('Y')"] */
 Expression::SPType St62Architecture::Decode_Y(BinaryStream const& rBinStrm, OffsetType& Offset, Instruction& rInsn, u8 Mode)
 {
   // operand0: reg('Y')
-  return Expr::MakeId(ST62_Reg_Y, &m_CpuInfo);
+  return m_ExprTemplates[0x19];
 }
 
 /* decoder ["call('Decode_bitdirect')"] */
@@ -153,14 +153,14 @@ Expression::SPType St62Architecture::Decode_pcr(BinaryStream const& rBinStrm, Of
 Expression::SPType St62Architecture::Decode_rX(BinaryStream const& rBinStrm, OffsetType& Offset, Instruction& rInsn, u8 Mode)
 {
   // operand0: ireg('X')
-  return Expr::MakeMem(8, Expr::MakeBitVector(16, 0x1000), Expr::MakeId(ST62_Reg_X, &m_CpuInfo), true);
+  return m_ExprTemplates[0x1b];
 }
 
 /* decoder ["ireg('Y')"] */
 Expression::SPType St62Architecture::Decode_rY(BinaryStream const& rBinStrm, OffsetType& Offset, Instruction& rInsn, u8 Mode)
 {
   // operand0: ireg('Y')
-  return Expr::MakeMem(8, Expr::MakeBitVector(16, 0x1000), Expr::MakeId(ST62_Reg_Y, &m_CpuInfo), true);
+  return m_ExprTemplates[0x1c];
 }
 
 /* operand ['op0 = decode_direct'] */
@@ -247,3 +247,35 @@ bool St62Architecture::Operand__rY(BinaryStream const& rBinStrm, OffsetType& Off
   return true;
 }
 
+void St62Architecture::_InitializeExpressionTemplates(void)
+{
+  m_ExprTemplates[0x00] = Expr::MakeId(ST62_Flg_Z, &m_CpuInfo);
+  m_ExprTemplates[0x01] = Expr::MakeBitVector(1, 0x0);
+  m_ExprTemplates[0x02] = Expr::MakeId(ST62_Reg_Stk5, &m_CpuInfo);
+  m_ExprTemplates[0x03] = Expr::MakeId(ST62_Reg_Stk4, &m_CpuInfo);
+  m_ExprTemplates[0x04] = Expr::MakeId(ST62_Reg_Stk3, &m_CpuInfo);
+  m_ExprTemplates[0x05] = Expr::MakeId(ST62_Reg_Stk2, &m_CpuInfo);
+  m_ExprTemplates[0x06] = Expr::MakeId(ST62_Reg_Stk1, &m_CpuInfo);
+  m_ExprTemplates[0x07] = Expr::MakeId(ST62_Reg_Stk0, &m_CpuInfo);
+  m_ExprTemplates[0x08] = Expr::MakeAssign(m_ExprTemplates[0x02], m_ExprTemplates[0x03]);
+  m_ExprTemplates[0x09] = Expr::MakeAssign(m_ExprTemplates[0x03], m_ExprTemplates[0x04]);
+  m_ExprTemplates[0x0a] = Expr::MakeAssign(m_ExprTemplates[0x04], m_ExprTemplates[0x05]);
+  m_ExprTemplates[0x0b] = Expr::MakeAssign(m_ExprTemplates[0x05], m_ExprTemplates[0x06]);
+  m_ExprTemplates[0x0c] = Expr::MakeAssign(m_ExprTemplates[0x06], m_ExprTemplates[0x07]);
+  m_ExprTemplates[0x0d] = Expr::MakeId(ST62_Flg_C, &m_CpuInfo);
+  m_ExprTemplates[0x0e] = Expr::MakeBitVector(1, 0x1);
+  m_ExprTemplates[0x0f] = Expr::MakeBitVector(8, 0x1);
+  m_ExprTemplates[0x10] = Expr::MakeAssign(m_ExprTemplates[0x07], m_ExprTemplates[0x06]);
+  m_ExprTemplates[0x11] = Expr::MakeAssign(m_ExprTemplates[0x06], m_ExprTemplates[0x05]);
+  m_ExprTemplates[0x12] = Expr::MakeAssign(m_ExprTemplates[0x05], m_ExprTemplates[0x04]);
+  m_ExprTemplates[0x13] = Expr::MakeAssign(m_ExprTemplates[0x04], m_ExprTemplates[0x03]);
+  m_ExprTemplates[0x14] = Expr::MakeAssign(m_ExprTemplates[0x03], m_ExprTemplates[0x02]);
+  m_ExprTemplates[0x15] = Expr::MakeId(ST62_Reg_A, &m_CpuInfo);
+  m_ExprTemplates[0x16] = Expr::MakeId(ST62_Reg_V, &m_CpuInfo);
+  m_ExprTemplates[0x17] = Expr::MakeId(ST62_Reg_W, &m_CpuInfo);
+  m_ExprTemplates[0x18] = Expr::MakeId(ST62_Reg_X, &m_CpuInfo);
+  m_ExprTemplates[0x19] = Expr::MakeId(ST62_Reg_Y, &m_CpuInfo);
+  m_ExprTemplates[0x1a] = Expr::MakeBitVector(16, 0x1000);
+  m_ExprTemplates[0x1b] = Expr::MakeMem(8, m_ExprTemplates[0x1a], m_ExprTemplates[0x18], true);
+  m_ExprTemplates[0x1c] = Expr::MakeMem(8, m_ExprTemplates[0x1a], m_ExprTemplates[0x19], true);
+}
@@ -10,7 +10,7 @@ namespace x86
   class ModRM
   {
   public:
-    ModRM(u8 ModRm) : m_ModRm(ModRm) {                          };
+    ModRM(u8 ModRm = 0) : m_ModRm(ModRm) {                          };
     u8 Mod(void) const               { return m_ModRm >> 6;     };
     u8 Reg(void) const               { return m_ModRm >> 3 & 7; };
     u8 Rm(void)  const               { return m_ModRm & 7;      };
@@ -22,7 +22,7 @@ namespace x86
   class Sib
   {
   public:
-    Sib(u8 Sib) : m_Sib(Sib) {                        };
+    Sib(u8 Sib = 0) : m_Sib(Sib) {                        };
     u8 Scale(void) const     { return m_Sib >> 6;     };
     u8 Index(void) const     { return m_Sib >> 3 & 7; };
     u8 Base(void)  const     { return m_Sib & 7;      };
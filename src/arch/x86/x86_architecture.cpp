@@ -439,10 +439,194 @@ bool X86Architecture::Disassemble(BinaryStream const& rBinStrm, OffsetType Offse
   rInsn.SetArchitectureTag(GetTag());
   rInsn.SetMode(Mode);
 
+  // The mode is resolved once here, every decoding function below is specialized on it
+  bool Res;
+  switch (Mode)
+  {
+  case X86_Bit_16: Res = _Disassemble<X86_Bit_16>(rBinStrm, Offset, rInsn); break;
+  case X86_Bit_32: Res = _Disassemble<X86_Bit_32>(rBinStrm, Offset, rInsn); break;
+  case X86_Bit_64: Res = _Disassemble<X86_Bit_64>(rBinStrm, Offset, rInsn); break;
+  default:         return false;
+  }
+  rInsn.SetName(m_Mnemonic[rInsn.GetOpcode()]);
+  return Res;
+}
+
+template<u8 Mode>
+bool X86Architecture::_Disassemble(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
+{
   u8 Opcode;
   if (!rBinStrm.Read(Offset, Opcode))
     return false;
-  bool Res = (this->*m_Table_1[Opcode])(rBinStrm, Offset + 1, rInsn, Mode);
-  rInsn.SetName(m_Mnemonic[rInsn.GetOpcode()]);
-  return Res;
+  return _Decode<Mode>(m_Table_1[Opcode], rBinStrm, Offset + 1, rInsn);
 }
+
+bool X86Architecture::DisassembleBlock(BinaryStream const& rBinStrm, OffsetType Offset, u8 Mode, u32 MaxInsns, bool StopOnBranch, InstructionBuffer& rInsnBuf)
+{
+  return _DisassembleBlock(rBinStrm, Offset, Mode, MaxInsns, StopOnBranch, rInsnBuf,
+    [this](BinaryStream const& rInsnStrm, OffsetType InsnOff, Instruction& rInsn, u8 InsnMode)
+  { return X86Architecture::Disassemble(rInsnStrm, InsnOff, rInsn, InsnMode); });
+}
+
+// NOTE: DecodeLength walks the same opcode tables than Disassemble but only tracks the prefixes which
+// change the size of the immediate or of the displacement. Entries whose size depends on the cpu model,
+// the vendor or a mandatory prefix are flagged LengthSlow and handled by the full decoder.
+bool X86Architecture::DecodeLength(BinaryStream const& rBinStrm, OffsetType Offset, u8 Mode, InsnClass& rInsnCls)
+{
+  LengthEntry const* pTable = m_Length_Table_1;
+  bool OpSize = false, AdSize = false, RexW = false;
+  u16 Length = 0;
+  u8 Opcode;
+
+  for (;;)
+  {
+    if (!rBinStrm.Read(Offset + Length, Opcode))
+      return false;
+    ++Length;
+
+    LengthEntry const& rEntry = pTable[Opcode];
+    if (rEntry.m_Flags & LengthSlow)
+      return Architecture::DecodeLength(rBinStrm, Offset, Mode, rInsnCls);
+    if (rEntry.m_Flags & LengthInvalid)
+      return false;
+    if ((rEntry.m_Flags & LengthPrefix) || ((rEntry.m_Flags & LengthPrefix64) && Mode == X86_Bit_64))
+    {
+      switch (rEntry.m_Index)
+      {
+      case LengthPrefixOpSize: OpSize = true; break;
+      case LengthPrefixAdSize: AdSize = true; break;
+      case LengthPrefixRexW:   RexW   = true; break;
+      default:                                break;
+      }
+      continue;
+    }
+    if (rEntry.m_Flags & LengthEscape)
+    {
+      pTable = m_LengthTable[rEntry.m_Index];
+      continue;
+    }
+    if ((rEntry.m_Flags & LengthNo64) && Mode == X86_Bit_64)
+      return false;
+
+    u8 Immediate = rEntry.m_Immediate;
+    rInsnCls.m_SubType = rEntry.m_SubType;
+
+    u8 AddrSize;
+    switch (Mode)
+    {
+    case X86_Bit_16: AddrSize = AdSize ? 32 : 16; break;
+    case X86_Bit_32: AddrSize = AdSize ? 16 : 32; break;
+    case X86_Bit_64: AddrSize = AdSize ? 32 : 64; break;
+    default:         return false;
+    }
+
+    if (rEntry.m_Flags & LengthModRm)
+    {
+      u8 ModRm;
+      if (!rBinStrm.Read(Offset + Length, ModRm))
+        return false;
+
+      bool HasModRm = true;
+      if (rEntry.m_Flags & LengthGroup)
+      {
+        LengthEntry const& rGrpEntry = m_LengthGroup[rEntry.m_Index][(ModRm >> 3) & 7];
+        if (rGrpEntry.m_Flags & LengthSlow)
+          return Architecture::DecodeLength(rBinStrm, Offset, Mode, rInsnCls);
+        if (rGrpEntry.m_Flags & LengthInvalid)
+          return false;
+        if ((rGrpEntry.m_Flags & LengthNo64) && Mode == X86_Bit_64)
+          return false;
+        Immediate = rGrpEntry.m_Immediate;
+        rInsnCls.m_SubType = rGrpEntry.m_SubType;
+        HasModRm = (rGrpEntry.m_Flags & LengthModRm) != 0;
+      }
+
+      // Some group entries only use ModR/M.reg as an opcode extension
+      if (HasModRm)
+      {
+        ++Length;
+
+        u8 Mod = ModRm >> 6, Rm = ModRm & 7;
+        if (AddrSize == 16)
+        {
+          if (Mod == 1)
+            Length += 1;
+          else if (Mod == 2 || (Mod == 0 && Rm == 6))
+            Length += 2;
+        }
+        else if (Mod != 3)
+        {
+          if (Rm == 4)
+          {
+            u8 Sib;
+            if (!rBinStrm.Read(Offset + Length, Sib))
+              return false;
+            ++Length;
+            if (Mod == 0 && (Sib & 7) == 5)
+              Length += 4;
+          }
+          if (Mod == 1)
+            Length += 1;
+          else if (Mod == 2 || (Mod == 0 && Rm == 5))
+            Length += 4;
+        }
+      }
+    }
+
+    u8 OprdSize = 32;
+    if (Mode == X86_Bit_64 && RexW)
+      OprdSize = 64;
+    else if ((Mode == X86_Bit_16) != OpSize)
+      OprdSize = 16;
+
+    switch (Immediate)
+    {
+    case LengthImmB:      Length += 1;                          break;
+    case LengthImmBB:     Length += 2;                          break;
+    case LengthImmW:      Length += 2;                          break;
+    case LengthImmWB:     Length += 3;                          break;
+    case LengthImmZ:      Length += OprdSize == 16 ? 2 : 4;     break;
+    case LengthImmV:      Length += OprdSize / 8;               break;
+    case LengthImmMoffs:  Length += AddrSize / 8;               break;
+    case LengthImmFarPtr: Length += AddrSize == 16 ? 4 : 6;     break;
+    default:                                                    break;
+    }
+
+    // The last byte must be readable, like it would be for the full decoder
+    if (Offset + Length > rBinStrm.GetSize())
+      return false;
+
+    rInsnCls.m_Length = Length;
+    return true;
+  }
+}
+
+template<u8 Mode>
+bool X86Architecture::_Decode(DecodeEntry const& rEntry, BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
+{
+  if (rEntry.m_Flags != 0)
+  {
+    if (rEntry.m_Flags & DecodeHandler)
+      return (this->*DecodeTable<Mode>::m_Handler[rEntry.m_Handler])(rBinStrm, Offset, rInsn);
+    if (rEntry.m_Flags & DecodeInvalid)
+      return false;
+    if ((rEntry.m_Flags & DecodeD64) && !(rInsn.Prefix() & X86_Prefix_OpSize))
+      rInsn.Prefix() |= X86_Prefix_REX_w;
+  }
+
+  rInsn.Size()++;
+  rInsn.SetOpcode(rEntry.m_Opcode);
+  if (rEntry.m_SubType != Instruction::NoneType)
+    rInsn.SubType() |= rEntry.m_SubType;
+  if (rEntry.m_Operand != 0 && !(this->*DecodeTable<Mode>::m_OperandDecoder[rEntry.m_Operand])(rBinStrm, Offset, rInsn))
+    return false;
+  if (rEntry.m_Semantic != 0)
+    (this->*m_SemanticBuilder[rEntry.m_Semantic])(rInsn, Mode);
+  return true;
+}
+
+X86_INSTANTIATE_DISASSEMBLER(_Disassemble);
+
+template bool X86Architecture::_Decode<X86_Bit_16>(DecodeEntry const&, BinaryStream const&, OffsetType, Instruction&);
+template bool X86Architecture::_Decode<X86_Bit_32>(DecodeEntry const&, BinaryStream const&, OffsetType, Instruction&);
+template bool X86Architecture::_Decode<X86_Bit_64>(DecodeEntry const&, BinaryStream const&, OffsetType, Instruction&);
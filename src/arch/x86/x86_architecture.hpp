@@ -53,6 +53,7 @@ private:
     virtual void* GetRegisterAddress(u32 Register);
     virtual void* GetContextAddress(void) { return &m_Context; }
     virtual u16 GetRegisterOffset(u32 Register);
+    virtual RegisterDescriptor const* GetRegisterDescriptor(u32 Reg) const;
     virtual void GetRegisters(RegisterList& RegList) const;
     virtual bool Translate(Address const& rLogicalAddress, u64& rLinearAddress) const;
     virtual u8 GetMode(void) const;
@@ -80,6 +81,13 @@ private:
     } m_Context;
 
     u8 m_Bits;
+
+    struct RegisterDescriptorTable
+    {
+      RegisterDescriptor m_Regs[X86_Reg_Rip + 1];
+      RegisterDescriptor m_Flags[(X86_FlOf >> 16) + 1]; // indexed by the mask of the flag
+    };
+    static RegisterDescriptorTable const& _GetRegisterDescriptors(void);
   };
 
 public:
@@ -90,6 +98,8 @@ public:
   virtual bool                  Translate(Address const& rVirtAddr, OffsetType& rPhysOff) { return false; }
   virtual EEndianness           GetEndianness(void) { return LittleEndian; }
   virtual bool                  Disassemble(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode);
+  virtual bool                  DisassembleBlock(BinaryStream const& rBinStrm, OffsetType Offset, u8 Mode, u32 MaxInsns, bool StopOnBranch, InstructionBuffer& rInsnBuf);
+  virtual bool                  DecodeLength(BinaryStream const& rBinStrm, OffsetType Offset, u8 Mode, InsnClass& rInsnCls);
   virtual NamedModeVector       GetModes(void) const
   {
     NamedModeVector X86Modes;
@@ -126,109 +136,127 @@ private:
 #include "x86_operand.ipp"
 #include "x86_opcode.ipp"
 
-  Expression::SPType __Decode_Ap(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode);
-  Expression::SPType __Decode_By(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode);
-  Expression::SPType __Decode_Cy(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode);
-  Expression::SPType __Decode_Dy(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode);
-
-  Expression::SPType __Decode_Eb(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode);
-  Expression::SPType __Decode_Ed(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode);
-  Expression::SPType __Decode_Edb(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode);
-  Expression::SPType __Decode_Eq(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode);
-  Expression::SPType __Decode_Ev(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode);
-  Expression::SPType __Decode_Ew(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode);
-  Expression::SPType __Decode_Ey(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode);
-  Expression::SPType __Decode_Eyb(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode);
-  Expression::SPType __Decode_Eyw(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode);
-
-  Expression::SPType __Decode_Gb(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode);
-  Expression::SPType __Decode_Gw(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode);
-  Expression::SPType __Decode_Gd(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode);
-  Expression::SPType __Decode_Gq(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode);
-  Expression::SPType __Decode_Gv(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode);
-  Expression::SPType __Decode_Gy(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode);
-
-  Expression::SPType __Decode_Ho(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode);
-  Expression::SPType __Decode_Hx(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode);
-  Expression::SPType __Decode_Hy(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode);
-
-  Expression::SPType __Decode_Ibs(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode);
-
-  Expression::SPType __Decode_Jb(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode);
-  Expression::SPType __Decode_Jz(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode);
-
-  Expression::SPType __Decode_Lx(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode);
-
-  Expression::SPType __Decode_M(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode);
-  Expression::SPType __Decode_Ma(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode);
-  Expression::SPType __Decode_Md(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode);
-  Expression::SPType __Decode_Mo(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode);
-  Expression::SPType __Decode_Mod(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode);
-  Expression::SPType __Decode_Moq(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode);
-  Expression::SPType __Decode_Mp(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode);
-  Expression::SPType __Decode_Mq(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode);
-  Expression::SPType __Decode_Mqo(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode);
-  Expression::SPType __Decode_Mv(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode);
-  Expression::SPType __Decode_Mw(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode);
-  Expression::SPType __Decode_Mx(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode);
-  Expression::SPType __Decode_My(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode);
-
-  Expression::SPType __Decode_Nq(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode);
-
-  Expression::SPType __Decode_Ob(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode);
-  Expression::SPType __Decode_Ov(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode);
-
-  Expression::SPType __Decode_Pq(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode);
-
-  Expression::SPType __Decode_Qd(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode);
-  Expression::SPType __Decode_Qq(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode);
-
-  Expression::SPType __Decode_Rv(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode);
-  Expression::SPType __Decode_Ry(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode);
-
-  Expression::SPType __Decode_Sw(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode);
-
-  Expression::SPType __Decode_Ty(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode);
-
-  Expression::SPType __Decode_Uo(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode);
-  Expression::SPType __Decode_Uod(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode);
-  Expression::SPType __Decode_Uoq(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode);
-  Expression::SPType __Decode_Uq(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode);
-  Expression::SPType __Decode_Ux(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode);
-
-  Expression::SPType __Decode_Vo(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode);
-  Expression::SPType __Decode_Vod(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode);
-  Expression::SPType __Decode_Voq(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode);
-  Expression::SPType __Decode_Vx(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode);
-  Expression::SPType __Decode_Vy(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode);
-
-  Expression::SPType __Decode_Wd(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode);
-  Expression::SPType __Decode_Wo(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode);
-  Expression::SPType __Decode_Wob(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode);
-  Expression::SPType __Decode_Wod(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode);
-  Expression::SPType __Decode_Woo(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode);
-  Expression::SPType __Decode_Woq(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode);
-  Expression::SPType __Decode_Woqo(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode);
-  Expression::SPType __Decode_Wow(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode);
-  Expression::SPType __Decode_Wq(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode);
-  Expression::SPType __Decode_Wx(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode);
-  Expression::SPType __Decode_Wy(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode);
-
-  Expression::SPType __Decode_m16int(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode);
-  Expression::SPType __Decode_m32fp(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode);
-  Expression::SPType __Decode_m32int(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode);
-  Expression::SPType __Decode_m64fp(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode);
-  Expression::SPType __Decode_m64int(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode);
-  Expression::SPType __Decode_m80bcd(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode);
-  Expression::SPType __Decode_m80dec(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode);
-  Expression::SPType __Decode_m80fp(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode);
-
-  Expression::SPType __Decode_b(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode);
-  Expression::SPType __Decode_w(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode);
-  Expression::SPType __Decode_x(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode);
+  //! This method decodes a whole instruction for a mode known at compile time
+  template<u8 Mode> bool _Disassemble(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn);
+
+  //! This method interprets a decode entry, only opcodes with a dedicated handler leave this function
+  template<u8 Mode> bool _Decode(DecodeEntry const& rEntry, BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn);
+
+  template<u8 Mode> Expression::SPType __Decode_Ap(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn);
+  template<u8 Mode> Expression::SPType __Decode_By(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn);
+  template<u8 Mode> Expression::SPType __Decode_Cy(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn);
+  template<u8 Mode> Expression::SPType __Decode_Dy(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn);
+
+  template<u8 Mode> Expression::SPType __Decode_Eb(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn);
+  template<u8 Mode> Expression::SPType __Decode_Ed(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn);
+  template<u8 Mode> Expression::SPType __Decode_Edb(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn);
+  template<u8 Mode> Expression::SPType __Decode_Eq(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn);
+  template<u8 Mode> Expression::SPType __Decode_Ev(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn);
+  template<u8 Mode> Expression::SPType __Decode_Ew(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn);
+  template<u8 Mode> Expression::SPType __Decode_Ey(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn);
+  template<u8 Mode> Expression::SPType __Decode_Eyb(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn);
+  template<u8 Mode> Expression::SPType __Decode_Eyw(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn);
+
+  template<u8 Mode> Expression::SPType __Decode_Gb(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn);
+  template<u8 Mode> Expression::SPType __Decode_Gw(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn);
+  template<u8 Mode> Expression::SPType __Decode_Gd(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn);
+  template<u8 Mode> Expression::SPType __Decode_Gq(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn);
+  template<u8 Mode> Expression::SPType __Decode_Gv(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn);
+  template<u8 Mode> Expression::SPType __Decode_Gy(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn);
+
+  template<u8 Mode> Expression::SPType __Decode_Ho(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn);
+  template<u8 Mode> Expression::SPType __Decode_Hx(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn);
+  template<u8 Mode> Expression::SPType __Decode_Hy(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn);
+
+  template<u8 Mode> Expression::SPType __Decode_Ibs(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn);
+
+  template<u8 Mode> Expression::SPType __Decode_Jb(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn);
+  template<u8 Mode> Expression::SPType __Decode_Jz(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn);
+
+  template<u8 Mode> Expression::SPType __Decode_Lx(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn);
+
+  template<u8 Mode> Expression::SPType __Decode_M(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn);
+  template<u8 Mode> Expression::SPType __Decode_Ma(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn);
+  template<u8 Mode> Expression::SPType __Decode_Md(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn);
+  template<u8 Mode> Expression::SPType __Decode_Mo(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn);
+  template<u8 Mode> Expression::SPType __Decode_Mod(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn);
+  template<u8 Mode> Expression::SPType __Decode_Moq(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn);
+  template<u8 Mode> Expression::SPType __Decode_Mp(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn);
+  template<u8 Mode> Expression::SPType __Decode_Mq(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn);
+  template<u8 Mode> Expression::SPType __Decode_Mqo(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn);
+  template<u8 Mode> Expression::SPType __Decode_Mv(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn);
+  template<u8 Mode> Expression::SPType __Decode_Mw(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn);
+  template<u8 Mode> Expression::SPType __Decode_Mx(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn);
+  template<u8 Mode> Expression::SPType __Decode_My(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn);
+
+  template<u8 Mode> Expression::SPType __Decode_Nq(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn);
+
+  template<u8 Mode> Expression::SPType __Decode_Ob(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn);
+  template<u8 Mode> Expression::SPType __Decode_Ov(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn);
+
+  template<u8 Mode> Expression::SPType __Decode_Pq(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn);
+
+  template<u8 Mode> Expression::SPType __Decode_Qd(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn);
+  template<u8 Mode> Expression::SPType __Decode_Qq(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn);
+
+  template<u8 Mode> Expression::SPType __Decode_Rv(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn);
+  template<u8 Mode> Expression::SPType __Decode_Ry(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn);
+
+  template<u8 Mode> Expression::SPType __Decode_Sw(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn);
+
+  template<u8 Mode> Expression::SPType __Decode_Ty(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn);
+
+  template<u8 Mode> Expression::SPType __Decode_Uo(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn);
+  template<u8 Mode> Expression::SPType __Decode_Uod(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn);
+  template<u8 Mode> Expression::SPType __Decode_Uoq(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn);
+  template<u8 Mode> Expression::SPType __Decode_Uq(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn);
+  template<u8 Mode> Expression::SPType __Decode_Ux(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn);
+
+  template<u8 Mode> Expression::SPType __Decode_Vo(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn);
+  template<u8 Mode> Expression::SPType __Decode_Vod(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn);
+  template<u8 Mode> Expression::SPType __Decode_Voq(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn);
+  template<u8 Mode> Expression::SPType __Decode_Vx(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn);
+  template<u8 Mode> Expression::SPType __Decode_Vy(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn);
+
+  template<u8 Mode> Expression::SPType __Decode_Wd(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn);
+  template<u8 Mode> Expression::SPType __Decode_Wo(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn);
+  template<u8 Mode> Expression::SPType __Decode_Wob(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn);
+  template<u8 Mode> Expression::SPType __Decode_Wod(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn);
+  template<u8 Mode> Expression::SPType __Decode_Woo(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn);
+  template<u8 Mode> Expression::SPType __Decode_Woq(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn);
+  template<u8 Mode> Expression::SPType __Decode_Woqo(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn);
+  template<u8 Mode> Expression::SPType __Decode_Wow(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn);
+  template<u8 Mode> Expression::SPType __Decode_Wq(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn);
+  template<u8 Mode> Expression::SPType __Decode_Wx(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn);
+  template<u8 Mode> Expression::SPType __Decode_Wy(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn);
+
+  template<u8 Mode> Expression::SPType __Decode_m16int(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn);
+  template<u8 Mode> Expression::SPType __Decode_m32fp(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn);
+  template<u8 Mode> Expression::SPType __Decode_m32int(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn);
+  template<u8 Mode> Expression::SPType __Decode_m64fp(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn);
+  template<u8 Mode> Expression::SPType __Decode_m64int(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn);
+  template<u8 Mode> Expression::SPType __Decode_m80bcd(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn);
+  template<u8 Mode> Expression::SPType __Decode_m80dec(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn);
+  template<u8 Mode> Expression::SPType __Decode_m80fp(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn);
+
+  template<u8 Mode> Expression::SPType __Decode_b(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn);
+  template<u8 Mode> Expression::SPType __Decode_w(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn);
+  template<u8 Mode> Expression::SPType __Decode_x(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn);
 
 private:
   static const char * m_Mnemonic[];
 };
 
+// Decoding functions are defined in several translation units, each of them
+// instantiates its own functions for every supported mode
+#define X86_INSTANTIATE_DISASSEMBLER(Name)                                                                           \
+  template bool X86Architecture::Name<X86_Bit_16>(BinaryStream const&, OffsetType, Instruction&);                   \
+  template bool X86Architecture::Name<X86_Bit_32>(BinaryStream const&, OffsetType, Instruction&);                   \
+  template bool X86Architecture::Name<X86_Bit_64>(BinaryStream const&, OffsetType, Instruction&)
+
+#define X86_INSTANTIATE_DECODER(Name)                                                                                \
+  template Expression::SPType X86Architecture::Name<X86_Bit_16>(BinaryStream const&, OffsetType, Instruction&);     \
+  template Expression::SPType X86Architecture::Name<X86_Bit_32>(BinaryStream const&, OffsetType, Instruction&);     \
+  template Expression::SPType X86Architecture::Name<X86_Bit_64>(BinaryStream const&, OffsetType, Instruction&)
+
 #endif // !ARCH_X86_HPP
\ No newline at end of file
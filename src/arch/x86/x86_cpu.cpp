@@ -67,277 +67,174 @@ X86Architecture::X86CpuContext::X86CpuContext(u8 Bits, CpuInformation const& rCp
 
 bool X86Architecture::X86CpuContext::ReadRegister(u32 Reg, void* pVal, u32 BitSize) const
 {
-  auto RegBitSize = m_rCpuInfo.GetSizeOfRegisterInBit(Reg);
-  if (RegBitSize != BitSize)
-    return false;
-
-#define READ_R_L(reg) *reinterpret_cast<u8  *>(pVal) = m_Context.reg.x.l;
-#define READ_R_H(reg) *reinterpret_cast<u8  *>(pVal) = m_Context.reg.x.h;
-#define READ_R_W(reg) *reinterpret_cast<u16 *>(pVal) = m_Context.reg.w;
-#define READ_S(seg)   *reinterpret_cast<u16 *>(pVal) = m_Context.seg;
-#define READ_R_E(reg) *reinterpret_cast<u32 *>(pVal) = m_Context.reg.e;
-#define READ_R_R(reg) *reinterpret_cast<u64 *>(pVal) = m_Context.reg.r;
-#define READ_F(flg)   *reinterpret_cast<bool*>(pVal) = (m_Context.flg) ? true : false;
-#define READ_R_X(reg) ReadSseRegister<128>(m_Context.reg, pVal);
-
-  switch (Reg)
+  // SIMD registers are multiprecision integers, so they can't be described
+  if (Reg >= X86_Reg_Xmm0 && Reg <= X86_Reg_Xmm15)
   {
-  case X86_FlCf:    READ_F(CF); break;
-  case X86_FlPf:    READ_F(PF); break;
-  case X86_FlAf:    READ_F(AF); break;
-  case X86_FlZf:    READ_F(ZF); break;
-  case X86_FlSf:    READ_F(SF); break;
-  case X86_FlTf:    READ_F(TF); break;
-  case X86_FlIf:    READ_F(IF); break;
-  case X86_FlDf:    READ_F(DF); break;
-  case X86_FlOf:    READ_F(OF); break;
-
-  case X86_Reg_Al:  READ_R_L(a);       break;
-  case X86_Reg_Ah:  READ_R_H(a);       break;
-  case X86_Reg_Bl:  READ_R_L(b);       break;
-  case X86_Reg_Bh:  READ_R_H(b);       break;
-  case X86_Reg_Cl:  READ_R_L(c);       break;
-  case X86_Reg_Ch:  READ_R_H(c);       break;
-  case X86_Reg_Dl:  READ_R_L(d);       break;
-  case X86_Reg_Dh:  READ_R_H(d);       break;
-  case X86_Reg_Spl: READ_R_L(sp);      break;
-  case X86_Reg_Bpl: READ_R_L(bp);      break;
-  case X86_Reg_Sil: READ_R_L(si);      break;
-  case X86_Reg_Dil: READ_R_L(di);      break;
-  case X86_Reg_R8b: READ_R_L(r8);      break;
-  case X86_Reg_R9b: READ_R_L(r9);      break;
-  case X86_Reg_R10b:READ_R_L(r10);     break;
-  case X86_Reg_R11b:READ_R_L(r11);     break;
-  case X86_Reg_R12b:READ_R_L(r12);     break;
-  case X86_Reg_R13b:READ_R_L(r13);     break;
-  case X86_Reg_R14b:READ_R_L(r14);     break;
-  case X86_Reg_R15b:READ_R_L(r15);     break;
-
-  case X86_Reg_Ax:  READ_R_W(a);       break;
-  case X86_Reg_Bx:  READ_R_W(b);       break;
-  case X86_Reg_Cx:  READ_R_W(c);       break;
-  case X86_Reg_Dx:  READ_R_W(d);       break;
-  case X86_Reg_Sp:  READ_R_W(sp);      break;
-  case X86_Reg_Bp:  READ_R_W(bp);      break;
-  case X86_Reg_Si:  READ_R_W(si);      break;
-  case X86_Reg_Di:  READ_R_W(di);      break;
-  case X86_Reg_R8w: READ_R_W(r8);      break;
-  case X86_Reg_R9w: READ_R_W(r9);      break;
-  case X86_Reg_R10w:READ_R_W(r10);     break;
-  case X86_Reg_R11w:READ_R_W(r11);     break;
-  case X86_Reg_R12w:READ_R_W(r12);     break;
-  case X86_Reg_R13w:READ_R_W(r13);     break;
-  case X86_Reg_R14w:READ_R_W(r14);     break;
-  case X86_Reg_R15w:READ_R_W(r15);     break;
-  case X86_Reg_Ip:  READ_R_W(ip);      break;
-  case X86_Reg_Cs:  READ_S(cs);        break;
-  case X86_Reg_Ds:  READ_S(ds);        break;
-  case X86_Reg_Es:  READ_S(es);        break;
-  case X86_Reg_Ss:  READ_S(ss);        break;
-  case X86_Reg_Fs:  READ_S(fs);        break;
-  case X86_Reg_Gs:  READ_S(gs);        break;
-
-  case X86_Reg_Eax: READ_R_E(a);       break;
-  case X86_Reg_Ebx: READ_R_E(b);       break;
-  case X86_Reg_Ecx: READ_R_E(c);       break;
-  case X86_Reg_Edx: READ_R_E(d);       break;
-  case X86_Reg_Esp: READ_R_E(sp);      break;
-  case X86_Reg_Ebp: READ_R_E(bp);      break;
-  case X86_Reg_Esi: READ_R_E(si);      break;
-  case X86_Reg_Edi: READ_R_E(di);      break;
-  case X86_Reg_R8d: READ_R_E(r8);      break;
-  case X86_Reg_R9d: READ_R_E(r9);      break;
-  case X86_Reg_R10d:READ_R_E(r10);     break;
-  case X86_Reg_R11d:READ_R_E(r11);     break;
-  case X86_Reg_R12d:READ_R_E(r12);     break;
-  case X86_Reg_R13d:READ_R_E(r13);     break;
-  case X86_Reg_R14d:READ_R_E(r14);     break;
-  case X86_Reg_R15d:READ_R_E(r15);     break;
-  case X86_Reg_Eip: READ_R_E(ip);      break;
-
-  case X86_Reg_Rax: READ_R_R(a);       break;
-  case X86_Reg_Rbx: READ_R_R(b);       break;
-  case X86_Reg_Rcx: READ_R_R(c);       break;
-  case X86_Reg_Rdx: READ_R_R(d);       break;
-  case X86_Reg_Rsp: READ_R_R(sp);      break;
-  case X86_Reg_Rbp: READ_R_R(bp);      break;
-  case X86_Reg_Rsi: READ_R_R(si);      break;
-  case X86_Reg_Rdi: READ_R_R(di);      break;
-  case X86_Reg_R8:  READ_R_R(r8);      break;
-  case X86_Reg_R9:  READ_R_R(r9);      break;
-  case X86_Reg_R10: READ_R_R(r10);     break;
-  case X86_Reg_R11: READ_R_R(r11);     break;
-  case X86_Reg_R12: READ_R_R(r12);     break;
-  case X86_Reg_R13: READ_R_R(r13);     break;
-  case X86_Reg_R14: READ_R_R(r14);     break;
-  case X86_Reg_R15: READ_R_R(r15);     break;
-  case X86_Reg_Rip: READ_R_R(ip);      break;
-
-  case X86_Reg_Xmm0: READ_R_X(xyzmm[0]) break;
-  case X86_Reg_Xmm1: READ_R_X(xyzmm[1]) break;
-  case X86_Reg_Xmm2: READ_R_X(xyzmm[2]) break;
-  case X86_Reg_Xmm3: READ_R_X(xyzmm[3]) break;
-  case X86_Reg_Xmm4: READ_R_X(xyzmm[4]) break;
-  case X86_Reg_Xmm5: READ_R_X(xyzmm[5]) break;
-  case X86_Reg_Xmm6: READ_R_X(xyzmm[6]) break;
-  case X86_Reg_Xmm7: READ_R_X(xyzmm[7]) break;
-  case X86_Reg_Xmm8: READ_R_X(xyzmm[8]) break;
-  case X86_Reg_Xmm9: READ_R_X(xyzmm[9]) break;
-  case X86_Reg_Xmm10: READ_R_X(xyzmm[10]) break;
-  case X86_Reg_Xmm11: READ_R_X(xyzmm[11]) break;
-  case X86_Reg_Xmm12: READ_R_X(xyzmm[12]) break;
-  case X86_Reg_Xmm13: READ_R_X(xyzmm[13]) break;
-  case X86_Reg_Xmm14: READ_R_X(xyzmm[14]) break;
-  case X86_Reg_Xmm15: READ_R_X(xyzmm[15]) break;
+    if (BitSize != 128)
+      return false;
+    ReadSseRegister<128>(m_Context.xyzmm[Reg - X86_Reg_Xmm0], pVal);
+    return true;
   }
 
-#undef READ_R_L
-#undef READ_R_H
-#undef READ_R_W
-#undef READ_S
-#undef READ_R_E
-#undef READ_R_R
-#undef READ_F
-
-  return true;
+  return _ReadRegister(GetRegisterDescriptor(Reg), &m_Context, pVal, BitSize);
 }
 
 bool X86Architecture::X86CpuContext::WriteRegister(u32 Reg, void const* pVal, u32 BitSize)
 {
-  auto RegBitSize = m_rCpuInfo.GetSizeOfRegisterInBit(Reg);
-  if (RegBitSize != BitSize)
-    return false;
+  if (Reg >= X86_Reg_Xmm0 && Reg <= X86_Reg_Xmm15)
+  {
+    if (BitSize != 128)
+      return false;
+    WriteSseRegister<128>(m_Context.xyzmm[Reg - X86_Reg_Xmm0], pVal);
+    return true;
+  }
 
-#define WRITE_R_L(reg) m_Context.reg.x.l = *reinterpret_cast<u8  const*>(pVal);
-#define WRITE_R_H(reg) m_Context.reg.x.h = *reinterpret_cast<u8  const*>(pVal);
-#define WRITE_R_W(reg) m_Context.reg.w   = *reinterpret_cast<u16 const*>(pVal);
-#define WRITE_S(seg)   m_Context.seg     = *reinterpret_cast<u16 const*>(pVal);
-#define WRITE_R_E(reg) m_Context.reg.r   = *reinterpret_cast<u32 const*>(pVal); /* AMD64 clears 32MSB of register */
-#define WRITE_R_R(reg) m_Context.reg.r   = *reinterpret_cast<u64 const*>(pVal);
-#define WRITE_F(flg)   m_Context.flg     = *reinterpret_cast<u8  const*>(pVal) ? true : false;
-#define WRITE_R_X(reg) WriteSseRegister<128>(m_Context.reg, pVal);
+  return _WriteRegister(GetRegisterDescriptor(Reg), &m_Context, pVal, BitSize);
+}
 
+CpuContext::RegisterDescriptor const* X86Architecture::X86CpuContext::GetRegisterDescriptor(u32 Reg) const
+{
+  auto const& rRegDescs = _GetRegisterDescriptors();
+  RegisterDescriptor const* pRegDesc;
 
-  switch (Reg)
+  // Flags are identified by their mask shifted by 16-bit
+  if (Reg > 0xffff)
+  {
+    u32 FlagIdx = Reg >> 16;
+    if (FlagIdx >= sizeof(rRegDescs.m_Flags) / sizeof(*rRegDescs.m_Flags))
+      return nullptr;
+    pRegDesc = &rRegDescs.m_Flags[FlagIdx];
+  }
+  else
   {
-  case X86_FlCf:    WRITE_F(CF); break;
-  case X86_FlPf:    WRITE_F(PF); break;
-  case X86_FlAf:    WRITE_F(AF); break;
-  case X86_FlZf:    WRITE_F(ZF); break;
-  case X86_FlSf:    WRITE_F(SF); break;
-  case X86_FlTf:    WRITE_F(TF); break;
-  case X86_FlIf:    WRITE_F(IF); break;
-  case X86_FlDf:    WRITE_F(DF); break;
-  case X86_FlOf:    WRITE_F(OF); break;
-
-  case X86_Reg_Al:  WRITE_R_L(a);       break;
-  case X86_Reg_Ah:  WRITE_R_H(a);       break;
-  case X86_Reg_Bl:  WRITE_R_L(b);       break;
-  case X86_Reg_Bh:  WRITE_R_H(b);       break;
-  case X86_Reg_Cl:  WRITE_R_L(c);       break;
-  case X86_Reg_Ch:  WRITE_R_H(c);       break;
-  case X86_Reg_Dl:  WRITE_R_L(d);       break;
-  case X86_Reg_Dh:  WRITE_R_H(d);       break;
-  case X86_Reg_Spl: WRITE_R_L(sp);      break;
-  case X86_Reg_Bpl: WRITE_R_L(bp);      break;
-  case X86_Reg_Sil: WRITE_R_L(si);      break;
-  case X86_Reg_Dil: WRITE_R_L(di);      break;
-  case X86_Reg_R8b: WRITE_R_L(r8);      break;
-  case X86_Reg_R9b: WRITE_R_L(r9);      break;
-  case X86_Reg_R10b:WRITE_R_L(r10);     break;
-  case X86_Reg_R11b:WRITE_R_L(r11);     break;
-  case X86_Reg_R12b:WRITE_R_L(r12);     break;
-  case X86_Reg_R13b:WRITE_R_L(r13);     break;
-  case X86_Reg_R14b:WRITE_R_L(r14);     break;
-  case X86_Reg_R15b:WRITE_R_L(r15);     break;
-
-  case X86_Reg_Ax:  WRITE_R_W(a);       break;
-  case X86_Reg_Bx:  WRITE_R_W(b);       break;
-  case X86_Reg_Cx:  WRITE_R_W(c);       break;
-  case X86_Reg_Dx:  WRITE_R_W(d);       break;
-  case X86_Reg_Sp:  WRITE_R_W(sp);      break;
-  case X86_Reg_Bp:  WRITE_R_W(bp);      break;
-  case X86_Reg_Si:  WRITE_R_W(si);      break;
-  case X86_Reg_Di:  WRITE_R_W(di);      break;
-  case X86_Reg_R8w: WRITE_R_W(r8);      break;
-  case X86_Reg_R9w: WRITE_R_W(r9);      break;
-  case X86_Reg_R10w:WRITE_R_W(r10);     break;
-  case X86_Reg_R11w:WRITE_R_W(r11);     break;
-  case X86_Reg_R12w:WRITE_R_W(r12);     break;
-  case X86_Reg_R13w:WRITE_R_W(r13);     break;
-  case X86_Reg_R14w:WRITE_R_W(r14);     break;
-  case X86_Reg_R15w:WRITE_R_W(r15);     break;
-  case X86_Reg_Ip:  WRITE_R_W(ip);      break;
-  case X86_Reg_Cs:  WRITE_S(cs);        break;
-  case X86_Reg_Ds:  WRITE_S(ds);        break;
-  case X86_Reg_Es:  WRITE_S(es);        break;
-  case X86_Reg_Ss:  WRITE_S(ss);        break;
-  case X86_Reg_Fs:  WRITE_S(fs);        break;
-  case X86_Reg_Gs:  WRITE_S(gs);        break;
-
-  case X86_Reg_Eax: WRITE_R_E(a);       break;
-  case X86_Reg_Ebx: WRITE_R_E(b);       break;
-  case X86_Reg_Ecx: WRITE_R_E(c);       break;
-  case X86_Reg_Edx: WRITE_R_E(d);       break;
-  case X86_Reg_Esp: WRITE_R_E(sp);      break;
-  case X86_Reg_Ebp: WRITE_R_E(bp);      break;
-  case X86_Reg_Esi: WRITE_R_E(si);      break;
-  case X86_Reg_Edi: WRITE_R_E(di);      break;
-  case X86_Reg_R8d: WRITE_R_E(r8);      break;
-  case X86_Reg_R9d: WRITE_R_E(r9);      break;
-  case X86_Reg_R10d:WRITE_R_E(r10);     break;
-  case X86_Reg_R11d:WRITE_R_E(r11);     break;
-  case X86_Reg_R12d:WRITE_R_E(r12);     break;
-  case X86_Reg_R13d:WRITE_R_E(r13);     break;
-  case X86_Reg_R14d:WRITE_R_E(r14);     break;
-  case X86_Reg_R15d:WRITE_R_E(r15);     break;
-  case X86_Reg_Eip: WRITE_R_E(ip);      break;
-
-  case X86_Reg_Rax: WRITE_R_R(a);       break;
-  case X86_Reg_Rbx: WRITE_R_R(b);       break;
-  case X86_Reg_Rcx: WRITE_R_R(c);       break;
-  case X86_Reg_Rdx: WRITE_R_R(d);       break;
-  case X86_Reg_Rsp: WRITE_R_R(sp);      break;
-  case X86_Reg_Rbp: WRITE_R_R(bp);      break;
-  case X86_Reg_Rsi: WRITE_R_R(si);      break;
-  case X86_Reg_Rdi: WRITE_R_R(di);      break;
-  case X86_Reg_R8:  WRITE_R_R(r8);      break;
-  case X86_Reg_R9:  WRITE_R_R(r9);      break;
-  case X86_Reg_R10: WRITE_R_R(r10);     break;
-  case X86_Reg_R11: WRITE_R_R(r11);     break;
-  case X86_Reg_R12: WRITE_R_R(r12);     break;
-  case X86_Reg_R13: WRITE_R_R(r13);     break;
-  case X86_Reg_R14: WRITE_R_R(r14);     break;
-  case X86_Reg_R15: WRITE_R_R(r15);     break;
-  case X86_Reg_Rip: WRITE_R_R(ip);      break;
-
-  case X86_Reg_Xmm0: WRITE_R_X(xyzmm[0]) break;
-  case X86_Reg_Xmm1: WRITE_R_X(xyzmm[1]) break;
-  case X86_Reg_Xmm2: WRITE_R_X(xyzmm[2]) break;
-  case X86_Reg_Xmm3: WRITE_R_X(xyzmm[3]) break;
-  case X86_Reg_Xmm4: WRITE_R_X(xyzmm[4]) break;
-  case X86_Reg_Xmm5: WRITE_R_X(xyzmm[5]) break;
-  case X86_Reg_Xmm6: WRITE_R_X(xyzmm[6]) break;
-  case X86_Reg_Xmm7: WRITE_R_X(xyzmm[7]) break;
-  case X86_Reg_Xmm8: WRITE_R_X(xyzmm[8]) break;
-  case X86_Reg_Xmm9: WRITE_R_X(xyzmm[9]) break;
-  case X86_Reg_Xmm10: WRITE_R_X(xyzmm[10]) break;
-  case X86_Reg_Xmm11: WRITE_R_X(xyzmm[11]) break;
-  case X86_Reg_Xmm12: WRITE_R_X(xyzmm[12]) break;
-  case X86_Reg_Xmm13: WRITE_R_X(xyzmm[13]) break;
-  case X86_Reg_Xmm14: WRITE_R_X(xyzmm[14]) break;
-  case X86_Reg_Xmm15: WRITE_R_X(xyzmm[15]) break;
+    if (Reg >= sizeof(rRegDescs.m_Regs) / sizeof(*rRegDescs.m_Regs))
+      return nullptr;
+    pRegDesc = &rRegDescs.m_Regs[Reg];
   }
 
-#undef WRITE_R_L
-#undef WRITE_R_H
-#undef WRITE_R_W
-#undef WRITE_S
-#undef WRITE_R_E
-#undef WRITE_R_R
-#undef WRITE_F
+  return pRegDesc->m_ContainerSize != 0 ? pRegDesc : nullptr;
+}
 
-  return true;
+X86Architecture::X86CpuContext::RegisterDescriptorTable const& X86Architecture::X86CpuContext::_GetRegisterDescriptors(void)
+{
+  static RegisterDescriptorTable const s_RegDescs = []
+  {
+    RegisterDescriptorTable RegDescs;
+    memset(&RegDescs, 0x0, sizeof(RegDescs));
+
+#define DESC(tbl, id, off, cont, bits, flg) { RegisterDescriptor Desc = { static_cast<u16>(off), cont, 0, bits, flg }; RegDescs.tbl[id] = Desc; }
+#define DESC_R_L(id, reg) DESC(m_Regs, id, offsetof(Context, reg),     1,  8, 0)
+#define DESC_R_H(id, reg) DESC(m_Regs, id, offsetof(Context, reg) + 1, 1,  8, 0)
+#define DESC_R_W(id, reg) DESC(m_Regs, id, offsetof(Context, reg),     2, 16, 0)
+#define DESC_S(id, seg)   DESC(m_Regs, id, offsetof(Context, seg),     2, 16, 0)
+#define DESC_R_E(id, reg) DESC(m_Regs, id, offsetof(Context, reg),     8, 32, RegisterDescriptor::ClearContainer) /* AMD64 clears 32MSB of register */
+#define DESC_R_R(id, reg) DESC(m_Regs, id, offsetof(Context, reg),     8, 64, 0)
+#define DESC_F(id, flg)   DESC(m_Flags, id >> 16, offsetof(Context, flg), sizeof(bool), 1, RegisterDescriptor::ClearContainer)
+
+    DESC_F(X86_FlCf, CF);
+    DESC_F(X86_FlPf, PF);
+    DESC_F(X86_FlAf, AF);
+    DESC_F(X86_FlZf, ZF);
+    DESC_F(X86_FlSf, SF);
+    DESC_F(X86_FlTf, TF);
+    DESC_F(X86_FlIf, IF);
+    DESC_F(X86_FlDf, DF);
+    DESC_F(X86_FlOf, OF);
+
+    DESC_R_L(X86_Reg_Al,   a);
+    DESC_R_H(X86_Reg_Ah,   a);
+    DESC_R_L(X86_Reg_Bl,   b);
+    DESC_R_H(X86_Reg_Bh,   b);
+    DESC_R_L(X86_Reg_Cl,   c);
+    DESC_R_H(X86_Reg_Ch,   c);
+    DESC_R_L(X86_Reg_Dl,   d);
+    DESC_R_H(X86_Reg_Dh,   d);
+    DESC_R_L(X86_Reg_Spl,  sp);
+    DESC_R_L(X86_Reg_Bpl,  bp);
+    DESC_R_L(X86_Reg_Sil,  si);
+    DESC_R_L(X86_Reg_Dil,  di);
+    DESC_R_L(X86_Reg_R8b,  r8);
+    DESC_R_L(X86_Reg_R9b,  r9);
+    DESC_R_L(X86_Reg_R10b, r10);
+    DESC_R_L(X86_Reg_R11b, r11);
+    DESC_R_L(X86_Reg_R12b, r12);
+    DESC_R_L(X86_Reg_R13b, r13);
+    DESC_R_L(X86_Reg_R14b, r14);
+    DESC_R_L(X86_Reg_R15b, r15);
+
+    DESC_R_W(X86_Reg_Ax,   a);
+    DESC_R_W(X86_Reg_Bx,   b);
+    DESC_R_W(X86_Reg_Cx,   c);
+    DESC_R_W(X86_Reg_Dx,   d);
+    DESC_R_W(X86_Reg_Sp,   sp);
+    DESC_R_W(X86_Reg_Bp,   bp);
+    DESC_R_W(X86_Reg_Si,   si);
+    DESC_R_W(X86_Reg_Di,   di);
+    DESC_R_W(X86_Reg_R8w,  r8);
+    DESC_R_W(X86_Reg_R9w,  r9);
+    DESC_R_W(X86_Reg_R10w, r10);
+    DESC_R_W(X86_Reg_R11w, r11);
+    DESC_R_W(X86_Reg_R12w, r12);
+    DESC_R_W(X86_Reg_R13w, r13);
+    DESC_R_W(X86_Reg_R14w, r14);
+    DESC_R_W(X86_Reg_R15w, r15);
+    DESC_R_W(X86_Reg_Ip,   ip);
+    DESC_S  (X86_Reg_Cs,   cs);
+    DESC_S  (X86_Reg_Ds,   ds);
+    DESC_S  (X86_Reg_Es,   es);
+    DESC_S  (X86_Reg_Ss,   ss);
+    DESC_S  (X86_Reg_Fs,   fs);
+    DESC_S  (X86_Reg_Gs,   gs);
+
+    DESC_R_E(X86_Reg_Eax,  a);
+    DESC_R_E(X86_Reg_Ebx,  b);
+    DESC_R_E(X86_Reg_Ecx,  c);
+    DESC_R_E(X86_Reg_Edx,  d);
+    DESC_R_E(X86_Reg_Esp,  sp);
+    DESC_R_E(X86_Reg_Ebp,  bp);
+    DESC_R_E(X86_Reg_Esi,  si);
+    DESC_R_E(X86_Reg_Edi,  di);
+    DESC_R_E(X86_Reg_R8d,  r8);
+    DESC_R_E(X86_Reg_R9d,  r9);
+    DESC_R_E(X86_Reg_R10d, r10);
+    DESC_R_E(X86_Reg_R11d, r11);
+    DESC_R_E(X86_Reg_R12d, r12);
+    DESC_R_E(X86_Reg_R13d, r13);
+    DESC_R_E(X86_Reg_R14d, r14);
+    DESC_R_E(X86_Reg_R15d, r15);
+    DESC_R_E(X86_Reg_Eip,  ip);
+
+    DESC_R_R(X86_Reg_Rax,  a);
+    DESC_R_R(X86_Reg_Rbx,  b);
+    DESC_R_R(X86_Reg_Rcx,  c);
+    DESC_R_R(X86_Reg_Rdx,  d);
+    DESC_R_R(X86_Reg_Rsp,  sp);
+    DESC_R_R(X86_Reg_Rbp,  bp);
+    DESC_R_R(X86_Reg_Rsi,  si);
+    DESC_R_R(X86_Reg_Rdi,  di);
+    DESC_R_R(X86_Reg_R8,   r8);
+    DESC_R_R(X86_Reg_R9,   r9);
+    DESC_R_R(X86_Reg_R10,  r10);
+    DESC_R_R(X86_Reg_R11,  r11);
+    DESC_R_R(X86_Reg_R12,  r12);
+    DESC_R_R(X86_Reg_R13,  r13);
+    DESC_R_R(X86_Reg_R14,  r14);
+    DESC_R_R(X86_Reg_R15,  r15);
+    DESC_R_R(X86_Reg_Rip,  ip);
+
+#undef DESC
+#undef DESC_R_L
+#undef DESC_R_H
+#undef DESC_R_W
+#undef DESC_S
+#undef DESC_R_E
+#undef DESC_R_R
+#undef DESC_F
+
+    return RegDescs;
+  }();
+
+  return s_RegDescs;
 }
 
 void* X86Architecture::X86CpuContext::GetRegisterAddress(u32 Register)
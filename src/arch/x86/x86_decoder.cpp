@@ -49,7 +49,8 @@ static u8 __ModRmRegister(Instruction const& rInsn, x86::ModRM const& rModRm)
     rModRm.Reg() | 0x08 : rModRm.Reg();
 }
 
-static u32 __GetOperandSize(Instruction const& rInsn, u8 Mode)
+template<u8 Mode>
+static u32 __GetOperandSize(Instruction const& rInsn)
 {
   switch (Mode)
   {
@@ -70,7 +71,8 @@ static u32 __GetOperandSize(Instruction const& rInsn, u8 Mode)
   }
 }
 
-static u8 __GetAddressSize(Instruction const& rInsn, u8 Mode)
+template<u8 Mode>
+static u8 __GetAddressSize(Instruction const& rInsn)
 {
   switch (Mode)
   {
@@ -104,25 +106,32 @@ static u32 s_CTR[16]    = { X86_Reg_Cr0,  X86_Reg_Cr1,  X86_Reg_Cr2,  X86_Reg_Cr
 static u32 s_DBG[16]    = { X86_Reg_Dr0,  X86_Reg_Dr1,  X86_Reg_Dr2,  X86_Reg_Dr3,  X86_Reg_Dr4,  X86_Reg_Dr5,  X86_Reg_Dr6,     X86_Reg_Dr7,     X86_Reg_Dr8,     X86_Reg_Dr9,     X86_Reg_Dr10,    X86_Reg_Dr11,    X86_Reg_Dr12,    X86_Reg_Dr13,    X86_Reg_Dr14,    X86_Reg_Dr15    };
 static u32 s_TST[16]    = { X86_Reg_Tr0,  X86_Reg_Tr1,  X86_Reg_Tr2,  X86_Reg_Tr3,  X86_Reg_Tr4,  X86_Reg_Tr5,  X86_Reg_Tr6,     X86_Reg_Tr7,     X86_Reg_Tr0,     X86_Reg_Tr1,     X86_Reg_Tr2,     X86_Reg_Tr3,     X86_Reg_Tr4,     X86_Reg_Tr5,     X86_Reg_Tr6,     X86_Reg_Tr7     };
 
-static x86::ModRM __GetModRm(BinaryStream const& rBinStrm, OffsetType Offset)
+// Both return false if the byte lies past the end of the stream, so truncated instructions are rejected
+static bool __GetModRm(BinaryStream const& rBinStrm, OffsetType Offset, x86::ModRM& rModRm)
 {
   u8 ModRmByte;
-  rBinStrm.Read(Offset, ModRmByte);
-  return ModRmByte;
+  if (!rBinStrm.Read(Offset, ModRmByte))
+    return false;
+  rModRm = ModRmByte;
+  return true;
 }
 
-static x86::Sib __GetSib(BinaryStream const& rBinStrm, OffsetType Offset)
+static bool __GetSib(BinaryStream const& rBinStrm, OffsetType Offset, x86::Sib& rSib)
 {
   u8 SibByte;
-  rBinStrm.Read(Offset, SibByte);
-  return SibByte;
+  if (!rBinStrm.Read(Offset, SibByte))
+    return false;
+  rSib = SibByte;
+  return true;
 }
 
 //ref: http://sandpile.org/x86/opc_rm16.htm
 static Expression::SPType __DecodeModRmAddress16(CpuInformation* pCpuInfo, BinaryStream const& rBinStrm, OffsetType Offset, Instruction const& rInsn, u8& OprdLen)
 {
   OprdLen = 0;
-  auto const ModRm = __GetModRm(rBinStrm, Offset);
+  x86::ModRM ModRm;
+  if (!__GetModRm(rBinStrm, Offset, ModRm))
+    return nullptr;
 
   // Mem
   Expression::SPType spOff;
@@ -153,7 +162,8 @@ static Expression::SPType __DecodeModRmAddress16(CpuInformation* pCpuInfo, Binar
       if ((ModRm.Mod()) == 0x0)
       {
         u16 Disp16;
-        rBinStrm.Read(Offset + 1, Disp16);
+        if (!rBinStrm.Read(Offset + 1, Disp16))
+          return nullptr;
         spOff = Expr::MakeBitVector(16, Disp16);
         OprdLen += sizeof(Disp16);
         break;
@@ -177,7 +187,8 @@ static Expression::SPType __DecodeModRmAddress16(CpuInformation* pCpuInfo, Binar
   case 0x1:
     {
       u8 Disp8;
-      rBinStrm.Read(Offset + 1, Disp8);
+      if (!rBinStrm.Read(Offset + 1, Disp8))
+        return nullptr;
       OprdLen += sizeof(Disp8);
       return Expr::MakeBinOp(OperationExpression::OpAdd, spOff, Expr::MakeBitVector(16, static_cast<u16>(SignExtend<s16, 8>(Disp8))));
       break;
@@ -185,7 +196,8 @@ static Expression::SPType __DecodeModRmAddress16(CpuInformation* pCpuInfo, Binar
   case 0x2:
     {
       u16 Disp16;
-      rBinStrm.Read(Offset + 1, Disp16);
+      if (!rBinStrm.Read(Offset + 1, Disp16))
+        return nullptr;
       OprdLen += sizeof(Disp16);
       return Expr::MakeBinOp(OperationExpression::OpAdd, spOff, Expr::MakeBitVector(16, Disp16));
       break;
@@ -209,8 +221,14 @@ static Expression::SPType __DecodeSib32(CpuInformation* pCpuInfo, BinaryStream c
   u32* pRegIndex = (rInsn.GetPrefix() & (X86_Prefix_REX_x & ~X86_Prefix_REX)) ? RegIndexRexX : RegIndex;
   u32  Reg101    = (rInsn.GetPrefix() & (X86_Prefix_REX_b & ~X86_Prefix_REX)) ? X86_Reg_R13d  : X86_Reg_Ebp;
 
-  auto const ModRm = __GetModRm(rBinStrm, Offset - 1);
-  auto const Sib   = __GetSib(rBinStrm, Offset);
+  x86::ModRM ModRm;
+
+  if (!__GetModRm(rBinStrm, Offset - 1, ModRm))
+
+    return nullptr;
+  x86::Sib Sib;
+  if (!__GetSib(rBinStrm, Offset, Sib))
+    return nullptr;
 
   Expression::SPType spReg, spDisp;
 
@@ -224,7 +242,8 @@ static Expression::SPType __DecodeSib32(CpuInformation* pCpuInfo, BinaryStream c
     case 0x0:
       {
         u32 Disp32;
-        rBinStrm.Read(Offset + sizeof(ModRm), Disp32);
+        if (!rBinStrm.Read(Offset + sizeof(ModRm), Disp32))
+          return nullptr;
         spDisp = Expr::MakeBitVector(32, Disp32);
         rOprdLen += sizeof(Disp32);
         break;
@@ -235,7 +254,8 @@ static Expression::SPType __DecodeSib32(CpuInformation* pCpuInfo, BinaryStream c
         spReg = Expr::MakeId(Reg101, pCpuInfo);
 
         u8 Disp8;
-        rBinStrm.Read(Offset + sizeof(ModRm), Disp8);
+        if (!rBinStrm.Read(Offset + sizeof(ModRm), Disp8))
+          return nullptr;
         spDisp = Expr::MakeBitVector(32, static_cast<u32>(SignExtend<s32, 8>(Disp8)));
         rOprdLen += sizeof(Disp8);
         break;
@@ -257,7 +277,8 @@ static Expression::SPType __DecodeSib32(CpuInformation* pCpuInfo, BinaryStream c
     case 0x1:
       {
         u8 Disp8;
-        rBinStrm.Read(Offset + 1, Disp8);
+        if (!rBinStrm.Read(Offset + 1, Disp8))
+          return nullptr;
         spDisp = Expr::MakeBitVector(32, static_cast<u32>(SignExtend<s32, 8>(Disp8)));
         rOprdLen += sizeof(Disp8);
         break;
@@ -266,7 +287,8 @@ static Expression::SPType __DecodeSib32(CpuInformation* pCpuInfo, BinaryStream c
     case 0x2:
       {
         u32 Disp32;
-        rBinStrm.Read(Offset + 1, Disp32);
+        if (!rBinStrm.Read(Offset + 1, Disp32))
+          return nullptr;
         spDisp = Expr::MakeBitVector(32, Disp32);
         rOprdLen += sizeof(Disp32);
         break;
@@ -308,7 +330,11 @@ static Expression::SPType __DecodeModRmAddress32(CpuInformation* pCpuInfo, Binar
   static u16 Reg32[]     = { X86_Reg_Eax, X86_Reg_Ecx, X86_Reg_Edx,  X86_Reg_Ebx,  X86_Reg_Unknown, X86_Reg_Ebp, X86_Reg_Esi,  X86_Reg_Edi  };
   static u16 Reg32RexB[] = { X86_Reg_R8d, X86_Reg_R9d, X86_Reg_R10d, X86_Reg_R11d, X86_Reg_Unknown, X86_Reg_Eip, X86_Reg_R14d, X86_Reg_R15d };
 
-  auto const ModRm = __GetModRm(rBinStrm, Offset);
+  x86::ModRM ModRm;
+
+  if (!__GetModRm(rBinStrm, Offset, ModRm))
+
+    return nullptr;
 
   // SIB
   if (ModRm.Mod() != 0x3 && ModRm.Rm() == 0x4)
@@ -318,7 +344,8 @@ static Expression::SPType __DecodeModRmAddress32(CpuInformation* pCpuInfo, Binar
   else if (ModRm.Mod() == 0x0 && ModRm.Rm() == 0x5)
   {
     u32 Disp32;
-    rBinStrm.Read(Offset + sizeof(ModRm), Disp32);
+    if (!rBinStrm.Read(Offset + sizeof(ModRm), Disp32))
+      return nullptr;
     rOprdLen += sizeof(Disp32);
     return Expr::MakeBitVector(32, Disp32);
   }
@@ -335,7 +362,8 @@ static Expression::SPType __DecodeModRmAddress32(CpuInformation* pCpuInfo, Binar
   case 0x1:
     {
       u8 Disp8;
-      rBinStrm.Read(Offset + sizeof(ModRm), Disp8);
+      if (!rBinStrm.Read(Offset + sizeof(ModRm), Disp8))
+        return nullptr;
       spDisp = Expr::MakeBitVector(32, static_cast<u32>(SignExtend<s32, 8>(Disp8)));
       rOprdLen += sizeof(Disp8);
       break;
@@ -343,7 +371,8 @@ static Expression::SPType __DecodeModRmAddress32(CpuInformation* pCpuInfo, Binar
   case 0x2:
     {
       u32 Disp32;
-      rBinStrm.Read(Offset + sizeof(ModRm), Disp32);
+      if (!rBinStrm.Read(Offset + sizeof(ModRm), Disp32))
+        return nullptr;
       spDisp = Expr::MakeBitVector(32, Disp32);
       rOprdLen += sizeof(Disp32);
       break;
@@ -368,8 +397,14 @@ static Expression::SPType __DecodeSib64(CpuInformation* pCpuInfo, BinaryStream c
   u32* pRegIndex = (rInsn.Prefix() & (X86_Prefix_REX_x & ~X86_Prefix_REX)) ? RegIndexRexX : RegIndex;
   u32  Reg101    = (rInsn.Prefix() & (X86_Prefix_REX_b & ~X86_Prefix_REX)) ? X86_Reg_R13   : X86_Reg_Rbp;
 
-  auto const ModRm = __GetModRm(rBinStrm, Offset - 1);
-  auto const Sib   = __GetSib(rBinStrm, Offset);
+  x86::ModRM ModRm;
+
+  if (!__GetModRm(rBinStrm, Offset - 1, ModRm))
+
+    return nullptr;
+  x86::Sib Sib;
+  if (!__GetSib(rBinStrm, Offset, Sib))
+    return nullptr;
 
   Expression::SPType spReg, spDisp;
 
@@ -383,7 +418,8 @@ static Expression::SPType __DecodeSib64(CpuInformation* pCpuInfo, BinaryStream c
     case 0x0:
       {
         u32 Disp32;
-        rBinStrm.Read(Offset + sizeof(ModRm), Disp32);
+        if (!rBinStrm.Read(Offset + sizeof(ModRm), Disp32))
+          return nullptr;
         spDisp = Expr::MakeBitVector(64, static_cast<u64>(SignExtend<s64, 32>(Disp32)));
         rOprdLen += sizeof(Disp32);
         break;
@@ -394,7 +430,8 @@ static Expression::SPType __DecodeSib64(CpuInformation* pCpuInfo, BinaryStream c
         spReg = Expr::MakeId(Reg101, pCpuInfo);
 
         u8 Disp8;
-        rBinStrm.Read(Offset + sizeof(ModRm), Disp8);
+        if (!rBinStrm.Read(Offset + sizeof(ModRm), Disp8))
+          return nullptr;
         spDisp = Expr::MakeBitVector(64, static_cast<u64>(SignExtend<s64, 8>(Disp8)));
         rOprdLen += sizeof(Disp8);
         break;
@@ -416,7 +453,8 @@ static Expression::SPType __DecodeSib64(CpuInformation* pCpuInfo, BinaryStream c
     case 0x1:
       {
         u8 Disp8;
-        rBinStrm.Read(Offset + 1, Disp8);
+        if (!rBinStrm.Read(Offset + 1, Disp8))
+          return nullptr;
         spDisp = Expr::MakeBitVector(64, static_cast<u64>(SignExtend<s64, 8>(Disp8)));
         rOprdLen += sizeof(Disp8);
         break;
@@ -425,7 +463,8 @@ static Expression::SPType __DecodeSib64(CpuInformation* pCpuInfo, BinaryStream c
     case 0x2:
       {
         u32 Disp32;
-        rBinStrm.Read(Offset + 1, Disp32);
+        if (!rBinStrm.Read(Offset + 1, Disp32))
+          return nullptr;
         spDisp = Expr::MakeBitVector(64, static_cast<u64>(SignExtend<s64, 32>(Disp32)));
         rOprdLen += sizeof(Disp32);
         break;
@@ -467,7 +506,11 @@ static Expression::SPType __DecodeModRmAddress64(CpuInformation* pCpuInfo, Binar
   static u16 Reg[]     = { X86_Reg_Rax, X86_Reg_Rcx, X86_Reg_Rdx, X86_Reg_Rbx, X86_Reg_Unknown, X86_Reg_Rbp, X86_Reg_Rsi, X86_Reg_Rdi };
   static u16 RegRexB[] = { X86_Reg_R8,  X86_Reg_R9,  X86_Reg_R10, X86_Reg_R11, X86_Reg_Unknown, X86_Reg_R13, X86_Reg_R14, X86_Reg_R15 };
 
-  auto const ModRm = __GetModRm(rBinStrm, Offset);
+  x86::ModRM ModRm;
+
+  if (!__GetModRm(rBinStrm, Offset, ModRm))
+
+    return nullptr;
 
   // SIB
   if (ModRm.Mod() != 0x3 && ModRm.Rm() == 0x4)
@@ -478,7 +521,8 @@ static Expression::SPType __DecodeModRmAddress64(CpuInformation* pCpuInfo, Binar
   else if (ModRm.Mod() == 0x0 && ModRm.Rm() == 0x5)
   {
     u32 Disp32;
-    rBinStrm.Read(Offset + sizeof(ModRm), Disp32);
+    if (!rBinStrm.Read(Offset + sizeof(ModRm), Disp32))
+      return nullptr;
     rOprdLen += sizeof(Disp32);
     return Expr::MakeBitVector(64, Disp32);
   }
@@ -495,7 +539,8 @@ static Expression::SPType __DecodeModRmAddress64(CpuInformation* pCpuInfo, Binar
   case 0x1:
     {
       u8 Disp8;
-      rBinStrm.Read(Offset + sizeof(ModRm), Disp8);
+      if (!rBinStrm.Read(Offset + sizeof(ModRm), Disp8))
+        return nullptr;
       spDisp = Expr::MakeBitVector(64, static_cast<u64>(SignExtend<s64, 8>(Disp8)));
       rOprdLen += sizeof(Disp8);
       break;
@@ -503,7 +548,8 @@ static Expression::SPType __DecodeModRmAddress64(CpuInformation* pCpuInfo, Binar
   case 0x2:
     {
       u32 Disp32;
-      rBinStrm.Read(Offset + sizeof(ModRm), Disp32);
+      if (!rBinStrm.Read(Offset + sizeof(ModRm), Disp32))
+        return nullptr;
       spDisp = Expr::MakeBitVector(64, static_cast<u64>(SignExtend<s64, 32>(Disp32)));
       rOprdLen += sizeof(Disp32);
       break;
@@ -515,11 +561,12 @@ static Expression::SPType __DecodeModRmAddress64(CpuInformation* pCpuInfo, Binar
   return spDisp == nullptr ? spReg : Expr::MakeBinOp(OperationExpression::OpAdd, spReg, spDisp);
 }
 
-static Expression::SPType __DecodeModRmAddress(CpuInformation* pCpuInfo, BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8& rOprdLen, X86_Bit Bit)
+template<u8 Mode>
+static Expression::SPType __DecodeModRmAddress(CpuInformation* pCpuInfo, BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8& rOprdLen)
 {
   Expression::SPType spExpr;
 
-  switch (Bit)
+  switch (Mode)
   {
   case X86_Bit_16:
     if (rInsn.Prefix() & X86_Prefix_AdSize)
@@ -538,7 +585,9 @@ static Expression::SPType __DecodeModRmAddress(CpuInformation* pCpuInfo, BinaryS
   case X86_Bit_64:
     // Handle [eip+Disp32] or [rip+Disp32] (x86_64 only)
     {
-      auto const ModRm = __GetModRm(rBinStrm, Offset);
+      x86::ModRM ModRm;
+      if (!__GetModRm(rBinStrm, Offset, ModRm))
+        return nullptr;
       if (ModRm.Mod() == 0x00 && ModRm.Rm() == 0x05)
       {
         bool Is64 = rInsn.GetPrefix() & X86_Prefix_AdSize ? false : true;
@@ -573,7 +622,8 @@ static Expression::SPType __DecodeModRmAddress(CpuInformation* pCpuInfo, BinaryS
   return spExpr;
 }
 
-Expression::SPType X86Architecture::__Decode_Ap(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+Expression::SPType X86Architecture::__Decode_Ap(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   auto Ap16 = [&](void) -> Expression::SPType
   {
@@ -582,8 +632,9 @@ Expression::SPType X86Architecture::__Decode_Ap(BinaryStream const& rBinStrm, Of
 
     if (!rBinStrm.Read(Offset, Off))
       return nullptr;
-    if (!rBinStrm.Read(Offset, Seg))
+    if (!rBinStrm.Read(Offset + sizeof(Off), Seg))
       return nullptr;
+    rInsn.Size() += sizeof(Off) + sizeof(Seg);
 
     auto spConstSeg = Expr::MakeBitVector(16, Seg);
     auto spConstOff = Expr::MakeBitVector(16, Off);
@@ -597,12 +648,13 @@ Expression::SPType X86Architecture::__Decode_Ap(BinaryStream const& rBinStrm, Of
 
     if (!rBinStrm.Read(Offset, Off))
       return nullptr;
-    if (!rBinStrm.Read(Offset, Seg))
+    if (!rBinStrm.Read(Offset + sizeof(Off), Seg))
       return nullptr;
+    rInsn.Size() += sizeof(Off) + sizeof(Seg);
 
     auto spConstSeg = Expr::MakeBitVector(16, Seg);
-    auto spConstOff = Expr::MakeBitVector(16, Off);
-    return Expr::MakeMem(16, spConstSeg, spConstOff, false);
+    auto spConstOff = Expr::MakeBitVector(32, Off);
+    return Expr::MakeMem(32, spConstSeg, spConstOff, false);
   };
 
   switch (Mode)
@@ -624,26 +676,32 @@ Expression::SPType X86Architecture::__Decode_Ap(BinaryStream const& rBinStrm, Of
   }
 }
 
-Expression::SPType X86Architecture::__Decode_By(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+Expression::SPType X86Architecture::__Decode_By(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   return nullptr; /* TODO */
 }
 
-Expression::SPType X86Architecture::__Decode_Cy(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+Expression::SPType X86Architecture::__Decode_Cy(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   return nullptr; /* TODO */
 }
 
-Expression::SPType X86Architecture::__Decode_Dy(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+Expression::SPType X86Architecture::__Decode_Dy(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   return nullptr; /* TODO */
 }
 
-Expression::SPType X86Architecture::__Decode_Eb(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+Expression::SPType X86Architecture::__Decode_Eb(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   Expression::SPType spOprd;
   u8 OprdLen = 0;
-  auto const ModRm = __GetModRm(rBinStrm, Offset);
+  x86::ModRM ModRm;
+  if (!__GetModRm(rBinStrm, Offset, ModRm))
+    return nullptr;
 
   ++rInsn.Size();
 
@@ -651,7 +709,7 @@ Expression::SPType X86Architecture::__Decode_Eb(BinaryStream const& rBinStrm, Of
   {
   case 0: case 1: case 2:
     {
-      auto spOff = __DecodeModRmAddress(&m_CpuInfo, rBinStrm, Offset, rInsn, OprdLen, static_cast<X86_Bit>(Mode));
+      auto spOff = __DecodeModRmAddress<Mode>(&m_CpuInfo, rBinStrm, Offset, rInsn, OprdLen);
       if (spOff == nullptr)
         return nullptr;
       spOprd = Expr::MakeMem(8, __GetSegmentRegister(&m_CpuInfo, rInsn), spOff);
@@ -667,11 +725,14 @@ Expression::SPType X86Architecture::__Decode_Eb(BinaryStream const& rBinStrm, Of
   return spOprd;
 }
 
-Expression::SPType X86Architecture::__Decode_Ed(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+Expression::SPType X86Architecture::__Decode_Ed(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   Expression::SPType spOprd;
   u8 OprdLen = 0;
-  auto const ModRm = __GetModRm(rBinStrm, Offset);
+  x86::ModRM ModRm;
+  if (!__GetModRm(rBinStrm, Offset, ModRm))
+    return nullptr;
 
   ++rInsn.Size();
 
@@ -679,7 +740,7 @@ Expression::SPType X86Architecture::__Decode_Ed(BinaryStream const& rBinStrm, Of
   {
   case 0: case 1: case 2:
     {
-      auto spOff = __DecodeModRmAddress(&m_CpuInfo, rBinStrm, Offset, rInsn, OprdLen, static_cast<X86_Bit>(Mode));
+      auto spOff = __DecodeModRmAddress<Mode>(&m_CpuInfo, rBinStrm, Offset, rInsn, OprdLen);
       if (spOff == nullptr)
         return nullptr;
       spOprd = Expr::MakeMem(32, __GetSegmentRegister(&m_CpuInfo, rInsn), spOff);
@@ -695,16 +756,20 @@ Expression::SPType X86Architecture::__Decode_Ed(BinaryStream const& rBinStrm, Of
   return spOprd;
 }
 
-Expression::SPType X86Architecture::__Decode_Edb(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+Expression::SPType X86Architecture::__Decode_Edb(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   return nullptr; /* TODO */
 }
 
-Expression::SPType X86Architecture::__Decode_Eq(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+Expression::SPType X86Architecture::__Decode_Eq(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   Expression::SPType spOprd;
   u8 OprdLen = 0;
-  auto const ModRm = __GetModRm(rBinStrm, Offset);
+  x86::ModRM ModRm;
+  if (!__GetModRm(rBinStrm, Offset, ModRm))
+    return nullptr;
 
   ++rInsn.Size();
 
@@ -712,7 +777,7 @@ Expression::SPType X86Architecture::__Decode_Eq(BinaryStream const& rBinStrm, Of
   {
   case 0: case 1: case 2:
     {
-      auto spOff = __DecodeModRmAddress(&m_CpuInfo, rBinStrm, Offset, rInsn, OprdLen, static_cast<X86_Bit>(Mode));
+      auto spOff = __DecodeModRmAddress<Mode>(&m_CpuInfo, rBinStrm, Offset, rInsn, OprdLen);
       if (spOff == nullptr)
         return nullptr;
       spOprd = Expr::MakeMem(64, __GetSegmentRegister(&m_CpuInfo, rInsn), spOff);
@@ -728,18 +793,19 @@ Expression::SPType X86Architecture::__Decode_Eq(BinaryStream const& rBinStrm, Of
   return spOprd;
 }
 
-Expression::SPType X86Architecture::__Decode_Ev(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+Expression::SPType X86Architecture::__Decode_Ev(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
-  switch (__GetOperandSize(rInsn, Mode))
+  switch (__GetOperandSize<Mode>(rInsn))
   {
   case 16:
-    return __Decode_Ew(rBinStrm, Offset, rInsn, Mode);
+    return __Decode_Ew<Mode>(rBinStrm, Offset, rInsn);
 
   case 32:
-    return __Decode_Ed(rBinStrm, Offset, rInsn, Mode);
+    return __Decode_Ed<Mode>(rBinStrm, Offset, rInsn);
 
   case 64:
-    return __Decode_Eq(rBinStrm, Offset, rInsn, Mode);
+    return __Decode_Eq<Mode>(rBinStrm, Offset, rInsn);
 
   default:
     assert(0 && "Invalid mode");
@@ -747,11 +813,14 @@ Expression::SPType X86Architecture::__Decode_Ev(BinaryStream const& rBinStrm, Of
   }
 }
 
-Expression::SPType X86Architecture::__Decode_Ew(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+Expression::SPType X86Architecture::__Decode_Ew(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   Expression::SPType spOprd;
   u8 OprdLen = 0;
-  auto const ModRm = __GetModRm(rBinStrm, Offset);
+  x86::ModRM ModRm;
+  if (!__GetModRm(rBinStrm, Offset, ModRm))
+    return nullptr;
 
   ++rInsn.Size();
 
@@ -759,7 +828,7 @@ Expression::SPType X86Architecture::__Decode_Ew(BinaryStream const& rBinStrm, Of
   {
   case 0: case 1: case 2:
     {
-      auto spOff = __DecodeModRmAddress(&m_CpuInfo, rBinStrm, Offset, rInsn, OprdLen, static_cast<X86_Bit>(Mode));
+      auto spOff = __DecodeModRmAddress<Mode>(&m_CpuInfo, rBinStrm, Offset, rInsn, OprdLen);
       if (spOff == nullptr)
         return nullptr;
       spOprd = Expr::MakeMem(16, __GetSegmentRegister(&m_CpuInfo, rInsn), spOff);
@@ -775,16 +844,17 @@ Expression::SPType X86Architecture::__Decode_Ew(BinaryStream const& rBinStrm, Of
   return spOprd;
 }
 
-Expression::SPType X86Architecture::__Decode_Ey(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+Expression::SPType X86Architecture::__Decode_Ey(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
-  switch (__GetOperandSize(rInsn, Mode))
+  switch (__GetOperandSize<Mode>(rInsn))
   {
   case 16:
   case 32:
-    return __Decode_Ed(rBinStrm, Offset, rInsn, Mode);
+    return __Decode_Ed<Mode>(rBinStrm, Offset, rInsn);
 
   case 64:
-    return __Decode_Eq(rBinStrm, Offset, rInsn, Mode);
+    return __Decode_Eq<Mode>(rBinStrm, Offset, rInsn);
 
   default:
     assert(0 && "Invalid mode");
@@ -792,52 +862,67 @@ Expression::SPType X86Architecture::__Decode_Ey(BinaryStream const& rBinStrm, Of
   }
 }
 
-Expression::SPType X86Architecture::__Decode_Eyb(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+Expression::SPType X86Architecture::__Decode_Eyb(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   return nullptr; /* TODO */
 }
 
-Expression::SPType X86Architecture::__Decode_Eyw(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+Expression::SPType X86Architecture::__Decode_Eyw(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   return nullptr; /* TODO */
 }
 
-Expression::SPType X86Architecture::__Decode_Gb(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+Expression::SPType X86Architecture::__Decode_Gb(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
-  auto const ModRm = __GetModRm(rBinStrm, Offset);
+  x86::ModRM ModRm;
+  if (!__GetModRm(rBinStrm, Offset, ModRm))
+    return nullptr;
   return __GetRegisterFromIndex(&m_CpuInfo, __ModRmRegister(rInsn, ModRm), rInsn.GetPrefix() & X86_Prefix_REX ? s_GP8Rex : s_GP8);
 }
 
-Expression::SPType X86Architecture::__Decode_Gw(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+Expression::SPType X86Architecture::__Decode_Gw(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
-  auto const ModRm = __GetModRm(rBinStrm, Offset);
+  x86::ModRM ModRm;
+  if (!__GetModRm(rBinStrm, Offset, ModRm))
+    return nullptr;
   return __GetRegisterFromIndex(&m_CpuInfo, __ModRmRegister(rInsn, ModRm), s_GP16);
 }
 
-Expression::SPType X86Architecture::__Decode_Gd(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+Expression::SPType X86Architecture::__Decode_Gd(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
-  auto const ModRm = __GetModRm(rBinStrm, Offset);
+  x86::ModRM ModRm;
+  if (!__GetModRm(rBinStrm, Offset, ModRm))
+    return nullptr;
   return __GetRegisterFromIndex(&m_CpuInfo, __ModRmRegister(rInsn, ModRm), s_GP32);
 }
 
-Expression::SPType X86Architecture::__Decode_Gq(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+Expression::SPType X86Architecture::__Decode_Gq(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
-  auto const ModRm = __GetModRm(rBinStrm, Offset);
+  x86::ModRM ModRm;
+  if (!__GetModRm(rBinStrm, Offset, ModRm))
+    return nullptr;
   return __GetRegisterFromIndex(&m_CpuInfo, __ModRmRegister(rInsn, ModRm), s_GP64);
 }
 
-Expression::SPType X86Architecture::__Decode_Gv(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+Expression::SPType X86Architecture::__Decode_Gv(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
-  switch (__GetOperandSize(rInsn, Mode))
+  switch (__GetOperandSize<Mode>(rInsn))
   {
   case 16:
-    return __Decode_Gw(rBinStrm, Offset, rInsn, Mode);
+    return __Decode_Gw<Mode>(rBinStrm, Offset, rInsn);
 
   case 32:
-    return __Decode_Gd(rBinStrm, Offset, rInsn, Mode);
+    return __Decode_Gd<Mode>(rBinStrm, Offset, rInsn);
 
   case 64:
-    return __Decode_Gq(rBinStrm, Offset, rInsn, Mode);
+    return __Decode_Gq<Mode>(rBinStrm, Offset, rInsn);
 
   default:
     assert(0 && "Invalid mode");
@@ -845,29 +930,37 @@ Expression::SPType X86Architecture::__Decode_Gv(BinaryStream const& rBinStrm, Of
   }
 }
 
-Expression::SPType X86Architecture::__Decode_Gy(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+Expression::SPType X86Architecture::__Decode_Gy(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   /* FIXME: */
-  return __Decode_Gv(rBinStrm, Offset, rInsn, Mode);
+  return __Decode_Gv<Mode>(rBinStrm, Offset, rInsn);
 }
 
-Expression::SPType X86Architecture::__Decode_Ho(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+Expression::SPType X86Architecture::__Decode_Ho(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   ++rInsn.Size();
-  auto const ModRm = __GetModRm(rBinStrm, Offset);
+  x86::ModRM ModRm;
+  if (!__GetModRm(rBinStrm, Offset, ModRm))
+    return nullptr;
   return __GetRegisterFromIndex(&m_CpuInfo, __ModRmMemoryRegister(rInsn, ModRm), s_MMX);
 }
 
-Expression::SPType X86Architecture::__Decode_Hx(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+Expression::SPType X86Architecture::__Decode_Hx(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   return nullptr; /* TODO */
 }
 
-Expression::SPType X86Architecture::__Decode_Hy(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+Expression::SPType X86Architecture::__Decode_Hy(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   ++rInsn.Size();
-  auto const ModRm = __GetModRm(rBinStrm, Offset);
-  switch (__GetOperandSize(rInsn, Mode))
+  x86::ModRM ModRm;
+  if (!__GetModRm(rBinStrm, Offset, ModRm))
+    return nullptr;
+  switch (__GetOperandSize<Mode>(rInsn))
   {
   case 32:
     return __GetRegisterFromIndex(&m_CpuInfo, __ModRmMemoryRegister(rInsn, ModRm), s_GP32);
@@ -879,7 +972,8 @@ Expression::SPType X86Architecture::__Decode_Hy(BinaryStream const& rBinStrm, Of
 }
 
 // TODO: handle sign extension
-Expression::SPType X86Architecture::__Decode_Ibs(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+Expression::SPType X86Architecture::__Decode_Ibs(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   u8 Value;
 
@@ -895,7 +989,8 @@ Expression::SPType X86Architecture::__Decode_Ibs(BinaryStream const& rBinStrm, O
   return Expr::MakeBitVector(BitSize, SignExtend<s64, 8>(Value));
 }
 
-Expression::SPType X86Architecture::__Decode_Jb(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+Expression::SPType X86Architecture::__Decode_Jb(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   auto RegPc = m_CpuInfo.GetRegisterByType(CpuInformation::ProgramPointerRegister, Mode);
   if (RegPc == 0)
@@ -914,7 +1009,8 @@ Expression::SPType X86Architecture::__Decode_Jb(BinaryStream const& rBinStrm, Of
     Expr::MakeBitVector(RegPcSize, SignExtend<s64, 8>(Value)));
 }
 
-Expression::SPType X86Architecture::__Decode_Jz(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+Expression::SPType X86Architecture::__Decode_Jz(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   auto RegPc = m_CpuInfo.GetRegisterByType(CpuInformation::ProgramPointerRegister, Mode);
   if (RegPc == 0)
@@ -923,7 +1019,7 @@ Expression::SPType X86Architecture::__Decode_Jz(BinaryStream const& rBinStrm, Of
   if (RegPcSize == 0)
     return nullptr;
 
-  switch (__GetOperandSize(rInsn, Mode))
+  switch (__GetOperandSize<Mode>(rInsn))
   {
   case 16:
     {
@@ -954,20 +1050,22 @@ Expression::SPType X86Architecture::__Decode_Jz(BinaryStream const& rBinStrm, Of
   }
 }
 
-Expression::SPType X86Architecture::__Decode_Lx(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+Expression::SPType X86Architecture::__Decode_Lx(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   return nullptr; /* TODO */
 }
 
-Expression::SPType X86Architecture::__Decode_M(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+Expression::SPType X86Architecture::__Decode_M(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   ++rInsn.Size();
   u8 OprdLen = 0;
-  Expression::SPType spOprd = __DecodeModRmAddress(&m_CpuInfo, rBinStrm, Offset, rInsn, OprdLen, static_cast<X86_Bit>(Mode));
+  Expression::SPType spOprd = __DecodeModRmAddress<Mode>(&m_CpuInfo, rBinStrm, Offset, rInsn, OprdLen);
   if (spOprd == nullptr)
     return nullptr;
 
-  auto AccessSize = __GetOperandSize(rInsn, Mode);
+  auto AccessSize = __GetOperandSize<Mode>(rInsn);
   if (AccessSize == 0)
     return nullptr;
 
@@ -976,15 +1074,16 @@ Expression::SPType X86Architecture::__Decode_M(BinaryStream const& rBinStrm, Off
   return Expr::MakeMem(AccessSize, __GetSegmentRegister(&m_CpuInfo, rInsn), spOprd);
 }
 
-Expression::SPType X86Architecture::__Decode_Ma(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+Expression::SPType X86Architecture::__Decode_Ma(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   ++rInsn.Size();
   u8 OprdLen = 0;
-  Expression::SPType spOprd = __DecodeModRmAddress(&m_CpuInfo, rBinStrm, Offset, rInsn, OprdLen, static_cast<X86_Bit>(Mode));
+  Expression::SPType spOprd = __DecodeModRmAddress<Mode>(&m_CpuInfo, rBinStrm, Offset, rInsn, OprdLen);
   if (spOprd == nullptr)
     return nullptr;
 
-  auto AccessSize = __GetOperandSize(rInsn, Mode);
+  auto AccessSize = __GetOperandSize<Mode>(rInsn);
   if (AccessSize == 0)
     return nullptr;
 
@@ -994,11 +1093,12 @@ Expression::SPType X86Architecture::__Decode_Ma(BinaryStream const& rBinStrm, Of
   return Expr::MakeMem(AccessSize * 2, __GetSegmentRegister(&m_CpuInfo, rInsn), spOprd);
 }
 
-Expression::SPType X86Architecture::__Decode_Md(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+Expression::SPType X86Architecture::__Decode_Md(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   ++rInsn.Size();
   u8 OprdLen = 0;
-  Expression::SPType spOprd = __DecodeModRmAddress(&m_CpuInfo, rBinStrm, Offset, rInsn, OprdLen, static_cast<X86_Bit>(Mode));
+  Expression::SPType spOprd = __DecodeModRmAddress<Mode>(&m_CpuInfo, rBinStrm, Offset, rInsn, OprdLen);
   if (spOprd == nullptr)
     return nullptr;
 
@@ -1007,11 +1107,12 @@ Expression::SPType X86Architecture::__Decode_Md(BinaryStream const& rBinStrm, Of
   return Expr::MakeMem(32, __GetSegmentRegister(&m_CpuInfo, rInsn), spOprd);
 }
 
-Expression::SPType X86Architecture::__Decode_Mo(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+Expression::SPType X86Architecture::__Decode_Mo(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   ++rInsn.Size();
   u8 OprdLen = 0;
-  Expression::SPType spOprd = __DecodeModRmAddress(&m_CpuInfo, rBinStrm, Offset, rInsn, OprdLen, static_cast<X86_Bit>(Mode));
+  Expression::SPType spOprd = __DecodeModRmAddress<Mode>(&m_CpuInfo, rBinStrm, Offset, rInsn, OprdLen);
   if (spOprd == nullptr)
     return nullptr;
 
@@ -1020,11 +1121,12 @@ Expression::SPType X86Architecture::__Decode_Mo(BinaryStream const& rBinStrm, Of
   return Expr::MakeMem(128, __GetSegmentRegister(&m_CpuInfo, rInsn), spOprd);
 }
 
-Expression::SPType X86Architecture::__Decode_Mod(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+Expression::SPType X86Architecture::__Decode_Mod(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   ++rInsn.Size();
   u8 OprdLen = 0;
-  Expression::SPType spOprd = __DecodeModRmAddress(&m_CpuInfo, rBinStrm, Offset, rInsn, OprdLen, static_cast<X86_Bit>(Mode));
+  Expression::SPType spOprd = __DecodeModRmAddress<Mode>(&m_CpuInfo, rBinStrm, Offset, rInsn, OprdLen);
   if (spOprd == nullptr)
     return nullptr;
 
@@ -1033,11 +1135,12 @@ Expression::SPType X86Architecture::__Decode_Mod(BinaryStream const& rBinStrm, O
   return Expr::MakeMem(32, __GetSegmentRegister(&m_CpuInfo, rInsn), spOprd);
 }
 
-Expression::SPType X86Architecture::__Decode_Moq(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+Expression::SPType X86Architecture::__Decode_Moq(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   ++rInsn.Size();
   u8 OprdLen = 0;
-  Expression::SPType spOprd = __DecodeModRmAddress(&m_CpuInfo, rBinStrm, Offset, rInsn, OprdLen, static_cast<X86_Bit>(Mode));
+  Expression::SPType spOprd = __DecodeModRmAddress<Mode>(&m_CpuInfo, rBinStrm, Offset, rInsn, OprdLen);
   if (spOprd == nullptr)
     return nullptr;
 
@@ -1046,15 +1149,16 @@ Expression::SPType X86Architecture::__Decode_Moq(BinaryStream const& rBinStrm, O
   return Expr::MakeMem(64, __GetSegmentRegister(&m_CpuInfo, rInsn), spOprd);
 }
 
-Expression::SPType X86Architecture::__Decode_Mp(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+Expression::SPType X86Architecture::__Decode_Mp(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   ++rInsn.Size();
   u8 OprdLen = 0;
-  Expression::SPType spOprd = __DecodeModRmAddress(&m_CpuInfo, rBinStrm, Offset, rInsn, OprdLen, static_cast<X86_Bit>(Mode));
+  Expression::SPType spOprd = __DecodeModRmAddress<Mode>(&m_CpuInfo, rBinStrm, Offset, rInsn, OprdLen);
   if (spOprd == nullptr)
     return nullptr;
 
-  auto AccessSize = __GetOperandSize(rInsn, Mode);
+  auto AccessSize = __GetOperandSize<Mode>(rInsn);
   if (AccessSize == 0)
     return nullptr;
 
@@ -1064,11 +1168,12 @@ Expression::SPType X86Architecture::__Decode_Mp(BinaryStream const& rBinStrm, Of
   return Expr::MakeMem(16 + AccessSize, __GetSegmentRegister(&m_CpuInfo, rInsn), spOprd);
 }
 
-Expression::SPType X86Architecture::__Decode_Mq(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+Expression::SPType X86Architecture::__Decode_Mq(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   ++rInsn.Size();
   u8 OprdLen = 0;
-  Expression::SPType spOprd = __DecodeModRmAddress(&m_CpuInfo, rBinStrm, Offset, rInsn, OprdLen, static_cast<X86_Bit>(Mode));
+  Expression::SPType spOprd = __DecodeModRmAddress<Mode>(&m_CpuInfo, rBinStrm, Offset, rInsn, OprdLen);
   if (spOprd == nullptr)
     return nullptr;
 
@@ -1078,20 +1183,22 @@ Expression::SPType X86Architecture::__Decode_Mq(BinaryStream const& rBinStrm, Of
 }
 
 //http://www.officedaytime.com/tips/simdimg/si.php?f=vpgatherdq
-Expression::SPType X86Architecture::__Decode_Mqo(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+Expression::SPType X86Architecture::__Decode_Mqo(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   return nullptr; /* TODO */
 }
 
-Expression::SPType X86Architecture::__Decode_Mv(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+Expression::SPType X86Architecture::__Decode_Mv(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   ++rInsn.Size();
   u8 OprdLen = 0;
-  Expression::SPType spOprd = __DecodeModRmAddress(&m_CpuInfo, rBinStrm, Offset, rInsn, OprdLen, static_cast<X86_Bit>(Mode));
+  Expression::SPType spOprd = __DecodeModRmAddress<Mode>(&m_CpuInfo, rBinStrm, Offset, rInsn, OprdLen);
   if (spOprd == nullptr)
     return nullptr;
 
-  auto AccessSize = __GetOperandSize(rInsn, Mode);
+  auto AccessSize = __GetOperandSize<Mode>(rInsn);
   if (AccessSize == 0)
     return nullptr;
 
@@ -1100,11 +1207,12 @@ Expression::SPType X86Architecture::__Decode_Mv(BinaryStream const& rBinStrm, Of
   return Expr::MakeMem(AccessSize, __GetSegmentRegister(&m_CpuInfo, rInsn), spOprd);
 }
 
-Expression::SPType X86Architecture::__Decode_Mw(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+Expression::SPType X86Architecture::__Decode_Mw(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   ++rInsn.Size();
   u8 OprdLen = 0;
-  Expression::SPType spOprd = __DecodeModRmAddress(&m_CpuInfo, rBinStrm, Offset, rInsn, OprdLen, static_cast<X86_Bit>(Mode));
+  Expression::SPType spOprd = __DecodeModRmAddress<Mode>(&m_CpuInfo, rBinStrm, Offset, rInsn, OprdLen);
   if (spOprd == nullptr)
     return nullptr;
 
@@ -1113,20 +1221,22 @@ Expression::SPType X86Architecture::__Decode_Mw(BinaryStream const& rBinStrm, Of
   return Expr::MakeMem(16, __GetSegmentRegister(&m_CpuInfo, rInsn), spOprd);
 }
 
-Expression::SPType X86Architecture::__Decode_Mx(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+Expression::SPType X86Architecture::__Decode_Mx(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   return nullptr; /* TODO */
 }
 
-Expression::SPType X86Architecture::__Decode_My(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+Expression::SPType X86Architecture::__Decode_My(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   ++rInsn.Size();
   u8 OprdLen = 0;
-  Expression::SPType spOprd = __DecodeModRmAddress(&m_CpuInfo, rBinStrm, Offset, rInsn, OprdLen, static_cast<X86_Bit>(Mode));
+  Expression::SPType spOprd = __DecodeModRmAddress<Mode>(&m_CpuInfo, rBinStrm, Offset, rInsn, OprdLen);
   if (spOprd == nullptr)
     return nullptr;
 
-  auto AccessSize = __GetOperandSize(rInsn, Mode);
+  auto AccessSize = __GetOperandSize<Mode>(rInsn);
   if (AccessSize == 0)
     return nullptr;
   // TODO:
@@ -1138,18 +1248,22 @@ Expression::SPType X86Architecture::__Decode_My(BinaryStream const& rBinStrm, Of
   return Expr::MakeMem(AccessSize, __GetSegmentRegister(&m_CpuInfo, rInsn), spOprd);
 }
 
-Expression::SPType X86Architecture::__Decode_Nq(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+Expression::SPType X86Architecture::__Decode_Nq(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
-  auto const ModRm = __GetModRm(rBinStrm, Offset);
+  x86::ModRM ModRm;
+  if (!__GetModRm(rBinStrm, Offset, ModRm))
+    return nullptr;
   if (ModRm.Mod() != 0x03)
     return nullptr;
-  return __Decode_Qq(rBinStrm, Offset, rInsn, Mode);
+  return __Decode_Qq<Mode>(rBinStrm, Offset, rInsn);
 }
 
-Expression::SPType X86Architecture::__Decode_Ob(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+Expression::SPType X86Architecture::__Decode_Ob(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   Expression::SPType spOff;
-  switch (__GetAddressSize(rInsn, Mode))
+  switch (__GetAddressSize<Mode>(rInsn))
   {
   case 16:
     {
@@ -1188,10 +1302,11 @@ Expression::SPType X86Architecture::__Decode_Ob(BinaryStream const& rBinStrm, Of
   return Expr::MakeMem(8, __GetSegmentRegister(&m_CpuInfo, rInsn), spOff);
 }
 
-Expression::SPType X86Architecture::__Decode_Ov(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+Expression::SPType X86Architecture::__Decode_Ov(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   Expression::SPType spOff;
-  switch (__GetAddressSize(rInsn, Mode))
+  switch (__GetAddressSize<Mode>(rInsn))
   {
   case 16:
     {
@@ -1227,24 +1342,30 @@ Expression::SPType X86Architecture::__Decode_Ov(BinaryStream const& rBinStrm, Of
     return nullptr;
   }
 
-  auto AccessSize = __GetOperandSize(rInsn, Mode);
+  auto AccessSize = __GetOperandSize<Mode>(rInsn);
   if (AccessSize == 0)
     return nullptr;
 
   return Expr::MakeMem(AccessSize, __GetSegmentRegister(&m_CpuInfo, rInsn), spOff);
 }
 
-Expression::SPType X86Architecture::__Decode_Pq(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+Expression::SPType X86Architecture::__Decode_Pq(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
-  auto const ModRm = __GetModRm(rBinStrm, Offset);
+  x86::ModRM ModRm;
+  if (!__GetModRm(rBinStrm, Offset, ModRm))
+    return nullptr;
   return __GetRegisterFromIndex(&m_CpuInfo, __ModRmRegister(rInsn, ModRm), s_MMX);
 }
 
-Expression::SPType X86Architecture::__Decode_Qd(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+Expression::SPType X86Architecture::__Decode_Qd(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   Expression::SPType spOprd;
   u8 OprdLen = 0;
-  auto const ModRm = __GetModRm(rBinStrm, Offset);
+  x86::ModRM ModRm;
+  if (!__GetModRm(rBinStrm, Offset, ModRm))
+    return nullptr;
 
   ++rInsn.Size();
 
@@ -1252,7 +1373,7 @@ Expression::SPType X86Architecture::__Decode_Qd(BinaryStream const& rBinStrm, Of
   {
   case 0: case 1: case 2:
     {
-      auto spOff = __DecodeModRmAddress(&m_CpuInfo, rBinStrm, Offset, rInsn, OprdLen, static_cast<X86_Bit>(Mode));
+      auto spOff = __DecodeModRmAddress<Mode>(&m_CpuInfo, rBinStrm, Offset, rInsn, OprdLen);
       if (spOff == nullptr)
         return nullptr;
       spOprd = Expr::MakeMem(32, __GetSegmentRegister(&m_CpuInfo, rInsn), spOff);
@@ -1268,11 +1389,14 @@ Expression::SPType X86Architecture::__Decode_Qd(BinaryStream const& rBinStrm, Of
   return spOprd;
 }
 
-Expression::SPType X86Architecture::__Decode_Qq(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+Expression::SPType X86Architecture::__Decode_Qq(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   Expression::SPType spOprd;
   u8 OprdLen = 0;
-  auto const ModRm = __GetModRm(rBinStrm, Offset);
+  x86::ModRM ModRm;
+  if (!__GetModRm(rBinStrm, Offset, ModRm))
+    return nullptr;
 
   ++rInsn.Size();
 
@@ -1280,7 +1404,7 @@ Expression::SPType X86Architecture::__Decode_Qq(BinaryStream const& rBinStrm, Of
   {
   case 0: case 1: case 2:
     {
-      auto spOff = __DecodeModRmAddress(&m_CpuInfo, rBinStrm, Offset, rInsn, OprdLen, static_cast<X86_Bit>(Mode));
+      auto spOff = __DecodeModRmAddress<Mode>(&m_CpuInfo, rBinStrm, Offset, rInsn, OprdLen);
       if (spOff == nullptr)
         return nullptr;
       spOprd = Expr::MakeMem(64, __GetSegmentRegister(&m_CpuInfo, rInsn), spOff);
@@ -1296,39 +1420,54 @@ Expression::SPType X86Architecture::__Decode_Qq(BinaryStream const& rBinStrm, Of
   return spOprd;
 }
 
-Expression::SPType X86Architecture::__Decode_Rv(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+Expression::SPType X86Architecture::__Decode_Rv(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
-  auto const ModRm = __GetModRm(rBinStrm, Offset);
+  x86::ModRM ModRm;
+  if (!__GetModRm(rBinStrm, Offset, ModRm))
+    return nullptr;
   if (ModRm.Mod() != 0x03)
     return nullptr;
-  return __Decode_Ev(rBinStrm, Offset, rInsn, Mode);
+  return __Decode_Ev<Mode>(rBinStrm, Offset, rInsn);
 }
 
-Expression::SPType X86Architecture::__Decode_Ry(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+Expression::SPType X86Architecture::__Decode_Ry(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
-  auto const ModRm = __GetModRm(rBinStrm, Offset);
+  x86::ModRM ModRm;
+  if (!__GetModRm(rBinStrm, Offset, ModRm))
+    return nullptr;
   if (ModRm.Mod() != 0x03)
     return nullptr;
-  return __Decode_Ey(rBinStrm, Offset, rInsn, Mode);
+  return __Decode_Ey<Mode>(rBinStrm, Offset, rInsn);
 }
 
-Expression::SPType X86Architecture::__Decode_Sw(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+Expression::SPType X86Architecture::__Decode_Sw(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
-  auto const ModRm = __GetModRm(rBinStrm, Offset);
+  x86::ModRM ModRm;
+  if (!__GetModRm(rBinStrm, Offset, ModRm))
+    return nullptr;
   return __GetRegisterFromIndex(&m_CpuInfo, __ModRmRegister(rInsn, ModRm), s_SEG);
 }
 
-Expression::SPType X86Architecture::__Decode_Ty(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+Expression::SPType X86Architecture::__Decode_Ty(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
-  auto const ModRm = __GetModRm(rBinStrm, Offset);
+  x86::ModRM ModRm;
+  if (!__GetModRm(rBinStrm, Offset, ModRm))
+    return nullptr;
   return __GetRegisterFromIndex(&m_CpuInfo, __ModRmRegister(rInsn, ModRm), s_TST);
 }
 
-Expression::SPType X86Architecture::__Decode_Uo(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+Expression::SPType X86Architecture::__Decode_Uo(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   Expression::SPType spOprd;
   u8 OprdLen = 0;
-  auto const ModRm = __GetModRm(rBinStrm, Offset);
+  x86::ModRM ModRm;
+  if (!__GetModRm(rBinStrm, Offset, ModRm))
+    return nullptr;
 
   ++rInsn.Size();
 
@@ -1336,7 +1475,7 @@ Expression::SPType X86Architecture::__Decode_Uo(BinaryStream const& rBinStrm, Of
   {
   case 0: case 1: case 2:
     {
-      auto spOff = __DecodeModRmAddress(&m_CpuInfo, rBinStrm, Offset, rInsn, OprdLen, static_cast<X86_Bit>(Mode));
+      auto spOff = __DecodeModRmAddress<Mode>(&m_CpuInfo, rBinStrm, Offset, rInsn, OprdLen);
       if (spOff == nullptr)
         return nullptr;
       spOprd = Expr::MakeMem(128, __GetSegmentRegister(&m_CpuInfo, rInsn), spOff);
@@ -1352,11 +1491,14 @@ Expression::SPType X86Architecture::__Decode_Uo(BinaryStream const& rBinStrm, Of
   return spOprd;
 }
 
-Expression::SPType X86Architecture::__Decode_Uod(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+Expression::SPType X86Architecture::__Decode_Uod(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   Expression::SPType spOprd;
   u8 OprdLen = 0;
-  auto const ModRm = __GetModRm(rBinStrm, Offset);
+  x86::ModRM ModRm;
+  if (!__GetModRm(rBinStrm, Offset, ModRm))
+    return nullptr;
 
   ++rInsn.Size();
 
@@ -1364,7 +1506,7 @@ Expression::SPType X86Architecture::__Decode_Uod(BinaryStream const& rBinStrm, O
   {
   case 0: case 1: case 2:
     {
-      auto spOff = __DecodeModRmAddress(&m_CpuInfo, rBinStrm, Offset, rInsn, OprdLen, static_cast<X86_Bit>(Mode));
+      auto spOff = __DecodeModRmAddress<Mode>(&m_CpuInfo, rBinStrm, Offset, rInsn, OprdLen);
       if (spOff == nullptr)
         return nullptr;
       spOprd = Expr::MakeMem(32, __GetSegmentRegister(&m_CpuInfo, rInsn), spOff);
@@ -1380,11 +1522,14 @@ Expression::SPType X86Architecture::__Decode_Uod(BinaryStream const& rBinStrm, O
   return spOprd;
 }
 
-Expression::SPType X86Architecture::__Decode_Uoq(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+Expression::SPType X86Architecture::__Decode_Uoq(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   Expression::SPType spOprd;
   u8 OprdLen = 0;
-  auto const ModRm = __GetModRm(rBinStrm, Offset);
+  x86::ModRM ModRm;
+  if (!__GetModRm(rBinStrm, Offset, ModRm))
+    return nullptr;
 
   ++rInsn.Size();
 
@@ -1392,7 +1537,7 @@ Expression::SPType X86Architecture::__Decode_Uoq(BinaryStream const& rBinStrm, O
   {
   case 0: case 1: case 2:
   {
-    auto spOff = __DecodeModRmAddress(&m_CpuInfo, rBinStrm, Offset, rInsn, OprdLen, static_cast<X86_Bit>(Mode));
+    auto spOff = __DecodeModRmAddress<Mode>(&m_CpuInfo, rBinStrm, Offset, rInsn, OprdLen);
     if (spOff == nullptr)
       return nullptr;
     spOprd = Expr::MakeMem(64, __GetSegmentRegister(&m_CpuInfo, rInsn), spOff);
@@ -1408,11 +1553,14 @@ Expression::SPType X86Architecture::__Decode_Uoq(BinaryStream const& rBinStrm, O
   return spOprd;
 }
 
-Expression::SPType X86Architecture::__Decode_Uq(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+Expression::SPType X86Architecture::__Decode_Uq(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   Expression::SPType spOprd;
   u8 OprdLen = 0;
-  auto const ModRm = __GetModRm(rBinStrm, Offset);
+  x86::ModRM ModRm;
+  if (!__GetModRm(rBinStrm, Offset, ModRm))
+    return nullptr;
 
   ++rInsn.Size();
 
@@ -1420,7 +1568,7 @@ Expression::SPType X86Architecture::__Decode_Uq(BinaryStream const& rBinStrm, Of
   {
   case 0: case 1: case 2:
     {
-      auto spOff = __DecodeModRmAddress(&m_CpuInfo, rBinStrm, Offset, rInsn, OprdLen, static_cast<X86_Bit>(Mode));
+      auto spOff = __DecodeModRmAddress<Mode>(&m_CpuInfo, rBinStrm, Offset, rInsn, OprdLen);
       if (spOff == nullptr)
         return nullptr;
       spOprd = Expr::MakeMem(64, __GetSegmentRegister(&m_CpuInfo, rInsn), spOff);
@@ -1436,56 +1584,80 @@ Expression::SPType X86Architecture::__Decode_Uq(BinaryStream const& rBinStrm, Of
   return spOprd;
 }
 
-Expression::SPType X86Architecture::__Decode_Ux(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+Expression::SPType X86Architecture::__Decode_Ux(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
-  auto const ModRm = __GetModRm(rBinStrm, Offset);
+  x86::ModRM ModRm;
+  if (!__GetModRm(rBinStrm, Offset, ModRm))
+    return nullptr;
   if (ModRm.Mod() != 0x03)
     return nullptr;
-  return __Decode_Wx(rBinStrm, Offset, rInsn, Mode);
+  return __Decode_Wx<Mode>(rBinStrm, Offset, rInsn);
 }
 
-Expression::SPType X86Architecture::__Decode_Vo(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+Expression::SPType X86Architecture::__Decode_Vo(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
-  auto const ModRm = __GetModRm(rBinStrm, Offset);
+  x86::ModRM ModRm;
+  if (!__GetModRm(rBinStrm, Offset, ModRm))
+    return nullptr;
   return __GetRegisterFromIndex(&m_CpuInfo, __ModRmRegister(rInsn, ModRm), s_XMM);
 }
 
-Expression::SPType X86Architecture::__Decode_Vod(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+Expression::SPType X86Architecture::__Decode_Vod(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
-  auto const ModRm = __GetModRm(rBinStrm, Offset);
+  x86::ModRM ModRm;
+  if (!__GetModRm(rBinStrm, Offset, ModRm))
+    return nullptr;
   return __GetRegisterFromIndex(&m_CpuInfo, __ModRmRegister(rInsn, ModRm), s_XMM);
 }
 
-Expression::SPType X86Architecture::__Decode_Voq(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+Expression::SPType X86Architecture::__Decode_Voq(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
-  auto const ModRm = __GetModRm(rBinStrm, Offset);
+  x86::ModRM ModRm;
+  if (!__GetModRm(rBinStrm, Offset, ModRm))
+    return nullptr;
   return __GetRegisterFromIndex(&m_CpuInfo, __ModRmRegister(rInsn, ModRm), s_XMM);
 }
 
-Expression::SPType X86Architecture::__Decode_Vx(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+Expression::SPType X86Architecture::__Decode_Vx(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   /* TODO: Handle YMM register here */
-  auto const ModRm = __GetModRm(rBinStrm, Offset);
+  x86::ModRM ModRm;
+  if (!__GetModRm(rBinStrm, Offset, ModRm))
+    return nullptr;
   return __GetRegisterFromIndex(&m_CpuInfo, __ModRmRegister(rInsn, ModRm), s_XMM);
 }
 
-Expression::SPType X86Architecture::__Decode_Vy(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+Expression::SPType X86Architecture::__Decode_Vy(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
-  auto const ModRm = __GetModRm(rBinStrm, Offset);
+  x86::ModRM ModRm;
+  if (!__GetModRm(rBinStrm, Offset, ModRm))
+    return nullptr;
   return __GetRegisterFromIndex(&m_CpuInfo, __ModRmRegister(rInsn, ModRm), s_XMM);
 }
 
-Expression::SPType X86Architecture::__Decode_Wd(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+Expression::SPType X86Architecture::__Decode_Wd(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
-  auto const ModRm = __GetModRm(rBinStrm, Offset);
+  x86::ModRM ModRm;
+  if (!__GetModRm(rBinStrm, Offset, ModRm))
+    return nullptr;
   return __GetRegisterFromIndex(&m_CpuInfo, __ModRmRegister(rInsn, ModRm), s_XMM);
 }
 
-Expression::SPType X86Architecture::__Decode_Wo(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+Expression::SPType X86Architecture::__Decode_Wo(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   Expression::SPType spOprd;
   u8 OprdLen = 0;
-  auto const ModRm = __GetModRm(rBinStrm, Offset);
+  x86::ModRM ModRm;
+  if (!__GetModRm(rBinStrm, Offset, ModRm))
+    return nullptr;
 
   ++rInsn.Size();
 
@@ -1493,7 +1665,7 @@ Expression::SPType X86Architecture::__Decode_Wo(BinaryStream const& rBinStrm, Of
   {
   case 0: case 1: case 2:
     {
-      auto spOff = __DecodeModRmAddress(&m_CpuInfo, rBinStrm, Offset, rInsn, OprdLen, static_cast<X86_Bit>(Mode));
+      auto spOff = __DecodeModRmAddress<Mode>(&m_CpuInfo, rBinStrm, Offset, rInsn, OprdLen);
       if (spOff == nullptr)
         return nullptr;
       spOprd = Expr::MakeMem(128, __GetSegmentRegister(&m_CpuInfo, rInsn), spOff);
@@ -1509,11 +1681,14 @@ Expression::SPType X86Architecture::__Decode_Wo(BinaryStream const& rBinStrm, Of
   return spOprd;
 }
 
-Expression::SPType X86Architecture::__Decode_Wob(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+Expression::SPType X86Architecture::__Decode_Wob(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   Expression::SPType spOprd;
   u8 OprdLen = 0;
-  auto const ModRm = __GetModRm(rBinStrm, Offset);
+  x86::ModRM ModRm;
+  if (!__GetModRm(rBinStrm, Offset, ModRm))
+    return nullptr;
 
   ++rInsn.Size();
 
@@ -1521,7 +1696,7 @@ Expression::SPType X86Architecture::__Decode_Wob(BinaryStream const& rBinStrm, O
   {
   case 0: case 1: case 2:
     {
-      auto spOff = __DecodeModRmAddress(&m_CpuInfo, rBinStrm, Offset, rInsn, OprdLen, static_cast<X86_Bit>(Mode));
+      auto spOff = __DecodeModRmAddress<Mode>(&m_CpuInfo, rBinStrm, Offset, rInsn, OprdLen);
       if (spOff == nullptr)
         return nullptr;
       spOprd = Expr::MakeMem(8, __GetSegmentRegister(&m_CpuInfo, rInsn), spOff);
@@ -1537,11 +1712,14 @@ Expression::SPType X86Architecture::__Decode_Wob(BinaryStream const& rBinStrm, O
   return spOprd;
 }
 
-Expression::SPType X86Architecture::__Decode_Wod(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+Expression::SPType X86Architecture::__Decode_Wod(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   Expression::SPType spOprd;
   u8 OprdLen = 0;
-  auto const ModRm = __GetModRm(rBinStrm, Offset);
+  x86::ModRM ModRm;
+  if (!__GetModRm(rBinStrm, Offset, ModRm))
+    return nullptr;
 
   ++rInsn.Size();
 
@@ -1549,7 +1727,7 @@ Expression::SPType X86Architecture::__Decode_Wod(BinaryStream const& rBinStrm, O
   {
   case 0: case 1: case 2:
     {
-      auto spOff = __DecodeModRmAddress(&m_CpuInfo, rBinStrm, Offset, rInsn, OprdLen, static_cast<X86_Bit>(Mode));
+      auto spOff = __DecodeModRmAddress<Mode>(&m_CpuInfo, rBinStrm, Offset, rInsn, OprdLen);
       if (spOff == nullptr)
         return nullptr;
       spOprd = Expr::MakeMem(32, __GetSegmentRegister(&m_CpuInfo, rInsn), spOff);
@@ -1566,11 +1744,14 @@ Expression::SPType X86Architecture::__Decode_Wod(BinaryStream const& rBinStrm, O
 }
 
 // NOTE: What's the different between Wo.o and Wo?
-Expression::SPType X86Architecture::__Decode_Woo(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+Expression::SPType X86Architecture::__Decode_Woo(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   Expression::SPType spOprd;
   u8 OprdLen = 0;
-  auto const ModRm = __GetModRm(rBinStrm, Offset);
+  x86::ModRM ModRm;
+  if (!__GetModRm(rBinStrm, Offset, ModRm))
+    return nullptr;
 
   ++rInsn.Size();
 
@@ -1578,7 +1759,7 @@ Expression::SPType X86Architecture::__Decode_Woo(BinaryStream const& rBinStrm, O
   {
   case 0: case 1: case 2:
     {
-      auto spOff = __DecodeModRmAddress(&m_CpuInfo, rBinStrm, Offset, rInsn, OprdLen, static_cast<X86_Bit>(Mode));
+      auto spOff = __DecodeModRmAddress<Mode>(&m_CpuInfo, rBinStrm, Offset, rInsn, OprdLen);
       if (spOff == nullptr)
         return nullptr;
       spOprd = Expr::MakeMem(128, __GetSegmentRegister(&m_CpuInfo, rInsn), spOff);
@@ -1594,11 +1775,14 @@ Expression::SPType X86Architecture::__Decode_Woo(BinaryStream const& rBinStrm, O
   return spOprd;
 }
 
-Expression::SPType X86Architecture::__Decode_Woq(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+Expression::SPType X86Architecture::__Decode_Woq(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   Expression::SPType spOprd;
   u8 OprdLen = 0;
-  auto const ModRm = __GetModRm(rBinStrm, Offset);
+  x86::ModRM ModRm;
+  if (!__GetModRm(rBinStrm, Offset, ModRm))
+    return nullptr;
 
   ++rInsn.Size();
 
@@ -1606,7 +1790,7 @@ Expression::SPType X86Architecture::__Decode_Woq(BinaryStream const& rBinStrm, O
   {
   case 0: case 1: case 2:
     {
-      auto spOff = __DecodeModRmAddress(&m_CpuInfo, rBinStrm, Offset, rInsn, OprdLen, static_cast<X86_Bit>(Mode));
+      auto spOff = __DecodeModRmAddress<Mode>(&m_CpuInfo, rBinStrm, Offset, rInsn, OprdLen);
       if (spOff == nullptr)
         return nullptr;
       spOprd = Expr::MakeMem(64, __GetSegmentRegister(&m_CpuInfo, rInsn), spOff);
@@ -1622,16 +1806,20 @@ Expression::SPType X86Architecture::__Decode_Woq(BinaryStream const& rBinStrm, O
   return spOprd;
 }
 
-Expression::SPType X86Architecture::__Decode_Woqo(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+Expression::SPType X86Architecture::__Decode_Woqo(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   return nullptr; /* TODO */
 }
 
-Expression::SPType X86Architecture::__Decode_Wow(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+Expression::SPType X86Architecture::__Decode_Wow(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   Expression::SPType spOprd;
   u8 OprdLen = 0;
-  auto const ModRm = __GetModRm(rBinStrm, Offset);
+  x86::ModRM ModRm;
+  if (!__GetModRm(rBinStrm, Offset, ModRm))
+    return nullptr;
 
   ++rInsn.Size();
 
@@ -1639,7 +1827,7 @@ Expression::SPType X86Architecture::__Decode_Wow(BinaryStream const& rBinStrm, O
   {
   case 0: case 1: case 2:
     {
-      auto spOff = __DecodeModRmAddress(&m_CpuInfo, rBinStrm, Offset, rInsn, OprdLen, static_cast<X86_Bit>(Mode));
+      auto spOff = __DecodeModRmAddress<Mode>(&m_CpuInfo, rBinStrm, Offset, rInsn, OprdLen);
       if (spOff == nullptr)
         return nullptr;
       spOprd = Expr::MakeMem(16, __GetSegmentRegister(&m_CpuInfo, rInsn), spOff);
@@ -1655,16 +1843,20 @@ Expression::SPType X86Architecture::__Decode_Wow(BinaryStream const& rBinStrm, O
   return spOprd;
 }
 
-Expression::SPType X86Architecture::__Decode_Wq(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+Expression::SPType X86Architecture::__Decode_Wq(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   return nullptr; /* TODO */
 }
 
-Expression::SPType X86Architecture::__Decode_Wx(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+Expression::SPType X86Architecture::__Decode_Wx(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   Expression::SPType spOprd;
   u8 OprdLen = 0;
-  auto const ModRm = __GetModRm(rBinStrm, Offset);
+  x86::ModRM ModRm;
+  if (!__GetModRm(rBinStrm, Offset, ModRm))
+    return nullptr;
 
   ++rInsn.Size();
 
@@ -1672,7 +1864,7 @@ Expression::SPType X86Architecture::__Decode_Wx(BinaryStream const& rBinStrm, Of
   {
   case 0: case 1: case 2:
     {
-      auto spOff = __DecodeModRmAddress(&m_CpuInfo, rBinStrm, Offset, rInsn, OprdLen, static_cast<X86_Bit>(Mode));
+      auto spOff = __DecodeModRmAddress<Mode>(&m_CpuInfo, rBinStrm, Offset, rInsn, OprdLen);
       if (spOff == nullptr)
         return nullptr;
       spOprd = Expr::MakeMem(128, __GetSegmentRegister(&m_CpuInfo, rInsn), spOff);
@@ -1688,62 +1880,156 @@ Expression::SPType X86Architecture::__Decode_Wx(BinaryStream const& rBinStrm, Of
   return spOprd;
 }
 
-Expression::SPType X86Architecture::__Decode_Wy(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+Expression::SPType X86Architecture::__Decode_Wy(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   return nullptr; /* TODO */
 }
 
-Expression::SPType X86Architecture::__Decode_b(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+Expression::SPType X86Architecture::__Decode_b(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   return nullptr; /* TODO */
 }
 
-Expression::SPType X86Architecture::__Decode_m16int(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+Expression::SPType X86Architecture::__Decode_m16int(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   return nullptr; /* TODO */
 }
 
-Expression::SPType X86Architecture::__Decode_m32fp(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+Expression::SPType X86Architecture::__Decode_m32fp(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   return nullptr; /* TODO */
 }
 
-Expression::SPType X86Architecture::__Decode_m32int(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+Expression::SPType X86Architecture::__Decode_m32int(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   return nullptr; /* TODO */
 }
 
-Expression::SPType X86Architecture::__Decode_m64fp(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+Expression::SPType X86Architecture::__Decode_m64fp(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   return nullptr; /* TODO */
 }
 
-Expression::SPType X86Architecture::__Decode_m64int(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+Expression::SPType X86Architecture::__Decode_m64int(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   return nullptr; /* TODO */
 }
 
-Expression::SPType X86Architecture::__Decode_m80bcd(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+Expression::SPType X86Architecture::__Decode_m80bcd(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   return nullptr; /* TODO */
 }
 
-Expression::SPType X86Architecture::__Decode_m80dec(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+Expression::SPType X86Architecture::__Decode_m80dec(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   return nullptr; /* TODO */
 }
 
-Expression::SPType X86Architecture::__Decode_m80fp(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+Expression::SPType X86Architecture::__Decode_m80fp(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   return nullptr; /* TODO */
 }
 
-Expression::SPType X86Architecture::__Decode_w(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+Expression::SPType X86Architecture::__Decode_w(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   return nullptr; /* TODO */
 }
 
-Expression::SPType X86Architecture::__Decode_x(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+Expression::SPType X86Architecture::__Decode_x(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   return nullptr; /* TODO */
-}
\ No newline at end of file
+}
+
+X86_INSTANTIATE_DECODER(__Decode_Ap);
+X86_INSTANTIATE_DECODER(__Decode_By);
+X86_INSTANTIATE_DECODER(__Decode_Cy);
+X86_INSTANTIATE_DECODER(__Decode_Dy);
+X86_INSTANTIATE_DECODER(__Decode_Eb);
+X86_INSTANTIATE_DECODER(__Decode_Ed);
+X86_INSTANTIATE_DECODER(__Decode_Edb);
+X86_INSTANTIATE_DECODER(__Decode_Eq);
+X86_INSTANTIATE_DECODER(__Decode_Ev);
+X86_INSTANTIATE_DECODER(__Decode_Ew);
+X86_INSTANTIATE_DECODER(__Decode_Ey);
+X86_INSTANTIATE_DECODER(__Decode_Eyb);
+X86_INSTANTIATE_DECODER(__Decode_Eyw);
+X86_INSTANTIATE_DECODER(__Decode_Gb);
+X86_INSTANTIATE_DECODER(__Decode_Gw);
+X86_INSTANTIATE_DECODER(__Decode_Gd);
+X86_INSTANTIATE_DECODER(__Decode_Gq);
+X86_INSTANTIATE_DECODER(__Decode_Gv);
+X86_INSTANTIATE_DECODER(__Decode_Gy);
+X86_INSTANTIATE_DECODER(__Decode_Ho);
+X86_INSTANTIATE_DECODER(__Decode_Hx);
+X86_INSTANTIATE_DECODER(__Decode_Hy);
+X86_INSTANTIATE_DECODER(__Decode_Ibs);
+X86_INSTANTIATE_DECODER(__Decode_Jb);
+X86_INSTANTIATE_DECODER(__Decode_Jz);
+X86_INSTANTIATE_DECODER(__Decode_Lx);
+X86_INSTANTIATE_DECODER(__Decode_M);
+X86_INSTANTIATE_DECODER(__Decode_Ma);
+X86_INSTANTIATE_DECODER(__Decode_Md);
+X86_INSTANTIATE_DECODER(__Decode_Mo);
+X86_INSTANTIATE_DECODER(__Decode_Mod);
+X86_INSTANTIATE_DECODER(__Decode_Moq);
+X86_INSTANTIATE_DECODER(__Decode_Mp);
+X86_INSTANTIATE_DECODER(__Decode_Mq);
+X86_INSTANTIATE_DECODER(__Decode_Mqo);
+X86_INSTANTIATE_DECODER(__Decode_Mv);
+X86_INSTANTIATE_DECODER(__Decode_Mw);
+X86_INSTANTIATE_DECODER(__Decode_Mx);
+X86_INSTANTIATE_DECODER(__Decode_My);
+X86_INSTANTIATE_DECODER(__Decode_Nq);
+X86_INSTANTIATE_DECODER(__Decode_Ob);
+X86_INSTANTIATE_DECODER(__Decode_Ov);
+X86_INSTANTIATE_DECODER(__Decode_Pq);
+X86_INSTANTIATE_DECODER(__Decode_Qd);
+X86_INSTANTIATE_DECODER(__Decode_Qq);
+X86_INSTANTIATE_DECODER(__Decode_Rv);
+X86_INSTANTIATE_DECODER(__Decode_Ry);
+X86_INSTANTIATE_DECODER(__Decode_Sw);
+X86_INSTANTIATE_DECODER(__Decode_Ty);
+X86_INSTANTIATE_DECODER(__Decode_Uo);
+X86_INSTANTIATE_DECODER(__Decode_Uod);
+X86_INSTANTIATE_DECODER(__Decode_Uoq);
+X86_INSTANTIATE_DECODER(__Decode_Uq);
+X86_INSTANTIATE_DECODER(__Decode_Ux);
+X86_INSTANTIATE_DECODER(__Decode_Vo);
+X86_INSTANTIATE_DECODER(__Decode_Vod);
+X86_INSTANTIATE_DECODER(__Decode_Voq);
+X86_INSTANTIATE_DECODER(__Decode_Vx);
+X86_INSTANTIATE_DECODER(__Decode_Vy);
+X86_INSTANTIATE_DECODER(__Decode_Wd);
+X86_INSTANTIATE_DECODER(__Decode_Wo);
+X86_INSTANTIATE_DECODER(__Decode_Wob);
+X86_INSTANTIATE_DECODER(__Decode_Wod);
+X86_INSTANTIATE_DECODER(__Decode_Woo);
+X86_INSTANTIATE_DECODER(__Decode_Woq);
+X86_INSTANTIATE_DECODER(__Decode_Woqo);
+X86_INSTANTIATE_DECODER(__Decode_Wow);
+X86_INSTANTIATE_DECODER(__Decode_Wq);
+X86_INSTANTIATE_DECODER(__Decode_Wx);
+X86_INSTANTIATE_DECODER(__Decode_Wy);
+X86_INSTANTIATE_DECODER(__Decode_b);
+X86_INSTANTIATE_DECODER(__Decode_m16int);
+X86_INSTANTIATE_DECODER(__Decode_m32fp);
+X86_INSTANTIATE_DECODER(__Decode_m32int);
+X86_INSTANTIATE_DECODER(__Decode_m64fp);
+X86_INSTANTIATE_DECODER(__Decode_m64int);
+X86_INSTANTIATE_DECODER(__Decode_m80bcd);
+X86_INSTANTIATE_DECODER(__Decode_m80dec);
+X86_INSTANTIATE_DECODER(__Decode_m80fp);
+X86_INSTANTIATE_DECODER(__Decode_w);
+X86_INSTANTIATE_DECODER(__Decode_x);
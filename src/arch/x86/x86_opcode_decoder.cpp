@@ -0,0 +1,5113 @@
+/* This file has been automatically generated, you must _NOT_ edit it directly. (Sun Oct 18 18:46:50 2026) */
+#include "x86_architecture.hpp"
+template<u8 Mode>
+const X86Architecture::TDisassembler X86Architecture::DecodeTable<Mode>::m_Handler[0x240] =
+{
+  &X86Architecture::Table_1_06<Mode>,
+  &X86Architecture::Table_1_07<Mode>,
+  &X86Architecture::Table_1_0e<Mode>,
+  &X86Architecture::Table_1_0f<Mode>,
+  &X86Architecture::Table_1_16<Mode>,
+  &X86Architecture::Table_1_17<Mode>,
+  &X86Architecture::Table_1_1e<Mode>,
+  &X86Architecture::Table_1_1f<Mode>,
+  &X86Architecture::Table_1_26<Mode>,
+  &X86Architecture::Table_1_27<Mode>,
+  &X86Architecture::Table_1_2e<Mode>,
+  &X86Architecture::Table_1_2f<Mode>,
+  &X86Architecture::Table_1_36<Mode>,
+  &X86Architecture::Table_1_3e<Mode>,
+  &X86Architecture::Table_1_3f<Mode>,
+  &X86Architecture::Table_1_40<Mode>,
+  &X86Architecture::Table_1_41<Mode>,
+  &X86Architecture::Table_1_42<Mode>,
+  &X86Architecture::Table_1_43<Mode>,
+  &X86Architecture::Table_1_44<Mode>,
+  &X86Architecture::Table_1_45<Mode>,
+  &X86Architecture::Table_1_46<Mode>,
+  &X86Architecture::Table_1_47<Mode>,
+  &X86Architecture::Table_1_48<Mode>,
+  &X86Architecture::Table_1_49<Mode>,
+  &X86Architecture::Table_1_4a<Mode>,
+  &X86Architecture::Table_1_4b<Mode>,
+  &X86Architecture::Table_1_4c<Mode>,
+  &X86Architecture::Table_1_4d<Mode>,
+  &X86Architecture::Table_1_4e<Mode>,
+  &X86Architecture::Table_1_4f<Mode>,
+  &X86Architecture::Table_1_50<Mode>,
+  &X86Architecture::Table_1_51<Mode>,
+  &X86Architecture::Table_1_52<Mode>,
+  &X86Architecture::Table_1_53<Mode>,
+  &X86Architecture::Table_1_54<Mode>,
+  &X86Architecture::Table_1_55<Mode>,
+  &X86Architecture::Table_1_56<Mode>,
+  &X86Architecture::Table_1_57<Mode>,
+  &X86Architecture::Table_1_58<Mode>,
+  &X86Architecture::Table_1_59<Mode>,
+  &X86Architecture::Table_1_5a<Mode>,
+  &X86Architecture::Table_1_5b<Mode>,
+  &X86Architecture::Table_1_5c<Mode>,
+  &X86Architecture::Table_1_5d<Mode>,
+  &X86Architecture::Table_1_5e<Mode>,
+  &X86Architecture::Table_1_5f<Mode>,
+  &X86Architecture::Table_1_60<Mode>,
+  &X86Architecture::Table_1_61<Mode>,
+  &X86Architecture::Table_1_62<Mode>,
+  &X86Architecture::Table_1_63<Mode>,
+  &X86Architecture::Table_1_64<Mode>,
+  &X86Architecture::Table_1_65<Mode>,
+  &X86Architecture::Table_1_66<Mode>,
+  &X86Architecture::Table_1_67<Mode>,
+  &X86Architecture::Table_1_68<Mode>,
+  &X86Architecture::Table_1_69<Mode>,
+  &X86Architecture::Table_1_6a<Mode>,
+  &X86Architecture::Table_1_6b<Mode>,
+  &X86Architecture::Table_1_6c<Mode>,
+  &X86Architecture::Table_1_6d<Mode>,
+  &X86Architecture::Table_1_6e<Mode>,
+  &X86Architecture::Table_1_6f<Mode>,
+  &X86Architecture::Table_1_80<Mode>,
+  &X86Architecture::Table_1_81<Mode>,
+  &X86Architecture::Table_1_82<Mode>,
+  &X86Architecture::Table_1_83<Mode>,
+  &X86Architecture::Table_1_8f<Mode>,
+  &X86Architecture::Table_1_90<Mode>,
+  &X86Architecture::Table_1_91<Mode>,
+  &X86Architecture::Table_1_92<Mode>,
+  &X86Architecture::Table_1_93<Mode>,
+  &X86Architecture::Table_1_94<Mode>,
+  &X86Architecture::Table_1_95<Mode>,
+  &X86Architecture::Table_1_96<Mode>,
+  &X86Architecture::Table_1_97<Mode>,
+  &X86Architecture::Table_1_98<Mode>,
+  &X86Architecture::Table_1_99<Mode>,
+  &X86Architecture::Table_1_9a<Mode>,
+  &X86Architecture::Table_1_b0<Mode>,
+  &X86Architecture::Table_1_b1<Mode>,
+  &X86Architecture::Table_1_b2<Mode>,
+  &X86Architecture::Table_1_b3<Mode>,
+  &X86Architecture::Table_1_b4<Mode>,
+  &X86Architecture::Table_1_b5<Mode>,
+  &X86Architecture::Table_1_b6<Mode>,
+  &X86Architecture::Table_1_b7<Mode>,
+  &X86Architecture::Table_1_b8<Mode>,
+  &X86Architecture::Table_1_b9<Mode>,
+  &X86Architecture::Table_1_ba<Mode>,
+  &X86Architecture::Table_1_bb<Mode>,
+  &X86Architecture::Table_1_bc<Mode>,
+  &X86Architecture::Table_1_bd<Mode>,
+  &X86Architecture::Table_1_be<Mode>,
+  &X86Architecture::Table_1_bf<Mode>,
+  &X86Architecture::Table_1_c0<Mode>,
+  &X86Architecture::Table_1_c1<Mode>,
+  &X86Architecture::Table_1_c4<Mode>,
+  &X86Architecture::Table_1_c5<Mode>,
+  &X86Architecture::Table_1_c6<Mode>,
+  &X86Architecture::Table_1_c7<Mode>,
+  &X86Architecture::Table_1_c8<Mode>,
+  &X86Architecture::Table_1_c9<Mode>,
+  &X86Architecture::Table_1_ce<Mode>,
+  &X86Architecture::Table_1_d0<Mode>,
+  &X86Architecture::Table_1_d1<Mode>,
+  &X86Architecture::Table_1_d2<Mode>,
+  &X86Architecture::Table_1_d3<Mode>,
+  &X86Architecture::Table_1_d4<Mode>,
+  &X86Architecture::Table_1_d5<Mode>,
+  &X86Architecture::Table_1_d6<Mode>,
+  &X86Architecture::Table_1_d8<Mode>,
+  &X86Architecture::Table_1_d9<Mode>,
+  &X86Architecture::Table_1_da<Mode>,
+  &X86Architecture::Table_1_db<Mode>,
+  &X86Architecture::Table_1_dc<Mode>,
+  &X86Architecture::Table_1_dd<Mode>,
+  &X86Architecture::Table_1_de<Mode>,
+  &X86Architecture::Table_1_df<Mode>,
+  &X86Architecture::Table_1_e3<Mode>,
+  &X86Architecture::Table_1_ea<Mode>,
+  &X86Architecture::Table_1_f0<Mode>,
+  &X86Architecture::Table_1_f2<Mode>,
+  &X86Architecture::Table_1_f3<Mode>,
+  &X86Architecture::Table_1_f6<Mode>,
+  &X86Architecture::Table_1_f7<Mode>,
+  &X86Architecture::Table_1_fe<Mode>,
+  &X86Architecture::Table_1_ff<Mode>,
+  &X86Architecture::Table_2_00<Mode>,
+  &X86Architecture::Table_2_01<Mode>,
+  &X86Architecture::Table_2_04<Mode>,
+  &X86Architecture::Table_2_05<Mode>,
+  &X86Architecture::Table_2_07<Mode>,
+  &X86Architecture::Table_2_08<Mode>,
+  &X86Architecture::Table_2_09<Mode>,
+  &X86Architecture::Table_2_0b<Mode>,
+  &X86Architecture::Table_2_0d<Mode>,
+  &X86Architecture::Table_2_0e<Mode>,
+  &X86Architecture::Table_2_0f<Mode>,
+  &X86Architecture::Table_2_10<Mode>,
+  &X86Architecture::Table_2_11<Mode>,
+  &X86Architecture::Table_2_12<Mode>,
+  &X86Architecture::Table_2_13<Mode>,
+  &X86Architecture::Table_2_14<Mode>,
+  &X86Architecture::Table_2_15<Mode>,
+  &X86Architecture::Table_2_16<Mode>,
+  &X86Architecture::Table_2_17<Mode>,
+  &X86Architecture::Table_2_18<Mode>,
+  &X86Architecture::Table_2_19<Mode>,
+  &X86Architecture::Table_2_1a<Mode>,
+  &X86Architecture::Table_2_1b<Mode>,
+  &X86Architecture::Table_2_1c<Mode>,
+  &X86Architecture::Table_2_1d<Mode>,
+  &X86Architecture::Table_2_1e<Mode>,
+  &X86Architecture::Table_2_1f<Mode>,
+  &X86Architecture::Table_2_20<Mode>,
+  &X86Architecture::Table_2_21<Mode>,
+  &X86Architecture::Table_2_22<Mode>,
+  &X86Architecture::Table_2_23<Mode>,
+  &X86Architecture::Table_2_24<Mode>,
+  &X86Architecture::Table_2_25<Mode>,
+  &X86Architecture::Table_2_26<Mode>,
+  &X86Architecture::Table_2_28<Mode>,
+  &X86Architecture::Table_2_29<Mode>,
+  &X86Architecture::Table_2_2a<Mode>,
+  &X86Architecture::Table_2_2b<Mode>,
+  &X86Architecture::Table_2_2c<Mode>,
+  &X86Architecture::Table_2_2d<Mode>,
+  &X86Architecture::Table_2_2e<Mode>,
+  &X86Architecture::Table_2_2f<Mode>,
+  &X86Architecture::Table_2_34<Mode>,
+  &X86Architecture::Table_2_35<Mode>,
+  &X86Architecture::Table_2_36<Mode>,
+  &X86Architecture::Table_2_37<Mode>,
+  &X86Architecture::Table_2_38<Mode>,
+  &X86Architecture::Table_2_39<Mode>,
+  &X86Architecture::Table_2_3a<Mode>,
+  &X86Architecture::Table_2_3b<Mode>,
+  &X86Architecture::Table_2_3c<Mode>,
+  &X86Architecture::Table_2_3d<Mode>,
+  &X86Architecture::Table_2_3f<Mode>,
+  &X86Architecture::Table_2_50<Mode>,
+  &X86Architecture::Table_2_51<Mode>,
+  &X86Architecture::Table_2_52<Mode>,
+  &X86Architecture::Table_2_53<Mode>,
+  &X86Architecture::Table_2_54<Mode>,
+  &X86Architecture::Table_2_55<Mode>,
+  &X86Architecture::Table_2_56<Mode>,
+  &X86Architecture::Table_2_57<Mode>,
+  &X86Architecture::Table_2_58<Mode>,
+  &X86Architecture::Table_2_59<Mode>,
+  &X86Architecture::Table_2_5a<Mode>,
+  &X86Architecture::Table_2_5b<Mode>,
+  &X86Architecture::Table_2_5c<Mode>,
+  &X86Architecture::Table_2_5d<Mode>,
+  &X86Architecture::Table_2_5e<Mode>,
+  &X86Architecture::Table_2_5f<Mode>,
+  &X86Architecture::Table_2_60<Mode>,
+  &X86Architecture::Table_2_61<Mode>,
+  &X86Architecture::Table_2_62<Mode>,
+  &X86Architecture::Table_2_63<Mode>,
+  &X86Architecture::Table_2_64<Mode>,
+  &X86Architecture::Table_2_65<Mode>,
+  &X86Architecture::Table_2_66<Mode>,
+  &X86Architecture::Table_2_67<Mode>,
+  &X86Architecture::Table_2_68<Mode>,
+  &X86Architecture::Table_2_69<Mode>,
+  &X86Architecture::Table_2_6a<Mode>,
+  &X86Architecture::Table_2_6b<Mode>,
+  &X86Architecture::Table_2_6c<Mode>,
+  &X86Architecture::Table_2_6d<Mode>,
+  &X86Architecture::Table_2_6e<Mode>,
+  &X86Architecture::Table_2_6f<Mode>,
+  &X86Architecture::Table_2_70<Mode>,
+  &X86Architecture::Table_2_71<Mode>,
+  &X86Architecture::Table_2_72<Mode>,
+  &X86Architecture::Table_2_73<Mode>,
+  &X86Architecture::Table_2_74<Mode>,
+  &X86Architecture::Table_2_75<Mode>,
+  &X86Architecture::Table_2_76<Mode>,
+  &X86Architecture::Table_2_77<Mode>,
+  &X86Architecture::Table_2_78<Mode>,
+  &X86Architecture::Table_2_79<Mode>,
+  &X86Architecture::Table_2_7a<Mode>,
+  &X86Architecture::Table_2_7b<Mode>,
+  &X86Architecture::Table_2_7c<Mode>,
+  &X86Architecture::Table_2_7d<Mode>,
+  &X86Architecture::Table_2_7e<Mode>,
+  &X86Architecture::Table_2_7f<Mode>,
+  &X86Architecture::Table_2_80<Mode>,
+  &X86Architecture::Table_2_81<Mode>,
+  &X86Architecture::Table_2_82<Mode>,
+  &X86Architecture::Table_2_83<Mode>,
+  &X86Architecture::Table_2_84<Mode>,
+  &X86Architecture::Table_2_85<Mode>,
+  &X86Architecture::Table_2_86<Mode>,
+  &X86Architecture::Table_2_87<Mode>,
+  &X86Architecture::Table_2_88<Mode>,
+  &X86Architecture::Table_2_89<Mode>,
+  &X86Architecture::Table_2_8a<Mode>,
+  &X86Architecture::Table_2_8b<Mode>,
+  &X86Architecture::Table_2_8c<Mode>,
+  &X86Architecture::Table_2_8d<Mode>,
+  &X86Architecture::Table_2_8e<Mode>,
+  &X86Architecture::Table_2_8f<Mode>,
+  &X86Architecture::Table_2_90<Mode>,
+  &X86Architecture::Table_2_91<Mode>,
+  &X86Architecture::Table_2_92<Mode>,
+  &X86Architecture::Table_2_93<Mode>,
+  &X86Architecture::Table_2_94<Mode>,
+  &X86Architecture::Table_2_95<Mode>,
+  &X86Architecture::Table_2_96<Mode>,
+  &X86Architecture::Table_2_97<Mode>,
+  &X86Architecture::Table_2_98<Mode>,
+  &X86Architecture::Table_2_99<Mode>,
+  &X86Architecture::Table_2_9a<Mode>,
+  &X86Architecture::Table_2_9b<Mode>,
+  &X86Architecture::Table_2_9c<Mode>,
+  &X86Architecture::Table_2_9d<Mode>,
+  &X86Architecture::Table_2_9e<Mode>,
+  &X86Architecture::Table_2_9f<Mode>,
+  &X86Architecture::Table_2_a0<Mode>,
+  &X86Architecture::Table_2_a1<Mode>,
+  &X86Architecture::Table_2_a3<Mode>,
+  &X86Architecture::Table_2_a4<Mode>,
+  &X86Architecture::Table_2_a5<Mode>,
+  &X86Architecture::Table_2_a6<Mode>,
+  &X86Architecture::Table_2_a7<Mode>,
+  &X86Architecture::Table_2_a8<Mode>,
+  &X86Architecture::Table_2_a9<Mode>,
+  &X86Architecture::Table_2_aa<Mode>,
+  &X86Architecture::Table_2_ab<Mode>,
+  &X86Architecture::Table_2_ac<Mode>,
+  &X86Architecture::Table_2_ad<Mode>,
+  &X86Architecture::Table_2_ae<Mode>,
+  &X86Architecture::Table_2_af<Mode>,
+  &X86Architecture::Table_2_b0<Mode>,
+  &X86Architecture::Table_2_b1<Mode>,
+  &X86Architecture::Table_2_b2<Mode>,
+  &X86Architecture::Table_2_b3<Mode>,
+  &X86Architecture::Table_2_b4<Mode>,
+  &X86Architecture::Table_2_b5<Mode>,
+  &X86Architecture::Table_2_b6<Mode>,
+  &X86Architecture::Table_2_b7<Mode>,
+  &X86Architecture::Table_2_b8<Mode>,
+  &X86Architecture::Table_2_b9<Mode>,
+  &X86Architecture::Table_2_ba<Mode>,
+  &X86Architecture::Table_2_bb<Mode>,
+  &X86Architecture::Table_2_bc<Mode>,
+  &X86Architecture::Table_2_bd<Mode>,
+  &X86Architecture::Table_2_be<Mode>,
+  &X86Architecture::Table_2_bf<Mode>,
+  &X86Architecture::Table_2_c0<Mode>,
+  &X86Architecture::Table_2_c1<Mode>,
+  &X86Architecture::Table_2_c3<Mode>,
+  &X86Architecture::Table_2_c4<Mode>,
+  &X86Architecture::Table_2_c5<Mode>,
+  &X86Architecture::Table_2_c6<Mode>,
+  &X86Architecture::Table_2_c7<Mode>,
+  &X86Architecture::Table_2_c8<Mode>,
+  &X86Architecture::Table_2_c9<Mode>,
+  &X86Architecture::Table_2_ca<Mode>,
+  &X86Architecture::Table_2_cb<Mode>,
+  &X86Architecture::Table_2_cc<Mode>,
+  &X86Architecture::Table_2_cd<Mode>,
+  &X86Architecture::Table_2_ce<Mode>,
+  &X86Architecture::Table_2_cf<Mode>,
+  &X86Architecture::Table_2_d0<Mode>,
+  &X86Architecture::Table_2_d1<Mode>,
+  &X86Architecture::Table_2_d2<Mode>,
+  &X86Architecture::Table_2_d3<Mode>,
+  &X86Architecture::Table_2_d4<Mode>,
+  &X86Architecture::Table_2_d5<Mode>,
+  &X86Architecture::Table_2_d6<Mode>,
+  &X86Architecture::Table_2_d7<Mode>,
+  &X86Architecture::Table_2_d8<Mode>,
+  &X86Architecture::Table_2_d9<Mode>,
+  &X86Architecture::Table_2_da<Mode>,
+  &X86Architecture::Table_2_db<Mode>,
+  &X86Architecture::Table_2_dc<Mode>,
+  &X86Architecture::Table_2_dd<Mode>,
+  &X86Architecture::Table_2_de<Mode>,
+  &X86Architecture::Table_2_df<Mode>,
+  &X86Architecture::Table_2_e0<Mode>,
+  &X86Architecture::Table_2_e1<Mode>,
+  &X86Architecture::Table_2_e2<Mode>,
+  &X86Architecture::Table_2_e3<Mode>,
+  &X86Architecture::Table_2_e4<Mode>,
+  &X86Architecture::Table_2_e5<Mode>,
+  &X86Architecture::Table_2_e6<Mode>,
+  &X86Architecture::Table_2_e7<Mode>,
+  &X86Architecture::Table_2_e8<Mode>,
+  &X86Architecture::Table_2_e9<Mode>,
+  &X86Architecture::Table_2_ea<Mode>,
+  &X86Architecture::Table_2_eb<Mode>,
+  &X86Architecture::Table_2_ec<Mode>,
+  &X86Architecture::Table_2_ed<Mode>,
+  &X86Architecture::Table_2_ee<Mode>,
+  &X86Architecture::Table_2_ef<Mode>,
+  &X86Architecture::Table_2_f0<Mode>,
+  &X86Architecture::Table_2_f1<Mode>,
+  &X86Architecture::Table_2_f2<Mode>,
+  &X86Architecture::Table_2_f3<Mode>,
+  &X86Architecture::Table_2_f4<Mode>,
+  &X86Architecture::Table_2_f5<Mode>,
+  &X86Architecture::Table_2_f6<Mode>,
+  &X86Architecture::Table_2_f7<Mode>,
+  &X86Architecture::Table_2_f8<Mode>,
+  &X86Architecture::Table_2_f9<Mode>,
+  &X86Architecture::Table_2_fa<Mode>,
+  &X86Architecture::Table_2_fb<Mode>,
+  &X86Architecture::Table_2_fc<Mode>,
+  &X86Architecture::Table_2_fd<Mode>,
+  &X86Architecture::Table_2_fe<Mode>,
+  &X86Architecture::Table_2_ff<Mode>,
+  &X86Architecture::Table_3dnow1_0c<Mode>,
+  &X86Architecture::Table_3dnow1_0d<Mode>,
+  &X86Architecture::Table_3dnow1_1c<Mode>,
+  &X86Architecture::Table_3dnow1_1d<Mode>,
+  &X86Architecture::Table_3dnow1_86<Mode>,
+  &X86Architecture::Table_3dnow1_87<Mode>,
+  &X86Architecture::Table_3dnow1_8a<Mode>,
+  &X86Architecture::Table_3dnow1_8e<Mode>,
+  &X86Architecture::Table_3dnow1_90<Mode>,
+  &X86Architecture::Table_3dnow1_94<Mode>,
+  &X86Architecture::Table_3dnow1_96<Mode>,
+  &X86Architecture::Table_3dnow1_97<Mode>,
+  &X86Architecture::Table_3dnow1_9a<Mode>,
+  &X86Architecture::Table_3dnow1_9e<Mode>,
+  &X86Architecture::Table_3dnow1_a0<Mode>,
+  &X86Architecture::Table_3dnow1_a4<Mode>,
+  &X86Architecture::Table_3dnow1_a6<Mode>,
+  &X86Architecture::Table_3dnow1_a7<Mode>,
+  &X86Architecture::Table_3dnow1_aa<Mode>,
+  &X86Architecture::Table_3dnow1_ae<Mode>,
+  &X86Architecture::Table_3dnow1_b0<Mode>,
+  &X86Architecture::Table_3dnow1_b4<Mode>,
+  &X86Architecture::Table_3dnow1_b6<Mode>,
+  &X86Architecture::Table_3dnow1_b7<Mode>,
+  &X86Architecture::Table_3dnow1_bb<Mode>,
+  &X86Architecture::Table_3dnow1_bf<Mode>,
+  &X86Architecture::Table_3_38_00<Mode>,
+  &X86Architecture::Table_3_38_01<Mode>,
+  &X86Architecture::Table_3_38_02<Mode>,
+  &X86Architecture::Table_3_38_03<Mode>,
+  &X86Architecture::Table_3_38_04<Mode>,
+  &X86Architecture::Table_3_38_05<Mode>,
+  &X86Architecture::Table_3_38_06<Mode>,
+  &X86Architecture::Table_3_38_07<Mode>,
+  &X86Architecture::Table_3_38_08<Mode>,
+  &X86Architecture::Table_3_38_09<Mode>,
+  &X86Architecture::Table_3_38_0a<Mode>,
+  &X86Architecture::Table_3_38_0b<Mode>,
+  &X86Architecture::Table_3_38_0c<Mode>,
+  &X86Architecture::Table_3_38_0d<Mode>,
+  &X86Architecture::Table_3_38_0e<Mode>,
+  &X86Architecture::Table_3_38_0f<Mode>,
+  &X86Architecture::Table_3_38_10<Mode>,
+  &X86Architecture::Table_3_38_13<Mode>,
+  &X86Architecture::Table_3_38_14<Mode>,
+  &X86Architecture::Table_3_38_15<Mode>,
+  &X86Architecture::Table_3_38_16<Mode>,
+  &X86Architecture::Table_3_38_17<Mode>,
+  &X86Architecture::Table_3_38_18<Mode>,
+  &X86Architecture::Table_3_38_19<Mode>,
+  &X86Architecture::Table_3_38_1a<Mode>,
+  &X86Architecture::Table_3_38_1c<Mode>,
+  &X86Architecture::Table_3_38_1d<Mode>,
+  &X86Architecture::Table_3_38_1e<Mode>,
+  &X86Architecture::Table_3_38_20<Mode>,
+  &X86Architecture::Table_3_38_21<Mode>,
+  &X86Architecture::Table_3_38_22<Mode>,
+  &X86Architecture::Table_3_38_23<Mode>,
+  &X86Architecture::Table_3_38_24<Mode>,
+  &X86Architecture::Table_3_38_25<Mode>,
+  &X86Architecture::Table_3_38_28<Mode>,
+  &X86Architecture::Table_3_38_29<Mode>,
+  &X86Architecture::Table_3_38_2a<Mode>,
+  &X86Architecture::Table_3_38_2b<Mode>,
+  &X86Architecture::Table_3_38_2c<Mode>,
+  &X86Architecture::Table_3_38_2d<Mode>,
+  &X86Architecture::Table_3_38_2e<Mode>,
+  &X86Architecture::Table_3_38_2f<Mode>,
+  &X86Architecture::Table_3_38_30<Mode>,
+  &X86Architecture::Table_3_38_31<Mode>,
+  &X86Architecture::Table_3_38_32<Mode>,
+  &X86Architecture::Table_3_38_33<Mode>,
+  &X86Architecture::Table_3_38_34<Mode>,
+  &X86Architecture::Table_3_38_35<Mode>,
+  &X86Architecture::Table_3_38_36<Mode>,
+  &X86Architecture::Table_3_38_37<Mode>,
+  &X86Architecture::Table_3_38_38<Mode>,
+  &X86Architecture::Table_3_38_39<Mode>,
+  &X86Architecture::Table_3_38_3a<Mode>,
+  &X86Architecture::Table_3_38_3b<Mode>,
+  &X86Architecture::Table_3_38_3c<Mode>,
+  &X86Architecture::Table_3_38_3d<Mode>,
+  &X86Architecture::Table_3_38_3e<Mode>,
+  &X86Architecture::Table_3_38_3f<Mode>,
+  &X86Architecture::Table_3_38_40<Mode>,
+  &X86Architecture::Table_3_38_41<Mode>,
+  &X86Architecture::Table_3_38_45<Mode>,
+  &X86Architecture::Table_3_38_46<Mode>,
+  &X86Architecture::Table_3_38_47<Mode>,
+  &X86Architecture::Table_3_38_58<Mode>,
+  &X86Architecture::Table_3_38_59<Mode>,
+  &X86Architecture::Table_3_38_5a<Mode>,
+  &X86Architecture::Table_3_38_78<Mode>,
+  &X86Architecture::Table_3_38_79<Mode>,
+  &X86Architecture::Table_3_38_80<Mode>,
+  &X86Architecture::Table_3_38_81<Mode>,
+  &X86Architecture::Table_3_38_82<Mode>,
+  &X86Architecture::Table_3_38_8c<Mode>,
+  &X86Architecture::Table_3_38_8e<Mode>,
+  &X86Architecture::Table_3_38_90<Mode>,
+  &X86Architecture::Table_3_38_91<Mode>,
+  &X86Architecture::Table_3_38_92<Mode>,
+  &X86Architecture::Table_3_38_93<Mode>,
+  &X86Architecture::Table_3_38_96<Mode>,
+  &X86Architecture::Table_3_38_97<Mode>,
+  &X86Architecture::Table_3_38_98<Mode>,
+  &X86Architecture::Table_3_38_99<Mode>,
+  &X86Architecture::Table_3_38_9a<Mode>,
+  &X86Architecture::Table_3_38_9b<Mode>,
+  &X86Architecture::Table_3_38_9c<Mode>,
+  &X86Architecture::Table_3_38_9d<Mode>,
+  &X86Architecture::Table_3_38_9e<Mode>,
+  &X86Architecture::Table_3_38_9f<Mode>,
+  &X86Architecture::Table_3_38_a6<Mode>,
+  &X86Architecture::Table_3_38_a7<Mode>,
+  &X86Architecture::Table_3_38_a8<Mode>,
+  &X86Architecture::Table_3_38_a9<Mode>,
+  &X86Architecture::Table_3_38_aa<Mode>,
+  &X86Architecture::Table_3_38_ab<Mode>,
+  &X86Architecture::Table_3_38_ac<Mode>,
+  &X86Architecture::Table_3_38_ad<Mode>,
+  &X86Architecture::Table_3_38_ae<Mode>,
+  &X86Architecture::Table_3_38_af<Mode>,
+  &X86Architecture::Table_3_38_b6<Mode>,
+  &X86Architecture::Table_3_38_b7<Mode>,
+  &X86Architecture::Table_3_38_b8<Mode>,
+  &X86Architecture::Table_3_38_b9<Mode>,
+  &X86Architecture::Table_3_38_ba<Mode>,
+  &X86Architecture::Table_3_38_bb<Mode>,
+  &X86Architecture::Table_3_38_bc<Mode>,
+  &X86Architecture::Table_3_38_bd<Mode>,
+  &X86Architecture::Table_3_38_be<Mode>,
+  &X86Architecture::Table_3_38_bf<Mode>,
+  &X86Architecture::Table_3_38_db<Mode>,
+  &X86Architecture::Table_3_38_dc<Mode>,
+  &X86Architecture::Table_3_38_dd<Mode>,
+  &X86Architecture::Table_3_38_de<Mode>,
+  &X86Architecture::Table_3_38_df<Mode>,
+  &X86Architecture::Table_3_38_f0<Mode>,
+  &X86Architecture::Table_3_38_f1<Mode>,
+  &X86Architecture::Table_3_38_f2<Mode>,
+  &X86Architecture::Table_3_38_f3<Mode>,
+  &X86Architecture::Table_3_38_f5<Mode>,
+  &X86Architecture::Table_3_38_f6<Mode>,
+  &X86Architecture::Table_3_38_f7<Mode>,
+  &X86Architecture::Table_3_3a_00<Mode>,
+  &X86Architecture::Table_3_3a_01<Mode>,
+  &X86Architecture::Table_3_3a_02<Mode>,
+  &X86Architecture::Table_3_3a_04<Mode>,
+  &X86Architecture::Table_3_3a_05<Mode>,
+  &X86Architecture::Table_3_3a_06<Mode>,
+  &X86Architecture::Table_3_3a_08<Mode>,
+  &X86Architecture::Table_3_3a_09<Mode>,
+  &X86Architecture::Table_3_3a_0a<Mode>,
+  &X86Architecture::Table_3_3a_0b<Mode>,
+  &X86Architecture::Table_3_3a_0c<Mode>,
+  &X86Architecture::Table_3_3a_0d<Mode>,
+  &X86Architecture::Table_3_3a_0e<Mode>,
+  &X86Architecture::Table_3_3a_0f<Mode>,
+  &X86Architecture::Table_3_3a_14<Mode>,
+  &X86Architecture::Table_3_3a_15<Mode>,
+  &X86Architecture::Table_3_3a_16<Mode>,
+  &X86Architecture::Table_3_3a_17<Mode>,
+  &X86Architecture::Table_3_3a_18<Mode>,
+  &X86Architecture::Table_3_3a_19<Mode>,
+  &X86Architecture::Table_3_3a_1d<Mode>,
+  &X86Architecture::Table_3_3a_20<Mode>,
+  &X86Architecture::Table_3_3a_21<Mode>,
+  &X86Architecture::Table_3_3a_22<Mode>,
+  &X86Architecture::Table_3_3a_38<Mode>,
+  &X86Architecture::Table_3_3a_39<Mode>,
+  &X86Architecture::Table_3_3a_40<Mode>,
+  &X86Architecture::Table_3_3a_41<Mode>,
+  &X86Architecture::Table_3_3a_42<Mode>,
+  &X86Architecture::Table_3_3a_44<Mode>,
+  &X86Architecture::Table_3_3a_46<Mode>,
+  &X86Architecture::Table_3_3a_4a<Mode>,
+  &X86Architecture::Table_3_3a_4b<Mode>,
+  &X86Architecture::Table_3_3a_4c<Mode>,
+  &X86Architecture::Table_3_3a_60<Mode>,
+  &X86Architecture::Table_3_3a_61<Mode>,
+  &X86Architecture::Table_3_3a_62<Mode>,
+  &X86Architecture::Table_3_3a_63<Mode>,
+  &X86Architecture::Table_3_3a_df<Mode>,
+  &X86Architecture::Table_3_3a_f0<Mode>,
+  &X86Architecture::Table_fp2_e6<Mode>,
+  &X86Architecture::Table_fp2_f5<Mode>,
+  &X86Architecture::Table_fp2_fb<Mode>,
+  &X86Architecture::Table_fp2_fe<Mode>,
+  &X86Architecture::Table_fp2_ff<Mode>,
+  &X86Architecture::Table_fp3_e9<Mode>,
+  &X86Architecture::Table_fp4_e0<Mode>,
+  &X86Architecture::Table_fp4_e1<Mode>,
+  &X86Architecture::Table_fp4_e4<Mode>,
+  &X86Architecture::Table_fp4_e5<Mode>,
+  &X86Architecture::Table_fp4_e8<Mode>,
+  &X86Architecture::Table_fp4_ea<Mode>,
+  &X86Architecture::Table_fp4_eb<Mode>,
+  &X86Architecture::Table_fp4_f1<Mode>,
+  &X86Architecture::Table_fp4_f8<Mode>,
+  &X86Architecture::Table_fp6_e0<Mode>,
+  &X86Architecture::Table_fp6_e1<Mode>,
+  &X86Architecture::Table_fp6_e2<Mode>,
+  &X86Architecture::Table_fp6_e3<Mode>,
+  &X86Architecture::Table_fp6_e4<Mode>,
+  &X86Architecture::Table_fp6_e5<Mode>,
+  &X86Architecture::Table_fp6_e6<Mode>,
+  &X86Architecture::Table_fp6_e7<Mode>,
+  &X86Architecture::Table_fp6_e8<Mode>,
+  &X86Architecture::Table_fp6_e9<Mode>,
+  &X86Architecture::Table_fp6_ea<Mode>,
+  &X86Architecture::Table_fp6_eb<Mode>,
+  &X86Architecture::Table_fp6_ec<Mode>,
+  &X86Architecture::Table_fp6_ed<Mode>,
+  &X86Architecture::Table_fp6_ee<Mode>,
+  &X86Architecture::Table_fp6_ef<Mode>,
+  &X86Architecture::Table_fp6_fc<Mode>,
+  &X86Architecture::Table_fp8_e0<Mode>,
+  &X86Architecture::Table_fp8_e1<Mode>,
+  &X86Architecture::Table_fp8_e2<Mode>,
+  &X86Architecture::Table_fp8_fc<Mode>
+};
+
+template<u8 Mode>
+const X86Architecture::TDisassembler X86Architecture::DecodeTable<Mode>::m_OperandDecoder[0x38] =
+{
+  nullptr,
+  &X86Architecture::Operand__Eb_Gb<Mode>,
+  &X86Architecture::Operand__Ev_Gv<Mode>,
+  &X86Architecture::Operand__Gb_Eb<Mode>,
+  &X86Architecture::Operand__Gv_Ev<Mode>,
+  &X86Architecture::Operand__AL_Ib<Mode>,
+  &X86Architecture::Operand__rAX_Iz<Mode>,
+  &X86Architecture::Operand__Jb<Mode>,
+  &X86Architecture::Operand__Ew_Sw<Mode>,
+  &X86Architecture::Operand__Gv_M<Mode>,
+  &X86Architecture::Operand__Sw_Ew<Mode>,
+  &X86Architecture::Operand__AL_Ob<Mode>,
+  &X86Architecture::Operand__rAX_Ov<Mode>,
+  &X86Architecture::Operand__Ob_AL<Mode>,
+  &X86Architecture::Operand__Ov_rAX<Mode>,
+  &X86Architecture::Operand__Xb_Yb<Mode>,
+  &X86Architecture::Operand__Xv_Yv<Mode>,
+  &X86Architecture::Operand__AL_Yb<Mode>,
+  &X86Architecture::Operand__rAX_Yv<Mode>,
+  &X86Architecture::Operand__AL_Xb<Mode>,
+  &X86Architecture::Operand__rAX_Xv<Mode>,
+  &X86Architecture::Operand__Iw<Mode>,
+  &X86Architecture::Operand__3<Mode>,
+  &X86Architecture::Operand__Ib<Mode>,
+  &X86Architecture::Operand__eAX_Ib<Mode>,
+  &X86Architecture::Operand__Ib_AL<Mode>,
+  &X86Architecture::Operand__Ib_eAX<Mode>,
+  &X86Architecture::Operand__Jz<Mode>,
+  &X86Architecture::Operand__AL_DX<Mode>,
+  &X86Architecture::Operand__eAX_DX<Mode>,
+  &X86Architecture::Operand__DX_AL<Mode>,
+  &X86Architecture::Operand__DX_eAX<Mode>,
+  &X86Architecture::Operand__Gv_Ew<Mode>,
+  &X86Architecture::Operand__ST0_ST0<Mode>,
+  &X86Architecture::Operand__ST0_ST1<Mode>,
+  &X86Architecture::Operand__ST0_ST2<Mode>,
+  &X86Architecture::Operand__ST0_ST3<Mode>,
+  &X86Architecture::Operand__ST0_ST4<Mode>,
+  &X86Architecture::Operand__ST0_ST5<Mode>,
+  &X86Architecture::Operand__ST0_ST6<Mode>,
+  &X86Architecture::Operand__ST0_ST7<Mode>,
+  &X86Architecture::Operand__ST0<Mode>,
+  &X86Architecture::Operand__ST1<Mode>,
+  &X86Architecture::Operand__ST2<Mode>,
+  &X86Architecture::Operand__ST3<Mode>,
+  &X86Architecture::Operand__ST4<Mode>,
+  &X86Architecture::Operand__ST5<Mode>,
+  &X86Architecture::Operand__ST6<Mode>,
+  &X86Architecture::Operand__ST7<Mode>,
+  &X86Architecture::Operand__ST1_ST0<Mode>,
+  &X86Architecture::Operand__ST2_ST0<Mode>,
+  &X86Architecture::Operand__ST3_ST0<Mode>,
+  &X86Architecture::Operand__ST4_ST0<Mode>,
+  &X86Architecture::Operand__ST5_ST0<Mode>,
+  &X86Architecture::Operand__ST6_ST0<Mode>,
+  &X86Architecture::Operand__ST7_ST0<Mode>
+};
+
+template struct X86Architecture::DecodeTable<X86_Bit_16>;
+template struct X86Architecture::DecodeTable<X86_Bit_32>;
+template struct X86Architecture::DecodeTable<X86_Bit_64>;
+
+const X86Architecture::TSemanticBuilder X86Architecture::m_SemanticBuilder[0x48] =
+{
+  nullptr,
+  &X86Architecture::Semantic_001,
+  &X86Architecture::Semantic_002,
+  &X86Architecture::Semantic_003,
+  &X86Architecture::Semantic_004,
+  &X86Architecture::Semantic_005,
+  &X86Architecture::Semantic_006,
+  &X86Architecture::Semantic_007,
+  &X86Architecture::Semantic_008,
+  &X86Architecture::Semantic_009,
+  &X86Architecture::Semantic_00a,
+  &X86Architecture::Semantic_00b,
+  &X86Architecture::Semantic_00c,
+  &X86Architecture::Semantic_00d,
+  &X86Architecture::Semantic_00e,
+  &X86Architecture::Semantic_00f,
+  &X86Architecture::Semantic_010,
+  &X86Architecture::Semantic_011,
+  &X86Architecture::Semantic_012,
+  &X86Architecture::Semantic_013,
+  &X86Architecture::Semantic_014,
+  &X86Architecture::Semantic_015,
+  &X86Architecture::Semantic_016,
+  &X86Architecture::Semantic_017,
+  &X86Architecture::Semantic_018,
+  &X86Architecture::Semantic_019,
+  &X86Architecture::Semantic_01a,
+  &X86Architecture::Semantic_01b,
+  &X86Architecture::Semantic_01c,
+  &X86Architecture::Semantic_01d,
+  &X86Architecture::Semantic_01e,
+  &X86Architecture::Semantic_01f,
+  &X86Architecture::Semantic_020,
+  &X86Architecture::Semantic_021,
+  &X86Architecture::Semantic_022,
+  &X86Architecture::Semantic_023,
+  &X86Architecture::Semantic_024,
+  &X86Architecture::Semantic_025,
+  &X86Architecture::Semantic_026,
+  &X86Architecture::Semantic_027,
+  &X86Architecture::Semantic_028,
+  &X86Architecture::Semantic_029,
+  &X86Architecture::Semantic_02a,
+  &X86Architecture::Semantic_02b,
+  &X86Architecture::Semantic_02c,
+  &X86Architecture::Semantic_02d,
+  &X86Architecture::Semantic_02e,
+  &X86Architecture::Semantic_02f,
+  &X86Architecture::Semantic_030,
+  &X86Architecture::Semantic_031,
+  &X86Architecture::Semantic_032,
+  &X86Architecture::Semantic_033,
+  &X86Architecture::Semantic_034,
+  &X86Architecture::Semantic_035,
+  &X86Architecture::Semantic_036,
+  &X86Architecture::Semantic_037,
+  &X86Architecture::Semantic_038,
+  &X86Architecture::Semantic_039,
+  &X86Architecture::Semantic_03a,
+  &X86Architecture::Semantic_03b,
+  &X86Architecture::Semantic_03c,
+  &X86Architecture::Semantic_03d,
+  &X86Architecture::Semantic_03e,
+  &X86Architecture::Semantic_03f,
+  &X86Architecture::Semantic_040,
+  &X86Architecture::Semantic_041,
+  &X86Architecture::Semantic_042,
+  &X86Architecture::Semantic_043,
+  &X86Architecture::Semantic_044,
+  &X86Architecture::Semantic_045,
+  &X86Architecture::Semantic_046,
+  &X86Architecture::Semantic_047
+};
+
+void X86Architecture::Semantic_001(Instruction& rInsn, u8 Mode)
+{
+  Expression::LSPType AllExpr;
+  rInsn.SetUpdatedFlags(X86_FlCf | X86_FlPf | X86_FlAf | X86_FlZf | X86_FlSf | X86_FlOf);
+  /* semantic: alloc_var('res', op0.bit) */
+  AllExpr.push_back(Expr::MakeVar("res", VariableExpression::Alloc, rInsn.GetOperand(0)->GetBitSize()));
+  /* semantic: res.val = op0.val + op1.val */
+  AllExpr.push_back(Expr::MakeAssign(
+    Expr::MakeVar("res", VariableExpression::Use),
+    Expr::MakeBinOp(
+      OperationExpression::OpAdd,
+      rInsn.GetOperand(0),
+      rInsn.GetOperand(1))));
+  /* semantic: call('overflow_flag_add') */
+  AllExpr.push_back(Expr::MakeAssign(
+    Expr::MakeId(X86_FlOf, &m_CpuInfo),
+    Expr::MakeBinOp(OperationExpression::OpBcast, Expr::MakeBinOp(
+      OperationExpression::OpLrs,
+      Expr::MakeBinOp(
+        OperationExpression::OpAnd,
+        Expr::MakeBinOp(
+          OperationExpression::OpXor,
+          rInsn.GetOperand(0),
+          Expr::MakeVar("res", VariableExpression::Use)),
+        Expr::MakeUnOp(
+          OperationExpression::OpNot,
+          Expr::MakeBinOp(
+            OperationExpression::OpXor,
+            rInsn.GetOperand(0),
+            rInsn.GetOperand(1)))),
+      Expr::MakeBinOp(
+        OperationExpression::OpSub,
+        Expr::MakeBitVector(rInsn.GetOperand(0)->GetBitSize(), rInsn.GetOperand(0)->GetBitSize()),
+        Expr::MakeBitVector(rInsn.GetOperand(0)->GetBitSize(), 0x1))), Expr::MakeBitVector(1, 0x1))));
+  /* semantic: call('carry_flag_add') */
+  AllExpr.push_back(Expr::MakeAssign(
+    Expr::MakeId(X86_FlCf, &m_CpuInfo),
+    Expr::MakeBinOp(OperationExpression::OpBcast, Expr::MakeBinOp(
+      OperationExpression::OpLrs,
+      Expr::MakeBinOp(
+        OperationExpression::OpXor,
+        Expr::MakeBinOp(
+          OperationExpression::OpAnd,
+          rInsn.GetOperand(0),
+          rInsn.GetOperand(1)),
+        Expr::MakeBinOp(
+          OperationExpression::OpAnd,
+          Expr::MakeBinOp(
+            OperationExpression::OpXor,
+            Expr::MakeBinOp(
+              OperationExpression::OpXor,
+              rInsn.GetOperand(0),
+              rInsn.GetOperand(1)),
+            Expr::MakeVar("res", VariableExpression::Use)),
+          Expr::MakeBinOp(
+            OperationExpression::OpXor,
+            rInsn.GetOperand(0),
+            rInsn.GetOperand(1)))),
+      Expr::MakeBinOp(
+        OperationExpression::OpSub,
+        Expr::MakeBitVector(rInsn.GetOperand(0)->GetBitSize(), rInsn.GetOperand(0)->GetBitSize()),
+        Expr::MakeBitVector(rInsn.GetOperand(0)->GetBitSize(), 0x1))), Expr::MakeBitVector(1, 0x1))));
+  /* semantic: call('sign_flag') */
+  AllExpr.push_back(Expr::MakeAssign(
+    Expr::MakeId(X86_FlSf, &m_CpuInfo),
+    Expr::MakeBinOp(OperationExpression::OpBcast, Expr::MakeBinOp(
+      OperationExpression::OpLrs,
+      Expr::MakeVar("res", VariableExpression::Use),
+      Expr::MakeBinOp(
+        OperationExpression::OpSub,
+        Expr::MakeBitVector(rInsn.GetOperand(0)->GetBitSize(), rInsn.GetOperand(0)->GetBitSize()),
+        Expr::MakeBitVector(rInsn.GetOperand(0)->GetBitSize(), 0x1))), Expr::MakeBitVector(1, 0x1))));
+  /* semantic: call('zero_flag') */
+  AllExpr.push_back(Expr::MakeAssign(
+    Expr::MakeId(X86_FlZf, &m_CpuInfo),
+    Expr::MakeTernaryCond(ConditionExpression::CondEq,
+    Expr::MakeVar("res", VariableExpression::Use),
+    Expr::MakeBitVector(rInsn.GetOperand(0)->GetBitSize(), 0x0),
+    Expr::MakeBitVector(1, 0x1), Expr::MakeBitVector(1, 0x0))));
+  /* semantic: call('parity_flag') */
+  AllExpr.push_back(Expr::MakeVar("pf_tmp", VariableExpression::Alloc, m_CpuInfo.GetSizeOfRegisterInBit(X86_FlPf)));
+  AllExpr.push_back(Expr::MakeAssign(
+    Expr::MakeVar("pf_tmp", VariableExpression::Use),
+    Expr::MakeBitVector(1, 0x1)));
+  AllExpr.push_back(Expr::MakeAssign(
+    Expr::MakeVar("pf_tmp", VariableExpression::Use),
+    Expr::MakeBinOp(
+      OperationExpression::OpXor,
+      Expr::MakeVar("pf_tmp", VariableExpression::Use),
+      Expr::MakeBinOp(OperationExpression::OpBcast, Expr::MakeBinOp(
+        OperationExpression::OpLrs,
+        Expr::MakeVar("res", VariableExpression::Use),
+        Expr::MakeBitVector(rInsn.GetOperand(0)->GetBitSize(), 0x0)), Expr::MakeBitVector(1, 0x1))))
+  );
+  AllExpr.push_back(Expr::MakeAssign(
+    Expr::MakeVar("pf_tmp", VariableExpression::Use),
+    Expr::MakeBinOp(
+      OperationExpression::OpXor,
+      Expr::MakeVar("pf_tmp", VariableExpression::Use),
+      Expr::MakeBinOp(OperationExpression::OpBcast, Expr::MakeBinOp(
+        OperationExpression::OpLrs,
+        Expr::MakeVar("res", VariableExpression::Use),
+        Expr::MakeBitVector(rInsn.GetOperand(0)->GetBitSize(), 0x1)), Expr::MakeBitVector(1, 0x1))))
+  );
+  AllExpr.push_back(Expr::MakeAssign(
+    Expr::MakeVar("pf_tmp", VariableExpression::Use),
+    Expr::MakeBinOp(
+      OperationExpression::OpXor,
+      Expr::MakeVar("pf_tmp", VariableExpression::Use),
+      Expr::MakeBinOp(OperationExpression::OpBcast, Expr::MakeBinOp(
+        OperationExpression::OpLrs,
+        Expr::MakeVar("res", VariableExpression::Use),
+        Expr::MakeBitVector(rInsn.GetOperand(0)->GetBitSize(), 0x2)), Expr::MakeBitVector(1, 0x1))))
+  );
+  AllExpr.push_back(Expr::MakeAssign(
+    Expr::MakeVar("pf_tmp", VariableExpression::Use),
+    Expr::MakeBinOp(
+      OperationExpression::OpXor,
+      Expr::MakeVar("pf_tmp", VariableExpression::Use),
+      Expr::MakeBinOp(OperationExpression::OpBcast, Expr::MakeBinOp(
+        OperationExpression::OpLrs,
+        Expr::MakeVar("res", VariableExpression::Use),
+        Expr::MakeBitVector(rInsn.GetOperand(0)->GetBitSize(), 0x3)), Expr::MakeBitVector(1, 0x1))))
+  );
+  AllExpr.push_back(Expr::MakeAssign(
+    Expr::MakeVar("pf_tmp", VariableExpression::Use),
+    Expr::MakeBinOp(
+      OperationExpression::OpXor,
+      Expr::MakeVar("pf_tmp", VariableExpression::Use),
+      Expr::MakeBinOp(OperationExpression::OpBcast, Expr::MakeBinOp(
+        OperationExpression::OpLrs,
+        Expr::MakeVar("res", VariableExpression::Use),
+        Expr::MakeBitVector(rInsn.GetOperand(0)->GetBitSize(), 0x4)), Expr::MakeBitVector(1, 0x1))))
+  );
+  AllExpr.push_back(Expr::MakeAssign(
+    Expr::MakeVar("pf_tmp", VariableExpression::Use),
+    Expr::MakeBinOp(
+      OperationExpression::OpXor,
+      Expr::MakeVar("pf_tmp", VariableExpression::Use),
+      Expr::MakeBinOp(OperationExpression::OpBcast, Expr::MakeBinOp(
+        OperationExpression::OpLrs,
+        Expr::MakeVar("res", VariableExpression::Use),
+        Expr::MakeBitVector(rInsn.GetOperand(0)->GetBitSize(), 0x5)), Expr::MakeBitVector(1, 0x1))))
+  );
+  AllExpr.push_back(Expr::MakeAssign(
+    Expr::MakeVar("pf_tmp", VariableExpression::Use),
+    Expr::MakeBinOp(
+      OperationExpression::OpXor,
+      Expr::MakeVar("pf_tmp", VariableExpression::Use),
+      Expr::MakeBinOp(OperationExpression::OpBcast, Expr::MakeBinOp(
+        OperationExpression::OpLrs,
+        Expr::MakeVar("res", VariableExpression::Use),
+        Expr::MakeBitVector(rInsn.GetOperand(0)->GetBitSize(), 0x6)), Expr::MakeBitVector(1, 0x1))))
+  );
+  AllExpr.push_back(Expr::MakeAssign(
+    Expr::MakeVar("pf_tmp", VariableExpression::Use),
+    Expr::MakeBinOp(
+      OperationExpression::OpXor,
+      Expr::MakeVar("pf_tmp", VariableExpression::Use),
+      Expr::MakeBinOp(OperationExpression::OpBcast, Expr::MakeBinOp(
+        OperationExpression::OpLrs,
+        Expr::MakeVar("res", VariableExpression::Use),
+        Expr::MakeBitVector(rInsn.GetOperand(0)->GetBitSize(), 0x7)), Expr::MakeBitVector(1, 0x1))))
+  );
+  AllExpr.push_back(Expr::MakeAssign(
+    Expr::MakeId(X86_FlPf, &m_CpuInfo),
+    Expr::MakeVar("pf_tmp", VariableExpression::Use)));
+  AllExpr.push_back(Expr::MakeVar("pf_tmp", VariableExpression::Free));
+  /* semantic: call('adjust_flag') */
+  AllExpr.push_back(Expr::MakeAssign(
+    Expr::MakeId(X86_FlAf, &m_CpuInfo),
+    Expr::MakeBinOp(OperationExpression::OpBcast, Expr::MakeBinOp(
+      OperationExpression::OpLrs,
+      Expr::MakeBinOp(
+        OperationExpression::OpXor,
+        Expr::MakeBinOp(
+          OperationExpression::OpXor,
+          rInsn.GetOperand(0),
+          rInsn.GetOperand(1)),
+        Expr::MakeVar("res", VariableExpression::Use)),
+      Expr::MakeBitVector(rInsn.GetOperand(0)->GetBitSize(), 0x4)), Expr::MakeBitVector(1, 0x1))));
+  /* semantic: op0.val = res.val */
+  AllExpr.push_back(Expr::MakeAssign(
+    rInsn.GetOperand(0),
+    Expr::MakeVar("res", VariableExpression::Use)));
+  /* semantic: free_var('res') */
+  AllExpr.push_back(Expr::MakeVar("res", VariableExpression::Free));
+  rInsn.SetSemantic(AllExpr);
+}
+
+void X86Architecture::Semantic_002(Instruction& rInsn, u8 Mode)
+{
+  Expression::LSPType AllExpr;
+  rInsn.SetUpdatedFlags(X86_FlCf | X86_FlPf | X86_FlAf | X86_FlZf | X86_FlSf | X86_FlOf);
+  rInsn.SetClearedFlags(X86_FlAf | X86_FlOf | X86_FlCf);
+  AllExpr.push_back(Expr::MakeAssign(Expr::MakeId(X86_FlAf, &m_CpuInfo), Expr::MakeBoolean(false)));
+  AllExpr.push_back(Expr::MakeAssign(Expr::MakeId(X86_FlOf, &m_CpuInfo), Expr::MakeBoolean(false)));
+  AllExpr.push_back(Expr::MakeAssign(Expr::MakeId(X86_FlCf, &m_CpuInfo), Expr::MakeBoolean(false)));
+  /* semantic: alloc_var('res', op0.bit) */
+  AllExpr.push_back(Expr::MakeVar("res", VariableExpression::Alloc, rInsn.GetOperand(0)->GetBitSize()));
+  /* semantic: res = op0.val | op1.val */
+  AllExpr.push_back(Expr::MakeAssign(
+    Expr::MakeVar("res", VariableExpression::Use),
+    Expr::MakeBinOp(
+      OperationExpression::OpOr,
+      rInsn.GetOperand(0),
+      rInsn.GetOperand(1))));
+  /* semantic: of.id = int1(0)
+  cf.id = int1(0)
+  call('sign_flag')
+  call('zero_flag')
+  call('parity_flag')
+  op0.val = res */
+  AllExpr.push_back(Expr::MakeAssign(
+    Expr::MakeId(X86_FlOf, &m_CpuInfo),
+    Expr::MakeBitVector(1, 0x0)));
+  AllExpr.push_back(Expr::MakeAssign(
+    Expr::MakeId(X86_FlCf, &m_CpuInfo),
+    Expr::MakeBitVector(1, 0x0)));
+  AllExpr.push_back(Expr::MakeAssign(
+    Expr::MakeId(X86_FlSf, &m_CpuInfo),
+    Expr::MakeBinOp(OperationExpression::OpBcast, Expr::MakeBinOp(
+      OperationExpression::OpLrs,
+      Expr::MakeVar("res", VariableExpression::Use),
+      Expr::MakeBinOp(
+        OperationExpression::OpSub,
+        Expr::MakeBitVector(rInsn.GetOperand(0)->GetBitSize(), rInsn.GetOperand(0)->GetBitSize()),
+        Expr::MakeBitVector(rInsn.GetOperand(0)->GetBitSize(), 0x1))), Expr::MakeBitVector(1, 0x1))));
+  AllExpr.push_back(Expr::MakeAssign(
+    Expr::MakeId(X86_FlZf, &m_CpuInfo),
+    Expr::MakeTernaryCond(ConditionExpression::CondEq,
+    Expr::MakeVar("res", VariableExpression::Use),
+    Expr::MakeBitVector(rInsn.GetOperand(0)->GetBitSize(), 0x0),
+    Expr::MakeBitVector(1, 0x1), Expr::MakeBitVector(1, 0x0))));
+  AllExpr.push_back(Expr::MakeVar("pf_tmp", VariableExpression::Alloc, m_CpuInfo.GetSizeOfRegisterInBit(X86_FlPf)));
+  AllExpr.push_back(Expr::MakeAssign(
+    Expr::MakeVar("pf_tmp", VariableExpression::Use),
+    Expr::MakeBitVector(1, 0x1)));
+  AllExpr.push_back(Expr::MakeAssign(
+    Expr::MakeVar("pf_tmp", VariableExpression::Use),
+    Expr::MakeBinOp(
+      OperationExpression::OpXor,
+      Expr::MakeVar("pf_tmp", VariableExpression::Use),
+      Expr::MakeBinOp(OperationExpression::OpBcast, Expr::MakeBinOp(
+        OperationExpression::OpLrs,
+        Expr::MakeVar("res", VariableExpression::Use),
+        Expr::MakeBitVector(rInsn.GetOperand(0)->GetBitSize(), 0x0)), Expr::MakeBitVector(1, 0x1))))
+  );
+  AllExpr.push_back(Expr::MakeAssign(
+    Expr::MakeVar("pf_tmp", VariableExpression::Use),
+    Expr::MakeBinOp(
+      OperationExpression::OpXor,
+      Expr::MakeVar("pf_tmp", VariableExpression::Use),
+      Expr::MakeBinOp(OperationExpression::OpBcast, Expr::MakeBinOp(
+        OperationExpression::OpLrs,
+        Expr::MakeVar("res", VariableExpression::Use),
+        Expr::MakeBitVector(rInsn.GetOperand(0)->GetBitSize(), 0x1)), Expr::MakeBitVector(1, 0x1))))
+  );
+  AllExpr.push_back(Expr::MakeAssign(
+    Expr::MakeVar("pf_tmp", VariableExpression::Use),
+    Expr::MakeBinOp(
+      OperationExpression::OpXor,
+      Expr::MakeVar("pf_tmp", VariableExpression::Use),
+      Expr::MakeBinOp(OperationExpression::OpBcast, Expr::MakeBinOp(
+        OperationExpression::OpLrs,
+        Expr::MakeVar("res", VariableExpression::Use),
+        Expr::MakeBitVector(rInsn.GetOperand(0)->GetBitSize(), 0x2)), Expr::MakeBitVector(1, 0x1))))
+  );
+  AllExpr.push_back(Expr::MakeAssign(
+    Expr::MakeVar("pf_tmp", VariableExpression::Use),
+    Expr::MakeBinOp(
+      OperationExpression::OpXor,
+      Expr::MakeVar("pf_tmp", VariableExpression::Use),
+      Expr::MakeBinOp(OperationExpression::OpBcast, Expr::MakeBinOp(
+        OperationExpression::OpLrs,
+        Expr::MakeVar("res", VariableExpression::Use),
+        Expr::MakeBitVector(rInsn.GetOperand(0)->GetBitSize(), 0x3)), Expr::MakeBitVector(1, 0x1))))
+  );
+  AllExpr.push_back(Expr::MakeAssign(
+    Expr::MakeVar("pf_tmp", VariableExpression::Use),
+    Expr::MakeBinOp(
+      OperationExpression::OpXor,
+      Expr::MakeVar("pf_tmp", VariableExpression::Use),
+      Expr::MakeBinOp(OperationExpression::OpBcast, Expr::MakeBinOp(
+        OperationExpression::OpLrs,
+        Expr::MakeVar("res", VariableExpression::Use),
+        Expr::MakeBitVector(rInsn.GetOperand(0)->GetBitSize(), 0x4)), Expr::MakeBitVector(1, 0x1))))
+  );
+  AllExpr.push_back(Expr::MakeAssign(
+    Expr::MakeVar("pf_tmp", VariableExpression::Use),
+    Expr::MakeBinOp(
+      OperationExpression::OpXor,
+      Expr::MakeVar("pf_tmp", VariableExpression::Use),
+      Expr::MakeBinOp(OperationExpression::OpBcast, Expr::MakeBinOp(
+        OperationExpression::OpLrs,
+        Expr::MakeVar("res", VariableExpression::Use),
+        Expr::MakeBitVector(rInsn.GetOperand(0)->GetBitSize(), 0x5)), Expr::MakeBitVector(1, 0x1))))
+  );
+  AllExpr.push_back(Expr::MakeAssign(
+    Expr::MakeVar("pf_tmp", VariableExpression::Use),
+    Expr::MakeBinOp(
+      OperationExpression::OpXor,
+      Expr::MakeVar("pf_tmp", VariableExpression::Use),
+      Expr::MakeBinOp(OperationExpression::OpBcast, Expr::MakeBinOp(
+        OperationExpression::OpLrs,
+        Expr::MakeVar("res", VariableExpression::Use),
+        Expr::MakeBitVector(rInsn.GetOperand(0)->GetBitSize(), 0x6)), Expr::MakeBitVector(1, 0x1))))
+  );
+  AllExpr.push_back(Expr::MakeAssign(
+    Expr::MakeVar("pf_tmp", VariableExpression::Use),
+    Expr::MakeBinOp(
+      OperationExpression::OpXor,
+      Expr::MakeVar("pf_tmp", VariableExpression::Use),
+      Expr::MakeBinOp(OperationExpression::OpBcast, Expr::MakeBinOp(
+        OperationExpression::OpLrs,
+        Expr::MakeVar("res", VariableExpression::Use),
+        Expr::MakeBitVector(rInsn.GetOperand(0)->GetBitSize(), 0x7)), Expr::MakeBitVector(1, 0x1))))
+  );
+  AllExpr.push_back(Expr::MakeAssign(
+    Expr::MakeId(X86_FlPf, &m_CpuInfo),
+    Expr::MakeVar("pf_tmp", VariableExpression::Use)));
+  AllExpr.push_back(Expr::MakeVar("pf_tmp", VariableExpression::Free));
+  AllExpr.push_back(Expr::MakeAssign(
+    rInsn.GetOperand(0),
+    Expr::MakeVar("res", VariableExpression::Use)));
+  /* semantic: free_var('res') */
+  AllExpr.push_back(Expr::MakeVar("res", VariableExpression::Free));
+  rInsn.SetSemantic(AllExpr);
+}
+
+void X86Architecture::Semantic_003(Instruction& rInsn, u8 Mode)
+{
+  Expression::LSPType AllExpr;
+  rInsn.SetTestedFlags(X86_FlCf);
+  rInsn.SetUpdatedFlags(X86_FlCf | X86_FlPf | X86_FlAf | X86_FlZf | X86_FlSf | X86_FlOf);
+  /* semantic: alloc_var('res', op0.bit) */
+  AllExpr.push_back(Expr::MakeVar("res", VariableExpression::Alloc, rInsn.GetOperand(0)->GetBitSize()));
+  /* semantic: res.val = op0.val + op1.val + bit_cast(cf.id, int(op0.bit, op0.bit)) */
+  AllExpr.push_back(Expr::MakeAssign(
+    Expr::MakeVar("res", VariableExpression::Use),
+    Expr::MakeBinOp(
+      OperationExpression::OpAdd,
+      Expr::MakeBinOp(
+        OperationExpression::OpAdd,
+        rInsn.GetOperand(0),
+        rInsn.GetOperand(1)),
+      Expr::MakeBinOp(OperationExpression::OpBcast, Expr::MakeId(X86_FlCf, &m_CpuInfo), Expr::MakeBitVector(rInsn.GetOperand(0)->GetBitSize(), rInsn.GetOperand(0)->GetBitSize())))));
+  /* semantic: call('overflow_flag_add') */
+  AllExpr.push_back(Expr::MakeAssign(
+    Expr::MakeId(X86_FlOf, &m_CpuInfo),
+    Expr::MakeBinOp(OperationExpression::OpBcast, Expr::MakeBinOp(
+      OperationExpression::OpLrs,
+      Expr::MakeBinOp(
+        OperationExpression::OpAnd,
+        Expr::MakeBinOp(
+          OperationExpression::OpXor,
+          rInsn.GetOperand(0),
+          Expr::MakeVar("res", VariableExpression::Use)),
+        Expr::MakeUnOp(
+          OperationExpression::OpNot,
+          Expr::MakeBinOp(
+            OperationExpression::OpXor,
+            rInsn.GetOperand(0),
+            rInsn.GetOperand(1)))),
+      Expr::MakeBinOp(
+        OperationExpression::OpSub,
+        Expr::MakeBitVector(rInsn.GetOperand(0)->GetBitSize(), rInsn.GetOperand(0)->GetBitSize()),
+        Expr::MakeBitVector(rInsn.GetOperand(0)->GetBitSize(), 0x1))), Expr::MakeBitVector(1, 0x1))));
+  /* semantic: call('carry_flag_add') */
+  AllExpr.push_back(Expr::MakeAssign(
+    Expr::MakeId(X86_FlCf, &m_CpuInfo),
+    Expr::MakeBinOp(OperationExpression::OpBcast, Expr::MakeBinOp(
+      OperationExpression::OpLrs,
+      Expr::MakeBinOp(
+        OperationExpression::OpXor,
+        Expr::MakeBinOp(
+          OperationExpression::OpAnd,
+          rInsn.GetOperand(0),
+          rInsn.GetOperand(1)),
+        Expr::MakeBinOp(
+          OperationExpression::OpAnd,
+          Expr::MakeBinOp(
+            OperationExpression::OpXor,
+            Expr::MakeBinOp(
+              OperationExpression::OpXor,
+              rInsn.GetOperand(0),
+              rInsn.GetOperand(1)),
+            Expr::MakeVar("res", VariableExpression::Use)),
+          Expr::MakeBinOp(
+            OperationExpression::OpXor,
+            rInsn.GetOperand(0),
+            rInsn.GetOperand(1)))),
+      Expr::MakeBinOp(
+        OperationExpression::OpSub,
+        Expr::MakeBitVector(rInsn.GetOperand(0)->GetBitSize(), rInsn.GetOperand(0)->GetBitSize()),
+        Expr::MakeBitVector(rInsn.GetOperand(0)->GetBitSize(), 0x1))), Expr::MakeBitVector(1, 0x1))));
+  /* semantic: call('sign_flag') */
+  AllExpr.push_back(Expr::MakeAssign(
+    Expr::MakeId(X86_FlSf, &m_CpuInfo),
+    Expr::MakeBinOp(OperationExpression::OpBcast, Expr::MakeBinOp(
+      OperationExpression::OpLrs,
+      Expr::MakeVar("res", VariableExpression::Use),
+      Expr::MakeBinOp(
+        OperationExpression::OpSub,
+        Expr::MakeBitVector(rInsn.GetOperand(0)->GetBitSize(), rInsn.GetOperand(0)->GetBitSize()),
+        Expr::MakeBitVector(rInsn.GetOperand(0)->GetBitSize(), 0x1))), Expr::MakeBitVector(1, 0x1))));
+  /* semantic: call('zero_flag') */
+  AllExpr.push_back(Expr::MakeAssign(
+    Expr::MakeId(X86_FlZf, &m_CpuInfo),
+    Expr::MakeTernaryCond(ConditionExpression::CondEq,
+    Expr::MakeVar("res", VariableExpression::Use),
+    Expr::MakeBitVector(rInsn.GetOperand(0)->GetBitSize(), 0x0),
+    Expr::MakeBitVector(1, 0x1), Expr::MakeBitVector(1, 0x0))));
+  /* semantic: call('parity_flag') */
+  AllExpr.push_back(Expr::MakeVar("pf_tmp", VariableExpression::Alloc, m_CpuInfo.GetSizeOfRegisterInBit(X86_FlPf)));
+  AllExpr.push_back(Expr::MakeAssign(
+    Expr::MakeVar("pf_tmp", VariableExpression::Use),
+    Expr::MakeBitVector(1, 0x1)));
+  AllExpr.push_back(Expr::MakeAssign(
+    Expr::MakeVar("pf_tmp", VariableExpression::Use),
+    Expr::MakeBinOp(
+      OperationExpression::OpXor,
+      Expr::MakeVar("pf_tmp", VariableExpression::Use),
+      Expr::MakeBinOp(OperationExpression::OpBcast, Expr::MakeBinOp(
+        OperationExpression::OpLrs,
+        Expr::MakeVar("res", VariableExpression::Use),
+        Expr::MakeBitVector(rInsn.GetOperand(0)->GetBitSize(), 0x0)), Expr::MakeBitVector(1, 0x1))))
+  );
+  AllExpr.push_back(Expr::MakeAssign(
+    Expr::MakeVar("pf_tmp", VariableExpression::Use),
+    Expr::MakeBinOp(
+      OperationExpression::OpXor,
+      Expr::MakeVar("pf_tmp", VariableExpression::Use),
+      Expr::MakeBinOp(OperationExpression::OpBcast, Expr::MakeBinOp(
+        OperationExpression::OpLrs,
+        Expr::MakeVar("res", VariableExpression::Use),
+        Expr::MakeBitVector(rInsn.GetOperand(0)->GetBitSize(), 0x1)), Expr::MakeBitVector(1, 0x1))))
+  );
+  AllExpr.push_back(Expr::MakeAssign(
+    Expr::MakeVar("pf_tmp", VariableExpression::Use),
+    Expr::MakeBinOp(
+      OperationExpression::OpXor,
+      Expr::MakeVar("pf_tmp", VariableExpression::Use),
+      Expr::MakeBinOp(OperationExpression::OpBcast, Expr::MakeBinOp(
+        OperationExpression::OpLrs,
+        Expr::MakeVar("res", VariableExpression::Use),
+        Expr::MakeBitVector(rInsn.GetOperand(0)->GetBitSize(), 0x2)), Expr::MakeBitVector(1, 0x1))))
+  );
+  AllExpr.push_back(Expr::MakeAssign(
+    Expr::MakeVar("pf_tmp", VariableExpression::Use),
+    Expr::MakeBinOp(
+      OperationExpression::OpXor,
+      Expr::MakeVar("pf_tmp", VariableExpression::Use),
+      Expr::MakeBinOp(OperationExpression::OpBcast, Expr::MakeBinOp(
+        OperationExpression::OpLrs,
+        Expr::MakeVar("res", VariableExpression::Use),
+        Expr::MakeBitVector(rInsn.GetOperand(0)->GetBitSize(), 0x3)), Expr::MakeBitVector(1, 0x1))))
+  );
+  AllExpr.push_back(Expr::MakeAssign(
+    Expr::MakeVar("pf_tmp", VariableExpression::Use),
+    Expr::MakeBinOp(
+      OperationExpression::OpXor,
+      Expr::MakeVar("pf_tmp", VariableExpression::Use),
+      Expr::MakeBinOp(OperationExpression::OpBcast, Expr::MakeBinOp(
+        OperationExpression::OpLrs,
+        Expr::MakeVar("res", VariableExpression::Use),
+        Expr::MakeBitVector(rInsn.GetOperand(0)->GetBitSize(), 0x4)), Expr::MakeBitVector(1, 0x1))))
+  );
+  AllExpr.push_back(Expr::MakeAssign(
+    Expr::MakeVar("pf_tmp", VariableExpression::Use),
+    Expr::MakeBinOp(
+      OperationExpression::OpXor,
+      Expr::MakeVar("pf_tmp", VariableExpression::Use),
+      Expr::MakeBinOp(OperationExpression::OpBcast, Expr::MakeBinOp(
+        OperationExpression::OpLrs,
+        Expr::MakeVar("res", VariableExpression::Use),
+        Expr::MakeBitVector(rInsn.GetOperand(0)->GetBitSize(), 0x5)), Expr::MakeBitVector(1, 0x1))))
+  );
+  AllExpr.push_back(Expr::MakeAssign(
+    Expr::MakeVar("pf_tmp", VariableExpression::Use),
+    Expr::MakeBinOp(
+      OperationExpression::OpXor,
+      Expr::MakeVar("pf_tmp", VariableExpression::Use),
+      Expr::MakeBinOp(OperationExpression::OpBcast, Expr::MakeBinOp(
+        OperationExpression::OpLrs,
+        Expr::MakeVar("res", VariableExpression::Use),
+        Expr::MakeBitVector(rInsn.GetOperand(0)->GetBitSize(), 0x6)), Expr::MakeBitVector(1, 0x1))))
+  );
+  AllExpr.push_back(Expr::MakeAssign(
+    Expr::MakeVar("pf_tmp", VariableExpression::Use),
+    Expr::MakeBinOp(
+      OperationExpression::OpXor,
+      Expr::MakeVar("pf_tmp", VariableExpression::Use),
+      Expr::MakeBinOp(OperationExpression::OpBcast, Expr::MakeBinOp(
+        OperationExpression::OpLrs,
+        Expr::MakeVar("res", VariableExpression::Use),
+        Expr::MakeBitVector(rInsn.GetOperand(0)->GetBitSize(), 0x7)), Expr::MakeBitVector(1, 0x1))))
+  );
+  AllExpr.push_back(Expr::MakeAssign(
+    Expr::MakeId(X86_FlPf, &m_CpuInfo),
+    Expr::MakeVar("pf_tmp", VariableExpression::Use)));
+  AllExpr.push_back(Expr::MakeVar("pf_tmp", VariableExpression::Free));
+  /* semantic: call('adjust_flag') */
+  AllExpr.push_back(Expr::MakeAssign(
+    Expr::MakeId(X86_FlAf, &m_CpuInfo),
+    Expr::MakeBinOp(OperationExpression::OpBcast, Expr::MakeBinOp(
+      OperationExpression::OpLrs,
+      Expr::MakeBinOp(
+        OperationExpression::OpXor,
+        Expr::MakeBinOp(
+          OperationExpression::OpXor,
+          rInsn.GetOperand(0),
+          rInsn.GetOperand(1)),
+        Expr::MakeVar("res", VariableExpression::Use)),
+      Expr::MakeBitVector(rInsn.GetOperand(0)->GetBitSize(), 0x4)), Expr::MakeBitVector(1, 0x1))));
+  /* semantic: op0.val = res.val */
+  AllExpr.push_back(Expr::MakeAssign(
+    rInsn.GetOperand(0),
+    Expr::MakeVar("res", VariableExpression::Use)));
+  /* semantic: free_var('res') */
+  AllExpr.push_back(Expr::MakeVar("res", VariableExpression::Free));
+  rInsn.SetSemantic(AllExpr);
+}
+
+void X86Architecture::Semantic_004(Instruction& rInsn, u8 Mode)
+{
+  Expression::LSPType AllExpr;
+  rInsn.SetTestedFlags(X86_FlCf);
+  rInsn.SetUpdatedFlags(X86_FlCf | X86_FlPf | X86_FlAf | X86_FlZf | X86_FlSf | X86_FlOf);
+  /* semantic: alloc_var('res', op0.bit) */
+  AllExpr.push_back(Expr::MakeVar("res", VariableExpression::Alloc, rInsn.GetOperand(0)->GetBitSize()));
+  /* semantic: res = op0.val - op1.val - bit_cast(cf.id, int(op0.bit, op0.bit)) */
+  AllExpr.push_back(Expr::MakeAssign(
+    Expr::MakeVar("res", VariableExpression::Use),
+    Expr::MakeBinOp(
+      OperationExpression::OpSub,
+      Expr::MakeBinOp(
+        OperationExpression::OpSub,
+        rInsn.GetOperand(0),
+        rInsn.GetOperand(1)),
+      Expr::MakeBinOp(OperationExpression::OpBcast, Expr::MakeId(X86_FlCf, &m_CpuInfo), Expr::MakeBitVector(rInsn.GetOperand(0)->GetBitSize(), rInsn.GetOperand(0)->GetBitSize())))));
+  /* semantic: call('overflow_flag_sub') */
+  AllExpr.push_back(Expr::MakeAssign(
+    Expr::MakeId(X86_FlOf, &m_CpuInfo),
+    Expr::MakeBinOp(OperationExpression::OpBcast, Expr::MakeBinOp(
+      OperationExpression::OpLrs,
+      Expr::MakeBinOp(
+        OperationExpression::OpAnd,
+        Expr::MakeBinOp(
+          OperationExpression::OpXor,
+          rInsn.GetOperand(0),
+          Expr::MakeVar("res", VariableExpression::Use)),
+        Expr::MakeBinOp(
+          OperationExpression::OpXor,
+          rInsn.GetOperand(0),
+          rInsn.GetOperand(1))),
+      Expr::MakeBinOp(
+        OperationExpression::OpSub,
+        Expr::MakeBitVector(rInsn.GetOperand(0)->GetBitSize(), rInsn.GetOperand(0)->GetBitSize()),
+        Expr::MakeBitVector(rInsn.GetOperand(0)->GetBitSize(), 0x1))), Expr::MakeBitVector(1, 0x1))));
+  /* semantic: call('carry_flag_sub') */
+  AllExpr.push_back(Expr::MakeAssign(
+    Expr::MakeId(X86_FlCf, &m_CpuInfo),
+    Expr::MakeBinOp(OperationExpression::OpBcast, Expr::MakeBinOp(
+      OperationExpression::OpLrs,
+      Expr::MakeBinOp(
+        OperationExpression::OpXor,
+        Expr::MakeBinOp(
+          OperationExpression::OpXor,
+          Expr::MakeBinOp(
+            OperationExpression::OpXor,
+            rInsn.GetOperand(0),
+            rInsn.GetOperand(1)),
+          Expr::MakeVar("res", VariableExpression::Use)),
+        Expr::MakeBinOp(
+          OperationExpression::OpAnd,
+          Expr::MakeBinOp(
+            OperationExpression::OpXor,
+            rInsn.GetOperand(0),
+            Expr::MakeVar("res", VariableExpression::Use)),
+          Expr::MakeBinOp(
+            OperationExpression::OpXor,
+            rInsn.GetOperand(0),
+            rInsn.GetOperand(1)))),
+      Expr::MakeBinOp(
+        OperationExpression::OpSub,
+        Expr::MakeBitVector(rInsn.GetOperand(0)->GetBitSize(), rInsn.GetOperand(0)->GetBitSize()),
+        Expr::MakeBitVector(rInsn.GetOperand(0)->GetBitSize(), 0x1))), Expr::MakeBitVector(1, 0x1))));
+  /* semantic: call('sign_flag') */
+  AllExpr.push_back(Expr::MakeAssign(
+    Expr::MakeId(X86_FlSf, &m_CpuInfo),
+    Expr::MakeBinOp(OperationExpression::OpBcast, Expr::MakeBinOp(
+      OperationExpression::OpLrs,
+      Expr::MakeVar("res", VariableExpression::Use),
+      Expr::MakeBinOp(
+        OperationExpression::OpSub,
+        Expr::MakeBitVector(rInsn.GetOperand(0)->GetBitSize(), rInsn.GetOperand(0)->GetBitSize()),
+        Expr::MakeBitVector(rInsn.GetOperand(0)->GetBitSize(), 0x1))), Expr::MakeBitVector(1, 0x1))));
+  /* semantic: call('zero_flag') */
+  AllExpr.push_back(Expr::MakeAssign(
+    Expr::MakeId(X86_FlZf, &m_CpuInfo),
+    Expr::MakeTernaryCond(ConditionExpression::CondEq,
+    Expr::MakeVar("res", VariableExpression::Use),
+    Expr::MakeBitVector(rInsn.GetOperand(0)->GetBitSize(), 0x0),
+    Expr::MakeBitVector(1, 0x1), Expr::MakeBitVector(1, 0x0))));
+  /* semantic: call('parity_flag') */
+  AllExpr.push_back(Expr::MakeVar("pf_tmp", VariableExpression::Alloc, m_CpuInfo.GetSizeOfRegisterInBit(X86_FlPf)));
+  AllExpr.push_back(Expr::MakeAssign(
+    Expr::MakeVar("pf_tmp", VariableExpression::Use),
+    Expr::MakeBitVector(1, 0x1)));
+  AllExpr.push_back(Expr::MakeAssign(
+    Expr::MakeVar("pf_tmp", VariableExpression::Use),
+    Expr::MakeBinOp(
+      OperationExpression::OpXor,
+      Expr::MakeVar("pf_tmp", VariableExpression::Use),
+      Expr::MakeBinOp(OperationExpression::OpBcast, Expr::MakeBinOp(
+        OperationExpression::OpLrs,
+        Expr::MakeVar("res", VariableExpression::Use),
+        Expr::MakeBitVector(rInsn.GetOperand(0)->GetBitSize(), 0x0)), Expr::MakeBitVector(1, 0x1))))
+  );
+  AllExpr.push_back(Expr::MakeAssign(
+    Expr::MakeVar("pf_tmp", VariableExpression::Use),
+    Expr::MakeBinOp(
+      OperationExpression::OpXor,
+      Expr::MakeVar("pf_tmp", VariableExpression::Use),
+      Expr::MakeBinOp(OperationExpression::OpBcast, Expr::MakeBinOp(
+        OperationExpression::OpLrs,
+        Expr::MakeVar("res", VariableExpression::Use),
+        Expr::MakeBitVector(rInsn.GetOperand(0)->GetBitSize(), 0x1)), Expr::MakeBitVector(1, 0x1))))
+  );
+  AllExpr.push_back(Expr::MakeAssign(
+    Expr::MakeVar("pf_tmp", VariableExpression::Use),
+    Expr::MakeBinOp(
+      OperationExpression::OpXor,
+      Expr::MakeVar("pf_tmp", VariableExpression::Use),
+      Expr::MakeBinOp(OperationExpression::OpBcast, Expr::MakeBinOp(
+        OperationExpression::OpLrs,
+        Expr::MakeVar("res", VariableExpression::Use),
+        Expr::MakeBitVector(rInsn.GetOperand(0)->GetBitSize(), 0x2)), Expr::MakeBitVector(1, 0x1))))
+  );
+  AllExpr.push_back(Expr::MakeAssign(
+    Expr::MakeVar("pf_tmp", VariableExpression::Use),
+    Expr::MakeBinOp(
+      OperationExpression::OpXor,
+      Expr::MakeVar("pf_tmp", VariableExpression::Use),
+      Expr::MakeBinOp(OperationExpression::OpBcast, Expr::MakeBinOp(
+        OperationExpression::OpLrs,
+        Expr::MakeVar("res", VariableExpression::Use),
+        Expr::MakeBitVector(rInsn.GetOperand(0)->GetBitSize(), 0x3)), Expr::MakeBitVector(1, 0x1))))
+  );
+  AllExpr.push_back(Expr::MakeAssign(
+    Expr::MakeVar("pf_tmp", VariableExpression::Use),
+    Expr::MakeBinOp(
+      OperationExpression::OpXor,
+      Expr::MakeVar("pf_tmp", VariableExpression::Use),
+      Expr::MakeBinOp(OperationExpression::OpBcast, Expr::MakeBinOp(
+        OperationExpression::OpLrs,
+        Expr::MakeVar("res", VariableExpression::Use),
+        Expr::MakeBitVector(rInsn.GetOperand(0)->GetBitSize(), 0x4)), Expr::MakeBitVector(1, 0x1))))
+  );
+  AllExpr.push_back(Expr::MakeAssign(
+    Expr::MakeVar("pf_tmp", VariableExpression::Use),
+    Expr::MakeBinOp(
+      OperationExpression::OpXor,
+      Expr::MakeVar("pf_tmp", VariableExpression::Use),
+      Expr::MakeBinOp(OperationExpression::OpBcast, Expr::MakeBinOp(
+        OperationExpression::OpLrs,
+        Expr::MakeVar("res", VariableExpression::Use),
+        Expr::MakeBitVector(rInsn.GetOperand(0)->GetBitSize(), 0x5)), Expr::MakeBitVector(1, 0x1))))
+  );
+  AllExpr.push_back(Expr::MakeAssign(
+    Expr::MakeVar("pf_tmp", VariableExpression::Use),
+    Expr::MakeBinOp(
+      OperationExpression::OpXor,
+      Expr::MakeVar("pf_tmp", VariableExpression::Use),
+      Expr::MakeBinOp(OperationExpression::OpBcast, Expr::MakeBinOp(
+        OperationExpression::OpLrs,
+        Expr::MakeVar("res", VariableExpression::Use),
+        Expr::MakeBitVector(rInsn.GetOperand(0)->GetBitSize(), 0x6)), Expr::MakeBitVector(1, 0x1))))
+  );
+  AllExpr.push_back(Expr::MakeAssign(
+    Expr::MakeVar("pf_tmp", VariableExpression::Use),
+    Expr::MakeBinOp(
+      OperationExpression::OpXor,
+      Expr::MakeVar("pf_tmp", VariableExpression::Use),
+      Expr::MakeBinOp(OperationExpression::OpBcast, Expr::MakeBinOp(
+        OperationExpression::OpLrs,
+        Expr::MakeVar("res", VariableExpression::Use),
+        Expr::MakeBitVector(rInsn.GetOperand(0)->GetBitSize(), 0x7)), Expr::MakeBitVector(1, 0x1))))
+  );
+  AllExpr.push_back(Expr::MakeAssign(
+    Expr::MakeId(X86_FlPf, &m_CpuInfo),
+    Expr::MakeVar("pf_tmp", VariableExpression::Use)));
+  AllExpr.push_back(Expr::MakeVar("pf_tmp", VariableExpression::Free));
+  /* semantic: call('adjust_flag') */
+  AllExpr.push_back(Expr::MakeAssign(
+    Expr::MakeId(X86_FlAf, &m_CpuInfo),
+    Expr::MakeBinOp(OperationExpression::OpBcast, Expr::MakeBinOp(
+      OperationExpression::OpLrs,
+      Expr::MakeBinOp(
+        OperationExpression::OpXor,
+        Expr::MakeBinOp(
+          OperationExpression::OpXor,
+          rInsn.GetOperand(0),
+          rInsn.GetOperand(1)),
+        Expr::MakeVar("res", VariableExpression::Use)),
+      Expr::MakeBitVector(rInsn.GetOperand(0)->GetBitSize(), 0x4)), Expr::MakeBitVector(1, 0x1))));
+  /* semantic: op0.val = res.val */
+  AllExpr.push_back(Expr::MakeAssign(
+    rInsn.GetOperand(0),
+    Expr::MakeVar("res", VariableExpression::Use)));
+  /* semantic: free_var('res') */
+  AllExpr.push_back(Expr::MakeVar("res", VariableExpression::Free));
+  rInsn.SetSemantic(AllExpr);
+}
+
+void X86Architecture::Semantic_005(Instruction& rInsn, u8 Mode)
+{
+  Expression::LSPType AllExpr;
+  rInsn.SetUpdatedFlags(X86_FlCf | X86_FlPf | X86_FlAf | X86_FlZf | X86_FlSf | X86_FlOf);
+  rInsn.SetClearedFlags(X86_FlAf | X86_FlOf | X86_FlCf);
+  AllExpr.push_back(Expr::MakeAssign(Expr::MakeId(X86_FlAf, &m_CpuInfo), Expr::MakeBoolean(false)));
+  AllExpr.push_back(Expr::MakeAssign(Expr::MakeId(X86_FlOf, &m_CpuInfo), Expr::MakeBoolean(false)));
+  AllExpr.push_back(Expr::MakeAssign(Expr::MakeId(X86_FlCf, &m_CpuInfo), Expr::MakeBoolean(false)));
+  /* semantic: alloc_var('res', op0.bit) */
+  AllExpr.push_back(Expr::MakeVar("res", VariableExpression::Alloc, rInsn.GetOperand(0)->GetBitSize()));
+  /* semantic: res = op0.val & op1.val */
+  AllExpr.push_back(Expr::MakeAssign(
+    Expr::MakeVar("res", VariableExpression::Use),
+    Expr::MakeBinOp(
+      OperationExpression::OpAnd,
+      rInsn.GetOperand(0),
+      rInsn.GetOperand(1))));
+  /* semantic: of.id = int1(0)
+  cf.id = int1(0)
+  call('sign_flag')
+  call('zero_flag')
+  call('parity_flag')
+  op0.val = res */
+  AllExpr.push_back(Expr::MakeAssign(
+    Expr::MakeId(X86_FlOf, &m_CpuInfo),
+    Expr::MakeBitVector(1, 0x0)));
+  AllExpr.push_back(Expr::MakeAssign(
+    Expr::MakeId(X86_FlCf, &m_CpuInfo),
+    Expr::MakeBitVector(1, 0x0)));
+  AllExpr.push_back(Expr::MakeAssign(
+    Expr::MakeId(X86_FlSf, &m_CpuInfo),
+    Expr::MakeBinOp(OperationExpression::OpBcast, Expr::MakeBinOp(
+      OperationExpression::OpLrs,
+      Expr::MakeVar("res", VariableExpression::Use),
+      Expr::MakeBinOp(
+        OperationExpression::OpSub,
+        Expr::MakeBitVector(rInsn.GetOperand(0)->GetBitSize(), rInsn.GetOperand(0)->GetBitSize()),
+        Expr::MakeBitVector(rInsn.GetOperand(0)->GetBitSize(), 0x1))), Expr::MakeBitVector(1, 0x1))));
+  AllExpr.push_back(Expr::MakeAssign(
+    Expr::MakeId(X86_FlZf, &m_CpuInfo),
+    Expr::MakeTernaryCond(ConditionExpression::CondEq,
+    Expr::MakeVar("res", VariableExpression::Use),
+    Expr::MakeBitVector(rInsn.GetOperand(0)->GetBitSize(), 0x0),
+    Expr::MakeBitVector(1, 0x1), Expr::MakeBitVector(1, 0x0))));
+  AllExpr.push_back(Expr::MakeVar("pf_tmp", VariableExpression::Alloc, m_CpuInfo.GetSizeOfRegisterInBit(X86_FlPf)));
+  AllExpr.push_back(Expr::MakeAssign(
+    Expr::MakeVar("pf_tmp", VariableExpression::Use),
+    Expr::MakeBitVector(1, 0x1)));
+  AllExpr.push_back(Expr::MakeAssign(
+    Expr::MakeVar("pf_tmp", VariableExpression::Use),
+    Expr::MakeBinOp(
+      OperationExpression::OpXor,
+      Expr::MakeVar("pf_tmp", VariableExpression::Use),
+      Expr::MakeBinOp(OperationExpression::OpBcast, Expr::MakeBinOp(
+        OperationExpression::OpLrs,
+        Expr::MakeVar("res", VariableExpression::Use),
+        Expr::MakeBitVector(rInsn.GetOperand(0)->GetBitSize(), 0x0)), Expr::MakeBitVector(1, 0x1))))
+  );
+  AllExpr.push_back(Expr::MakeAssign(
+    Expr::MakeVar("pf_tmp", VariableExpression::Use),
+    Expr::MakeBinOp(
+      OperationExpression::OpXor,
+      Expr::MakeVar("pf_tmp", VariableExpression::Use),
+      Expr::MakeBinOp(OperationExpression::OpBcast, Expr::MakeBinOp(
+        OperationExpression::OpLrs,
+        Expr::MakeVar("res", VariableExpression::Use),
+        Expr::MakeBitVector(rInsn.GetOperand(0)->GetBitSize(), 0x1)), Expr::MakeBitVector(1, 0x1))))
+  );
+  AllExpr.push_back(Expr::MakeAssign(
+    Expr::MakeVar("pf_tmp", VariableExpression::Use),
+    Expr::MakeBinOp(
+      OperationExpression::OpXor,
+      Expr::MakeVar("pf_tmp", VariableExpression::Use),
+      Expr::MakeBinOp(OperationExpression::OpBcast, Expr::MakeBinOp(
+        OperationExpression::OpLrs,
+        Expr::MakeVar("res", VariableExpression::Use),
+        Expr::MakeBitVector(rInsn.GetOperand(0)->GetBitSize(), 0x2)), Expr::MakeBitVector(1, 0x1))))
+  );
+  AllExpr.push_back(Expr::MakeAssign(
+    Expr::MakeVar("pf_tmp", VariableExpression::Use),
+    Expr::MakeBinOp(
+      OperationExpression::OpXor,
+      Expr::MakeVar("pf_tmp", VariableExpression::Use),
+      Expr::MakeBinOp(OperationExpression::OpBcast, Expr::MakeBinOp(
+        OperationExpression::OpLrs,
+        Expr::MakeVar("res", VariableExpression::Use),
+        Expr::MakeBitVector(rInsn.GetOperand(0)->GetBitSize(), 0x3)), Expr::MakeBitVector(1, 0x1))))
+  );
+  AllExpr.push_back(Expr::MakeAssign(
+    Expr::MakeVar("pf_tmp", VariableExpression::Use),
+    Expr::MakeBinOp(
+      OperationExpression::OpXor,
+      Expr::MakeVar("pf_tmp", VariableExpression::Use),
+      Expr::MakeBinOp(OperationExpression::OpBcast, Expr::MakeBinOp(
+        OperationExpression::OpLrs,
+        Expr::MakeVar("res", VariableExpression::Use),
+        Expr::MakeBitVector(rInsn.GetOperand(0)->GetBitSize(), 0x4)), Expr::MakeBitVector(1, 0x1))))
+  );
+  AllExpr.push_back(Expr::MakeAssign(
+    Expr::MakeVar("pf_tmp", VariableExpression::Use),
+    Expr::MakeBinOp(
+      OperationExpression::OpXor,
+      Expr::MakeVar("pf_tmp", VariableExpression::Use),
+      Expr::MakeBinOp(OperationExpression::OpBcast, Expr::MakeBinOp(
+        OperationExpression::OpLrs,
+        Expr::MakeVar("res", VariableExpression::Use),
+        Expr::MakeBitVector(rInsn.GetOperand(0)->GetBitSize(), 0x5)), Expr::MakeBitVector(1, 0x1))))
+  );
+  AllExpr.push_back(Expr::MakeAssign(
+    Expr::MakeVar("pf_tmp", VariableExpression::Use),
+    Expr::MakeBinOp(
+      OperationExpression::OpXor,
+      Expr::MakeVar("pf_tmp", VariableExpression::Use),
+      Expr::MakeBinOp(OperationExpression::OpBcast, Expr::MakeBinOp(
+        OperationExpression::OpLrs,
+        Expr::MakeVar("res", VariableExpression::Use),
+        Expr::MakeBitVector(rInsn.GetOperand(0)->GetBitSize(), 0x6)), Expr::MakeBitVector(1, 0x1))))
+  );
+  AllExpr.push_back(Expr::MakeAssign(
+    Expr::MakeVar("pf_tmp", VariableExpression::Use),
+    Expr::MakeBinOp(
+      OperationExpression::OpXor,
+      Expr::MakeVar("pf_tmp", VariableExpression::Use),
+      Expr::MakeBinOp(OperationExpression::OpBcast, Expr::MakeBinOp(
+        OperationExpression::OpLrs,
+        Expr::MakeVar("res", VariableExpression::Use),
+        Expr::MakeBitVector(rInsn.GetOperand(0)->GetBitSize(), 0x7)), Expr::MakeBitVector(1, 0x1))))
+  );
+  AllExpr.push_back(Expr::MakeAssign(
+    Expr::MakeId(X86_FlPf, &m_CpuInfo),
+    Expr::MakeVar("pf_tmp", VariableExpression::Use)));
+  AllExpr.push_back(Expr::MakeVar("pf_tmp", VariableExpression::Free));
+  AllExpr.push_back(Expr::MakeAssign(
+    rInsn.GetOperand(0),
+    Expr::MakeVar("res", VariableExpression::Use)));
+  /* semantic: free_var('res') */
+  AllExpr.push_back(Expr::MakeVar("res", VariableExpression::Free));
+  rInsn.SetSemantic(AllExpr);
+}
+
+void X86Architecture::Semantic_006(Instruction& rInsn, u8 Mode)
+{
+  Expression::LSPType AllExpr;
+  rInsn.SetUpdatedFlags(X86_FlCf | X86_FlPf | X86_FlAf | X86_FlZf | X86_FlSf | X86_FlOf);
+  /* semantic: alloc_var('res', op0.bit) */
+  AllExpr.push_back(Expr::MakeVar("res", VariableExpression::Alloc, rInsn.GetOperand(0)->GetBitSize()));
+  /* semantic: res = op0.val - op1.val */
+  AllExpr.push_back(Expr::MakeAssign(
+    Expr::MakeVar("res", VariableExpression::Use),
+    Expr::MakeBinOp(
+      OperationExpression::OpSub,
+      rInsn.GetOperand(0),
+      rInsn.GetOperand(1))));
+  /* semantic: call('overflow_flag_sub') */
+  AllExpr.push_back(Expr::MakeAssign(
+    Expr::MakeId(X86_FlOf, &m_CpuInfo),
+    Expr::MakeBinOp(OperationExpression::OpBcast, Expr::MakeBinOp(
+      OperationExpression::OpLrs,
+      Expr::MakeBinOp(
+        OperationExpression::OpAnd,
+        Expr::MakeBinOp(
+          OperationExpression::OpXor,
+          rInsn.GetOperand(0),
+          Expr::MakeVar("res", VariableExpression::Use)),
+        Expr::MakeBinOp(
+          OperationExpression::OpXor,
+          rInsn.GetOperand(0),
+          rInsn.GetOperand(1))),
+      Expr::MakeBinOp(
+        OperationExpression::OpSub,
+        Expr::MakeBitVector(rInsn.GetOperand(0)->GetBitSize(), rInsn.GetOperand(0)->GetBitSize()),
+        Expr::MakeBitVector(rInsn.GetOperand(0)->GetBitSize(), 0x1))), Expr::MakeBitVector(1, 0x1))));
+  /* semantic: call('carry_flag_sub') */
+  AllExpr.push_back(Expr::MakeAssign(
+    Expr::MakeId(X86_FlCf, &m_CpuInfo),
+    Expr::MakeBinOp(OperationExpression::OpBcast, Expr::MakeBinOp(
+      OperationExpression::OpLrs,
+      Expr::MakeBinOp(
+        OperationExpression::OpXor,
+        Expr::MakeBinOp(
+          OperationExpression::OpXor,
+          Expr::MakeBinOp(
+            OperationExpression::OpXor,
+            rInsn.GetOperand(0),
+            rInsn.GetOperand(1)),
+          Expr::MakeVar("res", VariableExpression::Use)),
+        Expr::MakeBinOp(
+          OperationExpression::OpAnd,
+          Expr::MakeBinOp(
+            OperationExpression::OpXor,
+            rInsn.GetOperand(0),
+            Expr::MakeVar("res", VariableExpression::Use)),
+          Expr::MakeBinOp(
+            OperationExpression::OpXor,
+            rInsn.GetOperand(0),
+            rInsn.GetOperand(1)))),
+      Expr::MakeBinOp(
+        OperationExpression::OpSub,
+        Expr::MakeBitVector(rInsn.GetOperand(0)->GetBitSize(), rInsn.GetOperand(0)->GetBitSize()),
+        Expr::MakeBitVector(rInsn.GetOperand(0)->GetBitSize(), 0x1))), Expr::MakeBitVector(1, 0x1))));
+  /* semantic: call('sign_flag') */
+  AllExpr.push_back(Expr::MakeAssign(
+    Expr::MakeId(X86_FlSf, &m_CpuInfo),
+    Expr::MakeBinOp(OperationExpression::OpBcast, Expr::MakeBinOp(
+      OperationExpression::OpLrs,
+      Expr::MakeVar("res", VariableExpression::Use),
+      Expr::MakeBinOp(
+        OperationExpression::OpSub,
+        Expr::MakeBitVector(rInsn.GetOperand(0)->GetBitSize(), rInsn.GetOperand(0)->GetBitSize()),
+        Expr::MakeBitVector(rInsn.GetOperand(0)->GetBitSize(), 0x1))), Expr::MakeBitVector(1, 0x1))));
+  /* semantic: call('zero_flag') */
+  AllExpr.push_back(Expr::MakeAssign(
+    Expr::MakeId(X86_FlZf, &m_CpuInfo),
+    Expr::MakeTernaryCond(ConditionExpression::CondEq,
+    Expr::MakeVar("res", VariableExpression::Use),
+    Expr::MakeBitVector(rInsn.GetOperand(0)->GetBitSize(), 0x0),
+    Expr::MakeBitVector(1, 0x1), Expr::MakeBitVector(1, 0x0))));
+  /* semantic: call('parity_flag') */
+  AllExpr.push_back(Expr::MakeVar("pf_tmp", VariableExpression::Alloc, m_CpuInfo.GetSizeOfRegisterInBit(X86_FlPf)));
+  AllExpr.push_back(Expr::MakeAssign(
+    Expr::MakeVar("pf_tmp", VariableExpression::Use),
+    Expr::MakeBitVector(1, 0x1)));
+  AllExpr.push_back(Expr::MakeAssign(
+    Expr::MakeVar("pf_tmp", VariableExpression::Use),
+    Expr::MakeBinOp(
+      OperationExpression::OpXor,
+      Expr::MakeVar("pf_tmp", VariableExpression::Use),
+      Expr::MakeBinOp(OperationExpression::OpBcast, Expr::MakeBinOp(
+        OperationExpression::OpLrs,
+        Expr::MakeVar("res", VariableExpression::Use),
+        Expr::MakeBitVector(rInsn.GetOperand(0)->GetBitSize(), 0x0)), Expr::MakeBitVector(1, 0x1))))
+  );
+  AllExpr.push_back(Expr::MakeAssign(
+    Expr::MakeVar("pf_tmp", VariableExpression::Use),
+    Expr::MakeBinOp(
+      OperationExpression::OpXor,
+      Expr::MakeVar("pf_tmp", VariableExpression::Use),
+      Expr::MakeBinOp(OperationExpression::OpBcast, Expr::MakeBinOp(
+        OperationExpression::OpLrs,
+        Expr::MakeVar("res", VariableExpression::Use),
+        Expr::MakeBitVector(rInsn.GetOperand(0)->GetBitSize(), 0x1)), Expr::MakeBitVector(1, 0x1))))
+  );
+  AllExpr.push_back(Expr::MakeAssign(
+    Expr::MakeVar("pf_tmp", VariableExpression::Use),
+    Expr::MakeBinOp(
+      OperationExpression::OpXor,
+      Expr::MakeVar("pf_tmp", VariableExpression::Use),
+      Expr::MakeBinOp(OperationExpression::OpBcast, Expr::MakeBinOp(
+        OperationExpression::OpLrs,
+        Expr::MakeVar("res", VariableExpression::Use),
+        Expr::MakeBitVector(rInsn.GetOperand(0)->GetBitSize(), 0x2)), Expr::MakeBitVector(1, 0x1))))
+  );
+  AllExpr.push_back(Expr::MakeAssign(
+    Expr::MakeVar("pf_tmp", VariableExpression::Use),
+    Expr::MakeBinOp(
+      OperationExpression::OpXor,
+      Expr::MakeVar("pf_tmp", VariableExpression::Use),
+      Expr::MakeBinOp(OperationExpression::OpBcast, Expr::MakeBinOp(
+        OperationExpression::OpLrs,
+        Expr::MakeVar("res", VariableExpression::Use),
+        Expr::MakeBitVector(rInsn.GetOperand(0)->GetBitSize(), 0x3)), Expr::MakeBitVector(1, 0x1))))
+  );
+  AllExpr.push_back(Expr::MakeAssign(
+    Expr::MakeVar("pf_tmp", VariableExpression::Use),
+    Expr::MakeBinOp(
+      OperationExpression::OpXor,
+      Expr::MakeVar("pf_tmp", VariableExpression::Use),
+      Expr::MakeBinOp(OperationExpression::OpBcast, Expr::MakeBinOp(
+        OperationExpression::OpLrs,
+        Expr::MakeVar("res", VariableExpression::Use),
+        Expr::MakeBitVector(rInsn.GetOperand(0)->GetBitSize(), 0x4)), Expr::MakeBitVector(1, 0x1))))
+  );
+  AllExpr.push_back(Expr::MakeAssign(
+    Expr::MakeVar("pf_tmp", VariableExpression::Use),
+    Expr::MakeBinOp(
+      OperationExpression::OpXor,
+      Expr::MakeVar("pf_tmp", VariableExpression::Use),
+      Expr::MakeBinOp(OperationExpression::OpBcast, Expr::MakeBinOp(
+        OperationExpression::OpLrs,
+        Expr::MakeVar("res", VariableExpression::Use),
+        Expr::MakeBitVector(rInsn.GetOperand(0)->GetBitSize(), 0x5)), Expr::MakeBitVector(1, 0x1))))
+  );
+  AllExpr.push_back(Expr::MakeAssign(
+    Expr::MakeVar("pf_tmp", VariableExpression::Use),
+    Expr::MakeBinOp(
+      OperationExpression::OpXor,
+      Expr::MakeVar("pf_tmp", VariableExpression::Use),
+      Expr::MakeBinOp(OperationExpression::OpBcast, Expr::MakeBinOp(
+        OperationExpression::OpLrs,
+        Expr::MakeVar("res", VariableExpression::Use),
+        Expr::MakeBitVector(rInsn.GetOperand(0)->GetBitSize(), 0x6)), Expr::MakeBitVector(1, 0x1))))
+  );
+  AllExpr.push_back(Expr::MakeAssign(
+    Expr::MakeVar("pf_tmp", VariableExpression::Use),
+    Expr::MakeBinOp(
+      OperationExpression::OpXor,
+      Expr::MakeVar("pf_tmp", VariableExpression::Use),
+      Expr::MakeBinOp(OperationExpression::OpBcast, Expr::MakeBinOp(
+        OperationExpression::OpLrs,
+        Expr::MakeVar("res", VariableExpression::Use),
+        Expr::MakeBitVector(rInsn.GetOperand(0)->GetBitSize(), 0x7)), Expr::MakeBitVector(1, 0x1))))
+  );
+  AllExpr.push_back(Expr::MakeAssign(
+    Expr::MakeId(X86_FlPf, &m_CpuInfo),
+    Expr::MakeVar("pf_tmp", VariableExpression::Use)));
+  AllExpr.push_back(Expr::MakeVar("pf_tmp", VariableExpression::Free));
+  /* semantic: call('adjust_flag') */
+  AllExpr.push_back(Expr::MakeAssign(
+    Expr::MakeId(X86_FlAf, &m_CpuInfo),
+    Expr::MakeBinOp(OperationExpression::OpBcast, Expr::MakeBinOp(
+      OperationExpression::OpLrs,
+      Expr::MakeBinOp(
+        OperationExpression::OpXor,
+        Expr::MakeBinOp(
+          OperationExpression::OpXor,
+          rInsn.GetOperand(0),
+          rInsn.GetOperand(1)),
+        Expr::MakeVar("res", VariableExpression::Use)),
+      Expr::MakeBitVector(rInsn.GetOperand(0)->GetBitSize(), 0x4)), Expr::MakeBitVector(1, 0x1))));
+  /* semantic: op0.val = res */
+  AllExpr.push_back(Expr::MakeAssign(
+    rInsn.GetOperand(0),
+    Expr::MakeVar("res", VariableExpression::Use)));
+  /* semantic: free_var('res') */
+  AllExpr.push_back(Expr::MakeVar("res", VariableExpression::Free));
+  rInsn.SetSemantic(AllExpr);
+}
+
+void X86Architecture::Semantic_007(Instruction& rInsn, u8 Mode)
+{
+  Expression::LSPType AllExpr;
+  rInsn.SetUpdatedFlags(X86_FlCf | X86_FlPf | X86_FlAf | X86_FlZf | X86_FlSf | X86_FlOf);
+  rInsn.SetClearedFlags(X86_FlAf | X86_FlOf | X86_FlCf);
+  AllExpr.push_back(Expr::MakeAssign(Expr::MakeId(X86_FlAf, &m_CpuInfo), Expr::MakeBoolean(false)));
+  AllExpr.push_back(Expr::MakeAssign(Expr::MakeId(X86_FlOf, &m_CpuInfo), Expr::MakeBoolean(false)));
+  AllExpr.push_back(Expr::MakeAssign(Expr::MakeId(X86_FlCf, &m_CpuInfo), Expr::MakeBoolean(false)));
+  /* semantic: alloc_var('res', op0.bit) */
+  AllExpr.push_back(Expr::MakeVar("res", VariableExpression::Alloc, rInsn.GetOperand(0)->GetBitSize()));
+  /* semantic: res = op0.val ^ op1.val */
+  AllExpr.push_back(Expr::MakeAssign(
+    Expr::MakeVar("res", VariableExpression::Use),
+    Expr::MakeBinOp(
+      OperationExpression::OpXor,
+      rInsn.GetOperand(0),
+      rInsn.GetOperand(1))));
+  /* semantic: of.id = int1(0)
+  cf.id = int1(0)
+  call('sign_flag')
+  call('zero_flag')
+  call('parity_flag')
+  op0.val = res */
+  AllExpr.push_back(Expr::MakeAssign(
+    Expr::MakeId(X86_FlOf, &m_CpuInfo),
+    Expr::MakeBitVector(1, 0x0)));
+  AllExpr.push_back(Expr::MakeAssign(
+    Expr::MakeId(X86_FlCf, &m_CpuInfo),
+    Expr::MakeBitVector(1, 0x0)));
+  AllExpr.push_back(Expr::MakeAssign(
+    Expr::MakeId(X86_FlSf, &m_CpuInfo),
+    Expr::MakeBinOp(OperationExpression::OpBcast, Expr::MakeBinOp(
+      OperationExpression::OpLrs,
+      Expr::MakeVar("res", VariableExpression::Use),
+      Expr::MakeBinOp(
+        OperationExpression::OpSub,
+        Expr::MakeBitVector(rInsn.GetOperand(0)->GetBitSize(), rInsn.GetOperand(0)->GetBitSize()),
+        Expr::MakeBitVector(rInsn.GetOperand(0)->GetBitSize(), 0x1))), Expr::MakeBitVector(1, 0x1))));
+  AllExpr.push_back(Expr::MakeAssign(
+    Expr::MakeId(X86_FlZf, &m_CpuInfo),
+    Expr::MakeTernaryCond(ConditionExpression::CondEq,
+    Expr::MakeVar("res", VariableExpression::Use),
+    Expr::MakeBitVector(rInsn.GetOperand(0)->GetBitSize(), 0x0),
+    Expr::MakeBitVector(1, 0x1), Expr::MakeBitVector(1, 0x0))));
+  AllExpr.push_back(Expr::MakeVar("pf_tmp", VariableExpression::Alloc, m_CpuInfo.GetSizeOfRegisterInBit(X86_FlPf)));
+  AllExpr.push_back(Expr::MakeAssign(
+    Expr::MakeVar("pf_tmp", VariableExpression::Use),
+    Expr::MakeBitVector(1, 0x1)));
+  AllExpr.push_back(Expr::MakeAssign(
+    Expr::MakeVar("pf_tmp", VariableExpression::Use),
+    Expr::MakeBinOp(
+      OperationExpression::OpXor,
+      Expr::MakeVar("pf_tmp", VariableExpression::Use),
+      Expr::MakeBinOp(OperationExpression::OpBcast, Expr::MakeBinOp(
+        OperationExpression::OpLrs,
+        Expr::MakeVar("res", VariableExpression::Use),
+        Expr::MakeBitVector(rInsn.GetOperand(0)->GetBitSize(), 0x0)), Expr::MakeBitVector(1, 0x1))))
+  );
+  AllExpr.push_back(Expr::MakeAssign(
+    Expr::MakeVar("pf_tmp", VariableExpression::Use),
+    Expr::MakeBinOp(
+      OperationExpression::OpXor,
+      Expr::MakeVar("pf_tmp", VariableExpression::Use),
+      Expr::MakeBinOp(OperationExpression::OpBcast, Expr::MakeBinOp(
+        OperationExpression::OpLrs,
+        Expr::MakeVar("res", VariableExpression::Use),
+        Expr::MakeBitVector(rInsn.GetOperand(0)->GetBitSize(), 0x1)), Expr::MakeBitVector(1, 0x1))))
+  );
+  AllExpr.push_back(Expr::MakeAssign(
+    Expr::MakeVar("pf_tmp", VariableExpression::Use),
+    Expr::MakeBinOp(
+      OperationExpression::OpXor,
+      Expr::MakeVar("pf_tmp", VariableExpression::Use),
+      Expr::MakeBinOp(OperationExpression::OpBcast, Expr::MakeBinOp(
+        OperationExpression::OpLrs,
+        Expr::MakeVar("res", VariableExpression::Use),
+        Expr::MakeBitVector(rInsn.GetOperand(0)->GetBitSize(), 0x2)), Expr::MakeBitVector(1, 0x1))))
+  );
+  AllExpr.push_back(Expr::MakeAssign(
+    Expr::MakeVar("pf_tmp", VariableExpression::Use),
+    Expr::MakeBinOp(
+      OperationExpression::OpXor,
+      Expr::MakeVar("pf_tmp", VariableExpression::Use),
+      Expr::MakeBinOp(OperationExpression::OpBcast, Expr::MakeBinOp(
+        OperationExpression::OpLrs,
+        Expr::MakeVar("res", VariableExpression::Use),
+        Expr::MakeBitVector(rInsn.GetOperand(0)->GetBitSize(), 0x3)), Expr::MakeBitVector(1, 0x1))))
+  );
+  AllExpr.push_back(Expr::MakeAssign(
+    Expr::MakeVar("pf_tmp", VariableExpression::Use),
+    Expr::MakeBinOp(
+      OperationExpression::OpXor,
+      Expr::MakeVar("pf_tmp", VariableExpression::Use),
+      Expr::MakeBinOp(OperationExpression::OpBcast, Expr::MakeBinOp(
+        OperationExpression::OpLrs,
+        Expr::MakeVar("res", VariableExpression::Use),
+        Expr::MakeBitVector(rInsn.GetOperand(0)->GetBitSize(), 0x4)), Expr::MakeBitVector(1, 0x1))))
+  );
+  AllExpr.push_back(Expr::MakeAssign(
+    Expr::MakeVar("pf_tmp", VariableExpression::Use),
+    Expr::MakeBinOp(
+      OperationExpression::OpXor,
+      Expr::MakeVar("pf_tmp", VariableExpression::Use),
+      Expr::MakeBinOp(OperationExpression::OpBcast, Expr::MakeBinOp(
+        OperationExpression::OpLrs,
+        Expr::MakeVar("res", VariableExpression::Use),
+        Expr::MakeBitVector(rInsn.GetOperand(0)->GetBitSize(), 0x5)), Expr::MakeBitVector(1, 0x1))))
+  );
+  AllExpr.push_back(Expr::MakeAssign(
+    Expr::MakeVar("pf_tmp", VariableExpression::Use),
+    Expr::MakeBinOp(
+      OperationExpression::OpXor,
+      Expr::MakeVar("pf_tmp", VariableExpression::Use),
+      Expr::MakeBinOp(OperationExpression::OpBcast, Expr::MakeBinOp(
+        OperationExpression::OpLrs,
+        Expr::MakeVar("res", VariableExpression::Use),
+        Expr::MakeBitVector(rInsn.GetOperand(0)->GetBitSize(), 0x6)), Expr::MakeBitVector(1, 0x1))))
+  );
+  AllExpr.push_back(Expr::MakeAssign(
+    Expr::MakeVar("pf_tmp", VariableExpression::Use),
+    Expr::MakeBinOp(
+      OperationExpression::OpXor,
+      Expr::MakeVar("pf_tmp", VariableExpression::Use),
+      Expr::MakeBinOp(OperationExpression::OpBcast, Expr::MakeBinOp(
+        OperationExpression::OpLrs,
+        Expr::MakeVar("res", VariableExpression::Use),
+        Expr::MakeBitVector(rInsn.GetOperand(0)->GetBitSize(), 0x7)), Expr::MakeBitVector(1, 0x1))))
+  );
+  AllExpr.push_back(Expr::MakeAssign(
+    Expr::MakeId(X86_FlPf, &m_CpuInfo),
+    Expr::MakeVar("pf_tmp", VariableExpression::Use)));
+  AllExpr.push_back(Expr::MakeVar("pf_tmp", VariableExpression::Free));
+  AllExpr.push_back(Expr::MakeAssign(
+    rInsn.GetOperand(0),
+    Expr::MakeVar("res", VariableExpression::Use)));
+  /* semantic: free_var('res') */
+  AllExpr.push_back(Expr::MakeVar("res", VariableExpression::Free));
+  rInsn.SetSemantic(AllExpr);
+}
+
+void X86Architecture::Semantic_008(Instruction& rInsn, u8 Mode)
+{
+  Expression::LSPType AllExpr;
+  rInsn.SetTestedFlags(X86_FlAf | X86_FlCf);
+  rInsn.SetUpdatedFlags(X86_FlCf | X86_FlPf | X86_FlAf | X86_FlZf | X86_FlSf | X86_FlOf);
+  rInsn.SetClearedFlags(X86_FlOf);
+  AllExpr.push_back(Expr::MakeAssign(Expr::MakeId(X86_FlOf, &m_CpuInfo), Expr::MakeBoolean(false)));
+  /* semantic: alloc_var('cond', 1) */
+  AllExpr.push_back(Expr::MakeVar("cond", VariableExpression::Alloc, 0x1));
+  /* semantic: cond = int1(0) */
+  AllExpr.push_back(Expr::MakeAssign(
+    Expr::MakeVar("cond", VariableExpression::Use),
+    Expr::MakeBitVector(1, 0x0)));
+  /* semantic: if __expr and ((al.id & int(al.bit, 0x0f)) > int(al.bit, 9)): cond |= int1(1) */
+  AllExpr.push_back(Expr::MakeIfElseCond(
+    ConditionExpression::CondUgt,
+    Expr::MakeBinOp(
+      OperationExpression::OpAnd,
+      Expr::MakeId(X86_Reg_Al, &m_CpuInfo),
+      Expr::MakeBitVector(m_CpuInfo.GetSizeOfRegisterInBit(X86_Reg_Al), 0xf)),
+    Expr::MakeBitVector(m_CpuInfo.GetSizeOfRegisterInBit(X86_Reg_Al), 0x9),
+    Expr::MakeAssign(
+      Expr::MakeVar("cond", VariableExpression::Use),
+      Expr::MakeBinOp(
+        OperationExpression::OpOr,
+        Expr::MakeVar("cond", VariableExpression::Use),
+        Expr::MakeBitVector(1, 0x1)))
+  , nullptr)
+  );
+  /* semantic: if __expr and af.id == int1(1): cond |= int1(1) */
+  AllExpr.push_back(Expr::MakeIfElseCond(
+    ConditionExpression::CondEq,
+    Expr::MakeId(X86_FlAf, &m_CpuInfo),
+    Expr::MakeBitVector(1, 0x1),
+    Expr::MakeAssign(
+      Expr::MakeVar("cond", VariableExpression::Use),
+      Expr::MakeBinOp(
+        OperationExpression::OpOr,
+        Expr::MakeVar("cond", VariableExpression::Use),
+        Expr::MakeBitVector(1, 0x1)))
+  , nullptr)
+  );
+  /* semantic: if __expr and cond == int1(1):
+    ax.id += int(ax.bit, 0x106)
+    af.id = int1(1)
+    cf.id = int1(1)
+  else:
+    af.id = int1(0)
+    cf.id = int1(0) */
+  AllExpr.push_back(Expr::MakeIfElseCond(
+    ConditionExpression::CondEq,
+    Expr::MakeVar("cond", VariableExpression::Use),
+    Expr::MakeBitVector(1, 0x1),
+    Expr::MakeBind({
+    Expr::MakeAssign(
+      Expr::MakeId(X86_Reg_Ax, &m_CpuInfo),
+      Expr::MakeBinOp(
+        OperationExpression::OpAdd,
+        Expr::MakeId(X86_Reg_Ax, &m_CpuInfo),
+        Expr::MakeBitVector(m_CpuInfo.GetSizeOfRegisterInBit(X86_Reg_Ax), 0x106)))
+    ,
+    Expr::MakeAssign(
+      Expr::MakeId(X86_FlAf, &m_CpuInfo),
+      Expr::MakeBitVector(1, 0x1)),
+    Expr::MakeAssign(
+      Expr::MakeId(X86_FlCf, &m_CpuInfo),
+      Expr::MakeBitVector(1, 0x1))})
+  ,
+    Expr::MakeBind({
+    Expr::MakeAssign(
+      Expr::MakeId(X86_FlAf, &m_CpuInfo),
+      Expr::MakeBitVector(1, 0x0)),
+    Expr::MakeAssign(
+      Expr::MakeId(X86_FlCf, &m_CpuInfo),
+      Expr::MakeBitVector(1, 0x0))})
+  ));
+  /* semantic: al.id &= int(al.bit, 0x0f) */
+  AllExpr.push_back(Expr::MakeAssign(
+    Expr::MakeId(X86_Reg_Al, &m_CpuInfo),
+    Expr::MakeBinOp(
+      OperationExpression::OpAnd,
+      Expr::MakeId(X86_Reg_Al, &m_CpuInfo),
+      Expr::MakeBitVector(m_CpuInfo.GetSizeOfRegisterInBit(X86_Reg_Al), 0xf)))
+  );
+  /* semantic: free_var('cond') */
+  AllExpr.push_back(Expr::MakeVar("cond", VariableExpression::Free));
+  rInsn.SetSemantic(AllExpr);
+}
+
+void X86Architecture::Semantic_009(Instruction& rInsn, u8 Mode)
+{
+  Expression::LSPType AllExpr;
+  rInsn.SetUpdatedFlags(X86_FlCf | X86_FlPf | X86_FlAf | X86_FlZf | X86_FlSf | X86_FlOf);
+  /* semantic: alloc_var('res', op0.bit) */
+  AllExpr.push_back(Expr::MakeVar("res", VariableExpression::Alloc, rInsn.GetOperand(0)->GetBitSize()));
+  /* semantic: res = op0.val - op1.val */
+  AllExpr.push_back(Expr::MakeAssign(
+    Expr::MakeVar("res", VariableExpression::Use),
+    Expr::MakeBinOp(
+      OperationExpression::OpSub,
+      rInsn.GetOperand(0),
+      rInsn.GetOperand(1))));
+  /* semantic: call('overflow_flag_sub') */
+  AllExpr.push_back(Expr::MakeAssign(
+    Expr::MakeId(X86_FlOf, &m_CpuInfo),
+    Expr::MakeBinOp(OperationExpression::OpBcast, Expr::MakeBinOp(
+      OperationExpression::OpLrs,
+      Expr::MakeBinOp(
+        OperationExpression::OpAnd,
+        Expr::MakeBinOp(
+          OperationExpression::OpXor,
+          rInsn.GetOperand(0),
+          Expr::MakeVar("res", VariableExpression::Use)),
+        Expr::MakeBinOp(
+          OperationExpression::OpXor,
+          rInsn.GetOperand(0),
+          rInsn.GetOperand(1))),
+      Expr::MakeBinOp(
+        OperationExpression::OpSub,
+        Expr::MakeBitVector(rInsn.GetOperand(0)->GetBitSize(), rInsn.GetOperand(0)->GetBitSize()),
+        Expr::MakeBitVector(rInsn.GetOperand(0)->GetBitSize(), 0x1))), Expr::MakeBitVector(1, 0x1))));
+  /* semantic: call('carry_flag_sub') */
+  AllExpr.push_back(Expr::MakeAssign(
+    Expr::MakeId(X86_FlCf, &m_CpuInfo),
+    Expr::MakeBinOp(OperationExpression::OpBcast, Expr::MakeBinOp(
+      OperationExpression::OpLrs,
+      Expr::MakeBinOp(
+        OperationExpression::OpXor,
+        Expr::MakeBinOp(
+          OperationExpression::OpXor,
+          Expr::MakeBinOp(
+            OperationExpression::OpXor,
+            rInsn.GetOperand(0),
+            rInsn.GetOperand(1)),
+          Expr::MakeVar("res", VariableExpression::Use)),
+        Expr::MakeBinOp(
+          OperationExpression::OpAnd,
+          Expr::MakeBinOp(
+            OperationExpression::OpXor,
+            rInsn.GetOperand(0),
+            Expr::MakeVar("res", VariableExpression::Use)),
+          Expr::MakeBinOp(
+            OperationExpression::OpXor,
+            rInsn.GetOperand(0),
+            rInsn.GetOperand(1)))),
+      Expr::MakeBinOp(
+        OperationExpression::OpSub,
+        Expr::MakeBitVector(rInsn.GetOperand(0)->GetBitSize(), rInsn.GetOperand(0)->GetBitSize()),
+        Expr::MakeBitVector(rInsn.GetOperand(0)->GetBitSize(), 0x1))), Expr::MakeBitVector(1, 0x1))));
+  /* semantic: call('sign_flag') */
+  AllExpr.push_back(Expr::MakeAssign(
+    Expr::MakeId(X86_FlSf, &m_CpuInfo),
+    Expr::MakeBinOp(OperationExpression::OpBcast, Expr::MakeBinOp(
+      OperationExpression::OpLrs,
+      Expr::MakeVar("res", VariableExpression::Use),
+      Expr::MakeBinOp(
+        OperationExpression::OpSub,
+        Expr::MakeBitVector(rInsn.GetOperand(0)->GetBitSize(), rInsn.GetOperand(0)->GetBitSize()),
+        Expr::MakeBitVector(rInsn.GetOperand(0)->GetBitSize(), 0x1))), Expr::MakeBitVector(1, 0x1))));
+  /* semantic: call('zero_flag') */
+  AllExpr.push_back(Expr::MakeAssign(
+    Expr::MakeId(X86_FlZf, &m_CpuInfo),
+    Expr::MakeTernaryCond(ConditionExpression::CondEq,
+    Expr::MakeVar("res", VariableExpression::Use),
+    Expr::MakeBitVector(rInsn.GetOperand(0)->GetBitSize(), 0x0),
+    Expr::MakeBitVector(1, 0x1), Expr::MakeBitVector(1, 0x0))));
+  /* semantic: call('parity_flag') */
+  AllExpr.push_back(Expr::MakeVar("pf_tmp", VariableExpression::Alloc, m_CpuInfo.GetSizeOfRegisterInBit(X86_FlPf)));
+  AllExpr.push_back(Expr::MakeAssign(
+    Expr::MakeVar("pf_tmp", VariableExpression::Use),
+    Expr::MakeBitVector(1, 0x1)));
+  AllExpr.push_back(Expr::MakeAssign(
+    Expr::MakeVar("pf_tmp", VariableExpression::Use),
+    Expr::MakeBinOp(
+      OperationExpression::OpXor,
+      Expr::MakeVar("pf_tmp", VariableExpression::Use),
+      Expr::MakeBinOp(OperationExpression::OpBcast, Expr::MakeBinOp(
+        OperationExpression::OpLrs,
+        Expr::MakeVar("res", VariableExpression::Use),
+        Expr::MakeBitVector(rInsn.GetOperand(0)->GetBitSize(), 0x0)), Expr::MakeBitVector(1, 0x1))))
+  );
+  AllExpr.push_back(Expr::MakeAssign(
+    Expr::MakeVar("pf_tmp", VariableExpression::Use),
+    Expr::MakeBinOp(
+      OperationExpression::OpXor,
+      Expr::MakeVar("pf_tmp", VariableExpression::Use),
+      Expr::MakeBinOp(OperationExpression::OpBcast, Expr::MakeBinOp(
+        OperationExpression::OpLrs,
+        Expr::MakeVar("res", VariableExpression::Use),
+        Expr::MakeBitVector(rInsn.GetOperand(0)->GetBitSize(), 0x1)), Expr::MakeBitVector(1, 0x1))))
+  );
+  AllExpr.push_back(Expr::MakeAssign(
+    Expr::MakeVar("pf_tmp", VariableExpression::Use),
+    Expr::MakeBinOp(
+      OperationExpression::OpXor,
+      Expr::MakeVar("pf_tmp", VariableExpression::Use),
+      Expr::MakeBinOp(OperationExpression::OpBcast, Expr::MakeBinOp(
+        OperationExpression::OpLrs,
+        Expr::MakeVar("res", VariableExpression::Use),
+        Expr::MakeBitVector(rInsn.GetOperand(0)->GetBitSize(), 0x2)), Expr::MakeBitVector(1, 0x1))))
+  );
+  AllExpr.push_back(Expr::MakeAssign(
+    Expr::MakeVar("pf_tmp", VariableExpression::Use),
+    Expr::MakeBinOp(
+      OperationExpression::OpXor,
+      Expr::MakeVar("pf_tmp", VariableExpression::Use),
+      Expr::MakeBinOp(OperationExpression::OpBcast, Expr::MakeBinOp(
+        OperationExpression::OpLrs,
+        Expr::MakeVar("res", VariableExpression::Use),
+        Expr::MakeBitVector(rInsn.GetOperand(0)->GetBitSize(), 0x3)), Expr::MakeBitVector(1, 0x1))))
+  );
+  AllExpr.push_back(Expr::MakeAssign(
+    Expr::MakeVar("pf_tmp", VariableExpression::Use),
+    Expr::MakeBinOp(
+      OperationExpression::OpXor,
+      Expr::MakeVar("pf_tmp", VariableExpression::Use),
+      Expr::MakeBinOp(OperationExpression::OpBcast, Expr::MakeBinOp(
+        OperationExpression::OpLrs,
+        Expr::MakeVar("res", VariableExpression::Use),
+        Expr::MakeBitVector(rInsn.GetOperand(0)->GetBitSize(), 0x4)), Expr::MakeBitVector(1, 0x1))))
+  );
+  AllExpr.push_back(Expr::MakeAssign(
+    Expr::MakeVar("pf_tmp", VariableExpression::Use),
+    Expr::MakeBinOp(
+      OperationExpression::OpXor,
+      Expr::MakeVar("pf_tmp", VariableExpression::Use),
+      Expr::MakeBinOp(OperationExpression::OpBcast, Expr::MakeBinOp(
+        OperationExpression::OpLrs,
+        Expr::MakeVar("res", VariableExpression::Use),
+        Expr::MakeBitVector(rInsn.GetOperand(0)->GetBitSize(), 0x5)), Expr::MakeBitVector(1, 0x1))))
+  );
+  AllExpr.push_back(Expr::MakeAssign(
+    Expr::MakeVar("pf_tmp", VariableExpression::Use),
+    Expr::MakeBinOp(
+      OperationExpression::OpXor,
+      Expr::MakeVar("pf_tmp", VariableExpression::Use),
+      Expr::MakeBinOp(OperationExpression::OpBcast, Expr::MakeBinOp(
+        OperationExpression::OpLrs,
+        Expr::MakeVar("res", VariableExpression::Use),
+        Expr::MakeBitVector(rInsn.GetOperand(0)->GetBitSize(), 0x6)), Expr::MakeBitVector(1, 0x1))))
+  );
+  AllExpr.push_back(Expr::MakeAssign(
+    Expr::MakeVar("pf_tmp", VariableExpression::Use),
+    Expr::MakeBinOp(
+      OperationExpression::OpXor,
+      Expr::MakeVar("pf_tmp", VariableExpression::Use),
+      Expr::MakeBinOp(OperationExpression::OpBcast, Expr::MakeBinOp(
+        OperationExpression::OpLrs,
+        Expr::MakeVar("res", VariableExpression::Use),
+        Expr::MakeBitVector(rInsn.GetOperand(0)->GetBitSize(), 0x7)), Expr::MakeBitVector(1, 0x1))))
+  );
+  AllExpr.push_back(Expr::MakeAssign(
+    Expr::MakeId(X86_FlPf, &m_CpuInfo),
+    Expr::MakeVar("pf_tmp", VariableExpression::Use)));
+  AllExpr.push_back(Expr::MakeVar("pf_tmp", VariableExpression::Free));
+  /* semantic: call('adjust_flag') */
+  AllExpr.push_back(Expr::MakeAssign(
+    Expr::MakeId(X86_FlAf, &m_CpuInfo),
+    Expr::MakeBinOp(OperationExpression::OpBcast, Expr::MakeBinOp(
+      OperationExpression::OpLrs,
+      Expr::MakeBinOp(
+        OperationExpression::OpXor,
+        Expr::MakeBinOp(
+          OperationExpression::OpXor,
+          rInsn.GetOperand(0),
+          rInsn.GetOperand(1)),
+        Expr::MakeVar("res", VariableExpression::Use)),
+      Expr::MakeBitVector(rInsn.GetOperand(0)->GetBitSize(), 0x4)), Expr::MakeBitVector(1, 0x1))));
+  /* semantic: free_var('res') */
+  AllExpr.push_back(Expr::MakeVar("res", VariableExpression::Free));
+  rInsn.SetSemantic(AllExpr);
+}
+
+void X86Architecture::Semantic_00a(Instruction& rInsn, u8 Mode)
+{
+  Expression::LSPType AllExpr;
+  rInsn.SetTestedFlags(X86_FlOf);
+  /* semantic: if __expr and of.id == int1(1): program.id = op0.val */
+  AllExpr.push_back(Expr::MakeIfElseCond(
+    ConditionExpression::CondEq,
+    Expr::MakeId(X86_FlOf, &m_CpuInfo),
+    Expr::MakeBitVector(1, 0x1),
+    Expr::MakeAssign(
+      Expr::MakeId(m_CpuInfo.GetRegisterByType(CpuInformation::ProgramPointerRegister, rInsn.GetMode()), &m_CpuInfo),
+      rInsn.GetOperand(0)), nullptr)
+  );
+  rInsn.SetSemantic(AllExpr);
+}
+
+void X86Architecture::Semantic_00b(Instruction& rInsn, u8 Mode)
+{
+  Expression::LSPType AllExpr;
+  rInsn.SetTestedFlags(X86_FlOf);
+  /* semantic: if __expr and of.id == int1(0): program.id = op0.val */
+  AllExpr.push_back(Expr::MakeIfElseCond(
+    ConditionExpression::CondEq,
+    Expr::MakeId(X86_FlOf, &m_CpuInfo),
+    Expr::MakeBitVector(1, 0x0),
+    Expr::MakeAssign(
+      Expr::MakeId(m_CpuInfo.GetRegisterByType(CpuInformation::ProgramPointerRegister, rInsn.GetMode()), &m_CpuInfo),
+      rInsn.GetOperand(0)), nullptr)
+  );
+  rInsn.SetSemantic(AllExpr);
+}
+
+void X86Architecture::Semantic_00c(Instruction& rInsn, u8 Mode)
+{
+  Expression::LSPType AllExpr;
+  rInsn.SetTestedFlags(X86_FlCf);
+  /* semantic: if __expr and cf.id == int1(1): program.id = op0.val */
+  AllExpr.push_back(Expr::MakeIfElseCond(
+    ConditionExpression::CondEq,
+    Expr::MakeId(X86_FlCf, &m_CpuInfo),
+    Expr::MakeBitVector(1, 0x1),
+    Expr::MakeAssign(
+      Expr::MakeId(m_CpuInfo.GetRegisterByType(CpuInformation::ProgramPointerRegister, rInsn.GetMode()), &m_CpuInfo),
+      rInsn.GetOperand(0)), nullptr)
+  );
+  rInsn.SetSemantic(AllExpr);
+}
+
+void X86Architecture::Semantic_00d(Instruction& rInsn, u8 Mode)
+{
+  Expression::LSPType AllExpr;
+  rInsn.SetTestedFlags(X86_FlCf);
+  /* semantic: if __expr and cf.id == int1(0): program.id = op0.val */
+  AllExpr.push_back(Expr::MakeIfElseCond(
+    ConditionExpression::CondEq,
+    Expr::MakeId(X86_FlCf, &m_CpuInfo),
+    Expr::MakeBitVector(1, 0x0),
+    Expr::MakeAssign(
+      Expr::MakeId(m_CpuInfo.GetRegisterByType(CpuInformation::ProgramPointerRegister, rInsn.GetMode()), &m_CpuInfo),
+      rInsn.GetOperand(0)), nullptr)
+  );
+  rInsn.SetSemantic(AllExpr);
+}
+
+void X86Architecture::Semantic_00e(Instruction& rInsn, u8 Mode)
+{
+  Expression::LSPType AllExpr;
+  rInsn.SetTestedFlags(X86_FlZf);
+  /* semantic: if __expr and zf.id == int1(1): program.id = op0.val */
+  AllExpr.push_back(Expr::MakeIfElseCond(
+    ConditionExpression::CondEq,
+    Expr::MakeId(X86_FlZf, &m_CpuInfo),
+    Expr::MakeBitVector(1, 0x1),
+    Expr::MakeAssign(
+      Expr::MakeId(m_CpuInfo.GetRegisterByType(CpuInformation::ProgramPointerRegister, rInsn.GetMode()), &m_CpuInfo),
+      rInsn.GetOperand(0)), nullptr)
+  );
+  rInsn.SetSemantic(AllExpr);
+}
+
+void X86Architecture::Semantic_00f(Instruction& rInsn, u8 Mode)
+{
+  Expression::LSPType AllExpr;
+  rInsn.SetTestedFlags(X86_FlZf);
+  /* semantic: if __expr and zf.id == int1(0): program.id = op0.val */
+  AllExpr.push_back(Expr::MakeIfElseCond(
+    ConditionExpression::CondEq,
+    Expr::MakeId(X86_FlZf, &m_CpuInfo),
+    Expr::MakeBitVector(1, 0x0),
+    Expr::MakeAssign(
+      Expr::MakeId(m_CpuInfo.GetRegisterByType(CpuInformation::ProgramPointerRegister, rInsn.GetMode()), &m_CpuInfo),
+      rInsn.GetOperand(0)), nullptr)
+  );
+  rInsn.SetSemantic(AllExpr);
+}
+
+void X86Architecture::Semantic_010(Instruction& rInsn, u8 Mode)
+{
+  Expression::LSPType AllExpr;
+  rInsn.SetTestedFlags(X86_FlCf | X86_FlZf);
+  /* semantic: if __expr and (cf.id | zf.id) != int1(0): program.id = op0.val */
+  AllExpr.push_back(Expr::MakeIfElseCond(
+    ConditionExpression::CondNe,
+    Expr::MakeBinOp(
+      OperationExpression::OpOr,
+      Expr::MakeId(X86_FlCf, &m_CpuInfo),
+      Expr::MakeId(X86_FlZf, &m_CpuInfo)),
+    Expr::MakeBitVector(1, 0x0),
+    Expr::MakeAssign(
+      Expr::MakeId(m_CpuInfo.GetRegisterByType(CpuInformation::ProgramPointerRegister, rInsn.GetMode()), &m_CpuInfo),
+      rInsn.GetOperand(0)), nullptr)
+  );
+  rInsn.SetSemantic(AllExpr);
+}
+
+void X86Architecture::Semantic_011(Instruction& rInsn, u8 Mode)
+{
+  Expression::LSPType AllExpr;
+  rInsn.SetTestedFlags(X86_FlCf | X86_FlZf);
+  /* semantic: if __expr and (cf.id | zf.id) == int1(0): program.id = op0.val */
+  AllExpr.push_back(Expr::MakeIfElseCond(
+    ConditionExpression::CondEq,
+    Expr::MakeBinOp(
+      OperationExpression::OpOr,
+      Expr::MakeId(X86_FlCf, &m_CpuInfo),
+      Expr::MakeId(X86_FlZf, &m_CpuInfo)),
+    Expr::MakeBitVector(1, 0x0),
+    Expr::MakeAssign(
+      Expr::MakeId(m_CpuInfo.GetRegisterByType(CpuInformation::ProgramPointerRegister, rInsn.GetMode()), &m_CpuInfo),
+      rInsn.GetOperand(0)), nullptr)
+  );
+  rInsn.SetSemantic(AllExpr);
+}
+
+void X86Architecture::Semantic_012(Instruction& rInsn, u8 Mode)
+{
+  Expression::LSPType AllExpr;
+  rInsn.SetTestedFlags(X86_FlSf);
+  /* semantic: if __expr and sf.id == int1(1): program.id = op0.val */
+  AllExpr.push_back(Expr::MakeIfElseCond(
+    ConditionExpression::CondEq,
+    Expr::MakeId(X86_FlSf, &m_CpuInfo),
+    Expr::MakeBitVector(1, 0x1),
+    Expr::MakeAssign(
+      Expr::MakeId(m_CpuInfo.GetRegisterByType(CpuInformation::ProgramPointerRegister, rInsn.GetMode()), &m_CpuInfo),
+      rInsn.GetOperand(0)), nullptr)
+  );
+  rInsn.SetSemantic(AllExpr);
+}
+
+void X86Architecture::Semantic_013(Instruction& rInsn, u8 Mode)
+{
+  Expression::LSPType AllExpr;
+  rInsn.SetTestedFlags(X86_FlSf);
+  /* semantic: if __expr and sf.id == int1(0): program.id = op0.val */
+  AllExpr.push_back(Expr::MakeIfElseCond(
+    ConditionExpression::CondEq,
+    Expr::MakeId(X86_FlSf, &m_CpuInfo),
+    Expr::MakeBitVector(1, 0x0),
+    Expr::MakeAssign(
+      Expr::MakeId(m_CpuInfo.GetRegisterByType(CpuInformation::ProgramPointerRegister, rInsn.GetMode()), &m_CpuInfo),
+      rInsn.GetOperand(0)), nullptr)
+  );
+  rInsn.SetSemantic(AllExpr);
+}
+
+void X86Architecture::Semantic_014(Instruction& rInsn, u8 Mode)
+{
+  Expression::LSPType AllExpr;
+  rInsn.SetTestedFlags(X86_FlPf);
+  /* semantic: if __expr and pf.id == int1(1): program.id = op0.val */
+  AllExpr.push_back(Expr::MakeIfElseCond(
+    ConditionExpression::CondEq,
+    Expr::MakeId(X86_FlPf, &m_CpuInfo),
+    Expr::MakeBitVector(1, 0x1),
+    Expr::MakeAssign(
+      Expr::MakeId(m_CpuInfo.GetRegisterByType(CpuInformation::ProgramPointerRegister, rInsn.GetMode()), &m_CpuInfo),
+      rInsn.GetOperand(0)), nullptr)
+  );
+  rInsn.SetSemantic(AllExpr);
+}
+
+void X86Architecture::Semantic_015(Instruction& rInsn, u8 Mode)
+{
+  Expression::LSPType AllExpr;
+  rInsn.SetTestedFlags(X86_FlPf);
+  /* semantic: if __expr and pf.id == int1(0): program.id = op0.val */
+  AllExpr.push_back(Expr::MakeIfElseCond(
+    ConditionExpression::CondEq,
+    Expr::MakeId(X86_FlPf, &m_CpuInfo),
+    Expr::MakeBitVector(1, 0x0),
+    Expr::MakeAssign(
+      Expr::MakeId(m_CpuInfo.GetRegisterByType(CpuInformation::ProgramPointerRegister, rInsn.GetMode()), &m_CpuInfo),
+      rInsn.GetOperand(0)), nullptr)
+  );
+  rInsn.SetSemantic(AllExpr);
+}
+
+void X86Architecture::Semantic_016(Instruction& rInsn, u8 Mode)
+{
+  Expression::LSPType AllExpr;
+  rInsn.SetTestedFlags(X86_FlOf | X86_FlSf);
+  /* semantic: if __expr and (sf.id ^ of.id) != int1(0): program.id = op0.val */
+  AllExpr.push_back(Expr::MakeIfElseCond(
+    ConditionExpression::CondNe,
+    Expr::MakeBinOp(
+      OperationExpression::OpXor,
+      Expr::MakeId(X86_FlSf, &m_CpuInfo),
+      Expr::MakeId(X86_FlOf, &m_CpuInfo)),
+    Expr::MakeBitVector(1, 0x0),
+    Expr::MakeAssign(
+      Expr::MakeId(m_CpuInfo.GetRegisterByType(CpuInformation::ProgramPointerRegister, rInsn.GetMode()), &m_CpuInfo),
+      rInsn.GetOperand(0)), nullptr)
+  );
+  rInsn.SetSemantic(AllExpr);
+}
+
+void X86Architecture::Semantic_017(Instruction& rInsn, u8 Mode)
+{
+  Expression::LSPType AllExpr;
+  rInsn.SetTestedFlags(X86_FlOf | X86_FlSf);
+  /* semantic: if __expr and (sf.id ^ of.id) == int1(0): program.id = op0.val */
+  AllExpr.push_back(Expr::MakeIfElseCond(
+    ConditionExpression::CondEq,
+    Expr::MakeBinOp(
+      OperationExpression::OpXor,
+      Expr::MakeId(X86_FlSf, &m_CpuInfo),
+      Expr::MakeId(X86_FlOf, &m_CpuInfo)),
+    Expr::MakeBitVector(1, 0x0),
+    Expr::MakeAssign(
+      Expr::MakeId(m_CpuInfo.GetRegisterByType(CpuInformation::ProgramPointerRegister, rInsn.GetMode()), &m_CpuInfo),
+      rInsn.GetOperand(0)), nullptr)
+  );
+  rInsn.SetSemantic(AllExpr);
+}
+
+void X86Architecture::Semantic_018(Instruction& rInsn, u8 Mode)
+{
+  Expression::LSPType AllExpr;
+  rInsn.SetTestedFlags(X86_FlOf | X86_FlSf | X86_FlZf);
+  /* semantic: if __expr and ((sf.id ^ of.id) | zf.id) != int1(0): program.id = op0.val */
+  AllExpr.push_back(Expr::MakeIfElseCond(
+    ConditionExpression::CondNe,
+    Expr::MakeBinOp(
+      OperationExpression::OpOr,
+      Expr::MakeBinOp(
+        OperationExpression::OpXor,
+        Expr::MakeId(X86_FlSf, &m_CpuInfo),
+        Expr::MakeId(X86_FlOf, &m_CpuInfo)),
+      Expr::MakeId(X86_FlZf, &m_CpuInfo)),
+    Expr::MakeBitVector(1, 0x0),
+    Expr::MakeAssign(
+      Expr::MakeId(m_CpuInfo.GetRegisterByType(CpuInformation::ProgramPointerRegister, rInsn.GetMode()), &m_CpuInfo),
+      rInsn.GetOperand(0)), nullptr)
+  );
+  rInsn.SetSemantic(AllExpr);
+}
+
+void X86Architecture::Semantic_019(Instruction& rInsn, u8 Mode)
+{
+  Expression::LSPType AllExpr;
+  rInsn.SetTestedFlags(X86_FlOf | X86_FlSf | X86_FlZf);
+  /* semantic: if __expr and ((sf.id ^ of.id) | zf.id) == int1(0): program.id = op0.val */
+  AllExpr.push_back(Expr::MakeIfElseCond(
+    ConditionExpression::CondEq,
+    Expr::MakeBinOp(
+      OperationExpression::OpOr,
+      Expr::MakeBinOp(
+        OperationExpression::OpXor,
+        Expr::MakeId(X86_FlSf, &m_CpuInfo),
+        Expr::MakeId(X86_FlOf, &m_CpuInfo)),
+      Expr::MakeId(X86_FlZf, &m_CpuInfo)),
+    Expr::MakeBitVector(1, 0x0),
+    Expr::MakeAssign(
+      Expr::MakeId(m_CpuInfo.GetRegisterByType(CpuInformation::ProgramPointerRegister, rInsn.GetMode()), &m_CpuInfo),
+      rInsn.GetOperand(0)), nullptr)
+  );
+  rInsn.SetSemantic(AllExpr);
+}
+
+void X86Architecture::Semantic_01a(Instruction& rInsn, u8 Mode)
+{
+  Expression::LSPType AllExpr;
+  rInsn.SetUpdatedFlags(X86_FlOf | X86_FlSf | X86_FlZf | X86_FlPf | X86_FlCf);
+  rInsn.SetClearedFlags(X86_FlAf);
+  AllExpr.push_back(Expr::MakeAssign(Expr::MakeId(X86_FlAf, &m_CpuInfo), Expr::MakeBoolean(false)));
+  /* semantic: alloc_var('res', op0.bit) */
+  AllExpr.push_back(Expr::MakeVar("res", VariableExpression::Alloc, rInsn.GetOperand(0)->GetBitSize()));
+  /* semantic: res = op0.val & op1.val */
+  AllExpr.push_back(Expr::MakeAssign(
+    Expr::MakeVar("res", VariableExpression::Use),
+    Expr::MakeBinOp(
+      OperationExpression::OpAnd,
+      rInsn.GetOperand(0),
+      rInsn.GetOperand(1))));
+  /* semantic: of.id = int1(0)
+  cf.id = int1(0)
+  call('sign_flag')
+  call('zero_flag')
+  call('parity_flag')
+  free_var('res') */
+  AllExpr.push_back(Expr::MakeAssign(
+    Expr::MakeId(X86_FlOf, &m_CpuInfo),
+    Expr::MakeBitVector(1, 0x0)));
+  AllExpr.push_back(Expr::MakeAssign(
+    Expr::MakeId(X86_FlCf, &m_CpuInfo),
+    Expr::MakeBitVector(1, 0x0)));
+  AllExpr.push_back(Expr::MakeAssign(
+    Expr::MakeId(X86_FlSf, &m_CpuInfo),
+    Expr::MakeBinOp(OperationExpression::OpBcast, Expr::MakeBinOp(
+      OperationExpression::OpLrs,
+      Expr::MakeVar("res", VariableExpression::Use),
+      Expr::MakeBinOp(
+        OperationExpression::OpSub,
+        Expr::MakeBitVector(rInsn.GetOperand(0)->GetBitSize(), rInsn.GetOperand(0)->GetBitSize()),
+        Expr::MakeBitVector(rInsn.GetOperand(0)->GetBitSize(), 0x1))), Expr::MakeBitVector(1, 0x1))));
+  AllExpr.push_back(Expr::MakeAssign(
+    Expr::MakeId(X86_FlZf, &m_CpuInfo),
+    Expr::MakeTernaryCond(ConditionExpression::CondEq,
+    Expr::MakeVar("res", VariableExpression::Use),
+    Expr::MakeBitVector(rInsn.GetOperand(0)->GetBitSize(), 0x0),
+    Expr::MakeBitVector(1, 0x1), Expr::MakeBitVector(1, 0x0))));
+  AllExpr.push_back(Expr::MakeVar("pf_tmp", VariableExpression::Alloc, m_CpuInfo.GetSizeOfRegisterInBit(X86_FlPf)));
+  AllExpr.push_back(Expr::MakeAssign(
+    Expr::MakeVar("pf_tmp", VariableExpression::Use),
+    Expr::MakeBitVector(1, 0x1)));
+  AllExpr.push_back(Expr::MakeAssign(
+    Expr::MakeVar("pf_tmp", VariableExpression::Use),
+    Expr::MakeBinOp(
+      OperationExpression::OpXor,
+      Expr::MakeVar("pf_tmp", VariableExpression::Use),
+      Expr::MakeBinOp(OperationExpression::OpBcast, Expr::MakeBinOp(
+        OperationExpression::OpLrs,
+        Expr::MakeVar("res", VariableExpression::Use),
+        Expr::MakeBitVector(rInsn.GetOperand(0)->GetBitSize(), 0x0)), Expr::MakeBitVector(1, 0x1))))
+  );
+  AllExpr.push_back(Expr::MakeAssign(
+    Expr::MakeVar("pf_tmp", VariableExpression::Use),
+    Expr::MakeBinOp(
+      OperationExpression::OpXor,
+      Expr::MakeVar("pf_tmp", VariableExpression::Use),
+      Expr::MakeBinOp(OperationExpression::OpBcast, Expr::MakeBinOp(
+        OperationExpression::OpLrs,
+        Expr::MakeVar("res", VariableExpression::Use),
+        Expr::MakeBitVector(rInsn.GetOperand(0)->GetBitSize(), 0x1)), Expr::MakeBitVector(1, 0x1))))
+  );
+  AllExpr.push_back(Expr::MakeAssign(
+    Expr::MakeVar("pf_tmp", VariableExpression::Use),
+    Expr::MakeBinOp(
+      OperationExpression::OpXor,
+      Expr::MakeVar("pf_tmp", VariableExpression::Use),
+      Expr::MakeBinOp(OperationExpression::OpBcast, Expr::MakeBinOp(
+        OperationExpression::OpLrs,
+        Expr::MakeVar("res", VariableExpression::Use),
+        Expr::MakeBitVector(rInsn.GetOperand(0)->GetBitSize(), 0x2)), Expr::MakeBitVector(1, 0x1))))
+  );
+  AllExpr.push_back(Expr::MakeAssign(
+    Expr::MakeVar("pf_tmp", VariableExpression::Use),
+    Expr::MakeBinOp(
+      OperationExpression::OpXor,
+      Expr::MakeVar("pf_tmp", VariableExpression::Use),
+      Expr::MakeBinOp(OperationExpression::OpBcast, Expr::MakeBinOp(
+        OperationExpression::OpLrs,
+        Expr::MakeVar("res", VariableExpression::Use),
+        Expr::MakeBitVector(rInsn.GetOperand(0)->GetBitSize(), 0x3)), Expr::MakeBitVector(1, 0x1))))
+  );
+  AllExpr.push_back(Expr::MakeAssign(
+    Expr::MakeVar("pf_tmp", VariableExpression::Use),
+    Expr::MakeBinOp(
+      OperationExpression::OpXor,
+      Expr::MakeVar("pf_tmp", VariableExpression::Use),
+      Expr::MakeBinOp(OperationExpression::OpBcast, Expr::MakeBinOp(
+        OperationExpression::OpLrs,
+        Expr::MakeVar("res", VariableExpression::Use),
+        Expr::MakeBitVector(rInsn.GetOperand(0)->GetBitSize(), 0x4)), Expr::MakeBitVector(1, 0x1))))
+  );
+  AllExpr.push_back(Expr::MakeAssign(
+    Expr::MakeVar("pf_tmp", VariableExpression::Use),
+    Expr::MakeBinOp(
+      OperationExpression::OpXor,
+      Expr::MakeVar("pf_tmp", VariableExpression::Use),
+      Expr::MakeBinOp(OperationExpression::OpBcast, Expr::MakeBinOp(
+        OperationExpression::OpLrs,
+        Expr::MakeVar("res", VariableExpression::Use),
+        Expr::MakeBitVector(rInsn.GetOperand(0)->GetBitSize(), 0x5)), Expr::MakeBitVector(1, 0x1))))
+  );
+  AllExpr.push_back(Expr::MakeAssign(
+    Expr::MakeVar("pf_tmp", VariableExpression::Use),
+    Expr::MakeBinOp(
+      OperationExpression::OpXor,
+      Expr::MakeVar("pf_tmp", VariableExpression::Use),
+      Expr::MakeBinOp(OperationExpression::OpBcast, Expr::MakeBinOp(
+        OperationExpression::OpLrs,
+        Expr::MakeVar("res", VariableExpression::Use),
+        Expr::MakeBitVector(rInsn.GetOperand(0)->GetBitSize(), 0x6)), Expr::MakeBitVector(1, 0x1))))
+  );
+  AllExpr.push_back(Expr::MakeAssign(
+    Expr::MakeVar("pf_tmp", VariableExpression::Use),
+    Expr::MakeBinOp(
+      OperationExpression::OpXor,
+      Expr::MakeVar("pf_tmp", VariableExpression::Use),
+      Expr::MakeBinOp(OperationExpression::OpBcast, Expr::MakeBinOp(
+        OperationExpression::OpLrs,
+        Expr::MakeVar("res", VariableExpression::Use),
+        Expr::MakeBitVector(rInsn.GetOperand(0)->GetBitSize(), 0x7)), Expr::MakeBitVector(1, 0x1))))
+  );
+  AllExpr.push_back(Expr::MakeAssign(
+    Expr::MakeId(X86_FlPf, &m_CpuInfo),
+    Expr::MakeVar("pf_tmp", VariableExpression::Use)));
+  AllExpr.push_back(Expr::MakeVar("pf_tmp", VariableExpression::Free));
+  AllExpr.push_back(Expr::MakeVar("res", VariableExpression::Free));
+  rInsn.SetSemantic(AllExpr);
+}
+
+void X86Architecture::Semantic_01b(Instruction& rInsn, u8 Mode)
+{
+  Expression::LSPType AllExpr;
+  /* semantic: alloc_var('tmp_val', op0.bit) */
+  AllExpr.push_back(Expr::MakeVar("tmp_val", VariableExpression::Alloc, rInsn.GetOperand(0)->GetBitSize()));
+  /* semantic: tmp_val = op0.val */
+  AllExpr.push_back(Expr::MakeAssign(
+    Expr::MakeVar("tmp_val", VariableExpression::Use),
+    rInsn.GetOperand(0)));
+  /* semantic: op0.val = op1.val */
+  AllExpr.push_back(Expr::MakeAssign(
+    rInsn.GetOperand(0),
+    rInsn.GetOperand(1)));
+  /* semantic: op1.val = tmp_val */
+  AllExpr.push_back(Expr::MakeAssign(
+    rInsn.GetOperand(1),
+    Expr::MakeVar("tmp_val", VariableExpression::Use)));
+  /* semantic: free_var('tmp_val') */
+  AllExpr.push_back(Expr::MakeVar("tmp_val", VariableExpression::Free));
+  rInsn.SetSemantic(AllExpr);
+}
+
+void X86Architecture::Semantic_01c(Instruction& rInsn, u8 Mode)
+{
+  Expression::LSPType AllExpr;
+  /* semantic: op0.val = op1.val */
+  AllExpr.push_back(Expr::MakeAssign(
+    rInsn.GetOperand(0),
+    rInsn.GetOperand(1)));
+  rInsn.SetSemantic(AllExpr);
+}
+
+void X86Architecture::Semantic_01d(Instruction& rInsn, u8 Mode)
+{
+  Expression::LSPType AllExpr;
+  /* semantic: op0.val = op1.addr */
+  AllExpr.push_back(Expr::MakeAssign(
+    rInsn.GetOperand(0),
+    rInsn.GetOperand(1)->ToAddress()));
+  rInsn.SetSemantic(AllExpr);
+}
+
+void X86Architecture::Semantic_01e(Instruction& rInsn, u8 Mode)
+{
+  Expression::LSPType AllExpr;
+  /* semantic: stack.id -= stack.size */
+  AllExpr.push_back(Expr::MakeAssign(
+    Expr::MakeId(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister, rInsn.GetMode()), &m_CpuInfo),
+    Expr::MakeBinOp(
+      OperationExpression::OpSub,
+      Expr::MakeId(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister, rInsn.GetMode()), &m_CpuInfo),
+      Expr::MakeBitVector(
+        m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister, rInsn.GetMode())),
+        m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister, rInsn.GetMode())) / 8)))
+  );
+  /* semantic: stack.mem =\
+    (  bit_cast(cf.id, int(stack.bit, stack.bit))
+    | (int64(1)                                   << int(stack.bit, 1))
+    | (bit_cast(pf.id, int(stack.bit, stack.bit)) << int(stack.bit, 2))
+    | (bit_cast(af.id, int(stack.bit, stack.bit)) << int(stack.bit, 4))
+    | (bit_cast(zf.id, int(stack.bit, stack.bit)) << int(stack.bit, 6))
+    | (bit_cast(sf.id, int(stack.bit, stack.bit)) << int(stack.bit, 7))
+    | (bit_cast(tf.id, int(stack.bit, stack.bit)) << int(stack.bit, 8))
+    | (int64(1)                                   << int(stack.bit, 9))
+    | (bit_cast(df.id, int(stack.bit, stack.bit)) << int(stack.bit, 10))
+    | (bit_cast(of.id, int(stack.bit, stack.bit)) << int(stack.bit, 11))) */
+  AllExpr.push_back(Expr::MakeAssign(
+    Expr::MakeMem(m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister, rInsn.GetMode())), nullptr, Expr::MakeId(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister, rInsn.GetMode()), &m_CpuInfo)),
+    Expr::MakeBinOp(
+      OperationExpression::OpOr,
+      Expr::MakeBinOp(
+        OperationExpression::OpOr,
+        Expr::MakeBinOp(
+          OperationExpression::OpOr,
+          Expr::MakeBinOp(
+            OperationExpression::OpOr,
+            Expr::MakeBinOp(
+              OperationExpression::OpOr,
+              Expr::MakeBinOp(
+                OperationExpression::OpOr,
+                Expr::MakeBinOp(
+                  OperationExpression::OpOr,
+                  Expr::MakeBinOp(
+                    OperationExpression::OpOr,
+                    Expr::MakeBinOp(
+                      OperationExpression::OpOr,
+                      Expr::MakeBinOp(OperationExpression::OpBcast, Expr::MakeId(X86_FlCf, &m_CpuInfo), Expr::MakeBitVector(m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister, rInsn.GetMode())), m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister, rInsn.GetMode())))),
+                      Expr::MakeBinOp(
+                        OperationExpression::OpLls,
+                        Expr::MakeBitVector(64, 0x1),
+                        Expr::MakeBitVector(m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister, rInsn.GetMode())), 0x1))),
+                    Expr::MakeBinOp(
+                      OperationExpression::OpLls,
+                      Expr::MakeBinOp(OperationExpression::OpBcast, Expr::MakeId(X86_FlPf, &m_CpuInfo), Expr::MakeBitVector(m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister, rInsn.GetMode())), m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister, rInsn.GetMode())))),
+                      Expr::MakeBitVector(m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister, rInsn.GetMode())), 0x2))),
+                  Expr::MakeBinOp(
+                    OperationExpression::OpLls,
+                    Expr::MakeBinOp(OperationExpression::OpBcast, Expr::MakeId(X86_FlAf, &m_CpuInfo), Expr::MakeBitVector(m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister, rInsn.GetMode())), m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister, rInsn.GetMode())))),
+                    Expr::MakeBitVector(m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister, rInsn.GetMode())), 0x4))),
+                Expr::MakeBinOp(
+                  OperationExpression::OpLls,
+                  Expr::MakeBinOp(OperationExpression::OpBcast, Expr::MakeId(X86_FlZf, &m_CpuInfo), Expr::MakeBitVector(m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister, rInsn.GetMode())), m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister, rInsn.GetMode())))),
+                  Expr::MakeBitVector(m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister, rInsn.GetMode())), 0x6))),
+              Expr::MakeBinOp(
+                OperationExpression::OpLls,
+                Expr::MakeBinOp(OperationExpression::OpBcast, Expr::MakeId(X86_FlSf, &m_CpuInfo), Expr::MakeBitVector(m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister, rInsn.GetMode())), m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister, rInsn.GetMode())))),
+                Expr::MakeBitVector(m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister, rInsn.GetMode())), 0x7))),
+            Expr::MakeBinOp(
+              OperationExpression::OpLls,
+              Expr::MakeBinOp(OperationExpression::OpBcast, Expr::MakeId(X86_FlTf, &m_CpuInfo), Expr::MakeBitVector(m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister, rInsn.GetMode())), m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister, rInsn.GetMode())))),
+              Expr::MakeBitVector(m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister, rInsn.GetMode())), 0x8))),
+          Expr::MakeBinOp(
+            OperationExpression::OpLls,
+            Expr::MakeBitVector(64, 0x1),
+            Expr::MakeBitVector(m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister, rInsn.GetMode())), 0x9))),
+        Expr::MakeBinOp(
+          OperationExpression::OpLls,
+          Expr::MakeBinOp(OperationExpression::OpBcast, Expr::MakeId(X86_FlDf, &m_CpuInfo), Expr::MakeBitVector(m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister, rInsn.GetMode())), m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister, rInsn.GetMode())))),
+          Expr::MakeBitVector(m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister, rInsn.GetMode())), 0xa))),
+      Expr::MakeBinOp(
+        OperationExpression::OpLls,
+        Expr::MakeBinOp(OperationExpression::OpBcast, Expr::MakeId(X86_FlOf, &m_CpuInfo), Expr::MakeBitVector(m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister, rInsn.GetMode())), m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister, rInsn.GetMode())))),
+        Expr::MakeBitVector(m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister, rInsn.GetMode())), 0xb)))));
+  rInsn.SetSemantic(AllExpr);
+}
+
+void X86Architecture::Semantic_01f(Instruction& rInsn, u8 Mode)
+{
+  Expression::LSPType AllExpr;
+  /* semantic: alloc_var('flags', stack.bit) */
+  AllExpr.push_back(Expr::MakeVar("flags", VariableExpression::Alloc, m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister, rInsn.GetMode()))));
+  /* semantic: flags = stack.mem */
+  AllExpr.push_back(Expr::MakeAssign(
+    Expr::MakeVar("flags", VariableExpression::Use),
+    Expr::MakeMem(m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister, rInsn.GetMode())), nullptr, Expr::MakeId(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister, rInsn.GetMode()), &m_CpuInfo))));
+  /* semantic: stack.id += stack.size */
+  AllExpr.push_back(Expr::MakeAssign(
+    Expr::MakeId(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister, rInsn.GetMode()), &m_CpuInfo),
+    Expr::MakeBinOp(
+      OperationExpression::OpAdd,
+      Expr::MakeId(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister, rInsn.GetMode()), &m_CpuInfo),
+      Expr::MakeBitVector(
+        m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister, rInsn.GetMode())),
+        m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister, rInsn.GetMode())) / 8)))
+  );
+  /* semantic: cf.id = bit_cast(flags, int1(1)) */
+  AllExpr.push_back(Expr::MakeAssign(
+    Expr::MakeId(X86_FlCf, &m_CpuInfo),
+    Expr::MakeBinOp(OperationExpression::OpBcast, Expr::MakeVar("flags", VariableExpression::Use), Expr::MakeBitVector(1, 0x1))));
+  /* semantic: pf.id = bit_cast((flags >> int(stack.bit,  2)), int1(1)) */
+  AllExpr.push_back(Expr::MakeAssign(
+    Expr::MakeId(X86_FlPf, &m_CpuInfo),
+    Expr::MakeBinOp(OperationExpression::OpBcast, Expr::MakeBinOp(
+      OperationExpression::OpLrs,
+      Expr::MakeVar("flags", VariableExpression::Use),
+      Expr::MakeBitVector(m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister, rInsn.GetMode())), 0x2)), Expr::MakeBitVector(1, 0x1))));
+  /* semantic: af.id = bit_cast((flags >> int(stack.bit,  4)), int1(1)) */
+  AllExpr.push_back(Expr::MakeAssign(
+    Expr::MakeId(X86_FlAf, &m_CpuInfo),
+    Expr::MakeBinOp(OperationExpression::OpBcast, Expr::MakeBinOp(
+      OperationExpression::OpLrs,
+      Expr::MakeVar("flags", VariableExpression::Use),
+      Expr::MakeBitVector(m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister, rInsn.GetMode())), 0x4)), Expr::MakeBitVector(1, 0x1))));
+  /* semantic: zf.id = bit_cast((flags >> int(stack.bit,  6)), int1(1)) */
+  AllExpr.push_back(Expr::MakeAssign(
+    Expr::MakeId(X86_FlZf, &m_CpuInfo),
+    Expr::MakeBinOp(OperationExpression::OpBcast, Expr::MakeBinOp(
+      OperationExpression::OpLrs,
+      Expr::MakeVar("flags", VariableExpression::Use),
+      Expr::MakeBitVector(m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister, rInsn.GetMode())), 0x6)), Expr::MakeBitVector(1, 0x1))));
+  /* semantic: sf.id = bit_cast((flags >> int(stack.bit,  7)), int1(1)) */
+  AllExpr.push_back(Expr::MakeAssign(
+    Expr::MakeId(X86_FlSf, &m_CpuInfo),
+    Expr::MakeBinOp(OperationExpression::OpBcast, Expr::MakeBinOp(
+      OperationExpression::OpLrs,
+      Expr::MakeVar("flags", VariableExpression::Use),
+      Expr::MakeBitVector(m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister, rInsn.GetMode())), 0x7)), Expr::MakeBitVector(1, 0x1))));
+  /* semantic: tf.id = bit_cast((flags >> int(stack.bit,  8)), int1(1)) */
+  AllExpr.push_back(Expr::MakeAssign(
+    Expr::MakeId(X86_FlTf, &m_CpuInfo),
+    Expr::MakeBinOp(OperationExpression::OpBcast, Expr::MakeBinOp(
+      OperationExpression::OpLrs,
+      Expr::MakeVar("flags", VariableExpression::Use),
+      Expr::MakeBitVector(m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister, rInsn.GetMode())), 0x8)), Expr::MakeBitVector(1, 0x1))));
+  /* semantic: df.id = bit_cast((flags >> int(stack.bit, 10)), int1(1)) */
+  AllExpr.push_back(Expr::MakeAssign(
+    Expr::MakeId(X86_FlDf, &m_CpuInfo),
+    Expr::MakeBinOp(OperationExpression::OpBcast, Expr::MakeBinOp(
+      OperationExpression::OpLrs,
+      Expr::MakeVar("flags", VariableExpression::Use),
+      Expr::MakeBitVector(m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister, rInsn.GetMode())), 0xa)), Expr::MakeBitVector(1, 0x1))));
+  /* semantic: of.id = bit_cast((flags >> int(stack.bit, 11)), int1(1)) */
+  AllExpr.push_back(Expr::MakeAssign(
+    Expr::MakeId(X86_FlOf, &m_CpuInfo),
+    Expr::MakeBinOp(OperationExpression::OpBcast, Expr::MakeBinOp(
+      OperationExpression::OpLrs,
+      Expr::MakeVar("flags", VariableExpression::Use),
+      Expr::MakeBitVector(m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister, rInsn.GetMode())), 0xb)), Expr::MakeBitVector(1, 0x1))));
+  /* semantic: free_var('flags') */
+  AllExpr.push_back(Expr::MakeVar("flags", VariableExpression::Free));
+  rInsn.SetSemantic(AllExpr);
+}
+
+void X86Architecture::Semantic_020(Instruction& rInsn, u8 Mode)
+{
+  Expression::LSPType AllExpr;
+  rInsn.SetUpdatedFlags(X86_FlSf | X86_FlZf | X86_FlAf | X86_FlPf | X86_FlCf);
+  rInsn.SetSemantic(AllExpr);
+}
+
+void X86Architecture::Semantic_021(Instruction& rInsn, u8 Mode)
+{
+  Expression::LSPType AllExpr;
+  rInsn.SetTestedFlags(X86_FlSf | X86_FlZf | X86_FlAf | X86_FlPf | X86_FlCf);
+  /* semantic: ah.id =\
+      (  bit_cast(cf.id, int8(ah.bit))
+      | (int(ah.bit, 1)                << int(ah.bit, 1))
+      | (bit_cast(pf.id, int8(ah.bit)) << int(ah.bit, 2))
+      | (int(ah.bit, 0)                << int(ah.bit, 3))
+      | (bit_cast(af.id, int8(ah.bit)) << int(ah.bit, 4))
+      | (int(ah.bit, 0)                << int(ah.bit, 5))
+      | (bit_cast(zf.id, int8(ah.bit)) << int(ah.bit, 6))
+      | (bit_cast(sf.id, int8(ah.bit)) << int(ah.bit, 7))) */
+  AllExpr.push_back(Expr::MakeAssign(
+    Expr::MakeId(X86_Reg_Ah, &m_CpuInfo),
+    Expr::MakeBinOp(
+      OperationExpression::OpOr,
+      Expr::MakeBinOp(
+        OperationExpression::OpOr,
+        Expr::MakeBinOp(
+          OperationExpression::OpOr,
+          Expr::MakeBinOp(
+            OperationExpression::OpOr,
+            Expr::MakeBinOp(
+              OperationExpression::OpOr,
+              Expr::MakeBinOp(
+                OperationExpression::OpOr,
+                Expr::MakeBinOp(
+                  OperationExpression::OpOr,
+                  Expr::MakeBinOp(OperationExpression::OpBcast, Expr::MakeId(X86_FlCf, &m_CpuInfo), Expr::MakeBitVector(8, m_CpuInfo.GetSizeOfRegisterInBit(X86_Reg_Ah))),
+                  Expr::MakeBinOp(
+                    OperationExpression::OpLls,
+                    Expr::MakeBitVector(m_CpuInfo.GetSizeOfRegisterInBit(X86_Reg_Ah), 0x1),
+                    Expr::MakeBitVector(m_CpuInfo.GetSizeOfRegisterInBit(X86_Reg_Ah), 0x1))),
+                Expr::MakeBinOp(
+                  OperationExpression::OpLls,
+                  Expr::MakeBinOp(OperationExpression::OpBcast, Expr::MakeId(X86_FlPf, &m_CpuInfo), Expr::MakeBitVector(8, m_CpuInfo.GetSizeOfRegisterInBit(X86_Reg_Ah))),
+                  Expr::MakeBitVector(m_CpuInfo.GetSizeOfRegisterInBit(X86_Reg_Ah), 0x2))),
+              Expr::MakeBinOp(
+                OperationExpression::OpLls,
+                Expr::MakeBitVector(m_CpuInfo.GetSizeOfRegisterInBit(X86_Reg_Ah), 0x0),
+                Expr::MakeBitVector(m_CpuInfo.GetSizeOfRegisterInBit(X86_Reg_Ah), 0x3))),
+            Expr::MakeBinOp(
+              OperationExpression::OpLls,
+              Expr::MakeBinOp(OperationExpression::OpBcast, Expr::MakeId(X86_FlAf, &m_CpuInfo), Expr::MakeBitVector(8, m_CpuInfo.GetSizeOfRegisterInBit(X86_Reg_Ah))),
+              Expr::MakeBitVector(m_CpuInfo.GetSizeOfRegisterInBit(X86_Reg_Ah), 0x4))),
+          Expr::MakeBinOp(
+            OperationExpression::OpLls,
+            Expr::MakeBitVector(m_CpuInfo.GetSizeOfRegisterInBit(X86_Reg_Ah), 0x0),
+            Expr::MakeBitVector(m_CpuInfo.GetSizeOfRegisterInBit(X86_Reg_Ah), 0x5))),
+        Expr::MakeBinOp(
+          OperationExpression::OpLls,
+          Expr::MakeBinOp(OperationExpression::OpBcast, Expr::MakeId(X86_FlZf, &m_CpuInfo), Expr::MakeBitVector(8, m_CpuInfo.GetSizeOfRegisterInBit(X86_Reg_Ah))),
+          Expr::MakeBitVector(m_CpuInfo.GetSizeOfRegisterInBit(X86_Reg_Ah), 0x6))),
+      Expr::MakeBinOp(
+        OperationExpression::OpLls,
+        Expr::MakeBinOp(OperationExpression::OpBcast, Expr::MakeId(X86_FlSf, &m_CpuInfo), Expr::MakeBitVector(8, m_CpuInfo.GetSizeOfRegisterInBit(X86_Reg_Ah))),
+        Expr::MakeBitVector(m_CpuInfo.GetSizeOfRegisterInBit(X86_Reg_Ah), 0x7)))));
+  rInsn.SetSemantic(AllExpr);
+}
+
+void X86Architecture::Semantic_022(Instruction& rInsn, u8 Mode)
+{
+  Expression::LSPType AllExpr;
+  rInsn.SetTestedFlags(X86_FlDf);
+  /* semantic: if __code and instruction_has_prefix(rep):
+    while cnt.id != int(cnt.bit, 0):
+      call('move_string')
+      cnt.id -= int(cnt.bit, 1) */
+  if (rInsn.GetPrefix() & (X86_Prefix_Rep))
+  {
+    /* block glb expressions */
+    AllExpr.push_back(Expr::MakeWhileCond(
+      ConditionExpression::CondNe,
+      Expr::MakeId(m_CpuInfo.GetRegisterByType(CpuInformation::CounterRegister, rInsn.GetMode()), &m_CpuInfo),
+      Expr::MakeBitVector(m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::CounterRegister, rInsn.GetMode())), 0x0),
+      Expr::MakeBind({
+      Expr::MakeAssign(
+        rInsn.GetOperand(1),
+        rInsn.GetOperand(0)),
+      Expr::MakeIfElseCond(
+        ConditionExpression::CondEq,
+        Expr::MakeId(X86_FlDf, &m_CpuInfo),
+        Expr::MakeBitVector(1, 0x1),
+        Expr::MakeBind({
+        Expr::MakeAssign(
+          expr_cast<MemoryExpression>(rInsn.GetOperand(0))->GetOffsetExpression(),
+          Expr::MakeBinOp(
+            OperationExpression::OpSub,
+            expr_cast<MemoryExpression>(rInsn.GetOperand(0))->GetOffsetExpression(),
+            Expr::MakeBitVector(expr_cast<MemoryExpression>(rInsn.GetOperand(0))->GetOffsetExpression()->GetBitSize(), rInsn.GetOperand(0)->GetBitSize() / 8)))
+        ,
+        Expr::MakeAssign(
+          expr_cast<MemoryExpression>(rInsn.GetOperand(1))->GetOffsetExpression(),
+          Expr::MakeBinOp(
+            OperationExpression::OpSub,
+            expr_cast<MemoryExpression>(rInsn.GetOperand(1))->GetOffsetExpression(),
+            Expr::MakeBitVector(expr_cast<MemoryExpression>(rInsn.GetOperand(1))->GetOffsetExpression()->GetBitSize(), rInsn.GetOperand(1)->GetBitSize() / 8)))
+        })
+      ,
+        Expr::MakeBind({
+        Expr::MakeAssign(
+          expr_cast<MemoryExpression>(rInsn.GetOperand(0))->GetOffsetExpression(),
+          Expr::MakeBinOp(
+            OperationExpression::OpAdd,
+            expr_cast<MemoryExpression>(rInsn.GetOperand(0))->GetOffsetExpression(),
+            Expr::MakeBitVector(expr_cast<MemoryExpression>(rInsn.GetOperand(0))->GetOffsetExpression()->GetBitSize(), rInsn.GetOperand(0)->GetBitSize() / 8)))
+        ,
+        Expr::MakeAssign(
+          expr_cast<MemoryExpression>(rInsn.GetOperand(1))->GetOffsetExpression(),
+          Expr::MakeBinOp(
+            OperationExpression::OpAdd,
+            expr_cast<MemoryExpression>(rInsn.GetOperand(1))->GetOffsetExpression(),
+            Expr::MakeBitVector(expr_cast<MemoryExpression>(rInsn.GetOperand(1))->GetOffsetExpression()->GetBitSize(), rInsn.GetOperand(1)->GetBitSize() / 8)))
+        })
+      ),
+      Expr::MakeAssign(
+        Expr::MakeId(m_CpuInfo.GetRegisterByType(CpuInformation::CounterRegister, rInsn.GetMode()), &m_CpuInfo),
+        Expr::MakeBinOp(
+          OperationExpression::OpSub,
+          Expr::MakeId(m_CpuInfo.GetRegisterByType(CpuInformation::CounterRegister, rInsn.GetMode()), &m_CpuInfo),
+          Expr::MakeBitVector(m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::CounterRegister, rInsn.GetMode())), 0x1)))
+      })
+    ));
+  }
+  /* semantic: if __code and instruction_has_no_prefix(rep):
+    call('move_string') */
+  if (!(rInsn.GetPrefix() & (X86_Prefix_Rep)))
+  {
+    /* block glb expressions */
+    AllExpr.push_back(Expr::MakeAssign(
+      rInsn.GetOperand(1),
+      rInsn.GetOperand(0)));
+    AllExpr.push_back(Expr::MakeIfElseCond(
+      ConditionExpression::CondEq,
+      Expr::MakeId(X86_FlDf, &m_CpuInfo),
+      Expr::MakeBitVector(1, 0x1),
+      Expr::MakeBind({
+      Expr::MakeAssign(
+        expr_cast<MemoryExpression>(rInsn.GetOperand(0))->GetOffsetExpression(),
+        Expr::MakeBinOp(
+          OperationExpression::OpSub,
+          expr_cast<MemoryExpression>(rInsn.GetOperand(0))->GetOffsetExpression(),
+          Expr::MakeBitVector(expr_cast<MemoryExpression>(rInsn.GetOperand(0))->GetOffsetExpression()->GetBitSize(), rInsn.GetOperand(0)->GetBitSize() / 8)))
+      ,
+      Expr::MakeAssign(
+        expr_cast<MemoryExpression>(rInsn.GetOperand(1))->GetOffsetExpression(),
+        Expr::MakeBinOp(
+          OperationExpression::OpSub,
+          expr_cast<MemoryExpression>(rInsn.GetOperand(1))->GetOffsetExpression(),
+          Expr::MakeBitVector(expr_cast<MemoryExpression>(rInsn.GetOperand(1))->GetOffsetExpression()->GetBitSize(), rInsn.GetOperand(1)->GetBitSize() / 8)))
+      })
+    ,
+      Expr::MakeBind({
+      Expr::MakeAssign(
+        expr_cast<MemoryExpression>(rInsn.GetOperand(0))->GetOffsetExpression(),
+        Expr::MakeBinOp(
+          OperationExpression::OpAdd,
+          expr_cast<MemoryExpression>(rInsn.GetOperand(0))->GetOffsetExpression(),
+          Expr::MakeBitVector(expr_cast<MemoryExpression>(rInsn.GetOperand(0))->GetOffsetExpression()->GetBitSize(), rInsn.GetOperand(0)->GetBitSize() / 8)))
+      ,
+      Expr::MakeAssign(
+        expr_cast<MemoryExpression>(rInsn.GetOperand(1))->GetOffsetExpression(),
+        Expr::MakeBinOp(
+          OperationExpression::OpAdd,
+          expr_cast<MemoryExpression>(rInsn.GetOperand(1))->GetOffsetExpression(),
+          Expr::MakeBitVector(expr_cast<MemoryExpression>(rInsn.GetOperand(1))->GetOffsetExpression()->GetBitSize(), rInsn.GetOperand(1)->GetBitSize() / 8)))
+      })
+    ));
+  }
+  rInsn.SetSemantic(AllExpr);
+}
+
+void X86Architecture::Semantic_023(Instruction& rInsn, u8 Mode)
+{
+  Expression::LSPType AllExpr;
+  rInsn.SetTestedFlags(X86_FlDf);
+  rInsn.SetUpdatedFlags(X86_FlOf | X86_FlSf | X86_FlZf | X86_FlAf | X86_FlPf | X86_FlCf);
+  /* semantic: alloc_var('loop', 1) */
+  AllExpr.push_back(Expr::MakeVar("loop", VariableExpression::Alloc, 0x1));
+  /* semantic: loop = int1(1) */
+  AllExpr.push_back(Expr::MakeAssign(
+    Expr::MakeVar("loop", VariableExpression::Use),
+    Expr::MakeBitVector(1, 0x1)));
+  /* semantic: if __code and instruction_has_prefix(repz):
+    if __expr and cnt.id == int(cnt.bit, 0): loop = int1(0)
+    while loop == int1(1):
+      call('compare_string')
+      cnt.id -= int(cnt.bit, 1)
+      if __expr and cnt.id == int(cnt.bit, 0): loop = int1(0)
+      if __expr and zf.id == int1(0): loop = int1(0) */
+  if (rInsn.GetPrefix() & (X86_Prefix_Rep))
+  {
+    /* block glb expressions */
+    AllExpr.push_back(Expr::MakeIfElseCond(
+      ConditionExpression::CondEq,
+      Expr::MakeId(m_CpuInfo.GetRegisterByType(CpuInformation::CounterRegister, rInsn.GetMode()), &m_CpuInfo),
+      Expr::MakeBitVector(m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::CounterRegister, rInsn.GetMode())), 0x0),
+      Expr::MakeAssign(
+        Expr::MakeVar("loop", VariableExpression::Use),
+        Expr::MakeBitVector(1, 0x0)), nullptr)
+    );
+    AllExpr.push_back(Expr::MakeWhileCond(
+      ConditionExpression::CondEq,
+      Expr::MakeVar("loop", VariableExpression::Use),
+      Expr::MakeBitVector(1, 0x1),
+      Expr::MakeBind({
+      Expr::MakeVar("res", VariableExpression::Alloc, rInsn.GetOperand(0)->GetBitSize()),
+      Expr::MakeAssign(
+        Expr::MakeVar("res", VariableExpression::Use),
+        Expr::MakeBinOp(
+          OperationExpression::OpSub,
+          rInsn.GetOperand(0),
+          rInsn.GetOperand(1))),
+      Expr::MakeAssign(
+        Expr::MakeId(X86_FlOf, &m_CpuInfo),
+        Expr::MakeBinOp(OperationExpression::OpBcast, Expr::MakeBinOp(
+          OperationExpression::OpLrs,
+          Expr::MakeBinOp(
+            OperationExpression::OpAnd,
+            Expr::MakeBinOp(
+              OperationExpression::OpXor,
+              rInsn.GetOperand(0),
+              Expr::MakeVar("res", VariableExpression::Use)),
+            Expr::MakeBinOp(
+              OperationExpression::OpXor,
+              rInsn.GetOperand(0),
+              rInsn.GetOperand(1))),
+          Expr::MakeBinOp(
+            OperationExpression::OpSub,
+            Expr::MakeBitVector(rInsn.GetOperand(0)->GetBitSize(), rInsn.GetOperand(0)->GetBitSize()),
+            Expr::MakeBitVector(rInsn.GetOperand(0)->GetBitSize(), 0x1))), Expr::MakeBitVector(1, 0x1))),
+      Expr::MakeAssign(
+        Expr::MakeId(X86_FlCf, &m_CpuInfo),
+        Expr::MakeBinOp(OperationExpression::OpBcast, Expr::MakeBinOp(
+          OperationExpression::OpLrs,
+          Expr::MakeBinOp(
+            OperationExpression::OpXor,
+            Expr::MakeBinOp(
+              OperationExpression::OpXor,
+              Expr::MakeBinOp(
+                OperationExpression::OpXor,
+                rInsn.GetOperand(0),
+                rInsn.GetOperand(1)),
+              Expr::MakeVar("res", VariableExpression::Use)),
+            Expr::MakeBinOp(
+              OperationExpression::OpAnd,
+              Expr::MakeBinOp(
+                OperationExpression::OpXor,
+                rInsn.GetOperand(0),
+                Expr::MakeVar("res", VariableExpression::Use)),
+              Expr::MakeBinOp(
+                OperationExpression::OpXor,
+                rInsn.GetOperand(0),
+                rInsn.GetOperand(1)))),
+          Expr::MakeBinOp(
+            OperationExpression::OpSub,
+            Expr::MakeBitVector(rInsn.GetOperand(0)->GetBitSize(), rInsn.GetOperand(0)->GetBitSize()),
+            Expr::MakeBitVector(rInsn.GetOperand(0)->GetBitSize(), 0x1))), Expr::MakeBitVector(1, 0x1))),
+      Expr::MakeAssign(
+        Expr::MakeId(X86_FlSf, &m_CpuInfo),
+        Expr::MakeBinOp(OperationExpression::OpBcast, Expr::MakeBinOp(
+          OperationExpression::OpLrs,
+          Expr::MakeVar("res", VariableExpression::Use),
+          Expr::MakeBinOp(
+            OperationExpression::OpSub,
+            Expr::MakeBitVector(rInsn.GetOperand(0)->GetBitSize(), rInsn.GetOperand(0)->GetBitSize()),
+            Expr::MakeBitVector(rInsn.GetOperand(0)->GetBitSize(), 0x1))), Expr::MakeBitVector(1, 0x1))),
+      Expr::MakeAssign(
+        Expr::MakeId(X86_FlZf, &m_CpuInfo),
+        Expr::MakeTernaryCond(ConditionExpression::CondEq,
+        Expr::MakeVar("res", VariableExpression::Use),
+        Expr::MakeBitVector(rInsn.GetOperand(0)->GetBitSize(), 0x0),
+        Expr::MakeBitVector(1, 0x1), Expr::MakeBitVector(1, 0x0))),
+      Expr::MakeVar("pf_tmp", VariableExpression::Alloc, m_CpuInfo.GetSizeOfRegisterInBit(X86_FlPf)),
+      Expr::MakeAssign(
+        Expr::MakeVar("pf_tmp", VariableExpression::Use),
+        Expr::MakeBitVector(1, 0x1)),
+      Expr::MakeAssign(
+        Expr::MakeVar("pf_tmp", VariableExpression::Use),
+        Expr::MakeBinOp(
+          OperationExpression::OpXor,
+          Expr::MakeVar("pf_tmp", VariableExpression::Use),
+          Expr::MakeBinOp(OperationExpression::OpBcast, Expr::MakeBinOp(
+            OperationExpression::OpLrs,
+            Expr::MakeVar("res", VariableExpression::Use),
+            Expr::MakeBitVector(rInsn.GetOperand(0)->GetBitSize(), 0x0)), Expr::MakeBitVector(1, 0x1))))
+      ,
+      Expr::MakeAssign(
+        Expr::MakeVar("pf_tmp", VariableExpression::Use),
+        Expr::MakeBinOp(
+          OperationExpression::OpXor,
+          Expr::MakeVar("pf_tmp", VariableExpression::Use),
+          Expr::MakeBinOp(OperationExpression::OpBcast, Expr::MakeBinOp(
+            OperationExpression::OpLrs,
+            Expr::MakeVar("res", VariableExpression::Use),
+            Expr::MakeBitVector(rInsn.GetOperand(0)->GetBitSize(), 0x1)), Expr::MakeBitVector(1, 0x1))))
+      ,
+      Expr::MakeAssign(
+        Expr::MakeVar("pf_tmp", VariableExpression::Use),
+        Expr::MakeBinOp(
+          OperationExpression::OpXor,
+          Expr::MakeVar("pf_tmp", VariableExpression::Use),
+          Expr::MakeBinOp(OperationExpression::OpBcast, Expr::MakeBinOp(
+            OperationExpression::OpLrs,
+            Expr::MakeVar("res", VariableExpression::Use),
+            Expr::MakeBitVector(rInsn.GetOperand(0)->GetBitSize(), 0x2)), Expr::MakeBitVector(1, 0x1))))
+      ,
+      Expr::MakeAssign(
+        Expr::MakeVar("pf_tmp", VariableExpression::Use),
+        Expr::MakeBinOp(
+          OperationExpression::OpXor,
+          Expr::MakeVar("pf_tmp", VariableExpression::Use),
+          Expr::MakeBinOp(OperationExpression::OpBcast, Expr::MakeBinOp(
+            OperationExpression::OpLrs,
+            Expr::MakeVar("res", VariableExpression::Use),
+            Expr::MakeBitVector(rInsn.GetOperand(0)->GetBitSize(), 0x3)), Expr::MakeBitVector(1, 0x1))))
+      ,
+      Expr::MakeAssign(
+        Expr::MakeVar("pf_tmp", VariableExpression::Use),
+        Expr::MakeBinOp(
+          OperationExpression::OpXor,
+          Expr::MakeVar("pf_tmp", VariableExpression::Use),
+          Expr::MakeBinOp(OperationExpression::OpBcast, Expr::MakeBinOp(
+            OperationExpression::OpLrs,
+            Expr::MakeVar("res", VariableExpression::Use),
+            Expr::MakeBitVector(rInsn.GetOperand(0)->GetBitSize(), 0x4)), Expr::MakeBitVector(1, 0x1))))
+      ,
+      Expr::MakeAssign(
+        Expr::MakeVar("pf_tmp", VariableExpression::Use),
+        Expr::MakeBinOp(
+          OperationExpression::OpXor,
+          Expr::MakeVar("pf_tmp", VariableExpression::Use),
+          Expr::MakeBinOp(OperationExpression::OpBcast, Expr::MakeBinOp(
+            OperationExpression::OpLrs,
+            Expr::MakeVar("res", VariableExpression::Use),
+            Expr::MakeBitVector(rInsn.GetOperand(0)->GetBitSize(), 0x5)), Expr::MakeBitVector(1, 0x1))))
+      ,
+      Expr::MakeAssign(
+        Expr::MakeVar("pf_tmp", VariableExpression::Use),
+        Expr::MakeBinOp(
+          OperationExpression::OpXor,
+          Expr::MakeVar("pf_tmp", VariableExpression::Use),
+          Expr::MakeBinOp(OperationExpression::OpBcast, Expr::MakeBinOp(
+            OperationExpression::OpLrs,
+            Expr::MakeVar("res", VariableExpression::Use),
+            Expr::MakeBitVector(rInsn.GetOperand(0)->GetBitSize(), 0x6)), Expr::MakeBitVector(1, 0x1))))
+      ,
+      Expr::MakeAssign(
+        Expr::MakeVar("pf_tmp", VariableExpression::Use),
+        Expr::MakeBinOp(
+          OperationExpression::OpXor,
+          Expr::MakeVar("pf_tmp", VariableExpression::Use),
+          Expr::MakeBinOp(OperationExpression::OpBcast, Expr::MakeBinOp(
+            OperationExpression::OpLrs,
+            Expr::MakeVar("res", VariableExpression::Use),
+            Expr::MakeBitVector(rInsn.GetOperand(0)->GetBitSize(), 0x7)), Expr::MakeBitVector(1, 0x1))))
+      ,
+      Expr::MakeAssign(
+        Expr::MakeId(X86_FlPf, &m_CpuInfo),
+        Expr::MakeVar("pf_tmp", VariableExpression::Use)),
+      Expr::MakeVar("pf_tmp", VariableExpression::Free),
+      Expr::MakeAssign(
+        Expr::MakeId(X86_FlAf, &m_CpuInfo),
+        Expr::MakeBinOp(OperationExpression::OpBcast, Expr::MakeBinOp(
+          OperationExpression::OpLrs,
+          Expr::MakeBinOp(
+            OperationExpression::OpXor,
+            Expr::MakeBinOp(
+              OperationExpression::OpXor,
+              rInsn.GetOperand(0),
+              rInsn.GetOperand(1)),
+            Expr::MakeVar("res", VariableExpression::Use)),
+          Expr::MakeBitVector(rInsn.GetOperand(0)->GetBitSize(), 0x4)), Expr::MakeBitVector(1, 0x1))),
+      Expr::MakeIfElseCond(
+        ConditionExpression::CondEq,
+        Expr::MakeId(X86_FlDf, &m_CpuInfo),
+        Expr::MakeBitVector(1, 0x1),
+        Expr::MakeBind({
+        Expr::MakeAssign(
+          expr_cast<MemoryExpression>(rInsn.GetOperand(0))->GetOffsetExpression(),
+          Expr::MakeBinOp(
+            OperationExpression::OpSub,
+            expr_cast<MemoryExpression>(rInsn.GetOperand(0))->GetOffsetExpression(),
+            Expr::MakeBitVector(expr_cast<MemoryExpression>(rInsn.GetOperand(0))->GetOffsetExpression()->GetBitSize(), rInsn.GetOperand(0)->GetBitSize() / 8)))
+        ,
+        Expr::MakeAssign(
+          expr_cast<MemoryExpression>(rInsn.GetOperand(1))->GetOffsetExpression(),
+          Expr::MakeBinOp(
+            OperationExpression::OpSub,
+            expr_cast<MemoryExpression>(rInsn.GetOperand(1))->GetOffsetExpression(),
+            Expr::MakeBitVector(expr_cast<MemoryExpression>(rInsn.GetOperand(1))->GetOffsetExpression()->GetBitSize(), rInsn.GetOperand(1)->GetBitSize() / 8)))
+        })
+      ,
+        Expr::MakeBind({
+        Expr::MakeAssign(
+          expr_cast<MemoryExpression>(rInsn.GetOperand(0))->GetOffsetExpression(),
+          Expr::MakeBinOp(
+            OperationExpression::OpAdd,
+            expr_cast<MemoryExpression>(rInsn.GetOperand(0))->GetOffsetExpression(),
+            Expr::MakeBitVector(expr_cast<MemoryExpression>(rInsn.GetOperand(0))->GetOffsetExpression()->GetBitSize(), rInsn.GetOperand(0)->GetBitSize() / 8)))
+        ,
+        Expr::MakeAssign(
+          expr_cast<MemoryExpression>(rInsn.GetOperand(1))->GetOffsetExpression(),
+          Expr::MakeBinOp(
+            OperationExpression::OpAdd,
+            expr_cast<MemoryExpression>(rInsn.GetOperand(1))->GetOffsetExpression(),
+            Expr::MakeBitVector(expr_cast<MemoryExpression>(rInsn.GetOperand(1))->GetOffsetExpression()->GetBitSize(), rInsn.GetOperand(1)->GetBitSize() / 8)))
+        })
+      ),
+      Expr::MakeVar("res", VariableExpression::Free),
+      Expr::MakeAssign(
+        Expr::MakeId(m_CpuInfo.GetRegisterByType(CpuInformation::CounterRegister, rInsn.GetMode()), &m_CpuInfo),
+        Expr::MakeBinOp(
+          OperationExpression::OpSub,
+          Expr::MakeId(m_CpuInfo.GetRegisterByType(CpuInformation::CounterRegister, rInsn.GetMode()), &m_CpuInfo),
+          Expr::MakeBitVector(m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::CounterRegister, rInsn.GetMode())), 0x1)))
+      ,
+      Expr::MakeIfElseCond(
+        ConditionExpression::CondEq,
+        Expr::MakeId(m_CpuInfo.GetRegisterByType(CpuInformation::CounterRegister, rInsn.GetMode()), &m_CpuInfo),
+        Expr::MakeBitVector(m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::CounterRegister, rInsn.GetMode())), 0x0),
+        Expr::MakeAssign(
+          Expr::MakeVar("loop", VariableExpression::Use),
+          Expr::MakeBitVector(1, 0x0)), nullptr)
+      ,
+      Expr::MakeIfElseCond(
+        ConditionExpression::CondEq,
+        Expr::MakeId(X86_FlZf, &m_CpuInfo),
+        Expr::MakeBitVector(1, 0x0),
+        Expr::MakeAssign(
+          Expr::MakeVar("loop", VariableExpression::Use),
+          Expr::MakeBitVector(1, 0x0)), nullptr)
+      })
+    ));
+  }
+  /* semantic: if __code and instruction_has_prefix(repnz):
+    if __expr and cnt.id == int(cnt.bit, 0): loop = int1(0)
+    while loop == int1(1):
+      call('compare_string')
+      cnt.id -= int(cnt.bit, 1)
+      if __expr and cnt.id == int(cnt.bit, 0): loop = int1(0)
+      if __expr and zf.id == int1(1): loop = int1(0) */
+  if (rInsn.GetPrefix() & (X86_Prefix_RepNz))
+  {
+    /* block glb expressions */
+    AllExpr.push_back(Expr::MakeIfElseCond(
+      ConditionExpression::CondEq,
+      Expr::MakeId(m_CpuInfo.GetRegisterByType(CpuInformation::CounterRegister, rInsn.GetMode()), &m_CpuInfo),
+      Expr::MakeBitVector(m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::CounterRegister, rInsn.GetMode())), 0x0),
+      Expr::MakeAssign(
+        Expr::MakeVar("loop", VariableExpression::Use),
+        Expr::MakeBitVector(1, 0x0)), nullptr)
+    );
+    AllExpr.push_back(Expr::MakeWhileCond(
+      ConditionExpression::CondEq,
+      Expr::MakeVar("loop", VariableExpression::Use),
+      Expr::MakeBitVector(1, 0x1),
+      Expr::MakeBind({
+      Expr::MakeVar("res", VariableExpression::Alloc, rInsn.GetOperand(0)->GetBitSize()),
+      Expr::MakeAssign(
+        Expr::MakeVar("res", VariableExpression::Use),
+        Expr::MakeBinOp(
+          OperationExpression::OpSub,
+          rInsn.GetOperand(0),
+          rInsn.GetOperand(1))),
+      Expr::MakeAssign(
+        Expr::MakeId(X86_FlOf, &m_CpuInfo),
+        Expr::MakeBinOp(OperationExpression::OpBcast, Expr::MakeBinOp(
+          OperationExpression::OpLrs,
+          Expr::MakeBinOp(
+            OperationExpression::OpAnd,
+            Expr::MakeBinOp(
+              OperationExpression::OpXor,
+              rInsn.GetOperand(0),
+              Expr::MakeVar("res", VariableExpression::Use)),
+            Expr::MakeBinOp(
+              OperationExpression::OpXor,
+              rInsn.GetOperand(0),
+              rInsn.GetOperand(1))),
+          Expr::MakeBinOp(
+            OperationExpression::OpSub,
+            Expr::MakeBitVector(rInsn.GetOperand(0)->GetBitSize(), rInsn.GetOperand(0)->GetBitSize()),
+            Expr::MakeBitVector(rInsn.GetOperand(0)->GetBitSize(), 0x1))), Expr::MakeBitVector(1, 0x1))),
+      Expr::MakeAssign(
+        Expr::MakeId(X86_FlCf, &m_CpuInfo),
+        Expr::MakeBinOp(OperationExpression::OpBcast, Expr::MakeBinOp(
+          OperationExpression::OpLrs,
+          Expr::MakeBinOp(
+            OperationExpression::OpXor,
+            Expr::MakeBinOp(
+              OperationExpression::OpXor,
+              Expr::MakeBinOp(
+                OperationExpression::OpXor,
+                rInsn.GetOperand(0),
+                rInsn.GetOperand(1)),
+              Expr::MakeVar("res", VariableExpression::Use)),
+            Expr::MakeBinOp(
+              OperationExpression::OpAnd,
+              Expr::MakeBinOp(
+                OperationExpression::OpXor,
+                rInsn.GetOperand(0),
+                Expr::MakeVar("res", VariableExpression::Use)),
+              Expr::MakeBinOp(
+                OperationExpression::OpXor,
+                rInsn.GetOperand(0),
+                rInsn.GetOperand(1)))),
+          Expr::MakeBinOp(
+            OperationExpression::OpSub,
+            Expr::MakeBitVector(rInsn.GetOperand(0)->GetBitSize(), rInsn.GetOperand(0)->GetBitSize()),
+            Expr::MakeBitVector(rInsn.GetOperand(0)->GetBitSize(), 0x1))), Expr::MakeBitVector(1, 0x1))),
+      Expr::MakeAssign(
+        Expr::MakeId(X86_FlSf, &m_CpuInfo),
+        Expr::MakeBinOp(OperationExpression::OpBcast, Expr::MakeBinOp(
+          OperationExpression::OpLrs,
+          Expr::MakeVar("res", VariableExpression::Use),
+          Expr::MakeBinOp(
+            OperationExpression::OpSub,
+            Expr::MakeBitVector(rInsn.GetOperand(0)->GetBitSize(), rInsn.GetOperand(0)->GetBitSize()),
+            Expr::MakeBitVector(rInsn.GetOperand(0)->GetBitSize(), 0x1))), Expr::MakeBitVector(1, 0x1))),
+      Expr::MakeAssign(
+        Expr::MakeId(X86_FlZf, &m_CpuInfo),
+        Expr::MakeTernaryCond(ConditionExpression::CondEq,
+        Expr::MakeVar("res", VariableExpression::Use),
+        Expr::MakeBitVector(rInsn.GetOperand(0)->GetBitSize(), 0x0),
+        Expr::MakeBitVector(1, 0x1), Expr::MakeBitVector(1, 0x0))),
+      Expr::MakeVar("pf_tmp", VariableExpression::Alloc, m_CpuInfo.GetSizeOfRegisterInBit(X86_FlPf)),
+      Expr::MakeAssign(
+        Expr::MakeVar("pf_tmp", VariableExpression::Use),
+        Expr::MakeBitVector(1, 0x1)),
+      Expr::MakeAssign(
+        Expr::MakeVar("pf_tmp", VariableExpression::Use),
+        Expr::MakeBinOp(
+          OperationExpression::OpXor,
+          Expr::MakeVar("pf_tmp", VariableExpression::Use),
+          Expr::MakeBinOp(OperationExpression::OpBcast, Expr::MakeBinOp(
+            OperationExpression::OpLrs,
+            Expr::MakeVar("res", VariableExpression::Use),
+            Expr::MakeBitVector(rInsn.GetOperand(0)->GetBitSize(), 0x0)), Expr::MakeBitVector(1, 0x1))))
+      ,
+      Expr::MakeAssign(
+        Expr::MakeVar("pf_tmp", VariableExpression::Use),
+        Expr::MakeBinOp(
+          OperationExpression::OpXor,
+          Expr::MakeVar("pf_tmp", VariableExpression::Use),
+          Expr::MakeBinOp(OperationExpression::OpBcast, Expr::MakeBinOp(
+            OperationExpression::OpLrs,
+            Expr::MakeVar("res", VariableExpression::Use),
+            Expr::MakeBitVector(rInsn.GetOperand(0)->GetBitSize(), 0x1)), Expr::MakeBitVector(1, 0x1))))
+      ,
+      Expr::MakeAssign(
+        Expr::MakeVar("pf_tmp", VariableExpression::Use),
+        Expr::MakeBinOp(
+          OperationExpression::OpXor,
+          Expr::MakeVar("pf_tmp", VariableExpression::Use),
+          Expr::MakeBinOp(OperationExpression::OpBcast, Expr::MakeBinOp(
+            OperationExpression::OpLrs,
+            Expr::MakeVar("res", VariableExpression::Use),
+            Expr::MakeBitVector(rInsn.GetOperand(0)->GetBitSize(), 0x2)), Expr::MakeBitVector(1, 0x1))))
+      ,
+      Expr::MakeAssign(
+        Expr::MakeVar("pf_tmp", VariableExpression::Use),
+        Expr::MakeBinOp(
+          OperationExpression::OpXor,
+          Expr::MakeVar("pf_tmp", VariableExpression::Use),
+          Expr::MakeBinOp(OperationExpression::OpBcast, Expr::MakeBinOp(
+            OperationExpression::OpLrs,
+            Expr::MakeVar("res", VariableExpression::Use),
+            Expr::MakeBitVector(rInsn.GetOperand(0)->GetBitSize(), 0x3)), Expr::MakeBitVector(1, 0x1))))
+      ,
+      Expr::MakeAssign(
+        Expr::MakeVar("pf_tmp", VariableExpression::Use),
+        Expr::MakeBinOp(
+          OperationExpression::OpXor,
+          Expr::MakeVar("pf_tmp", VariableExpression::Use),
+          Expr::MakeBinOp(OperationExpression::OpBcast, Expr::MakeBinOp(
+            OperationExpression::OpLrs,
+            Expr::MakeVar("res", VariableExpression::Use),
+            Expr::MakeBitVector(rInsn.GetOperand(0)->GetBitSize(), 0x4)), Expr::MakeBitVector(1, 0x1))))
+      ,
+      Expr::MakeAssign(
+        Expr::MakeVar("pf_tmp", VariableExpression::Use),
+        Expr::MakeBinOp(
+          OperationExpression::OpXor,
+          Expr::MakeVar("pf_tmp", VariableExpression::Use),
+          Expr::MakeBinOp(OperationExpression::OpBcast, Expr::MakeBinOp(
+            OperationExpression::OpLrs,
+            Expr::MakeVar("res", VariableExpression::Use),
+            Expr::MakeBitVector(rInsn.GetOperand(0)->GetBitSize(), 0x5)), Expr::MakeBitVector(1, 0x1))))
+      ,
+      Expr::MakeAssign(
+        Expr::MakeVar("pf_tmp", VariableExpression::Use),
+        Expr::MakeBinOp(
+          OperationExpression::OpXor,
+          Expr::MakeVar("pf_tmp", VariableExpression::Use),
+          Expr::MakeBinOp(OperationExpression::OpBcast, Expr::MakeBinOp(
+            OperationExpression::OpLrs,
+            Expr::MakeVar("res", VariableExpression::Use),
+            Expr::MakeBitVector(rInsn.GetOperand(0)->GetBitSize(), 0x6)), Expr::MakeBitVector(1, 0x1))))
+      ,
+      Expr::MakeAssign(
+        Expr::MakeVar("pf_tmp", VariableExpression::Use),
+        Expr::MakeBinOp(
+          OperationExpression::OpXor,
+          Expr::MakeVar("pf_tmp", VariableExpression::Use),
+          Expr::MakeBinOp(OperationExpression::OpBcast, Expr::MakeBinOp(
+            OperationExpression::OpLrs,
+            Expr::MakeVar("res", VariableExpression::Use),
+            Expr::MakeBitVector(rInsn.GetOperand(0)->GetBitSize(), 0x7)), Expr::MakeBitVector(1, 0x1))))
+      ,
+      Expr::MakeAssign(
+        Expr::MakeId(X86_FlPf, &m_CpuInfo),
+        Expr::MakeVar("pf_tmp", VariableExpression::Use)),
+      Expr::MakeVar("pf_tmp", VariableExpression::Free),
+      Expr::MakeAssign(
+        Expr::MakeId(X86_FlAf, &m_CpuInfo),
+        Expr::MakeBinOp(OperationExpression::OpBcast, Expr::MakeBinOp(
+          OperationExpression::OpLrs,
+          Expr::MakeBinOp(
+            OperationExpression::OpXor,
+            Expr::MakeBinOp(
+              OperationExpression::OpXor,
+              rInsn.GetOperand(0),
+              rInsn.GetOperand(1)),
+            Expr::MakeVar("res", VariableExpression::Use)),
+          Expr::MakeBitVector(rInsn.GetOperand(0)->GetBitSize(), 0x4)), Expr::MakeBitVector(1, 0x1))),
+      Expr::MakeIfElseCond(
+        ConditionExpression::CondEq,
+        Expr::MakeId(X86_FlDf, &m_CpuInfo),
+        Expr::MakeBitVector(1, 0x1),
+        Expr::MakeBind({
+        Expr::MakeAssign(
+          expr_cast<MemoryExpression>(rInsn.GetOperand(0))->GetOffsetExpression(),
+          Expr::MakeBinOp(
+            OperationExpression::OpSub,
+            expr_cast<MemoryExpression>(rInsn.GetOperand(0))->GetOffsetExpression(),
+            Expr::MakeBitVector(expr_cast<MemoryExpression>(rInsn.GetOperand(0))->GetOffsetExpression()->GetBitSize(), rInsn.GetOperand(0)->GetBitSize() / 8)))
+        ,
+        Expr::MakeAssign(
+          expr_cast<MemoryExpression>(rInsn.GetOperand(1))->GetOffsetExpression(),
+          Expr::MakeBinOp(
+            OperationExpression::OpSub,
+            expr_cast<MemoryExpression>(rInsn.GetOperand(1))->GetOffsetExpression(),
+            Expr::MakeBitVector(expr_cast<MemoryExpression>(rInsn.GetOperand(1))->GetOffsetExpression()->GetBitSize(), rInsn.GetOperand(1)->GetBitSize() / 8)))
+        })
+      ,
+        Expr::MakeBind({
+        Expr::MakeAssign(
+          expr_cast<MemoryExpression>(rInsn.GetOperand(0))->GetOffsetExpression(),
+          Expr::MakeBinOp(
+            OperationExpression::OpAdd,
+            expr_cast<MemoryExpression>(rInsn.GetOperand(0))->GetOffsetExpression(),
+            Expr::MakeBitVector(expr_cast<MemoryExpression>(rInsn.GetOperand(0))->GetOffsetExpression()->GetBitSize(), rInsn.GetOperand(0)->GetBitSize() / 8)))
+        ,
+        Expr::MakeAssign(
+          expr_cast<MemoryExpression>(rInsn.GetOperand(1))->GetOffsetExpression(),
+          Expr::MakeBinOp(
+            OperationExpression::OpAdd,
+            expr_cast<MemoryExpression>(rInsn.GetOperand(1))->GetOffsetExpression(),
+            Expr::MakeBitVector(expr_cast<MemoryExpression>(rInsn.GetOperand(1))->GetOffsetExpression()->GetBitSize(), rInsn.GetOperand(1)->GetBitSize() / 8)))
+        })
+      ),
+      Expr::MakeVar("res", VariableExpression::Free),
+      Expr::MakeAssign(
+        Expr::MakeId(m_CpuInfo.GetRegisterByType(CpuInformation::CounterRegister, rInsn.GetMode()), &m_CpuInfo),
+        Expr::MakeBinOp(
+          OperationExpression::OpSub,
+          Expr::MakeId(m_CpuInfo.GetRegisterByType(CpuInformation::CounterRegister, rInsn.GetMode()), &m_CpuInfo),
+          Expr::MakeBitVector(m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::CounterRegister, rInsn.GetMode())), 0x1)))
+      ,
+      Expr::MakeIfElseCond(
+        ConditionExpression::CondEq,
+        Expr::MakeId(m_CpuInfo.GetRegisterByType(CpuInformation::CounterRegister, rInsn.GetMode()), &m_CpuInfo),
+        Expr::MakeBitVector(m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::CounterRegister, rInsn.GetMode())), 0x0),
+        Expr::MakeAssign(
+          Expr::MakeVar("loop", VariableExpression::Use),
+          Expr::MakeBitVector(1, 0x0)), nullptr)
+      ,
+      Expr::MakeIfElseCond(
+        ConditionExpression::CondEq,
+        Expr::MakeId(X86_FlZf, &m_CpuInfo),
+        Expr::MakeBitVector(1, 0x1),
+        Expr::MakeAssign(
+          Expr::MakeVar("loop", VariableExpression::Use),
+          Expr::MakeBitVector(1, 0x0)), nullptr)
+      })
+    ));
+  }
+  /* semantic: if __code and instruction_has_no_prefix(repz, repnz):
+    call('compare_string') */
+  if (!(rInsn.GetPrefix() & (X86_Prefix_Rep | X86_Prefix_RepNz)))
+  {
+    /* block glb expressions */
+    AllExpr.push_back(Expr::MakeVar("res", VariableExpression::Alloc, rInsn.GetOperand(0)->GetBitSize()));
+    AllExpr.push_back(Expr::MakeAssign(
+      Expr::MakeVar("res", VariableExpression::Use),
+      Expr::MakeBinOp(
+        OperationExpression::OpSub,
+        rInsn.GetOperand(0),
+        rInsn.GetOperand(1))));
+    AllExpr.push_back(Expr::MakeAssign(
+      Expr::MakeId(X86_FlOf, &m_CpuInfo),
+      Expr::MakeBinOp(OperationExpression::OpBcast, Expr::MakeBinOp(
+        OperationExpression::OpLrs,
+        Expr::MakeBinOp(
+          OperationExpression::OpAnd,
+          Expr::MakeBinOp(
+            OperationExpression::OpXor,
+            rInsn.GetOperand(0),
+            Expr::MakeVar("res", VariableExpression::Use)),
+          Expr::MakeBinOp(
+            OperationExpression::OpXor,
+            rInsn.GetOperand(0),
+            rInsn.GetOperand(1))),
+        Expr::MakeBinOp(
+          OperationExpression::OpSub,
+          Expr::MakeBitVector(rInsn.GetOperand(0)->GetBitSize(), rInsn.GetOperand(0)->GetBitSize()),
+          Expr::MakeBitVector(rInsn.GetOperand(0)->GetBitSize(), 0x1))), Expr::MakeBitVector(1, 0x1))));
+    AllExpr.push_back(Expr::MakeAssign(
+      Expr::MakeId(X86_FlCf, &m_CpuInfo),
+      Expr::MakeBinOp(OperationExpression::OpBcast, Expr::MakeBinOp(
+        OperationExpression::OpLrs,
+        Expr::MakeBinOp(
+          OperationExpression::OpXor,
+          Expr::MakeBinOp(
+            OperationExpression::OpXor,
+            Expr::MakeBinOp(
+              OperationExpression::OpXor,
+              rInsn.GetOperand(0),
+              rInsn.GetOperand(1)),
+            Expr::MakeVar("res", VariableExpression::Use)),
+          Expr::MakeBinOp(
+            OperationExpression::OpAnd,
+            Expr::MakeBinOp(
+              OperationExpression::OpXor,
+              rInsn.GetOperand(0),
+              Expr::MakeVar("res", VariableExpression::Use)),
+            Expr::MakeBinOp(
+              OperationExpression::OpXor,
+              rInsn.GetOperand(0),
+              rInsn.GetOperand(1)))),
+        Expr::MakeBinOp(
+          OperationExpression::OpSub,
+          Expr::MakeBitVector(rInsn.GetOperand(0)->GetBitSize(), rInsn.GetOperand(0)->GetBitSize()),
+          Expr::MakeBitVector(rInsn.GetOperand(0)->GetBitSize(), 0x1))), Expr::MakeBitVector(1, 0x1))));
+    AllExpr.push_back(Expr::MakeAssign(
+      Expr::MakeId(X86_FlSf, &m_CpuInfo),
+      Expr::MakeBinOp(OperationExpression::OpBcast, Expr::MakeBinOp(
+        OperationExpression::OpLrs,
+        Expr::MakeVar("res", VariableExpression::Use),
+        Expr::MakeBinOp(
+          OperationExpression::OpSub,
+          Expr::MakeBitVector(rInsn.GetOperand(0)->GetBitSize(), rInsn.GetOperand(0)->GetBitSize()),
+          Expr::MakeBitVector(rInsn.GetOperand(0)->GetBitSize(), 0x1))), Expr::MakeBitVector(1, 0x1))));
+    AllExpr.push_back(Expr::MakeAssign(
+      Expr::MakeId(X86_FlZf, &m_CpuInfo),
+      Expr::MakeTernaryCond(ConditionExpression::CondEq,
+      Expr::MakeVar("res", VariableExpression::Use),
+      Expr::MakeBitVector(rInsn.GetOperand(0)->GetBitSize(), 0x0),
+      Expr::MakeBitVector(1, 0x1), Expr::MakeBitVector(1, 0x0))));
+    AllExpr.push_back(Expr::MakeVar("pf_tmp", VariableExpression::Alloc, m_CpuInfo.GetSizeOfRegisterInBit(X86_FlPf)));
+    AllExpr.push_back(Expr::MakeAssign(
+      Expr::MakeVar("pf_tmp", VariableExpression::Use),
+      Expr::MakeBitVector(1, 0x1)));
+    AllExpr.push_back(Expr::MakeAssign(
+      Expr::MakeVar("pf_tmp", VariableExpression::Use),
+      Expr::MakeBinOp(
+        OperationExpression::OpXor,
+        Expr::MakeVar("pf_tmp", VariableExpression::Use),
+        Expr::MakeBinOp(OperationExpression::OpBcast, Expr::MakeBinOp(
+          OperationExpression::OpLrs,
+          Expr::MakeVar("res", VariableExpression::Use),
+          Expr::MakeBitVector(rInsn.GetOperand(0)->GetBitSize(), 0x0)), Expr::MakeBitVector(1, 0x1))))
+    );
+    AllExpr.push_back(Expr::MakeAssign(
+      Expr::MakeVar("pf_tmp", VariableExpression::Use),
+      Expr::MakeBinOp(
+        OperationExpression::OpXor,
+        Expr::MakeVar("pf_tmp", VariableExpression::Use),
+        Expr::MakeBinOp(OperationExpression::OpBcast, Expr::MakeBinOp(
+          OperationExpression::OpLrs,
+          Expr::MakeVar("res", VariableExpression::Use),
+          Expr::MakeBitVector(rInsn.GetOperand(0)->GetBitSize(), 0x1)), Expr::MakeBitVector(1, 0x1))))
+    );
+    AllExpr.push_back(Expr::MakeAssign(
+      Expr::MakeVar("pf_tmp", VariableExpression::Use),
+      Expr::MakeBinOp(
+        OperationExpression::OpXor,
+        Expr::MakeVar("pf_tmp", VariableExpression::Use),
+        Expr::MakeBinOp(OperationExpression::OpBcast, Expr::MakeBinOp(
+          OperationExpression::OpLrs,
+          Expr::MakeVar("res", VariableExpression::Use),
+          Expr::MakeBitVector(rInsn.GetOperand(0)->GetBitSize(), 0x2)), Expr::MakeBitVector(1, 0x1))))
+    );
+    AllExpr.push_back(Expr::MakeAssign(
+      Expr::MakeVar("pf_tmp", VariableExpression::Use),
+      Expr::MakeBinOp(
+        OperationExpression::OpXor,
+        Expr::MakeVar("pf_tmp", VariableExpression::Use),
+        Expr::MakeBinOp(OperationExpression::OpBcast, Expr::MakeBinOp(
+          OperationExpression::OpLrs,
+          Expr::MakeVar("res", VariableExpression::Use),
+          Expr::MakeBitVector(rInsn.GetOperand(0)->GetBitSize(), 0x3)), Expr::MakeBitVector(1, 0x1))))
+    );
+    AllExpr.push_back(Expr::MakeAssign(
+      Expr::MakeVar("pf_tmp", VariableExpression::Use),
+      Expr::MakeBinOp(
+        OperationExpression::OpXor,
+        Expr::MakeVar("pf_tmp", VariableExpression::Use),
+        Expr::MakeBinOp(OperationExpression::OpBcast, Expr::MakeBinOp(
+          OperationExpression::OpLrs,
+          Expr::MakeVar("res", VariableExpression::Use),
+          Expr::MakeBitVector(rInsn.GetOperand(0)->GetBitSize(), 0x4)), Expr::MakeBitVector(1, 0x1))))
+    );
+    AllExpr.push_back(Expr::MakeAssign(
+      Expr::MakeVar("pf_tmp", VariableExpression::Use),
+      Expr::MakeBinOp(
+        OperationExpression::OpXor,
+        Expr::MakeVar("pf_tmp", VariableExpression::Use),
+        Expr::MakeBinOp(OperationExpression::OpBcast, Expr::MakeBinOp(
+          OperationExpression::OpLrs,
+          Expr::MakeVar("res", VariableExpression::Use),
+          Expr::MakeBitVector(rInsn.GetOperand(0)->GetBitSize(), 0x5)), Expr::MakeBitVector(1, 0x1))))
+    );
+    AllExpr.push_back(Expr::MakeAssign(
+      Expr::MakeVar("pf_tmp", VariableExpression::Use),
+      Expr::MakeBinOp(
+        OperationExpression::OpXor,
+        Expr::MakeVar("pf_tmp", VariableExpression::Use),
+        Expr::MakeBinOp(OperationExpression::OpBcast, Expr::MakeBinOp(
+          OperationExpression::OpLrs,
+          Expr::MakeVar("res", VariableExpression::Use),
+          Expr::MakeBitVector(rInsn.GetOperand(0)->GetBitSize(), 0x6)), Expr::MakeBitVector(1, 0x1))))
+    );
+    AllExpr.push_back(Expr::MakeAssign(
+      Expr::MakeVar("pf_tmp", VariableExpression::Use),
+      Expr::MakeBinOp(
+        OperationExpression::OpXor,
+        Expr::MakeVar("pf_tmp", VariableExpression::Use),
+        Expr::MakeBinOp(OperationExpression::OpBcast, Expr::MakeBinOp(
+          OperationExpression::OpLrs,
+          Expr::MakeVar("res", VariableExpression::Use),
+          Expr::MakeBitVector(rInsn.GetOperand(0)->GetBitSize(), 0x7)), Expr::MakeBitVector(1, 0x1))))
+    );
+    AllExpr.push_back(Expr::MakeAssign(
+      Expr::MakeId(X86_FlPf, &m_CpuInfo),
+      Expr::MakeVar("pf_tmp", VariableExpression::Use)));
+    AllExpr.push_back(Expr::MakeVar("pf_tmp", VariableExpression::Free));
+    AllExpr.push_back(Expr::MakeAssign(
+      Expr::MakeId(X86_FlAf, &m_CpuInfo),
+      Expr::MakeBinOp(OperationExpression::OpBcast, Expr::MakeBinOp(
+        OperationExpression::OpLrs,
+        Expr::MakeBinOp(
+          OperationExpression::OpXor,
+          Expr::MakeBinOp(
+            OperationExpression::OpXor,
+            rInsn.GetOperand(0),
+            rInsn.GetOperand(1)),
+          Expr::MakeVar("res", VariableExpression::Use)),
+        Expr::MakeBitVector(rInsn.GetOperand(0)->GetBitSize(), 0x4)), Expr::MakeBitVector(1, 0x1))));
+    AllExpr.push_back(Expr::MakeIfElseCond(
+      ConditionExpression::CondEq,
+      Expr::MakeId(X86_FlDf, &m_CpuInfo),
+      Expr::MakeBitVector(1, 0x1),
+      Expr::MakeBind({
+      Expr::MakeAssign(
+        expr_cast<MemoryExpression>(rInsn.GetOperand(0))->GetOffsetExpression(),
+        Expr::MakeBinOp(
+          OperationExpression::OpSub,
+          expr_cast<MemoryExpression>(rInsn.GetOperand(0))->GetOffsetExpression(),
+          Expr::MakeBitVector(expr_cast<MemoryExpression>(rInsn.GetOperand(0))->GetOffsetExpression()->GetBitSize(), rInsn.GetOperand(0)->GetBitSize() / 8)))
+      ,
+      Expr::MakeAssign(
+        expr_cast<MemoryExpression>(rInsn.GetOperand(1))->GetOffsetExpression(),
+        Expr::MakeBinOp(
+          OperationExpression::OpSub,
+          expr_cast<MemoryExpression>(rInsn.GetOperand(1))->GetOffsetExpression(),
+          Expr::MakeBitVector(expr_cast<MemoryExpression>(rInsn.GetOperand(1))->GetOffsetExpression()->GetBitSize(), rInsn.GetOperand(1)->GetBitSize() / 8)))
+      })
+    ,
+      Expr::MakeBind({
+      Expr::MakeAssign(
+        expr_cast<MemoryExpression>(rInsn.GetOperand(0))->GetOffsetExpression(),
+        Expr::MakeBinOp(
+          OperationExpression::OpAdd,
+          expr_cast<MemoryExpression>(rInsn.GetOperand(0))->GetOffsetExpression(),
+          Expr::MakeBitVector(expr_cast<MemoryExpression>(rInsn.GetOperand(0))->GetOffsetExpression()->GetBitSize(), rInsn.GetOperand(0)->GetBitSize() / 8)))
+      ,
+      Expr::MakeAssign(
+        expr_cast<MemoryExpression>(rInsn.GetOperand(1))->GetOffsetExpression(),
+        Expr::MakeBinOp(
+          OperationExpression::OpAdd,
+          expr_cast<MemoryExpression>(rInsn.GetOperand(1))->GetOffsetExpression(),
+          Expr::MakeBitVector(expr_cast<MemoryExpression>(rInsn.GetOperand(1))->GetOffsetExpression()->GetBitSize(), rInsn.GetOperand(1)->GetBitSize() / 8)))
+      })
+    ));
+    AllExpr.push_back(Expr::MakeVar("res", VariableExpression::Free));
+  }
+  /* semantic: free_var('loop') */
+  AllExpr.push_back(Expr::MakeVar("loop", VariableExpression::Free));
+  rInsn.SetSemantic(AllExpr);
+}
+
+void X86Architecture::Semantic_024(Instruction& rInsn, u8 Mode)
+{
+  Expression::LSPType AllExpr;
+  rInsn.SetTestedFlags(X86_FlDf);
+  /* semantic: if __code and instruction_has_prefix(rep):
+    while cnt.id != int(cnt.bit, 0):
+      call('store_string')
+      cnt.id -= int(cnt.bit, 1) */
+  if (rInsn.GetPrefix() & (X86_Prefix_Rep))
+  {
+    /* block glb expressions */
+    AllExpr.push_back(Expr::MakeWhileCond(
+      ConditionExpression::CondNe,
+      Expr::MakeId(m_CpuInfo.GetRegisterByType(CpuInformation::CounterRegister, rInsn.GetMode()), &m_CpuInfo),
+      Expr::MakeBitVector(m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::CounterRegister, rInsn.GetMode())), 0x0),
+      Expr::MakeBind({
+      Expr::MakeAssign(
+        rInsn.GetOperand(1),
+        rInsn.GetOperand(0)),
+      Expr::MakeIfElseCond(
+        ConditionExpression::CondEq,
+        Expr::MakeId(X86_FlDf, &m_CpuInfo),
+        Expr::MakeBitVector(1, 0x1),
+        Expr::MakeAssign(
+          expr_cast<MemoryExpression>(rInsn.GetOperand(1))->GetOffsetExpression(),
+          Expr::MakeBinOp(
+            OperationExpression::OpSub,
+            expr_cast<MemoryExpression>(rInsn.GetOperand(1))->GetOffsetExpression(),
+            Expr::MakeBitVector(expr_cast<MemoryExpression>(rInsn.GetOperand(1))->GetOffsetExpression()->GetBitSize(), rInsn.GetOperand(1)->GetBitSize() / 8)))
+      ,
+        Expr::MakeAssign(
+          expr_cast<MemoryExpression>(rInsn.GetOperand(1))->GetOffsetExpression(),
+          Expr::MakeBinOp(
+            OperationExpression::OpAdd,
+            expr_cast<MemoryExpression>(rInsn.GetOperand(1))->GetOffsetExpression(),
+            Expr::MakeBitVector(expr_cast<MemoryExpression>(rInsn.GetOperand(1))->GetOffsetExpression()->GetBitSize(), rInsn.GetOperand(1)->GetBitSize() / 8)))
+      ),
+      Expr::MakeAssign(
+        Expr::MakeId(m_CpuInfo.GetRegisterByType(CpuInformation::CounterRegister, rInsn.GetMode()), &m_CpuInfo),
+        Expr::MakeBinOp(
+          OperationExpression::OpSub,
+          Expr::MakeId(m_CpuInfo.GetRegisterByType(CpuInformation::CounterRegister, rInsn.GetMode()), &m_CpuInfo),
+          Expr::MakeBitVector(m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::CounterRegister, rInsn.GetMode())), 0x1)))
+      })
+    ));
+  }
+  /* semantic: if __code and instruction_has_no_prefix(rep):
+    call('store_string') */
+  if (!(rInsn.GetPrefix() & (X86_Prefix_Rep)))
+  {
+    /* block glb expressions */
+    AllExpr.push_back(Expr::MakeAssign(
+      rInsn.GetOperand(1),
+      rInsn.GetOperand(0)));
+    AllExpr.push_back(Expr::MakeIfElseCond(
+      ConditionExpression::CondEq,
+      Expr::MakeId(X86_FlDf, &m_CpuInfo),
+      Expr::MakeBitVector(1, 0x1),
+      Expr::MakeAssign(
+        expr_cast<MemoryExpression>(rInsn.GetOperand(1))->GetOffsetExpression(),
+        Expr::MakeBinOp(
+          OperationExpression::OpSub,
+          expr_cast<MemoryExpression>(rInsn.GetOperand(1))->GetOffsetExpression(),
+          Expr::MakeBitVector(expr_cast<MemoryExpression>(rInsn.GetOperand(1))->GetOffsetExpression()->GetBitSize(), rInsn.GetOperand(1)->GetBitSize() / 8)))
+    ,
+      Expr::MakeAssign(
+        expr_cast<MemoryExpression>(rInsn.GetOperand(1))->GetOffsetExpression(),
+        Expr::MakeBinOp(
+          OperationExpression::OpAdd,
+          expr_cast<MemoryExpression>(rInsn.GetOperand(1))->GetOffsetExpression(),
+          Expr::MakeBitVector(expr_cast<MemoryExpression>(rInsn.GetOperand(1))->GetOffsetExpression()->GetBitSize(), rInsn.GetOperand(1)->GetBitSize() / 8)))
+    ));
+  }
+  rInsn.SetSemantic(AllExpr);
+}
+
+void X86Architecture::Semantic_025(Instruction& rInsn, u8 Mode)
+{
+  Expression::LSPType AllExpr;
+  rInsn.SetTestedFlags(X86_FlDf);
+  /* semantic: if __code and instruction_has_prefix(rep):
+    while cnt.id != int(cnt.bit, 0):
+      call('load_string')
+      cnt.id -= int(cnt.bit, 1) */
+  if (rInsn.GetPrefix() & (X86_Prefix_Rep))
+  {
+    /* block glb expressions */
+    AllExpr.push_back(Expr::MakeWhileCond(
+      ConditionExpression::CondNe,
+      Expr::MakeId(m_CpuInfo.GetRegisterByType(CpuInformation::CounterRegister, rInsn.GetMode()), &m_CpuInfo),
+      Expr::MakeBitVector(m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::CounterRegister, rInsn.GetMode())), 0x0),
+      Expr::MakeBind({
+      Expr::MakeAssign(
+        rInsn.GetOperand(0),
+        rInsn.GetOperand(1)),
+      Expr::MakeIfElseCond(
+        ConditionExpression::CondEq,
+        Expr::MakeId(X86_FlDf, &m_CpuInfo),
+        Expr::MakeBitVector(1, 0x1),
+        Expr::MakeAssign(
+          expr_cast<MemoryExpression>(rInsn.GetOperand(1))->GetOffsetExpression(),
+          Expr::MakeBinOp(
+            OperationExpression::OpSub,
+            expr_cast<MemoryExpression>(rInsn.GetOperand(1))->GetOffsetExpression(),
+            Expr::MakeBitVector(expr_cast<MemoryExpression>(rInsn.GetOperand(1))->GetOffsetExpression()->GetBitSize(), rInsn.GetOperand(1)->GetBitSize() / 8)))
+      ,
+        Expr::MakeAssign(
+          expr_cast<MemoryExpression>(rInsn.GetOperand(1))->GetOffsetExpression(),
+          Expr::MakeBinOp(
+            OperationExpression::OpAdd,
+            expr_cast<MemoryExpression>(rInsn.GetOperand(1))->GetOffsetExpression(),
+            Expr::MakeBitVector(expr_cast<MemoryExpression>(rInsn.GetOperand(1))->GetOffsetExpression()->GetBitSize(), rInsn.GetOperand(1)->GetBitSize() / 8)))
+      ),
+      Expr::MakeAssign(
+        Expr::MakeId(m_CpuInfo.GetRegisterByType(CpuInformation::CounterRegister, rInsn.GetMode()), &m_CpuInfo),
+        Expr::MakeBinOp(
+          OperationExpression::OpSub,
+          Expr::MakeId(m_CpuInfo.GetRegisterByType(CpuInformation::CounterRegister, rInsn.GetMode()), &m_CpuInfo),
+          Expr::MakeBitVector(m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::CounterRegister, rInsn.GetMode())), 0x1)))
+      })
+    ));
+  }
+  /* semantic: if __code and instruction_has_no_prefix(rep):
+    call('load_string')
+   */
+  if (!(rInsn.GetPrefix() & (X86_Prefix_Rep)))
+  {
+    /* block glb expressions */
+    AllExpr.push_back(Expr::MakeAssign(
+      rInsn.GetOperand(0),
+      rInsn.GetOperand(1)));
+    AllExpr.push_back(Expr::MakeIfElseCond(
+      ConditionExpression::CondEq,
+      Expr::MakeId(X86_FlDf, &m_CpuInfo),
+      Expr::MakeBitVector(1, 0x1),
+      Expr::MakeAssign(
+        expr_cast<MemoryExpression>(rInsn.GetOperand(1))->GetOffsetExpression(),
+        Expr::MakeBinOp(
+          OperationExpression::OpSub,
+          expr_cast<MemoryExpression>(rInsn.GetOperand(1))->GetOffsetExpression(),
+          Expr::MakeBitVector(expr_cast<MemoryExpression>(rInsn.GetOperand(1))->GetOffsetExpression()->GetBitSize(), rInsn.GetOperand(1)->GetBitSize() / 8)))
+    ,
+      Expr::MakeAssign(
+        expr_cast<MemoryExpression>(rInsn.GetOperand(1))->GetOffsetExpression(),
+        Expr::MakeBinOp(
+          OperationExpression::OpAdd,
+          expr_cast<MemoryExpression>(rInsn.GetOperand(1))->GetOffsetExpression(),
+          Expr::MakeBitVector(expr_cast<MemoryExpression>(rInsn.GetOperand(1))->GetOffsetExpression()->GetBitSize(), rInsn.GetOperand(1)->GetBitSize() / 8)))
+    ));
+  }
+  rInsn.SetSemantic(AllExpr);
+}
+
+void X86Architecture::Semantic_026(Instruction& rInsn, u8 Mode)
+{
+  Expression::LSPType AllExpr;
+  rInsn.SetTestedFlags(X86_FlDf);
+  rInsn.SetUpdatedFlags(X86_FlOf | X86_FlSf | X86_FlZf | X86_FlAf | X86_FlPf | X86_FlCf);
+  /* semantic: alloc_var('loop', 1) */
+  AllExpr.push_back(Expr::MakeVar("loop", VariableExpression::Alloc, 0x1));
+  /* semantic: loop = int1(1) */
+  AllExpr.push_back(Expr::MakeAssign(
+    Expr::MakeVar("loop", VariableExpression::Use),
+    Expr::MakeBitVector(1, 0x1)));
+  /* semantic: if __code and instruction_has_prefix(repz):
+    if __expr and cnt.id == int(cnt.bit, 0): loop = int1(0)
+    while loop == int1(1):
+      call('scan_string')
+      cnt.id -= int(cnt.bit, 1)
+      if __expr and cnt.id == int(cnt.bit, 0): loop = int1(0)
+      if __expr and zf.id == int1(0): loop = int1(0) */
+  if (rInsn.GetPrefix() & (X86_Prefix_Rep))
+  {
+    /* block glb expressions */
+    AllExpr.push_back(Expr::MakeIfElseCond(
+      ConditionExpression::CondEq,
+      Expr::MakeId(m_CpuInfo.GetRegisterByType(CpuInformation::CounterRegister, rInsn.GetMode()), &m_CpuInfo),
+      Expr::MakeBitVector(m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::CounterRegister, rInsn.GetMode())), 0x0),
+      Expr::MakeAssign(
+        Expr::MakeVar("loop", VariableExpression::Use),
+        Expr::MakeBitVector(1, 0x0)), nullptr)
+    );
+    AllExpr.push_back(Expr::MakeWhileCond(
+      ConditionExpression::CondEq,
+      Expr::MakeVar("loop", VariableExpression::Use),
+      Expr::MakeBitVector(1, 0x1),
+      Expr::MakeBind({
+      Expr::MakeVar("res", VariableExpression::Alloc, rInsn.GetOperand(0)->GetBitSize()),
+      Expr::MakeAssign(
+        Expr::MakeVar("res", VariableExpression::Use),
+        Expr::MakeBinOp(
+          OperationExpression::OpSub,
+          rInsn.GetOperand(0),
+          rInsn.GetOperand(1))),
+      Expr::MakeAssign(
+        Expr::MakeId(X86_FlOf, &m_CpuInfo),
+        Expr::MakeBinOp(OperationExpression::OpBcast, Expr::MakeBinOp(
+          OperationExpression::OpLrs,
+          Expr::MakeBinOp(
+            OperationExpression::OpAnd,
+            Expr::MakeBinOp(
+              OperationExpression::OpXor,
+              rInsn.GetOperand(0),
+              Expr::MakeVar("res", VariableExpression::Use)),
+            Expr::MakeBinOp(
+              OperationExpression::OpXor,
+              rInsn.GetOperand(0),
+              rInsn.GetOperand(1))),
+          Expr::MakeBinOp(
+            OperationExpression::OpSub,
+            Expr::MakeBitVector(rInsn.GetOperand(0)->GetBitSize(), rInsn.GetOperand(0)->GetBitSize()),
+            Expr::MakeBitVector(rInsn.GetOperand(0)->GetBitSize(), 0x1))), Expr::MakeBitVector(1, 0x1))),
+      Expr::MakeAssign(
+        Expr::MakeId(X86_FlCf, &m_CpuInfo),
+        Expr::MakeBinOp(OperationExpression::OpBcast, Expr::MakeBinOp(
+          OperationExpression::OpLrs,
+          Expr::MakeBinOp(
+            OperationExpression::OpXor,
+            Expr::MakeBinOp(
+              OperationExpression::OpXor,
+              Expr::MakeBinOp(
+                OperationExpression::OpXor,
+                rInsn.GetOperand(0),
+                rInsn.GetOperand(1)),
+              Expr::MakeVar("res", VariableExpression::Use)),
+            Expr::MakeBinOp(
+              OperationExpression::OpAnd,
+              Expr::MakeBinOp(
+                OperationExpression::OpXor,
+                rInsn.GetOperand(0),
+                Expr::MakeVar("res", VariableExpression::Use)),
+              Expr::MakeBinOp(
+                OperationExpression::OpXor,
+                rInsn.GetOperand(0),
+                rInsn.GetOperand(1)))),
+          Expr::MakeBinOp(
+            OperationExpression::OpSub,
+            Expr::MakeBitVector(rInsn.GetOperand(0)->GetBitSize(), rInsn.GetOperand(0)->GetBitSize()),
+            Expr::MakeBitVector(rInsn.GetOperand(0)->GetBitSize(), 0x1))), Expr::MakeBitVector(1, 0x1))),
+      Expr::MakeAssign(
+        Expr::MakeId(X86_FlSf, &m_CpuInfo),
+        Expr::MakeBinOp(OperationExpression::OpBcast, Expr::MakeBinOp(
+          OperationExpression::OpLrs,
+          Expr::MakeVar("res", VariableExpression::Use),
+          Expr::MakeBinOp(
+            OperationExpression::OpSub,
+            Expr::MakeBitVector(rInsn.GetOperand(0)->GetBitSize(), rInsn.GetOperand(0)->GetBitSize()),
+            Expr::MakeBitVector(rInsn.GetOperand(0)->GetBitSize(), 0x1))), Expr::MakeBitVector(1, 0x1))),
+      Expr::MakeAssign(
+        Expr::MakeId(X86_FlZf, &m_CpuInfo),
+        Expr::MakeTernaryCond(ConditionExpression::CondEq,
+        Expr::MakeVar("res", VariableExpression::Use),
+        Expr::MakeBitVector(rInsn.GetOperand(0)->GetBitSize(), 0x0),
+        Expr::MakeBitVector(1, 0x1), Expr::MakeBitVector(1, 0x0))),
+      Expr::MakeVar("pf_tmp", VariableExpression::Alloc, m_CpuInfo.GetSizeOfRegisterInBit(X86_FlPf)),
+      Expr::MakeAssign(
+        Expr::MakeVar("pf_tmp", VariableExpression::Use),
+        Expr::MakeBitVector(1, 0x1)),
+      Expr::MakeAssign(
+        Expr::MakeVar("pf_tmp", VariableExpression::Use),
+        Expr::MakeBinOp(
+          OperationExpression::OpXor,
+          Expr::MakeVar("pf_tmp", VariableExpression::Use),
+          Expr::MakeBinOp(OperationExpression::OpBcast, Expr::MakeBinOp(
+            OperationExpression::OpLrs,
+            Expr::MakeVar("res", VariableExpression::Use),
+            Expr::MakeBitVector(rInsn.GetOperand(0)->GetBitSize(), 0x0)), Expr::MakeBitVector(1, 0x1))))
+      ,
+      Expr::MakeAssign(
+        Expr::MakeVar("pf_tmp", VariableExpression::Use),
+        Expr::MakeBinOp(
+          OperationExpression::OpXor,
+          Expr::MakeVar("pf_tmp", VariableExpression::Use),
+          Expr::MakeBinOp(OperationExpression::OpBcast, Expr::MakeBinOp(
+            OperationExpression::OpLrs,
+            Expr::MakeVar("res", VariableExpression::Use),
+            Expr::MakeBitVector(rInsn.GetOperand(0)->GetBitSize(), 0x1)), Expr::MakeBitVector(1, 0x1))))
+      ,
+      Expr::MakeAssign(
+        Expr::MakeVar("pf_tmp", VariableExpression::Use),
+        Expr::MakeBinOp(
+          OperationExpression::OpXor,
+          Expr::MakeVar("pf_tmp", VariableExpression::Use),
+          Expr::MakeBinOp(OperationExpression::OpBcast, Expr::MakeBinOp(
+            OperationExpression::OpLrs,
+            Expr::MakeVar("res", VariableExpression::Use),
+            Expr::MakeBitVector(rInsn.GetOperand(0)->GetBitSize(), 0x2)), Expr::MakeBitVector(1, 0x1))))
+      ,
+      Expr::MakeAssign(
+        Expr::MakeVar("pf_tmp", VariableExpression::Use),
+        Expr::MakeBinOp(
+          OperationExpression::OpXor,
+          Expr::MakeVar("pf_tmp", VariableExpression::Use),
+          Expr::MakeBinOp(OperationExpression::OpBcast, Expr::MakeBinOp(
+            OperationExpression::OpLrs,
+            Expr::MakeVar("res", VariableExpression::Use),
+            Expr::MakeBitVector(rInsn.GetOperand(0)->GetBitSize(), 0x3)), Expr::MakeBitVector(1, 0x1))))
+      ,
+      Expr::MakeAssign(
+        Expr::MakeVar("pf_tmp", VariableExpression::Use),
+        Expr::MakeBinOp(
+          OperationExpression::OpXor,
+          Expr::MakeVar("pf_tmp", VariableExpression::Use),
+          Expr::MakeBinOp(OperationExpression::OpBcast, Expr::MakeBinOp(
+            OperationExpression::OpLrs,
+            Expr::MakeVar("res", VariableExpression::Use),
+            Expr::MakeBitVector(rInsn.GetOperand(0)->GetBitSize(), 0x4)), Expr::MakeBitVector(1, 0x1))))
+      ,
+      Expr::MakeAssign(
+        Expr::MakeVar("pf_tmp", VariableExpression::Use),
+        Expr::MakeBinOp(
+          OperationExpression::OpXor,
+          Expr::MakeVar("pf_tmp", VariableExpression::Use),
+          Expr::MakeBinOp(OperationExpression::OpBcast, Expr::MakeBinOp(
+            OperationExpression::OpLrs,
+            Expr::MakeVar("res", VariableExpression::Use),
+            Expr::MakeBitVector(rInsn.GetOperand(0)->GetBitSize(), 0x5)), Expr::MakeBitVector(1, 0x1))))
+      ,
+      Expr::MakeAssign(
+        Expr::MakeVar("pf_tmp", VariableExpression::Use),
+        Expr::MakeBinOp(
+          OperationExpression::OpXor,
+          Expr::MakeVar("pf_tmp", VariableExpression::Use),
+          Expr::MakeBinOp(OperationExpression::OpBcast, Expr::MakeBinOp(
+            OperationExpression::OpLrs,
+            Expr::MakeVar("res", VariableExpression::Use),
+            Expr::MakeBitVector(rInsn.GetOperand(0)->GetBitSize(), 0x6)), Expr::MakeBitVector(1, 0x1))))
+      ,
+      Expr::MakeAssign(
+        Expr::MakeVar("pf_tmp", VariableExpression::Use),
+        Expr::MakeBinOp(
+          OperationExpression::OpXor,
+          Expr::MakeVar("pf_tmp", VariableExpression::Use),
+          Expr::MakeBinOp(OperationExpression::OpBcast, Expr::MakeBinOp(
+            OperationExpression::OpLrs,
+            Expr::MakeVar("res", VariableExpression::Use),
+            Expr::MakeBitVector(rInsn.GetOperand(0)->GetBitSize(), 0x7)), Expr::MakeBitVector(1, 0x1))))
+      ,
+      Expr::MakeAssign(
+        Expr::MakeId(X86_FlPf, &m_CpuInfo),
+        Expr::MakeVar("pf_tmp", VariableExpression::Use)),
+      Expr::MakeVar("pf_tmp", VariableExpression::Free),
+      Expr::MakeAssign(
+        Expr::MakeId(X86_FlAf, &m_CpuInfo),
+        Expr::MakeBinOp(OperationExpression::OpBcast, Expr::MakeBinOp(
+          OperationExpression::OpLrs,
+          Expr::MakeBinOp(
+            OperationExpression::OpXor,
+            Expr::MakeBinOp(
+              OperationExpression::OpXor,
+              rInsn.GetOperand(0),
+              rInsn.GetOperand(1)),
+            Expr::MakeVar("res", VariableExpression::Use)),
+          Expr::MakeBitVector(rInsn.GetOperand(0)->GetBitSize(), 0x4)), Expr::MakeBitVector(1, 0x1))),
+      Expr::MakeIfElseCond(
+        ConditionExpression::CondEq,
+        Expr::MakeId(X86_FlDf, &m_CpuInfo),
+        Expr::MakeBitVector(1, 0x1),
+        Expr::MakeAssign(
+          expr_cast<MemoryExpression>(rInsn.GetOperand(1))->GetOffsetExpression(),
+          Expr::MakeBinOp(
+            OperationExpression::OpSub,
+            expr_cast<MemoryExpression>(rInsn.GetOperand(1))->GetOffsetExpression(),
+            Expr::MakeBitVector(expr_cast<MemoryExpression>(rInsn.GetOperand(1))->GetOffsetExpression()->GetBitSize(), rInsn.GetOperand(1)->GetBitSize() / 8)))
+      ,
+        Expr::MakeAssign(
+          expr_cast<MemoryExpression>(rInsn.GetOperand(1))->GetOffsetExpression(),
+          Expr::MakeBinOp(
+            OperationExpression::OpAdd,
+            expr_cast<MemoryExpression>(rInsn.GetOperand(1))->GetOffsetExpression(),
+            Expr::MakeBitVector(expr_cast<MemoryExpression>(rInsn.GetOperand(1))->GetOffsetExpression()->GetBitSize(), rInsn.GetOperand(1)->GetBitSize() / 8)))
+      ),
+      Expr::MakeVar("res", VariableExpression::Free),
+      Expr::MakeAssign(
+        Expr::MakeId(m_CpuInfo.GetRegisterByType(CpuInformation::CounterRegister, rInsn.GetMode()), &m_CpuInfo),
+        Expr::MakeBinOp(
+          OperationExpression::OpSub,
+          Expr::MakeId(m_CpuInfo.GetRegisterByType(CpuInformation::CounterRegister, rInsn.GetMode()), &m_CpuInfo),
+          Expr::MakeBitVector(m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::CounterRegister, rInsn.GetMode())), 0x1)))
+      ,
+      Expr::MakeIfElseCond(
+        ConditionExpression::CondEq,
+        Expr::MakeId(m_CpuInfo.GetRegisterByType(CpuInformation::CounterRegister, rInsn.GetMode()), &m_CpuInfo),
+        Expr::MakeBitVector(m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::CounterRegister, rInsn.GetMode())), 0x0),
+        Expr::MakeAssign(
+          Expr::MakeVar("loop", VariableExpression::Use),
+          Expr::MakeBitVector(1, 0x0)), nullptr)
+      ,
+      Expr::MakeIfElseCond(
+        ConditionExpression::CondEq,
+        Expr::MakeId(X86_FlZf, &m_CpuInfo),
+        Expr::MakeBitVector(1, 0x0),
+        Expr::MakeAssign(
+          Expr::MakeVar("loop", VariableExpression::Use),
+          Expr::MakeBitVector(1, 0x0)), nullptr)
+      })
+    ));
+  }
+  /* semantic: if __code and instruction_has_prefix(repnz):
+    if __expr and cnt.id == int(cnt.bit, 0): loop = int1(0)
+    while loop == int1(1):
+      call('scan_string')
+      cnt.id -= int(cnt.bit, 1)
+      if __expr and cnt.id == int(cnt.bit, 0): loop = int1(0)
+      if __expr and zf.id == int1(1): loop = int1(0) */
+  if (rInsn.GetPrefix() & (X86_Prefix_RepNz))
+  {
+    /* block glb expressions */
+    AllExpr.push_back(Expr::MakeIfElseCond(
+      ConditionExpression::CondEq,
+      Expr::MakeId(m_CpuInfo.GetRegisterByType(CpuInformation::CounterRegister, rInsn.GetMode()), &m_CpuInfo),
+      Expr::MakeBitVector(m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::CounterRegister, rInsn.GetMode())), 0x0),
+      Expr::MakeAssign(
+        Expr::MakeVar("loop", VariableExpression::Use),
+        Expr::MakeBitVector(1, 0x0)), nullptr)
+    );
+    AllExpr.push_back(Expr::MakeWhileCond(
+      ConditionExpression::CondEq,
+      Expr::MakeVar("loop", VariableExpression::Use),
+      Expr::MakeBitVector(1, 0x1),
+      Expr::MakeBind({
+      Expr::MakeVar("res", VariableExpression::Alloc, rInsn.GetOperand(0)->GetBitSize()),
+      Expr::MakeAssign(
+        Expr::MakeVar("res", VariableExpression::Use),
+        Expr::MakeBinOp(
+          OperationExpression::OpSub,
+          rInsn.GetOperand(0),
+          rInsn.GetOperand(1))),
+      Expr::MakeAssign(
+        Expr::MakeId(X86_FlOf, &m_CpuInfo),
+        Expr::MakeBinOp(OperationExpression::OpBcast, Expr::MakeBinOp(
+          OperationExpression::OpLrs,
+          Expr::MakeBinOp(
+            OperationExpression::OpAnd,
+            Expr::MakeBinOp(
+              OperationExpression::OpXor,
+              rInsn.GetOperand(0),
+              Expr::MakeVar("res", VariableExpression::Use)),
+            Expr::MakeBinOp(
+              OperationExpression::OpXor,
+              rInsn.GetOperand(0),
+              rInsn.GetOperand(1))),
+          Expr::MakeBinOp(
+            OperationExpression::OpSub,
+            Expr::MakeBitVector(rInsn.GetOperand(0)->GetBitSize(), rInsn.GetOperand(0)->GetBitSize()),
+            Expr::MakeBitVector(rInsn.GetOperand(0)->GetBitSize(), 0x1))), Expr::MakeBitVector(1, 0x1))),
+      Expr::MakeAssign(
+        Expr::MakeId(X86_FlCf, &m_CpuInfo),
+        Expr::MakeBinOp(OperationExpression::OpBcast, Expr::MakeBinOp(
+          OperationExpression::OpLrs,
+          Expr::MakeBinOp(
+            OperationExpression::OpXor,
+            Expr::MakeBinOp(
+              OperationExpression::OpXor,
+              Expr::MakeBinOp(
+                OperationExpression::OpXor,
+                rInsn.GetOperand(0),
+                rInsn.GetOperand(1)),
+              Expr::MakeVar("res", VariableExpression::Use)),
+            Expr::MakeBinOp(
+              OperationExpression::OpAnd,
+              Expr::MakeBinOp(
+                OperationExpression::OpXor,
+                rInsn.GetOperand(0),
+                Expr::MakeVar("res", VariableExpression::Use)),
+              Expr::MakeBinOp(
+                OperationExpression::OpXor,
+                rInsn.GetOperand(0),
+                rInsn.GetOperand(1)))),
+          Expr::MakeBinOp(
+            OperationExpression::OpSub,
+            Expr::MakeBitVector(rInsn.GetOperand(0)->GetBitSize(), rInsn.GetOperand(0)->GetBitSize()),
+            Expr::MakeBitVector(rInsn.GetOperand(0)->GetBitSize(), 0x1))), Expr::MakeBitVector(1, 0x1))),
+      Expr::MakeAssign(
+        Expr::MakeId(X86_FlSf, &m_CpuInfo),
+        Expr::MakeBinOp(OperationExpression::OpBcast, Expr::MakeBinOp(
+          OperationExpression::OpLrs,
+          Expr::MakeVar("res", VariableExpression::Use),
+          Expr::MakeBinOp(
+            OperationExpression::OpSub,
+            Expr::MakeBitVector(rInsn.GetOperand(0)->GetBitSize(), rInsn.GetOperand(0)->GetBitSize()),
+            Expr::MakeBitVector(rInsn.GetOperand(0)->GetBitSize(), 0x1))), Expr::MakeBitVector(1, 0x1))),
+      Expr::MakeAssign(
+        Expr::MakeId(X86_FlZf, &m_CpuInfo),
+        Expr::MakeTernaryCond(ConditionExpression::CondEq,
+        Expr::MakeVar("res", VariableExpression::Use),
+        Expr::MakeBitVector(rInsn.GetOperand(0)->GetBitSize(), 0x0),
+        Expr::MakeBitVector(1, 0x1), Expr::MakeBitVector(1, 0x0))),
+      Expr::MakeVar("pf_tmp", VariableExpression::Alloc, m_CpuInfo.GetSizeOfRegisterInBit(X86_FlPf)),
+      Expr::MakeAssign(
+        Expr::MakeVar("pf_tmp", VariableExpression::Use),
+        Expr::MakeBitVector(1, 0x1)),
+      Expr::MakeAssign(
+        Expr::MakeVar("pf_tmp", VariableExpression::Use),
+        Expr::MakeBinOp(
+          OperationExpression::OpXor,
+          Expr::MakeVar("pf_tmp", VariableExpression::Use),
+          Expr::MakeBinOp(OperationExpression::OpBcast, Expr::MakeBinOp(
+            OperationExpression::OpLrs,
+            Expr::MakeVar("res", VariableExpression::Use),
+            Expr::MakeBitVector(rInsn.GetOperand(0)->GetBitSize(), 0x0)), Expr::MakeBitVector(1, 0x1))))
+      ,
+      Expr::MakeAssign(
+        Expr::MakeVar("pf_tmp", VariableExpression::Use),
+        Expr::MakeBinOp(
+          OperationExpression::OpXor,
+          Expr::MakeVar("pf_tmp", VariableExpression::Use),
+          Expr::MakeBinOp(OperationExpression::OpBcast, Expr::MakeBinOp(
+            OperationExpression::OpLrs,
+            Expr::MakeVar("res", VariableExpression::Use),
+            Expr::MakeBitVector(rInsn.GetOperand(0)->GetBitSize(), 0x1)), Expr::MakeBitVector(1, 0x1))))
+      ,
+      Expr::MakeAssign(
+        Expr::MakeVar("pf_tmp", VariableExpression::Use),
+        Expr::MakeBinOp(
+          OperationExpression::OpXor,
+          Expr::MakeVar("pf_tmp", VariableExpression::Use),
+          Expr::MakeBinOp(OperationExpression::OpBcast, Expr::MakeBinOp(
+            OperationExpression::OpLrs,
+            Expr::MakeVar("res", VariableExpression::Use),
+            Expr::MakeBitVector(rInsn.GetOperand(0)->GetBitSize(), 0x2)), Expr::MakeBitVector(1, 0x1))))
+      ,
+      Expr::MakeAssign(
+        Expr::MakeVar("pf_tmp", VariableExpression::Use),
+        Expr::MakeBinOp(
+          OperationExpression::OpXor,
+          Expr::MakeVar("pf_tmp", VariableExpression::Use),
+          Expr::MakeBinOp(OperationExpression::OpBcast, Expr::MakeBinOp(
+            OperationExpression::OpLrs,
+            Expr::MakeVar("res", VariableExpression::Use),
+            Expr::MakeBitVector(rInsn.GetOperand(0)->GetBitSize(), 0x3)), Expr::MakeBitVector(1, 0x1))))
+      ,
+      Expr::MakeAssign(
+        Expr::MakeVar("pf_tmp", VariableExpression::Use),
+        Expr::MakeBinOp(
+          OperationExpression::OpXor,
+          Expr::MakeVar("pf_tmp", VariableExpression::Use),
+          Expr::MakeBinOp(OperationExpression::OpBcast, Expr::MakeBinOp(
+            OperationExpression::OpLrs,
+            Expr::MakeVar("res", VariableExpression::Use),
+            Expr::MakeBitVector(rInsn.GetOperand(0)->GetBitSize(), 0x4)), Expr::MakeBitVector(1, 0x1))))
+      ,
+      Expr::MakeAssign(
+        Expr::MakeVar("pf_tmp", VariableExpression::Use),
+        Expr::MakeBinOp(
+          OperationExpression::OpXor,
+          Expr::MakeVar("pf_tmp", VariableExpression::Use),
+          Expr::MakeBinOp(OperationExpression::OpBcast, Expr::MakeBinOp(
+            OperationExpression::OpLrs,
+            Expr::MakeVar("res", VariableExpression::Use),
+            Expr::MakeBitVector(rInsn.GetOperand(0)->GetBitSize(), 0x5)), Expr::MakeBitVector(1, 0x1))))
+      ,
+      Expr::MakeAssign(
+        Expr::MakeVar("pf_tmp", VariableExpression::Use),
+        Expr::MakeBinOp(
+          OperationExpression::OpXor,
+          Expr::MakeVar("pf_tmp", VariableExpression::Use),
+          Expr::MakeBinOp(OperationExpression::OpBcast, Expr::MakeBinOp(
+            OperationExpression::OpLrs,
+            Expr::MakeVar("res", VariableExpression::Use),
+            Expr::MakeBitVector(rInsn.GetOperand(0)->GetBitSize(), 0x6)), Expr::MakeBitVector(1, 0x1))))
+      ,
+      Expr::MakeAssign(
+        Expr::MakeVar("pf_tmp", VariableExpression::Use),
+        Expr::MakeBinOp(
+          OperationExpression::OpXor,
+          Expr::MakeVar("pf_tmp", VariableExpression::Use),
+          Expr::MakeBinOp(OperationExpression::OpBcast, Expr::MakeBinOp(
+            OperationExpression::OpLrs,
+            Expr::MakeVar("res", VariableExpression::Use),
+            Expr::MakeBitVector(rInsn.GetOperand(0)->GetBitSize(), 0x7)), Expr::MakeBitVector(1, 0x1))))
+      ,
+      Expr::MakeAssign(
+        Expr::MakeId(X86_FlPf, &m_CpuInfo),
+        Expr::MakeVar("pf_tmp", VariableExpression::Use)),
+      Expr::MakeVar("pf_tmp", VariableExpression::Free),
+      Expr::MakeAssign(
+        Expr::MakeId(X86_FlAf, &m_CpuInfo),
+        Expr::MakeBinOp(OperationExpression::OpBcast, Expr::MakeBinOp(
+          OperationExpression::OpLrs,
+          Expr::MakeBinOp(
+            OperationExpression::OpXor,
+            Expr::MakeBinOp(
+              OperationExpression::OpXor,
+              rInsn.GetOperand(0),
+              rInsn.GetOperand(1)),
+            Expr::MakeVar("res", VariableExpression::Use)),
+          Expr::MakeBitVector(rInsn.GetOperand(0)->GetBitSize(), 0x4)), Expr::MakeBitVector(1, 0x1))),
+      Expr::MakeIfElseCond(
+        ConditionExpression::CondEq,
+        Expr::MakeId(X86_FlDf, &m_CpuInfo),
+        Expr::MakeBitVector(1, 0x1),
+        Expr::MakeAssign(
+          expr_cast<MemoryExpression>(rInsn.GetOperand(1))->GetOffsetExpression(),
+          Expr::MakeBinOp(
+            OperationExpression::OpSub,
+            expr_cast<MemoryExpression>(rInsn.GetOperand(1))->GetOffsetExpression(),
+            Expr::MakeBitVector(expr_cast<MemoryExpression>(rInsn.GetOperand(1))->GetOffsetExpression()->GetBitSize(), rInsn.GetOperand(1)->GetBitSize() / 8)))
+      ,
+        Expr::MakeAssign(
+          expr_cast<MemoryExpression>(rInsn.GetOperand(1))->GetOffsetExpression(),
+          Expr::MakeBinOp(
+            OperationExpression::OpAdd,
+            expr_cast<MemoryExpression>(rInsn.GetOperand(1))->GetOffsetExpression(),
+            Expr::MakeBitVector(expr_cast<MemoryExpression>(rInsn.GetOperand(1))->GetOffsetExpression()->GetBitSize(), rInsn.GetOperand(1)->GetBitSize() / 8)))
+      ),
+      Expr::MakeVar("res", VariableExpression::Free),
+      Expr::MakeAssign(
+        Expr::MakeId(m_CpuInfo.GetRegisterByType(CpuInformation::CounterRegister, rInsn.GetMode()), &m_CpuInfo),
+        Expr::MakeBinOp(
+          OperationExpression::OpSub,
+          Expr::MakeId(m_CpuInfo.GetRegisterByType(CpuInformation::CounterRegister, rInsn.GetMode()), &m_CpuInfo),
+          Expr::MakeBitVector(m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::CounterRegister, rInsn.GetMode())), 0x1)))
+      ,
+      Expr::MakeIfElseCond(
+        ConditionExpression::CondEq,
+        Expr::MakeId(m_CpuInfo.GetRegisterByType(CpuInformation::CounterRegister, rInsn.GetMode()), &m_CpuInfo),
+        Expr::MakeBitVector(m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::CounterRegister, rInsn.GetMode())), 0x0),
+        Expr::MakeAssign(
+          Expr::MakeVar("loop", VariableExpression::Use),
+          Expr::MakeBitVector(1, 0x0)), nullptr)
+      ,
+      Expr::MakeIfElseCond(
+        ConditionExpression::CondEq,
+        Expr::MakeId(X86_FlZf, &m_CpuInfo),
+        Expr::MakeBitVector(1, 0x1),
+        Expr::MakeAssign(
+          Expr::MakeVar("loop", VariableExpression::Use),
+          Expr::MakeBitVector(1, 0x0)), nullptr)
+      })
+    ));
+  }
+  /* semantic: if __code and instruction_has_no_prefix(repz, repnz):
+    call('scan_string') */
+  if (!(rInsn.GetPrefix() & (X86_Prefix_Rep | X86_Prefix_RepNz)))
+  {
+    /* block glb expressions */
+    AllExpr.push_back(Expr::MakeVar("res", VariableExpression::Alloc, rInsn.GetOperand(0)->GetBitSize()));
+    AllExpr.push_back(Expr::MakeAssign(
+      Expr::MakeVar("res", VariableExpression::Use),
+      Expr::MakeBinOp(
+        OperationExpression::OpSub,
+        rInsn.GetOperand(0),
+        rInsn.GetOperand(1))));
+    AllExpr.push_back(Expr::MakeAssign(
+      Expr::MakeId(X86_FlOf, &m_CpuInfo),
+      Expr::MakeBinOp(OperationExpression::OpBcast, Expr::MakeBinOp(
+        OperationExpression::OpLrs,
+        Expr::MakeBinOp(
+          OperationExpression::OpAnd,
+          Expr::MakeBinOp(
+            OperationExpression::OpXor,
+            rInsn.GetOperand(0),
+            Expr::MakeVar("res", VariableExpression::Use)),
+          Expr::MakeBinOp(
+            OperationExpression::OpXor,
+            rInsn.GetOperand(0),
+            rInsn.GetOperand(1))),
+        Expr::MakeBinOp(
+          OperationExpression::OpSub,
+          Expr::MakeBitVector(rInsn.GetOperand(0)->GetBitSize(), rInsn.GetOperand(0)->GetBitSize()),
+          Expr::MakeBitVector(rInsn.GetOperand(0)->GetBitSize(), 0x1))), Expr::MakeBitVector(1, 0x1))));
+    AllExpr.push_back(Expr::MakeAssign(
+      Expr::MakeId(X86_FlCf, &m_CpuInfo),
+      Expr::MakeBinOp(OperationExpression::OpBcast, Expr::MakeBinOp(
+        OperationExpression::OpLrs,
+        Expr::MakeBinOp(
+          OperationExpression::OpXor,
+          Expr::MakeBinOp(
+            OperationExpression::OpXor,
+            Expr::MakeBinOp(
+              OperationExpression::OpXor,
+              rInsn.GetOperand(0),
+              rInsn.GetOperand(1)),
+            Expr::MakeVar("res", VariableExpression::Use)),
+          Expr::MakeBinOp(
+            OperationExpression::OpAnd,
+            Expr::MakeBinOp(
+              OperationExpression::OpXor,
+              rInsn.GetOperand(0),
+              Expr::MakeVar("res", VariableExpression::Use)),
+            Expr::MakeBinOp(
+              OperationExpression::OpXor,
+              rInsn.GetOperand(0),
+              rInsn.GetOperand(1)))),
+        Expr::MakeBinOp(
+          OperationExpression::OpSub,
+          Expr::MakeBitVector(rInsn.GetOperand(0)->GetBitSize(), rInsn.GetOperand(0)->GetBitSize()),
+          Expr::MakeBitVector(rInsn.GetOperand(0)->GetBitSize(), 0x1))), Expr::MakeBitVector(1, 0x1))));
+    AllExpr.push_back(Expr::MakeAssign(
+      Expr::MakeId(X86_FlSf, &m_CpuInfo),
+      Expr::MakeBinOp(OperationExpression::OpBcast, Expr::MakeBinOp(
+        OperationExpression::OpLrs,
+        Expr::MakeVar("res", VariableExpression::Use),
+        Expr::MakeBinOp(
+          OperationExpression::OpSub,
+          Expr::MakeBitVector(rInsn.GetOperand(0)->GetBitSize(), rInsn.GetOperand(0)->GetBitSize()),
+          Expr::MakeBitVector(rInsn.GetOperand(0)->GetBitSize(), 0x1))), Expr::MakeBitVector(1, 0x1))));
+    AllExpr.push_back(Expr::MakeAssign(
+      Expr::MakeId(X86_FlZf, &m_CpuInfo),
+      Expr::MakeTernaryCond(ConditionExpression::CondEq,
+      Expr::MakeVar("res", VariableExpression::Use),
+      Expr::MakeBitVector(rInsn.GetOperand(0)->GetBitSize(), 0x0),
+      Expr::MakeBitVector(1, 0x1), Expr::MakeBitVector(1, 0x0))));
+    AllExpr.push_back(Expr::MakeVar("pf_tmp", VariableExpression::Alloc, m_CpuInfo.GetSizeOfRegisterInBit(X86_FlPf)));
+    AllExpr.push_back(Expr::MakeAssign(
+      Expr::MakeVar("pf_tmp", VariableExpression::Use),
+      Expr::MakeBitVector(1, 0x1)));
+    AllExpr.push_back(Expr::MakeAssign(
+      Expr::MakeVar("pf_tmp", VariableExpression::Use),
+      Expr::MakeBinOp(
+        OperationExpression::OpXor,
+        Expr::MakeVar("pf_tmp", VariableExpression::Use),
+        Expr::MakeBinOp(OperationExpression::OpBcast, Expr::MakeBinOp(
+          OperationExpression::OpLrs,
+          Expr::MakeVar("res", VariableExpression::Use),
+          Expr::MakeBitVector(rInsn.GetOperand(0)->GetBitSize(), 0x0)), Expr::MakeBitVector(1, 0x1))))
+    );
+    AllExpr.push_back(Expr::MakeAssign(
+      Expr::MakeVar("pf_tmp", VariableExpression::Use),
+      Expr::MakeBinOp(
+        OperationExpression::OpXor,
+        Expr::MakeVar("pf_tmp", VariableExpression::Use),
+        Expr::MakeBinOp(OperationExpression::OpBcast, Expr::MakeBinOp(
+          OperationExpression::OpLrs,
+          Expr::MakeVar("res", VariableExpression::Use),
+          Expr::MakeBitVector(rInsn.GetOperand(0)->GetBitSize(), 0x1)), Expr::MakeBitVector(1, 0x1))))
+    );
+    AllExpr.push_back(Expr::MakeAssign(
+      Expr::MakeVar("pf_tmp", VariableExpression::Use),
+      Expr::MakeBinOp(
+        OperationExpression::OpXor,
+        Expr::MakeVar("pf_tmp", VariableExpression::Use),
+        Expr::MakeBinOp(OperationExpression::OpBcast, Expr::MakeBinOp(
+          OperationExpression::OpLrs,
+          Expr::MakeVar("res", VariableExpression::Use),
+          Expr::MakeBitVector(rInsn.GetOperand(0)->GetBitSize(), 0x2)), Expr::MakeBitVector(1, 0x1))))
+    );
+    AllExpr.push_back(Expr::MakeAssign(
+      Expr::MakeVar("pf_tmp", VariableExpression::Use),
+      Expr::MakeBinOp(
+        OperationExpression::OpXor,
+        Expr::MakeVar("pf_tmp", VariableExpression::Use),
+        Expr::MakeBinOp(OperationExpression::OpBcast, Expr::MakeBinOp(
+          OperationExpression::OpLrs,
+          Expr::MakeVar("res", VariableExpression::Use),
+          Expr::MakeBitVector(rInsn.GetOperand(0)->GetBitSize(), 0x3)), Expr::MakeBitVector(1, 0x1))))
+    );
+    AllExpr.push_back(Expr::MakeAssign(
+      Expr::MakeVar("pf_tmp", VariableExpression::Use),
+      Expr::MakeBinOp(
+        OperationExpression::OpXor,
+        Expr::MakeVar("pf_tmp", VariableExpression::Use),
+        Expr::MakeBinOp(OperationExpression::OpBcast, Expr::MakeBinOp(
+          OperationExpression::OpLrs,
+          Expr::MakeVar("res", VariableExpression::Use),
+          Expr::MakeBitVector(rInsn.GetOperand(0)->GetBitSize(), 0x4)), Expr::MakeBitVector(1, 0x1))))
+    );
+    AllExpr.push_back(Expr::MakeAssign(
+      Expr::MakeVar("pf_tmp", VariableExpression::Use),
+      Expr::MakeBinOp(
+        OperationExpression::OpXor,
+        Expr::MakeVar("pf_tmp", VariableExpression::Use),
+        Expr::MakeBinOp(OperationExpression::OpBcast, Expr::MakeBinOp(
+          OperationExpression::OpLrs,
+          Expr::MakeVar("res", VariableExpression::Use),
+          Expr::MakeBitVector(rInsn.GetOperand(0)->GetBitSize(), 0x5)), Expr::MakeBitVector(1, 0x1))))
+    );
+    AllExpr.push_back(Expr::MakeAssign(
+      Expr::MakeVar("pf_tmp", VariableExpression::Use),
+      Expr::MakeBinOp(
+        OperationExpression::OpXor,
+        Expr::MakeVar("pf_tmp", VariableExpression::Use),
+        Expr::MakeBinOp(OperationExpression::OpBcast, Expr::MakeBinOp(
+          OperationExpression::OpLrs,
+          Expr::MakeVar("res", VariableExpression::Use),
+          Expr::MakeBitVector(rInsn.GetOperand(0)->GetBitSize(), 0x6)), Expr::MakeBitVector(1, 0x1))))
+    );
+    AllExpr.push_back(Expr::MakeAssign(
+      Expr::MakeVar("pf_tmp", VariableExpression::Use),
+      Expr::MakeBinOp(
+        OperationExpression::OpXor,
+        Expr::MakeVar("pf_tmp", VariableExpression::Use),
+        Expr::MakeBinOp(OperationExpression::OpBcast, Expr::MakeBinOp(
+          OperationExpression::OpLrs,
+          Expr::MakeVar("res", VariableExpression::Use),
+          Expr::MakeBitVector(rInsn.GetOperand(0)->GetBitSize(), 0x7)), Expr::MakeBitVector(1, 0x1))))
+    );
+    AllExpr.push_back(Expr::MakeAssign(
+      Expr::MakeId(X86_FlPf, &m_CpuInfo),
+      Expr::MakeVar("pf_tmp", VariableExpression::Use)));
+    AllExpr.push_back(Expr::MakeVar("pf_tmp", VariableExpression::Free));
+    AllExpr.push_back(Expr::MakeAssign(
+      Expr::MakeId(X86_FlAf, &m_CpuInfo),
+      Expr::MakeBinOp(OperationExpression::OpBcast, Expr::MakeBinOp(
+        OperationExpression::OpLrs,
+        Expr::MakeBinOp(
+          OperationExpression::OpXor,
+          Expr::MakeBinOp(
+            OperationExpression::OpXor,
+            rInsn.GetOperand(0),
+            rInsn.GetOperand(1)),
+          Expr::MakeVar("res", VariableExpression::Use)),
+        Expr::MakeBitVector(rInsn.GetOperand(0)->GetBitSize(), 0x4)), Expr::MakeBitVector(1, 0x1))));
+    AllExpr.push_back(Expr::MakeIfElseCond(
+      ConditionExpression::CondEq,
+      Expr::MakeId(X86_FlDf, &m_CpuInfo),
+      Expr::MakeBitVector(1, 0x1),
+      Expr::MakeAssign(
+        expr_cast<MemoryExpression>(rInsn.GetOperand(1))->GetOffsetExpression(),
+        Expr::MakeBinOp(
+          OperationExpression::OpSub,
+          expr_cast<MemoryExpression>(rInsn.GetOperand(1))->GetOffsetExpression(),
+          Expr::MakeBitVector(expr_cast<MemoryExpression>(rInsn.GetOperand(1))->GetOffsetExpression()->GetBitSize(), rInsn.GetOperand(1)->GetBitSize() / 8)))
+    ,
+      Expr::MakeAssign(
+        expr_cast<MemoryExpression>(rInsn.GetOperand(1))->GetOffsetExpression(),
+        Expr::MakeBinOp(
+          OperationExpression::OpAdd,
+          expr_cast<MemoryExpression>(rInsn.GetOperand(1))->GetOffsetExpression(),
+          Expr::MakeBitVector(expr_cast<MemoryExpression>(rInsn.GetOperand(1))->GetOffsetExpression()->GetBitSize(), rInsn.GetOperand(1)->GetBitSize() / 8)))
+    ));
+    AllExpr.push_back(Expr::MakeVar("res", VariableExpression::Free));
+  }
+  /* semantic: free_var('loop') */
+  AllExpr.push_back(Expr::MakeVar("loop", VariableExpression::Free));
+  rInsn.SetSemantic(AllExpr);
+}
+
+void X86Architecture::Semantic_027(Instruction& rInsn, u8 Mode)
+{
+  Expression::LSPType AllExpr;
+  /* semantic: program.id = stack.mem */
+  AllExpr.push_back(Expr::MakeAssign(
+    Expr::MakeId(m_CpuInfo.GetRegisterByType(CpuInformation::ProgramPointerRegister, rInsn.GetMode()), &m_CpuInfo),
+    Expr::MakeMem(m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister, rInsn.GetMode())), nullptr, Expr::MakeId(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister, rInsn.GetMode()), &m_CpuInfo))));
+  /* semantic: stack.id += stack.size */
+  AllExpr.push_back(Expr::MakeAssign(
+    Expr::MakeId(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister, rInsn.GetMode()), &m_CpuInfo),
+    Expr::MakeBinOp(
+      OperationExpression::OpAdd,
+      Expr::MakeId(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister, rInsn.GetMode()), &m_CpuInfo),
+      Expr::MakeBitVector(
+        m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister, rInsn.GetMode())),
+        m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister, rInsn.GetMode())) / 8)))
+  );
+  /* semantic: stack.id += bit_cast(op0.val, int(stack.bit, stack.bit)) */
+  AllExpr.push_back(Expr::MakeAssign(
+    Expr::MakeId(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister, rInsn.GetMode()), &m_CpuInfo),
+    Expr::MakeBinOp(
+      OperationExpression::OpAdd,
+      Expr::MakeId(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister, rInsn.GetMode()), &m_CpuInfo),
+      Expr::MakeBinOp(OperationExpression::OpBcast, rInsn.GetOperand(0), Expr::MakeBitVector(m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister, rInsn.GetMode())), m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister, rInsn.GetMode()))))))
+  );
+  rInsn.SetSemantic(AllExpr);
+}
+
+void X86Architecture::Semantic_028(Instruction& rInsn, u8 Mode)
+{
+  Expression::LSPType AllExpr;
+  /* semantic: program.id = stack.mem */
+  AllExpr.push_back(Expr::MakeAssign(
+    Expr::MakeId(m_CpuInfo.GetRegisterByType(CpuInformation::ProgramPointerRegister, rInsn.GetMode()), &m_CpuInfo),
+    Expr::MakeMem(m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister, rInsn.GetMode())), nullptr, Expr::MakeId(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister, rInsn.GetMode()), &m_CpuInfo))));
+  /* semantic: stack.id += stack.size */
+  AllExpr.push_back(Expr::MakeAssign(
+    Expr::MakeId(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister, rInsn.GetMode()), &m_CpuInfo),
+    Expr::MakeBinOp(
+      OperationExpression::OpAdd,
+      Expr::MakeId(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister, rInsn.GetMode()), &m_CpuInfo),
+      Expr::MakeBitVector(
+        m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister, rInsn.GetMode())),
+        m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister, rInsn.GetMode())) / 8)))
+  );
+  rInsn.SetSemantic(AllExpr);
+}
+
+void X86Architecture::Semantic_029(Instruction& rInsn, u8 Mode)
+{
+  Expression::LSPType AllExpr;
+  rInsn.SetTestedFlags(X86_FlZf);
+  /* semantic: cnt.id -= int(cnt.bit, 1) */
+  AllExpr.push_back(Expr::MakeAssign(
+    Expr::MakeId(m_CpuInfo.GetRegisterByType(CpuInformation::CounterRegister, rInsn.GetMode()), &m_CpuInfo),
+    Expr::MakeBinOp(
+      OperationExpression::OpSub,
+      Expr::MakeId(m_CpuInfo.GetRegisterByType(CpuInformation::CounterRegister, rInsn.GetMode()), &m_CpuInfo),
+      Expr::MakeBitVector(m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::CounterRegister, rInsn.GetMode())), 0x1)))
+  );
+  /* semantic: if __expr and (zf.id ^ int(cnt.bit, 1) & cnt.id) != int(cnt.bit, 0):
+    program.id = op0.val */
+  AllExpr.push_back(Expr::MakeIfElseCond(
+    ConditionExpression::CondNe,
+    Expr::MakeBinOp(
+      OperationExpression::OpXor,
+      Expr::MakeId(X86_FlZf, &m_CpuInfo),
+      Expr::MakeBinOp(
+        OperationExpression::OpAnd,
+        Expr::MakeBitVector(m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::CounterRegister, rInsn.GetMode())), 0x1),
+        Expr::MakeId(m_CpuInfo.GetRegisterByType(CpuInformation::CounterRegister, rInsn.GetMode()), &m_CpuInfo))),
+    Expr::MakeBitVector(m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::CounterRegister, rInsn.GetMode())), 0x0),
+    Expr::MakeAssign(
+      Expr::MakeId(m_CpuInfo.GetRegisterByType(CpuInformation::ProgramPointerRegister, rInsn.GetMode()), &m_CpuInfo),
+      rInsn.GetOperand(0)), nullptr)
+  );
+  rInsn.SetSemantic(AllExpr);
+}
+
+void X86Architecture::Semantic_02a(Instruction& rInsn, u8 Mode)
+{
+  Expression::LSPType AllExpr;
+  rInsn.SetTestedFlags(X86_FlZf);
+  /* semantic: cnt.id -= int(cnt.bit, 1) */
+  AllExpr.push_back(Expr::MakeAssign(
+    Expr::MakeId(m_CpuInfo.GetRegisterByType(CpuInformation::CounterRegister, rInsn.GetMode()), &m_CpuInfo),
+    Expr::MakeBinOp(
+      OperationExpression::OpSub,
+      Expr::MakeId(m_CpuInfo.GetRegisterByType(CpuInformation::CounterRegister, rInsn.GetMode()), &m_CpuInfo),
+      Expr::MakeBitVector(m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::CounterRegister, rInsn.GetMode())), 0x1)))
+  );
+  /* semantic: if __expr and (cnt.id | zf.id) != int(cnt.bit, 0):
+    program.id = op0.val */
+  AllExpr.push_back(Expr::MakeIfElseCond(
+    ConditionExpression::CondNe,
+    Expr::MakeBinOp(
+      OperationExpression::OpOr,
+      Expr::MakeId(m_CpuInfo.GetRegisterByType(CpuInformation::CounterRegister, rInsn.GetMode()), &m_CpuInfo),
+      Expr::MakeId(X86_FlZf, &m_CpuInfo)),
+    Expr::MakeBitVector(m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::CounterRegister, rInsn.GetMode())), 0x0),
+    Expr::MakeAssign(
+      Expr::MakeId(m_CpuInfo.GetRegisterByType(CpuInformation::ProgramPointerRegister, rInsn.GetMode()), &m_CpuInfo),
+      rInsn.GetOperand(0)), nullptr)
+  );
+  rInsn.SetSemantic(AllExpr);
+}
+
+void X86Architecture::Semantic_02b(Instruction& rInsn, u8 Mode)
+{
+  Expression::LSPType AllExpr;
+  /* semantic: cnt.id -= int(cnt.bit, 1) */
+  AllExpr.push_back(Expr::MakeAssign(
+    Expr::MakeId(m_CpuInfo.GetRegisterByType(CpuInformation::CounterRegister, rInsn.GetMode()), &m_CpuInfo),
+    Expr::MakeBinOp(
+      OperationExpression::OpSub,
+      Expr::MakeId(m_CpuInfo.GetRegisterByType(CpuInformation::CounterRegister, rInsn.GetMode()), &m_CpuInfo),
+      Expr::MakeBitVector(m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::CounterRegister, rInsn.GetMode())), 0x1)))
+  );
+  /* semantic: if __expr and cnt.id != int(cnt.bit, 0):
+    program.id = op0.val */
+  AllExpr.push_back(Expr::MakeIfElseCond(
+    ConditionExpression::CondNe,
+    Expr::MakeId(m_CpuInfo.GetRegisterByType(CpuInformation::CounterRegister, rInsn.GetMode()), &m_CpuInfo),
+    Expr::MakeBitVector(m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::CounterRegister, rInsn.GetMode())), 0x0),
+    Expr::MakeAssign(
+      Expr::MakeId(m_CpuInfo.GetRegisterByType(CpuInformation::ProgramPointerRegister, rInsn.GetMode()), &m_CpuInfo),
+      rInsn.GetOperand(0)), nullptr)
+  );
+  rInsn.SetSemantic(AllExpr);
+}
+
+void X86Architecture::Semantic_02c(Instruction& rInsn, u8 Mode)
+{
+  Expression::LSPType AllExpr;
+  /* semantic: alloc_var('call_dst', stack.bit) */
+  AllExpr.push_back(Expr::MakeVar("call_dst", VariableExpression::Alloc, m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister, rInsn.GetMode()))));
+  /* semantic: call_dst = op0.val */
+  AllExpr.push_back(Expr::MakeAssign(
+    Expr::MakeVar("call_dst", VariableExpression::Use),
+    rInsn.GetOperand(0)));
+  /* semantic: stack.id -= stack.size */
+  AllExpr.push_back(Expr::MakeAssign(
+    Expr::MakeId(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister, rInsn.GetMode()), &m_CpuInfo),
+    Expr::MakeBinOp(
+      OperationExpression::OpSub,
+      Expr::MakeId(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister, rInsn.GetMode()), &m_CpuInfo),
+      Expr::MakeBitVector(
+        m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister, rInsn.GetMode())),
+        m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister, rInsn.GetMode())) / 8)))
+  );
+  /* semantic: stack.mem = program.id */
+  AllExpr.push_back(Expr::MakeAssign(
+    Expr::MakeMem(m_CpuInfo.GetSizeOfRegisterInBit(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister, rInsn.GetMode())), nullptr, Expr::MakeId(m_CpuInfo.GetRegisterByType(CpuInformation::StackPointerRegister, rInsn.GetMode()), &m_CpuInfo)),
+    Expr::MakeId(m_CpuInfo.GetRegisterByType(CpuInformation::ProgramPointerRegister, rInsn.GetMode()), &m_CpuInfo)));
+  /* semantic: program.id = call_dst */
+  AllExpr.push_back(Expr::MakeAssign(
+    Expr::MakeId(m_CpuInfo.GetRegisterByType(CpuInformation::ProgramPointerRegister, rInsn.GetMode()), &m_CpuInfo),
+    Expr::MakeVar("call_dst", VariableExpression::Use)));
+  /* semantic: free_var('call_dst') */
+  AllExpr.push_back(Expr::MakeVar("call_dst", VariableExpression::Free));
+  rInsn.SetSemantic(AllExpr);
+}
+
+void X86Architecture::Semantic_02d(Instruction& rInsn, u8 Mode)
+{
+  Expression::LSPType AllExpr;
+  /* semantic: program.id = op0.val */
+  AllExpr.push_back(Expr::MakeAssign(
+    Expr::MakeId(m_CpuInfo.GetRegisterByType(CpuInformation::ProgramPointerRegister, rInsn.GetMode()), &m_CpuInfo),
+    rInsn.GetOperand(0)));
+  rInsn.SetSemantic(AllExpr);
+}
+
+void X86Architecture::Semantic_02e(Instruction& rInsn, u8 Mode)
+{
+  Expression::LSPType AllExpr;
+  rInsn.SetUpdatedFlags(X86_FlCf);
+  /* semantic: cf.id = cf.id ^ int1(1) */
+  AllExpr.push_back(Expr::MakeAssign(
+    Expr::MakeId(X86_FlCf, &m_CpuInfo),
+    Expr::MakeBinOp(
+      OperationExpression::OpXor,
+      Expr::MakeId(X86_FlCf, &m_CpuInfo),
+      Expr::MakeBitVector(1, 0x1))));
+  rInsn.SetSemantic(AllExpr);
+}
+
+void X86Architecture::Semantic_02f(Instruction& rInsn, u8 Mode)
+{
+  Expression::LSPType AllExpr;
+  rInsn.SetClearedFlags(X86_FlCf);
+  AllExpr.push_back(Expr::MakeAssign(Expr::MakeId(X86_FlCf, &m_CpuInfo), Expr::MakeBoolean(false)));
+  /* semantic: cf.id = int1(0) */
+  AllExpr.push_back(Expr::MakeAssign(
+    Expr::MakeId(X86_FlCf, &m_CpuInfo),
+    Expr::MakeBitVector(1, 0x0)));
+  rInsn.SetSemantic(AllExpr);
+}
+
+void X86Architecture::Semantic_030(Instruction& rInsn, u8 Mode)
+{
+  Expression::LSPType AllExpr;
+  rInsn.SetUpdatedFlags(X86_FlCf);
+  /* semantic: cf.id = int1(1) */
+  AllExpr.push_back(Expr::MakeAssign(
+    Expr::MakeId(X86_FlCf, &m_CpuInfo),
+    Expr::MakeBitVector(1, 0x1)));
+  rInsn.SetSemantic(AllExpr);
+}
+
+void X86Architecture::Semantic_031(Instruction& rInsn, u8 Mode)
+{
+  Expression::LSPType AllExpr;
+  rInsn.SetClearedFlags(X86_FlIf);
+  AllExpr.push_back(Expr::MakeAssign(Expr::MakeId(X86_FlIf, &m_CpuInfo), Expr::MakeBoolean(false)));
+  rInsn.SetSemantic(AllExpr);
+}
+
+void X86Architecture::Semantic_032(Instruction& rInsn, u8 Mode)
+{
+  Expression::LSPType AllExpr;
+  rInsn.SetFixedFlags(X86_FlIf);
+  AllExpr.push_back(Expr::MakeAssign(Expr::MakeId(X86_FlIf, &m_CpuInfo), Expr::MakeBoolean(true)));
+  rInsn.SetSemantic(AllExpr);
+}
+
+void X86Architecture::Semantic_033(Instruction& rInsn, u8 Mode)
+{
+  Expression::LSPType AllExpr;
+  rInsn.SetClearedFlags(X86_FlDf);
+  AllExpr.push_back(Expr::MakeAssign(Expr::MakeId(X86_FlDf, &m_CpuInfo), Expr::MakeBoolean(false)));
+  /* semantic: df.id = int1(0) */
+  AllExpr.push_back(Expr::MakeAssign(
+    Expr::MakeId(X86_FlDf, &m_CpuInfo),
+    Expr::MakeBitVector(1, 0x0)));
+  rInsn.SetSemantic(AllExpr);
+}
+
+void X86Architecture::Semantic_034(Instruction& rInsn, u8 Mode)
+{
+  Expression::LSPType AllExpr;
+  rInsn.SetFixedFlags(X86_FlDf);
+  AllExpr.push_back(Expr::MakeAssign(Expr::MakeId(X86_FlDf, &m_CpuInfo), Expr::MakeBoolean(true)));
+  /* semantic: df.id = int1(1) */
+  AllExpr.push_back(Expr::MakeAssign(
+    Expr::MakeId(X86_FlDf, &m_CpuInfo),
+    Expr::MakeBitVector(1, 0x1)));
+  rInsn.SetSemantic(AllExpr);
+}
+
+void X86Architecture::Semantic_035(Instruction& rInsn, u8 Mode)
+{
+  Expression::LSPType AllExpr;
+  /* semantic: eax.id = int32(0) */
+  AllExpr.push_back(Expr::MakeAssign(
+    Expr::MakeId(X86_Reg_Eax, &m_CpuInfo),
+    Expr::MakeBitVector(32, 0x0)));
+  /* semantic: edx.id = int32(0) */
+  AllExpr.push_back(Expr::MakeAssign(
+    Expr::MakeId(X86_Reg_Edx, &m_CpuInfo),
+    Expr::MakeBitVector(32, 0x0)));
+  rInsn.SetSemantic(AllExpr);
+}
+
+void X86Architecture::Semantic_036(Instruction& rInsn, u8 Mode)
+{
+  Expression::LSPType AllExpr;
+  rInsn.SetTestedFlags(X86_FlOf);
+  /* semantic: if __expr and of.id == int1(1): op0.val = op1.val */
+  AllExpr.push_back(Expr::MakeIfElseCond(
+    ConditionExpression::CondEq,
+    Expr::MakeId(X86_FlOf, &m_CpuInfo),
+    Expr::MakeBitVector(1, 0x1),
+    Expr::MakeAssign(
+      rInsn.GetOperand(0),
+      rInsn.GetOperand(1)), nullptr)
+  );
+  rInsn.SetSemantic(AllExpr);
+}
+
+void X86Architecture::Semantic_037(Instruction& rInsn, u8 Mode)
+{
+  Expression::LSPType AllExpr;
+  rInsn.SetTestedFlags(X86_FlOf);
+  /* semantic: if __expr and of.id == int1(0): op0.val = op1.val */
+  AllExpr.push_back(Expr::MakeIfElseCond(
+    ConditionExpression::CondEq,
+    Expr::MakeId(X86_FlOf, &m_CpuInfo),
+    Expr::MakeBitVector(1, 0x0),
+    Expr::MakeAssign(
+      rInsn.GetOperand(0),
+      rInsn.GetOperand(1)), nullptr)
+  );
+  rInsn.SetSemantic(AllExpr);
+}
+
+void X86Architecture::Semantic_038(Instruction& rInsn, u8 Mode)
+{
+  Expression::LSPType AllExpr;
+  rInsn.SetTestedFlags(X86_FlCf);
+  /* semantic: if __expr and cf.id == int1(1): op0.val = op1.val */
+  AllExpr.push_back(Expr::MakeIfElseCond(
+    ConditionExpression::CondEq,
+    Expr::MakeId(X86_FlCf, &m_CpuInfo),
+    Expr::MakeBitVector(1, 0x1),
+    Expr::MakeAssign(
+      rInsn.GetOperand(0),
+      rInsn.GetOperand(1)), nullptr)
+  );
+  rInsn.SetSemantic(AllExpr);
+}
+
+void X86Architecture::Semantic_039(Instruction& rInsn, u8 Mode)
+{
+  Expression::LSPType AllExpr;
+  rInsn.SetTestedFlags(X86_FlCf);
+  /* semantic: if __expr and cf.id == int1(0): op0.val = op1.val */
+  AllExpr.push_back(Expr::MakeIfElseCond(
+    ConditionExpression::CondEq,
+    Expr::MakeId(X86_FlCf, &m_CpuInfo),
+    Expr::MakeBitVector(1, 0x0),
+    Expr::MakeAssign(
+      rInsn.GetOperand(0),
+      rInsn.GetOperand(1)), nullptr)
+  );
+  rInsn.SetSemantic(AllExpr);
+}
+
+void X86Architecture::Semantic_03a(Instruction& rInsn, u8 Mode)
+{
+  Expression::LSPType AllExpr;
+  rInsn.SetTestedFlags(X86_FlZf);
+  /* semantic: if __expr and zf.id == int1(1): op0.val = op1.val */
+  AllExpr.push_back(Expr::MakeIfElseCond(
+    ConditionExpression::CondEq,
+    Expr::MakeId(X86_FlZf, &m_CpuInfo),
+    Expr::MakeBitVector(1, 0x1),
+    Expr::MakeAssign(
+      rInsn.GetOperand(0),
+      rInsn.GetOperand(1)), nullptr)
+  );
+  rInsn.SetSemantic(AllExpr);
+}
+
+void X86Architecture::Semantic_03b(Instruction& rInsn, u8 Mode)
+{
+  Expression::LSPType AllExpr;
+  rInsn.SetTestedFlags(X86_FlZf);
+  /* semantic: if __expr and zf.id == int1(0): op0.val = op1.val */
+  AllExpr.push_back(Expr::MakeIfElseCond(
+    ConditionExpression::CondEq,
+    Expr::MakeId(X86_FlZf, &m_CpuInfo),
+    Expr::MakeBitVector(1, 0x0),
+    Expr::MakeAssign(
+      rInsn.GetOperand(0),
+      rInsn.GetOperand(1)), nullptr)
+  );
+  rInsn.SetSemantic(AllExpr);
+}
+
+void X86Architecture::Semantic_03c(Instruction& rInsn, u8 Mode)
+{
+  Expression::LSPType AllExpr;
+  rInsn.SetTestedFlags(X86_FlZf | X86_FlCf);
+  /* semantic: if __expr and (cf.id | zf.id) != int1(0): op0.val = op1.val */
+  AllExpr.push_back(Expr::MakeIfElseCond(
+    ConditionExpression::CondNe,
+    Expr::MakeBinOp(
+      OperationExpression::OpOr,
+      Expr::MakeId(X86_FlCf, &m_CpuInfo),
+      Expr::MakeId(X86_FlZf, &m_CpuInfo)),
+    Expr::MakeBitVector(1, 0x0),
+    Expr::MakeAssign(
+      rInsn.GetOperand(0),
+      rInsn.GetOperand(1)), nullptr)
+  );
+  rInsn.SetSemantic(AllExpr);
+}
+
+void X86Architecture::Semantic_03d(Instruction& rInsn, u8 Mode)
+{
+  Expression::LSPType AllExpr;
+  rInsn.SetTestedFlags(X86_FlZf | X86_FlCf);
+  /* semantic: if __expr and (cf.id | zf.id) == int1(0): op0.val = op1.val */
+  AllExpr.push_back(Expr::MakeIfElseCond(
+    ConditionExpression::CondEq,
+    Expr::MakeBinOp(
+      OperationExpression::OpOr,
+      Expr::MakeId(X86_FlCf, &m_CpuInfo),
+      Expr::MakeId(X86_FlZf, &m_CpuInfo)),
+    Expr::MakeBitVector(1, 0x0),
+    Expr::MakeAssign(
+      rInsn.GetOperand(0),
+      rInsn.GetOperand(1)), nullptr)
+  );
+  rInsn.SetSemantic(AllExpr);
+}
+
+void X86Architecture::Semantic_03e(Instruction& rInsn, u8 Mode)
+{
+  Expression::LSPType AllExpr;
+  rInsn.SetTestedFlags(X86_FlSf);
+  /* semantic: if __expr and sf.id == int1(1): op0.val = op1.val */
+  AllExpr.push_back(Expr::MakeIfElseCond(
+    ConditionExpression::CondEq,
+    Expr::MakeId(X86_FlSf, &m_CpuInfo),
+    Expr::MakeBitVector(1, 0x1),
+    Expr::MakeAssign(
+      rInsn.GetOperand(0),
+      rInsn.GetOperand(1)), nullptr)
+  );
+  rInsn.SetSemantic(AllExpr);
+}
+
+void X86Architecture::Semantic_03f(Instruction& rInsn, u8 Mode)
+{
+  Expression::LSPType AllExpr;
+  rInsn.SetTestedFlags(X86_FlSf);
+  /* semantic: if __expr and sf.id == int1(0): op0.val = op1.val */
+  AllExpr.push_back(Expr::MakeIfElseCond(
+    ConditionExpression::CondEq,
+    Expr::MakeId(X86_FlSf, &m_CpuInfo),
+    Expr::MakeBitVector(1, 0x0),
+    Expr::MakeAssign(
+      rInsn.GetOperand(0),
+      rInsn.GetOperand(1)), nullptr)
+  );
+  rInsn.SetSemantic(AllExpr);
+}
+
+void X86Architecture::Semantic_040(Instruction& rInsn, u8 Mode)
+{
+  Expression::LSPType AllExpr;
+  rInsn.SetTestedFlags(X86_FlPf);
+  /* semantic: if __expr and pf.id == int1(1): op0.val = op1.val */
+  AllExpr.push_back(Expr::MakeIfElseCond(
+    ConditionExpression::CondEq,
+    Expr::MakeId(X86_FlPf, &m_CpuInfo),
+    Expr::MakeBitVector(1, 0x1),
+    Expr::MakeAssign(
+      rInsn.GetOperand(0),
+      rInsn.GetOperand(1)), nullptr)
+  );
+  rInsn.SetSemantic(AllExpr);
+}
+
+void X86Architecture::Semantic_041(Instruction& rInsn, u8 Mode)
+{
+  Expression::LSPType AllExpr;
+  rInsn.SetTestedFlags(X86_FlPf);
+  /* semantic: if __expr and pf.id == int1(0): op0.val = op1.val */
+  AllExpr.push_back(Expr::MakeIfElseCond(
+    ConditionExpression::CondEq,
+    Expr::MakeId(X86_FlPf, &m_CpuInfo),
+    Expr::MakeBitVector(1, 0x0),
+    Expr::MakeAssign(
+      rInsn.GetOperand(0),
+      rInsn.GetOperand(1)), nullptr)
+  );
+  rInsn.SetSemantic(AllExpr);
+}
+
+void X86Architecture::Semantic_042(Instruction& rInsn, u8 Mode)
+{
+  Expression::LSPType AllExpr;
+  rInsn.SetTestedFlags(X86_FlOf | X86_FlSf);
+  /* semantic: if __expr and (sf.id ^ of.id) != int1(0): op0.val = op1.val */
+  AllExpr.push_back(Expr::MakeIfElseCond(
+    ConditionExpression::CondNe,
+    Expr::MakeBinOp(
+      OperationExpression::OpXor,
+      Expr::MakeId(X86_FlSf, &m_CpuInfo),
+      Expr::MakeId(X86_FlOf, &m_CpuInfo)),
+    Expr::MakeBitVector(1, 0x0),
+    Expr::MakeAssign(
+      rInsn.GetOperand(0),
+      rInsn.GetOperand(1)), nullptr)
+  );
+  rInsn.SetSemantic(AllExpr);
+}
+
+void X86Architecture::Semantic_043(Instruction& rInsn, u8 Mode)
+{
+  Expression::LSPType AllExpr;
+  rInsn.SetTestedFlags(X86_FlOf | X86_FlSf);
+  /* semantic: if __expr and (sf.id ^ of.id) == int1(0): op0.val = op1.val */
+  AllExpr.push_back(Expr::MakeIfElseCond(
+    ConditionExpression::CondEq,
+    Expr::MakeBinOp(
+      OperationExpression::OpXor,
+      Expr::MakeId(X86_FlSf, &m_CpuInfo),
+      Expr::MakeId(X86_FlOf, &m_CpuInfo)),
+    Expr::MakeBitVector(1, 0x0),
+    Expr::MakeAssign(
+      rInsn.GetOperand(0),
+      rInsn.GetOperand(1)), nullptr)
+  );
+  rInsn.SetSemantic(AllExpr);
+}
+
+void X86Architecture::Semantic_044(Instruction& rInsn, u8 Mode)
+{
+  Expression::LSPType AllExpr;
+  rInsn.SetTestedFlags(X86_FlOf | X86_FlSf | X86_FlZf);
+  /* semantic: if __expr and ((sf.id ^ of.id) | zf.id) != int1(0): op0.val = op1.val */
+  AllExpr.push_back(Expr::MakeIfElseCond(
+    ConditionExpression::CondNe,
+    Expr::MakeBinOp(
+      OperationExpression::OpOr,
+      Expr::MakeBinOp(
+        OperationExpression::OpXor,
+        Expr::MakeId(X86_FlSf, &m_CpuInfo),
+        Expr::MakeId(X86_FlOf, &m_CpuInfo)),
+      Expr::MakeId(X86_FlZf, &m_CpuInfo)),
+    Expr::MakeBitVector(1, 0x0),
+    Expr::MakeAssign(
+      rInsn.GetOperand(0),
+      rInsn.GetOperand(1)), nullptr)
+  );
+  rInsn.SetSemantic(AllExpr);
+}
+
+void X86Architecture::Semantic_045(Instruction& rInsn, u8 Mode)
+{
+  Expression::LSPType AllExpr;
+  rInsn.SetTestedFlags(X86_FlOf | X86_FlSf | X86_FlZf);
+  /* semantic: if __expr and ((sf.id ^ of.id) | zf.id) == int1(0): op0.val = op1.val */
+  AllExpr.push_back(Expr::MakeIfElseCond(
+    ConditionExpression::CondEq,
+    Expr::MakeBinOp(
+      OperationExpression::OpOr,
+      Expr::MakeBinOp(
+        OperationExpression::OpXor,
+        Expr::MakeId(X86_FlSf, &m_CpuInfo),
+        Expr::MakeId(X86_FlOf, &m_CpuInfo)),
+      Expr::MakeId(X86_FlZf, &m_CpuInfo)),
+    Expr::MakeBitVector(1, 0x0),
+    Expr::MakeAssign(
+      rInsn.GetOperand(0),
+      rInsn.GetOperand(1)), nullptr)
+  );
+  rInsn.SetSemantic(AllExpr);
+}
+
+void X86Architecture::Semantic_046(Instruction& rInsn, u8 Mode)
+{
+  Expression::LSPType AllExpr;
+  /* semantic: eax.id = int32(0x11111111) */
+  AllExpr.push_back(Expr::MakeAssign(
+    Expr::MakeId(X86_Reg_Eax, &m_CpuInfo),
+    Expr::MakeBitVector(32, 0x11111111)));
+  /* semantic: ecx.id = int32(0x22222222) */
+  AllExpr.push_back(Expr::MakeAssign(
+    Expr::MakeId(X86_Reg_Ecx, &m_CpuInfo),
+    Expr::MakeBitVector(32, 0x22222222)));
+  /* semantic: edx.id = int32(0x33333333) */
+  AllExpr.push_back(Expr::MakeAssign(
+    Expr::MakeId(X86_Reg_Edx, &m_CpuInfo),
+    Expr::MakeBitVector(32, 0x33333333)));
+  /* semantic: ebx.id = int32(0x44444444) */
+  AllExpr.push_back(Expr::MakeAssign(
+    Expr::MakeId(X86_Reg_Ebx, &m_CpuInfo),
+    Expr::MakeBitVector(32, 0x44444444)));
+  rInsn.SetSemantic(AllExpr);
+}
+
+void X86Architecture::Semantic_047(Instruction& rInsn, u8 Mode)
+{
+  Expression::LSPType AllExpr;
+  /* semantic: program.id = program.id */
+  AllExpr.push_back(Expr::MakeAssign(
+    Expr::MakeId(m_CpuInfo.GetRegisterByType(CpuInformation::ProgramPointerRegister, rInsn.GetMode()), &m_CpuInfo),
+    Expr::MakeId(m_CpuInfo.GetRegisterByType(CpuInformation::ProgramPointerRegister, rInsn.GetMode()), &m_CpuInfo)));
+  rInsn.SetSemantic(AllExpr);
+}
+
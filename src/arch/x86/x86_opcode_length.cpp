@@ -0,0 +1,1745 @@
+/* This file has been automatically generated, you must _NOT_ edit it directly. (Sun Oct 18 16:41:17 2026) */
+#include "x86_architecture.hpp"
+const X86Architecture::LengthEntry X86Architecture::m_Length_Table_1[0x100] =
+{
+  { LengthModRm, LengthImmNone, 0, 0 }, /* 00 */
+  { LengthModRm, LengthImmNone, 0, 0 }, /* 01 */
+  { LengthModRm, LengthImmNone, 0, 0 }, /* 02 */
+  { LengthModRm, LengthImmNone, 0, 0 }, /* 03 */
+  { 0, LengthImmB, 0, 0 }, /* 04 */
+  { 0, LengthImmZ, 0, 0 }, /* 05 */
+  { LengthNo64, LengthImmNone, 0, 0 }, /* 06 */
+  { LengthNo64, LengthImmNone, 0, 0 }, /* 07 */
+  { LengthModRm, LengthImmNone, 0, 0 }, /* 08 */
+  { LengthModRm, LengthImmNone, 0, 0 }, /* 09 */
+  { LengthModRm, LengthImmNone, 0, 0 }, /* 0a */
+  { LengthModRm, LengthImmNone, 0, 0 }, /* 0b */
+  { 0, LengthImmB, 0, 0 }, /* 0c */
+  { 0, LengthImmZ, 0, 0 }, /* 0d */
+  { LengthNo64, LengthImmNone, 0, 0 }, /* 0e */
+  { LengthEscape, LengthImmNone, 0, LengthTable_2 }, /* 0f */
+  { LengthModRm, LengthImmNone, 0, 0 }, /* 10 */
+  { LengthModRm, LengthImmNone, 0, 0 }, /* 11 */
+  { LengthModRm, LengthImmNone, 0, 0 }, /* 12 */
+  { LengthModRm, LengthImmNone, 0, 0 }, /* 13 */
+  { 0, LengthImmB, 0, 0 }, /* 14 */
+  { 0, LengthImmZ, 0, 0 }, /* 15 */
+  { LengthNo64, LengthImmNone, 0, 0 }, /* 16 */
+  { LengthNo64, LengthImmNone, 0, 0 }, /* 17 */
+  { LengthModRm, LengthImmNone, 0, 0 }, /* 18 */
+  { LengthModRm, LengthImmNone, 0, 0 }, /* 19 */
+  { LengthModRm, LengthImmNone, 0, 0 }, /* 1a */
+  { LengthModRm, LengthImmNone, 0, 0 }, /* 1b */
+  { 0, LengthImmB, 0, 0 }, /* 1c */
+  { 0, LengthImmZ, 0, 0 }, /* 1d */
+  { LengthNo64, LengthImmNone, 0, 0 }, /* 1e */
+  { LengthNo64, LengthImmNone, 0, 0 }, /* 1f */
+  { LengthModRm, LengthImmNone, 0, 0 }, /* 20 */
+  { LengthModRm, LengthImmNone, 0, 0 }, /* 21 */
+  { LengthModRm, LengthImmNone, 0, 0 }, /* 22 */
+  { LengthModRm, LengthImmNone, 0, 0 }, /* 23 */
+  { 0, LengthImmB, 0, 0 }, /* 24 */
+  { 0, LengthImmZ, 0, 0 }, /* 25 */
+  { LengthPrefix, LengthImmNone, 0, LengthPrefixOther }, /* 26 */
+  { LengthNo64, LengthImmNone, 0, 0 }, /* 27 */
+  { LengthModRm, LengthImmNone, 0, 0 }, /* 28 */
+  { LengthModRm, LengthImmNone, 0, 0 }, /* 29 */
+  { LengthModRm, LengthImmNone, 0, 0 }, /* 2a */
+  { LengthModRm, LengthImmNone, 0, 0 }, /* 2b */
+  { 0, LengthImmB, 0, 0 }, /* 2c */
+  { 0, LengthImmZ, 0, 0 }, /* 2d */
+  { LengthPrefix, LengthImmNone, 0, LengthPrefixOther }, /* 2e */
+  { LengthNo64, LengthImmNone, 0, 0 }, /* 2f */
+  { LengthModRm, LengthImmNone, 0, 0 }, /* 30 */
+  { LengthModRm, LengthImmNone, 0, 0 }, /* 31 */
+  { LengthModRm, LengthImmNone, 0, 0 }, /* 32 */
+  { LengthModRm, LengthImmNone, 0, 0 }, /* 33 */
+  { 0, LengthImmB, 0, 0 }, /* 34 */
+  { 0, LengthImmZ, 0, 0 }, /* 35 */
+  { LengthPrefix, LengthImmNone, 0, LengthPrefixOther }, /* 36 */
+  { 0, LengthImmNone, 0, 0 }, /* 37 */
+  { LengthModRm, LengthImmNone, 0, 0 }, /* 38 */
+  { LengthModRm, LengthImmNone, 0, 0 }, /* 39 */
+  { LengthModRm, LengthImmNone, 0, 0 }, /* 3a */
+  { LengthModRm, LengthImmNone, 0, 0 }, /* 3b */
+  { 0, LengthImmB, 0, 0 }, /* 3c */
+  { 0, LengthImmZ, 0, 0 }, /* 3d */
+  { LengthPrefix, LengthImmNone, 0, LengthPrefixOther }, /* 3e */
+  { LengthNo64, LengthImmNone, 0, 0 }, /* 3f */
+  { LengthPrefix64, LengthImmNone, 0, LengthPrefixRex }, /* 40 */
+  { LengthPrefix64, LengthImmNone, 0, LengthPrefixRex }, /* 41 */
+  { LengthPrefix64, LengthImmNone, 0, LengthPrefixRex }, /* 42 */
+  { LengthPrefix64, LengthImmNone, 0, LengthPrefixRex }, /* 43 */
+  { LengthPrefix64, LengthImmNone, 0, LengthPrefixRex }, /* 44 */
+  { LengthPrefix64, LengthImmNone, 0, LengthPrefixRex }, /* 45 */
+  { LengthPrefix64, LengthImmNone, 0, LengthPrefixRex }, /* 46 */
+  { LengthPrefix64, LengthImmNone, 0, LengthPrefixRex }, /* 47 */
+  { LengthPrefix64, LengthImmNone, 0, LengthPrefixRexW }, /* 48 */
+  { LengthPrefix64, LengthImmNone, 0, LengthPrefixRexW }, /* 49 */
+  { LengthPrefix64, LengthImmNone, 0, LengthPrefixRexW }, /* 4a */
+  { LengthPrefix64, LengthImmNone, 0, LengthPrefixRexW }, /* 4b */
+  { LengthPrefix64, LengthImmNone, 0, LengthPrefixRexW }, /* 4c */
+  { LengthPrefix64, LengthImmNone, 0, LengthPrefixRexW }, /* 4d */
+  { LengthPrefix64, LengthImmNone, 0, LengthPrefixRexW }, /* 4e */
+  { LengthPrefix64, LengthImmNone, 0, LengthPrefixRexW }, /* 4f */
+  { 0, LengthImmNone, 0, 0 }, /* 50 */
+  { 0, LengthImmNone, 0, 0 }, /* 51 */
+  { 0, LengthImmNone, 0, 0 }, /* 52 */
+  { 0, LengthImmNone, 0, 0 }, /* 53 */
+  { 0, LengthImmNone, 0, 0 }, /* 54 */
+  { 0, LengthImmNone, 0, 0 }, /* 55 */
+  { 0, LengthImmNone, 0, 0 }, /* 56 */
+  { 0, LengthImmNone, 0, 0 }, /* 57 */
+  { 0, LengthImmNone, 0, 0 }, /* 58 */
+  { 0, LengthImmNone, 0, 0 }, /* 59 */
+  { 0, LengthImmNone, 0, 0 }, /* 5a */
+  { 0, LengthImmNone, 0, 0 }, /* 5b */
+  { 0, LengthImmNone, 0, 0 }, /* 5c */
+  { 0, LengthImmNone, 0, 0 }, /* 5d */
+  { 0, LengthImmNone, 0, 0 }, /* 5e */
+  { 0, LengthImmNone, 0, 0 }, /* 5f */
+  { LengthNo64, LengthImmNone, 0, 0 }, /* 60 */
+  { LengthNo64, LengthImmNone, 0, 0 }, /* 61 */
+  { LengthModRm | LengthNo64, LengthImmNone, 0, 0 }, /* 62 */
+  { LengthModRm, LengthImmNone, 0, 0 }, /* 63 */
+  { LengthPrefix, LengthImmNone, 0, LengthPrefixOther }, /* 64 */
+  { LengthPrefix, LengthImmNone, 0, LengthPrefixOther }, /* 65 */
+  { LengthPrefix, LengthImmNone, 0, LengthPrefixOpSize }, /* 66 */
+  { LengthPrefix, LengthImmNone, 0, LengthPrefixAdSize }, /* 67 */
+  { 0, LengthImmZ, 0, 0 }, /* 68 */
+  { LengthModRm, LengthImmZ, 0, 0 }, /* 69 */
+  { 0, LengthImmB, 0, 0 }, /* 6a */
+  { LengthModRm, LengthImmB, 0, 0 }, /* 6b */
+  { 0, LengthImmNone, 0, 0 }, /* 6c */
+  { 0, LengthImmNone, 0, 0 }, /* 6d */
+  { 0, LengthImmNone, 0, 0 }, /* 6e */
+  { 0, LengthImmNone, 0, 0 }, /* 6f */
+  { 0, LengthImmB, Instruction::JumpType | Instruction::ConditionalType, 0 }, /* 70 */
+  { 0, LengthImmB, Instruction::JumpType | Instruction::ConditionalType, 0 }, /* 71 */
+  { 0, LengthImmB, Instruction::JumpType | Instruction::ConditionalType, 0 }, /* 72 */
+  { 0, LengthImmB, Instruction::JumpType | Instruction::ConditionalType, 0 }, /* 73 */
+  { 0, LengthImmB, Instruction::JumpType | Instruction::ConditionalType, 0 }, /* 74 */
+  { 0, LengthImmB, Instruction::JumpType | Instruction::ConditionalType, 0 }, /* 75 */
+  { 0, LengthImmB, Instruction::JumpType | Instruction::ConditionalType, 0 }, /* 76 */
+  { 0, LengthImmB, Instruction::JumpType | Instruction::ConditionalType, 0 }, /* 77 */
+  { 0, LengthImmB, Instruction::JumpType | Instruction::ConditionalType, 0 }, /* 78 */
+  { 0, LengthImmB, Instruction::JumpType | Instruction::ConditionalType, 0 }, /* 79 */
+  { 0, LengthImmB, Instruction::JumpType | Instruction::ConditionalType, 0 }, /* 7a */
+  { 0, LengthImmB, Instruction::JumpType | Instruction::ConditionalType, 0 }, /* 7b */
+  { 0, LengthImmB, Instruction::JumpType | Instruction::ConditionalType, 0 }, /* 7c */
+  { 0, LengthImmB, Instruction::JumpType | Instruction::ConditionalType, 0 }, /* 7d */
+  { 0, LengthImmB, Instruction::JumpType | Instruction::ConditionalType, 0 }, /* 7e */
+  { 0, LengthImmB, Instruction::JumpType | Instruction::ConditionalType, 0 }, /* 7f */
+  { LengthModRm | LengthGroup, LengthImmNone, 0, 0x00 }, /* 80 */
+  { LengthModRm | LengthGroup, LengthImmNone, 0, 0x01 }, /* 81 */
+  { LengthModRm | LengthGroup, LengthImmNone, 0, 0x00 }, /* 82 */
+  { LengthModRm | LengthGroup, LengthImmNone, 0, 0x00 }, /* 83 */
+  { LengthModRm, LengthImmNone, 0, 0 }, /* 84 */
+  { LengthModRm, LengthImmNone, 0, 0 }, /* 85 */
+  { LengthModRm, LengthImmNone, 0, 0 }, /* 86 */
+  { LengthModRm, LengthImmNone, 0, 0 }, /* 87 */
+  { LengthModRm, LengthImmNone, 0, 0 }, /* 88 */
+  { LengthModRm, LengthImmNone, 0, 0 }, /* 89 */
+  { LengthModRm, LengthImmNone, 0, 0 }, /* 8a */
+  { LengthModRm, LengthImmNone, 0, 0 }, /* 8b */
+  { LengthModRm, LengthImmNone, 0, 0 }, /* 8c */
+  { LengthModRm, LengthImmNone, 0, 0 }, /* 8d */
+  { LengthModRm, LengthImmNone, 0, 0 }, /* 8e */
+  { LengthModRm | LengthGroup, LengthImmNone, 0, 0x02 }, /* 8f */
+  { 0, LengthImmNone, 0, 0 }, /* 90 */
+  { 0, LengthImmNone, 0, 0 }, /* 91 */
+  { 0, LengthImmNone, 0, 0 }, /* 92 */
+  { 0, LengthImmNone, 0, 0 }, /* 93 */
+  { 0, LengthImmNone, 0, 0 }, /* 94 */
+  { 0, LengthImmNone, 0, 0 }, /* 95 */
+  { 0, LengthImmNone, 0, 0 }, /* 96 */
+  { 0, LengthImmNone, 0, 0 }, /* 97 */
+  { 0, LengthImmNone, 0, 0 }, /* 98 */
+  { 0, LengthImmNone, 0, 0 }, /* 99 */
+  { LengthNo64, LengthImmFarPtr, Instruction::CallType, 0 }, /* 9a */
+  { 0, LengthImmNone, 0, 0 }, /* 9b */
+  { 0, LengthImmNone, 0, 0 }, /* 9c */
+  { 0, LengthImmNone, 0, 0 }, /* 9d */
+  { 0, LengthImmNone, 0, 0 }, /* 9e */
+  { 0, LengthImmNone, 0, 0 }, /* 9f */
+  { 0, LengthImmMoffs, 0, 0 }, /* a0 */
+  { 0, LengthImmMoffs, 0, 0 }, /* a1 */
+  { 0, LengthImmMoffs, 0, 0 }, /* a2 */
+  { 0, LengthImmMoffs, 0, 0 }, /* a3 */
+  { 0, LengthImmNone, 0, 0 }, /* a4 */
+  { 0, LengthImmNone, 0, 0 }, /* a5 */
+  { 0, LengthImmNone, 0, 0 }, /* a6 */
+  { 0, LengthImmNone, 0, 0 }, /* a7 */
+  { 0, LengthImmB, 0, 0 }, /* a8 */
+  { 0, LengthImmZ, 0, 0 }, /* a9 */
+  { 0, LengthImmNone, 0, 0 }, /* aa */
+  { 0, LengthImmNone, 0, 0 }, /* ab */
+  { 0, LengthImmNone, 0, 0 }, /* ac */
+  { 0, LengthImmNone, 0, 0 }, /* ad */
+  { 0, LengthImmNone, 0, 0 }, /* ae */
+  { 0, LengthImmNone, 0, 0 }, /* af */
+  { 0, LengthImmB, 0, 0 }, /* b0 */
+  { 0, LengthImmB, 0, 0 }, /* b1 */
+  { 0, LengthImmB, 0, 0 }, /* b2 */
+  { 0, LengthImmB, 0, 0 }, /* b3 */
+  { 0, LengthImmB, 0, 0 }, /* b4 */
+  { 0, LengthImmB, 0, 0 }, /* b5 */
+  { 0, LengthImmB, 0, 0 }, /* b6 */
+  { 0, LengthImmB, 0, 0 }, /* b7 */
+  { 0, LengthImmV, 0, 0 }, /* b8 */
+  { 0, LengthImmV, 0, 0 }, /* b9 */
+  { 0, LengthImmV, 0, 0 }, /* ba */
+  { 0, LengthImmV, 0, 0 }, /* bb */
+  { 0, LengthImmV, 0, 0 }, /* bc */
+  { 0, LengthImmV, 0, 0 }, /* bd */
+  { 0, LengthImmV, 0, 0 }, /* be */
+  { 0, LengthImmV, 0, 0 }, /* bf */
+  { LengthModRm | LengthGroup, LengthImmNone, 0, 0x00 }, /* c0 */
+  { LengthModRm | LengthGroup, LengthImmNone, 0, 0x00 }, /* c1 */
+  { 0, LengthImmW, Instruction::ReturnType, 0 }, /* c2 */
+  { 0, LengthImmNone, Instruction::ReturnType, 0 }, /* c3 */
+  { LengthPrefix64 | LengthModRm, LengthImmNone, 0, LengthPrefixOther }, /* c4 */
+  { LengthPrefix64 | LengthModRm, LengthImmNone, 0, LengthPrefixOther }, /* c5 */
+  { LengthModRm | LengthGroup, LengthImmNone, 0, 0x03 }, /* c6 */
+  { LengthModRm | LengthGroup, LengthImmNone, 0, 0x04 }, /* c7 */
+  { 0, LengthImmWB, 0, 0 }, /* c8 */
+  { 0, LengthImmNone, 0, 0 }, /* c9 */
+  { 0, LengthImmW, Instruction::ReturnType, 0 }, /* ca */
+  { 0, LengthImmNone, Instruction::ReturnType, 0 }, /* cb */
+  { 0, LengthImmNone, 0, 0 }, /* cc */
+  { 0, LengthImmB, 0, 0 }, /* cd */
+  { LengthNo64, LengthImmNone, 0, 0 }, /* ce */
+  { 0, LengthImmNone, Instruction::ReturnType, 0 }, /* cf */
+  { LengthModRm | LengthGroup, LengthImmNone, 0, 0x05 }, /* d0 */
+  { LengthModRm | LengthGroup, LengthImmNone, 0, 0x05 }, /* d1 */
+  { LengthModRm | LengthGroup, LengthImmNone, 0, 0x05 }, /* d2 */
+  { LengthModRm | LengthGroup, LengthImmNone, 0, 0x05 }, /* d3 */
+  { LengthNo64, LengthImmB, 0, 0 }, /* d4 */
+  { LengthNo64, LengthImmB, 0, 0 }, /* d5 */
+  { LengthNo64, LengthImmNone, 0, 0 }, /* d6 */
+  { 0, LengthImmNone, 0, 0 }, /* d7 */
+  { LengthModRm, LengthImmNone, 0, 0 }, /* d8 */
+  { LengthModRm, LengthImmNone, 0, 0 }, /* d9 */
+  { LengthModRm, LengthImmNone, 0, 0 }, /* da */
+  { LengthModRm, LengthImmNone, 0, 0 }, /* db */
+  { LengthModRm, LengthImmNone, 0, 0 }, /* dc */
+  { LengthModRm, LengthImmNone, 0, 0 }, /* dd */
+  { LengthModRm, LengthImmNone, 0, 0 }, /* de */
+  { LengthModRm, LengthImmNone, 0, 0 }, /* df */
+  { 0, LengthImmB, Instruction::JumpType | Instruction::ConditionalType, 0 }, /* e0 */
+  { 0, LengthImmB, Instruction::JumpType | Instruction::ConditionalType, 0 }, /* e1 */
+  { 0, LengthImmB, Instruction::JumpType | Instruction::ConditionalType, 0 }, /* e2 */
+  { 0, LengthImmB, Instruction::JumpType | Instruction::ConditionalType, 0 }, /* e3 */
+  { 0, LengthImmB, 0, 0 }, /* e4 */
+  { 0, LengthImmB, 0, 0 }, /* e5 */
+  { 0, LengthImmB, 0, 0 }, /* e6 */
+  { 0, LengthImmB, 0, 0 }, /* e7 */
+  { 0, LengthImmZ, Instruction::CallType, 0 }, /* e8 */
+  { 0, LengthImmZ, Instruction::JumpType, 0 }, /* e9 */
+  { LengthNo64, LengthImmFarPtr, Instruction::JumpType, 0 }, /* ea */
+  { 0, LengthImmB, Instruction::JumpType, 0 }, /* eb */
+  { 0, LengthImmNone, 0, 0 }, /* ec */
+  { 0, LengthImmNone, 0, 0 }, /* ed */
+  { 0, LengthImmNone, 0, 0 }, /* ee */
+  { 0, LengthImmNone, 0, 0 }, /* ef */
+  { LengthPrefix, LengthImmNone, 0, LengthPrefixOther }, /* f0 */
+  { 0, LengthImmNone, 0, 0 }, /* f1 */
+  { LengthPrefix, LengthImmNone, 0, LengthPrefixOther }, /* f2 */
+  { LengthPrefix, LengthImmNone, 0, LengthPrefixOther }, /* f3 */
+  { 0, LengthImmNone, Instruction::ReturnType, 0 }, /* f4 */
+  { 0, LengthImmNone, 0, 0 }, /* f5 */
+  { LengthModRm | LengthGroup, LengthImmNone, 0, 0x06 }, /* f6 */
+  { LengthModRm | LengthGroup, LengthImmNone, 0, 0x07 }, /* f7 */
+  { 0, LengthImmNone, 0, 0 }, /* f8 */
+  { 0, LengthImmNone, 0, 0 }, /* f9 */
+  { 0, LengthImmNone, 0, 0 }, /* fa */
+  { 0, LengthImmNone, 0, 0 }, /* fb */
+  { 0, LengthImmNone, 0, 0 }, /* fc */
+  { 0, LengthImmNone, 0, 0 }, /* fd */
+  { LengthModRm | LengthGroup, LengthImmNone, 0, 0x08 }, /* fe */
+  { LengthModRm | LengthGroup, LengthImmNone, 0, 0x09 }  /* ff */
+};
+
+const X86Architecture::LengthEntry X86Architecture::m_Length_Table_2[0x100] =
+{
+  { LengthModRm | LengthGroup, LengthImmNone, 0, 0x0a }, /* 00 */
+  { LengthModRm | LengthGroup, LengthImmNone, 0, 0x0b }, /* 01 */
+  { LengthModRm, LengthImmNone, 0, 0 }, /* 02 */
+  { LengthModRm, LengthImmNone, 0, 0 }, /* 03 */
+  { 0, LengthImmNone, 0, 0 }, /* 04 */
+  { 0, LengthImmNone, 0, 0 }, /* 05 */
+  { 0, LengthImmNone, 0, 0 }, /* 06 */
+  { 0, LengthImmNone, 0, 0 }, /* 07 */
+  { 0, LengthImmNone, 0, 0 }, /* 08 */
+  { 0, LengthImmNone, 0, 0 }, /* 09 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 0a */
+  { 0, LengthImmNone, 0, 0 }, /* 0b */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 0c */
+  { LengthModRm | LengthGroup, LengthImmNone, 0, 0x05 }, /* 0d */
+  { 0, LengthImmNone, 0, 0 }, /* 0e */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 0f */
+  { LengthModRm, LengthImmNone, 0, 0 }, /* 10 */
+  { LengthModRm, LengthImmNone, 0, 0 }, /* 11 */
+  { LengthModRm, LengthImmNone, 0, 0 }, /* 12 */
+  { LengthModRm, LengthImmNone, 0, 0 }, /* 13 */
+  { LengthModRm, LengthImmNone, 0, 0 }, /* 14 */
+  { LengthModRm, LengthImmNone, 0, 0 }, /* 15 */
+  { LengthModRm, LengthImmNone, 0, 0 }, /* 16 */
+  { LengthModRm, LengthImmNone, 0, 0 }, /* 17 */
+  { LengthModRm | LengthGroup, LengthImmNone, 0, 0x05 }, /* 18 */
+  { LengthModRm | LengthGroup, LengthImmNone, 0, 0x05 }, /* 19 */
+  { LengthModRm | LengthGroup, LengthImmNone, 0, 0x05 }, /* 1a */
+  { LengthModRm | LengthGroup, LengthImmNone, 0, 0x05 }, /* 1b */
+  { LengthModRm | LengthGroup, LengthImmNone, 0, 0x05 }, /* 1c */
+  { LengthModRm | LengthGroup, LengthImmNone, 0, 0x05 }, /* 1d */
+  { LengthModRm | LengthGroup, LengthImmNone, 0, 0x05 }, /* 1e */
+  { LengthModRm | LengthGroup, LengthImmNone, 0, 0x05 }, /* 1f */
+  { LengthModRm, LengthImmNone, 0, 0 }, /* 20 */
+  { LengthModRm, LengthImmNone, 0, 0 }, /* 21 */
+  { LengthModRm, LengthImmNone, 0, 0 }, /* 22 */
+  { LengthModRm, LengthImmNone, 0, 0 }, /* 23 */
+  { LengthEscape, LengthImmNone, 0, LengthTable_sse5a }, /* 24 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 25 */
+  { LengthModRm, LengthImmNone, 0, 0 }, /* 26 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 27 */
+  { LengthModRm, LengthImmNone, 0, 0 }, /* 28 */
+  { LengthModRm, LengthImmNone, 0, 0 }, /* 29 */
+  { LengthModRm, LengthImmNone, 0, 0 }, /* 2a */
+  { LengthModRm, LengthImmNone, 0, 0 }, /* 2b */
+  { LengthModRm, LengthImmNone, 0, 0 }, /* 2c */
+  { LengthModRm, LengthImmNone, 0, 0 }, /* 2d */
+  { LengthModRm, LengthImmNone, 0, 0 }, /* 2e */
+  { LengthModRm, LengthImmNone, 0, 0 }, /* 2f */
+  { 0, LengthImmNone, 0, 0 }, /* 30 */
+  { 0, LengthImmNone, 0, 0 }, /* 31 */
+  { 0, LengthImmNone, 0, 0 }, /* 32 */
+  { 0, LengthImmNone, 0, 0 }, /* 33 */
+  { 0, LengthImmNone, 0, 0 }, /* 34 */
+  { 0, LengthImmNone, 0, 0 }, /* 35 */
+  { LengthModRm, LengthImmNone, 0, 0 }, /* 36 */
+  { LengthSlow, LengthImmNone, 0, 0 }, /* 37 */
+  { LengthSlow, LengthImmNone, 0, 0 }, /* 38 */
+  { 0, LengthImmNone, 0, 0 }, /* 39 */
+  { LengthSlow, LengthImmNone, 0, 0 }, /* 3a */
+  { 0, LengthImmNone, 0, 0 }, /* 3b */
+  { 0, LengthImmNone, 0, 0 }, /* 3c */
+  { 0, LengthImmNone, 0, 0 }, /* 3d */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 3e */
+  { 0, LengthImmNone, 0, 0 }, /* 3f */
+  { LengthModRm, LengthImmNone, Instruction::ConditionalType, 0 }, /* 40 */
+  { LengthModRm, LengthImmNone, Instruction::ConditionalType, 0 }, /* 41 */
+  { LengthModRm, LengthImmNone, Instruction::ConditionalType, 0 }, /* 42 */
+  { LengthModRm, LengthImmNone, Instruction::ConditionalType, 0 }, /* 43 */
+  { LengthModRm, LengthImmNone, Instruction::ConditionalType, 0 }, /* 44 */
+  { LengthModRm, LengthImmNone, Instruction::ConditionalType, 0 }, /* 45 */
+  { LengthModRm, LengthImmNone, Instruction::ConditionalType, 0 }, /* 46 */
+  { LengthModRm, LengthImmNone, Instruction::ConditionalType, 0 }, /* 47 */
+  { LengthModRm, LengthImmNone, Instruction::ConditionalType, 0 }, /* 48 */
+  { LengthModRm, LengthImmNone, Instruction::ConditionalType, 0 }, /* 49 */
+  { LengthModRm, LengthImmNone, Instruction::ConditionalType, 0 }, /* 4a */
+  { LengthModRm, LengthImmNone, Instruction::ConditionalType, 0 }, /* 4b */
+  { LengthModRm, LengthImmNone, Instruction::ConditionalType, 0 }, /* 4c */
+  { LengthModRm, LengthImmNone, Instruction::ConditionalType, 0 }, /* 4d */
+  { LengthModRm, LengthImmNone, Instruction::ConditionalType, 0 }, /* 4e */
+  { LengthModRm, LengthImmNone, Instruction::ConditionalType, 0 }, /* 4f */
+  { LengthModRm, LengthImmNone, 0, 0 }, /* 50 */
+  { LengthModRm, LengthImmNone, 0, 0 }, /* 51 */
+  { LengthModRm, LengthImmNone, 0, 0 }, /* 52 */
+  { LengthModRm, LengthImmNone, 0, 0 }, /* 53 */
+  { LengthModRm, LengthImmNone, 0, 0 }, /* 54 */
+  { LengthModRm, LengthImmNone, 0, 0 }, /* 55 */
+  { LengthModRm, LengthImmNone, 0, 0 }, /* 56 */
+  { LengthModRm, LengthImmNone, 0, 0 }, /* 57 */
+  { LengthModRm, LengthImmNone, 0, 0 }, /* 58 */
+  { LengthModRm, LengthImmNone, 0, 0 }, /* 59 */
+  { LengthModRm, LengthImmNone, 0, 0 }, /* 5a */
+  { LengthModRm, LengthImmNone, 0, 0 }, /* 5b */
+  { LengthModRm, LengthImmNone, 0, 0 }, /* 5c */
+  { LengthModRm, LengthImmNone, 0, 0 }, /* 5d */
+  { LengthModRm, LengthImmNone, 0, 0 }, /* 5e */
+  { LengthModRm, LengthImmNone, 0, 0 }, /* 5f */
+  { LengthModRm, LengthImmNone, 0, 0 }, /* 60 */
+  { LengthModRm, LengthImmNone, 0, 0 }, /* 61 */
+  { LengthModRm, LengthImmNone, 0, 0 }, /* 62 */
+  { LengthModRm, LengthImmNone, 0, 0 }, /* 63 */
+  { LengthModRm, LengthImmNone, 0, 0 }, /* 64 */
+  { LengthModRm, LengthImmNone, 0, 0 }, /* 65 */
+  { LengthModRm, LengthImmNone, 0, 0 }, /* 66 */
+  { LengthModRm, LengthImmNone, 0, 0 }, /* 67 */
+  { LengthModRm, LengthImmNone, 0, 0 }, /* 68 */
+  { LengthModRm, LengthImmNone, 0, 0 }, /* 69 */
+  { LengthModRm, LengthImmNone, 0, 0 }, /* 6a */
+  { LengthModRm, LengthImmNone, 0, 0 }, /* 6b */
+  { LengthModRm, LengthImmNone, 0, 0 }, /* 6c */
+  { LengthModRm, LengthImmNone, 0, 0 }, /* 6d */
+  { LengthModRm, LengthImmNone, 0, 0 }, /* 6e */
+  { LengthModRm, LengthImmNone, 0, 0 }, /* 6f */
+  { LengthModRm, LengthImmB, 0, 0 }, /* 70 */
+  { LengthModRm | LengthGroup, LengthImmNone, 0, 0x0c }, /* 71 */
+  { LengthModRm | LengthGroup, LengthImmNone, 0, 0x0c }, /* 72 */
+  { LengthModRm | LengthGroup, LengthImmNone, 0, 0x0d }, /* 73 */
+  { LengthModRm, LengthImmNone, 0, 0 }, /* 74 */
+  { LengthModRm, LengthImmNone, 0, 0 }, /* 75 */
+  { LengthModRm, LengthImmNone, 0, 0 }, /* 76 */
+  { 0, LengthImmNone, 0, 0 }, /* 77 */
+  { LengthSlow, LengthImmNone, 0, 0 }, /* 78 */
+  { LengthModRm, LengthImmNone, 0, 0 }, /* 79 */
+  { LengthEscape, LengthImmNone, 0, LengthTable_sse5a }, /* 7a */
+  { LengthEscape, LengthImmNone, 0, LengthTable_sse5a }, /* 7b */
+  { LengthModRm, LengthImmNone, 0, 0 }, /* 7c */
+  { LengthModRm, LengthImmNone, 0, 0 }, /* 7d */
+  { LengthModRm, LengthImmNone, 0, 0 }, /* 7e */
+  { LengthModRm, LengthImmNone, 0, 0 }, /* 7f */
+  { 0, LengthImmZ, Instruction::JumpType | Instruction::ConditionalType, 0 }, /* 80 */
+  { 0, LengthImmZ, Instruction::JumpType | Instruction::ConditionalType, 0 }, /* 81 */
+  { 0, LengthImmZ, Instruction::JumpType | Instruction::ConditionalType, 0 }, /* 82 */
+  { 0, LengthImmZ, Instruction::JumpType | Instruction::ConditionalType, 0 }, /* 83 */
+  { 0, LengthImmZ, Instruction::JumpType | Instruction::ConditionalType, 0 }, /* 84 */
+  { 0, LengthImmZ, Instruction::JumpType | Instruction::ConditionalType, 0 }, /* 85 */
+  { 0, LengthImmZ, Instruction::JumpType | Instruction::ConditionalType, 0 }, /* 86 */
+  { 0, LengthImmZ, Instruction::JumpType | Instruction::ConditionalType, 0 }, /* 87 */
+  { 0, LengthImmZ, Instruction::JumpType | Instruction::ConditionalType, 0 }, /* 88 */
+  { 0, LengthImmZ, Instruction::JumpType | Instruction::ConditionalType, 0 }, /* 89 */
+  { 0, LengthImmZ, Instruction::JumpType | Instruction::ConditionalType, 0 }, /* 8a */
+  { 0, LengthImmZ, Instruction::JumpType | Instruction::ConditionalType, 0 }, /* 8b */
+  { 0, LengthImmZ, Instruction::JumpType | Instruction::ConditionalType, 0 }, /* 8c */
+  { 0, LengthImmZ, Instruction::JumpType | Instruction::ConditionalType, 0 }, /* 8d */
+  { 0, LengthImmZ, Instruction::JumpType | Instruction::ConditionalType, 0 }, /* 8e */
+  { 0, LengthImmZ, Instruction::JumpType | Instruction::ConditionalType, 0 }, /* 8f */
+  { LengthModRm, LengthImmNone, 0, 0 }, /* 90 */
+  { LengthModRm, LengthImmNone, 0, 0 }, /* 91 */
+  { LengthModRm, LengthImmNone, 0, 0 }, /* 92 */
+  { LengthModRm, LengthImmNone, 0, 0 }, /* 93 */
+  { LengthModRm, LengthImmNone, 0, 0 }, /* 94 */
+  { LengthModRm, LengthImmNone, 0, 0 }, /* 95 */
+  { LengthModRm, LengthImmNone, 0, 0 }, /* 96 */
+  { LengthModRm, LengthImmNone, 0, 0 }, /* 97 */
+  { LengthModRm, LengthImmNone, 0, 0 }, /* 98 */
+  { LengthModRm, LengthImmNone, 0, 0 }, /* 99 */
+  { LengthModRm, LengthImmNone, 0, 0 }, /* 9a */
+  { LengthModRm, LengthImmNone, 0, 0 }, /* 9b */
+  { LengthModRm, LengthImmNone, 0, 0 }, /* 9c */
+  { LengthModRm, LengthImmNone, 0, 0 }, /* 9d */
+  { LengthModRm, LengthImmNone, 0, 0 }, /* 9e */
+  { LengthModRm, LengthImmNone, 0, 0 }, /* 9f */
+  { 0, LengthImmNone, 0, 0 }, /* a0 */
+  { 0, LengthImmNone, 0, 0 }, /* a1 */
+  { 0, LengthImmNone, 0, 0 }, /* a2 */
+  { LengthModRm, LengthImmNone, 0, 0 }, /* a3 */
+  { LengthModRm, LengthImmB, 0, 0 }, /* a4 */
+  { LengthModRm, LengthImmNone, 0, 0 }, /* a5 */
+  { 0, LengthImmNone, 0, 0 }, /* a6 */
+  { 0, LengthImmNone, 0, 0 }, /* a7 */
+  { 0, LengthImmNone, 0, 0 }, /* a8 */
+  { 0, LengthImmNone, 0, 0 }, /* a9 */
+  { 0, LengthImmNone, 0, 0 }, /* aa */
+  { LengthModRm, LengthImmNone, 0, 0 }, /* ab */
+  { LengthModRm, LengthImmB, 0, 0 }, /* ac */
+  { LengthModRm, LengthImmNone, 0, 0 }, /* ad */
+  { LengthModRm | LengthGroup, LengthImmNone, 0, 0x05 }, /* ae */
+  { LengthModRm, LengthImmNone, 0, 0 }, /* af */
+  { LengthModRm, LengthImmNone, 0, 0 }, /* b0 */
+  { LengthModRm, LengthImmNone, 0, 0 }, /* b1 */
+  { LengthModRm, LengthImmNone, 0, 0 }, /* b2 */
+  { LengthModRm, LengthImmNone, 0, 0 }, /* b3 */
+  { LengthModRm, LengthImmNone, 0, 0 }, /* b4 */
+  { LengthModRm, LengthImmNone, 0, 0 }, /* b5 */
+  { LengthModRm, LengthImmNone, 0, 0 }, /* b6 */
+  { LengthModRm, LengthImmNone, 0, 0 }, /* b7 */
+  { LengthSlow, LengthImmNone, 0, 0 }, /* b8 */
+  { LengthModRm | LengthGroup, LengthImmNone, 0, 0x0e }, /* b9 */
+  { LengthModRm | LengthGroup, LengthImmNone, 0, 0x0f }, /* ba */
+  { LengthModRm, LengthImmNone, 0, 0 }, /* bb */
+  { LengthModRm, LengthImmNone, 0, 0 }, /* bc */
+  { LengthModRm, LengthImmNone, 0, 0 }, /* bd */
+  { LengthModRm, LengthImmNone, 0, 0 }, /* be */
+  { LengthModRm, LengthImmNone, 0, 0 }, /* bf */
+  { LengthModRm, LengthImmNone, 0, 0 }, /* c0 */
+  { LengthModRm, LengthImmNone, 0, 0 }, /* c1 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* c2 */
+  { LengthModRm, LengthImmNone, 0, 0 }, /* c3 */
+  { LengthModRm, LengthImmB, 0, 0 }, /* c4 */
+  { LengthModRm, LengthImmB, 0, 0 }, /* c5 */
+  { LengthModRm, LengthImmB, 0, 0 }, /* c6 */
+  { LengthModRm | LengthGroup, LengthImmNone, 0, 0x10 }, /* c7 */
+  { 0, LengthImmNone, 0, 0 }, /* c8 */
+  { 0, LengthImmNone, 0, 0 }, /* c9 */
+  { 0, LengthImmNone, 0, 0 }, /* ca */
+  { 0, LengthImmNone, 0, 0 }, /* cb */
+  { 0, LengthImmNone, 0, 0 }, /* cc */
+  { 0, LengthImmNone, 0, 0 }, /* cd */
+  { 0, LengthImmNone, 0, 0 }, /* ce */
+  { 0, LengthImmNone, 0, 0 }, /* cf */
+  { LengthModRm, LengthImmNone, 0, 0 }, /* d0 */
+  { LengthModRm, LengthImmNone, 0, 0 }, /* d1 */
+  { LengthModRm, LengthImmNone, 0, 0 }, /* d2 */
+  { LengthModRm, LengthImmNone, 0, 0 }, /* d3 */
+  { LengthModRm, LengthImmNone, 0, 0 }, /* d4 */
+  { LengthModRm, LengthImmNone, 0, 0 }, /* d5 */
+  { LengthModRm, LengthImmNone, 0, 0 }, /* d6 */
+  { LengthModRm, LengthImmNone, 0, 0 }, /* d7 */
+  { LengthModRm, LengthImmNone, 0, 0 }, /* d8 */
+  { LengthModRm, LengthImmNone, 0, 0 }, /* d9 */
+  { LengthModRm, LengthImmNone, 0, 0 }, /* da */
+  { LengthModRm, LengthImmNone, 0, 0 }, /* db */
+  { LengthModRm, LengthImmNone, 0, 0 }, /* dc */
+  { LengthModRm, LengthImmNone, 0, 0 }, /* dd */
+  { LengthModRm, LengthImmNone, 0, 0 }, /* de */
+  { LengthModRm, LengthImmNone, 0, 0 }, /* df */
+  { LengthModRm, LengthImmNone, 0, 0 }, /* e0 */
+  { LengthModRm, LengthImmNone, 0, 0 }, /* e1 */
+  { LengthModRm, LengthImmNone, 0, 0 }, /* e2 */
+  { LengthModRm, LengthImmNone, 0, 0 }, /* e3 */
+  { LengthModRm, LengthImmNone, 0, 0 }, /* e4 */
+  { LengthModRm, LengthImmNone, 0, 0 }, /* e5 */
+  { LengthModRm, LengthImmNone, 0, 0 }, /* e6 */
+  { LengthModRm, LengthImmNone, 0, 0 }, /* e7 */
+  { LengthModRm, LengthImmNone, 0, 0 }, /* e8 */
+  { LengthModRm, LengthImmNone, 0, 0 }, /* e9 */
+  { LengthModRm, LengthImmNone, 0, 0 }, /* ea */
+  { LengthModRm, LengthImmNone, 0, 0 }, /* eb */
+  { LengthModRm, LengthImmNone, 0, 0 }, /* ec */
+  { LengthModRm, LengthImmNone, 0, 0 }, /* ed */
+  { LengthModRm, LengthImmNone, 0, 0 }, /* ee */
+  { LengthModRm, LengthImmNone, 0, 0 }, /* ef */
+  { LengthModRm, LengthImmNone, 0, 0 }, /* f0 */
+  { LengthModRm, LengthImmNone, 0, 0 }, /* f1 */
+  { LengthModRm, LengthImmNone, 0, 0 }, /* f2 */
+  { LengthModRm, LengthImmNone, 0, 0 }, /* f3 */
+  { LengthModRm, LengthImmNone, 0, 0 }, /* f4 */
+  { LengthModRm, LengthImmNone, 0, 0 }, /* f5 */
+  { LengthModRm, LengthImmNone, 0, 0 }, /* f6 */
+  { LengthModRm, LengthImmNone, 0, 0 }, /* f7 */
+  { LengthModRm, LengthImmNone, 0, 0 }, /* f8 */
+  { LengthModRm, LengthImmNone, 0, 0 }, /* f9 */
+  { LengthModRm, LengthImmNone, 0, 0 }, /* fa */
+  { LengthModRm, LengthImmNone, 0, 0 }, /* fb */
+  { LengthModRm, LengthImmNone, 0, 0 }, /* fc */
+  { LengthModRm, LengthImmNone, 0, 0 }, /* fd */
+  { LengthModRm, LengthImmNone, 0, 0 }, /* fe */
+  { 0, LengthImmNone, 0, 0 }  /* ff */
+};
+
+const X86Architecture::LengthEntry X86Architecture::m_Length_Table_3dnow1[0x100] =
+{
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 00 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 01 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 02 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 03 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 04 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 05 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 06 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 07 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 08 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 09 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 0a */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 0b */
+  { LengthModRm, LengthImmNone, 0, 0 }, /* 0c */
+  { LengthModRm, LengthImmNone, 0, 0 }, /* 0d */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 0e */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 0f */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 10 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 11 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 12 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 13 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 14 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 15 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 16 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 17 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 18 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 19 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 1a */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 1b */
+  { LengthModRm, LengthImmNone, 0, 0 }, /* 1c */
+  { LengthModRm, LengthImmNone, 0, 0 }, /* 1d */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 1e */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 1f */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 20 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 21 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 22 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 23 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 24 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 25 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 26 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 27 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 28 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 29 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 2a */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 2b */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 2c */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 2d */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 2e */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 2f */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 30 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 31 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 32 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 33 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 34 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 35 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 36 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 37 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 38 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 39 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 3a */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 3b */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 3c */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 3d */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 3e */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 3f */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 40 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 41 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 42 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 43 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 44 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 45 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 46 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 47 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 48 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 49 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 4a */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 4b */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 4c */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 4d */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 4e */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 4f */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 50 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 51 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 52 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 53 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 54 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 55 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 56 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 57 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 58 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 59 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 5a */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 5b */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 5c */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 5d */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 5e */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 5f */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 60 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 61 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 62 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 63 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 64 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 65 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 66 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 67 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 68 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 69 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 6a */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 6b */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 6c */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 6d */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 6e */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 6f */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 70 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 71 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 72 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 73 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 74 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 75 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 76 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 77 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 78 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 79 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 7a */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 7b */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 7c */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 7d */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 7e */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 7f */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 80 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 81 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 82 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 83 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 84 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 85 */
+  { LengthModRm, LengthImmNone, 0, 0 }, /* 86 */
+  { LengthModRm, LengthImmNone, 0, 0 }, /* 87 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 88 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 89 */
+  { LengthModRm, LengthImmNone, 0, 0 }, /* 8a */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 8b */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 8c */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 8d */
+  { LengthModRm, LengthImmNone, 0, 0 }, /* 8e */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 8f */
+  { LengthModRm, LengthImmNone, 0, 0 }, /* 90 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 91 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 92 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 93 */
+  { LengthModRm, LengthImmNone, 0, 0 }, /* 94 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 95 */
+  { LengthModRm, LengthImmNone, 0, 0 }, /* 96 */
+  { LengthModRm, LengthImmNone, 0, 0 }, /* 97 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 98 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 99 */
+  { LengthModRm, LengthImmNone, 0, 0 }, /* 9a */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 9b */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 9c */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 9d */
+  { LengthModRm, LengthImmNone, 0, 0 }, /* 9e */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 9f */
+  { LengthModRm, LengthImmNone, 0, 0 }, /* a0 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* a1 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* a2 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* a3 */
+  { LengthModRm, LengthImmNone, 0, 0 }, /* a4 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* a5 */
+  { LengthModRm, LengthImmNone, 0, 0 }, /* a6 */
+  { LengthModRm, LengthImmNone, 0, 0 }, /* a7 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* a8 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* a9 */
+  { LengthModRm, LengthImmNone, 0, 0 }, /* aa */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* ab */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* ac */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* ad */
+  { LengthModRm, LengthImmNone, 0, 0 }, /* ae */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* af */
+  { LengthModRm, LengthImmNone, 0, 0 }, /* b0 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* b1 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* b2 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* b3 */
+  { LengthModRm, LengthImmNone, 0, 0 }, /* b4 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* b5 */
+  { LengthModRm, LengthImmNone, 0, 0 }, /* b6 */
+  { LengthModRm, LengthImmNone, 0, 0 }, /* b7 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* b8 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* b9 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* ba */
+  { LengthModRm, LengthImmNone, 0, 0 }, /* bb */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* bc */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* bd */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* be */
+  { LengthModRm, LengthImmNone, 0, 0 }, /* bf */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* c0 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* c1 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* c2 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* c3 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* c4 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* c5 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* c6 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* c7 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* c8 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* c9 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* ca */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* cb */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* cc */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* cd */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* ce */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* cf */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* d0 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* d1 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* d2 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* d3 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* d4 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* d5 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* d6 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* d7 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* d8 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* d9 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* da */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* db */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* dc */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* dd */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* de */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* df */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* e0 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* e1 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* e2 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* e3 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* e4 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* e5 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* e6 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* e7 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* e8 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* e9 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* ea */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* eb */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* ec */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* ed */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* ee */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* ef */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* f0 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* f1 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* f2 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* f3 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* f4 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* f5 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* f6 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* f7 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* f8 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* f9 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* fa */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* fb */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* fc */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* fd */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* fe */
+  { LengthInvalid, LengthImmNone, 0, 0 }  /* ff */
+};
+
+const X86Architecture::LengthEntry X86Architecture::m_Length_Table_3_38[0x100] =
+{
+  { LengthModRm, LengthImmNone, 0, 0 }, /* 00 */
+  { LengthModRm, LengthImmNone, 0, 0 }, /* 01 */
+  { LengthModRm, LengthImmNone, 0, 0 }, /* 02 */
+  { LengthModRm, LengthImmNone, 0, 0 }, /* 03 */
+  { LengthModRm, LengthImmNone, 0, 0 }, /* 04 */
+  { LengthModRm, LengthImmNone, 0, 0 }, /* 05 */
+  { LengthModRm, LengthImmNone, 0, 0 }, /* 06 */
+  { LengthModRm, LengthImmNone, 0, 0 }, /* 07 */
+  { LengthModRm, LengthImmNone, 0, 0 }, /* 08 */
+  { LengthModRm, LengthImmNone, 0, 0 }, /* 09 */
+  { LengthModRm, LengthImmNone, 0, 0 }, /* 0a */
+  { LengthModRm, LengthImmNone, 0, 0 }, /* 0b */
+  { LengthModRm, LengthImmNone, 0, 0 }, /* 0c */
+  { LengthModRm, LengthImmNone, 0, 0 }, /* 0d */
+  { LengthModRm, LengthImmNone, 0, 0 }, /* 0e */
+  { LengthModRm, LengthImmNone, 0, 0 }, /* 0f */
+  { LengthModRm, LengthImmNone, 0, 0 }, /* 10 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 11 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 12 */
+  { LengthModRm, LengthImmNone, 0, 0 }, /* 13 */
+  { LengthModRm, LengthImmNone, 0, 0 }, /* 14 */
+  { LengthModRm, LengthImmNone, 0, 0 }, /* 15 */
+  { LengthModRm, LengthImmNone, 0, 0 }, /* 16 */
+  { LengthModRm, LengthImmNone, 0, 0 }, /* 17 */
+  { LengthModRm, LengthImmNone, 0, 0 }, /* 18 */
+  { LengthModRm, LengthImmNone, 0, 0 }, /* 19 */
+  { LengthModRm, LengthImmNone, 0, 0 }, /* 1a */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 1b */
+  { LengthModRm, LengthImmNone, 0, 0 }, /* 1c */
+  { LengthModRm, LengthImmNone, 0, 0 }, /* 1d */
+  { LengthModRm, LengthImmNone, 0, 0 }, /* 1e */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 1f */
+  { LengthModRm, LengthImmNone, 0, 0 }, /* 20 */
+  { LengthModRm, LengthImmNone, 0, 0 }, /* 21 */
+  { LengthModRm, LengthImmNone, 0, 0 }, /* 22 */
+  { LengthModRm, LengthImmNone, 0, 0 }, /* 23 */
+  { LengthModRm, LengthImmNone, 0, 0 }, /* 24 */
+  { LengthModRm, LengthImmNone, 0, 0 }, /* 25 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 26 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 27 */
+  { LengthModRm, LengthImmNone, 0, 0 }, /* 28 */
+  { LengthModRm, LengthImmNone, 0, 0 }, /* 29 */
+  { LengthModRm, LengthImmNone, 0, 0 }, /* 2a */
+  { LengthModRm, LengthImmNone, 0, 0 }, /* 2b */
+  { LengthModRm, LengthImmNone, 0, 0 }, /* 2c */
+  { LengthModRm, LengthImmNone, 0, 0 }, /* 2d */
+  { LengthModRm, LengthImmNone, 0, 0 }, /* 2e */
+  { LengthModRm, LengthImmNone, 0, 0 }, /* 2f */
+  { LengthModRm, LengthImmNone, 0, 0 }, /* 30 */
+  { LengthModRm, LengthImmNone, 0, 0 }, /* 31 */
+  { LengthModRm, LengthImmNone, 0, 0 }, /* 32 */
+  { LengthModRm, LengthImmNone, 0, 0 }, /* 33 */
+  { LengthModRm, LengthImmNone, 0, 0 }, /* 34 */
+  { LengthModRm, LengthImmNone, 0, 0 }, /* 35 */
+  { LengthModRm, LengthImmNone, 0, 0 }, /* 36 */
+  { LengthModRm, LengthImmNone, 0, 0 }, /* 37 */
+  { LengthModRm, LengthImmNone, 0, 0 }, /* 38 */
+  { LengthModRm, LengthImmNone, 0, 0 }, /* 39 */
+  { LengthModRm, LengthImmNone, 0, 0 }, /* 3a */
+  { LengthModRm, LengthImmNone, 0, 0 }, /* 3b */
+  { LengthModRm, LengthImmNone, 0, 0 }, /* 3c */
+  { LengthModRm, LengthImmNone, 0, 0 }, /* 3d */
+  { LengthModRm, LengthImmNone, 0, 0 }, /* 3e */
+  { LengthModRm, LengthImmNone, 0, 0 }, /* 3f */
+  { LengthModRm, LengthImmNone, 0, 0 }, /* 40 */
+  { LengthModRm, LengthImmNone, 0, 0 }, /* 41 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 42 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 43 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 44 */
+  { LengthModRm, LengthImmNone, 0, 0 }, /* 45 */
+  { LengthModRm, LengthImmNone, 0, 0 }, /* 46 */
+  { LengthModRm, LengthImmNone, 0, 0 }, /* 47 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 48 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 49 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 4a */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 4b */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 4c */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 4d */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 4e */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 4f */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 50 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 51 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 52 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 53 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 54 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 55 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 56 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 57 */
+  { LengthModRm, LengthImmNone, 0, 0 }, /* 58 */
+  { LengthModRm, LengthImmNone, 0, 0 }, /* 59 */
+  { LengthModRm, LengthImmNone, 0, 0 }, /* 5a */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 5b */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 5c */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 5d */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 5e */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 5f */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 60 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 61 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 62 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 63 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 64 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 65 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 66 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 67 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 68 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 69 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 6a */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 6b */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 6c */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 6d */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 6e */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 6f */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 70 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 71 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 72 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 73 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 74 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 75 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 76 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 77 */
+  { LengthModRm, LengthImmNone, 0, 0 }, /* 78 */
+  { LengthModRm, LengthImmNone, 0, 0 }, /* 79 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 7a */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 7b */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 7c */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 7d */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 7e */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 7f */
+  { LengthModRm, LengthImmNone, 0, 0 }, /* 80 */
+  { LengthModRm, LengthImmNone, 0, 0 }, /* 81 */
+  { LengthModRm, LengthImmNone, 0, 0 }, /* 82 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 83 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 84 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 85 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 86 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 87 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 88 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 89 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 8a */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 8b */
+  { LengthModRm, LengthImmNone, 0, 0 }, /* 8c */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 8d */
+  { LengthModRm, LengthImmNone, 0, 0 }, /* 8e */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 8f */
+  { LengthModRm, LengthImmNone, 0, 0 }, /* 90 */
+  { LengthModRm, LengthImmNone, 0, 0 }, /* 91 */
+  { LengthModRm, LengthImmNone, 0, 0 }, /* 92 */
+  { LengthModRm, LengthImmNone, 0, 0 }, /* 93 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 94 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 95 */
+  { LengthModRm, LengthImmNone, 0, 0 }, /* 96 */
+  { LengthModRm, LengthImmNone, 0, 0 }, /* 97 */
+  { LengthModRm, LengthImmNone, 0, 0 }, /* 98 */
+  { LengthModRm, LengthImmNone, 0, 0 }, /* 99 */
+  { LengthModRm, LengthImmNone, 0, 0 }, /* 9a */
+  { LengthModRm, LengthImmNone, 0, 0 }, /* 9b */
+  { LengthModRm, LengthImmNone, 0, 0 }, /* 9c */
+  { LengthModRm, LengthImmNone, 0, 0 }, /* 9d */
+  { LengthModRm, LengthImmNone, 0, 0 }, /* 9e */
+  { LengthModRm, LengthImmNone, 0, 0 }, /* 9f */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* a0 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* a1 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* a2 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* a3 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* a4 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* a5 */
+  { LengthModRm, LengthImmNone, 0, 0 }, /* a6 */
+  { LengthModRm, LengthImmNone, 0, 0 }, /* a7 */
+  { LengthModRm, LengthImmNone, 0, 0 }, /* a8 */
+  { LengthModRm, LengthImmNone, 0, 0 }, /* a9 */
+  { LengthModRm, LengthImmNone, 0, 0 }, /* aa */
+  { LengthModRm, LengthImmNone, 0, 0 }, /* ab */
+  { LengthModRm, LengthImmNone, 0, 0 }, /* ac */
+  { LengthModRm, LengthImmNone, 0, 0 }, /* ad */
+  { LengthModRm, LengthImmNone, 0, 0 }, /* ae */
+  { LengthModRm, LengthImmNone, 0, 0 }, /* af */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* b0 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* b1 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* b2 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* b3 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* b4 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* b5 */
+  { LengthModRm, LengthImmNone, 0, 0 }, /* b6 */
+  { LengthModRm, LengthImmNone, 0, 0 }, /* b7 */
+  { LengthModRm, LengthImmNone, 0, 0 }, /* b8 */
+  { LengthModRm, LengthImmNone, 0, 0 }, /* b9 */
+  { LengthModRm, LengthImmNone, 0, 0 }, /* ba */
+  { LengthModRm, LengthImmNone, 0, 0 }, /* bb */
+  { LengthModRm, LengthImmNone, 0, 0 }, /* bc */
+  { LengthModRm, LengthImmNone, 0, 0 }, /* bd */
+  { LengthModRm, LengthImmNone, 0, 0 }, /* be */
+  { LengthModRm, LengthImmNone, 0, 0 }, /* bf */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* c0 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* c1 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* c2 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* c3 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* c4 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* c5 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* c6 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* c7 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* c8 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* c9 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* ca */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* cb */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* cc */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* cd */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* ce */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* cf */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* d0 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* d1 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* d2 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* d3 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* d4 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* d5 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* d6 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* d7 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* d8 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* d9 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* da */
+  { LengthModRm, LengthImmNone, 0, 0 }, /* db */
+  { LengthModRm, LengthImmNone, 0, 0 }, /* dc */
+  { LengthModRm, LengthImmNone, 0, 0 }, /* dd */
+  { LengthModRm, LengthImmNone, 0, 0 }, /* de */
+  { LengthModRm, LengthImmNone, 0, 0 }, /* df */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* e0 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* e1 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* e2 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* e3 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* e4 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* e5 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* e6 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* e7 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* e8 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* e9 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* ea */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* eb */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* ec */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* ed */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* ee */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* ef */
+  { LengthModRm, LengthImmNone, 0, 0 }, /* f0 */
+  { LengthModRm, LengthImmNone, 0, 0 }, /* f1 */
+  { LengthModRm, LengthImmNone, 0, 0 }, /* f2 */
+  { LengthSlow, LengthImmNone, 0, 0 }, /* f3 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* f4 */
+  { LengthModRm, LengthImmNone, 0, 0 }, /* f5 */
+  { LengthModRm, LengthImmNone, 0, 0 }, /* f6 */
+  { LengthModRm, LengthImmNone, 0, 0 }, /* f7 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* f8 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* f9 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* fa */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* fb */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* fc */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* fd */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* fe */
+  { LengthInvalid, LengthImmNone, 0, 0 }  /* ff */
+};
+
+const X86Architecture::LengthEntry X86Architecture::m_Length_Table_3_3a[0x100] =
+{
+  { LengthModRm, LengthImmB, 0, 0 }, /* 00 */
+  { LengthModRm, LengthImmB, 0, 0 }, /* 01 */
+  { LengthModRm, LengthImmB, 0, 0 }, /* 02 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 03 */
+  { LengthModRm, LengthImmB, 0, 0 }, /* 04 */
+  { LengthModRm, LengthImmB, 0, 0 }, /* 05 */
+  { LengthModRm, LengthImmB, 0, 0 }, /* 06 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 07 */
+  { LengthModRm, LengthImmB, 0, 0 }, /* 08 */
+  { LengthModRm, LengthImmB, 0, 0 }, /* 09 */
+  { LengthModRm, LengthImmB, 0, 0 }, /* 0a */
+  { LengthModRm, LengthImmB, 0, 0 }, /* 0b */
+  { LengthModRm, LengthImmB, 0, 0 }, /* 0c */
+  { LengthModRm, LengthImmB, 0, 0 }, /* 0d */
+  { LengthModRm, LengthImmB, 0, 0 }, /* 0e */
+  { LengthModRm, LengthImmB, 0, 0 }, /* 0f */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 10 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 11 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 12 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 13 */
+  { LengthModRm, LengthImmB, 0, 0 }, /* 14 */
+  { LengthModRm, LengthImmB, 0, 0 }, /* 15 */
+  { LengthModRm, LengthImmB, 0, 0 }, /* 16 */
+  { LengthModRm, LengthImmB, 0, 0 }, /* 17 */
+  { LengthModRm, LengthImmB, 0, 0 }, /* 18 */
+  { LengthModRm, LengthImmB, 0, 0 }, /* 19 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 1a */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 1b */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 1c */
+  { LengthModRm, LengthImmB, 0, 0 }, /* 1d */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 1e */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 1f */
+  { LengthModRm, LengthImmB, 0, 0 }, /* 20 */
+  { LengthModRm, LengthImmB, 0, 0 }, /* 21 */
+  { LengthModRm, LengthImmB, 0, 0 }, /* 22 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 23 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 24 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 25 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 26 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 27 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 28 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 29 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 2a */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 2b */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 2c */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 2d */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 2e */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 2f */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 30 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 31 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 32 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 33 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 34 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 35 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 36 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 37 */
+  { LengthModRm, LengthImmB, 0, 0 }, /* 38 */
+  { LengthModRm, LengthImmB, 0, 0 }, /* 39 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 3a */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 3b */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 3c */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 3d */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 3e */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 3f */
+  { LengthModRm, LengthImmB, 0, 0 }, /* 40 */
+  { LengthModRm, LengthImmB, 0, 0 }, /* 41 */
+  { LengthModRm, LengthImmB, 0, 0 }, /* 42 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 43 */
+  { LengthModRm, LengthImmB, 0, 0 }, /* 44 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 45 */
+  { LengthModRm, LengthImmB, 0, 0 }, /* 46 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 47 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 48 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 49 */
+  { LengthModRm, LengthImmB, 0, 0 }, /* 4a */
+  { LengthModRm, LengthImmB, 0, 0 }, /* 4b */
+  { LengthModRm, LengthImmB, 0, 0 }, /* 4c */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 4d */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 4e */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 4f */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 50 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 51 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 52 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 53 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 54 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 55 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 56 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 57 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 58 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 59 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 5a */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 5b */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 5c */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 5d */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 5e */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 5f */
+  { LengthModRm, LengthImmB, 0, 0 }, /* 60 */
+  { LengthModRm, LengthImmB, 0, 0 }, /* 61 */
+  { LengthModRm, LengthImmB, 0, 0 }, /* 62 */
+  { LengthModRm, LengthImmB, 0, 0 }, /* 63 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 64 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 65 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 66 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 67 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 68 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 69 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 6a */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 6b */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 6c */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 6d */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 6e */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 6f */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 70 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 71 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 72 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 73 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 74 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 75 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 76 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 77 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 78 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 79 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 7a */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 7b */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 7c */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 7d */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 7e */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 7f */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 80 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 81 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 82 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 83 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 84 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 85 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 86 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 87 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 88 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 89 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 8a */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 8b */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 8c */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 8d */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 8e */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 8f */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 90 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 91 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 92 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 93 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 94 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 95 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 96 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 97 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 98 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 99 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 9a */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 9b */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 9c */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 9d */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 9e */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 9f */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* a0 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* a1 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* a2 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* a3 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* a4 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* a5 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* a6 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* a7 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* a8 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* a9 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* aa */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* ab */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* ac */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* ad */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* ae */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* af */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* b0 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* b1 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* b2 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* b3 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* b4 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* b5 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* b6 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* b7 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* b8 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* b9 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* ba */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* bb */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* bc */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* bd */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* be */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* bf */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* c0 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* c1 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* c2 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* c3 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* c4 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* c5 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* c6 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* c7 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* c8 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* c9 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* ca */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* cb */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* cc */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* cd */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* ce */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* cf */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* d0 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* d1 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* d2 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* d3 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* d4 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* d5 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* d6 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* d7 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* d8 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* d9 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* da */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* db */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* dc */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* dd */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* de */
+  { LengthModRm, LengthImmB, 0, 0 }, /* df */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* e0 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* e1 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* e2 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* e3 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* e4 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* e5 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* e6 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* e7 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* e8 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* e9 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* ea */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* eb */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* ec */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* ed */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* ee */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* ef */
+  { LengthModRm, LengthImmB, 0, 0 }, /* f0 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* f1 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* f2 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* f3 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* f4 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* f5 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* f6 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* f7 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* f8 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* f9 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* fa */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* fb */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* fc */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* fd */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* fe */
+  { LengthInvalid, LengthImmNone, 0, 0 }  /* ff */
+};
+
+const X86Architecture::LengthEntry X86Architecture::m_Length_Table_sse5a[0x100] =
+{
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 00 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 01 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 02 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 03 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 04 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 05 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 06 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 07 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 08 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 09 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 0a */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 0b */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 0c */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 0d */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 0e */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 0f */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 10 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 11 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 12 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 13 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 14 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 15 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 16 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 17 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 18 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 19 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 1a */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 1b */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 1c */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 1d */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 1e */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 1f */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 20 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 21 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 22 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 23 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 24 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 25 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 26 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 27 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 28 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 29 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 2a */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 2b */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 2c */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 2d */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 2e */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 2f */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 30 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 31 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 32 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 33 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 34 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 35 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 36 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 37 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 38 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 39 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 3a */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 3b */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 3c */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 3d */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 3e */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 3f */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 40 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 41 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 42 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 43 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 44 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 45 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 46 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 47 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 48 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 49 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 4a */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 4b */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 4c */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 4d */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 4e */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 4f */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 50 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 51 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 52 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 53 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 54 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 55 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 56 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 57 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 58 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 59 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 5a */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 5b */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 5c */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 5d */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 5e */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 5f */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 60 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 61 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 62 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 63 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 64 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 65 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 66 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 67 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 68 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 69 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 6a */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 6b */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 6c */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 6d */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 6e */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 6f */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 70 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 71 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 72 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 73 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 74 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 75 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 76 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 77 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 78 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 79 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 7a */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 7b */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 7c */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 7d */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 7e */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 7f */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 80 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 81 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 82 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 83 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 84 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 85 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 86 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 87 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 88 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 89 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 8a */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 8b */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 8c */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 8d */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 8e */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 8f */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 90 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 91 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 92 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 93 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 94 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 95 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 96 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 97 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 98 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 99 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 9a */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 9b */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 9c */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 9d */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 9e */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* 9f */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* a0 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* a1 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* a2 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* a3 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* a4 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* a5 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* a6 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* a7 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* a8 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* a9 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* aa */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* ab */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* ac */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* ad */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* ae */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* af */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* b0 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* b1 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* b2 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* b3 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* b4 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* b5 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* b6 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* b7 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* b8 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* b9 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* ba */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* bb */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* bc */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* bd */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* be */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* bf */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* c0 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* c1 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* c2 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* c3 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* c4 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* c5 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* c6 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* c7 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* c8 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* c9 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* ca */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* cb */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* cc */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* cd */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* ce */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* cf */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* d0 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* d1 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* d2 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* d3 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* d4 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* d5 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* d6 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* d7 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* d8 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* d9 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* da */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* db */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* dc */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* dd */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* de */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* df */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* e0 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* e1 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* e2 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* e3 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* e4 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* e5 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* e6 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* e7 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* e8 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* e9 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* ea */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* eb */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* ec */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* ed */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* ee */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* ef */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* f0 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* f1 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* f2 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* f3 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* f4 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* f5 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* f6 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* f7 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* f8 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* f9 */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* fa */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* fb */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* fc */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* fd */
+  { LengthInvalid, LengthImmNone, 0, 0 }, /* fe */
+  { LengthInvalid, LengthImmNone, 0, 0 }  /* ff */
+};
+
+const X86Architecture::LengthEntry X86Architecture::m_LengthGroup[0x11][8] =
+{
+  {
+    { LengthModRm, LengthImmB, 0, 0 }, /* 00 */
+    { LengthModRm, LengthImmB, 0, 0 }, /* 01 */
+    { LengthModRm, LengthImmB, 0, 0 }, /* 02 */
+    { LengthModRm, LengthImmB, 0, 0 }, /* 03 */
+    { LengthModRm, LengthImmB, 0, 0 }, /* 04 */
+    { LengthModRm, LengthImmB, 0, 0 }, /* 05 */
+    { LengthModRm, LengthImmB, 0, 0 }, /* 06 */
+    { LengthModRm, LengthImmB, 0, 0 }  /* 07 */
+  },
+  {
+    { LengthModRm, LengthImmZ, 0, 0 }, /* 00 */
+    { LengthModRm, LengthImmZ, 0, 0 }, /* 01 */
+    { LengthModRm, LengthImmZ, 0, 0 }, /* 02 */
+    { LengthModRm, LengthImmZ, 0, 0 }, /* 03 */
+    { LengthModRm, LengthImmZ, 0, 0 }, /* 04 */
+    { LengthModRm, LengthImmZ, 0, 0 }, /* 05 */
+    { LengthModRm, LengthImmZ, 0, 0 }, /* 06 */
+    { LengthModRm, LengthImmZ, 0, 0 }  /* 07 */
+  },
+  {
+    { LengthModRm, LengthImmNone, 0, 0 }, /* 00 */
+    { LengthSlow, LengthImmNone, 0, 0 }, /* 01 */
+    { LengthInvalid, LengthImmNone, 0, 0 }, /* 02 */
+    { LengthInvalid, LengthImmNone, 0, 0 }, /* 03 */
+    { LengthInvalid, LengthImmNone, 0, 0 }, /* 04 */
+    { LengthInvalid, LengthImmNone, 0, 0 }, /* 05 */
+    { LengthInvalid, LengthImmNone, 0, 0 }, /* 06 */
+    { LengthInvalid, LengthImmNone, 0, 0 }  /* 07 */
+  },
+  {
+    { LengthModRm, LengthImmB, 0, 0 }, /* 00 */
+    { LengthInvalid, LengthImmNone, 0, 0 }, /* 01 */
+    { LengthInvalid, LengthImmNone, 0, 0 }, /* 02 */
+    { LengthInvalid, LengthImmNone, 0, 0 }, /* 03 */
+    { LengthInvalid, LengthImmNone, 0, 0 }, /* 04 */
+    { LengthInvalid, LengthImmNone, 0, 0 }, /* 05 */
+    { LengthInvalid, LengthImmNone, 0, 0 }, /* 06 */
+    { LengthInvalid, LengthImmNone, 0, 0 }  /* 07 */
+  },
+  {
+    { LengthModRm, LengthImmZ, 0, 0 }, /* 00 */
+    { LengthInvalid, LengthImmNone, 0, 0 }, /* 01 */
+    { LengthInvalid, LengthImmNone, 0, 0 }, /* 02 */
+    { LengthInvalid, LengthImmNone, 0, 0 }, /* 03 */
+    { LengthInvalid, LengthImmNone, 0, 0 }, /* 04 */
+    { LengthInvalid, LengthImmNone, 0, 0 }, /* 05 */
+    { LengthInvalid, LengthImmNone, 0, 0 }, /* 06 */
+    { LengthInvalid, LengthImmNone, 0, 0 }  /* 07 */
+  },
+  {
+    { LengthModRm, LengthImmNone, 0, 0 }, /* 00 */
+    { LengthModRm, LengthImmNone, 0, 0 }, /* 01 */
+    { LengthModRm, LengthImmNone, 0, 0 }, /* 02 */
+    { LengthModRm, LengthImmNone, 0, 0 }, /* 03 */
+    { LengthModRm, LengthImmNone, 0, 0 }, /* 04 */
+    { LengthModRm, LengthImmNone, 0, 0 }, /* 05 */
+    { LengthModRm, LengthImmNone, 0, 0 }, /* 06 */
+    { LengthModRm, LengthImmNone, 0, 0 }  /* 07 */
+  },
+  {
+    { LengthModRm, LengthImmB, 0, 0 }, /* 00 */
+    { LengthModRm, LengthImmB, 0, 0 }, /* 01 */
+    { LengthModRm, LengthImmNone, 0, 0 }, /* 02 */
+    { LengthModRm, LengthImmNone, 0, 0 }, /* 03 */
+    { LengthModRm, LengthImmNone, 0, 0 }, /* 04 */
+    { LengthModRm, LengthImmNone, 0, 0 }, /* 05 */
+    { LengthModRm, LengthImmNone, 0, 0 }, /* 06 */
+    { LengthModRm, LengthImmNone, 0, 0 }  /* 07 */
+  },
+  {
+    { LengthModRm, LengthImmZ, 0, 0 }, /* 00 */
+    { LengthModRm, LengthImmZ, 0, 0 }, /* 01 */
+    { LengthModRm, LengthImmNone, 0, 0 }, /* 02 */
+    { LengthModRm, LengthImmNone, 0, 0 }, /* 03 */
+    { LengthModRm, LengthImmNone, 0, 0 }, /* 04 */
+    { LengthModRm, LengthImmNone, 0, 0 }, /* 05 */
+    { LengthModRm, LengthImmNone, 0, 0 }, /* 06 */
+    { LengthModRm, LengthImmNone, 0, 0 }  /* 07 */
+  },
+  {
+    { LengthModRm, LengthImmNone, 0, 0 }, /* 00 */
+    { LengthModRm, LengthImmNone, 0, 0 }, /* 01 */
+    { LengthInvalid, LengthImmNone, 0, 0 }, /* 02 */
+    { LengthInvalid, LengthImmNone, 0, 0 }, /* 03 */
+    { LengthInvalid, LengthImmNone, 0, 0 }, /* 04 */
+    { LengthInvalid, LengthImmNone, 0, 0 }, /* 05 */
+    { LengthInvalid, LengthImmNone, 0, 0 }, /* 06 */
+    { LengthInvalid, LengthImmNone, 0, 0 }  /* 07 */
+  },
+  {
+    { LengthModRm, LengthImmNone, 0, 0 }, /* 00 */
+    { LengthModRm, LengthImmNone, 0, 0 }, /* 01 */
+    { LengthModRm, LengthImmNone, Instruction::CallType, 0 }, /* 02 */
+    { LengthModRm, LengthImmNone, Instruction::CallType, 0 }, /* 03 */
+    { LengthModRm, LengthImmNone, Instruction::JumpType, 0 }, /* 04 */
+    { LengthModRm, LengthImmNone, Instruction::JumpType, 0 }, /* 05 */
+    { LengthModRm, LengthImmNone, 0, 0 }, /* 06 */
+    { LengthInvalid, LengthImmNone, 0, 0 }  /* 07 */
+  },
+  {
+    { LengthModRm, LengthImmNone, 0, 0 }, /* 00 */
+    { LengthModRm, LengthImmNone, 0, 0 }, /* 01 */
+    { LengthModRm, LengthImmNone, 0, 0 }, /* 02 */
+    { LengthModRm, LengthImmNone, 0, 0 }, /* 03 */
+    { LengthModRm, LengthImmNone, 0, 0 }, /* 04 */
+    { LengthModRm, LengthImmNone, 0, 0 }, /* 05 */
+    { LengthModRm, LengthImmNone, 0, 0 }, /* 06 */
+    { LengthInvalid, LengthImmNone, 0, 0 }  /* 07 */
+  },
+  {
+    { LengthModRm, LengthImmNone, 0, 0 }, /* 00 */
+    { LengthModRm, LengthImmNone, 0, 0 }, /* 01 */
+    { LengthModRm, LengthImmNone, 0, 0 }, /* 02 */
+    { LengthModRm, LengthImmNone, 0, 0 }, /* 03 */
+    { LengthModRm, LengthImmNone, 0, 0 }, /* 04 */
+    { LengthInvalid, LengthImmNone, 0, 0 }, /* 05 */
+    { LengthModRm, LengthImmNone, 0, 0 }, /* 06 */
+    { LengthModRm, LengthImmNone, 0, 0 }  /* 07 */
+  },
+  {
+    { LengthInvalid, LengthImmNone, 0, 0 }, /* 00 */
+    { LengthInvalid, LengthImmNone, 0, 0 }, /* 01 */
+    { LengthModRm, LengthImmB, 0, 0 }, /* 02 */
+    { LengthInvalid, LengthImmNone, 0, 0 }, /* 03 */
+    { LengthModRm, LengthImmB, 0, 0 }, /* 04 */
+    { LengthInvalid, LengthImmNone, 0, 0 }, /* 05 */
+    { LengthModRm, LengthImmB, 0, 0 }, /* 06 */
+    { LengthInvalid, LengthImmNone, 0, 0 }  /* 07 */
+  },
+  {
+    { LengthInvalid, LengthImmNone, 0, 0 }, /* 00 */
+    { LengthInvalid, LengthImmNone, 0, 0 }, /* 01 */
+    { LengthModRm, LengthImmB, 0, 0 }, /* 02 */
+    { LengthModRm, LengthImmB, 0, 0 }, /* 03 */
+    { LengthInvalid, LengthImmNone, 0, 0 }, /* 04 */
+    { LengthInvalid, LengthImmNone, 0, 0 }, /* 05 */
+    { LengthModRm, LengthImmB, 0, 0 }, /* 06 */
+    { LengthModRm, LengthImmB, 0, 0 }  /* 07 */
+  },
+  {
+    { 0, LengthImmNone, 0, 0 }, /* 00 */
+    { 0, LengthImmNone, 0, 0 }, /* 01 */
+    { 0, LengthImmNone, 0, 0 }, /* 02 */
+    { 0, LengthImmNone, 0, 0 }, /* 03 */
+    { 0, LengthImmNone, 0, 0 }, /* 04 */
+    { 0, LengthImmNone, 0, 0 }, /* 05 */
+    { 0, LengthImmNone, 0, 0 }, /* 06 */
+    { 0, LengthImmNone, 0, 0 }  /* 07 */
+  },
+  {
+    { LengthInvalid, LengthImmNone, 0, 0 }, /* 00 */
+    { LengthInvalid, LengthImmNone, 0, 0 }, /* 01 */
+    { LengthInvalid, LengthImmNone, 0, 0 }, /* 02 */
+    { LengthInvalid, LengthImmNone, 0, 0 }, /* 03 */
+    { LengthModRm, LengthImmB, 0, 0 }, /* 04 */
+    { LengthModRm, LengthImmB, 0, 0 }, /* 05 */
+    { LengthModRm, LengthImmB, 0, 0 }, /* 06 */
+    { LengthModRm, LengthImmB, 0, 0 }  /* 07 */
+  },
+  {
+    { LengthInvalid, LengthImmNone, 0, 0 }, /* 00 */
+    { LengthModRm, LengthImmNone, 0, 0 }, /* 01 */
+    { LengthInvalid, LengthImmNone, 0, 0 }, /* 02 */
+    { LengthInvalid, LengthImmNone, 0, 0 }, /* 03 */
+    { LengthInvalid, LengthImmNone, 0, 0 }, /* 04 */
+    { LengthInvalid, LengthImmNone, 0, 0 }, /* 05 */
+    { LengthSlow, LengthImmNone, 0, 0 }, /* 06 */
+    { LengthModRm, LengthImmNone, 0, 0 }  /* 07 */
+  }
+};
+
+const X86Architecture::LengthEntry* const X86Architecture::m_LengthTable[LengthTableCount] =
+{
+  m_Length_Table_1,
+  m_Length_Table_2,
+  m_Length_Table_3dnow1,
+  m_Length_Table_3_38,
+  m_Length_Table_3_3a,
+  m_Length_Table_sse5a
+};
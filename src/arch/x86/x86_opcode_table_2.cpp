@@ -1,263 +1,263 @@
-/* This file has been automatically generated, you must _NOT_ edit it directly. (Sun Feb 05 12:38:19 2017) */
+/* This file has been automatically generated, you must _NOT_ edit it directly. (Sun Oct 18 18:46:50 2026) */
 #include "x86_architecture.hpp"
-const X86Architecture::TDisassembler X86Architecture::m_Table_2[0x100] =
-{
-  &X86Architecture::Table_2_00,
-  &X86Architecture::Table_2_01,
-  &X86Architecture::Table_2_02,
-  &X86Architecture::Table_2_03,
-  &X86Architecture::Table_2_04,
-  &X86Architecture::Table_2_05,
-  &X86Architecture::Table_2_06,
-  &X86Architecture::Table_2_07,
-  &X86Architecture::Table_2_08,
-  &X86Architecture::Table_2_09,
-  &X86Architecture::Table_2_0a,
-  &X86Architecture::Table_2_0b,
-  &X86Architecture::Table_2_0c,
-  &X86Architecture::Table_2_0d,
-  &X86Architecture::Table_2_0e,
-  &X86Architecture::Table_2_0f,
-  &X86Architecture::Table_2_10,
-  &X86Architecture::Table_2_11,
-  &X86Architecture::Table_2_12,
-  &X86Architecture::Table_2_13,
-  &X86Architecture::Table_2_14,
-  &X86Architecture::Table_2_15,
-  &X86Architecture::Table_2_16,
-  &X86Architecture::Table_2_17,
-  &X86Architecture::Table_2_18,
-  &X86Architecture::Table_2_19,
-  &X86Architecture::Table_2_1a,
-  &X86Architecture::Table_2_1b,
-  &X86Architecture::Table_2_1c,
-  &X86Architecture::Table_2_1d,
-  &X86Architecture::Table_2_1e,
-  &X86Architecture::Table_2_1f,
-  &X86Architecture::Table_2_20,
-  &X86Architecture::Table_2_21,
-  &X86Architecture::Table_2_22,
-  &X86Architecture::Table_2_23,
-  &X86Architecture::Table_2_24,
-  &X86Architecture::Table_2_25,
-  &X86Architecture::Table_2_26,
-  &X86Architecture::Table_2_27,
-  &X86Architecture::Table_2_28,
-  &X86Architecture::Table_2_29,
-  &X86Architecture::Table_2_2a,
-  &X86Architecture::Table_2_2b,
-  &X86Architecture::Table_2_2c,
-  &X86Architecture::Table_2_2d,
-  &X86Architecture::Table_2_2e,
-  &X86Architecture::Table_2_2f,
-  &X86Architecture::Table_2_30,
-  &X86Architecture::Table_2_31,
-  &X86Architecture::Table_2_32,
-  &X86Architecture::Table_2_33,
-  &X86Architecture::Table_2_34,
-  &X86Architecture::Table_2_35,
-  &X86Architecture::Table_2_36,
-  &X86Architecture::Table_2_37,
-  &X86Architecture::Table_2_38,
-  &X86Architecture::Table_2_39,
-  &X86Architecture::Table_2_3a,
-  &X86Architecture::Table_2_3b,
-  &X86Architecture::Table_2_3c,
-  &X86Architecture::Table_2_3d,
-  &X86Architecture::Table_2_3e,
-  &X86Architecture::Table_2_3f,
-  &X86Architecture::Table_2_40,
-  &X86Architecture::Table_2_41,
-  &X86Architecture::Table_2_42,
-  &X86Architecture::Table_2_43,
-  &X86Architecture::Table_2_44,
-  &X86Architecture::Table_2_45,
-  &X86Architecture::Table_2_46,
-  &X86Architecture::Table_2_47,
-  &X86Architecture::Table_2_48,
-  &X86Architecture::Table_2_49,
-  &X86Architecture::Table_2_4a,
-  &X86Architecture::Table_2_4b,
-  &X86Architecture::Table_2_4c,
-  &X86Architecture::Table_2_4d,
-  &X86Architecture::Table_2_4e,
-  &X86Architecture::Table_2_4f,
-  &X86Architecture::Table_2_50,
-  &X86Architecture::Table_2_51,
-  &X86Architecture::Table_2_52,
-  &X86Architecture::Table_2_53,
-  &X86Architecture::Table_2_54,
-  &X86Architecture::Table_2_55,
-  &X86Architecture::Table_2_56,
-  &X86Architecture::Table_2_57,
-  &X86Architecture::Table_2_58,
-  &X86Architecture::Table_2_59,
-  &X86Architecture::Table_2_5a,
-  &X86Architecture::Table_2_5b,
-  &X86Architecture::Table_2_5c,
-  &X86Architecture::Table_2_5d,
-  &X86Architecture::Table_2_5e,
-  &X86Architecture::Table_2_5f,
-  &X86Architecture::Table_2_60,
-  &X86Architecture::Table_2_61,
-  &X86Architecture::Table_2_62,
-  &X86Architecture::Table_2_63,
-  &X86Architecture::Table_2_64,
-  &X86Architecture::Table_2_65,
-  &X86Architecture::Table_2_66,
-  &X86Architecture::Table_2_67,
-  &X86Architecture::Table_2_68,
-  &X86Architecture::Table_2_69,
-  &X86Architecture::Table_2_6a,
-  &X86Architecture::Table_2_6b,
-  &X86Architecture::Table_2_6c,
-  &X86Architecture::Table_2_6d,
-  &X86Architecture::Table_2_6e,
-  &X86Architecture::Table_2_6f,
-  &X86Architecture::Table_2_70,
-  &X86Architecture::Table_2_71,
-  &X86Architecture::Table_2_72,
-  &X86Architecture::Table_2_73,
-  &X86Architecture::Table_2_74,
-  &X86Architecture::Table_2_75,
-  &X86Architecture::Table_2_76,
-  &X86Architecture::Table_2_77,
-  &X86Architecture::Table_2_78,
-  &X86Architecture::Table_2_79,
-  &X86Architecture::Table_2_7a,
-  &X86Architecture::Table_2_7b,
-  &X86Architecture::Table_2_7c,
-  &X86Architecture::Table_2_7d,
-  &X86Architecture::Table_2_7e,
-  &X86Architecture::Table_2_7f,
-  &X86Architecture::Table_2_80,
-  &X86Architecture::Table_2_81,
-  &X86Architecture::Table_2_82,
-  &X86Architecture::Table_2_83,
-  &X86Architecture::Table_2_84,
-  &X86Architecture::Table_2_85,
-  &X86Architecture::Table_2_86,
-  &X86Architecture::Table_2_87,
-  &X86Architecture::Table_2_88,
-  &X86Architecture::Table_2_89,
-  &X86Architecture::Table_2_8a,
-  &X86Architecture::Table_2_8b,
-  &X86Architecture::Table_2_8c,
-  &X86Architecture::Table_2_8d,
-  &X86Architecture::Table_2_8e,
-  &X86Architecture::Table_2_8f,
-  &X86Architecture::Table_2_90,
-  &X86Architecture::Table_2_91,
-  &X86Architecture::Table_2_92,
-  &X86Architecture::Table_2_93,
-  &X86Architecture::Table_2_94,
-  &X86Architecture::Table_2_95,
-  &X86Architecture::Table_2_96,
-  &X86Architecture::Table_2_97,
-  &X86Architecture::Table_2_98,
-  &X86Architecture::Table_2_99,
-  &X86Architecture::Table_2_9a,
-  &X86Architecture::Table_2_9b,
-  &X86Architecture::Table_2_9c,
-  &X86Architecture::Table_2_9d,
-  &X86Architecture::Table_2_9e,
-  &X86Architecture::Table_2_9f,
-  &X86Architecture::Table_2_a0,
-  &X86Architecture::Table_2_a1,
-  &X86Architecture::Table_2_a2,
-  &X86Architecture::Table_2_a3,
-  &X86Architecture::Table_2_a4,
-  &X86Architecture::Table_2_a5,
-  &X86Architecture::Table_2_a6,
-  &X86Architecture::Table_2_a7,
-  &X86Architecture::Table_2_a8,
-  &X86Architecture::Table_2_a9,
-  &X86Architecture::Table_2_aa,
-  &X86Architecture::Table_2_ab,
-  &X86Architecture::Table_2_ac,
-  &X86Architecture::Table_2_ad,
-  &X86Architecture::Table_2_ae,
-  &X86Architecture::Table_2_af,
-  &X86Architecture::Table_2_b0,
-  &X86Architecture::Table_2_b1,
-  &X86Architecture::Table_2_b2,
-  &X86Architecture::Table_2_b3,
-  &X86Architecture::Table_2_b4,
-  &X86Architecture::Table_2_b5,
-  &X86Architecture::Table_2_b6,
-  &X86Architecture::Table_2_b7,
-  &X86Architecture::Table_2_b8,
-  &X86Architecture::Table_2_b9,
-  &X86Architecture::Table_2_ba,
-  &X86Architecture::Table_2_bb,
-  &X86Architecture::Table_2_bc,
-  &X86Architecture::Table_2_bd,
-  &X86Architecture::Table_2_be,
-  &X86Architecture::Table_2_bf,
-  &X86Architecture::Table_2_c0,
-  &X86Architecture::Table_2_c1,
-  &X86Architecture::Table_2_c2,
-  &X86Architecture::Table_2_c3,
-  &X86Architecture::Table_2_c4,
-  &X86Architecture::Table_2_c5,
-  &X86Architecture::Table_2_c6,
-  &X86Architecture::Table_2_c7,
-  &X86Architecture::Table_2_c8,
-  &X86Architecture::Table_2_c9,
-  &X86Architecture::Table_2_ca,
-  &X86Architecture::Table_2_cb,
-  &X86Architecture::Table_2_cc,
-  &X86Architecture::Table_2_cd,
-  &X86Architecture::Table_2_ce,
-  &X86Architecture::Table_2_cf,
-  &X86Architecture::Table_2_d0,
-  &X86Architecture::Table_2_d1,
-  &X86Architecture::Table_2_d2,
-  &X86Architecture::Table_2_d3,
-  &X86Architecture::Table_2_d4,
-  &X86Architecture::Table_2_d5,
-  &X86Architecture::Table_2_d6,
-  &X86Architecture::Table_2_d7,
-  &X86Architecture::Table_2_d8,
-  &X86Architecture::Table_2_d9,
-  &X86Architecture::Table_2_da,
-  &X86Architecture::Table_2_db,
-  &X86Architecture::Table_2_dc,
-  &X86Architecture::Table_2_dd,
-  &X86Architecture::Table_2_de,
-  &X86Architecture::Table_2_df,
-  &X86Architecture::Table_2_e0,
-  &X86Architecture::Table_2_e1,
-  &X86Architecture::Table_2_e2,
-  &X86Architecture::Table_2_e3,
-  &X86Architecture::Table_2_e4,
-  &X86Architecture::Table_2_e5,
-  &X86Architecture::Table_2_e6,
-  &X86Architecture::Table_2_e7,
-  &X86Architecture::Table_2_e8,
-  &X86Architecture::Table_2_e9,
-  &X86Architecture::Table_2_ea,
-  &X86Architecture::Table_2_eb,
-  &X86Architecture::Table_2_ec,
-  &X86Architecture::Table_2_ed,
-  &X86Architecture::Table_2_ee,
-  &X86Architecture::Table_2_ef,
-  &X86Architecture::Table_2_f0,
-  &X86Architecture::Table_2_f1,
-  &X86Architecture::Table_2_f2,
-  &X86Architecture::Table_2_f3,
-  &X86Architecture::Table_2_f4,
-  &X86Architecture::Table_2_f5,
-  &X86Architecture::Table_2_f6,
-  &X86Architecture::Table_2_f7,
-  &X86Architecture::Table_2_f8,
-  &X86Architecture::Table_2_f9,
-  &X86Architecture::Table_2_fa,
-  &X86Architecture::Table_2_fb,
-  &X86Architecture::Table_2_fc,
-  &X86Architecture::Table_2_fd,
-  &X86Architecture::Table_2_fe,
-  &X86Architecture::Table_2_ff
+const X86Architecture::DecodeEntry X86Architecture::m_Table_2[0x100] =
+{
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x080, 0, DecodeHandler }, /* 00 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x081, 0, DecodeHandler }, /* 01 */
+  { X86_Opcode_Lar, 0x020, 0x000, 0x000, 0, 0 }, /* 02 */
+  { X86_Opcode_Lsl, 0x020, 0x000, 0x000, 0, 0 }, /* 03 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x082, 0, DecodeHandler }, /* 04 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x083, 0, DecodeHandler }, /* 05 */
+  { X86_Opcode_Clts, 0x000, 0x000, 0x000, 0, 0 }, /* 06 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x084, 0, DecodeHandler }, /* 07 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x085, 0, DecodeHandler }, /* 08 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x086, 0, DecodeHandler }, /* 09 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* 0a */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x087, 0, DecodeHandler }, /* 0b */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* 0c */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x088, 0, DecodeHandler }, /* 0d */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x089, 0, DecodeHandler }, /* 0e */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x08a, 0, DecodeHandler }, /* 0f */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x08b, 0, DecodeHandler }, /* 10 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x08c, 0, DecodeHandler }, /* 11 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x08d, 0, DecodeHandler }, /* 12 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x08e, 0, DecodeHandler }, /* 13 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x08f, 0, DecodeHandler }, /* 14 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x090, 0, DecodeHandler }, /* 15 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x091, 0, DecodeHandler }, /* 16 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x092, 0, DecodeHandler }, /* 17 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x093, 0, DecodeHandler }, /* 18 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x094, 0, DecodeHandler }, /* 19 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x095, 0, DecodeHandler }, /* 1a */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x096, 0, DecodeHandler }, /* 1b */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x097, 0, DecodeHandler }, /* 1c */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x098, 0, DecodeHandler }, /* 1d */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x099, 0, DecodeHandler }, /* 1e */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x09a, 0, DecodeHandler }, /* 1f */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x09b, 0, DecodeHandler }, /* 20 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x09c, 0, DecodeHandler }, /* 21 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x09d, 0, DecodeHandler }, /* 22 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x09e, 0, DecodeHandler }, /* 23 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x09f, 0, DecodeHandler }, /* 24 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x0a0, 0, DecodeHandler }, /* 25 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x0a1, 0, DecodeHandler }, /* 26 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* 27 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x0a2, 0, DecodeHandler }, /* 28 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x0a3, 0, DecodeHandler }, /* 29 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x0a4, 0, DecodeHandler }, /* 2a */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x0a5, 0, DecodeHandler }, /* 2b */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x0a6, 0, DecodeHandler }, /* 2c */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x0a7, 0, DecodeHandler }, /* 2d */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x0a8, 0, DecodeHandler }, /* 2e */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x0a9, 0, DecodeHandler }, /* 2f */
+  { X86_Opcode_Wrmsr, 0x000, 0x000, 0x000, 0, 0 }, /* 30 */
+  { X86_Opcode_Rdtsc, 0x000, 0x035, 0x000, 0, 0 }, /* 31 */
+  { X86_Opcode_Rdmsr, 0x000, 0x000, 0x000, 0, 0 }, /* 32 */
+  { X86_Opcode_Rdpmc, 0x000, 0x000, 0x000, 0, 0 }, /* 33 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x0aa, 0, DecodeHandler }, /* 34 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x0ab, 0, DecodeHandler }, /* 35 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x0ac, 0, DecodeHandler }, /* 36 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x0ad, 0, DecodeHandler }, /* 37 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x0ae, 0, DecodeHandler }, /* 38 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x0af, 0, DecodeHandler }, /* 39 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x0b0, 0, DecodeHandler }, /* 3a */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x0b1, 0, DecodeHandler }, /* 3b */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x0b2, 0, DecodeHandler }, /* 3c */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x0b3, 0, DecodeHandler }, /* 3d */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* 3e */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x0b4, 0, DecodeHandler }, /* 3f */
+  { X86_Opcode_Cmovo, 0x004, 0x036, 0x000, Instruction::ConditionalType, 0 }, /* 40 */
+  { X86_Opcode_Cmovno, 0x004, 0x037, 0x000, Instruction::ConditionalType, 0 }, /* 41 */
+  { X86_Opcode_Cmovb, 0x004, 0x038, 0x000, Instruction::ConditionalType, 0 }, /* 42 */
+  { X86_Opcode_Cmovnb, 0x004, 0x039, 0x000, Instruction::ConditionalType, 0 }, /* 43 */
+  { X86_Opcode_Cmovz, 0x004, 0x03a, 0x000, Instruction::ConditionalType, 0 }, /* 44 */
+  { X86_Opcode_Cmovnz, 0x004, 0x03b, 0x000, Instruction::ConditionalType, 0 }, /* 45 */
+  { X86_Opcode_Cmovbe, 0x004, 0x03c, 0x000, Instruction::ConditionalType, 0 }, /* 46 */
+  { X86_Opcode_Cmovnbe, 0x004, 0x03d, 0x000, Instruction::ConditionalType, 0 }, /* 47 */
+  { X86_Opcode_Cmovs, 0x004, 0x03e, 0x000, Instruction::ConditionalType, 0 }, /* 48 */
+  { X86_Opcode_Cmovns, 0x004, 0x03f, 0x000, Instruction::ConditionalType, 0 }, /* 49 */
+  { X86_Opcode_Cmovp, 0x004, 0x040, 0x000, Instruction::ConditionalType, 0 }, /* 4a */
+  { X86_Opcode_Cmovnp, 0x004, 0x041, 0x000, Instruction::ConditionalType, 0 }, /* 4b */
+  { X86_Opcode_Cmovl, 0x004, 0x042, 0x000, Instruction::ConditionalType, 0 }, /* 4c */
+  { X86_Opcode_Cmovnl, 0x004, 0x043, 0x000, Instruction::ConditionalType, 0 }, /* 4d */
+  { X86_Opcode_Cmovle, 0x004, 0x044, 0x000, Instruction::ConditionalType, 0 }, /* 4e */
+  { X86_Opcode_Cmovnle, 0x004, 0x045, 0x000, Instruction::ConditionalType, 0 }, /* 4f */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x0b5, 0, DecodeHandler }, /* 50 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x0b6, 0, DecodeHandler }, /* 51 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x0b7, 0, DecodeHandler }, /* 52 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x0b8, 0, DecodeHandler }, /* 53 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x0b9, 0, DecodeHandler }, /* 54 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x0ba, 0, DecodeHandler }, /* 55 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x0bb, 0, DecodeHandler }, /* 56 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x0bc, 0, DecodeHandler }, /* 57 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x0bd, 0, DecodeHandler }, /* 58 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x0be, 0, DecodeHandler }, /* 59 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x0bf, 0, DecodeHandler }, /* 5a */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x0c0, 0, DecodeHandler }, /* 5b */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x0c1, 0, DecodeHandler }, /* 5c */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x0c2, 0, DecodeHandler }, /* 5d */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x0c3, 0, DecodeHandler }, /* 5e */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x0c4, 0, DecodeHandler }, /* 5f */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x0c5, 0, DecodeHandler }, /* 60 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x0c6, 0, DecodeHandler }, /* 61 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x0c7, 0, DecodeHandler }, /* 62 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x0c8, 0, DecodeHandler }, /* 63 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x0c9, 0, DecodeHandler }, /* 64 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x0ca, 0, DecodeHandler }, /* 65 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x0cb, 0, DecodeHandler }, /* 66 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x0cc, 0, DecodeHandler }, /* 67 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x0cd, 0, DecodeHandler }, /* 68 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x0ce, 0, DecodeHandler }, /* 69 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x0cf, 0, DecodeHandler }, /* 6a */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x0d0, 0, DecodeHandler }, /* 6b */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x0d1, 0, DecodeHandler }, /* 6c */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x0d2, 0, DecodeHandler }, /* 6d */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x0d3, 0, DecodeHandler }, /* 6e */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x0d4, 0, DecodeHandler }, /* 6f */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x0d5, 0, DecodeHandler }, /* 70 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x0d6, 0, DecodeHandler }, /* 71 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x0d7, 0, DecodeHandler }, /* 72 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x0d8, 0, DecodeHandler }, /* 73 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x0d9, 0, DecodeHandler }, /* 74 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x0da, 0, DecodeHandler }, /* 75 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x0db, 0, DecodeHandler }, /* 76 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x0dc, 0, DecodeHandler }, /* 77 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x0dd, 0, DecodeHandler }, /* 78 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x0de, 0, DecodeHandler }, /* 79 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x0df, 0, DecodeHandler }, /* 7a */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x0e0, 0, DecodeHandler }, /* 7b */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x0e1, 0, DecodeHandler }, /* 7c */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x0e2, 0, DecodeHandler }, /* 7d */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x0e3, 0, DecodeHandler }, /* 7e */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x0e4, 0, DecodeHandler }, /* 7f */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x0e5, 0, DecodeHandler }, /* 80 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x0e6, 0, DecodeHandler }, /* 81 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x0e7, 0, DecodeHandler }, /* 82 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x0e8, 0, DecodeHandler }, /* 83 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x0e9, 0, DecodeHandler }, /* 84 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x0ea, 0, DecodeHandler }, /* 85 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x0eb, 0, DecodeHandler }, /* 86 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x0ec, 0, DecodeHandler }, /* 87 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x0ed, 0, DecodeHandler }, /* 88 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x0ee, 0, DecodeHandler }, /* 89 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x0ef, 0, DecodeHandler }, /* 8a */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x0f0, 0, DecodeHandler }, /* 8b */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x0f1, 0, DecodeHandler }, /* 8c */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x0f2, 0, DecodeHandler }, /* 8d */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x0f3, 0, DecodeHandler }, /* 8e */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x0f4, 0, DecodeHandler }, /* 8f */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x0f5, 0, DecodeHandler }, /* 90 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x0f6, 0, DecodeHandler }, /* 91 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x0f7, 0, DecodeHandler }, /* 92 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x0f8, 0, DecodeHandler }, /* 93 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x0f9, 0, DecodeHandler }, /* 94 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x0fa, 0, DecodeHandler }, /* 95 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x0fb, 0, DecodeHandler }, /* 96 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x0fc, 0, DecodeHandler }, /* 97 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x0fd, 0, DecodeHandler }, /* 98 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x0fe, 0, DecodeHandler }, /* 99 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x0ff, 0, DecodeHandler }, /* 9a */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x100, 0, DecodeHandler }, /* 9b */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x101, 0, DecodeHandler }, /* 9c */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x102, 0, DecodeHandler }, /* 9d */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x103, 0, DecodeHandler }, /* 9e */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x104, 0, DecodeHandler }, /* 9f */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x105, 0, DecodeHandler }, /* a0 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x106, 0, DecodeHandler }, /* a1 */
+  { X86_Opcode_Cpuid, 0x000, 0x046, 0x000, 0, 0 }, /* a2 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x107, 0, DecodeHandler }, /* a3 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x108, 0, DecodeHandler }, /* a4 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x109, 0, DecodeHandler }, /* a5 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x10a, 0, DecodeHandler }, /* a6 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x10b, 0, DecodeHandler }, /* a7 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x10c, 0, DecodeHandler }, /* a8 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x10d, 0, DecodeHandler }, /* a9 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x10e, 0, DecodeHandler }, /* aa */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x10f, 0, DecodeHandler }, /* ab */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x110, 0, DecodeHandler }, /* ac */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x111, 0, DecodeHandler }, /* ad */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x112, 0, DecodeHandler }, /* ae */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x113, 0, DecodeHandler }, /* af */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x114, 0, DecodeHandler }, /* b0 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x115, 0, DecodeHandler }, /* b1 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x116, 0, DecodeHandler }, /* b2 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x117, 0, DecodeHandler }, /* b3 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x118, 0, DecodeHandler }, /* b4 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x119, 0, DecodeHandler }, /* b5 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x11a, 0, DecodeHandler }, /* b6 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x11b, 0, DecodeHandler }, /* b7 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x11c, 0, DecodeHandler }, /* b8 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x11d, 0, DecodeHandler }, /* b9 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x11e, 0, DecodeHandler }, /* ba */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x11f, 0, DecodeHandler }, /* bb */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x120, 0, DecodeHandler }, /* bc */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x121, 0, DecodeHandler }, /* bd */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x122, 0, DecodeHandler }, /* be */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x123, 0, DecodeHandler }, /* bf */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x124, 0, DecodeHandler }, /* c0 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x125, 0, DecodeHandler }, /* c1 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* c2 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x126, 0, DecodeHandler }, /* c3 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x127, 0, DecodeHandler }, /* c4 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x128, 0, DecodeHandler }, /* c5 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x129, 0, DecodeHandler }, /* c6 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x12a, 0, DecodeHandler }, /* c7 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x12b, 0, DecodeHandler }, /* c8 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x12c, 0, DecodeHandler }, /* c9 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x12d, 0, DecodeHandler }, /* ca */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x12e, 0, DecodeHandler }, /* cb */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x12f, 0, DecodeHandler }, /* cc */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x130, 0, DecodeHandler }, /* cd */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x131, 0, DecodeHandler }, /* ce */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x132, 0, DecodeHandler }, /* cf */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x133, 0, DecodeHandler }, /* d0 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x134, 0, DecodeHandler }, /* d1 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x135, 0, DecodeHandler }, /* d2 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x136, 0, DecodeHandler }, /* d3 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x137, 0, DecodeHandler }, /* d4 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x138, 0, DecodeHandler }, /* d5 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x139, 0, DecodeHandler }, /* d6 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x13a, 0, DecodeHandler }, /* d7 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x13b, 0, DecodeHandler }, /* d8 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x13c, 0, DecodeHandler }, /* d9 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x13d, 0, DecodeHandler }, /* da */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x13e, 0, DecodeHandler }, /* db */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x13f, 0, DecodeHandler }, /* dc */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x140, 0, DecodeHandler }, /* dd */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x141, 0, DecodeHandler }, /* de */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x142, 0, DecodeHandler }, /* df */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x143, 0, DecodeHandler }, /* e0 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x144, 0, DecodeHandler }, /* e1 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x145, 0, DecodeHandler }, /* e2 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x146, 0, DecodeHandler }, /* e3 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x147, 0, DecodeHandler }, /* e4 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x148, 0, DecodeHandler }, /* e5 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x149, 0, DecodeHandler }, /* e6 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x14a, 0, DecodeHandler }, /* e7 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x14b, 0, DecodeHandler }, /* e8 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x14c, 0, DecodeHandler }, /* e9 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x14d, 0, DecodeHandler }, /* ea */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x14e, 0, DecodeHandler }, /* eb */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x14f, 0, DecodeHandler }, /* ec */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x150, 0, DecodeHandler }, /* ed */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x151, 0, DecodeHandler }, /* ee */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x152, 0, DecodeHandler }, /* ef */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x153, 0, DecodeHandler }, /* f0 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x154, 0, DecodeHandler }, /* f1 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x155, 0, DecodeHandler }, /* f2 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x156, 0, DecodeHandler }, /* f3 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x157, 0, DecodeHandler }, /* f4 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x158, 0, DecodeHandler }, /* f5 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x159, 0, DecodeHandler }, /* f6 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x15a, 0, DecodeHandler }, /* f7 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x15b, 0, DecodeHandler }, /* f8 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x15c, 0, DecodeHandler }, /* f9 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x15d, 0, DecodeHandler }, /* fa */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x15e, 0, DecodeHandler }, /* fb */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x15f, 0, DecodeHandler }, /* fc */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x160, 0, DecodeHandler }, /* fd */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x161, 0, DecodeHandler }, /* fe */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x162, 0, DecodeHandler }  /* ff */
 };
 
 /** group:
@@ -279,16 +279,17 @@ const X86Architecture::TDisassembler X86Architecture::m_Table_2[0x100] =
  * opcode: 05
  * sub_opcodes: [{'mnemonic': 'verw', 'operand': ['Mw']}, {'mnemonic': 'verw', 'operand': ['Rv'], 'attr': ['na16']}]
  *
+ * opcode: 06
  * mnemonic: jmpe
  * operand: ['Ev']
- * opcode: 06
  * attr: ['ia64']
  *
  * opcode: 07
  * invalid
  *
 **/
-bool X86Architecture::Table_2_00(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_2_00(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     u8 ModRmByte;
     if (!rBinStrm.Read(Offset, ModRmByte))
@@ -302,7 +303,7 @@ bool X86Architecture::Table_2_00(BinaryStream const& rBinStrm, OffsetType Offset
       {
         rInsn.Size()++;
         rInsn.SetOpcode(X86_Opcode_Sldt);
-        if (Operand__Rv(rBinStrm, Offset, rInsn, Mode) == false)
+        if (Operand__Rv<Mode>(rBinStrm, Offset, rInsn) == false)
         {
           return false;
         }
@@ -312,7 +313,7 @@ bool X86Architecture::Table_2_00(BinaryStream const& rBinStrm, OffsetType Offset
       {
         rInsn.Size()++;
         rInsn.SetOpcode(X86_Opcode_Sldt);
-        if (Operand__Mw(rBinStrm, Offset, rInsn, Mode) == false)
+        if (Operand__Mw<Mode>(rBinStrm, Offset, rInsn) == false)
         {
           return false;
         }
@@ -323,7 +324,7 @@ bool X86Architecture::Table_2_00(BinaryStream const& rBinStrm, OffsetType Offset
       {
         rInsn.Size()++;
         rInsn.SetOpcode(X86_Opcode_Str);
-        if (Operand__Rv(rBinStrm, Offset, rInsn, Mode) == false)
+        if (Operand__Rv<Mode>(rBinStrm, Offset, rInsn) == false)
         {
           return false;
         }
@@ -333,7 +334,7 @@ bool X86Architecture::Table_2_00(BinaryStream const& rBinStrm, OffsetType Offset
       {
         rInsn.Size()++;
         rInsn.SetOpcode(X86_Opcode_Str);
-        if (Operand__Mw(rBinStrm, Offset, rInsn, Mode) == false)
+        if (Operand__Mw<Mode>(rBinStrm, Offset, rInsn) == false)
         {
           return false;
         }
@@ -344,7 +345,7 @@ bool X86Architecture::Table_2_00(BinaryStream const& rBinStrm, OffsetType Offset
       {
         rInsn.Size()++;
         rInsn.SetOpcode(X86_Opcode_Lldt);
-        if (Operand__Rv(rBinStrm, Offset, rInsn, Mode) == false)
+        if (Operand__Rv<Mode>(rBinStrm, Offset, rInsn) == false)
         {
           return false;
         }
@@ -354,7 +355,7 @@ bool X86Architecture::Table_2_00(BinaryStream const& rBinStrm, OffsetType Offset
       {
         rInsn.Size()++;
         rInsn.SetOpcode(X86_Opcode_Lldt);
-        if (Operand__Mw(rBinStrm, Offset, rInsn, Mode) == false)
+        if (Operand__Mw<Mode>(rBinStrm, Offset, rInsn) == false)
         {
           return false;
         }
@@ -365,7 +366,7 @@ bool X86Architecture::Table_2_00(BinaryStream const& rBinStrm, OffsetType Offset
       {
         rInsn.Size()++;
         rInsn.SetOpcode(X86_Opcode_Ltr);
-        if (Operand__Rv(rBinStrm, Offset, rInsn, Mode) == false)
+        if (Operand__Rv<Mode>(rBinStrm, Offset, rInsn) == false)
         {
           return false;
         }
@@ -375,7 +376,7 @@ bool X86Architecture::Table_2_00(BinaryStream const& rBinStrm, OffsetType Offset
       {
         rInsn.Size()++;
         rInsn.SetOpcode(X86_Opcode_Ltr);
-        if (Operand__Mw(rBinStrm, Offset, rInsn, Mode) == false)
+        if (Operand__Mw<Mode>(rBinStrm, Offset, rInsn) == false)
         {
           return false;
         }
@@ -386,7 +387,7 @@ bool X86Architecture::Table_2_00(BinaryStream const& rBinStrm, OffsetType Offset
       {
         rInsn.Size()++;
         rInsn.SetOpcode(X86_Opcode_Verr);
-        if (Operand__Rv(rBinStrm, Offset, rInsn, Mode) == false)
+        if (Operand__Rv<Mode>(rBinStrm, Offset, rInsn) == false)
         {
           return false;
         }
@@ -396,7 +397,7 @@ bool X86Architecture::Table_2_00(BinaryStream const& rBinStrm, OffsetType Offset
       {
         rInsn.Size()++;
         rInsn.SetOpcode(X86_Opcode_Verr);
-        if (Operand__Mw(rBinStrm, Offset, rInsn, Mode) == false)
+        if (Operand__Mw<Mode>(rBinStrm, Offset, rInsn) == false)
         {
           return false;
         }
@@ -407,7 +408,7 @@ bool X86Architecture::Table_2_00(BinaryStream const& rBinStrm, OffsetType Offset
       {
         rInsn.Size()++;
         rInsn.SetOpcode(X86_Opcode_Verw);
-        if (Operand__Rv(rBinStrm, Offset, rInsn, Mode) == false)
+        if (Operand__Rv<Mode>(rBinStrm, Offset, rInsn) == false)
         {
           return false;
         }
@@ -417,7 +418,7 @@ bool X86Architecture::Table_2_00(BinaryStream const& rBinStrm, OffsetType Offset
       {
         rInsn.Size()++;
         rInsn.SetOpcode(X86_Opcode_Verw);
-        if (Operand__Mw(rBinStrm, Offset, rInsn, Mode) == false)
+        if (Operand__Mw<Mode>(rBinStrm, Offset, rInsn) == false)
         {
           return false;
         }
@@ -428,7 +429,7 @@ bool X86Architecture::Table_2_00(BinaryStream const& rBinStrm, OffsetType Offset
       {
         rInsn.Size()++;
         rInsn.SetOpcode(X86_Opcode_Jmpe);
-        if (Operand__Ev(rBinStrm, Offset, rInsn, Mode) == false)
+        if (Operand__Ev<Mode>(rBinStrm, Offset, rInsn) == false)
         {
           return false;
         }
@@ -469,7 +470,8 @@ bool X86Architecture::Table_2_00(BinaryStream const& rBinStrm, OffsetType Offset
  * sub_opcodes: [{'mnemonic': 'invlpg', 'operand': ['M']}, {'mnemonic': 'swapgs', 'suffix': 248}, {'mnemonic': 'rdtscp', 'suffix': 249}]
  *
 **/
-bool X86Architecture::Table_2_01(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_2_01(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     u8 ModRmByte;
     if (!rBinStrm.Read(Offset, ModRmByte))
@@ -512,7 +514,7 @@ bool X86Architecture::Table_2_01(BinaryStream const& rBinStrm, OffsetType Offset
         {
           rInsn.Size()++;
           rInsn.SetOpcode(X86_Opcode_Sgdt);
-          if (Operand__Mp(rBinStrm, Offset, rInsn, Mode) == false)
+          if (Operand__Mp<Mode>(rBinStrm, Offset, rInsn) == false)
           {
             return false;
           }
@@ -541,7 +543,7 @@ bool X86Architecture::Table_2_01(BinaryStream const& rBinStrm, OffsetType Offset
         {
           rInsn.Size()++;
           rInsn.SetOpcode(X86_Opcode_Sidt);
-          if (Operand__Mp(rBinStrm, Offset, rInsn, Mode) == false)
+          if (Operand__Mp<Mode>(rBinStrm, Offset, rInsn) == false)
           {
             return false;
           }
@@ -570,7 +572,7 @@ bool X86Architecture::Table_2_01(BinaryStream const& rBinStrm, OffsetType Offset
         {
           rInsn.Size()++;
           rInsn.SetOpcode(X86_Opcode_Lgdt);
-          if (Operand__Mp(rBinStrm, Offset, rInsn, Mode) == false)
+          if (Operand__Mp<Mode>(rBinStrm, Offset, rInsn) == false)
           {
             return false;
           }
@@ -635,7 +637,7 @@ bool X86Architecture::Table_2_01(BinaryStream const& rBinStrm, OffsetType Offset
         {
           rInsn.Size()++;
           rInsn.SetOpcode(X86_Opcode_Lidt);
-          if (Operand__Mp(rBinStrm, Offset, rInsn, Mode) == false)
+          if (Operand__Mp<Mode>(rBinStrm, Offset, rInsn) == false)
           {
             return false;
           }
@@ -647,7 +649,7 @@ bool X86Architecture::Table_2_01(BinaryStream const& rBinStrm, OffsetType Offset
       {
         rInsn.Size()++;
         rInsn.SetOpcode(X86_Opcode_Smsw);
-        if (Operand__Rv(rBinStrm, Offset, rInsn, Mode) == false)
+        if (Operand__Rv<Mode>(rBinStrm, Offset, rInsn) == false)
         {
           return false;
         }
@@ -657,7 +659,7 @@ bool X86Architecture::Table_2_01(BinaryStream const& rBinStrm, OffsetType Offset
       {
         rInsn.Size()++;
         rInsn.SetOpcode(X86_Opcode_Smsw);
-        if (Operand__Mw(rBinStrm, Offset, rInsn, Mode) == false)
+        if (Operand__Mw<Mode>(rBinStrm, Offset, rInsn) == false)
         {
           return false;
         }
@@ -670,7 +672,7 @@ bool X86Architecture::Table_2_01(BinaryStream const& rBinStrm, OffsetType Offset
       {
         rInsn.Size()++;
         rInsn.SetOpcode(X86_Opcode_Lmsw);
-        if (Operand__Rv(rBinStrm, Offset, rInsn, Mode) == false)
+        if (Operand__Rv<Mode>(rBinStrm, Offset, rInsn) == false)
         {
           return false;
         }
@@ -680,7 +682,7 @@ bool X86Architecture::Table_2_01(BinaryStream const& rBinStrm, OffsetType Offset
       {
         rInsn.Size()++;
         rInsn.SetOpcode(X86_Opcode_Lmsw);
-        if (Operand__Mw(rBinStrm, Offset, rInsn, Mode) == false)
+        if (Operand__Mw<Mode>(rBinStrm, Offset, rInsn) == false)
         {
           return false;
         }
@@ -708,7 +710,7 @@ bool X86Architecture::Table_2_01(BinaryStream const& rBinStrm, OffsetType Offset
         {
           rInsn.Size()++;
           rInsn.SetOpcode(X86_Opcode_Invlpg);
-          if (Operand__M(rBinStrm, Offset, rInsn, Mode) == false)
+          if (Operand__M<Mode>(rBinStrm, Offset, rInsn) == false)
           {
             return false;
           }
@@ -721,43 +723,12 @@ bool X86Architecture::Table_2_01(BinaryStream const& rBinStrm, OffsetType Offset
 }
 
 /** instruction
- * mnemonic: lar
- * operand: ['Gv', 'Ew']
- * opcode: 02
-**/
-bool X86Architecture::Table_2_02(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    rInsn.Size()++;
-    rInsn.SetOpcode(X86_Opcode_Lar);
-    if (Operand__Gv_Ew(rBinStrm, Offset, rInsn, Mode) == false)
-    {
-      return false;
-    }
-    return true;
-}
-
-/** instruction
- * mnemonic: lsl
- * operand: ['Gv', 'Ew']
- * opcode: 03
-**/
-bool X86Architecture::Table_2_03(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    rInsn.Size()++;
-    rInsn.SetOpcode(X86_Opcode_Lsl);
-    if (Operand__Gv_Ew(rBinStrm, Offset, rInsn, Mode) == false)
-    {
-      return false;
-    }
-    return true;
-}
-
-/** instruction
- * mnemonic: loadall
  * opcode: 04
+ * mnemonic: loadall
  * cpu_model: == X86_Arch_80286
 **/
-bool X86Architecture::Table_2_04(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_2_04(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") == X86_Arch_80286)
     {
@@ -776,11 +747,12 @@ bool X86Architecture::Table_2_04(BinaryStream const& rBinStrm, OffsetType Offset
  * cpu_model: == X86_Arch_80286
  *
  * mnemonic: syscall
- * semantic: 
  * cpu_model: >= X86_Arch_K6_2
+ * semantic: 
  *
 **/
-bool X86Architecture::Table_2_05(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_2_05(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_K6_2)
     {
@@ -797,17 +769,6 @@ bool X86Architecture::Table_2_05(BinaryStream const& rBinStrm, OffsetType Offset
     return false;
 }
 
-/** instruction
- * mnemonic: clts
- * opcode: 06
-**/
-bool X86Architecture::Table_2_06(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    rInsn.Size()++;
-    rInsn.SetOpcode(X86_Opcode_Clts);
-    return true;
-}
-
 /** instructions
  * opcode: 07
  *
@@ -815,11 +776,12 @@ bool X86Architecture::Table_2_06(BinaryStream const& rBinStrm, OffsetType Offset
  * cpu_model: == X86_Arch_80386
  *
  * mnemonic: sysret
- * semantic: 
  * cpu_model: >= X86_Arch_K6_2
+ * semantic: 
  *
 **/
-bool X86Architecture::Table_2_07(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_2_07(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_K6_2)
     {
@@ -837,11 +799,12 @@ bool X86Architecture::Table_2_07(BinaryStream const& rBinStrm, OffsetType Offset
 }
 
 /** instruction
- * mnemonic: invd
  * opcode: 08
+ * mnemonic: invd
  * cpu_model: >= X86_Arch_80486
 **/
-bool X86Architecture::Table_2_08(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_2_08(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_80486)
     {
@@ -854,11 +817,12 @@ bool X86Architecture::Table_2_08(BinaryStream const& rBinStrm, OffsetType Offset
 }
 
 /** instruction
- * mnemonic: wbindvd
  * opcode: 09
+ * mnemonic: wbindvd
  * cpu_model: >= X86_Arch_80486
 **/
-bool X86Architecture::Table_2_09(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_2_09(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_80486)
     {
@@ -871,20 +835,12 @@ bool X86Architecture::Table_2_09(BinaryStream const& rBinStrm, OffsetType Offset
 }
 
 /** instruction
- * opcode: 0a
- * invalid
-**/
-bool X86Architecture::Table_2_0a(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * mnemonic: ud1
  * opcode: 0b
+ * mnemonic: ud1
  * cpu_model: >= X86_Arch_80286
 **/
-bool X86Architecture::Table_2_0b(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_2_0b(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_80286)
     {
@@ -896,36 +852,28 @@ bool X86Architecture::Table_2_0b(BinaryStream const& rBinStrm, OffsetType Offset
       return false;
 }
 
-/** instruction
- * opcode: 0c
- * invalid
-**/
-bool X86Architecture::Table_2_0c(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
 /** instructions
  * opcode: 0d
  *
  * invalid
  *
  * mnemonic: nop
+ * operand: ['M']
+ * cpu_model: >= X86_Arch_Pentium_pro
  * semantic: program.id = program.id;
 
- * attr: ['amd']
  * reference: group_3DNOW1
- * operand: ['M']
- * cpu_model: >= X86_Arch_Pentium_pro
+ * attr: ['amd']
  *
 **/
-bool X86Architecture::Table_2_0d(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_2_0d(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_Pentium_pro && m_CfgMdl.GetEnum("Vendor") == X86_ProcType_AMD)
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Nop);
-      if (Operand__M(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__M<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -954,7 +902,8 @@ bool X86Architecture::Table_2_0d(BinaryStream const& rBinStrm, OffsetType Offset
  * attr: ['amd']
  *
 **/
-bool X86Architecture::Table_2_0e(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_2_0e(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Vendor") == X86_ProcType_AMD)
     {
@@ -976,7 +925,8 @@ bool X86Architecture::Table_2_0e(BinaryStream const& rBinStrm, OffsetType Offset
  * cpu_model: >= X86_Arch_K6_2
  *
 **/
-bool X86Architecture::Table_2_0f(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_2_0f(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_K6_2)
     {
@@ -994,9 +944,9 @@ bool X86Architecture::Table_2_0f(BinaryStream const& rBinStrm, OffsetType Offset
  *
  * mnemonic: movups
  * operand: ['Vx', 'Wx']
+ * cpu_model: >= X86_Arch_Sse
  * semantic: op0.val = op1.val;
 
- * cpu_model: >= X86_Arch_Sse
  *
  * mnemonic: movupd
  * operand: ['Vx', 'Wx']
@@ -1006,6 +956,7 @@ bool X86Architecture::Table_2_0f(BinaryStream const& rBinStrm, OffsetType Offset
  * mnemonic: movss
  * operand: ['Vo', 'Wod']
  * prefix: f3
+ * cpu_model: >= X86_Arch_Sse
  * semantic: alloc_var('tmp_val', op0.bit);
 if __code and is_id_and_mem(op0, op1):
   op0.val = bit_cast(op1.val, int_type128);
@@ -1021,11 +972,11 @@ if __code and is_id_and_id(op0, op1):
   op0.val = tmp_val;
 free_var('tmp_val');
 
- * cpu_model: >= X86_Arch_Sse
  *
  * mnemonic: movsd
  * operand: ['Vo', 'Woq']
  * prefix: f2
+ * cpu_model: >= X86_Arch_Sse2
  * semantic: alloc_var('tmp_val', op0.bit);
 if __code and is_id_and_mem(op0, op1):
   op0.val = bit_cast(op1.val, int_type128);
@@ -1038,16 +989,16 @@ if __code and is_id_and_id(op0, op1):
   op0.val = tmp_val;
 free_var('tmp_val');
 
- * cpu_model: >= X86_Arch_Sse2
  *
 **/
-bool X86Architecture::Table_2_10(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_2_10(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_Sse2 && (rInsn.GetPrefix() & X86_Prefix_RepNz) == X86_Prefix_RepNz)
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Movsd);
-      if (Operand__Vo_Woq(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vo_Woq<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -1114,7 +1065,7 @@ bool X86Architecture::Table_2_10(BinaryStream const& rBinStrm, OffsetType Offset
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Movss);
-      if (Operand__Vo_Wod(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vo_Wod<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -1203,7 +1154,7 @@ bool X86Architecture::Table_2_10(BinaryStream const& rBinStrm, OffsetType Offset
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Movupd);
-      if (Operand__Vx_Wx(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vx_Wx<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -1213,7 +1164,7 @@ bool X86Architecture::Table_2_10(BinaryStream const& rBinStrm, OffsetType Offset
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Movups);
-      if (Operand__Vx_Wx(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vx_Wx<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -1231,7 +1182,7 @@ bool X86Architecture::Table_2_10(BinaryStream const& rBinStrm, OffsetType Offset
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Umov);
-      if (Operand__Eb_Gb(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Eb_Gb<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -1249,9 +1200,9 @@ bool X86Architecture::Table_2_10(BinaryStream const& rBinStrm, OffsetType Offset
  *
  * mnemonic: movups
  * operand: ['Wx', 'Vx']
+ * cpu_model: >= X86_Arch_Sse
  * semantic: op0.val = op1.val;
 
- * cpu_model: >= X86_Arch_Sse
  *
  * mnemonic: movupd
  * operand: ['Wx', 'Vx']
@@ -1261,6 +1212,7 @@ bool X86Architecture::Table_2_10(BinaryStream const& rBinStrm, OffsetType Offset
  * mnemonic: movss
  * operand: ['Wod', 'Vo']
  * prefix: f3
+ * cpu_model: >= X86_Arch_Sse
  * semantic: alloc_var('tmp_val', op0.bit);
 if __code and is_id_and_mem(op0, op1):
   op0.val = bit_cast(op1.val, int_type128);
@@ -1276,11 +1228,11 @@ if __code and is_id_and_id(op0, op1):
   op0.val = tmp_val;
 free_var('tmp_val');
 
- * cpu_model: >= X86_Arch_Sse
  *
  * mnemonic: movsd
  * operand: ['Woq', 'Vo']
  * prefix: f2
+ * cpu_model: >= X86_Arch_Sse2
  * semantic: alloc_var('tmp_val', op0.bit);
 if __code and is_id_and_mem(op0, op1):
   op0.val = bit_cast(op1.val, int_type128);
@@ -1293,16 +1245,16 @@ if __code and is_id_and_id(op0, op1):
   op0.val = tmp_val;
 free_var('tmp_val');
 
- * cpu_model: >= X86_Arch_Sse2
  *
 **/
-bool X86Architecture::Table_2_11(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_2_11(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_Sse2 && (rInsn.GetPrefix() & X86_Prefix_RepNz) == X86_Prefix_RepNz)
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Movsd);
-      if (Operand__Woq_Vo(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Woq_Vo<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -1369,7 +1321,7 @@ bool X86Architecture::Table_2_11(BinaryStream const& rBinStrm, OffsetType Offset
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Movss);
-      if (Operand__Wod_Vo(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Wod_Vo<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -1458,7 +1410,7 @@ bool X86Architecture::Table_2_11(BinaryStream const& rBinStrm, OffsetType Offset
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Movupd);
-      if (Operand__Wx_Vx(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Wx_Vx<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -1468,7 +1420,7 @@ bool X86Architecture::Table_2_11(BinaryStream const& rBinStrm, OffsetType Offset
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Movups);
-      if (Operand__Wx_Vx(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Wx_Vx<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -1486,7 +1438,7 @@ bool X86Architecture::Table_2_11(BinaryStream const& rBinStrm, OffsetType Offset
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Umov);
-      if (Operand__Ev_Gv(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Ev_Gv<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -1522,13 +1474,14 @@ bool X86Architecture::Table_2_11(BinaryStream const& rBinStrm, OffsetType Offset
  * cpu_model: >= X86_Arch_Sse3
  *
 **/
-bool X86Architecture::Table_2_12(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_2_12(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_Sse3 && (rInsn.GetPrefix() & X86_Prefix_RepNz) == X86_Prefix_RepNz)
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Movddup);
-      if (Operand__Vo_Woq(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vo_Woq<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -1538,7 +1491,7 @@ bool X86Architecture::Table_2_12(BinaryStream const& rBinStrm, OffsetType Offset
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Movsldup);
-      if (Operand__Vx_Wx(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vx_Wx<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -1548,7 +1501,7 @@ bool X86Architecture::Table_2_12(BinaryStream const& rBinStrm, OffsetType Offset
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Movlpd);
-      if (Operand__Vo_Woq(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vo_Woq<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -1558,7 +1511,7 @@ bool X86Architecture::Table_2_12(BinaryStream const& rBinStrm, OffsetType Offset
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Movlps);
-      if (Operand__Vo_Woq(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vo_Woq<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -1568,7 +1521,7 @@ bool X86Architecture::Table_2_12(BinaryStream const& rBinStrm, OffsetType Offset
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Umov);
-      if (Operand__Gb_Ev(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Gb_Ev<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -1593,13 +1546,14 @@ bool X86Architecture::Table_2_12(BinaryStream const& rBinStrm, OffsetType Offset
  * cpu_model: >= X86_Arch_Sse2
  *
 **/
-bool X86Architecture::Table_2_13(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_2_13(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_Sse2)
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Movlpd);
-      if (Operand__Woq_Vo(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Woq_Vo<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -1609,7 +1563,7 @@ bool X86Architecture::Table_2_13(BinaryStream const& rBinStrm, OffsetType Offset
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Movlps);
-      if (Operand__Woq_Vo(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Woq_Vo<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -1619,7 +1573,7 @@ bool X86Architecture::Table_2_13(BinaryStream const& rBinStrm, OffsetType Offset
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Umov);
-      if (Operand__Gv_Ev(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Gv_Ev<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -1643,13 +1597,14 @@ bool X86Architecture::Table_2_13(BinaryStream const& rBinStrm, OffsetType Offset
  * cpu_model: >= X86_Arch_Sse2
  *
 **/
-bool X86Architecture::Table_2_14(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_2_14(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_Sse2 && (rInsn.GetPrefix() & X86_Prefix_OpSize) == X86_Prefix_OpSize)
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Unpcklpd);
-      if (Operand__Vx_Wx(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vx_Wx<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -1659,7 +1614,7 @@ bool X86Architecture::Table_2_14(BinaryStream const& rBinStrm, OffsetType Offset
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Unpcklps);
-      if (Operand__Vx_Wx(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vx_Wx<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -1686,13 +1641,14 @@ bool X86Architecture::Table_2_14(BinaryStream const& rBinStrm, OffsetType Offset
  * cpu_model: >= X86_Arch_Sse2
  *
 **/
-bool X86Architecture::Table_2_15(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_2_15(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_Sse2 && (rInsn.GetPrefix() & X86_Prefix_OpSize) == X86_Prefix_OpSize)
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Unpckhpd);
-      if (Operand__Vx_Wx(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vx_Wx<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -1702,7 +1658,7 @@ bool X86Architecture::Table_2_15(BinaryStream const& rBinStrm, OffsetType Offset
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Unpckhps);
-      if (Operand__Vx_Wx(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vx_Wx<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -1734,13 +1690,14 @@ bool X86Architecture::Table_2_15(BinaryStream const& rBinStrm, OffsetType Offset
  * cpu_model: >= X86_Arch_Sse3
  *
 **/
-bool X86Architecture::Table_2_16(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_2_16(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_Sse3 && (rInsn.GetPrefix() & X86_Prefix_Rep) == X86_Prefix_Rep)
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Movshdup);
-      if (Operand__Vx_Wx(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vx_Wx<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -1750,7 +1707,7 @@ bool X86Architecture::Table_2_16(BinaryStream const& rBinStrm, OffsetType Offset
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Movhpd);
-      if (Operand__Vo_Woq(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vo_Woq<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -1760,7 +1717,7 @@ bool X86Architecture::Table_2_16(BinaryStream const& rBinStrm, OffsetType Offset
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Movhps);
-      if (Operand__Vo_Woq(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vo_Woq<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -1787,13 +1744,14 @@ bool X86Architecture::Table_2_16(BinaryStream const& rBinStrm, OffsetType Offset
  * cpu_model: >= X86_Arch_Sse2
  *
 **/
-bool X86Architecture::Table_2_17(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_2_17(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_Sse2 && (rInsn.GetPrefix() & X86_Prefix_OpSize) == X86_Prefix_OpSize)
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Movhpd);
-      if (Operand__Woq_Vo(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Woq_Vo<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -1803,7 +1761,7 @@ bool X86Architecture::Table_2_17(BinaryStream const& rBinStrm, OffsetType Offset
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Movhps);
-      if (Operand__Woq_Vo(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Woq_Vo<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -1816,56 +1774,57 @@ bool X86Architecture::Table_2_17(BinaryStream const& rBinStrm, OffsetType Offset
 }
 
 /** group:
+ * opcode: 00
  * mnemonic: hint_nop
  * operand: ['Ev']
- * opcode: 00
  * semantic: program.id = program.id;
 
  *
+ * opcode: 01
  * mnemonic: hint_nop
  * operand: ['Ev']
- * opcode: 01
  * semantic: program.id = program.id;
 
  *
+ * opcode: 02
  * mnemonic: hint_nop
  * operand: ['Ev']
- * opcode: 02
  * semantic: program.id = program.id;
 
  *
+ * opcode: 03
  * mnemonic: hint_nop
  * operand: ['Ev']
- * opcode: 03
  * semantic: program.id = program.id;
 
  *
+ * opcode: 04
  * mnemonic: hint_nop
  * operand: ['Ev']
- * opcode: 04
  * semantic: program.id = program.id;
 
  *
+ * opcode: 05
  * mnemonic: hint_nop
  * operand: ['Ev']
- * opcode: 05
  * semantic: program.id = program.id;
 
  *
+ * opcode: 06
  * mnemonic: hint_nop
  * operand: ['Ev']
- * opcode: 06
  * semantic: program.id = program.id;
 
  *
+ * opcode: 07
  * mnemonic: hint_nop
  * operand: ['Ev']
- * opcode: 07
  * semantic: program.id = program.id;
 
  *
 **/
-bool X86Architecture::Table_2_18(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_2_18(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     u8 ModRmByte;
     if (!rBinStrm.Read(Offset, ModRmByte))
@@ -1877,7 +1836,7 @@ bool X86Architecture::Table_2_18(BinaryStream const& rBinStrm, OffsetType Offset
     case 0x0:
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Hint_nop);
-      if (Operand__Ev(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Ev<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -1893,7 +1852,7 @@ bool X86Architecture::Table_2_18(BinaryStream const& rBinStrm, OffsetType Offset
     case 0x1:
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Hint_nop);
-      if (Operand__Ev(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Ev<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -1909,7 +1868,7 @@ bool X86Architecture::Table_2_18(BinaryStream const& rBinStrm, OffsetType Offset
     case 0x2:
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Hint_nop);
-      if (Operand__Ev(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Ev<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -1925,7 +1884,7 @@ bool X86Architecture::Table_2_18(BinaryStream const& rBinStrm, OffsetType Offset
     case 0x3:
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Hint_nop);
-      if (Operand__Ev(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Ev<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -1941,7 +1900,7 @@ bool X86Architecture::Table_2_18(BinaryStream const& rBinStrm, OffsetType Offset
     case 0x4:
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Hint_nop);
-      if (Operand__Ev(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Ev<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -1957,7 +1916,7 @@ bool X86Architecture::Table_2_18(BinaryStream const& rBinStrm, OffsetType Offset
     case 0x5:
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Hint_nop);
-      if (Operand__Ev(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Ev<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -1973,7 +1932,7 @@ bool X86Architecture::Table_2_18(BinaryStream const& rBinStrm, OffsetType Offset
     case 0x6:
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Hint_nop);
-      if (Operand__Ev(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Ev<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -1989,7 +1948,7 @@ bool X86Architecture::Table_2_18(BinaryStream const& rBinStrm, OffsetType Offset
     case 0x7:
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Hint_nop);
-      if (Operand__Ev(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Ev<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -2008,56 +1967,57 @@ bool X86Architecture::Table_2_18(BinaryStream const& rBinStrm, OffsetType Offset
 }
 
 /** group:
+ * opcode: 00
  * mnemonic: hint_nop
  * operand: ['Ev']
- * opcode: 00
  * semantic: program.id = program.id;
 
  *
+ * opcode: 01
  * mnemonic: hint_nop
  * operand: ['Ev']
- * opcode: 01
  * semantic: program.id = program.id;
 
  *
+ * opcode: 02
  * mnemonic: hint_nop
  * operand: ['Ev']
- * opcode: 02
  * semantic: program.id = program.id;
 
  *
+ * opcode: 03
  * mnemonic: hint_nop
  * operand: ['Ev']
- * opcode: 03
  * semantic: program.id = program.id;
 
  *
+ * opcode: 04
  * mnemonic: hint_nop
  * operand: ['Ev']
- * opcode: 04
  * semantic: program.id = program.id;
 
  *
+ * opcode: 05
  * mnemonic: hint_nop
  * operand: ['Ev']
- * opcode: 05
  * semantic: program.id = program.id;
 
  *
+ * opcode: 06
  * mnemonic: hint_nop
  * operand: ['Ev']
- * opcode: 06
  * semantic: program.id = program.id;
 
  *
+ * opcode: 07
  * mnemonic: hint_nop
  * operand: ['Ev']
- * opcode: 07
  * semantic: program.id = program.id;
 
  *
 **/
-bool X86Architecture::Table_2_19(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_2_19(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     u8 ModRmByte;
     if (!rBinStrm.Read(Offset, ModRmByte))
@@ -2069,7 +2029,7 @@ bool X86Architecture::Table_2_19(BinaryStream const& rBinStrm, OffsetType Offset
     case 0x0:
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Hint_nop);
-      if (Operand__Ev(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Ev<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -2085,7 +2045,7 @@ bool X86Architecture::Table_2_19(BinaryStream const& rBinStrm, OffsetType Offset
     case 0x1:
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Hint_nop);
-      if (Operand__Ev(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Ev<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -2101,7 +2061,7 @@ bool X86Architecture::Table_2_19(BinaryStream const& rBinStrm, OffsetType Offset
     case 0x2:
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Hint_nop);
-      if (Operand__Ev(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Ev<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -2117,7 +2077,7 @@ bool X86Architecture::Table_2_19(BinaryStream const& rBinStrm, OffsetType Offset
     case 0x3:
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Hint_nop);
-      if (Operand__Ev(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Ev<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -2133,7 +2093,7 @@ bool X86Architecture::Table_2_19(BinaryStream const& rBinStrm, OffsetType Offset
     case 0x4:
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Hint_nop);
-      if (Operand__Ev(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Ev<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -2149,7 +2109,7 @@ bool X86Architecture::Table_2_19(BinaryStream const& rBinStrm, OffsetType Offset
     case 0x5:
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Hint_nop);
-      if (Operand__Ev(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Ev<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -2165,7 +2125,7 @@ bool X86Architecture::Table_2_19(BinaryStream const& rBinStrm, OffsetType Offset
     case 0x6:
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Hint_nop);
-      if (Operand__Ev(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Ev<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -2181,7 +2141,7 @@ bool X86Architecture::Table_2_19(BinaryStream const& rBinStrm, OffsetType Offset
     case 0x7:
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Hint_nop);
-      if (Operand__Ev(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Ev<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -2200,56 +2160,57 @@ bool X86Architecture::Table_2_19(BinaryStream const& rBinStrm, OffsetType Offset
 }
 
 /** group:
+ * opcode: 00
  * mnemonic: hint_nop
  * operand: ['Ev']
- * opcode: 00
  * semantic: program.id = program.id;
 
  *
+ * opcode: 01
  * mnemonic: hint_nop
  * operand: ['Ev']
- * opcode: 01
  * semantic: program.id = program.id;
 
  *
+ * opcode: 02
  * mnemonic: hint_nop
  * operand: ['Ev']
- * opcode: 02
  * semantic: program.id = program.id;
 
  *
+ * opcode: 03
  * mnemonic: hint_nop
  * operand: ['Ev']
- * opcode: 03
  * semantic: program.id = program.id;
 
  *
+ * opcode: 04
  * mnemonic: hint_nop
  * operand: ['Ev']
- * opcode: 04
  * semantic: program.id = program.id;
 
  *
+ * opcode: 05
  * mnemonic: hint_nop
  * operand: ['Ev']
- * opcode: 05
  * semantic: program.id = program.id;
 
  *
+ * opcode: 06
  * mnemonic: hint_nop
  * operand: ['Ev']
- * opcode: 06
  * semantic: program.id = program.id;
 
  *
+ * opcode: 07
  * mnemonic: hint_nop
  * operand: ['Ev']
- * opcode: 07
  * semantic: program.id = program.id;
 
  *
 **/
-bool X86Architecture::Table_2_1a(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_2_1a(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     u8 ModRmByte;
     if (!rBinStrm.Read(Offset, ModRmByte))
@@ -2261,7 +2222,7 @@ bool X86Architecture::Table_2_1a(BinaryStream const& rBinStrm, OffsetType Offset
     case 0x0:
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Hint_nop);
-      if (Operand__Ev(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Ev<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -2277,7 +2238,7 @@ bool X86Architecture::Table_2_1a(BinaryStream const& rBinStrm, OffsetType Offset
     case 0x1:
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Hint_nop);
-      if (Operand__Ev(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Ev<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -2293,7 +2254,7 @@ bool X86Architecture::Table_2_1a(BinaryStream const& rBinStrm, OffsetType Offset
     case 0x2:
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Hint_nop);
-      if (Operand__Ev(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Ev<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -2309,7 +2270,7 @@ bool X86Architecture::Table_2_1a(BinaryStream const& rBinStrm, OffsetType Offset
     case 0x3:
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Hint_nop);
-      if (Operand__Ev(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Ev<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -2325,7 +2286,7 @@ bool X86Architecture::Table_2_1a(BinaryStream const& rBinStrm, OffsetType Offset
     case 0x4:
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Hint_nop);
-      if (Operand__Ev(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Ev<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -2341,7 +2302,7 @@ bool X86Architecture::Table_2_1a(BinaryStream const& rBinStrm, OffsetType Offset
     case 0x5:
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Hint_nop);
-      if (Operand__Ev(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Ev<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -2357,7 +2318,7 @@ bool X86Architecture::Table_2_1a(BinaryStream const& rBinStrm, OffsetType Offset
     case 0x6:
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Hint_nop);
-      if (Operand__Ev(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Ev<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -2373,7 +2334,7 @@ bool X86Architecture::Table_2_1a(BinaryStream const& rBinStrm, OffsetType Offset
     case 0x7:
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Hint_nop);
-      if (Operand__Ev(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Ev<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -2392,56 +2353,57 @@ bool X86Architecture::Table_2_1a(BinaryStream const& rBinStrm, OffsetType Offset
 }
 
 /** group:
+ * opcode: 00
  * mnemonic: hint_nop
  * operand: ['Ev']
- * opcode: 00
  * semantic: program.id = program.id;
 
  *
+ * opcode: 01
  * mnemonic: hint_nop
  * operand: ['Ev']
- * opcode: 01
  * semantic: program.id = program.id;
 
  *
+ * opcode: 02
  * mnemonic: hint_nop
  * operand: ['Ev']
- * opcode: 02
  * semantic: program.id = program.id;
 
  *
+ * opcode: 03
  * mnemonic: hint_nop
  * operand: ['Ev']
- * opcode: 03
  * semantic: program.id = program.id;
 
  *
+ * opcode: 04
  * mnemonic: hint_nop
  * operand: ['Ev']
- * opcode: 04
  * semantic: program.id = program.id;
 
  *
+ * opcode: 05
  * mnemonic: hint_nop
  * operand: ['Ev']
- * opcode: 05
  * semantic: program.id = program.id;
 
  *
+ * opcode: 06
  * mnemonic: hint_nop
  * operand: ['Ev']
- * opcode: 06
  * semantic: program.id = program.id;
 
  *
+ * opcode: 07
  * mnemonic: hint_nop
  * operand: ['Ev']
- * opcode: 07
  * semantic: program.id = program.id;
 
  *
 **/
-bool X86Architecture::Table_2_1b(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_2_1b(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     u8 ModRmByte;
     if (!rBinStrm.Read(Offset, ModRmByte))
@@ -2453,7 +2415,7 @@ bool X86Architecture::Table_2_1b(BinaryStream const& rBinStrm, OffsetType Offset
     case 0x0:
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Hint_nop);
-      if (Operand__Ev(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Ev<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -2469,7 +2431,7 @@ bool X86Architecture::Table_2_1b(BinaryStream const& rBinStrm, OffsetType Offset
     case 0x1:
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Hint_nop);
-      if (Operand__Ev(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Ev<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -2485,7 +2447,7 @@ bool X86Architecture::Table_2_1b(BinaryStream const& rBinStrm, OffsetType Offset
     case 0x2:
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Hint_nop);
-      if (Operand__Ev(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Ev<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -2501,7 +2463,7 @@ bool X86Architecture::Table_2_1b(BinaryStream const& rBinStrm, OffsetType Offset
     case 0x3:
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Hint_nop);
-      if (Operand__Ev(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Ev<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -2517,7 +2479,7 @@ bool X86Architecture::Table_2_1b(BinaryStream const& rBinStrm, OffsetType Offset
     case 0x4:
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Hint_nop);
-      if (Operand__Ev(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Ev<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -2533,7 +2495,7 @@ bool X86Architecture::Table_2_1b(BinaryStream const& rBinStrm, OffsetType Offset
     case 0x5:
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Hint_nop);
-      if (Operand__Ev(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Ev<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -2549,7 +2511,7 @@ bool X86Architecture::Table_2_1b(BinaryStream const& rBinStrm, OffsetType Offset
     case 0x6:
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Hint_nop);
-      if (Operand__Ev(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Ev<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -2565,7 +2527,7 @@ bool X86Architecture::Table_2_1b(BinaryStream const& rBinStrm, OffsetType Offset
     case 0x7:
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Hint_nop);
-      if (Operand__Ev(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Ev<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -2584,56 +2546,57 @@ bool X86Architecture::Table_2_1b(BinaryStream const& rBinStrm, OffsetType Offset
 }
 
 /** group:
+ * opcode: 00
  * mnemonic: hint_nop
  * operand: ['Ev']
- * opcode: 00
  * semantic: program.id = program.id;
 
  *
+ * opcode: 01
  * mnemonic: hint_nop
  * operand: ['Ev']
- * opcode: 01
  * semantic: program.id = program.id;
 
  *
+ * opcode: 02
  * mnemonic: hint_nop
  * operand: ['Ev']
- * opcode: 02
  * semantic: program.id = program.id;
 
  *
+ * opcode: 03
  * mnemonic: hint_nop
  * operand: ['Ev']
- * opcode: 03
  * semantic: program.id = program.id;
 
  *
+ * opcode: 04
  * mnemonic: hint_nop
  * operand: ['Ev']
- * opcode: 04
  * semantic: program.id = program.id;
 
  *
+ * opcode: 05
  * mnemonic: hint_nop
  * operand: ['Ev']
- * opcode: 05
  * semantic: program.id = program.id;
 
  *
+ * opcode: 06
  * mnemonic: hint_nop
  * operand: ['Ev']
- * opcode: 06
  * semantic: program.id = program.id;
 
  *
+ * opcode: 07
  * mnemonic: hint_nop
  * operand: ['Ev']
- * opcode: 07
  * semantic: program.id = program.id;
 
  *
 **/
-bool X86Architecture::Table_2_1c(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_2_1c(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     u8 ModRmByte;
     if (!rBinStrm.Read(Offset, ModRmByte))
@@ -2645,7 +2608,7 @@ bool X86Architecture::Table_2_1c(BinaryStream const& rBinStrm, OffsetType Offset
     case 0x0:
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Hint_nop);
-      if (Operand__Ev(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Ev<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -2661,7 +2624,7 @@ bool X86Architecture::Table_2_1c(BinaryStream const& rBinStrm, OffsetType Offset
     case 0x1:
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Hint_nop);
-      if (Operand__Ev(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Ev<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -2677,7 +2640,7 @@ bool X86Architecture::Table_2_1c(BinaryStream const& rBinStrm, OffsetType Offset
     case 0x2:
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Hint_nop);
-      if (Operand__Ev(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Ev<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -2693,7 +2656,7 @@ bool X86Architecture::Table_2_1c(BinaryStream const& rBinStrm, OffsetType Offset
     case 0x3:
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Hint_nop);
-      if (Operand__Ev(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Ev<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -2709,7 +2672,7 @@ bool X86Architecture::Table_2_1c(BinaryStream const& rBinStrm, OffsetType Offset
     case 0x4:
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Hint_nop);
-      if (Operand__Ev(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Ev<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -2725,7 +2688,7 @@ bool X86Architecture::Table_2_1c(BinaryStream const& rBinStrm, OffsetType Offset
     case 0x5:
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Hint_nop);
-      if (Operand__Ev(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Ev<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -2741,7 +2704,7 @@ bool X86Architecture::Table_2_1c(BinaryStream const& rBinStrm, OffsetType Offset
     case 0x6:
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Hint_nop);
-      if (Operand__Ev(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Ev<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -2757,7 +2720,7 @@ bool X86Architecture::Table_2_1c(BinaryStream const& rBinStrm, OffsetType Offset
     case 0x7:
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Hint_nop);
-      if (Operand__Ev(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Ev<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -2776,56 +2739,57 @@ bool X86Architecture::Table_2_1c(BinaryStream const& rBinStrm, OffsetType Offset
 }
 
 /** group:
+ * opcode: 00
  * mnemonic: hint_nop
  * operand: ['Ev']
- * opcode: 00
  * semantic: program.id = program.id;
 
  *
+ * opcode: 01
  * mnemonic: hint_nop
  * operand: ['Ev']
- * opcode: 01
  * semantic: program.id = program.id;
 
  *
+ * opcode: 02
  * mnemonic: hint_nop
  * operand: ['Ev']
- * opcode: 02
  * semantic: program.id = program.id;
 
  *
+ * opcode: 03
  * mnemonic: hint_nop
  * operand: ['Ev']
- * opcode: 03
  * semantic: program.id = program.id;
 
  *
+ * opcode: 04
  * mnemonic: hint_nop
  * operand: ['Ev']
- * opcode: 04
  * semantic: program.id = program.id;
 
  *
+ * opcode: 05
  * mnemonic: hint_nop
  * operand: ['Ev']
- * opcode: 05
  * semantic: program.id = program.id;
 
  *
+ * opcode: 06
  * mnemonic: hint_nop
  * operand: ['Ev']
- * opcode: 06
  * semantic: program.id = program.id;
 
  *
+ * opcode: 07
  * mnemonic: hint_nop
  * operand: ['Ev']
- * opcode: 07
  * semantic: program.id = program.id;
 
  *
 **/
-bool X86Architecture::Table_2_1d(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_2_1d(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     u8 ModRmByte;
     if (!rBinStrm.Read(Offset, ModRmByte))
@@ -2837,7 +2801,7 @@ bool X86Architecture::Table_2_1d(BinaryStream const& rBinStrm, OffsetType Offset
     case 0x0:
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Hint_nop);
-      if (Operand__Ev(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Ev<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -2853,7 +2817,7 @@ bool X86Architecture::Table_2_1d(BinaryStream const& rBinStrm, OffsetType Offset
     case 0x1:
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Hint_nop);
-      if (Operand__Ev(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Ev<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -2869,7 +2833,7 @@ bool X86Architecture::Table_2_1d(BinaryStream const& rBinStrm, OffsetType Offset
     case 0x2:
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Hint_nop);
-      if (Operand__Ev(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Ev<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -2885,7 +2849,7 @@ bool X86Architecture::Table_2_1d(BinaryStream const& rBinStrm, OffsetType Offset
     case 0x3:
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Hint_nop);
-      if (Operand__Ev(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Ev<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -2901,7 +2865,7 @@ bool X86Architecture::Table_2_1d(BinaryStream const& rBinStrm, OffsetType Offset
     case 0x4:
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Hint_nop);
-      if (Operand__Ev(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Ev<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -2917,7 +2881,7 @@ bool X86Architecture::Table_2_1d(BinaryStream const& rBinStrm, OffsetType Offset
     case 0x5:
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Hint_nop);
-      if (Operand__Ev(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Ev<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -2933,7 +2897,7 @@ bool X86Architecture::Table_2_1d(BinaryStream const& rBinStrm, OffsetType Offset
     case 0x6:
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Hint_nop);
-      if (Operand__Ev(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Ev<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -2949,7 +2913,7 @@ bool X86Architecture::Table_2_1d(BinaryStream const& rBinStrm, OffsetType Offset
     case 0x7:
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Hint_nop);
-      if (Operand__Ev(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Ev<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -2968,56 +2932,57 @@ bool X86Architecture::Table_2_1d(BinaryStream const& rBinStrm, OffsetType Offset
 }
 
 /** group:
+ * opcode: 00
  * mnemonic: hint_nop
  * operand: ['Ev']
- * opcode: 00
  * semantic: program.id = program.id;
 
  *
+ * opcode: 01
  * mnemonic: hint_nop
  * operand: ['Ev']
- * opcode: 01
  * semantic: program.id = program.id;
 
  *
+ * opcode: 02
  * mnemonic: hint_nop
  * operand: ['Ev']
- * opcode: 02
  * semantic: program.id = program.id;
 
  *
+ * opcode: 03
  * mnemonic: hint_nop
  * operand: ['Ev']
- * opcode: 03
  * semantic: program.id = program.id;
 
  *
+ * opcode: 04
  * mnemonic: hint_nop
  * operand: ['Ev']
- * opcode: 04
  * semantic: program.id = program.id;
 
  *
+ * opcode: 05
  * mnemonic: hint_nop
  * operand: ['Ev']
- * opcode: 05
  * semantic: program.id = program.id;
 
  *
+ * opcode: 06
  * mnemonic: hint_nop
  * operand: ['Ev']
- * opcode: 06
  * semantic: program.id = program.id;
 
  *
+ * opcode: 07
  * mnemonic: hint_nop
  * operand: ['Ev']
- * opcode: 07
  * semantic: program.id = program.id;
 
  *
 **/
-bool X86Architecture::Table_2_1e(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_2_1e(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     u8 ModRmByte;
     if (!rBinStrm.Read(Offset, ModRmByte))
@@ -3029,7 +2994,7 @@ bool X86Architecture::Table_2_1e(BinaryStream const& rBinStrm, OffsetType Offset
     case 0x0:
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Hint_nop);
-      if (Operand__Ev(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Ev<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -3045,7 +3010,7 @@ bool X86Architecture::Table_2_1e(BinaryStream const& rBinStrm, OffsetType Offset
     case 0x1:
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Hint_nop);
-      if (Operand__Ev(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Ev<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -3061,7 +3026,7 @@ bool X86Architecture::Table_2_1e(BinaryStream const& rBinStrm, OffsetType Offset
     case 0x2:
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Hint_nop);
-      if (Operand__Ev(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Ev<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -3077,7 +3042,7 @@ bool X86Architecture::Table_2_1e(BinaryStream const& rBinStrm, OffsetType Offset
     case 0x3:
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Hint_nop);
-      if (Operand__Ev(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Ev<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -3093,7 +3058,7 @@ bool X86Architecture::Table_2_1e(BinaryStream const& rBinStrm, OffsetType Offset
     case 0x4:
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Hint_nop);
-      if (Operand__Ev(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Ev<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -3109,7 +3074,7 @@ bool X86Architecture::Table_2_1e(BinaryStream const& rBinStrm, OffsetType Offset
     case 0x5:
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Hint_nop);
-      if (Operand__Ev(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Ev<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -3125,7 +3090,7 @@ bool X86Architecture::Table_2_1e(BinaryStream const& rBinStrm, OffsetType Offset
     case 0x6:
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Hint_nop);
-      if (Operand__Ev(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Ev<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -3141,7 +3106,7 @@ bool X86Architecture::Table_2_1e(BinaryStream const& rBinStrm, OffsetType Offset
     case 0x7:
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Hint_nop);
-      if (Operand__Ev(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Ev<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -3160,56 +3125,57 @@ bool X86Architecture::Table_2_1e(BinaryStream const& rBinStrm, OffsetType Offset
 }
 
 /** group:
+ * opcode: 00
  * mnemonic: hint_nop
  * operand: ['Ev']
- * opcode: 00
  * semantic: program.id = program.id;
 
  *
+ * opcode: 01
  * mnemonic: hint_nop
  * operand: ['Ev']
- * opcode: 01
  * semantic: program.id = program.id;
 
  *
+ * opcode: 02
  * mnemonic: hint_nop
  * operand: ['Ev']
- * opcode: 02
  * semantic: program.id = program.id;
 
  *
+ * opcode: 03
  * mnemonic: hint_nop
  * operand: ['Ev']
- * opcode: 03
  * semantic: program.id = program.id;
 
  *
+ * opcode: 04
  * mnemonic: hint_nop
  * operand: ['Ev']
- * opcode: 04
  * semantic: program.id = program.id;
 
  *
+ * opcode: 05
  * mnemonic: hint_nop
  * operand: ['Ev']
- * opcode: 05
  * semantic: program.id = program.id;
 
  *
+ * opcode: 06
  * mnemonic: hint_nop
  * operand: ['Ev']
- * opcode: 06
  * semantic: program.id = program.id;
 
  *
+ * opcode: 07
  * mnemonic: hint_nop
  * operand: ['Ev']
- * opcode: 07
  * semantic: program.id = program.id;
 
  *
 **/
-bool X86Architecture::Table_2_1f(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_2_1f(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     u8 ModRmByte;
     if (!rBinStrm.Read(Offset, ModRmByte))
@@ -3221,7 +3187,7 @@ bool X86Architecture::Table_2_1f(BinaryStream const& rBinStrm, OffsetType Offset
     case 0x0:
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Hint_nop);
-      if (Operand__Ev(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Ev<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -3237,7 +3203,7 @@ bool X86Architecture::Table_2_1f(BinaryStream const& rBinStrm, OffsetType Offset
     case 0x1:
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Hint_nop);
-      if (Operand__Ev(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Ev<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -3253,7 +3219,7 @@ bool X86Architecture::Table_2_1f(BinaryStream const& rBinStrm, OffsetType Offset
     case 0x2:
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Hint_nop);
-      if (Operand__Ev(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Ev<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -3269,7 +3235,7 @@ bool X86Architecture::Table_2_1f(BinaryStream const& rBinStrm, OffsetType Offset
     case 0x3:
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Hint_nop);
-      if (Operand__Ev(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Ev<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -3285,7 +3251,7 @@ bool X86Architecture::Table_2_1f(BinaryStream const& rBinStrm, OffsetType Offset
     case 0x4:
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Hint_nop);
-      if (Operand__Ev(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Ev<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -3301,7 +3267,7 @@ bool X86Architecture::Table_2_1f(BinaryStream const& rBinStrm, OffsetType Offset
     case 0x5:
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Hint_nop);
-      if (Operand__Ev(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Ev<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -3317,7 +3283,7 @@ bool X86Architecture::Table_2_1f(BinaryStream const& rBinStrm, OffsetType Offset
     case 0x6:
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Hint_nop);
-      if (Operand__Ev(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Ev<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -3333,7 +3299,7 @@ bool X86Architecture::Table_2_1f(BinaryStream const& rBinStrm, OffsetType Offset
     case 0x7:
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Hint_nop);
-      if (Operand__Ev(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Ev<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -3358,17 +3324,18 @@ bool X86Architecture::Table_2_1f(BinaryStream const& rBinStrm, OffsetType Offset
  *
  * mnemonic: mov
  * operand: ['Ry', 'Cy']
- * cpu_model: >= X86_Arch_80386
  * constraint: f64
+ * cpu_model: >= X86_Arch_80386
  *
 **/
-bool X86Architecture::Table_2_20(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_2_20(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_80386)
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Mov);
-      if (Operand__Ry_Cy(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Ry_Cy<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -3387,17 +3354,18 @@ bool X86Architecture::Table_2_20(BinaryStream const& rBinStrm, OffsetType Offset
  *
  * mnemonic: mov
  * operand: ['Ry', 'Dy']
- * cpu_model: >= X86_Arch_80386
  * constraint: f64
+ * cpu_model: >= X86_Arch_80386
  *
 **/
-bool X86Architecture::Table_2_21(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_2_21(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_80386)
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Mov);
-      if (Operand__Ry_Dy(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Ry_Dy<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -3416,17 +3384,18 @@ bool X86Architecture::Table_2_21(BinaryStream const& rBinStrm, OffsetType Offset
  *
  * mnemonic: mov
  * operand: ['Dy', 'Ry']
- * cpu_model: >= X86_Arch_80386
  * constraint: f64
+ * cpu_model: >= X86_Arch_80386
  *
 **/
-bool X86Architecture::Table_2_22(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_2_22(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_80386)
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Mov);
-      if (Operand__Dy_Ry(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Dy_Ry<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -3445,17 +3414,18 @@ bool X86Architecture::Table_2_22(BinaryStream const& rBinStrm, OffsetType Offset
  *
  * mnemonic: mov
  * operand: ['Dy', 'Ry']
- * cpu_model: >= X86_Arch_80386
  * constraint: f64
+ * cpu_model: >= X86_Arch_80386
  *
 **/
-bool X86Architecture::Table_2_23(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_2_23(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_80386)
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Mov);
-      if (Operand__Dy_Ry(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Dy_Ry<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -3473,21 +3443,22 @@ bool X86Architecture::Table_2_23(BinaryStream const& rBinStrm, OffsetType Offset
  * invalid
  *
  * mnemonic: mov
+ * operand: ['Ry', 'Ty']
+ * cpu_model: == X86_Arch_80386
  * semantic: op0.val = op1.val;
 
- * attr: ['amd']
  * reference: table_sse5a
- * operand: ['Ry', 'Ty']
- * cpu_model: == X86_Arch_80386
+ * attr: ['amd']
  *
 **/
-bool X86Architecture::Table_2_24(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_2_24(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") == X86_Arch_80386 && m_CfgMdl.GetEnum("Vendor") == X86_ProcType_AMD)
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Mov);
-      if (Operand__Ry_Ty(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Ry_Ty<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -3515,7 +3486,8 @@ bool X86Architecture::Table_2_24(BinaryStream const& rBinStrm, OffsetType Offset
  * attr: ['amd']
  *
 **/
-bool X86Architecture::Table_2_25(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_2_25(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Vendor") == X86_ProcType_AMD)
     {
@@ -3531,19 +3503,20 @@ bool X86Architecture::Table_2_25(BinaryStream const& rBinStrm, OffsetType Offset
  *
  * mnemonic: mov
  * operand: ['Ty', 'Ry']
+ * constraint: f64
+ * cpu_model: == X86_Arch_80386
  * semantic: op0.val = op1.val;
 
- * cpu_model: == X86_Arch_80386
- * constraint: f64
  *
 **/
-bool X86Architecture::Table_2_26(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_2_26(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") == X86_Arch_80386)
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Mov);
-      if (Operand__Ty_Ry(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Ty_Ry<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -3563,23 +3536,14 @@ bool X86Architecture::Table_2_26(BinaryStream const& rBinStrm, OffsetType Offset
     }
 }
 
-/** instruction
- * opcode: 27
- * invalid
-**/
-bool X86Architecture::Table_2_27(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
 /** instructions
  * opcode: 28
  *
  * mnemonic: movaps
  * operand: ['Vx', 'Wx']
+ * cpu_model: >= X86_Arch_Sse
  * semantic: op0.val = op1.val;
 
- * cpu_model: >= X86_Arch_Sse
  *
  * mnemonic: movapd
  * operand: ['Vx', 'Wx']
@@ -3587,13 +3551,14 @@ bool X86Architecture::Table_2_27(BinaryStream const& rBinStrm, OffsetType Offset
  * cpu_model: >= X86_Arch_Sse2
  *
 **/
-bool X86Architecture::Table_2_28(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_2_28(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_Sse2 && (rInsn.GetPrefix() & X86_Prefix_OpSize) == X86_Prefix_OpSize)
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Movapd);
-      if (Operand__Vx_Wx(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vx_Wx<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -3603,7 +3568,7 @@ bool X86Architecture::Table_2_28(BinaryStream const& rBinStrm, OffsetType Offset
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Movaps);
-      if (Operand__Vx_Wx(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vx_Wx<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -3625,9 +3590,9 @@ bool X86Architecture::Table_2_28(BinaryStream const& rBinStrm, OffsetType Offset
  *
  * mnemonic: movaps
  * operand: ['Wx', 'Vx']
+ * cpu_model: >= X86_Arch_Sse
  * semantic: op0.val = op1.val;
 
- * cpu_model: >= X86_Arch_Sse
  *
  * mnemonic: movapd
  * operand: ['Wx', 'Vx']
@@ -3635,13 +3600,14 @@ bool X86Architecture::Table_2_28(BinaryStream const& rBinStrm, OffsetType Offset
  * cpu_model: >= X86_Arch_Sse2
  *
 **/
-bool X86Architecture::Table_2_29(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_2_29(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_Sse2 && (rInsn.GetPrefix() & X86_Prefix_OpSize) == X86_Prefix_OpSize)
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Movapd);
-      if (Operand__Wx_Vx(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Wx_Vx<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -3651,7 +3617,7 @@ bool X86Architecture::Table_2_29(BinaryStream const& rBinStrm, OffsetType Offset
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Movaps);
-      if (Operand__Wx_Vx(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Wx_Vx<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -3700,13 +3666,14 @@ bool X86Architecture::Table_2_29(BinaryStream const& rBinStrm, OffsetType Offset
  * cpu_model: >= X86_Arch_Sse2
  *
 **/
-bool X86Architecture::Table_2_2a(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_2_2a(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_Sse2 && (rInsn.GetPrefix() & X86_Prefix_RepNz) == X86_Prefix_RepNz)
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Cvtsi2sd);
-      if (Operand__Vo_Ey(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vo_Ey<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -3716,7 +3683,7 @@ bool X86Architecture::Table_2_2a(BinaryStream const& rBinStrm, OffsetType Offset
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Cvtsi2ss);
-      if (Operand__Vo_Ey(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vo_Ey<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -3726,7 +3693,7 @@ bool X86Architecture::Table_2_2a(BinaryStream const& rBinStrm, OffsetType Offset
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Cvtpi2pd);
-      if (Operand__Vo_Nq(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vo_Nq<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -3736,7 +3703,7 @@ bool X86Architecture::Table_2_2a(BinaryStream const& rBinStrm, OffsetType Offset
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Cvtpi2pd);
-      if (Operand__Vo_Mq(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vo_Mq<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -3746,7 +3713,7 @@ bool X86Architecture::Table_2_2a(BinaryStream const& rBinStrm, OffsetType Offset
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Cvtpi2ps);
-      if (Operand__Vo_Nq(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vo_Nq<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -3756,7 +3723,7 @@ bool X86Architecture::Table_2_2a(BinaryStream const& rBinStrm, OffsetType Offset
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Cvtpi2ps);
-      if (Operand__Vo_Mq(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vo_Mq<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -3788,13 +3755,14 @@ bool X86Architecture::Table_2_2a(BinaryStream const& rBinStrm, OffsetType Offset
  * cpu_model: >= X86_Arch_Sse4a
  *
 **/
-bool X86Architecture::Table_2_2b(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_2_2b(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_Sse4a && (rInsn.GetPrefix() & X86_Prefix_RepNz) == X86_Prefix_RepNz)
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Movntsd);
-      if (Operand__Mq_Vo(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Mq_Vo<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -3804,7 +3772,7 @@ bool X86Architecture::Table_2_2b(BinaryStream const& rBinStrm, OffsetType Offset
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Movntss);
-      if (Operand__Md_Vo(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Md_Vo<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -3814,7 +3782,7 @@ bool X86Architecture::Table_2_2b(BinaryStream const& rBinStrm, OffsetType Offset
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Movntpd);
-      if (Operand__Mx_Vx(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Mx_Vx<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -3824,7 +3792,7 @@ bool X86Architecture::Table_2_2b(BinaryStream const& rBinStrm, OffsetType Offset
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Movntps);
-      if (Operand__Mx_Vx(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Mx_Vx<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -3856,13 +3824,14 @@ bool X86Architecture::Table_2_2b(BinaryStream const& rBinStrm, OffsetType Offset
  * cpu_model: >= X86_Arch_Sse2
  *
 **/
-bool X86Architecture::Table_2_2c(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_2_2c(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_Sse2 && (rInsn.GetPrefix() & X86_Prefix_RepNz) == X86_Prefix_RepNz)
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Cvttsd2si);
-      if (Operand__Gy_Woq(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Gy_Woq<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -3872,7 +3841,7 @@ bool X86Architecture::Table_2_2c(BinaryStream const& rBinStrm, OffsetType Offset
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Cvttss2si);
-      if (Operand__Gy_Wod(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Gy_Wod<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -3882,7 +3851,7 @@ bool X86Architecture::Table_2_2c(BinaryStream const& rBinStrm, OffsetType Offset
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Cvttpd2pi);
-      if (Operand__Pq_Wo(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Pq_Wo<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -3892,7 +3861,7 @@ bool X86Architecture::Table_2_2c(BinaryStream const& rBinStrm, OffsetType Offset
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Cvttps2pi);
-      if (Operand__Pq_Woq(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Pq_Woq<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -3924,13 +3893,14 @@ bool X86Architecture::Table_2_2c(BinaryStream const& rBinStrm, OffsetType Offset
  * cpu_model: >= X86_Arch_Sse2
  *
 **/
-bool X86Architecture::Table_2_2d(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_2_2d(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_Sse2 && (rInsn.GetPrefix() & X86_Prefix_RepNz) == X86_Prefix_RepNz)
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Cvtsd2si);
-      if (Operand__Gy_Woq(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Gy_Woq<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -3940,7 +3910,7 @@ bool X86Architecture::Table_2_2d(BinaryStream const& rBinStrm, OffsetType Offset
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Cvtss2si);
-      if (Operand__Gy_Wod(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Gy_Wod<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -3950,7 +3920,7 @@ bool X86Architecture::Table_2_2d(BinaryStream const& rBinStrm, OffsetType Offset
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Cvtpd2pi);
-      if (Operand__Pq_Wo(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Pq_Wo<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -3960,7 +3930,7 @@ bool X86Architecture::Table_2_2d(BinaryStream const& rBinStrm, OffsetType Offset
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Cvtps2pi);
-      if (Operand__Pq_Woq(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Pq_Woq<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -3982,13 +3952,14 @@ bool X86Architecture::Table_2_2d(BinaryStream const& rBinStrm, OffsetType Offset
  * cpu_model: >= X86_Arch_Sse2
  *
 **/
-bool X86Architecture::Table_2_2e(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_2_2e(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_Sse2 && (rInsn.GetPrefix() & X86_Prefix_OpSize) == X86_Prefix_OpSize)
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Ucomisd);
-      if (Operand__Vo_Woq(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vo_Woq<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -3998,7 +3969,7 @@ bool X86Architecture::Table_2_2e(BinaryStream const& rBinStrm, OffsetType Offset
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Ucomiss);
-      if (Operand__Vo_Wod(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vo_Wod<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -4020,13 +3991,14 @@ bool X86Architecture::Table_2_2e(BinaryStream const& rBinStrm, OffsetType Offset
  * cpu_model: >= X86_Arch_Sse2
  *
 **/
-bool X86Architecture::Table_2_2f(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_2_2f(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_Sse2 && (rInsn.GetPrefix() & X86_Prefix_OpSize) == X86_Prefix_OpSize)
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Comisd);
-      if (Operand__Vo_Woq(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vo_Woq<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -4036,7 +4008,7 @@ bool X86Architecture::Table_2_2f(BinaryStream const& rBinStrm, OffsetType Offset
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Comiss);
-      if (Operand__Vo_Wod(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vo_Wod<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -4046,98 +4018,41 @@ bool X86Architecture::Table_2_2f(BinaryStream const& rBinStrm, OffsetType Offset
 }
 
 /** instruction
- * mnemonic: wrmsr
- * opcode: 30
+ * opcode: 34
+ * mnemonic: sysenter
+ * attr: ['intel']
+ * semantic: 
 **/
-bool X86Architecture::Table_2_30(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_2_34(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
-    rInsn.Size()++;
-    rInsn.SetOpcode(X86_Opcode_Wrmsr);
-    return true;
+    if (m_CfgMdl.GetEnum("Vendor") == X86_ProcType_INTEL)
+    {
+      rInsn.Size()++;
+      rInsn.SetOpcode(X86_Opcode_Sysenter);
+      return true;
+    }
+    else
+      return false;
 }
 
 /** instruction
- * mnemonic: rdtsc
- * opcode: 31
- * semantic: eax.id = int32(0);
-edx.id = int32(0);
-
+ * opcode: 35
+ * mnemonic: sysexit
+ * attr: ['intel']
+ * semantic: 
 **/
-bool X86Architecture::Table_2_31(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_2_35(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
-    rInsn.Size()++;
-    rInsn.SetOpcode(X86_Opcode_Rdtsc);
+    if (m_CfgMdl.GetEnum("Vendor") == X86_ProcType_INTEL)
     {
-      Expression::LSPType AllExpr;
-      /* semantic: eax.id = int32(0) */
-      AllExpr.push_back(Expr::MakeAssign(
-        Expr::MakeId(X86_Reg_Eax, &m_CpuInfo),
-        Expr::MakeBitVector(32, 0x0)));
-      /* semantic: edx.id = int32(0) */
-      AllExpr.push_back(Expr::MakeAssign(
-        Expr::MakeId(X86_Reg_Edx, &m_CpuInfo),
-        Expr::MakeBitVector(32, 0x0)));
-      rInsn.SetSemantic(AllExpr);
+      rInsn.Size()++;
+      rInsn.SetOpcode(X86_Opcode_Sysexit);
+      return true;
     }
-    return true;
-}
-
-/** instruction
- * mnemonic: rdmsr
- * opcode: 32
-**/
-bool X86Architecture::Table_2_32(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    rInsn.Size()++;
-    rInsn.SetOpcode(X86_Opcode_Rdmsr);
-    return true;
-}
-
-/** instruction
- * mnemonic: rdpmc
- * opcode: 33
-**/
-bool X86Architecture::Table_2_33(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    rInsn.Size()++;
-    rInsn.SetOpcode(X86_Opcode_Rdpmc);
-    return true;
-}
-
-/** instruction
- * mnemonic: sysenter
- * opcode: 34
- * semantic: 
- * attr: ['intel']
-**/
-bool X86Architecture::Table_2_34(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    if (m_CfgMdl.GetEnum("Vendor") == X86_ProcType_INTEL)
-    {
-      rInsn.Size()++;
-      rInsn.SetOpcode(X86_Opcode_Sysenter);
-      return true;
-    }
-    else
-      return false;
-}
-
-/** instruction
- * mnemonic: sysexit
- * opcode: 35
- * semantic: 
- * attr: ['intel']
-**/
-bool X86Architecture::Table_2_35(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    if (m_CfgMdl.GetEnum("Vendor") == X86_ProcType_INTEL)
-    {
-      rInsn.Size()++;
-      rInsn.SetOpcode(X86_Opcode_Sysexit);
-      return true;
-    }
-    else
-      return false;
+    else
+      return false;
 }
 
 /** instructions
@@ -4150,13 +4065,14 @@ bool X86Architecture::Table_2_35(BinaryStream const& rBinStrm, OffsetType Offset
  * attr: ['cyrix']
  *
 **/
-bool X86Architecture::Table_2_36(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_2_36(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Vendor") == X86_ProcType_CYRIX)
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Rdshr);
-      if (Operand__Ed(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Ed<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -4178,13 +4094,14 @@ bool X86Architecture::Table_2_36(BinaryStream const& rBinStrm, OffsetType Offset
  * attr: ['cyrix']
  *
 **/
-bool X86Architecture::Table_2_37(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_2_37(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Vendor") == X86_ProcType_CYRIX)
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Wrshr);
-      if (Operand__Ed(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Ed<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -4212,7 +4129,8 @@ bool X86Architecture::Table_2_37(BinaryStream const& rBinStrm, OffsetType Offset
  * cpu_model: >= X86_Arch_Geode_lx
  *
 **/
-bool X86Architecture::Table_2_38(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_2_38(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_Geode_lx && m_CfgMdl.GetEnum("Vendor") == X86_ProcType_CYRIX)
     {
@@ -4233,19 +4151,20 @@ bool X86Architecture::Table_2_38(BinaryStream const& rBinStrm, OffsetType Offset
         return false;
 
       rInsn.Size()++;
-      if (Opcode + 1 > sizeof(m_Table_3_38))
+      if (Opcode >= sizeof(m_Table_3_38) / sizeof(*m_Table_3_38))
         return false;
-      return (this->*m_Table_3_38[Opcode])(rBinStrm, Offset + 1, rInsn, Mode);
+      return _Decode<Mode>(m_Table_3_38[Opcode], rBinStrm, Offset + 1, rInsn);
     }
 }
 
 /** instruction
- * mnemonic: dmint
  * opcode: 39
+ * mnemonic: dmint
  * attr: ['cyrix']
  * cpu_model: >= X86_Arch_Geode_lx
 **/
-bool X86Architecture::Table_2_39(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_2_39(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_Geode_lx && m_CfgMdl.GetEnum("Vendor") == X86_ProcType_CYRIX)
     {
@@ -4271,7 +4190,8 @@ bool X86Architecture::Table_2_39(BinaryStream const& rBinStrm, OffsetType Offset
  * cpu_model: >= X86_Arch_Geode_lx
  *
 **/
-bool X86Architecture::Table_2_3a(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_2_3a(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_Geode_lx && m_CfgMdl.GetEnum("Vendor") == X86_ProcType_CYRIX)
     {
@@ -4292,19 +4212,20 @@ bool X86Architecture::Table_2_3a(BinaryStream const& rBinStrm, OffsetType Offset
         return false;
 
       rInsn.Size()++;
-      if (Opcode + 1 > sizeof(m_Table_3_3a))
+      if (Opcode >= sizeof(m_Table_3_3a) / sizeof(*m_Table_3_3a))
         return false;
-      return (this->*m_Table_3_3a[Opcode])(rBinStrm, Offset + 1, rInsn, Mode);
+      return _Decode<Mode>(m_Table_3_3a[Opcode], rBinStrm, Offset + 1, rInsn);
     }
 }
 
 /** instruction
- * mnemonic: bb1_reset
  * opcode: 3b
+ * mnemonic: bb1_reset
  * attr: ['cyrix']
  * cpu_model: >= X86_Arch_Cyrix_gx1
 **/
-bool X86Architecture::Table_2_3b(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_2_3b(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_Cyrix_gx1 && m_CfgMdl.GetEnum("Vendor") == X86_ProcType_CYRIX)
     {
@@ -4317,12 +4238,13 @@ bool X86Architecture::Table_2_3b(BinaryStream const& rBinStrm, OffsetType Offset
 }
 
 /** instruction
- * mnemonic: cpu_write
  * opcode: 3c
+ * mnemonic: cpu_write
  * attr: ['cyrix']
  * cpu_model: >= X86_Arch_Cyrix_gx1
 **/
-bool X86Architecture::Table_2_3c(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_2_3c(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_Cyrix_gx1 && m_CfgMdl.GetEnum("Vendor") == X86_ProcType_CYRIX)
     {
@@ -4335,12 +4257,13 @@ bool X86Architecture::Table_2_3c(BinaryStream const& rBinStrm, OffsetType Offset
 }
 
 /** instruction
- * mnemonic: cpu_read
  * opcode: 3d
+ * mnemonic: cpu_read
  * attr: ['cyrix']
  * cpu_model: >= X86_Arch_Cyrix_gx1
 **/
-bool X86Architecture::Table_2_3d(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_2_3d(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_Cyrix_gx1 && m_CfgMdl.GetEnum("Vendor") == X86_ProcType_CYRIX)
     {
@@ -4353,614 +4276,22 @@ bool X86Architecture::Table_2_3d(BinaryStream const& rBinStrm, OffsetType Offset
 }
 
 /** instruction
- * opcode: 3e
- * invalid
-**/
-bool X86Architecture::Table_2_3e(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * mnemonic: altinst
  * opcode: 3f
+ * mnemonic: altinst
  * attr: ['cyrix']
  * cpu_model: >= X86_Arch_Centaur_ais
 **/
-bool X86Architecture::Table_2_3f(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_Centaur_ais && m_CfgMdl.GetEnum("Vendor") == X86_ProcType_CYRIX)
-    {
-      rInsn.Size()++;
-      rInsn.SetOpcode(X86_Opcode_Altinst);
-      return true;
-    }
-    else
-      return false;
-}
-
-/** instruction
- * mnemonic: cmovo
- * operand: ['Gv', 'Ev']
- * test_flags: ['of']
- * semantic: if __expr and of.id == int1(1): op0.val = op1.val;
-
- * operation_type: ['cond']
- * opcode: 40
-**/
-bool X86Architecture::Table_2_40(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    rInsn.Size()++;
-    rInsn.SetOpcode(X86_Opcode_Cmovo);
-    rInsn.SubType() |= Instruction::ConditionalType;
-    if (Operand__Gv_Ev(rBinStrm, Offset, rInsn, Mode) == false)
-    {
-      return false;
-    }
-    {
-      Expression::LSPType AllExpr;
-      rInsn.SetTestedFlags(X86_FlOf);
-      /* semantic: if __expr and of.id == int1(1): op0.val = op1.val */
-      AllExpr.push_back(Expr::MakeIfElseCond(
-        ConditionExpression::CondEq,
-        Expr::MakeId(X86_FlOf, &m_CpuInfo),
-        Expr::MakeBitVector(1, 0x1),
-        Expr::MakeAssign(
-          rInsn.GetOperand(0),
-          rInsn.GetOperand(1)), nullptr)
-      );
-      rInsn.SetSemantic(AllExpr);
-    }
-    return true;
-}
-
-/** instruction
- * mnemonic: cmovno
- * operand: ['Gv', 'Ev']
- * test_flags: ['of']
- * semantic: if __expr and of.id == int1(0): op0.val = op1.val;
-
- * operation_type: ['cond']
- * opcode: 41
-**/
-bool X86Architecture::Table_2_41(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    rInsn.Size()++;
-    rInsn.SetOpcode(X86_Opcode_Cmovno);
-    rInsn.SubType() |= Instruction::ConditionalType;
-    if (Operand__Gv_Ev(rBinStrm, Offset, rInsn, Mode) == false)
-    {
-      return false;
-    }
-    {
-      Expression::LSPType AllExpr;
-      rInsn.SetTestedFlags(X86_FlOf);
-      /* semantic: if __expr and of.id == int1(0): op0.val = op1.val */
-      AllExpr.push_back(Expr::MakeIfElseCond(
-        ConditionExpression::CondEq,
-        Expr::MakeId(X86_FlOf, &m_CpuInfo),
-        Expr::MakeBitVector(1, 0x0),
-        Expr::MakeAssign(
-          rInsn.GetOperand(0),
-          rInsn.GetOperand(1)), nullptr)
-      );
-      rInsn.SetSemantic(AllExpr);
-    }
-    return true;
-}
-
-/** instruction
- * mnemonic: cmovb
- * operand: ['Gv', 'Ev']
- * test_flags: ['cf']
- * semantic: if __expr and cf.id == int1(1): op0.val = op1.val;
-
- * operation_type: ['cond']
- * opcode: 42
-**/
-bool X86Architecture::Table_2_42(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    rInsn.Size()++;
-    rInsn.SetOpcode(X86_Opcode_Cmovb);
-    rInsn.SubType() |= Instruction::ConditionalType;
-    if (Operand__Gv_Ev(rBinStrm, Offset, rInsn, Mode) == false)
-    {
-      return false;
-    }
-    {
-      Expression::LSPType AllExpr;
-      rInsn.SetTestedFlags(X86_FlCf);
-      /* semantic: if __expr and cf.id == int1(1): op0.val = op1.val */
-      AllExpr.push_back(Expr::MakeIfElseCond(
-        ConditionExpression::CondEq,
-        Expr::MakeId(X86_FlCf, &m_CpuInfo),
-        Expr::MakeBitVector(1, 0x1),
-        Expr::MakeAssign(
-          rInsn.GetOperand(0),
-          rInsn.GetOperand(1)), nullptr)
-      );
-      rInsn.SetSemantic(AllExpr);
-    }
-    return true;
-}
-
-/** instruction
- * mnemonic: cmovnb
- * operand: ['Gv', 'Ev']
- * test_flags: ['cf']
- * semantic: if __expr and cf.id == int1(0): op0.val = op1.val;
-
- * operation_type: ['cond']
- * opcode: 43
-**/
-bool X86Architecture::Table_2_43(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    rInsn.Size()++;
-    rInsn.SetOpcode(X86_Opcode_Cmovnb);
-    rInsn.SubType() |= Instruction::ConditionalType;
-    if (Operand__Gv_Ev(rBinStrm, Offset, rInsn, Mode) == false)
-    {
-      return false;
-    }
-    {
-      Expression::LSPType AllExpr;
-      rInsn.SetTestedFlags(X86_FlCf);
-      /* semantic: if __expr and cf.id == int1(0): op0.val = op1.val */
-      AllExpr.push_back(Expr::MakeIfElseCond(
-        ConditionExpression::CondEq,
-        Expr::MakeId(X86_FlCf, &m_CpuInfo),
-        Expr::MakeBitVector(1, 0x0),
-        Expr::MakeAssign(
-          rInsn.GetOperand(0),
-          rInsn.GetOperand(1)), nullptr)
-      );
-      rInsn.SetSemantic(AllExpr);
-    }
-    return true;
-}
-
-/** instruction
- * mnemonic: cmovz
- * operand: ['Gv', 'Ev']
- * test_flags: ['zf']
- * semantic: if __expr and zf.id == int1(1): op0.val = op1.val;
-
- * operation_type: ['cond']
- * opcode: 44
-**/
-bool X86Architecture::Table_2_44(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    rInsn.Size()++;
-    rInsn.SetOpcode(X86_Opcode_Cmovz);
-    rInsn.SubType() |= Instruction::ConditionalType;
-    if (Operand__Gv_Ev(rBinStrm, Offset, rInsn, Mode) == false)
-    {
-      return false;
-    }
-    {
-      Expression::LSPType AllExpr;
-      rInsn.SetTestedFlags(X86_FlZf);
-      /* semantic: if __expr and zf.id == int1(1): op0.val = op1.val */
-      AllExpr.push_back(Expr::MakeIfElseCond(
-        ConditionExpression::CondEq,
-        Expr::MakeId(X86_FlZf, &m_CpuInfo),
-        Expr::MakeBitVector(1, 0x1),
-        Expr::MakeAssign(
-          rInsn.GetOperand(0),
-          rInsn.GetOperand(1)), nullptr)
-      );
-      rInsn.SetSemantic(AllExpr);
-    }
-    return true;
-}
-
-/** instruction
- * mnemonic: cmovnz
- * operand: ['Gv', 'Ev']
- * test_flags: ['zf']
- * semantic: if __expr and zf.id == int1(0): op0.val = op1.val;
-
- * operation_type: ['cond']
- * opcode: 45
-**/
-bool X86Architecture::Table_2_45(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_2_3f(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
-    rInsn.Size()++;
-    rInsn.SetOpcode(X86_Opcode_Cmovnz);
-    rInsn.SubType() |= Instruction::ConditionalType;
-    if (Operand__Gv_Ev(rBinStrm, Offset, rInsn, Mode) == false)
-    {
-      return false;
-    }
-    {
-      Expression::LSPType AllExpr;
-      rInsn.SetTestedFlags(X86_FlZf);
-      /* semantic: if __expr and zf.id == int1(0): op0.val = op1.val */
-      AllExpr.push_back(Expr::MakeIfElseCond(
-        ConditionExpression::CondEq,
-        Expr::MakeId(X86_FlZf, &m_CpuInfo),
-        Expr::MakeBitVector(1, 0x0),
-        Expr::MakeAssign(
-          rInsn.GetOperand(0),
-          rInsn.GetOperand(1)), nullptr)
-      );
-      rInsn.SetSemantic(AllExpr);
-    }
-    return true;
-}
-
-/** instruction
- * mnemonic: cmovbe
- * operand: ['Gv', 'Ev']
- * test_flags: ['zf', 'cf']
- * semantic: if __expr and (cf.id | zf.id) != int1(0): op0.val = op1.val;
-
- * operation_type: ['cond']
- * opcode: 46
-**/
-bool X86Architecture::Table_2_46(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    rInsn.Size()++;
-    rInsn.SetOpcode(X86_Opcode_Cmovbe);
-    rInsn.SubType() |= Instruction::ConditionalType;
-    if (Operand__Gv_Ev(rBinStrm, Offset, rInsn, Mode) == false)
-    {
-      return false;
-    }
-    {
-      Expression::LSPType AllExpr;
-      rInsn.SetTestedFlags(X86_FlZf | X86_FlCf);
-      /* semantic: if __expr and (cf.id | zf.id) != int1(0): op0.val = op1.val */
-      AllExpr.push_back(Expr::MakeIfElseCond(
-        ConditionExpression::CondNe,
-        Expr::MakeBinOp(
-          OperationExpression::OpOr,
-          Expr::MakeId(X86_FlCf, &m_CpuInfo),
-          Expr::MakeId(X86_FlZf, &m_CpuInfo)),
-        Expr::MakeBitVector(1, 0x0),
-        Expr::MakeAssign(
-          rInsn.GetOperand(0),
-          rInsn.GetOperand(1)), nullptr)
-      );
-      rInsn.SetSemantic(AllExpr);
-    }
-    return true;
-}
-
-/** instruction
- * mnemonic: cmovnbe
- * operand: ['Gv', 'Ev']
- * test_flags: ['zf', 'cf']
- * semantic: if __expr and (cf.id | zf.id) == int1(0): op0.val = op1.val;
-
- * operation_type: ['cond']
- * opcode: 47
-**/
-bool X86Architecture::Table_2_47(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    rInsn.Size()++;
-    rInsn.SetOpcode(X86_Opcode_Cmovnbe);
-    rInsn.SubType() |= Instruction::ConditionalType;
-    if (Operand__Gv_Ev(rBinStrm, Offset, rInsn, Mode) == false)
-    {
-      return false;
-    }
-    {
-      Expression::LSPType AllExpr;
-      rInsn.SetTestedFlags(X86_FlZf | X86_FlCf);
-      /* semantic: if __expr and (cf.id | zf.id) == int1(0): op0.val = op1.val */
-      AllExpr.push_back(Expr::MakeIfElseCond(
-        ConditionExpression::CondEq,
-        Expr::MakeBinOp(
-          OperationExpression::OpOr,
-          Expr::MakeId(X86_FlCf, &m_CpuInfo),
-          Expr::MakeId(X86_FlZf, &m_CpuInfo)),
-        Expr::MakeBitVector(1, 0x0),
-        Expr::MakeAssign(
-          rInsn.GetOperand(0),
-          rInsn.GetOperand(1)), nullptr)
-      );
-      rInsn.SetSemantic(AllExpr);
-    }
-    return true;
-}
-
-/** instruction
- * mnemonic: cmovs
- * operand: ['Gv', 'Ev']
- * test_flags: ['sf']
- * semantic: if __expr and sf.id == int1(1): op0.val = op1.val;
-
- * operation_type: ['cond']
- * opcode: 48
-**/
-bool X86Architecture::Table_2_48(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    rInsn.Size()++;
-    rInsn.SetOpcode(X86_Opcode_Cmovs);
-    rInsn.SubType() |= Instruction::ConditionalType;
-    if (Operand__Gv_Ev(rBinStrm, Offset, rInsn, Mode) == false)
-    {
-      return false;
-    }
-    {
-      Expression::LSPType AllExpr;
-      rInsn.SetTestedFlags(X86_FlSf);
-      /* semantic: if __expr and sf.id == int1(1): op0.val = op1.val */
-      AllExpr.push_back(Expr::MakeIfElseCond(
-        ConditionExpression::CondEq,
-        Expr::MakeId(X86_FlSf, &m_CpuInfo),
-        Expr::MakeBitVector(1, 0x1),
-        Expr::MakeAssign(
-          rInsn.GetOperand(0),
-          rInsn.GetOperand(1)), nullptr)
-      );
-      rInsn.SetSemantic(AllExpr);
-    }
-    return true;
-}
-
-/** instruction
- * mnemonic: cmovns
- * operand: ['Gv', 'Ev']
- * test_flags: ['sf']
- * semantic: if __expr and sf.id == int1(0): op0.val = op1.val;
-
- * operation_type: ['cond']
- * opcode: 49
-**/
-bool X86Architecture::Table_2_49(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    rInsn.Size()++;
-    rInsn.SetOpcode(X86_Opcode_Cmovns);
-    rInsn.SubType() |= Instruction::ConditionalType;
-    if (Operand__Gv_Ev(rBinStrm, Offset, rInsn, Mode) == false)
-    {
-      return false;
-    }
-    {
-      Expression::LSPType AllExpr;
-      rInsn.SetTestedFlags(X86_FlSf);
-      /* semantic: if __expr and sf.id == int1(0): op0.val = op1.val */
-      AllExpr.push_back(Expr::MakeIfElseCond(
-        ConditionExpression::CondEq,
-        Expr::MakeId(X86_FlSf, &m_CpuInfo),
-        Expr::MakeBitVector(1, 0x0),
-        Expr::MakeAssign(
-          rInsn.GetOperand(0),
-          rInsn.GetOperand(1)), nullptr)
-      );
-      rInsn.SetSemantic(AllExpr);
-    }
-    return true;
-}
-
-/** instruction
- * mnemonic: cmovp
- * operand: ['Gv', 'Ev']
- * test_flags: ['pf']
- * semantic: if __expr and pf.id == int1(1): op0.val = op1.val;
-
- * operation_type: ['cond']
- * opcode: 4a
-**/
-bool X86Architecture::Table_2_4a(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    rInsn.Size()++;
-    rInsn.SetOpcode(X86_Opcode_Cmovp);
-    rInsn.SubType() |= Instruction::ConditionalType;
-    if (Operand__Gv_Ev(rBinStrm, Offset, rInsn, Mode) == false)
-    {
-      return false;
-    }
-    {
-      Expression::LSPType AllExpr;
-      rInsn.SetTestedFlags(X86_FlPf);
-      /* semantic: if __expr and pf.id == int1(1): op0.val = op1.val */
-      AllExpr.push_back(Expr::MakeIfElseCond(
-        ConditionExpression::CondEq,
-        Expr::MakeId(X86_FlPf, &m_CpuInfo),
-        Expr::MakeBitVector(1, 0x1),
-        Expr::MakeAssign(
-          rInsn.GetOperand(0),
-          rInsn.GetOperand(1)), nullptr)
-      );
-      rInsn.SetSemantic(AllExpr);
-    }
-    return true;
-}
-
-/** instruction
- * mnemonic: cmovnp
- * operand: ['Gv', 'Ev']
- * test_flags: ['pf']
- * semantic: if __expr and pf.id == int1(0): op0.val = op1.val;
-
- * operation_type: ['cond']
- * opcode: 4b
-**/
-bool X86Architecture::Table_2_4b(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    rInsn.Size()++;
-    rInsn.SetOpcode(X86_Opcode_Cmovnp);
-    rInsn.SubType() |= Instruction::ConditionalType;
-    if (Operand__Gv_Ev(rBinStrm, Offset, rInsn, Mode) == false)
-    {
-      return false;
-    }
-    {
-      Expression::LSPType AllExpr;
-      rInsn.SetTestedFlags(X86_FlPf);
-      /* semantic: if __expr and pf.id == int1(0): op0.val = op1.val */
-      AllExpr.push_back(Expr::MakeIfElseCond(
-        ConditionExpression::CondEq,
-        Expr::MakeId(X86_FlPf, &m_CpuInfo),
-        Expr::MakeBitVector(1, 0x0),
-        Expr::MakeAssign(
-          rInsn.GetOperand(0),
-          rInsn.GetOperand(1)), nullptr)
-      );
-      rInsn.SetSemantic(AllExpr);
-    }
-    return true;
-}
-
-/** instruction
- * mnemonic: cmovl
- * operand: ['Gv', 'Ev']
- * test_flags: ['of', 'sf']
- * semantic: if __expr and (sf.id ^ of.id) != int1(0): op0.val = op1.val;
-
- * operation_type: ['cond']
- * opcode: 4c
-**/
-bool X86Architecture::Table_2_4c(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    rInsn.Size()++;
-    rInsn.SetOpcode(X86_Opcode_Cmovl);
-    rInsn.SubType() |= Instruction::ConditionalType;
-    if (Operand__Gv_Ev(rBinStrm, Offset, rInsn, Mode) == false)
-    {
-      return false;
-    }
-    {
-      Expression::LSPType AllExpr;
-      rInsn.SetTestedFlags(X86_FlOf | X86_FlSf);
-      /* semantic: if __expr and (sf.id ^ of.id) != int1(0): op0.val = op1.val */
-      AllExpr.push_back(Expr::MakeIfElseCond(
-        ConditionExpression::CondNe,
-        Expr::MakeBinOp(
-          OperationExpression::OpXor,
-          Expr::MakeId(X86_FlSf, &m_CpuInfo),
-          Expr::MakeId(X86_FlOf, &m_CpuInfo)),
-        Expr::MakeBitVector(1, 0x0),
-        Expr::MakeAssign(
-          rInsn.GetOperand(0),
-          rInsn.GetOperand(1)), nullptr)
-      );
-      rInsn.SetSemantic(AllExpr);
-    }
-    return true;
-}
-
-/** instruction
- * mnemonic: cmovnl
- * operand: ['Gv', 'Ev']
- * test_flags: ['of', 'sf']
- * semantic: if __expr and (sf.id ^ of.id) == int1(0): op0.val = op1.val;
-
- * operation_type: ['cond']
- * opcode: 4d
-**/
-bool X86Architecture::Table_2_4d(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    rInsn.Size()++;
-    rInsn.SetOpcode(X86_Opcode_Cmovnl);
-    rInsn.SubType() |= Instruction::ConditionalType;
-    if (Operand__Gv_Ev(rBinStrm, Offset, rInsn, Mode) == false)
-    {
-      return false;
-    }
-    {
-      Expression::LSPType AllExpr;
-      rInsn.SetTestedFlags(X86_FlOf | X86_FlSf);
-      /* semantic: if __expr and (sf.id ^ of.id) == int1(0): op0.val = op1.val */
-      AllExpr.push_back(Expr::MakeIfElseCond(
-        ConditionExpression::CondEq,
-        Expr::MakeBinOp(
-          OperationExpression::OpXor,
-          Expr::MakeId(X86_FlSf, &m_CpuInfo),
-          Expr::MakeId(X86_FlOf, &m_CpuInfo)),
-        Expr::MakeBitVector(1, 0x0),
-        Expr::MakeAssign(
-          rInsn.GetOperand(0),
-          rInsn.GetOperand(1)), nullptr)
-      );
-      rInsn.SetSemantic(AllExpr);
-    }
-    return true;
-}
-
-/** instruction
- * mnemonic: cmovle
- * operand: ['Gv', 'Ev']
- * test_flags: ['of', 'sf', 'zf']
- * semantic: if __expr and ((sf.id ^ of.id) | zf.id) != int1(0): op0.val = op1.val;
-
- * operation_type: ['cond']
- * opcode: 4e
-**/
-bool X86Architecture::Table_2_4e(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    rInsn.Size()++;
-    rInsn.SetOpcode(X86_Opcode_Cmovle);
-    rInsn.SubType() |= Instruction::ConditionalType;
-    if (Operand__Gv_Ev(rBinStrm, Offset, rInsn, Mode) == false)
-    {
-      return false;
-    }
-    {
-      Expression::LSPType AllExpr;
-      rInsn.SetTestedFlags(X86_FlOf | X86_FlSf | X86_FlZf);
-      /* semantic: if __expr and ((sf.id ^ of.id) | zf.id) != int1(0): op0.val = op1.val */
-      AllExpr.push_back(Expr::MakeIfElseCond(
-        ConditionExpression::CondNe,
-        Expr::MakeBinOp(
-          OperationExpression::OpOr,
-          Expr::MakeBinOp(
-            OperationExpression::OpXor,
-            Expr::MakeId(X86_FlSf, &m_CpuInfo),
-            Expr::MakeId(X86_FlOf, &m_CpuInfo)),
-          Expr::MakeId(X86_FlZf, &m_CpuInfo)),
-        Expr::MakeBitVector(1, 0x0),
-        Expr::MakeAssign(
-          rInsn.GetOperand(0),
-          rInsn.GetOperand(1)), nullptr)
-      );
-      rInsn.SetSemantic(AllExpr);
-    }
-    return true;
-}
-
-/** instruction
- * mnemonic: cmovnle
- * operand: ['Gv', 'Ev']
- * test_flags: ['of', 'sf', 'zf']
- * semantic: if __expr and ((sf.id ^ of.id) | zf.id) == int1(0): op0.val = op1.val;
-
- * operation_type: ['cond']
- * opcode: 4f
-**/
-bool X86Architecture::Table_2_4f(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    rInsn.Size()++;
-    rInsn.SetOpcode(X86_Opcode_Cmovnle);
-    rInsn.SubType() |= Instruction::ConditionalType;
-    if (Operand__Gv_Ev(rBinStrm, Offset, rInsn, Mode) == false)
-    {
-      return false;
-    }
-    {
-      Expression::LSPType AllExpr;
-      rInsn.SetTestedFlags(X86_FlOf | X86_FlSf | X86_FlZf);
-      /* semantic: if __expr and ((sf.id ^ of.id) | zf.id) == int1(0): op0.val = op1.val */
-      AllExpr.push_back(Expr::MakeIfElseCond(
-        ConditionExpression::CondEq,
-        Expr::MakeBinOp(
-          OperationExpression::OpOr,
-          Expr::MakeBinOp(
-            OperationExpression::OpXor,
-            Expr::MakeId(X86_FlSf, &m_CpuInfo),
-            Expr::MakeId(X86_FlOf, &m_CpuInfo)),
-          Expr::MakeId(X86_FlZf, &m_CpuInfo)),
-        Expr::MakeBitVector(1, 0x0),
-        Expr::MakeAssign(
-          rInsn.GetOperand(0),
-          rInsn.GetOperand(1)), nullptr)
-      );
-      rInsn.SetSemantic(AllExpr);
+    if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_Centaur_ais && m_CfgMdl.GetEnum("Vendor") == X86_ProcType_CYRIX)
+    {
+      rInsn.Size()++;
+      rInsn.SetOpcode(X86_Opcode_Altinst);
+      return true;
     }
-    return true;
+    else
+      return false;
 }
 
 /** instructions
@@ -4976,13 +4307,14 @@ bool X86Architecture::Table_2_4f(BinaryStream const& rBinStrm, OffsetType Offset
  * cpu_model: >= X86_Arch_Sse2
  *
 **/
-bool X86Architecture::Table_2_50(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_2_50(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_Sse2 && (rInsn.GetPrefix() & X86_Prefix_OpSize) == X86_Prefix_OpSize)
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Movmskpd);
-      if (Operand__Gy_Ux(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Gy_Ux<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -4992,7 +4324,7 @@ bool X86Architecture::Table_2_50(BinaryStream const& rBinStrm, OffsetType Offset
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Movmskps);
-      if (Operand__Gy_Ux(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Gy_Ux<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -5024,13 +4356,14 @@ bool X86Architecture::Table_2_50(BinaryStream const& rBinStrm, OffsetType Offset
  * cpu_model: >= X86_Arch_Sse2
  *
 **/
-bool X86Architecture::Table_2_51(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_2_51(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_Sse2 && (rInsn.GetPrefix() & X86_Prefix_RepNz) == X86_Prefix_RepNz)
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Sqrtsd);
-      if (Operand__Vo_Woq(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vo_Woq<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -5040,7 +4373,7 @@ bool X86Architecture::Table_2_51(BinaryStream const& rBinStrm, OffsetType Offset
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Sqrtss);
-      if (Operand__Vo_Wod(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vo_Wod<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -5050,7 +4383,7 @@ bool X86Architecture::Table_2_51(BinaryStream const& rBinStrm, OffsetType Offset
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Sqrtpsd);
-      if (Operand__Vx_Wx(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vx_Wx<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -5060,7 +4393,7 @@ bool X86Architecture::Table_2_51(BinaryStream const& rBinStrm, OffsetType Offset
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Sqrtps);
-      if (Operand__Vx_Wx(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vx_Wx<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -5082,13 +4415,14 @@ bool X86Architecture::Table_2_51(BinaryStream const& rBinStrm, OffsetType Offset
  * cpu_model: >= X86_Arch_Sse
  *
 **/
-bool X86Architecture::Table_2_52(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_2_52(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_Sse && (rInsn.GetPrefix() & X86_Prefix_Rep) == X86_Prefix_Rep)
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Rsqrtss);
-      if (Operand__Vo_Wod(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vo_Wod<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -5098,7 +4432,7 @@ bool X86Architecture::Table_2_52(BinaryStream const& rBinStrm, OffsetType Offset
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Rsqrtps);
-      if (Operand__Vx_Wx(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vx_Wx<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -5120,13 +4454,14 @@ bool X86Architecture::Table_2_52(BinaryStream const& rBinStrm, OffsetType Offset
  * cpu_model: >= X86_Arch_Sse
  *
 **/
-bool X86Architecture::Table_2_53(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_2_53(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_Sse && (rInsn.GetPrefix() & X86_Prefix_Rep) == X86_Prefix_Rep)
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Rcpss);
-      if (Operand__Vo_Wod(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vo_Wod<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -5136,7 +4471,7 @@ bool X86Architecture::Table_2_53(BinaryStream const& rBinStrm, OffsetType Offset
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Rcpps);
-      if (Operand__Vx_Wx(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vx_Wx<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -5158,13 +4493,14 @@ bool X86Architecture::Table_2_53(BinaryStream const& rBinStrm, OffsetType Offset
  * cpu_model: >= X86_Arch_Sse2
  *
 **/
-bool X86Architecture::Table_2_54(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_2_54(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_Sse2 && (rInsn.GetPrefix() & X86_Prefix_OpSize) == X86_Prefix_OpSize)
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Andpd);
-      if (Operand__Vx_Wx(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vx_Wx<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -5174,7 +4510,7 @@ bool X86Architecture::Table_2_54(BinaryStream const& rBinStrm, OffsetType Offset
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Andps);
-      if (Operand__Vx_Wx(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vx_Wx<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -5196,13 +4532,14 @@ bool X86Architecture::Table_2_54(BinaryStream const& rBinStrm, OffsetType Offset
  * cpu_model: >= X86_Arch_Sse2
  *
 **/
-bool X86Architecture::Table_2_55(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_2_55(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_Sse2 && (rInsn.GetPrefix() & X86_Prefix_OpSize) == X86_Prefix_OpSize)
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Andnpd);
-      if (Operand__Vx_Wx(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vx_Wx<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -5212,7 +4549,7 @@ bool X86Architecture::Table_2_55(BinaryStream const& rBinStrm, OffsetType Offset
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Andnps);
-      if (Operand__Vx_Wx(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vx_Wx<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -5234,13 +4571,14 @@ bool X86Architecture::Table_2_55(BinaryStream const& rBinStrm, OffsetType Offset
  * cpu_model: >= X86_Arch_Sse
  *
 **/
-bool X86Architecture::Table_2_56(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_2_56(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_Sse && (rInsn.GetPrefix() & X86_Prefix_OpSize) == X86_Prefix_OpSize)
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Orpd);
-      if (Operand__Vx_Wx(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vx_Wx<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -5250,7 +4588,7 @@ bool X86Architecture::Table_2_56(BinaryStream const& rBinStrm, OffsetType Offset
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Orps);
-      if (Operand__Vx_Wx(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vx_Wx<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -5264,9 +4602,9 @@ bool X86Architecture::Table_2_56(BinaryStream const& rBinStrm, OffsetType Offset
  *
  * mnemonic: xorps
  * operand: ['Vx', 'Wx']
+ * cpu_model: >= X86_Arch_Sse
  * semantic: op0.val ^= op1.val;
 
- * cpu_model: >= X86_Arch_Sse
  *
  * mnemonic: xorpd
  * operand: ['Vx', 'Wx']
@@ -5274,13 +4612,14 @@ bool X86Architecture::Table_2_56(BinaryStream const& rBinStrm, OffsetType Offset
  * cpu_model: >= X86_Arch_Sse2
  *
 **/
-bool X86Architecture::Table_2_57(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_2_57(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_Sse2 && (rInsn.GetPrefix() & X86_Prefix_OpSize) == X86_Prefix_OpSize)
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Xorpd);
-      if (Operand__Vx_Wx(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vx_Wx<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -5290,7 +4629,7 @@ bool X86Architecture::Table_2_57(BinaryStream const& rBinStrm, OffsetType Offset
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Xorps);
-      if (Operand__Vx_Wx(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vx_Wx<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -5326,12 +4665,12 @@ bool X86Architecture::Table_2_57(BinaryStream const& rBinStrm, OffsetType Offset
  * mnemonic: addss
  * operand: ['Vo', 'Wod']
  * prefix: f3
+ * cpu_model: >= X86_Arch_Sse
  * semantic: alloc_var('res', 32);
 res     = fadd(bit_cast(op0.val, int_type32), bit_cast(op1.val, int_type32));
 op0.val = clear_bits(op0.val, bit_cast(int(op0.bit, 0xffffffff), int_type(op0.bit))) | bit_cast(res, int_type(op0.bit));
 free_var('res');
 
- * cpu_model: >= X86_Arch_Sse
  *
  * mnemonic: addsd
  * operand: ['Vo', 'Woq']
@@ -5339,13 +4678,14 @@ free_var('res');
  * cpu_model: >= X86_Arch_Sse2
  *
 **/
-bool X86Architecture::Table_2_58(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_2_58(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_Sse2 && (rInsn.GetPrefix() & X86_Prefix_RepNz) == X86_Prefix_RepNz)
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Addsd);
-      if (Operand__Vo_Woq(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vo_Woq<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -5355,7 +4695,7 @@ bool X86Architecture::Table_2_58(BinaryStream const& rBinStrm, OffsetType Offset
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Addss);
-      if (Operand__Vo_Wod(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vo_Wod<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -5384,7 +4724,7 @@ bool X86Architecture::Table_2_58(BinaryStream const& rBinStrm, OffsetType Offset
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Addpd);
-      if (Operand__Vx_Wx(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vx_Wx<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -5394,7 +4734,7 @@ bool X86Architecture::Table_2_58(BinaryStream const& rBinStrm, OffsetType Offset
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Addps);
-      if (Operand__Vx_Wx(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vx_Wx<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -5418,12 +4758,12 @@ bool X86Architecture::Table_2_58(BinaryStream const& rBinStrm, OffsetType Offset
  * mnemonic: mulss
  * operand: ['Vo', 'Wod']
  * prefix: f3
+ * cpu_model: >= X86_Arch_Sse
  * semantic: alloc_var('res', 32);
 res     = fmul(bit_cast(op0.val, int_type32), bit_cast(op1.val, int_type32));
 op0.val = clear_bits(op0.val, bit_cast(int(op0.bit, 0xffffffff), int_type(op0.bit))) | bit_cast(res, int_type(op0.bit));
 free_var('res');
 
- * cpu_model: >= X86_Arch_Sse
  *
  * mnemonic: mulsd
  * operand: ['Vo', 'Woq']
@@ -5431,13 +4771,14 @@ free_var('res');
  * cpu_model: >= X86_Arch_Sse2
  *
 **/
-bool X86Architecture::Table_2_59(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_2_59(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_Sse2 && (rInsn.GetPrefix() & X86_Prefix_RepNz) == X86_Prefix_RepNz)
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Mulsd);
-      if (Operand__Vo_Woq(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vo_Woq<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -5447,7 +4788,7 @@ bool X86Architecture::Table_2_59(BinaryStream const& rBinStrm, OffsetType Offset
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Mulss);
-      if (Operand__Vo_Wod(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vo_Wod<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -5476,7 +4817,7 @@ bool X86Architecture::Table_2_59(BinaryStream const& rBinStrm, OffsetType Offset
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Mulpd);
-      if (Operand__Vx_Wx(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vx_Wx<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -5486,7 +4827,7 @@ bool X86Architecture::Table_2_59(BinaryStream const& rBinStrm, OffsetType Offset
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Mulps);
-      if (Operand__Vx_Wx(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vx_Wx<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -5518,13 +4859,14 @@ bool X86Architecture::Table_2_59(BinaryStream const& rBinStrm, OffsetType Offset
  * cpu_model: >= X86_Arch_Sse2
  *
 **/
-bool X86Architecture::Table_2_5a(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_2_5a(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_Sse2 && (rInsn.GetPrefix() & X86_Prefix_RepNz) == X86_Prefix_RepNz)
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Cvtsd2ss);
-      if (Operand__Vo_Woq(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vo_Woq<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -5534,7 +4876,7 @@ bool X86Architecture::Table_2_5a(BinaryStream const& rBinStrm, OffsetType Offset
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Cvtss2sd);
-      if (Operand__Vo_Wod(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vo_Wod<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -5544,7 +4886,7 @@ bool X86Architecture::Table_2_5a(BinaryStream const& rBinStrm, OffsetType Offset
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Cvtpd2ps);
-      if (Operand__Vx_Wx(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vx_Wx<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -5554,7 +4896,7 @@ bool X86Architecture::Table_2_5a(BinaryStream const& rBinStrm, OffsetType Offset
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Cvtps2pd);
-      if (Operand__Vx_Wx(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vx_Wx<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -5581,13 +4923,14 @@ bool X86Architecture::Table_2_5a(BinaryStream const& rBinStrm, OffsetType Offset
  * cpu_model: >= X86_Arch_Sse2
  *
 **/
-bool X86Architecture::Table_2_5b(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_2_5b(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_Sse2 && (rInsn.GetPrefix() & X86_Prefix_Rep) == X86_Prefix_Rep)
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Cvttps2dq);
-      if (Operand__Vx_Wx(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vx_Wx<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -5597,7 +4940,7 @@ bool X86Architecture::Table_2_5b(BinaryStream const& rBinStrm, OffsetType Offset
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Cvtps2dq);
-      if (Operand__Vx_Wx(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vx_Wx<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -5607,7 +4950,7 @@ bool X86Architecture::Table_2_5b(BinaryStream const& rBinStrm, OffsetType Offset
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Cvtdq2ps);
-      if (Operand__Vx_Wx(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vx_Wx<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -5639,13 +4982,14 @@ bool X86Architecture::Table_2_5b(BinaryStream const& rBinStrm, OffsetType Offset
  * cpu_model: >= X86_Arch_Sse2
  *
 **/
-bool X86Architecture::Table_2_5c(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_2_5c(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_Sse2 && (rInsn.GetPrefix() & X86_Prefix_RepNz) == X86_Prefix_RepNz)
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Subsd);
-      if (Operand__Vo_Woq(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vo_Woq<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -5655,7 +4999,7 @@ bool X86Architecture::Table_2_5c(BinaryStream const& rBinStrm, OffsetType Offset
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Subss);
-      if (Operand__Vo_Wod(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vo_Wod<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -5665,7 +5009,7 @@ bool X86Architecture::Table_2_5c(BinaryStream const& rBinStrm, OffsetType Offset
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Subpd);
-      if (Operand__Vx_Wx(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vx_Wx<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -5675,7 +5019,7 @@ bool X86Architecture::Table_2_5c(BinaryStream const& rBinStrm, OffsetType Offset
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Subps);
-      if (Operand__Vx_Wx(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vx_Wx<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -5707,13 +5051,14 @@ bool X86Architecture::Table_2_5c(BinaryStream const& rBinStrm, OffsetType Offset
  * cpu_model: >= X86_Arch_Sse2
  *
 **/
-bool X86Architecture::Table_2_5d(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_2_5d(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_Sse2 && (rInsn.GetPrefix() & X86_Prefix_RepNz) == X86_Prefix_RepNz)
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Minsd);
-      if (Operand__Vo_Woq(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vo_Woq<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -5723,7 +5068,7 @@ bool X86Architecture::Table_2_5d(BinaryStream const& rBinStrm, OffsetType Offset
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Minss);
-      if (Operand__Vo_Wod(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vo_Wod<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -5733,7 +5078,7 @@ bool X86Architecture::Table_2_5d(BinaryStream const& rBinStrm, OffsetType Offset
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Minpd);
-      if (Operand__Vx_Wx(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vx_Wx<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -5743,7 +5088,7 @@ bool X86Architecture::Table_2_5d(BinaryStream const& rBinStrm, OffsetType Offset
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Minps);
-      if (Operand__Vx_Wx(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vx_Wx<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -5775,13 +5120,14 @@ bool X86Architecture::Table_2_5d(BinaryStream const& rBinStrm, OffsetType Offset
  * cpu_model: >= X86_Arch_Sse2
  *
 **/
-bool X86Architecture::Table_2_5e(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_2_5e(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_Sse2 && (rInsn.GetPrefix() & X86_Prefix_RepNz) == X86_Prefix_RepNz)
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Divsd);
-      if (Operand__Vo_Woq(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vo_Woq<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -5791,7 +5137,7 @@ bool X86Architecture::Table_2_5e(BinaryStream const& rBinStrm, OffsetType Offset
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Divss);
-      if (Operand__Vo_Wod(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vo_Wod<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -5801,7 +5147,7 @@ bool X86Architecture::Table_2_5e(BinaryStream const& rBinStrm, OffsetType Offset
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Divpd);
-      if (Operand__Vx_Wx(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vx_Wx<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -5811,7 +5157,7 @@ bool X86Architecture::Table_2_5e(BinaryStream const& rBinStrm, OffsetType Offset
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Divps);
-      if (Operand__Vx_Wx(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vx_Wx<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -5843,13 +5189,14 @@ bool X86Architecture::Table_2_5e(BinaryStream const& rBinStrm, OffsetType Offset
  * cpu_model: >= X86_Arch_Sse2
  *
 **/
-bool X86Architecture::Table_2_5f(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_2_5f(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_Sse2 && (rInsn.GetPrefix() & X86_Prefix_RepNz) == X86_Prefix_RepNz)
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Maxsd);
-      if (Operand__Vo_Woq(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vo_Woq<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -5859,7 +5206,7 @@ bool X86Architecture::Table_2_5f(BinaryStream const& rBinStrm, OffsetType Offset
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Maxss);
-      if (Operand__Vo_Wod(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vo_Wod<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -5869,7 +5216,7 @@ bool X86Architecture::Table_2_5f(BinaryStream const& rBinStrm, OffsetType Offset
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Maxpd);
-      if (Operand__Vx_Wx(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vx_Wx<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -5879,7 +5226,7 @@ bool X86Architecture::Table_2_5f(BinaryStream const& rBinStrm, OffsetType Offset
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Maxps);
-      if (Operand__Vx_Wx(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vx_Wx<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -5901,13 +5248,14 @@ bool X86Architecture::Table_2_5f(BinaryStream const& rBinStrm, OffsetType Offset
  * cpu_model: >= X86_Arch_Sse2
  *
 **/
-bool X86Architecture::Table_2_60(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_2_60(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_Sse2 && (rInsn.GetPrefix() & X86_Prefix_OpSize) == X86_Prefix_OpSize)
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Pupcklbw);
-      if (Operand__Vx_Wx(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vx_Wx<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -5917,7 +5265,7 @@ bool X86Architecture::Table_2_60(BinaryStream const& rBinStrm, OffsetType Offset
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Punpcklbw);
-      if (Operand__Pq_Qd(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Pq_Qd<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -5939,13 +5287,14 @@ bool X86Architecture::Table_2_60(BinaryStream const& rBinStrm, OffsetType Offset
  * cpu_model: >= X86_Arch_Sse2
  *
 **/
-bool X86Architecture::Table_2_61(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_2_61(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_Sse2 && (rInsn.GetPrefix() & X86_Prefix_OpSize) == X86_Prefix_OpSize)
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Punpcklwd);
-      if (Operand__Vx_Wx(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vx_Wx<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -5955,7 +5304,7 @@ bool X86Architecture::Table_2_61(BinaryStream const& rBinStrm, OffsetType Offset
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Punpcklwd);
-      if (Operand__Pq_Qd(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Pq_Qd<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -5976,13 +5325,14 @@ bool X86Architecture::Table_2_61(BinaryStream const& rBinStrm, OffsetType Offset
  * cpu_model: >= X86_Arch_Sse2
  *
 **/
-bool X86Architecture::Table_2_62(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_2_62(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_Sse2)
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Pupckldq);
-      if (Operand__Vx_Wx(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vx_Wx<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -5992,7 +5342,7 @@ bool X86Architecture::Table_2_62(BinaryStream const& rBinStrm, OffsetType Offset
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Punpckldq);
-      if (Operand__Pq_Qd(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Pq_Qd<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -6014,13 +5364,14 @@ bool X86Architecture::Table_2_62(BinaryStream const& rBinStrm, OffsetType Offset
  * cpu_model: >= X86_Arch_Sse2
  *
 **/
-bool X86Architecture::Table_2_63(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_2_63(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_Sse2 && (rInsn.GetPrefix() & X86_Prefix_OpSize) == X86_Prefix_OpSize)
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Packsswb);
-      if (Operand__Vx_Wx(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vx_Wx<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -6030,7 +5381,7 @@ bool X86Architecture::Table_2_63(BinaryStream const& rBinStrm, OffsetType Offset
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Packsswb);
-      if (Operand__Pq_Qq(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Pq_Qq<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -6052,13 +5403,14 @@ bool X86Architecture::Table_2_63(BinaryStream const& rBinStrm, OffsetType Offset
  * cpu_model: >= X86_Arch_Sse2
  *
 **/
-bool X86Architecture::Table_2_64(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_2_64(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_Sse2 && (rInsn.GetPrefix() & X86_Prefix_OpSize) == X86_Prefix_OpSize)
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Pcmpgtb);
-      if (Operand__Vx_Wx(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vx_Wx<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -6068,7 +5420,7 @@ bool X86Architecture::Table_2_64(BinaryStream const& rBinStrm, OffsetType Offset
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Pcmpgtb);
-      if (Operand__Pq_Qq(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Pq_Qq<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -6090,13 +5442,14 @@ bool X86Architecture::Table_2_64(BinaryStream const& rBinStrm, OffsetType Offset
  * cpu_model: >= X86_Arch_Sse2
  *
 **/
-bool X86Architecture::Table_2_65(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_2_65(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_Sse2 && (rInsn.GetPrefix() & X86_Prefix_OpSize) == X86_Prefix_OpSize)
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Pcmpgtw);
-      if (Operand__Vx_Wx(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vx_Wx<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -6106,7 +5459,7 @@ bool X86Architecture::Table_2_65(BinaryStream const& rBinStrm, OffsetType Offset
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Pcmpgtw);
-      if (Operand__Pq_Qq(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Pq_Qq<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -6128,13 +5481,14 @@ bool X86Architecture::Table_2_65(BinaryStream const& rBinStrm, OffsetType Offset
  * cpu_model: >= X86_Arch_Sse2
  *
 **/
-bool X86Architecture::Table_2_66(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_2_66(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_Sse2 && (rInsn.GetPrefix() & X86_Prefix_OpSize) == X86_Prefix_OpSize)
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Cmpgtd);
-      if (Operand__Vx_Wx(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vx_Wx<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -6144,7 +5498,7 @@ bool X86Architecture::Table_2_66(BinaryStream const& rBinStrm, OffsetType Offset
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Pcmpgtd);
-      if (Operand__Pq_Qq(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Pq_Qq<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -6166,13 +5520,14 @@ bool X86Architecture::Table_2_66(BinaryStream const& rBinStrm, OffsetType Offset
  * cpu_model: >= X86_Arch_Sse2
  *
 **/
-bool X86Architecture::Table_2_67(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_2_67(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_Sse2 && (rInsn.GetPrefix() & X86_Prefix_OpSize) == X86_Prefix_OpSize)
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Packuswb);
-      if (Operand__Vx_Wx(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vx_Wx<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -6182,7 +5537,7 @@ bool X86Architecture::Table_2_67(BinaryStream const& rBinStrm, OffsetType Offset
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Packuswb);
-      if (Operand__Pq_Qq(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Pq_Qq<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -6204,13 +5559,14 @@ bool X86Architecture::Table_2_67(BinaryStream const& rBinStrm, OffsetType Offset
  * cpu_model: >= X86_Arch_Sse2
  *
 **/
-bool X86Architecture::Table_2_68(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_2_68(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_Sse2 && (rInsn.GetPrefix() & X86_Prefix_OpSize) == X86_Prefix_OpSize)
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Punpckhbw);
-      if (Operand__Hx_Hx_Wx(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Hx_Hx_Wx<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -6220,7 +5576,7 @@ bool X86Architecture::Table_2_68(BinaryStream const& rBinStrm, OffsetType Offset
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Punpckhbw);
-      if (Operand__Pq_Qq(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Pq_Qq<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -6242,13 +5598,14 @@ bool X86Architecture::Table_2_68(BinaryStream const& rBinStrm, OffsetType Offset
  * cpu_model: >= X86_Arch_Sse2
  *
 **/
-bool X86Architecture::Table_2_69(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_2_69(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_Sse2 && (rInsn.GetPrefix() & X86_Prefix_OpSize) == X86_Prefix_OpSize)
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Punpckhwd);
-      if (Operand__Vx_Wx(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vx_Wx<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -6258,7 +5615,7 @@ bool X86Architecture::Table_2_69(BinaryStream const& rBinStrm, OffsetType Offset
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Punpckhwd);
-      if (Operand__Pq_Qq(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Pq_Qq<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -6280,13 +5637,14 @@ bool X86Architecture::Table_2_69(BinaryStream const& rBinStrm, OffsetType Offset
  * cpu_model: >= X86_Arch_Sse2
  *
 **/
-bool X86Architecture::Table_2_6a(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_2_6a(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_Sse2 && (rInsn.GetPrefix() & X86_Prefix_OpSize) == X86_Prefix_OpSize)
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Punpckhdq);
-      if (Operand__Vx_Wx(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vx_Wx<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -6296,7 +5654,7 @@ bool X86Architecture::Table_2_6a(BinaryStream const& rBinStrm, OffsetType Offset
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Punpckhdq);
-      if (Operand__Pq_Qq(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Pq_Qq<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -6318,13 +5676,14 @@ bool X86Architecture::Table_2_6a(BinaryStream const& rBinStrm, OffsetType Offset
  * cpu_model: >= X86_Arch_Sse2
  *
 **/
-bool X86Architecture::Table_2_6b(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_2_6b(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_Sse2 && (rInsn.GetPrefix() & X86_Prefix_OpSize) == X86_Prefix_OpSize)
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Packssdw);
-      if (Operand__Vx_Wx(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vx_Wx<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -6334,7 +5693,7 @@ bool X86Architecture::Table_2_6b(BinaryStream const& rBinStrm, OffsetType Offset
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Packssdw);
-      if (Operand__Pq_Qq(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Pq_Qq<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -6354,13 +5713,14 @@ bool X86Architecture::Table_2_6b(BinaryStream const& rBinStrm, OffsetType Offset
  * cpu_model: >= X86_Arch_Sse2
  *
 **/
-bool X86Architecture::Table_2_6c(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_2_6c(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_Sse2 && (rInsn.GetPrefix() & X86_Prefix_OpSize) == X86_Prefix_OpSize)
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Punpcklqdq);
-      if (Operand__Vx_Wx(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vx_Wx<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -6383,13 +5743,14 @@ bool X86Architecture::Table_2_6c(BinaryStream const& rBinStrm, OffsetType Offset
  * cpu_model: >= X86_Arch_Sse2
  *
 **/
-bool X86Architecture::Table_2_6d(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_2_6d(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_Sse2 && (rInsn.GetPrefix() & X86_Prefix_OpSize) == X86_Prefix_OpSize)
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Punpckhqdq);
-      if (Operand__Vx_Wx(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vx_Wx<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -6414,13 +5775,13 @@ bool X86Architecture::Table_2_6d(BinaryStream const& rBinStrm, OffsetType Offset
  *
  * mnemonic: movd
  * operand: ['Vo', 'Ed']
+ * attr: ['op_size']
+ * cpu_model: >= X86_Arch_Sse2
  * semantic: if __code and is_dword_operation:
   op0.val = bit_cast(op1.val, int_type32);
 if __code and is_oword_operation:
   op0.val = bit_cast(op1.val, int_type128);
 
- * attr: ['op_size']
- * cpu_model: >= X86_Arch_Sse2
  *
  * mnemonic: movq
  * operand: ['Vo', 'Ey']
@@ -6428,13 +5789,14 @@ if __code and is_oword_operation:
  * cpu_model: >= X86_Arch_Sse2
  *
 **/
-bool X86Architecture::Table_2_6e(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_2_6e(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_Sse2 && Mode == X86_Bit_64 && (rInsn.GetPrefix() & X86_Prefix_REX_w) == X86_Prefix_REX_w && (rInsn.GetPrefix() & X86_Prefix_OpSize))
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Movq);
-      if (Operand__Vo_Ey(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vo_Ey<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -6444,7 +5806,7 @@ bool X86Architecture::Table_2_6e(BinaryStream const& rBinStrm, OffsetType Offset
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Movd);
-      if (Operand__Vo_Ed(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vo_Ed<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -6476,7 +5838,7 @@ bool X86Architecture::Table_2_6e(BinaryStream const& rBinStrm, OffsetType Offset
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Movq);
-      if (Operand__Pq_Ey(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Pq_Ey<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -6486,7 +5848,7 @@ bool X86Architecture::Table_2_6e(BinaryStream const& rBinStrm, OffsetType Offset
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Movd);
-      if (Operand__Pq_Ey(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Pq_Ey<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -6510,18 +5872,19 @@ bool X86Architecture::Table_2_6e(BinaryStream const& rBinStrm, OffsetType Offset
  * mnemonic: movdqu
  * operand: ['Vx', 'Wx']
  * prefix: f3
+ * cpu_model: >= X86_Arch_Sse
  * semantic: op0.val = op1.val;
 
- * cpu_model: >= X86_Arch_Sse
  *
 **/
-bool X86Architecture::Table_2_6f(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_2_6f(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_Sse && (rInsn.GetPrefix() & X86_Prefix_Rep) == X86_Prefix_Rep)
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Movdqu);
-      if (Operand__Vx_Wx(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vx_Wx<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -6539,7 +5902,7 @@ bool X86Architecture::Table_2_6f(BinaryStream const& rBinStrm, OffsetType Offset
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Modqa);
-      if (Operand__Vx_Wx(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vx_Wx<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -6549,7 +5912,7 @@ bool X86Architecture::Table_2_6f(BinaryStream const& rBinStrm, OffsetType Offset
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Movq);
-      if (Operand__Pq_Qq(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Pq_Qq<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -6581,13 +5944,14 @@ bool X86Architecture::Table_2_6f(BinaryStream const& rBinStrm, OffsetType Offset
  * cpu_model: >= X86_Arch_Sse2
  *
 **/
-bool X86Architecture::Table_2_70(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_2_70(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_Sse2 && (rInsn.GetPrefix() & X86_Prefix_RepNz) == X86_Prefix_RepNz)
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Pshuflw);
-      if (Operand__Vx_Wx_Ib(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vx_Wx_Ib<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -6597,7 +5961,7 @@ bool X86Architecture::Table_2_70(BinaryStream const& rBinStrm, OffsetType Offset
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Pshufhw);
-      if (Operand__Vx_Wx_Ib(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vx_Wx_Ib<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -6607,7 +5971,7 @@ bool X86Architecture::Table_2_70(BinaryStream const& rBinStrm, OffsetType Offset
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Pshufd);
-      if (Operand__Vx_Wx_Ib(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vx_Wx_Ib<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -6617,7 +5981,7 @@ bool X86Architecture::Table_2_70(BinaryStream const& rBinStrm, OffsetType Offset
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Pshufw);
-      if (Operand__Pq_Qq_Ib(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Pq_Qq_Ib<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -6652,7 +6016,8 @@ bool X86Architecture::Table_2_70(BinaryStream const& rBinStrm, OffsetType Offset
  * invalid
  *
 **/
-bool X86Architecture::Table_2_71(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_2_71(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     u8 ModRmByte;
     if (!rBinStrm.Read(Offset, ModRmByte))
@@ -6670,7 +6035,7 @@ bool X86Architecture::Table_2_71(BinaryStream const& rBinStrm, OffsetType Offset
       {
         rInsn.Size()++;
         rInsn.SetOpcode(X86_Opcode_Psrlw);
-        if (Operand__Ux_Ib(rBinStrm, Offset, rInsn, Mode) == false)
+        if (Operand__Ux_Ib<Mode>(rBinStrm, Offset, rInsn) == false)
         {
           return false;
         }
@@ -6680,7 +6045,7 @@ bool X86Architecture::Table_2_71(BinaryStream const& rBinStrm, OffsetType Offset
       {
         rInsn.Size()++;
         rInsn.SetOpcode(X86_Opcode_Psrlw);
-        if (Operand__Nq_Ib(rBinStrm, Offset, rInsn, Mode) == false)
+        if (Operand__Nq_Ib<Mode>(rBinStrm, Offset, rInsn) == false)
         {
           return false;
         }
@@ -6693,7 +6058,7 @@ bool X86Architecture::Table_2_71(BinaryStream const& rBinStrm, OffsetType Offset
       {
         rInsn.Size()++;
         rInsn.SetOpcode(X86_Opcode_Psraw);
-        if (Operand__Ux_Ib(rBinStrm, Offset, rInsn, Mode) == false)
+        if (Operand__Ux_Ib<Mode>(rBinStrm, Offset, rInsn) == false)
         {
           return false;
         }
@@ -6703,7 +6068,7 @@ bool X86Architecture::Table_2_71(BinaryStream const& rBinStrm, OffsetType Offset
       {
         rInsn.Size()++;
         rInsn.SetOpcode(X86_Opcode_Psraw);
-        if (Operand__Nq_Ib(rBinStrm, Offset, rInsn, Mode) == false)
+        if (Operand__Nq_Ib<Mode>(rBinStrm, Offset, rInsn) == false)
         {
           return false;
         }
@@ -6716,7 +6081,7 @@ bool X86Architecture::Table_2_71(BinaryStream const& rBinStrm, OffsetType Offset
       {
         rInsn.Size()++;
         rInsn.SetOpcode(X86_Opcode_Psllw);
-        if (Operand__Ux_Ib(rBinStrm, Offset, rInsn, Mode) == false)
+        if (Operand__Ux_Ib<Mode>(rBinStrm, Offset, rInsn) == false)
         {
           return false;
         }
@@ -6726,7 +6091,7 @@ bool X86Architecture::Table_2_71(BinaryStream const& rBinStrm, OffsetType Offset
       {
         rInsn.Size()++;
         rInsn.SetOpcode(X86_Opcode_Psllw);
-        if (Operand__Nq_Ib(rBinStrm, Offset, rInsn, Mode) == false)
+        if (Operand__Nq_Ib<Mode>(rBinStrm, Offset, rInsn) == false)
         {
           return false;
         }
@@ -6765,7 +6130,8 @@ bool X86Architecture::Table_2_71(BinaryStream const& rBinStrm, OffsetType Offset
  * invalid
  *
 **/
-bool X86Architecture::Table_2_72(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_2_72(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     u8 ModRmByte;
     if (!rBinStrm.Read(Offset, ModRmByte))
@@ -6783,7 +6149,7 @@ bool X86Architecture::Table_2_72(BinaryStream const& rBinStrm, OffsetType Offset
       {
         rInsn.Size()++;
         rInsn.SetOpcode(X86_Opcode_Psrld);
-        if (Operand__Ux_Ib(rBinStrm, Offset, rInsn, Mode) == false)
+        if (Operand__Ux_Ib<Mode>(rBinStrm, Offset, rInsn) == false)
         {
           return false;
         }
@@ -6793,7 +6159,7 @@ bool X86Architecture::Table_2_72(BinaryStream const& rBinStrm, OffsetType Offset
       {
         rInsn.Size()++;
         rInsn.SetOpcode(X86_Opcode_Psrld);
-        if (Operand__Nq_Ib(rBinStrm, Offset, rInsn, Mode) == false)
+        if (Operand__Nq_Ib<Mode>(rBinStrm, Offset, rInsn) == false)
         {
           return false;
         }
@@ -6806,7 +6172,7 @@ bool X86Architecture::Table_2_72(BinaryStream const& rBinStrm, OffsetType Offset
       {
         rInsn.Size()++;
         rInsn.SetOpcode(X86_Opcode_Psrad);
-        if (Operand__Ux_Ib(rBinStrm, Offset, rInsn, Mode) == false)
+        if (Operand__Ux_Ib<Mode>(rBinStrm, Offset, rInsn) == false)
         {
           return false;
         }
@@ -6816,7 +6182,7 @@ bool X86Architecture::Table_2_72(BinaryStream const& rBinStrm, OffsetType Offset
       {
         rInsn.Size()++;
         rInsn.SetOpcode(X86_Opcode_Psrad);
-        if (Operand__Nq_Ib(rBinStrm, Offset, rInsn, Mode) == false)
+        if (Operand__Nq_Ib<Mode>(rBinStrm, Offset, rInsn) == false)
         {
           return false;
         }
@@ -6829,7 +6195,7 @@ bool X86Architecture::Table_2_72(BinaryStream const& rBinStrm, OffsetType Offset
       {
         rInsn.Size()++;
         rInsn.SetOpcode(X86_Opcode_Pslld);
-        if (Operand__Ux_Ib(rBinStrm, Offset, rInsn, Mode) == false)
+        if (Operand__Ux_Ib<Mode>(rBinStrm, Offset, rInsn) == false)
         {
           return false;
         }
@@ -6839,7 +6205,7 @@ bool X86Architecture::Table_2_72(BinaryStream const& rBinStrm, OffsetType Offset
       {
         rInsn.Size()++;
         rInsn.SetOpcode(X86_Opcode_Pslld);
-        if (Operand__Nq_Ib(rBinStrm, Offset, rInsn, Mode) == false)
+        if (Operand__Nq_Ib<Mode>(rBinStrm, Offset, rInsn) == false)
         {
           return false;
         }
@@ -6878,7 +6244,8 @@ bool X86Architecture::Table_2_72(BinaryStream const& rBinStrm, OffsetType Offset
  * sub_opcodes: [{'invalid': None}, {'mnemonic': 'pslldq', 'operand': ['Ux', 'Ib'], 'prefix': 102}]
  *
 **/
-bool X86Architecture::Table_2_73(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_2_73(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     u8 ModRmByte;
     if (!rBinStrm.Read(Offset, ModRmByte))
@@ -6896,7 +6263,7 @@ bool X86Architecture::Table_2_73(BinaryStream const& rBinStrm, OffsetType Offset
       {
         rInsn.Size()++;
         rInsn.SetOpcode(X86_Opcode_Psrlq);
-        if (Operand__Ux_Ib(rBinStrm, Offset, rInsn, Mode) == false)
+        if (Operand__Ux_Ib<Mode>(rBinStrm, Offset, rInsn) == false)
         {
           return false;
         }
@@ -6906,7 +6273,7 @@ bool X86Architecture::Table_2_73(BinaryStream const& rBinStrm, OffsetType Offset
       {
         rInsn.Size()++;
         rInsn.SetOpcode(X86_Opcode_Psrlq);
-        if (Operand__Nq_Ib(rBinStrm, Offset, rInsn, Mode) == false)
+        if (Operand__Nq_Ib<Mode>(rBinStrm, Offset, rInsn) == false)
         {
           return false;
         }
@@ -6917,7 +6284,7 @@ bool X86Architecture::Table_2_73(BinaryStream const& rBinStrm, OffsetType Offset
       {
         rInsn.Size()++;
         rInsn.SetOpcode(X86_Opcode_Psrldq);
-        if (Operand__Ux_Ib(rBinStrm, Offset, rInsn, Mode) == false)
+        if (Operand__Ux_Ib<Mode>(rBinStrm, Offset, rInsn) == false)
         {
           return false;
         }
@@ -6936,7 +6303,7 @@ bool X86Architecture::Table_2_73(BinaryStream const& rBinStrm, OffsetType Offset
       {
         rInsn.Size()++;
         rInsn.SetOpcode(X86_Opcode_Psllq);
-        if (Operand__Ux_Ib(rBinStrm, Offset, rInsn, Mode) == false)
+        if (Operand__Ux_Ib<Mode>(rBinStrm, Offset, rInsn) == false)
         {
           return false;
         }
@@ -6946,7 +6313,7 @@ bool X86Architecture::Table_2_73(BinaryStream const& rBinStrm, OffsetType Offset
       {
         rInsn.Size()++;
         rInsn.SetOpcode(X86_Opcode_Psllq);
-        if (Operand__Nq_Ib(rBinStrm, Offset, rInsn, Mode) == false)
+        if (Operand__Nq_Ib<Mode>(rBinStrm, Offset, rInsn) == false)
         {
           return false;
         }
@@ -6957,7 +6324,7 @@ bool X86Architecture::Table_2_73(BinaryStream const& rBinStrm, OffsetType Offset
       {
         rInsn.Size()++;
         rInsn.SetOpcode(X86_Opcode_Pslldq);
-        if (Operand__Ux_Ib(rBinStrm, Offset, rInsn, Mode) == false)
+        if (Operand__Ux_Ib<Mode>(rBinStrm, Offset, rInsn) == false)
         {
           return false;
         }
@@ -6985,13 +6352,14 @@ bool X86Architecture::Table_2_73(BinaryStream const& rBinStrm, OffsetType Offset
  * cpu_model: >= X86_Arch_Sse2
  *
 **/
-bool X86Architecture::Table_2_74(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_2_74(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_Sse2 && (rInsn.GetPrefix() & X86_Prefix_OpSize) == X86_Prefix_OpSize)
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Pcmpeqb);
-      if (Operand__Vx_Wx(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vx_Wx<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -7001,7 +6369,7 @@ bool X86Architecture::Table_2_74(BinaryStream const& rBinStrm, OffsetType Offset
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Pcmpeqb);
-      if (Operand__Pq_Qq(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Pq_Qq<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -7023,13 +6391,14 @@ bool X86Architecture::Table_2_74(BinaryStream const& rBinStrm, OffsetType Offset
  * cpu_model: >= X86_Arch_Sse2
  *
 **/
-bool X86Architecture::Table_2_75(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_2_75(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_Sse2 && (rInsn.GetPrefix() & X86_Prefix_OpSize) == X86_Prefix_OpSize)
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Pcmpeqw);
-      if (Operand__Vx_Wx(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vx_Wx<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -7039,7 +6408,7 @@ bool X86Architecture::Table_2_75(BinaryStream const& rBinStrm, OffsetType Offset
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Pcmpeqw);
-      if (Operand__Pq_Qq(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Pq_Qq<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -7061,13 +6430,14 @@ bool X86Architecture::Table_2_75(BinaryStream const& rBinStrm, OffsetType Offset
  * cpu_model: >= X86_Arch_Sse2
  *
 **/
-bool X86Architecture::Table_2_76(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_2_76(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_Sse2 && (rInsn.GetPrefix() & X86_Prefix_OpSize) == X86_Prefix_OpSize)
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Pcmpeqd);
-      if (Operand__Vx_Wx(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vx_Wx<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -7077,7 +6447,7 @@ bool X86Architecture::Table_2_76(BinaryStream const& rBinStrm, OffsetType Offset
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Pcmpeqd);
-      if (Operand__Pq_Qq(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Pq_Qq<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -7096,7 +6466,8 @@ bool X86Architecture::Table_2_76(BinaryStream const& rBinStrm, OffsetType Offset
  * cpu_model: >= X86_Arch_Avx
  *
 **/
-bool X86Architecture::Table_2_77(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_2_77(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_Avx)
     {
@@ -7125,13 +6496,14 @@ bool X86Architecture::Table_2_77(BinaryStream const& rBinStrm, OffsetType Offset
  * cpu_model: >= X86_Arch_Sse4a
  *
 **/
-bool X86Architecture::Table_2_78(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_2_78(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_Sse4a && (rInsn.GetPrefix() & X86_Prefix_OpSize) == X86_Prefix_OpSize)
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Extrq);
-      if (Operand__Uo_Ib_Ib(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Uo_Ib_Ib<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -7141,7 +6513,7 @@ bool X86Architecture::Table_2_78(BinaryStream const& rBinStrm, OffsetType Offset
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Mread);
-      if (Operand__Ey_Gy(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Ey_Gy<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -7161,13 +6533,14 @@ bool X86Architecture::Table_2_78(BinaryStream const& rBinStrm, OffsetType Offset
  * cpu_model: >= X86_Arch_Sse4a
  *
 **/
-bool X86Architecture::Table_2_79(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_2_79(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_Sse4a && (rInsn.GetPrefix() & X86_Prefix_OpSize) == X86_Prefix_OpSize)
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Extrq);
-      if (Operand__Vo_Uo(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vo_Uo<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -7177,7 +6550,7 @@ bool X86Architecture::Table_2_79(BinaryStream const& rBinStrm, OffsetType Offset
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Vmwrite);
-      if (Operand__Gy_Ey(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Gy_Ey<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -7187,36 +6560,38 @@ bool X86Architecture::Table_2_79(BinaryStream const& rBinStrm, OffsetType Offset
 
 /** instruction
  * opcode: 7a
- * attr: ['amd']
  * reference: table_sse5a
+ * attr: ['amd']
 **/
-bool X86Architecture::Table_2_7a(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_2_7a(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     u8 Opcode;
     if (!rBinStrm.Read(Offset, Opcode))
       return false;
 
     rInsn.Size()++;
-    if (Opcode + 1 > sizeof(m_Table_sse5a))
+    if (Opcode >= sizeof(m_Table_sse5a) / sizeof(*m_Table_sse5a))
       return false;
-    return (this->*m_Table_sse5a[Opcode])(rBinStrm, Offset + 1, rInsn, Mode);
+    return _Decode<Mode>(m_Table_sse5a[Opcode], rBinStrm, Offset + 1, rInsn);
 }
 
 /** instruction
  * opcode: 7b
- * attr: ['amd']
  * reference: table_sse5a
+ * attr: ['amd']
 **/
-bool X86Architecture::Table_2_7b(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_2_7b(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     u8 Opcode;
     if (!rBinStrm.Read(Offset, Opcode))
       return false;
 
     rInsn.Size()++;
-    if (Opcode + 1 > sizeof(m_Table_sse5a))
+    if (Opcode >= sizeof(m_Table_sse5a) / sizeof(*m_Table_sse5a))
       return false;
-    return (this->*m_Table_sse5a[Opcode])(rBinStrm, Offset + 1, rInsn, Mode);
+    return _Decode<Mode>(m_Table_sse5a[Opcode], rBinStrm, Offset + 1, rInsn);
 }
 
 /** instructions
@@ -7235,13 +6610,14 @@ bool X86Architecture::Table_2_7b(BinaryStream const& rBinStrm, OffsetType Offset
  * cpu_model: >= X86_Arch_Sse3
  *
 **/
-bool X86Architecture::Table_2_7c(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_2_7c(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_Sse3 && (rInsn.GetPrefix() & X86_Prefix_RepNz) == X86_Prefix_RepNz)
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Haddps);
-      if (Operand__Vx_Wx(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vx_Wx<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -7251,7 +6627,7 @@ bool X86Architecture::Table_2_7c(BinaryStream const& rBinStrm, OffsetType Offset
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Haddpd);
-      if (Operand__Vx_Wx(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vx_Wx<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -7279,13 +6655,14 @@ bool X86Architecture::Table_2_7c(BinaryStream const& rBinStrm, OffsetType Offset
  * cpu_model: >= X86_Arch_Sse3
  *
 **/
-bool X86Architecture::Table_2_7d(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_2_7d(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_Sse3 && (rInsn.GetPrefix() & X86_Prefix_RepNz) == X86_Prefix_RepNz)
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Hsubps);
-      if (Operand__Vx_Wx(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vx_Wx<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -7295,7 +6672,7 @@ bool X86Architecture::Table_2_7d(BinaryStream const& rBinStrm, OffsetType Offset
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Hsubpd);
-      if (Operand__Vx_Wx(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vx_Wx<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -7316,13 +6693,13 @@ bool X86Architecture::Table_2_7d(BinaryStream const& rBinStrm, OffsetType Offset
  *
  * mnemonic: movd
  * operand: ['Ed', 'Vo']
+ * attr: ['op_size']
+ * cpu_model: >= X86_Arch_Sse2
  * semantic: if __code and is_dword_operation:
   op0.val = bit_cast(op1.val, int_type32);
 if __code and is_oword_operation:
   op0.val = bit_cast(op1.val, int_type128);
 
- * attr: ['op_size']
- * cpu_model: >= X86_Arch_Sse2
  *
  * mnemonic: movq
  * operand: ['Vo', 'Woq']
@@ -7330,13 +6707,14 @@ if __code and is_oword_operation:
  * cpu_model: >= X86_Arch_Sse2
  *
 **/
-bool X86Architecture::Table_2_7e(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_2_7e(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_Sse2 && (rInsn.GetPrefix() & X86_Prefix_Rep))
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Movq);
-      if (Operand__Vo_Woq(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vo_Woq<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -7346,7 +6724,7 @@ bool X86Architecture::Table_2_7e(BinaryStream const& rBinStrm, OffsetType Offset
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Movd);
-      if (Operand__Ed_Vo(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Ed_Vo<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -7378,7 +6756,7 @@ bool X86Architecture::Table_2_7e(BinaryStream const& rBinStrm, OffsetType Offset
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Movd);
-      if (Operand__Ey_Pq(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Ey_Pq<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -7401,19 +6779,20 @@ bool X86Architecture::Table_2_7e(BinaryStream const& rBinStrm, OffsetType Offset
  *
  * mnemonic: movdqu
  * operand: ['Wx', 'Vx']
- * semantic: op0.val = op1.val;
-
  * attr: ['rep']
  * cpu_model: >= X86_Arch_Sse2
+ * semantic: op0.val = op1.val;
+
  *
 **/
-bool X86Architecture::Table_2_7f(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_2_7f(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_Sse2 && (rInsn.GetPrefix() & X86_Prefix_Rep))
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Movdqu);
-      if (Operand__Wx_Vx(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Wx_Vx<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -7431,7 +6810,7 @@ bool X86Architecture::Table_2_7f(BinaryStream const& rBinStrm, OffsetType Offset
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Movdqa);
-      if (Operand__Wx_Vx(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Wx_Vx<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -7441,7 +6820,7 @@ bool X86Architecture::Table_2_7f(BinaryStream const& rBinStrm, OffsetType Offset
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Movq);
-      if (Operand__Qq_Pq(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Qq_Pq<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -7451,17 +6830,18 @@ bool X86Architecture::Table_2_7f(BinaryStream const& rBinStrm, OffsetType Offset
 }
 
 /** instruction
+ * opcode: 80
  * mnemonic: jo
- * semantic: if __expr and of.id == int1(1): program.id = op0.val;
-
- * constraint: df64
- * cpu_model: >= X86_Arch_80386
  * operand: ['Jz']
- * test_flags: ['of']
- * opcode: 80
+ * constraint: df64
  * operation_type: ['jmp', 'cond']
+ * test_flags: ['of']
+ * cpu_model: >= X86_Arch_80386
+ * semantic: if __expr and of.id == int1(1): program.id = op0.val;
+
 **/
-bool X86Architecture::Table_2_80(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_2_80(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_80386)
     {
@@ -7472,7 +6852,7 @@ bool X86Architecture::Table_2_80(BinaryStream const& rBinStrm, OffsetType Offset
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Jo);
       rInsn.SubType() |= Instruction::JumpType | Instruction::ConditionalType;
-      if (Operand__Jz(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Jz<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -7497,17 +6877,18 @@ bool X86Architecture::Table_2_80(BinaryStream const& rBinStrm, OffsetType Offset
 }
 
 /** instruction
+ * opcode: 81
  * mnemonic: jno
- * semantic: if __expr and of.id == int1(0): program.id = op0.val;
-
- * constraint: df64
- * cpu_model: >= X86_Arch_80386
  * operand: ['Jz']
- * test_flags: ['of']
- * opcode: 81
+ * constraint: df64
  * operation_type: ['jmp', 'cond']
+ * test_flags: ['of']
+ * cpu_model: >= X86_Arch_80386
+ * semantic: if __expr and of.id == int1(0): program.id = op0.val;
+
 **/
-bool X86Architecture::Table_2_81(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_2_81(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_80386)
     {
@@ -7518,7 +6899,7 @@ bool X86Architecture::Table_2_81(BinaryStream const& rBinStrm, OffsetType Offset
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Jno);
       rInsn.SubType() |= Instruction::JumpType | Instruction::ConditionalType;
-      if (Operand__Jz(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Jz<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -7543,17 +6924,18 @@ bool X86Architecture::Table_2_81(BinaryStream const& rBinStrm, OffsetType Offset
 }
 
 /** instruction
+ * opcode: 82
  * mnemonic: jb
- * semantic: if __expr and cf.id == int1(1): program.id = op0.val;
-
- * constraint: df64
- * cpu_model: >= X86_Arch_80386
  * operand: ['Jz']
- * test_flags: ['cf']
- * opcode: 82
+ * constraint: df64
  * operation_type: ['jmp', 'cond']
+ * test_flags: ['cf']
+ * cpu_model: >= X86_Arch_80386
+ * semantic: if __expr and cf.id == int1(1): program.id = op0.val;
+
 **/
-bool X86Architecture::Table_2_82(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_2_82(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_80386)
     {
@@ -7564,7 +6946,7 @@ bool X86Architecture::Table_2_82(BinaryStream const& rBinStrm, OffsetType Offset
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Jb);
       rInsn.SubType() |= Instruction::JumpType | Instruction::ConditionalType;
-      if (Operand__Jz(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Jz<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -7589,17 +6971,18 @@ bool X86Architecture::Table_2_82(BinaryStream const& rBinStrm, OffsetType Offset
 }
 
 /** instruction
+ * opcode: 83
  * mnemonic: jnb
- * semantic: if __expr and cf.id == int1(0): program.id = op0.val;
-
- * constraint: df64
- * cpu_model: >= X86_Arch_80386
  * operand: ['Jz']
- * test_flags: ['cf']
- * opcode: 83
+ * constraint: df64
  * operation_type: ['jmp', 'cond']
+ * test_flags: ['cf']
+ * cpu_model: >= X86_Arch_80386
+ * semantic: if __expr and cf.id == int1(0): program.id = op0.val;
+
 **/
-bool X86Architecture::Table_2_83(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_2_83(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_80386)
     {
@@ -7610,7 +6993,7 @@ bool X86Architecture::Table_2_83(BinaryStream const& rBinStrm, OffsetType Offset
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Jnb);
       rInsn.SubType() |= Instruction::JumpType | Instruction::ConditionalType;
-      if (Operand__Jz(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Jz<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -7635,17 +7018,18 @@ bool X86Architecture::Table_2_83(BinaryStream const& rBinStrm, OffsetType Offset
 }
 
 /** instruction
+ * opcode: 84
  * mnemonic: jz
- * semantic: if __expr and zf.id == int1(1): program.id = op0.val;
-
- * constraint: df64
- * cpu_model: >= X86_Arch_80386
  * operand: ['Jz']
- * test_flags: ['zf']
- * opcode: 84
+ * constraint: df64
  * operation_type: ['jmp', 'cond']
+ * test_flags: ['zf']
+ * cpu_model: >= X86_Arch_80386
+ * semantic: if __expr and zf.id == int1(1): program.id = op0.val;
+
 **/
-bool X86Architecture::Table_2_84(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_2_84(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_80386)
     {
@@ -7656,7 +7040,7 @@ bool X86Architecture::Table_2_84(BinaryStream const& rBinStrm, OffsetType Offset
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Jz);
       rInsn.SubType() |= Instruction::JumpType | Instruction::ConditionalType;
-      if (Operand__Jz(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Jz<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -7681,17 +7065,18 @@ bool X86Architecture::Table_2_84(BinaryStream const& rBinStrm, OffsetType Offset
 }
 
 /** instruction
+ * opcode: 85
  * mnemonic: jnz
- * semantic: if __expr and zf.id == int1(0): program.id = op0.val;
-
- * constraint: df64
- * cpu_model: >= X86_Arch_80386
  * operand: ['Jz']
- * test_flags: ['zf']
- * opcode: 85
+ * constraint: df64
  * operation_type: ['jmp', 'cond']
+ * test_flags: ['zf']
+ * cpu_model: >= X86_Arch_80386
+ * semantic: if __expr and zf.id == int1(0): program.id = op0.val;
+
 **/
-bool X86Architecture::Table_2_85(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_2_85(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_80386)
     {
@@ -7702,7 +7087,7 @@ bool X86Architecture::Table_2_85(BinaryStream const& rBinStrm, OffsetType Offset
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Jnz);
       rInsn.SubType() |= Instruction::JumpType | Instruction::ConditionalType;
-      if (Operand__Jz(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Jz<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -7727,17 +7112,18 @@ bool X86Architecture::Table_2_85(BinaryStream const& rBinStrm, OffsetType Offset
 }
 
 /** instruction
+ * opcode: 86
  * mnemonic: jbe
- * semantic: if __expr and (cf.id | zf.id) != int1(0): program.id = op0.val;
-
- * constraint: df64
- * cpu_model: >= X86_Arch_80386
  * operand: ['Jz']
- * test_flags: ['zf', 'cf']
- * opcode: 86
+ * constraint: df64
  * operation_type: ['jmp', 'cond']
+ * test_flags: ['zf', 'cf']
+ * cpu_model: >= X86_Arch_80386
+ * semantic: if __expr and (cf.id | zf.id) != int1(0): program.id = op0.val;
+
 **/
-bool X86Architecture::Table_2_86(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_2_86(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_80386)
     {
@@ -7748,7 +7134,7 @@ bool X86Architecture::Table_2_86(BinaryStream const& rBinStrm, OffsetType Offset
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Jbe);
       rInsn.SubType() |= Instruction::JumpType | Instruction::ConditionalType;
-      if (Operand__Jz(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Jz<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -7776,17 +7162,18 @@ bool X86Architecture::Table_2_86(BinaryStream const& rBinStrm, OffsetType Offset
 }
 
 /** instruction
+ * opcode: 87
  * mnemonic: jnbe
- * semantic: if __expr and (cf.id | zf.id) == int1(0): program.id = op0.val;
-
- * constraint: df64
- * cpu_model: >= X86_Arch_80386
  * operand: ['Jz']
- * test_flags: ['zf', 'cf']
- * opcode: 87
+ * constraint: df64
  * operation_type: ['jmp', 'cond']
+ * test_flags: ['zf', 'cf']
+ * cpu_model: >= X86_Arch_80386
+ * semantic: if __expr and (cf.id | zf.id) == int1(0): program.id = op0.val;
+
 **/
-bool X86Architecture::Table_2_87(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_2_87(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_80386)
     {
@@ -7797,7 +7184,7 @@ bool X86Architecture::Table_2_87(BinaryStream const& rBinStrm, OffsetType Offset
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Jnbe);
       rInsn.SubType() |= Instruction::JumpType | Instruction::ConditionalType;
-      if (Operand__Jz(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Jz<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -7825,17 +7212,18 @@ bool X86Architecture::Table_2_87(BinaryStream const& rBinStrm, OffsetType Offset
 }
 
 /** instruction
+ * opcode: 88
  * mnemonic: js
- * semantic: if __expr and sf.id == int1(1): program.id = op0.val;
-
- * constraint: df64
- * cpu_model: >= X86_Arch_80386
  * operand: ['Jz']
- * test_flags: ['sf']
- * opcode: 88
+ * constraint: df64
  * operation_type: ['jmp', 'cond']
+ * test_flags: ['sf']
+ * cpu_model: >= X86_Arch_80386
+ * semantic: if __expr and sf.id == int1(1): program.id = op0.val;
+
 **/
-bool X86Architecture::Table_2_88(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_2_88(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_80386)
     {
@@ -7846,7 +7234,7 @@ bool X86Architecture::Table_2_88(BinaryStream const& rBinStrm, OffsetType Offset
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Js);
       rInsn.SubType() |= Instruction::JumpType | Instruction::ConditionalType;
-      if (Operand__Jz(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Jz<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -7871,17 +7259,18 @@ bool X86Architecture::Table_2_88(BinaryStream const& rBinStrm, OffsetType Offset
 }
 
 /** instruction
+ * opcode: 89
  * mnemonic: jns
- * semantic: if __expr and sf.id == int1(0): program.id = op0.val;
-
- * constraint: df64
- * cpu_model: >= X86_Arch_80386
  * operand: ['Jz']
- * test_flags: ['sf']
- * opcode: 89
+ * constraint: df64
  * operation_type: ['jmp', 'cond']
+ * test_flags: ['sf']
+ * cpu_model: >= X86_Arch_80386
+ * semantic: if __expr and sf.id == int1(0): program.id = op0.val;
+
 **/
-bool X86Architecture::Table_2_89(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_2_89(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_80386)
     {
@@ -7892,7 +7281,7 @@ bool X86Architecture::Table_2_89(BinaryStream const& rBinStrm, OffsetType Offset
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Jns);
       rInsn.SubType() |= Instruction::JumpType | Instruction::ConditionalType;
-      if (Operand__Jz(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Jz<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -7917,17 +7306,18 @@ bool X86Architecture::Table_2_89(BinaryStream const& rBinStrm, OffsetType Offset
 }
 
 /** instruction
+ * opcode: 8a
  * mnemonic: jp
- * semantic: if __expr and pf.id == int1(1): program.id = op0.val;
-
- * constraint: df64
- * cpu_model: >= X86_Arch_80386
  * operand: ['Jz']
- * test_flags: ['pf']
- * opcode: 8a
+ * constraint: df64
  * operation_type: ['jmp', 'cond']
+ * test_flags: ['pf']
+ * cpu_model: >= X86_Arch_80386
+ * semantic: if __expr and pf.id == int1(1): program.id = op0.val;
+
 **/
-bool X86Architecture::Table_2_8a(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_2_8a(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_80386)
     {
@@ -7938,7 +7328,7 @@ bool X86Architecture::Table_2_8a(BinaryStream const& rBinStrm, OffsetType Offset
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Jp);
       rInsn.SubType() |= Instruction::JumpType | Instruction::ConditionalType;
-      if (Operand__Jz(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Jz<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -7963,17 +7353,18 @@ bool X86Architecture::Table_2_8a(BinaryStream const& rBinStrm, OffsetType Offset
 }
 
 /** instruction
+ * opcode: 8b
  * mnemonic: jnp
- * semantic: if __expr and pf.id == int1(0): program.id = op0.val;
-
- * constraint: df64
- * cpu_model: >= X86_Arch_80386
  * operand: ['Jz']
- * test_flags: ['pf']
- * opcode: 8b
+ * constraint: df64
  * operation_type: ['jmp', 'cond']
+ * test_flags: ['pf']
+ * cpu_model: >= X86_Arch_80386
+ * semantic: if __expr and pf.id == int1(0): program.id = op0.val;
+
 **/
-bool X86Architecture::Table_2_8b(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_2_8b(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_80386)
     {
@@ -7984,7 +7375,7 @@ bool X86Architecture::Table_2_8b(BinaryStream const& rBinStrm, OffsetType Offset
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Jnp);
       rInsn.SubType() |= Instruction::JumpType | Instruction::ConditionalType;
-      if (Operand__Jz(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Jz<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -8009,17 +7400,18 @@ bool X86Architecture::Table_2_8b(BinaryStream const& rBinStrm, OffsetType Offset
 }
 
 /** instruction
+ * opcode: 8c
  * mnemonic: jl
- * semantic: if __expr and (sf.id ^ of.id) != int1(0): program.id = op0.val;
-
- * constraint: df64
- * cpu_model: >= X86_Arch_80386
  * operand: ['Jz']
- * test_flags: ['of', 'sf']
- * opcode: 8c
+ * constraint: df64
  * operation_type: ['jmp', 'cond']
+ * test_flags: ['of', 'sf']
+ * cpu_model: >= X86_Arch_80386
+ * semantic: if __expr and (sf.id ^ of.id) != int1(0): program.id = op0.val;
+
 **/
-bool X86Architecture::Table_2_8c(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_2_8c(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_80386)
     {
@@ -8030,7 +7422,7 @@ bool X86Architecture::Table_2_8c(BinaryStream const& rBinStrm, OffsetType Offset
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Jl);
       rInsn.SubType() |= Instruction::JumpType | Instruction::ConditionalType;
-      if (Operand__Jz(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Jz<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -8058,17 +7450,18 @@ bool X86Architecture::Table_2_8c(BinaryStream const& rBinStrm, OffsetType Offset
 }
 
 /** instruction
+ * opcode: 8d
  * mnemonic: jnl
- * semantic: if __expr and (sf.id ^ of.id) == int1(0): program.id = op0.val;
-
- * constraint: df64
- * cpu_model: >= X86_Arch_80386
  * operand: ['Jz']
- * test_flags: ['of', 'sf']
- * opcode: 8d
+ * constraint: df64
  * operation_type: ['jmp', 'cond']
+ * test_flags: ['of', 'sf']
+ * cpu_model: >= X86_Arch_80386
+ * semantic: if __expr and (sf.id ^ of.id) == int1(0): program.id = op0.val;
+
 **/
-bool X86Architecture::Table_2_8d(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_2_8d(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_80386)
     {
@@ -8079,7 +7472,7 @@ bool X86Architecture::Table_2_8d(BinaryStream const& rBinStrm, OffsetType Offset
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Jnl);
       rInsn.SubType() |= Instruction::JumpType | Instruction::ConditionalType;
-      if (Operand__Jz(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Jz<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -8107,17 +7500,18 @@ bool X86Architecture::Table_2_8d(BinaryStream const& rBinStrm, OffsetType Offset
 }
 
 /** instruction
+ * opcode: 8e
  * mnemonic: jle
- * semantic: if __expr and ((sf.id ^ of.id) | zf.id) != int1(0): program.id = op0.val;
-
- * constraint: df64
- * cpu_model: >= X86_Arch_80386
  * operand: ['Jz']
- * test_flags: ['of', 'sf', 'zf']
- * opcode: 8e
+ * constraint: df64
  * operation_type: ['jmp', 'cond']
+ * test_flags: ['of', 'sf', 'zf']
+ * cpu_model: >= X86_Arch_80386
+ * semantic: if __expr and ((sf.id ^ of.id) | zf.id) != int1(0): program.id = op0.val;
+
 **/
-bool X86Architecture::Table_2_8e(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_2_8e(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_80386)
     {
@@ -8128,7 +7522,7 @@ bool X86Architecture::Table_2_8e(BinaryStream const& rBinStrm, OffsetType Offset
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Jle);
       rInsn.SubType() |= Instruction::JumpType | Instruction::ConditionalType;
-      if (Operand__Jz(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Jz<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -8159,17 +7553,18 @@ bool X86Architecture::Table_2_8e(BinaryStream const& rBinStrm, OffsetType Offset
 }
 
 /** instruction
+ * opcode: 8f
  * mnemonic: jnle
- * semantic: if __expr and ((sf.id ^ of.id) | zf.id) == int1(0): program.id = op0.val;
-
- * constraint: df64
- * cpu_model: >= X86_Arch_80386
  * operand: ['Jz']
- * test_flags: ['of', 'sf', 'zf']
- * opcode: 8f
+ * constraint: df64
  * operation_type: ['jmp', 'cond']
+ * test_flags: ['of', 'sf', 'zf']
+ * cpu_model: >= X86_Arch_80386
+ * semantic: if __expr and ((sf.id ^ of.id) | zf.id) == int1(0): program.id = op0.val;
+
 **/
-bool X86Architecture::Table_2_8f(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_2_8f(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_80386)
     {
@@ -8180,7 +7575,7 @@ bool X86Architecture::Table_2_8f(BinaryStream const& rBinStrm, OffsetType Offset
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Jnle);
       rInsn.SubType() |= Instruction::JumpType | Instruction::ConditionalType;
-      if (Operand__Jz(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Jz<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -8211,22 +7606,23 @@ bool X86Architecture::Table_2_8f(BinaryStream const& rBinStrm, OffsetType Offset
 }
 
 /** instruction
+ * opcode: 90
  * mnemonic: seto
+ * operand: ['Eb']
  * test_flags: ['of']
+ * cpu_model: >= X86_Arch_80386
  * semantic: if __expr and of.id == int1(1): op0.val = int8(1)
 else: op0.val = int8(0);
 
- * operand: ['Eb']
- * opcode: 90
- * cpu_model: >= X86_Arch_80386
 **/
-bool X86Architecture::Table_2_90(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_2_90(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_80386)
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Seto);
-      if (Operand__Eb(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Eb<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -8254,22 +7650,23 @@ bool X86Architecture::Table_2_90(BinaryStream const& rBinStrm, OffsetType Offset
 }
 
 /** instruction
+ * opcode: 91
  * mnemonic: setno
+ * operand: ['Eb']
  * test_flags: ['of']
+ * cpu_model: >= X86_Arch_80386
  * semantic: if __expr and of.id == int1(0): op0.val = int8(1)
 else: op0.val = int8(0);
 
- * operand: ['Eb']
- * opcode: 91
- * cpu_model: >= X86_Arch_80386
 **/
-bool X86Architecture::Table_2_91(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_2_91(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_80386)
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Setno);
-      if (Operand__Eb(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Eb<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -8297,22 +7694,23 @@ bool X86Architecture::Table_2_91(BinaryStream const& rBinStrm, OffsetType Offset
 }
 
 /** instruction
+ * opcode: 92
  * mnemonic: setb
+ * operand: ['Eb']
  * test_flags: ['cf']
+ * cpu_model: >= X86_Arch_80386
  * semantic: if __expr and cf.id == int1(1): op0.val = int8(1)
 else: op0.val = int8(0);
 
- * operand: ['Eb']
- * opcode: 92
- * cpu_model: >= X86_Arch_80386
 **/
-bool X86Architecture::Table_2_92(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_2_92(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_80386)
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Setb);
-      if (Operand__Eb(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Eb<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -8340,22 +7738,23 @@ bool X86Architecture::Table_2_92(BinaryStream const& rBinStrm, OffsetType Offset
 }
 
 /** instruction
+ * opcode: 93
  * mnemonic: setnb
+ * operand: ['Eb']
  * test_flags: ['cf']
+ * cpu_model: >= X86_Arch_80386
  * semantic: if __expr and cf.id == int1(0): op0.val = int8(1)
 else: op0.val = int8(0);
 
- * operand: ['Eb']
- * opcode: 93
- * cpu_model: >= X86_Arch_80386
 **/
-bool X86Architecture::Table_2_93(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_2_93(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_80386)
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Setnb);
-      if (Operand__Eb(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Eb<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -8383,22 +7782,23 @@ bool X86Architecture::Table_2_93(BinaryStream const& rBinStrm, OffsetType Offset
 }
 
 /** instruction
+ * opcode: 94
  * mnemonic: setz
+ * operand: ['Eb']
  * test_flags: ['zf']
+ * cpu_model: >= X86_Arch_80386
  * semantic: if __expr and zf.id == int1(1): op0.val = int8(1)
 else: op0.val = int8(0);
 
- * operand: ['Eb']
- * opcode: 94
- * cpu_model: >= X86_Arch_80386
 **/
-bool X86Architecture::Table_2_94(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_2_94(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_80386)
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Setz);
-      if (Operand__Eb(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Eb<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -8426,22 +7826,23 @@ bool X86Architecture::Table_2_94(BinaryStream const& rBinStrm, OffsetType Offset
 }
 
 /** instruction
+ * opcode: 95
  * mnemonic: setnz
+ * operand: ['Eb']
  * test_flags: ['zf']
+ * cpu_model: >= X86_Arch_80386
  * semantic: if __expr and zf.id == int1(0): op0.val = int8(1)
 else: op0.val = int8(0);
 
- * operand: ['Eb']
- * opcode: 95
- * cpu_model: >= X86_Arch_80386
 **/
-bool X86Architecture::Table_2_95(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_2_95(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_80386)
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Setnz);
-      if (Operand__Eb(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Eb<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -8469,22 +7870,23 @@ bool X86Architecture::Table_2_95(BinaryStream const& rBinStrm, OffsetType Offset
 }
 
 /** instruction
+ * opcode: 96
  * mnemonic: setbe
+ * operand: ['Eb']
  * test_flags: ['zf', 'cf']
+ * cpu_model: >= X86_Arch_80386
  * semantic: if __expr and (cf.id | zf.id) != int1(0): op0.val = int8(1)
 else: op0.val = int8(0);
 
- * operand: ['Eb']
- * opcode: 96
- * cpu_model: >= X86_Arch_80386
 **/
-bool X86Architecture::Table_2_96(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_2_96(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_80386)
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Setbe);
-      if (Operand__Eb(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Eb<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -8515,22 +7917,23 @@ bool X86Architecture::Table_2_96(BinaryStream const& rBinStrm, OffsetType Offset
 }
 
 /** instruction
+ * opcode: 97
  * mnemonic: setnbe
+ * operand: ['Eb']
  * test_flags: ['zf', 'cf']
+ * cpu_model: >= X86_Arch_80386
  * semantic: if __expr and (cf.id | zf.id) == int1(0): op0.val = int8(1)
 else: op0.val = int8(0);
 
- * operand: ['Eb']
- * opcode: 97
- * cpu_model: >= X86_Arch_80386
 **/
-bool X86Architecture::Table_2_97(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_2_97(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_80386)
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Setnbe);
-      if (Operand__Eb(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Eb<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -8561,22 +7964,23 @@ bool X86Architecture::Table_2_97(BinaryStream const& rBinStrm, OffsetType Offset
 }
 
 /** instruction
+ * opcode: 98
  * mnemonic: sets
+ * operand: ['Eb']
  * test_flags: ['sf']
+ * cpu_model: >= X86_Arch_80386
  * semantic: if __expr and sf.id == int1(1): op0.val = int8(1)
 else: op0.val = int8(0);
 
- * operand: ['Eb']
- * opcode: 98
- * cpu_model: >= X86_Arch_80386
 **/
-bool X86Architecture::Table_2_98(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_2_98(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_80386)
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Sets);
-      if (Operand__Eb(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Eb<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -8604,22 +8008,23 @@ bool X86Architecture::Table_2_98(BinaryStream const& rBinStrm, OffsetType Offset
 }
 
 /** instruction
+ * opcode: 99
  * mnemonic: setns
+ * operand: ['Eb']
  * test_flags: ['sf']
+ * cpu_model: >= X86_Arch_80386
  * semantic: if __expr and sf.id == int1(0): op0.val = int8(1)
 else: op0.val = int8(0);
 
- * operand: ['Eb']
- * opcode: 99
- * cpu_model: >= X86_Arch_80386
 **/
-bool X86Architecture::Table_2_99(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_2_99(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_80386)
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Setns);
-      if (Operand__Eb(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Eb<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -8647,22 +8052,23 @@ bool X86Architecture::Table_2_99(BinaryStream const& rBinStrm, OffsetType Offset
 }
 
 /** instruction
+ * opcode: 9a
  * mnemonic: setp
+ * operand: ['Eb']
  * test_flags: ['pf']
+ * cpu_model: >= X86_Arch_80386
  * semantic: if __expr and pf.id == int1(1): op0.val = int8(1)
 else: op0.val = int8(0);
 
- * operand: ['Eb']
- * opcode: 9a
- * cpu_model: >= X86_Arch_80386
 **/
-bool X86Architecture::Table_2_9a(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_2_9a(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_80386)
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Setp);
-      if (Operand__Eb(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Eb<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -8690,22 +8096,23 @@ bool X86Architecture::Table_2_9a(BinaryStream const& rBinStrm, OffsetType Offset
 }
 
 /** instruction
+ * opcode: 9b
  * mnemonic: setnp
+ * operand: ['Eb']
  * test_flags: ['pf']
+ * cpu_model: >= X86_Arch_80386
  * semantic: if __expr and pf.id == int1(0): op0.val = int8(1)
 else: op0.val = int8(0);
 
- * operand: ['Eb']
- * opcode: 9b
- * cpu_model: >= X86_Arch_80386
 **/
-bool X86Architecture::Table_2_9b(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_2_9b(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_80386)
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Setnp);
-      if (Operand__Eb(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Eb<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -8733,22 +8140,23 @@ bool X86Architecture::Table_2_9b(BinaryStream const& rBinStrm, OffsetType Offset
 }
 
 /** instruction
+ * opcode: 9c
  * mnemonic: setl
+ * operand: ['Eb']
  * test_flags: ['of', 'sf']
+ * cpu_model: >= X86_Arch_80386
  * semantic: if __expr and (sf.id ^ of.id) != int1(0): op0.val = int8(1)
 else: op0.val = int8(0);
 
- * operand: ['Eb']
- * opcode: 9c
- * cpu_model: >= X86_Arch_80386
 **/
-bool X86Architecture::Table_2_9c(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_2_9c(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_80386)
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Setl);
-      if (Operand__Eb(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Eb<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -8779,22 +8187,23 @@ bool X86Architecture::Table_2_9c(BinaryStream const& rBinStrm, OffsetType Offset
 }
 
 /** instruction
+ * opcode: 9d
  * mnemonic: setnl
+ * operand: ['Eb']
  * test_flags: ['of', 'sf']
+ * cpu_model: >= X86_Arch_80386
  * semantic: if __expr and (sf.id ^ of.id) == int1(0): op0.val = int8(1)
 else: op0.val = int8(0);
 
- * operand: ['Eb']
- * opcode: 9d
- * cpu_model: >= X86_Arch_80386
 **/
-bool X86Architecture::Table_2_9d(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_2_9d(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_80386)
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Setnl);
-      if (Operand__Eb(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Eb<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -8825,22 +8234,23 @@ bool X86Architecture::Table_2_9d(BinaryStream const& rBinStrm, OffsetType Offset
 }
 
 /** instruction
+ * opcode: 9e
  * mnemonic: setle
+ * operand: ['Eb']
  * test_flags: ['of', 'sf', 'zf']
+ * cpu_model: >= X86_Arch_80386
  * semantic: if __expr and ((sf.id ^ of.id) | zf.id) != int1(0): op0.val = int8(1)
 else: op0.val = int8(0);
 
- * operand: ['Eb']
- * opcode: 9e
- * cpu_model: >= X86_Arch_80386
 **/
-bool X86Architecture::Table_2_9e(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_2_9e(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_80386)
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Setle);
-      if (Operand__Eb(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Eb<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -8874,22 +8284,23 @@ bool X86Architecture::Table_2_9e(BinaryStream const& rBinStrm, OffsetType Offset
 }
 
 /** instruction
+ * opcode: 9f
  * mnemonic: setnle
+ * operand: ['Eb']
  * test_flags: ['of', 'sf', 'zf']
+ * cpu_model: >= X86_Arch_80386
  * semantic: if __expr and ((sf.id ^ of.id) | zf.id) == int1(0): op0.val = int8(1)
 else: op0.val = int8(0);
 
- * operand: ['Eb']
- * opcode: 9f
- * cpu_model: >= X86_Arch_80386
 **/
-bool X86Architecture::Table_2_9f(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_2_9f(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_80386)
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Setnle);
-      if (Operand__Eb(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Eb<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -8923,19 +8334,20 @@ bool X86Architecture::Table_2_9f(BinaryStream const& rBinStrm, OffsetType Offset
 }
 
 /** instruction
+ * opcode: a0
  * mnemonic: push
+ * operand: ['FS']
+ * constraint: df64
+ * cpu_model: >= X86_Arch_80386
  * semantic: alloc_var('pushed_value', stack.bit);
 pushed_value = sign_extend(op0.val, int(stack.bit, stack.bit));
 stack.id -= stack.size;
 stack.mem = pushed_value;
 free_var('pushed_value');
 
- * constraint: df64
- * operand: ['FS']
- * opcode: a0
- * cpu_model: >= X86_Arch_80386
 **/
-bool X86Architecture::Table_2_a0(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_2_a0(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_80386)
     {
@@ -8945,7 +8357,7 @@ bool X86Architecture::Table_2_a0(BinaryStream const& rBinStrm, OffsetType Offset
       }
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Push);
-      if (Operand__FS(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__FS<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -8982,19 +8394,20 @@ bool X86Architecture::Table_2_a0(BinaryStream const& rBinStrm, OffsetType Offset
 }
 
 /** instruction
+ * opcode: a1
  * mnemonic: pop
+ * operand: ['FS']
+ * constraint: df64
+ * cpu_model: >= X86_Arch_80386
  * semantic: alloc_var('popped_value', stack.bit);
 popped_value = stack.mem;
 stack.id += stack.size;
 op0.val = popped_value;
 free_var('popped_value');
 
- * constraint: df64
- * operand: ['FS']
- * opcode: a1
- * cpu_model: >= X86_Arch_80386
 **/
-bool X86Architecture::Table_2_a1(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_2_a1(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_80386)
     {
@@ -9004,7 +8417,7 @@ bool X86Architecture::Table_2_a1(BinaryStream const& rBinStrm, OffsetType Offset
       }
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Pop);
-      if (Operand__FS(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__FS<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -9041,56 +8454,21 @@ bool X86Architecture::Table_2_a1(BinaryStream const& rBinStrm, OffsetType Offset
 }
 
 /** instruction
- * mnemonic: cpuid
- * opcode: a2
- * semantic: eax.id = int32(0x11111111);
-ecx.id = int32(0x22222222);
-edx.id = int32(0x33333333);
-ebx.id = int32(0x44444444);
-
-**/
-bool X86Architecture::Table_2_a2(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    rInsn.Size()++;
-    rInsn.SetOpcode(X86_Opcode_Cpuid);
-    {
-      Expression::LSPType AllExpr;
-      /* semantic: eax.id = int32(0x11111111) */
-      AllExpr.push_back(Expr::MakeAssign(
-        Expr::MakeId(X86_Reg_Eax, &m_CpuInfo),
-        Expr::MakeBitVector(32, 0x11111111)));
-      /* semantic: ecx.id = int32(0x22222222) */
-      AllExpr.push_back(Expr::MakeAssign(
-        Expr::MakeId(X86_Reg_Ecx, &m_CpuInfo),
-        Expr::MakeBitVector(32, 0x22222222)));
-      /* semantic: edx.id = int32(0x33333333) */
-      AllExpr.push_back(Expr::MakeAssign(
-        Expr::MakeId(X86_Reg_Edx, &m_CpuInfo),
-        Expr::MakeBitVector(32, 0x33333333)));
-      /* semantic: ebx.id = int32(0x44444444) */
-      AllExpr.push_back(Expr::MakeAssign(
-        Expr::MakeId(X86_Reg_Ebx, &m_CpuInfo),
-        Expr::MakeBitVector(32, 0x44444444)));
-      rInsn.SetSemantic(AllExpr);
-    }
-    return true;
-}
-
-/** instruction
+ * opcode: a3
  * mnemonic: bt
  * operand: ['Ev', 'Gv']
- * opcode: a3
  * cpu_model: >= X86_Arch_80386
  * semantic: cf.id = bit_cast((op0.val >> (bit_cast(op1.val, int_type(op0.bit)) & (int(op0.bit, op0.bit) - int(op0.bit, 1)))), int_type1);
 
 **/
-bool X86Architecture::Table_2_a3(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_2_a3(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_80386)
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Bt);
-      if (Operand__Ev_Gv(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Ev_Gv<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -9118,7 +8496,11 @@ bool X86Architecture::Table_2_a3(BinaryStream const& rBinStrm, OffsetType Offset
 }
 
 /** instruction
+ * opcode: a4
  * mnemonic: shld
+ * operand: ['Ev', 'Gv', 'Ib']
+ * update_flags: ['cf', 'pf', 'af', 'zf', 'sf', 'of']
+ * cpu_model: >= X86_Arch_80386
  * semantic: alloc_var('res', op0.bit);
 alloc_var('count', op0.bit);
 alloc_var('sign_saved', 1);
@@ -9138,18 +8520,15 @@ free_var('sign_saved');
 free_var('count');
 free_var('res');
 
- * operand: ['Ev', 'Gv', 'Ib']
- * opcode: a4
- * update_flags: ['cf', 'pf', 'af', 'zf', 'sf', 'of']
- * cpu_model: >= X86_Arch_80386
 **/
-bool X86Architecture::Table_2_a4(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_2_a4(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_80386)
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Shld);
-      if (Operand__Ev_Gv_Ib(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Ev_Gv_Ib<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -9365,7 +8744,11 @@ bool X86Architecture::Table_2_a4(BinaryStream const& rBinStrm, OffsetType Offset
 }
 
 /** instruction
+ * opcode: a5
  * mnemonic: shld
+ * operand: ['Ev', 'Gv', 'CL']
+ * update_flags: ['cf', 'pf', 'af', 'zf', 'sf', 'of']
+ * cpu_model: >= X86_Arch_80386
  * semantic: alloc_var('res', op0.bit);
 alloc_var('count', op0.bit);
 alloc_var('sign_saved', 1);
@@ -9385,18 +8768,15 @@ free_var('sign_saved');
 free_var('count');
 free_var('res');
 
- * operand: ['Ev', 'Gv', 'CL']
- * opcode: a5
- * update_flags: ['cf', 'pf', 'af', 'zf', 'sf', 'of']
- * cpu_model: >= X86_Arch_80386
 **/
-bool X86Architecture::Table_2_a5(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_2_a5(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_80386)
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Shld);
-      if (Operand__Ev_Gv_CL(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Ev_Gv_CL<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -9624,7 +9004,8 @@ bool X86Architecture::Table_2_a5(BinaryStream const& rBinStrm, OffsetType Offset
  * cpu_model: >= X86_Arch_Centaur_he
  *
 **/
-bool X86Architecture::Table_2_a6(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_2_a6(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_Centaur_he)
     {
@@ -9660,7 +9041,8 @@ bool X86Architecture::Table_2_a6(BinaryStream const& rBinStrm, OffsetType Offset
  * cpu_model: >= X86_Arch_Centaur_ace
  *
 **/
-bool X86Architecture::Table_2_a7(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_2_a7(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_Centaur_ace)
     {
@@ -9684,19 +9066,20 @@ bool X86Architecture::Table_2_a7(BinaryStream const& rBinStrm, OffsetType Offset
 }
 
 /** instruction
+ * opcode: a8
  * mnemonic: push
+ * operand: ['GS']
+ * constraint: d64
+ * cpu_model: >= X86_Arch_80386
  * semantic: alloc_var('pushed_value', stack.bit);
 pushed_value = sign_extend(op0.val, int(stack.bit, stack.bit));
 stack.id -= stack.size;
 stack.mem = pushed_value;
 free_var('pushed_value');
 
- * constraint: d64
- * operand: ['GS']
- * opcode: a8
- * cpu_model: >= X86_Arch_80386
 **/
-bool X86Architecture::Table_2_a8(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_2_a8(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_80386)
     {
@@ -9706,7 +9089,7 @@ bool X86Architecture::Table_2_a8(BinaryStream const& rBinStrm, OffsetType Offset
       }
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Push);
-      if (Operand__GS(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__GS<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -9743,19 +9126,20 @@ bool X86Architecture::Table_2_a8(BinaryStream const& rBinStrm, OffsetType Offset
 }
 
 /** instruction
+ * opcode: a9
  * mnemonic: pop
+ * operand: ['GS']
+ * constraint: d64
+ * cpu_model: >= X86_Arch_80386
  * semantic: alloc_var('popped_value', stack.bit);
 popped_value = stack.mem;
 stack.id += stack.size;
 op0.val = popped_value;
 free_var('popped_value');
 
- * constraint: d64
- * operand: ['GS']
- * opcode: a9
- * cpu_model: >= X86_Arch_80386
 **/
-bool X86Architecture::Table_2_a9(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_2_a9(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_80386)
     {
@@ -9765,7 +9149,7 @@ bool X86Architecture::Table_2_a9(BinaryStream const& rBinStrm, OffsetType Offset
       }
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Pop);
-      if (Operand__GS(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__GS<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -9802,11 +9186,12 @@ bool X86Architecture::Table_2_a9(BinaryStream const& rBinStrm, OffsetType Offset
 }
 
 /** instruction
- * mnemonic: rsm
  * opcode: aa
+ * mnemonic: rsm
  * cpu_model: >= X86_Arch_80386sl
 **/
-bool X86Architecture::Table_2_aa(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_2_aa(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_80386sl)
     {
@@ -9819,9 +9204,9 @@ bool X86Architecture::Table_2_aa(BinaryStream const& rBinStrm, OffsetType Offset
 }
 
 /** instruction
+ * opcode: ab
  * mnemonic: bts
  * operand: ['Ev', 'Gv']
- * opcode: ab
  * cpu_model: >= X86_Arch_80386
  * semantic: alloc_var('res', op0.bit);
 alloc_var('bit_set', op0.bit);
@@ -9833,13 +9218,14 @@ free_var('bit_set');
 free_var('res');
 
 **/
-bool X86Architecture::Table_2_ab(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_2_ab(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_80386)
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Bts);
-      if (Operand__Ev_Gv(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Ev_Gv<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -9893,9 +9279,9 @@ bool X86Architecture::Table_2_ab(BinaryStream const& rBinStrm, OffsetType Offset
 }
 
 /** instruction
+ * opcode: ac
  * mnemonic: shrd
  * operand: ['Ev', 'Gv', 'Ib']
- * opcode: ac
  * cpu_model: >= X86_Arch_80386
  * semantic: alloc_var('res', op0.bit);
 alloc_var('count', op0.bit);
@@ -9917,13 +9303,14 @@ free_var('count');
 free_var('res');
 
 **/
-bool X86Architecture::Table_2_ac(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_2_ac(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_80386)
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Shrd);
-      if (Operand__Ev_Gv_Ib(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Ev_Gv_Ib<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -10138,9 +9525,9 @@ bool X86Architecture::Table_2_ac(BinaryStream const& rBinStrm, OffsetType Offset
 }
 
 /** instruction
+ * opcode: ad
  * mnemonic: shrd
  * operand: ['Ev', 'Gv', 'CL']
- * opcode: ad
  * cpu_model: >= X86_Arch_80386
  * semantic: alloc_var('res', op0.bit);
 alloc_var('count', op0.bit);
@@ -10162,13 +9549,14 @@ free_var('count');
 free_var('res');
 
 **/
-bool X86Architecture::Table_2_ad(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_2_ad(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_80386)
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Shrd);
-      if (Operand__Ev_Gv_CL(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Ev_Gv_CL<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -10395,9 +9783,9 @@ bool X86Architecture::Table_2_ad(BinaryStream const& rBinStrm, OffsetType Offset
  * opcode: 03
  * sub_opcodes: [{'mnemonic': 'stmxcsr', 'operand': ['Md']}, {'mnemonic': 'wrgsbase', 'operand': ['Ry'], 'prefix': 243}]
  *
+ * opcode: 04
  * mnemonic: xsave
  * operand: ['M']
- * opcode: 04
  *
  * opcode: 05
  * sub_opcodes: [{'mnemonic': 'xrstor', 'operand': ['M']}, {'mnemonic': 'lfence', 'suffix': 232}]
@@ -10409,7 +9797,8 @@ bool X86Architecture::Table_2_ad(BinaryStream const& rBinStrm, OffsetType Offset
  * sub_opcodes: [{'mnemonic': 'clflush', 'operand': ['M']}, {'mnemonic': 'sfence', 'suffix': 248}]
  *
 **/
-bool X86Architecture::Table_2_ae(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_2_ae(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     u8 ModRmByte;
     if (!rBinStrm.Read(Offset, ModRmByte))
@@ -10423,7 +9812,7 @@ bool X86Architecture::Table_2_ae(BinaryStream const& rBinStrm, OffsetType Offset
       {
         rInsn.Size()++;
         rInsn.SetOpcode(X86_Opcode_Rdfsbase);
-        if (Operand__Ry(rBinStrm, Offset, rInsn, Mode) == false)
+        if (Operand__Ry<Mode>(rBinStrm, Offset, rInsn) == false)
         {
           return false;
         }
@@ -10433,7 +9822,7 @@ bool X86Architecture::Table_2_ae(BinaryStream const& rBinStrm, OffsetType Offset
       {
         rInsn.Size()++;
         rInsn.SetOpcode(X86_Opcode_Fxsave);
-        if (Operand__M(rBinStrm, Offset, rInsn, Mode) == false)
+        if (Operand__M<Mode>(rBinStrm, Offset, rInsn) == false)
         {
           return false;
         }
@@ -10444,7 +9833,7 @@ bool X86Architecture::Table_2_ae(BinaryStream const& rBinStrm, OffsetType Offset
       {
         rInsn.Size()++;
         rInsn.SetOpcode(X86_Opcode_Rdgsbase);
-        if (Operand__Ry(rBinStrm, Offset, rInsn, Mode) == false)
+        if (Operand__Ry<Mode>(rBinStrm, Offset, rInsn) == false)
         {
           return false;
         }
@@ -10454,7 +9843,7 @@ bool X86Architecture::Table_2_ae(BinaryStream const& rBinStrm, OffsetType Offset
       {
         rInsn.Size()++;
         rInsn.SetOpcode(X86_Opcode_Fxrstor);
-        if (Operand__M(rBinStrm, Offset, rInsn, Mode) == false)
+        if (Operand__M<Mode>(rBinStrm, Offset, rInsn) == false)
         {
           return false;
         }
@@ -10465,7 +9854,7 @@ bool X86Architecture::Table_2_ae(BinaryStream const& rBinStrm, OffsetType Offset
       {
         rInsn.Size()++;
         rInsn.SetOpcode(X86_Opcode_Wrfsbase);
-        if (Operand__Ry(rBinStrm, Offset, rInsn, Mode) == false)
+        if (Operand__Ry<Mode>(rBinStrm, Offset, rInsn) == false)
         {
           return false;
         }
@@ -10475,7 +9864,7 @@ bool X86Architecture::Table_2_ae(BinaryStream const& rBinStrm, OffsetType Offset
       {
         rInsn.Size()++;
         rInsn.SetOpcode(X86_Opcode_Ldmxcsr);
-        if (Operand__Md(rBinStrm, Offset, rInsn, Mode) == false)
+        if (Operand__Md<Mode>(rBinStrm, Offset, rInsn) == false)
         {
           return false;
         }
@@ -10486,7 +9875,7 @@ bool X86Architecture::Table_2_ae(BinaryStream const& rBinStrm, OffsetType Offset
       {
         rInsn.Size()++;
         rInsn.SetOpcode(X86_Opcode_Wrgsbase);
-        if (Operand__Ry(rBinStrm, Offset, rInsn, Mode) == false)
+        if (Operand__Ry<Mode>(rBinStrm, Offset, rInsn) == false)
         {
           return false;
         }
@@ -10496,7 +9885,7 @@ bool X86Architecture::Table_2_ae(BinaryStream const& rBinStrm, OffsetType Offset
       {
         rInsn.Size()++;
         rInsn.SetOpcode(X86_Opcode_Stmxcsr);
-        if (Operand__Md(rBinStrm, Offset, rInsn, Mode) == false)
+        if (Operand__Md<Mode>(rBinStrm, Offset, rInsn) == false)
         {
           return false;
         }
@@ -10505,7 +9894,7 @@ bool X86Architecture::Table_2_ae(BinaryStream const& rBinStrm, OffsetType Offset
     case 0x4:
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Xsave);
-      if (Operand__M(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__M<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -10526,7 +9915,7 @@ bool X86Architecture::Table_2_ae(BinaryStream const& rBinStrm, OffsetType Offset
         {
           rInsn.Size()++;
           rInsn.SetOpcode(X86_Opcode_Xrstor);
-          if (Operand__M(rBinStrm, Offset, rInsn, Mode) == false)
+          if (Operand__M<Mode>(rBinStrm, Offset, rInsn) == false)
           {
             return false;
           }
@@ -10549,7 +9938,7 @@ bool X86Architecture::Table_2_ae(BinaryStream const& rBinStrm, OffsetType Offset
         {
           rInsn.Size()++;
           rInsn.SetOpcode(X86_Opcode_Xsaveopt);
-          if (Operand__M(rBinStrm, Offset, rInsn, Mode) == false)
+          if (Operand__M<Mode>(rBinStrm, Offset, rInsn) == false)
           {
             return false;
           }
@@ -10572,7 +9961,7 @@ bool X86Architecture::Table_2_ae(BinaryStream const& rBinStrm, OffsetType Offset
         {
           rInsn.Size()++;
           rInsn.SetOpcode(X86_Opcode_Clflush);
-          if (Operand__M(rBinStrm, Offset, rInsn, Mode) == false)
+          if (Operand__M<Mode>(rBinStrm, Offset, rInsn) == false)
           {
             return false;
           }
@@ -10585,9 +9974,9 @@ bool X86Architecture::Table_2_ae(BinaryStream const& rBinStrm, OffsetType Offset
 }
 
 /** instruction
+ * opcode: af
  * mnemonic: imul
  * operand: ['Gv', 'Ev']
- * opcode: af
  * cpu_model: >= X86_Arch_80386
  * semantic: alloc_var('res', op0.bit);
 alloc_var('mul_res', concat(op0.bit, ignore(' * 2')));
@@ -10608,13 +9997,14 @@ free_var('mul_res');
 free_var('res');
 
 **/
-bool X86Architecture::Table_2_af(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_2_af(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_80386)
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Imul);
-      if (Operand__Gv_Ev(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Gv_Ev<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -10696,9 +10086,9 @@ bool X86Architecture::Table_2_af(BinaryStream const& rBinStrm, OffsetType Offset
 }
 
 /** instruction
+ * opcode: b0
  * mnemonic: cmpxchg
  * operand: ['Eb', 'Gb']
- * opcode: b0
  * cpu_model: >= X86_Arch_80486
  * semantic: if __expr and op0.val == acc.id:
   zf.id = int1(1)
@@ -10709,13 +10099,14 @@ if __expr and zf.id == int1(1):
   op0.val = op1.val;
 
 **/
-bool X86Architecture::Table_2_b0(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_2_b0(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_80486)
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Cmpxchg);
-      if (Operand__Eb_Gb(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Eb_Gb<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -10755,9 +10146,9 @@ bool X86Architecture::Table_2_b0(BinaryStream const& rBinStrm, OffsetType Offset
 }
 
 /** instruction
+ * opcode: b1
  * mnemonic: cmpxchg
  * operand: ['Ev', 'Gv']
- * opcode: b1
  * cpu_model: >= X86_Arch_80486
  * semantic: if __expr and op0.val == acc.id:
   zf.id = int1(1)
@@ -10768,13 +10159,14 @@ if __expr and zf.id == int1(1):
   op0.val = op1.val;
 
 **/
-bool X86Architecture::Table_2_b1(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_2_b1(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_80486)
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Cmpxchg);
-      if (Operand__Ev_Gv(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Ev_Gv<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -10814,18 +10206,19 @@ bool X86Architecture::Table_2_b1(BinaryStream const& rBinStrm, OffsetType Offset
 }
 
 /** instruction
+ * opcode: b2
  * mnemonic: lss
  * operand: ['Gv', 'Mp']
- * opcode: b2
  * cpu_model: >= X86_Arch_80386
 **/
-bool X86Architecture::Table_2_b2(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_2_b2(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_80386)
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Lss);
-      if (Operand__Gv_Mp(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Gv_Mp<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -10836,9 +10229,9 @@ bool X86Architecture::Table_2_b2(BinaryStream const& rBinStrm, OffsetType Offset
 }
 
 /** instruction
+ * opcode: b3
  * mnemonic: btr
  * operand: ['Ev', 'Gv']
- * opcode: b3
  * cpu_model: >= X86_Arch_80386
  * semantic: alloc_var('bit_set', op0.bit);
 bit_set = bit_cast(op1.val, int_type(op0.bit)) & (int(op0.bit, op0.bit) - int(op0.bit, 1));
@@ -10847,13 +10240,14 @@ op0.val = (op0.val & (~(int(op0.bit, 1) << bit_cast(bit_set, int_type(op0.bit)))
 free_var('bit_set');
 
 **/
-bool X86Architecture::Table_2_b3(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_2_b3(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_80386)
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Btr);
-      if (Operand__Ev_Gv(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Ev_Gv<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -10901,18 +10295,19 @@ bool X86Architecture::Table_2_b3(BinaryStream const& rBinStrm, OffsetType Offset
 }
 
 /** instruction
+ * opcode: b4
  * mnemonic: lfs
  * operand: ['Gv', 'Mp']
- * opcode: b4
  * cpu_model: >= X86_Arch_80386
 **/
-bool X86Architecture::Table_2_b4(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_2_b4(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_80386)
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Lfs);
-      if (Operand__Gv_Mp(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Gv_Mp<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -10923,18 +10318,19 @@ bool X86Architecture::Table_2_b4(BinaryStream const& rBinStrm, OffsetType Offset
 }
 
 /** instruction
+ * opcode: b5
  * mnemonic: lgs
  * operand: ['Gv', 'Mp']
- * opcode: b5
  * cpu_model: >= X86_Arch_80386
 **/
-bool X86Architecture::Table_2_b5(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_2_b5(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_80386)
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Lgs);
-      if (Operand__Gv_Mp(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Gv_Mp<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -10945,20 +10341,21 @@ bool X86Architecture::Table_2_b5(BinaryStream const& rBinStrm, OffsetType Offset
 }
 
 /** instruction
+ * opcode: b6
  * mnemonic: movzx
  * operand: ['Gv', 'Eb']
- * opcode: b6
  * cpu_model: >= X86_Arch_80386
  * semantic: op0.val = zero_extend(op1.val, int(op0.bit, op0.bit));
 
 **/
-bool X86Architecture::Table_2_b6(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_2_b6(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_80386)
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Movzx);
-      if (Operand__Gv_Eb(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Gv_Eb<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -10977,20 +10374,21 @@ bool X86Architecture::Table_2_b6(BinaryStream const& rBinStrm, OffsetType Offset
 }
 
 /** instruction
+ * opcode: b7
  * mnemonic: movzx
  * operand: ['Gv', 'Ew']
- * opcode: b7
  * cpu_model: >= X86_Arch_80386
  * semantic: op0.val = zero_extend(op1.val, int(op0.bit, op0.bit));
 
 **/
-bool X86Architecture::Table_2_b7(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_2_b7(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_80386)
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Movzx);
-      if (Operand__Gv_Ew(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Gv_Ew<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -11020,13 +10418,14 @@ bool X86Architecture::Table_2_b7(BinaryStream const& rBinStrm, OffsetType Offset
  * prefix: f3
  *
 **/
-bool X86Architecture::Table_2_b8(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_2_b8(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if ((rInsn.GetPrefix() & X86_Prefix_Rep) == X86_Prefix_Rep)
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Popcnt);
-      if (Operand__Gv_Ev(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Gv_Ev<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -11036,7 +10435,7 @@ bool X86Architecture::Table_2_b8(BinaryStream const& rBinStrm, OffsetType Offset
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Jmpe);
-      if (Operand__Jz(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Jz<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -11046,32 +10445,33 @@ bool X86Architecture::Table_2_b8(BinaryStream const& rBinStrm, OffsetType Offset
 }
 
 /** group:
- * mnemonic: ud2
  * opcode: 00
- *
  * mnemonic: ud2
- * opcode: 01
  *
+ * opcode: 01
  * mnemonic: ud2
- * opcode: 02
  *
+ * opcode: 02
  * mnemonic: ud2
- * opcode: 03
  *
+ * opcode: 03
  * mnemonic: ud2
- * opcode: 04
  *
+ * opcode: 04
  * mnemonic: ud2
- * opcode: 05
  *
+ * opcode: 05
  * mnemonic: ud2
- * opcode: 06
  *
+ * opcode: 06
  * mnemonic: ud2
+ *
  * opcode: 07
+ * mnemonic: ud2
  *
 **/
-bool X86Architecture::Table_2_b9(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_2_b9(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     u8 ModRmByte;
     if (!rBinStrm.Read(Offset, ModRmByte))
@@ -11130,15 +10530,15 @@ bool X86Architecture::Table_2_b9(BinaryStream const& rBinStrm, OffsetType Offset
  * opcode: 03
  * invalid
  *
+ * opcode: 04
  * mnemonic: bt
  * operand: ['Ev', 'Ib']
- * opcode: 04
  * semantic: cf.id = bit_cast((op0.val >> (bit_cast(op1.val, int_type(op0.bit)) & (int(op0.bit, op0.bit) - int(op0.bit, 1)))), int_type1);
 
  *
+ * opcode: 05
  * mnemonic: bts
  * operand: ['Ev', 'Ib']
- * opcode: 05
  * semantic: alloc_var('res', op0.bit);
 alloc_var('bit_set', op0.bit);
 bit_set = bit_cast(op1.val, int_type(op0.bit)) & (int(op0.bit, op0.bit) - int(op0.bit, 1));
@@ -11149,9 +10549,9 @@ free_var('bit_set');
 free_var('res');
 
  *
+ * opcode: 06
  * mnemonic: btr
  * operand: ['Ev', 'Ib']
- * opcode: 06
  * semantic: alloc_var('bit_set', op0.bit);
 bit_set = bit_cast(op1.val, int_type(op0.bit)) & (int(op0.bit, op0.bit) - int(op0.bit, 1));
 cf.id = bit_cast((op0.val >> bit_set), int_type1);
@@ -11159,9 +10559,9 @@ op0.val = (op0.val & (~(int(op0.bit, 1) << bit_cast(bit_set, int_type(op0.bit)))
 free_var('bit_set');
 
  *
+ * opcode: 07
  * mnemonic: btc
  * operand: ['Ev', 'Ib']
- * opcode: 07
  * semantic: alloc_var('bit_set', op0.bit);
 bit_set = bit_cast(op1.val, int_type(op0.bit)) & (int(op0.bit, op0.bit) - int(op0.bit, 1));
 cf.id = bit_cast((op0.val >> bit_set), int_type1);
@@ -11170,7 +10570,8 @@ free_var('bit_set');
 
  *
 **/
-bool X86Architecture::Table_2_ba(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_2_ba(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     u8 ModRmByte;
     if (!rBinStrm.Read(Offset, ModRmByte))
@@ -11190,7 +10591,7 @@ bool X86Architecture::Table_2_ba(BinaryStream const& rBinStrm, OffsetType Offset
     case 0x4:
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Bt);
-      if (Operand__Ev_Ib(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Ev_Ib<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -11215,7 +10616,7 @@ bool X86Architecture::Table_2_ba(BinaryStream const& rBinStrm, OffsetType Offset
     case 0x5:
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Bts);
-      if (Operand__Ev_Ib(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Ev_Ib<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -11266,7 +10667,7 @@ bool X86Architecture::Table_2_ba(BinaryStream const& rBinStrm, OffsetType Offset
     case 0x6:
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Btr);
-      if (Operand__Ev_Ib(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Ev_Ib<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -11311,7 +10712,7 @@ bool X86Architecture::Table_2_ba(BinaryStream const& rBinStrm, OffsetType Offset
     case 0x7:
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Btc);
-      if (Operand__Ev_Ib(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Ev_Ib<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -11357,9 +10758,9 @@ bool X86Architecture::Table_2_ba(BinaryStream const& rBinStrm, OffsetType Offset
 }
 
 /** instruction
+ * opcode: bb
  * mnemonic: btc
  * operand: ['Ev', 'Gv']
- * opcode: bb
  * cpu_model: >= X86_Arch_80386
  * semantic: alloc_var('bit_set', op0.bit);
 bit_set = bit_cast(op1.val, int_type(op0.bit)) & (int(op0.bit, op0.bit) - int(op0.bit, 1));
@@ -11368,13 +10769,14 @@ op0.val = (op0.val ^ ((int(op0.bit, 1) << bit_cast(bit_set, int_type(op0.bit))))
 free_var('bit_set');
 
 **/
-bool X86Architecture::Table_2_bb(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_2_bb(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_80386)
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Btc);
-      if (Operand__Ev_Gv(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Ev_Gv<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -11424,26 +10826,27 @@ bool X86Architecture::Table_2_bb(BinaryStream const& rBinStrm, OffsetType Offset
  *
  * mnemonic: bsf
  * operand: ['Gv', 'Ev']
+ * cpu_model: >= X86_Arch_80386
  * semantic: if __expr and op1.val == int(op1.bit, 0):
   zf.id = int1(1)
 else:
   zf.id = int1(0)
   op0.val = bsf(op1.val);
 
- * cpu_model: >= X86_Arch_80386
  *
  * mnemonic: tzcnt
  * operand: ['Gv', 'Ev']
  * prefix: f3
  *
 **/
-bool X86Architecture::Table_2_bc(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_2_bc(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if ((rInsn.GetPrefix() & X86_Prefix_Rep) == X86_Prefix_Rep)
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Tzcnt);
-      if (Operand__Gv_Ev(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Gv_Ev<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -11453,7 +10856,7 @@ bool X86Architecture::Table_2_bc(BinaryStream const& rBinStrm, OffsetType Offset
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Bsf);
-      if (Operand__Gv_Ev(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Gv_Ev<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -11491,26 +10894,27 @@ bool X86Architecture::Table_2_bc(BinaryStream const& rBinStrm, OffsetType Offset
  *
  * mnemonic: bsr
  * operand: ['Gv', 'Ev']
+ * cpu_model: >= X86_Arch_80386
  * semantic: if __expr and op1.val == int(op1.bit, 0):
   zf.id = int1(1)
 else:
   zf.id = int1(0)
   op0.val = bsr(op1);
 
- * cpu_model: >= X86_Arch_80386
  *
  * mnemonic: lzcnt
  * operand: ['Gv', 'Ev']
  * prefix: f3
  *
 **/
-bool X86Architecture::Table_2_bd(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_2_bd(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if ((rInsn.GetPrefix() & X86_Prefix_Rep) == X86_Prefix_Rep)
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Lzcnt);
-      if (Operand__Gv_Ev(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Gv_Ev<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -11520,7 +10924,7 @@ bool X86Architecture::Table_2_bd(BinaryStream const& rBinStrm, OffsetType Offset
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Bsr);
-      if (Operand__Gv_Ev(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Gv_Ev<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -11554,20 +10958,21 @@ bool X86Architecture::Table_2_bd(BinaryStream const& rBinStrm, OffsetType Offset
 }
 
 /** instruction
+ * opcode: be
  * mnemonic: movsx
  * operand: ['Gv', 'Eb']
- * opcode: be
  * cpu_model: >= X86_Arch_80386
  * semantic: op0.val = sign_extend(op1.val, int(op0.bit, op0.bit));
 
 **/
-bool X86Architecture::Table_2_be(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_2_be(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_80386)
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Movsx);
-      if (Operand__Gv_Eb(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Gv_Eb<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -11586,20 +10991,21 @@ bool X86Architecture::Table_2_be(BinaryStream const& rBinStrm, OffsetType Offset
 }
 
 /** instruction
+ * opcode: bf
  * mnemonic: movsx
  * operand: ['Gv', 'Ew']
- * opcode: bf
  * cpu_model: >= X86_Arch_80386
  * semantic: op0.val = sign_extend(op1.val, int(op0.bit, op0.bit));
 
 **/
-bool X86Architecture::Table_2_bf(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_2_bf(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_80386)
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Movsx);
-      if (Operand__Gv_Ew(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Gv_Ew<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -11618,7 +11024,11 @@ bool X86Architecture::Table_2_bf(BinaryStream const& rBinStrm, OffsetType Offset
 }
 
 /** instruction
+ * opcode: c0
  * mnemonic: xadd
+ * operand: ['Eb', 'Gb']
+ * update_flags: ['cf', 'pf', 'af', 'zf', 'sf', 'of']
+ * cpu_model: >= X86_Arch_80486
  * semantic: alloc_var('res', op0.bit);
 alloc_var('tmp_val', op0.bit);
 tmp_val = op0.val;
@@ -11635,18 +11045,15 @@ op0.val = res;
 free_var('res');
 free_var('tmp_val');
 
- * operand: ['Eb', 'Gb']
- * opcode: c0
- * update_flags: ['cf', 'pf', 'af', 'zf', 'sf', 'of']
- * cpu_model: >= X86_Arch_80486
 **/
-bool X86Architecture::Table_2_c0(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_2_c0(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_80486)
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Xadd);
-      if (Operand__Eb_Gb(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Eb_Gb<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -11861,7 +11268,11 @@ bool X86Architecture::Table_2_c0(BinaryStream const& rBinStrm, OffsetType Offset
 }
 
 /** instruction
+ * opcode: c1
  * mnemonic: xadd
+ * operand: ['Ev', 'Gv']
+ * update_flags: ['cf', 'pf', 'af', 'zf', 'sf', 'of']
+ * cpu_model: >= X86_Arch_80486
  * semantic: alloc_var('res', op0.bit);
 alloc_var('tmp_val', op0.bit);
 tmp_val = op0.val;
@@ -11878,18 +11289,15 @@ op0.val = res;
 free_var('res');
 free_var('tmp_val');
 
- * operand: ['Ev', 'Gv']
- * opcode: c1
- * update_flags: ['cf', 'pf', 'af', 'zf', 'sf', 'of']
- * cpu_model: >= X86_Arch_80486
 **/
-bool X86Architecture::Table_2_c1(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_2_c1(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_80486)
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Xadd);
-      if (Operand__Ev_Gv(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Ev_Gv<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -12104,27 +11512,19 @@ bool X86Architecture::Table_2_c1(BinaryStream const& rBinStrm, OffsetType Offset
 }
 
 /** instruction
- * opcode: c2
- * invalid
-**/
-bool X86Architecture::Table_2_c2(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
+ * opcode: c3
  * mnemonic: movnti
  * operand: ['My', 'Gy']
- * opcode: c3
  * cpu_model: >= X86_Arch_Sse2
 **/
-bool X86Architecture::Table_2_c3(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_2_c3(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_Sse2)
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Movnti);
-      if (Operand__My_Gy(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__My_Gy<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -12147,13 +11547,14 @@ bool X86Architecture::Table_2_c3(BinaryStream const& rBinStrm, OffsetType Offset
  * cpu_model: >= X86_Arch_Sse2
  *
 **/
-bool X86Architecture::Table_2_c4(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_2_c4(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_Sse2 && (rInsn.GetPrefix() & X86_Prefix_OpSize) == X86_Prefix_OpSize)
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Pinsrw);
-      if (Operand__Vo_Mw_Ib(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vo_Mw_Ib<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -12163,7 +11564,7 @@ bool X86Architecture::Table_2_c4(BinaryStream const& rBinStrm, OffsetType Offset
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Pinsrw);
-      if (Operand__Pq_Mw_Ib(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Pq_Mw_Ib<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -12185,13 +11586,14 @@ bool X86Architecture::Table_2_c4(BinaryStream const& rBinStrm, OffsetType Offset
  * cpu_model: >= X86_Arch_Sse2
  *
 **/
-bool X86Architecture::Table_2_c5(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_2_c5(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_Sse2 && (rInsn.GetPrefix() & X86_Prefix_OpSize) == X86_Prefix_OpSize)
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Pextrw);
-      if (Operand__Gy_Uo_Ib(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Gy_Uo_Ib<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -12201,7 +11603,7 @@ bool X86Architecture::Table_2_c5(BinaryStream const& rBinStrm, OffsetType Offset
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Pextrw);
-      if (Operand__Gy_Nq_Ib(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Gy_Nq_Ib<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -12223,13 +11625,14 @@ bool X86Architecture::Table_2_c5(BinaryStream const& rBinStrm, OffsetType Offset
  * cpu_model: >= X86_Arch_Sse2
  *
 **/
-bool X86Architecture::Table_2_c6(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_2_c6(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_Sse2 && (rInsn.GetPrefix() & X86_Prefix_OpSize) == X86_Prefix_OpSize)
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Shufpd);
-      if (Operand__Vx_Wx_Ib(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vx_Wx_Ib<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -12239,7 +11642,7 @@ bool X86Architecture::Table_2_c6(BinaryStream const& rBinStrm, OffsetType Offset
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Shufps);
-      if (Operand__Vx_Wx_Ib(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vx_Wx_Ib<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -12253,7 +11656,7 @@ bool X86Architecture::Table_2_c6(BinaryStream const& rBinStrm, OffsetType Offset
  * invalid
  *
  * opcode: 01
- * sub_opcodes: [{'mnemonic': 'cmpxchg8b', 'operand': ['Mq'], 'semantic': []}, {'mnemonic': 'cmpxchg16b', 'operand': ['Uo'], 'semantic': [], 'attr': ['m64']}]
+ * sub_opcodes: [{'mnemonic': 'cmpxchg8b', 'operand': ['Mq'], 'semantic': []}, {'mnemonic': 'cmpxchg16b', 'operand': ['Uo'], 'attr': ['m64'], 'semantic': []}]
  *
  * opcode: 02
  * invalid
@@ -12270,12 +11673,13 @@ bool X86Architecture::Table_2_c6(BinaryStream const& rBinStrm, OffsetType Offset
  * opcode: 06
  * sub_opcodes: [{'mnemonic': 'vmptrld', 'operand': ['Mq']}, {'mnemonic': 'vmclear', 'operand': ['Mq'], 'prefix': 102}, {'mnemonic': 'vmxon', 'prefix': 243}]
  *
+ * opcode: 07
  * mnemonic: vmptrst
  * operand: ['Mq']
- * opcode: 07
  *
 **/
-bool X86Architecture::Table_2_c7(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_2_c7(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     u8 ModRmByte;
     if (!rBinStrm.Read(Offset, ModRmByte))
@@ -12291,7 +11695,7 @@ bool X86Architecture::Table_2_c7(BinaryStream const& rBinStrm, OffsetType Offset
       {
         rInsn.Size()++;
         rInsn.SetOpcode(X86_Opcode_Cmpxchg16b);
-        if (Operand__Uo(rBinStrm, Offset, rInsn, Mode) == false)
+        if (Operand__Uo<Mode>(rBinStrm, Offset, rInsn) == false)
         {
           return false;
         }
@@ -12301,7 +11705,7 @@ bool X86Architecture::Table_2_c7(BinaryStream const& rBinStrm, OffsetType Offset
       {
         rInsn.Size()++;
         rInsn.SetOpcode(X86_Opcode_Cmpxchg8b);
-        if (Operand__Mq(rBinStrm, Offset, rInsn, Mode) == false)
+        if (Operand__Mq<Mode>(rBinStrm, Offset, rInsn) == false)
         {
           return false;
         }
@@ -12326,7 +11730,7 @@ bool X86Architecture::Table_2_c7(BinaryStream const& rBinStrm, OffsetType Offset
       {
         rInsn.Size()++;
         rInsn.SetOpcode(X86_Opcode_Vmclear);
-        if (Operand__Mq(rBinStrm, Offset, rInsn, Mode) == false)
+        if (Operand__Mq<Mode>(rBinStrm, Offset, rInsn) == false)
         {
           return false;
         }
@@ -12336,7 +11740,7 @@ bool X86Architecture::Table_2_c7(BinaryStream const& rBinStrm, OffsetType Offset
       {
         rInsn.Size()++;
         rInsn.SetOpcode(X86_Opcode_Vmptrld);
-        if (Operand__Mq(rBinStrm, Offset, rInsn, Mode) == false)
+        if (Operand__Mq<Mode>(rBinStrm, Offset, rInsn) == false)
         {
           return false;
         }
@@ -12345,7 +11749,7 @@ bool X86Architecture::Table_2_c7(BinaryStream const& rBinStrm, OffsetType Offset
     case 0x7:
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Vmptrst);
-      if (Operand__Mq(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Mq<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -12360,31 +11764,32 @@ bool X86Architecture::Table_2_c7(BinaryStream const& rBinStrm, OffsetType Offset
  *
  * mnemonic: bswap
  * operand: ['rAX']
+ * cpu_model: >= X86_Arch_80486
  * semantic: if __expr and int(op0.bit, op0.bit) == int(op0.bit, 16): # Handle undefined processor state on 16-bit
   op0.val = int(op0.bit, 0)
 else:
   op0.val = swap(op0.val);
 
- * cpu_model: >= X86_Arch_80486
  *
  * mnemonic: bswap
  * operand: ['r8']
+ * attr: ['rexb']
+ * cpu_model: >= X86_Arch_80486
  * semantic: if __expr and int(op0.bit, op0.bit) == int(op0.bit, 16): # Handle undefined processor state on 16-bit
   op0.val = int(op0.bit, 0)
 else:
   op0.val = swap(op0.val);
 
- * attr: ['rexb']
- * cpu_model: >= X86_Arch_80486
  *
 **/
-bool X86Architecture::Table_2_c8(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_2_c8(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_80486 && (rInsn.GetPrefix() & X86_Prefix_REX_b) == X86_Prefix_REX_b)
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Bswap);
-      if (Operand__r8(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__r8<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -12412,7 +11817,7 @@ bool X86Architecture::Table_2_c8(BinaryStream const& rBinStrm, OffsetType Offset
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Bswap);
-      if (Operand__rAX(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__rAX<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -12444,31 +11849,32 @@ bool X86Architecture::Table_2_c8(BinaryStream const& rBinStrm, OffsetType Offset
  *
  * mnemonic: bswap
  * operand: ['rCX']
+ * cpu_model: >= X86_Arch_80486
  * semantic: if __expr and int(op0.bit, op0.bit) == int(op0.bit, 16): # Handle undefined processor state on 16-bit
   op0.val = int(op0.bit, 0)
 else:
   op0.val = swap(op0.val);
 
- * cpu_model: >= X86_Arch_80486
  *
  * mnemonic: bswap
  * operand: ['r9']
+ * attr: ['rexb']
+ * cpu_model: >= X86_Arch_80486
  * semantic: if __expr and int(op0.bit, op0.bit) == int(op0.bit, 16): # Handle undefined processor state on 16-bit
   op0.val = int(op0.bit, 0)
 else:
   op0.val = swap(op0.val);
 
- * attr: ['rexb']
- * cpu_model: >= X86_Arch_80486
  *
 **/
-bool X86Architecture::Table_2_c9(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_2_c9(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_80486 && (rInsn.GetPrefix() & X86_Prefix_REX_b) == X86_Prefix_REX_b)
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Bswap);
-      if (Operand__r9(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__r9<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -12496,7 +11902,7 @@ bool X86Architecture::Table_2_c9(BinaryStream const& rBinStrm, OffsetType Offset
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Bswap);
-      if (Operand__rCX(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__rCX<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -12528,31 +11934,32 @@ bool X86Architecture::Table_2_c9(BinaryStream const& rBinStrm, OffsetType Offset
  *
  * mnemonic: bswap
  * operand: ['rDX']
+ * cpu_model: >= X86_Arch_80486
  * semantic: if __expr and int(op0.bit, op0.bit) == int(op0.bit, 16): # Handle undefined processor state on 16-bit
   op0.val = int(op0.bit, 0)
 else:
   op0.val = swap(op0.val);
 
- * cpu_model: >= X86_Arch_80486
  *
  * mnemonic: bswap
  * operand: ['r10']
+ * attr: ['rexb']
+ * cpu_model: >= X86_Arch_80486
  * semantic: if __expr and int(op0.bit, op0.bit) == int(op0.bit, 16): # Handle undefined processor state on 16-bit
   op0.val = int(op0.bit, 0)
 else:
   op0.val = swap(op0.val);
 
- * attr: ['rexb']
- * cpu_model: >= X86_Arch_80486
  *
 **/
-bool X86Architecture::Table_2_ca(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_2_ca(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_80486 && (rInsn.GetPrefix() & X86_Prefix_REX_b) == X86_Prefix_REX_b)
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Bswap);
-      if (Operand__r10(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__r10<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -12580,7 +11987,7 @@ bool X86Architecture::Table_2_ca(BinaryStream const& rBinStrm, OffsetType Offset
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Bswap);
-      if (Operand__rDX(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__rDX<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -12612,31 +12019,32 @@ bool X86Architecture::Table_2_ca(BinaryStream const& rBinStrm, OffsetType Offset
  *
  * mnemonic: bswap
  * operand: ['rBX']
+ * cpu_model: >= X86_Arch_80486
  * semantic: if __expr and int(op0.bit, op0.bit) == int(op0.bit, 16): # Handle undefined processor state on 16-bit
   op0.val = int(op0.bit, 0)
 else:
   op0.val = swap(op0.val);
 
- * cpu_model: >= X86_Arch_80486
  *
  * mnemonic: bswap
  * operand: ['r11']
+ * attr: ['rexb']
+ * cpu_model: >= X86_Arch_80486
  * semantic: if __expr and int(op0.bit, op0.bit) == int(op0.bit, 16): # Handle undefined processor state on 16-bit
   op0.val = int(op0.bit, 0)
 else:
   op0.val = swap(op0.val);
 
- * attr: ['rexb']
- * cpu_model: >= X86_Arch_80486
  *
 **/
-bool X86Architecture::Table_2_cb(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_2_cb(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_80486 && (rInsn.GetPrefix() & X86_Prefix_REX_b) == X86_Prefix_REX_b)
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Bswap);
-      if (Operand__r11(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__r11<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -12664,7 +12072,7 @@ bool X86Architecture::Table_2_cb(BinaryStream const& rBinStrm, OffsetType Offset
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Bswap);
-      if (Operand__rBX(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__rBX<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -12696,31 +12104,32 @@ bool X86Architecture::Table_2_cb(BinaryStream const& rBinStrm, OffsetType Offset
  *
  * mnemonic: bswap
  * operand: ['rSP']
+ * cpu_model: >= X86_Arch_80486
  * semantic: if __expr and int(op0.bit, op0.bit) == int(op0.bit, 16): # Handle undefined processor state on 16-bit
   op0.val = int(op0.bit, 0)
 else:
   op0.val = swap(op0.val);
 
- * cpu_model: >= X86_Arch_80486
  *
  * mnemonic: bswap
  * operand: ['r12']
+ * attr: ['rexb']
+ * cpu_model: >= X86_Arch_80486
  * semantic: if __expr and int(op0.bit, op0.bit) == int(op0.bit, 16): # Handle undefined processor state on 16-bit
   op0.val = int(op0.bit, 0)
 else:
   op0.val = swap(op0.val);
 
- * attr: ['rexb']
- * cpu_model: >= X86_Arch_80486
  *
 **/
-bool X86Architecture::Table_2_cc(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_2_cc(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_80486 && (rInsn.GetPrefix() & X86_Prefix_REX_b) == X86_Prefix_REX_b)
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Bswap);
-      if (Operand__r12(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__r12<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -12748,7 +12157,7 @@ bool X86Architecture::Table_2_cc(BinaryStream const& rBinStrm, OffsetType Offset
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Bswap);
-      if (Operand__rSP(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__rSP<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -12780,31 +12189,32 @@ bool X86Architecture::Table_2_cc(BinaryStream const& rBinStrm, OffsetType Offset
  *
  * mnemonic: bswap
  * operand: ['rBP']
+ * cpu_model: >= X86_Arch_80486
  * semantic: if __expr and int(op0.bit, op0.bit) == int(op0.bit, 16): # Handle undefined processor state on 16-bit
   op0.val = int(op0.bit, 0)
 else:
   op0.val = swap(op0.val);
 
- * cpu_model: >= X86_Arch_80486
  *
  * mnemonic: bswap
  * operand: ['r13']
+ * attr: ['rexb']
+ * cpu_model: >= X86_Arch_80486
  * semantic: if __expr and int(op0.bit, op0.bit) == int(op0.bit, 16): # Handle undefined processor state on 16-bit
   op0.val = int(op0.bit, 0)
 else:
   op0.val = swap(op0.val);
 
- * attr: ['rexb']
- * cpu_model: >= X86_Arch_80486
  *
 **/
-bool X86Architecture::Table_2_cd(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_2_cd(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_80486 && (rInsn.GetPrefix() & X86_Prefix_REX_b) == X86_Prefix_REX_b)
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Bswap);
-      if (Operand__r13(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__r13<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -12832,7 +12242,7 @@ bool X86Architecture::Table_2_cd(BinaryStream const& rBinStrm, OffsetType Offset
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Bswap);
-      if (Operand__rBP(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__rBP<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -12864,31 +12274,32 @@ bool X86Architecture::Table_2_cd(BinaryStream const& rBinStrm, OffsetType Offset
  *
  * mnemonic: bswap
  * operand: ['rSI']
+ * cpu_model: >= X86_Arch_80486
  * semantic: if __expr and int(op0.bit, op0.bit) == int(op0.bit, 16): # Handle undefined processor state on 16-bit
   op0.val = int(op0.bit, 0)
 else:
   op0.val = swap(op0.val);
 
- * cpu_model: >= X86_Arch_80486
  *
  * mnemonic: bswap
  * operand: ['r14']
+ * attr: ['rexb']
+ * cpu_model: >= X86_Arch_80486
  * semantic: if __expr and int(op0.bit, op0.bit) == int(op0.bit, 16): # Handle undefined processor state on 16-bit
   op0.val = int(op0.bit, 0)
 else:
   op0.val = swap(op0.val);
 
- * attr: ['rexb']
- * cpu_model: >= X86_Arch_80486
  *
 **/
-bool X86Architecture::Table_2_ce(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_2_ce(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_80486 && (rInsn.GetPrefix() & X86_Prefix_REX_b) == X86_Prefix_REX_b)
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Bswap);
-      if (Operand__r14(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__r14<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -12916,7 +12327,7 @@ bool X86Architecture::Table_2_ce(BinaryStream const& rBinStrm, OffsetType Offset
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Bswap);
-      if (Operand__rSI(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__rSI<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -12948,31 +12359,32 @@ bool X86Architecture::Table_2_ce(BinaryStream const& rBinStrm, OffsetType Offset
  *
  * mnemonic: bswap
  * operand: ['rDI']
+ * cpu_model: >= X86_Arch_80486
  * semantic: if __expr and int(op0.bit, op0.bit) == int(op0.bit, 16): # Handle undefined processor state on 16-bit
   op0.val = int(op0.bit, 0)
 else:
   op0.val = swap(op0.val);
 
- * cpu_model: >= X86_Arch_80486
  *
  * mnemonic: bswap
  * operand: ['r15']
+ * attr: ['rexb']
+ * cpu_model: >= X86_Arch_80486
  * semantic: if __expr and int(op0.bit, op0.bit) == int(op0.bit, 16): # Handle undefined processor state on 16-bit
   op0.val = int(op0.bit, 0)
 else:
   op0.val = swap(op0.val);
 
- * attr: ['rexb']
- * cpu_model: >= X86_Arch_80486
  *
 **/
-bool X86Architecture::Table_2_cf(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_2_cf(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_80486 && (rInsn.GetPrefix() & X86_Prefix_REX_b) == X86_Prefix_REX_b)
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Bswap);
-      if (Operand__r15(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__r15<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -13000,7 +12412,7 @@ bool X86Architecture::Table_2_cf(BinaryStream const& rBinStrm, OffsetType Offset
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Bswap);
-      if (Operand__rDI(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__rDI<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -13043,13 +12455,14 @@ bool X86Architecture::Table_2_cf(BinaryStream const& rBinStrm, OffsetType Offset
  * cpu_model: >= X86_Arch_Sse3
  *
 **/
-bool X86Architecture::Table_2_d0(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_2_d0(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_Sse3 && (rInsn.GetPrefix() & X86_Prefix_RepNz) == X86_Prefix_RepNz)
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Addsubps);
-      if (Operand__Vx_Wx(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vx_Wx<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -13059,7 +12472,7 @@ bool X86Architecture::Table_2_d0(BinaryStream const& rBinStrm, OffsetType Offset
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Addsubps);
-      if (Operand__Vx_Wx(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vx_Wx<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -13084,13 +12497,14 @@ bool X86Architecture::Table_2_d0(BinaryStream const& rBinStrm, OffsetType Offset
  * cpu_model: >= X86_Arch_Sse2
  *
 **/
-bool X86Architecture::Table_2_d1(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_2_d1(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_Sse2 && (rInsn.GetPrefix() & X86_Prefix_OpSize) == X86_Prefix_OpSize)
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Psrlw);
-      if (Operand__Vx_Wx(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vx_Wx<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -13100,7 +12514,7 @@ bool X86Architecture::Table_2_d1(BinaryStream const& rBinStrm, OffsetType Offset
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Psrlw);
-      if (Operand__Pq_Qq(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Pq_Qq<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -13122,13 +12536,14 @@ bool X86Architecture::Table_2_d1(BinaryStream const& rBinStrm, OffsetType Offset
  * cpu_model: >= X86_Arch_Sse2
  *
 **/
-bool X86Architecture::Table_2_d2(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_2_d2(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_Sse2 && (rInsn.GetPrefix() & X86_Prefix_OpSize) == X86_Prefix_OpSize)
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Psrld);
-      if (Operand__Vx_Wx(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vx_Wx<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -13138,7 +12553,7 @@ bool X86Architecture::Table_2_d2(BinaryStream const& rBinStrm, OffsetType Offset
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Psrld);
-      if (Operand__Pq_Qq(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Pq_Qq<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -13160,13 +12575,14 @@ bool X86Architecture::Table_2_d2(BinaryStream const& rBinStrm, OffsetType Offset
  * cpu_model: >= X86_Arch_Sse2
  *
 **/
-bool X86Architecture::Table_2_d3(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_2_d3(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_Sse2 && (rInsn.GetPrefix() & X86_Prefix_OpSize) == X86_Prefix_OpSize)
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Psrld);
-      if (Operand__Vx_Wx(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vx_Wx<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -13176,7 +12592,7 @@ bool X86Architecture::Table_2_d3(BinaryStream const& rBinStrm, OffsetType Offset
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Psrlq);
-      if (Operand__Pq_Qq(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Pq_Qq<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -13198,13 +12614,14 @@ bool X86Architecture::Table_2_d3(BinaryStream const& rBinStrm, OffsetType Offset
  * cpu_model: >= X86_Arch_Sse2
  *
 **/
-bool X86Architecture::Table_2_d4(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_2_d4(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_Sse2 && (rInsn.GetPrefix() & X86_Prefix_OpSize) == X86_Prefix_OpSize)
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Paddq);
-      if (Operand__Vx_Wx(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vx_Wx<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -13214,7 +12631,7 @@ bool X86Architecture::Table_2_d4(BinaryStream const& rBinStrm, OffsetType Offset
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Paddq);
-      if (Operand__Pq_Qq(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Pq_Qq<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -13236,13 +12653,14 @@ bool X86Architecture::Table_2_d4(BinaryStream const& rBinStrm, OffsetType Offset
  * cpu_model: >= X86_Arch_Sse2
  *
 **/
-bool X86Architecture::Table_2_d5(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_2_d5(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_Sse2 && (rInsn.GetPrefix() & X86_Prefix_OpSize) == X86_Prefix_OpSize)
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Pmullw);
-      if (Operand__Vx_Wx(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vx_Wx<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -13252,7 +12670,7 @@ bool X86Architecture::Table_2_d5(BinaryStream const& rBinStrm, OffsetType Offset
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Pmullw);
-      if (Operand__Pq_Qq(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Pq_Qq<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -13282,13 +12700,14 @@ bool X86Architecture::Table_2_d5(BinaryStream const& rBinStrm, OffsetType Offset
  * cpu_model: >= X86_Arch_Sse2_mmx
  *
 **/
-bool X86Architecture::Table_2_d6(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_2_d6(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_Sse2_mmx && (rInsn.GetPrefix() & X86_Prefix_RepNz) == X86_Prefix_RepNz)
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Movdq2q);
-      if (Operand__Pq_Uq(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Pq_Uq<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -13298,7 +12717,7 @@ bool X86Architecture::Table_2_d6(BinaryStream const& rBinStrm, OffsetType Offset
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Movq2dq);
-      if (Operand__Vo_Nq(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vo_Nq<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -13308,7 +12727,7 @@ bool X86Architecture::Table_2_d6(BinaryStream const& rBinStrm, OffsetType Offset
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Movq);
-      if (Operand__Woq_Vo(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Woq_Vo<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -13333,13 +12752,14 @@ bool X86Architecture::Table_2_d6(BinaryStream const& rBinStrm, OffsetType Offset
  * cpu_model: >= X86_Arch_Sse2
  *
 **/
-bool X86Architecture::Table_2_d7(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_2_d7(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_Sse2 && (rInsn.GetPrefix() & X86_Prefix_OpSize) == X86_Prefix_OpSize)
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Pmovmskb);
-      if (Operand__Gy_Ux(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Gy_Ux<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -13349,7 +12769,7 @@ bool X86Architecture::Table_2_d7(BinaryStream const& rBinStrm, OffsetType Offset
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Pmovmskb);
-      if (Operand__Gy_Nq(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Gy_Nq<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -13371,13 +12791,14 @@ bool X86Architecture::Table_2_d7(BinaryStream const& rBinStrm, OffsetType Offset
  * cpu_model: >= X86_Arch_Sse2
  *
 **/
-bool X86Architecture::Table_2_d8(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_2_d8(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_Sse2 && (rInsn.GetPrefix() & X86_Prefix_OpSize) == X86_Prefix_OpSize)
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Psubusb);
-      if (Operand__Vx_Wx(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vx_Wx<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -13387,7 +12808,7 @@ bool X86Architecture::Table_2_d8(BinaryStream const& rBinStrm, OffsetType Offset
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Psubusb);
-      if (Operand__Pq_Qq(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Pq_Qq<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -13409,13 +12830,14 @@ bool X86Architecture::Table_2_d8(BinaryStream const& rBinStrm, OffsetType Offset
  * cpu_model: >= X86_Arch_Sse2
  *
 **/
-bool X86Architecture::Table_2_d9(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_2_d9(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_Sse2 && (rInsn.GetPrefix() & X86_Prefix_OpSize) == X86_Prefix_OpSize)
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Psubusw);
-      if (Operand__Vx_Wx(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vx_Wx<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -13425,7 +12847,7 @@ bool X86Architecture::Table_2_d9(BinaryStream const& rBinStrm, OffsetType Offset
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Psubusw);
-      if (Operand__Pq_Qq(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Pq_Qq<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -13447,13 +12869,14 @@ bool X86Architecture::Table_2_d9(BinaryStream const& rBinStrm, OffsetType Offset
  * cpu_model: >= X86_Arch_Sse2
  *
 **/
-bool X86Architecture::Table_2_da(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_2_da(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_Sse2 && (rInsn.GetPrefix() & X86_Prefix_OpSize) == X86_Prefix_OpSize)
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Pminub);
-      if (Operand__Vx_Wx(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vx_Wx<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -13463,7 +12886,7 @@ bool X86Architecture::Table_2_da(BinaryStream const& rBinStrm, OffsetType Offset
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Pminub);
-      if (Operand__Pq_Qq(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Pq_Qq<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -13485,13 +12908,14 @@ bool X86Architecture::Table_2_da(BinaryStream const& rBinStrm, OffsetType Offset
  * cpu_model: >= X86_Arch_Sse2
  *
 **/
-bool X86Architecture::Table_2_db(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_2_db(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_Sse2 && (rInsn.GetPrefix() & X86_Prefix_OpSize) == X86_Prefix_OpSize)
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Pand);
-      if (Operand__Vx_Wx(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vx_Wx<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -13501,7 +12925,7 @@ bool X86Architecture::Table_2_db(BinaryStream const& rBinStrm, OffsetType Offset
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Pand);
-      if (Operand__Pq_Qq(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Pq_Qq<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -13523,13 +12947,14 @@ bool X86Architecture::Table_2_db(BinaryStream const& rBinStrm, OffsetType Offset
  * cpu_model: >= X86_Arch_Sse2
  *
 **/
-bool X86Architecture::Table_2_dc(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_2_dc(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_Sse2 && (rInsn.GetPrefix() & X86_Prefix_OpSize) == X86_Prefix_OpSize)
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Paddusb);
-      if (Operand__Vx_Wx(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vx_Wx<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -13539,7 +12964,7 @@ bool X86Architecture::Table_2_dc(BinaryStream const& rBinStrm, OffsetType Offset
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Paddusb);
-      if (Operand__Pq_Qq(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Pq_Qq<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -13561,13 +12986,14 @@ bool X86Architecture::Table_2_dc(BinaryStream const& rBinStrm, OffsetType Offset
  * cpu_model: >= X86_Arch_Sse2
  *
 **/
-bool X86Architecture::Table_2_dd(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_2_dd(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_Sse2 && (rInsn.GetPrefix() & X86_Prefix_OpSize) == X86_Prefix_OpSize)
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Paddusw);
-      if (Operand__Vx_Wx(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vx_Wx<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -13577,7 +13003,7 @@ bool X86Architecture::Table_2_dd(BinaryStream const& rBinStrm, OffsetType Offset
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Paddusw);
-      if (Operand__Pq_Qq(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Pq_Qq<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -13599,13 +13025,14 @@ bool X86Architecture::Table_2_dd(BinaryStream const& rBinStrm, OffsetType Offset
  * cpu_model: >= X86_Arch_Sse2
  *
 **/
-bool X86Architecture::Table_2_de(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_2_de(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_Sse2 && (rInsn.GetPrefix() & X86_Prefix_OpSize) == X86_Prefix_OpSize)
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Pmaxub);
-      if (Operand__Vx_Wx(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vx_Wx<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -13615,7 +13042,7 @@ bool X86Architecture::Table_2_de(BinaryStream const& rBinStrm, OffsetType Offset
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Pmaxub);
-      if (Operand__Pq_Qq(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Pq_Qq<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -13637,13 +13064,14 @@ bool X86Architecture::Table_2_de(BinaryStream const& rBinStrm, OffsetType Offset
  * cpu_model: >= X86_Arch_Sse2
  *
 **/
-bool X86Architecture::Table_2_df(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_2_df(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_Sse2 && (rInsn.GetPrefix() & X86_Prefix_OpSize) == X86_Prefix_OpSize)
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Pandn);
-      if (Operand__Vx_Wx(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vx_Wx<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -13653,7 +13081,7 @@ bool X86Architecture::Table_2_df(BinaryStream const& rBinStrm, OffsetType Offset
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Pandn);
-      if (Operand__Pq_Qq(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Pq_Qq<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -13675,13 +13103,14 @@ bool X86Architecture::Table_2_df(BinaryStream const& rBinStrm, OffsetType Offset
  * cpu_model: >= X86_Arch_Sse2
  *
 **/
-bool X86Architecture::Table_2_e0(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_2_e0(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_Sse2 && (rInsn.GetPrefix() & X86_Prefix_OpSize) == X86_Prefix_OpSize)
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Pavgb);
-      if (Operand__Vx_Wx(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vx_Wx<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -13691,7 +13120,7 @@ bool X86Architecture::Table_2_e0(BinaryStream const& rBinStrm, OffsetType Offset
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Pavgb);
-      if (Operand__Pq_Qq(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Pq_Qq<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -13713,13 +13142,14 @@ bool X86Architecture::Table_2_e0(BinaryStream const& rBinStrm, OffsetType Offset
  * cpu_model: >= X86_Arch_Sse2
  *
 **/
-bool X86Architecture::Table_2_e1(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_2_e1(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_Sse2 && (rInsn.GetPrefix() & X86_Prefix_OpSize) == X86_Prefix_OpSize)
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Psraw);
-      if (Operand__Vx_Wx(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vx_Wx<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -13729,7 +13159,7 @@ bool X86Architecture::Table_2_e1(BinaryStream const& rBinStrm, OffsetType Offset
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Psraw);
-      if (Operand__Pq_Qq(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Pq_Qq<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -13751,13 +13181,14 @@ bool X86Architecture::Table_2_e1(BinaryStream const& rBinStrm, OffsetType Offset
  * cpu_model: >= X86_Arch_Sse2
  *
 **/
-bool X86Architecture::Table_2_e2(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_2_e2(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_Sse2 && (rInsn.GetPrefix() & X86_Prefix_OpSize) == X86_Prefix_OpSize)
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Psrad);
-      if (Operand__Vx_Wx(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vx_Wx<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -13767,7 +13198,7 @@ bool X86Architecture::Table_2_e2(BinaryStream const& rBinStrm, OffsetType Offset
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Psrad);
-      if (Operand__Pq_Qq(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Pq_Qq<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -13789,13 +13220,14 @@ bool X86Architecture::Table_2_e2(BinaryStream const& rBinStrm, OffsetType Offset
  * cpu_model: >= X86_Arch_Sse2
  *
 **/
-bool X86Architecture::Table_2_e3(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_2_e3(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_Sse2 && (rInsn.GetPrefix() & X86_Prefix_OpSize) == X86_Prefix_OpSize)
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Pavgw);
-      if (Operand__Vx_Wx(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vx_Wx<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -13805,7 +13237,7 @@ bool X86Architecture::Table_2_e3(BinaryStream const& rBinStrm, OffsetType Offset
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Pavgw);
-      if (Operand__Pq_Qq(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Pq_Qq<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -13827,13 +13259,14 @@ bool X86Architecture::Table_2_e3(BinaryStream const& rBinStrm, OffsetType Offset
  * cpu_model: >= X86_Arch_Sse2
  *
 **/
-bool X86Architecture::Table_2_e4(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_2_e4(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_Sse2 && (rInsn.GetPrefix() & X86_Prefix_OpSize) == X86_Prefix_OpSize)
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Pmulhuw);
-      if (Operand__Vx_Wx(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vx_Wx<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -13843,7 +13276,7 @@ bool X86Architecture::Table_2_e4(BinaryStream const& rBinStrm, OffsetType Offset
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Pmulhuw);
-      if (Operand__Pq_Qq(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Pq_Qq<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -13865,13 +13298,14 @@ bool X86Architecture::Table_2_e4(BinaryStream const& rBinStrm, OffsetType Offset
  * cpu_model: >= X86_Arch_Sse2
  *
 **/
-bool X86Architecture::Table_2_e5(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_2_e5(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_Sse2 && (rInsn.GetPrefix() & X86_Prefix_OpSize) == X86_Prefix_OpSize)
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Pmulhw);
-      if (Operand__Vx_Wx(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vx_Wx<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -13881,7 +13315,7 @@ bool X86Architecture::Table_2_e5(BinaryStream const& rBinStrm, OffsetType Offset
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Pmulhw);
-      if (Operand__Pq_Qq(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Pq_Qq<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -13911,13 +13345,14 @@ bool X86Architecture::Table_2_e5(BinaryStream const& rBinStrm, OffsetType Offset
  * cpu_model: >= X86_Arch_Sse2
  *
 **/
-bool X86Architecture::Table_2_e6(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_2_e6(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_Sse2 && (rInsn.GetPrefix() & X86_Prefix_RepNz) == X86_Prefix_RepNz)
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Cvtpd2dq);
-      if (Operand__Vo_Wx(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vo_Wx<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -13927,7 +13362,7 @@ bool X86Architecture::Table_2_e6(BinaryStream const& rBinStrm, OffsetType Offset
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Cvtdq2pd);
-      if (Operand__Vo_Woq(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vo_Woq<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -13937,7 +13372,7 @@ bool X86Architecture::Table_2_e6(BinaryStream const& rBinStrm, OffsetType Offset
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Cvttpd2dq);
-      if (Operand__Vo_Wx(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vo_Wx<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -13962,13 +13397,14 @@ bool X86Architecture::Table_2_e6(BinaryStream const& rBinStrm, OffsetType Offset
  * cpu_model: >= X86_Arch_Sse2
  *
 **/
-bool X86Architecture::Table_2_e7(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_2_e7(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_Sse2 && (rInsn.GetPrefix() & X86_Prefix_OpSize) == X86_Prefix_OpSize)
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Movntdq);
-      if (Operand__Mx_Vx(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Mx_Vx<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -13978,7 +13414,7 @@ bool X86Architecture::Table_2_e7(BinaryStream const& rBinStrm, OffsetType Offset
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Movntq);
-      if (Operand__Mq_Pq(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Mq_Pq<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -14000,13 +13436,14 @@ bool X86Architecture::Table_2_e7(BinaryStream const& rBinStrm, OffsetType Offset
  * cpu_model: >= X86_Arch_Sse2
  *
 **/
-bool X86Architecture::Table_2_e8(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_2_e8(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_Sse2 && (rInsn.GetPrefix() & X86_Prefix_OpSize) == X86_Prefix_OpSize)
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Psubsb);
-      if (Operand__Vx_Wx(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vx_Wx<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -14016,7 +13453,7 @@ bool X86Architecture::Table_2_e8(BinaryStream const& rBinStrm, OffsetType Offset
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Psubsb);
-      if (Operand__Pq_Qq(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Pq_Qq<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -14038,13 +13475,14 @@ bool X86Architecture::Table_2_e8(BinaryStream const& rBinStrm, OffsetType Offset
  * cpu_model: >= X86_Arch_Sse2
  *
 **/
-bool X86Architecture::Table_2_e9(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_2_e9(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_Sse2 && (rInsn.GetPrefix() & X86_Prefix_OpSize) == X86_Prefix_OpSize)
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Psubsw);
-      if (Operand__Vx_Wx(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vx_Wx<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -14054,7 +13492,7 @@ bool X86Architecture::Table_2_e9(BinaryStream const& rBinStrm, OffsetType Offset
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Psubsw);
-      if (Operand__Pq_Qq(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Pq_Qq<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -14076,13 +13514,14 @@ bool X86Architecture::Table_2_e9(BinaryStream const& rBinStrm, OffsetType Offset
  * cpu_model: >= X86_Arch_Sse2
  *
 **/
-bool X86Architecture::Table_2_ea(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_2_ea(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_Sse2 && (rInsn.GetPrefix() & X86_Prefix_OpSize) == X86_Prefix_OpSize)
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Pminsw);
-      if (Operand__Vx_Wx(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vx_Wx<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -14092,7 +13531,7 @@ bool X86Architecture::Table_2_ea(BinaryStream const& rBinStrm, OffsetType Offset
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Pminsw);
-      if (Operand__Pq_Qq(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Pq_Qq<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -14114,13 +13553,14 @@ bool X86Architecture::Table_2_ea(BinaryStream const& rBinStrm, OffsetType Offset
  * cpu_model: >= X86_Arch_Sse2
  *
 **/
-bool X86Architecture::Table_2_eb(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_2_eb(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_Sse2 && (rInsn.GetPrefix() & X86_Prefix_OpSize) == X86_Prefix_OpSize)
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Por);
-      if (Operand__Vx_Wx(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vx_Wx<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -14130,7 +13570,7 @@ bool X86Architecture::Table_2_eb(BinaryStream const& rBinStrm, OffsetType Offset
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Por);
-      if (Operand__Pq_Qq(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Pq_Qq<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -14152,13 +13592,14 @@ bool X86Architecture::Table_2_eb(BinaryStream const& rBinStrm, OffsetType Offset
  * cpu_model: >= X86_Arch_Sse2
  *
 **/
-bool X86Architecture::Table_2_ec(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_2_ec(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_Sse2 && (rInsn.GetPrefix() & X86_Prefix_OpSize) == X86_Prefix_OpSize)
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Paddsb);
-      if (Operand__Vx_Wx(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vx_Wx<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -14168,7 +13609,7 @@ bool X86Architecture::Table_2_ec(BinaryStream const& rBinStrm, OffsetType Offset
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Paddsb);
-      if (Operand__Pq_Qq(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Pq_Qq<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -14190,13 +13631,14 @@ bool X86Architecture::Table_2_ec(BinaryStream const& rBinStrm, OffsetType Offset
  * cpu_model: >= X86_Arch_Sse2
  *
 **/
-bool X86Architecture::Table_2_ed(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_2_ed(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_Sse2 && (rInsn.GetPrefix() & X86_Prefix_OpSize) == X86_Prefix_OpSize)
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Paddsw);
-      if (Operand__Vx_Wx(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vx_Wx<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -14206,7 +13648,7 @@ bool X86Architecture::Table_2_ed(BinaryStream const& rBinStrm, OffsetType Offset
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Paddsw);
-      if (Operand__Pq_Qq(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Pq_Qq<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -14228,13 +13670,14 @@ bool X86Architecture::Table_2_ed(BinaryStream const& rBinStrm, OffsetType Offset
  * cpu_model: >= X86_Arch_Sse2
  *
 **/
-bool X86Architecture::Table_2_ee(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_2_ee(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_Sse2 && (rInsn.GetPrefix() & X86_Prefix_OpSize) == X86_Prefix_OpSize)
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Pmaxsw);
-      if (Operand__Vx_Wx(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vx_Wx<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -14244,7 +13687,7 @@ bool X86Architecture::Table_2_ee(BinaryStream const& rBinStrm, OffsetType Offset
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Pmaxsw);
-      if (Operand__Pq_Qq(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Pq_Qq<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -14266,13 +13709,14 @@ bool X86Architecture::Table_2_ee(BinaryStream const& rBinStrm, OffsetType Offset
  * cpu_model: >= X86_Arch_Sse2
  *
 **/
-bool X86Architecture::Table_2_ef(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_2_ef(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_Sse2 && (rInsn.GetPrefix() & X86_Prefix_OpSize) == X86_Prefix_OpSize)
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Pxor);
-      if (Operand__Vx_Wx(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vx_Wx<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -14282,7 +13726,7 @@ bool X86Architecture::Table_2_ef(BinaryStream const& rBinStrm, OffsetType Offset
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Pxor);
-      if (Operand__Pq_Qq(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Pq_Qq<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -14302,13 +13746,14 @@ bool X86Architecture::Table_2_ef(BinaryStream const& rBinStrm, OffsetType Offset
  * cpu_model: >= X86_Arch_Sse3
  *
 **/
-bool X86Architecture::Table_2_f0(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_2_f0(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_Sse3 && (rInsn.GetPrefix() & X86_Prefix_RepNz) == X86_Prefix_RepNz)
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Lddqu);
-      if (Operand__Vx_Mx(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vx_Mx<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -14333,13 +13778,14 @@ bool X86Architecture::Table_2_f0(BinaryStream const& rBinStrm, OffsetType Offset
  * cpu_model: >= X86_Arch_Sse2
  *
 **/
-bool X86Architecture::Table_2_f1(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_2_f1(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_Sse2 && (rInsn.GetPrefix() & X86_Prefix_OpSize) == X86_Prefix_OpSize)
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Psllw);
-      if (Operand__Vx_Wx(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vx_Wx<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -14349,7 +13795,7 @@ bool X86Architecture::Table_2_f1(BinaryStream const& rBinStrm, OffsetType Offset
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Psllw);
-      if (Operand__Pq_Qq(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Pq_Qq<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -14371,13 +13817,14 @@ bool X86Architecture::Table_2_f1(BinaryStream const& rBinStrm, OffsetType Offset
  * cpu_model: >= X86_Arch_Sse2
  *
 **/
-bool X86Architecture::Table_2_f2(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_2_f2(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_Sse2 && (rInsn.GetPrefix() & X86_Prefix_OpSize) == X86_Prefix_OpSize)
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Splld);
-      if (Operand__Vx_Wx(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vx_Wx<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -14387,7 +13834,7 @@ bool X86Architecture::Table_2_f2(BinaryStream const& rBinStrm, OffsetType Offset
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Pslld);
-      if (Operand__Pq_Qq(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Pq_Qq<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -14409,13 +13856,14 @@ bool X86Architecture::Table_2_f2(BinaryStream const& rBinStrm, OffsetType Offset
  * cpu_model: >= X86_Arch_Sse2
  *
 **/
-bool X86Architecture::Table_2_f3(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_2_f3(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_Sse2 && (rInsn.GetPrefix() & X86_Prefix_OpSize) == X86_Prefix_OpSize)
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Spllq);
-      if (Operand__Vx_Wx(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vx_Wx<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -14425,7 +13873,7 @@ bool X86Architecture::Table_2_f3(BinaryStream const& rBinStrm, OffsetType Offset
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Psllq);
-      if (Operand__Pq_Qq(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Pq_Qq<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -14447,13 +13895,14 @@ bool X86Architecture::Table_2_f3(BinaryStream const& rBinStrm, OffsetType Offset
  * cpu_model: >= X86_Arch_Sse2
  *
 **/
-bool X86Architecture::Table_2_f4(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_2_f4(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_Sse2 && (rInsn.GetPrefix() & X86_Prefix_OpSize) == X86_Prefix_OpSize)
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Pmuludq);
-      if (Operand__Vx_Wx(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vx_Wx<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -14463,7 +13912,7 @@ bool X86Architecture::Table_2_f4(BinaryStream const& rBinStrm, OffsetType Offset
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Pmuludq);
-      if (Operand__Pq_Qq(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Pq_Qq<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -14485,13 +13934,14 @@ bool X86Architecture::Table_2_f4(BinaryStream const& rBinStrm, OffsetType Offset
  * cpu_model: >= X86_Arch_Sse2
  *
 **/
-bool X86Architecture::Table_2_f5(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_2_f5(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_Sse2 && (rInsn.GetPrefix() & X86_Prefix_OpSize) == X86_Prefix_OpSize)
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Pmaddwd);
-      if (Operand__Vx_Wx(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vx_Wx<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -14501,7 +13951,7 @@ bool X86Architecture::Table_2_f5(BinaryStream const& rBinStrm, OffsetType Offset
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Pmaddwd);
-      if (Operand__Pq_Qq(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Pq_Qq<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -14523,13 +13973,14 @@ bool X86Architecture::Table_2_f5(BinaryStream const& rBinStrm, OffsetType Offset
  * cpu_model: >= X86_Arch_Sse2
  *
 **/
-bool X86Architecture::Table_2_f6(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_2_f6(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_Sse2 && (rInsn.GetPrefix() & X86_Prefix_OpSize) == X86_Prefix_OpSize)
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Psadbw);
-      if (Operand__Vx_Wx(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vx_Wx<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -14539,7 +13990,7 @@ bool X86Architecture::Table_2_f6(BinaryStream const& rBinStrm, OffsetType Offset
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Psadbw);
-      if (Operand__Pq_Qq(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Pq_Qq<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -14561,13 +14012,14 @@ bool X86Architecture::Table_2_f6(BinaryStream const& rBinStrm, OffsetType Offset
  * cpu_model: >= X86_Arch_Sse2
  *
 **/
-bool X86Architecture::Table_2_f7(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_2_f7(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_Sse2 && (rInsn.GetPrefix() & X86_Prefix_OpSize) == X86_Prefix_OpSize)
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Maskmovdqu);
-      if (Operand__Vo_Uo(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vo_Uo<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -14577,7 +14029,7 @@ bool X86Architecture::Table_2_f7(BinaryStream const& rBinStrm, OffsetType Offset
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Maskmovq);
-      if (Operand__Pq_Nq(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Pq_Nq<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -14599,13 +14051,14 @@ bool X86Architecture::Table_2_f7(BinaryStream const& rBinStrm, OffsetType Offset
  * cpu_model: >= X86_Arch_Sse2
  *
 **/
-bool X86Architecture::Table_2_f8(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_2_f8(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_Sse2 && (rInsn.GetPrefix() & X86_Prefix_OpSize) == X86_Prefix_OpSize)
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Psubb);
-      if (Operand__Vx_Wx(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vx_Wx<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -14615,7 +14068,7 @@ bool X86Architecture::Table_2_f8(BinaryStream const& rBinStrm, OffsetType Offset
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Psubb);
-      if (Operand__Pq_Qq(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Pq_Qq<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -14637,13 +14090,14 @@ bool X86Architecture::Table_2_f8(BinaryStream const& rBinStrm, OffsetType Offset
  * cpu_model: >= X86_Arch_Sse2
  *
 **/
-bool X86Architecture::Table_2_f9(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_2_f9(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_Sse2 && (rInsn.GetPrefix() & X86_Prefix_OpSize) == X86_Prefix_OpSize)
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Psubw);
-      if (Operand__Vx_Wx(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vx_Wx<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -14653,7 +14107,7 @@ bool X86Architecture::Table_2_f9(BinaryStream const& rBinStrm, OffsetType Offset
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Psubw);
-      if (Operand__Pq_Qq(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Pq_Qq<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -14675,13 +14129,14 @@ bool X86Architecture::Table_2_f9(BinaryStream const& rBinStrm, OffsetType Offset
  * cpu_model: >= X86_Arch_Sse2
  *
 **/
-bool X86Architecture::Table_2_fa(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_2_fa(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_Sse2 && (rInsn.GetPrefix() & X86_Prefix_OpSize) == X86_Prefix_OpSize)
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Psubd);
-      if (Operand__Vx_Wx(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vx_Wx<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -14691,7 +14146,7 @@ bool X86Architecture::Table_2_fa(BinaryStream const& rBinStrm, OffsetType Offset
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Psubd);
-      if (Operand__Pq_Qq(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Pq_Qq<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -14713,13 +14168,14 @@ bool X86Architecture::Table_2_fa(BinaryStream const& rBinStrm, OffsetType Offset
  * cpu_model: >= X86_Arch_Sse2
  *
 **/
-bool X86Architecture::Table_2_fb(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_2_fb(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_Sse2 && (rInsn.GetPrefix() & X86_Prefix_OpSize) == X86_Prefix_OpSize)
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Psubq);
-      if (Operand__Vx_Wx(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vx_Wx<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -14729,7 +14185,7 @@ bool X86Architecture::Table_2_fb(BinaryStream const& rBinStrm, OffsetType Offset
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Psubq);
-      if (Operand__Pq_Qq(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Pq_Qq<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -14751,13 +14207,14 @@ bool X86Architecture::Table_2_fb(BinaryStream const& rBinStrm, OffsetType Offset
  * cpu_model: >= X86_Arch_Sse2
  *
 **/
-bool X86Architecture::Table_2_fc(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_2_fc(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_Sse2 && (rInsn.GetPrefix() & X86_Prefix_OpSize) == X86_Prefix_OpSize)
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Paddb);
-      if (Operand__Vx_Wx(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vx_Wx<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -14767,7 +14224,7 @@ bool X86Architecture::Table_2_fc(BinaryStream const& rBinStrm, OffsetType Offset
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Paddb);
-      if (Operand__Pq_Qq(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Pq_Qq<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -14789,13 +14246,14 @@ bool X86Architecture::Table_2_fc(BinaryStream const& rBinStrm, OffsetType Offset
  * cpu_model: >= X86_Arch_Sse2
  *
 **/
-bool X86Architecture::Table_2_fd(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_2_fd(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_Sse2 && (rInsn.GetPrefix() & X86_Prefix_OpSize) == X86_Prefix_OpSize)
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Paddw);
-      if (Operand__Vx_Wx(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vx_Wx<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -14805,7 +14263,7 @@ bool X86Architecture::Table_2_fd(BinaryStream const& rBinStrm, OffsetType Offset
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Paddw);
-      if (Operand__Pq_Qq(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Pq_Qq<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -14827,13 +14285,14 @@ bool X86Architecture::Table_2_fd(BinaryStream const& rBinStrm, OffsetType Offset
  * cpu_model: >= X86_Arch_Sse2
  *
 **/
-bool X86Architecture::Table_2_fe(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_2_fe(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_Sse2 && (rInsn.GetPrefix() & X86_Prefix_OpSize) == X86_Prefix_OpSize)
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Paddd);
-      if (Operand__Vx_Wx(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vx_Wx<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -14843,7 +14302,7 @@ bool X86Architecture::Table_2_fe(BinaryStream const& rBinStrm, OffsetType Offset
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Paddd);
-      if (Operand__Pq_Qq(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Pq_Qq<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -14859,7 +14318,8 @@ bool X86Architecture::Table_2_fe(BinaryStream const& rBinStrm, OffsetType Offset
  * attr: ['amd']
  *
 **/
-bool X86Architecture::Table_2_ff(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_2_ff(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Vendor") == X86_ProcType_AMD)
     {
@@ -14870,3 +14330,230 @@ bool X86Architecture::Table_2_ff(BinaryStream const& rBinStrm, OffsetType Offset
     return false;
 }
 
+X86_INSTANTIATE_DISASSEMBLER(Table_2_00);
+X86_INSTANTIATE_DISASSEMBLER(Table_2_01);
+X86_INSTANTIATE_DISASSEMBLER(Table_2_04);
+X86_INSTANTIATE_DISASSEMBLER(Table_2_05);
+X86_INSTANTIATE_DISASSEMBLER(Table_2_07);
+X86_INSTANTIATE_DISASSEMBLER(Table_2_08);
+X86_INSTANTIATE_DISASSEMBLER(Table_2_09);
+X86_INSTANTIATE_DISASSEMBLER(Table_2_0b);
+X86_INSTANTIATE_DISASSEMBLER(Table_2_0d);
+X86_INSTANTIATE_DISASSEMBLER(Table_2_0e);
+X86_INSTANTIATE_DISASSEMBLER(Table_2_0f);
+X86_INSTANTIATE_DISASSEMBLER(Table_2_10);
+X86_INSTANTIATE_DISASSEMBLER(Table_2_11);
+X86_INSTANTIATE_DISASSEMBLER(Table_2_12);
+X86_INSTANTIATE_DISASSEMBLER(Table_2_13);
+X86_INSTANTIATE_DISASSEMBLER(Table_2_14);
+X86_INSTANTIATE_DISASSEMBLER(Table_2_15);
+X86_INSTANTIATE_DISASSEMBLER(Table_2_16);
+X86_INSTANTIATE_DISASSEMBLER(Table_2_17);
+X86_INSTANTIATE_DISASSEMBLER(Table_2_18);
+X86_INSTANTIATE_DISASSEMBLER(Table_2_19);
+X86_INSTANTIATE_DISASSEMBLER(Table_2_1a);
+X86_INSTANTIATE_DISASSEMBLER(Table_2_1b);
+X86_INSTANTIATE_DISASSEMBLER(Table_2_1c);
+X86_INSTANTIATE_DISASSEMBLER(Table_2_1d);
+X86_INSTANTIATE_DISASSEMBLER(Table_2_1e);
+X86_INSTANTIATE_DISASSEMBLER(Table_2_1f);
+X86_INSTANTIATE_DISASSEMBLER(Table_2_20);
+X86_INSTANTIATE_DISASSEMBLER(Table_2_21);
+X86_INSTANTIATE_DISASSEMBLER(Table_2_22);
+X86_INSTANTIATE_DISASSEMBLER(Table_2_23);
+X86_INSTANTIATE_DISASSEMBLER(Table_2_24);
+X86_INSTANTIATE_DISASSEMBLER(Table_2_25);
+X86_INSTANTIATE_DISASSEMBLER(Table_2_26);
+X86_INSTANTIATE_DISASSEMBLER(Table_2_28);
+X86_INSTANTIATE_DISASSEMBLER(Table_2_29);
+X86_INSTANTIATE_DISASSEMBLER(Table_2_2a);
+X86_INSTANTIATE_DISASSEMBLER(Table_2_2b);
+X86_INSTANTIATE_DISASSEMBLER(Table_2_2c);
+X86_INSTANTIATE_DISASSEMBLER(Table_2_2d);
+X86_INSTANTIATE_DISASSEMBLER(Table_2_2e);
+X86_INSTANTIATE_DISASSEMBLER(Table_2_2f);
+X86_INSTANTIATE_DISASSEMBLER(Table_2_34);
+X86_INSTANTIATE_DISASSEMBLER(Table_2_35);
+X86_INSTANTIATE_DISASSEMBLER(Table_2_36);
+X86_INSTANTIATE_DISASSEMBLER(Table_2_37);
+X86_INSTANTIATE_DISASSEMBLER(Table_2_38);
+X86_INSTANTIATE_DISASSEMBLER(Table_2_39);
+X86_INSTANTIATE_DISASSEMBLER(Table_2_3a);
+X86_INSTANTIATE_DISASSEMBLER(Table_2_3b);
+X86_INSTANTIATE_DISASSEMBLER(Table_2_3c);
+X86_INSTANTIATE_DISASSEMBLER(Table_2_3d);
+X86_INSTANTIATE_DISASSEMBLER(Table_2_3f);
+X86_INSTANTIATE_DISASSEMBLER(Table_2_50);
+X86_INSTANTIATE_DISASSEMBLER(Table_2_51);
+X86_INSTANTIATE_DISASSEMBLER(Table_2_52);
+X86_INSTANTIATE_DISASSEMBLER(Table_2_53);
+X86_INSTANTIATE_DISASSEMBLER(Table_2_54);
+X86_INSTANTIATE_DISASSEMBLER(Table_2_55);
+X86_INSTANTIATE_DISASSEMBLER(Table_2_56);
+X86_INSTANTIATE_DISASSEMBLER(Table_2_57);
+X86_INSTANTIATE_DISASSEMBLER(Table_2_58);
+X86_INSTANTIATE_DISASSEMBLER(Table_2_59);
+X86_INSTANTIATE_DISASSEMBLER(Table_2_5a);
+X86_INSTANTIATE_DISASSEMBLER(Table_2_5b);
+X86_INSTANTIATE_DISASSEMBLER(Table_2_5c);
+X86_INSTANTIATE_DISASSEMBLER(Table_2_5d);
+X86_INSTANTIATE_DISASSEMBLER(Table_2_5e);
+X86_INSTANTIATE_DISASSEMBLER(Table_2_5f);
+X86_INSTANTIATE_DISASSEMBLER(Table_2_60);
+X86_INSTANTIATE_DISASSEMBLER(Table_2_61);
+X86_INSTANTIATE_DISASSEMBLER(Table_2_62);
+X86_INSTANTIATE_DISASSEMBLER(Table_2_63);
+X86_INSTANTIATE_DISASSEMBLER(Table_2_64);
+X86_INSTANTIATE_DISASSEMBLER(Table_2_65);
+X86_INSTANTIATE_DISASSEMBLER(Table_2_66);
+X86_INSTANTIATE_DISASSEMBLER(Table_2_67);
+X86_INSTANTIATE_DISASSEMBLER(Table_2_68);
+X86_INSTANTIATE_DISASSEMBLER(Table_2_69);
+X86_INSTANTIATE_DISASSEMBLER(Table_2_6a);
+X86_INSTANTIATE_DISASSEMBLER(Table_2_6b);
+X86_INSTANTIATE_DISASSEMBLER(Table_2_6c);
+X86_INSTANTIATE_DISASSEMBLER(Table_2_6d);
+X86_INSTANTIATE_DISASSEMBLER(Table_2_6e);
+X86_INSTANTIATE_DISASSEMBLER(Table_2_6f);
+X86_INSTANTIATE_DISASSEMBLER(Table_2_70);
+X86_INSTANTIATE_DISASSEMBLER(Table_2_71);
+X86_INSTANTIATE_DISASSEMBLER(Table_2_72);
+X86_INSTANTIATE_DISASSEMBLER(Table_2_73);
+X86_INSTANTIATE_DISASSEMBLER(Table_2_74);
+X86_INSTANTIATE_DISASSEMBLER(Table_2_75);
+X86_INSTANTIATE_DISASSEMBLER(Table_2_76);
+X86_INSTANTIATE_DISASSEMBLER(Table_2_77);
+X86_INSTANTIATE_DISASSEMBLER(Table_2_78);
+X86_INSTANTIATE_DISASSEMBLER(Table_2_79);
+X86_INSTANTIATE_DISASSEMBLER(Table_2_7a);
+X86_INSTANTIATE_DISASSEMBLER(Table_2_7b);
+X86_INSTANTIATE_DISASSEMBLER(Table_2_7c);
+X86_INSTANTIATE_DISASSEMBLER(Table_2_7d);
+X86_INSTANTIATE_DISASSEMBLER(Table_2_7e);
+X86_INSTANTIATE_DISASSEMBLER(Table_2_7f);
+X86_INSTANTIATE_DISASSEMBLER(Table_2_80);
+X86_INSTANTIATE_DISASSEMBLER(Table_2_81);
+X86_INSTANTIATE_DISASSEMBLER(Table_2_82);
+X86_INSTANTIATE_DISASSEMBLER(Table_2_83);
+X86_INSTANTIATE_DISASSEMBLER(Table_2_84);
+X86_INSTANTIATE_DISASSEMBLER(Table_2_85);
+X86_INSTANTIATE_DISASSEMBLER(Table_2_86);
+X86_INSTANTIATE_DISASSEMBLER(Table_2_87);
+X86_INSTANTIATE_DISASSEMBLER(Table_2_88);
+X86_INSTANTIATE_DISASSEMBLER(Table_2_89);
+X86_INSTANTIATE_DISASSEMBLER(Table_2_8a);
+X86_INSTANTIATE_DISASSEMBLER(Table_2_8b);
+X86_INSTANTIATE_DISASSEMBLER(Table_2_8c);
+X86_INSTANTIATE_DISASSEMBLER(Table_2_8d);
+X86_INSTANTIATE_DISASSEMBLER(Table_2_8e);
+X86_INSTANTIATE_DISASSEMBLER(Table_2_8f);
+X86_INSTANTIATE_DISASSEMBLER(Table_2_90);
+X86_INSTANTIATE_DISASSEMBLER(Table_2_91);
+X86_INSTANTIATE_DISASSEMBLER(Table_2_92);
+X86_INSTANTIATE_DISASSEMBLER(Table_2_93);
+X86_INSTANTIATE_DISASSEMBLER(Table_2_94);
+X86_INSTANTIATE_DISASSEMBLER(Table_2_95);
+X86_INSTANTIATE_DISASSEMBLER(Table_2_96);
+X86_INSTANTIATE_DISASSEMBLER(Table_2_97);
+X86_INSTANTIATE_DISASSEMBLER(Table_2_98);
+X86_INSTANTIATE_DISASSEMBLER(Table_2_99);
+X86_INSTANTIATE_DISASSEMBLER(Table_2_9a);
+X86_INSTANTIATE_DISASSEMBLER(Table_2_9b);
+X86_INSTANTIATE_DISASSEMBLER(Table_2_9c);
+X86_INSTANTIATE_DISASSEMBLER(Table_2_9d);
+X86_INSTANTIATE_DISASSEMBLER(Table_2_9e);
+X86_INSTANTIATE_DISASSEMBLER(Table_2_9f);
+X86_INSTANTIATE_DISASSEMBLER(Table_2_a0);
+X86_INSTANTIATE_DISASSEMBLER(Table_2_a1);
+X86_INSTANTIATE_DISASSEMBLER(Table_2_a3);
+X86_INSTANTIATE_DISASSEMBLER(Table_2_a4);
+X86_INSTANTIATE_DISASSEMBLER(Table_2_a5);
+X86_INSTANTIATE_DISASSEMBLER(Table_2_a6);
+X86_INSTANTIATE_DISASSEMBLER(Table_2_a7);
+X86_INSTANTIATE_DISASSEMBLER(Table_2_a8);
+X86_INSTANTIATE_DISASSEMBLER(Table_2_a9);
+X86_INSTANTIATE_DISASSEMBLER(Table_2_aa);
+X86_INSTANTIATE_DISASSEMBLER(Table_2_ab);
+X86_INSTANTIATE_DISASSEMBLER(Table_2_ac);
+X86_INSTANTIATE_DISASSEMBLER(Table_2_ad);
+X86_INSTANTIATE_DISASSEMBLER(Table_2_ae);
+X86_INSTANTIATE_DISASSEMBLER(Table_2_af);
+X86_INSTANTIATE_DISASSEMBLER(Table_2_b0);
+X86_INSTANTIATE_DISASSEMBLER(Table_2_b1);
+X86_INSTANTIATE_DISASSEMBLER(Table_2_b2);
+X86_INSTANTIATE_DISASSEMBLER(Table_2_b3);
+X86_INSTANTIATE_DISASSEMBLER(Table_2_b4);
+X86_INSTANTIATE_DISASSEMBLER(Table_2_b5);
+X86_INSTANTIATE_DISASSEMBLER(Table_2_b6);
+X86_INSTANTIATE_DISASSEMBLER(Table_2_b7);
+X86_INSTANTIATE_DISASSEMBLER(Table_2_b8);
+X86_INSTANTIATE_DISASSEMBLER(Table_2_b9);
+X86_INSTANTIATE_DISASSEMBLER(Table_2_ba);
+X86_INSTANTIATE_DISASSEMBLER(Table_2_bb);
+X86_INSTANTIATE_DISASSEMBLER(Table_2_bc);
+X86_INSTANTIATE_DISASSEMBLER(Table_2_bd);
+X86_INSTANTIATE_DISASSEMBLER(Table_2_be);
+X86_INSTANTIATE_DISASSEMBLER(Table_2_bf);
+X86_INSTANTIATE_DISASSEMBLER(Table_2_c0);
+X86_INSTANTIATE_DISASSEMBLER(Table_2_c1);
+X86_INSTANTIATE_DISASSEMBLER(Table_2_c3);
+X86_INSTANTIATE_DISASSEMBLER(Table_2_c4);
+X86_INSTANTIATE_DISASSEMBLER(Table_2_c5);
+X86_INSTANTIATE_DISASSEMBLER(Table_2_c6);
+X86_INSTANTIATE_DISASSEMBLER(Table_2_c7);
+X86_INSTANTIATE_DISASSEMBLER(Table_2_c8);
+X86_INSTANTIATE_DISASSEMBLER(Table_2_c9);
+X86_INSTANTIATE_DISASSEMBLER(Table_2_ca);
+X86_INSTANTIATE_DISASSEMBLER(Table_2_cb);
+X86_INSTANTIATE_DISASSEMBLER(Table_2_cc);
+X86_INSTANTIATE_DISASSEMBLER(Table_2_cd);
+X86_INSTANTIATE_DISASSEMBLER(Table_2_ce);
+X86_INSTANTIATE_DISASSEMBLER(Table_2_cf);
+X86_INSTANTIATE_DISASSEMBLER(Table_2_d0);
+X86_INSTANTIATE_DISASSEMBLER(Table_2_d1);
+X86_INSTANTIATE_DISASSEMBLER(Table_2_d2);
+X86_INSTANTIATE_DISASSEMBLER(Table_2_d3);
+X86_INSTANTIATE_DISASSEMBLER(Table_2_d4);
+X86_INSTANTIATE_DISASSEMBLER(Table_2_d5);
+X86_INSTANTIATE_DISASSEMBLER(Table_2_d6);
+X86_INSTANTIATE_DISASSEMBLER(Table_2_d7);
+X86_INSTANTIATE_DISASSEMBLER(Table_2_d8);
+X86_INSTANTIATE_DISASSEMBLER(Table_2_d9);
+X86_INSTANTIATE_DISASSEMBLER(Table_2_da);
+X86_INSTANTIATE_DISASSEMBLER(Table_2_db);
+X86_INSTANTIATE_DISASSEMBLER(Table_2_dc);
+X86_INSTANTIATE_DISASSEMBLER(Table_2_dd);
+X86_INSTANTIATE_DISASSEMBLER(Table_2_de);
+X86_INSTANTIATE_DISASSEMBLER(Table_2_df);
+X86_INSTANTIATE_DISASSEMBLER(Table_2_e0);
+X86_INSTANTIATE_DISASSEMBLER(Table_2_e1);
+X86_INSTANTIATE_DISASSEMBLER(Table_2_e2);
+X86_INSTANTIATE_DISASSEMBLER(Table_2_e3);
+X86_INSTANTIATE_DISASSEMBLER(Table_2_e4);
+X86_INSTANTIATE_DISASSEMBLER(Table_2_e5);
+X86_INSTANTIATE_DISASSEMBLER(Table_2_e6);
+X86_INSTANTIATE_DISASSEMBLER(Table_2_e7);
+X86_INSTANTIATE_DISASSEMBLER(Table_2_e8);
+X86_INSTANTIATE_DISASSEMBLER(Table_2_e9);
+X86_INSTANTIATE_DISASSEMBLER(Table_2_ea);
+X86_INSTANTIATE_DISASSEMBLER(Table_2_eb);
+X86_INSTANTIATE_DISASSEMBLER(Table_2_ec);
+X86_INSTANTIATE_DISASSEMBLER(Table_2_ed);
+X86_INSTANTIATE_DISASSEMBLER(Table_2_ee);
+X86_INSTANTIATE_DISASSEMBLER(Table_2_ef);
+X86_INSTANTIATE_DISASSEMBLER(Table_2_f0);
+X86_INSTANTIATE_DISASSEMBLER(Table_2_f1);
+X86_INSTANTIATE_DISASSEMBLER(Table_2_f2);
+X86_INSTANTIATE_DISASSEMBLER(Table_2_f3);
+X86_INSTANTIATE_DISASSEMBLER(Table_2_f4);
+X86_INSTANTIATE_DISASSEMBLER(Table_2_f5);
+X86_INSTANTIATE_DISASSEMBLER(Table_2_f6);
+X86_INSTANTIATE_DISASSEMBLER(Table_2_f7);
+X86_INSTANTIATE_DISASSEMBLER(Table_2_f8);
+X86_INSTANTIATE_DISASSEMBLER(Table_2_f9);
+X86_INSTANTIATE_DISASSEMBLER(Table_2_fa);
+X86_INSTANTIATE_DISASSEMBLER(Table_2_fb);
+X86_INSTANTIATE_DISASSEMBLER(Table_2_fc);
+X86_INSTANTIATE_DISASSEMBLER(Table_2_fd);
+X86_INSTANTIATE_DISASSEMBLER(Table_2_fe);
+X86_INSTANTIATE_DISASSEMBLER(Table_2_ff);
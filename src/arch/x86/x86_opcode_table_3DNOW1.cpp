@@ -1,386 +1,279 @@
-/* This file has been automatically generated, you must _NOT_ edit it directly. (Sun Feb 05 12:38:19 2017) */
+/* This file has been automatically generated, you must _NOT_ edit it directly. (Sun Oct 18 18:46:50 2026) */
 #include "x86_architecture.hpp"
-const X86Architecture::TDisassembler X86Architecture::m_Table_3dnow1[0x100] =
-{
-  &X86Architecture::Table_3dnow1_00,
-  &X86Architecture::Table_3dnow1_01,
-  &X86Architecture::Table_3dnow1_02,
-  &X86Architecture::Table_3dnow1_03,
-  &X86Architecture::Table_3dnow1_04,
-  &X86Architecture::Table_3dnow1_05,
-  &X86Architecture::Table_3dnow1_06,
-  &X86Architecture::Table_3dnow1_07,
-  &X86Architecture::Table_3dnow1_08,
-  &X86Architecture::Table_3dnow1_09,
-  &X86Architecture::Table_3dnow1_0a,
-  &X86Architecture::Table_3dnow1_0b,
-  &X86Architecture::Table_3dnow1_0c,
-  &X86Architecture::Table_3dnow1_0d,
-  &X86Architecture::Table_3dnow1_0e,
-  &X86Architecture::Table_3dnow1_0f,
-  &X86Architecture::Table_3dnow1_10,
-  &X86Architecture::Table_3dnow1_11,
-  &X86Architecture::Table_3dnow1_12,
-  &X86Architecture::Table_3dnow1_13,
-  &X86Architecture::Table_3dnow1_14,
-  &X86Architecture::Table_3dnow1_15,
-  &X86Architecture::Table_3dnow1_16,
-  &X86Architecture::Table_3dnow1_17,
-  &X86Architecture::Table_3dnow1_18,
-  &X86Architecture::Table_3dnow1_19,
-  &X86Architecture::Table_3dnow1_1a,
-  &X86Architecture::Table_3dnow1_1b,
-  &X86Architecture::Table_3dnow1_1c,
-  &X86Architecture::Table_3dnow1_1d,
-  &X86Architecture::Table_3dnow1_1e,
-  &X86Architecture::Table_3dnow1_1f,
-  &X86Architecture::Table_3dnow1_20,
-  &X86Architecture::Table_3dnow1_21,
-  &X86Architecture::Table_3dnow1_22,
-  &X86Architecture::Table_3dnow1_23,
-  &X86Architecture::Table_3dnow1_24,
-  &X86Architecture::Table_3dnow1_25,
-  &X86Architecture::Table_3dnow1_26,
-  &X86Architecture::Table_3dnow1_27,
-  &X86Architecture::Table_3dnow1_28,
-  &X86Architecture::Table_3dnow1_29,
-  &X86Architecture::Table_3dnow1_2a,
-  &X86Architecture::Table_3dnow1_2b,
-  &X86Architecture::Table_3dnow1_2c,
-  &X86Architecture::Table_3dnow1_2d,
-  &X86Architecture::Table_3dnow1_2e,
-  &X86Architecture::Table_3dnow1_2f,
-  &X86Architecture::Table_3dnow1_30,
-  &X86Architecture::Table_3dnow1_31,
-  &X86Architecture::Table_3dnow1_32,
-  &X86Architecture::Table_3dnow1_33,
-  &X86Architecture::Table_3dnow1_34,
-  &X86Architecture::Table_3dnow1_35,
-  &X86Architecture::Table_3dnow1_36,
-  &X86Architecture::Table_3dnow1_37,
-  &X86Architecture::Table_3dnow1_38,
-  &X86Architecture::Table_3dnow1_39,
-  &X86Architecture::Table_3dnow1_3a,
-  &X86Architecture::Table_3dnow1_3b,
-  &X86Architecture::Table_3dnow1_3c,
-  &X86Architecture::Table_3dnow1_3d,
-  &X86Architecture::Table_3dnow1_3e,
-  &X86Architecture::Table_3dnow1_3f,
-  &X86Architecture::Table_3dnow1_40,
-  &X86Architecture::Table_3dnow1_41,
-  &X86Architecture::Table_3dnow1_42,
-  &X86Architecture::Table_3dnow1_43,
-  &X86Architecture::Table_3dnow1_44,
-  &X86Architecture::Table_3dnow1_45,
-  &X86Architecture::Table_3dnow1_46,
-  &X86Architecture::Table_3dnow1_47,
-  &X86Architecture::Table_3dnow1_48,
-  &X86Architecture::Table_3dnow1_49,
-  &X86Architecture::Table_3dnow1_4a,
-  &X86Architecture::Table_3dnow1_4b,
-  &X86Architecture::Table_3dnow1_4c,
-  &X86Architecture::Table_3dnow1_4d,
-  &X86Architecture::Table_3dnow1_4e,
-  &X86Architecture::Table_3dnow1_4f,
-  &X86Architecture::Table_3dnow1_50,
-  &X86Architecture::Table_3dnow1_51,
-  &X86Architecture::Table_3dnow1_52,
-  &X86Architecture::Table_3dnow1_53,
-  &X86Architecture::Table_3dnow1_54,
-  &X86Architecture::Table_3dnow1_55,
-  &X86Architecture::Table_3dnow1_56,
-  &X86Architecture::Table_3dnow1_57,
-  &X86Architecture::Table_3dnow1_58,
-  &X86Architecture::Table_3dnow1_59,
-  &X86Architecture::Table_3dnow1_5a,
-  &X86Architecture::Table_3dnow1_5b,
-  &X86Architecture::Table_3dnow1_5c,
-  &X86Architecture::Table_3dnow1_5d,
-  &X86Architecture::Table_3dnow1_5e,
-  &X86Architecture::Table_3dnow1_5f,
-  &X86Architecture::Table_3dnow1_60,
-  &X86Architecture::Table_3dnow1_61,
-  &X86Architecture::Table_3dnow1_62,
-  &X86Architecture::Table_3dnow1_63,
-  &X86Architecture::Table_3dnow1_64,
-  &X86Architecture::Table_3dnow1_65,
-  &X86Architecture::Table_3dnow1_66,
-  &X86Architecture::Table_3dnow1_67,
-  &X86Architecture::Table_3dnow1_68,
-  &X86Architecture::Table_3dnow1_69,
-  &X86Architecture::Table_3dnow1_6a,
-  &X86Architecture::Table_3dnow1_6b,
-  &X86Architecture::Table_3dnow1_6c,
-  &X86Architecture::Table_3dnow1_6d,
-  &X86Architecture::Table_3dnow1_6e,
-  &X86Architecture::Table_3dnow1_6f,
-  &X86Architecture::Table_3dnow1_70,
-  &X86Architecture::Table_3dnow1_71,
-  &X86Architecture::Table_3dnow1_72,
-  &X86Architecture::Table_3dnow1_73,
-  &X86Architecture::Table_3dnow1_74,
-  &X86Architecture::Table_3dnow1_75,
-  &X86Architecture::Table_3dnow1_76,
-  &X86Architecture::Table_3dnow1_77,
-  &X86Architecture::Table_3dnow1_78,
-  &X86Architecture::Table_3dnow1_79,
-  &X86Architecture::Table_3dnow1_7a,
-  &X86Architecture::Table_3dnow1_7b,
-  &X86Architecture::Table_3dnow1_7c,
-  &X86Architecture::Table_3dnow1_7d,
-  &X86Architecture::Table_3dnow1_7e,
-  &X86Architecture::Table_3dnow1_7f,
-  &X86Architecture::Table_3dnow1_80,
-  &X86Architecture::Table_3dnow1_81,
-  &X86Architecture::Table_3dnow1_82,
-  &X86Architecture::Table_3dnow1_83,
-  &X86Architecture::Table_3dnow1_84,
-  &X86Architecture::Table_3dnow1_85,
-  &X86Architecture::Table_3dnow1_86,
-  &X86Architecture::Table_3dnow1_87,
-  &X86Architecture::Table_3dnow1_88,
-  &X86Architecture::Table_3dnow1_89,
-  &X86Architecture::Table_3dnow1_8a,
-  &X86Architecture::Table_3dnow1_8b,
-  &X86Architecture::Table_3dnow1_8c,
-  &X86Architecture::Table_3dnow1_8d,
-  &X86Architecture::Table_3dnow1_8e,
-  &X86Architecture::Table_3dnow1_8f,
-  &X86Architecture::Table_3dnow1_90,
-  &X86Architecture::Table_3dnow1_91,
-  &X86Architecture::Table_3dnow1_92,
-  &X86Architecture::Table_3dnow1_93,
-  &X86Architecture::Table_3dnow1_94,
-  &X86Architecture::Table_3dnow1_95,
-  &X86Architecture::Table_3dnow1_96,
-  &X86Architecture::Table_3dnow1_97,
-  &X86Architecture::Table_3dnow1_98,
-  &X86Architecture::Table_3dnow1_99,
-  &X86Architecture::Table_3dnow1_9a,
-  &X86Architecture::Table_3dnow1_9b,
-  &X86Architecture::Table_3dnow1_9c,
-  &X86Architecture::Table_3dnow1_9d,
-  &X86Architecture::Table_3dnow1_9e,
-  &X86Architecture::Table_3dnow1_9f,
-  &X86Architecture::Table_3dnow1_a0,
-  &X86Architecture::Table_3dnow1_a1,
-  &X86Architecture::Table_3dnow1_a2,
-  &X86Architecture::Table_3dnow1_a3,
-  &X86Architecture::Table_3dnow1_a4,
-  &X86Architecture::Table_3dnow1_a5,
-  &X86Architecture::Table_3dnow1_a6,
-  &X86Architecture::Table_3dnow1_a7,
-  &X86Architecture::Table_3dnow1_a8,
-  &X86Architecture::Table_3dnow1_a9,
-  &X86Architecture::Table_3dnow1_aa,
-  &X86Architecture::Table_3dnow1_ab,
-  &X86Architecture::Table_3dnow1_ac,
-  &X86Architecture::Table_3dnow1_ad,
-  &X86Architecture::Table_3dnow1_ae,
-  &X86Architecture::Table_3dnow1_af,
-  &X86Architecture::Table_3dnow1_b0,
-  &X86Architecture::Table_3dnow1_b1,
-  &X86Architecture::Table_3dnow1_b2,
-  &X86Architecture::Table_3dnow1_b3,
-  &X86Architecture::Table_3dnow1_b4,
-  &X86Architecture::Table_3dnow1_b5,
-  &X86Architecture::Table_3dnow1_b6,
-  &X86Architecture::Table_3dnow1_b7,
-  &X86Architecture::Table_3dnow1_b8,
-  &X86Architecture::Table_3dnow1_b9,
-  &X86Architecture::Table_3dnow1_ba,
-  &X86Architecture::Table_3dnow1_bb,
-  &X86Architecture::Table_3dnow1_bc,
-  &X86Architecture::Table_3dnow1_bd,
-  &X86Architecture::Table_3dnow1_be,
-  &X86Architecture::Table_3dnow1_bf,
-  &X86Architecture::Table_3dnow1_c0,
-  &X86Architecture::Table_3dnow1_c1,
-  &X86Architecture::Table_3dnow1_c2,
-  &X86Architecture::Table_3dnow1_c3,
-  &X86Architecture::Table_3dnow1_c4,
-  &X86Architecture::Table_3dnow1_c5,
-  &X86Architecture::Table_3dnow1_c6,
-  &X86Architecture::Table_3dnow1_c7,
-  &X86Architecture::Table_3dnow1_c8,
-  &X86Architecture::Table_3dnow1_c9,
-  &X86Architecture::Table_3dnow1_ca,
-  &X86Architecture::Table_3dnow1_cb,
-  &X86Architecture::Table_3dnow1_cc,
-  &X86Architecture::Table_3dnow1_cd,
-  &X86Architecture::Table_3dnow1_ce,
-  &X86Architecture::Table_3dnow1_cf,
-  &X86Architecture::Table_3dnow1_d0,
-  &X86Architecture::Table_3dnow1_d1,
-  &X86Architecture::Table_3dnow1_d2,
-  &X86Architecture::Table_3dnow1_d3,
-  &X86Architecture::Table_3dnow1_d4,
-  &X86Architecture::Table_3dnow1_d5,
-  &X86Architecture::Table_3dnow1_d6,
-  &X86Architecture::Table_3dnow1_d7,
-  &X86Architecture::Table_3dnow1_d8,
-  &X86Architecture::Table_3dnow1_d9,
-  &X86Architecture::Table_3dnow1_da,
-  &X86Architecture::Table_3dnow1_db,
-  &X86Architecture::Table_3dnow1_dc,
-  &X86Architecture::Table_3dnow1_dd,
-  &X86Architecture::Table_3dnow1_de,
-  &X86Architecture::Table_3dnow1_df,
-  &X86Architecture::Table_3dnow1_e0,
-  &X86Architecture::Table_3dnow1_e1,
-  &X86Architecture::Table_3dnow1_e2,
-  &X86Architecture::Table_3dnow1_e3,
-  &X86Architecture::Table_3dnow1_e4,
-  &X86Architecture::Table_3dnow1_e5,
-  &X86Architecture::Table_3dnow1_e6,
-  &X86Architecture::Table_3dnow1_e7,
-  &X86Architecture::Table_3dnow1_e8,
-  &X86Architecture::Table_3dnow1_e9,
-  &X86Architecture::Table_3dnow1_ea,
-  &X86Architecture::Table_3dnow1_eb,
-  &X86Architecture::Table_3dnow1_ec,
-  &X86Architecture::Table_3dnow1_ed,
-  &X86Architecture::Table_3dnow1_ee,
-  &X86Architecture::Table_3dnow1_ef,
-  &X86Architecture::Table_3dnow1_f0,
-  &X86Architecture::Table_3dnow1_f1,
-  &X86Architecture::Table_3dnow1_f2,
-  &X86Architecture::Table_3dnow1_f3,
-  &X86Architecture::Table_3dnow1_f4,
-  &X86Architecture::Table_3dnow1_f5,
-  &X86Architecture::Table_3dnow1_f6,
-  &X86Architecture::Table_3dnow1_f7,
-  &X86Architecture::Table_3dnow1_f8,
-  &X86Architecture::Table_3dnow1_f9,
-  &X86Architecture::Table_3dnow1_fa,
-  &X86Architecture::Table_3dnow1_fb,
-  &X86Architecture::Table_3dnow1_fc,
-  &X86Architecture::Table_3dnow1_fd,
-  &X86Architecture::Table_3dnow1_fe,
-  &X86Architecture::Table_3dnow1_ff
+const X86Architecture::DecodeEntry X86Architecture::m_Table_3dnow1[0x100] =
+{
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* 00 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* 01 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* 02 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* 03 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* 04 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* 05 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* 06 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* 07 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* 08 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* 09 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* 0a */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* 0b */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x163, 0, DecodeHandler }, /* 0c */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x164, 0, DecodeHandler }, /* 0d */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* 0e */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* 0f */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* 10 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* 11 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* 12 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* 13 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* 14 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* 15 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* 16 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* 17 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* 18 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* 19 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* 1a */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* 1b */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x165, 0, DecodeHandler }, /* 1c */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x166, 0, DecodeHandler }, /* 1d */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* 1e */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* 1f */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* 20 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* 21 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* 22 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* 23 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* 24 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* 25 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* 26 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* 27 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* 28 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* 29 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* 2a */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* 2b */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* 2c */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* 2d */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* 2e */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* 2f */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* 30 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* 31 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* 32 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* 33 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* 34 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* 35 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* 36 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* 37 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* 38 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* 39 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* 3a */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* 3b */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* 3c */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* 3d */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* 3e */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* 3f */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* 40 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* 41 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* 42 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* 43 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* 44 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* 45 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* 46 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* 47 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* 48 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* 49 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* 4a */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* 4b */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* 4c */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* 4d */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* 4e */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* 4f */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* 50 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* 51 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* 52 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* 53 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* 54 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* 55 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* 56 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* 57 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* 58 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* 59 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* 5a */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* 5b */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* 5c */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* 5d */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* 5e */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* 5f */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* 60 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* 61 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* 62 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* 63 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* 64 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* 65 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* 66 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* 67 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* 68 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* 69 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* 6a */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* 6b */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* 6c */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* 6d */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* 6e */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* 6f */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* 70 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* 71 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* 72 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* 73 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* 74 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* 75 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* 76 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* 77 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* 78 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* 79 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* 7a */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* 7b */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* 7c */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* 7d */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* 7e */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* 7f */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* 80 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* 81 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* 82 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* 83 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* 84 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* 85 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x167, 0, DecodeHandler }, /* 86 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x168, 0, DecodeHandler }, /* 87 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* 88 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* 89 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x169, 0, DecodeHandler }, /* 8a */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* 8b */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* 8c */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* 8d */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x16a, 0, DecodeHandler }, /* 8e */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* 8f */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x16b, 0, DecodeHandler }, /* 90 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* 91 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* 92 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* 93 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x16c, 0, DecodeHandler }, /* 94 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* 95 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x16d, 0, DecodeHandler }, /* 96 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x16e, 0, DecodeHandler }, /* 97 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* 98 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* 99 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x16f, 0, DecodeHandler }, /* 9a */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* 9b */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* 9c */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* 9d */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x170, 0, DecodeHandler }, /* 9e */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* 9f */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x171, 0, DecodeHandler }, /* a0 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* a1 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* a2 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* a3 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x172, 0, DecodeHandler }, /* a4 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* a5 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x173, 0, DecodeHandler }, /* a6 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x174, 0, DecodeHandler }, /* a7 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* a8 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* a9 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x175, 0, DecodeHandler }, /* aa */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* ab */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* ac */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* ad */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x176, 0, DecodeHandler }, /* ae */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* af */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x177, 0, DecodeHandler }, /* b0 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* b1 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* b2 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* b3 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x178, 0, DecodeHandler }, /* b4 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* b5 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x179, 0, DecodeHandler }, /* b6 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x17a, 0, DecodeHandler }, /* b7 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* b8 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* b9 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* ba */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x17b, 0, DecodeHandler }, /* bb */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* bc */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* bd */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* be */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x17c, 0, DecodeHandler }, /* bf */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* c0 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* c1 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* c2 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* c3 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* c4 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* c5 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* c6 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* c7 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* c8 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* c9 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* ca */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* cb */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* cc */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* cd */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* ce */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* cf */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* d0 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* d1 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* d2 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* d3 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* d4 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* d5 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* d6 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* d7 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* d8 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* d9 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* da */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* db */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* dc */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* dd */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* de */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* df */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* e0 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* e1 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* e2 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* e3 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* e4 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* e5 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* e6 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* e7 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* e8 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* e9 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* ea */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* eb */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* ec */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* ed */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* ee */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* ef */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* f0 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* f1 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* f2 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* f3 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* f4 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* f5 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* f6 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* f7 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* f8 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* f9 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* fa */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* fb */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* fc */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* fd */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* fe */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }  /* ff */
 };
 
 /** instruction
- * opcode: 00
- * invalid
-**/
-bool X86Architecture::Table_3dnow1_00(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: 01
- * invalid
-**/
-bool X86Architecture::Table_3dnow1_01(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: 02
- * invalid
-**/
-bool X86Architecture::Table_3dnow1_02(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: 03
- * invalid
-**/
-bool X86Architecture::Table_3dnow1_03(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: 04
- * invalid
-**/
-bool X86Architecture::Table_3dnow1_04(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: 05
- * invalid
-**/
-bool X86Architecture::Table_3dnow1_05(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: 06
- * invalid
-**/
-bool X86Architecture::Table_3dnow1_06(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: 07
- * invalid
-**/
-bool X86Architecture::Table_3dnow1_07(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: 08
- * invalid
-**/
-bool X86Architecture::Table_3dnow1_08(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: 09
- * invalid
-**/
-bool X86Architecture::Table_3dnow1_09(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: 0a
- * invalid
-**/
-bool X86Architecture::Table_3dnow1_0a(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: 0b
- * invalid
-**/
-bool X86Architecture::Table_3dnow1_0b(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
+ * opcode: 0c
  * mnemonic: pi2fw
  * operand: ['Pq', 'Qq']
- * opcode: 0c
  * attr: ['amd']
 **/
-bool X86Architecture::Table_3dnow1_0c(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_3dnow1_0c(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Vendor") == X86_ProcType_AMD)
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Pi2fw);
-      if (Operand__Pq_Qq(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Pq_Qq<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -391,18 +284,19 @@ bool X86Architecture::Table_3dnow1_0c(BinaryStream const& rBinStrm, OffsetType O
 }
 
 /** instruction
+ * opcode: 0d
  * mnemonic: pi2fd
  * operand: ['Pq', 'Qq']
- * opcode: 0d
  * attr: ['amd']
 **/
-bool X86Architecture::Table_3dnow1_0d(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_3dnow1_0d(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Vendor") == X86_ProcType_AMD)
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Pi2fd);
-      if (Operand__Pq_Qq(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Pq_Qq<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -413,144 +307,251 @@ bool X86Architecture::Table_3dnow1_0d(BinaryStream const& rBinStrm, OffsetType O
 }
 
 /** instruction
- * opcode: 0e
- * invalid
-**/
-bool X86Architecture::Table_3dnow1_0e(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: 0f
- * invalid
-**/
-bool X86Architecture::Table_3dnow1_0f(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: 10
- * invalid
-**/
-bool X86Architecture::Table_3dnow1_10(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: 11
- * invalid
-**/
-bool X86Architecture::Table_3dnow1_11(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: 12
- * invalid
+ * opcode: 1c
+ * mnemonic: pf2iw
+ * operand: ['Pq', 'Qq']
+ * attr: ['amd']
 **/
-bool X86Architecture::Table_3dnow1_12(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_3dnow1_1c(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
-    return false; /* INVALID */
+    if (m_CfgMdl.GetEnum("Vendor") == X86_ProcType_AMD)
+    {
+      rInsn.Size()++;
+      rInsn.SetOpcode(X86_Opcode_Pf2iw);
+      if (Operand__Pq_Qq<Mode>(rBinStrm, Offset, rInsn) == false)
+      {
+        return false;
+      }
+      return true;
+    }
+    else
+      return false;
 }
 
 /** instruction
- * opcode: 13
- * invalid
+ * opcode: 1d
+ * mnemonic: pd2id
+ * operand: ['Pq', 'Qq']
+ * attr: ['amd']
 **/
-bool X86Architecture::Table_3dnow1_13(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_3dnow1_1d(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
-    return false; /* INVALID */
+    if (m_CfgMdl.GetEnum("Vendor") == X86_ProcType_AMD)
+    {
+      rInsn.Size()++;
+      rInsn.SetOpcode(X86_Opcode_Pd2id);
+      if (Operand__Pq_Qq<Mode>(rBinStrm, Offset, rInsn) == false)
+      {
+        return false;
+      }
+      return true;
+    }
+    else
+      return false;
 }
 
 /** instruction
- * opcode: 14
- * invalid
+ * opcode: 86
+ * mnemonic: pfrcpv
+ * operand: ['Pq', 'Qq']
+ * attr: ['cyrix']
+ * cpu_model: >= X86_Arch_Geode_lx
 **/
-bool X86Architecture::Table_3dnow1_14(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_3dnow1_86(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
-    return false; /* INVALID */
+    if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_Geode_lx && m_CfgMdl.GetEnum("Vendor") == X86_ProcType_CYRIX)
+    {
+      rInsn.Size()++;
+      rInsn.SetOpcode(X86_Opcode_Pfrcpv);
+      if (Operand__Pq_Qq<Mode>(rBinStrm, Offset, rInsn) == false)
+      {
+        return false;
+      }
+      return true;
+    }
+    else
+      return false;
 }
 
 /** instruction
- * opcode: 15
- * invalid
+ * opcode: 87
+ * mnemonic: pfrsqrtv
+ * operand: ['Pq', 'Qq']
+ * attr: ['cyrix']
+ * cpu_model: >= X86_Arch_Geode_lx
 **/
-bool X86Architecture::Table_3dnow1_15(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_3dnow1_87(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
-    return false; /* INVALID */
+    if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_Geode_lx && m_CfgMdl.GetEnum("Vendor") == X86_ProcType_CYRIX)
+    {
+      rInsn.Size()++;
+      rInsn.SetOpcode(X86_Opcode_Pfrsqrtv);
+      if (Operand__Pq_Qq<Mode>(rBinStrm, Offset, rInsn) == false)
+      {
+        return false;
+      }
+      return true;
+    }
+    else
+      return false;
 }
 
 /** instruction
- * opcode: 16
- * invalid
+ * opcode: 8a
+ * mnemonic: pfnacc
+ * operand: ['Pq', 'Qq']
+ * attr: ['amd']
 **/
-bool X86Architecture::Table_3dnow1_16(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_3dnow1_8a(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
-    return false; /* INVALID */
+    if (m_CfgMdl.GetEnum("Vendor") == X86_ProcType_AMD)
+    {
+      rInsn.Size()++;
+      rInsn.SetOpcode(X86_Opcode_Pfnacc);
+      if (Operand__Pq_Qq<Mode>(rBinStrm, Offset, rInsn) == false)
+      {
+        return false;
+      }
+      return true;
+    }
+    else
+      return false;
 }
 
 /** instruction
- * opcode: 17
- * invalid
+ * opcode: 8e
+ * mnemonic: pfpnacc
+ * operand: ['Pq', 'Qq']
+ * attr: ['amd']
 **/
-bool X86Architecture::Table_3dnow1_17(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_3dnow1_8e(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
-    return false; /* INVALID */
+    if (m_CfgMdl.GetEnum("Vendor") == X86_ProcType_AMD)
+    {
+      rInsn.Size()++;
+      rInsn.SetOpcode(X86_Opcode_Pfpnacc);
+      if (Operand__Pq_Qq<Mode>(rBinStrm, Offset, rInsn) == false)
+      {
+        return false;
+      }
+      return true;
+    }
+    else
+      return false;
 }
 
 /** instruction
- * opcode: 18
- * invalid
+ * opcode: 90
+ * mnemonic: pfcmge
+ * operand: ['Pq', 'Qq']
+ * attr: ['amd']
 **/
-bool X86Architecture::Table_3dnow1_18(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_3dnow1_90(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
-    return false; /* INVALID */
+    if (m_CfgMdl.GetEnum("Vendor") == X86_ProcType_AMD)
+    {
+      rInsn.Size()++;
+      rInsn.SetOpcode(X86_Opcode_Pfcmge);
+      if (Operand__Pq_Qq<Mode>(rBinStrm, Offset, rInsn) == false)
+      {
+        return false;
+      }
+      return true;
+    }
+    else
+      return false;
 }
 
 /** instruction
- * opcode: 19
- * invalid
+ * opcode: 94
+ * mnemonic: pfmin
+ * operand: ['Pq', 'Qq']
+ * attr: ['amd']
 **/
-bool X86Architecture::Table_3dnow1_19(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_3dnow1_94(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
-    return false; /* INVALID */
+    if (m_CfgMdl.GetEnum("Vendor") == X86_ProcType_AMD)
+    {
+      rInsn.Size()++;
+      rInsn.SetOpcode(X86_Opcode_Pfmin);
+      if (Operand__Pq_Qq<Mode>(rBinStrm, Offset, rInsn) == false)
+      {
+        return false;
+      }
+      return true;
+    }
+    else
+      return false;
 }
 
 /** instruction
- * opcode: 1a
- * invalid
+ * opcode: 96
+ * mnemonic: pfrcp
+ * operand: ['Pq', 'Qq']
+ * attr: ['amd']
 **/
-bool X86Architecture::Table_3dnow1_1a(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_3dnow1_96(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
-    return false; /* INVALID */
+    if (m_CfgMdl.GetEnum("Vendor") == X86_ProcType_AMD)
+    {
+      rInsn.Size()++;
+      rInsn.SetOpcode(X86_Opcode_Pfrcp);
+      if (Operand__Pq_Qq<Mode>(rBinStrm, Offset, rInsn) == false)
+      {
+        return false;
+      }
+      return true;
+    }
+    else
+      return false;
 }
 
 /** instruction
- * opcode: 1b
- * invalid
+ * opcode: 97
+ * mnemonic: pfrsqrt
+ * operand: ['Pq', 'Qq']
+ * attr: ['amd']
 **/
-bool X86Architecture::Table_3dnow1_1b(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_3dnow1_97(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
-    return false; /* INVALID */
+    if (m_CfgMdl.GetEnum("Vendor") == X86_ProcType_AMD)
+    {
+      rInsn.Size()++;
+      rInsn.SetOpcode(X86_Opcode_Pfrsqrt);
+      if (Operand__Pq_Qq<Mode>(rBinStrm, Offset, rInsn) == false)
+      {
+        return false;
+      }
+      return true;
+    }
+    else
+      return false;
 }
 
 /** instruction
- * mnemonic: pf2iw
+ * opcode: 9a
+ * mnemonic: pfsub
  * operand: ['Pq', 'Qq']
- * opcode: 1c
  * attr: ['amd']
 **/
-bool X86Architecture::Table_3dnow1_1c(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_3dnow1_9a(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Vendor") == X86_ProcType_AMD)
     {
       rInsn.Size()++;
-      rInsn.SetOpcode(X86_Opcode_Pf2iw);
-      if (Operand__Pq_Qq(rBinStrm, Offset, rInsn, Mode) == false)
+      rInsn.SetOpcode(X86_Opcode_Pfsub);
+      if (Operand__Pq_Qq<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -561,18 +562,19 @@ bool X86Architecture::Table_3dnow1_1c(BinaryStream const& rBinStrm, OffsetType O
 }
 
 /** instruction
- * mnemonic: pd2id
+ * opcode: 9e
+ * mnemonic: pfadd
  * operand: ['Pq', 'Qq']
- * opcode: 1d
  * attr: ['amd']
 **/
-bool X86Architecture::Table_3dnow1_1d(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_3dnow1_9e(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Vendor") == X86_ProcType_AMD)
     {
       rInsn.Size()++;
-      rInsn.SetOpcode(X86_Opcode_Pd2id);
-      if (Operand__Pq_Qq(rBinStrm, Offset, rInsn, Mode) == false)
+      rInsn.SetOpcode(X86_Opcode_Pfadd);
+      if (Operand__Pq_Qq<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -583,2324 +585,304 @@ bool X86Architecture::Table_3dnow1_1d(BinaryStream const& rBinStrm, OffsetType O
 }
 
 /** instruction
- * opcode: 1e
- * invalid
+ * opcode: a0
+ * mnemonic: pfcmpgt
+ * operand: ['Pq', 'Qq']
+ * attr: ['amd']
 **/
-bool X86Architecture::Table_3dnow1_1e(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_3dnow1_a0(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: 1f
- * invalid
-**/
-bool X86Architecture::Table_3dnow1_1f(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: 20
- * invalid
-**/
-bool X86Architecture::Table_3dnow1_20(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: 21
- * invalid
-**/
-bool X86Architecture::Table_3dnow1_21(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: 22
- * invalid
-**/
-bool X86Architecture::Table_3dnow1_22(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: 23
- * invalid
-**/
-bool X86Architecture::Table_3dnow1_23(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: 24
- * invalid
-**/
-bool X86Architecture::Table_3dnow1_24(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: 25
- * invalid
-**/
-bool X86Architecture::Table_3dnow1_25(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: 26
- * invalid
-**/
-bool X86Architecture::Table_3dnow1_26(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: 27
- * invalid
-**/
-bool X86Architecture::Table_3dnow1_27(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: 28
- * invalid
-**/
-bool X86Architecture::Table_3dnow1_28(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: 29
- * invalid
-**/
-bool X86Architecture::Table_3dnow1_29(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: 2a
- * invalid
-**/
-bool X86Architecture::Table_3dnow1_2a(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: 2b
- * invalid
-**/
-bool X86Architecture::Table_3dnow1_2b(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: 2c
- * invalid
-**/
-bool X86Architecture::Table_3dnow1_2c(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: 2d
- * invalid
-**/
-bool X86Architecture::Table_3dnow1_2d(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: 2e
- * invalid
-**/
-bool X86Architecture::Table_3dnow1_2e(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: 2f
- * invalid
-**/
-bool X86Architecture::Table_3dnow1_2f(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: 30
- * invalid
-**/
-bool X86Architecture::Table_3dnow1_30(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: 31
- * invalid
-**/
-bool X86Architecture::Table_3dnow1_31(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: 32
- * invalid
-**/
-bool X86Architecture::Table_3dnow1_32(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: 33
- * invalid
-**/
-bool X86Architecture::Table_3dnow1_33(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: 34
- * invalid
-**/
-bool X86Architecture::Table_3dnow1_34(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: 35
- * invalid
-**/
-bool X86Architecture::Table_3dnow1_35(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: 36
- * invalid
-**/
-bool X86Architecture::Table_3dnow1_36(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: 37
- * invalid
-**/
-bool X86Architecture::Table_3dnow1_37(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: 38
- * invalid
-**/
-bool X86Architecture::Table_3dnow1_38(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: 39
- * invalid
-**/
-bool X86Architecture::Table_3dnow1_39(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: 3a
- * invalid
-**/
-bool X86Architecture::Table_3dnow1_3a(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: 3b
- * invalid
-**/
-bool X86Architecture::Table_3dnow1_3b(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: 3c
- * invalid
-**/
-bool X86Architecture::Table_3dnow1_3c(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: 3d
- * invalid
-**/
-bool X86Architecture::Table_3dnow1_3d(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: 3e
- * invalid
-**/
-bool X86Architecture::Table_3dnow1_3e(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: 3f
- * invalid
-**/
-bool X86Architecture::Table_3dnow1_3f(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: 40
- * invalid
-**/
-bool X86Architecture::Table_3dnow1_40(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: 41
- * invalid
-**/
-bool X86Architecture::Table_3dnow1_41(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: 42
- * invalid
-**/
-bool X86Architecture::Table_3dnow1_42(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: 43
- * invalid
-**/
-bool X86Architecture::Table_3dnow1_43(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: 44
- * invalid
-**/
-bool X86Architecture::Table_3dnow1_44(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: 45
- * invalid
-**/
-bool X86Architecture::Table_3dnow1_45(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: 46
- * invalid
-**/
-bool X86Architecture::Table_3dnow1_46(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: 47
- * invalid
-**/
-bool X86Architecture::Table_3dnow1_47(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: 48
- * invalid
-**/
-bool X86Architecture::Table_3dnow1_48(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: 49
- * invalid
-**/
-bool X86Architecture::Table_3dnow1_49(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: 4a
- * invalid
-**/
-bool X86Architecture::Table_3dnow1_4a(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: 4b
- * invalid
-**/
-bool X86Architecture::Table_3dnow1_4b(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: 4c
- * invalid
-**/
-bool X86Architecture::Table_3dnow1_4c(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: 4d
- * invalid
-**/
-bool X86Architecture::Table_3dnow1_4d(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: 4e
- * invalid
-**/
-bool X86Architecture::Table_3dnow1_4e(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: 4f
- * invalid
-**/
-bool X86Architecture::Table_3dnow1_4f(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: 50
- * invalid
-**/
-bool X86Architecture::Table_3dnow1_50(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: 51
- * invalid
-**/
-bool X86Architecture::Table_3dnow1_51(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: 52
- * invalid
-**/
-bool X86Architecture::Table_3dnow1_52(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: 53
- * invalid
-**/
-bool X86Architecture::Table_3dnow1_53(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: 54
- * invalid
-**/
-bool X86Architecture::Table_3dnow1_54(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: 55
- * invalid
-**/
-bool X86Architecture::Table_3dnow1_55(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: 56
- * invalid
-**/
-bool X86Architecture::Table_3dnow1_56(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: 57
- * invalid
-**/
-bool X86Architecture::Table_3dnow1_57(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: 58
- * invalid
-**/
-bool X86Architecture::Table_3dnow1_58(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: 59
- * invalid
-**/
-bool X86Architecture::Table_3dnow1_59(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: 5a
- * invalid
-**/
-bool X86Architecture::Table_3dnow1_5a(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: 5b
- * invalid
-**/
-bool X86Architecture::Table_3dnow1_5b(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: 5c
- * invalid
-**/
-bool X86Architecture::Table_3dnow1_5c(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: 5d
- * invalid
-**/
-bool X86Architecture::Table_3dnow1_5d(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: 5e
- * invalid
-**/
-bool X86Architecture::Table_3dnow1_5e(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: 5f
- * invalid
-**/
-bool X86Architecture::Table_3dnow1_5f(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: 60
- * invalid
-**/
-bool X86Architecture::Table_3dnow1_60(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: 61
- * invalid
-**/
-bool X86Architecture::Table_3dnow1_61(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: 62
- * invalid
-**/
-bool X86Architecture::Table_3dnow1_62(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: 63
- * invalid
-**/
-bool X86Architecture::Table_3dnow1_63(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: 64
- * invalid
-**/
-bool X86Architecture::Table_3dnow1_64(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: 65
- * invalid
-**/
-bool X86Architecture::Table_3dnow1_65(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: 66
- * invalid
-**/
-bool X86Architecture::Table_3dnow1_66(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: 67
- * invalid
-**/
-bool X86Architecture::Table_3dnow1_67(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: 68
- * invalid
-**/
-bool X86Architecture::Table_3dnow1_68(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: 69
- * invalid
-**/
-bool X86Architecture::Table_3dnow1_69(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: 6a
- * invalid
-**/
-bool X86Architecture::Table_3dnow1_6a(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: 6b
- * invalid
-**/
-bool X86Architecture::Table_3dnow1_6b(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: 6c
- * invalid
-**/
-bool X86Architecture::Table_3dnow1_6c(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: 6d
- * invalid
-**/
-bool X86Architecture::Table_3dnow1_6d(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: 6e
- * invalid
-**/
-bool X86Architecture::Table_3dnow1_6e(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: 6f
- * invalid
-**/
-bool X86Architecture::Table_3dnow1_6f(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: 70
- * invalid
-**/
-bool X86Architecture::Table_3dnow1_70(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: 71
- * invalid
-**/
-bool X86Architecture::Table_3dnow1_71(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: 72
- * invalid
-**/
-bool X86Architecture::Table_3dnow1_72(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: 73
- * invalid
-**/
-bool X86Architecture::Table_3dnow1_73(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: 74
- * invalid
-**/
-bool X86Architecture::Table_3dnow1_74(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: 75
- * invalid
-**/
-bool X86Architecture::Table_3dnow1_75(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: 76
- * invalid
-**/
-bool X86Architecture::Table_3dnow1_76(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: 77
- * invalid
-**/
-bool X86Architecture::Table_3dnow1_77(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: 78
- * invalid
-**/
-bool X86Architecture::Table_3dnow1_78(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: 79
- * invalid
-**/
-bool X86Architecture::Table_3dnow1_79(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: 7a
- * invalid
-**/
-bool X86Architecture::Table_3dnow1_7a(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: 7b
- * invalid
-**/
-bool X86Architecture::Table_3dnow1_7b(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: 7c
- * invalid
-**/
-bool X86Architecture::Table_3dnow1_7c(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: 7d
- * invalid
-**/
-bool X86Architecture::Table_3dnow1_7d(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: 7e
- * invalid
-**/
-bool X86Architecture::Table_3dnow1_7e(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: 7f
- * invalid
-**/
-bool X86Architecture::Table_3dnow1_7f(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: 80
- * invalid
-**/
-bool X86Architecture::Table_3dnow1_80(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: 81
- * invalid
-**/
-bool X86Architecture::Table_3dnow1_81(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: 82
- * invalid
-**/
-bool X86Architecture::Table_3dnow1_82(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: 83
- * invalid
-**/
-bool X86Architecture::Table_3dnow1_83(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: 84
- * invalid
-**/
-bool X86Architecture::Table_3dnow1_84(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: 85
- * invalid
-**/
-bool X86Architecture::Table_3dnow1_85(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * mnemonic: pfrcpv
- * operand: ['Pq', 'Qq']
- * opcode: 86
- * attr: ['cyrix']
- * cpu_model: >= X86_Arch_Geode_lx
-**/
-bool X86Architecture::Table_3dnow1_86(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_Geode_lx && m_CfgMdl.GetEnum("Vendor") == X86_ProcType_CYRIX)
-    {
-      rInsn.Size()++;
-      rInsn.SetOpcode(X86_Opcode_Pfrcpv);
-      if (Operand__Pq_Qq(rBinStrm, Offset, rInsn, Mode) == false)
-      {
-        return false;
-      }
-      return true;
-    }
-    else
-      return false;
-}
-
-/** instruction
- * mnemonic: pfrsqrtv
- * operand: ['Pq', 'Qq']
- * opcode: 87
- * attr: ['cyrix']
- * cpu_model: >= X86_Arch_Geode_lx
-**/
-bool X86Architecture::Table_3dnow1_87(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_Geode_lx && m_CfgMdl.GetEnum("Vendor") == X86_ProcType_CYRIX)
-    {
-      rInsn.Size()++;
-      rInsn.SetOpcode(X86_Opcode_Pfrsqrtv);
-      if (Operand__Pq_Qq(rBinStrm, Offset, rInsn, Mode) == false)
-      {
-        return false;
-      }
-      return true;
-    }
-    else
-      return false;
-}
-
-/** instruction
- * opcode: 88
- * invalid
-**/
-bool X86Architecture::Table_3dnow1_88(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: 89
- * invalid
-**/
-bool X86Architecture::Table_3dnow1_89(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * mnemonic: pfnacc
- * operand: ['Pq', 'Qq']
- * opcode: 8a
- * attr: ['amd']
-**/
-bool X86Architecture::Table_3dnow1_8a(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    if (m_CfgMdl.GetEnum("Vendor") == X86_ProcType_AMD)
-    {
-      rInsn.Size()++;
-      rInsn.SetOpcode(X86_Opcode_Pfnacc);
-      if (Operand__Pq_Qq(rBinStrm, Offset, rInsn, Mode) == false)
-      {
-        return false;
-      }
-      return true;
-    }
-    else
-      return false;
-}
-
-/** instruction
- * opcode: 8b
- * invalid
-**/
-bool X86Architecture::Table_3dnow1_8b(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: 8c
- * invalid
-**/
-bool X86Architecture::Table_3dnow1_8c(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: 8d
- * invalid
-**/
-bool X86Architecture::Table_3dnow1_8d(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * mnemonic: pfpnacc
- * operand: ['Pq', 'Qq']
- * opcode: 8e
- * attr: ['amd']
-**/
-bool X86Architecture::Table_3dnow1_8e(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    if (m_CfgMdl.GetEnum("Vendor") == X86_ProcType_AMD)
-    {
-      rInsn.Size()++;
-      rInsn.SetOpcode(X86_Opcode_Pfpnacc);
-      if (Operand__Pq_Qq(rBinStrm, Offset, rInsn, Mode) == false)
-      {
-        return false;
-      }
-      return true;
-    }
-    else
-      return false;
-}
-
-/** instruction
- * opcode: 8f
- * invalid
-**/
-bool X86Architecture::Table_3dnow1_8f(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * mnemonic: pfcmge
- * operand: ['Pq', 'Qq']
- * opcode: 90
- * attr: ['amd']
-**/
-bool X86Architecture::Table_3dnow1_90(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    if (m_CfgMdl.GetEnum("Vendor") == X86_ProcType_AMD)
-    {
-      rInsn.Size()++;
-      rInsn.SetOpcode(X86_Opcode_Pfcmge);
-      if (Operand__Pq_Qq(rBinStrm, Offset, rInsn, Mode) == false)
-      {
-        return false;
-      }
-      return true;
-    }
-    else
-      return false;
-}
-
-/** instruction
- * opcode: 91
- * invalid
-**/
-bool X86Architecture::Table_3dnow1_91(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: 92
- * invalid
-**/
-bool X86Architecture::Table_3dnow1_92(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: 93
- * invalid
-**/
-bool X86Architecture::Table_3dnow1_93(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * mnemonic: pfmin
- * operand: ['Pq', 'Qq']
- * opcode: 94
- * attr: ['amd']
-**/
-bool X86Architecture::Table_3dnow1_94(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    if (m_CfgMdl.GetEnum("Vendor") == X86_ProcType_AMD)
-    {
-      rInsn.Size()++;
-      rInsn.SetOpcode(X86_Opcode_Pfmin);
-      if (Operand__Pq_Qq(rBinStrm, Offset, rInsn, Mode) == false)
-      {
-        return false;
-      }
-      return true;
-    }
-    else
-      return false;
-}
-
-/** instruction
- * opcode: 95
- * invalid
-**/
-bool X86Architecture::Table_3dnow1_95(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * mnemonic: pfrcp
- * operand: ['Pq', 'Qq']
- * opcode: 96
- * attr: ['amd']
-**/
-bool X86Architecture::Table_3dnow1_96(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    if (m_CfgMdl.GetEnum("Vendor") == X86_ProcType_AMD)
-    {
-      rInsn.Size()++;
-      rInsn.SetOpcode(X86_Opcode_Pfrcp);
-      if (Operand__Pq_Qq(rBinStrm, Offset, rInsn, Mode) == false)
-      {
-        return false;
-      }
-      return true;
-    }
-    else
-      return false;
-}
-
-/** instruction
- * mnemonic: pfrsqrt
- * operand: ['Pq', 'Qq']
- * opcode: 97
- * attr: ['amd']
-**/
-bool X86Architecture::Table_3dnow1_97(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    if (m_CfgMdl.GetEnum("Vendor") == X86_ProcType_AMD)
-    {
-      rInsn.Size()++;
-      rInsn.SetOpcode(X86_Opcode_Pfrsqrt);
-      if (Operand__Pq_Qq(rBinStrm, Offset, rInsn, Mode) == false)
-      {
-        return false;
-      }
-      return true;
-    }
-    else
-      return false;
-}
-
-/** instruction
- * opcode: 98
- * invalid
-**/
-bool X86Architecture::Table_3dnow1_98(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: 99
- * invalid
-**/
-bool X86Architecture::Table_3dnow1_99(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * mnemonic: pfsub
- * operand: ['Pq', 'Qq']
- * opcode: 9a
- * attr: ['amd']
-**/
-bool X86Architecture::Table_3dnow1_9a(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    if (m_CfgMdl.GetEnum("Vendor") == X86_ProcType_AMD)
-    {
-      rInsn.Size()++;
-      rInsn.SetOpcode(X86_Opcode_Pfsub);
-      if (Operand__Pq_Qq(rBinStrm, Offset, rInsn, Mode) == false)
-      {
-        return false;
-      }
-      return true;
-    }
-    else
-      return false;
-}
-
-/** instruction
- * opcode: 9b
- * invalid
-**/
-bool X86Architecture::Table_3dnow1_9b(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: 9c
- * invalid
-**/
-bool X86Architecture::Table_3dnow1_9c(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: 9d
- * invalid
-**/
-bool X86Architecture::Table_3dnow1_9d(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * mnemonic: pfadd
- * operand: ['Pq', 'Qq']
- * opcode: 9e
- * attr: ['amd']
-**/
-bool X86Architecture::Table_3dnow1_9e(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    if (m_CfgMdl.GetEnum("Vendor") == X86_ProcType_AMD)
-    {
-      rInsn.Size()++;
-      rInsn.SetOpcode(X86_Opcode_Pfadd);
-      if (Operand__Pq_Qq(rBinStrm, Offset, rInsn, Mode) == false)
-      {
-        return false;
-      }
-      return true;
-    }
-    else
-      return false;
-}
-
-/** instruction
- * opcode: 9f
- * invalid
-**/
-bool X86Architecture::Table_3dnow1_9f(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * mnemonic: pfcmpgt
- * operand: ['Pq', 'Qq']
- * opcode: a0
- * attr: ['amd']
-**/
-bool X86Architecture::Table_3dnow1_a0(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    if (m_CfgMdl.GetEnum("Vendor") == X86_ProcType_AMD)
-    {
-      rInsn.Size()++;
-      rInsn.SetOpcode(X86_Opcode_Pfcmpgt);
-      if (Operand__Pq_Qq(rBinStrm, Offset, rInsn, Mode) == false)
-      {
-        return false;
-      }
-      return true;
-    }
-    else
-      return false;
-}
-
-/** instruction
- * opcode: a1
- * invalid
-**/
-bool X86Architecture::Table_3dnow1_a1(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: a2
- * invalid
-**/
-bool X86Architecture::Table_3dnow1_a2(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: a3
- * invalid
-**/
-bool X86Architecture::Table_3dnow1_a3(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * mnemonic: pfmax
- * operand: ['Pq', 'Qq']
- * opcode: a4
- * attr: ['amd']
-**/
-bool X86Architecture::Table_3dnow1_a4(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    if (m_CfgMdl.GetEnum("Vendor") == X86_ProcType_AMD)
-    {
-      rInsn.Size()++;
-      rInsn.SetOpcode(X86_Opcode_Pfmax);
-      if (Operand__Pq_Qq(rBinStrm, Offset, rInsn, Mode) == false)
-      {
-        return false;
-      }
-      return true;
-    }
-    else
-      return false;
-}
-
-/** instruction
- * opcode: a5
- * invalid
-**/
-bool X86Architecture::Table_3dnow1_a5(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * mnemonic: pfrcpit1
- * operand: ['Pq', 'Qq']
- * opcode: a6
- * attr: ['amd']
-**/
-bool X86Architecture::Table_3dnow1_a6(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    if (m_CfgMdl.GetEnum("Vendor") == X86_ProcType_AMD)
-    {
-      rInsn.Size()++;
-      rInsn.SetOpcode(X86_Opcode_Pfrcpit1);
-      if (Operand__Pq_Qq(rBinStrm, Offset, rInsn, Mode) == false)
-      {
-        return false;
-      }
-      return true;
-    }
-    else
-      return false;
-}
-
-/** instruction
- * mnemonic: pfrsqit1
- * operand: ['Pq', 'Qq']
- * opcode: a7
- * attr: ['amd']
-**/
-bool X86Architecture::Table_3dnow1_a7(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    if (m_CfgMdl.GetEnum("Vendor") == X86_ProcType_AMD)
-    {
-      rInsn.Size()++;
-      rInsn.SetOpcode(X86_Opcode_Pfrsqit1);
-      if (Operand__Pq_Qq(rBinStrm, Offset, rInsn, Mode) == false)
-      {
-        return false;
-      }
-      return true;
-    }
-    else
-      return false;
-}
-
-/** instruction
- * opcode: a8
- * invalid
-**/
-bool X86Architecture::Table_3dnow1_a8(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: a9
- * invalid
-**/
-bool X86Architecture::Table_3dnow1_a9(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * mnemonic: pfsubr
- * operand: ['Pq', 'Qq']
- * opcode: aa
- * attr: ['amd']
-**/
-bool X86Architecture::Table_3dnow1_aa(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    if (m_CfgMdl.GetEnum("Vendor") == X86_ProcType_AMD)
-    {
-      rInsn.Size()++;
-      rInsn.SetOpcode(X86_Opcode_Pfsubr);
-      if (Operand__Pq_Qq(rBinStrm, Offset, rInsn, Mode) == false)
-      {
-        return false;
-      }
-      return true;
-    }
-    else
-      return false;
-}
-
-/** instruction
- * opcode: ab
- * invalid
-**/
-bool X86Architecture::Table_3dnow1_ab(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: ac
- * invalid
-**/
-bool X86Architecture::Table_3dnow1_ac(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: ad
- * invalid
-**/
-bool X86Architecture::Table_3dnow1_ad(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * mnemonic: pfacc
- * operand: ['Pq', 'Qq']
- * opcode: ae
- * attr: ['amd']
-**/
-bool X86Architecture::Table_3dnow1_ae(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    if (m_CfgMdl.GetEnum("Vendor") == X86_ProcType_AMD)
-    {
-      rInsn.Size()++;
-      rInsn.SetOpcode(X86_Opcode_Pfacc);
-      if (Operand__Pq_Qq(rBinStrm, Offset, rInsn, Mode) == false)
-      {
-        return false;
-      }
-      return true;
-    }
-    else
-      return false;
-}
-
-/** instruction
- * opcode: af
- * invalid
-**/
-bool X86Architecture::Table_3dnow1_af(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * mnemonic: pfcmpeq
- * operand: ['Pq', 'Qq']
- * opcode: b0
- * attr: ['amd']
-**/
-bool X86Architecture::Table_3dnow1_b0(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    if (m_CfgMdl.GetEnum("Vendor") == X86_ProcType_AMD)
-    {
-      rInsn.Size()++;
-      rInsn.SetOpcode(X86_Opcode_Pfcmpeq);
-      if (Operand__Pq_Qq(rBinStrm, Offset, rInsn, Mode) == false)
-      {
-        return false;
-      }
-      return true;
-    }
-    else
-      return false;
-}
-
-/** instruction
- * opcode: b1
- * invalid
-**/
-bool X86Architecture::Table_3dnow1_b1(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: b2
- * invalid
-**/
-bool X86Architecture::Table_3dnow1_b2(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: b3
- * invalid
-**/
-bool X86Architecture::Table_3dnow1_b3(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * mnemonic: pfmul
- * operand: ['Pq', 'Qq']
- * opcode: b4
- * attr: ['amd']
-**/
-bool X86Architecture::Table_3dnow1_b4(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    if (m_CfgMdl.GetEnum("Vendor") == X86_ProcType_AMD)
-    {
-      rInsn.Size()++;
-      rInsn.SetOpcode(X86_Opcode_Pfmul);
-      if (Operand__Pq_Qq(rBinStrm, Offset, rInsn, Mode) == false)
-      {
-        return false;
-      }
-      return true;
-    }
-    else
-      return false;
-}
-
-/** instruction
- * opcode: b5
- * invalid
-**/
-bool X86Architecture::Table_3dnow1_b5(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * mnemonic: pfrcpit2
- * operand: ['Pq', 'Qq']
- * opcode: b6
- * attr: ['amd']
-**/
-bool X86Architecture::Table_3dnow1_b6(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    if (m_CfgMdl.GetEnum("Vendor") == X86_ProcType_AMD)
-    {
-      rInsn.Size()++;
-      rInsn.SetOpcode(X86_Opcode_Pfrcpit2);
-      if (Operand__Pq_Qq(rBinStrm, Offset, rInsn, Mode) == false)
-      {
-        return false;
-      }
-      return true;
-    }
-    else
-      return false;
-}
-
-/** instruction
- * mnemonic: pmulhrw
- * operand: ['Pq', 'Qq']
- * opcode: b7
- * attr: ['amd']
-**/
-bool X86Architecture::Table_3dnow1_b7(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    if (m_CfgMdl.GetEnum("Vendor") == X86_ProcType_AMD)
-    {
-      rInsn.Size()++;
-      rInsn.SetOpcode(X86_Opcode_Pmulhrw);
-      if (Operand__Pq_Qq(rBinStrm, Offset, rInsn, Mode) == false)
-      {
-        return false;
-      }
-      return true;
-    }
-    else
-      return false;
-}
-
-/** instruction
- * opcode: b8
- * invalid
-**/
-bool X86Architecture::Table_3dnow1_b8(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: b9
- * invalid
-**/
-bool X86Architecture::Table_3dnow1_b9(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: ba
- * invalid
-**/
-bool X86Architecture::Table_3dnow1_ba(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * mnemonic: pswapd
- * operand: ['Pq', 'Qq']
- * opcode: bb
- * attr: ['amd']
-**/
-bool X86Architecture::Table_3dnow1_bb(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    if (m_CfgMdl.GetEnum("Vendor") == X86_ProcType_AMD)
-    {
-      rInsn.Size()++;
-      rInsn.SetOpcode(X86_Opcode_Pswapd);
-      if (Operand__Pq_Qq(rBinStrm, Offset, rInsn, Mode) == false)
-      {
-        return false;
-      }
-      return true;
-    }
-    else
-      return false;
-}
-
-/** instruction
- * opcode: bc
- * invalid
-**/
-bool X86Architecture::Table_3dnow1_bc(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: bd
- * invalid
-**/
-bool X86Architecture::Table_3dnow1_bd(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: be
- * invalid
-**/
-bool X86Architecture::Table_3dnow1_be(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * mnemonic: pavgusb
- * operand: ['Pq', 'Qq']
- * opcode: bf
- * attr: ['amd']
-**/
-bool X86Architecture::Table_3dnow1_bf(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    if (m_CfgMdl.GetEnum("Vendor") == X86_ProcType_AMD)
-    {
-      rInsn.Size()++;
-      rInsn.SetOpcode(X86_Opcode_Pavgusb);
-      if (Operand__Pq_Qq(rBinStrm, Offset, rInsn, Mode) == false)
-      {
-        return false;
-      }
-      return true;
-    }
-    else
-      return false;
-}
-
-/** instruction
- * opcode: c0
- * invalid
-**/
-bool X86Architecture::Table_3dnow1_c0(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: c1
- * invalid
-**/
-bool X86Architecture::Table_3dnow1_c1(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: c2
- * invalid
-**/
-bool X86Architecture::Table_3dnow1_c2(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: c3
- * invalid
-**/
-bool X86Architecture::Table_3dnow1_c3(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: c4
- * invalid
-**/
-bool X86Architecture::Table_3dnow1_c4(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: c5
- * invalid
-**/
-bool X86Architecture::Table_3dnow1_c5(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: c6
- * invalid
-**/
-bool X86Architecture::Table_3dnow1_c6(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: c7
- * invalid
-**/
-bool X86Architecture::Table_3dnow1_c7(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: c8
- * invalid
-**/
-bool X86Architecture::Table_3dnow1_c8(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: c9
- * invalid
-**/
-bool X86Architecture::Table_3dnow1_c9(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: ca
- * invalid
-**/
-bool X86Architecture::Table_3dnow1_ca(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: cb
- * invalid
-**/
-bool X86Architecture::Table_3dnow1_cb(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: cc
- * invalid
-**/
-bool X86Architecture::Table_3dnow1_cc(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: cd
- * invalid
-**/
-bool X86Architecture::Table_3dnow1_cd(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: ce
- * invalid
-**/
-bool X86Architecture::Table_3dnow1_ce(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: cf
- * invalid
-**/
-bool X86Architecture::Table_3dnow1_cf(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: d0
- * invalid
-**/
-bool X86Architecture::Table_3dnow1_d0(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: d1
- * invalid
-**/
-bool X86Architecture::Table_3dnow1_d1(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: d2
- * invalid
-**/
-bool X86Architecture::Table_3dnow1_d2(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: d3
- * invalid
-**/
-bool X86Architecture::Table_3dnow1_d3(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: d4
- * invalid
-**/
-bool X86Architecture::Table_3dnow1_d4(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: d5
- * invalid
-**/
-bool X86Architecture::Table_3dnow1_d5(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: d6
- * invalid
-**/
-bool X86Architecture::Table_3dnow1_d6(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: d7
- * invalid
-**/
-bool X86Architecture::Table_3dnow1_d7(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: d8
- * invalid
-**/
-bool X86Architecture::Table_3dnow1_d8(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: d9
- * invalid
-**/
-bool X86Architecture::Table_3dnow1_d9(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: da
- * invalid
-**/
-bool X86Architecture::Table_3dnow1_da(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: db
- * invalid
-**/
-bool X86Architecture::Table_3dnow1_db(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: dc
- * invalid
-**/
-bool X86Architecture::Table_3dnow1_dc(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: dd
- * invalid
-**/
-bool X86Architecture::Table_3dnow1_dd(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: de
- * invalid
-**/
-bool X86Architecture::Table_3dnow1_de(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: df
- * invalid
-**/
-bool X86Architecture::Table_3dnow1_df(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: e0
- * invalid
-**/
-bool X86Architecture::Table_3dnow1_e0(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: e1
- * invalid
-**/
-bool X86Architecture::Table_3dnow1_e1(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: e2
- * invalid
-**/
-bool X86Architecture::Table_3dnow1_e2(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: e3
- * invalid
-**/
-bool X86Architecture::Table_3dnow1_e3(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: e4
- * invalid
-**/
-bool X86Architecture::Table_3dnow1_e4(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: e5
- * invalid
-**/
-bool X86Architecture::Table_3dnow1_e5(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: e6
- * invalid
-**/
-bool X86Architecture::Table_3dnow1_e6(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: e7
- * invalid
-**/
-bool X86Architecture::Table_3dnow1_e7(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: e8
- * invalid
-**/
-bool X86Architecture::Table_3dnow1_e8(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: e9
- * invalid
-**/
-bool X86Architecture::Table_3dnow1_e9(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: ea
- * invalid
-**/
-bool X86Architecture::Table_3dnow1_ea(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: eb
- * invalid
-**/
-bool X86Architecture::Table_3dnow1_eb(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: ec
- * invalid
-**/
-bool X86Architecture::Table_3dnow1_ec(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: ed
- * invalid
-**/
-bool X86Architecture::Table_3dnow1_ed(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: ee
- * invalid
-**/
-bool X86Architecture::Table_3dnow1_ee(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: ef
- * invalid
-**/
-bool X86Architecture::Table_3dnow1_ef(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: f0
- * invalid
-**/
-bool X86Architecture::Table_3dnow1_f0(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: f1
- * invalid
-**/
-bool X86Architecture::Table_3dnow1_f1(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: f2
- * invalid
-**/
-bool X86Architecture::Table_3dnow1_f2(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: f3
- * invalid
-**/
-bool X86Architecture::Table_3dnow1_f3(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: f4
- * invalid
-**/
-bool X86Architecture::Table_3dnow1_f4(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
+    if (m_CfgMdl.GetEnum("Vendor") == X86_ProcType_AMD)
+    {
+      rInsn.Size()++;
+      rInsn.SetOpcode(X86_Opcode_Pfcmpgt);
+      if (Operand__Pq_Qq<Mode>(rBinStrm, Offset, rInsn) == false)
+      {
+        return false;
+      }
+      return true;
+    }
+    else
+      return false;
 }
 
 /** instruction
- * opcode: f5
- * invalid
+ * opcode: a4
+ * mnemonic: pfmax
+ * operand: ['Pq', 'Qq']
+ * attr: ['amd']
 **/
-bool X86Architecture::Table_3dnow1_f5(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_3dnow1_a4(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
-    return false; /* INVALID */
+    if (m_CfgMdl.GetEnum("Vendor") == X86_ProcType_AMD)
+    {
+      rInsn.Size()++;
+      rInsn.SetOpcode(X86_Opcode_Pfmax);
+      if (Operand__Pq_Qq<Mode>(rBinStrm, Offset, rInsn) == false)
+      {
+        return false;
+      }
+      return true;
+    }
+    else
+      return false;
 }
 
 /** instruction
- * opcode: f6
- * invalid
+ * opcode: a6
+ * mnemonic: pfrcpit1
+ * operand: ['Pq', 'Qq']
+ * attr: ['amd']
 **/
-bool X86Architecture::Table_3dnow1_f6(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_3dnow1_a6(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
-    return false; /* INVALID */
+    if (m_CfgMdl.GetEnum("Vendor") == X86_ProcType_AMD)
+    {
+      rInsn.Size()++;
+      rInsn.SetOpcode(X86_Opcode_Pfrcpit1);
+      if (Operand__Pq_Qq<Mode>(rBinStrm, Offset, rInsn) == false)
+      {
+        return false;
+      }
+      return true;
+    }
+    else
+      return false;
 }
 
 /** instruction
- * opcode: f7
- * invalid
+ * opcode: a7
+ * mnemonic: pfrsqit1
+ * operand: ['Pq', 'Qq']
+ * attr: ['amd']
 **/
-bool X86Architecture::Table_3dnow1_f7(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_3dnow1_a7(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
-    return false; /* INVALID */
+    if (m_CfgMdl.GetEnum("Vendor") == X86_ProcType_AMD)
+    {
+      rInsn.Size()++;
+      rInsn.SetOpcode(X86_Opcode_Pfrsqit1);
+      if (Operand__Pq_Qq<Mode>(rBinStrm, Offset, rInsn) == false)
+      {
+        return false;
+      }
+      return true;
+    }
+    else
+      return false;
 }
 
 /** instruction
- * opcode: f8
- * invalid
+ * opcode: aa
+ * mnemonic: pfsubr
+ * operand: ['Pq', 'Qq']
+ * attr: ['amd']
 **/
-bool X86Architecture::Table_3dnow1_f8(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_3dnow1_aa(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
-    return false; /* INVALID */
+    if (m_CfgMdl.GetEnum("Vendor") == X86_ProcType_AMD)
+    {
+      rInsn.Size()++;
+      rInsn.SetOpcode(X86_Opcode_Pfsubr);
+      if (Operand__Pq_Qq<Mode>(rBinStrm, Offset, rInsn) == false)
+      {
+        return false;
+      }
+      return true;
+    }
+    else
+      return false;
 }
 
 /** instruction
- * opcode: f9
- * invalid
+ * opcode: ae
+ * mnemonic: pfacc
+ * operand: ['Pq', 'Qq']
+ * attr: ['amd']
 **/
-bool X86Architecture::Table_3dnow1_f9(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_3dnow1_ae(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
-    return false; /* INVALID */
+    if (m_CfgMdl.GetEnum("Vendor") == X86_ProcType_AMD)
+    {
+      rInsn.Size()++;
+      rInsn.SetOpcode(X86_Opcode_Pfacc);
+      if (Operand__Pq_Qq<Mode>(rBinStrm, Offset, rInsn) == false)
+      {
+        return false;
+      }
+      return true;
+    }
+    else
+      return false;
 }
 
 /** instruction
- * opcode: fa
- * invalid
+ * opcode: b0
+ * mnemonic: pfcmpeq
+ * operand: ['Pq', 'Qq']
+ * attr: ['amd']
 **/
-bool X86Architecture::Table_3dnow1_fa(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_3dnow1_b0(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
-    return false; /* INVALID */
+    if (m_CfgMdl.GetEnum("Vendor") == X86_ProcType_AMD)
+    {
+      rInsn.Size()++;
+      rInsn.SetOpcode(X86_Opcode_Pfcmpeq);
+      if (Operand__Pq_Qq<Mode>(rBinStrm, Offset, rInsn) == false)
+      {
+        return false;
+      }
+      return true;
+    }
+    else
+      return false;
 }
 
 /** instruction
- * opcode: fb
- * invalid
+ * opcode: b4
+ * mnemonic: pfmul
+ * operand: ['Pq', 'Qq']
+ * attr: ['amd']
 **/
-bool X86Architecture::Table_3dnow1_fb(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_3dnow1_b4(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
-    return false; /* INVALID */
+    if (m_CfgMdl.GetEnum("Vendor") == X86_ProcType_AMD)
+    {
+      rInsn.Size()++;
+      rInsn.SetOpcode(X86_Opcode_Pfmul);
+      if (Operand__Pq_Qq<Mode>(rBinStrm, Offset, rInsn) == false)
+      {
+        return false;
+      }
+      return true;
+    }
+    else
+      return false;
 }
 
 /** instruction
- * opcode: fc
- * invalid
+ * opcode: b6
+ * mnemonic: pfrcpit2
+ * operand: ['Pq', 'Qq']
+ * attr: ['amd']
 **/
-bool X86Architecture::Table_3dnow1_fc(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_3dnow1_b6(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
-    return false; /* INVALID */
+    if (m_CfgMdl.GetEnum("Vendor") == X86_ProcType_AMD)
+    {
+      rInsn.Size()++;
+      rInsn.SetOpcode(X86_Opcode_Pfrcpit2);
+      if (Operand__Pq_Qq<Mode>(rBinStrm, Offset, rInsn) == false)
+      {
+        return false;
+      }
+      return true;
+    }
+    else
+      return false;
 }
 
 /** instruction
- * opcode: fd
- * invalid
+ * opcode: b7
+ * mnemonic: pmulhrw
+ * operand: ['Pq', 'Qq']
+ * attr: ['amd']
 **/
-bool X86Architecture::Table_3dnow1_fd(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_3dnow1_b7(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
-    return false; /* INVALID */
+    if (m_CfgMdl.GetEnum("Vendor") == X86_ProcType_AMD)
+    {
+      rInsn.Size()++;
+      rInsn.SetOpcode(X86_Opcode_Pmulhrw);
+      if (Operand__Pq_Qq<Mode>(rBinStrm, Offset, rInsn) == false)
+      {
+        return false;
+      }
+      return true;
+    }
+    else
+      return false;
 }
 
 /** instruction
- * opcode: fe
- * invalid
+ * opcode: bb
+ * mnemonic: pswapd
+ * operand: ['Pq', 'Qq']
+ * attr: ['amd']
 **/
-bool X86Architecture::Table_3dnow1_fe(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_3dnow1_bb(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
-    return false; /* INVALID */
+    if (m_CfgMdl.GetEnum("Vendor") == X86_ProcType_AMD)
+    {
+      rInsn.Size()++;
+      rInsn.SetOpcode(X86_Opcode_Pswapd);
+      if (Operand__Pq_Qq<Mode>(rBinStrm, Offset, rInsn) == false)
+      {
+        return false;
+      }
+      return true;
+    }
+    else
+      return false;
 }
 
 /** instruction
- * opcode: ff
- * invalid
+ * opcode: bf
+ * mnemonic: pavgusb
+ * operand: ['Pq', 'Qq']
+ * attr: ['amd']
 **/
-bool X86Architecture::Table_3dnow1_ff(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_3dnow1_bf(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
-    return false; /* INVALID */
+    if (m_CfgMdl.GetEnum("Vendor") == X86_ProcType_AMD)
+    {
+      rInsn.Size()++;
+      rInsn.SetOpcode(X86_Opcode_Pavgusb);
+      if (Operand__Pq_Qq<Mode>(rBinStrm, Offset, rInsn) == false)
+      {
+        return false;
+      }
+      return true;
+    }
+    else
+      return false;
 }
 
+X86_INSTANTIATE_DISASSEMBLER(Table_3dnow1_0c);
+X86_INSTANTIATE_DISASSEMBLER(Table_3dnow1_0d);
+X86_INSTANTIATE_DISASSEMBLER(Table_3dnow1_1c);
+X86_INSTANTIATE_DISASSEMBLER(Table_3dnow1_1d);
+X86_INSTANTIATE_DISASSEMBLER(Table_3dnow1_86);
+X86_INSTANTIATE_DISASSEMBLER(Table_3dnow1_87);
+X86_INSTANTIATE_DISASSEMBLER(Table_3dnow1_8a);
+X86_INSTANTIATE_DISASSEMBLER(Table_3dnow1_8e);
+X86_INSTANTIATE_DISASSEMBLER(Table_3dnow1_90);
+X86_INSTANTIATE_DISASSEMBLER(Table_3dnow1_94);
+X86_INSTANTIATE_DISASSEMBLER(Table_3dnow1_96);
+X86_INSTANTIATE_DISASSEMBLER(Table_3dnow1_97);
+X86_INSTANTIATE_DISASSEMBLER(Table_3dnow1_9a);
+X86_INSTANTIATE_DISASSEMBLER(Table_3dnow1_9e);
+X86_INSTANTIATE_DISASSEMBLER(Table_3dnow1_a0);
+X86_INSTANTIATE_DISASSEMBLER(Table_3dnow1_a4);
+X86_INSTANTIATE_DISASSEMBLER(Table_3dnow1_a6);
+X86_INSTANTIATE_DISASSEMBLER(Table_3dnow1_a7);
+X86_INSTANTIATE_DISASSEMBLER(Table_3dnow1_aa);
+X86_INSTANTIATE_DISASSEMBLER(Table_3dnow1_ae);
+X86_INSTANTIATE_DISASSEMBLER(Table_3dnow1_b0);
+X86_INSTANTIATE_DISASSEMBLER(Table_3dnow1_b4);
+X86_INSTANTIATE_DISASSEMBLER(Table_3dnow1_b6);
+X86_INSTANTIATE_DISASSEMBLER(Table_3dnow1_b7);
+X86_INSTANTIATE_DISASSEMBLER(Table_3dnow1_bb);
+X86_INSTANTIATE_DISASSEMBLER(Table_3dnow1_bf);
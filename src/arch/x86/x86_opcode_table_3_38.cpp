@@ -1,263 +1,263 @@
-/* This file has been automatically generated, you must _NOT_ edit it directly. (Sun Feb 05 12:38:19 2017) */
+/* This file has been automatically generated, you must _NOT_ edit it directly. (Sun Oct 18 18:46:50 2026) */
 #include "x86_architecture.hpp"
-const X86Architecture::TDisassembler X86Architecture::m_Table_3_38[0x100] =
-{
-  &X86Architecture::Table_3_38_00,
-  &X86Architecture::Table_3_38_01,
-  &X86Architecture::Table_3_38_02,
-  &X86Architecture::Table_3_38_03,
-  &X86Architecture::Table_3_38_04,
-  &X86Architecture::Table_3_38_05,
-  &X86Architecture::Table_3_38_06,
-  &X86Architecture::Table_3_38_07,
-  &X86Architecture::Table_3_38_08,
-  &X86Architecture::Table_3_38_09,
-  &X86Architecture::Table_3_38_0a,
-  &X86Architecture::Table_3_38_0b,
-  &X86Architecture::Table_3_38_0c,
-  &X86Architecture::Table_3_38_0d,
-  &X86Architecture::Table_3_38_0e,
-  &X86Architecture::Table_3_38_0f,
-  &X86Architecture::Table_3_38_10,
-  &X86Architecture::Table_3_38_11,
-  &X86Architecture::Table_3_38_12,
-  &X86Architecture::Table_3_38_13,
-  &X86Architecture::Table_3_38_14,
-  &X86Architecture::Table_3_38_15,
-  &X86Architecture::Table_3_38_16,
-  &X86Architecture::Table_3_38_17,
-  &X86Architecture::Table_3_38_18,
-  &X86Architecture::Table_3_38_19,
-  &X86Architecture::Table_3_38_1a,
-  &X86Architecture::Table_3_38_1b,
-  &X86Architecture::Table_3_38_1c,
-  &X86Architecture::Table_3_38_1d,
-  &X86Architecture::Table_3_38_1e,
-  &X86Architecture::Table_3_38_1f,
-  &X86Architecture::Table_3_38_20,
-  &X86Architecture::Table_3_38_21,
-  &X86Architecture::Table_3_38_22,
-  &X86Architecture::Table_3_38_23,
-  &X86Architecture::Table_3_38_24,
-  &X86Architecture::Table_3_38_25,
-  &X86Architecture::Table_3_38_26,
-  &X86Architecture::Table_3_38_27,
-  &X86Architecture::Table_3_38_28,
-  &X86Architecture::Table_3_38_29,
-  &X86Architecture::Table_3_38_2a,
-  &X86Architecture::Table_3_38_2b,
-  &X86Architecture::Table_3_38_2c,
-  &X86Architecture::Table_3_38_2d,
-  &X86Architecture::Table_3_38_2e,
-  &X86Architecture::Table_3_38_2f,
-  &X86Architecture::Table_3_38_30,
-  &X86Architecture::Table_3_38_31,
-  &X86Architecture::Table_3_38_32,
-  &X86Architecture::Table_3_38_33,
-  &X86Architecture::Table_3_38_34,
-  &X86Architecture::Table_3_38_35,
-  &X86Architecture::Table_3_38_36,
-  &X86Architecture::Table_3_38_37,
-  &X86Architecture::Table_3_38_38,
-  &X86Architecture::Table_3_38_39,
-  &X86Architecture::Table_3_38_3a,
-  &X86Architecture::Table_3_38_3b,
-  &X86Architecture::Table_3_38_3c,
-  &X86Architecture::Table_3_38_3d,
-  &X86Architecture::Table_3_38_3e,
-  &X86Architecture::Table_3_38_3f,
-  &X86Architecture::Table_3_38_40,
-  &X86Architecture::Table_3_38_41,
-  &X86Architecture::Table_3_38_42,
-  &X86Architecture::Table_3_38_43,
-  &X86Architecture::Table_3_38_44,
-  &X86Architecture::Table_3_38_45,
-  &X86Architecture::Table_3_38_46,
-  &X86Architecture::Table_3_38_47,
-  &X86Architecture::Table_3_38_48,
-  &X86Architecture::Table_3_38_49,
-  &X86Architecture::Table_3_38_4a,
-  &X86Architecture::Table_3_38_4b,
-  &X86Architecture::Table_3_38_4c,
-  &X86Architecture::Table_3_38_4d,
-  &X86Architecture::Table_3_38_4e,
-  &X86Architecture::Table_3_38_4f,
-  &X86Architecture::Table_3_38_50,
-  &X86Architecture::Table_3_38_51,
-  &X86Architecture::Table_3_38_52,
-  &X86Architecture::Table_3_38_53,
-  &X86Architecture::Table_3_38_54,
-  &X86Architecture::Table_3_38_55,
-  &X86Architecture::Table_3_38_56,
-  &X86Architecture::Table_3_38_57,
-  &X86Architecture::Table_3_38_58,
-  &X86Architecture::Table_3_38_59,
-  &X86Architecture::Table_3_38_5a,
-  &X86Architecture::Table_3_38_5b,
-  &X86Architecture::Table_3_38_5c,
-  &X86Architecture::Table_3_38_5d,
-  &X86Architecture::Table_3_38_5e,
-  &X86Architecture::Table_3_38_5f,
-  &X86Architecture::Table_3_38_60,
-  &X86Architecture::Table_3_38_61,
-  &X86Architecture::Table_3_38_62,
-  &X86Architecture::Table_3_38_63,
-  &X86Architecture::Table_3_38_64,
-  &X86Architecture::Table_3_38_65,
-  &X86Architecture::Table_3_38_66,
-  &X86Architecture::Table_3_38_67,
-  &X86Architecture::Table_3_38_68,
-  &X86Architecture::Table_3_38_69,
-  &X86Architecture::Table_3_38_6a,
-  &X86Architecture::Table_3_38_6b,
-  &X86Architecture::Table_3_38_6c,
-  &X86Architecture::Table_3_38_6d,
-  &X86Architecture::Table_3_38_6e,
-  &X86Architecture::Table_3_38_6f,
-  &X86Architecture::Table_3_38_70,
-  &X86Architecture::Table_3_38_71,
-  &X86Architecture::Table_3_38_72,
-  &X86Architecture::Table_3_38_73,
-  &X86Architecture::Table_3_38_74,
-  &X86Architecture::Table_3_38_75,
-  &X86Architecture::Table_3_38_76,
-  &X86Architecture::Table_3_38_77,
-  &X86Architecture::Table_3_38_78,
-  &X86Architecture::Table_3_38_79,
-  &X86Architecture::Table_3_38_7a,
-  &X86Architecture::Table_3_38_7b,
-  &X86Architecture::Table_3_38_7c,
-  &X86Architecture::Table_3_38_7d,
-  &X86Architecture::Table_3_38_7e,
-  &X86Architecture::Table_3_38_7f,
-  &X86Architecture::Table_3_38_80,
-  &X86Architecture::Table_3_38_81,
-  &X86Architecture::Table_3_38_82,
-  &X86Architecture::Table_3_38_83,
-  &X86Architecture::Table_3_38_84,
-  &X86Architecture::Table_3_38_85,
-  &X86Architecture::Table_3_38_86,
-  &X86Architecture::Table_3_38_87,
-  &X86Architecture::Table_3_38_88,
-  &X86Architecture::Table_3_38_89,
-  &X86Architecture::Table_3_38_8a,
-  &X86Architecture::Table_3_38_8b,
-  &X86Architecture::Table_3_38_8c,
-  &X86Architecture::Table_3_38_8d,
-  &X86Architecture::Table_3_38_8e,
-  &X86Architecture::Table_3_38_8f,
-  &X86Architecture::Table_3_38_90,
-  &X86Architecture::Table_3_38_91,
-  &X86Architecture::Table_3_38_92,
-  &X86Architecture::Table_3_38_93,
-  &X86Architecture::Table_3_38_94,
-  &X86Architecture::Table_3_38_95,
-  &X86Architecture::Table_3_38_96,
-  &X86Architecture::Table_3_38_97,
-  &X86Architecture::Table_3_38_98,
-  &X86Architecture::Table_3_38_99,
-  &X86Architecture::Table_3_38_9a,
-  &X86Architecture::Table_3_38_9b,
-  &X86Architecture::Table_3_38_9c,
-  &X86Architecture::Table_3_38_9d,
-  &X86Architecture::Table_3_38_9e,
-  &X86Architecture::Table_3_38_9f,
-  &X86Architecture::Table_3_38_a0,
-  &X86Architecture::Table_3_38_a1,
-  &X86Architecture::Table_3_38_a2,
-  &X86Architecture::Table_3_38_a3,
-  &X86Architecture::Table_3_38_a4,
-  &X86Architecture::Table_3_38_a5,
-  &X86Architecture::Table_3_38_a6,
-  &X86Architecture::Table_3_38_a7,
-  &X86Architecture::Table_3_38_a8,
-  &X86Architecture::Table_3_38_a9,
-  &X86Architecture::Table_3_38_aa,
-  &X86Architecture::Table_3_38_ab,
-  &X86Architecture::Table_3_38_ac,
-  &X86Architecture::Table_3_38_ad,
-  &X86Architecture::Table_3_38_ae,
-  &X86Architecture::Table_3_38_af,
-  &X86Architecture::Table_3_38_b0,
-  &X86Architecture::Table_3_38_b1,
-  &X86Architecture::Table_3_38_b2,
-  &X86Architecture::Table_3_38_b3,
-  &X86Architecture::Table_3_38_b4,
-  &X86Architecture::Table_3_38_b5,
-  &X86Architecture::Table_3_38_b6,
-  &X86Architecture::Table_3_38_b7,
-  &X86Architecture::Table_3_38_b8,
-  &X86Architecture::Table_3_38_b9,
-  &X86Architecture::Table_3_38_ba,
-  &X86Architecture::Table_3_38_bb,
-  &X86Architecture::Table_3_38_bc,
-  &X86Architecture::Table_3_38_bd,
-  &X86Architecture::Table_3_38_be,
-  &X86Architecture::Table_3_38_bf,
-  &X86Architecture::Table_3_38_c0,
-  &X86Architecture::Table_3_38_c1,
-  &X86Architecture::Table_3_38_c2,
-  &X86Architecture::Table_3_38_c3,
-  &X86Architecture::Table_3_38_c4,
-  &X86Architecture::Table_3_38_c5,
-  &X86Architecture::Table_3_38_c6,
-  &X86Architecture::Table_3_38_c7,
-  &X86Architecture::Table_3_38_c8,
-  &X86Architecture::Table_3_38_c9,
-  &X86Architecture::Table_3_38_ca,
-  &X86Architecture::Table_3_38_cb,
-  &X86Architecture::Table_3_38_cc,
-  &X86Architecture::Table_3_38_cd,
-  &X86Architecture::Table_3_38_ce,
-  &X86Architecture::Table_3_38_cf,
-  &X86Architecture::Table_3_38_d0,
-  &X86Architecture::Table_3_38_d1,
-  &X86Architecture::Table_3_38_d2,
-  &X86Architecture::Table_3_38_d3,
-  &X86Architecture::Table_3_38_d4,
-  &X86Architecture::Table_3_38_d5,
-  &X86Architecture::Table_3_38_d6,
-  &X86Architecture::Table_3_38_d7,
-  &X86Architecture::Table_3_38_d8,
-  &X86Architecture::Table_3_38_d9,
-  &X86Architecture::Table_3_38_da,
-  &X86Architecture::Table_3_38_db,
-  &X86Architecture::Table_3_38_dc,
-  &X86Architecture::Table_3_38_dd,
-  &X86Architecture::Table_3_38_de,
-  &X86Architecture::Table_3_38_df,
-  &X86Architecture::Table_3_38_e0,
-  &X86Architecture::Table_3_38_e1,
-  &X86Architecture::Table_3_38_e2,
-  &X86Architecture::Table_3_38_e3,
-  &X86Architecture::Table_3_38_e4,
-  &X86Architecture::Table_3_38_e5,
-  &X86Architecture::Table_3_38_e6,
-  &X86Architecture::Table_3_38_e7,
-  &X86Architecture::Table_3_38_e8,
-  &X86Architecture::Table_3_38_e9,
-  &X86Architecture::Table_3_38_ea,
-  &X86Architecture::Table_3_38_eb,
-  &X86Architecture::Table_3_38_ec,
-  &X86Architecture::Table_3_38_ed,
-  &X86Architecture::Table_3_38_ee,
-  &X86Architecture::Table_3_38_ef,
-  &X86Architecture::Table_3_38_f0,
-  &X86Architecture::Table_3_38_f1,
-  &X86Architecture::Table_3_38_f2,
-  &X86Architecture::Table_3_38_f3,
-  &X86Architecture::Table_3_38_f4,
-  &X86Architecture::Table_3_38_f5,
-  &X86Architecture::Table_3_38_f6,
-  &X86Architecture::Table_3_38_f7,
-  &X86Architecture::Table_3_38_f8,
-  &X86Architecture::Table_3_38_f9,
-  &X86Architecture::Table_3_38_fa,
-  &X86Architecture::Table_3_38_fb,
-  &X86Architecture::Table_3_38_fc,
-  &X86Architecture::Table_3_38_fd,
-  &X86Architecture::Table_3_38_fe,
-  &X86Architecture::Table_3_38_ff
+const X86Architecture::DecodeEntry X86Architecture::m_Table_3_38[0x100] =
+{
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x17d, 0, DecodeHandler }, /* 00 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x17e, 0, DecodeHandler }, /* 01 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x17f, 0, DecodeHandler }, /* 02 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x180, 0, DecodeHandler }, /* 03 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x181, 0, DecodeHandler }, /* 04 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x182, 0, DecodeHandler }, /* 05 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x183, 0, DecodeHandler }, /* 06 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x184, 0, DecodeHandler }, /* 07 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x185, 0, DecodeHandler }, /* 08 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x186, 0, DecodeHandler }, /* 09 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x187, 0, DecodeHandler }, /* 0a */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x188, 0, DecodeHandler }, /* 0b */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x189, 0, DecodeHandler }, /* 0c */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x18a, 0, DecodeHandler }, /* 0d */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x18b, 0, DecodeHandler }, /* 0e */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x18c, 0, DecodeHandler }, /* 0f */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x18d, 0, DecodeHandler }, /* 10 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* 11 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* 12 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x18e, 0, DecodeHandler }, /* 13 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x18f, 0, DecodeHandler }, /* 14 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x190, 0, DecodeHandler }, /* 15 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x191, 0, DecodeHandler }, /* 16 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x192, 0, DecodeHandler }, /* 17 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x193, 0, DecodeHandler }, /* 18 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x194, 0, DecodeHandler }, /* 19 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x195, 0, DecodeHandler }, /* 1a */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* 1b */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x196, 0, DecodeHandler }, /* 1c */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x197, 0, DecodeHandler }, /* 1d */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x198, 0, DecodeHandler }, /* 1e */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* 1f */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x199, 0, DecodeHandler }, /* 20 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x19a, 0, DecodeHandler }, /* 21 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x19b, 0, DecodeHandler }, /* 22 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x19c, 0, DecodeHandler }, /* 23 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x19d, 0, DecodeHandler }, /* 24 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x19e, 0, DecodeHandler }, /* 25 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* 26 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* 27 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x19f, 0, DecodeHandler }, /* 28 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x1a0, 0, DecodeHandler }, /* 29 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x1a1, 0, DecodeHandler }, /* 2a */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x1a2, 0, DecodeHandler }, /* 2b */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x1a3, 0, DecodeHandler }, /* 2c */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x1a4, 0, DecodeHandler }, /* 2d */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x1a5, 0, DecodeHandler }, /* 2e */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x1a6, 0, DecodeHandler }, /* 2f */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x1a7, 0, DecodeHandler }, /* 30 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x1a8, 0, DecodeHandler }, /* 31 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x1a9, 0, DecodeHandler }, /* 32 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x1aa, 0, DecodeHandler }, /* 33 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x1ab, 0, DecodeHandler }, /* 34 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x1ac, 0, DecodeHandler }, /* 35 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x1ad, 0, DecodeHandler }, /* 36 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x1ae, 0, DecodeHandler }, /* 37 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x1af, 0, DecodeHandler }, /* 38 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x1b0, 0, DecodeHandler }, /* 39 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x1b1, 0, DecodeHandler }, /* 3a */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x1b2, 0, DecodeHandler }, /* 3b */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x1b3, 0, DecodeHandler }, /* 3c */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x1b4, 0, DecodeHandler }, /* 3d */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x1b5, 0, DecodeHandler }, /* 3e */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x1b6, 0, DecodeHandler }, /* 3f */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x1b7, 0, DecodeHandler }, /* 40 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x1b8, 0, DecodeHandler }, /* 41 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* 42 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* 43 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* 44 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x1b9, 0, DecodeHandler }, /* 45 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x1ba, 0, DecodeHandler }, /* 46 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x1bb, 0, DecodeHandler }, /* 47 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* 48 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* 49 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* 4a */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* 4b */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* 4c */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* 4d */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* 4e */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* 4f */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* 50 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* 51 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* 52 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* 53 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* 54 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* 55 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* 56 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* 57 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x1bc, 0, DecodeHandler }, /* 58 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x1bd, 0, DecodeHandler }, /* 59 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x1be, 0, DecodeHandler }, /* 5a */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* 5b */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* 5c */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* 5d */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* 5e */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* 5f */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* 60 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* 61 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* 62 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* 63 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* 64 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* 65 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* 66 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* 67 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* 68 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* 69 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* 6a */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* 6b */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* 6c */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* 6d */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* 6e */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* 6f */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* 70 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* 71 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* 72 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* 73 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* 74 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* 75 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* 76 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* 77 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x1bf, 0, DecodeHandler }, /* 78 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x1c0, 0, DecodeHandler }, /* 79 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* 7a */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* 7b */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* 7c */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* 7d */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* 7e */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* 7f */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x1c1, 0, DecodeHandler }, /* 80 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x1c2, 0, DecodeHandler }, /* 81 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x1c3, 0, DecodeHandler }, /* 82 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* 83 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* 84 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* 85 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* 86 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* 87 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* 88 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* 89 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* 8a */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* 8b */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x1c4, 0, DecodeHandler }, /* 8c */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* 8d */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x1c5, 0, DecodeHandler }, /* 8e */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* 8f */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x1c6, 0, DecodeHandler }, /* 90 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x1c7, 0, DecodeHandler }, /* 91 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x1c8, 0, DecodeHandler }, /* 92 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x1c9, 0, DecodeHandler }, /* 93 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* 94 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* 95 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x1ca, 0, DecodeHandler }, /* 96 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x1cb, 0, DecodeHandler }, /* 97 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x1cc, 0, DecodeHandler }, /* 98 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x1cd, 0, DecodeHandler }, /* 99 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x1ce, 0, DecodeHandler }, /* 9a */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x1cf, 0, DecodeHandler }, /* 9b */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x1d0, 0, DecodeHandler }, /* 9c */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x1d1, 0, DecodeHandler }, /* 9d */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x1d2, 0, DecodeHandler }, /* 9e */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x1d3, 0, DecodeHandler }, /* 9f */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* a0 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* a1 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* a2 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* a3 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* a4 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* a5 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x1d4, 0, DecodeHandler }, /* a6 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x1d5, 0, DecodeHandler }, /* a7 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x1d6, 0, DecodeHandler }, /* a8 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x1d7, 0, DecodeHandler }, /* a9 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x1d8, 0, DecodeHandler }, /* aa */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x1d9, 0, DecodeHandler }, /* ab */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x1da, 0, DecodeHandler }, /* ac */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x1db, 0, DecodeHandler }, /* ad */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x1dc, 0, DecodeHandler }, /* ae */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x1dd, 0, DecodeHandler }, /* af */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* b0 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* b1 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* b2 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* b3 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* b4 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* b5 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x1de, 0, DecodeHandler }, /* b6 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x1df, 0, DecodeHandler }, /* b7 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x1e0, 0, DecodeHandler }, /* b8 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x1e1, 0, DecodeHandler }, /* b9 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x1e2, 0, DecodeHandler }, /* ba */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x1e3, 0, DecodeHandler }, /* bb */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x1e4, 0, DecodeHandler }, /* bc */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x1e5, 0, DecodeHandler }, /* bd */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x1e6, 0, DecodeHandler }, /* be */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x1e7, 0, DecodeHandler }, /* bf */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* c0 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* c1 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* c2 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* c3 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* c4 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* c5 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* c6 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* c7 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* c8 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* c9 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* ca */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* cb */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* cc */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* cd */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* ce */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* cf */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* d0 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* d1 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* d2 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* d3 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* d4 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* d5 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* d6 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* d7 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* d8 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* d9 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* da */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x1e8, 0, DecodeHandler }, /* db */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x1e9, 0, DecodeHandler }, /* dc */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x1ea, 0, DecodeHandler }, /* dd */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x1eb, 0, DecodeHandler }, /* de */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x1ec, 0, DecodeHandler }, /* df */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* e0 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* e1 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* e2 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* e3 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* e4 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* e5 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* e6 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* e7 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* e8 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* e9 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* ea */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* eb */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* ec */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* ed */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* ee */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* ef */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x1ed, 0, DecodeHandler }, /* f0 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x1ee, 0, DecodeHandler }, /* f1 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x1ef, 0, DecodeHandler }, /* f2 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x1f0, 0, DecodeHandler }, /* f3 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* f4 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x1f1, 0, DecodeHandler }, /* f5 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x1f2, 0, DecodeHandler }, /* f6 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x1f3, 0, DecodeHandler }, /* f7 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* f8 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* f9 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* fa */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* fb */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* fc */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* fd */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* fe */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }  /* ff */
 };
 
 /** instructions
@@ -274,8 +274,8 @@ const X86Architecture::TDisassembler X86Architecture::m_Table_3_38[0x100] =
  *
  * mnemonic: pshufb
  * operand: ['Vx', 'Wx']
- * prefix: 66
  * attr: ['ny']
+ * prefix: 66
  * cpu_model: >= X86_Arch_Avx
  *
  * mnemonic: pshufb
@@ -284,13 +284,14 @@ const X86Architecture::TDisassembler X86Architecture::m_Table_3_38[0x100] =
  * cpu_model: >= X86_Arch_Avx2
  *
 **/
-bool X86Architecture::Table_3_38_00(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_3_38_00(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_Avx2 && (rInsn.GetPrefix() & X86_Prefix_OpSize) == X86_Prefix_OpSize)
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Pshufb);
-      if (Operand__Vx_Wx(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vx_Wx<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -300,7 +301,7 @@ bool X86Architecture::Table_3_38_00(BinaryStream const& rBinStrm, OffsetType Off
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Pshufb);
-      if (Operand__Vx_Wx(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vx_Wx<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -310,7 +311,7 @@ bool X86Architecture::Table_3_38_00(BinaryStream const& rBinStrm, OffsetType Off
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Pshufb);
-      if (Operand__Vx_Wx(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vx_Wx<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -320,7 +321,7 @@ bool X86Architecture::Table_3_38_00(BinaryStream const& rBinStrm, OffsetType Off
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Pshufb);
-      if (Operand__Pq_Qq(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Pq_Qq<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -343,8 +344,8 @@ bool X86Architecture::Table_3_38_00(BinaryStream const& rBinStrm, OffsetType Off
  *
  * mnemonic: phaddw
  * operand: ['Vx', 'Wx']
- * prefix: 66
  * attr: ['ny']
+ * prefix: 66
  * cpu_model: >= X86_Arch_Avx
  *
  * mnemonic: phaddw
@@ -353,13 +354,14 @@ bool X86Architecture::Table_3_38_00(BinaryStream const& rBinStrm, OffsetType Off
  * cpu_model: >= X86_Arch_Avx2
  *
 **/
-bool X86Architecture::Table_3_38_01(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_3_38_01(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_Avx2 && (rInsn.GetPrefix() & X86_Prefix_OpSize) == X86_Prefix_OpSize)
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Phaddw);
-      if (Operand__Vx_Wx(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vx_Wx<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -369,7 +371,7 @@ bool X86Architecture::Table_3_38_01(BinaryStream const& rBinStrm, OffsetType Off
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Phaddw);
-      if (Operand__Vx_Wx(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vx_Wx<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -379,7 +381,7 @@ bool X86Architecture::Table_3_38_01(BinaryStream const& rBinStrm, OffsetType Off
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Phaddw);
-      if (Operand__Vx_Wx(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vx_Wx<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -389,7 +391,7 @@ bool X86Architecture::Table_3_38_01(BinaryStream const& rBinStrm, OffsetType Off
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Phaddw);
-      if (Operand__Pq_Qq(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Pq_Qq<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -412,8 +414,8 @@ bool X86Architecture::Table_3_38_01(BinaryStream const& rBinStrm, OffsetType Off
  *
  * mnemonic: phaddd
  * operand: ['Vx', 'Wx']
- * prefix: 66
  * attr: ['ny']
+ * prefix: 66
  * cpu_model: >= X86_Arch_Avx
  *
  * mnemonic: phaddd
@@ -422,13 +424,14 @@ bool X86Architecture::Table_3_38_01(BinaryStream const& rBinStrm, OffsetType Off
  * cpu_model: >= X86_Arch_Avx2
  *
 **/
-bool X86Architecture::Table_3_38_02(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_3_38_02(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_Avx2 && (rInsn.GetPrefix() & X86_Prefix_OpSize) == X86_Prefix_OpSize)
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Phaddd);
-      if (Operand__Vx_Wx(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vx_Wx<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -438,7 +441,7 @@ bool X86Architecture::Table_3_38_02(BinaryStream const& rBinStrm, OffsetType Off
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Phaddd);
-      if (Operand__Vx_Wx(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vx_Wx<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -448,7 +451,7 @@ bool X86Architecture::Table_3_38_02(BinaryStream const& rBinStrm, OffsetType Off
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Phaddd);
-      if (Operand__Vx_Wx(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vx_Wx<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -458,7 +461,7 @@ bool X86Architecture::Table_3_38_02(BinaryStream const& rBinStrm, OffsetType Off
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Phaddd);
-      if (Operand__Pq_Qq(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Pq_Qq<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -481,8 +484,8 @@ bool X86Architecture::Table_3_38_02(BinaryStream const& rBinStrm, OffsetType Off
  *
  * mnemonic: phaddsw
  * operand: ['Vx', 'Wx']
- * prefix: 66
  * attr: ['ny']
+ * prefix: 66
  * cpu_model: >= X86_Arch_Avx
  *
  * mnemonic: phaddsw
@@ -491,13 +494,14 @@ bool X86Architecture::Table_3_38_02(BinaryStream const& rBinStrm, OffsetType Off
  * cpu_model: >= X86_Arch_Avx2
  *
 **/
-bool X86Architecture::Table_3_38_03(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_3_38_03(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_Avx2 && (rInsn.GetPrefix() & X86_Prefix_OpSize) == X86_Prefix_OpSize)
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Phaddsw);
-      if (Operand__Vx_Wx(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vx_Wx<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -507,7 +511,7 @@ bool X86Architecture::Table_3_38_03(BinaryStream const& rBinStrm, OffsetType Off
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Phaddsw);
-      if (Operand__Vx_Wx(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vx_Wx<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -517,7 +521,7 @@ bool X86Architecture::Table_3_38_03(BinaryStream const& rBinStrm, OffsetType Off
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Phaddsw);
-      if (Operand__Vx_Wx(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vx_Wx<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -527,7 +531,7 @@ bool X86Architecture::Table_3_38_03(BinaryStream const& rBinStrm, OffsetType Off
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Phaddsw);
-      if (Operand__Pq_Qq(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Pq_Qq<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -550,8 +554,8 @@ bool X86Architecture::Table_3_38_03(BinaryStream const& rBinStrm, OffsetType Off
  *
  * mnemonic: pmaddubsw
  * operand: ['Vx', 'Wx']
- * prefix: 66
  * attr: ['ny']
+ * prefix: 66
  * cpu_model: >= X86_Arch_Avx
  *
  * mnemonic: pmaddubsw
@@ -560,13 +564,14 @@ bool X86Architecture::Table_3_38_03(BinaryStream const& rBinStrm, OffsetType Off
  * cpu_model: >= X86_Arch_Avx2
  *
 **/
-bool X86Architecture::Table_3_38_04(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_3_38_04(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_Avx2 && (rInsn.GetPrefix() & X86_Prefix_OpSize) == X86_Prefix_OpSize)
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Pmaddubsw);
-      if (Operand__Vx_Wx(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vx_Wx<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -576,7 +581,7 @@ bool X86Architecture::Table_3_38_04(BinaryStream const& rBinStrm, OffsetType Off
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Pmaddubsw);
-      if (Operand__Vx_Wx(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vx_Wx<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -586,7 +591,7 @@ bool X86Architecture::Table_3_38_04(BinaryStream const& rBinStrm, OffsetType Off
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Pmaddubsw);
-      if (Operand__Vx_Wx(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vx_Wx<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -596,7 +601,7 @@ bool X86Architecture::Table_3_38_04(BinaryStream const& rBinStrm, OffsetType Off
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Pmaddubsw);
-      if (Operand__Pq_Qq(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Pq_Qq<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -619,8 +624,8 @@ bool X86Architecture::Table_3_38_04(BinaryStream const& rBinStrm, OffsetType Off
  *
  * mnemonic: phsubw
  * operand: ['Vx', 'Wx']
- * prefix: 66
  * attr: ['ny']
+ * prefix: 66
  * cpu_model: >= X86_Arch_Avx
  *
  * mnemonic: phsubw
@@ -629,13 +634,14 @@ bool X86Architecture::Table_3_38_04(BinaryStream const& rBinStrm, OffsetType Off
  * cpu_model: >= X86_Arch_Avx2
  *
 **/
-bool X86Architecture::Table_3_38_05(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_3_38_05(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_Avx2 && (rInsn.GetPrefix() & X86_Prefix_OpSize) == X86_Prefix_OpSize)
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Phsubw);
-      if (Operand__Vx_Wx(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vx_Wx<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -645,7 +651,7 @@ bool X86Architecture::Table_3_38_05(BinaryStream const& rBinStrm, OffsetType Off
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Phsubw);
-      if (Operand__Vx_Wx(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vx_Wx<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -655,7 +661,7 @@ bool X86Architecture::Table_3_38_05(BinaryStream const& rBinStrm, OffsetType Off
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Phsubw);
-      if (Operand__Vx_Wx(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vx_Wx<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -665,7 +671,7 @@ bool X86Architecture::Table_3_38_05(BinaryStream const& rBinStrm, OffsetType Off
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Phsubw);
-      if (Operand__Pq_Qq(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Pq_Qq<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -688,8 +694,8 @@ bool X86Architecture::Table_3_38_05(BinaryStream const& rBinStrm, OffsetType Off
  *
  * mnemonic: phsubd
  * operand: ['Vx', 'Wx']
- * prefix: 66
  * attr: ['ny']
+ * prefix: 66
  * cpu_model: >= X86_Arch_Avx
  *
  * mnemonic: phsubd
@@ -698,13 +704,14 @@ bool X86Architecture::Table_3_38_05(BinaryStream const& rBinStrm, OffsetType Off
  * cpu_model: >= X86_Arch_Avx2
  *
 **/
-bool X86Architecture::Table_3_38_06(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_3_38_06(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_Avx2 && (rInsn.GetPrefix() & X86_Prefix_OpSize) == X86_Prefix_OpSize)
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Phsubd);
-      if (Operand__Vx_Wx(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vx_Wx<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -714,7 +721,7 @@ bool X86Architecture::Table_3_38_06(BinaryStream const& rBinStrm, OffsetType Off
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Phsubd);
-      if (Operand__Vx_Wx(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vx_Wx<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -724,7 +731,7 @@ bool X86Architecture::Table_3_38_06(BinaryStream const& rBinStrm, OffsetType Off
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Phsubd);
-      if (Operand__Vx_Wx(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vx_Wx<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -734,7 +741,7 @@ bool X86Architecture::Table_3_38_06(BinaryStream const& rBinStrm, OffsetType Off
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Phsubd);
-      if (Operand__Pq_Qq(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Pq_Qq<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -757,8 +764,8 @@ bool X86Architecture::Table_3_38_06(BinaryStream const& rBinStrm, OffsetType Off
  *
  * mnemonic: phsubsw
  * operand: ['Vx', 'Wx']
- * prefix: 66
  * attr: ['ny']
+ * prefix: 66
  * cpu_model: >= X86_Arch_Avx
  *
  * mnemonic: phsubsw
@@ -767,13 +774,14 @@ bool X86Architecture::Table_3_38_06(BinaryStream const& rBinStrm, OffsetType Off
  * cpu_model: >= X86_Arch_Avx2
  *
 **/
-bool X86Architecture::Table_3_38_07(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_3_38_07(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_Avx2 && (rInsn.GetPrefix() & X86_Prefix_OpSize) == X86_Prefix_OpSize)
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Phsubsw);
-      if (Operand__Vx_Wx(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vx_Wx<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -783,7 +791,7 @@ bool X86Architecture::Table_3_38_07(BinaryStream const& rBinStrm, OffsetType Off
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Phsubsw);
-      if (Operand__Vx_Wx(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vx_Wx<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -793,7 +801,7 @@ bool X86Architecture::Table_3_38_07(BinaryStream const& rBinStrm, OffsetType Off
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Phsubsw);
-      if (Operand__Vx_Wx(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vx_Wx<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -803,7 +811,7 @@ bool X86Architecture::Table_3_38_07(BinaryStream const& rBinStrm, OffsetType Off
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Phsubsw);
-      if (Operand__Pq_Qq(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Pq_Qq<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -826,8 +834,8 @@ bool X86Architecture::Table_3_38_07(BinaryStream const& rBinStrm, OffsetType Off
  *
  * mnemonic: psignb
  * operand: ['Vx', 'Wx']
- * prefix: 66
  * attr: ['ny']
+ * prefix: 66
  * cpu_model: >= X86_Arch_Avx
  *
  * mnemonic: psignb
@@ -836,13 +844,14 @@ bool X86Architecture::Table_3_38_07(BinaryStream const& rBinStrm, OffsetType Off
  * cpu_model: >= X86_Arch_Avx2
  *
 **/
-bool X86Architecture::Table_3_38_08(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_3_38_08(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_Avx2 && (rInsn.GetPrefix() & X86_Prefix_OpSize) == X86_Prefix_OpSize)
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Psignb);
-      if (Operand__Vx_Wx(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vx_Wx<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -852,7 +861,7 @@ bool X86Architecture::Table_3_38_08(BinaryStream const& rBinStrm, OffsetType Off
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Psignb);
-      if (Operand__Vx_Wx(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vx_Wx<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -862,7 +871,7 @@ bool X86Architecture::Table_3_38_08(BinaryStream const& rBinStrm, OffsetType Off
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Psignb);
-      if (Operand__Vx_Wx(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vx_Wx<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -872,7 +881,7 @@ bool X86Architecture::Table_3_38_08(BinaryStream const& rBinStrm, OffsetType Off
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Psignb);
-      if (Operand__Pq_Qq(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Pq_Qq<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -895,8 +904,8 @@ bool X86Architecture::Table_3_38_08(BinaryStream const& rBinStrm, OffsetType Off
  *
  * mnemonic: psignw
  * operand: ['Vx', 'Wx']
- * prefix: 66
  * attr: ['ny']
+ * prefix: 66
  * cpu_model: >= X86_Arch_Avx
  *
  * mnemonic: psignw
@@ -905,13 +914,14 @@ bool X86Architecture::Table_3_38_08(BinaryStream const& rBinStrm, OffsetType Off
  * cpu_model: >= X86_Arch_Avx2
  *
 **/
-bool X86Architecture::Table_3_38_09(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_3_38_09(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_Avx2 && (rInsn.GetPrefix() & X86_Prefix_OpSize) == X86_Prefix_OpSize)
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Psignw);
-      if (Operand__Vx_Wx(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vx_Wx<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -921,7 +931,7 @@ bool X86Architecture::Table_3_38_09(BinaryStream const& rBinStrm, OffsetType Off
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Psignw);
-      if (Operand__Vx_Wx(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vx_Wx<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -931,7 +941,7 @@ bool X86Architecture::Table_3_38_09(BinaryStream const& rBinStrm, OffsetType Off
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Psignw);
-      if (Operand__Vx_Wx(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vx_Wx<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -941,7 +951,7 @@ bool X86Architecture::Table_3_38_09(BinaryStream const& rBinStrm, OffsetType Off
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Psignw);
-      if (Operand__Pq_Qq(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Pq_Qq<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -964,8 +974,8 @@ bool X86Architecture::Table_3_38_09(BinaryStream const& rBinStrm, OffsetType Off
  *
  * mnemonic: psignd
  * operand: ['Vx', 'Wx']
- * prefix: 66
  * attr: ['ny']
+ * prefix: 66
  * cpu_model: >= X86_Arch_Avx
  *
  * mnemonic: psignd
@@ -974,13 +984,14 @@ bool X86Architecture::Table_3_38_09(BinaryStream const& rBinStrm, OffsetType Off
  * cpu_model: >= X86_Arch_Avx2
  *
 **/
-bool X86Architecture::Table_3_38_0a(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_3_38_0a(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_Avx2 && (rInsn.GetPrefix() & X86_Prefix_OpSize) == X86_Prefix_OpSize)
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Psignd);
-      if (Operand__Vx_Wx(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vx_Wx<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -990,7 +1001,7 @@ bool X86Architecture::Table_3_38_0a(BinaryStream const& rBinStrm, OffsetType Off
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Psignd);
-      if (Operand__Vx_Wx(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vx_Wx<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -1000,7 +1011,7 @@ bool X86Architecture::Table_3_38_0a(BinaryStream const& rBinStrm, OffsetType Off
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Psignd);
-      if (Operand__Vx_Wx(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vx_Wx<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -1010,7 +1021,7 @@ bool X86Architecture::Table_3_38_0a(BinaryStream const& rBinStrm, OffsetType Off
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Psignd);
-      if (Operand__Pq_Qq(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Pq_Qq<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -1033,8 +1044,8 @@ bool X86Architecture::Table_3_38_0a(BinaryStream const& rBinStrm, OffsetType Off
  *
  * mnemonic: pmulhrsw
  * operand: ['Vx', 'Wx']
- * prefix: 66
  * attr: ['ny']
+ * prefix: 66
  * cpu_model: >= X86_Arch_Avx
  *
  * mnemonic: pmulhrsw
@@ -1043,13 +1054,14 @@ bool X86Architecture::Table_3_38_0a(BinaryStream const& rBinStrm, OffsetType Off
  * cpu_model: >= X86_Arch_Avx2
  *
 **/
-bool X86Architecture::Table_3_38_0b(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_3_38_0b(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_Avx2 && (rInsn.GetPrefix() & X86_Prefix_OpSize) == X86_Prefix_OpSize)
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Pmulhrsw);
-      if (Operand__Vx_Wx(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vx_Wx<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -1059,7 +1071,7 @@ bool X86Architecture::Table_3_38_0b(BinaryStream const& rBinStrm, OffsetType Off
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Pmulhrsw);
-      if (Operand__Vx_Wx(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vx_Wx<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -1069,7 +1081,7 @@ bool X86Architecture::Table_3_38_0b(BinaryStream const& rBinStrm, OffsetType Off
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Pmulhrsw);
-      if (Operand__Vx_Wx(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vx_Wx<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -1079,7 +1091,7 @@ bool X86Architecture::Table_3_38_0b(BinaryStream const& rBinStrm, OffsetType Off
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Pmulhrsw);
-      if (Operand__Pq_Qq(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Pq_Qq<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -1089,20 +1101,21 @@ bool X86Architecture::Table_3_38_0b(BinaryStream const& rBinStrm, OffsetType Off
 }
 
 /** instruction
- * mnemonic: permilps
- * prefix: 66
  * opcode: 0c
- * attr: ['w0']
+ * mnemonic: permilps
  * operand: ['Vx', 'Wx']
+ * attr: ['w0']
+ * prefix: 66
  * cpu_model: >= X86_Arch_Avx
 **/
-bool X86Architecture::Table_3_38_0c(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_3_38_0c(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_Avx && (rInsn.GetPrefix() & X86_Prefix_OpSize) == X86_Prefix_OpSize)
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Permilps);
-      if (Operand__Vx_Wx(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vx_Wx<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -1113,20 +1126,21 @@ bool X86Architecture::Table_3_38_0c(BinaryStream const& rBinStrm, OffsetType Off
 }
 
 /** instruction
- * mnemonic: permilpd
- * prefix: 66
  * opcode: 0d
- * attr: ['w0']
+ * mnemonic: permilpd
  * operand: ['Vx', 'Wx']
+ * attr: ['w0']
+ * prefix: 66
  * cpu_model: >= X86_Arch_Avx
 **/
-bool X86Architecture::Table_3_38_0d(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_3_38_0d(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_Avx && (rInsn.GetPrefix() & X86_Prefix_OpSize) == X86_Prefix_OpSize)
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Permilpd);
-      if (Operand__Vx_Wx(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vx_Wx<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -1137,20 +1151,21 @@ bool X86Architecture::Table_3_38_0d(BinaryStream const& rBinStrm, OffsetType Off
 }
 
 /** instruction
- * mnemonic: testps
- * prefix: 66
  * opcode: 0e
- * attr: ['nv', 'w0']
+ * mnemonic: testps
  * operand: ['Vx', 'Wx']
+ * attr: ['nv', 'w0']
+ * prefix: 66
  * cpu_model: >= X86_Arch_Avx
 **/
-bool X86Architecture::Table_3_38_0e(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_3_38_0e(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_Avx && (rInsn.GetPrefix() & X86_Prefix_OpSize) == X86_Prefix_OpSize)
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Testps);
-      if (Operand__Vx_Wx(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vx_Wx<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -1161,20 +1176,21 @@ bool X86Architecture::Table_3_38_0e(BinaryStream const& rBinStrm, OffsetType Off
 }
 
 /** instruction
- * mnemonic: testpd
- * prefix: 66
  * opcode: 0f
- * attr: ['nv', 'w0']
+ * mnemonic: testpd
  * operand: ['Vx', 'Wx']
+ * attr: ['nv', 'w0']
+ * prefix: 66
  * cpu_model: >= X86_Arch_Avx
 **/
-bool X86Architecture::Table_3_38_0f(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_3_38_0f(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_Avx && (rInsn.GetPrefix() & X86_Prefix_OpSize) == X86_Prefix_OpSize)
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Testpd);
-      if (Operand__Vx_Wx(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vx_Wx<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -1185,19 +1201,20 @@ bool X86Architecture::Table_3_38_0f(BinaryStream const& rBinStrm, OffsetType Off
 }
 
 /** instruction
+ * opcode: 10
  * mnemonic: pblendvb
  * operand: ['Vo', 'Wo']
  * prefix: 66
- * opcode: 10
  * cpu_model: >= X86_Arch_Sse41
 **/
-bool X86Architecture::Table_3_38_10(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_3_38_10(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_Sse41 && (rInsn.GetPrefix() & X86_Prefix_OpSize) == X86_Prefix_OpSize)
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Pblendvb);
-      if (Operand__Vo_Wo(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vo_Wo<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -1207,47 +1224,30 @@ bool X86Architecture::Table_3_38_10(BinaryStream const& rBinStrm, OffsetType Off
       return false;
 }
 
-/** instruction
- * opcode: 11
- * invalid
-**/
-bool X86Architecture::Table_3_38_11(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: 12
- * invalid
-**/
-bool X86Architecture::Table_3_38_12(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
 /** instructions
  * opcode: 13
  *
  * mnemonic: cvtph2ps
  * operand: ['Vo', 'Woq']
- * prefix: 66
  * attr: ['vl0']
+ * prefix: 66
  * cpu_model: >= X86_Arch_F16c
  *
  * mnemonic: cvtph2ps
  * operand: ['Vy', 'Woo']
- * prefix: 66
  * attr: ['vl1']
+ * prefix: 66
  * cpu_model: >= X86_Arch_F16c
  *
 **/
-bool X86Architecture::Table_3_38_13(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_3_38_13(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_F16c && (rInsn.GetPrefix() & X86_Prefix_OpSize) == X86_Prefix_OpSize)
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Cvtph2ps);
-      if (Operand__Vy_Woo(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vy_Woo<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -1257,7 +1257,7 @@ bool X86Architecture::Table_3_38_13(BinaryStream const& rBinStrm, OffsetType Off
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Cvtph2ps);
-      if (Operand__Vo_Woq(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vo_Woq<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -1267,19 +1267,20 @@ bool X86Architecture::Table_3_38_13(BinaryStream const& rBinStrm, OffsetType Off
 }
 
 /** instruction
+ * opcode: 14
  * mnemonic: blendvps
  * operand: ['Vo', 'Wo']
  * prefix: 66
- * opcode: 14
  * cpu_model: >= X86_Arch_Sse41
 **/
-bool X86Architecture::Table_3_38_14(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_3_38_14(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_Sse41 && (rInsn.GetPrefix() & X86_Prefix_OpSize) == X86_Prefix_OpSize)
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Blendvps);
-      if (Operand__Vo_Wo(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vo_Wo<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -1290,19 +1291,20 @@ bool X86Architecture::Table_3_38_14(BinaryStream const& rBinStrm, OffsetType Off
 }
 
 /** instruction
+ * opcode: 15
  * mnemonic: blendvpd
  * operand: ['Vo', 'Wo']
  * prefix: 66
- * opcode: 15
  * cpu_model: >= X86_Arch_Sse41
 **/
-bool X86Architecture::Table_3_38_15(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_3_38_15(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_Sse41 && (rInsn.GetPrefix() & X86_Prefix_OpSize) == X86_Prefix_OpSize)
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Blendvpd);
-      if (Operand__Vo_Wo(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vo_Wo<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -1313,19 +1315,20 @@ bool X86Architecture::Table_3_38_15(BinaryStream const& rBinStrm, OffsetType Off
 }
 
 /** instruction
+ * opcode: 16
  * mnemonic: permps
  * operand: ['Vy', 'Hy', 'Wy']
  * prefix: 66
- * opcode: 16
  * cpu_model: >= X86_Arch_Avx2
 **/
-bool X86Architecture::Table_3_38_16(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_3_38_16(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_Avx2 && (rInsn.GetPrefix() & X86_Prefix_OpSize) == X86_Prefix_OpSize)
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Permps);
-      if (Operand__Vy_Hy_Wy(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vy_Hy_Wy<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -1345,18 +1348,19 @@ bool X86Architecture::Table_3_38_16(BinaryStream const& rBinStrm, OffsetType Off
  *
  * mnemonic: ptest
  * operand: ['Vx', 'Wx']
- * prefix: 66
  * attr: ['nv']
+ * prefix: 66
  * cpu_model: >= X86_Arch_Avx
  *
 **/
-bool X86Architecture::Table_3_38_17(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_3_38_17(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_Avx && (rInsn.GetPrefix() & X86_Prefix_OpSize) == X86_Prefix_OpSize)
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Ptest);
-      if (Operand__Vx_Wx(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vx_Wx<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -1366,7 +1370,7 @@ bool X86Architecture::Table_3_38_17(BinaryStream const& rBinStrm, OffsetType Off
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Ptest);
-      if (Operand__Vx_Wx(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vx_Wx<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -1380,24 +1384,25 @@ bool X86Architecture::Table_3_38_17(BinaryStream const& rBinStrm, OffsetType Off
  *
  * mnemonic: broadcastss
  * operand: ['Vx', 'Uod']
- * prefix: 66
  * attr: ['nc', 'w0']
+ * prefix: 66
  * cpu_model: >= X86_Arch_Avx
  *
  * mnemonic: broadcastss
  * operand: ['Vx', 'Uo']
- * prefix: 66
  * attr: ['nc', 'w0']
+ * prefix: 66
  * cpu_model: >= X86_Arch_Avx2
  *
 **/
-bool X86Architecture::Table_3_38_18(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_3_38_18(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_Avx2 && (rInsn.GetPrefix() & X86_Prefix_OpSize) == X86_Prefix_OpSize)
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Broadcastss);
-      if (Operand__Vx_Uo(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vx_Uo<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -1407,7 +1412,7 @@ bool X86Architecture::Table_3_38_18(BinaryStream const& rBinStrm, OffsetType Off
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Broadcastss);
-      if (Operand__Vx_Uod(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vx_Uod<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -1421,24 +1426,25 @@ bool X86Architecture::Table_3_38_18(BinaryStream const& rBinStrm, OffsetType Off
  *
  * mnemonic: broadcastsd
  * operand: ['Vy', 'Woq']
- * prefix: 66
  * attr: ['nc', 'w0']
+ * prefix: 66
  * cpu_model: >= X86_Arch_Avx
  *
  * mnemonic: broadcastsd
  * operand: ['Vy', 'Uo']
- * prefix: 66
  * attr: ['nc', 'w0']
+ * prefix: 66
  * cpu_model: >= X86_Arch_Avx2
  *
 **/
-bool X86Architecture::Table_3_38_19(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_3_38_19(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_Avx2 && (rInsn.GetPrefix() & X86_Prefix_OpSize) == X86_Prefix_OpSize)
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Broadcastsd);
-      if (Operand__Vy_Uo(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vy_Uo<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -1448,7 +1454,7 @@ bool X86Architecture::Table_3_38_19(BinaryStream const& rBinStrm, OffsetType Off
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Broadcastsd);
-      if (Operand__Vy_Woq(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vy_Woq<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -1458,20 +1464,21 @@ bool X86Architecture::Table_3_38_19(BinaryStream const& rBinStrm, OffsetType Off
 }
 
 /** instruction
- * mnemonic: broadcastf128
- * prefix: 66
  * opcode: 1a
- * attr: ['nv', 'w0']
+ * mnemonic: broadcastf128
  * operand: ['Vy', 'Uo']
+ * attr: ['nv', 'w0']
+ * prefix: 66
  * cpu_model: >= X86_Arch_Avx
 **/
-bool X86Architecture::Table_3_38_1a(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_3_38_1a(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_Avx && (rInsn.GetPrefix() & X86_Prefix_OpSize) == X86_Prefix_OpSize)
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Broadcastf128);
-      if (Operand__Vy_Uo(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vy_Uo<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -1481,15 +1488,6 @@ bool X86Architecture::Table_3_38_1a(BinaryStream const& rBinStrm, OffsetType Off
       return false;
 }
 
-/** instruction
- * opcode: 1b
- * invalid
-**/
-bool X86Architecture::Table_3_38_1b(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
 /** instructions
  * opcode: 1c
  *
@@ -1504,8 +1502,8 @@ bool X86Architecture::Table_3_38_1b(BinaryStream const& rBinStrm, OffsetType Off
  *
  * mnemonic: pabsb
  * operand: ['Vx', 'Wx']
- * prefix: 66
  * attr: ['ny']
+ * prefix: 66
  * cpu_model: >= X86_Arch_Avx
  *
  * mnemonic: pabsb
@@ -1514,13 +1512,14 @@ bool X86Architecture::Table_3_38_1b(BinaryStream const& rBinStrm, OffsetType Off
  * cpu_model: >= X86_Arch_Avx2
  *
 **/
-bool X86Architecture::Table_3_38_1c(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_3_38_1c(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_Avx2 && (rInsn.GetPrefix() & X86_Prefix_OpSize) == X86_Prefix_OpSize)
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Pabsb);
-      if (Operand__Vx_Wx(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vx_Wx<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -1530,7 +1529,7 @@ bool X86Architecture::Table_3_38_1c(BinaryStream const& rBinStrm, OffsetType Off
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Pabsb);
-      if (Operand__Vx_Wx(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vx_Wx<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -1540,7 +1539,7 @@ bool X86Architecture::Table_3_38_1c(BinaryStream const& rBinStrm, OffsetType Off
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Pabsb);
-      if (Operand__Vx_Wx(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vx_Wx<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -1550,7 +1549,7 @@ bool X86Architecture::Table_3_38_1c(BinaryStream const& rBinStrm, OffsetType Off
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Pabsb);
-      if (Operand__Pq_Qq(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Pq_Qq<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -1573,8 +1572,8 @@ bool X86Architecture::Table_3_38_1c(BinaryStream const& rBinStrm, OffsetType Off
  *
  * mnemonic: pabsw
  * operand: ['Vx', 'Wx']
- * prefix: 66
  * attr: ['ny']
+ * prefix: 66
  * cpu_model: >= X86_Arch_Avx
  *
  * mnemonic: pabsw
@@ -1583,13 +1582,14 @@ bool X86Architecture::Table_3_38_1c(BinaryStream const& rBinStrm, OffsetType Off
  * cpu_model: >= X86_Arch_Avx2
  *
 **/
-bool X86Architecture::Table_3_38_1d(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_3_38_1d(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_Avx2 && (rInsn.GetPrefix() & X86_Prefix_OpSize) == X86_Prefix_OpSize)
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Pabsw);
-      if (Operand__Vx_Wx(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vx_Wx<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -1599,7 +1599,7 @@ bool X86Architecture::Table_3_38_1d(BinaryStream const& rBinStrm, OffsetType Off
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Pabsw);
-      if (Operand__Vx_Wx(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vx_Wx<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -1609,7 +1609,7 @@ bool X86Architecture::Table_3_38_1d(BinaryStream const& rBinStrm, OffsetType Off
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Pabsw);
-      if (Operand__Vx_Wx(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vx_Wx<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -1619,7 +1619,7 @@ bool X86Architecture::Table_3_38_1d(BinaryStream const& rBinStrm, OffsetType Off
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Pabsw);
-      if (Operand__Pq_Qq(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Pq_Qq<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -1642,8 +1642,8 @@ bool X86Architecture::Table_3_38_1d(BinaryStream const& rBinStrm, OffsetType Off
  *
  * mnemonic: pabsd
  * operand: ['Vx', 'Wx']
- * prefix: 66
  * attr: ['ny']
+ * prefix: 66
  * cpu_model: >= X86_Arch_Avx
  *
  * mnemonic: pabsd
@@ -1652,13 +1652,14 @@ bool X86Architecture::Table_3_38_1d(BinaryStream const& rBinStrm, OffsetType Off
  * cpu_model: >= X86_Arch_Avx2
  *
 **/
-bool X86Architecture::Table_3_38_1e(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_3_38_1e(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_Avx2 && (rInsn.GetPrefix() & X86_Prefix_OpSize) == X86_Prefix_OpSize)
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Pabsd);
-      if (Operand__Vx_Wx(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vx_Wx<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -1668,7 +1669,7 @@ bool X86Architecture::Table_3_38_1e(BinaryStream const& rBinStrm, OffsetType Off
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Pabsd);
-      if (Operand__Vx_Wx(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vx_Wx<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -1678,7 +1679,7 @@ bool X86Architecture::Table_3_38_1e(BinaryStream const& rBinStrm, OffsetType Off
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Pabsd);
-      if (Operand__Vx_Wx(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vx_Wx<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -1688,7 +1689,7 @@ bool X86Architecture::Table_3_38_1e(BinaryStream const& rBinStrm, OffsetType Off
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Pabsd);
-      if (Operand__Pq_Qq(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Pq_Qq<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -1697,15 +1698,6 @@ bool X86Architecture::Table_3_38_1e(BinaryStream const& rBinStrm, OffsetType Off
     return false;
 }
 
-/** instruction
- * opcode: 1f
- * invalid
-**/
-bool X86Architecture::Table_3_38_1f(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
 /** instructions
  * opcode: 20
  *
@@ -1716,8 +1708,8 @@ bool X86Architecture::Table_3_38_1f(BinaryStream const& rBinStrm, OffsetType Off
  *
  * mnemonic: pmovsxbw
  * operand: ['Vo', 'Woq']
- * prefix: 66
  * attr: ['ny', 'nv']
+ * prefix: 66
  * cpu_model: >= X86_Arch_Avx
  *
  * mnemonic: pmovsxbw
@@ -1726,13 +1718,14 @@ bool X86Architecture::Table_3_38_1f(BinaryStream const& rBinStrm, OffsetType Off
  * cpu_model: >= X86_Arch_Avx2
  *
 **/
-bool X86Architecture::Table_3_38_20(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_3_38_20(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_Avx2 && (rInsn.GetPrefix() & X86_Prefix_OpSize) == X86_Prefix_OpSize)
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Pmovsxbw);
-      if (Operand__Vy_Woo(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vy_Woo<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -1742,7 +1735,7 @@ bool X86Architecture::Table_3_38_20(BinaryStream const& rBinStrm, OffsetType Off
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Pmovsxbw);
-      if (Operand__Vo_Woq(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vo_Woq<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -1752,7 +1745,7 @@ bool X86Architecture::Table_3_38_20(BinaryStream const& rBinStrm, OffsetType Off
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Pmovsxbw);
-      if (Operand__Vo_Woq(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vo_Woq<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -1771,8 +1764,8 @@ bool X86Architecture::Table_3_38_20(BinaryStream const& rBinStrm, OffsetType Off
  *
  * mnemonic: pmovsxbd
  * operand: ['Vo', 'Wod']
- * prefix: 66
  * attr: ['ny', 'nv']
+ * prefix: 66
  * cpu_model: >= X86_Arch_Avx
  *
  * mnemonic: pmovsxbd
@@ -1781,13 +1774,14 @@ bool X86Architecture::Table_3_38_20(BinaryStream const& rBinStrm, OffsetType Off
  * cpu_model: >= X86_Arch_Avx2
  *
 **/
-bool X86Architecture::Table_3_38_21(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_3_38_21(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_Avx2 && (rInsn.GetPrefix() & X86_Prefix_OpSize) == X86_Prefix_OpSize)
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Pmovsxbd);
-      if (Operand__Vy_Woq(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vy_Woq<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -1797,7 +1791,7 @@ bool X86Architecture::Table_3_38_21(BinaryStream const& rBinStrm, OffsetType Off
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Pmovsxbd);
-      if (Operand__Vo_Wod(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vo_Wod<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -1807,7 +1801,7 @@ bool X86Architecture::Table_3_38_21(BinaryStream const& rBinStrm, OffsetType Off
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Pmovsxbd);
-      if (Operand__Vo_Wod(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vo_Wod<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -1826,8 +1820,8 @@ bool X86Architecture::Table_3_38_21(BinaryStream const& rBinStrm, OffsetType Off
  *
  * mnemonic: pmovsxbq
  * operand: ['Vo', 'Wow']
- * prefix: 66
  * attr: ['ny', 'nv']
+ * prefix: 66
  * cpu_model: >= X86_Arch_Avx
  *
  * mnemonic: pmovsxbq
@@ -1836,13 +1830,14 @@ bool X86Architecture::Table_3_38_21(BinaryStream const& rBinStrm, OffsetType Off
  * cpu_model: >= X86_Arch_Avx2
  *
 **/
-bool X86Architecture::Table_3_38_22(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_3_38_22(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_Avx2 && (rInsn.GetPrefix() & X86_Prefix_OpSize) == X86_Prefix_OpSize)
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Pmovsxbq);
-      if (Operand__Vy_Wod(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vy_Wod<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -1852,7 +1847,7 @@ bool X86Architecture::Table_3_38_22(BinaryStream const& rBinStrm, OffsetType Off
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Pmovsxbq);
-      if (Operand__Vo_Wow(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vo_Wow<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -1862,7 +1857,7 @@ bool X86Architecture::Table_3_38_22(BinaryStream const& rBinStrm, OffsetType Off
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Pmovsxbq);
-      if (Operand__Vo_Wow(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vo_Wow<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -1881,8 +1876,8 @@ bool X86Architecture::Table_3_38_22(BinaryStream const& rBinStrm, OffsetType Off
  *
  * mnemonic: pmovsxwd
  * operand: ['Vo', 'Woq']
- * prefix: 66
  * attr: ['ny', 'nv']
+ * prefix: 66
  * cpu_model: >= X86_Arch_Avx
  *
  * mnemonic: pmovsxwd
@@ -1891,13 +1886,14 @@ bool X86Architecture::Table_3_38_22(BinaryStream const& rBinStrm, OffsetType Off
  * cpu_model: >= X86_Arch_Avx2
  *
 **/
-bool X86Architecture::Table_3_38_23(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_3_38_23(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_Avx2 && (rInsn.GetPrefix() & X86_Prefix_OpSize) == X86_Prefix_OpSize)
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Pmovsxwd);
-      if (Operand__Vy_Woo(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vy_Woo<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -1907,7 +1903,7 @@ bool X86Architecture::Table_3_38_23(BinaryStream const& rBinStrm, OffsetType Off
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Pmovsxwd);
-      if (Operand__Vo_Woq(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vo_Woq<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -1917,7 +1913,7 @@ bool X86Architecture::Table_3_38_23(BinaryStream const& rBinStrm, OffsetType Off
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Pmovsxwd);
-      if (Operand__Vo_Woq(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vo_Woq<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -1936,8 +1932,8 @@ bool X86Architecture::Table_3_38_23(BinaryStream const& rBinStrm, OffsetType Off
  *
  * mnemonic: pmovsxwq
  * operand: ['Vo', 'Wod']
- * prefix: 66
  * attr: ['ny', 'nv']
+ * prefix: 66
  * cpu_model: >= X86_Arch_Avx
  *
  * mnemonic: pmovsxwq
@@ -1946,13 +1942,14 @@ bool X86Architecture::Table_3_38_23(BinaryStream const& rBinStrm, OffsetType Off
  * cpu_model: >= X86_Arch_Avx2
  *
 **/
-bool X86Architecture::Table_3_38_24(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_3_38_24(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_Avx2 && (rInsn.GetPrefix() & X86_Prefix_OpSize) == X86_Prefix_OpSize)
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Pmovsxwq);
-      if (Operand__Vy_Woq(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vy_Woq<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -1962,7 +1959,7 @@ bool X86Architecture::Table_3_38_24(BinaryStream const& rBinStrm, OffsetType Off
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Pmovsxwq);
-      if (Operand__Vo_Wod(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vo_Wod<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -1972,7 +1969,7 @@ bool X86Architecture::Table_3_38_24(BinaryStream const& rBinStrm, OffsetType Off
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Pmovsxwq);
-      if (Operand__Vo_Wod(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vo_Wod<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -1991,8 +1988,8 @@ bool X86Architecture::Table_3_38_24(BinaryStream const& rBinStrm, OffsetType Off
  *
  * mnemonic: pmovsxdq
  * operand: ['Vo', 'Wow']
- * prefix: 66
  * attr: ['ny', 'nv']
+ * prefix: 66
  * cpu_model: >= X86_Arch_Avx
  *
  * mnemonic: pmovsxdq
@@ -2001,13 +1998,14 @@ bool X86Architecture::Table_3_38_24(BinaryStream const& rBinStrm, OffsetType Off
  * cpu_model: >= X86_Arch_Avx2
  *
 **/
-bool X86Architecture::Table_3_38_25(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_3_38_25(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_Avx2 && (rInsn.GetPrefix() & X86_Prefix_OpSize) == X86_Prefix_OpSize)
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Pmovsxdq);
-      if (Operand__Vy_Wod(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vy_Wod<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -2017,7 +2015,7 @@ bool X86Architecture::Table_3_38_25(BinaryStream const& rBinStrm, OffsetType Off
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Pmovsxdq);
-      if (Operand__Vo_Wow(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vo_Wow<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -2027,7 +2025,7 @@ bool X86Architecture::Table_3_38_25(BinaryStream const& rBinStrm, OffsetType Off
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Pmovsxdq);
-      if (Operand__Vo_Wow(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vo_Wow<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -2036,24 +2034,6 @@ bool X86Architecture::Table_3_38_25(BinaryStream const& rBinStrm, OffsetType Off
     return false;
 }
 
-/** instruction
- * opcode: 26
- * invalid
-**/
-bool X86Architecture::Table_3_38_26(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: 27
- * invalid
-**/
-bool X86Architecture::Table_3_38_27(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
 /** instructions
  * opcode: 28
  *
@@ -2064,8 +2044,8 @@ bool X86Architecture::Table_3_38_27(BinaryStream const& rBinStrm, OffsetType Off
  *
  * mnemonic: pmuldq
  * operand: ['Vx', 'Wx']
- * prefix: 66
  * attr: ['ny']
+ * prefix: 66
  * cpu_model: >= X86_Arch_Avx
  *
  * mnemonic: pmuldq
@@ -2074,13 +2054,14 @@ bool X86Architecture::Table_3_38_27(BinaryStream const& rBinStrm, OffsetType Off
  * cpu_model: >= X86_Arch_Avx2
  *
 **/
-bool X86Architecture::Table_3_38_28(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_3_38_28(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_Avx2 && (rInsn.GetPrefix() & X86_Prefix_OpSize) == X86_Prefix_OpSize)
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Pmuldq);
-      if (Operand__Vx_Wx(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vx_Wx<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -2090,7 +2071,7 @@ bool X86Architecture::Table_3_38_28(BinaryStream const& rBinStrm, OffsetType Off
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Pmuldq);
-      if (Operand__Vx_Wx(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vx_Wx<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -2100,7 +2081,7 @@ bool X86Architecture::Table_3_38_28(BinaryStream const& rBinStrm, OffsetType Off
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Pmuldq);
-      if (Operand__Vx_Wx(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vx_Wx<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -2119,8 +2100,8 @@ bool X86Architecture::Table_3_38_28(BinaryStream const& rBinStrm, OffsetType Off
  *
  * mnemonic: pcmpeqq
  * operand: ['Vx', 'Wx']
- * prefix: 66
  * attr: ['ny']
+ * prefix: 66
  * cpu_model: >= X86_Arch_Avx
  *
  * mnemonic: pcmpeqq
@@ -2129,13 +2110,14 @@ bool X86Architecture::Table_3_38_28(BinaryStream const& rBinStrm, OffsetType Off
  * cpu_model: >= X86_Arch_Avx2
  *
 **/
-bool X86Architecture::Table_3_38_29(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_3_38_29(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_Avx2 && (rInsn.GetPrefix() & X86_Prefix_OpSize) == X86_Prefix_OpSize)
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Pcmpeqq);
-      if (Operand__Vx_Wx(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vx_Wx<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -2145,7 +2127,7 @@ bool X86Architecture::Table_3_38_29(BinaryStream const& rBinStrm, OffsetType Off
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Pcmpeqq);
-      if (Operand__Vx_Wx(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vx_Wx<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -2155,7 +2137,7 @@ bool X86Architecture::Table_3_38_29(BinaryStream const& rBinStrm, OffsetType Off
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Pcmpeqq);
-      if (Operand__Vx_Wx(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vx_Wx<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -2174,24 +2156,25 @@ bool X86Architecture::Table_3_38_29(BinaryStream const& rBinStrm, OffsetType Off
  *
  * mnemonic: movntdqa
  * operand: ['Vx', 'Mx']
- * prefix: 66
  * attr: ['nv', 'ny']
+ * prefix: 66
  * cpu_model: >= X86_Arch_Avx
  *
  * mnemonic: movntdqa
  * operand: ['Vx', 'Mx']
- * prefix: 66
  * attr: ['nv']
+ * prefix: 66
  * cpu_model: >= X86_Arch_Avx2
  *
 **/
-bool X86Architecture::Table_3_38_2a(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_3_38_2a(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_Avx2 && (rInsn.GetPrefix() & X86_Prefix_OpSize) == X86_Prefix_OpSize)
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Movntdqa);
-      if (Operand__Vx_Mx(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vx_Mx<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -2201,7 +2184,7 @@ bool X86Architecture::Table_3_38_2a(BinaryStream const& rBinStrm, OffsetType Off
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Movntdqa);
-      if (Operand__Vx_Mx(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vx_Mx<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -2211,7 +2194,7 @@ bool X86Architecture::Table_3_38_2a(BinaryStream const& rBinStrm, OffsetType Off
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Movntdqa);
-      if (Operand__Vx_Mx(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vx_Mx<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -2230,8 +2213,8 @@ bool X86Architecture::Table_3_38_2a(BinaryStream const& rBinStrm, OffsetType Off
  *
  * mnemonic: packusdw
  * operand: ['Vx', 'Wx']
- * prefix: 66
  * attr: ['ny']
+ * prefix: 66
  * cpu_model: >= X86_Arch_Avx
  *
  * mnemonic: packusdw
@@ -2240,13 +2223,14 @@ bool X86Architecture::Table_3_38_2a(BinaryStream const& rBinStrm, OffsetType Off
  * cpu_model: >= X86_Arch_Avx2
  *
 **/
-bool X86Architecture::Table_3_38_2b(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_3_38_2b(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_Avx2 && (rInsn.GetPrefix() & X86_Prefix_OpSize) == X86_Prefix_OpSize)
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Packusdw);
-      if (Operand__Vx_Wx(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vx_Wx<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -2256,7 +2240,7 @@ bool X86Architecture::Table_3_38_2b(BinaryStream const& rBinStrm, OffsetType Off
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Packusdw);
-      if (Operand__Vx_Wx(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vx_Wx<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -2266,7 +2250,7 @@ bool X86Architecture::Table_3_38_2b(BinaryStream const& rBinStrm, OffsetType Off
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Packusdw);
-      if (Operand__Vx_Wx(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vx_Wx<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -2276,20 +2260,21 @@ bool X86Architecture::Table_3_38_2b(BinaryStream const& rBinStrm, OffsetType Off
 }
 
 /** instruction
- * mnemonic: maskmovps
- * prefix: 66
  * opcode: 2c
- * attr: ['w0']
+ * mnemonic: maskmovps
  * operand: ['Vx', 'Mx']
+ * attr: ['w0']
+ * prefix: 66
  * cpu_model: >= X86_Arch_Avx
 **/
-bool X86Architecture::Table_3_38_2c(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_3_38_2c(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_Avx && (rInsn.GetPrefix() & X86_Prefix_OpSize) == X86_Prefix_OpSize)
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Maskmovps);
-      if (Operand__Vx_Mx(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vx_Mx<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -2300,20 +2285,21 @@ bool X86Architecture::Table_3_38_2c(BinaryStream const& rBinStrm, OffsetType Off
 }
 
 /** instruction
- * mnemonic: maskmovpd
- * prefix: 66
  * opcode: 2d
- * attr: ['w0']
+ * mnemonic: maskmovpd
  * operand: ['Vx', 'Mx']
+ * attr: ['w0']
+ * prefix: 66
  * cpu_model: >= X86_Arch_Avx
 **/
-bool X86Architecture::Table_3_38_2d(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_3_38_2d(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_Avx && (rInsn.GetPrefix() & X86_Prefix_OpSize) == X86_Prefix_OpSize)
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Maskmovpd);
-      if (Operand__Vx_Mx(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vx_Mx<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -2324,20 +2310,21 @@ bool X86Architecture::Table_3_38_2d(BinaryStream const& rBinStrm, OffsetType Off
 }
 
 /** instruction
- * mnemonic: maskmovps
- * prefix: 66
  * opcode: 2e
- * attr: ['w0']
+ * mnemonic: maskmovps
  * operand: ['Mx', 'Vx']
+ * attr: ['w0']
+ * prefix: 66
  * cpu_model: >= X86_Arch_Avx
 **/
-bool X86Architecture::Table_3_38_2e(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_3_38_2e(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_Avx && (rInsn.GetPrefix() & X86_Prefix_OpSize) == X86_Prefix_OpSize)
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Maskmovps);
-      if (Operand__Mx_Vx(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Mx_Vx<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -2348,20 +2335,21 @@ bool X86Architecture::Table_3_38_2e(BinaryStream const& rBinStrm, OffsetType Off
 }
 
 /** instruction
- * mnemonic: maskmovpd
- * prefix: 66
  * opcode: 2f
- * attr: ['w0']
+ * mnemonic: maskmovpd
  * operand: ['Mx', 'Vx']
+ * attr: ['w0']
+ * prefix: 66
  * cpu_model: >= X86_Arch_Avx
 **/
-bool X86Architecture::Table_3_38_2f(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_3_38_2f(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_Avx && (rInsn.GetPrefix() & X86_Prefix_OpSize) == X86_Prefix_OpSize)
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Maskmovpd);
-      if (Operand__Mx_Vx(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Mx_Vx<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -2381,8 +2369,8 @@ bool X86Architecture::Table_3_38_2f(BinaryStream const& rBinStrm, OffsetType Off
  *
  * mnemonic: pmovzxbw
  * operand: ['Vo', 'Woq']
- * prefix: 66
  * attr: ['ny', 'nv']
+ * prefix: 66
  * cpu_model: >= X86_Arch_Avx
  *
  * mnemonic: pmovzxbw
@@ -2391,13 +2379,14 @@ bool X86Architecture::Table_3_38_2f(BinaryStream const& rBinStrm, OffsetType Off
  * cpu_model: >= X86_Arch_Avx2
  *
 **/
-bool X86Architecture::Table_3_38_30(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_3_38_30(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_Avx2 && (rInsn.GetPrefix() & X86_Prefix_OpSize) == X86_Prefix_OpSize)
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Pmovzxbw);
-      if (Operand__Vy_Woo(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vy_Woo<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -2407,7 +2396,7 @@ bool X86Architecture::Table_3_38_30(BinaryStream const& rBinStrm, OffsetType Off
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Pmovzxbw);
-      if (Operand__Vo_Woq(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vo_Woq<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -2417,7 +2406,7 @@ bool X86Architecture::Table_3_38_30(BinaryStream const& rBinStrm, OffsetType Off
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Pmovzxbw);
-      if (Operand__Vo_Woq(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vo_Woq<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -2436,8 +2425,8 @@ bool X86Architecture::Table_3_38_30(BinaryStream const& rBinStrm, OffsetType Off
  *
  * mnemonic: pmovzxbd
  * operand: ['Vo', 'Wod']
- * prefix: 66
  * attr: ['ny', 'nv']
+ * prefix: 66
  * cpu_model: >= X86_Arch_Avx
  *
  * mnemonic: pmovzxbd
@@ -2446,13 +2435,14 @@ bool X86Architecture::Table_3_38_30(BinaryStream const& rBinStrm, OffsetType Off
  * cpu_model: >= X86_Arch_Avx2
  *
 **/
-bool X86Architecture::Table_3_38_31(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_3_38_31(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_Avx2 && (rInsn.GetPrefix() & X86_Prefix_OpSize) == X86_Prefix_OpSize)
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Pmovzxbd);
-      if (Operand__Vy_Woq(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vy_Woq<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -2462,7 +2452,7 @@ bool X86Architecture::Table_3_38_31(BinaryStream const& rBinStrm, OffsetType Off
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Pmovzxbd);
-      if (Operand__Vo_Wod(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vo_Wod<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -2472,7 +2462,7 @@ bool X86Architecture::Table_3_38_31(BinaryStream const& rBinStrm, OffsetType Off
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Pmovzxbd);
-      if (Operand__Vo_Wod(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vo_Wod<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -2491,8 +2481,8 @@ bool X86Architecture::Table_3_38_31(BinaryStream const& rBinStrm, OffsetType Off
  *
  * mnemonic: pmovzxbq
  * operand: ['Vo', 'Wow']
- * prefix: 66
  * attr: ['ny', 'nv']
+ * prefix: 66
  * cpu_model: >= X86_Arch_Avx
  *
  * mnemonic: pmovzxbq
@@ -2501,13 +2491,14 @@ bool X86Architecture::Table_3_38_31(BinaryStream const& rBinStrm, OffsetType Off
  * cpu_model: >= X86_Arch_Avx2
  *
 **/
-bool X86Architecture::Table_3_38_32(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_3_38_32(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_Avx2 && (rInsn.GetPrefix() & X86_Prefix_OpSize) == X86_Prefix_OpSize)
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Pmovzxbq);
-      if (Operand__Vy_Wod(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vy_Wod<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -2517,7 +2508,7 @@ bool X86Architecture::Table_3_38_32(BinaryStream const& rBinStrm, OffsetType Off
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Pmovzxbq);
-      if (Operand__Vo_Wow(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vo_Wow<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -2527,7 +2518,7 @@ bool X86Architecture::Table_3_38_32(BinaryStream const& rBinStrm, OffsetType Off
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Pmovzxbq);
-      if (Operand__Vo_Wow(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vo_Wow<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -2546,8 +2537,8 @@ bool X86Architecture::Table_3_38_32(BinaryStream const& rBinStrm, OffsetType Off
  *
  * mnemonic: pmovzxwd
  * operand: ['Vo', 'Woq']
- * prefix: 66
  * attr: ['ny', 'nv']
+ * prefix: 66
  * cpu_model: >= X86_Arch_Avx
  *
  * mnemonic: pmovzxwd
@@ -2556,13 +2547,14 @@ bool X86Architecture::Table_3_38_32(BinaryStream const& rBinStrm, OffsetType Off
  * cpu_model: >= X86_Arch_Avx2
  *
 **/
-bool X86Architecture::Table_3_38_33(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_3_38_33(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_Avx2 && (rInsn.GetPrefix() & X86_Prefix_OpSize) == X86_Prefix_OpSize)
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Pmovzxwd);
-      if (Operand__Vy_Woo(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vy_Woo<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -2572,7 +2564,7 @@ bool X86Architecture::Table_3_38_33(BinaryStream const& rBinStrm, OffsetType Off
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Pmovzxwd);
-      if (Operand__Vo_Woq(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vo_Woq<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -2582,7 +2574,7 @@ bool X86Architecture::Table_3_38_33(BinaryStream const& rBinStrm, OffsetType Off
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Pmovzxwd);
-      if (Operand__Vo_Woq(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vo_Woq<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -2601,8 +2593,8 @@ bool X86Architecture::Table_3_38_33(BinaryStream const& rBinStrm, OffsetType Off
  *
  * mnemonic: pmovzxwq
  * operand: ['Vo', 'Wod']
- * prefix: 66
  * attr: ['ny', 'nv']
+ * prefix: 66
  * cpu_model: >= X86_Arch_Avx
  *
  * mnemonic: pmovzxwq
@@ -2611,13 +2603,14 @@ bool X86Architecture::Table_3_38_33(BinaryStream const& rBinStrm, OffsetType Off
  * cpu_model: >= X86_Arch_Avx2
  *
 **/
-bool X86Architecture::Table_3_38_34(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_3_38_34(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_Avx2 && (rInsn.GetPrefix() & X86_Prefix_OpSize) == X86_Prefix_OpSize)
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Pmovzxwq);
-      if (Operand__Vy_Woq(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vy_Woq<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -2627,7 +2620,7 @@ bool X86Architecture::Table_3_38_34(BinaryStream const& rBinStrm, OffsetType Off
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Pmovzxwq);
-      if (Operand__Vo_Wod(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vo_Wod<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -2637,7 +2630,7 @@ bool X86Architecture::Table_3_38_34(BinaryStream const& rBinStrm, OffsetType Off
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Pmovzxwq);
-      if (Operand__Vo_Wod(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vo_Wod<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -2656,8 +2649,8 @@ bool X86Architecture::Table_3_38_34(BinaryStream const& rBinStrm, OffsetType Off
  *
  * mnemonic: pmovzxdq
  * operand: ['Vo', 'Woq']
- * prefix: 66
  * attr: ['ny', 'nv']
+ * prefix: 66
  * cpu_model: >= X86_Arch_Avx
  *
  * mnemonic: pmovzxdq
@@ -2666,13 +2659,14 @@ bool X86Architecture::Table_3_38_34(BinaryStream const& rBinStrm, OffsetType Off
  * cpu_model: >= X86_Arch_Avx2
  *
 **/
-bool X86Architecture::Table_3_38_35(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_3_38_35(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_Avx2 && (rInsn.GetPrefix() & X86_Prefix_OpSize) == X86_Prefix_OpSize)
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Pmovzxdq);
-      if (Operand__Vy_Woo(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vy_Woo<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -2682,7 +2676,7 @@ bool X86Architecture::Table_3_38_35(BinaryStream const& rBinStrm, OffsetType Off
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Pmovzxdq);
-      if (Operand__Vo_Woq(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vo_Woq<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -2692,7 +2686,7 @@ bool X86Architecture::Table_3_38_35(BinaryStream const& rBinStrm, OffsetType Off
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Pmovzxdq);
-      if (Operand__Vo_Woq(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vo_Woq<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -2702,19 +2696,20 @@ bool X86Architecture::Table_3_38_35(BinaryStream const& rBinStrm, OffsetType Off
 }
 
 /** instruction
+ * opcode: 36
  * mnemonic: permd
  * operand: ['Vy', 'Hy', 'Wy']
  * prefix: 66
- * opcode: 36
  * cpu_model: >= X86_Arch_Avx2
 **/
-bool X86Architecture::Table_3_38_36(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_3_38_36(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_Avx2 && (rInsn.GetPrefix() & X86_Prefix_OpSize) == X86_Prefix_OpSize)
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Permd);
-      if (Operand__Vy_Hy_Wy(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vy_Hy_Wy<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -2734,18 +2729,19 @@ bool X86Architecture::Table_3_38_36(BinaryStream const& rBinStrm, OffsetType Off
  *
  * mnemonic: pcmpgtq
  * operand: ['Vx', 'Wx']
- * prefix: 66
  * attr: ['ny']
+ * prefix: 66
  * cpu_model: >= X86_Arch_Avx
  *
 **/
-bool X86Architecture::Table_3_38_37(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_3_38_37(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_Avx && (rInsn.GetPrefix() & X86_Prefix_OpSize) == X86_Prefix_OpSize)
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Pcmpgtq);
-      if (Operand__Vx_Wx(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vx_Wx<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -2755,7 +2751,7 @@ bool X86Architecture::Table_3_38_37(BinaryStream const& rBinStrm, OffsetType Off
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Pcmpgtq);
-      if (Operand__Vx_Wx(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vx_Wx<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -2774,8 +2770,8 @@ bool X86Architecture::Table_3_38_37(BinaryStream const& rBinStrm, OffsetType Off
  *
  * mnemonic: pminsb
  * operand: ['Vx', 'Wx']
- * prefix: 66
  * attr: ['ny']
+ * prefix: 66
  * cpu_model: >= X86_Arch_Avx
  *
  * mnemonic: pminsb
@@ -2784,13 +2780,14 @@ bool X86Architecture::Table_3_38_37(BinaryStream const& rBinStrm, OffsetType Off
  * cpu_model: >= X86_Arch_Avx2
  *
 **/
-bool X86Architecture::Table_3_38_38(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_3_38_38(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_Avx2 && (rInsn.GetPrefix() & X86_Prefix_OpSize) == X86_Prefix_OpSize)
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Pminsb);
-      if (Operand__Vx_Wx(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vx_Wx<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -2800,7 +2797,7 @@ bool X86Architecture::Table_3_38_38(BinaryStream const& rBinStrm, OffsetType Off
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Pminsb);
-      if (Operand__Vx_Wx(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vx_Wx<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -2810,7 +2807,7 @@ bool X86Architecture::Table_3_38_38(BinaryStream const& rBinStrm, OffsetType Off
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Pminsb);
-      if (Operand__Vx_Wx(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vx_Wx<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -2829,8 +2826,8 @@ bool X86Architecture::Table_3_38_38(BinaryStream const& rBinStrm, OffsetType Off
  *
  * mnemonic: pminsd
  * operand: ['Vx', 'Wx']
- * prefix: 66
  * attr: ['ny']
+ * prefix: 66
  * cpu_model: >= X86_Arch_Avx
  *
  * mnemonic: pminsd
@@ -2839,13 +2836,14 @@ bool X86Architecture::Table_3_38_38(BinaryStream const& rBinStrm, OffsetType Off
  * cpu_model: >= X86_Arch_Avx2
  *
 **/
-bool X86Architecture::Table_3_38_39(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_3_38_39(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_Avx2 && (rInsn.GetPrefix() & X86_Prefix_OpSize) == X86_Prefix_OpSize)
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Pminsd);
-      if (Operand__Vx_Wx(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vx_Wx<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -2855,7 +2853,7 @@ bool X86Architecture::Table_3_38_39(BinaryStream const& rBinStrm, OffsetType Off
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Pminsd);
-      if (Operand__Vx_Wx(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vx_Wx<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -2865,7 +2863,7 @@ bool X86Architecture::Table_3_38_39(BinaryStream const& rBinStrm, OffsetType Off
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Pminsd);
-      if (Operand__Vx_Wx(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vx_Wx<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -2884,8 +2882,8 @@ bool X86Architecture::Table_3_38_39(BinaryStream const& rBinStrm, OffsetType Off
  *
  * mnemonic: pminuw
  * operand: ['Vx', 'Wx']
- * prefix: 66
  * attr: ['ny']
+ * prefix: 66
  * cpu_model: >= X86_Arch_Avx
  *
  * mnemonic: pminuw
@@ -2894,13 +2892,14 @@ bool X86Architecture::Table_3_38_39(BinaryStream const& rBinStrm, OffsetType Off
  * cpu_model: >= X86_Arch_Avx2
  *
 **/
-bool X86Architecture::Table_3_38_3a(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_3_38_3a(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_Avx2 && (rInsn.GetPrefix() & X86_Prefix_OpSize) == X86_Prefix_OpSize)
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Pminuw);
-      if (Operand__Vx_Wx(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vx_Wx<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -2910,7 +2909,7 @@ bool X86Architecture::Table_3_38_3a(BinaryStream const& rBinStrm, OffsetType Off
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Pminuw);
-      if (Operand__Vx_Wx(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vx_Wx<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -2920,7 +2919,7 @@ bool X86Architecture::Table_3_38_3a(BinaryStream const& rBinStrm, OffsetType Off
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Pminuw);
-      if (Operand__Vx_Wx(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vx_Wx<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -2939,8 +2938,8 @@ bool X86Architecture::Table_3_38_3a(BinaryStream const& rBinStrm, OffsetType Off
  *
  * mnemonic: pminud
  * operand: ['Vx', 'Wx']
- * prefix: 66
  * attr: ['ny']
+ * prefix: 66
  * cpu_model: >= X86_Arch_Avx
  *
  * mnemonic: pminud
@@ -2949,13 +2948,14 @@ bool X86Architecture::Table_3_38_3a(BinaryStream const& rBinStrm, OffsetType Off
  * cpu_model: >= X86_Arch_Avx2
  *
 **/
-bool X86Architecture::Table_3_38_3b(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_3_38_3b(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_Avx2 && (rInsn.GetPrefix() & X86_Prefix_OpSize) == X86_Prefix_OpSize)
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Pminud);
-      if (Operand__Vx_Wx(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vx_Wx<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -2965,7 +2965,7 @@ bool X86Architecture::Table_3_38_3b(BinaryStream const& rBinStrm, OffsetType Off
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Pminud);
-      if (Operand__Vx_Wx(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vx_Wx<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -2975,7 +2975,7 @@ bool X86Architecture::Table_3_38_3b(BinaryStream const& rBinStrm, OffsetType Off
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Pminud);
-      if (Operand__Vx_Wx(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vx_Wx<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -2994,8 +2994,8 @@ bool X86Architecture::Table_3_38_3b(BinaryStream const& rBinStrm, OffsetType Off
  *
  * mnemonic: pmaxsb
  * operand: ['Vx', 'Wx']
- * prefix: 66
  * attr: ['ny']
+ * prefix: 66
  * cpu_model: >= X86_Arch_Avx
  *
  * mnemonic: pmaxsb
@@ -3004,13 +3004,14 @@ bool X86Architecture::Table_3_38_3b(BinaryStream const& rBinStrm, OffsetType Off
  * cpu_model: >= X86_Arch_Avx2
  *
 **/
-bool X86Architecture::Table_3_38_3c(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_3_38_3c(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_Avx2 && (rInsn.GetPrefix() & X86_Prefix_OpSize) == X86_Prefix_OpSize)
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Pmaxsb);
-      if (Operand__Vx_Wx(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vx_Wx<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -3020,7 +3021,7 @@ bool X86Architecture::Table_3_38_3c(BinaryStream const& rBinStrm, OffsetType Off
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Pmaxsb);
-      if (Operand__Vx_Wx(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vx_Wx<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -3030,7 +3031,7 @@ bool X86Architecture::Table_3_38_3c(BinaryStream const& rBinStrm, OffsetType Off
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Pmaxsb);
-      if (Operand__Vx_Wx(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vx_Wx<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -3049,8 +3050,8 @@ bool X86Architecture::Table_3_38_3c(BinaryStream const& rBinStrm, OffsetType Off
  *
  * mnemonic: pmaxsd
  * operand: ['Vx', 'Wx']
- * prefix: 66
  * attr: ['ny']
+ * prefix: 66
  * cpu_model: >= X86_Arch_Avx
  *
  * mnemonic: pmaxsd
@@ -3059,13 +3060,14 @@ bool X86Architecture::Table_3_38_3c(BinaryStream const& rBinStrm, OffsetType Off
  * cpu_model: >= X86_Arch_Avx2
  *
 **/
-bool X86Architecture::Table_3_38_3d(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_3_38_3d(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_Avx2 && (rInsn.GetPrefix() & X86_Prefix_OpSize) == X86_Prefix_OpSize)
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Pmaxsd);
-      if (Operand__Vx_Wx(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vx_Wx<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -3075,7 +3077,7 @@ bool X86Architecture::Table_3_38_3d(BinaryStream const& rBinStrm, OffsetType Off
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Pmaxsd);
-      if (Operand__Vx_Wx(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vx_Wx<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -3085,7 +3087,7 @@ bool X86Architecture::Table_3_38_3d(BinaryStream const& rBinStrm, OffsetType Off
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Pmaxsd);
-      if (Operand__Vx_Wx(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vx_Wx<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -3104,8 +3106,8 @@ bool X86Architecture::Table_3_38_3d(BinaryStream const& rBinStrm, OffsetType Off
  *
  * mnemonic: pmaxuw
  * operand: ['Vx', 'Wx']
- * prefix: 66
  * attr: ['ny']
+ * prefix: 66
  * cpu_model: >= X86_Arch_Avx
  *
  * mnemonic: pmaxuw
@@ -3114,13 +3116,14 @@ bool X86Architecture::Table_3_38_3d(BinaryStream const& rBinStrm, OffsetType Off
  * cpu_model: >= X86_Arch_Avx2
  *
 **/
-bool X86Architecture::Table_3_38_3e(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_3_38_3e(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_Avx2 && (rInsn.GetPrefix() & X86_Prefix_OpSize) == X86_Prefix_OpSize)
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Pmaxuw);
-      if (Operand__Vx_Wx(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vx_Wx<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -3130,7 +3133,7 @@ bool X86Architecture::Table_3_38_3e(BinaryStream const& rBinStrm, OffsetType Off
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Pmaxuw);
-      if (Operand__Vx_Wx(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vx_Wx<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -3140,7 +3143,7 @@ bool X86Architecture::Table_3_38_3e(BinaryStream const& rBinStrm, OffsetType Off
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Pmaxuw);
-      if (Operand__Vx_Wx(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vx_Wx<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -3159,8 +3162,8 @@ bool X86Architecture::Table_3_38_3e(BinaryStream const& rBinStrm, OffsetType Off
  *
  * mnemonic: pmaxud
  * operand: ['Vx', 'Wx']
- * prefix: 66
  * attr: ['ny']
+ * prefix: 66
  * cpu_model: >= X86_Arch_Avx
  *
  * mnemonic: pmaxud
@@ -3169,13 +3172,14 @@ bool X86Architecture::Table_3_38_3e(BinaryStream const& rBinStrm, OffsetType Off
  * cpu_model: >= X86_Arch_Avx2
  *
 **/
-bool X86Architecture::Table_3_38_3f(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_3_38_3f(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_Avx2 && (rInsn.GetPrefix() & X86_Prefix_OpSize) == X86_Prefix_OpSize)
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Pmaxud);
-      if (Operand__Vx_Wx(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vx_Wx<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -3185,7 +3189,7 @@ bool X86Architecture::Table_3_38_3f(BinaryStream const& rBinStrm, OffsetType Off
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Pmaxud);
-      if (Operand__Vx_Wx(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vx_Wx<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -3195,7 +3199,7 @@ bool X86Architecture::Table_3_38_3f(BinaryStream const& rBinStrm, OffsetType Off
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Pmaxud);
-      if (Operand__Vx_Wx(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vx_Wx<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -3214,8 +3218,8 @@ bool X86Architecture::Table_3_38_3f(BinaryStream const& rBinStrm, OffsetType Off
  *
  * mnemonic: pmulld
  * operand: ['Vx', 'Wx']
- * prefix: 66
  * attr: ['ny']
+ * prefix: 66
  * cpu_model: >= X86_Arch_Avx
  *
  * mnemonic: pmulld
@@ -3224,13 +3228,14 @@ bool X86Architecture::Table_3_38_3f(BinaryStream const& rBinStrm, OffsetType Off
  * cpu_model: >= X86_Arch_Avx2
  *
 **/
-bool X86Architecture::Table_3_38_40(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_3_38_40(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_Avx2 && (rInsn.GetPrefix() & X86_Prefix_OpSize) == X86_Prefix_OpSize)
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Pmulld);
-      if (Operand__Vx_Wx(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vx_Wx<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -3240,7 +3245,7 @@ bool X86Architecture::Table_3_38_40(BinaryStream const& rBinStrm, OffsetType Off
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Pmulld);
-      if (Operand__Vx_Wx(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vx_Wx<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -3250,7 +3255,7 @@ bool X86Architecture::Table_3_38_40(BinaryStream const& rBinStrm, OffsetType Off
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Pmulld);
-      if (Operand__Vx_Wx(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vx_Wx<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -3269,18 +3274,19 @@ bool X86Architecture::Table_3_38_40(BinaryStream const& rBinStrm, OffsetType Off
  *
  * mnemonic: phminposuw
  * operand: ['Vo', 'Wo']
- * prefix: 66
  * attr: ['ny', 'nv']
+ * prefix: 66
  * cpu_model: >= X86_Arch_Avx
  *
 **/
-bool X86Architecture::Table_3_38_41(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_3_38_41(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_Avx && (rInsn.GetPrefix() & X86_Prefix_OpSize) == X86_Prefix_OpSize)
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Phminposuw);
-      if (Operand__Vo_Wo(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vo_Wo<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -3290,7 +3296,7 @@ bool X86Architecture::Table_3_38_41(BinaryStream const& rBinStrm, OffsetType Off
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Phminposuw);
-      if (Operand__Vo_Wo(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vo_Wo<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -3299,56 +3305,30 @@ bool X86Architecture::Table_3_38_41(BinaryStream const& rBinStrm, OffsetType Off
     return false;
 }
 
-/** instruction
- * opcode: 42
- * invalid
-**/
-bool X86Architecture::Table_3_38_42(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: 43
- * invalid
-**/
-bool X86Architecture::Table_3_38_43(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: 44
- * invalid
-**/
-bool X86Architecture::Table_3_38_44(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
 /** instructions
  * opcode: 45
  *
  * mnemonic: psrlvd
  * operand: ['Vx', 'Wx']
- * prefix: 66
  * attr: ['w0']
+ * prefix: 66
  * cpu_model: >= X86_Arch_Avx2
  *
  * mnemonic: psrlvq
  * operand: ['Vx', 'Wx']
- * prefix: 66
  * attr: ['w1']
+ * prefix: 66
  * cpu_model: >= X86_Arch_Avx2
  *
 **/
-bool X86Architecture::Table_3_38_45(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_3_38_45(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_Avx2 && (rInsn.GetPrefix() & X86_Prefix_OpSize) == X86_Prefix_OpSize)
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Psrlvq);
-      if (Operand__Vx_Wx(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vx_Wx<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -3358,7 +3338,7 @@ bool X86Architecture::Table_3_38_45(BinaryStream const& rBinStrm, OffsetType Off
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Psrlvd);
-      if (Operand__Vx_Wx(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vx_Wx<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -3368,20 +3348,21 @@ bool X86Architecture::Table_3_38_45(BinaryStream const& rBinStrm, OffsetType Off
 }
 
 /** instruction
- * mnemonic: psravd
- * prefix: 66
  * opcode: 46
- * attr: ['w0']
+ * mnemonic: psravd
  * operand: ['Vx', 'Wx']
+ * attr: ['w0']
+ * prefix: 66
  * cpu_model: >= X86_Arch_Avx2
 **/
-bool X86Architecture::Table_3_38_46(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_3_38_46(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_Avx2 && (rInsn.GetPrefix() & X86_Prefix_OpSize) == X86_Prefix_OpSize)
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Psravd);
-      if (Operand__Vx_Wx(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vx_Wx<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -3396,24 +3377,25 @@ bool X86Architecture::Table_3_38_46(BinaryStream const& rBinStrm, OffsetType Off
  *
  * mnemonic: psllvd
  * operand: ['Vx', 'Wx']
- * prefix: 66
  * attr: ['w0']
+ * prefix: 66
  * cpu_model: >= X86_Arch_Avx2
  *
  * mnemonic: psllvq
  * operand: ['Vx', 'Wx']
- * prefix: 66
  * attr: ['w0']
+ * prefix: 66
  * cpu_model: >= X86_Arch_Avx2
  *
 **/
-bool X86Architecture::Table_3_38_47(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_3_38_47(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_Avx2 && (rInsn.GetPrefix() & X86_Prefix_OpSize) == X86_Prefix_OpSize)
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Psllvq);
-      if (Operand__Vx_Wx(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vx_Wx<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -3423,7 +3405,7 @@ bool X86Architecture::Table_3_38_47(BinaryStream const& rBinStrm, OffsetType Off
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Psllvd);
-      if (Operand__Vx_Wx(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vx_Wx<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -3433,188 +3415,46 @@ bool X86Architecture::Table_3_38_47(BinaryStream const& rBinStrm, OffsetType Off
 }
 
 /** instruction
- * opcode: 48
- * invalid
-**/
-bool X86Architecture::Table_3_38_48(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: 49
- * invalid
+ * opcode: 58
+ * mnemonic: pbroadcastd
+ * operand: ['Vx', 'Uod']
+ * attr: ['nv', 'w0']
+ * prefix: 66
+ * cpu_model: >= X86_Arch_Avx2
 **/
-bool X86Architecture::Table_3_38_49(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_3_38_58(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
-    return false; /* INVALID */
+    if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_Avx2 && (rInsn.GetPrefix() & X86_Prefix_OpSize) == X86_Prefix_OpSize)
+    {
+      rInsn.Size()++;
+      rInsn.SetOpcode(X86_Opcode_Pbroadcastd);
+      if (Operand__Vx_Uod<Mode>(rBinStrm, Offset, rInsn) == false)
+      {
+        return false;
+      }
+      return true;
+    }
+    else
+      return false;
 }
 
 /** instruction
- * opcode: 4a
- * invalid
+ * opcode: 59
+ * mnemonic: pbroadcastq
+ * operand: ['Vx', 'Woq']
+ * attr: ['nv', 'w0']
+ * prefix: 66
+ * cpu_model: >= X86_Arch_Avx2
 **/
-bool X86Architecture::Table_3_38_4a(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: 4b
- * invalid
-**/
-bool X86Architecture::Table_3_38_4b(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: 4c
- * invalid
-**/
-bool X86Architecture::Table_3_38_4c(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: 4d
- * invalid
-**/
-bool X86Architecture::Table_3_38_4d(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: 4e
- * invalid
-**/
-bool X86Architecture::Table_3_38_4e(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: 4f
- * invalid
-**/
-bool X86Architecture::Table_3_38_4f(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: 50
- * invalid
-**/
-bool X86Architecture::Table_3_38_50(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: 51
- * invalid
-**/
-bool X86Architecture::Table_3_38_51(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: 52
- * invalid
-**/
-bool X86Architecture::Table_3_38_52(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: 53
- * invalid
-**/
-bool X86Architecture::Table_3_38_53(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: 54
- * invalid
-**/
-bool X86Architecture::Table_3_38_54(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: 55
- * invalid
-**/
-bool X86Architecture::Table_3_38_55(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: 56
- * invalid
-**/
-bool X86Architecture::Table_3_38_56(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: 57
- * invalid
-**/
-bool X86Architecture::Table_3_38_57(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * mnemonic: pbroadcastd
- * prefix: 66
- * opcode: 58
- * attr: ['nv', 'w0']
- * operand: ['Vx', 'Uod']
- * cpu_model: >= X86_Arch_Avx2
-**/
-bool X86Architecture::Table_3_38_58(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_Avx2 && (rInsn.GetPrefix() & X86_Prefix_OpSize) == X86_Prefix_OpSize)
-    {
-      rInsn.Size()++;
-      rInsn.SetOpcode(X86_Opcode_Pbroadcastd);
-      if (Operand__Vx_Uod(rBinStrm, Offset, rInsn, Mode) == false)
-      {
-        return false;
-      }
-      return true;
-    }
-    else
-      return false;
-}
-
-/** instruction
- * mnemonic: pbroadcastq
- * prefix: 66
- * opcode: 59
- * attr: ['nv', 'w0']
- * operand: ['Vx', 'Woq']
- * cpu_model: >= X86_Arch_Avx2
-**/
-bool X86Architecture::Table_3_38_59(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_3_38_59(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_Avx2 && (rInsn.GetPrefix() & X86_Prefix_OpSize) == X86_Prefix_OpSize)
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Pbroadcastq);
-      if (Operand__Vx_Woq(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vx_Woq<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -3625,20 +3465,21 @@ bool X86Architecture::Table_3_38_59(BinaryStream const& rBinStrm, OffsetType Off
 }
 
 /** instruction
- * mnemonic: broadcasti128
- * prefix: 66
  * opcode: 5a
- * attr: ['nv', 'w0']
+ * mnemonic: broadcasti128
  * operand: ['Vy', 'Uo']
+ * attr: ['nv', 'w0']
+ * prefix: 66
  * cpu_model: >= X86_Arch_Avx2
 **/
-bool X86Architecture::Table_3_38_5a(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_3_38_5a(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_Avx2 && (rInsn.GetPrefix() & X86_Prefix_OpSize) == X86_Prefix_OpSize)
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Broadcasti128);
-      if (Operand__Vy_Uo(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vy_Uo<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -3649,382 +3490,70 @@ bool X86Architecture::Table_3_38_5a(BinaryStream const& rBinStrm, OffsetType Off
 }
 
 /** instruction
- * opcode: 5b
- * invalid
-**/
-bool X86Architecture::Table_3_38_5b(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: 5c
- * invalid
-**/
-bool X86Architecture::Table_3_38_5c(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: 5d
- * invalid
-**/
-bool X86Architecture::Table_3_38_5d(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: 5e
- * invalid
-**/
-bool X86Architecture::Table_3_38_5e(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: 5f
- * invalid
-**/
-bool X86Architecture::Table_3_38_5f(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: 60
- * invalid
-**/
-bool X86Architecture::Table_3_38_60(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: 61
- * invalid
-**/
-bool X86Architecture::Table_3_38_61(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: 62
- * invalid
-**/
-bool X86Architecture::Table_3_38_62(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: 63
- * invalid
-**/
-bool X86Architecture::Table_3_38_63(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: 64
- * invalid
-**/
-bool X86Architecture::Table_3_38_64(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: 65
- * invalid
-**/
-bool X86Architecture::Table_3_38_65(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: 66
- * invalid
-**/
-bool X86Architecture::Table_3_38_66(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: 67
- * invalid
-**/
-bool X86Architecture::Table_3_38_67(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: 68
- * invalid
-**/
-bool X86Architecture::Table_3_38_68(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: 69
- * invalid
-**/
-bool X86Architecture::Table_3_38_69(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: 6a
- * invalid
-**/
-bool X86Architecture::Table_3_38_6a(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: 6b
- * invalid
-**/
-bool X86Architecture::Table_3_38_6b(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: 6c
- * invalid
-**/
-bool X86Architecture::Table_3_38_6c(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: 6d
- * invalid
-**/
-bool X86Architecture::Table_3_38_6d(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: 6e
- * invalid
-**/
-bool X86Architecture::Table_3_38_6e(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: 6f
- * invalid
-**/
-bool X86Architecture::Table_3_38_6f(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: 70
- * invalid
-**/
-bool X86Architecture::Table_3_38_70(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: 71
- * invalid
-**/
-bool X86Architecture::Table_3_38_71(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: 72
- * invalid
-**/
-bool X86Architecture::Table_3_38_72(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: 73
- * invalid
-**/
-bool X86Architecture::Table_3_38_73(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: 74
- * invalid
-**/
-bool X86Architecture::Table_3_38_74(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: 75
- * invalid
-**/
-bool X86Architecture::Table_3_38_75(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: 76
- * invalid
-**/
-bool X86Architecture::Table_3_38_76(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: 77
- * invalid
-**/
-bool X86Architecture::Table_3_38_77(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * mnemonic: pbroadcastb
- * prefix: 66
  * opcode: 78
- * attr: ['nv']
+ * mnemonic: pbroadcastb
  * operand: ['Vx', 'Uo', 'b']
- * cpu_model: >= X86_Arch_Avx2
-**/
-bool X86Architecture::Table_3_38_78(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_Avx2 && (rInsn.GetPrefix() & X86_Prefix_OpSize) == X86_Prefix_OpSize)
-    {
-      rInsn.Size()++;
-      rInsn.SetOpcode(X86_Opcode_Pbroadcastb);
-      if (Operand__Vx_Uo_b(rBinStrm, Offset, rInsn, Mode) == false)
-      {
-        return false;
-      }
-      return true;
-    }
-    else
-      return false;
-}
-
-/** instruction
- * mnemonic: pbroadcastw
- * prefix: 66
- * opcode: 79
  * attr: ['nv']
- * operand: ['Vx', 'Uo', 'w']
+ * prefix: 66
  * cpu_model: >= X86_Arch_Avx2
 **/
-bool X86Architecture::Table_3_38_79(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_3_38_78(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_Avx2 && (rInsn.GetPrefix() & X86_Prefix_OpSize) == X86_Prefix_OpSize)
     {
       rInsn.Size()++;
-      rInsn.SetOpcode(X86_Opcode_Pbroadcastw);
-      if (Operand__Vx_Uo_w(rBinStrm, Offset, rInsn, Mode) == false)
+      rInsn.SetOpcode(X86_Opcode_Pbroadcastb);
+      if (Operand__Vx_Uo_b<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
       return true;
     }
-    else
-      return false;
-}
-
-/** instruction
- * opcode: 7a
- * invalid
-**/
-bool X86Architecture::Table_3_38_7a(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: 7b
- * invalid
-**/
-bool X86Architecture::Table_3_38_7b(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: 7c
- * invalid
-**/
-bool X86Architecture::Table_3_38_7c(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: 7d
- * invalid
-**/
-bool X86Architecture::Table_3_38_7d(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: 7e
- * invalid
-**/
-bool X86Architecture::Table_3_38_7e(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
+    else
+      return false;
 }
 
 /** instruction
- * opcode: 7f
- * invalid
+ * opcode: 79
+ * mnemonic: pbroadcastw
+ * operand: ['Vx', 'Uo', 'w']
+ * attr: ['nv']
+ * prefix: 66
+ * cpu_model: >= X86_Arch_Avx2
 **/
-bool X86Architecture::Table_3_38_7f(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_3_38_79(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
-    return false; /* INVALID */
+    if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_Avx2 && (rInsn.GetPrefix() & X86_Prefix_OpSize) == X86_Prefix_OpSize)
+    {
+      rInsn.Size()++;
+      rInsn.SetOpcode(X86_Opcode_Pbroadcastw);
+      if (Operand__Vx_Uo_w<Mode>(rBinStrm, Offset, rInsn) == false)
+      {
+        return false;
+      }
+      return true;
+    }
+    else
+      return false;
 }
 
 /** instruction
+ * opcode: 80
  * mnemonic: invept
  * operand: ['Gy', 'Uo']
  * prefix: 66
- * opcode: 80
  * cpu_model: >= X86_Arch_Vmx
 **/
-bool X86Architecture::Table_3_38_80(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_3_38_80(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_Vmx && (rInsn.GetPrefix() & X86_Prefix_OpSize) == X86_Prefix_OpSize)
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Invept);
-      if (Operand__Gy_Uo(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Gy_Uo<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -4035,19 +3564,20 @@ bool X86Architecture::Table_3_38_80(BinaryStream const& rBinStrm, OffsetType Off
 }
 
 /** instruction
+ * opcode: 81
  * mnemonic: invvpid
  * operand: ['Gy', 'Uo']
  * prefix: 66
- * opcode: 81
  * cpu_model: >= X86_Arch_Vmx
 **/
-bool X86Architecture::Table_3_38_81(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_3_38_81(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_Vmx && (rInsn.GetPrefix() & X86_Prefix_OpSize) == X86_Prefix_OpSize)
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Invvpid);
-      if (Operand__Gy_Uo(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Gy_Uo<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -4058,19 +3588,20 @@ bool X86Architecture::Table_3_38_81(BinaryStream const& rBinStrm, OffsetType Off
 }
 
 /** instruction
+ * opcode: 82
  * mnemonic: invpcid
  * operand: ['Gy', 'Uo']
  * prefix: 66
- * opcode: 82
  * cpu_model: >= X86_Arch_Invpcid
 **/
-bool X86Architecture::Table_3_38_82(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_3_38_82(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_Invpcid && (rInsn.GetPrefix() & X86_Prefix_OpSize) == X86_Prefix_OpSize)
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Invpcid);
-      if (Operand__Gy_Uo(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Gy_Uo<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -4080,110 +3611,30 @@ bool X86Architecture::Table_3_38_82(BinaryStream const& rBinStrm, OffsetType Off
       return false;
 }
 
-/** instruction
- * opcode: 83
- * invalid
-**/
-bool X86Architecture::Table_3_38_83(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: 84
- * invalid
-**/
-bool X86Architecture::Table_3_38_84(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: 85
- * invalid
-**/
-bool X86Architecture::Table_3_38_85(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: 86
- * invalid
-**/
-bool X86Architecture::Table_3_38_86(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: 87
- * invalid
-**/
-bool X86Architecture::Table_3_38_87(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: 88
- * invalid
-**/
-bool X86Architecture::Table_3_38_88(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: 89
- * invalid
-**/
-bool X86Architecture::Table_3_38_89(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: 8a
- * invalid
-**/
-bool X86Architecture::Table_3_38_8a(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: 8b
- * invalid
-**/
-bool X86Architecture::Table_3_38_8b(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
 /** instructions
  * opcode: 8c
  *
  * mnemonic: pmaskmovd
  * operand: ['Vx', 'Mx']
- * prefix: 66
  * attr: ['w0']
+ * prefix: 66
  * cpu_model: >= X86_Arch_Avx2
  *
  * mnemonic: pmaskmovq
  * operand: ['Vx', 'Mx']
- * prefix: 66
  * attr: ['w1']
+ * prefix: 66
  * cpu_model: >= X86_Arch_Avx2
  *
 **/
-bool X86Architecture::Table_3_38_8c(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_3_38_8c(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_Avx2 && (rInsn.GetPrefix() & X86_Prefix_OpSize) == X86_Prefix_OpSize)
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Pmaskmovq);
-      if (Operand__Vx_Mx(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vx_Mx<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -4193,7 +3644,7 @@ bool X86Architecture::Table_3_38_8c(BinaryStream const& rBinStrm, OffsetType Off
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Pmaskmovd);
-      if (Operand__Vx_Mx(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vx_Mx<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -4202,38 +3653,30 @@ bool X86Architecture::Table_3_38_8c(BinaryStream const& rBinStrm, OffsetType Off
     return false;
 }
 
-/** instruction
- * opcode: 8d
- * invalid
-**/
-bool X86Architecture::Table_3_38_8d(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
 /** instructions
  * opcode: 8e
  *
  * mnemonic: pmaskmovd
  * operand: ['Mx', 'Vx']
- * prefix: 66
  * attr: ['w0']
+ * prefix: 66
  * cpu_model: >= X86_Arch_Avx2
  *
  * mnemonic: pmaskmovq
  * operand: ['Mx', 'Vx']
- * prefix: 66
  * attr: ['w1']
+ * prefix: 66
  * cpu_model: >= X86_Arch_Avx2
  *
 **/
-bool X86Architecture::Table_3_38_8e(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_3_38_8e(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_Avx2 && (rInsn.GetPrefix() & X86_Prefix_OpSize) == X86_Prefix_OpSize)
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Pmaskmovq);
-      if (Operand__Mx_Vx(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Mx_Vx<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -4243,7 +3686,7 @@ bool X86Architecture::Table_3_38_8e(BinaryStream const& rBinStrm, OffsetType Off
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Pmaskmovd);
-      if (Operand__Mx_Vx(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Mx_Vx<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -4252,38 +3695,30 @@ bool X86Architecture::Table_3_38_8e(BinaryStream const& rBinStrm, OffsetType Off
     return false;
 }
 
-/** instruction
- * opcode: 8f
- * invalid
-**/
-bool X86Architecture::Table_3_38_8f(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
 /** instructions
  * opcode: 90
  *
  * mnemonic: pgatherdd
  * operand: ['Vx', 'Md', 'x', 'Hx']
- * prefix: 66
  * attr: ['w0']
+ * prefix: 66
  * cpu_model: >= X86_Arch_Avx2
  *
  * mnemonic: pgatherdq
  * operand: ['Vx', 'Mqo', 'Hx']
- * prefix: 66
  * attr: ['w1']
+ * prefix: 66
  * cpu_model: >= X86_Arch_Avx2
  *
 **/
-bool X86Architecture::Table_3_38_90(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_3_38_90(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_Avx2 && (rInsn.GetPrefix() & X86_Prefix_OpSize) == X86_Prefix_OpSize)
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Pgatherdq);
-      if (Operand__Vx_Mqo_Hx(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vx_Mqo_Hx<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -4293,7 +3728,7 @@ bool X86Architecture::Table_3_38_90(BinaryStream const& rBinStrm, OffsetType Off
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Pgatherdd);
-      if (Operand__Vx_Md_x_Hx(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vx_Md_x_Hx<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -4307,24 +3742,25 @@ bool X86Architecture::Table_3_38_90(BinaryStream const& rBinStrm, OffsetType Off
  *
  * mnemonic: pgatherqd
  * operand: ['Vo', 'Md', 'x', 'Ho']
- * prefix: 66
  * attr: ['w0']
+ * prefix: 66
  * cpu_model: >= X86_Arch_Avx2
  *
  * mnemonic: pgatherqq
  * operand: ['Vx', 'Mq', 'x', 'Hx']
- * prefix: 66
  * attr: ['w1']
+ * prefix: 66
  * cpu_model: >= X86_Arch_Avx2
  *
 **/
-bool X86Architecture::Table_3_38_91(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_3_38_91(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_Avx2 && (rInsn.GetPrefix() & X86_Prefix_OpSize) == X86_Prefix_OpSize)
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Pgatherqq);
-      if (Operand__Vx_Mq_x_Hx(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vx_Mq_x_Hx<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -4334,7 +3770,7 @@ bool X86Architecture::Table_3_38_91(BinaryStream const& rBinStrm, OffsetType Off
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Pgatherqd);
-      if (Operand__Vo_Md_x_Ho(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vo_Md_x_Ho<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -4348,24 +3784,25 @@ bool X86Architecture::Table_3_38_91(BinaryStream const& rBinStrm, OffsetType Off
  *
  * mnemonic: pgatherdps
  * operand: ['Vx', 'Md', 'x', 'Hx']
- * prefix: 66
  * attr: ['w0']
+ * prefix: 66
  * cpu_model: >= X86_Arch_Avx2
  *
  * mnemonic: pgatherdpd
  * operand: ['Vx', 'Mqo', 'Hx']
- * prefix: 66
  * attr: ['w1']
+ * prefix: 66
  * cpu_model: >= X86_Arch_Avx2
  *
 **/
-bool X86Architecture::Table_3_38_92(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_3_38_92(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_Avx2 && (rInsn.GetPrefix() & X86_Prefix_OpSize) == X86_Prefix_OpSize)
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Pgatherdpd);
-      if (Operand__Vx_Mqo_Hx(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vx_Mqo_Hx<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -4375,7 +3812,7 @@ bool X86Architecture::Table_3_38_92(BinaryStream const& rBinStrm, OffsetType Off
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Pgatherdps);
-      if (Operand__Vx_Md_x_Hx(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vx_Md_x_Hx<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -4389,24 +3826,25 @@ bool X86Architecture::Table_3_38_92(BinaryStream const& rBinStrm, OffsetType Off
  *
  * mnemonic: pgatherqps
  * operand: ['Vo', 'Md', 'x', 'Ho']
- * prefix: 66
  * attr: ['w0']
+ * prefix: 66
  * cpu_model: >= X86_Arch_Avx2
  *
  * mnemonic: pgatherqpd
  * operand: ['Vx', 'Mq', 'x', 'Hx']
- * prefix: 66
  * attr: ['w1']
+ * prefix: 66
  * cpu_model: >= X86_Arch_Avx2
  *
 **/
-bool X86Architecture::Table_3_38_93(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_3_38_93(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_Avx2 && (rInsn.GetPrefix() & X86_Prefix_OpSize) == X86_Prefix_OpSize)
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Pgatherqpd);
-      if (Operand__Vx_Mq_x_Hx(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vx_Mq_x_Hx<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -4416,7 +3854,7 @@ bool X86Architecture::Table_3_38_93(BinaryStream const& rBinStrm, OffsetType Off
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Pgatherqps);
-      if (Operand__Vo_Md_x_Ho(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vo_Md_x_Ho<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -4425,47 +3863,30 @@ bool X86Architecture::Table_3_38_93(BinaryStream const& rBinStrm, OffsetType Off
     return false;
 }
 
-/** instruction
- * opcode: 94
- * invalid
-**/
-bool X86Architecture::Table_3_38_94(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: 95
- * invalid
-**/
-bool X86Architecture::Table_3_38_95(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
 /** instructions
  * opcode: 96
  *
  * mnemonic: fmaddsub132ps
  * operand: ['Vx', 'Wx']
- * prefix: 66
  * attr: ['w0']
+ * prefix: 66
  * cpu_model: >= X86_Arch_Fma
  *
  * mnemonic: fmaddsub132pd
  * operand: ['Vx', 'Wx']
- * prefix: 66
  * attr: ['w1']
+ * prefix: 66
  * cpu_model: >= X86_Arch_Fma
  *
 **/
-bool X86Architecture::Table_3_38_96(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_3_38_96(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_Fma && (rInsn.GetPrefix() & X86_Prefix_OpSize) == X86_Prefix_OpSize)
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Fmaddsub132pd);
-      if (Operand__Vx_Wx(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vx_Wx<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -4475,7 +3896,7 @@ bool X86Architecture::Table_3_38_96(BinaryStream const& rBinStrm, OffsetType Off
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Fmaddsub132ps);
-      if (Operand__Vx_Wx(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vx_Wx<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -4489,24 +3910,25 @@ bool X86Architecture::Table_3_38_96(BinaryStream const& rBinStrm, OffsetType Off
  *
  * mnemonic: fmsubadd132ps
  * operand: ['Vx', 'Wx']
- * prefix: 66
  * attr: ['w0']
+ * prefix: 66
  * cpu_model: >= X86_Arch_Fma
  *
  * mnemonic: fmsubadd132pd
  * operand: ['Vx', 'Wx']
- * prefix: 66
  * attr: ['w1']
+ * prefix: 66
  * cpu_model: >= X86_Arch_Fma
  *
 **/
-bool X86Architecture::Table_3_38_97(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_3_38_97(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_Fma && (rInsn.GetPrefix() & X86_Prefix_OpSize) == X86_Prefix_OpSize)
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Fmsubadd132pd);
-      if (Operand__Vx_Wx(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vx_Wx<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -4516,7 +3938,7 @@ bool X86Architecture::Table_3_38_97(BinaryStream const& rBinStrm, OffsetType Off
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Fmsubadd132ps);
-      if (Operand__Vx_Wx(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vx_Wx<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -4530,24 +3952,25 @@ bool X86Architecture::Table_3_38_97(BinaryStream const& rBinStrm, OffsetType Off
  *
  * mnemonic: fmadd132ps
  * operand: ['Vx', 'Wx']
- * prefix: 66
  * attr: ['w0']
+ * prefix: 66
  * cpu_model: >= X86_Arch_Fma
  *
  * mnemonic: fmadd132pd
  * operand: ['Vx', 'Wx']
- * prefix: 66
  * attr: ['w1']
+ * prefix: 66
  * cpu_model: >= X86_Arch_Fma
  *
 **/
-bool X86Architecture::Table_3_38_98(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_3_38_98(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_Fma && (rInsn.GetPrefix() & X86_Prefix_OpSize) == X86_Prefix_OpSize)
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Fmadd132pd);
-      if (Operand__Vx_Wx(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vx_Wx<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -4557,7 +3980,7 @@ bool X86Architecture::Table_3_38_98(BinaryStream const& rBinStrm, OffsetType Off
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Fmadd132ps);
-      if (Operand__Vx_Wx(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vx_Wx<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -4571,24 +3994,25 @@ bool X86Architecture::Table_3_38_98(BinaryStream const& rBinStrm, OffsetType Off
  *
  * mnemonic: fmadd132ss
  * operand: ['Vo', 'Ho', 'Wd']
- * prefix: 66
  * attr: ['w0']
+ * prefix: 66
  * cpu_model: >= X86_Arch_Fma
  *
  * mnemonic: fmadd132sd
  * operand: ['Vo', 'Ho', 'Wq']
- * prefix: 66
  * attr: ['w1']
+ * prefix: 66
  * cpu_model: >= X86_Arch_Fma
  *
 **/
-bool X86Architecture::Table_3_38_99(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_3_38_99(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_Fma && (rInsn.GetPrefix() & X86_Prefix_OpSize) == X86_Prefix_OpSize)
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Fmadd132sd);
-      if (Operand__Vo_Ho_Wq(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vo_Ho_Wq<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -4598,7 +4022,7 @@ bool X86Architecture::Table_3_38_99(BinaryStream const& rBinStrm, OffsetType Off
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Fmadd132ss);
-      if (Operand__Vo_Ho_Wd(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vo_Ho_Wd<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -4612,24 +4036,25 @@ bool X86Architecture::Table_3_38_99(BinaryStream const& rBinStrm, OffsetType Off
  *
  * mnemonic: fmsub132ps
  * operand: ['Vx', 'Wx']
- * prefix: 66
  * attr: ['w0']
+ * prefix: 66
  * cpu_model: >= X86_Arch_Fma
  *
  * mnemonic: fmsub132pd
  * operand: ['Vx', 'Wx']
- * prefix: 66
  * attr: ['w1']
+ * prefix: 66
  * cpu_model: >= X86_Arch_Fma
  *
 **/
-bool X86Architecture::Table_3_38_9a(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_3_38_9a(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_Fma && (rInsn.GetPrefix() & X86_Prefix_OpSize) == X86_Prefix_OpSize)
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Fmsub132pd);
-      if (Operand__Vx_Wx(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vx_Wx<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -4639,7 +4064,7 @@ bool X86Architecture::Table_3_38_9a(BinaryStream const& rBinStrm, OffsetType Off
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Fmsub132ps);
-      if (Operand__Vx_Wx(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vx_Wx<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -4653,24 +4078,25 @@ bool X86Architecture::Table_3_38_9a(BinaryStream const& rBinStrm, OffsetType Off
  *
  * mnemonic: fmsub132ss
  * operand: ['Vo', 'Ho', 'Wd']
- * prefix: 66
  * attr: ['w0']
+ * prefix: 66
  * cpu_model: >= X86_Arch_Fma
  *
  * mnemonic: fmsub132sd
  * operand: ['Vo', 'Ho', 'Wq']
- * prefix: 66
  * attr: ['w1']
+ * prefix: 66
  * cpu_model: >= X86_Arch_Fma
  *
 **/
-bool X86Architecture::Table_3_38_9b(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_3_38_9b(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_Fma && (rInsn.GetPrefix() & X86_Prefix_OpSize) == X86_Prefix_OpSize)
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Fmsub132sd);
-      if (Operand__Vo_Ho_Wq(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vo_Ho_Wq<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -4680,7 +4106,7 @@ bool X86Architecture::Table_3_38_9b(BinaryStream const& rBinStrm, OffsetType Off
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Fmsub132ss);
-      if (Operand__Vo_Ho_Wd(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vo_Ho_Wd<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -4694,24 +4120,25 @@ bool X86Architecture::Table_3_38_9b(BinaryStream const& rBinStrm, OffsetType Off
  *
  * mnemonic: fnmadd132ps
  * operand: ['Vx', 'Wx']
- * prefix: 66
  * attr: ['w0']
+ * prefix: 66
  * cpu_model: >= X86_Arch_Fma
  *
  * mnemonic: fnmadd132pd
  * operand: ['Vx', 'Wx']
- * prefix: 66
  * attr: ['w1']
+ * prefix: 66
  * cpu_model: >= X86_Arch_Fma
  *
 **/
-bool X86Architecture::Table_3_38_9c(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_3_38_9c(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_Fma && (rInsn.GetPrefix() & X86_Prefix_OpSize) == X86_Prefix_OpSize)
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Fnmadd132pd);
-      if (Operand__Vx_Wx(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vx_Wx<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -4721,7 +4148,7 @@ bool X86Architecture::Table_3_38_9c(BinaryStream const& rBinStrm, OffsetType Off
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Fnmadd132ps);
-      if (Operand__Vx_Wx(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vx_Wx<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -4735,24 +4162,25 @@ bool X86Architecture::Table_3_38_9c(BinaryStream const& rBinStrm, OffsetType Off
  *
  * mnemonic: fnmadd132ss
  * operand: ['Vo', 'Ho', 'Wd']
- * prefix: 66
  * attr: ['w0']
+ * prefix: 66
  * cpu_model: >= X86_Arch_Fma
  *
  * mnemonic: fnmadd132sd
  * operand: ['Vo', 'Ho', 'Wq']
- * prefix: 66
  * attr: ['w1']
+ * prefix: 66
  * cpu_model: >= X86_Arch_Fma
  *
 **/
-bool X86Architecture::Table_3_38_9d(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_3_38_9d(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_Fma && (rInsn.GetPrefix() & X86_Prefix_OpSize) == X86_Prefix_OpSize)
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Fnmadd132sd);
-      if (Operand__Vo_Ho_Wq(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vo_Ho_Wq<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -4762,7 +4190,7 @@ bool X86Architecture::Table_3_38_9d(BinaryStream const& rBinStrm, OffsetType Off
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Fnmadd132ss);
-      if (Operand__Vo_Ho_Wd(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vo_Ho_Wd<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -4776,24 +4204,25 @@ bool X86Architecture::Table_3_38_9d(BinaryStream const& rBinStrm, OffsetType Off
  *
  * mnemonic: fnmsub132ps
  * operand: ['Vx', 'Wx']
- * prefix: 66
  * attr: ['w0']
+ * prefix: 66
  * cpu_model: >= X86_Arch_Fma
  *
  * mnemonic: fnmsub132pd
  * operand: ['Vx', 'Wx']
- * prefix: 66
  * attr: ['w1']
+ * prefix: 66
  * cpu_model: >= X86_Arch_Fma
  *
 **/
-bool X86Architecture::Table_3_38_9e(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_3_38_9e(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_Fma && (rInsn.GetPrefix() & X86_Prefix_OpSize) == X86_Prefix_OpSize)
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Fnmsub132pd);
-      if (Operand__Vx_Wx(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vx_Wx<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -4803,7 +4232,7 @@ bool X86Architecture::Table_3_38_9e(BinaryStream const& rBinStrm, OffsetType Off
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Fnmsub132ps);
-      if (Operand__Vx_Wx(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vx_Wx<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -4817,24 +4246,25 @@ bool X86Architecture::Table_3_38_9e(BinaryStream const& rBinStrm, OffsetType Off
  *
  * mnemonic: fnmsub132ss
  * operand: ['Vo', 'Ho', 'Wd']
- * prefix: 66
  * attr: ['w0']
+ * prefix: 66
  * cpu_model: >= X86_Arch_Fma
  *
  * mnemonic: fnmsub132sd
  * operand: ['Vo', 'Ho', 'Wq']
- * prefix: 66
  * attr: ['w1']
+ * prefix: 66
  * cpu_model: >= X86_Arch_Fma
  *
 **/
-bool X86Architecture::Table_3_38_9f(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_3_38_9f(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_Fma && (rInsn.GetPrefix() & X86_Prefix_OpSize) == X86_Prefix_OpSize)
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Fnmsub132sd);
-      if (Operand__Vo_Ho_Wq(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vo_Ho_Wq<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -4844,7 +4274,7 @@ bool X86Architecture::Table_3_38_9f(BinaryStream const& rBinStrm, OffsetType Off
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Fnmsub132ss);
-      if (Operand__Vo_Ho_Wd(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vo_Ho_Wd<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -4853,83 +4283,30 @@ bool X86Architecture::Table_3_38_9f(BinaryStream const& rBinStrm, OffsetType Off
     return false;
 }
 
-/** instruction
- * opcode: a0
- * invalid
-**/
-bool X86Architecture::Table_3_38_a0(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: a1
- * invalid
-**/
-bool X86Architecture::Table_3_38_a1(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: a2
- * invalid
-**/
-bool X86Architecture::Table_3_38_a2(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: a3
- * invalid
-**/
-bool X86Architecture::Table_3_38_a3(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: a4
- * invalid
-**/
-bool X86Architecture::Table_3_38_a4(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: a5
- * invalid
-**/
-bool X86Architecture::Table_3_38_a5(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
 /** instructions
  * opcode: a6
  *
  * mnemonic: fmaddsub213ps
  * operand: ['Vx', 'Wx']
- * prefix: 66
  * attr: ['w0']
+ * prefix: 66
  * cpu_model: >= X86_Arch_Fma
  *
  * mnemonic: fmaddsub213pd
  * operand: ['Vx', 'Wx']
- * prefix: 66
  * attr: ['w1']
+ * prefix: 66
  * cpu_model: >= X86_Arch_Fma
  *
 **/
-bool X86Architecture::Table_3_38_a6(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_3_38_a6(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_Fma && (rInsn.GetPrefix() & X86_Prefix_OpSize) == X86_Prefix_OpSize)
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Fmaddsub213pd);
-      if (Operand__Vx_Wx(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vx_Wx<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -4939,7 +4316,7 @@ bool X86Architecture::Table_3_38_a6(BinaryStream const& rBinStrm, OffsetType Off
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Fmaddsub213ps);
-      if (Operand__Vx_Wx(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vx_Wx<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -4953,24 +4330,25 @@ bool X86Architecture::Table_3_38_a6(BinaryStream const& rBinStrm, OffsetType Off
  *
  * mnemonic: fmsubadd213ps
  * operand: ['Vx', 'Wx']
- * prefix: 66
  * attr: ['w0']
+ * prefix: 66
  * cpu_model: >= X86_Arch_Fma
  *
  * mnemonic: fmsubadd213pd
  * operand: ['Vx', 'Wx']
- * prefix: 66
  * attr: ['w1']
+ * prefix: 66
  * cpu_model: >= X86_Arch_Fma
  *
 **/
-bool X86Architecture::Table_3_38_a7(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_3_38_a7(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_Fma && (rInsn.GetPrefix() & X86_Prefix_OpSize) == X86_Prefix_OpSize)
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Fmsubadd213pd);
-      if (Operand__Vx_Wx(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vx_Wx<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -4980,7 +4358,7 @@ bool X86Architecture::Table_3_38_a7(BinaryStream const& rBinStrm, OffsetType Off
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Fmsubadd213ps);
-      if (Operand__Vx_Wx(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vx_Wx<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -4994,24 +4372,25 @@ bool X86Architecture::Table_3_38_a7(BinaryStream const& rBinStrm, OffsetType Off
  *
  * mnemonic: fmadd213ps
  * operand: ['Vx', 'Wx']
- * prefix: 66
  * attr: ['w0']
+ * prefix: 66
  * cpu_model: >= X86_Arch_Fma
  *
  * mnemonic: fmadd213pd
  * operand: ['Vx', 'Wx']
- * prefix: 66
  * attr: ['w1']
+ * prefix: 66
  * cpu_model: >= X86_Arch_Fma
  *
 **/
-bool X86Architecture::Table_3_38_a8(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_3_38_a8(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_Fma && (rInsn.GetPrefix() & X86_Prefix_OpSize) == X86_Prefix_OpSize)
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Fmadd213pd);
-      if (Operand__Vx_Wx(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vx_Wx<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -5021,7 +4400,7 @@ bool X86Architecture::Table_3_38_a8(BinaryStream const& rBinStrm, OffsetType Off
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Fmadd213ps);
-      if (Operand__Vx_Wx(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vx_Wx<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -5035,24 +4414,25 @@ bool X86Architecture::Table_3_38_a8(BinaryStream const& rBinStrm, OffsetType Off
  *
  * mnemonic: fmadd213ss
  * operand: ['Vo', 'Ho', 'Wd']
- * prefix: 66
  * attr: ['w0']
+ * prefix: 66
  * cpu_model: >= X86_Arch_Fma
  *
  * mnemonic: fmadd213sd
  * operand: ['Vo', 'Ho', 'Wq']
- * prefix: 66
  * attr: ['w1']
+ * prefix: 66
  * cpu_model: >= X86_Arch_Fma
  *
 **/
-bool X86Architecture::Table_3_38_a9(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_3_38_a9(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_Fma && (rInsn.GetPrefix() & X86_Prefix_OpSize) == X86_Prefix_OpSize)
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Fmadd213sd);
-      if (Operand__Vo_Ho_Wq(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vo_Ho_Wq<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -5062,7 +4442,7 @@ bool X86Architecture::Table_3_38_a9(BinaryStream const& rBinStrm, OffsetType Off
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Fmadd213ss);
-      if (Operand__Vo_Ho_Wd(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vo_Ho_Wd<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -5076,24 +4456,25 @@ bool X86Architecture::Table_3_38_a9(BinaryStream const& rBinStrm, OffsetType Off
  *
  * mnemonic: fmsub213ps
  * operand: ['Vx', 'Wx']
- * prefix: 66
  * attr: ['w0']
+ * prefix: 66
  * cpu_model: >= X86_Arch_Fma
  *
  * mnemonic: fmsub213pd
  * operand: ['Vx', 'Wx']
- * prefix: 66
  * attr: ['w1']
+ * prefix: 66
  * cpu_model: >= X86_Arch_Fma
  *
 **/
-bool X86Architecture::Table_3_38_aa(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_3_38_aa(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_Fma && (rInsn.GetPrefix() & X86_Prefix_OpSize) == X86_Prefix_OpSize)
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Fmsub213pd);
-      if (Operand__Vx_Wx(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vx_Wx<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -5103,7 +4484,7 @@ bool X86Architecture::Table_3_38_aa(BinaryStream const& rBinStrm, OffsetType Off
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Fmsub213ps);
-      if (Operand__Vx_Wx(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vx_Wx<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -5117,24 +4498,25 @@ bool X86Architecture::Table_3_38_aa(BinaryStream const& rBinStrm, OffsetType Off
  *
  * mnemonic: fmsub213ss
  * operand: ['Vo', 'Ho', 'Wd']
- * prefix: 66
  * attr: ['w0']
+ * prefix: 66
  * cpu_model: >= X86_Arch_Fma
  *
  * mnemonic: fmsub213sd
  * operand: ['Vo', 'Ho', 'Wq']
- * prefix: 66
  * attr: ['w1']
+ * prefix: 66
  * cpu_model: >= X86_Arch_Fma
  *
 **/
-bool X86Architecture::Table_3_38_ab(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_3_38_ab(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_Fma && (rInsn.GetPrefix() & X86_Prefix_OpSize) == X86_Prefix_OpSize)
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Fmsub213sd);
-      if (Operand__Vo_Ho_Wq(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vo_Ho_Wq<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -5144,7 +4526,7 @@ bool X86Architecture::Table_3_38_ab(BinaryStream const& rBinStrm, OffsetType Off
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Fmsub213ss);
-      if (Operand__Vo_Ho_Wd(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vo_Ho_Wd<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -5158,24 +4540,25 @@ bool X86Architecture::Table_3_38_ab(BinaryStream const& rBinStrm, OffsetType Off
  *
  * mnemonic: fnmadd213ps
  * operand: ['Vx', 'Wx']
- * prefix: 66
  * attr: ['w0']
+ * prefix: 66
  * cpu_model: >= X86_Arch_Fma
  *
  * mnemonic: fnmadd213pd
  * operand: ['Vx', 'Wx']
- * prefix: 66
  * attr: ['w1']
+ * prefix: 66
  * cpu_model: >= X86_Arch_Fma
  *
 **/
-bool X86Architecture::Table_3_38_ac(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_3_38_ac(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_Fma && (rInsn.GetPrefix() & X86_Prefix_OpSize) == X86_Prefix_OpSize)
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Fnmadd213pd);
-      if (Operand__Vx_Wx(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vx_Wx<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -5185,7 +4568,7 @@ bool X86Architecture::Table_3_38_ac(BinaryStream const& rBinStrm, OffsetType Off
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Fnmadd213ps);
-      if (Operand__Vx_Wx(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vx_Wx<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -5199,24 +4582,25 @@ bool X86Architecture::Table_3_38_ac(BinaryStream const& rBinStrm, OffsetType Off
  *
  * mnemonic: fnmadd213ss
  * operand: ['Vo', 'Ho', 'Wd']
- * prefix: 66
  * attr: ['w0']
+ * prefix: 66
  * cpu_model: >= X86_Arch_Fma
  *
  * mnemonic: fnmadd213sd
  * operand: ['Vo', 'Ho', 'Wq']
- * prefix: 66
  * attr: ['w1']
+ * prefix: 66
  * cpu_model: >= X86_Arch_Fma
  *
 **/
-bool X86Architecture::Table_3_38_ad(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_3_38_ad(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_Fma && (rInsn.GetPrefix() & X86_Prefix_OpSize) == X86_Prefix_OpSize)
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Fnmadd213sd);
-      if (Operand__Vo_Ho_Wq(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vo_Ho_Wq<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -5226,7 +4610,7 @@ bool X86Architecture::Table_3_38_ad(BinaryStream const& rBinStrm, OffsetType Off
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Fnmadd213ss);
-      if (Operand__Vo_Ho_Wd(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vo_Ho_Wd<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -5240,24 +4624,25 @@ bool X86Architecture::Table_3_38_ad(BinaryStream const& rBinStrm, OffsetType Off
  *
  * mnemonic: fnmsub213ps
  * operand: ['Vx', 'Wx']
- * prefix: 66
  * attr: ['w0']
+ * prefix: 66
  * cpu_model: >= X86_Arch_Fma
  *
  * mnemonic: fnmsub213pd
  * operand: ['Vx', 'Wx']
- * prefix: 66
  * attr: ['w1']
+ * prefix: 66
  * cpu_model: >= X86_Arch_Fma
  *
 **/
-bool X86Architecture::Table_3_38_ae(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_3_38_ae(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_Fma && (rInsn.GetPrefix() & X86_Prefix_OpSize) == X86_Prefix_OpSize)
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Fnmsub213pd);
-      if (Operand__Vx_Wx(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vx_Wx<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -5267,7 +4652,7 @@ bool X86Architecture::Table_3_38_ae(BinaryStream const& rBinStrm, OffsetType Off
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Fnmsub213ps);
-      if (Operand__Vx_Wx(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vx_Wx<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -5281,24 +4666,25 @@ bool X86Architecture::Table_3_38_ae(BinaryStream const& rBinStrm, OffsetType Off
  *
  * mnemonic: fnmsub213ss
  * operand: ['Vo', 'Ho', 'Wd']
- * prefix: 66
  * attr: ['w0']
+ * prefix: 66
  * cpu_model: >= X86_Arch_Fma
  *
  * mnemonic: fnmsub213sd
  * operand: ['Vo', 'Ho', 'Wq']
- * prefix: 66
  * attr: ['w1']
+ * prefix: 66
  * cpu_model: >= X86_Arch_Fma
  *
 **/
-bool X86Architecture::Table_3_38_af(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_3_38_af(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_Fma && (rInsn.GetPrefix() & X86_Prefix_OpSize) == X86_Prefix_OpSize)
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Fnmsub213sd);
-      if (Operand__Vo_Ho_Wq(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vo_Ho_Wq<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -5308,7 +4694,7 @@ bool X86Architecture::Table_3_38_af(BinaryStream const& rBinStrm, OffsetType Off
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Fnmsub213ss);
-      if (Operand__Vo_Ho_Wd(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vo_Ho_Wd<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -5317,83 +4703,30 @@ bool X86Architecture::Table_3_38_af(BinaryStream const& rBinStrm, OffsetType Off
     return false;
 }
 
-/** instruction
- * opcode: b0
- * invalid
-**/
-bool X86Architecture::Table_3_38_b0(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: b1
- * invalid
-**/
-bool X86Architecture::Table_3_38_b1(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: b2
- * invalid
-**/
-bool X86Architecture::Table_3_38_b2(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: b3
- * invalid
-**/
-bool X86Architecture::Table_3_38_b3(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: b4
- * invalid
-**/
-bool X86Architecture::Table_3_38_b4(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: b5
- * invalid
-**/
-bool X86Architecture::Table_3_38_b5(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
 /** instructions
  * opcode: b6
  *
  * mnemonic: fmaddsub231ps
  * operand: ['Vx', 'Wx']
- * prefix: 66
  * attr: ['w0']
+ * prefix: 66
  * cpu_model: >= X86_Arch_Fma
  *
  * mnemonic: fmaddsub231pd
  * operand: ['Vx', 'Wx']
- * prefix: 66
  * attr: ['w1']
+ * prefix: 66
  * cpu_model: >= X86_Arch_Fma
  *
 **/
-bool X86Architecture::Table_3_38_b6(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_3_38_b6(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_Fma && (rInsn.GetPrefix() & X86_Prefix_OpSize) == X86_Prefix_OpSize)
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Fmaddsub231pd);
-      if (Operand__Vx_Wx(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vx_Wx<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -5403,7 +4736,7 @@ bool X86Architecture::Table_3_38_b6(BinaryStream const& rBinStrm, OffsetType Off
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Fmaddsub231ps);
-      if (Operand__Vx_Wx(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vx_Wx<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -5417,24 +4750,25 @@ bool X86Architecture::Table_3_38_b6(BinaryStream const& rBinStrm, OffsetType Off
  *
  * mnemonic: fmsubadd231ps
  * operand: ['Vx', 'Wx']
- * prefix: 66
  * attr: ['w0']
+ * prefix: 66
  * cpu_model: >= X86_Arch_Fma
  *
  * mnemonic: fmsubadd231pd
  * operand: ['Vx', 'Wx']
- * prefix: 66
  * attr: ['w1']
+ * prefix: 66
  * cpu_model: >= X86_Arch_Fma
  *
 **/
-bool X86Architecture::Table_3_38_b7(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_3_38_b7(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_Fma && (rInsn.GetPrefix() & X86_Prefix_OpSize) == X86_Prefix_OpSize)
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Fmsubadd231pd);
-      if (Operand__Vx_Wx(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vx_Wx<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -5444,7 +4778,7 @@ bool X86Architecture::Table_3_38_b7(BinaryStream const& rBinStrm, OffsetType Off
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Fmsubadd231ps);
-      if (Operand__Vx_Wx(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vx_Wx<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -5458,24 +4792,25 @@ bool X86Architecture::Table_3_38_b7(BinaryStream const& rBinStrm, OffsetType Off
  *
  * mnemonic: fmadd231ps
  * operand: ['Vx', 'Wx']
- * prefix: 66
  * attr: ['w0']
+ * prefix: 66
  * cpu_model: >= X86_Arch_Fma
  *
  * mnemonic: fmadd231pd
  * operand: ['Vx', 'Wx']
- * prefix: 66
  * attr: ['w1']
+ * prefix: 66
  * cpu_model: >= X86_Arch_Fma
  *
 **/
-bool X86Architecture::Table_3_38_b8(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_3_38_b8(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_Fma && (rInsn.GetPrefix() & X86_Prefix_OpSize) == X86_Prefix_OpSize)
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Fmadd231pd);
-      if (Operand__Vx_Wx(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vx_Wx<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -5485,7 +4820,7 @@ bool X86Architecture::Table_3_38_b8(BinaryStream const& rBinStrm, OffsetType Off
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Fmadd231ps);
-      if (Operand__Vx_Wx(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vx_Wx<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -5499,24 +4834,25 @@ bool X86Architecture::Table_3_38_b8(BinaryStream const& rBinStrm, OffsetType Off
  *
  * mnemonic: fmadd231ss
  * operand: ['Vo', 'Ho', 'Wd']
- * prefix: 66
  * attr: ['w0']
+ * prefix: 66
  * cpu_model: >= X86_Arch_Fma
  *
  * mnemonic: fmadd231sd
  * operand: ['Vo', 'Ho', 'Wq']
- * prefix: 66
  * attr: ['w1']
+ * prefix: 66
  * cpu_model: >= X86_Arch_Fma
  *
 **/
-bool X86Architecture::Table_3_38_b9(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_3_38_b9(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_Fma && (rInsn.GetPrefix() & X86_Prefix_OpSize) == X86_Prefix_OpSize)
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Fmadd231sd);
-      if (Operand__Vo_Ho_Wq(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vo_Ho_Wq<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -5526,7 +4862,7 @@ bool X86Architecture::Table_3_38_b9(BinaryStream const& rBinStrm, OffsetType Off
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Fmadd231ss);
-      if (Operand__Vo_Ho_Wd(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vo_Ho_Wd<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -5540,24 +4876,25 @@ bool X86Architecture::Table_3_38_b9(BinaryStream const& rBinStrm, OffsetType Off
  *
  * mnemonic: fmsub231ps
  * operand: ['Vx', 'Wx']
- * prefix: 66
  * attr: ['w0']
+ * prefix: 66
  * cpu_model: >= X86_Arch_Fma
  *
  * mnemonic: fmsub231pd
  * operand: ['Vx', 'Wx']
- * prefix: 66
  * attr: ['w1']
+ * prefix: 66
  * cpu_model: >= X86_Arch_Fma
  *
 **/
-bool X86Architecture::Table_3_38_ba(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_3_38_ba(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_Fma && (rInsn.GetPrefix() & X86_Prefix_OpSize) == X86_Prefix_OpSize)
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Fmsub231pd);
-      if (Operand__Vx_Wx(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vx_Wx<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -5567,7 +4904,7 @@ bool X86Architecture::Table_3_38_ba(BinaryStream const& rBinStrm, OffsetType Off
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Fmsub231ps);
-      if (Operand__Vx_Wx(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vx_Wx<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -5581,24 +4918,25 @@ bool X86Architecture::Table_3_38_ba(BinaryStream const& rBinStrm, OffsetType Off
  *
  * mnemonic: fmsub231ss
  * operand: ['Vo', 'Ho', 'Wd']
- * prefix: 66
  * attr: ['w0']
+ * prefix: 66
  * cpu_model: >= X86_Arch_Fma
  *
  * mnemonic: fmsub231sd
  * operand: ['Vo', 'Ho', 'Wq']
- * prefix: 66
  * attr: ['w1']
+ * prefix: 66
  * cpu_model: >= X86_Arch_Fma
  *
 **/
-bool X86Architecture::Table_3_38_bb(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_3_38_bb(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_Fma && (rInsn.GetPrefix() & X86_Prefix_OpSize) == X86_Prefix_OpSize)
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Fmsub231sd);
-      if (Operand__Vo_Ho_Wq(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vo_Ho_Wq<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -5608,7 +4946,7 @@ bool X86Architecture::Table_3_38_bb(BinaryStream const& rBinStrm, OffsetType Off
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Fmsub231ss);
-      if (Operand__Vo_Ho_Wd(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vo_Ho_Wd<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -5622,24 +4960,25 @@ bool X86Architecture::Table_3_38_bb(BinaryStream const& rBinStrm, OffsetType Off
  *
  * mnemonic: fnmadd231ps
  * operand: ['Vx', 'Wx']
- * prefix: 66
  * attr: ['w0']
+ * prefix: 66
  * cpu_model: >= X86_Arch_Fma
  *
  * mnemonic: fnmadd231pd
  * operand: ['Vx', 'Wx']
- * prefix: 66
  * attr: ['w1']
+ * prefix: 66
  * cpu_model: >= X86_Arch_Fma
  *
 **/
-bool X86Architecture::Table_3_38_bc(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_3_38_bc(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_Fma && (rInsn.GetPrefix() & X86_Prefix_OpSize) == X86_Prefix_OpSize)
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Fnmadd231pd);
-      if (Operand__Vx_Wx(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vx_Wx<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -5649,7 +4988,7 @@ bool X86Architecture::Table_3_38_bc(BinaryStream const& rBinStrm, OffsetType Off
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Fnmadd231ps);
-      if (Operand__Vx_Wx(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vx_Wx<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -5663,365 +5002,125 @@ bool X86Architecture::Table_3_38_bc(BinaryStream const& rBinStrm, OffsetType Off
  *
  * mnemonic: fnmadd231ss
  * operand: ['Vo', 'Ho', 'Wd']
- * prefix: 66
- * attr: ['w0']
- * cpu_model: >= X86_Arch_Fma
- *
- * mnemonic: fnmadd231sd
- * operand: ['Vo', 'Ho', 'Wq']
- * prefix: 66
- * attr: ['w1']
- * cpu_model: >= X86_Arch_Fma
- *
-**/
-bool X86Architecture::Table_3_38_bd(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_Fma && (rInsn.GetPrefix() & X86_Prefix_OpSize) == X86_Prefix_OpSize)
-    {
-      rInsn.Size()++;
-      rInsn.SetOpcode(X86_Opcode_Fnmadd231sd);
-      if (Operand__Vo_Ho_Wq(rBinStrm, Offset, rInsn, Mode) == false)
-      {
-        return false;
-      }
-      return true;
-    }
-    else if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_Fma && (rInsn.GetPrefix() & X86_Prefix_OpSize) == X86_Prefix_OpSize)
-    {
-      rInsn.Size()++;
-      rInsn.SetOpcode(X86_Opcode_Fnmadd231ss);
-      if (Operand__Vo_Ho_Wd(rBinStrm, Offset, rInsn, Mode) == false)
-      {
-        return false;
-      }
-      return true;
-    }
-    return false;
-}
-
-/** instructions
- * opcode: be
- *
- * mnemonic: fnmsub231ps
- * operand: ['Vx', 'Wx']
- * prefix: 66
- * attr: ['w0']
- * cpu_model: >= X86_Arch_Fma
- *
- * mnemonic: fnmsub231pd
- * operand: ['Vx', 'Wx']
- * prefix: 66
- * attr: ['w1']
- * cpu_model: >= X86_Arch_Fma
- *
-**/
-bool X86Architecture::Table_3_38_be(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_Fma && (rInsn.GetPrefix() & X86_Prefix_OpSize) == X86_Prefix_OpSize)
-    {
-      rInsn.Size()++;
-      rInsn.SetOpcode(X86_Opcode_Fnmsub231pd);
-      if (Operand__Vx_Wx(rBinStrm, Offset, rInsn, Mode) == false)
-      {
-        return false;
-      }
-      return true;
-    }
-    else if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_Fma && (rInsn.GetPrefix() & X86_Prefix_OpSize) == X86_Prefix_OpSize)
-    {
-      rInsn.Size()++;
-      rInsn.SetOpcode(X86_Opcode_Fnmsub231ps);
-      if (Operand__Vx_Wx(rBinStrm, Offset, rInsn, Mode) == false)
-      {
-        return false;
-      }
-      return true;
-    }
-    return false;
-}
-
-/** instructions
- * opcode: bf
- *
- * mnemonic: fnmsub231ss
- * operand: ['Vo', 'Ho', 'Wd']
- * prefix: 66
- * attr: ['w0']
- * cpu_model: >= X86_Arch_Fma
- *
- * mnemonic: fnmsub231sd
- * operand: ['Vo', 'Ho', 'Wq']
- * prefix: 66
- * attr: ['w1']
- * cpu_model: >= X86_Arch_Fma
- *
-**/
-bool X86Architecture::Table_3_38_bf(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_Fma && (rInsn.GetPrefix() & X86_Prefix_OpSize) == X86_Prefix_OpSize)
-    {
-      rInsn.Size()++;
-      rInsn.SetOpcode(X86_Opcode_Fnmsub231sd);
-      if (Operand__Vo_Ho_Wq(rBinStrm, Offset, rInsn, Mode) == false)
-      {
-        return false;
-      }
-      return true;
-    }
-    else if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_Fma && (rInsn.GetPrefix() & X86_Prefix_OpSize) == X86_Prefix_OpSize)
-    {
-      rInsn.Size()++;
-      rInsn.SetOpcode(X86_Opcode_Fnmsub231ss);
-      if (Operand__Vo_Ho_Wd(rBinStrm, Offset, rInsn, Mode) == false)
-      {
-        return false;
-      }
-      return true;
-    }
-    return false;
-}
-
-/** instruction
- * opcode: c0
- * invalid
-**/
-bool X86Architecture::Table_3_38_c0(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: c1
- * invalid
-**/
-bool X86Architecture::Table_3_38_c1(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: c2
- * invalid
-**/
-bool X86Architecture::Table_3_38_c2(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: c3
- * invalid
-**/
-bool X86Architecture::Table_3_38_c3(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: c4
- * invalid
-**/
-bool X86Architecture::Table_3_38_c4(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: c5
- * invalid
-**/
-bool X86Architecture::Table_3_38_c5(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: c6
- * invalid
-**/
-bool X86Architecture::Table_3_38_c6(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: c7
- * invalid
-**/
-bool X86Architecture::Table_3_38_c7(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: c8
- * invalid
-**/
-bool X86Architecture::Table_3_38_c8(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: c9
- * invalid
-**/
-bool X86Architecture::Table_3_38_c9(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: ca
- * invalid
-**/
-bool X86Architecture::Table_3_38_ca(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: cb
- * invalid
-**/
-bool X86Architecture::Table_3_38_cb(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: cc
- * invalid
-**/
-bool X86Architecture::Table_3_38_cc(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: cd
- * invalid
-**/
-bool X86Architecture::Table_3_38_cd(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: ce
- * invalid
-**/
-bool X86Architecture::Table_3_38_ce(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: cf
- * invalid
-**/
-bool X86Architecture::Table_3_38_cf(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: d0
- * invalid
-**/
-bool X86Architecture::Table_3_38_d0(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: d1
- * invalid
-**/
-bool X86Architecture::Table_3_38_d1(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: d2
- * invalid
-**/
-bool X86Architecture::Table_3_38_d2(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: d3
- * invalid
-**/
-bool X86Architecture::Table_3_38_d3(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: d4
- * invalid
-**/
-bool X86Architecture::Table_3_38_d4(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: d5
- * invalid
-**/
-bool X86Architecture::Table_3_38_d5(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: d6
- * invalid
-**/
-bool X86Architecture::Table_3_38_d6(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: d7
- * invalid
-**/
-bool X86Architecture::Table_3_38_d7(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: d8
- * invalid
+ * attr: ['w0']
+ * prefix: 66
+ * cpu_model: >= X86_Arch_Fma
+ *
+ * mnemonic: fnmadd231sd
+ * operand: ['Vo', 'Ho', 'Wq']
+ * attr: ['w1']
+ * prefix: 66
+ * cpu_model: >= X86_Arch_Fma
+ *
 **/
-bool X86Architecture::Table_3_38_d8(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_3_38_bd(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
-    return false; /* INVALID */
+    if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_Fma && (rInsn.GetPrefix() & X86_Prefix_OpSize) == X86_Prefix_OpSize)
+    {
+      rInsn.Size()++;
+      rInsn.SetOpcode(X86_Opcode_Fnmadd231sd);
+      if (Operand__Vo_Ho_Wq<Mode>(rBinStrm, Offset, rInsn) == false)
+      {
+        return false;
+      }
+      return true;
+    }
+    else if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_Fma && (rInsn.GetPrefix() & X86_Prefix_OpSize) == X86_Prefix_OpSize)
+    {
+      rInsn.Size()++;
+      rInsn.SetOpcode(X86_Opcode_Fnmadd231ss);
+      if (Operand__Vo_Ho_Wd<Mode>(rBinStrm, Offset, rInsn) == false)
+      {
+        return false;
+      }
+      return true;
+    }
+    return false;
 }
 
-/** instruction
- * opcode: d9
- * invalid
+/** instructions
+ * opcode: be
+ *
+ * mnemonic: fnmsub231ps
+ * operand: ['Vx', 'Wx']
+ * attr: ['w0']
+ * prefix: 66
+ * cpu_model: >= X86_Arch_Fma
+ *
+ * mnemonic: fnmsub231pd
+ * operand: ['Vx', 'Wx']
+ * attr: ['w1']
+ * prefix: 66
+ * cpu_model: >= X86_Arch_Fma
+ *
 **/
-bool X86Architecture::Table_3_38_d9(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_3_38_be(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
-    return false; /* INVALID */
+    if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_Fma && (rInsn.GetPrefix() & X86_Prefix_OpSize) == X86_Prefix_OpSize)
+    {
+      rInsn.Size()++;
+      rInsn.SetOpcode(X86_Opcode_Fnmsub231pd);
+      if (Operand__Vx_Wx<Mode>(rBinStrm, Offset, rInsn) == false)
+      {
+        return false;
+      }
+      return true;
+    }
+    else if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_Fma && (rInsn.GetPrefix() & X86_Prefix_OpSize) == X86_Prefix_OpSize)
+    {
+      rInsn.Size()++;
+      rInsn.SetOpcode(X86_Opcode_Fnmsub231ps);
+      if (Operand__Vx_Wx<Mode>(rBinStrm, Offset, rInsn) == false)
+      {
+        return false;
+      }
+      return true;
+    }
+    return false;
 }
 
-/** instruction
- * opcode: da
- * invalid
+/** instructions
+ * opcode: bf
+ *
+ * mnemonic: fnmsub231ss
+ * operand: ['Vo', 'Ho', 'Wd']
+ * attr: ['w0']
+ * prefix: 66
+ * cpu_model: >= X86_Arch_Fma
+ *
+ * mnemonic: fnmsub231sd
+ * operand: ['Vo', 'Ho', 'Wq']
+ * attr: ['w1']
+ * prefix: 66
+ * cpu_model: >= X86_Arch_Fma
+ *
 **/
-bool X86Architecture::Table_3_38_da(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_3_38_bf(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
-    return false; /* INVALID */
+    if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_Fma && (rInsn.GetPrefix() & X86_Prefix_OpSize) == X86_Prefix_OpSize)
+    {
+      rInsn.Size()++;
+      rInsn.SetOpcode(X86_Opcode_Fnmsub231sd);
+      if (Operand__Vo_Ho_Wq<Mode>(rBinStrm, Offset, rInsn) == false)
+      {
+        return false;
+      }
+      return true;
+    }
+    else if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_Fma && (rInsn.GetPrefix() & X86_Prefix_OpSize) == X86_Prefix_OpSize)
+    {
+      rInsn.Size()++;
+      rInsn.SetOpcode(X86_Opcode_Fnmsub231ss);
+      if (Operand__Vo_Ho_Wd<Mode>(rBinStrm, Offset, rInsn) == false)
+      {
+        return false;
+      }
+      return true;
+    }
+    return false;
 }
 
 /** instructions
@@ -6029,24 +5128,25 @@ bool X86Architecture::Table_3_38_da(BinaryStream const& rBinStrm, OffsetType Off
  *
  * mnemonic: aesimc
  * operand: ['Vo', 'Wo']
- * prefix: 66
  * attr: ['nv', 'ny']
+ * prefix: 66
  * cpu_model: >= X86_Arch_Aes
  *
  * mnemonic: aesimc
  * operand: ['Vo', 'Wo']
- * prefix: 66
  * attr: ['nv', 'ny']
+ * prefix: 66
  * cpu_model: >= X86_Arch_Avx
  *
 **/
-bool X86Architecture::Table_3_38_db(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_3_38_db(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_Avx && (rInsn.GetPrefix() & X86_Prefix_OpSize) == X86_Prefix_OpSize)
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Aesimc);
-      if (Operand__Vo_Wo(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vo_Wo<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -6056,7 +5156,7 @@ bool X86Architecture::Table_3_38_db(BinaryStream const& rBinStrm, OffsetType Off
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Aesimc);
-      if (Operand__Vo_Wo(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vo_Wo<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -6070,24 +5170,25 @@ bool X86Architecture::Table_3_38_db(BinaryStream const& rBinStrm, OffsetType Off
  *
  * mnemonic: aesenc
  * operand: ['Vo', 'Wo']
- * prefix: 66
  * attr: ['nv', 'ny']
+ * prefix: 66
  * cpu_model: >= X86_Arch_Aes
  *
  * mnemonic: aesenc
  * operand: ['Vo', 'Ho', 'Wo']
- * prefix: 66
  * attr: ['ny']
+ * prefix: 66
  * cpu_model: >= X86_Arch_Avx
  *
 **/
-bool X86Architecture::Table_3_38_dc(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_3_38_dc(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_Avx && (rInsn.GetPrefix() & X86_Prefix_OpSize) == X86_Prefix_OpSize)
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Aesenc);
-      if (Operand__Vo_Ho_Wo(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vo_Ho_Wo<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -6097,7 +5198,7 @@ bool X86Architecture::Table_3_38_dc(BinaryStream const& rBinStrm, OffsetType Off
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Aesenc);
-      if (Operand__Vo_Wo(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vo_Wo<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -6111,24 +5212,25 @@ bool X86Architecture::Table_3_38_dc(BinaryStream const& rBinStrm, OffsetType Off
  *
  * mnemonic: aesenclast
  * operand: ['Vo', 'Wo']
- * prefix: 66
  * attr: ['nv', 'ny']
+ * prefix: 66
  * cpu_model: >= X86_Arch_Aes
  *
  * mnemonic: aesenclast
  * operand: ['Vo', 'Ho', 'Wo']
- * prefix: 66
  * attr: ['ny']
+ * prefix: 66
  * cpu_model: >= X86_Arch_Avx
  *
 **/
-bool X86Architecture::Table_3_38_dd(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_3_38_dd(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_Avx && (rInsn.GetPrefix() & X86_Prefix_OpSize) == X86_Prefix_OpSize)
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Aesenclast);
-      if (Operand__Vo_Ho_Wo(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vo_Ho_Wo<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -6138,7 +5240,7 @@ bool X86Architecture::Table_3_38_dd(BinaryStream const& rBinStrm, OffsetType Off
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Aesenclast);
-      if (Operand__Vo_Wo(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vo_Wo<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -6152,24 +5254,25 @@ bool X86Architecture::Table_3_38_dd(BinaryStream const& rBinStrm, OffsetType Off
  *
  * mnemonic: aesdec
  * operand: ['Vo', 'Wo']
- * prefix: 66
  * attr: ['nv', 'ny']
+ * prefix: 66
  * cpu_model: >= X86_Arch_Aes
  *
  * mnemonic: aesdec
  * operand: ['Vo', 'Ho', 'Wo']
- * prefix: 66
  * attr: ['ny']
+ * prefix: 66
  * cpu_model: >= X86_Arch_Avx
  *
 **/
-bool X86Architecture::Table_3_38_de(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_3_38_de(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_Avx && (rInsn.GetPrefix() & X86_Prefix_OpSize) == X86_Prefix_OpSize)
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Aesdec);
-      if (Operand__Vo_Ho_Wo(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vo_Ho_Wo<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -6179,7 +5282,7 @@ bool X86Architecture::Table_3_38_de(BinaryStream const& rBinStrm, OffsetType Off
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Aesdec);
-      if (Operand__Vo_Wo(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vo_Wo<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -6193,24 +5296,25 @@ bool X86Architecture::Table_3_38_de(BinaryStream const& rBinStrm, OffsetType Off
  *
  * mnemonic: aesdeclast
  * operand: ['Vo', 'Wo']
- * prefix: 66
  * attr: ['nv', 'ny']
+ * prefix: 66
  * cpu_model: >= X86_Arch_Aes
  *
  * mnemonic: aesdeclast
  * operand: ['Vo', 'Ho', 'Wo']
- * prefix: 66
  * attr: ['ny']
+ * prefix: 66
  * cpu_model: >= X86_Arch_Avx
  *
 **/
-bool X86Architecture::Table_3_38_df(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_3_38_df(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_Avx && (rInsn.GetPrefix() & X86_Prefix_OpSize) == X86_Prefix_OpSize)
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Aesdeclast);
-      if (Operand__Vo_Ho_Wo(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vo_Ho_Wo<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -6220,7 +5324,7 @@ bool X86Architecture::Table_3_38_df(BinaryStream const& rBinStrm, OffsetType Off
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Aesdeclast);
-      if (Operand__Vo_Wo(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vo_Wo<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -6229,150 +5333,6 @@ bool X86Architecture::Table_3_38_df(BinaryStream const& rBinStrm, OffsetType Off
     return false;
 }
 
-/** instruction
- * opcode: e0
- * invalid
-**/
-bool X86Architecture::Table_3_38_e0(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: e1
- * invalid
-**/
-bool X86Architecture::Table_3_38_e1(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: e2
- * invalid
-**/
-bool X86Architecture::Table_3_38_e2(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: e3
- * invalid
-**/
-bool X86Architecture::Table_3_38_e3(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: e4
- * invalid
-**/
-bool X86Architecture::Table_3_38_e4(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: e5
- * invalid
-**/
-bool X86Architecture::Table_3_38_e5(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: e6
- * invalid
-**/
-bool X86Architecture::Table_3_38_e6(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: e7
- * invalid
-**/
-bool X86Architecture::Table_3_38_e7(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: e8
- * invalid
-**/
-bool X86Architecture::Table_3_38_e8(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: e9
- * invalid
-**/
-bool X86Architecture::Table_3_38_e9(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: ea
- * invalid
-**/
-bool X86Architecture::Table_3_38_ea(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: eb
- * invalid
-**/
-bool X86Architecture::Table_3_38_eb(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: ec
- * invalid
-**/
-bool X86Architecture::Table_3_38_ec(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: ed
- * invalid
-**/
-bool X86Architecture::Table_3_38_ed(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: ee
- * invalid
-**/
-bool X86Architecture::Table_3_38_ee(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: ef
- * invalid
-**/
-bool X86Architecture::Table_3_38_ef(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
 /** instructions
  * opcode: f0
  *
@@ -6396,13 +5356,14 @@ bool X86Architecture::Table_3_38_ef(BinaryStream const& rBinStrm, OffsetType Off
  * cpu_model: >= X86_Arch_Sse42
  *
 **/
-bool X86Architecture::Table_3_38_f0(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_3_38_f0(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_Sse42 && (rInsn.GetPrefix() & X86_Prefix_OpSize) == X86_Prefix_OpSize && (rInsn.GetPrefix() & X86_Prefix_RepNz) == X86_Prefix_RepNz)
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Crc32);
-      if (Operand__Gy_Eb(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Gy_Eb<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -6412,7 +5373,7 @@ bool X86Architecture::Table_3_38_f0(BinaryStream const& rBinStrm, OffsetType Off
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Crc32);
-      if (Operand__Gy_Eb(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Gy_Eb<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -6422,7 +5383,7 @@ bool X86Architecture::Table_3_38_f0(BinaryStream const& rBinStrm, OffsetType Off
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Movbe);
-      if (Operand__Gv_Mv(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Gv_Mv<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -6432,7 +5393,7 @@ bool X86Architecture::Table_3_38_f0(BinaryStream const& rBinStrm, OffsetType Off
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Movbe);
-      if (Operand__Gv_Mv(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Gv_Mv<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -6464,13 +5425,14 @@ bool X86Architecture::Table_3_38_f0(BinaryStream const& rBinStrm, OffsetType Off
  * cpu_model: >= X86_Arch_Sse42
  *
 **/
-bool X86Architecture::Table_3_38_f1(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_3_38_f1(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_Sse42 && (rInsn.GetPrefix() & X86_Prefix_OpSize) == X86_Prefix_OpSize && (rInsn.GetPrefix() & X86_Prefix_RepNz) == X86_Prefix_RepNz)
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Crc32);
-      if (Operand__Gy_Ev(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Gy_Ev<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -6480,7 +5442,7 @@ bool X86Architecture::Table_3_38_f1(BinaryStream const& rBinStrm, OffsetType Off
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Crc32);
-      if (Operand__Gy_Ev(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Gy_Ev<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -6490,7 +5452,7 @@ bool X86Architecture::Table_3_38_f1(BinaryStream const& rBinStrm, OffsetType Off
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Movbe);
-      if (Operand__Mv_Gv(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Mv_Gv<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -6500,7 +5462,7 @@ bool X86Architecture::Table_3_38_f1(BinaryStream const& rBinStrm, OffsetType Off
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Movbe);
-      if (Operand__Mv_Gv(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Mv_Gv<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -6510,18 +5472,19 @@ bool X86Architecture::Table_3_38_f1(BinaryStream const& rBinStrm, OffsetType Off
 }
 
 /** instruction
+ * opcode: f2
  * mnemonic: andn
  * operand: ['Gy', 'By', 'Ey']
- * opcode: f2
  * cpu_model: >= X86_Arch_Bmi
 **/
-bool X86Architecture::Table_3_38_f2(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_3_38_f2(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_Bmi)
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Andn);
-      if (Operand__Gy_By_Ey(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Gy_By_Ey<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -6536,20 +5499,21 @@ bool X86Architecture::Table_3_38_f2(BinaryStream const& rBinStrm, OffsetType Off
  *
  * reference: group_17
  *
- * prefix: 66
  * reference: group_17
+ * prefix: 66
  *
- * prefix: f3
  * reference: group_17
+ * prefix: f3
  *
- * prefix: f2
  * reference: group_17
+ * prefix: f2
  *
- * prefix: [102, 242]
  * reference: group_17
+ * prefix: [102, 242]
  *
 **/
-bool X86Architecture::Table_3_38_f3(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_3_38_f3(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if ((rInsn.GetPrefix() & X86_Prefix_OpSize) == X86_Prefix_OpSize && (rInsn.GetPrefix() & X86_Prefix_RepNz) == X86_Prefix_RepNz)
     {
@@ -6587,7 +5551,7 @@ bool X86Architecture::Table_3_38_f3(BinaryStream const& rBinStrm, OffsetType Off
         {
           rInsn.Size()++;
           rInsn.SetOpcode(X86_Opcode_Blsr);
-          if (Operand__By_Ey(rBinStrm, Offset, rInsn, Mode) == false)
+          if (Operand__By_Ey<Mode>(rBinStrm, Offset, rInsn) == false)
           {
             return false;
           }
@@ -6600,7 +5564,7 @@ bool X86Architecture::Table_3_38_f3(BinaryStream const& rBinStrm, OffsetType Off
         {
           rInsn.Size()++;
           rInsn.SetOpcode(X86_Opcode_Blsmsk);
-          if (Operand__By_Ey(rBinStrm, Offset, rInsn, Mode) == false)
+          if (Operand__By_Ey<Mode>(rBinStrm, Offset, rInsn) == false)
           {
             return false;
           }
@@ -6613,7 +5577,7 @@ bool X86Architecture::Table_3_38_f3(BinaryStream const& rBinStrm, OffsetType Off
         {
           rInsn.Size()++;
           rInsn.SetOpcode(X86_Opcode_Blsi);
-          if (Operand__By_Ey(rBinStrm, Offset, rInsn, Mode) == false)
+          if (Operand__By_Ey<Mode>(rBinStrm, Offset, rInsn) == false)
           {
             return false;
           }
@@ -6635,15 +5599,6 @@ bool X86Architecture::Table_3_38_f3(BinaryStream const& rBinStrm, OffsetType Off
     }
 }
 
-/** instruction
- * opcode: f4
- * invalid
-**/
-bool X86Architecture::Table_3_38_f4(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
 /** instructions
  * opcode: f5
  *
@@ -6662,13 +5617,14 @@ bool X86Architecture::Table_3_38_f4(BinaryStream const& rBinStrm, OffsetType Off
  * cpu_model: >= X86_Arch_Bmi2
  *
 **/
-bool X86Architecture::Table_3_38_f5(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_3_38_f5(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_Bmi2 && (rInsn.GetPrefix() & X86_Prefix_RepNz) == X86_Prefix_RepNz)
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Pdep);
-      if (Operand__Gy_By_Ey(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Gy_By_Ey<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -6678,7 +5634,7 @@ bool X86Architecture::Table_3_38_f5(BinaryStream const& rBinStrm, OffsetType Off
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Pext);
-      if (Operand__Gy_By_Ey(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Gy_By_Ey<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -6688,7 +5644,7 @@ bool X86Architecture::Table_3_38_f5(BinaryStream const& rBinStrm, OffsetType Off
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Bzhi);
-      if (Operand__Gy_Ey_By(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Gy_Ey_By<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -6698,19 +5654,20 @@ bool X86Architecture::Table_3_38_f5(BinaryStream const& rBinStrm, OffsetType Off
 }
 
 /** instruction
+ * opcode: f6
  * mnemonic: mulx
  * operand: ['Gy', 'Ey', 'By']
  * prefix: f2
- * opcode: f6
  * cpu_model: >= X86_Arch_Bmi2
 **/
-bool X86Architecture::Table_3_38_f6(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_3_38_f6(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_Bmi2 && (rInsn.GetPrefix() & X86_Prefix_RepNz) == X86_Prefix_RepNz)
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Mulx);
-      if (Operand__Gy_Ey_By(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Gy_Ey_By<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -6743,13 +5700,14 @@ bool X86Architecture::Table_3_38_f6(BinaryStream const& rBinStrm, OffsetType Off
  * cpu_model: >= X86_Arch_Bmi2
  *
 **/
-bool X86Architecture::Table_3_38_f7(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_3_38_f7(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_Bmi2 && (rInsn.GetPrefix() & X86_Prefix_RepNz) == X86_Prefix_RepNz)
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Shrx);
-      if (Operand__Gy_Ey_By(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Gy_Ey_By<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -6759,7 +5717,7 @@ bool X86Architecture::Table_3_38_f7(BinaryStream const& rBinStrm, OffsetType Off
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Sarx);
-      if (Operand__Gy_Ey_By(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Gy_Ey_By<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -6769,7 +5727,7 @@ bool X86Architecture::Table_3_38_f7(BinaryStream const& rBinStrm, OffsetType Off
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Shlx);
-      if (Operand__Gy_Ey_By(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Gy_Ey_By<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -6779,7 +5737,7 @@ bool X86Architecture::Table_3_38_f7(BinaryStream const& rBinStrm, OffsetType Off
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Bextr);
-      if (Operand__Gy_Ey_By(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Gy_Ey_By<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -6788,75 +5746,122 @@ bool X86Architecture::Table_3_38_f7(BinaryStream const& rBinStrm, OffsetType Off
     return false;
 }
 
-/** instruction
- * opcode: f8
- * invalid
-**/
-bool X86Architecture::Table_3_38_f8(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: f9
- * invalid
-**/
-bool X86Architecture::Table_3_38_f9(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: fa
- * invalid
-**/
-bool X86Architecture::Table_3_38_fa(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: fb
- * invalid
-**/
-bool X86Architecture::Table_3_38_fb(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: fc
- * invalid
-**/
-bool X86Architecture::Table_3_38_fc(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: fd
- * invalid
-**/
-bool X86Architecture::Table_3_38_fd(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: fe
- * invalid
-**/
-bool X86Architecture::Table_3_38_fe(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: ff
- * invalid
-**/
-bool X86Architecture::Table_3_38_ff(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
+X86_INSTANTIATE_DISASSEMBLER(Table_3_38_00);
+X86_INSTANTIATE_DISASSEMBLER(Table_3_38_01);
+X86_INSTANTIATE_DISASSEMBLER(Table_3_38_02);
+X86_INSTANTIATE_DISASSEMBLER(Table_3_38_03);
+X86_INSTANTIATE_DISASSEMBLER(Table_3_38_04);
+X86_INSTANTIATE_DISASSEMBLER(Table_3_38_05);
+X86_INSTANTIATE_DISASSEMBLER(Table_3_38_06);
+X86_INSTANTIATE_DISASSEMBLER(Table_3_38_07);
+X86_INSTANTIATE_DISASSEMBLER(Table_3_38_08);
+X86_INSTANTIATE_DISASSEMBLER(Table_3_38_09);
+X86_INSTANTIATE_DISASSEMBLER(Table_3_38_0a);
+X86_INSTANTIATE_DISASSEMBLER(Table_3_38_0b);
+X86_INSTANTIATE_DISASSEMBLER(Table_3_38_0c);
+X86_INSTANTIATE_DISASSEMBLER(Table_3_38_0d);
+X86_INSTANTIATE_DISASSEMBLER(Table_3_38_0e);
+X86_INSTANTIATE_DISASSEMBLER(Table_3_38_0f);
+X86_INSTANTIATE_DISASSEMBLER(Table_3_38_10);
+X86_INSTANTIATE_DISASSEMBLER(Table_3_38_13);
+X86_INSTANTIATE_DISASSEMBLER(Table_3_38_14);
+X86_INSTANTIATE_DISASSEMBLER(Table_3_38_15);
+X86_INSTANTIATE_DISASSEMBLER(Table_3_38_16);
+X86_INSTANTIATE_DISASSEMBLER(Table_3_38_17);
+X86_INSTANTIATE_DISASSEMBLER(Table_3_38_18);
+X86_INSTANTIATE_DISASSEMBLER(Table_3_38_19);
+X86_INSTANTIATE_DISASSEMBLER(Table_3_38_1a);
+X86_INSTANTIATE_DISASSEMBLER(Table_3_38_1c);
+X86_INSTANTIATE_DISASSEMBLER(Table_3_38_1d);
+X86_INSTANTIATE_DISASSEMBLER(Table_3_38_1e);
+X86_INSTANTIATE_DISASSEMBLER(Table_3_38_20);
+X86_INSTANTIATE_DISASSEMBLER(Table_3_38_21);
+X86_INSTANTIATE_DISASSEMBLER(Table_3_38_22);
+X86_INSTANTIATE_DISASSEMBLER(Table_3_38_23);
+X86_INSTANTIATE_DISASSEMBLER(Table_3_38_24);
+X86_INSTANTIATE_DISASSEMBLER(Table_3_38_25);
+X86_INSTANTIATE_DISASSEMBLER(Table_3_38_28);
+X86_INSTANTIATE_DISASSEMBLER(Table_3_38_29);
+X86_INSTANTIATE_DISASSEMBLER(Table_3_38_2a);
+X86_INSTANTIATE_DISASSEMBLER(Table_3_38_2b);
+X86_INSTANTIATE_DISASSEMBLER(Table_3_38_2c);
+X86_INSTANTIATE_DISASSEMBLER(Table_3_38_2d);
+X86_INSTANTIATE_DISASSEMBLER(Table_3_38_2e);
+X86_INSTANTIATE_DISASSEMBLER(Table_3_38_2f);
+X86_INSTANTIATE_DISASSEMBLER(Table_3_38_30);
+X86_INSTANTIATE_DISASSEMBLER(Table_3_38_31);
+X86_INSTANTIATE_DISASSEMBLER(Table_3_38_32);
+X86_INSTANTIATE_DISASSEMBLER(Table_3_38_33);
+X86_INSTANTIATE_DISASSEMBLER(Table_3_38_34);
+X86_INSTANTIATE_DISASSEMBLER(Table_3_38_35);
+X86_INSTANTIATE_DISASSEMBLER(Table_3_38_36);
+X86_INSTANTIATE_DISASSEMBLER(Table_3_38_37);
+X86_INSTANTIATE_DISASSEMBLER(Table_3_38_38);
+X86_INSTANTIATE_DISASSEMBLER(Table_3_38_39);
+X86_INSTANTIATE_DISASSEMBLER(Table_3_38_3a);
+X86_INSTANTIATE_DISASSEMBLER(Table_3_38_3b);
+X86_INSTANTIATE_DISASSEMBLER(Table_3_38_3c);
+X86_INSTANTIATE_DISASSEMBLER(Table_3_38_3d);
+X86_INSTANTIATE_DISASSEMBLER(Table_3_38_3e);
+X86_INSTANTIATE_DISASSEMBLER(Table_3_38_3f);
+X86_INSTANTIATE_DISASSEMBLER(Table_3_38_40);
+X86_INSTANTIATE_DISASSEMBLER(Table_3_38_41);
+X86_INSTANTIATE_DISASSEMBLER(Table_3_38_45);
+X86_INSTANTIATE_DISASSEMBLER(Table_3_38_46);
+X86_INSTANTIATE_DISASSEMBLER(Table_3_38_47);
+X86_INSTANTIATE_DISASSEMBLER(Table_3_38_58);
+X86_INSTANTIATE_DISASSEMBLER(Table_3_38_59);
+X86_INSTANTIATE_DISASSEMBLER(Table_3_38_5a);
+X86_INSTANTIATE_DISASSEMBLER(Table_3_38_78);
+X86_INSTANTIATE_DISASSEMBLER(Table_3_38_79);
+X86_INSTANTIATE_DISASSEMBLER(Table_3_38_80);
+X86_INSTANTIATE_DISASSEMBLER(Table_3_38_81);
+X86_INSTANTIATE_DISASSEMBLER(Table_3_38_82);
+X86_INSTANTIATE_DISASSEMBLER(Table_3_38_8c);
+X86_INSTANTIATE_DISASSEMBLER(Table_3_38_8e);
+X86_INSTANTIATE_DISASSEMBLER(Table_3_38_90);
+X86_INSTANTIATE_DISASSEMBLER(Table_3_38_91);
+X86_INSTANTIATE_DISASSEMBLER(Table_3_38_92);
+X86_INSTANTIATE_DISASSEMBLER(Table_3_38_93);
+X86_INSTANTIATE_DISASSEMBLER(Table_3_38_96);
+X86_INSTANTIATE_DISASSEMBLER(Table_3_38_97);
+X86_INSTANTIATE_DISASSEMBLER(Table_3_38_98);
+X86_INSTANTIATE_DISASSEMBLER(Table_3_38_99);
+X86_INSTANTIATE_DISASSEMBLER(Table_3_38_9a);
+X86_INSTANTIATE_DISASSEMBLER(Table_3_38_9b);
+X86_INSTANTIATE_DISASSEMBLER(Table_3_38_9c);
+X86_INSTANTIATE_DISASSEMBLER(Table_3_38_9d);
+X86_INSTANTIATE_DISASSEMBLER(Table_3_38_9e);
+X86_INSTANTIATE_DISASSEMBLER(Table_3_38_9f);
+X86_INSTANTIATE_DISASSEMBLER(Table_3_38_a6);
+X86_INSTANTIATE_DISASSEMBLER(Table_3_38_a7);
+X86_INSTANTIATE_DISASSEMBLER(Table_3_38_a8);
+X86_INSTANTIATE_DISASSEMBLER(Table_3_38_a9);
+X86_INSTANTIATE_DISASSEMBLER(Table_3_38_aa);
+X86_INSTANTIATE_DISASSEMBLER(Table_3_38_ab);
+X86_INSTANTIATE_DISASSEMBLER(Table_3_38_ac);
+X86_INSTANTIATE_DISASSEMBLER(Table_3_38_ad);
+X86_INSTANTIATE_DISASSEMBLER(Table_3_38_ae);
+X86_INSTANTIATE_DISASSEMBLER(Table_3_38_af);
+X86_INSTANTIATE_DISASSEMBLER(Table_3_38_b6);
+X86_INSTANTIATE_DISASSEMBLER(Table_3_38_b7);
+X86_INSTANTIATE_DISASSEMBLER(Table_3_38_b8);
+X86_INSTANTIATE_DISASSEMBLER(Table_3_38_b9);
+X86_INSTANTIATE_DISASSEMBLER(Table_3_38_ba);
+X86_INSTANTIATE_DISASSEMBLER(Table_3_38_bb);
+X86_INSTANTIATE_DISASSEMBLER(Table_3_38_bc);
+X86_INSTANTIATE_DISASSEMBLER(Table_3_38_bd);
+X86_INSTANTIATE_DISASSEMBLER(Table_3_38_be);
+X86_INSTANTIATE_DISASSEMBLER(Table_3_38_bf);
+X86_INSTANTIATE_DISASSEMBLER(Table_3_38_db);
+X86_INSTANTIATE_DISASSEMBLER(Table_3_38_dc);
+X86_INSTANTIATE_DISASSEMBLER(Table_3_38_dd);
+X86_INSTANTIATE_DISASSEMBLER(Table_3_38_de);
+X86_INSTANTIATE_DISASSEMBLER(Table_3_38_df);
+X86_INSTANTIATE_DISASSEMBLER(Table_3_38_f0);
+X86_INSTANTIATE_DISASSEMBLER(Table_3_38_f1);
+X86_INSTANTIATE_DISASSEMBLER(Table_3_38_f2);
+X86_INSTANTIATE_DISASSEMBLER(Table_3_38_f3);
+X86_INSTANTIATE_DISASSEMBLER(Table_3_38_f5);
+X86_INSTANTIATE_DISASSEMBLER(Table_3_38_f6);
+X86_INSTANTIATE_DISASSEMBLER(Table_3_38_f7);
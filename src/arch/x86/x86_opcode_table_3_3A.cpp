@@ -1,279 +1,280 @@
-/* This file has been automatically generated, you must _NOT_ edit it directly. (Sun Feb 05 12:38:19 2017) */
+/* This file has been automatically generated, you must _NOT_ edit it directly. (Sun Oct 18 18:46:50 2026) */
 #include "x86_architecture.hpp"
-const X86Architecture::TDisassembler X86Architecture::m_Table_3_3a[0x100] =
-{
-  &X86Architecture::Table_3_3a_00,
-  &X86Architecture::Table_3_3a_01,
-  &X86Architecture::Table_3_3a_02,
-  &X86Architecture::Table_3_3a_03,
-  &X86Architecture::Table_3_3a_04,
-  &X86Architecture::Table_3_3a_05,
-  &X86Architecture::Table_3_3a_06,
-  &X86Architecture::Table_3_3a_07,
-  &X86Architecture::Table_3_3a_08,
-  &X86Architecture::Table_3_3a_09,
-  &X86Architecture::Table_3_3a_0a,
-  &X86Architecture::Table_3_3a_0b,
-  &X86Architecture::Table_3_3a_0c,
-  &X86Architecture::Table_3_3a_0d,
-  &X86Architecture::Table_3_3a_0e,
-  &X86Architecture::Table_3_3a_0f,
-  &X86Architecture::Table_3_3a_10,
-  &X86Architecture::Table_3_3a_11,
-  &X86Architecture::Table_3_3a_12,
-  &X86Architecture::Table_3_3a_13,
-  &X86Architecture::Table_3_3a_14,
-  &X86Architecture::Table_3_3a_15,
-  &X86Architecture::Table_3_3a_16,
-  &X86Architecture::Table_3_3a_17,
-  &X86Architecture::Table_3_3a_18,
-  &X86Architecture::Table_3_3a_19,
-  &X86Architecture::Table_3_3a_1a,
-  &X86Architecture::Table_3_3a_1b,
-  &X86Architecture::Table_3_3a_1c,
-  &X86Architecture::Table_3_3a_1d,
-  &X86Architecture::Table_3_3a_1e,
-  &X86Architecture::Table_3_3a_1f,
-  &X86Architecture::Table_3_3a_20,
-  &X86Architecture::Table_3_3a_21,
-  &X86Architecture::Table_3_3a_22,
-  &X86Architecture::Table_3_3a_23,
-  &X86Architecture::Table_3_3a_24,
-  &X86Architecture::Table_3_3a_25,
-  &X86Architecture::Table_3_3a_26,
-  &X86Architecture::Table_3_3a_27,
-  &X86Architecture::Table_3_3a_28,
-  &X86Architecture::Table_3_3a_29,
-  &X86Architecture::Table_3_3a_2a,
-  &X86Architecture::Table_3_3a_2b,
-  &X86Architecture::Table_3_3a_2c,
-  &X86Architecture::Table_3_3a_2d,
-  &X86Architecture::Table_3_3a_2e,
-  &X86Architecture::Table_3_3a_2f,
-  &X86Architecture::Table_3_3a_30,
-  &X86Architecture::Table_3_3a_31,
-  &X86Architecture::Table_3_3a_32,
-  &X86Architecture::Table_3_3a_33,
-  &X86Architecture::Table_3_3a_34,
-  &X86Architecture::Table_3_3a_35,
-  &X86Architecture::Table_3_3a_36,
-  &X86Architecture::Table_3_3a_37,
-  &X86Architecture::Table_3_3a_38,
-  &X86Architecture::Table_3_3a_39,
-  &X86Architecture::Table_3_3a_3a,
-  &X86Architecture::Table_3_3a_3b,
-  &X86Architecture::Table_3_3a_3c,
-  &X86Architecture::Table_3_3a_3d,
-  &X86Architecture::Table_3_3a_3e,
-  &X86Architecture::Table_3_3a_3f,
-  &X86Architecture::Table_3_3a_40,
-  &X86Architecture::Table_3_3a_41,
-  &X86Architecture::Table_3_3a_42,
-  &X86Architecture::Table_3_3a_43,
-  &X86Architecture::Table_3_3a_44,
-  &X86Architecture::Table_3_3a_45,
-  &X86Architecture::Table_3_3a_46,
-  &X86Architecture::Table_3_3a_47,
-  &X86Architecture::Table_3_3a_48,
-  &X86Architecture::Table_3_3a_49,
-  &X86Architecture::Table_3_3a_4a,
-  &X86Architecture::Table_3_3a_4b,
-  &X86Architecture::Table_3_3a_4c,
-  &X86Architecture::Table_3_3a_4d,
-  &X86Architecture::Table_3_3a_4e,
-  &X86Architecture::Table_3_3a_4f,
-  &X86Architecture::Table_3_3a_50,
-  &X86Architecture::Table_3_3a_51,
-  &X86Architecture::Table_3_3a_52,
-  &X86Architecture::Table_3_3a_53,
-  &X86Architecture::Table_3_3a_54,
-  &X86Architecture::Table_3_3a_55,
-  &X86Architecture::Table_3_3a_56,
-  &X86Architecture::Table_3_3a_57,
-  &X86Architecture::Table_3_3a_58,
-  &X86Architecture::Table_3_3a_59,
-  &X86Architecture::Table_3_3a_5a,
-  &X86Architecture::Table_3_3a_5b,
-  &X86Architecture::Table_3_3a_5c,
-  &X86Architecture::Table_3_3a_5d,
-  &X86Architecture::Table_3_3a_5e,
-  &X86Architecture::Table_3_3a_5f,
-  &X86Architecture::Table_3_3a_60,
-  &X86Architecture::Table_3_3a_61,
-  &X86Architecture::Table_3_3a_62,
-  &X86Architecture::Table_3_3a_63,
-  &X86Architecture::Table_3_3a_64,
-  &X86Architecture::Table_3_3a_65,
-  &X86Architecture::Table_3_3a_66,
-  &X86Architecture::Table_3_3a_67,
-  &X86Architecture::Table_3_3a_68,
-  &X86Architecture::Table_3_3a_69,
-  &X86Architecture::Table_3_3a_6a,
-  &X86Architecture::Table_3_3a_6b,
-  &X86Architecture::Table_3_3a_6c,
-  &X86Architecture::Table_3_3a_6d,
-  &X86Architecture::Table_3_3a_6e,
-  &X86Architecture::Table_3_3a_6f,
-  &X86Architecture::Table_3_3a_70,
-  &X86Architecture::Table_3_3a_71,
-  &X86Architecture::Table_3_3a_72,
-  &X86Architecture::Table_3_3a_73,
-  &X86Architecture::Table_3_3a_74,
-  &X86Architecture::Table_3_3a_75,
-  &X86Architecture::Table_3_3a_76,
-  &X86Architecture::Table_3_3a_77,
-  &X86Architecture::Table_3_3a_78,
-  &X86Architecture::Table_3_3a_79,
-  &X86Architecture::Table_3_3a_7a,
-  &X86Architecture::Table_3_3a_7b,
-  &X86Architecture::Table_3_3a_7c,
-  &X86Architecture::Table_3_3a_7d,
-  &X86Architecture::Table_3_3a_7e,
-  &X86Architecture::Table_3_3a_7f,
-  &X86Architecture::Table_3_3a_80,
-  &X86Architecture::Table_3_3a_81,
-  &X86Architecture::Table_3_3a_82,
-  &X86Architecture::Table_3_3a_83,
-  &X86Architecture::Table_3_3a_84,
-  &X86Architecture::Table_3_3a_85,
-  &X86Architecture::Table_3_3a_86,
-  &X86Architecture::Table_3_3a_87,
-  &X86Architecture::Table_3_3a_88,
-  &X86Architecture::Table_3_3a_89,
-  &X86Architecture::Table_3_3a_8a,
-  &X86Architecture::Table_3_3a_8b,
-  &X86Architecture::Table_3_3a_8c,
-  &X86Architecture::Table_3_3a_8d,
-  &X86Architecture::Table_3_3a_8e,
-  &X86Architecture::Table_3_3a_8f,
-  &X86Architecture::Table_3_3a_90,
-  &X86Architecture::Table_3_3a_91,
-  &X86Architecture::Table_3_3a_92,
-  &X86Architecture::Table_3_3a_93,
-  &X86Architecture::Table_3_3a_94,
-  &X86Architecture::Table_3_3a_95,
-  &X86Architecture::Table_3_3a_96,
-  &X86Architecture::Table_3_3a_97,
-  &X86Architecture::Table_3_3a_98,
-  &X86Architecture::Table_3_3a_99,
-  &X86Architecture::Table_3_3a_9a,
-  &X86Architecture::Table_3_3a_9b,
-  &X86Architecture::Table_3_3a_9c,
-  &X86Architecture::Table_3_3a_9d,
-  &X86Architecture::Table_3_3a_9e,
-  &X86Architecture::Table_3_3a_9f,
-  &X86Architecture::Table_3_3a_a0,
-  &X86Architecture::Table_3_3a_a1,
-  &X86Architecture::Table_3_3a_a2,
-  &X86Architecture::Table_3_3a_a3,
-  &X86Architecture::Table_3_3a_a4,
-  &X86Architecture::Table_3_3a_a5,
-  &X86Architecture::Table_3_3a_a6,
-  &X86Architecture::Table_3_3a_a7,
-  &X86Architecture::Table_3_3a_a8,
-  &X86Architecture::Table_3_3a_a9,
-  &X86Architecture::Table_3_3a_aa,
-  &X86Architecture::Table_3_3a_ab,
-  &X86Architecture::Table_3_3a_ac,
-  &X86Architecture::Table_3_3a_ad,
-  &X86Architecture::Table_3_3a_ae,
-  &X86Architecture::Table_3_3a_af,
-  &X86Architecture::Table_3_3a_b0,
-  &X86Architecture::Table_3_3a_b1,
-  &X86Architecture::Table_3_3a_b2,
-  &X86Architecture::Table_3_3a_b3,
-  &X86Architecture::Table_3_3a_b4,
-  &X86Architecture::Table_3_3a_b5,
-  &X86Architecture::Table_3_3a_b6,
-  &X86Architecture::Table_3_3a_b7,
-  &X86Architecture::Table_3_3a_b8,
-  &X86Architecture::Table_3_3a_b9,
-  &X86Architecture::Table_3_3a_ba,
-  &X86Architecture::Table_3_3a_bb,
-  &X86Architecture::Table_3_3a_bc,
-  &X86Architecture::Table_3_3a_bd,
-  &X86Architecture::Table_3_3a_be,
-  &X86Architecture::Table_3_3a_bf,
-  &X86Architecture::Table_3_3a_c0,
-  &X86Architecture::Table_3_3a_c1,
-  &X86Architecture::Table_3_3a_c2,
-  &X86Architecture::Table_3_3a_c3,
-  &X86Architecture::Table_3_3a_c4,
-  &X86Architecture::Table_3_3a_c5,
-  &X86Architecture::Table_3_3a_c6,
-  &X86Architecture::Table_3_3a_c7,
-  &X86Architecture::Table_3_3a_c8,
-  &X86Architecture::Table_3_3a_c9,
-  &X86Architecture::Table_3_3a_ca,
-  &X86Architecture::Table_3_3a_cb,
-  &X86Architecture::Table_3_3a_cc,
-  &X86Architecture::Table_3_3a_cd,
-  &X86Architecture::Table_3_3a_ce,
-  &X86Architecture::Table_3_3a_cf,
-  &X86Architecture::Table_3_3a_d0,
-  &X86Architecture::Table_3_3a_d1,
-  &X86Architecture::Table_3_3a_d2,
-  &X86Architecture::Table_3_3a_d3,
-  &X86Architecture::Table_3_3a_d4,
-  &X86Architecture::Table_3_3a_d5,
-  &X86Architecture::Table_3_3a_d6,
-  &X86Architecture::Table_3_3a_d7,
-  &X86Architecture::Table_3_3a_d8,
-  &X86Architecture::Table_3_3a_d9,
-  &X86Architecture::Table_3_3a_da,
-  &X86Architecture::Table_3_3a_db,
-  &X86Architecture::Table_3_3a_dc,
-  &X86Architecture::Table_3_3a_dd,
-  &X86Architecture::Table_3_3a_de,
-  &X86Architecture::Table_3_3a_df,
-  &X86Architecture::Table_3_3a_e0,
-  &X86Architecture::Table_3_3a_e1,
-  &X86Architecture::Table_3_3a_e2,
-  &X86Architecture::Table_3_3a_e3,
-  &X86Architecture::Table_3_3a_e4,
-  &X86Architecture::Table_3_3a_e5,
-  &X86Architecture::Table_3_3a_e6,
-  &X86Architecture::Table_3_3a_e7,
-  &X86Architecture::Table_3_3a_e8,
-  &X86Architecture::Table_3_3a_e9,
-  &X86Architecture::Table_3_3a_ea,
-  &X86Architecture::Table_3_3a_eb,
-  &X86Architecture::Table_3_3a_ec,
-  &X86Architecture::Table_3_3a_ed,
-  &X86Architecture::Table_3_3a_ee,
-  &X86Architecture::Table_3_3a_ef,
-  &X86Architecture::Table_3_3a_f0,
-  &X86Architecture::Table_3_3a_f1,
-  &X86Architecture::Table_3_3a_f2,
-  &X86Architecture::Table_3_3a_f3,
-  &X86Architecture::Table_3_3a_f4,
-  &X86Architecture::Table_3_3a_f5,
-  &X86Architecture::Table_3_3a_f6,
-  &X86Architecture::Table_3_3a_f7,
-  &X86Architecture::Table_3_3a_f8,
-  &X86Architecture::Table_3_3a_f9,
-  &X86Architecture::Table_3_3a_fa,
-  &X86Architecture::Table_3_3a_fb,
-  &X86Architecture::Table_3_3a_fc,
-  &X86Architecture::Table_3_3a_fd,
-  &X86Architecture::Table_3_3a_fe,
-  &X86Architecture::Table_3_3a_ff
+const X86Architecture::DecodeEntry X86Architecture::m_Table_3_3a[0x100] =
+{
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x1f4, 0, DecodeHandler }, /* 00 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x1f5, 0, DecodeHandler }, /* 01 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x1f6, 0, DecodeHandler }, /* 02 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* 03 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x1f7, 0, DecodeHandler }, /* 04 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x1f8, 0, DecodeHandler }, /* 05 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x1f9, 0, DecodeHandler }, /* 06 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* 07 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x1fa, 0, DecodeHandler }, /* 08 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x1fb, 0, DecodeHandler }, /* 09 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x1fc, 0, DecodeHandler }, /* 0a */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x1fd, 0, DecodeHandler }, /* 0b */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x1fe, 0, DecodeHandler }, /* 0c */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x1ff, 0, DecodeHandler }, /* 0d */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x200, 0, DecodeHandler }, /* 0e */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x201, 0, DecodeHandler }, /* 0f */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* 10 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* 11 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* 12 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* 13 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x202, 0, DecodeHandler }, /* 14 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x203, 0, DecodeHandler }, /* 15 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x204, 0, DecodeHandler }, /* 16 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x205, 0, DecodeHandler }, /* 17 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x206, 0, DecodeHandler }, /* 18 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x207, 0, DecodeHandler }, /* 19 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* 1a */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* 1b */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* 1c */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x208, 0, DecodeHandler }, /* 1d */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* 1e */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* 1f */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x209, 0, DecodeHandler }, /* 20 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x20a, 0, DecodeHandler }, /* 21 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x20b, 0, DecodeHandler }, /* 22 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* 23 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* 24 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* 25 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* 26 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* 27 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* 28 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* 29 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* 2a */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* 2b */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* 2c */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* 2d */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* 2e */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* 2f */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* 30 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* 31 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* 32 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* 33 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* 34 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* 35 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* 36 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* 37 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x20c, 0, DecodeHandler }, /* 38 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x20d, 0, DecodeHandler }, /* 39 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* 3a */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* 3b */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* 3c */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* 3d */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* 3e */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* 3f */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x20e, 0, DecodeHandler }, /* 40 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x20f, 0, DecodeHandler }, /* 41 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x210, 0, DecodeHandler }, /* 42 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* 43 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x211, 0, DecodeHandler }, /* 44 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* 45 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x212, 0, DecodeHandler }, /* 46 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* 47 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* 48 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* 49 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x213, 0, DecodeHandler }, /* 4a */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x214, 0, DecodeHandler }, /* 4b */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x215, 0, DecodeHandler }, /* 4c */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* 4d */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* 4e */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* 4f */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* 50 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* 51 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* 52 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* 53 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* 54 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* 55 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* 56 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* 57 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* 58 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* 59 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* 5a */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* 5b */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* 5c */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* 5d */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* 5e */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* 5f */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x216, 0, DecodeHandler }, /* 60 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x217, 0, DecodeHandler }, /* 61 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x218, 0, DecodeHandler }, /* 62 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x219, 0, DecodeHandler }, /* 63 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* 64 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* 65 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* 66 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* 67 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* 68 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* 69 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* 6a */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* 6b */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* 6c */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* 6d */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* 6e */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* 6f */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* 70 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* 71 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* 72 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* 73 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* 74 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* 75 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* 76 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* 77 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* 78 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* 79 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* 7a */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* 7b */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* 7c */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* 7d */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* 7e */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* 7f */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* 80 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* 81 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* 82 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* 83 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* 84 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* 85 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* 86 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* 87 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* 88 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* 89 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* 8a */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* 8b */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* 8c */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* 8d */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* 8e */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* 8f */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* 90 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* 91 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* 92 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* 93 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* 94 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* 95 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* 96 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* 97 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* 98 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* 99 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* 9a */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* 9b */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* 9c */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* 9d */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* 9e */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* 9f */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* a0 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* a1 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* a2 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* a3 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* a4 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* a5 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* a6 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* a7 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* a8 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* a9 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* aa */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* ab */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* ac */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* ad */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* ae */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* af */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* b0 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* b1 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* b2 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* b3 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* b4 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* b5 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* b6 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* b7 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* b8 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* b9 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* ba */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* bb */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* bc */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* bd */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* be */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* bf */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* c0 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* c1 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* c2 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* c3 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* c4 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* c5 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* c6 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* c7 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* c8 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* c9 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* ca */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* cb */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* cc */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* cd */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* ce */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* cf */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* d0 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* d1 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* d2 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* d3 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* d4 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* d5 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* d6 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* d7 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* d8 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* d9 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* da */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* db */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* dc */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* dd */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* de */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x21a, 0, DecodeHandler }, /* df */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* e0 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* e1 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* e2 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* e3 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* e4 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* e5 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* e6 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* e7 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* e8 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* e9 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* ea */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* eb */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* ec */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* ed */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* ee */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* ef */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x21b, 0, DecodeHandler }, /* f0 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* f1 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* f2 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* f3 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* f4 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* f5 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* f6 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* f7 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* f8 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* f9 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* fa */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* fb */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* fc */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* fd */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* fe */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }  /* ff */
 };
 
 /** instruction
+ * opcode: 00
  * mnemonic: permq
  * operand: ['Vy', 'Wy', 'Ib']
  * prefix: 66
- * opcode: 00
  * cpu_model: >= X86_Arch_Avx2
 **/
-bool X86Architecture::Table_3_3a_00(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_3_3a_00(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_Avx2 && (rInsn.GetPrefix() & X86_Prefix_OpSize) == X86_Prefix_OpSize)
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Permq);
-      if (Operand__Vy_Wy_Ib(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vy_Wy_Ib<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -284,19 +285,20 @@ bool X86Architecture::Table_3_3a_00(BinaryStream const& rBinStrm, OffsetType Off
 }
 
 /** instruction
+ * opcode: 01
  * mnemonic: permd
  * operand: ['Vy', 'Wy', 'Ib']
  * prefix: 66
- * opcode: 01
  * cpu_model: >= X86_Arch_Avx2
 **/
-bool X86Architecture::Table_3_3a_01(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_3_3a_01(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_Avx2 && (rInsn.GetPrefix() & X86_Prefix_OpSize) == X86_Prefix_OpSize)
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Permd);
-      if (Operand__Vy_Wy_Ib(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vy_Wy_Ib<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -307,19 +309,20 @@ bool X86Architecture::Table_3_3a_01(BinaryStream const& rBinStrm, OffsetType Off
 }
 
 /** instruction
+ * opcode: 02
  * mnemonic: pblendd
  * operand: ['Vx', 'Wx', 'Ib']
  * prefix: 66
- * opcode: 02
  * cpu_model: >= X86_Arch_Avx2
 **/
-bool X86Architecture::Table_3_3a_02(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_3_3a_02(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_Avx2 && (rInsn.GetPrefix() & X86_Prefix_OpSize) == X86_Prefix_OpSize)
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Pblendd);
-      if (Operand__Vx_Wx_Ib(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vx_Wx_Ib<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -330,28 +333,20 @@ bool X86Architecture::Table_3_3a_02(BinaryStream const& rBinStrm, OffsetType Off
 }
 
 /** instruction
- * opcode: 03
- * invalid
-**/
-bool X86Architecture::Table_3_3a_03(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
+ * opcode: 04
  * mnemonic: permilps
  * operand: ['Vx', 'Wx', 'Ib']
  * prefix: 66
- * opcode: 04
  * cpu_model: >= X86_Arch_Avx
 **/
-bool X86Architecture::Table_3_3a_04(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_3_3a_04(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_Avx && (rInsn.GetPrefix() & X86_Prefix_OpSize) == X86_Prefix_OpSize)
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Permilps);
-      if (Operand__Vx_Wx_Ib(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vx_Wx_Ib<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -362,19 +357,20 @@ bool X86Architecture::Table_3_3a_04(BinaryStream const& rBinStrm, OffsetType Off
 }
 
 /** instruction
+ * opcode: 05
  * mnemonic: permilpd
  * operand: ['Vx', 'Wx', 'Ib']
  * prefix: 66
- * opcode: 05
  * cpu_model: >= X86_Arch_Avx
 **/
-bool X86Architecture::Table_3_3a_05(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_3_3a_05(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_Avx && (rInsn.GetPrefix() & X86_Prefix_OpSize) == X86_Prefix_OpSize)
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Permilpd);
-      if (Operand__Vx_Wx_Ib(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vx_Wx_Ib<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -385,19 +381,20 @@ bool X86Architecture::Table_3_3a_05(BinaryStream const& rBinStrm, OffsetType Off
 }
 
 /** instruction
+ * opcode: 06
  * mnemonic: perm2f128
  * operand: ['Vy', 'Hy', 'Wy', 'Ib']
  * prefix: 66
- * opcode: 06
  * cpu_model: >= X86_Arch_Avx
 **/
-bool X86Architecture::Table_3_3a_06(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_3_3a_06(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_Avx && (rInsn.GetPrefix() & X86_Prefix_OpSize) == X86_Prefix_OpSize)
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Perm2f128);
-      if (Operand__Vy_Hy_Wy_Ib(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vy_Hy_Wy_Ib<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -407,15 +404,6 @@ bool X86Architecture::Table_3_3a_06(BinaryStream const& rBinStrm, OffsetType Off
       return false;
 }
 
-/** instruction
- * opcode: 07
- * invalid
-**/
-bool X86Architecture::Table_3_3a_07(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
 /** instructions
  * opcode: 08
  *
@@ -426,18 +414,19 @@ bool X86Architecture::Table_3_3a_07(BinaryStream const& rBinStrm, OffsetType Off
  *
  * mnemonic: roundps
  * operand: ['Vx', 'Wx', 'Ib']
- * prefix: 66
  * attr: ['nv']
+ * prefix: 66
  * cpu_model: >= X86_Arch_Avx
  *
 **/
-bool X86Architecture::Table_3_3a_08(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_3_3a_08(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_Avx && (rInsn.GetPrefix() & X86_Prefix_OpSize) == X86_Prefix_OpSize)
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Roundps);
-      if (Operand__Vx_Wx_Ib(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vx_Wx_Ib<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -447,7 +436,7 @@ bool X86Architecture::Table_3_3a_08(BinaryStream const& rBinStrm, OffsetType Off
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Roundps);
-      if (Operand__Vx_Wx_Ib(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vx_Wx_Ib<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -466,18 +455,19 @@ bool X86Architecture::Table_3_3a_08(BinaryStream const& rBinStrm, OffsetType Off
  *
  * mnemonic: roundpd
  * operand: ['Vx', 'Wx', 'Ib']
- * prefix: 66
  * attr: ['nv']
+ * prefix: 66
  * cpu_model: >= X86_Arch_Avx
  *
 **/
-bool X86Architecture::Table_3_3a_09(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_3_3a_09(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_Avx && (rInsn.GetPrefix() & X86_Prefix_OpSize) == X86_Prefix_OpSize)
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Roundpd);
-      if (Operand__Vx_Wx_Ib(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vx_Wx_Ib<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -487,7 +477,7 @@ bool X86Architecture::Table_3_3a_09(BinaryStream const& rBinStrm, OffsetType Off
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Roundpd);
-      if (Operand__Vx_Wx_Ib(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vx_Wx_Ib<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -506,18 +496,19 @@ bool X86Architecture::Table_3_3a_09(BinaryStream const& rBinStrm, OffsetType Off
  *
  * mnemonic: roundss
  * operand: ['Vo', 'Ho', 'Woq', 'Ib']
- * prefix: 66
  * attr: ['ny']
+ * prefix: 66
  * cpu_model: >= X86_Arch_Avx
  *
 **/
-bool X86Architecture::Table_3_3a_0a(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_3_3a_0a(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_Avx && (rInsn.GetPrefix() & X86_Prefix_OpSize) == X86_Prefix_OpSize)
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Roundss);
-      if (Operand__Vo_Ho_Woq_Ib(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vo_Ho_Woq_Ib<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -527,7 +518,7 @@ bool X86Architecture::Table_3_3a_0a(BinaryStream const& rBinStrm, OffsetType Off
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Roundss);
-      if (Operand__Vo_Woq_Ib(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vo_Woq_Ib<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -546,18 +537,19 @@ bool X86Architecture::Table_3_3a_0a(BinaryStream const& rBinStrm, OffsetType Off
  *
  * mnemonic: roundsd
  * operand: ['Vo', 'Ho', 'Woq', 'Ib']
- * prefix: 66
  * attr: ['ny']
+ * prefix: 66
  * cpu_model: >= X86_Arch_Avx
  *
 **/
-bool X86Architecture::Table_3_3a_0b(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_3_3a_0b(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_Avx && (rInsn.GetPrefix() & X86_Prefix_OpSize) == X86_Prefix_OpSize)
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Roundsd);
-      if (Operand__Vo_Ho_Woq_Ib(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vo_Ho_Woq_Ib<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -567,7 +559,7 @@ bool X86Architecture::Table_3_3a_0b(BinaryStream const& rBinStrm, OffsetType Off
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Roundsd);
-      if (Operand__Vo_Woq_Ib(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vo_Woq_Ib<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -590,13 +582,14 @@ bool X86Architecture::Table_3_3a_0b(BinaryStream const& rBinStrm, OffsetType Off
  * cpu_model: >= X86_Arch_Avx
  *
 **/
-bool X86Architecture::Table_3_3a_0c(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_3_3a_0c(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_Avx && (rInsn.GetPrefix() & X86_Prefix_OpSize) == X86_Prefix_OpSize)
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Blendps);
-      if (Operand__Vx_Wx_Ib(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vx_Wx_Ib<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -606,7 +599,7 @@ bool X86Architecture::Table_3_3a_0c(BinaryStream const& rBinStrm, OffsetType Off
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Blendps);
-      if (Operand__Vx_Wx_Ib(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vx_Wx_Ib<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -629,13 +622,14 @@ bool X86Architecture::Table_3_3a_0c(BinaryStream const& rBinStrm, OffsetType Off
  * cpu_model: >= X86_Arch_Avx
  *
 **/
-bool X86Architecture::Table_3_3a_0d(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_3_3a_0d(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_Avx && (rInsn.GetPrefix() & X86_Prefix_OpSize) == X86_Prefix_OpSize)
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Blendpd);
-      if (Operand__Vx_Wx_Ib(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vx_Wx_Ib<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -645,7 +639,7 @@ bool X86Architecture::Table_3_3a_0d(BinaryStream const& rBinStrm, OffsetType Off
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Blendpd);
-      if (Operand__Vx_Wx_Ib(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vx_Wx_Ib<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -664,8 +658,8 @@ bool X86Architecture::Table_3_3a_0d(BinaryStream const& rBinStrm, OffsetType Off
  *
  * mnemonic: blendw
  * operand: ['Vx', 'Wx', 'Ib']
- * prefix: 66
  * attr: ['ny']
+ * prefix: 66
  * cpu_model: >= X86_Arch_Avx
  *
  * mnemonic: blendw
@@ -674,13 +668,14 @@ bool X86Architecture::Table_3_3a_0d(BinaryStream const& rBinStrm, OffsetType Off
  * cpu_model: >= X86_Arch_Avx2
  *
 **/
-bool X86Architecture::Table_3_3a_0e(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_3_3a_0e(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_Avx2 && (rInsn.GetPrefix() & X86_Prefix_OpSize) == X86_Prefix_OpSize)
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Blendw);
-      if (Operand__Vx_Wx_Ib(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vx_Wx_Ib<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -690,7 +685,7 @@ bool X86Architecture::Table_3_3a_0e(BinaryStream const& rBinStrm, OffsetType Off
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Blendw);
-      if (Operand__Vx_Wx_Ib(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vx_Wx_Ib<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -700,7 +695,7 @@ bool X86Architecture::Table_3_3a_0e(BinaryStream const& rBinStrm, OffsetType Off
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Blendw);
-      if (Operand__Vx_Wx_Ib(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vx_Wx_Ib<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -723,8 +718,8 @@ bool X86Architecture::Table_3_3a_0e(BinaryStream const& rBinStrm, OffsetType Off
  *
  * mnemonic: palignr
  * operand: ['Vx', 'Wx', 'Ib']
- * prefix: 66
  * attr: ['ny']
+ * prefix: 66
  * cpu_model: >= X86_Arch_Avx
  *
  * mnemonic: palignr
@@ -733,13 +728,14 @@ bool X86Architecture::Table_3_3a_0e(BinaryStream const& rBinStrm, OffsetType Off
  * cpu_model: >= X86_Arch_Avx2
  *
 **/
-bool X86Architecture::Table_3_3a_0f(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_3_3a_0f(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_Avx2 && (rInsn.GetPrefix() & X86_Prefix_OpSize) == X86_Prefix_OpSize)
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Palignr);
-      if (Operand__Vx_Wx_Ib(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vx_Wx_Ib<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -749,7 +745,7 @@ bool X86Architecture::Table_3_3a_0f(BinaryStream const& rBinStrm, OffsetType Off
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Palignr);
-      if (Operand__Vx_Wx_Ib(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vx_Wx_Ib<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -759,7 +755,7 @@ bool X86Architecture::Table_3_3a_0f(BinaryStream const& rBinStrm, OffsetType Off
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Palignr);
-      if (Operand__Vx_Wx_Ib(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vx_Wx_Ib<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -769,7 +765,7 @@ bool X86Architecture::Table_3_3a_0f(BinaryStream const& rBinStrm, OffsetType Off
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Palignr);
-      if (Operand__Pq_Qq_Ib(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Pq_Qq_Ib<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -778,42 +774,6 @@ bool X86Architecture::Table_3_3a_0f(BinaryStream const& rBinStrm, OffsetType Off
     return false;
 }
 
-/** instruction
- * opcode: 10
- * invalid
-**/
-bool X86Architecture::Table_3_3a_10(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: 11
- * invalid
-**/
-bool X86Architecture::Table_3_3a_11(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: 12
- * invalid
-**/
-bool X86Architecture::Table_3_3a_12(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: 13
- * invalid
-**/
-bool X86Architecture::Table_3_3a_13(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
 /** instructions
  * opcode: 14
  *
@@ -824,18 +784,19 @@ bool X86Architecture::Table_3_3a_13(BinaryStream const& rBinStrm, OffsetType Off
  *
  * mnemonic: pextrb
  * operand: ['Wob', 'Vo', 'Ib']
- * prefix: 66
  * attr: ['ny', 'nv']
+ * prefix: 66
  * cpu_model: >= X86_Arch_Avx
  *
 **/
-bool X86Architecture::Table_3_3a_14(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_3_3a_14(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_Avx && (rInsn.GetPrefix() & X86_Prefix_OpSize) == X86_Prefix_OpSize)
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Pextrb);
-      if (Operand__Wob_Vo_Ib(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Wob_Vo_Ib<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -845,7 +806,7 @@ bool X86Architecture::Table_3_3a_14(BinaryStream const& rBinStrm, OffsetType Off
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Pextrb);
-      if (Operand__Eyb_Vo_Ib(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Eyb_Vo_Ib<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -864,18 +825,19 @@ bool X86Architecture::Table_3_3a_14(BinaryStream const& rBinStrm, OffsetType Off
  *
  * mnemonic: pextrw
  * operand: ['Wow', 'Vo', 'Ib']
- * prefix: 66
  * attr: ['ny', 'nv']
+ * prefix: 66
  * cpu_model: >= X86_Arch_Avx
  *
 **/
-bool X86Architecture::Table_3_3a_15(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_3_3a_15(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_Avx && (rInsn.GetPrefix() & X86_Prefix_OpSize) == X86_Prefix_OpSize)
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Pextrw);
-      if (Operand__Wow_Vo_Ib(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Wow_Vo_Ib<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -885,7 +847,7 @@ bool X86Architecture::Table_3_3a_15(BinaryStream const& rBinStrm, OffsetType Off
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Pextrw);
-      if (Operand__Eyw_Vo_Ib(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Eyw_Vo_Ib<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -899,25 +861,26 @@ bool X86Architecture::Table_3_3a_15(BinaryStream const& rBinStrm, OffsetType Off
  *
  * mnemonic: pextrd
  * operand: ['Ey', 'Vo', 'Ib']
+ * constraint: f64
  * prefix: 66
  * cpu_model: >= X86_Arch_Sse41
- * constraint: f64
  *
  * mnemonic: pextrd
- * prefix: 66
- * attr: ['ny', 'nv']
- * constraint: f64
  * operand: ['Ey', 'Vo', 'Ib']
+ * constraint: f64
+ * attr: ['ny', 'nv']
+ * prefix: 66
  * cpu_model: >= X86_Arch_Avx
  *
 **/
-bool X86Architecture::Table_3_3a_16(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_3_3a_16(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_Avx && (rInsn.GetPrefix() & X86_Prefix_OpSize) == X86_Prefix_OpSize)
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Pextrd);
-      if (Operand__Ey_Vo_Ib(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Ey_Vo_Ib<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -927,7 +890,7 @@ bool X86Architecture::Table_3_3a_16(BinaryStream const& rBinStrm, OffsetType Off
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Pextrd);
-      if (Operand__Ey_Vo_Ib(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Ey_Vo_Ib<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -946,18 +909,19 @@ bool X86Architecture::Table_3_3a_16(BinaryStream const& rBinStrm, OffsetType Off
  *
  * mnemonic: extractps
  * operand: ['Ey', 'Vo', 'Ib']
- * prefix: 66
  * attr: ['ny', 'nv']
+ * prefix: 66
  * cpu_model: >= X86_Arch_Avx
  *
 **/
-bool X86Architecture::Table_3_3a_17(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_3_3a_17(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_Avx && (rInsn.GetPrefix() & X86_Prefix_OpSize) == X86_Prefix_OpSize)
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Extractps);
-      if (Operand__Ey_Vo_Ib(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Ey_Vo_Ib<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -967,7 +931,7 @@ bool X86Architecture::Table_3_3a_17(BinaryStream const& rBinStrm, OffsetType Off
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Extractps);
-      if (Operand__Ey_Vo_Ib(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Ey_Vo_Ib<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -977,19 +941,20 @@ bool X86Architecture::Table_3_3a_17(BinaryStream const& rBinStrm, OffsetType Off
 }
 
 /** instruction
+ * opcode: 18
  * mnemonic: insertf128
  * operand: ['Vy', 'Hy', 'Wo', 'Ib']
  * prefix: 66
- * opcode: 18
  * cpu_model: >= X86_Arch_Avx
 **/
-bool X86Architecture::Table_3_3a_18(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_3_3a_18(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_Avx && (rInsn.GetPrefix() & X86_Prefix_OpSize) == X86_Prefix_OpSize)
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Insertf128);
-      if (Operand__Vy_Hy_Wo_Ib(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vy_Hy_Wo_Ib<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -1000,19 +965,20 @@ bool X86Architecture::Table_3_3a_18(BinaryStream const& rBinStrm, OffsetType Off
 }
 
 /** instruction
+ * opcode: 19
  * mnemonic: extractf128
  * operand: ['Wo', 'Vy', 'Ib']
  * prefix: 66
- * opcode: 19
  * cpu_model: >= X86_Arch_Avx
 **/
-bool X86Architecture::Table_3_3a_19(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_3_3a_19(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_Avx && (rInsn.GetPrefix() & X86_Prefix_OpSize) == X86_Prefix_OpSize)
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Extractf128);
-      if (Operand__Wo_Vy_Ib(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Wo_Vy_Ib<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -1023,46 +989,20 @@ bool X86Architecture::Table_3_3a_19(BinaryStream const& rBinStrm, OffsetType Off
 }
 
 /** instruction
- * opcode: 1a
- * invalid
-**/
-bool X86Architecture::Table_3_3a_1a(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: 1b
- * invalid
-**/
-bool X86Architecture::Table_3_3a_1b(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: 1c
- * invalid
-**/
-bool X86Architecture::Table_3_3a_1c(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
+ * opcode: 1d
  * mnemonic: cvtps2ph
  * operand: ['Woqo', 'Vx', 'Ib']
  * prefix: 66
- * opcode: 1d
  * cpu_model: >= X86_Arch_F16c
 **/
-bool X86Architecture::Table_3_3a_1d(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_3_3a_1d(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_F16c && (rInsn.GetPrefix() & X86_Prefix_OpSize) == X86_Prefix_OpSize)
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Cvtps2ph);
-      if (Operand__Woqo_Vx_Ib(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Woqo_Vx_Ib<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -1072,24 +1012,6 @@ bool X86Architecture::Table_3_3a_1d(BinaryStream const& rBinStrm, OffsetType Off
       return false;
 }
 
-/** instruction
- * opcode: 1e
- * invalid
-**/
-bool X86Architecture::Table_3_3a_1e(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: 1f
- * invalid
-**/
-bool X86Architecture::Table_3_3a_1f(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
 /** instructions
  * opcode: 20
  *
@@ -1100,18 +1022,19 @@ bool X86Architecture::Table_3_3a_1f(BinaryStream const& rBinStrm, OffsetType Off
  *
  * mnemonic: pinsrb
  * operand: ['Vo', 'Ho', 'Edb', 'Ib']
- * prefix: 66
  * attr: ['ny']
+ * prefix: 66
  * cpu_model: >= X86_Arch_Avx
  *
 **/
-bool X86Architecture::Table_3_3a_20(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_3_3a_20(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_Avx && (rInsn.GetPrefix() & X86_Prefix_OpSize) == X86_Prefix_OpSize)
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Pinsrb);
-      if (Operand__Vo_Ho_Edb_Ib(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vo_Ho_Edb_Ib<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -1121,7 +1044,7 @@ bool X86Architecture::Table_3_3a_20(BinaryStream const& rBinStrm, OffsetType Off
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Pinsrb);
-      if (Operand__Vo_Edb_Ib(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vo_Edb_Ib<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -1140,18 +1063,19 @@ bool X86Architecture::Table_3_3a_20(BinaryStream const& rBinStrm, OffsetType Off
  *
  * mnemonic: insertps
  * operand: ['Vo', 'Ho', 'Uod', 'Ib']
- * prefix: 66
  * attr: ['ny']
+ * prefix: 66
  * cpu_model: >= X86_Arch_Avx
  *
 **/
-bool X86Architecture::Table_3_3a_21(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_3_3a_21(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_Avx && (rInsn.GetPrefix() & X86_Prefix_OpSize) == X86_Prefix_OpSize)
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Insertps);
-      if (Operand__Vo_Ho_Uod_Ib(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vo_Ho_Uod_Ib<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -1161,7 +1085,7 @@ bool X86Architecture::Table_3_3a_21(BinaryStream const& rBinStrm, OffsetType Off
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Insertps);
-      if (Operand__Vo_Uod_Ib(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vo_Uod_Ib<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -1180,18 +1104,19 @@ bool X86Architecture::Table_3_3a_21(BinaryStream const& rBinStrm, OffsetType Off
  *
  * mnemonic: pinsrd
  * operand: ['Vo', 'Ho', 'Ey', 'Ib']
- * prefix: 66
  * attr: ['ny']
+ * prefix: 66
  * cpu_model: >= X86_Arch_Avx
  *
 **/
-bool X86Architecture::Table_3_3a_22(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_3_3a_22(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_Avx && (rInsn.GetPrefix() & X86_Prefix_OpSize) == X86_Prefix_OpSize)
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Pinsrd);
-      if (Operand__Vo_Ho_Ey_Ib(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vo_Ho_Ey_Ib<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -1201,7 +1126,7 @@ bool X86Architecture::Table_3_3a_22(BinaryStream const& rBinStrm, OffsetType Off
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Pinsrd);
-      if (Operand__Vo_Ey_Ib(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vo_Ey_Ib<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -1211,208 +1136,20 @@ bool X86Architecture::Table_3_3a_22(BinaryStream const& rBinStrm, OffsetType Off
 }
 
 /** instruction
- * opcode: 23
- * invalid
-**/
-bool X86Architecture::Table_3_3a_23(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: 24
- * invalid
-**/
-bool X86Architecture::Table_3_3a_24(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: 25
- * invalid
-**/
-bool X86Architecture::Table_3_3a_25(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: 26
- * invalid
-**/
-bool X86Architecture::Table_3_3a_26(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: 27
- * invalid
-**/
-bool X86Architecture::Table_3_3a_27(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: 28
- * invalid
-**/
-bool X86Architecture::Table_3_3a_28(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: 29
- * invalid
-**/
-bool X86Architecture::Table_3_3a_29(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: 2a
- * invalid
-**/
-bool X86Architecture::Table_3_3a_2a(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: 2b
- * invalid
-**/
-bool X86Architecture::Table_3_3a_2b(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: 2c
- * invalid
-**/
-bool X86Architecture::Table_3_3a_2c(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: 2d
- * invalid
-**/
-bool X86Architecture::Table_3_3a_2d(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: 2e
- * invalid
-**/
-bool X86Architecture::Table_3_3a_2e(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: 2f
- * invalid
-**/
-bool X86Architecture::Table_3_3a_2f(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: 30
- * invalid
-**/
-bool X86Architecture::Table_3_3a_30(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: 31
- * invalid
-**/
-bool X86Architecture::Table_3_3a_31(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: 32
- * invalid
-**/
-bool X86Architecture::Table_3_3a_32(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: 33
- * invalid
-**/
-bool X86Architecture::Table_3_3a_33(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: 34
- * invalid
-**/
-bool X86Architecture::Table_3_3a_34(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: 35
- * invalid
-**/
-bool X86Architecture::Table_3_3a_35(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: 36
- * invalid
-**/
-bool X86Architecture::Table_3_3a_36(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: 37
- * invalid
-**/
-bool X86Architecture::Table_3_3a_37(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
+ * opcode: 38
  * mnemonic: inserti128
  * operand: ['Vy', 'Hy', 'Wo', 'Ib']
  * prefix: 66
- * opcode: 38
  * cpu_model: >= X86_Arch_Avx2
 **/
-bool X86Architecture::Table_3_3a_38(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_3_3a_38(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_Avx2 && (rInsn.GetPrefix() & X86_Prefix_OpSize) == X86_Prefix_OpSize)
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Inserti128);
-      if (Operand__Vy_Hy_Wo_Ib(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vy_Hy_Wo_Ib<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -1423,20 +1160,21 @@ bool X86Architecture::Table_3_3a_38(BinaryStream const& rBinStrm, OffsetType Off
 }
 
 /** instruction
- * mnemonic: extracti128
- * prefix: 66
  * opcode: 39
- * attr: ['nv']
+ * mnemonic: extracti128
  * operand: ['Wo', 'Vy', 'Ib']
+ * attr: ['nv']
+ * prefix: 66
  * cpu_model: >= X86_Arch_Avx2
 **/
-bool X86Architecture::Table_3_3a_39(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_3_3a_39(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_Avx2 && (rInsn.GetPrefix() & X86_Prefix_OpSize) == X86_Prefix_OpSize)
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Extracti128);
-      if (Operand__Wo_Vy_Ib(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Wo_Vy_Ib<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -1446,60 +1184,6 @@ bool X86Architecture::Table_3_3a_39(BinaryStream const& rBinStrm, OffsetType Off
       return false;
 }
 
-/** instruction
- * opcode: 3a
- * invalid
-**/
-bool X86Architecture::Table_3_3a_3a(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: 3b
- * invalid
-**/
-bool X86Architecture::Table_3_3a_3b(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: 3c
- * invalid
-**/
-bool X86Architecture::Table_3_3a_3c(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: 3d
- * invalid
-**/
-bool X86Architecture::Table_3_3a_3d(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: 3e
- * invalid
-**/
-bool X86Architecture::Table_3_3a_3e(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: 3f
- * invalid
-**/
-bool X86Architecture::Table_3_3a_3f(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
 /** instructions
  * opcode: 40
  *
@@ -1514,13 +1198,14 @@ bool X86Architecture::Table_3_3a_3f(BinaryStream const& rBinStrm, OffsetType Off
  * cpu_model: >= X86_Arch_Avx
  *
 **/
-bool X86Architecture::Table_3_3a_40(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_3_3a_40(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_Avx && (rInsn.GetPrefix() & X86_Prefix_OpSize) == X86_Prefix_OpSize)
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Dpps);
-      if (Operand__Vx_Wx_Ib(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vx_Wx_Ib<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -1530,7 +1215,7 @@ bool X86Architecture::Table_3_3a_40(BinaryStream const& rBinStrm, OffsetType Off
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Dpps);
-      if (Operand__Vx_Wx_Ib(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vx_Wx_Ib<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -1549,18 +1234,19 @@ bool X86Architecture::Table_3_3a_40(BinaryStream const& rBinStrm, OffsetType Off
  *
  * mnemonic: dppd
  * operand: ['Vo', 'Ho', 'Wo', 'Ib']
- * prefix: 66
  * attr: ['ny']
+ * prefix: 66
  * cpu_model: >= X86_Arch_Avx
  *
 **/
-bool X86Architecture::Table_3_3a_41(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_3_3a_41(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_Avx && (rInsn.GetPrefix() & X86_Prefix_OpSize) == X86_Prefix_OpSize)
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Dppd);
-      if (Operand__Vo_Ho_Wo_Ib(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vo_Ho_Wo_Ib<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -1570,7 +1256,7 @@ bool X86Architecture::Table_3_3a_41(BinaryStream const& rBinStrm, OffsetType Off
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Dppd);
-      if (Operand__Vo_Wo_Ib(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vo_Wo_Ib<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -1589,8 +1275,8 @@ bool X86Architecture::Table_3_3a_41(BinaryStream const& rBinStrm, OffsetType Off
  *
  * mnemonic: mpsadbw
  * operand: ['Vx', 'Wx', 'Ib']
- * prefix: 66
  * attr: ['ny']
+ * prefix: 66
  * cpu_model: >= X86_Arch_Avx
  *
  * mnemonic: mpsadbw
@@ -1599,13 +1285,14 @@ bool X86Architecture::Table_3_3a_41(BinaryStream const& rBinStrm, OffsetType Off
  * cpu_model: >= X86_Arch_Avx2
  *
 **/
-bool X86Architecture::Table_3_3a_42(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_3_3a_42(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_Avx2 && (rInsn.GetPrefix() & X86_Prefix_OpSize) == X86_Prefix_OpSize)
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Mpsadbw);
-      if (Operand__Vx_Wx_Ib(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vx_Wx_Ib<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -1615,7 +1302,7 @@ bool X86Architecture::Table_3_3a_42(BinaryStream const& rBinStrm, OffsetType Off
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Mpsadbw);
-      if (Operand__Vx_Wx_Ib(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vx_Wx_Ib<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -1625,7 +1312,7 @@ bool X86Architecture::Table_3_3a_42(BinaryStream const& rBinStrm, OffsetType Off
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Mpsadbw);
-      if (Operand__Vx_Wx_Ib(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vx_Wx_Ib<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -1634,15 +1321,6 @@ bool X86Architecture::Table_3_3a_42(BinaryStream const& rBinStrm, OffsetType Off
     return false;
 }
 
-/** instruction
- * opcode: 43
- * invalid
-**/
-bool X86Architecture::Table_3_3a_43(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
 /** instructions
  * opcode: 44
  *
@@ -1653,18 +1331,19 @@ bool X86Architecture::Table_3_3a_43(BinaryStream const& rBinStrm, OffsetType Off
  *
  * mnemonic: pclmulqdq
  * operand: ['Vo', 'Ho', 'Wo', 'Ib']
- * prefix: 66
  * attr: ['ny']
+ * prefix: 66
  * cpu_model: >= X86_Arch_Avx
  *
 **/
-bool X86Architecture::Table_3_3a_44(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_3_3a_44(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_Avx && (rInsn.GetPrefix() & X86_Prefix_OpSize) == X86_Prefix_OpSize)
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Pclmulqdq);
-      if (Operand__Vo_Ho_Wo_Ib(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vo_Ho_Wo_Ib<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -1674,7 +1353,7 @@ bool X86Architecture::Table_3_3a_44(BinaryStream const& rBinStrm, OffsetType Off
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Pclmulqdq);
-      if (Operand__Vo_Wo_Ib(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vo_Wo_Ib<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -1684,28 +1363,20 @@ bool X86Architecture::Table_3_3a_44(BinaryStream const& rBinStrm, OffsetType Off
 }
 
 /** instruction
- * opcode: 45
- * invalid
-**/
-bool X86Architecture::Table_3_3a_45(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
+ * opcode: 46
  * mnemonic: perm2i128
  * operand: ['Vy', 'Hy', 'Wy', 'Ib']
  * prefix: 66
- * opcode: 46
  * cpu_model: >= X86_Arch_Avx2
 **/
-bool X86Architecture::Table_3_3a_46(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_3_3a_46(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_Avx2 && (rInsn.GetPrefix() & X86_Prefix_OpSize) == X86_Prefix_OpSize)
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Perm2i128);
-      if (Operand__Vy_Hy_Wy_Ib(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vy_Hy_Wy_Ib<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -1716,46 +1387,20 @@ bool X86Architecture::Table_3_3a_46(BinaryStream const& rBinStrm, OffsetType Off
 }
 
 /** instruction
- * opcode: 47
- * invalid
-**/
-bool X86Architecture::Table_3_3a_47(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: 48
- * invalid
-**/
-bool X86Architecture::Table_3_3a_48(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: 49
- * invalid
-**/
-bool X86Architecture::Table_3_3a_49(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
+ * opcode: 4a
  * mnemonic: blendvps
  * operand: ['Vx', 'Hx', 'Wx', 'Lx']
  * prefix: 66
- * opcode: 4a
  * cpu_model: >= X86_Arch_Avx
 **/
-bool X86Architecture::Table_3_3a_4a(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_3_3a_4a(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_Avx && (rInsn.GetPrefix() & X86_Prefix_OpSize) == X86_Prefix_OpSize)
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Blendvps);
-      if (Operand__Vx_Hx_Wx_Lx(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vx_Hx_Wx_Lx<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -1766,19 +1411,20 @@ bool X86Architecture::Table_3_3a_4a(BinaryStream const& rBinStrm, OffsetType Off
 }
 
 /** instruction
+ * opcode: 4b
  * mnemonic: blendvpd
  * operand: ['Vx', 'Hx', 'Wx', 'Lx']
  * prefix: 66
- * opcode: 4b
  * cpu_model: >= X86_Arch_Avx
 **/
-bool X86Architecture::Table_3_3a_4b(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_3_3a_4b(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_Avx && (rInsn.GetPrefix() & X86_Prefix_OpSize) == X86_Prefix_OpSize)
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Blendvpd);
-      if (Operand__Vx_Hx_Wx_Lx(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vx_Hx_Wx_Lx<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -1793,8 +1439,8 @@ bool X86Architecture::Table_3_3a_4b(BinaryStream const& rBinStrm, OffsetType Off
  *
  * mnemonic: pblendvp
  * operand: ['Vx', 'Hx', 'Wx', 'Lx']
- * prefix: 66
  * attr: ['ny']
+ * prefix: 66
  * cpu_model: >= X86_Arch_Avx
  *
  * mnemonic: pblendvp
@@ -1803,13 +1449,14 @@ bool X86Architecture::Table_3_3a_4b(BinaryStream const& rBinStrm, OffsetType Off
  * cpu_model: >= X86_Arch_Avx2
  *
 **/
-bool X86Architecture::Table_3_3a_4c(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_3_3a_4c(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_Avx2 && (rInsn.GetPrefix() & X86_Prefix_OpSize) == X86_Prefix_OpSize)
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Pblendvp);
-      if (Operand__Vx_Hx_Wx_Lx(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vx_Hx_Wx_Lx<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -1819,7 +1466,7 @@ bool X86Architecture::Table_3_3a_4c(BinaryStream const& rBinStrm, OffsetType Off
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Pblendvp);
-      if (Operand__Vx_Hx_Wx_Lx(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vx_Hx_Wx_Lx<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -1828,177 +1475,6 @@ bool X86Architecture::Table_3_3a_4c(BinaryStream const& rBinStrm, OffsetType Off
     return false;
 }
 
-/** instruction
- * opcode: 4d
- * invalid
-**/
-bool X86Architecture::Table_3_3a_4d(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: 4e
- * invalid
-**/
-bool X86Architecture::Table_3_3a_4e(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: 4f
- * invalid
-**/
-bool X86Architecture::Table_3_3a_4f(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: 50
- * invalid
-**/
-bool X86Architecture::Table_3_3a_50(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: 51
- * invalid
-**/
-bool X86Architecture::Table_3_3a_51(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: 52
- * invalid
-**/
-bool X86Architecture::Table_3_3a_52(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: 53
- * invalid
-**/
-bool X86Architecture::Table_3_3a_53(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: 54
- * invalid
-**/
-bool X86Architecture::Table_3_3a_54(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: 55
- * invalid
-**/
-bool X86Architecture::Table_3_3a_55(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: 56
- * invalid
-**/
-bool X86Architecture::Table_3_3a_56(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: 57
- * invalid
-**/
-bool X86Architecture::Table_3_3a_57(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: 58
- * invalid
-**/
-bool X86Architecture::Table_3_3a_58(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: 59
- * invalid
-**/
-bool X86Architecture::Table_3_3a_59(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: 5a
- * invalid
-**/
-bool X86Architecture::Table_3_3a_5a(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: 5b
- * invalid
-**/
-bool X86Architecture::Table_3_3a_5b(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: 5c
- * invalid
-**/
-bool X86Architecture::Table_3_3a_5c(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: 5d
- * invalid
-**/
-bool X86Architecture::Table_3_3a_5d(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: 5e
- * invalid
-**/
-bool X86Architecture::Table_3_3a_5e(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: 5f
- * invalid
-**/
-bool X86Architecture::Table_3_3a_5f(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
 /** instructions
  * opcode: 60
  *
@@ -2009,18 +1485,19 @@ bool X86Architecture::Table_3_3a_5f(BinaryStream const& rBinStrm, OffsetType Off
  *
  * mnemonic: pcmpestrm
  * operand: ['Vo', 'Wo', 'Ib']
- * prefix: 66
  * attr: ['ny', 'nv']
+ * prefix: 66
  * cpu_model: >= X86_Arch_Avx
  *
 **/
-bool X86Architecture::Table_3_3a_60(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_3_3a_60(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_Avx && (rInsn.GetPrefix() & X86_Prefix_OpSize) == X86_Prefix_OpSize)
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Pcmpestrm);
-      if (Operand__Vo_Wo_Ib(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vo_Wo_Ib<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -2030,7 +1507,7 @@ bool X86Architecture::Table_3_3a_60(BinaryStream const& rBinStrm, OffsetType Off
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Pcmpestrm);
-      if (Operand__Vo_Wo_Ib(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vo_Wo_Ib<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -2049,18 +1526,19 @@ bool X86Architecture::Table_3_3a_60(BinaryStream const& rBinStrm, OffsetType Off
  *
  * mnemonic: pcmpestri
  * operand: ['Vo', 'Wo', 'Ib']
- * prefix: 66
  * attr: ['ny', 'nv']
+ * prefix: 66
  * cpu_model: >= X86_Arch_Avx
  *
 **/
-bool X86Architecture::Table_3_3a_61(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_3_3a_61(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_Avx && (rInsn.GetPrefix() & X86_Prefix_OpSize) == X86_Prefix_OpSize)
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Pcmpestri);
-      if (Operand__Vo_Wo_Ib(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vo_Wo_Ib<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -2070,7 +1548,7 @@ bool X86Architecture::Table_3_3a_61(BinaryStream const& rBinStrm, OffsetType Off
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Pcmpestri);
-      if (Operand__Vo_Wo_Ib(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vo_Wo_Ib<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -2089,18 +1567,19 @@ bool X86Architecture::Table_3_3a_61(BinaryStream const& rBinStrm, OffsetType Off
  *
  * mnemonic: pcmpistrm
  * operand: ['Vo', 'Wo', 'Ib']
- * prefix: 66
  * attr: ['ny', 'nv']
+ * prefix: 66
  * cpu_model: >= X86_Arch_Avx
  *
 **/
-bool X86Architecture::Table_3_3a_62(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_3_3a_62(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_Avx && (rInsn.GetPrefix() & X86_Prefix_OpSize) == X86_Prefix_OpSize)
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Pcmpistrm);
-      if (Operand__Vo_Wo_Ib(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vo_Wo_Ib<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -2110,7 +1589,7 @@ bool X86Architecture::Table_3_3a_62(BinaryStream const& rBinStrm, OffsetType Off
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Pcmpistrm);
-      if (Operand__Vo_Wo_Ib(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vo_Wo_Ib<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -2129,18 +1608,19 @@ bool X86Architecture::Table_3_3a_62(BinaryStream const& rBinStrm, OffsetType Off
  *
  * mnemonic: pcmpistri
  * operand: ['Vo', 'Wo', 'Ib']
- * prefix: 66
  * attr: ['ny', 'nv']
+ * prefix: 66
  * cpu_model: >= X86_Arch_Avx
  *
 **/
-bool X86Architecture::Table_3_3a_63(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_3_3a_63(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_Avx && (rInsn.GetPrefix() & X86_Prefix_OpSize) == X86_Prefix_OpSize)
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Pcmpistri);
-      if (Operand__Vo_Wo_Ib(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vo_Wo_Ib<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -2150,7 +1630,7 @@ bool X86Architecture::Table_3_3a_63(BinaryStream const& rBinStrm, OffsetType Off
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Pcmpistri);
-      if (Operand__Vo_Wo_Ib(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__Vo_Wo_Ib<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -2159,1312 +1639,63 @@ bool X86Architecture::Table_3_3a_63(BinaryStream const& rBinStrm, OffsetType Off
     return false;
 }
 
-/** instruction
- * opcode: 64
- * invalid
-**/
-bool X86Architecture::Table_3_3a_64(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: 65
- * invalid
-**/
-bool X86Architecture::Table_3_3a_65(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: 66
- * invalid
-**/
-bool X86Architecture::Table_3_3a_66(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: 67
- * invalid
-**/
-bool X86Architecture::Table_3_3a_67(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: 68
- * invalid
-**/
-bool X86Architecture::Table_3_3a_68(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: 69
- * invalid
-**/
-bool X86Architecture::Table_3_3a_69(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: 6a
- * invalid
-**/
-bool X86Architecture::Table_3_3a_6a(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: 6b
- * invalid
-**/
-bool X86Architecture::Table_3_3a_6b(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: 6c
- * invalid
-**/
-bool X86Architecture::Table_3_3a_6c(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: 6d
- * invalid
-**/
-bool X86Architecture::Table_3_3a_6d(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: 6e
- * invalid
-**/
-bool X86Architecture::Table_3_3a_6e(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: 6f
- * invalid
-**/
-bool X86Architecture::Table_3_3a_6f(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: 70
- * invalid
-**/
-bool X86Architecture::Table_3_3a_70(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: 71
- * invalid
-**/
-bool X86Architecture::Table_3_3a_71(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: 72
- * invalid
-**/
-bool X86Architecture::Table_3_3a_72(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: 73
- * invalid
-**/
-bool X86Architecture::Table_3_3a_73(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: 74
- * invalid
+/** instructions
+ * opcode: df
+ *
+ * mnemonic: aeskeygenassist
+ * operand: ['Vo', 'Wo', 'Ib']
+ * prefix: 66
+ * cpu_model: >= X86_Arch_Aes
+ *
+ * mnemonic: aeskeygenassist
+ * operand: ['Vo', 'Wo', 'Ib']
+ * attr: ['ny', 'nc']
+ * prefix: 66
+ * cpu_model: >= X86_Arch_Avx
+ *
 **/
-bool X86Architecture::Table_3_3a_74(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_3_3a_df(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
-    return false; /* INVALID */
+    if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_Avx && (rInsn.GetPrefix() & X86_Prefix_OpSize) == X86_Prefix_OpSize)
+    {
+      rInsn.Size()++;
+      rInsn.SetOpcode(X86_Opcode_Aeskeygenassist);
+      if (Operand__Vo_Wo_Ib<Mode>(rBinStrm, Offset, rInsn) == false)
+      {
+        return false;
+      }
+      return true;
+    }
+    else if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_Aes && (rInsn.GetPrefix() & X86_Prefix_OpSize) == X86_Prefix_OpSize)
+    {
+      rInsn.Size()++;
+      rInsn.SetOpcode(X86_Opcode_Aeskeygenassist);
+      if (Operand__Vo_Wo_Ib<Mode>(rBinStrm, Offset, rInsn) == false)
+      {
+        return false;
+      }
+      return true;
+    }
+    return false;
 }
 
 /** instruction
- * opcode: 75
- * invalid
+ * opcode: f0
+ * mnemonic: rorx
+ * operand: ['By', 'Ey', 'Ib']
+ * attr: ['ny', 'nv']
+ * prefix: f2
+ * cpu_model: >= X86_Arch_Bmi2
 **/
-bool X86Architecture::Table_3_3a_75(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: 76
- * invalid
-**/
-bool X86Architecture::Table_3_3a_76(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: 77
- * invalid
-**/
-bool X86Architecture::Table_3_3a_77(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: 78
- * invalid
-**/
-bool X86Architecture::Table_3_3a_78(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: 79
- * invalid
-**/
-bool X86Architecture::Table_3_3a_79(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: 7a
- * invalid
-**/
-bool X86Architecture::Table_3_3a_7a(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: 7b
- * invalid
-**/
-bool X86Architecture::Table_3_3a_7b(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: 7c
- * invalid
-**/
-bool X86Architecture::Table_3_3a_7c(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: 7d
- * invalid
-**/
-bool X86Architecture::Table_3_3a_7d(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: 7e
- * invalid
-**/
-bool X86Architecture::Table_3_3a_7e(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: 7f
- * invalid
-**/
-bool X86Architecture::Table_3_3a_7f(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: 80
- * invalid
-**/
-bool X86Architecture::Table_3_3a_80(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: 81
- * invalid
-**/
-bool X86Architecture::Table_3_3a_81(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: 82
- * invalid
-**/
-bool X86Architecture::Table_3_3a_82(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: 83
- * invalid
-**/
-bool X86Architecture::Table_3_3a_83(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: 84
- * invalid
-**/
-bool X86Architecture::Table_3_3a_84(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: 85
- * invalid
-**/
-bool X86Architecture::Table_3_3a_85(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: 86
- * invalid
-**/
-bool X86Architecture::Table_3_3a_86(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: 87
- * invalid
-**/
-bool X86Architecture::Table_3_3a_87(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: 88
- * invalid
-**/
-bool X86Architecture::Table_3_3a_88(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: 89
- * invalid
-**/
-bool X86Architecture::Table_3_3a_89(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: 8a
- * invalid
-**/
-bool X86Architecture::Table_3_3a_8a(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: 8b
- * invalid
-**/
-bool X86Architecture::Table_3_3a_8b(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: 8c
- * invalid
-**/
-bool X86Architecture::Table_3_3a_8c(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: 8d
- * invalid
-**/
-bool X86Architecture::Table_3_3a_8d(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: 8e
- * invalid
-**/
-bool X86Architecture::Table_3_3a_8e(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: 8f
- * invalid
-**/
-bool X86Architecture::Table_3_3a_8f(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: 90
- * invalid
-**/
-bool X86Architecture::Table_3_3a_90(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: 91
- * invalid
-**/
-bool X86Architecture::Table_3_3a_91(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: 92
- * invalid
-**/
-bool X86Architecture::Table_3_3a_92(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: 93
- * invalid
-**/
-bool X86Architecture::Table_3_3a_93(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: 94
- * invalid
-**/
-bool X86Architecture::Table_3_3a_94(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: 95
- * invalid
-**/
-bool X86Architecture::Table_3_3a_95(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: 96
- * invalid
-**/
-bool X86Architecture::Table_3_3a_96(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: 97
- * invalid
-**/
-bool X86Architecture::Table_3_3a_97(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: 98
- * invalid
-**/
-bool X86Architecture::Table_3_3a_98(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: 99
- * invalid
-**/
-bool X86Architecture::Table_3_3a_99(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: 9a
- * invalid
-**/
-bool X86Architecture::Table_3_3a_9a(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: 9b
- * invalid
-**/
-bool X86Architecture::Table_3_3a_9b(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: 9c
- * invalid
-**/
-bool X86Architecture::Table_3_3a_9c(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: 9d
- * invalid
-**/
-bool X86Architecture::Table_3_3a_9d(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: 9e
- * invalid
-**/
-bool X86Architecture::Table_3_3a_9e(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: 9f
- * invalid
-**/
-bool X86Architecture::Table_3_3a_9f(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: a0
- * invalid
-**/
-bool X86Architecture::Table_3_3a_a0(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: a1
- * invalid
-**/
-bool X86Architecture::Table_3_3a_a1(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: a2
- * invalid
-**/
-bool X86Architecture::Table_3_3a_a2(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: a3
- * invalid
-**/
-bool X86Architecture::Table_3_3a_a3(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: a4
- * invalid
-**/
-bool X86Architecture::Table_3_3a_a4(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: a5
- * invalid
-**/
-bool X86Architecture::Table_3_3a_a5(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: a6
- * invalid
-**/
-bool X86Architecture::Table_3_3a_a6(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: a7
- * invalid
-**/
-bool X86Architecture::Table_3_3a_a7(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: a8
- * invalid
-**/
-bool X86Architecture::Table_3_3a_a8(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: a9
- * invalid
-**/
-bool X86Architecture::Table_3_3a_a9(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: aa
- * invalid
-**/
-bool X86Architecture::Table_3_3a_aa(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: ab
- * invalid
-**/
-bool X86Architecture::Table_3_3a_ab(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: ac
- * invalid
-**/
-bool X86Architecture::Table_3_3a_ac(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: ad
- * invalid
-**/
-bool X86Architecture::Table_3_3a_ad(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: ae
- * invalid
-**/
-bool X86Architecture::Table_3_3a_ae(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: af
- * invalid
-**/
-bool X86Architecture::Table_3_3a_af(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: b0
- * invalid
-**/
-bool X86Architecture::Table_3_3a_b0(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: b1
- * invalid
-**/
-bool X86Architecture::Table_3_3a_b1(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: b2
- * invalid
-**/
-bool X86Architecture::Table_3_3a_b2(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: b3
- * invalid
-**/
-bool X86Architecture::Table_3_3a_b3(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: b4
- * invalid
-**/
-bool X86Architecture::Table_3_3a_b4(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: b5
- * invalid
-**/
-bool X86Architecture::Table_3_3a_b5(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: b6
- * invalid
-**/
-bool X86Architecture::Table_3_3a_b6(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: b7
- * invalid
-**/
-bool X86Architecture::Table_3_3a_b7(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: b8
- * invalid
-**/
-bool X86Architecture::Table_3_3a_b8(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: b9
- * invalid
-**/
-bool X86Architecture::Table_3_3a_b9(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: ba
- * invalid
-**/
-bool X86Architecture::Table_3_3a_ba(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: bb
- * invalid
-**/
-bool X86Architecture::Table_3_3a_bb(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: bc
- * invalid
-**/
-bool X86Architecture::Table_3_3a_bc(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: bd
- * invalid
-**/
-bool X86Architecture::Table_3_3a_bd(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: be
- * invalid
-**/
-bool X86Architecture::Table_3_3a_be(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: bf
- * invalid
-**/
-bool X86Architecture::Table_3_3a_bf(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: c0
- * invalid
-**/
-bool X86Architecture::Table_3_3a_c0(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: c1
- * invalid
-**/
-bool X86Architecture::Table_3_3a_c1(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: c2
- * invalid
-**/
-bool X86Architecture::Table_3_3a_c2(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: c3
- * invalid
-**/
-bool X86Architecture::Table_3_3a_c3(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: c4
- * invalid
-**/
-bool X86Architecture::Table_3_3a_c4(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: c5
- * invalid
-**/
-bool X86Architecture::Table_3_3a_c5(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: c6
- * invalid
-**/
-bool X86Architecture::Table_3_3a_c6(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: c7
- * invalid
-**/
-bool X86Architecture::Table_3_3a_c7(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: c8
- * invalid
-**/
-bool X86Architecture::Table_3_3a_c8(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: c9
- * invalid
-**/
-bool X86Architecture::Table_3_3a_c9(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: ca
- * invalid
-**/
-bool X86Architecture::Table_3_3a_ca(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: cb
- * invalid
-**/
-bool X86Architecture::Table_3_3a_cb(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: cc
- * invalid
-**/
-bool X86Architecture::Table_3_3a_cc(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: cd
- * invalid
-**/
-bool X86Architecture::Table_3_3a_cd(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: ce
- * invalid
-**/
-bool X86Architecture::Table_3_3a_ce(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: cf
- * invalid
-**/
-bool X86Architecture::Table_3_3a_cf(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: d0
- * invalid
-**/
-bool X86Architecture::Table_3_3a_d0(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: d1
- * invalid
-**/
-bool X86Architecture::Table_3_3a_d1(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: d2
- * invalid
-**/
-bool X86Architecture::Table_3_3a_d2(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: d3
- * invalid
-**/
-bool X86Architecture::Table_3_3a_d3(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: d4
- * invalid
-**/
-bool X86Architecture::Table_3_3a_d4(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: d5
- * invalid
-**/
-bool X86Architecture::Table_3_3a_d5(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: d6
- * invalid
-**/
-bool X86Architecture::Table_3_3a_d6(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: d7
- * invalid
-**/
-bool X86Architecture::Table_3_3a_d7(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: d8
- * invalid
-**/
-bool X86Architecture::Table_3_3a_d8(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: d9
- * invalid
-**/
-bool X86Architecture::Table_3_3a_d9(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: da
- * invalid
-**/
-bool X86Architecture::Table_3_3a_da(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: db
- * invalid
-**/
-bool X86Architecture::Table_3_3a_db(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: dc
- * invalid
-**/
-bool X86Architecture::Table_3_3a_dc(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: dd
- * invalid
-**/
-bool X86Architecture::Table_3_3a_dd(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: de
- * invalid
-**/
-bool X86Architecture::Table_3_3a_de(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instructions
- * opcode: df
- *
- * mnemonic: aeskeygenassist
- * operand: ['Vo', 'Wo', 'Ib']
- * prefix: 66
- * cpu_model: >= X86_Arch_Aes
- *
- * mnemonic: aeskeygenassist
- * operand: ['Vo', 'Wo', 'Ib']
- * prefix: 66
- * attr: ['ny', 'nc']
- * cpu_model: >= X86_Arch_Avx
- *
-**/
-bool X86Architecture::Table_3_3a_df(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_Avx && (rInsn.GetPrefix() & X86_Prefix_OpSize) == X86_Prefix_OpSize)
-    {
-      rInsn.Size()++;
-      rInsn.SetOpcode(X86_Opcode_Aeskeygenassist);
-      if (Operand__Vo_Wo_Ib(rBinStrm, Offset, rInsn, Mode) == false)
-      {
-        return false;
-      }
-      return true;
-    }
-    else if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_Aes && (rInsn.GetPrefix() & X86_Prefix_OpSize) == X86_Prefix_OpSize)
-    {
-      rInsn.Size()++;
-      rInsn.SetOpcode(X86_Opcode_Aeskeygenassist);
-      if (Operand__Vo_Wo_Ib(rBinStrm, Offset, rInsn, Mode) == false)
-      {
-        return false;
-      }
-      return true;
-    }
-    return false;
-}
-
-/** instruction
- * opcode: e0
- * invalid
-**/
-bool X86Architecture::Table_3_3a_e0(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: e1
- * invalid
-**/
-bool X86Architecture::Table_3_3a_e1(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: e2
- * invalid
-**/
-bool X86Architecture::Table_3_3a_e2(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: e3
- * invalid
-**/
-bool X86Architecture::Table_3_3a_e3(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: e4
- * invalid
-**/
-bool X86Architecture::Table_3_3a_e4(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: e5
- * invalid
-**/
-bool X86Architecture::Table_3_3a_e5(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: e6
- * invalid
-**/
-bool X86Architecture::Table_3_3a_e6(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: e7
- * invalid
-**/
-bool X86Architecture::Table_3_3a_e7(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: e8
- * invalid
-**/
-bool X86Architecture::Table_3_3a_e8(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: e9
- * invalid
-**/
-bool X86Architecture::Table_3_3a_e9(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: ea
- * invalid
-**/
-bool X86Architecture::Table_3_3a_ea(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: eb
- * invalid
-**/
-bool X86Architecture::Table_3_3a_eb(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: ec
- * invalid
-**/
-bool X86Architecture::Table_3_3a_ec(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: ed
- * invalid
-**/
-bool X86Architecture::Table_3_3a_ed(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: ee
- * invalid
-**/
-bool X86Architecture::Table_3_3a_ee(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: ef
- * invalid
-**/
-bool X86Architecture::Table_3_3a_ef(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * mnemonic: rorx
- * prefix: f2
- * opcode: f0
- * attr: ['ny', 'nv']
- * operand: ['By', 'Ey', 'Ib']
- * cpu_model: >= X86_Arch_Bmi2
-**/
-bool X86Architecture::Table_3_3a_f0(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_3_3a_f0(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_Bmi2 && (rInsn.GetPrefix() & X86_Prefix_RepNz) == X86_Prefix_RepNz)
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Rorx);
-      if (Operand__By_Ey_Ib(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__By_Ey_Ib<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -3474,138 +1705,43 @@ bool X86Architecture::Table_3_3a_f0(BinaryStream const& rBinStrm, OffsetType Off
       return false;
 }
 
-/** instruction
- * opcode: f1
- * invalid
-**/
-bool X86Architecture::Table_3_3a_f1(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: f2
- * invalid
-**/
-bool X86Architecture::Table_3_3a_f2(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: f3
- * invalid
-**/
-bool X86Architecture::Table_3_3a_f3(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: f4
- * invalid
-**/
-bool X86Architecture::Table_3_3a_f4(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: f5
- * invalid
-**/
-bool X86Architecture::Table_3_3a_f5(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: f6
- * invalid
-**/
-bool X86Architecture::Table_3_3a_f6(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: f7
- * invalid
-**/
-bool X86Architecture::Table_3_3a_f7(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: f8
- * invalid
-**/
-bool X86Architecture::Table_3_3a_f8(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: f9
- * invalid
-**/
-bool X86Architecture::Table_3_3a_f9(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: fa
- * invalid
-**/
-bool X86Architecture::Table_3_3a_fa(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: fb
- * invalid
-**/
-bool X86Architecture::Table_3_3a_fb(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: fc
- * invalid
-**/
-bool X86Architecture::Table_3_3a_fc(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: fd
- * invalid
-**/
-bool X86Architecture::Table_3_3a_fd(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: fe
- * invalid
-**/
-bool X86Architecture::Table_3_3a_fe(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: ff
- * invalid
-**/
-bool X86Architecture::Table_3_3a_ff(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
+X86_INSTANTIATE_DISASSEMBLER(Table_3_3a_00);
+X86_INSTANTIATE_DISASSEMBLER(Table_3_3a_01);
+X86_INSTANTIATE_DISASSEMBLER(Table_3_3a_02);
+X86_INSTANTIATE_DISASSEMBLER(Table_3_3a_04);
+X86_INSTANTIATE_DISASSEMBLER(Table_3_3a_05);
+X86_INSTANTIATE_DISASSEMBLER(Table_3_3a_06);
+X86_INSTANTIATE_DISASSEMBLER(Table_3_3a_08);
+X86_INSTANTIATE_DISASSEMBLER(Table_3_3a_09);
+X86_INSTANTIATE_DISASSEMBLER(Table_3_3a_0a);
+X86_INSTANTIATE_DISASSEMBLER(Table_3_3a_0b);
+X86_INSTANTIATE_DISASSEMBLER(Table_3_3a_0c);
+X86_INSTANTIATE_DISASSEMBLER(Table_3_3a_0d);
+X86_INSTANTIATE_DISASSEMBLER(Table_3_3a_0e);
+X86_INSTANTIATE_DISASSEMBLER(Table_3_3a_0f);
+X86_INSTANTIATE_DISASSEMBLER(Table_3_3a_14);
+X86_INSTANTIATE_DISASSEMBLER(Table_3_3a_15);
+X86_INSTANTIATE_DISASSEMBLER(Table_3_3a_16);
+X86_INSTANTIATE_DISASSEMBLER(Table_3_3a_17);
+X86_INSTANTIATE_DISASSEMBLER(Table_3_3a_18);
+X86_INSTANTIATE_DISASSEMBLER(Table_3_3a_19);
+X86_INSTANTIATE_DISASSEMBLER(Table_3_3a_1d);
+X86_INSTANTIATE_DISASSEMBLER(Table_3_3a_20);
+X86_INSTANTIATE_DISASSEMBLER(Table_3_3a_21);
+X86_INSTANTIATE_DISASSEMBLER(Table_3_3a_22);
+X86_INSTANTIATE_DISASSEMBLER(Table_3_3a_38);
+X86_INSTANTIATE_DISASSEMBLER(Table_3_3a_39);
+X86_INSTANTIATE_DISASSEMBLER(Table_3_3a_40);
+X86_INSTANTIATE_DISASSEMBLER(Table_3_3a_41);
+X86_INSTANTIATE_DISASSEMBLER(Table_3_3a_42);
+X86_INSTANTIATE_DISASSEMBLER(Table_3_3a_44);
+X86_INSTANTIATE_DISASSEMBLER(Table_3_3a_46);
+X86_INSTANTIATE_DISASSEMBLER(Table_3_3a_4a);
+X86_INSTANTIATE_DISASSEMBLER(Table_3_3a_4b);
+X86_INSTANTIATE_DISASSEMBLER(Table_3_3a_4c);
+X86_INSTANTIATE_DISASSEMBLER(Table_3_3a_60);
+X86_INSTANTIATE_DISASSEMBLER(Table_3_3a_61);
+X86_INSTANTIATE_DISASSEMBLER(Table_3_3a_62);
+X86_INSTANTIATE_DISASSEMBLER(Table_3_3a_63);
+X86_INSTANTIATE_DISASSEMBLER(Table_3_3a_df);
+X86_INSTANTIATE_DISASSEMBLER(Table_3_3a_f0);
@@ -1,585 +1,73 @@
-/* This file has been automatically generated, you must _NOT_ edit it directly. (Sun Feb 05 12:38:19 2017) */
+/* This file has been automatically generated, you must _NOT_ edit it directly. (Sun Oct 18 18:46:50 2026) */
 #include "x86_architecture.hpp"
-const X86Architecture::TDisassembler X86Architecture::m_Table_fp4[0x40] =
-{
-  &X86Architecture::Table_fp4_c0,
-  &X86Architecture::Table_fp4_c1,
-  &X86Architecture::Table_fp4_c2,
-  &X86Architecture::Table_fp4_c3,
-  &X86Architecture::Table_fp4_c4,
-  &X86Architecture::Table_fp4_c5,
-  &X86Architecture::Table_fp4_c6,
-  &X86Architecture::Table_fp4_c7,
-  &X86Architecture::Table_fp4_c8,
-  &X86Architecture::Table_fp4_c9,
-  &X86Architecture::Table_fp4_ca,
-  &X86Architecture::Table_fp4_cb,
-  &X86Architecture::Table_fp4_cc,
-  &X86Architecture::Table_fp4_cd,
-  &X86Architecture::Table_fp4_ce,
-  &X86Architecture::Table_fp4_cf,
-  &X86Architecture::Table_fp4_d0,
-  &X86Architecture::Table_fp4_d1,
-  &X86Architecture::Table_fp4_d2,
-  &X86Architecture::Table_fp4_d3,
-  &X86Architecture::Table_fp4_d4,
-  &X86Architecture::Table_fp4_d5,
-  &X86Architecture::Table_fp4_d6,
-  &X86Architecture::Table_fp4_d7,
-  &X86Architecture::Table_fp4_d8,
-  &X86Architecture::Table_fp4_d9,
-  &X86Architecture::Table_fp4_da,
-  &X86Architecture::Table_fp4_db,
-  &X86Architecture::Table_fp4_dc,
-  &X86Architecture::Table_fp4_dd,
-  &X86Architecture::Table_fp4_de,
-  &X86Architecture::Table_fp4_df,
-  &X86Architecture::Table_fp4_e0,
-  &X86Architecture::Table_fp4_e1,
-  &X86Architecture::Table_fp4_e2,
-  &X86Architecture::Table_fp4_e3,
-  &X86Architecture::Table_fp4_e4,
-  &X86Architecture::Table_fp4_e5,
-  &X86Architecture::Table_fp4_e6,
-  &X86Architecture::Table_fp4_e7,
-  &X86Architecture::Table_fp4_e8,
-  &X86Architecture::Table_fp4_e9,
-  &X86Architecture::Table_fp4_ea,
-  &X86Architecture::Table_fp4_eb,
-  &X86Architecture::Table_fp4_ec,
-  &X86Architecture::Table_fp4_ed,
-  &X86Architecture::Table_fp4_ee,
-  &X86Architecture::Table_fp4_ef,
-  &X86Architecture::Table_fp4_f0,
-  &X86Architecture::Table_fp4_f1,
-  &X86Architecture::Table_fp4_f2,
-  &X86Architecture::Table_fp4_f3,
-  &X86Architecture::Table_fp4_f4,
-  &X86Architecture::Table_fp4_f5,
-  &X86Architecture::Table_fp4_f6,
-  &X86Architecture::Table_fp4_f7,
-  &X86Architecture::Table_fp4_f8,
-  &X86Architecture::Table_fp4_f9,
-  &X86Architecture::Table_fp4_fa,
-  &X86Architecture::Table_fp4_fb,
-  &X86Architecture::Table_fp4_fc,
-  &X86Architecture::Table_fp4_fd,
-  &X86Architecture::Table_fp4_fe,
-  &X86Architecture::Table_fp4_ff
+const X86Architecture::DecodeEntry X86Architecture::m_Table_fp4[0x40] =
+{
+  { X86_Opcode_Fcmovnb, 0x021, 0x000, 0x000, 0, 0 }, /* c0 */
+  { X86_Opcode_Fcmovnb, 0x022, 0x000, 0x000, 0, 0 }, /* c1 */
+  { X86_Opcode_Fcmovnb, 0x023, 0x000, 0x000, 0, 0 }, /* c2 */
+  { X86_Opcode_Fcmovnb, 0x024, 0x000, 0x000, 0, 0 }, /* c3 */
+  { X86_Opcode_Fcmovnb, 0x025, 0x000, 0x000, 0, 0 }, /* c4 */
+  { X86_Opcode_Fcmovnb, 0x026, 0x000, 0x000, 0, 0 }, /* c5 */
+  { X86_Opcode_Fcmovnb, 0x027, 0x000, 0x000, 0, 0 }, /* c6 */
+  { X86_Opcode_Fcmovnb, 0x028, 0x000, 0x000, 0, 0 }, /* c7 */
+  { X86_Opcode_Fcmovne, 0x021, 0x000, 0x000, 0, 0 }, /* c8 */
+  { X86_Opcode_Fcmovne, 0x022, 0x000, 0x000, 0, 0 }, /* c9 */
+  { X86_Opcode_Fcmovne, 0x023, 0x000, 0x000, 0, 0 }, /* ca */
+  { X86_Opcode_Fcmovne, 0x024, 0x000, 0x000, 0, 0 }, /* cb */
+  { X86_Opcode_Fcmovne, 0x025, 0x000, 0x000, 0, 0 }, /* cc */
+  { X86_Opcode_Fcmovne, 0x026, 0x000, 0x000, 0, 0 }, /* cd */
+  { X86_Opcode_Fcmovne, 0x027, 0x000, 0x000, 0, 0 }, /* ce */
+  { X86_Opcode_Fcmovne, 0x028, 0x000, 0x000, 0, 0 }, /* cf */
+  { X86_Opcode_Fcmovnbe, 0x021, 0x000, 0x000, 0, 0 }, /* d0 */
+  { X86_Opcode_Fcmovnbe, 0x022, 0x000, 0x000, 0, 0 }, /* d1 */
+  { X86_Opcode_Fcmovnbe, 0x023, 0x000, 0x000, 0, 0 }, /* d2 */
+  { X86_Opcode_Fcmovnbe, 0x024, 0x000, 0x000, 0, 0 }, /* d3 */
+  { X86_Opcode_Fcmovnbe, 0x025, 0x000, 0x000, 0, 0 }, /* d4 */
+  { X86_Opcode_Fcmovnbe, 0x026, 0x000, 0x000, 0, 0 }, /* d5 */
+  { X86_Opcode_Fcmovnbe, 0x027, 0x000, 0x000, 0, 0 }, /* d6 */
+  { X86_Opcode_Fcmovnbe, 0x028, 0x000, 0x000, 0, 0 }, /* d7 */
+  { X86_Opcode_Fcmovnu, 0x021, 0x000, 0x000, 0, 0 }, /* d8 */
+  { X86_Opcode_Fcmovnu, 0x022, 0x000, 0x000, 0, 0 }, /* d9 */
+  { X86_Opcode_Fcmovnu, 0x023, 0x000, 0x000, 0, 0 }, /* da */
+  { X86_Opcode_Fcmovnu, 0x024, 0x000, 0x000, 0, 0 }, /* db */
+  { X86_Opcode_Fcmovnu, 0x025, 0x000, 0x000, 0, 0 }, /* dc */
+  { X86_Opcode_Fcmovnu, 0x026, 0x000, 0x000, 0, 0 }, /* dd */
+  { X86_Opcode_Fcmovnu, 0x027, 0x000, 0x000, 0, 0 }, /* de */
+  { X86_Opcode_Fcmovnu, 0x028, 0x000, 0x000, 0, 0 }, /* df */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x222, 0, DecodeHandler }, /* e0 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x223, 0, DecodeHandler }, /* e1 */
+  { X86_Opcode_Fnclex, 0x000, 0x000, 0x000, 0, 0 }, /* e2 */
+  { X86_Opcode_Fninit, 0x000, 0x047, 0x000, 0, 0 }, /* e3 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x224, 0, DecodeHandler }, /* e4 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x225, 0, DecodeHandler }, /* e5 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* e6 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* e7 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x226, 0, DecodeHandler }, /* e8 */
+  { X86_Opcode_Fucomi, 0x022, 0x000, 0x000, 0, 0 }, /* e9 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x227, 0, DecodeHandler }, /* ea */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x228, 0, DecodeHandler }, /* eb */
+  { X86_Opcode_Fucomi, 0x025, 0x000, 0x000, 0, 0 }, /* ec */
+  { X86_Opcode_Fucomi, 0x026, 0x000, 0x000, 0, 0 }, /* ed */
+  { X86_Opcode_Fucomi, 0x027, 0x000, 0x000, 0, 0 }, /* ee */
+  { X86_Opcode_Fucomi, 0x028, 0x000, 0x000, 0, 0 }, /* ef */
+  { X86_Opcode_Fcomi, 0x021, 0x000, 0x000, 0, 0 }, /* f0 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x229, 0, DecodeHandler }, /* f1 */
+  { X86_Opcode_Fcomi, 0x023, 0x000, 0x000, 0, 0 }, /* f2 */
+  { X86_Opcode_Fcomi, 0x024, 0x000, 0x000, 0, 0 }, /* f3 */
+  { X86_Opcode_Fcomi, 0x025, 0x000, 0x000, 0, 0 }, /* f4 */
+  { X86_Opcode_Fcomi, 0x026, 0x000, 0x000, 0, 0 }, /* f5 */
+  { X86_Opcode_Fcomi, 0x027, 0x000, 0x000, 0, 0 }, /* f6 */
+  { X86_Opcode_Fcomi, 0x028, 0x000, 0x000, 0, 0 }, /* f7 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x22a, 0, DecodeHandler }, /* f8 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* f9 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* fa */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* fb */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* fc */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* fd */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* fe */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }  /* ff */
 };
 
-/** instruction
- * mnemonic: fcmovnb
- * operand: ['ST0', 'ST0']
- * opcode: 00
-**/
-bool X86Architecture::Table_fp4_c0(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    rInsn.Size()++;
-    rInsn.SetOpcode(X86_Opcode_Fcmovnb);
-    if (Operand__ST0_ST0(rBinStrm, Offset, rInsn, Mode) == false)
-    {
-      return false;
-    }
-    return true;
-}
-
-/** instruction
- * mnemonic: fcmovnb
- * operand: ['ST0', 'ST1']
- * opcode: 01
-**/
-bool X86Architecture::Table_fp4_c1(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    rInsn.Size()++;
-    rInsn.SetOpcode(X86_Opcode_Fcmovnb);
-    if (Operand__ST0_ST1(rBinStrm, Offset, rInsn, Mode) == false)
-    {
-      return false;
-    }
-    return true;
-}
-
-/** instruction
- * mnemonic: fcmovnb
- * operand: ['ST0', 'ST2']
- * opcode: 02
-**/
-bool X86Architecture::Table_fp4_c2(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    rInsn.Size()++;
-    rInsn.SetOpcode(X86_Opcode_Fcmovnb);
-    if (Operand__ST0_ST2(rBinStrm, Offset, rInsn, Mode) == false)
-    {
-      return false;
-    }
-    return true;
-}
-
-/** instruction
- * mnemonic: fcmovnb
- * operand: ['ST0', 'ST3']
- * opcode: 03
-**/
-bool X86Architecture::Table_fp4_c3(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    rInsn.Size()++;
-    rInsn.SetOpcode(X86_Opcode_Fcmovnb);
-    if (Operand__ST0_ST3(rBinStrm, Offset, rInsn, Mode) == false)
-    {
-      return false;
-    }
-    return true;
-}
-
-/** instruction
- * mnemonic: fcmovnb
- * operand: ['ST0', 'ST4']
- * opcode: 04
-**/
-bool X86Architecture::Table_fp4_c4(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    rInsn.Size()++;
-    rInsn.SetOpcode(X86_Opcode_Fcmovnb);
-    if (Operand__ST0_ST4(rBinStrm, Offset, rInsn, Mode) == false)
-    {
-      return false;
-    }
-    return true;
-}
-
-/** instruction
- * mnemonic: fcmovnb
- * operand: ['ST0', 'ST5']
- * opcode: 05
-**/
-bool X86Architecture::Table_fp4_c5(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    rInsn.Size()++;
-    rInsn.SetOpcode(X86_Opcode_Fcmovnb);
-    if (Operand__ST0_ST5(rBinStrm, Offset, rInsn, Mode) == false)
-    {
-      return false;
-    }
-    return true;
-}
-
-/** instruction
- * mnemonic: fcmovnb
- * operand: ['ST0', 'ST6']
- * opcode: 06
-**/
-bool X86Architecture::Table_fp4_c6(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    rInsn.Size()++;
-    rInsn.SetOpcode(X86_Opcode_Fcmovnb);
-    if (Operand__ST0_ST6(rBinStrm, Offset, rInsn, Mode) == false)
-    {
-      return false;
-    }
-    return true;
-}
-
-/** instruction
- * mnemonic: fcmovnb
- * operand: ['ST0', 'ST7']
- * opcode: 07
-**/
-bool X86Architecture::Table_fp4_c7(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    rInsn.Size()++;
-    rInsn.SetOpcode(X86_Opcode_Fcmovnb);
-    if (Operand__ST0_ST7(rBinStrm, Offset, rInsn, Mode) == false)
-    {
-      return false;
-    }
-    return true;
-}
-
-/** instruction
- * mnemonic: fcmovne
- * operand: ['ST0', 'ST0']
- * opcode: 08
-**/
-bool X86Architecture::Table_fp4_c8(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    rInsn.Size()++;
-    rInsn.SetOpcode(X86_Opcode_Fcmovne);
-    if (Operand__ST0_ST0(rBinStrm, Offset, rInsn, Mode) == false)
-    {
-      return false;
-    }
-    return true;
-}
-
-/** instruction
- * mnemonic: fcmovne
- * operand: ['ST0', 'ST1']
- * opcode: 09
-**/
-bool X86Architecture::Table_fp4_c9(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    rInsn.Size()++;
-    rInsn.SetOpcode(X86_Opcode_Fcmovne);
-    if (Operand__ST0_ST1(rBinStrm, Offset, rInsn, Mode) == false)
-    {
-      return false;
-    }
-    return true;
-}
-
-/** instruction
- * mnemonic: fcmovne
- * operand: ['ST0', 'ST2']
- * opcode: 0a
-**/
-bool X86Architecture::Table_fp4_ca(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    rInsn.Size()++;
-    rInsn.SetOpcode(X86_Opcode_Fcmovne);
-    if (Operand__ST0_ST2(rBinStrm, Offset, rInsn, Mode) == false)
-    {
-      return false;
-    }
-    return true;
-}
-
-/** instruction
- * mnemonic: fcmovne
- * operand: ['ST0', 'ST3']
- * opcode: 0b
-**/
-bool X86Architecture::Table_fp4_cb(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    rInsn.Size()++;
-    rInsn.SetOpcode(X86_Opcode_Fcmovne);
-    if (Operand__ST0_ST3(rBinStrm, Offset, rInsn, Mode) == false)
-    {
-      return false;
-    }
-    return true;
-}
-
-/** instruction
- * mnemonic: fcmovne
- * operand: ['ST0', 'ST4']
- * opcode: 0c
-**/
-bool X86Architecture::Table_fp4_cc(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    rInsn.Size()++;
-    rInsn.SetOpcode(X86_Opcode_Fcmovne);
-    if (Operand__ST0_ST4(rBinStrm, Offset, rInsn, Mode) == false)
-    {
-      return false;
-    }
-    return true;
-}
-
-/** instruction
- * mnemonic: fcmovne
- * operand: ['ST0', 'ST5']
- * opcode: 0d
-**/
-bool X86Architecture::Table_fp4_cd(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    rInsn.Size()++;
-    rInsn.SetOpcode(X86_Opcode_Fcmovne);
-    if (Operand__ST0_ST5(rBinStrm, Offset, rInsn, Mode) == false)
-    {
-      return false;
-    }
-    return true;
-}
-
-/** instruction
- * mnemonic: fcmovne
- * operand: ['ST0', 'ST6']
- * opcode: 0e
-**/
-bool X86Architecture::Table_fp4_ce(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    rInsn.Size()++;
-    rInsn.SetOpcode(X86_Opcode_Fcmovne);
-    if (Operand__ST0_ST6(rBinStrm, Offset, rInsn, Mode) == false)
-    {
-      return false;
-    }
-    return true;
-}
-
-/** instruction
- * mnemonic: fcmovne
- * operand: ['ST0', 'ST7']
- * opcode: 0f
-**/
-bool X86Architecture::Table_fp4_cf(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    rInsn.Size()++;
-    rInsn.SetOpcode(X86_Opcode_Fcmovne);
-    if (Operand__ST0_ST7(rBinStrm, Offset, rInsn, Mode) == false)
-    {
-      return false;
-    }
-    return true;
-}
-
-/** instruction
- * mnemonic: fcmovnbe
- * operand: ['ST0', 'ST0']
- * opcode: 10
-**/
-bool X86Architecture::Table_fp4_d0(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    rInsn.Size()++;
-    rInsn.SetOpcode(X86_Opcode_Fcmovnbe);
-    if (Operand__ST0_ST0(rBinStrm, Offset, rInsn, Mode) == false)
-    {
-      return false;
-    }
-    return true;
-}
-
-/** instruction
- * mnemonic: fcmovnbe
- * operand: ['ST0', 'ST1']
- * opcode: 11
-**/
-bool X86Architecture::Table_fp4_d1(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    rInsn.Size()++;
-    rInsn.SetOpcode(X86_Opcode_Fcmovnbe);
-    if (Operand__ST0_ST1(rBinStrm, Offset, rInsn, Mode) == false)
-    {
-      return false;
-    }
-    return true;
-}
-
-/** instruction
- * mnemonic: fcmovnbe
- * operand: ['ST0', 'ST2']
- * opcode: 12
-**/
-bool X86Architecture::Table_fp4_d2(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    rInsn.Size()++;
-    rInsn.SetOpcode(X86_Opcode_Fcmovnbe);
-    if (Operand__ST0_ST2(rBinStrm, Offset, rInsn, Mode) == false)
-    {
-      return false;
-    }
-    return true;
-}
-
-/** instruction
- * mnemonic: fcmovnbe
- * operand: ['ST0', 'ST3']
- * opcode: 13
-**/
-bool X86Architecture::Table_fp4_d3(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    rInsn.Size()++;
-    rInsn.SetOpcode(X86_Opcode_Fcmovnbe);
-    if (Operand__ST0_ST3(rBinStrm, Offset, rInsn, Mode) == false)
-    {
-      return false;
-    }
-    return true;
-}
-
-/** instruction
- * mnemonic: fcmovnbe
- * operand: ['ST0', 'ST4']
- * opcode: 14
-**/
-bool X86Architecture::Table_fp4_d4(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    rInsn.Size()++;
-    rInsn.SetOpcode(X86_Opcode_Fcmovnbe);
-    if (Operand__ST0_ST4(rBinStrm, Offset, rInsn, Mode) == false)
-    {
-      return false;
-    }
-    return true;
-}
-
-/** instruction
- * mnemonic: fcmovnbe
- * operand: ['ST0', 'ST5']
- * opcode: 15
-**/
-bool X86Architecture::Table_fp4_d5(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    rInsn.Size()++;
-    rInsn.SetOpcode(X86_Opcode_Fcmovnbe);
-    if (Operand__ST0_ST5(rBinStrm, Offset, rInsn, Mode) == false)
-    {
-      return false;
-    }
-    return true;
-}
-
-/** instruction
- * mnemonic: fcmovnbe
- * operand: ['ST0', 'ST6']
- * opcode: 16
-**/
-bool X86Architecture::Table_fp4_d6(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    rInsn.Size()++;
-    rInsn.SetOpcode(X86_Opcode_Fcmovnbe);
-    if (Operand__ST0_ST6(rBinStrm, Offset, rInsn, Mode) == false)
-    {
-      return false;
-    }
-    return true;
-}
-
-/** instruction
- * mnemonic: fcmovnbe
- * operand: ['ST0', 'ST7']
- * opcode: 17
-**/
-bool X86Architecture::Table_fp4_d7(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    rInsn.Size()++;
-    rInsn.SetOpcode(X86_Opcode_Fcmovnbe);
-    if (Operand__ST0_ST7(rBinStrm, Offset, rInsn, Mode) == false)
-    {
-      return false;
-    }
-    return true;
-}
-
-/** instruction
- * mnemonic: fcmovnu
- * operand: ['ST0', 'ST0']
- * opcode: 18
-**/
-bool X86Architecture::Table_fp4_d8(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    rInsn.Size()++;
-    rInsn.SetOpcode(X86_Opcode_Fcmovnu);
-    if (Operand__ST0_ST0(rBinStrm, Offset, rInsn, Mode) == false)
-    {
-      return false;
-    }
-    return true;
-}
-
-/** instruction
- * mnemonic: fcmovnu
- * operand: ['ST0', 'ST1']
- * opcode: 19
-**/
-bool X86Architecture::Table_fp4_d9(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    rInsn.Size()++;
-    rInsn.SetOpcode(X86_Opcode_Fcmovnu);
-    if (Operand__ST0_ST1(rBinStrm, Offset, rInsn, Mode) == false)
-    {
-      return false;
-    }
-    return true;
-}
-
-/** instruction
- * mnemonic: fcmovnu
- * operand: ['ST0', 'ST2']
- * opcode: 1a
-**/
-bool X86Architecture::Table_fp4_da(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    rInsn.Size()++;
-    rInsn.SetOpcode(X86_Opcode_Fcmovnu);
-    if (Operand__ST0_ST2(rBinStrm, Offset, rInsn, Mode) == false)
-    {
-      return false;
-    }
-    return true;
-}
-
-/** instruction
- * mnemonic: fcmovnu
- * operand: ['ST0', 'ST3']
- * opcode: 1b
-**/
-bool X86Architecture::Table_fp4_db(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    rInsn.Size()++;
-    rInsn.SetOpcode(X86_Opcode_Fcmovnu);
-    if (Operand__ST0_ST3(rBinStrm, Offset, rInsn, Mode) == false)
-    {
-      return false;
-    }
-    return true;
-}
-
-/** instruction
- * mnemonic: fcmovnu
- * operand: ['ST0', 'ST4']
- * opcode: 1c
-**/
-bool X86Architecture::Table_fp4_dc(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    rInsn.Size()++;
-    rInsn.SetOpcode(X86_Opcode_Fcmovnu);
-    if (Operand__ST0_ST4(rBinStrm, Offset, rInsn, Mode) == false)
-    {
-      return false;
-    }
-    return true;
-}
-
-/** instruction
- * mnemonic: fcmovnu
- * operand: ['ST0', 'ST5']
- * opcode: 1d
-**/
-bool X86Architecture::Table_fp4_dd(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    rInsn.Size()++;
-    rInsn.SetOpcode(X86_Opcode_Fcmovnu);
-    if (Operand__ST0_ST5(rBinStrm, Offset, rInsn, Mode) == false)
-    {
-      return false;
-    }
-    return true;
-}
-
-/** instruction
- * mnemonic: fcmovnu
- * operand: ['ST0', 'ST6']
- * opcode: 1e
-**/
-bool X86Architecture::Table_fp4_de(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    rInsn.Size()++;
-    rInsn.SetOpcode(X86_Opcode_Fcmovnu);
-    if (Operand__ST0_ST6(rBinStrm, Offset, rInsn, Mode) == false)
-    {
-      return false;
-    }
-    return true;
-}
-
-/** instruction
- * mnemonic: fcmovnu
- * operand: ['ST0', 'ST7']
- * opcode: 1f
-**/
-bool X86Architecture::Table_fp4_df(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    rInsn.Size()++;
-    rInsn.SetOpcode(X86_Opcode_Fcmovnu);
-    if (Operand__ST0_ST7(rBinStrm, Offset, rInsn, Mode) == false)
-    {
-      return false;
-    }
-    return true;
-}
-
 /** instructions
  * opcode: 20
  *
@@ -589,7 +77,8 @@ bool X86Architecture::Table_fp4_df(BinaryStream const& rBinStrm, OffsetType Offs
  * cpu_model: == X86_Arch_8087
  *
 **/
-bool X86Architecture::Table_fp4_e0(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_fp4_e0(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") == X86_Arch_8087)
     {
@@ -612,7 +101,8 @@ bool X86Architecture::Table_fp4_e0(BinaryStream const& rBinStrm, OffsetType Offs
  * cpu_model: == X86_Arch_8087
  *
 **/
-bool X86Architecture::Table_fp4_e1(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_fp4_e1(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") == X86_Arch_8087)
     {
@@ -626,37 +116,6 @@ bool X86Architecture::Table_fp4_e1(BinaryStream const& rBinStrm, OffsetType Offs
     }
 }
 
-/** instruction
- * mnemonic: fnclex
- * opcode: 22
-**/
-bool X86Architecture::Table_fp4_e2(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    rInsn.Size()++;
-    rInsn.SetOpcode(X86_Opcode_Fnclex);
-    return true;
-}
-
-/** instruction
- * mnemonic: fninit
- * opcode: 23
- * semantic: ['program.id = program.id']
-**/
-bool X86Architecture::Table_fp4_e3(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    rInsn.Size()++;
-    rInsn.SetOpcode(X86_Opcode_Fninit);
-    {
-      Expression::LSPType AllExpr;
-      /* semantic: program.id = program.id */
-      AllExpr.push_back(Expr::MakeAssign(
-        Expr::MakeId(m_CpuInfo.GetRegisterByType(CpuInformation::ProgramPointerRegister, rInsn.GetMode()), &m_CpuInfo),
-        Expr::MakeId(m_CpuInfo.GetRegisterByType(CpuInformation::ProgramPointerRegister, rInsn.GetMode()), &m_CpuInfo)));
-      rInsn.SetSemantic(AllExpr);
-    }
-    return true;
-}
-
 /** instructions
  * opcode: 24
  *
@@ -666,7 +125,8 @@ bool X86Architecture::Table_fp4_e3(BinaryStream const& rBinStrm, OffsetType Offs
  * cpu_model: == X86_Arch_80287
  *
 **/
-bool X86Architecture::Table_fp4_e4(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_fp4_e4(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") == X86_Arch_80287)
     {
@@ -689,7 +149,8 @@ bool X86Architecture::Table_fp4_e4(BinaryStream const& rBinStrm, OffsetType Offs
  * cpu_model: == X86_Arch_80287xl
  *
 **/
-bool X86Architecture::Table_fp4_e5(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_fp4_e5(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") == X86_Arch_80287xl)
     {
@@ -703,24 +164,6 @@ bool X86Architecture::Table_fp4_e5(BinaryStream const& rBinStrm, OffsetType Offs
     }
 }
 
-/** instruction
- * opcode: 26
- * invalid
-**/
-bool X86Architecture::Table_fp4_e6(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: 27
- * invalid
-**/
-bool X86Architecture::Table_fp4_e7(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
 /** instructions
  * opcode: 28
  *
@@ -731,7 +174,8 @@ bool X86Architecture::Table_fp4_e7(BinaryStream const& rBinStrm, OffsetType Offs
  * attr: ['iit']
  *
 **/
-bool X86Architecture::Table_fp4_e8(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_fp4_e8(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Vendor") == X86_ProcType_IIT)
     {
@@ -743,7 +187,7 @@ bool X86Architecture::Table_fp4_e8(BinaryStream const& rBinStrm, OffsetType Offs
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Fucomi);
-      if (Operand__ST0_ST0(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__ST0_ST0<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -751,22 +195,6 @@ bool X86Architecture::Table_fp4_e8(BinaryStream const& rBinStrm, OffsetType Offs
     }
 }
 
-/** instruction
- * mnemonic: fucomi
- * operand: ['ST0', 'ST1']
- * opcode: 29
-**/
-bool X86Architecture::Table_fp4_e9(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    rInsn.Size()++;
-    rInsn.SetOpcode(X86_Opcode_Fucomi);
-    if (Operand__ST0_ST1(rBinStrm, Offset, rInsn, Mode) == false)
-    {
-      return false;
-    }
-    return true;
-}
-
 /** instructions
  * opcode: 2a
  *
@@ -777,7 +205,8 @@ bool X86Architecture::Table_fp4_e9(BinaryStream const& rBinStrm, OffsetType Offs
  * attr: ['iit']
  *
 **/
-bool X86Architecture::Table_fp4_ea(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_fp4_ea(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Vendor") == X86_ProcType_IIT)
     {
@@ -789,7 +218,7 @@ bool X86Architecture::Table_fp4_ea(BinaryStream const& rBinStrm, OffsetType Offs
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Fucomi);
-      if (Operand__ST0_ST2(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__ST0_ST2<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -807,7 +236,8 @@ bool X86Architecture::Table_fp4_ea(BinaryStream const& rBinStrm, OffsetType Offs
  * attr: ['iit']
  *
 **/
-bool X86Architecture::Table_fp4_eb(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_fp4_eb(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Vendor") == X86_ProcType_IIT)
     {
@@ -819,7 +249,7 @@ bool X86Architecture::Table_fp4_eb(BinaryStream const& rBinStrm, OffsetType Offs
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Fucomi);
-      if (Operand__ST0_ST3(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__ST0_ST3<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -827,86 +257,6 @@ bool X86Architecture::Table_fp4_eb(BinaryStream const& rBinStrm, OffsetType Offs
     }
 }
 
-/** instruction
- * mnemonic: fucomi
- * operand: ['ST0', 'ST4']
- * opcode: 2c
-**/
-bool X86Architecture::Table_fp4_ec(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    rInsn.Size()++;
-    rInsn.SetOpcode(X86_Opcode_Fucomi);
-    if (Operand__ST0_ST4(rBinStrm, Offset, rInsn, Mode) == false)
-    {
-      return false;
-    }
-    return true;
-}
-
-/** instruction
- * mnemonic: fucomi
- * operand: ['ST0', 'ST5']
- * opcode: 2d
-**/
-bool X86Architecture::Table_fp4_ed(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    rInsn.Size()++;
-    rInsn.SetOpcode(X86_Opcode_Fucomi);
-    if (Operand__ST0_ST5(rBinStrm, Offset, rInsn, Mode) == false)
-    {
-      return false;
-    }
-    return true;
-}
-
-/** instruction
- * mnemonic: fucomi
- * operand: ['ST0', 'ST6']
- * opcode: 2e
-**/
-bool X86Architecture::Table_fp4_ee(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    rInsn.Size()++;
-    rInsn.SetOpcode(X86_Opcode_Fucomi);
-    if (Operand__ST0_ST6(rBinStrm, Offset, rInsn, Mode) == false)
-    {
-      return false;
-    }
-    return true;
-}
-
-/** instruction
- * mnemonic: fucomi
- * operand: ['ST0', 'ST7']
- * opcode: 2f
-**/
-bool X86Architecture::Table_fp4_ef(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    rInsn.Size()++;
-    rInsn.SetOpcode(X86_Opcode_Fucomi);
-    if (Operand__ST0_ST7(rBinStrm, Offset, rInsn, Mode) == false)
-    {
-      return false;
-    }
-    return true;
-}
-
-/** instruction
- * mnemonic: fcomi
- * operand: ['ST0', 'ST0']
- * opcode: 30
-**/
-bool X86Architecture::Table_fp4_f0(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    rInsn.Size()++;
-    rInsn.SetOpcode(X86_Opcode_Fcomi);
-    if (Operand__ST0_ST0(rBinStrm, Offset, rInsn, Mode) == false)
-    {
-      return false;
-    }
-    return true;
-}
-
 /** instructions
  * opcode: 31
  *
@@ -917,7 +267,8 @@ bool X86Architecture::Table_fp4_f0(BinaryStream const& rBinStrm, OffsetType Offs
  * attr: ['iit']
  *
 **/
-bool X86Architecture::Table_fp4_f1(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_fp4_f1(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Vendor") == X86_ProcType_IIT)
     {
@@ -929,7 +280,7 @@ bool X86Architecture::Table_fp4_f1(BinaryStream const& rBinStrm, OffsetType Offs
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Fcomi);
-      if (Operand__ST0_ST1(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__ST0_ST1<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -937,102 +288,6 @@ bool X86Architecture::Table_fp4_f1(BinaryStream const& rBinStrm, OffsetType Offs
     }
 }
 
-/** instruction
- * mnemonic: fcomi
- * operand: ['ST0', 'ST2']
- * opcode: 32
-**/
-bool X86Architecture::Table_fp4_f2(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    rInsn.Size()++;
-    rInsn.SetOpcode(X86_Opcode_Fcomi);
-    if (Operand__ST0_ST2(rBinStrm, Offset, rInsn, Mode) == false)
-    {
-      return false;
-    }
-    return true;
-}
-
-/** instruction
- * mnemonic: fcomi
- * operand: ['ST0', 'ST3']
- * opcode: 33
-**/
-bool X86Architecture::Table_fp4_f3(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    rInsn.Size()++;
-    rInsn.SetOpcode(X86_Opcode_Fcomi);
-    if (Operand__ST0_ST3(rBinStrm, Offset, rInsn, Mode) == false)
-    {
-      return false;
-    }
-    return true;
-}
-
-/** instruction
- * mnemonic: fcomi
- * operand: ['ST0', 'ST4']
- * opcode: 34
-**/
-bool X86Architecture::Table_fp4_f4(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    rInsn.Size()++;
-    rInsn.SetOpcode(X86_Opcode_Fcomi);
-    if (Operand__ST0_ST4(rBinStrm, Offset, rInsn, Mode) == false)
-    {
-      return false;
-    }
-    return true;
-}
-
-/** instruction
- * mnemonic: fcomi
- * operand: ['ST0', 'ST5']
- * opcode: 35
-**/
-bool X86Architecture::Table_fp4_f5(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    rInsn.Size()++;
-    rInsn.SetOpcode(X86_Opcode_Fcomi);
-    if (Operand__ST0_ST5(rBinStrm, Offset, rInsn, Mode) == false)
-    {
-      return false;
-    }
-    return true;
-}
-
-/** instruction
- * mnemonic: fcomi
- * operand: ['ST0', 'ST6']
- * opcode: 36
-**/
-bool X86Architecture::Table_fp4_f6(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    rInsn.Size()++;
-    rInsn.SetOpcode(X86_Opcode_Fcomi);
-    if (Operand__ST0_ST6(rBinStrm, Offset, rInsn, Mode) == false)
-    {
-      return false;
-    }
-    return true;
-}
-
-/** instruction
- * mnemonic: fcomi
- * operand: ['ST0', 'ST7']
- * opcode: 37
-**/
-bool X86Architecture::Table_fp4_f7(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    rInsn.Size()++;
-    rInsn.SetOpcode(X86_Opcode_Fcomi);
-    if (Operand__ST0_ST7(rBinStrm, Offset, rInsn, Mode) == false)
-    {
-      return false;
-    }
-    return true;
-}
-
 /** instructions
  * opcode: 38
  *
@@ -1042,7 +297,8 @@ bool X86Architecture::Table_fp4_f7(BinaryStream const& rBinStrm, OffsetType Offs
  * attr: ['cyrix']
  *
 **/
-bool X86Architecture::Table_fp4_f8(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_fp4_f8(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Vendor") == X86_ProcType_CYRIX)
     {
@@ -1056,66 +312,12 @@ bool X86Architecture::Table_fp4_f8(BinaryStream const& rBinStrm, OffsetType Offs
     }
 }
 
-/** instruction
- * opcode: 39
- * invalid
-**/
-bool X86Architecture::Table_fp4_f9(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: 3a
- * invalid
-**/
-bool X86Architecture::Table_fp4_fa(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: 3b
- * invalid
-**/
-bool X86Architecture::Table_fp4_fb(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: 3c
- * invalid
-**/
-bool X86Architecture::Table_fp4_fc(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: 3d
- * invalid
-**/
-bool X86Architecture::Table_fp4_fd(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: 3e
- * invalid
-**/
-bool X86Architecture::Table_fp4_fe(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: 3f
- * invalid
-**/
-bool X86Architecture::Table_fp4_ff(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
+X86_INSTANTIATE_DISASSEMBLER(Table_fp4_e0);
+X86_INSTANTIATE_DISASSEMBLER(Table_fp4_e1);
+X86_INSTANTIATE_DISASSEMBLER(Table_fp4_e4);
+X86_INSTANTIATE_DISASSEMBLER(Table_fp4_e5);
+X86_INSTANTIATE_DISASSEMBLER(Table_fp4_e8);
+X86_INSTANTIATE_DISASSEMBLER(Table_fp4_ea);
+X86_INSTANTIATE_DISASSEMBLER(Table_fp4_eb);
+X86_INSTANTIATE_DISASSEMBLER(Table_fp4_f1);
+X86_INSTANTIATE_DISASSEMBLER(Table_fp4_f8);
@@ -1,598 +1,87 @@
-/* This file has been automatically generated, you must _NOT_ edit it directly. (Sun Feb 05 12:38:19 2017) */
+/* This file has been automatically generated, you must _NOT_ edit it directly. (Sun Oct 18 18:46:50 2026) */
 #include "x86_architecture.hpp"
-const X86Architecture::TDisassembler X86Architecture::m_Table_fp6[0x40] =
-{
-  &X86Architecture::Table_fp6_c0,
-  &X86Architecture::Table_fp6_c1,
-  &X86Architecture::Table_fp6_c2,
-  &X86Architecture::Table_fp6_c3,
-  &X86Architecture::Table_fp6_c4,
-  &X86Architecture::Table_fp6_c5,
-  &X86Architecture::Table_fp6_c6,
-  &X86Architecture::Table_fp6_c7,
-  &X86Architecture::Table_fp6_c8,
-  &X86Architecture::Table_fp6_c9,
-  &X86Architecture::Table_fp6_ca,
-  &X86Architecture::Table_fp6_cb,
-  &X86Architecture::Table_fp6_cc,
-  &X86Architecture::Table_fp6_cd,
-  &X86Architecture::Table_fp6_ce,
-  &X86Architecture::Table_fp6_cf,
-  &X86Architecture::Table_fp6_d0,
-  &X86Architecture::Table_fp6_d1,
-  &X86Architecture::Table_fp6_d2,
-  &X86Architecture::Table_fp6_d3,
-  &X86Architecture::Table_fp6_d4,
-  &X86Architecture::Table_fp6_d5,
-  &X86Architecture::Table_fp6_d6,
-  &X86Architecture::Table_fp6_d7,
-  &X86Architecture::Table_fp6_d8,
-  &X86Architecture::Table_fp6_d9,
-  &X86Architecture::Table_fp6_da,
-  &X86Architecture::Table_fp6_db,
-  &X86Architecture::Table_fp6_dc,
-  &X86Architecture::Table_fp6_dd,
-  &X86Architecture::Table_fp6_de,
-  &X86Architecture::Table_fp6_df,
-  &X86Architecture::Table_fp6_e0,
-  &X86Architecture::Table_fp6_e1,
-  &X86Architecture::Table_fp6_e2,
-  &X86Architecture::Table_fp6_e3,
-  &X86Architecture::Table_fp6_e4,
-  &X86Architecture::Table_fp6_e5,
-  &X86Architecture::Table_fp6_e6,
-  &X86Architecture::Table_fp6_e7,
-  &X86Architecture::Table_fp6_e8,
-  &X86Architecture::Table_fp6_e9,
-  &X86Architecture::Table_fp6_ea,
-  &X86Architecture::Table_fp6_eb,
-  &X86Architecture::Table_fp6_ec,
-  &X86Architecture::Table_fp6_ed,
-  &X86Architecture::Table_fp6_ee,
-  &X86Architecture::Table_fp6_ef,
-  &X86Architecture::Table_fp6_f0,
-  &X86Architecture::Table_fp6_f1,
-  &X86Architecture::Table_fp6_f2,
-  &X86Architecture::Table_fp6_f3,
-  &X86Architecture::Table_fp6_f4,
-  &X86Architecture::Table_fp6_f5,
-  &X86Architecture::Table_fp6_f6,
-  &X86Architecture::Table_fp6_f7,
-  &X86Architecture::Table_fp6_f8,
-  &X86Architecture::Table_fp6_f9,
-  &X86Architecture::Table_fp6_fa,
-  &X86Architecture::Table_fp6_fb,
-  &X86Architecture::Table_fp6_fc,
-  &X86Architecture::Table_fp6_fd,
-  &X86Architecture::Table_fp6_fe,
-  &X86Architecture::Table_fp6_ff
+const X86Architecture::DecodeEntry X86Architecture::m_Table_fp6[0x40] =
+{
+  { X86_Opcode_Ffree, 0x029, 0x000, 0x000, 0, 0 }, /* c0 */
+  { X86_Opcode_Ffree, 0x02a, 0x000, 0x000, 0, 0 }, /* c1 */
+  { X86_Opcode_Ffree, 0x02b, 0x000, 0x000, 0, 0 }, /* c2 */
+  { X86_Opcode_Ffree, 0x02c, 0x000, 0x000, 0, 0 }, /* c3 */
+  { X86_Opcode_Ffree, 0x02d, 0x000, 0x000, 0, 0 }, /* c4 */
+  { X86_Opcode_Ffree, 0x02e, 0x000, 0x000, 0, 0 }, /* c5 */
+  { X86_Opcode_Ffree, 0x02f, 0x000, 0x000, 0, 0 }, /* c6 */
+  { X86_Opcode_Ffree, 0x030, 0x000, 0x000, 0, 0 }, /* c7 */
+  { X86_Opcode_Fxch, 0x029, 0x000, 0x000, 0, 0 }, /* c8 */
+  { X86_Opcode_Fxch, 0x02a, 0x000, 0x000, 0, 0 }, /* c9 */
+  { X86_Opcode_Fxch, 0x02b, 0x000, 0x000, 0, 0 }, /* ca */
+  { X86_Opcode_Fxch, 0x02c, 0x000, 0x000, 0, 0 }, /* cb */
+  { X86_Opcode_Fxch, 0x02d, 0x000, 0x000, 0, 0 }, /* cc */
+  { X86_Opcode_Fxch, 0x02e, 0x000, 0x000, 0, 0 }, /* cd */
+  { X86_Opcode_Fxch, 0x02f, 0x000, 0x000, 0, 0 }, /* ce */
+  { X86_Opcode_Fxch, 0x030, 0x000, 0x000, 0, 0 }, /* cf */
+  { X86_Opcode_Fst, 0x029, 0x000, 0x000, 0, 0 }, /* d0 */
+  { X86_Opcode_Fst, 0x02a, 0x000, 0x000, 0, 0 }, /* d1 */
+  { X86_Opcode_Fst, 0x02b, 0x000, 0x000, 0, 0 }, /* d2 */
+  { X86_Opcode_Fst, 0x02c, 0x000, 0x000, 0, 0 }, /* d3 */
+  { X86_Opcode_Fst, 0x02d, 0x000, 0x000, 0, 0 }, /* d4 */
+  { X86_Opcode_Fst, 0x02e, 0x000, 0x000, 0, 0 }, /* d5 */
+  { X86_Opcode_Fst, 0x02f, 0x000, 0x000, 0, 0 }, /* d6 */
+  { X86_Opcode_Fst, 0x030, 0x000, 0x000, 0, 0 }, /* d7 */
+  { X86_Opcode_Fstp, 0x029, 0x000, 0x000, 0, 0 }, /* d8 */
+  { X86_Opcode_Fstp, 0x02a, 0x000, 0x000, 0, 0 }, /* d9 */
+  { X86_Opcode_Fstp, 0x02b, 0x000, 0x000, 0, 0 }, /* da */
+  { X86_Opcode_Fstp, 0x02c, 0x000, 0x000, 0, 0 }, /* db */
+  { X86_Opcode_Fstp, 0x02d, 0x000, 0x000, 0, 0 }, /* dc */
+  { X86_Opcode_Fstp, 0x02e, 0x000, 0x000, 0, 0 }, /* dd */
+  { X86_Opcode_Fstp, 0x02f, 0x000, 0x000, 0, 0 }, /* de */
+  { X86_Opcode_Fstp, 0x030, 0x000, 0x000, 0, 0 }, /* df */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x22b, 0, DecodeHandler }, /* e0 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x22c, 0, DecodeHandler }, /* e1 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x22d, 0, DecodeHandler }, /* e2 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x22e, 0, DecodeHandler }, /* e3 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x22f, 0, DecodeHandler }, /* e4 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x230, 0, DecodeHandler }, /* e5 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x231, 0, DecodeHandler }, /* e6 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x232, 0, DecodeHandler }, /* e7 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x233, 0, DecodeHandler }, /* e8 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x234, 0, DecodeHandler }, /* e9 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x235, 0, DecodeHandler }, /* ea */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x236, 0, DecodeHandler }, /* eb */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x237, 0, DecodeHandler }, /* ec */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x238, 0, DecodeHandler }, /* ed */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x239, 0, DecodeHandler }, /* ee */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x23a, 0, DecodeHandler }, /* ef */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* f0 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* f1 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* f2 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* f3 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* f4 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* f5 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* f6 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* f7 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* f8 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* f9 */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* fa */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* fb */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x23b, 0, DecodeHandler }, /* fc */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* fd */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }, /* fe */
+  { X86_Opcode_Unknown, 0x000, 0x000, 0x000, 0, DecodeInvalid }  /* ff */
 };
 
 /** instruction
- * mnemonic: ffree
- * operand: ['ST0']
- * opcode: 00
-**/
-bool X86Architecture::Table_fp6_c0(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    rInsn.Size()++;
-    rInsn.SetOpcode(X86_Opcode_Ffree);
-    if (Operand__ST0(rBinStrm, Offset, rInsn, Mode) == false)
-    {
-      return false;
-    }
-    return true;
-}
-
-/** instruction
- * mnemonic: ffree
- * operand: ['ST1']
- * opcode: 01
-**/
-bool X86Architecture::Table_fp6_c1(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    rInsn.Size()++;
-    rInsn.SetOpcode(X86_Opcode_Ffree);
-    if (Operand__ST1(rBinStrm, Offset, rInsn, Mode) == false)
-    {
-      return false;
-    }
-    return true;
-}
-
-/** instruction
- * mnemonic: ffree
- * operand: ['ST2']
- * opcode: 02
-**/
-bool X86Architecture::Table_fp6_c2(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    rInsn.Size()++;
-    rInsn.SetOpcode(X86_Opcode_Ffree);
-    if (Operand__ST2(rBinStrm, Offset, rInsn, Mode) == false)
-    {
-      return false;
-    }
-    return true;
-}
-
-/** instruction
- * mnemonic: ffree
- * operand: ['ST3']
- * opcode: 03
-**/
-bool X86Architecture::Table_fp6_c3(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    rInsn.Size()++;
-    rInsn.SetOpcode(X86_Opcode_Ffree);
-    if (Operand__ST3(rBinStrm, Offset, rInsn, Mode) == false)
-    {
-      return false;
-    }
-    return true;
-}
-
-/** instruction
- * mnemonic: ffree
- * operand: ['ST4']
- * opcode: 04
-**/
-bool X86Architecture::Table_fp6_c4(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    rInsn.Size()++;
-    rInsn.SetOpcode(X86_Opcode_Ffree);
-    if (Operand__ST4(rBinStrm, Offset, rInsn, Mode) == false)
-    {
-      return false;
-    }
-    return true;
-}
-
-/** instruction
- * mnemonic: ffree
- * operand: ['ST5']
- * opcode: 05
-**/
-bool X86Architecture::Table_fp6_c5(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    rInsn.Size()++;
-    rInsn.SetOpcode(X86_Opcode_Ffree);
-    if (Operand__ST5(rBinStrm, Offset, rInsn, Mode) == false)
-    {
-      return false;
-    }
-    return true;
-}
-
-/** instruction
- * mnemonic: ffree
- * operand: ['ST6']
- * opcode: 06
-**/
-bool X86Architecture::Table_fp6_c6(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    rInsn.Size()++;
-    rInsn.SetOpcode(X86_Opcode_Ffree);
-    if (Operand__ST6(rBinStrm, Offset, rInsn, Mode) == false)
-    {
-      return false;
-    }
-    return true;
-}
-
-/** instruction
- * mnemonic: ffree
- * operand: ['ST7']
- * opcode: 07
-**/
-bool X86Architecture::Table_fp6_c7(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    rInsn.Size()++;
-    rInsn.SetOpcode(X86_Opcode_Ffree);
-    if (Operand__ST7(rBinStrm, Offset, rInsn, Mode) == false)
-    {
-      return false;
-    }
-    return true;
-}
-
-/** instruction
- * mnemonic: fxch
- * operand: ['ST0']
- * opcode: 08
-**/
-bool X86Architecture::Table_fp6_c8(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    rInsn.Size()++;
-    rInsn.SetOpcode(X86_Opcode_Fxch);
-    if (Operand__ST0(rBinStrm, Offset, rInsn, Mode) == false)
-    {
-      return false;
-    }
-    return true;
-}
-
-/** instruction
- * mnemonic: fxch
- * operand: ['ST1']
- * opcode: 09
-**/
-bool X86Architecture::Table_fp6_c9(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    rInsn.Size()++;
-    rInsn.SetOpcode(X86_Opcode_Fxch);
-    if (Operand__ST1(rBinStrm, Offset, rInsn, Mode) == false)
-    {
-      return false;
-    }
-    return true;
-}
-
-/** instruction
- * mnemonic: fxch
- * operand: ['ST2']
- * opcode: 0a
-**/
-bool X86Architecture::Table_fp6_ca(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    rInsn.Size()++;
-    rInsn.SetOpcode(X86_Opcode_Fxch);
-    if (Operand__ST2(rBinStrm, Offset, rInsn, Mode) == false)
-    {
-      return false;
-    }
-    return true;
-}
-
-/** instruction
- * mnemonic: fxch
- * operand: ['ST3']
- * opcode: 0b
-**/
-bool X86Architecture::Table_fp6_cb(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    rInsn.Size()++;
-    rInsn.SetOpcode(X86_Opcode_Fxch);
-    if (Operand__ST3(rBinStrm, Offset, rInsn, Mode) == false)
-    {
-      return false;
-    }
-    return true;
-}
-
-/** instruction
- * mnemonic: fxch
- * operand: ['ST4']
- * opcode: 0c
-**/
-bool X86Architecture::Table_fp6_cc(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    rInsn.Size()++;
-    rInsn.SetOpcode(X86_Opcode_Fxch);
-    if (Operand__ST4(rBinStrm, Offset, rInsn, Mode) == false)
-    {
-      return false;
-    }
-    return true;
-}
-
-/** instruction
- * mnemonic: fxch
- * operand: ['ST5']
- * opcode: 0d
-**/
-bool X86Architecture::Table_fp6_cd(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    rInsn.Size()++;
-    rInsn.SetOpcode(X86_Opcode_Fxch);
-    if (Operand__ST5(rBinStrm, Offset, rInsn, Mode) == false)
-    {
-      return false;
-    }
-    return true;
-}
-
-/** instruction
- * mnemonic: fxch
- * operand: ['ST6']
- * opcode: 0e
-**/
-bool X86Architecture::Table_fp6_ce(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    rInsn.Size()++;
-    rInsn.SetOpcode(X86_Opcode_Fxch);
-    if (Operand__ST6(rBinStrm, Offset, rInsn, Mode) == false)
-    {
-      return false;
-    }
-    return true;
-}
-
-/** instruction
- * mnemonic: fxch
- * operand: ['ST7']
- * opcode: 0f
-**/
-bool X86Architecture::Table_fp6_cf(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    rInsn.Size()++;
-    rInsn.SetOpcode(X86_Opcode_Fxch);
-    if (Operand__ST7(rBinStrm, Offset, rInsn, Mode) == false)
-    {
-      return false;
-    }
-    return true;
-}
-
-/** instruction
- * mnemonic: fst
- * operand: ['ST0']
- * opcode: 10
-**/
-bool X86Architecture::Table_fp6_d0(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    rInsn.Size()++;
-    rInsn.SetOpcode(X86_Opcode_Fst);
-    if (Operand__ST0(rBinStrm, Offset, rInsn, Mode) == false)
-    {
-      return false;
-    }
-    return true;
-}
-
-/** instruction
- * mnemonic: fst
- * operand: ['ST1']
- * opcode: 11
-**/
-bool X86Architecture::Table_fp6_d1(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    rInsn.Size()++;
-    rInsn.SetOpcode(X86_Opcode_Fst);
-    if (Operand__ST1(rBinStrm, Offset, rInsn, Mode) == false)
-    {
-      return false;
-    }
-    return true;
-}
-
-/** instruction
- * mnemonic: fst
- * operand: ['ST2']
- * opcode: 12
-**/
-bool X86Architecture::Table_fp6_d2(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    rInsn.Size()++;
-    rInsn.SetOpcode(X86_Opcode_Fst);
-    if (Operand__ST2(rBinStrm, Offset, rInsn, Mode) == false)
-    {
-      return false;
-    }
-    return true;
-}
-
-/** instruction
- * mnemonic: fst
- * operand: ['ST3']
- * opcode: 13
-**/
-bool X86Architecture::Table_fp6_d3(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    rInsn.Size()++;
-    rInsn.SetOpcode(X86_Opcode_Fst);
-    if (Operand__ST3(rBinStrm, Offset, rInsn, Mode) == false)
-    {
-      return false;
-    }
-    return true;
-}
-
-/** instruction
- * mnemonic: fst
- * operand: ['ST4']
- * opcode: 14
-**/
-bool X86Architecture::Table_fp6_d4(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    rInsn.Size()++;
-    rInsn.SetOpcode(X86_Opcode_Fst);
-    if (Operand__ST4(rBinStrm, Offset, rInsn, Mode) == false)
-    {
-      return false;
-    }
-    return true;
-}
-
-/** instruction
- * mnemonic: fst
- * operand: ['ST5']
- * opcode: 15
-**/
-bool X86Architecture::Table_fp6_d5(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    rInsn.Size()++;
-    rInsn.SetOpcode(X86_Opcode_Fst);
-    if (Operand__ST5(rBinStrm, Offset, rInsn, Mode) == false)
-    {
-      return false;
-    }
-    return true;
-}
-
-/** instruction
- * mnemonic: fst
- * operand: ['ST6']
- * opcode: 16
-**/
-bool X86Architecture::Table_fp6_d6(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    rInsn.Size()++;
-    rInsn.SetOpcode(X86_Opcode_Fst);
-    if (Operand__ST6(rBinStrm, Offset, rInsn, Mode) == false)
-    {
-      return false;
-    }
-    return true;
-}
-
-/** instruction
- * mnemonic: fst
- * operand: ['ST7']
- * opcode: 17
-**/
-bool X86Architecture::Table_fp6_d7(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    rInsn.Size()++;
-    rInsn.SetOpcode(X86_Opcode_Fst);
-    if (Operand__ST7(rBinStrm, Offset, rInsn, Mode) == false)
-    {
-      return false;
-    }
-    return true;
-}
-
-/** instruction
- * mnemonic: fstp
- * operand: ['ST0']
- * opcode: 18
-**/
-bool X86Architecture::Table_fp6_d8(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    rInsn.Size()++;
-    rInsn.SetOpcode(X86_Opcode_Fstp);
-    if (Operand__ST0(rBinStrm, Offset, rInsn, Mode) == false)
-    {
-      return false;
-    }
-    return true;
-}
-
-/** instruction
- * mnemonic: fstp
- * operand: ['ST1']
- * opcode: 19
-**/
-bool X86Architecture::Table_fp6_d9(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    rInsn.Size()++;
-    rInsn.SetOpcode(X86_Opcode_Fstp);
-    if (Operand__ST1(rBinStrm, Offset, rInsn, Mode) == false)
-    {
-      return false;
-    }
-    return true;
-}
-
-/** instruction
- * mnemonic: fstp
- * operand: ['ST2']
- * opcode: 1a
-**/
-bool X86Architecture::Table_fp6_da(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    rInsn.Size()++;
-    rInsn.SetOpcode(X86_Opcode_Fstp);
-    if (Operand__ST2(rBinStrm, Offset, rInsn, Mode) == false)
-    {
-      return false;
-    }
-    return true;
-}
-
-/** instruction
- * mnemonic: fstp
- * operand: ['ST3']
- * opcode: 1b
-**/
-bool X86Architecture::Table_fp6_db(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    rInsn.Size()++;
-    rInsn.SetOpcode(X86_Opcode_Fstp);
-    if (Operand__ST3(rBinStrm, Offset, rInsn, Mode) == false)
-    {
-      return false;
-    }
-    return true;
-}
-
-/** instruction
- * mnemonic: fstp
- * operand: ['ST4']
- * opcode: 1c
-**/
-bool X86Architecture::Table_fp6_dc(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    rInsn.Size()++;
-    rInsn.SetOpcode(X86_Opcode_Fstp);
-    if (Operand__ST4(rBinStrm, Offset, rInsn, Mode) == false)
-    {
-      return false;
-    }
-    return true;
-}
-
-/** instruction
- * mnemonic: fstp
- * operand: ['ST5']
- * opcode: 1d
-**/
-bool X86Architecture::Table_fp6_dd(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    rInsn.Size()++;
-    rInsn.SetOpcode(X86_Opcode_Fstp);
-    if (Operand__ST5(rBinStrm, Offset, rInsn, Mode) == false)
-    {
-      return false;
-    }
-    return true;
-}
-
-/** instruction
- * mnemonic: fstp
- * operand: ['ST6']
- * opcode: 1e
-**/
-bool X86Architecture::Table_fp6_de(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    rInsn.Size()++;
-    rInsn.SetOpcode(X86_Opcode_Fstp);
-    if (Operand__ST6(rBinStrm, Offset, rInsn, Mode) == false)
-    {
-      return false;
-    }
-    return true;
-}
-
-/** instruction
- * mnemonic: fstp
- * operand: ['ST7']
- * opcode: 1f
-**/
-bool X86Architecture::Table_fp6_df(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    rInsn.Size()++;
-    rInsn.SetOpcode(X86_Opcode_Fstp);
-    if (Operand__ST7(rBinStrm, Offset, rInsn, Mode) == false)
-    {
-      return false;
-    }
-    return true;
-}
-
-/** instruction
+ * opcode: 20
  * mnemonic: fucom
  * operand: ['ST0', 'ST0']
- * opcode: 20
  * cpu_model: >= X86_Arch_80387
 **/
-bool X86Architecture::Table_fp6_e0(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_fp6_e0(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_80387)
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Fucom);
-      if (Operand__ST0_ST0(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__ST0_ST0<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -603,18 +92,19 @@ bool X86Architecture::Table_fp6_e0(BinaryStream const& rBinStrm, OffsetType Offs
 }
 
 /** instruction
+ * opcode: 21
  * mnemonic: fucom
  * operand: ['ST1', 'ST0']
- * opcode: 21
  * cpu_model: >= X86_Arch_80387
 **/
-bool X86Architecture::Table_fp6_e1(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_fp6_e1(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_80387)
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Fucom);
-      if (Operand__ST1_ST0(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__ST1_ST0<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -625,18 +115,19 @@ bool X86Architecture::Table_fp6_e1(BinaryStream const& rBinStrm, OffsetType Offs
 }
 
 /** instruction
+ * opcode: 22
  * mnemonic: fucom
  * operand: ['ST2', 'ST0']
- * opcode: 22
  * cpu_model: >= X86_Arch_80387
 **/
-bool X86Architecture::Table_fp6_e2(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_fp6_e2(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_80387)
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Fucom);
-      if (Operand__ST2_ST0(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__ST2_ST0<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -647,18 +138,19 @@ bool X86Architecture::Table_fp6_e2(BinaryStream const& rBinStrm, OffsetType Offs
 }
 
 /** instruction
+ * opcode: 23
  * mnemonic: fucom
  * operand: ['ST3', 'ST0']
- * opcode: 23
  * cpu_model: >= X86_Arch_80387
 **/
-bool X86Architecture::Table_fp6_e3(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_fp6_e3(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_80387)
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Fucom);
-      if (Operand__ST3_ST0(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__ST3_ST0<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -669,18 +161,19 @@ bool X86Architecture::Table_fp6_e3(BinaryStream const& rBinStrm, OffsetType Offs
 }
 
 /** instruction
+ * opcode: 24
  * mnemonic: fucom
  * operand: ['ST4', 'ST0']
- * opcode: 24
  * cpu_model: >= X86_Arch_80387
 **/
-bool X86Architecture::Table_fp6_e4(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_fp6_e4(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_80387)
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Fucom);
-      if (Operand__ST4_ST0(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__ST4_ST0<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -691,18 +184,19 @@ bool X86Architecture::Table_fp6_e4(BinaryStream const& rBinStrm, OffsetType Offs
 }
 
 /** instruction
+ * opcode: 25
  * mnemonic: fucom
  * operand: ['ST5', 'ST0']
- * opcode: 25
  * cpu_model: >= X86_Arch_80387
 **/
-bool X86Architecture::Table_fp6_e5(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_fp6_e5(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_80387)
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Fucom);
-      if (Operand__ST5_ST0(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__ST5_ST0<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -713,18 +207,19 @@ bool X86Architecture::Table_fp6_e5(BinaryStream const& rBinStrm, OffsetType Offs
 }
 
 /** instruction
+ * opcode: 26
  * mnemonic: fucom
  * operand: ['ST6', 'ST0']
- * opcode: 26
  * cpu_model: >= X86_Arch_80387
 **/
-bool X86Architecture::Table_fp6_e6(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_fp6_e6(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_80387)
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Fucom);
-      if (Operand__ST6_ST0(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__ST6_ST0<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -735,18 +230,19 @@ bool X86Architecture::Table_fp6_e6(BinaryStream const& rBinStrm, OffsetType Offs
 }
 
 /** instruction
+ * opcode: 27
  * mnemonic: fucom
  * operand: ['ST7', 'ST0']
- * opcode: 27
  * cpu_model: >= X86_Arch_80387
 **/
-bool X86Architecture::Table_fp6_e7(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_fp6_e7(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_80387)
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Fucom);
-      if (Operand__ST7_ST0(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__ST7_ST0<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -757,18 +253,19 @@ bool X86Architecture::Table_fp6_e7(BinaryStream const& rBinStrm, OffsetType Offs
 }
 
 /** instruction
+ * opcode: 28
  * mnemonic: fucomp
  * operand: ['ST0']
- * opcode: 28
  * cpu_model: >= X86_Arch_80387
 **/
-bool X86Architecture::Table_fp6_e8(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_fp6_e8(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_80387)
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Fucomp);
-      if (Operand__ST0(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__ST0<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -779,18 +276,19 @@ bool X86Architecture::Table_fp6_e8(BinaryStream const& rBinStrm, OffsetType Offs
 }
 
 /** instruction
+ * opcode: 29
  * mnemonic: fucomp
  * operand: ['ST1']
- * opcode: 29
  * cpu_model: >= X86_Arch_80387
 **/
-bool X86Architecture::Table_fp6_e9(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_fp6_e9(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_80387)
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Fucomp);
-      if (Operand__ST1(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__ST1<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -801,18 +299,19 @@ bool X86Architecture::Table_fp6_e9(BinaryStream const& rBinStrm, OffsetType Offs
 }
 
 /** instruction
+ * opcode: 2a
  * mnemonic: fucomp
  * operand: ['ST2']
- * opcode: 2a
  * cpu_model: >= X86_Arch_80387
 **/
-bool X86Architecture::Table_fp6_ea(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_fp6_ea(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_80387)
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Fucomp);
-      if (Operand__ST2(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__ST2<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -823,18 +322,19 @@ bool X86Architecture::Table_fp6_ea(BinaryStream const& rBinStrm, OffsetType Offs
 }
 
 /** instruction
+ * opcode: 2b
  * mnemonic: fucomp
  * operand: ['ST3']
- * opcode: 2b
  * cpu_model: >= X86_Arch_80387
 **/
-bool X86Architecture::Table_fp6_eb(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_fp6_eb(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_80387)
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Fucomp);
-      if (Operand__ST3(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__ST3<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -845,18 +345,19 @@ bool X86Architecture::Table_fp6_eb(BinaryStream const& rBinStrm, OffsetType Offs
 }
 
 /** instruction
+ * opcode: 2c
  * mnemonic: fucomp
  * operand: ['ST4']
- * opcode: 2c
  * cpu_model: >= X86_Arch_80387
 **/
-bool X86Architecture::Table_fp6_ec(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_fp6_ec(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_80387)
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Fucomp);
-      if (Operand__ST4(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__ST4<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -867,18 +368,19 @@ bool X86Architecture::Table_fp6_ec(BinaryStream const& rBinStrm, OffsetType Offs
 }
 
 /** instruction
+ * opcode: 2d
  * mnemonic: fucomp
  * operand: ['ST5']
- * opcode: 2d
  * cpu_model: >= X86_Arch_80387
 **/
-bool X86Architecture::Table_fp6_ed(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_fp6_ed(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_80387)
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Fucomp);
-      if (Operand__ST5(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__ST5<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -889,18 +391,19 @@ bool X86Architecture::Table_fp6_ed(BinaryStream const& rBinStrm, OffsetType Offs
 }
 
 /** instruction
+ * opcode: 2e
  * mnemonic: fucomp
  * operand: ['ST6']
- * opcode: 2e
  * cpu_model: >= X86_Arch_80387
 **/
-bool X86Architecture::Table_fp6_ee(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_fp6_ee(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_80387)
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Fucomp);
-      if (Operand__ST6(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__ST6<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -911,18 +414,19 @@ bool X86Architecture::Table_fp6_ee(BinaryStream const& rBinStrm, OffsetType Offs
 }
 
 /** instruction
+ * opcode: 2f
  * mnemonic: fucomp
  * operand: ['ST7']
- * opcode: 2f
  * cpu_model: >= X86_Arch_80387
 **/
-bool X86Architecture::Table_fp6_ef(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_fp6_ef(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Architecture") >= X86_Arch_80387)
     {
       rInsn.Size()++;
       rInsn.SetOpcode(X86_Opcode_Fucomp);
-      if (Operand__ST7(rBinStrm, Offset, rInsn, Mode) == false)
+      if (Operand__ST7<Mode>(rBinStrm, Offset, rInsn) == false)
       {
         return false;
       }
@@ -932,114 +436,6 @@ bool X86Architecture::Table_fp6_ef(BinaryStream const& rBinStrm, OffsetType Offs
       return false;
 }
 
-/** instruction
- * opcode: 30
- * invalid
-**/
-bool X86Architecture::Table_fp6_f0(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: 31
- * invalid
-**/
-bool X86Architecture::Table_fp6_f1(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: 32
- * invalid
-**/
-bool X86Architecture::Table_fp6_f2(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: 33
- * invalid
-**/
-bool X86Architecture::Table_fp6_f3(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: 34
- * invalid
-**/
-bool X86Architecture::Table_fp6_f4(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: 35
- * invalid
-**/
-bool X86Architecture::Table_fp6_f5(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: 36
- * invalid
-**/
-bool X86Architecture::Table_fp6_f6(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: 37
- * invalid
-**/
-bool X86Architecture::Table_fp6_f7(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: 38
- * invalid
-**/
-bool X86Architecture::Table_fp6_f8(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: 39
- * invalid
-**/
-bool X86Architecture::Table_fp6_f9(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: 3a
- * invalid
-**/
-bool X86Architecture::Table_fp6_fa(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: 3b
- * invalid
-**/
-bool X86Architecture::Table_fp6_fb(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
 /** instructions
  * opcode: 3c
  *
@@ -1049,7 +445,8 @@ bool X86Architecture::Table_fp6_fb(BinaryStream const& rBinStrm, OffsetType Offs
  * attr: ['cyrix']
  *
 **/
-bool X86Architecture::Table_fp6_fc(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Table_fp6_fc(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
     if (m_CfgMdl.GetEnum("Vendor") == X86_ProcType_CYRIX)
     {
@@ -1063,30 +460,20 @@ bool X86Architecture::Table_fp6_fc(BinaryStream const& rBinStrm, OffsetType Offs
     }
 }
 
-/** instruction
- * opcode: 3d
- * invalid
-**/
-bool X86Architecture::Table_fp6_fd(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: 3e
- * invalid
-**/
-bool X86Architecture::Table_fp6_fe(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
-/** instruction
- * opcode: 3f
- * invalid
-**/
-bool X86Architecture::Table_fp6_ff(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
-{
-    return false; /* INVALID */
-}
-
+X86_INSTANTIATE_DISASSEMBLER(Table_fp6_e0);
+X86_INSTANTIATE_DISASSEMBLER(Table_fp6_e1);
+X86_INSTANTIATE_DISASSEMBLER(Table_fp6_e2);
+X86_INSTANTIATE_DISASSEMBLER(Table_fp6_e3);
+X86_INSTANTIATE_DISASSEMBLER(Table_fp6_e4);
+X86_INSTANTIATE_DISASSEMBLER(Table_fp6_e5);
+X86_INSTANTIATE_DISASSEMBLER(Table_fp6_e6);
+X86_INSTANTIATE_DISASSEMBLER(Table_fp6_e7);
+X86_INSTANTIATE_DISASSEMBLER(Table_fp6_e8);
+X86_INSTANTIATE_DISASSEMBLER(Table_fp6_e9);
+X86_INSTANTIATE_DISASSEMBLER(Table_fp6_ea);
+X86_INSTANTIATE_DISASSEMBLER(Table_fp6_eb);
+X86_INSTANTIATE_DISASSEMBLER(Table_fp6_ec);
+X86_INSTANTIATE_DISASSEMBLER(Table_fp6_ed);
+X86_INSTANTIATE_DISASSEMBLER(Table_fp6_ee);
+X86_INSTANTIATE_DISASSEMBLER(Table_fp6_ef);
+X86_INSTANTIATE_DISASSEMBLER(Table_fp6_fc);
@@ -1,10 +1,11 @@
-/* This file has been automatically generated, you must _NOT_ edit it directly. (Sun Feb 05 12:38:19 2017) */
+/* This file has been automatically generated, you must _NOT_ edit it directly. (Mon Oct 19 07:47:42 2026) */
 #include "x86_architecture.hpp"
 /* operand ['op0 = decode_3'] */
-bool X86Architecture::Operand__3(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Operand__3(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: op0 = decode_3
-  auto spOprd0 = Decode_3(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd0 = Decode_3<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd0 == nullptr)
     return false;
   rInsn.AddOperand(spOprd0);
@@ -13,16 +14,17 @@ bool X86Architecture::Operand__3(BinaryStream const& rBinStrm, OffsetType Offset
 }
 
 /* operand ['op0 = decode_AH', 'op1 = decode_Ib'] */
-bool X86Architecture::Operand__AH_Ib(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Operand__AH_Ib(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: op0 = decode_AH
-  auto spOprd0 = Decode_AH(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd0 = Decode_AH<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd0 == nullptr)
     return false;
   rInsn.AddOperand(spOprd0);
 
   // operand1: op1 = decode_Ib
-  auto spOprd1 = Decode_Ib(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd1 = Decode_Ib<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd1 == nullptr)
     return false;
   rInsn.AddOperand(spOprd1);
@@ -31,16 +33,17 @@ bool X86Architecture::Operand__AH_Ib(BinaryStream const& rBinStrm, OffsetType Of
 }
 
 /* operand ['op0 = decode_AL', 'op1 = decode_DX'] */
-bool X86Architecture::Operand__AL_DX(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Operand__AL_DX(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: op0 = decode_AL
-  auto spOprd0 = Decode_AL(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd0 = Decode_AL<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd0 == nullptr)
     return false;
   rInsn.AddOperand(spOprd0);
 
   // operand1: op1 = decode_DX
-  auto spOprd1 = Decode_DX(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd1 = Decode_DX<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd1 == nullptr)
     return false;
   rInsn.AddOperand(spOprd1);
@@ -49,16 +52,17 @@ bool X86Architecture::Operand__AL_DX(BinaryStream const& rBinStrm, OffsetType Of
 }
 
 /* operand ['op0 = decode_AL', 'op1 = decode_Ib'] */
-bool X86Architecture::Operand__AL_Ib(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Operand__AL_Ib(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: op0 = decode_AL
-  auto spOprd0 = Decode_AL(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd0 = Decode_AL<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd0 == nullptr)
     return false;
   rInsn.AddOperand(spOprd0);
 
   // operand1: op1 = decode_Ib
-  auto spOprd1 = Decode_Ib(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd1 = Decode_Ib<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd1 == nullptr)
     return false;
   rInsn.AddOperand(spOprd1);
@@ -67,16 +71,17 @@ bool X86Architecture::Operand__AL_Ib(BinaryStream const& rBinStrm, OffsetType Of
 }
 
 /* operand ['op0 = decode_AL', 'op1 = decode_Ob'] */
-bool X86Architecture::Operand__AL_Ob(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Operand__AL_Ob(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: op0 = decode_AL
-  auto spOprd0 = Decode_AL(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd0 = Decode_AL<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd0 == nullptr)
     return false;
   rInsn.AddOperand(spOprd0);
 
   // operand1: op1 = decode_Ob
-  auto spOprd1 = Decode_Ob(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd1 = Decode_Ob<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd1 == nullptr)
     return false;
   rInsn.AddOperand(spOprd1);
@@ -85,16 +90,17 @@ bool X86Architecture::Operand__AL_Ob(BinaryStream const& rBinStrm, OffsetType Of
 }
 
 /* operand ['op0 = decode_AL', 'op1 = decode_Xb'] */
-bool X86Architecture::Operand__AL_Xb(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Operand__AL_Xb(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: op0 = decode_AL
-  auto spOprd0 = Decode_AL(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd0 = Decode_AL<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd0 == nullptr)
     return false;
   rInsn.AddOperand(spOprd0);
 
   // operand1: op1 = decode_Xb
-  auto spOprd1 = Decode_Xb(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd1 = Decode_Xb<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd1 == nullptr)
     return false;
   rInsn.AddOperand(spOprd1);
@@ -103,16 +109,17 @@ bool X86Architecture::Operand__AL_Xb(BinaryStream const& rBinStrm, OffsetType Of
 }
 
 /* operand ['op0 = decode_AL', 'op1 = decode_Yb'] */
-bool X86Architecture::Operand__AL_Yb(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Operand__AL_Yb(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: op0 = decode_AL
-  auto spOprd0 = Decode_AL(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd0 = Decode_AL<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd0 == nullptr)
     return false;
   rInsn.AddOperand(spOprd0);
 
   // operand1: op1 = decode_Yb
-  auto spOprd1 = Decode_Yb(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd1 = Decode_Yb<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd1 == nullptr)
     return false;
   rInsn.AddOperand(spOprd1);
@@ -121,10 +128,11 @@ bool X86Architecture::Operand__AL_Yb(BinaryStream const& rBinStrm, OffsetType Of
 }
 
 /* operand ['op0 = decode_AX'] */
-bool X86Architecture::Operand__AX(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Operand__AX(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: op0 = decode_AX
-  auto spOprd0 = Decode_AX(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd0 = Decode_AX<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd0 == nullptr)
     return false;
   rInsn.AddOperand(spOprd0);
@@ -133,10 +141,11 @@ bool X86Architecture::Operand__AX(BinaryStream const& rBinStrm, OffsetType Offse
 }
 
 /* operand ['op0 = decode_Ap'] */
-bool X86Architecture::Operand__Ap(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Operand__Ap(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: op0 = decode_Ap
-  auto spOprd0 = Decode_Ap(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd0 = Decode_Ap<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd0 == nullptr)
     return false;
   rInsn.AddOperand(spOprd0);
@@ -145,16 +154,17 @@ bool X86Architecture::Operand__Ap(BinaryStream const& rBinStrm, OffsetType Offse
 }
 
 /* operand ['op0 = decode_BH', 'op1 = decode_Ib'] */
-bool X86Architecture::Operand__BH_Ib(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Operand__BH_Ib(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: op0 = decode_BH
-  auto spOprd0 = Decode_BH(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd0 = Decode_BH<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd0 == nullptr)
     return false;
   rInsn.AddOperand(spOprd0);
 
   // operand1: op1 = decode_Ib
-  auto spOprd1 = Decode_Ib(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd1 = Decode_Ib<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd1 == nullptr)
     return false;
   rInsn.AddOperand(spOprd1);
@@ -163,16 +173,17 @@ bool X86Architecture::Operand__BH_Ib(BinaryStream const& rBinStrm, OffsetType Of
 }
 
 /* operand ['op0 = decode_BL', 'op1 = decode_Ib'] */
-bool X86Architecture::Operand__BL_Ib(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Operand__BL_Ib(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: op0 = decode_BL
-  auto spOprd0 = Decode_BL(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd0 = Decode_BL<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd0 == nullptr)
     return false;
   rInsn.AddOperand(spOprd0);
 
   // operand1: op1 = decode_Ib
-  auto spOprd1 = Decode_Ib(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd1 = Decode_Ib<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd1 == nullptr)
     return false;
   rInsn.AddOperand(spOprd1);
@@ -181,16 +192,17 @@ bool X86Architecture::Operand__BL_Ib(BinaryStream const& rBinStrm, OffsetType Of
 }
 
 /* operand ['op0 = decode_By', 'op1 = decode_Ey'] */
-bool X86Architecture::Operand__By_Ey(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Operand__By_Ey(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: op0 = decode_By
-  auto spOprd0 = Decode_By(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd0 = Decode_By<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd0 == nullptr)
     return false;
   rInsn.AddOperand(spOprd0);
 
   // operand1: op1 = decode_Ey
-  auto spOprd1 = Decode_Ey(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd1 = Decode_Ey<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd1 == nullptr)
     return false;
   rInsn.AddOperand(spOprd1);
@@ -198,23 +210,28 @@ bool X86Architecture::Operand__By_Ey(BinaryStream const& rBinStrm, OffsetType Of
   return true;
 }
 
-/* operand ['op0 = decode_By', 'op1 = decode_Ey', 'op2 = decode_Ib'] */
-bool X86Architecture::Operand__By_Ey_Ib(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+/* operand ['last_len', 'op0 = decode_By', 'op1 = decode_Ey', 'move_decode_offset(next_operand)', 'op2 = decode_Ib'] */
+template<u8 Mode>
+bool X86Architecture::Operand__By_Ey_Ib(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
+  // operand0: last_len
+  auto LastLen = rInsn.GetSize();
   // operand0: op0 = decode_By
-  auto spOprd0 = Decode_By(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd0 = Decode_By<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd0 == nullptr)
     return false;
   rInsn.AddOperand(spOprd0);
 
   // operand1: op1 = decode_Ey
-  auto spOprd1 = Decode_Ey(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd1 = Decode_Ey<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd1 == nullptr)
     return false;
   rInsn.AddOperand(spOprd1);
 
+  // operand2: move_decode_offset(next_operand)
+  Offset += (rInsn.GetSize() - LastLen);
   // operand2: op2 = decode_Ib
-  auto spOprd2 = Decode_Ib(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd2 = Decode_Ib<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd2 == nullptr)
     return false;
   rInsn.AddOperand(spOprd2);
@@ -223,16 +240,17 @@ bool X86Architecture::Operand__By_Ey_Ib(BinaryStream const& rBinStrm, OffsetType
 }
 
 /* operand ['op0 = decode_CH', 'op1 = decode_Ib'] */
-bool X86Architecture::Operand__CH_Ib(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Operand__CH_Ib(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: op0 = decode_CH
-  auto spOprd0 = Decode_CH(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd0 = Decode_CH<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd0 == nullptr)
     return false;
   rInsn.AddOperand(spOprd0);
 
   // operand1: op1 = decode_Ib
-  auto spOprd1 = Decode_Ib(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd1 = Decode_Ib<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd1 == nullptr)
     return false;
   rInsn.AddOperand(spOprd1);
@@ -241,16 +259,17 @@ bool X86Architecture::Operand__CH_Ib(BinaryStream const& rBinStrm, OffsetType Of
 }
 
 /* operand ['op0 = decode_CL', 'op1 = decode_Ib'] */
-bool X86Architecture::Operand__CL_Ib(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Operand__CL_Ib(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: op0 = decode_CL
-  auto spOprd0 = Decode_CL(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd0 = Decode_CL<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd0 == nullptr)
     return false;
   rInsn.AddOperand(spOprd0);
 
   // operand1: op1 = decode_Ib
-  auto spOprd1 = Decode_Ib(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd1 = Decode_Ib<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd1 == nullptr)
     return false;
   rInsn.AddOperand(spOprd1);
@@ -259,10 +278,11 @@ bool X86Architecture::Operand__CL_Ib(BinaryStream const& rBinStrm, OffsetType Of
 }
 
 /* operand ['op0 = decode_CS'] */
-bool X86Architecture::Operand__CS(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Operand__CS(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: op0 = decode_CS
-  auto spOprd0 = Decode_CS(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd0 = Decode_CS<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd0 == nullptr)
     return false;
   rInsn.AddOperand(spOprd0);
@@ -271,16 +291,17 @@ bool X86Architecture::Operand__CS(BinaryStream const& rBinStrm, OffsetType Offse
 }
 
 /* operand ['op0 = decode_DH', 'op1 = decode_Ib'] */
-bool X86Architecture::Operand__DH_Ib(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Operand__DH_Ib(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: op0 = decode_DH
-  auto spOprd0 = Decode_DH(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd0 = Decode_DH<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd0 == nullptr)
     return false;
   rInsn.AddOperand(spOprd0);
 
   // operand1: op1 = decode_Ib
-  auto spOprd1 = Decode_Ib(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd1 = Decode_Ib<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd1 == nullptr)
     return false;
   rInsn.AddOperand(spOprd1);
@@ -289,16 +310,17 @@ bool X86Architecture::Operand__DH_Ib(BinaryStream const& rBinStrm, OffsetType Of
 }
 
 /* operand ['op0 = decode_DL', 'op1 = decode_Ib'] */
-bool X86Architecture::Operand__DL_Ib(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Operand__DL_Ib(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: op0 = decode_DL
-  auto spOprd0 = Decode_DL(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd0 = Decode_DL<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd0 == nullptr)
     return false;
   rInsn.AddOperand(spOprd0);
 
   // operand1: op1 = decode_Ib
-  auto spOprd1 = Decode_Ib(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd1 = Decode_Ib<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd1 == nullptr)
     return false;
   rInsn.AddOperand(spOprd1);
@@ -307,10 +329,11 @@ bool X86Architecture::Operand__DL_Ib(BinaryStream const& rBinStrm, OffsetType Of
 }
 
 /* operand ['op0 = decode_DS'] */
-bool X86Architecture::Operand__DS(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Operand__DS(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: op0 = decode_DS
-  auto spOprd0 = Decode_DS(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd0 = Decode_DS<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd0 == nullptr)
     return false;
   rInsn.AddOperand(spOprd0);
@@ -319,16 +342,17 @@ bool X86Architecture::Operand__DS(BinaryStream const& rBinStrm, OffsetType Offse
 }
 
 /* operand ['op0 = decode_DX', 'op1 = decode_AL'] */
-bool X86Architecture::Operand__DX_AL(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Operand__DX_AL(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: op0 = decode_DX
-  auto spOprd0 = Decode_DX(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd0 = Decode_DX<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd0 == nullptr)
     return false;
   rInsn.AddOperand(spOprd0);
 
   // operand1: op1 = decode_AL
-  auto spOprd1 = Decode_AL(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd1 = Decode_AL<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd1 == nullptr)
     return false;
   rInsn.AddOperand(spOprd1);
@@ -337,16 +361,17 @@ bool X86Architecture::Operand__DX_AL(BinaryStream const& rBinStrm, OffsetType Of
 }
 
 /* operand ['op0 = decode_DX', 'op1 = decode_Xb'] */
-bool X86Architecture::Operand__DX_Xb(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Operand__DX_Xb(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: op0 = decode_DX
-  auto spOprd0 = Decode_DX(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd0 = Decode_DX<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd0 == nullptr)
     return false;
   rInsn.AddOperand(spOprd0);
 
   // operand1: op1 = decode_Xb
-  auto spOprd1 = Decode_Xb(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd1 = Decode_Xb<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd1 == nullptr)
     return false;
   rInsn.AddOperand(spOprd1);
@@ -355,16 +380,17 @@ bool X86Architecture::Operand__DX_Xb(BinaryStream const& rBinStrm, OffsetType Of
 }
 
 /* operand ['op0 = decode_DX', 'op1 = decode_Xz'] */
-bool X86Architecture::Operand__DX_Xz(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Operand__DX_Xz(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: op0 = decode_DX
-  auto spOprd0 = Decode_DX(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd0 = Decode_DX<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd0 == nullptr)
     return false;
   rInsn.AddOperand(spOprd0);
 
   // operand1: op1 = decode_Xz
-  auto spOprd1 = Decode_Xz(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd1 = Decode_Xz<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd1 == nullptr)
     return false;
   rInsn.AddOperand(spOprd1);
@@ -373,16 +399,17 @@ bool X86Architecture::Operand__DX_Xz(BinaryStream const& rBinStrm, OffsetType Of
 }
 
 /* operand ['op0 = decode_DX', 'op1 = decode_eAX'] */
-bool X86Architecture::Operand__DX_eAX(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Operand__DX_eAX(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: op0 = decode_DX
-  auto spOprd0 = Decode_DX(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd0 = Decode_DX<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd0 == nullptr)
     return false;
   rInsn.AddOperand(spOprd0);
 
   // operand1: op1 = decode_eAX
-  auto spOprd1 = Decode_eAX(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd1 = Decode_eAX<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd1 == nullptr)
     return false;
   rInsn.AddOperand(spOprd1);
@@ -391,16 +418,17 @@ bool X86Architecture::Operand__DX_eAX(BinaryStream const& rBinStrm, OffsetType O
 }
 
 /* operand ['op0 = decode_Dy', 'op1 = decode_Ry'] */
-bool X86Architecture::Operand__Dy_Ry(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Operand__Dy_Ry(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: op0 = decode_Dy
-  auto spOprd0 = Decode_Dy(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd0 = Decode_Dy<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd0 == nullptr)
     return false;
   rInsn.AddOperand(spOprd0);
 
   // operand1: op1 = decode_Ry
-  auto spOprd1 = Decode_Ry(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd1 = Decode_Ry<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd1 == nullptr)
     return false;
   rInsn.AddOperand(spOprd1);
@@ -409,10 +437,11 @@ bool X86Architecture::Operand__Dy_Ry(BinaryStream const& rBinStrm, OffsetType Of
 }
 
 /* operand ['op0 = decode_ES'] */
-bool X86Architecture::Operand__ES(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Operand__ES(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: op0 = decode_ES
-  auto spOprd0 = Decode_ES(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd0 = Decode_ES<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd0 == nullptr)
     return false;
   rInsn.AddOperand(spOprd0);
@@ -421,10 +450,11 @@ bool X86Architecture::Operand__ES(BinaryStream const& rBinStrm, OffsetType Offse
 }
 
 /* operand ['op0 = decode_Eb'] */
-bool X86Architecture::Operand__Eb(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Operand__Eb(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: op0 = decode_Eb
-  auto spOprd0 = Decode_Eb(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd0 = Decode_Eb<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd0 == nullptr)
     return false;
   rInsn.AddOperand(spOprd0);
@@ -433,16 +463,17 @@ bool X86Architecture::Operand__Eb(BinaryStream const& rBinStrm, OffsetType Offse
 }
 
 /* operand ['op0 = decode_Eb', 'op1 = decode_1'] */
-bool X86Architecture::Operand__Eb_1(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Operand__Eb_1(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: op0 = decode_Eb
-  auto spOprd0 = Decode_Eb(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd0 = Decode_Eb<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd0 == nullptr)
     return false;
   rInsn.AddOperand(spOprd0);
 
   // operand1: op1 = decode_1
-  auto spOprd1 = Decode_1(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd1 = Decode_1<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd1 == nullptr)
     return false;
   rInsn.AddOperand(spOprd1);
@@ -451,16 +482,17 @@ bool X86Architecture::Operand__Eb_1(BinaryStream const& rBinStrm, OffsetType Off
 }
 
 /* operand ['op0 = decode_Eb', 'op1 = decode_CL'] */
-bool X86Architecture::Operand__Eb_CL(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Operand__Eb_CL(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: op0 = decode_Eb
-  auto spOprd0 = Decode_Eb(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd0 = Decode_Eb<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd0 == nullptr)
     return false;
   rInsn.AddOperand(spOprd0);
 
   // operand1: op1 = decode_CL
-  auto spOprd1 = Decode_CL(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd1 = Decode_CL<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd1 == nullptr)
     return false;
   rInsn.AddOperand(spOprd1);
@@ -469,16 +501,17 @@ bool X86Architecture::Operand__Eb_CL(BinaryStream const& rBinStrm, OffsetType Of
 }
 
 /* operand ['op0 = decode_Eb', 'op1 = decode_Gb'] */
-bool X86Architecture::Operand__Eb_Gb(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Operand__Eb_Gb(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: op0 = decode_Eb
-  auto spOprd0 = Decode_Eb(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd0 = Decode_Eb<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd0 == nullptr)
     return false;
   rInsn.AddOperand(spOprd0);
 
   // operand1: op1 = decode_Gb
-  auto spOprd1 = Decode_Gb(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd1 = Decode_Gb<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd1 == nullptr)
     return false;
   rInsn.AddOperand(spOprd1);
@@ -487,12 +520,13 @@ bool X86Architecture::Operand__Eb_Gb(BinaryStream const& rBinStrm, OffsetType Of
 }
 
 /* operand ['last_len', 'op0 = decode_Eb', 'move_decode_offset(next_operand)', 'op1 = decode_Ib'] */
-bool X86Architecture::Operand__Eb_Ib(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Operand__Eb_Ib(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: last_len
   auto LastLen = rInsn.GetSize();
   // operand0: op0 = decode_Eb
-  auto spOprd0 = Decode_Eb(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd0 = Decode_Eb<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd0 == nullptr)
     return false;
   rInsn.AddOperand(spOprd0);
@@ -500,7 +534,7 @@ bool X86Architecture::Operand__Eb_Ib(BinaryStream const& rBinStrm, OffsetType Of
   // operand1: move_decode_offset(next_operand)
   Offset += (rInsn.GetSize() - LastLen);
   // operand1: op1 = decode_Ib
-  auto spOprd1 = Decode_Ib(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd1 = Decode_Ib<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd1 == nullptr)
     return false;
   rInsn.AddOperand(spOprd1);
@@ -509,10 +543,11 @@ bool X86Architecture::Operand__Eb_Ib(BinaryStream const& rBinStrm, OffsetType Of
 }
 
 /* operand ['op0 = decode_Ed'] */
-bool X86Architecture::Operand__Ed(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Operand__Ed(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: op0 = decode_Ed
-  auto spOprd0 = Decode_Ed(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd0 = Decode_Ed<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd0 == nullptr)
     return false;
   rInsn.AddOperand(spOprd0);
@@ -521,16 +556,17 @@ bool X86Architecture::Operand__Ed(BinaryStream const& rBinStrm, OffsetType Offse
 }
 
 /* operand ['op0 = decode_Ed', 'op1 = decode_Vo'] */
-bool X86Architecture::Operand__Ed_Vo(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Operand__Ed_Vo(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: op0 = decode_Ed
-  auto spOprd0 = Decode_Ed(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd0 = Decode_Ed<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd0 == nullptr)
     return false;
   rInsn.AddOperand(spOprd0);
 
   // operand1: op1 = decode_Vo
-  auto spOprd1 = Decode_Vo(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd1 = Decode_Vo<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd1 == nullptr)
     return false;
   rInsn.AddOperand(spOprd1);
@@ -539,10 +575,11 @@ bool X86Architecture::Operand__Ed_Vo(BinaryStream const& rBinStrm, OffsetType Of
 }
 
 /* operand ['op0 = decode_Ev'] */
-bool X86Architecture::Operand__Ev(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Operand__Ev(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: op0 = decode_Ev
-  auto spOprd0 = Decode_Ev(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd0 = Decode_Ev<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd0 == nullptr)
     return false;
   rInsn.AddOperand(spOprd0);
@@ -551,16 +588,17 @@ bool X86Architecture::Operand__Ev(BinaryStream const& rBinStrm, OffsetType Offse
 }
 
 /* operand ['op0 = decode_Ev', 'op1 = decode_1'] */
-bool X86Architecture::Operand__Ev_1(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Operand__Ev_1(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: op0 = decode_Ev
-  auto spOprd0 = Decode_Ev(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd0 = Decode_Ev<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd0 == nullptr)
     return false;
   rInsn.AddOperand(spOprd0);
 
   // operand1: op1 = decode_1
-  auto spOprd1 = Decode_1(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd1 = Decode_1<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd1 == nullptr)
     return false;
   rInsn.AddOperand(spOprd1);
@@ -569,16 +607,17 @@ bool X86Architecture::Operand__Ev_1(BinaryStream const& rBinStrm, OffsetType Off
 }
 
 /* operand ['op0 = decode_Ev', 'op1 = decode_CL'] */
-bool X86Architecture::Operand__Ev_CL(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Operand__Ev_CL(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: op0 = decode_Ev
-  auto spOprd0 = Decode_Ev(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd0 = Decode_Ev<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd0 == nullptr)
     return false;
   rInsn.AddOperand(spOprd0);
 
   // operand1: op1 = decode_CL
-  auto spOprd1 = Decode_CL(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd1 = Decode_CL<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd1 == nullptr)
     return false;
   rInsn.AddOperand(spOprd1);
@@ -587,16 +626,17 @@ bool X86Architecture::Operand__Ev_CL(BinaryStream const& rBinStrm, OffsetType Of
 }
 
 /* operand ['op0 = decode_Ev', 'op1 = decode_Gv'] */
-bool X86Architecture::Operand__Ev_Gv(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Operand__Ev_Gv(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: op0 = decode_Ev
-  auto spOprd0 = Decode_Ev(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd0 = Decode_Ev<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd0 == nullptr)
     return false;
   rInsn.AddOperand(spOprd0);
 
   // operand1: op1 = decode_Gv
-  auto spOprd1 = Decode_Gv(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd1 = Decode_Gv<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd1 == nullptr)
     return false;
   rInsn.AddOperand(spOprd1);
@@ -605,22 +645,23 @@ bool X86Architecture::Operand__Ev_Gv(BinaryStream const& rBinStrm, OffsetType Of
 }
 
 /* operand ['op0 = decode_Ev', 'op1 = decode_Gv', 'op2 = decode_CL'] */
-bool X86Architecture::Operand__Ev_Gv_CL(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Operand__Ev_Gv_CL(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: op0 = decode_Ev
-  auto spOprd0 = Decode_Ev(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd0 = Decode_Ev<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd0 == nullptr)
     return false;
   rInsn.AddOperand(spOprd0);
 
   // operand1: op1 = decode_Gv
-  auto spOprd1 = Decode_Gv(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd1 = Decode_Gv<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd1 == nullptr)
     return false;
   rInsn.AddOperand(spOprd1);
 
   // operand2: op2 = decode_CL
-  auto spOprd2 = Decode_CL(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd2 = Decode_CL<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd2 == nullptr)
     return false;
   rInsn.AddOperand(spOprd2);
@@ -629,18 +670,19 @@ bool X86Architecture::Operand__Ev_Gv_CL(BinaryStream const& rBinStrm, OffsetType
 }
 
 /* operand ['last_len', 'op0 = decode_Ev', 'op1 = decode_Gv', 'move_decode_offset(next_operand)', 'op2 = decode_Ib'] */
-bool X86Architecture::Operand__Ev_Gv_Ib(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Operand__Ev_Gv_Ib(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: last_len
   auto LastLen = rInsn.GetSize();
   // operand0: op0 = decode_Ev
-  auto spOprd0 = Decode_Ev(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd0 = Decode_Ev<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd0 == nullptr)
     return false;
   rInsn.AddOperand(spOprd0);
 
   // operand1: op1 = decode_Gv
-  auto spOprd1 = Decode_Gv(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd1 = Decode_Gv<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd1 == nullptr)
     return false;
   rInsn.AddOperand(spOprd1);
@@ -648,7 +690,7 @@ bool X86Architecture::Operand__Ev_Gv_Ib(BinaryStream const& rBinStrm, OffsetType
   // operand2: move_decode_offset(next_operand)
   Offset += (rInsn.GetSize() - LastLen);
   // operand2: op2 = decode_Ib
-  auto spOprd2 = Decode_Ib(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd2 = Decode_Ib<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd2 == nullptr)
     return false;
   rInsn.AddOperand(spOprd2);
@@ -657,12 +699,13 @@ bool X86Architecture::Operand__Ev_Gv_Ib(BinaryStream const& rBinStrm, OffsetType
 }
 
 /* operand ['last_len', 'op0 = decode_Ev', 'move_decode_offset(next_operand)', 'op1 = decode_Ib'] */
-bool X86Architecture::Operand__Ev_Ib(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Operand__Ev_Ib(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: last_len
   auto LastLen = rInsn.GetSize();
   // operand0: op0 = decode_Ev
-  auto spOprd0 = Decode_Ev(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd0 = Decode_Ev<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd0 == nullptr)
     return false;
   rInsn.AddOperand(spOprd0);
@@ -670,7 +713,7 @@ bool X86Architecture::Operand__Ev_Ib(BinaryStream const& rBinStrm, OffsetType Of
   // operand1: move_decode_offset(next_operand)
   Offset += (rInsn.GetSize() - LastLen);
   // operand1: op1 = decode_Ib
-  auto spOprd1 = Decode_Ib(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd1 = Decode_Ib<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd1 == nullptr)
     return false;
   rInsn.AddOperand(spOprd1);
@@ -679,12 +722,13 @@ bool X86Architecture::Operand__Ev_Ib(BinaryStream const& rBinStrm, OffsetType Of
 }
 
 /* operand ['last_len', 'op0 = decode_Ev', 'move_decode_offset(next_operand)', 'op1 = decode_Ibs'] */
-bool X86Architecture::Operand__Ev_Ibs(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Operand__Ev_Ibs(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: last_len
   auto LastLen = rInsn.GetSize();
   // operand0: op0 = decode_Ev
-  auto spOprd0 = Decode_Ev(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd0 = Decode_Ev<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd0 == nullptr)
     return false;
   rInsn.AddOperand(spOprd0);
@@ -692,7 +736,7 @@ bool X86Architecture::Operand__Ev_Ibs(BinaryStream const& rBinStrm, OffsetType O
   // operand1: move_decode_offset(next_operand)
   Offset += (rInsn.GetSize() - LastLen);
   // operand1: op1 = decode_Ibs
-  auto spOprd1 = Decode_Ibs(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd1 = Decode_Ibs<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd1 == nullptr)
     return false;
   rInsn.AddOperand(spOprd1);
@@ -701,12 +745,13 @@ bool X86Architecture::Operand__Ev_Ibs(BinaryStream const& rBinStrm, OffsetType O
 }
 
 /* operand ['last_len', 'op0 = decode_Ev', 'move_decode_offset(next_operand)', 'op1 = decode_Iz'] */
-bool X86Architecture::Operand__Ev_Iz(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Operand__Ev_Iz(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: last_len
   auto LastLen = rInsn.GetSize();
   // operand0: op0 = decode_Ev
-  auto spOprd0 = Decode_Ev(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd0 = Decode_Ev<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd0 == nullptr)
     return false;
   rInsn.AddOperand(spOprd0);
@@ -714,7 +759,7 @@ bool X86Architecture::Operand__Ev_Iz(BinaryStream const& rBinStrm, OffsetType Of
   // operand1: move_decode_offset(next_operand)
   Offset += (rInsn.GetSize() - LastLen);
   // operand1: op1 = decode_Iz
-  auto spOprd1 = Decode_Iz(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd1 = Decode_Iz<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd1 == nullptr)
     return false;
   rInsn.AddOperand(spOprd1);
@@ -723,16 +768,17 @@ bool X86Architecture::Operand__Ev_Iz(BinaryStream const& rBinStrm, OffsetType Of
 }
 
 /* operand ['op0 = decode_Ew', 'op1 = decode_Gw'] */
-bool X86Architecture::Operand__Ew_Gw(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Operand__Ew_Gw(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: op0 = decode_Ew
-  auto spOprd0 = Decode_Ew(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd0 = Decode_Ew<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd0 == nullptr)
     return false;
   rInsn.AddOperand(spOprd0);
 
   // operand1: op1 = decode_Gw
-  auto spOprd1 = Decode_Gw(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd1 = Decode_Gw<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd1 == nullptr)
     return false;
   rInsn.AddOperand(spOprd1);
@@ -741,16 +787,17 @@ bool X86Architecture::Operand__Ew_Gw(BinaryStream const& rBinStrm, OffsetType Of
 }
 
 /* operand ['op0 = decode_Ew', 'op1 = decode_Sw'] */
-bool X86Architecture::Operand__Ew_Sw(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Operand__Ew_Sw(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: op0 = decode_Ew
-  auto spOprd0 = Decode_Ew(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd0 = Decode_Ew<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd0 == nullptr)
     return false;
   rInsn.AddOperand(spOprd0);
 
   // operand1: op1 = decode_Sw
-  auto spOprd1 = Decode_Sw(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd1 = Decode_Sw<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd1 == nullptr)
     return false;
   rInsn.AddOperand(spOprd1);
@@ -759,16 +806,17 @@ bool X86Architecture::Operand__Ew_Sw(BinaryStream const& rBinStrm, OffsetType Of
 }
 
 /* operand ['op0 = decode_Ey', 'op1 = decode_Gy'] */
-bool X86Architecture::Operand__Ey_Gy(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Operand__Ey_Gy(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: op0 = decode_Ey
-  auto spOprd0 = Decode_Ey(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd0 = Decode_Ey<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd0 == nullptr)
     return false;
   rInsn.AddOperand(spOprd0);
 
   // operand1: op1 = decode_Gy
-  auto spOprd1 = Decode_Gy(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd1 = Decode_Gy<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd1 == nullptr)
     return false;
   rInsn.AddOperand(spOprd1);
@@ -777,16 +825,17 @@ bool X86Architecture::Operand__Ey_Gy(BinaryStream const& rBinStrm, OffsetType Of
 }
 
 /* operand ['op0 = decode_Ey', 'op1 = decode_Pq'] */
-bool X86Architecture::Operand__Ey_Pq(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Operand__Ey_Pq(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: op0 = decode_Ey
-  auto spOprd0 = Decode_Ey(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd0 = Decode_Ey<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd0 == nullptr)
     return false;
   rInsn.AddOperand(spOprd0);
 
   // operand1: op1 = decode_Pq
-  auto spOprd1 = Decode_Pq(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd1 = Decode_Pq<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd1 == nullptr)
     return false;
   rInsn.AddOperand(spOprd1);
@@ -795,16 +844,17 @@ bool X86Architecture::Operand__Ey_Pq(BinaryStream const& rBinStrm, OffsetType Of
 }
 
 /* operand ['op0 = decode_Ey', 'op1 = decode_Vo'] */
-bool X86Architecture::Operand__Ey_Vo(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Operand__Ey_Vo(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: op0 = decode_Ey
-  auto spOprd0 = Decode_Ey(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd0 = Decode_Ey<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd0 == nullptr)
     return false;
   rInsn.AddOperand(spOprd0);
 
   // operand1: op1 = decode_Vo
-  auto spOprd1 = Decode_Vo(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd1 = Decode_Vo<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd1 == nullptr)
     return false;
   rInsn.AddOperand(spOprd1);
@@ -812,23 +862,28 @@ bool X86Architecture::Operand__Ey_Vo(BinaryStream const& rBinStrm, OffsetType Of
   return true;
 }
 
-/* operand ['op0 = decode_Ey', 'op1 = decode_Vo', 'op2 = decode_Ib'] */
-bool X86Architecture::Operand__Ey_Vo_Ib(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+/* operand ['last_len', 'op0 = decode_Ey', 'op1 = decode_Vo', 'move_decode_offset(next_operand)', 'op2 = decode_Ib'] */
+template<u8 Mode>
+bool X86Architecture::Operand__Ey_Vo_Ib(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
+  // operand0: last_len
+  auto LastLen = rInsn.GetSize();
   // operand0: op0 = decode_Ey
-  auto spOprd0 = Decode_Ey(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd0 = Decode_Ey<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd0 == nullptr)
     return false;
   rInsn.AddOperand(spOprd0);
 
   // operand1: op1 = decode_Vo
-  auto spOprd1 = Decode_Vo(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd1 = Decode_Vo<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd1 == nullptr)
     return false;
   rInsn.AddOperand(spOprd1);
 
+  // operand2: move_decode_offset(next_operand)
+  Offset += (rInsn.GetSize() - LastLen);
   // operand2: op2 = decode_Ib
-  auto spOprd2 = Decode_Ib(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd2 = Decode_Ib<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd2 == nullptr)
     return false;
   rInsn.AddOperand(spOprd2);
@@ -836,23 +891,28 @@ bool X86Architecture::Operand__Ey_Vo_Ib(BinaryStream const& rBinStrm, OffsetType
   return true;
 }
 
-/* operand ['op0 = decode_Eyb', 'op1 = decode_Vo', 'op2 = decode_Ib'] */
-bool X86Architecture::Operand__Eyb_Vo_Ib(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+/* operand ['last_len', 'op0 = decode_Eyb', 'op1 = decode_Vo', 'move_decode_offset(next_operand)', 'op2 = decode_Ib'] */
+template<u8 Mode>
+bool X86Architecture::Operand__Eyb_Vo_Ib(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
+  // operand0: last_len
+  auto LastLen = rInsn.GetSize();
   // operand0: op0 = decode_Eyb
-  auto spOprd0 = Decode_Eyb(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd0 = Decode_Eyb<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd0 == nullptr)
     return false;
   rInsn.AddOperand(spOprd0);
 
   // operand1: op1 = decode_Vo
-  auto spOprd1 = Decode_Vo(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd1 = Decode_Vo<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd1 == nullptr)
     return false;
   rInsn.AddOperand(spOprd1);
 
+  // operand2: move_decode_offset(next_operand)
+  Offset += (rInsn.GetSize() - LastLen);
   // operand2: op2 = decode_Ib
-  auto spOprd2 = Decode_Ib(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd2 = Decode_Ib<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd2 == nullptr)
     return false;
   rInsn.AddOperand(spOprd2);
@@ -860,23 +920,28 @@ bool X86Architecture::Operand__Eyb_Vo_Ib(BinaryStream const& rBinStrm, OffsetTyp
   return true;
 }
 
-/* operand ['op0 = decode_Eyw', 'op1 = decode_Vo', 'op2 = decode_Ib'] */
-bool X86Architecture::Operand__Eyw_Vo_Ib(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+/* operand ['last_len', 'op0 = decode_Eyw', 'op1 = decode_Vo', 'move_decode_offset(next_operand)', 'op2 = decode_Ib'] */
+template<u8 Mode>
+bool X86Architecture::Operand__Eyw_Vo_Ib(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
+  // operand0: last_len
+  auto LastLen = rInsn.GetSize();
   // operand0: op0 = decode_Eyw
-  auto spOprd0 = Decode_Eyw(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd0 = Decode_Eyw<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd0 == nullptr)
     return false;
   rInsn.AddOperand(spOprd0);
 
   // operand1: op1 = decode_Vo
-  auto spOprd1 = Decode_Vo(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd1 = Decode_Vo<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd1 == nullptr)
     return false;
   rInsn.AddOperand(spOprd1);
 
+  // operand2: move_decode_offset(next_operand)
+  Offset += (rInsn.GetSize() - LastLen);
   // operand2: op2 = decode_Ib
-  auto spOprd2 = Decode_Ib(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd2 = Decode_Ib<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd2 == nullptr)
     return false;
   rInsn.AddOperand(spOprd2);
@@ -885,10 +950,11 @@ bool X86Architecture::Operand__Eyw_Vo_Ib(BinaryStream const& rBinStrm, OffsetTyp
 }
 
 /* operand ['op0 = decode_FS'] */
-bool X86Architecture::Operand__FS(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Operand__FS(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: op0 = decode_FS
-  auto spOprd0 = Decode_FS(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd0 = Decode_FS<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd0 == nullptr)
     return false;
   rInsn.AddOperand(spOprd0);
@@ -897,10 +963,11 @@ bool X86Architecture::Operand__FS(BinaryStream const& rBinStrm, OffsetType Offse
 }
 
 /* operand ['op0 = decode_GS'] */
-bool X86Architecture::Operand__GS(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Operand__GS(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: op0 = decode_GS
-  auto spOprd0 = Decode_GS(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd0 = Decode_GS<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd0 == nullptr)
     return false;
   rInsn.AddOperand(spOprd0);
@@ -909,16 +976,17 @@ bool X86Architecture::Operand__GS(BinaryStream const& rBinStrm, OffsetType Offse
 }
 
 /* operand ['op0 = decode_Gb', 'op1 = decode_Eb'] */
-bool X86Architecture::Operand__Gb_Eb(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Operand__Gb_Eb(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: op0 = decode_Gb
-  auto spOprd0 = Decode_Gb(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd0 = Decode_Gb<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd0 == nullptr)
     return false;
   rInsn.AddOperand(spOprd0);
 
   // operand1: op1 = decode_Eb
-  auto spOprd1 = Decode_Eb(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd1 = Decode_Eb<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd1 == nullptr)
     return false;
   rInsn.AddOperand(spOprd1);
@@ -927,16 +995,17 @@ bool X86Architecture::Operand__Gb_Eb(BinaryStream const& rBinStrm, OffsetType Of
 }
 
 /* operand ['op0 = decode_Gb', 'op1 = decode_Ev'] */
-bool X86Architecture::Operand__Gb_Ev(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Operand__Gb_Ev(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: op0 = decode_Gb
-  auto spOprd0 = Decode_Gb(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd0 = Decode_Gb<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd0 == nullptr)
     return false;
   rInsn.AddOperand(spOprd0);
 
   // operand1: op1 = decode_Ev
-  auto spOprd1 = Decode_Ev(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd1 = Decode_Ev<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd1 == nullptr)
     return false;
   rInsn.AddOperand(spOprd1);
@@ -945,16 +1014,17 @@ bool X86Architecture::Operand__Gb_Ev(BinaryStream const& rBinStrm, OffsetType Of
 }
 
 /* operand ['op0 = decode_Gv', 'op1 = decode_Eb'] */
-bool X86Architecture::Operand__Gv_Eb(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Operand__Gv_Eb(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: op0 = decode_Gv
-  auto spOprd0 = Decode_Gv(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd0 = Decode_Gv<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd0 == nullptr)
     return false;
   rInsn.AddOperand(spOprd0);
 
   // operand1: op1 = decode_Eb
-  auto spOprd1 = Decode_Eb(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd1 = Decode_Eb<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd1 == nullptr)
     return false;
   rInsn.AddOperand(spOprd1);
@@ -963,16 +1033,17 @@ bool X86Architecture::Operand__Gv_Eb(BinaryStream const& rBinStrm, OffsetType Of
 }
 
 /* operand ['op0 = decode_Gv', 'op1 = decode_Ed'] */
-bool X86Architecture::Operand__Gv_Ed(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Operand__Gv_Ed(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: op0 = decode_Gv
-  auto spOprd0 = Decode_Gv(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd0 = Decode_Gv<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd0 == nullptr)
     return false;
   rInsn.AddOperand(spOprd0);
 
   // operand1: op1 = decode_Ed
-  auto spOprd1 = Decode_Ed(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd1 = Decode_Ed<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd1 == nullptr)
     return false;
   rInsn.AddOperand(spOprd1);
@@ -981,16 +1052,17 @@ bool X86Architecture::Operand__Gv_Ed(BinaryStream const& rBinStrm, OffsetType Of
 }
 
 /* operand ['op0 = decode_Gv', 'op1 = decode_Ev'] */
-bool X86Architecture::Operand__Gv_Ev(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Operand__Gv_Ev(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: op0 = decode_Gv
-  auto spOprd0 = Decode_Gv(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd0 = Decode_Gv<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd0 == nullptr)
     return false;
   rInsn.AddOperand(spOprd0);
 
   // operand1: op1 = decode_Ev
-  auto spOprd1 = Decode_Ev(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd1 = Decode_Ev<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd1 == nullptr)
     return false;
   rInsn.AddOperand(spOprd1);
@@ -999,18 +1071,19 @@ bool X86Architecture::Operand__Gv_Ev(BinaryStream const& rBinStrm, OffsetType Of
 }
 
 /* operand ['last_len', 'op0 = decode_Gv', 'op1 = decode_Ev', 'move_decode_offset(next_operand)', 'op2 = decode_Ibs'] */
-bool X86Architecture::Operand__Gv_Ev_Ibs(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Operand__Gv_Ev_Ibs(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: last_len
   auto LastLen = rInsn.GetSize();
   // operand0: op0 = decode_Gv
-  auto spOprd0 = Decode_Gv(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd0 = Decode_Gv<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd0 == nullptr)
     return false;
   rInsn.AddOperand(spOprd0);
 
   // operand1: op1 = decode_Ev
-  auto spOprd1 = Decode_Ev(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd1 = Decode_Ev<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd1 == nullptr)
     return false;
   rInsn.AddOperand(spOprd1);
@@ -1018,7 +1091,7 @@ bool X86Architecture::Operand__Gv_Ev_Ibs(BinaryStream const& rBinStrm, OffsetTyp
   // operand2: move_decode_offset(next_operand)
   Offset += (rInsn.GetSize() - LastLen);
   // operand2: op2 = decode_Ibs
-  auto spOprd2 = Decode_Ibs(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd2 = Decode_Ibs<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd2 == nullptr)
     return false;
   rInsn.AddOperand(spOprd2);
@@ -1027,18 +1100,19 @@ bool X86Architecture::Operand__Gv_Ev_Ibs(BinaryStream const& rBinStrm, OffsetTyp
 }
 
 /* operand ['last_len', 'op0 = decode_Gv', 'op1 = decode_Ev', 'move_decode_offset(next_operand)', 'op2 = decode_Iz'] */
-bool X86Architecture::Operand__Gv_Ev_Iz(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Operand__Gv_Ev_Iz(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: last_len
   auto LastLen = rInsn.GetSize();
   // operand0: op0 = decode_Gv
-  auto spOprd0 = Decode_Gv(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd0 = Decode_Gv<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd0 == nullptr)
     return false;
   rInsn.AddOperand(spOprd0);
 
   // operand1: op1 = decode_Ev
-  auto spOprd1 = Decode_Ev(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd1 = Decode_Ev<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd1 == nullptr)
     return false;
   rInsn.AddOperand(spOprd1);
@@ -1046,7 +1120,7 @@ bool X86Architecture::Operand__Gv_Ev_Iz(BinaryStream const& rBinStrm, OffsetType
   // operand2: move_decode_offset(next_operand)
   Offset += (rInsn.GetSize() - LastLen);
   // operand2: op2 = decode_Iz
-  auto spOprd2 = Decode_Iz(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd2 = Decode_Iz<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd2 == nullptr)
     return false;
   rInsn.AddOperand(spOprd2);
@@ -1055,16 +1129,17 @@ bool X86Architecture::Operand__Gv_Ev_Iz(BinaryStream const& rBinStrm, OffsetType
 }
 
 /* operand ['op0 = decode_Gv', 'op1 = decode_Ew'] */
-bool X86Architecture::Operand__Gv_Ew(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Operand__Gv_Ew(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: op0 = decode_Gv
-  auto spOprd0 = Decode_Gv(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd0 = Decode_Gv<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd0 == nullptr)
     return false;
   rInsn.AddOperand(spOprd0);
 
   // operand1: op1 = decode_Ew
-  auto spOprd1 = Decode_Ew(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd1 = Decode_Ew<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd1 == nullptr)
     return false;
   rInsn.AddOperand(spOprd1);
@@ -1073,16 +1148,17 @@ bool X86Architecture::Operand__Gv_Ew(BinaryStream const& rBinStrm, OffsetType Of
 }
 
 /* operand ['op0 = decode_Gv', 'op1 = decode_M'] */
-bool X86Architecture::Operand__Gv_M(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Operand__Gv_M(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: op0 = decode_Gv
-  auto spOprd0 = Decode_Gv(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd0 = Decode_Gv<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd0 == nullptr)
     return false;
   rInsn.AddOperand(spOprd0);
 
   // operand1: op1 = decode_M
-  auto spOprd1 = Decode_M(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd1 = Decode_M<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd1 == nullptr)
     return false;
   rInsn.AddOperand(spOprd1);
@@ -1091,16 +1167,17 @@ bool X86Architecture::Operand__Gv_M(BinaryStream const& rBinStrm, OffsetType Off
 }
 
 /* operand ['op0 = decode_Gv', 'op1 = decode_Ma'] */
-bool X86Architecture::Operand__Gv_Ma(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Operand__Gv_Ma(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: op0 = decode_Gv
-  auto spOprd0 = Decode_Gv(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd0 = Decode_Gv<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd0 == nullptr)
     return false;
   rInsn.AddOperand(spOprd0);
 
   // operand1: op1 = decode_Ma
-  auto spOprd1 = Decode_Ma(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd1 = Decode_Ma<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd1 == nullptr)
     return false;
   rInsn.AddOperand(spOprd1);
@@ -1109,16 +1186,17 @@ bool X86Architecture::Operand__Gv_Ma(BinaryStream const& rBinStrm, OffsetType Of
 }
 
 /* operand ['op0 = decode_Gv', 'op1 = decode_Mp'] */
-bool X86Architecture::Operand__Gv_Mp(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Operand__Gv_Mp(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: op0 = decode_Gv
-  auto spOprd0 = Decode_Gv(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd0 = Decode_Gv<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd0 == nullptr)
     return false;
   rInsn.AddOperand(spOprd0);
 
   // operand1: op1 = decode_Mp
-  auto spOprd1 = Decode_Mp(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd1 = Decode_Mp<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd1 == nullptr)
     return false;
   rInsn.AddOperand(spOprd1);
@@ -1127,16 +1205,17 @@ bool X86Architecture::Operand__Gv_Mp(BinaryStream const& rBinStrm, OffsetType Of
 }
 
 /* operand ['op0 = decode_Gv', 'op1 = decode_Mv'] */
-bool X86Architecture::Operand__Gv_Mv(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Operand__Gv_Mv(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: op0 = decode_Gv
-  auto spOprd0 = Decode_Gv(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd0 = Decode_Gv<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd0 == nullptr)
     return false;
   rInsn.AddOperand(spOprd0);
 
   // operand1: op1 = decode_Mv
-  auto spOprd1 = Decode_Mv(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd1 = Decode_Mv<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd1 == nullptr)
     return false;
   rInsn.AddOperand(spOprd1);
@@ -1145,22 +1224,23 @@ bool X86Architecture::Operand__Gv_Mv(BinaryStream const& rBinStrm, OffsetType Of
 }
 
 /* operand ['op0 = decode_Gy', 'op1 = decode_By', 'op2 = decode_Ey'] */
-bool X86Architecture::Operand__Gy_By_Ey(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Operand__Gy_By_Ey(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: op0 = decode_Gy
-  auto spOprd0 = Decode_Gy(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd0 = Decode_Gy<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd0 == nullptr)
     return false;
   rInsn.AddOperand(spOprd0);
 
   // operand1: op1 = decode_By
-  auto spOprd1 = Decode_By(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd1 = Decode_By<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd1 == nullptr)
     return false;
   rInsn.AddOperand(spOprd1);
 
   // operand2: op2 = decode_Ey
-  auto spOprd2 = Decode_Ey(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd2 = Decode_Ey<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd2 == nullptr)
     return false;
   rInsn.AddOperand(spOprd2);
@@ -1169,16 +1249,17 @@ bool X86Architecture::Operand__Gy_By_Ey(BinaryStream const& rBinStrm, OffsetType
 }
 
 /* operand ['op0 = decode_Gy', 'op1 = decode_Eb'] */
-bool X86Architecture::Operand__Gy_Eb(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Operand__Gy_Eb(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: op0 = decode_Gy
-  auto spOprd0 = Decode_Gy(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd0 = Decode_Gy<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd0 == nullptr)
     return false;
   rInsn.AddOperand(spOprd0);
 
   // operand1: op1 = decode_Eb
-  auto spOprd1 = Decode_Eb(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd1 = Decode_Eb<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd1 == nullptr)
     return false;
   rInsn.AddOperand(spOprd1);
@@ -1187,16 +1268,17 @@ bool X86Architecture::Operand__Gy_Eb(BinaryStream const& rBinStrm, OffsetType Of
 }
 
 /* operand ['op0 = decode_Gy', 'op1 = decode_Ev'] */
-bool X86Architecture::Operand__Gy_Ev(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Operand__Gy_Ev(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: op0 = decode_Gy
-  auto spOprd0 = Decode_Gy(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd0 = Decode_Gy<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd0 == nullptr)
     return false;
   rInsn.AddOperand(spOprd0);
 
   // operand1: op1 = decode_Ev
-  auto spOprd1 = Decode_Ev(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd1 = Decode_Ev<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd1 == nullptr)
     return false;
   rInsn.AddOperand(spOprd1);
@@ -1205,16 +1287,17 @@ bool X86Architecture::Operand__Gy_Ev(BinaryStream const& rBinStrm, OffsetType Of
 }
 
 /* operand ['op0 = decode_Gy', 'op1 = decode_Ey'] */
-bool X86Architecture::Operand__Gy_Ey(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Operand__Gy_Ey(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: op0 = decode_Gy
-  auto spOprd0 = Decode_Gy(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd0 = Decode_Gy<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd0 == nullptr)
     return false;
   rInsn.AddOperand(spOprd0);
 
   // operand1: op1 = decode_Ey
-  auto spOprd1 = Decode_Ey(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd1 = Decode_Ey<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd1 == nullptr)
     return false;
   rInsn.AddOperand(spOprd1);
@@ -1223,22 +1306,23 @@ bool X86Architecture::Operand__Gy_Ey(BinaryStream const& rBinStrm, OffsetType Of
 }
 
 /* operand ['op0 = decode_Gy', 'op1 = decode_Ey', 'op2 = decode_By'] */
-bool X86Architecture::Operand__Gy_Ey_By(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Operand__Gy_Ey_By(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: op0 = decode_Gy
-  auto spOprd0 = Decode_Gy(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd0 = Decode_Gy<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd0 == nullptr)
     return false;
   rInsn.AddOperand(spOprd0);
 
   // operand1: op1 = decode_Ey
-  auto spOprd1 = Decode_Ey(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd1 = Decode_Ey<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd1 == nullptr)
     return false;
   rInsn.AddOperand(spOprd1);
 
   // operand2: op2 = decode_By
-  auto spOprd2 = Decode_By(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd2 = Decode_By<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd2 == nullptr)
     return false;
   rInsn.AddOperand(spOprd2);
@@ -1247,16 +1331,17 @@ bool X86Architecture::Operand__Gy_Ey_By(BinaryStream const& rBinStrm, OffsetType
 }
 
 /* operand ['op0 = decode_Gy', 'op1 = decode_Nq'] */
-bool X86Architecture::Operand__Gy_Nq(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Operand__Gy_Nq(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: op0 = decode_Gy
-  auto spOprd0 = Decode_Gy(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd0 = Decode_Gy<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd0 == nullptr)
     return false;
   rInsn.AddOperand(spOprd0);
 
   // operand1: op1 = decode_Nq
-  auto spOprd1 = Decode_Nq(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd1 = Decode_Nq<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd1 == nullptr)
     return false;
   rInsn.AddOperand(spOprd1);
@@ -1264,23 +1349,28 @@ bool X86Architecture::Operand__Gy_Nq(BinaryStream const& rBinStrm, OffsetType Of
   return true;
 }
 
-/* operand ['op0 = decode_Gy', 'op1 = decode_Nq', 'op2 = decode_Ib'] */
-bool X86Architecture::Operand__Gy_Nq_Ib(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+/* operand ['last_len', 'op0 = decode_Gy', 'op1 = decode_Nq', 'move_decode_offset(next_operand)', 'op2 = decode_Ib'] */
+template<u8 Mode>
+bool X86Architecture::Operand__Gy_Nq_Ib(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
+  // operand0: last_len
+  auto LastLen = rInsn.GetSize();
   // operand0: op0 = decode_Gy
-  auto spOprd0 = Decode_Gy(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd0 = Decode_Gy<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd0 == nullptr)
     return false;
   rInsn.AddOperand(spOprd0);
 
   // operand1: op1 = decode_Nq
-  auto spOprd1 = Decode_Nq(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd1 = Decode_Nq<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd1 == nullptr)
     return false;
   rInsn.AddOperand(spOprd1);
 
+  // operand2: move_decode_offset(next_operand)
+  Offset += (rInsn.GetSize() - LastLen);
   // operand2: op2 = decode_Ib
-  auto spOprd2 = Decode_Ib(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd2 = Decode_Ib<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd2 == nullptr)
     return false;
   rInsn.AddOperand(spOprd2);
@@ -1289,16 +1379,17 @@ bool X86Architecture::Operand__Gy_Nq_Ib(BinaryStream const& rBinStrm, OffsetType
 }
 
 /* operand ['op0 = decode_Gy', 'op1 = decode_Uo'] */
-bool X86Architecture::Operand__Gy_Uo(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Operand__Gy_Uo(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: op0 = decode_Gy
-  auto spOprd0 = Decode_Gy(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd0 = Decode_Gy<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd0 == nullptr)
     return false;
   rInsn.AddOperand(spOprd0);
 
   // operand1: op1 = decode_Uo
-  auto spOprd1 = Decode_Uo(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd1 = Decode_Uo<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd1 == nullptr)
     return false;
   rInsn.AddOperand(spOprd1);
@@ -1306,23 +1397,28 @@ bool X86Architecture::Operand__Gy_Uo(BinaryStream const& rBinStrm, OffsetType Of
   return true;
 }
 
-/* operand ['op0 = decode_Gy', 'op1 = decode_Uo', 'op2 = decode_Ib'] */
-bool X86Architecture::Operand__Gy_Uo_Ib(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+/* operand ['last_len', 'op0 = decode_Gy', 'op1 = decode_Uo', 'move_decode_offset(next_operand)', 'op2 = decode_Ib'] */
+template<u8 Mode>
+bool X86Architecture::Operand__Gy_Uo_Ib(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
+  // operand0: last_len
+  auto LastLen = rInsn.GetSize();
   // operand0: op0 = decode_Gy
-  auto spOprd0 = Decode_Gy(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd0 = Decode_Gy<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd0 == nullptr)
     return false;
   rInsn.AddOperand(spOprd0);
 
   // operand1: op1 = decode_Uo
-  auto spOprd1 = Decode_Uo(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd1 = Decode_Uo<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd1 == nullptr)
     return false;
   rInsn.AddOperand(spOprd1);
 
+  // operand2: move_decode_offset(next_operand)
+  Offset += (rInsn.GetSize() - LastLen);
   // operand2: op2 = decode_Ib
-  auto spOprd2 = Decode_Ib(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd2 = Decode_Ib<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd2 == nullptr)
     return false;
   rInsn.AddOperand(spOprd2);
@@ -1331,16 +1427,17 @@ bool X86Architecture::Operand__Gy_Uo_Ib(BinaryStream const& rBinStrm, OffsetType
 }
 
 /* operand ['op0 = decode_Gy', 'op1 = decode_Ux'] */
-bool X86Architecture::Operand__Gy_Ux(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Operand__Gy_Ux(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: op0 = decode_Gy
-  auto spOprd0 = Decode_Gy(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd0 = Decode_Gy<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd0 == nullptr)
     return false;
   rInsn.AddOperand(spOprd0);
 
   // operand1: op1 = decode_Ux
-  auto spOprd1 = Decode_Ux(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd1 = Decode_Ux<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd1 == nullptr)
     return false;
   rInsn.AddOperand(spOprd1);
@@ -1349,16 +1446,17 @@ bool X86Architecture::Operand__Gy_Ux(BinaryStream const& rBinStrm, OffsetType Of
 }
 
 /* operand ['op0 = decode_Gy', 'op1 = decode_Wod'] */
-bool X86Architecture::Operand__Gy_Wod(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Operand__Gy_Wod(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: op0 = decode_Gy
-  auto spOprd0 = Decode_Gy(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd0 = Decode_Gy<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd0 == nullptr)
     return false;
   rInsn.AddOperand(spOprd0);
 
   // operand1: op1 = decode_Wod
-  auto spOprd1 = Decode_Wod(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd1 = Decode_Wod<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd1 == nullptr)
     return false;
   rInsn.AddOperand(spOprd1);
@@ -1367,16 +1465,17 @@ bool X86Architecture::Operand__Gy_Wod(BinaryStream const& rBinStrm, OffsetType O
 }
 
 /* operand ['op0 = decode_Gy', 'op1 = decode_Woq'] */
-bool X86Architecture::Operand__Gy_Woq(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Operand__Gy_Woq(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: op0 = decode_Gy
-  auto spOprd0 = Decode_Gy(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd0 = Decode_Gy<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd0 == nullptr)
     return false;
   rInsn.AddOperand(spOprd0);
 
   // operand1: op1 = decode_Woq
-  auto spOprd1 = Decode_Woq(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd1 = Decode_Woq<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd1 == nullptr)
     return false;
   rInsn.AddOperand(spOprd1);
@@ -1385,22 +1484,23 @@ bool X86Architecture::Operand__Gy_Woq(BinaryStream const& rBinStrm, OffsetType O
 }
 
 /* operand ['op0 = decode_Hx', 'op1 = decode_Hx', 'op2 = decode_Wx'] */
-bool X86Architecture::Operand__Hx_Hx_Wx(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Operand__Hx_Hx_Wx(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: op0 = decode_Hx
-  auto spOprd0 = Decode_Hx(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd0 = Decode_Hx<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd0 == nullptr)
     return false;
   rInsn.AddOperand(spOprd0);
 
   // operand1: op1 = decode_Hx
-  auto spOprd1 = Decode_Hx(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd1 = Decode_Hx<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd1 == nullptr)
     return false;
   rInsn.AddOperand(spOprd1);
 
   // operand2: op2 = decode_Wx
-  auto spOprd2 = Decode_Wx(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd2 = Decode_Wx<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd2 == nullptr)
     return false;
   rInsn.AddOperand(spOprd2);
@@ -1409,18 +1509,19 @@ bool X86Architecture::Operand__Hx_Hx_Wx(BinaryStream const& rBinStrm, OffsetType
 }
 
 /* operand ['last_len', 'op0 = decode_Hx', 'op1 = decode_Ux', 'move_decode_offset(next_operand)', 'op2 = decode_Ib'] */
-bool X86Architecture::Operand__Hx_Ux_Ib(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Operand__Hx_Ux_Ib(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: last_len
   auto LastLen = rInsn.GetSize();
   // operand0: op0 = decode_Hx
-  auto spOprd0 = Decode_Hx(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd0 = Decode_Hx<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd0 == nullptr)
     return false;
   rInsn.AddOperand(spOprd0);
 
   // operand1: op1 = decode_Ux
-  auto spOprd1 = Decode_Ux(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd1 = Decode_Ux<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd1 == nullptr)
     return false;
   rInsn.AddOperand(spOprd1);
@@ -1428,7 +1529,7 @@ bool X86Architecture::Operand__Hx_Ux_Ib(BinaryStream const& rBinStrm, OffsetType
   // operand2: move_decode_offset(next_operand)
   Offset += (rInsn.GetSize() - LastLen);
   // operand2: op2 = decode_Ib
-  auto spOprd2 = Decode_Ib(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd2 = Decode_Ib<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd2 == nullptr)
     return false;
   rInsn.AddOperand(spOprd2);
@@ -1437,10 +1538,11 @@ bool X86Architecture::Operand__Hx_Ux_Ib(BinaryStream const& rBinStrm, OffsetType
 }
 
 /* operand ['op0 = decode_Ib'] */
-bool X86Architecture::Operand__Ib(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Operand__Ib(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: op0 = decode_Ib
-  auto spOprd0 = Decode_Ib(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd0 = Decode_Ib<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd0 == nullptr)
     return false;
   rInsn.AddOperand(spOprd0);
@@ -1449,16 +1551,17 @@ bool X86Architecture::Operand__Ib(BinaryStream const& rBinStrm, OffsetType Offse
 }
 
 /* operand ['op0 = decode_Ib', 'op1 = decode_AL'] */
-bool X86Architecture::Operand__Ib_AL(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Operand__Ib_AL(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: op0 = decode_Ib
-  auto spOprd0 = Decode_Ib(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd0 = Decode_Ib<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd0 == nullptr)
     return false;
   rInsn.AddOperand(spOprd0);
 
   // operand1: op1 = decode_AL
-  auto spOprd1 = Decode_AL(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd1 = Decode_AL<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd1 == nullptr)
     return false;
   rInsn.AddOperand(spOprd1);
@@ -1467,16 +1570,17 @@ bool X86Architecture::Operand__Ib_AL(BinaryStream const& rBinStrm, OffsetType Of
 }
 
 /* operand ['op0 = decode_Ib', 'op1 = decode_eAX'] */
-bool X86Architecture::Operand__Ib_eAX(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Operand__Ib_eAX(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: op0 = decode_Ib
-  auto spOprd0 = Decode_Ib(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd0 = Decode_Ib<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd0 == nullptr)
     return false;
   rInsn.AddOperand(spOprd0);
 
   // operand1: op1 = decode_eAX
-  auto spOprd1 = Decode_eAX(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd1 = Decode_eAX<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd1 == nullptr)
     return false;
   rInsn.AddOperand(spOprd1);
@@ -1485,10 +1589,11 @@ bool X86Architecture::Operand__Ib_eAX(BinaryStream const& rBinStrm, OffsetType O
 }
 
 /* operand ['op0 = decode_Iw'] */
-bool X86Architecture::Operand__Iw(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Operand__Iw(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: op0 = decode_Iw
-  auto spOprd0 = Decode_Iw(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd0 = Decode_Iw<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd0 == nullptr)
     return false;
   rInsn.AddOperand(spOprd0);
@@ -1496,17 +1601,22 @@ bool X86Architecture::Operand__Iw(BinaryStream const& rBinStrm, OffsetType Offse
   return true;
 }
 
-/* operand ['op0 = decode_Iw', 'op1 = decode_Ib'] */
-bool X86Architecture::Operand__Iw_Ib(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+/* operand ['last_len', 'op0 = decode_Iw', 'move_decode_offset(next_operand)', 'op1 = decode_Ib'] */
+template<u8 Mode>
+bool X86Architecture::Operand__Iw_Ib(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
+  // operand0: last_len
+  auto LastLen = rInsn.GetSize();
   // operand0: op0 = decode_Iw
-  auto spOprd0 = Decode_Iw(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd0 = Decode_Iw<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd0 == nullptr)
     return false;
   rInsn.AddOperand(spOprd0);
 
+  // operand1: move_decode_offset(next_operand)
+  Offset += (rInsn.GetSize() - LastLen);
   // operand1: op1 = decode_Ib
-  auto spOprd1 = Decode_Ib(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd1 = Decode_Ib<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd1 == nullptr)
     return false;
   rInsn.AddOperand(spOprd1);
@@ -1515,10 +1625,11 @@ bool X86Architecture::Operand__Iw_Ib(BinaryStream const& rBinStrm, OffsetType Of
 }
 
 /* operand ['op0 = decode_Iz'] */
-bool X86Architecture::Operand__Iz(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Operand__Iz(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: op0 = decode_Iz
-  auto spOprd0 = Decode_Iz(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd0 = Decode_Iz<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd0 == nullptr)
     return false;
   rInsn.AddOperand(spOprd0);
@@ -1527,10 +1638,11 @@ bool X86Architecture::Operand__Iz(BinaryStream const& rBinStrm, OffsetType Offse
 }
 
 /* operand ['op0 = decode_Jb'] */
-bool X86Architecture::Operand__Jb(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Operand__Jb(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: op0 = decode_Jb
-  auto spOprd0 = Decode_Jb(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd0 = Decode_Jb<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd0 == nullptr)
     return false;
   rInsn.AddOperand(spOprd0);
@@ -1539,10 +1651,11 @@ bool X86Architecture::Operand__Jb(BinaryStream const& rBinStrm, OffsetType Offse
 }
 
 /* operand ['op0 = decode_Jz'] */
-bool X86Architecture::Operand__Jz(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Operand__Jz(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: op0 = decode_Jz
-  auto spOprd0 = Decode_Jz(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd0 = Decode_Jz<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd0 == nullptr)
     return false;
   rInsn.AddOperand(spOprd0);
@@ -1551,10 +1664,11 @@ bool X86Architecture::Operand__Jz(BinaryStream const& rBinStrm, OffsetType Offse
 }
 
 /* operand ['op0 = decode_M'] */
-bool X86Architecture::Operand__M(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Operand__M(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: op0 = decode_M
-  auto spOprd0 = Decode_M(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd0 = Decode_M<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd0 == nullptr)
     return false;
   rInsn.AddOperand(spOprd0);
@@ -1563,10 +1677,11 @@ bool X86Architecture::Operand__M(BinaryStream const& rBinStrm, OffsetType Offset
 }
 
 /* operand ['op0 = decode_Md'] */
-bool X86Architecture::Operand__Md(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Operand__Md(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: op0 = decode_Md
-  auto spOprd0 = Decode_Md(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd0 = Decode_Md<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd0 == nullptr)
     return false;
   rInsn.AddOperand(spOprd0);
@@ -1575,16 +1690,17 @@ bool X86Architecture::Operand__Md(BinaryStream const& rBinStrm, OffsetType Offse
 }
 
 /* operand ['op0 = decode_Md', 'op1 = decode_Vo'] */
-bool X86Architecture::Operand__Md_Vo(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Operand__Md_Vo(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: op0 = decode_Md
-  auto spOprd0 = Decode_Md(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd0 = Decode_Md<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd0 == nullptr)
     return false;
   rInsn.AddOperand(spOprd0);
 
   // operand1: op1 = decode_Vo
-  auto spOprd1 = Decode_Vo(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd1 = Decode_Vo<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd1 == nullptr)
     return false;
   rInsn.AddOperand(spOprd1);
@@ -1593,10 +1709,11 @@ bool X86Architecture::Operand__Md_Vo(BinaryStream const& rBinStrm, OffsetType Of
 }
 
 /* operand ['op0 = decode_Mp'] */
-bool X86Architecture::Operand__Mp(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Operand__Mp(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: op0 = decode_Mp
-  auto spOprd0 = Decode_Mp(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd0 = Decode_Mp<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd0 == nullptr)
     return false;
   rInsn.AddOperand(spOprd0);
@@ -1605,10 +1722,11 @@ bool X86Architecture::Operand__Mp(BinaryStream const& rBinStrm, OffsetType Offse
 }
 
 /* operand ['op0 = decode_Mq'] */
-bool X86Architecture::Operand__Mq(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Operand__Mq(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: op0 = decode_Mq
-  auto spOprd0 = Decode_Mq(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd0 = Decode_Mq<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd0 == nullptr)
     return false;
   rInsn.AddOperand(spOprd0);
@@ -1617,16 +1735,17 @@ bool X86Architecture::Operand__Mq(BinaryStream const& rBinStrm, OffsetType Offse
 }
 
 /* operand ['op0 = decode_Mq', 'op1 = decode_Pq'] */
-bool X86Architecture::Operand__Mq_Pq(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Operand__Mq_Pq(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: op0 = decode_Mq
-  auto spOprd0 = Decode_Mq(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd0 = Decode_Mq<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd0 == nullptr)
     return false;
   rInsn.AddOperand(spOprd0);
 
   // operand1: op1 = decode_Pq
-  auto spOprd1 = Decode_Pq(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd1 = Decode_Pq<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd1 == nullptr)
     return false;
   rInsn.AddOperand(spOprd1);
@@ -1635,16 +1754,17 @@ bool X86Architecture::Operand__Mq_Pq(BinaryStream const& rBinStrm, OffsetType Of
 }
 
 /* operand ['op0 = decode_Mq', 'op1 = decode_Vo'] */
-bool X86Architecture::Operand__Mq_Vo(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Operand__Mq_Vo(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: op0 = decode_Mq
-  auto spOprd0 = Decode_Mq(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd0 = Decode_Mq<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd0 == nullptr)
     return false;
   rInsn.AddOperand(spOprd0);
 
   // operand1: op1 = decode_Vo
-  auto spOprd1 = Decode_Vo(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd1 = Decode_Vo<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd1 == nullptr)
     return false;
   rInsn.AddOperand(spOprd1);
@@ -1653,16 +1773,17 @@ bool X86Architecture::Operand__Mq_Vo(BinaryStream const& rBinStrm, OffsetType Of
 }
 
 /* operand ['op0 = decode_Mv', 'op1 = decode_Gv'] */
-bool X86Architecture::Operand__Mv_Gv(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Operand__Mv_Gv(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: op0 = decode_Mv
-  auto spOprd0 = Decode_Mv(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd0 = Decode_Mv<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd0 == nullptr)
     return false;
   rInsn.AddOperand(spOprd0);
 
   // operand1: op1 = decode_Gv
-  auto spOprd1 = Decode_Gv(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd1 = Decode_Gv<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd1 == nullptr)
     return false;
   rInsn.AddOperand(spOprd1);
@@ -1671,10 +1792,11 @@ bool X86Architecture::Operand__Mv_Gv(BinaryStream const& rBinStrm, OffsetType Of
 }
 
 /* operand ['op0 = decode_Mw'] */
-bool X86Architecture::Operand__Mw(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Operand__Mw(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: op0 = decode_Mw
-  auto spOprd0 = Decode_Mw(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd0 = Decode_Mw<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd0 == nullptr)
     return false;
   rInsn.AddOperand(spOprd0);
@@ -1683,22 +1805,23 @@ bool X86Architecture::Operand__Mw(BinaryStream const& rBinStrm, OffsetType Offse
 }
 
 /* operand ['op0 = decode_Mx', 'op1 = decode_Hx', 'op2 = decode_Vx'] */
-bool X86Architecture::Operand__Mx_Hx_Vx(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Operand__Mx_Hx_Vx(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: op0 = decode_Mx
-  auto spOprd0 = Decode_Mx(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd0 = Decode_Mx<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd0 == nullptr)
     return false;
   rInsn.AddOperand(spOprd0);
 
   // operand1: op1 = decode_Hx
-  auto spOprd1 = Decode_Hx(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd1 = Decode_Hx<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd1 == nullptr)
     return false;
   rInsn.AddOperand(spOprd1);
 
   // operand2: op2 = decode_Vx
-  auto spOprd2 = Decode_Vx(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd2 = Decode_Vx<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd2 == nullptr)
     return false;
   rInsn.AddOperand(spOprd2);
@@ -1707,16 +1830,17 @@ bool X86Architecture::Operand__Mx_Hx_Vx(BinaryStream const& rBinStrm, OffsetType
 }
 
 /* operand ['op0 = decode_Mx', 'op1 = decode_Vx'] */
-bool X86Architecture::Operand__Mx_Vx(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Operand__Mx_Vx(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: op0 = decode_Mx
-  auto spOprd0 = Decode_Mx(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd0 = Decode_Mx<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd0 == nullptr)
     return false;
   rInsn.AddOperand(spOprd0);
 
   // operand1: op1 = decode_Vx
-  auto spOprd1 = Decode_Vx(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd1 = Decode_Vx<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd1 == nullptr)
     return false;
   rInsn.AddOperand(spOprd1);
@@ -1725,16 +1849,17 @@ bool X86Architecture::Operand__Mx_Vx(BinaryStream const& rBinStrm, OffsetType Of
 }
 
 /* operand ['op0 = decode_My', 'op1 = decode_Gy'] */
-bool X86Architecture::Operand__My_Gy(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Operand__My_Gy(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: op0 = decode_My
-  auto spOprd0 = Decode_My(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd0 = Decode_My<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd0 == nullptr)
     return false;
   rInsn.AddOperand(spOprd0);
 
   // operand1: op1 = decode_Gy
-  auto spOprd1 = Decode_Gy(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd1 = Decode_Gy<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd1 == nullptr)
     return false;
   rInsn.AddOperand(spOprd1);
@@ -1742,17 +1867,22 @@ bool X86Architecture::Operand__My_Gy(BinaryStream const& rBinStrm, OffsetType Of
   return true;
 }
 
-/* operand ['op0 = decode_Nq', 'op1 = decode_Ib'] */
-bool X86Architecture::Operand__Nq_Ib(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+/* operand ['last_len', 'op0 = decode_Nq', 'move_decode_offset(next_operand)', 'op1 = decode_Ib'] */
+template<u8 Mode>
+bool X86Architecture::Operand__Nq_Ib(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
+  // operand0: last_len
+  auto LastLen = rInsn.GetSize();
   // operand0: op0 = decode_Nq
-  auto spOprd0 = Decode_Nq(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd0 = Decode_Nq<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd0 == nullptr)
     return false;
   rInsn.AddOperand(spOprd0);
 
+  // operand1: move_decode_offset(next_operand)
+  Offset += (rInsn.GetSize() - LastLen);
   // operand1: op1 = decode_Ib
-  auto spOprd1 = Decode_Ib(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd1 = Decode_Ib<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd1 == nullptr)
     return false;
   rInsn.AddOperand(spOprd1);
@@ -1761,16 +1891,17 @@ bool X86Architecture::Operand__Nq_Ib(BinaryStream const& rBinStrm, OffsetType Of
 }
 
 /* operand ['op0 = decode_Ob', 'op1 = decode_AL'] */
-bool X86Architecture::Operand__Ob_AL(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Operand__Ob_AL(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: op0 = decode_Ob
-  auto spOprd0 = Decode_Ob(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd0 = Decode_Ob<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd0 == nullptr)
     return false;
   rInsn.AddOperand(spOprd0);
 
   // operand1: op1 = decode_AL
-  auto spOprd1 = Decode_AL(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd1 = Decode_AL<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd1 == nullptr)
     return false;
   rInsn.AddOperand(spOprd1);
@@ -1779,16 +1910,17 @@ bool X86Architecture::Operand__Ob_AL(BinaryStream const& rBinStrm, OffsetType Of
 }
 
 /* operand ['op0 = decode_Ov', 'op1 = decode_rAX'] */
-bool X86Architecture::Operand__Ov_rAX(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Operand__Ov_rAX(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: op0 = decode_Ov
-  auto spOprd0 = Decode_Ov(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd0 = Decode_Ov<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd0 == nullptr)
     return false;
   rInsn.AddOperand(spOprd0);
 
   // operand1: op1 = decode_rAX
-  auto spOprd1 = Decode_rAX(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd1 = Decode_rAX<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd1 == nullptr)
     return false;
   rInsn.AddOperand(spOprd1);
@@ -1797,16 +1929,17 @@ bool X86Architecture::Operand__Ov_rAX(BinaryStream const& rBinStrm, OffsetType O
 }
 
 /* operand ['op0 = decode_Pq', 'op1 = decode_Ey'] */
-bool X86Architecture::Operand__Pq_Ey(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Operand__Pq_Ey(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: op0 = decode_Pq
-  auto spOprd0 = Decode_Pq(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd0 = Decode_Pq<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd0 == nullptr)
     return false;
   rInsn.AddOperand(spOprd0);
 
   // operand1: op1 = decode_Ey
-  auto spOprd1 = Decode_Ey(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd1 = Decode_Ey<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd1 == nullptr)
     return false;
   rInsn.AddOperand(spOprd1);
@@ -1814,23 +1947,28 @@ bool X86Architecture::Operand__Pq_Ey(BinaryStream const& rBinStrm, OffsetType Of
   return true;
 }
 
-/* operand ['op0 = decode_Pq', 'op1 = decode_Mw', 'op2 = decode_Ib'] */
-bool X86Architecture::Operand__Pq_Mw_Ib(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+/* operand ['last_len', 'op0 = decode_Pq', 'op1 = decode_Mw', 'move_decode_offset(next_operand)', 'op2 = decode_Ib'] */
+template<u8 Mode>
+bool X86Architecture::Operand__Pq_Mw_Ib(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
+  // operand0: last_len
+  auto LastLen = rInsn.GetSize();
   // operand0: op0 = decode_Pq
-  auto spOprd0 = Decode_Pq(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd0 = Decode_Pq<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd0 == nullptr)
     return false;
   rInsn.AddOperand(spOprd0);
 
   // operand1: op1 = decode_Mw
-  auto spOprd1 = Decode_Mw(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd1 = Decode_Mw<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd1 == nullptr)
     return false;
   rInsn.AddOperand(spOprd1);
 
+  // operand2: move_decode_offset(next_operand)
+  Offset += (rInsn.GetSize() - LastLen);
   // operand2: op2 = decode_Ib
-  auto spOprd2 = Decode_Ib(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd2 = Decode_Ib<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd2 == nullptr)
     return false;
   rInsn.AddOperand(spOprd2);
@@ -1839,16 +1977,17 @@ bool X86Architecture::Operand__Pq_Mw_Ib(BinaryStream const& rBinStrm, OffsetType
 }
 
 /* operand ['op0 = decode_Pq', 'op1 = decode_Nq'] */
-bool X86Architecture::Operand__Pq_Nq(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Operand__Pq_Nq(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: op0 = decode_Pq
-  auto spOprd0 = Decode_Pq(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd0 = Decode_Pq<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd0 == nullptr)
     return false;
   rInsn.AddOperand(spOprd0);
 
   // operand1: op1 = decode_Nq
-  auto spOprd1 = Decode_Nq(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd1 = Decode_Nq<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd1 == nullptr)
     return false;
   rInsn.AddOperand(spOprd1);
@@ -1857,16 +1996,17 @@ bool X86Architecture::Operand__Pq_Nq(BinaryStream const& rBinStrm, OffsetType Of
 }
 
 /* operand ['op0 = decode_Pq', 'op1 = decode_Qd'] */
-bool X86Architecture::Operand__Pq_Qd(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Operand__Pq_Qd(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: op0 = decode_Pq
-  auto spOprd0 = Decode_Pq(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd0 = Decode_Pq<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd0 == nullptr)
     return false;
   rInsn.AddOperand(spOprd0);
 
   // operand1: op1 = decode_Qd
-  auto spOprd1 = Decode_Qd(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd1 = Decode_Qd<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd1 == nullptr)
     return false;
   rInsn.AddOperand(spOprd1);
@@ -1875,16 +2015,17 @@ bool X86Architecture::Operand__Pq_Qd(BinaryStream const& rBinStrm, OffsetType Of
 }
 
 /* operand ['op0 = decode_Pq', 'op1 = decode_Qq'] */
-bool X86Architecture::Operand__Pq_Qq(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Operand__Pq_Qq(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: op0 = decode_Pq
-  auto spOprd0 = Decode_Pq(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd0 = Decode_Pq<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd0 == nullptr)
     return false;
   rInsn.AddOperand(spOprd0);
 
   // operand1: op1 = decode_Qq
-  auto spOprd1 = Decode_Qq(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd1 = Decode_Qq<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd1 == nullptr)
     return false;
   rInsn.AddOperand(spOprd1);
@@ -1892,23 +2033,28 @@ bool X86Architecture::Operand__Pq_Qq(BinaryStream const& rBinStrm, OffsetType Of
   return true;
 }
 
-/* operand ['op0 = decode_Pq', 'op1 = decode_Qq', 'op2 = decode_Ib'] */
-bool X86Architecture::Operand__Pq_Qq_Ib(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+/* operand ['last_len', 'op0 = decode_Pq', 'op1 = decode_Qq', 'move_decode_offset(next_operand)', 'op2 = decode_Ib'] */
+template<u8 Mode>
+bool X86Architecture::Operand__Pq_Qq_Ib(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
+  // operand0: last_len
+  auto LastLen = rInsn.GetSize();
   // operand0: op0 = decode_Pq
-  auto spOprd0 = Decode_Pq(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd0 = Decode_Pq<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd0 == nullptr)
     return false;
   rInsn.AddOperand(spOprd0);
 
   // operand1: op1 = decode_Qq
-  auto spOprd1 = Decode_Qq(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd1 = Decode_Qq<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd1 == nullptr)
     return false;
   rInsn.AddOperand(spOprd1);
 
+  // operand2: move_decode_offset(next_operand)
+  Offset += (rInsn.GetSize() - LastLen);
   // operand2: op2 = decode_Ib
-  auto spOprd2 = Decode_Ib(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd2 = Decode_Ib<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd2 == nullptr)
     return false;
   rInsn.AddOperand(spOprd2);
@@ -1917,16 +2063,17 @@ bool X86Architecture::Operand__Pq_Qq_Ib(BinaryStream const& rBinStrm, OffsetType
 }
 
 /* operand ['op0 = decode_Pq', 'op1 = decode_Uq'] */
-bool X86Architecture::Operand__Pq_Uq(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Operand__Pq_Uq(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: op0 = decode_Pq
-  auto spOprd0 = Decode_Pq(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd0 = Decode_Pq<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd0 == nullptr)
     return false;
   rInsn.AddOperand(spOprd0);
 
   // operand1: op1 = decode_Uq
-  auto spOprd1 = Decode_Uq(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd1 = Decode_Uq<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd1 == nullptr)
     return false;
   rInsn.AddOperand(spOprd1);
@@ -1935,16 +2082,17 @@ bool X86Architecture::Operand__Pq_Uq(BinaryStream const& rBinStrm, OffsetType Of
 }
 
 /* operand ['op0 = decode_Pq', 'op1 = decode_Wo'] */
-bool X86Architecture::Operand__Pq_Wo(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Operand__Pq_Wo(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: op0 = decode_Pq
-  auto spOprd0 = Decode_Pq(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd0 = Decode_Pq<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd0 == nullptr)
     return false;
   rInsn.AddOperand(spOprd0);
 
   // operand1: op1 = decode_Wo
-  auto spOprd1 = Decode_Wo(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd1 = Decode_Wo<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd1 == nullptr)
     return false;
   rInsn.AddOperand(spOprd1);
@@ -1953,16 +2101,17 @@ bool X86Architecture::Operand__Pq_Wo(BinaryStream const& rBinStrm, OffsetType Of
 }
 
 /* operand ['op0 = decode_Pq', 'op1 = decode_Woq'] */
-bool X86Architecture::Operand__Pq_Woq(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Operand__Pq_Woq(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: op0 = decode_Pq
-  auto spOprd0 = Decode_Pq(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd0 = Decode_Pq<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd0 == nullptr)
     return false;
   rInsn.AddOperand(spOprd0);
 
   // operand1: op1 = decode_Woq
-  auto spOprd1 = Decode_Woq(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd1 = Decode_Woq<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd1 == nullptr)
     return false;
   rInsn.AddOperand(spOprd1);
@@ -1971,16 +2120,17 @@ bool X86Architecture::Operand__Pq_Woq(BinaryStream const& rBinStrm, OffsetType O
 }
 
 /* operand ['op0 = decode_Qq', 'op1 = decode_Pq'] */
-bool X86Architecture::Operand__Qq_Pq(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Operand__Qq_Pq(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: op0 = decode_Qq
-  auto spOprd0 = Decode_Qq(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd0 = Decode_Qq<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd0 == nullptr)
     return false;
   rInsn.AddOperand(spOprd0);
 
   // operand1: op1 = decode_Pq
-  auto spOprd1 = Decode_Pq(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd1 = Decode_Pq<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd1 == nullptr)
     return false;
   rInsn.AddOperand(spOprd1);
@@ -1989,10 +2139,11 @@ bool X86Architecture::Operand__Qq_Pq(BinaryStream const& rBinStrm, OffsetType Of
 }
 
 /* operand ['op0 = decode_Rv'] */
-bool X86Architecture::Operand__Rv(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Operand__Rv(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: op0 = decode_Rv
-  auto spOprd0 = Decode_Rv(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd0 = Decode_Rv<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd0 == nullptr)
     return false;
   rInsn.AddOperand(spOprd0);
@@ -2001,10 +2152,11 @@ bool X86Architecture::Operand__Rv(BinaryStream const& rBinStrm, OffsetType Offse
 }
 
 /* operand ['op0 = decode_Ry'] */
-bool X86Architecture::Operand__Ry(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Operand__Ry(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: op0 = decode_Ry
-  auto spOprd0 = Decode_Ry(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd0 = Decode_Ry<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd0 == nullptr)
     return false;
   rInsn.AddOperand(spOprd0);
@@ -2013,16 +2165,17 @@ bool X86Architecture::Operand__Ry(BinaryStream const& rBinStrm, OffsetType Offse
 }
 
 /* operand ['op0 = decode_Ry', 'op1 = decode_Cy'] */
-bool X86Architecture::Operand__Ry_Cy(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Operand__Ry_Cy(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: op0 = decode_Ry
-  auto spOprd0 = Decode_Ry(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd0 = Decode_Ry<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd0 == nullptr)
     return false;
   rInsn.AddOperand(spOprd0);
 
   // operand1: op1 = decode_Cy
-  auto spOprd1 = Decode_Cy(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd1 = Decode_Cy<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd1 == nullptr)
     return false;
   rInsn.AddOperand(spOprd1);
@@ -2031,16 +2184,17 @@ bool X86Architecture::Operand__Ry_Cy(BinaryStream const& rBinStrm, OffsetType Of
 }
 
 /* operand ['op0 = decode_Ry', 'op1 = decode_Dy'] */
-bool X86Architecture::Operand__Ry_Dy(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Operand__Ry_Dy(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: op0 = decode_Ry
-  auto spOprd0 = Decode_Ry(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd0 = Decode_Ry<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd0 == nullptr)
     return false;
   rInsn.AddOperand(spOprd0);
 
   // operand1: op1 = decode_Dy
-  auto spOprd1 = Decode_Dy(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd1 = Decode_Dy<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd1 == nullptr)
     return false;
   rInsn.AddOperand(spOprd1);
@@ -2049,16 +2203,17 @@ bool X86Architecture::Operand__Ry_Dy(BinaryStream const& rBinStrm, OffsetType Of
 }
 
 /* operand ['op0 = decode_Ry', 'op1 = decode_Ty'] */
-bool X86Architecture::Operand__Ry_Ty(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Operand__Ry_Ty(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: op0 = decode_Ry
-  auto spOprd0 = Decode_Ry(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd0 = Decode_Ry<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd0 == nullptr)
     return false;
   rInsn.AddOperand(spOprd0);
 
   // operand1: op1 = decode_Ty
-  auto spOprd1 = Decode_Ty(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd1 = Decode_Ty<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd1 == nullptr)
     return false;
   rInsn.AddOperand(spOprd1);
@@ -2067,10 +2222,11 @@ bool X86Architecture::Operand__Ry_Ty(BinaryStream const& rBinStrm, OffsetType Of
 }
 
 /* operand ['op0 = decode_SS'] */
-bool X86Architecture::Operand__SS(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Operand__SS(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: op0 = decode_SS
-  auto spOprd0 = Decode_SS(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd0 = Decode_SS<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd0 == nullptr)
     return false;
   rInsn.AddOperand(spOprd0);
@@ -2079,10 +2235,11 @@ bool X86Architecture::Operand__SS(BinaryStream const& rBinStrm, OffsetType Offse
 }
 
 /* operand ['op0 = decode_ST0'] */
-bool X86Architecture::Operand__ST0(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Operand__ST0(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: op0 = decode_ST0
-  auto spOprd0 = Decode_ST0(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd0 = Decode_ST0<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd0 == nullptr)
     return false;
   rInsn.AddOperand(spOprd0);
@@ -2091,16 +2248,17 @@ bool X86Architecture::Operand__ST0(BinaryStream const& rBinStrm, OffsetType Offs
 }
 
 /* operand ['op0 = decode_ST0', 'op1 = decode_ST0'] */
-bool X86Architecture::Operand__ST0_ST0(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Operand__ST0_ST0(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: op0 = decode_ST0
-  auto spOprd0 = Decode_ST0(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd0 = Decode_ST0<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd0 == nullptr)
     return false;
   rInsn.AddOperand(spOprd0);
 
   // operand1: op1 = decode_ST0
-  auto spOprd1 = Decode_ST0(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd1 = Decode_ST0<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd1 == nullptr)
     return false;
   rInsn.AddOperand(spOprd1);
@@ -2109,16 +2267,17 @@ bool X86Architecture::Operand__ST0_ST0(BinaryStream const& rBinStrm, OffsetType
 }
 
 /* operand ['op0 = decode_ST0', 'op1 = decode_ST1'] */
-bool X86Architecture::Operand__ST0_ST1(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Operand__ST0_ST1(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: op0 = decode_ST0
-  auto spOprd0 = Decode_ST0(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd0 = Decode_ST0<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd0 == nullptr)
     return false;
   rInsn.AddOperand(spOprd0);
 
   // operand1: op1 = decode_ST1
-  auto spOprd1 = Decode_ST1(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd1 = Decode_ST1<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd1 == nullptr)
     return false;
   rInsn.AddOperand(spOprd1);
@@ -2127,16 +2286,17 @@ bool X86Architecture::Operand__ST0_ST1(BinaryStream const& rBinStrm, OffsetType
 }
 
 /* operand ['op0 = decode_ST0', 'op1 = decode_ST2'] */
-bool X86Architecture::Operand__ST0_ST2(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Operand__ST0_ST2(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: op0 = decode_ST0
-  auto spOprd0 = Decode_ST0(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd0 = Decode_ST0<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd0 == nullptr)
     return false;
   rInsn.AddOperand(spOprd0);
 
   // operand1: op1 = decode_ST2
-  auto spOprd1 = Decode_ST2(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd1 = Decode_ST2<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd1 == nullptr)
     return false;
   rInsn.AddOperand(spOprd1);
@@ -2145,16 +2305,17 @@ bool X86Architecture::Operand__ST0_ST2(BinaryStream const& rBinStrm, OffsetType
 }
 
 /* operand ['op0 = decode_ST0', 'op1 = decode_ST3'] */
-bool X86Architecture::Operand__ST0_ST3(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Operand__ST0_ST3(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: op0 = decode_ST0
-  auto spOprd0 = Decode_ST0(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd0 = Decode_ST0<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd0 == nullptr)
     return false;
   rInsn.AddOperand(spOprd0);
 
   // operand1: op1 = decode_ST3
-  auto spOprd1 = Decode_ST3(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd1 = Decode_ST3<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd1 == nullptr)
     return false;
   rInsn.AddOperand(spOprd1);
@@ -2163,16 +2324,17 @@ bool X86Architecture::Operand__ST0_ST3(BinaryStream const& rBinStrm, OffsetType
 }
 
 /* operand ['op0 = decode_ST0', 'op1 = decode_ST4'] */
-bool X86Architecture::Operand__ST0_ST4(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Operand__ST0_ST4(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: op0 = decode_ST0
-  auto spOprd0 = Decode_ST0(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd0 = Decode_ST0<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd0 == nullptr)
     return false;
   rInsn.AddOperand(spOprd0);
 
   // operand1: op1 = decode_ST4
-  auto spOprd1 = Decode_ST4(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd1 = Decode_ST4<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd1 == nullptr)
     return false;
   rInsn.AddOperand(spOprd1);
@@ -2181,16 +2343,17 @@ bool X86Architecture::Operand__ST0_ST4(BinaryStream const& rBinStrm, OffsetType
 }
 
 /* operand ['op0 = decode_ST0', 'op1 = decode_ST5'] */
-bool X86Architecture::Operand__ST0_ST5(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Operand__ST0_ST5(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: op0 = decode_ST0
-  auto spOprd0 = Decode_ST0(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd0 = Decode_ST0<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd0 == nullptr)
     return false;
   rInsn.AddOperand(spOprd0);
 
   // operand1: op1 = decode_ST5
-  auto spOprd1 = Decode_ST5(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd1 = Decode_ST5<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd1 == nullptr)
     return false;
   rInsn.AddOperand(spOprd1);
@@ -2199,16 +2362,17 @@ bool X86Architecture::Operand__ST0_ST5(BinaryStream const& rBinStrm, OffsetType
 }
 
 /* operand ['op0 = decode_ST0', 'op1 = decode_ST6'] */
-bool X86Architecture::Operand__ST0_ST6(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Operand__ST0_ST6(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: op0 = decode_ST0
-  auto spOprd0 = Decode_ST0(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd0 = Decode_ST0<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd0 == nullptr)
     return false;
   rInsn.AddOperand(spOprd0);
 
   // operand1: op1 = decode_ST6
-  auto spOprd1 = Decode_ST6(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd1 = Decode_ST6<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd1 == nullptr)
     return false;
   rInsn.AddOperand(spOprd1);
@@ -2217,16 +2381,17 @@ bool X86Architecture::Operand__ST0_ST6(BinaryStream const& rBinStrm, OffsetType
 }
 
 /* operand ['op0 = decode_ST0', 'op1 = decode_ST7'] */
-bool X86Architecture::Operand__ST0_ST7(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Operand__ST0_ST7(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: op0 = decode_ST0
-  auto spOprd0 = Decode_ST0(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd0 = Decode_ST0<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd0 == nullptr)
     return false;
   rInsn.AddOperand(spOprd0);
 
   // operand1: op1 = decode_ST7
-  auto spOprd1 = Decode_ST7(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd1 = Decode_ST7<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd1 == nullptr)
     return false;
   rInsn.AddOperand(spOprd1);
@@ -2235,10 +2400,11 @@ bool X86Architecture::Operand__ST0_ST7(BinaryStream const& rBinStrm, OffsetType
 }
 
 /* operand ['op0 = decode_ST1'] */
-bool X86Architecture::Operand__ST1(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Operand__ST1(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: op0 = decode_ST1
-  auto spOprd0 = Decode_ST1(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd0 = Decode_ST1<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd0 == nullptr)
     return false;
   rInsn.AddOperand(spOprd0);
@@ -2247,16 +2413,17 @@ bool X86Architecture::Operand__ST1(BinaryStream const& rBinStrm, OffsetType Offs
 }
 
 /* operand ['op0 = decode_ST1', 'op1 = decode_ST0'] */
-bool X86Architecture::Operand__ST1_ST0(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Operand__ST1_ST0(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: op0 = decode_ST1
-  auto spOprd0 = Decode_ST1(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd0 = Decode_ST1<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd0 == nullptr)
     return false;
   rInsn.AddOperand(spOprd0);
 
   // operand1: op1 = decode_ST0
-  auto spOprd1 = Decode_ST0(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd1 = Decode_ST0<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd1 == nullptr)
     return false;
   rInsn.AddOperand(spOprd1);
@@ -2265,10 +2432,11 @@ bool X86Architecture::Operand__ST1_ST0(BinaryStream const& rBinStrm, OffsetType
 }
 
 /* operand ['op0 = decode_ST2'] */
-bool X86Architecture::Operand__ST2(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Operand__ST2(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: op0 = decode_ST2
-  auto spOprd0 = Decode_ST2(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd0 = Decode_ST2<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd0 == nullptr)
     return false;
   rInsn.AddOperand(spOprd0);
@@ -2277,16 +2445,17 @@ bool X86Architecture::Operand__ST2(BinaryStream const& rBinStrm, OffsetType Offs
 }
 
 /* operand ['op0 = decode_ST2', 'op1 = decode_ST0'] */
-bool X86Architecture::Operand__ST2_ST0(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Operand__ST2_ST0(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: op0 = decode_ST2
-  auto spOprd0 = Decode_ST2(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd0 = Decode_ST2<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd0 == nullptr)
     return false;
   rInsn.AddOperand(spOprd0);
 
   // operand1: op1 = decode_ST0
-  auto spOprd1 = Decode_ST0(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd1 = Decode_ST0<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd1 == nullptr)
     return false;
   rInsn.AddOperand(spOprd1);
@@ -2295,10 +2464,11 @@ bool X86Architecture::Operand__ST2_ST0(BinaryStream const& rBinStrm, OffsetType
 }
 
 /* operand ['op0 = decode_ST3'] */
-bool X86Architecture::Operand__ST3(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Operand__ST3(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: op0 = decode_ST3
-  auto spOprd0 = Decode_ST3(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd0 = Decode_ST3<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd0 == nullptr)
     return false;
   rInsn.AddOperand(spOprd0);
@@ -2307,16 +2477,17 @@ bool X86Architecture::Operand__ST3(BinaryStream const& rBinStrm, OffsetType Offs
 }
 
 /* operand ['op0 = decode_ST3', 'op1 = decode_ST0'] */
-bool X86Architecture::Operand__ST3_ST0(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Operand__ST3_ST0(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: op0 = decode_ST3
-  auto spOprd0 = Decode_ST3(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd0 = Decode_ST3<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd0 == nullptr)
     return false;
   rInsn.AddOperand(spOprd0);
 
   // operand1: op1 = decode_ST0
-  auto spOprd1 = Decode_ST0(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd1 = Decode_ST0<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd1 == nullptr)
     return false;
   rInsn.AddOperand(spOprd1);
@@ -2325,10 +2496,11 @@ bool X86Architecture::Operand__ST3_ST0(BinaryStream const& rBinStrm, OffsetType
 }
 
 /* operand ['op0 = decode_ST4'] */
-bool X86Architecture::Operand__ST4(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Operand__ST4(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: op0 = decode_ST4
-  auto spOprd0 = Decode_ST4(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd0 = Decode_ST4<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd0 == nullptr)
     return false;
   rInsn.AddOperand(spOprd0);
@@ -2337,16 +2509,17 @@ bool X86Architecture::Operand__ST4(BinaryStream const& rBinStrm, OffsetType Offs
 }
 
 /* operand ['op0 = decode_ST4', 'op1 = decode_ST0'] */
-bool X86Architecture::Operand__ST4_ST0(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Operand__ST4_ST0(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: op0 = decode_ST4
-  auto spOprd0 = Decode_ST4(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd0 = Decode_ST4<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd0 == nullptr)
     return false;
   rInsn.AddOperand(spOprd0);
 
   // operand1: op1 = decode_ST0
-  auto spOprd1 = Decode_ST0(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd1 = Decode_ST0<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd1 == nullptr)
     return false;
   rInsn.AddOperand(spOprd1);
@@ -2355,10 +2528,11 @@ bool X86Architecture::Operand__ST4_ST0(BinaryStream const& rBinStrm, OffsetType
 }
 
 /* operand ['op0 = decode_ST5'] */
-bool X86Architecture::Operand__ST5(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Operand__ST5(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: op0 = decode_ST5
-  auto spOprd0 = Decode_ST5(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd0 = Decode_ST5<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd0 == nullptr)
     return false;
   rInsn.AddOperand(spOprd0);
@@ -2367,16 +2541,17 @@ bool X86Architecture::Operand__ST5(BinaryStream const& rBinStrm, OffsetType Offs
 }
 
 /* operand ['op0 = decode_ST5', 'op1 = decode_ST0'] */
-bool X86Architecture::Operand__ST5_ST0(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Operand__ST5_ST0(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: op0 = decode_ST5
-  auto spOprd0 = Decode_ST5(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd0 = Decode_ST5<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd0 == nullptr)
     return false;
   rInsn.AddOperand(spOprd0);
 
   // operand1: op1 = decode_ST0
-  auto spOprd1 = Decode_ST0(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd1 = Decode_ST0<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd1 == nullptr)
     return false;
   rInsn.AddOperand(spOprd1);
@@ -2385,10 +2560,11 @@ bool X86Architecture::Operand__ST5_ST0(BinaryStream const& rBinStrm, OffsetType
 }
 
 /* operand ['op0 = decode_ST6'] */
-bool X86Architecture::Operand__ST6(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Operand__ST6(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: op0 = decode_ST6
-  auto spOprd0 = Decode_ST6(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd0 = Decode_ST6<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd0 == nullptr)
     return false;
   rInsn.AddOperand(spOprd0);
@@ -2397,16 +2573,17 @@ bool X86Architecture::Operand__ST6(BinaryStream const& rBinStrm, OffsetType Offs
 }
 
 /* operand ['op0 = decode_ST6', 'op1 = decode_ST0'] */
-bool X86Architecture::Operand__ST6_ST0(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Operand__ST6_ST0(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: op0 = decode_ST6
-  auto spOprd0 = Decode_ST6(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd0 = Decode_ST6<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd0 == nullptr)
     return false;
   rInsn.AddOperand(spOprd0);
 
   // operand1: op1 = decode_ST0
-  auto spOprd1 = Decode_ST0(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd1 = Decode_ST0<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd1 == nullptr)
     return false;
   rInsn.AddOperand(spOprd1);
@@ -2415,10 +2592,11 @@ bool X86Architecture::Operand__ST6_ST0(BinaryStream const& rBinStrm, OffsetType
 }
 
 /* operand ['op0 = decode_ST7'] */
-bool X86Architecture::Operand__ST7(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Operand__ST7(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: op0 = decode_ST7
-  auto spOprd0 = Decode_ST7(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd0 = Decode_ST7<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd0 == nullptr)
     return false;
   rInsn.AddOperand(spOprd0);
@@ -2427,16 +2605,17 @@ bool X86Architecture::Operand__ST7(BinaryStream const& rBinStrm, OffsetType Offs
 }
 
 /* operand ['op0 = decode_ST7', 'op1 = decode_ST0'] */
-bool X86Architecture::Operand__ST7_ST0(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Operand__ST7_ST0(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: op0 = decode_ST7
-  auto spOprd0 = Decode_ST7(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd0 = Decode_ST7<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd0 == nullptr)
     return false;
   rInsn.AddOperand(spOprd0);
 
   // operand1: op1 = decode_ST0
-  auto spOprd1 = Decode_ST0(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd1 = Decode_ST0<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd1 == nullptr)
     return false;
   rInsn.AddOperand(spOprd1);
@@ -2445,16 +2624,17 @@ bool X86Architecture::Operand__ST7_ST0(BinaryStream const& rBinStrm, OffsetType
 }
 
 /* operand ['op0 = decode_Sw', 'op1 = decode_Ew'] */
-bool X86Architecture::Operand__Sw_Ew(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Operand__Sw_Ew(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: op0 = decode_Sw
-  auto spOprd0 = Decode_Sw(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd0 = Decode_Sw<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd0 == nullptr)
     return false;
   rInsn.AddOperand(spOprd0);
 
   // operand1: op1 = decode_Ew
-  auto spOprd1 = Decode_Ew(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd1 = Decode_Ew<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd1 == nullptr)
     return false;
   rInsn.AddOperand(spOprd1);
@@ -2463,16 +2643,17 @@ bool X86Architecture::Operand__Sw_Ew(BinaryStream const& rBinStrm, OffsetType Of
 }
 
 /* operand ['op0 = decode_Ty', 'op1 = decode_Ry'] */
-bool X86Architecture::Operand__Ty_Ry(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Operand__Ty_Ry(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: op0 = decode_Ty
-  auto spOprd0 = Decode_Ty(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd0 = Decode_Ty<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd0 == nullptr)
     return false;
   rInsn.AddOperand(spOprd0);
 
   // operand1: op1 = decode_Ry
-  auto spOprd1 = Decode_Ry(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd1 = Decode_Ry<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd1 == nullptr)
     return false;
   rInsn.AddOperand(spOprd1);
@@ -2481,10 +2662,11 @@ bool X86Architecture::Operand__Ty_Ry(BinaryStream const& rBinStrm, OffsetType Of
 }
 
 /* operand ['op0 = decode_Uo'] */
-bool X86Architecture::Operand__Uo(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Operand__Uo(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: op0 = decode_Uo
-  auto spOprd0 = Decode_Uo(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd0 = Decode_Uo<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd0 == nullptr)
     return false;
   rInsn.AddOperand(spOprd0);
@@ -2492,23 +2674,30 @@ bool X86Architecture::Operand__Uo(BinaryStream const& rBinStrm, OffsetType Offse
   return true;
 }
 
-/* operand ['op0 = decode_Uo', 'op1 = decode_Ib', 'op2 = decode_Ib'] */
-bool X86Architecture::Operand__Uo_Ib_Ib(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+/* operand ['last_len', 'op0 = decode_Uo', 'move_decode_offset(next_operand)', 'op1 = decode_Ib', 'move_decode_offset(1)', 'op2 = decode_Ib'] */
+template<u8 Mode>
+bool X86Architecture::Operand__Uo_Ib_Ib(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
+  // operand0: last_len
+  auto LastLen = rInsn.GetSize();
   // operand0: op0 = decode_Uo
-  auto spOprd0 = Decode_Uo(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd0 = Decode_Uo<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd0 == nullptr)
     return false;
   rInsn.AddOperand(spOprd0);
 
+  // operand1: move_decode_offset(next_operand)
+  Offset += (rInsn.GetSize() - LastLen);
   // operand1: op1 = decode_Ib
-  auto spOprd1 = Decode_Ib(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd1 = Decode_Ib<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd1 == nullptr)
     return false;
   rInsn.AddOperand(spOprd1);
 
+  // operand2: move_decode_offset(1)
+  ++Offset;
   // operand2: op2 = decode_Ib
-  auto spOprd2 = Decode_Ib(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd2 = Decode_Ib<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd2 == nullptr)
     return false;
   rInsn.AddOperand(spOprd2);
@@ -2517,16 +2706,17 @@ bool X86Architecture::Operand__Uo_Ib_Ib(BinaryStream const& rBinStrm, OffsetType
 }
 
 /* operand ['op0 = decode_Uo', 'op1 = decode_Vod'] */
-bool X86Architecture::Operand__Uo_Vod(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Operand__Uo_Vod(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: op0 = decode_Uo
-  auto spOprd0 = Decode_Uo(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd0 = Decode_Uo<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd0 == nullptr)
     return false;
   rInsn.AddOperand(spOprd0);
 
   // operand1: op1 = decode_Vod
-  auto spOprd1 = Decode_Vod(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd1 = Decode_Vod<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd1 == nullptr)
     return false;
   rInsn.AddOperand(spOprd1);
@@ -2535,16 +2725,17 @@ bool X86Architecture::Operand__Uo_Vod(BinaryStream const& rBinStrm, OffsetType O
 }
 
 /* operand ['op0 = decode_Uo', 'op1 = decode_Voq'] */
-bool X86Architecture::Operand__Uo_Voq(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Operand__Uo_Voq(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: op0 = decode_Uo
-  auto spOprd0 = Decode_Uo(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd0 = Decode_Uo<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd0 == nullptr)
     return false;
   rInsn.AddOperand(spOprd0);
 
   // operand1: op1 = decode_Voq
-  auto spOprd1 = Decode_Voq(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd1 = Decode_Voq<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd1 == nullptr)
     return false;
   rInsn.AddOperand(spOprd1);
@@ -2553,16 +2744,17 @@ bool X86Architecture::Operand__Uo_Voq(BinaryStream const& rBinStrm, OffsetType O
 }
 
 /* operand ['op0 = decode_Uoq', 'op1 = decode_Vo'] */
-bool X86Architecture::Operand__Uoq_Vo(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Operand__Uoq_Vo(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: op0 = decode_Uoq
-  auto spOprd0 = Decode_Uoq(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd0 = Decode_Uoq<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd0 == nullptr)
     return false;
   rInsn.AddOperand(spOprd0);
 
   // operand1: op1 = decode_Vo
-  auto spOprd1 = Decode_Vo(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd1 = Decode_Vo<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd1 == nullptr)
     return false;
   rInsn.AddOperand(spOprd1);
@@ -2571,12 +2763,13 @@ bool X86Architecture::Operand__Uoq_Vo(BinaryStream const& rBinStrm, OffsetType O
 }
 
 /* operand ['last_len', 'op0 = decode_Ux', 'move_decode_offset(next_operand)', 'op1 = decode_Ib'] */
-bool X86Architecture::Operand__Ux_Ib(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Operand__Ux_Ib(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: last_len
   auto LastLen = rInsn.GetSize();
   // operand0: op0 = decode_Ux
-  auto spOprd0 = Decode_Ux(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd0 = Decode_Ux<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd0 == nullptr)
     return false;
   rInsn.AddOperand(spOprd0);
@@ -2584,7 +2777,7 @@ bool X86Architecture::Operand__Ux_Ib(BinaryStream const& rBinStrm, OffsetType Of
   // operand1: move_decode_offset(next_operand)
   Offset += (rInsn.GetSize() - LastLen);
   // operand1: op1 = decode_Ib
-  auto spOprd1 = Decode_Ib(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd1 = Decode_Ib<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd1 == nullptr)
     return false;
   rInsn.AddOperand(spOprd1);
@@ -2593,16 +2786,17 @@ bool X86Architecture::Operand__Ux_Ib(BinaryStream const& rBinStrm, OffsetType Of
 }
 
 /* operand ['op0 = decode_Vo', 'op1 = decode_Ed'] */
-bool X86Architecture::Operand__Vo_Ed(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Operand__Vo_Ed(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: op0 = decode_Vo
-  auto spOprd0 = Decode_Vo(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd0 = Decode_Vo<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd0 == nullptr)
     return false;
   rInsn.AddOperand(spOprd0);
 
   // operand1: op1 = decode_Ed
-  auto spOprd1 = Decode_Ed(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd1 = Decode_Ed<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd1 == nullptr)
     return false;
   rInsn.AddOperand(spOprd1);
@@ -2610,23 +2804,28 @@ bool X86Architecture::Operand__Vo_Ed(BinaryStream const& rBinStrm, OffsetType Of
   return true;
 }
 
-/* operand ['op0 = decode_Vo', 'op1 = decode_Edb', 'op2 = decode_Ib'] */
-bool X86Architecture::Operand__Vo_Edb_Ib(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+/* operand ['last_len', 'op0 = decode_Vo', 'op1 = decode_Edb', 'move_decode_offset(next_operand)', 'op2 = decode_Ib'] */
+template<u8 Mode>
+bool X86Architecture::Operand__Vo_Edb_Ib(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
+  // operand0: last_len
+  auto LastLen = rInsn.GetSize();
   // operand0: op0 = decode_Vo
-  auto spOprd0 = Decode_Vo(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd0 = Decode_Vo<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd0 == nullptr)
     return false;
   rInsn.AddOperand(spOprd0);
 
   // operand1: op1 = decode_Edb
-  auto spOprd1 = Decode_Edb(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd1 = Decode_Edb<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd1 == nullptr)
     return false;
   rInsn.AddOperand(spOprd1);
 
+  // operand2: move_decode_offset(next_operand)
+  Offset += (rInsn.GetSize() - LastLen);
   // operand2: op2 = decode_Ib
-  auto spOprd2 = Decode_Ib(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd2 = Decode_Ib<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd2 == nullptr)
     return false;
   rInsn.AddOperand(spOprd2);
@@ -2635,16 +2834,17 @@ bool X86Architecture::Operand__Vo_Edb_Ib(BinaryStream const& rBinStrm, OffsetTyp
 }
 
 /* operand ['op0 = decode_Vo', 'op1 = decode_Ey'] */
-bool X86Architecture::Operand__Vo_Ey(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Operand__Vo_Ey(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: op0 = decode_Vo
-  auto spOprd0 = Decode_Vo(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd0 = Decode_Vo<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd0 == nullptr)
     return false;
   rInsn.AddOperand(spOprd0);
 
   // operand1: op1 = decode_Ey
-  auto spOprd1 = Decode_Ey(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd1 = Decode_Ey<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd1 == nullptr)
     return false;
   rInsn.AddOperand(spOprd1);
@@ -2652,23 +2852,28 @@ bool X86Architecture::Operand__Vo_Ey(BinaryStream const& rBinStrm, OffsetType Of
   return true;
 }
 
-/* operand ['op0 = decode_Vo', 'op1 = decode_Ey', 'op2 = decode_Ib'] */
-bool X86Architecture::Operand__Vo_Ey_Ib(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+/* operand ['last_len', 'op0 = decode_Vo', 'op1 = decode_Ey', 'move_decode_offset(next_operand)', 'op2 = decode_Ib'] */
+template<u8 Mode>
+bool X86Architecture::Operand__Vo_Ey_Ib(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
+  // operand0: last_len
+  auto LastLen = rInsn.GetSize();
   // operand0: op0 = decode_Vo
-  auto spOprd0 = Decode_Vo(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd0 = Decode_Vo<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd0 == nullptr)
     return false;
   rInsn.AddOperand(spOprd0);
 
   // operand1: op1 = decode_Ey
-  auto spOprd1 = Decode_Ey(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd1 = Decode_Ey<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd1 == nullptr)
     return false;
   rInsn.AddOperand(spOprd1);
 
+  // operand2: move_decode_offset(next_operand)
+  Offset += (rInsn.GetSize() - LastLen);
   // operand2: op2 = decode_Ib
-  auto spOprd2 = Decode_Ib(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd2 = Decode_Ib<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd2 == nullptr)
     return false;
   rInsn.AddOperand(spOprd2);
@@ -2676,29 +2881,34 @@ bool X86Architecture::Operand__Vo_Ey_Ib(BinaryStream const& rBinStrm, OffsetType
   return true;
 }
 
-/* operand ['op0 = decode_Vo', 'op1 = decode_Ho', 'op2 = decode_Edb', 'op3 = decode_Ib'] */
-bool X86Architecture::Operand__Vo_Ho_Edb_Ib(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+/* operand ['last_len', 'op0 = decode_Vo', 'op1 = decode_Ho', 'op2 = decode_Edb', 'move_decode_offset(next_operand)', 'op3 = decode_Ib'] */
+template<u8 Mode>
+bool X86Architecture::Operand__Vo_Ho_Edb_Ib(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
+  // operand0: last_len
+  auto LastLen = rInsn.GetSize();
   // operand0: op0 = decode_Vo
-  auto spOprd0 = Decode_Vo(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd0 = Decode_Vo<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd0 == nullptr)
     return false;
   rInsn.AddOperand(spOprd0);
 
   // operand1: op1 = decode_Ho
-  auto spOprd1 = Decode_Ho(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd1 = Decode_Ho<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd1 == nullptr)
     return false;
   rInsn.AddOperand(spOprd1);
 
   // operand2: op2 = decode_Edb
-  auto spOprd2 = Decode_Edb(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd2 = Decode_Edb<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd2 == nullptr)
     return false;
   rInsn.AddOperand(spOprd2);
 
+  // operand3: move_decode_offset(next_operand)
+  Offset += (rInsn.GetSize() - LastLen);
   // operand3: op3 = decode_Ib
-  auto spOprd3 = Decode_Ib(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd3 = Decode_Ib<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd3 == nullptr)
     return false;
   rInsn.AddOperand(spOprd3);
@@ -2707,22 +2917,23 @@ bool X86Architecture::Operand__Vo_Ho_Edb_Ib(BinaryStream const& rBinStrm, Offset
 }
 
 /* operand ['op0 = decode_Vo', 'op1 = decode_Ho', 'op2 = decode_Ey'] */
-bool X86Architecture::Operand__Vo_Ho_Ey(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Operand__Vo_Ho_Ey(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: op0 = decode_Vo
-  auto spOprd0 = Decode_Vo(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd0 = Decode_Vo<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd0 == nullptr)
     return false;
   rInsn.AddOperand(spOprd0);
 
   // operand1: op1 = decode_Ho
-  auto spOprd1 = Decode_Ho(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd1 = Decode_Ho<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd1 == nullptr)
     return false;
   rInsn.AddOperand(spOprd1);
 
   // operand2: op2 = decode_Ey
-  auto spOprd2 = Decode_Ey(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd2 = Decode_Ey<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd2 == nullptr)
     return false;
   rInsn.AddOperand(spOprd2);
@@ -2730,29 +2941,34 @@ bool X86Architecture::Operand__Vo_Ho_Ey(BinaryStream const& rBinStrm, OffsetType
   return true;
 }
 
-/* operand ['op0 = decode_Vo', 'op1 = decode_Ho', 'op2 = decode_Ey', 'op3 = decode_Ib'] */
-bool X86Architecture::Operand__Vo_Ho_Ey_Ib(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+/* operand ['last_len', 'op0 = decode_Vo', 'op1 = decode_Ho', 'op2 = decode_Ey', 'move_decode_offset(next_operand)', 'op3 = decode_Ib'] */
+template<u8 Mode>
+bool X86Architecture::Operand__Vo_Ho_Ey_Ib(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
+  // operand0: last_len
+  auto LastLen = rInsn.GetSize();
   // operand0: op0 = decode_Vo
-  auto spOprd0 = Decode_Vo(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd0 = Decode_Vo<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd0 == nullptr)
     return false;
   rInsn.AddOperand(spOprd0);
 
   // operand1: op1 = decode_Ho
-  auto spOprd1 = Decode_Ho(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd1 = Decode_Ho<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd1 == nullptr)
     return false;
   rInsn.AddOperand(spOprd1);
 
   // operand2: op2 = decode_Ey
-  auto spOprd2 = Decode_Ey(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd2 = Decode_Ey<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd2 == nullptr)
     return false;
   rInsn.AddOperand(spOprd2);
 
+  // operand3: move_decode_offset(next_operand)
+  Offset += (rInsn.GetSize() - LastLen);
   // operand3: op3 = decode_Ib
-  auto spOprd3 = Decode_Ib(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd3 = Decode_Ib<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd3 == nullptr)
     return false;
   rInsn.AddOperand(spOprd3);
@@ -2760,29 +2976,34 @@ bool X86Architecture::Operand__Vo_Ho_Ey_Ib(BinaryStream const& rBinStrm, OffsetT
   return true;
 }
 
-/* operand ['op0 = decode_Vo', 'op1 = decode_Ho', 'op2 = decode_Mw', 'op3 = decode_Ib'] */
-bool X86Architecture::Operand__Vo_Ho_Mw_Ib(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+/* operand ['last_len', 'op0 = decode_Vo', 'op1 = decode_Ho', 'op2 = decode_Mw', 'move_decode_offset(next_operand)', 'op3 = decode_Ib'] */
+template<u8 Mode>
+bool X86Architecture::Operand__Vo_Ho_Mw_Ib(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
+  // operand0: last_len
+  auto LastLen = rInsn.GetSize();
   // operand0: op0 = decode_Vo
-  auto spOprd0 = Decode_Vo(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd0 = Decode_Vo<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd0 == nullptr)
     return false;
   rInsn.AddOperand(spOprd0);
 
   // operand1: op1 = decode_Ho
-  auto spOprd1 = Decode_Ho(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd1 = Decode_Ho<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd1 == nullptr)
     return false;
   rInsn.AddOperand(spOprd1);
 
   // operand2: op2 = decode_Mw
-  auto spOprd2 = Decode_Mw(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd2 = Decode_Mw<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd2 == nullptr)
     return false;
   rInsn.AddOperand(spOprd2);
 
+  // operand3: move_decode_offset(next_operand)
+  Offset += (rInsn.GetSize() - LastLen);
   // operand3: op3 = decode_Ib
-  auto spOprd3 = Decode_Ib(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd3 = Decode_Ib<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd3 == nullptr)
     return false;
   rInsn.AddOperand(spOprd3);
@@ -2790,29 +3011,34 @@ bool X86Architecture::Operand__Vo_Ho_Mw_Ib(BinaryStream const& rBinStrm, OffsetT
   return true;
 }
 
-/* operand ['op0 = decode_Vo', 'op1 = decode_Ho', 'op2 = decode_Uod', 'op3 = decode_Ib'] */
-bool X86Architecture::Operand__Vo_Ho_Uod_Ib(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+/* operand ['last_len', 'op0 = decode_Vo', 'op1 = decode_Ho', 'op2 = decode_Uod', 'move_decode_offset(next_operand)', 'op3 = decode_Ib'] */
+template<u8 Mode>
+bool X86Architecture::Operand__Vo_Ho_Uod_Ib(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
+  // operand0: last_len
+  auto LastLen = rInsn.GetSize();
   // operand0: op0 = decode_Vo
-  auto spOprd0 = Decode_Vo(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd0 = Decode_Vo<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd0 == nullptr)
     return false;
   rInsn.AddOperand(spOprd0);
 
   // operand1: op1 = decode_Ho
-  auto spOprd1 = Decode_Ho(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd1 = Decode_Ho<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd1 == nullptr)
     return false;
   rInsn.AddOperand(spOprd1);
 
   // operand2: op2 = decode_Uod
-  auto spOprd2 = Decode_Uod(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd2 = Decode_Uod<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd2 == nullptr)
     return false;
   rInsn.AddOperand(spOprd2);
 
+  // operand3: move_decode_offset(next_operand)
+  Offset += (rInsn.GetSize() - LastLen);
   // operand3: op3 = decode_Ib
-  auto spOprd3 = Decode_Ib(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd3 = Decode_Ib<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd3 == nullptr)
     return false;
   rInsn.AddOperand(spOprd3);
@@ -2821,22 +3047,23 @@ bool X86Architecture::Operand__Vo_Ho_Uod_Ib(BinaryStream const& rBinStrm, Offset
 }
 
 /* operand ['op0 = decode_Vo', 'op1 = decode_Ho', 'op2 = decode_Uoq'] */
-bool X86Architecture::Operand__Vo_Ho_Uoq(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Operand__Vo_Ho_Uoq(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: op0 = decode_Vo
-  auto spOprd0 = Decode_Vo(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd0 = Decode_Vo<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd0 == nullptr)
     return false;
   rInsn.AddOperand(spOprd0);
 
   // operand1: op1 = decode_Ho
-  auto spOprd1 = Decode_Ho(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd1 = Decode_Ho<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd1 == nullptr)
     return false;
   rInsn.AddOperand(spOprd1);
 
   // operand2: op2 = decode_Uoq
-  auto spOprd2 = Decode_Uoq(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd2 = Decode_Uoq<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd2 == nullptr)
     return false;
   rInsn.AddOperand(spOprd2);
@@ -2845,22 +3072,23 @@ bool X86Architecture::Operand__Vo_Ho_Uoq(BinaryStream const& rBinStrm, OffsetTyp
 }
 
 /* operand ['op0 = decode_Vo', 'op1 = decode_Ho', 'op2 = decode_Wd'] */
-bool X86Architecture::Operand__Vo_Ho_Wd(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Operand__Vo_Ho_Wd(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: op0 = decode_Vo
-  auto spOprd0 = Decode_Vo(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd0 = Decode_Vo<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd0 == nullptr)
     return false;
   rInsn.AddOperand(spOprd0);
 
   // operand1: op1 = decode_Ho
-  auto spOprd1 = Decode_Ho(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd1 = Decode_Ho<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd1 == nullptr)
     return false;
   rInsn.AddOperand(spOprd1);
 
   // operand2: op2 = decode_Wd
-  auto spOprd2 = Decode_Wd(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd2 = Decode_Wd<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd2 == nullptr)
     return false;
   rInsn.AddOperand(spOprd2);
@@ -2869,22 +3097,23 @@ bool X86Architecture::Operand__Vo_Ho_Wd(BinaryStream const& rBinStrm, OffsetType
 }
 
 /* operand ['op0 = decode_Vo', 'op1 = decode_Ho', 'op2 = decode_Wo'] */
-bool X86Architecture::Operand__Vo_Ho_Wo(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Operand__Vo_Ho_Wo(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: op0 = decode_Vo
-  auto spOprd0 = Decode_Vo(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd0 = Decode_Vo<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd0 == nullptr)
     return false;
   rInsn.AddOperand(spOprd0);
 
   // operand1: op1 = decode_Ho
-  auto spOprd1 = Decode_Ho(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd1 = Decode_Ho<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd1 == nullptr)
     return false;
   rInsn.AddOperand(spOprd1);
 
   // operand2: op2 = decode_Wo
-  auto spOprd2 = Decode_Wo(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd2 = Decode_Wo<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd2 == nullptr)
     return false;
   rInsn.AddOperand(spOprd2);
@@ -2892,29 +3121,34 @@ bool X86Architecture::Operand__Vo_Ho_Wo(BinaryStream const& rBinStrm, OffsetType
   return true;
 }
 
-/* operand ['op0 = decode_Vo', 'op1 = decode_Ho', 'op2 = decode_Wo', 'op3 = decode_Ib'] */
-bool X86Architecture::Operand__Vo_Ho_Wo_Ib(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+/* operand ['last_len', 'op0 = decode_Vo', 'op1 = decode_Ho', 'op2 = decode_Wo', 'move_decode_offset(next_operand)', 'op3 = decode_Ib'] */
+template<u8 Mode>
+bool X86Architecture::Operand__Vo_Ho_Wo_Ib(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
+  // operand0: last_len
+  auto LastLen = rInsn.GetSize();
   // operand0: op0 = decode_Vo
-  auto spOprd0 = Decode_Vo(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd0 = Decode_Vo<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd0 == nullptr)
     return false;
   rInsn.AddOperand(spOprd0);
 
   // operand1: op1 = decode_Ho
-  auto spOprd1 = Decode_Ho(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd1 = Decode_Ho<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd1 == nullptr)
     return false;
   rInsn.AddOperand(spOprd1);
 
   // operand2: op2 = decode_Wo
-  auto spOprd2 = Decode_Wo(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd2 = Decode_Wo<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd2 == nullptr)
     return false;
   rInsn.AddOperand(spOprd2);
 
+  // operand3: move_decode_offset(next_operand)
+  Offset += (rInsn.GetSize() - LastLen);
   // operand3: op3 = decode_Ib
-  auto spOprd3 = Decode_Ib(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd3 = Decode_Ib<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd3 == nullptr)
     return false;
   rInsn.AddOperand(spOprd3);
@@ -2923,22 +3157,23 @@ bool X86Architecture::Operand__Vo_Ho_Wo_Ib(BinaryStream const& rBinStrm, OffsetT
 }
 
 /* operand ['op0 = decode_Vo', 'op1 = decode_Ho', 'op2 = decode_Wod'] */
-bool X86Architecture::Operand__Vo_Ho_Wod(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Operand__Vo_Ho_Wod(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: op0 = decode_Vo
-  auto spOprd0 = Decode_Vo(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd0 = Decode_Vo<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd0 == nullptr)
     return false;
   rInsn.AddOperand(spOprd0);
 
   // operand1: op1 = decode_Ho
-  auto spOprd1 = Decode_Ho(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd1 = Decode_Ho<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd1 == nullptr)
     return false;
   rInsn.AddOperand(spOprd1);
 
   // operand2: op2 = decode_Wod
-  auto spOprd2 = Decode_Wod(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd2 = Decode_Wod<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd2 == nullptr)
     return false;
   rInsn.AddOperand(spOprd2);
@@ -2947,22 +3182,23 @@ bool X86Architecture::Operand__Vo_Ho_Wod(BinaryStream const& rBinStrm, OffsetTyp
 }
 
 /* operand ['op0 = decode_Vo', 'op1 = decode_Ho', 'op2 = decode_Woq'] */
-bool X86Architecture::Operand__Vo_Ho_Woq(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Operand__Vo_Ho_Woq(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: op0 = decode_Vo
-  auto spOprd0 = Decode_Vo(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd0 = Decode_Vo<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd0 == nullptr)
     return false;
   rInsn.AddOperand(spOprd0);
 
   // operand1: op1 = decode_Ho
-  auto spOprd1 = Decode_Ho(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd1 = Decode_Ho<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd1 == nullptr)
     return false;
   rInsn.AddOperand(spOprd1);
 
   // operand2: op2 = decode_Woq
-  auto spOprd2 = Decode_Woq(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd2 = Decode_Woq<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd2 == nullptr)
     return false;
   rInsn.AddOperand(spOprd2);
@@ -2970,29 +3206,34 @@ bool X86Architecture::Operand__Vo_Ho_Woq(BinaryStream const& rBinStrm, OffsetTyp
   return true;
 }
 
-/* operand ['op0 = decode_Vo', 'op1 = decode_Ho', 'op2 = decode_Woq', 'op3 = decode_Ib'] */
-bool X86Architecture::Operand__Vo_Ho_Woq_Ib(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+/* operand ['last_len', 'op0 = decode_Vo', 'op1 = decode_Ho', 'op2 = decode_Woq', 'move_decode_offset(next_operand)', 'op3 = decode_Ib'] */
+template<u8 Mode>
+bool X86Architecture::Operand__Vo_Ho_Woq_Ib(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
+  // operand0: last_len
+  auto LastLen = rInsn.GetSize();
   // operand0: op0 = decode_Vo
-  auto spOprd0 = Decode_Vo(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd0 = Decode_Vo<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd0 == nullptr)
     return false;
   rInsn.AddOperand(spOprd0);
 
   // operand1: op1 = decode_Ho
-  auto spOprd1 = Decode_Ho(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd1 = Decode_Ho<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd1 == nullptr)
     return false;
   rInsn.AddOperand(spOprd1);
 
   // operand2: op2 = decode_Woq
-  auto spOprd2 = Decode_Woq(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd2 = Decode_Woq<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd2 == nullptr)
     return false;
   rInsn.AddOperand(spOprd2);
 
+  // operand3: move_decode_offset(next_operand)
+  Offset += (rInsn.GetSize() - LastLen);
   // operand3: op3 = decode_Ib
-  auto spOprd3 = Decode_Ib(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd3 = Decode_Ib<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd3 == nullptr)
     return false;
   rInsn.AddOperand(spOprd3);
@@ -3001,22 +3242,23 @@ bool X86Architecture::Operand__Vo_Ho_Woq_Ib(BinaryStream const& rBinStrm, Offset
 }
 
 /* operand ['op0 = decode_Vo', 'op1 = decode_Ho', 'op2 = decode_Wq'] */
-bool X86Architecture::Operand__Vo_Ho_Wq(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Operand__Vo_Ho_Wq(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: op0 = decode_Vo
-  auto spOprd0 = Decode_Vo(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd0 = Decode_Vo<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd0 == nullptr)
     return false;
   rInsn.AddOperand(spOprd0);
 
   // operand1: op1 = decode_Ho
-  auto spOprd1 = Decode_Ho(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd1 = Decode_Ho<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd1 == nullptr)
     return false;
   rInsn.AddOperand(spOprd1);
 
   // operand2: op2 = decode_Wq
-  auto spOprd2 = Decode_Wq(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd2 = Decode_Wq<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd2 == nullptr)
     return false;
   rInsn.AddOperand(spOprd2);
@@ -3025,28 +3267,29 @@ bool X86Architecture::Operand__Vo_Ho_Wq(BinaryStream const& rBinStrm, OffsetType
 }
 
 /* operand ['op0 = decode_Vo', 'op1 = decode_Md', 'op2 = decode_x', 'op3 = decode_Ho'] */
-bool X86Architecture::Operand__Vo_Md_x_Ho(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Operand__Vo_Md_x_Ho(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: op0 = decode_Vo
-  auto spOprd0 = Decode_Vo(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd0 = Decode_Vo<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd0 == nullptr)
     return false;
   rInsn.AddOperand(spOprd0);
 
   // operand1: op1 = decode_Md
-  auto spOprd1 = Decode_Md(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd1 = Decode_Md<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd1 == nullptr)
     return false;
   rInsn.AddOperand(spOprd1);
 
   // operand2: op2 = decode_x
-  auto spOprd2 = Decode_x(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd2 = Decode_x<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd2 == nullptr)
     return false;
   rInsn.AddOperand(spOprd2);
 
   // operand3: op3 = decode_Ho
-  auto spOprd3 = Decode_Ho(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd3 = Decode_Ho<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd3 == nullptr)
     return false;
   rInsn.AddOperand(spOprd3);
@@ -3055,16 +3298,17 @@ bool X86Architecture::Operand__Vo_Md_x_Ho(BinaryStream const& rBinStrm, OffsetTy
 }
 
 /* operand ['op0 = decode_Vo', 'op1 = decode_Mq'] */
-bool X86Architecture::Operand__Vo_Mq(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Operand__Vo_Mq(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: op0 = decode_Vo
-  auto spOprd0 = Decode_Vo(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd0 = Decode_Vo<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd0 == nullptr)
     return false;
   rInsn.AddOperand(spOprd0);
 
   // operand1: op1 = decode_Mq
-  auto spOprd1 = Decode_Mq(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd1 = Decode_Mq<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd1 == nullptr)
     return false;
   rInsn.AddOperand(spOprd1);
@@ -3072,23 +3316,28 @@ bool X86Architecture::Operand__Vo_Mq(BinaryStream const& rBinStrm, OffsetType Of
   return true;
 }
 
-/* operand ['op0 = decode_Vo', 'op1 = decode_Mw', 'op2 = decode_Ib'] */
-bool X86Architecture::Operand__Vo_Mw_Ib(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+/* operand ['last_len', 'op0 = decode_Vo', 'op1 = decode_Mw', 'move_decode_offset(next_operand)', 'op2 = decode_Ib'] */
+template<u8 Mode>
+bool X86Architecture::Operand__Vo_Mw_Ib(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
+  // operand0: last_len
+  auto LastLen = rInsn.GetSize();
   // operand0: op0 = decode_Vo
-  auto spOprd0 = Decode_Vo(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd0 = Decode_Vo<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd0 == nullptr)
     return false;
   rInsn.AddOperand(spOprd0);
 
   // operand1: op1 = decode_Mw
-  auto spOprd1 = Decode_Mw(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd1 = Decode_Mw<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd1 == nullptr)
     return false;
   rInsn.AddOperand(spOprd1);
 
+  // operand2: move_decode_offset(next_operand)
+  Offset += (rInsn.GetSize() - LastLen);
   // operand2: op2 = decode_Ib
-  auto spOprd2 = Decode_Ib(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd2 = Decode_Ib<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd2 == nullptr)
     return false;
   rInsn.AddOperand(spOprd2);
@@ -3097,16 +3346,17 @@ bool X86Architecture::Operand__Vo_Mw_Ib(BinaryStream const& rBinStrm, OffsetType
 }
 
 /* operand ['op0 = decode_Vo', 'op1 = decode_Nq'] */
-bool X86Architecture::Operand__Vo_Nq(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Operand__Vo_Nq(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: op0 = decode_Vo
-  auto spOprd0 = Decode_Vo(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd0 = Decode_Vo<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd0 == nullptr)
     return false;
   rInsn.AddOperand(spOprd0);
 
   // operand1: op1 = decode_Nq
-  auto spOprd1 = Decode_Nq(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd1 = Decode_Nq<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd1 == nullptr)
     return false;
   rInsn.AddOperand(spOprd1);
@@ -3115,16 +3365,17 @@ bool X86Architecture::Operand__Vo_Nq(BinaryStream const& rBinStrm, OffsetType Of
 }
 
 /* operand ['op0 = decode_Vo', 'op1 = decode_Uo'] */
-bool X86Architecture::Operand__Vo_Uo(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Operand__Vo_Uo(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: op0 = decode_Vo
-  auto spOprd0 = Decode_Vo(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd0 = Decode_Vo<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd0 == nullptr)
     return false;
   rInsn.AddOperand(spOprd0);
 
   // operand1: op1 = decode_Uo
-  auto spOprd1 = Decode_Uo(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd1 = Decode_Uo<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd1 == nullptr)
     return false;
   rInsn.AddOperand(spOprd1);
@@ -3133,16 +3384,17 @@ bool X86Architecture::Operand__Vo_Uo(BinaryStream const& rBinStrm, OffsetType Of
 }
 
 /* operand ['op0 = decode_Vo', 'op1 = decode_Uod'] */
-bool X86Architecture::Operand__Vo_Uod(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Operand__Vo_Uod(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: op0 = decode_Vo
-  auto spOprd0 = Decode_Vo(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd0 = Decode_Vo<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd0 == nullptr)
     return false;
   rInsn.AddOperand(spOprd0);
 
   // operand1: op1 = decode_Uod
-  auto spOprd1 = Decode_Uod(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd1 = Decode_Uod<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd1 == nullptr)
     return false;
   rInsn.AddOperand(spOprd1);
@@ -3150,23 +3402,28 @@ bool X86Architecture::Operand__Vo_Uod(BinaryStream const& rBinStrm, OffsetType O
   return true;
 }
 
-/* operand ['op0 = decode_Vo', 'op1 = decode_Uod', 'op2 = decode_Ib'] */
-bool X86Architecture::Operand__Vo_Uod_Ib(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+/* operand ['last_len', 'op0 = decode_Vo', 'op1 = decode_Uod', 'move_decode_offset(next_operand)', 'op2 = decode_Ib'] */
+template<u8 Mode>
+bool X86Architecture::Operand__Vo_Uod_Ib(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
+  // operand0: last_len
+  auto LastLen = rInsn.GetSize();
   // operand0: op0 = decode_Vo
-  auto spOprd0 = Decode_Vo(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd0 = Decode_Vo<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd0 == nullptr)
     return false;
   rInsn.AddOperand(spOprd0);
 
   // operand1: op1 = decode_Uod
-  auto spOprd1 = Decode_Uod(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd1 = Decode_Uod<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd1 == nullptr)
     return false;
   rInsn.AddOperand(spOprd1);
 
+  // operand2: move_decode_offset(next_operand)
+  Offset += (rInsn.GetSize() - LastLen);
   // operand2: op2 = decode_Ib
-  auto spOprd2 = Decode_Ib(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd2 = Decode_Ib<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd2 == nullptr)
     return false;
   rInsn.AddOperand(spOprd2);
@@ -3175,16 +3432,17 @@ bool X86Architecture::Operand__Vo_Uod_Ib(BinaryStream const& rBinStrm, OffsetTyp
 }
 
 /* operand ['op0 = decode_Vo', 'op1 = decode_Uoq'] */
-bool X86Architecture::Operand__Vo_Uoq(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Operand__Vo_Uoq(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: op0 = decode_Vo
-  auto spOprd0 = Decode_Vo(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd0 = Decode_Vo<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd0 == nullptr)
     return false;
   rInsn.AddOperand(spOprd0);
 
   // operand1: op1 = decode_Uoq
-  auto spOprd1 = Decode_Uoq(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd1 = Decode_Uoq<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd1 == nullptr)
     return false;
   rInsn.AddOperand(spOprd1);
@@ -3193,16 +3451,17 @@ bool X86Architecture::Operand__Vo_Uoq(BinaryStream const& rBinStrm, OffsetType O
 }
 
 /* operand ['op0 = decode_Vo', 'op1 = decode_Wo'] */
-bool X86Architecture::Operand__Vo_Wo(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Operand__Vo_Wo(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: op0 = decode_Vo
-  auto spOprd0 = Decode_Vo(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd0 = Decode_Vo<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd0 == nullptr)
     return false;
   rInsn.AddOperand(spOprd0);
 
   // operand1: op1 = decode_Wo
-  auto spOprd1 = Decode_Wo(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd1 = Decode_Wo<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd1 == nullptr)
     return false;
   rInsn.AddOperand(spOprd1);
@@ -3210,23 +3469,28 @@ bool X86Architecture::Operand__Vo_Wo(BinaryStream const& rBinStrm, OffsetType Of
   return true;
 }
 
-/* operand ['op0 = decode_Vo', 'op1 = decode_Wo', 'op2 = decode_Ib'] */
-bool X86Architecture::Operand__Vo_Wo_Ib(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+/* operand ['last_len', 'op0 = decode_Vo', 'op1 = decode_Wo', 'move_decode_offset(next_operand)', 'op2 = decode_Ib'] */
+template<u8 Mode>
+bool X86Architecture::Operand__Vo_Wo_Ib(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
+  // operand0: last_len
+  auto LastLen = rInsn.GetSize();
   // operand0: op0 = decode_Vo
-  auto spOprd0 = Decode_Vo(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd0 = Decode_Vo<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd0 == nullptr)
     return false;
   rInsn.AddOperand(spOprd0);
 
   // operand1: op1 = decode_Wo
-  auto spOprd1 = Decode_Wo(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd1 = Decode_Wo<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd1 == nullptr)
     return false;
   rInsn.AddOperand(spOprd1);
 
+  // operand2: move_decode_offset(next_operand)
+  Offset += (rInsn.GetSize() - LastLen);
   // operand2: op2 = decode_Ib
-  auto spOprd2 = Decode_Ib(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd2 = Decode_Ib<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd2 == nullptr)
     return false;
   rInsn.AddOperand(spOprd2);
@@ -3235,16 +3499,17 @@ bool X86Architecture::Operand__Vo_Wo_Ib(BinaryStream const& rBinStrm, OffsetType
 }
 
 /* operand ['op0 = decode_Vo', 'op1 = decode_Wod'] */
-bool X86Architecture::Operand__Vo_Wod(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Operand__Vo_Wod(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: op0 = decode_Vo
-  auto spOprd0 = Decode_Vo(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd0 = Decode_Vo<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd0 == nullptr)
     return false;
   rInsn.AddOperand(spOprd0);
 
   // operand1: op1 = decode_Wod
-  auto spOprd1 = Decode_Wod(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd1 = Decode_Wod<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd1 == nullptr)
     return false;
   rInsn.AddOperand(spOprd1);
@@ -3253,16 +3518,17 @@ bool X86Architecture::Operand__Vo_Wod(BinaryStream const& rBinStrm, OffsetType O
 }
 
 /* operand ['op0 = decode_Vo', 'op1 = decode_Woq'] */
-bool X86Architecture::Operand__Vo_Woq(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Operand__Vo_Woq(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: op0 = decode_Vo
-  auto spOprd0 = Decode_Vo(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd0 = Decode_Vo<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd0 == nullptr)
     return false;
   rInsn.AddOperand(spOprd0);
 
   // operand1: op1 = decode_Woq
-  auto spOprd1 = Decode_Woq(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd1 = Decode_Woq<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd1 == nullptr)
     return false;
   rInsn.AddOperand(spOprd1);
@@ -3270,23 +3536,28 @@ bool X86Architecture::Operand__Vo_Woq(BinaryStream const& rBinStrm, OffsetType O
   return true;
 }
 
-/* operand ['op0 = decode_Vo', 'op1 = decode_Woq', 'op2 = decode_Ib'] */
-bool X86Architecture::Operand__Vo_Woq_Ib(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+/* operand ['last_len', 'op0 = decode_Vo', 'op1 = decode_Woq', 'move_decode_offset(next_operand)', 'op2 = decode_Ib'] */
+template<u8 Mode>
+bool X86Architecture::Operand__Vo_Woq_Ib(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
+  // operand0: last_len
+  auto LastLen = rInsn.GetSize();
   // operand0: op0 = decode_Vo
-  auto spOprd0 = Decode_Vo(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd0 = Decode_Vo<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd0 == nullptr)
     return false;
   rInsn.AddOperand(spOprd0);
 
   // operand1: op1 = decode_Woq
-  auto spOprd1 = Decode_Woq(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd1 = Decode_Woq<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd1 == nullptr)
     return false;
   rInsn.AddOperand(spOprd1);
 
+  // operand2: move_decode_offset(next_operand)
+  Offset += (rInsn.GetSize() - LastLen);
   // operand2: op2 = decode_Ib
-  auto spOprd2 = Decode_Ib(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd2 = Decode_Ib<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd2 == nullptr)
     return false;
   rInsn.AddOperand(spOprd2);
@@ -3295,16 +3566,17 @@ bool X86Architecture::Operand__Vo_Woq_Ib(BinaryStream const& rBinStrm, OffsetTyp
 }
 
 /* operand ['op0 = decode_Vo', 'op1 = decode_Wow'] */
-bool X86Architecture::Operand__Vo_Wow(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Operand__Vo_Wow(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: op0 = decode_Vo
-  auto spOprd0 = Decode_Vo(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd0 = Decode_Vo<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd0 == nullptr)
     return false;
   rInsn.AddOperand(spOprd0);
 
   // operand1: op1 = decode_Wow
-  auto spOprd1 = Decode_Wow(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd1 = Decode_Wow<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd1 == nullptr)
     return false;
   rInsn.AddOperand(spOprd1);
@@ -3313,16 +3585,17 @@ bool X86Architecture::Operand__Vo_Wow(BinaryStream const& rBinStrm, OffsetType O
 }
 
 /* operand ['op0 = decode_Vo', 'op1 = decode_Wx'] */
-bool X86Architecture::Operand__Vo_Wx(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Operand__Vo_Wx(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: op0 = decode_Vo
-  auto spOprd0 = Decode_Vo(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd0 = Decode_Vo<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd0 == nullptr)
     return false;
   rInsn.AddOperand(spOprd0);
 
   // operand1: op1 = decode_Wx
-  auto spOprd1 = Decode_Wx(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd1 = Decode_Wx<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd1 == nullptr)
     return false;
   rInsn.AddOperand(spOprd1);
@@ -3331,22 +3604,23 @@ bool X86Architecture::Operand__Vo_Wx(BinaryStream const& rBinStrm, OffsetType Of
 }
 
 /* operand ['op0 = decode_Vx', 'op1 = decode_Hx', 'op2 = decode_Mx'] */
-bool X86Architecture::Operand__Vx_Hx_Mx(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Operand__Vx_Hx_Mx(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: op0 = decode_Vx
-  auto spOprd0 = Decode_Vx(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd0 = Decode_Vx<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd0 == nullptr)
     return false;
   rInsn.AddOperand(spOprd0);
 
   // operand1: op1 = decode_Hx
-  auto spOprd1 = Decode_Hx(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd1 = Decode_Hx<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd1 == nullptr)
     return false;
   rInsn.AddOperand(spOprd1);
 
   // operand2: op2 = decode_Mx
-  auto spOprd2 = Decode_Mx(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd2 = Decode_Mx<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd2 == nullptr)
     return false;
   rInsn.AddOperand(spOprd2);
@@ -3355,22 +3629,23 @@ bool X86Architecture::Operand__Vx_Hx_Mx(BinaryStream const& rBinStrm, OffsetType
 }
 
 /* operand ['op0 = decode_Vx', 'op1 = decode_Hx', 'op2 = decode_Wx'] */
-bool X86Architecture::Operand__Vx_Hx_Wx(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Operand__Vx_Hx_Wx(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: op0 = decode_Vx
-  auto spOprd0 = Decode_Vx(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd0 = Decode_Vx<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd0 == nullptr)
     return false;
   rInsn.AddOperand(spOprd0);
 
   // operand1: op1 = decode_Hx
-  auto spOprd1 = Decode_Hx(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd1 = Decode_Hx<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd1 == nullptr)
     return false;
   rInsn.AddOperand(spOprd1);
 
   // operand2: op2 = decode_Wx
-  auto spOprd2 = Decode_Wx(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd2 = Decode_Wx<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd2 == nullptr)
     return false;
   rInsn.AddOperand(spOprd2);
@@ -3379,24 +3654,25 @@ bool X86Architecture::Operand__Vx_Hx_Wx(BinaryStream const& rBinStrm, OffsetType
 }
 
 /* operand ['last_len', 'op0 = decode_Vx', 'op1 = decode_Hx', 'op2 = decode_Wx', 'move_decode_offset(next_operand)', 'op3 = decode_Ib'] */
-bool X86Architecture::Operand__Vx_Hx_Wx_Ib(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Operand__Vx_Hx_Wx_Ib(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: last_len
   auto LastLen = rInsn.GetSize();
   // operand0: op0 = decode_Vx
-  auto spOprd0 = Decode_Vx(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd0 = Decode_Vx<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd0 == nullptr)
     return false;
   rInsn.AddOperand(spOprd0);
 
   // operand1: op1 = decode_Hx
-  auto spOprd1 = Decode_Hx(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd1 = Decode_Hx<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd1 == nullptr)
     return false;
   rInsn.AddOperand(spOprd1);
 
   // operand2: op2 = decode_Wx
-  auto spOprd2 = Decode_Wx(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd2 = Decode_Wx<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd2 == nullptr)
     return false;
   rInsn.AddOperand(spOprd2);
@@ -3404,7 +3680,7 @@ bool X86Architecture::Operand__Vx_Hx_Wx_Ib(BinaryStream const& rBinStrm, OffsetT
   // operand3: move_decode_offset(next_operand)
   Offset += (rInsn.GetSize() - LastLen);
   // operand3: op3 = decode_Ib
-  auto spOprd3 = Decode_Ib(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd3 = Decode_Ib<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd3 == nullptr)
     return false;
   rInsn.AddOperand(spOprd3);
@@ -3413,28 +3689,29 @@ bool X86Architecture::Operand__Vx_Hx_Wx_Ib(BinaryStream const& rBinStrm, OffsetT
 }
 
 /* operand ['op0 = decode_Vx', 'op1 = decode_Hx', 'op2 = decode_Wx', 'op3 = decode_Lx'] */
-bool X86Architecture::Operand__Vx_Hx_Wx_Lx(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Operand__Vx_Hx_Wx_Lx(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: op0 = decode_Vx
-  auto spOprd0 = Decode_Vx(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd0 = Decode_Vx<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd0 == nullptr)
     return false;
   rInsn.AddOperand(spOprd0);
 
   // operand1: op1 = decode_Hx
-  auto spOprd1 = Decode_Hx(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd1 = Decode_Hx<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd1 == nullptr)
     return false;
   rInsn.AddOperand(spOprd1);
 
   // operand2: op2 = decode_Wx
-  auto spOprd2 = Decode_Wx(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd2 = Decode_Wx<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd2 == nullptr)
     return false;
   rInsn.AddOperand(spOprd2);
 
   // operand3: op3 = decode_Lx
-  auto spOprd3 = Decode_Lx(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd3 = Decode_Lx<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd3 == nullptr)
     return false;
   rInsn.AddOperand(spOprd3);
@@ -3443,28 +3720,29 @@ bool X86Architecture::Operand__Vx_Hx_Wx_Lx(BinaryStream const& rBinStrm, OffsetT
 }
 
 /* operand ['op0 = decode_Vx', 'op1 = decode_Md', 'op2 = decode_x', 'op3 = decode_Hx'] */
-bool X86Architecture::Operand__Vx_Md_x_Hx(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Operand__Vx_Md_x_Hx(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: op0 = decode_Vx
-  auto spOprd0 = Decode_Vx(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd0 = Decode_Vx<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd0 == nullptr)
     return false;
   rInsn.AddOperand(spOprd0);
 
   // operand1: op1 = decode_Md
-  auto spOprd1 = Decode_Md(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd1 = Decode_Md<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd1 == nullptr)
     return false;
   rInsn.AddOperand(spOprd1);
 
   // operand2: op2 = decode_x
-  auto spOprd2 = Decode_x(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd2 = Decode_x<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd2 == nullptr)
     return false;
   rInsn.AddOperand(spOprd2);
 
   // operand3: op3 = decode_Hx
-  auto spOprd3 = Decode_Hx(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd3 = Decode_Hx<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd3 == nullptr)
     return false;
   rInsn.AddOperand(spOprd3);
@@ -3473,28 +3751,29 @@ bool X86Architecture::Operand__Vx_Md_x_Hx(BinaryStream const& rBinStrm, OffsetTy
 }
 
 /* operand ['op0 = decode_Vx', 'op1 = decode_Mq', 'op2 = decode_x', 'op3 = decode_Hx'] */
-bool X86Architecture::Operand__Vx_Mq_x_Hx(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Operand__Vx_Mq_x_Hx(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: op0 = decode_Vx
-  auto spOprd0 = Decode_Vx(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd0 = Decode_Vx<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd0 == nullptr)
     return false;
   rInsn.AddOperand(spOprd0);
 
   // operand1: op1 = decode_Mq
-  auto spOprd1 = Decode_Mq(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd1 = Decode_Mq<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd1 == nullptr)
     return false;
   rInsn.AddOperand(spOprd1);
 
   // operand2: op2 = decode_x
-  auto spOprd2 = Decode_x(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd2 = Decode_x<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd2 == nullptr)
     return false;
   rInsn.AddOperand(spOprd2);
 
   // operand3: op3 = decode_Hx
-  auto spOprd3 = Decode_Hx(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd3 = Decode_Hx<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd3 == nullptr)
     return false;
   rInsn.AddOperand(spOprd3);
@@ -3503,22 +3782,23 @@ bool X86Architecture::Operand__Vx_Mq_x_Hx(BinaryStream const& rBinStrm, OffsetTy
 }
 
 /* operand ['op0 = decode_Vx', 'op1 = decode_Mqo', 'op2 = decode_Hx'] */
-bool X86Architecture::Operand__Vx_Mqo_Hx(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Operand__Vx_Mqo_Hx(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: op0 = decode_Vx
-  auto spOprd0 = Decode_Vx(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd0 = Decode_Vx<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd0 == nullptr)
     return false;
   rInsn.AddOperand(spOprd0);
 
   // operand1: op1 = decode_Mqo
-  auto spOprd1 = Decode_Mqo(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd1 = Decode_Mqo<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd1 == nullptr)
     return false;
   rInsn.AddOperand(spOprd1);
 
   // operand2: op2 = decode_Hx
-  auto spOprd2 = Decode_Hx(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd2 = Decode_Hx<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd2 == nullptr)
     return false;
   rInsn.AddOperand(spOprd2);
@@ -3527,16 +3807,17 @@ bool X86Architecture::Operand__Vx_Mqo_Hx(BinaryStream const& rBinStrm, OffsetTyp
 }
 
 /* operand ['op0 = decode_Vx', 'op1 = decode_Mx'] */
-bool X86Architecture::Operand__Vx_Mx(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Operand__Vx_Mx(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: op0 = decode_Vx
-  auto spOprd0 = Decode_Vx(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd0 = Decode_Vx<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd0 == nullptr)
     return false;
   rInsn.AddOperand(spOprd0);
 
   // operand1: op1 = decode_Mx
-  auto spOprd1 = Decode_Mx(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd1 = Decode_Mx<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd1 == nullptr)
     return false;
   rInsn.AddOperand(spOprd1);
@@ -3545,16 +3826,17 @@ bool X86Architecture::Operand__Vx_Mx(BinaryStream const& rBinStrm, OffsetType Of
 }
 
 /* operand ['op0 = decode_Vx', 'op1 = decode_Uo'] */
-bool X86Architecture::Operand__Vx_Uo(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Operand__Vx_Uo(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: op0 = decode_Vx
-  auto spOprd0 = Decode_Vx(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd0 = Decode_Vx<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd0 == nullptr)
     return false;
   rInsn.AddOperand(spOprd0);
 
   // operand1: op1 = decode_Uo
-  auto spOprd1 = Decode_Uo(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd1 = Decode_Uo<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd1 == nullptr)
     return false;
   rInsn.AddOperand(spOprd1);
@@ -3563,22 +3845,23 @@ bool X86Architecture::Operand__Vx_Uo(BinaryStream const& rBinStrm, OffsetType Of
 }
 
 /* operand ['op0 = decode_Vx', 'op1 = decode_Uo', 'op2 = decode_b'] */
-bool X86Architecture::Operand__Vx_Uo_b(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Operand__Vx_Uo_b(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: op0 = decode_Vx
-  auto spOprd0 = Decode_Vx(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd0 = Decode_Vx<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd0 == nullptr)
     return false;
   rInsn.AddOperand(spOprd0);
 
   // operand1: op1 = decode_Uo
-  auto spOprd1 = Decode_Uo(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd1 = Decode_Uo<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd1 == nullptr)
     return false;
   rInsn.AddOperand(spOprd1);
 
   // operand2: op2 = decode_b
-  auto spOprd2 = Decode_b(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd2 = Decode_b<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd2 == nullptr)
     return false;
   rInsn.AddOperand(spOprd2);
@@ -3587,22 +3870,23 @@ bool X86Architecture::Operand__Vx_Uo_b(BinaryStream const& rBinStrm, OffsetType
 }
 
 /* operand ['op0 = decode_Vx', 'op1 = decode_Uo', 'op2 = decode_w'] */
-bool X86Architecture::Operand__Vx_Uo_w(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Operand__Vx_Uo_w(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: op0 = decode_Vx
-  auto spOprd0 = Decode_Vx(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd0 = Decode_Vx<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd0 == nullptr)
     return false;
   rInsn.AddOperand(spOprd0);
 
   // operand1: op1 = decode_Uo
-  auto spOprd1 = Decode_Uo(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd1 = Decode_Uo<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd1 == nullptr)
     return false;
   rInsn.AddOperand(spOprd1);
 
   // operand2: op2 = decode_w
-  auto spOprd2 = Decode_w(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd2 = Decode_w<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd2 == nullptr)
     return false;
   rInsn.AddOperand(spOprd2);
@@ -3611,16 +3895,17 @@ bool X86Architecture::Operand__Vx_Uo_w(BinaryStream const& rBinStrm, OffsetType
 }
 
 /* operand ['op0 = decode_Vx', 'op1 = decode_Uod'] */
-bool X86Architecture::Operand__Vx_Uod(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Operand__Vx_Uod(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: op0 = decode_Vx
-  auto spOprd0 = Decode_Vx(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd0 = Decode_Vx<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd0 == nullptr)
     return false;
   rInsn.AddOperand(spOprd0);
 
   // operand1: op1 = decode_Uod
-  auto spOprd1 = Decode_Uod(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd1 = Decode_Uod<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd1 == nullptr)
     return false;
   rInsn.AddOperand(spOprd1);
@@ -3629,16 +3914,17 @@ bool X86Architecture::Operand__Vx_Uod(BinaryStream const& rBinStrm, OffsetType O
 }
 
 /* operand ['op0 = decode_Vx', 'op1 = decode_Uoq'] */
-bool X86Architecture::Operand__Vx_Uoq(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Operand__Vx_Uoq(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: op0 = decode_Vx
-  auto spOprd0 = Decode_Vx(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd0 = Decode_Vx<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd0 == nullptr)
     return false;
   rInsn.AddOperand(spOprd0);
 
   // operand1: op1 = decode_Uoq
-  auto spOprd1 = Decode_Uoq(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd1 = Decode_Uoq<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd1 == nullptr)
     return false;
   rInsn.AddOperand(spOprd1);
@@ -3647,16 +3933,17 @@ bool X86Architecture::Operand__Vx_Uoq(BinaryStream const& rBinStrm, OffsetType O
 }
 
 /* operand ['op0 = decode_Vx', 'op1 = decode_Woq'] */
-bool X86Architecture::Operand__Vx_Woq(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Operand__Vx_Woq(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: op0 = decode_Vx
-  auto spOprd0 = Decode_Vx(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd0 = Decode_Vx<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd0 == nullptr)
     return false;
   rInsn.AddOperand(spOprd0);
 
   // operand1: op1 = decode_Woq
-  auto spOprd1 = Decode_Woq(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd1 = Decode_Woq<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd1 == nullptr)
     return false;
   rInsn.AddOperand(spOprd1);
@@ -3665,16 +3952,17 @@ bool X86Architecture::Operand__Vx_Woq(BinaryStream const& rBinStrm, OffsetType O
 }
 
 /* operand ['op0 = decode_Vx', 'op1 = decode_Wx'] */
-bool X86Architecture::Operand__Vx_Wx(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Operand__Vx_Wx(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: op0 = decode_Vx
-  auto spOprd0 = Decode_Vx(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd0 = Decode_Vx<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd0 == nullptr)
     return false;
   rInsn.AddOperand(spOprd0);
 
   // operand1: op1 = decode_Wx
-  auto spOprd1 = Decode_Wx(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd1 = Decode_Wx<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd1 == nullptr)
     return false;
   rInsn.AddOperand(spOprd1);
@@ -3683,18 +3971,19 @@ bool X86Architecture::Operand__Vx_Wx(BinaryStream const& rBinStrm, OffsetType Of
 }
 
 /* operand ['last_len', 'op0 = decode_Vx', 'op1 = decode_Wx', 'move_decode_offset(next_operand)', 'op2 = decode_Ib'] */
-bool X86Architecture::Operand__Vx_Wx_Ib(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Operand__Vx_Wx_Ib(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: last_len
   auto LastLen = rInsn.GetSize();
   // operand0: op0 = decode_Vx
-  auto spOprd0 = Decode_Vx(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd0 = Decode_Vx<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd0 == nullptr)
     return false;
   rInsn.AddOperand(spOprd0);
 
   // operand1: op1 = decode_Wx
-  auto spOprd1 = Decode_Wx(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd1 = Decode_Wx<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd1 == nullptr)
     return false;
   rInsn.AddOperand(spOprd1);
@@ -3702,7 +3991,7 @@ bool X86Architecture::Operand__Vx_Wx_Ib(BinaryStream const& rBinStrm, OffsetType
   // operand2: move_decode_offset(next_operand)
   Offset += (rInsn.GetSize() - LastLen);
   // operand2: op2 = decode_Ib
-  auto spOprd2 = Decode_Ib(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd2 = Decode_Ib<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd2 == nullptr)
     return false;
   rInsn.AddOperand(spOprd2);
@@ -3711,24 +4000,25 @@ bool X86Architecture::Operand__Vx_Wx_Ib(BinaryStream const& rBinStrm, OffsetType
 }
 
 /* operand ['last_len', 'op0 = decode_Vy', 'op1 = decode_Hy', 'op2 = decode_Wo', 'move_decode_offset(next_operand)', 'op3 = decode_Ib'] */
-bool X86Architecture::Operand__Vy_Hy_Wo_Ib(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Operand__Vy_Hy_Wo_Ib(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: last_len
   auto LastLen = rInsn.GetSize();
   // operand0: op0 = decode_Vy
-  auto spOprd0 = Decode_Vy(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd0 = Decode_Vy<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd0 == nullptr)
     return false;
   rInsn.AddOperand(spOprd0);
 
   // operand1: op1 = decode_Hy
-  auto spOprd1 = Decode_Hy(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd1 = Decode_Hy<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd1 == nullptr)
     return false;
   rInsn.AddOperand(spOprd1);
 
   // operand2: op2 = decode_Wo
-  auto spOprd2 = Decode_Wo(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd2 = Decode_Wo<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd2 == nullptr)
     return false;
   rInsn.AddOperand(spOprd2);
@@ -3736,7 +4026,7 @@ bool X86Architecture::Operand__Vy_Hy_Wo_Ib(BinaryStream const& rBinStrm, OffsetT
   // operand3: move_decode_offset(next_operand)
   Offset += (rInsn.GetSize() - LastLen);
   // operand3: op3 = decode_Ib
-  auto spOprd3 = Decode_Ib(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd3 = Decode_Ib<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd3 == nullptr)
     return false;
   rInsn.AddOperand(spOprd3);
@@ -3745,22 +4035,23 @@ bool X86Architecture::Operand__Vy_Hy_Wo_Ib(BinaryStream const& rBinStrm, OffsetT
 }
 
 /* operand ['op0 = decode_Vy', 'op1 = decode_Hy', 'op2 = decode_Wy'] */
-bool X86Architecture::Operand__Vy_Hy_Wy(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Operand__Vy_Hy_Wy(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: op0 = decode_Vy
-  auto spOprd0 = Decode_Vy(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd0 = Decode_Vy<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd0 == nullptr)
     return false;
   rInsn.AddOperand(spOprd0);
 
   // operand1: op1 = decode_Hy
-  auto spOprd1 = Decode_Hy(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd1 = Decode_Hy<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd1 == nullptr)
     return false;
   rInsn.AddOperand(spOprd1);
 
   // operand2: op2 = decode_Wy
-  auto spOprd2 = Decode_Wy(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd2 = Decode_Wy<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd2 == nullptr)
     return false;
   rInsn.AddOperand(spOprd2);
@@ -3769,24 +4060,25 @@ bool X86Architecture::Operand__Vy_Hy_Wy(BinaryStream const& rBinStrm, OffsetType
 }
 
 /* operand ['last_len', 'op0 = decode_Vy', 'op1 = decode_Hy', 'op2 = decode_Wy', 'move_decode_offset(next_operand)', 'op3 = decode_Ib'] */
-bool X86Architecture::Operand__Vy_Hy_Wy_Ib(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Operand__Vy_Hy_Wy_Ib(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: last_len
   auto LastLen = rInsn.GetSize();
   // operand0: op0 = decode_Vy
-  auto spOprd0 = Decode_Vy(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd0 = Decode_Vy<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd0 == nullptr)
     return false;
   rInsn.AddOperand(spOprd0);
 
   // operand1: op1 = decode_Hy
-  auto spOprd1 = Decode_Hy(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd1 = Decode_Hy<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd1 == nullptr)
     return false;
   rInsn.AddOperand(spOprd1);
 
   // operand2: op2 = decode_Wy
-  auto spOprd2 = Decode_Wy(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd2 = Decode_Wy<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd2 == nullptr)
     return false;
   rInsn.AddOperand(spOprd2);
@@ -3794,7 +4086,7 @@ bool X86Architecture::Operand__Vy_Hy_Wy_Ib(BinaryStream const& rBinStrm, OffsetT
   // operand3: move_decode_offset(next_operand)
   Offset += (rInsn.GetSize() - LastLen);
   // operand3: op3 = decode_Ib
-  auto spOprd3 = Decode_Ib(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd3 = Decode_Ib<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd3 == nullptr)
     return false;
   rInsn.AddOperand(spOprd3);
@@ -3803,16 +4095,17 @@ bool X86Architecture::Operand__Vy_Hy_Wy_Ib(BinaryStream const& rBinStrm, OffsetT
 }
 
 /* operand ['op0 = decode_Vy', 'op1 = decode_Uo'] */
-bool X86Architecture::Operand__Vy_Uo(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Operand__Vy_Uo(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: op0 = decode_Vy
-  auto spOprd0 = Decode_Vy(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd0 = Decode_Vy<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd0 == nullptr)
     return false;
   rInsn.AddOperand(spOprd0);
 
   // operand1: op1 = decode_Uo
-  auto spOprd1 = Decode_Uo(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd1 = Decode_Uo<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd1 == nullptr)
     return false;
   rInsn.AddOperand(spOprd1);
@@ -3821,16 +4114,17 @@ bool X86Architecture::Operand__Vy_Uo(BinaryStream const& rBinStrm, OffsetType Of
 }
 
 /* operand ['op0 = decode_Vy', 'op1 = decode_Uoq'] */
-bool X86Architecture::Operand__Vy_Uoq(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Operand__Vy_Uoq(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: op0 = decode_Vy
-  auto spOprd0 = Decode_Vy(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd0 = Decode_Vy<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd0 == nullptr)
     return false;
   rInsn.AddOperand(spOprd0);
 
   // operand1: op1 = decode_Uoq
-  auto spOprd1 = Decode_Uoq(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd1 = Decode_Uoq<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd1 == nullptr)
     return false;
   rInsn.AddOperand(spOprd1);
@@ -3839,16 +4133,17 @@ bool X86Architecture::Operand__Vy_Uoq(BinaryStream const& rBinStrm, OffsetType O
 }
 
 /* operand ['op0 = decode_Vy', 'op1 = decode_Wod'] */
-bool X86Architecture::Operand__Vy_Wod(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Operand__Vy_Wod(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: op0 = decode_Vy
-  auto spOprd0 = Decode_Vy(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd0 = Decode_Vy<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd0 == nullptr)
     return false;
   rInsn.AddOperand(spOprd0);
 
   // operand1: op1 = decode_Wod
-  auto spOprd1 = Decode_Wod(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd1 = Decode_Wod<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd1 == nullptr)
     return false;
   rInsn.AddOperand(spOprd1);
@@ -3857,16 +4152,17 @@ bool X86Architecture::Operand__Vy_Wod(BinaryStream const& rBinStrm, OffsetType O
 }
 
 /* operand ['op0 = decode_Vy', 'op1 = decode_Woo'] */
-bool X86Architecture::Operand__Vy_Woo(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Operand__Vy_Woo(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: op0 = decode_Vy
-  auto spOprd0 = Decode_Vy(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd0 = Decode_Vy<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd0 == nullptr)
     return false;
   rInsn.AddOperand(spOprd0);
 
   // operand1: op1 = decode_Woo
-  auto spOprd1 = Decode_Woo(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd1 = Decode_Woo<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd1 == nullptr)
     return false;
   rInsn.AddOperand(spOprd1);
@@ -3875,16 +4171,17 @@ bool X86Architecture::Operand__Vy_Woo(BinaryStream const& rBinStrm, OffsetType O
 }
 
 /* operand ['op0 = decode_Vy', 'op1 = decode_Woq'] */
-bool X86Architecture::Operand__Vy_Woq(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Operand__Vy_Woq(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: op0 = decode_Vy
-  auto spOprd0 = Decode_Vy(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd0 = Decode_Vy<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd0 == nullptr)
     return false;
   rInsn.AddOperand(spOprd0);
 
   // operand1: op1 = decode_Woq
-  auto spOprd1 = Decode_Woq(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd1 = Decode_Woq<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd1 == nullptr)
     return false;
   rInsn.AddOperand(spOprd1);
@@ -3893,18 +4190,19 @@ bool X86Architecture::Operand__Vy_Woq(BinaryStream const& rBinStrm, OffsetType O
 }
 
 /* operand ['last_len', 'op0 = decode_Vy', 'op1 = decode_Wy', 'move_decode_offset(next_operand)', 'op2 = decode_Ib'] */
-bool X86Architecture::Operand__Vy_Wy_Ib(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Operand__Vy_Wy_Ib(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: last_len
   auto LastLen = rInsn.GetSize();
   // operand0: op0 = decode_Vy
-  auto spOprd0 = Decode_Vy(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd0 = Decode_Vy<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd0 == nullptr)
     return false;
   rInsn.AddOperand(spOprd0);
 
   // operand1: op1 = decode_Wy
-  auto spOprd1 = Decode_Wy(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd1 = Decode_Wy<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd1 == nullptr)
     return false;
   rInsn.AddOperand(spOprd1);
@@ -3912,7 +4210,7 @@ bool X86Architecture::Operand__Vy_Wy_Ib(BinaryStream const& rBinStrm, OffsetType
   // operand2: move_decode_offset(next_operand)
   Offset += (rInsn.GetSize() - LastLen);
   // operand2: op2 = decode_Ib
-  auto spOprd2 = Decode_Ib(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd2 = Decode_Ib<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd2 == nullptr)
     return false;
   rInsn.AddOperand(spOprd2);
@@ -3921,18 +4219,19 @@ bool X86Architecture::Operand__Vy_Wy_Ib(BinaryStream const& rBinStrm, OffsetType
 }
 
 /* operand ['last_len', 'op0 = decode_Wo', 'op1 = decode_Vy', 'move_decode_offset(next_operand)', 'op2 = decode_Ib'] */
-bool X86Architecture::Operand__Wo_Vy_Ib(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Operand__Wo_Vy_Ib(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: last_len
   auto LastLen = rInsn.GetSize();
   // operand0: op0 = decode_Wo
-  auto spOprd0 = Decode_Wo(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd0 = Decode_Wo<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd0 == nullptr)
     return false;
   rInsn.AddOperand(spOprd0);
 
   // operand1: op1 = decode_Vy
-  auto spOprd1 = Decode_Vy(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd1 = Decode_Vy<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd1 == nullptr)
     return false;
   rInsn.AddOperand(spOprd1);
@@ -3940,7 +4239,7 @@ bool X86Architecture::Operand__Wo_Vy_Ib(BinaryStream const& rBinStrm, OffsetType
   // operand2: move_decode_offset(next_operand)
   Offset += (rInsn.GetSize() - LastLen);
   // operand2: op2 = decode_Ib
-  auto spOprd2 = Decode_Ib(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd2 = Decode_Ib<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd2 == nullptr)
     return false;
   rInsn.AddOperand(spOprd2);
@@ -3949,18 +4248,19 @@ bool X86Architecture::Operand__Wo_Vy_Ib(BinaryStream const& rBinStrm, OffsetType
 }
 
 /* operand ['last_len', 'op0 = decode_Wob', 'op1 = decode_Vo', 'move_decode_offset(next_operand)', 'op2 = decode_Ib'] */
-bool X86Architecture::Operand__Wob_Vo_Ib(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Operand__Wob_Vo_Ib(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: last_len
   auto LastLen = rInsn.GetSize();
   // operand0: op0 = decode_Wob
-  auto spOprd0 = Decode_Wob(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd0 = Decode_Wob<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd0 == nullptr)
     return false;
   rInsn.AddOperand(spOprd0);
 
   // operand1: op1 = decode_Vo
-  auto spOprd1 = Decode_Vo(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd1 = Decode_Vo<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd1 == nullptr)
     return false;
   rInsn.AddOperand(spOprd1);
@@ -3968,7 +4268,7 @@ bool X86Architecture::Operand__Wob_Vo_Ib(BinaryStream const& rBinStrm, OffsetTyp
   // operand2: move_decode_offset(next_operand)
   Offset += (rInsn.GetSize() - LastLen);
   // operand2: op2 = decode_Ib
-  auto spOprd2 = Decode_Ib(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd2 = Decode_Ib<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd2 == nullptr)
     return false;
   rInsn.AddOperand(spOprd2);
@@ -3977,16 +4277,17 @@ bool X86Architecture::Operand__Wob_Vo_Ib(BinaryStream const& rBinStrm, OffsetTyp
 }
 
 /* operand ['op0 = decode_Wod', 'op1 = decode_Vo'] */
-bool X86Architecture::Operand__Wod_Vo(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Operand__Wod_Vo(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: op0 = decode_Wod
-  auto spOprd0 = Decode_Wod(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd0 = Decode_Wod<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd0 == nullptr)
     return false;
   rInsn.AddOperand(spOprd0);
 
   // operand1: op1 = decode_Vo
-  auto spOprd1 = Decode_Vo(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd1 = Decode_Vo<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd1 == nullptr)
     return false;
   rInsn.AddOperand(spOprd1);
@@ -3995,16 +4296,17 @@ bool X86Architecture::Operand__Wod_Vo(BinaryStream const& rBinStrm, OffsetType O
 }
 
 /* operand ['op0 = decode_Woq', 'op1 = decode_Vo'] */
-bool X86Architecture::Operand__Woq_Vo(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Operand__Woq_Vo(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: op0 = decode_Woq
-  auto spOprd0 = Decode_Woq(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd0 = Decode_Woq<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd0 == nullptr)
     return false;
   rInsn.AddOperand(spOprd0);
 
   // operand1: op1 = decode_Vo
-  auto spOprd1 = Decode_Vo(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd1 = Decode_Vo<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd1 == nullptr)
     return false;
   rInsn.AddOperand(spOprd1);
@@ -4013,18 +4315,19 @@ bool X86Architecture::Operand__Woq_Vo(BinaryStream const& rBinStrm, OffsetType O
 }
 
 /* operand ['last_len', 'op0 = decode_Woqo', 'op1 = decode_Vx', 'move_decode_offset(next_operand)', 'op2 = decode_Ib'] */
-bool X86Architecture::Operand__Woqo_Vx_Ib(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Operand__Woqo_Vx_Ib(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: last_len
   auto LastLen = rInsn.GetSize();
   // operand0: op0 = decode_Woqo
-  auto spOprd0 = Decode_Woqo(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd0 = Decode_Woqo<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd0 == nullptr)
     return false;
   rInsn.AddOperand(spOprd0);
 
   // operand1: op1 = decode_Vx
-  auto spOprd1 = Decode_Vx(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd1 = Decode_Vx<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd1 == nullptr)
     return false;
   rInsn.AddOperand(spOprd1);
@@ -4032,7 +4335,7 @@ bool X86Architecture::Operand__Woqo_Vx_Ib(BinaryStream const& rBinStrm, OffsetTy
   // operand2: move_decode_offset(next_operand)
   Offset += (rInsn.GetSize() - LastLen);
   // operand2: op2 = decode_Ib
-  auto spOprd2 = Decode_Ib(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd2 = Decode_Ib<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd2 == nullptr)
     return false;
   rInsn.AddOperand(spOprd2);
@@ -4041,18 +4344,19 @@ bool X86Architecture::Operand__Woqo_Vx_Ib(BinaryStream const& rBinStrm, OffsetTy
 }
 
 /* operand ['last_len', 'op0 = decode_Wow', 'op1 = decode_Vo', 'move_decode_offset(next_operand)', 'op2 = decode_Ib'] */
-bool X86Architecture::Operand__Wow_Vo_Ib(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Operand__Wow_Vo_Ib(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: last_len
   auto LastLen = rInsn.GetSize();
   // operand0: op0 = decode_Wow
-  auto spOprd0 = Decode_Wow(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd0 = Decode_Wow<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd0 == nullptr)
     return false;
   rInsn.AddOperand(spOprd0);
 
   // operand1: op1 = decode_Vo
-  auto spOprd1 = Decode_Vo(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd1 = Decode_Vo<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd1 == nullptr)
     return false;
   rInsn.AddOperand(spOprd1);
@@ -4060,7 +4364,7 @@ bool X86Architecture::Operand__Wow_Vo_Ib(BinaryStream const& rBinStrm, OffsetTyp
   // operand2: move_decode_offset(next_operand)
   Offset += (rInsn.GetSize() - LastLen);
   // operand2: op2 = decode_Ib
-  auto spOprd2 = Decode_Ib(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd2 = Decode_Ib<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd2 == nullptr)
     return false;
   rInsn.AddOperand(spOprd2);
@@ -4069,16 +4373,17 @@ bool X86Architecture::Operand__Wow_Vo_Ib(BinaryStream const& rBinStrm, OffsetTyp
 }
 
 /* operand ['op0 = decode_Wx', 'op1 = decode_Vx'] */
-bool X86Architecture::Operand__Wx_Vx(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Operand__Wx_Vx(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: op0 = decode_Wx
-  auto spOprd0 = Decode_Wx(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd0 = Decode_Wx<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd0 == nullptr)
     return false;
   rInsn.AddOperand(spOprd0);
 
   // operand1: op1 = decode_Vx
-  auto spOprd1 = Decode_Vx(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd1 = Decode_Vx<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd1 == nullptr)
     return false;
   rInsn.AddOperand(spOprd1);
@@ -4087,16 +4392,17 @@ bool X86Architecture::Operand__Wx_Vx(BinaryStream const& rBinStrm, OffsetType Of
 }
 
 /* operand ['op0 = decode_Xb', 'op1 = decode_Yb'] */
-bool X86Architecture::Operand__Xb_Yb(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Operand__Xb_Yb(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: op0 = decode_Xb
-  auto spOprd0 = Decode_Xb(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd0 = Decode_Xb<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd0 == nullptr)
     return false;
   rInsn.AddOperand(spOprd0);
 
   // operand1: op1 = decode_Yb
-  auto spOprd1 = Decode_Yb(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd1 = Decode_Yb<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd1 == nullptr)
     return false;
   rInsn.AddOperand(spOprd1);
@@ -4105,16 +4411,17 @@ bool X86Architecture::Operand__Xb_Yb(BinaryStream const& rBinStrm, OffsetType Of
 }
 
 /* operand ['op0 = decode_Xv', 'op1 = decode_Yv'] */
-bool X86Architecture::Operand__Xv_Yv(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Operand__Xv_Yv(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: op0 = decode_Xv
-  auto spOprd0 = Decode_Xv(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd0 = Decode_Xv<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd0 == nullptr)
     return false;
   rInsn.AddOperand(spOprd0);
 
   // operand1: op1 = decode_Yv
-  auto spOprd1 = Decode_Yv(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd1 = Decode_Yv<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd1 == nullptr)
     return false;
   rInsn.AddOperand(spOprd1);
@@ -4123,16 +4430,17 @@ bool X86Architecture::Operand__Xv_Yv(BinaryStream const& rBinStrm, OffsetType Of
 }
 
 /* operand ['op0 = decode_Yb', 'op1 = decode_DX'] */
-bool X86Architecture::Operand__Yb_DX(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Operand__Yb_DX(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: op0 = decode_Yb
-  auto spOprd0 = Decode_Yb(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd0 = Decode_Yb<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd0 == nullptr)
     return false;
   rInsn.AddOperand(spOprd0);
 
   // operand1: op1 = decode_DX
-  auto spOprd1 = Decode_DX(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd1 = Decode_DX<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd1 == nullptr)
     return false;
   rInsn.AddOperand(spOprd1);
@@ -4141,16 +4449,17 @@ bool X86Architecture::Operand__Yb_DX(BinaryStream const& rBinStrm, OffsetType Of
 }
 
 /* operand ['op0 = decode_Yz', 'op1 = decode_DX'] */
-bool X86Architecture::Operand__Yz_DX(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Operand__Yz_DX(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: op0 = decode_Yz
-  auto spOprd0 = Decode_Yz(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd0 = Decode_Yz<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd0 == nullptr)
     return false;
   rInsn.AddOperand(spOprd0);
 
   // operand1: op1 = decode_DX
-  auto spOprd1 = Decode_DX(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd1 = Decode_DX<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd1 == nullptr)
     return false;
   rInsn.AddOperand(spOprd1);
@@ -4159,10 +4468,11 @@ bool X86Architecture::Operand__Yz_DX(BinaryStream const& rBinStrm, OffsetType Of
 }
 
 /* operand ['op0 = decode_d64_r10'] */
-bool X86Architecture::Operand__d64_r10(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Operand__d64_r10(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: op0 = decode_d64_r10
-  auto spOprd0 = Decode_d64_r10(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd0 = Decode_d64_r10<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd0 == nullptr)
     return false;
   rInsn.AddOperand(spOprd0);
@@ -4171,10 +4481,11 @@ bool X86Architecture::Operand__d64_r10(BinaryStream const& rBinStrm, OffsetType
 }
 
 /* operand ['op0 = decode_d64_r11'] */
-bool X86Architecture::Operand__d64_r11(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Operand__d64_r11(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: op0 = decode_d64_r11
-  auto spOprd0 = Decode_d64_r11(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd0 = Decode_d64_r11<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd0 == nullptr)
     return false;
   rInsn.AddOperand(spOprd0);
@@ -4183,10 +4494,11 @@ bool X86Architecture::Operand__d64_r11(BinaryStream const& rBinStrm, OffsetType
 }
 
 /* operand ['op0 = decode_d64_r12'] */
-bool X86Architecture::Operand__d64_r12(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Operand__d64_r12(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: op0 = decode_d64_r12
-  auto spOprd0 = Decode_d64_r12(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd0 = Decode_d64_r12<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd0 == nullptr)
     return false;
   rInsn.AddOperand(spOprd0);
@@ -4195,10 +4507,11 @@ bool X86Architecture::Operand__d64_r12(BinaryStream const& rBinStrm, OffsetType
 }
 
 /* operand ['op0 = decode_d64_r13'] */
-bool X86Architecture::Operand__d64_r13(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Operand__d64_r13(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: op0 = decode_d64_r13
-  auto spOprd0 = Decode_d64_r13(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd0 = Decode_d64_r13<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd0 == nullptr)
     return false;
   rInsn.AddOperand(spOprd0);
@@ -4207,10 +4520,11 @@ bool X86Architecture::Operand__d64_r13(BinaryStream const& rBinStrm, OffsetType
 }
 
 /* operand ['op0 = decode_d64_r14'] */
-bool X86Architecture::Operand__d64_r14(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Operand__d64_r14(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: op0 = decode_d64_r14
-  auto spOprd0 = Decode_d64_r14(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd0 = Decode_d64_r14<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd0 == nullptr)
     return false;
   rInsn.AddOperand(spOprd0);
@@ -4219,10 +4533,11 @@ bool X86Architecture::Operand__d64_r14(BinaryStream const& rBinStrm, OffsetType
 }
 
 /* operand ['op0 = decode_d64_r15'] */
-bool X86Architecture::Operand__d64_r15(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Operand__d64_r15(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: op0 = decode_d64_r15
-  auto spOprd0 = Decode_d64_r15(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd0 = Decode_d64_r15<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd0 == nullptr)
     return false;
   rInsn.AddOperand(spOprd0);
@@ -4231,10 +4546,11 @@ bool X86Architecture::Operand__d64_r15(BinaryStream const& rBinStrm, OffsetType
 }
 
 /* operand ['op0 = decode_d64_r8'] */
-bool X86Architecture::Operand__d64_r8(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Operand__d64_r8(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: op0 = decode_d64_r8
-  auto spOprd0 = Decode_d64_r8(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd0 = Decode_d64_r8<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd0 == nullptr)
     return false;
   rInsn.AddOperand(spOprd0);
@@ -4243,10 +4559,11 @@ bool X86Architecture::Operand__d64_r8(BinaryStream const& rBinStrm, OffsetType O
 }
 
 /* operand ['op0 = decode_d64_r9'] */
-bool X86Architecture::Operand__d64_r9(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Operand__d64_r9(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: op0 = decode_d64_r9
-  auto spOprd0 = Decode_d64_r9(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd0 = Decode_d64_r9<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd0 == nullptr)
     return false;
   rInsn.AddOperand(spOprd0);
@@ -4255,10 +4572,11 @@ bool X86Architecture::Operand__d64_r9(BinaryStream const& rBinStrm, OffsetType O
 }
 
 /* operand ['op0 = decode_d64_rAX'] */
-bool X86Architecture::Operand__d64_rAX(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Operand__d64_rAX(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: op0 = decode_d64_rAX
-  auto spOprd0 = Decode_d64_rAX(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd0 = Decode_d64_rAX<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd0 == nullptr)
     return false;
   rInsn.AddOperand(spOprd0);
@@ -4267,10 +4585,11 @@ bool X86Architecture::Operand__d64_rAX(BinaryStream const& rBinStrm, OffsetType
 }
 
 /* operand ['op0 = decode_d64_rBP'] */
-bool X86Architecture::Operand__d64_rBP(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Operand__d64_rBP(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: op0 = decode_d64_rBP
-  auto spOprd0 = Decode_d64_rBP(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd0 = Decode_d64_rBP<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd0 == nullptr)
     return false;
   rInsn.AddOperand(spOprd0);
@@ -4279,10 +4598,11 @@ bool X86Architecture::Operand__d64_rBP(BinaryStream const& rBinStrm, OffsetType
 }
 
 /* operand ['op0 = decode_d64_rBX'] */
-bool X86Architecture::Operand__d64_rBX(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Operand__d64_rBX(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: op0 = decode_d64_rBX
-  auto spOprd0 = Decode_d64_rBX(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd0 = Decode_d64_rBX<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd0 == nullptr)
     return false;
   rInsn.AddOperand(spOprd0);
@@ -4291,10 +4611,11 @@ bool X86Architecture::Operand__d64_rBX(BinaryStream const& rBinStrm, OffsetType
 }
 
 /* operand ['op0 = decode_d64_rCX'] */
-bool X86Architecture::Operand__d64_rCX(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Operand__d64_rCX(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: op0 = decode_d64_rCX
-  auto spOprd0 = Decode_d64_rCX(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd0 = Decode_d64_rCX<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd0 == nullptr)
     return false;
   rInsn.AddOperand(spOprd0);
@@ -4303,10 +4624,11 @@ bool X86Architecture::Operand__d64_rCX(BinaryStream const& rBinStrm, OffsetType
 }
 
 /* operand ['op0 = decode_d64_rDI'] */
-bool X86Architecture::Operand__d64_rDI(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Operand__d64_rDI(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: op0 = decode_d64_rDI
-  auto spOprd0 = Decode_d64_rDI(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd0 = Decode_d64_rDI<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd0 == nullptr)
     return false;
   rInsn.AddOperand(spOprd0);
@@ -4315,10 +4637,11 @@ bool X86Architecture::Operand__d64_rDI(BinaryStream const& rBinStrm, OffsetType
 }
 
 /* operand ['op0 = decode_d64_rDX'] */
-bool X86Architecture::Operand__d64_rDX(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Operand__d64_rDX(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: op0 = decode_d64_rDX
-  auto spOprd0 = Decode_d64_rDX(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd0 = Decode_d64_rDX<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd0 == nullptr)
     return false;
   rInsn.AddOperand(spOprd0);
@@ -4327,10 +4650,11 @@ bool X86Architecture::Operand__d64_rDX(BinaryStream const& rBinStrm, OffsetType
 }
 
 /* operand ['op0 = decode_d64_rSI'] */
-bool X86Architecture::Operand__d64_rSI(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Operand__d64_rSI(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: op0 = decode_d64_rSI
-  auto spOprd0 = Decode_d64_rSI(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd0 = Decode_d64_rSI<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd0 == nullptr)
     return false;
   rInsn.AddOperand(spOprd0);
@@ -4339,10 +4663,11 @@ bool X86Architecture::Operand__d64_rSI(BinaryStream const& rBinStrm, OffsetType
 }
 
 /* operand ['op0 = decode_d64_rSP'] */
-bool X86Architecture::Operand__d64_rSP(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Operand__d64_rSP(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: op0 = decode_d64_rSP
-  auto spOprd0 = Decode_d64_rSP(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd0 = Decode_d64_rSP<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd0 == nullptr)
     return false;
   rInsn.AddOperand(spOprd0);
@@ -4351,259 +4676,296 @@ bool X86Architecture::Operand__d64_rSP(BinaryStream const& rBinStrm, OffsetType
 }
 
 /* decoder ['const(8, 1)'] */
-Expression::SPType X86Architecture::Decode_1(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+Expression::SPType X86Architecture::Decode_1(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: const(8, 1)
   return Expr::MakeBitVector(8, 1);
 }
 
 /* decoder ['const(8, 3)'] */
-Expression::SPType X86Architecture::Decode_3(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+Expression::SPType X86Architecture::Decode_3(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: const(8, 3)
   return Expr::MakeBitVector(8, 3);
 }
 
 /* decoder ["reg('ah')"] */
-Expression::SPType X86Architecture::Decode_AH(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+Expression::SPType X86Architecture::Decode_AH(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: reg('ah')
   return Expr::MakeId(X86_Reg_Ah, &m_CpuInfo);
 }
 
 /* decoder ["reg('al')"] */
-Expression::SPType X86Architecture::Decode_AL(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+Expression::SPType X86Architecture::Decode_AL(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: reg('al')
   return Expr::MakeId(X86_Reg_Al, &m_CpuInfo);
 }
 
 /* decoder ["reg('ax')"] */
-Expression::SPType X86Architecture::Decode_AX(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+Expression::SPType X86Architecture::Decode_AX(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: reg('ax')
   return Expr::MakeId(X86_Reg_Ax, &m_CpuInfo);
 }
 
 /* decoder ["call('Decode_Ap')"] */
-Expression::SPType X86Architecture::Decode_Ap(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+Expression::SPType X86Architecture::Decode_Ap(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: call('Decode_Ap')
-  return __Decode_Ap(rBinStrm, Offset, rInsn, Mode);
+  return __Decode_Ap<Mode>(rBinStrm, Offset, rInsn);
 }
 
 /* decoder ["reg('bh')"] */
-Expression::SPType X86Architecture::Decode_BH(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+Expression::SPType X86Architecture::Decode_BH(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: reg('bh')
   return Expr::MakeId(X86_Reg_Bh, &m_CpuInfo);
 }
 
 /* decoder ["reg('bl')"] */
-Expression::SPType X86Architecture::Decode_BL(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+Expression::SPType X86Architecture::Decode_BL(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: reg('bl')
   return Expr::MakeId(X86_Reg_Bl, &m_CpuInfo);
 }
 
 /* decoder ["call('Decode_By')"] */
-Expression::SPType X86Architecture::Decode_By(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+Expression::SPType X86Architecture::Decode_By(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: call('Decode_By')
-  return __Decode_By(rBinStrm, Offset, rInsn, Mode);
+  return __Decode_By<Mode>(rBinStrm, Offset, rInsn);
 }
 
 /* decoder ["reg('ch')"] */
-Expression::SPType X86Architecture::Decode_CH(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+Expression::SPType X86Architecture::Decode_CH(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: reg('ch')
   return Expr::MakeId(X86_Reg_Ch, &m_CpuInfo);
 }
 
 /* decoder ["reg('cl')"] */
-Expression::SPType X86Architecture::Decode_CL(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+Expression::SPType X86Architecture::Decode_CL(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: reg('cl')
   return Expr::MakeId(X86_Reg_Cl, &m_CpuInfo);
 }
 
 /* decoder ["reg('cs')"] */
-Expression::SPType X86Architecture::Decode_CS(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+Expression::SPType X86Architecture::Decode_CS(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: reg('cs')
   return Expr::MakeId(X86_Reg_Cs, &m_CpuInfo);
 }
 
 /* decoder ["call('Decode_Cy')"] */
-Expression::SPType X86Architecture::Decode_Cy(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+Expression::SPType X86Architecture::Decode_Cy(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: call('Decode_Cy')
-  return __Decode_Cy(rBinStrm, Offset, rInsn, Mode);
+  return __Decode_Cy<Mode>(rBinStrm, Offset, rInsn);
 }
 
 /* decoder ["reg('dh')"] */
-Expression::SPType X86Architecture::Decode_DH(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+Expression::SPType X86Architecture::Decode_DH(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: reg('dh')
   return Expr::MakeId(X86_Reg_Dh, &m_CpuInfo);
 }
 
 /* decoder ["reg('dl')"] */
-Expression::SPType X86Architecture::Decode_DL(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+Expression::SPType X86Architecture::Decode_DL(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: reg('dl')
   return Expr::MakeId(X86_Reg_Dl, &m_CpuInfo);
 }
 
 /* decoder ["reg('ds')"] */
-Expression::SPType X86Architecture::Decode_DS(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+Expression::SPType X86Architecture::Decode_DS(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: reg('ds')
   return Expr::MakeId(X86_Reg_Ds, &m_CpuInfo);
 }
 
 /* decoder ["reg('dx')"] */
-Expression::SPType X86Architecture::Decode_DX(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+Expression::SPType X86Architecture::Decode_DX(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: reg('dx')
   return Expr::MakeId(X86_Reg_Dx, &m_CpuInfo);
 }
 
 /* decoder ["call('Decode_Dy')"] */
-Expression::SPType X86Architecture::Decode_Dy(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+Expression::SPType X86Architecture::Decode_Dy(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: call('Decode_Dy')
-  return __Decode_Dy(rBinStrm, Offset, rInsn, Mode);
+  return __Decode_Dy<Mode>(rBinStrm, Offset, rInsn);
 }
 
 /* decoder ["reg('es')"] */
-Expression::SPType X86Architecture::Decode_ES(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+Expression::SPType X86Architecture::Decode_ES(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: reg('es')
   return Expr::MakeId(X86_Reg_Es, &m_CpuInfo);
 }
 
 /* decoder ["call('Decode_Eb')"] */
-Expression::SPType X86Architecture::Decode_Eb(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+Expression::SPType X86Architecture::Decode_Eb(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: call('Decode_Eb')
-  return __Decode_Eb(rBinStrm, Offset, rInsn, Mode);
+  return __Decode_Eb<Mode>(rBinStrm, Offset, rInsn);
 }
 
 /* decoder ["call('Decode_Ed')"] */
-Expression::SPType X86Architecture::Decode_Ed(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+Expression::SPType X86Architecture::Decode_Ed(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: call('Decode_Ed')
-  return __Decode_Ed(rBinStrm, Offset, rInsn, Mode);
+  return __Decode_Ed<Mode>(rBinStrm, Offset, rInsn);
 }
 
 /* decoder ["call('Decode_Edb')"] */
-Expression::SPType X86Architecture::Decode_Edb(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+Expression::SPType X86Architecture::Decode_Edb(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: call('Decode_Edb')
-  return __Decode_Edb(rBinStrm, Offset, rInsn, Mode);
+  return __Decode_Edb<Mode>(rBinStrm, Offset, rInsn);
 }
 
 /* decoder ["call('Decode_Ev')"] */
-Expression::SPType X86Architecture::Decode_Ev(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+Expression::SPType X86Architecture::Decode_Ev(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: call('Decode_Ev')
-  return __Decode_Ev(rBinStrm, Offset, rInsn, Mode);
+  return __Decode_Ev<Mode>(rBinStrm, Offset, rInsn);
 }
 
 /* decoder ["call('Decode_Ew')"] */
-Expression::SPType X86Architecture::Decode_Ew(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+Expression::SPType X86Architecture::Decode_Ew(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: call('Decode_Ew')
-  return __Decode_Ew(rBinStrm, Offset, rInsn, Mode);
+  return __Decode_Ew<Mode>(rBinStrm, Offset, rInsn);
 }
 
 /* decoder ["call('Decode_Ey')"] */
-Expression::SPType X86Architecture::Decode_Ey(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+Expression::SPType X86Architecture::Decode_Ey(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: call('Decode_Ey')
-  return __Decode_Ey(rBinStrm, Offset, rInsn, Mode);
+  return __Decode_Ey<Mode>(rBinStrm, Offset, rInsn);
 }
 
 /* decoder ["call('Decode_Eyb')"] */
-Expression::SPType X86Architecture::Decode_Eyb(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+Expression::SPType X86Architecture::Decode_Eyb(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: call('Decode_Eyb')
-  return __Decode_Eyb(rBinStrm, Offset, rInsn, Mode);
+  return __Decode_Eyb<Mode>(rBinStrm, Offset, rInsn);
 }
 
 /* decoder ["call('Decode_Eyw')"] */
-Expression::SPType X86Architecture::Decode_Eyw(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+Expression::SPType X86Architecture::Decode_Eyw(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: call('Decode_Eyw')
-  return __Decode_Eyw(rBinStrm, Offset, rInsn, Mode);
+  return __Decode_Eyw<Mode>(rBinStrm, Offset, rInsn);
 }
 
 /* decoder ["reg('fs')"] */
-Expression::SPType X86Architecture::Decode_FS(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+Expression::SPType X86Architecture::Decode_FS(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: reg('fs')
   return Expr::MakeId(X86_Reg_Fs, &m_CpuInfo);
 }
 
 /* decoder ["reg('gs')"] */
-Expression::SPType X86Architecture::Decode_GS(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+Expression::SPType X86Architecture::Decode_GS(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: reg('gs')
   return Expr::MakeId(X86_Reg_Gs, &m_CpuInfo);
 }
 
 /* decoder ["call('Decode_Gb')"] */
-Expression::SPType X86Architecture::Decode_Gb(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+Expression::SPType X86Architecture::Decode_Gb(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: call('Decode_Gb')
-  return __Decode_Gb(rBinStrm, Offset, rInsn, Mode);
+  return __Decode_Gb<Mode>(rBinStrm, Offset, rInsn);
 }
 
 /* decoder ["call('Decode_Gv')"] */
-Expression::SPType X86Architecture::Decode_Gv(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+Expression::SPType X86Architecture::Decode_Gv(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: call('Decode_Gv')
-  return __Decode_Gv(rBinStrm, Offset, rInsn, Mode);
+  return __Decode_Gv<Mode>(rBinStrm, Offset, rInsn);
 }
 
 /* decoder ["call('Decode_Gw')"] */
-Expression::SPType X86Architecture::Decode_Gw(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+Expression::SPType X86Architecture::Decode_Gw(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: call('Decode_Gw')
-  return __Decode_Gw(rBinStrm, Offset, rInsn, Mode);
+  return __Decode_Gw<Mode>(rBinStrm, Offset, rInsn);
 }
 
 /* decoder ["call('Decode_Gy')"] */
-Expression::SPType X86Architecture::Decode_Gy(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+Expression::SPType X86Architecture::Decode_Gy(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: call('Decode_Gy')
-  return __Decode_Gy(rBinStrm, Offset, rInsn, Mode);
+  return __Decode_Gy<Mode>(rBinStrm, Offset, rInsn);
 }
 
 /* decoder ["call('Decode_Ho')"] */
-Expression::SPType X86Architecture::Decode_Ho(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+Expression::SPType X86Architecture::Decode_Ho(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: call('Decode_Ho')
-  return __Decode_Ho(rBinStrm, Offset, rInsn, Mode);
+  return __Decode_Ho<Mode>(rBinStrm, Offset, rInsn);
 }
 
 /* decoder ["call('Decode_Hx')"] */
-Expression::SPType X86Architecture::Decode_Hx(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+Expression::SPType X86Architecture::Decode_Hx(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: call('Decode_Hx')
-  return __Decode_Hx(rBinStrm, Offset, rInsn, Mode);
+  return __Decode_Hx<Mode>(rBinStrm, Offset, rInsn);
 }
 
 /* decoder ["call('Decode_Hy')"] */
-Expression::SPType X86Architecture::Decode_Hy(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+Expression::SPType X86Architecture::Decode_Hy(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: call('Decode_Hy')
-  return __Decode_Hy(rBinStrm, Offset, rInsn, Mode);
+  return __Decode_Hy<Mode>(rBinStrm, Offset, rInsn);
 }
 
 /* decoder ['read_b(off)'] */
-Expression::SPType X86Architecture::Decode_Ib(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+Expression::SPType X86Architecture::Decode_Ib(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: read_b(off)
   u8 Value;
@@ -4616,14 +4978,16 @@ Expression::SPType X86Architecture::Decode_Ib(BinaryStream const& rBinStrm, Offs
 }
 
 /* decoder ["call('Decode_Ibs')"] */
-Expression::SPType X86Architecture::Decode_Ibs(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+Expression::SPType X86Architecture::Decode_Ibs(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: call('Decode_Ibs')
-  return __Decode_Ibs(rBinStrm, Offset, rInsn, Mode);
+  return __Decode_Ibs<Mode>(rBinStrm, Offset, rInsn);
 }
 
 /* decoder ['read_bsq(off)'] */
-Expression::SPType X86Architecture::Decode_Ibsq(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+Expression::SPType X86Architecture::Decode_Ibsq(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: read_bsq(off)
   u8 Value;
@@ -4636,7 +5000,8 @@ Expression::SPType X86Architecture::Decode_Ibsq(BinaryStream const& rBinStrm, Of
 }
 
 /* decoder ['read_v(off)'] */
-Expression::SPType X86Architecture::Decode_Iv(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+Expression::SPType X86Architecture::Decode_Iv(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: read_v(off)
   switch (Mode)
@@ -4696,7 +5061,8 @@ Expression::SPType X86Architecture::Decode_Iv(BinaryStream const& rBinStrm, Offs
 }
 
 /* decoder ['read_w(off)'] */
-Expression::SPType X86Architecture::Decode_Iw(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+Expression::SPType X86Architecture::Decode_Iw(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: read_w(off)
   u16 Value;
@@ -4709,7 +5075,8 @@ Expression::SPType X86Architecture::Decode_Iw(BinaryStream const& rBinStrm, Offs
 }
 
 /* decoder ['read_z(off)'] */
-Expression::SPType X86Architecture::Decode_Iz(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+Expression::SPType X86Architecture::Decode_Iz(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: read_z(off)
   switch (Mode)
@@ -4769,7 +5136,8 @@ Expression::SPType X86Architecture::Decode_Iz(BinaryStream const& rBinStrm, Offs
 }
 
 /* decoder ['read_zsq(off)'] */
-Expression::SPType X86Architecture::Decode_Izsq(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+Expression::SPType X86Architecture::Decode_Izsq(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: read_zsq(off)
   switch (Mode)
@@ -4829,402 +5197,457 @@ Expression::SPType X86Architecture::Decode_Izsq(BinaryStream const& rBinStrm, Of
 }
 
 /* decoder ["call('Decode_Jb')"] */
-Expression::SPType X86Architecture::Decode_Jb(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+Expression::SPType X86Architecture::Decode_Jb(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: call('Decode_Jb')
-  return __Decode_Jb(rBinStrm, Offset, rInsn, Mode);
+  return __Decode_Jb<Mode>(rBinStrm, Offset, rInsn);
 }
 
 /* decoder ["call('Decode_Jz')"] */
-Expression::SPType X86Architecture::Decode_Jz(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+Expression::SPType X86Architecture::Decode_Jz(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: call('Decode_Jz')
-  return __Decode_Jz(rBinStrm, Offset, rInsn, Mode);
+  return __Decode_Jz<Mode>(rBinStrm, Offset, rInsn);
 }
 
 /* decoder ["call('Decode_Lx')"] */
-Expression::SPType X86Architecture::Decode_Lx(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+Expression::SPType X86Architecture::Decode_Lx(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: call('Decode_Lx')
-  return __Decode_Lx(rBinStrm, Offset, rInsn, Mode);
+  return __Decode_Lx<Mode>(rBinStrm, Offset, rInsn);
 }
 
 /* decoder ["call('Decode_M')"] */
-Expression::SPType X86Architecture::Decode_M(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+Expression::SPType X86Architecture::Decode_M(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: call('Decode_M')
-  return __Decode_M(rBinStrm, Offset, rInsn, Mode);
+  return __Decode_M<Mode>(rBinStrm, Offset, rInsn);
 }
 
 /* decoder ["call('Decode_Ma')"] */
-Expression::SPType X86Architecture::Decode_Ma(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+Expression::SPType X86Architecture::Decode_Ma(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: call('Decode_Ma')
-  return __Decode_Ma(rBinStrm, Offset, rInsn, Mode);
+  return __Decode_Ma<Mode>(rBinStrm, Offset, rInsn);
 }
 
 /* decoder ["call('Decode_Md')"] */
-Expression::SPType X86Architecture::Decode_Md(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+Expression::SPType X86Architecture::Decode_Md(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: call('Decode_Md')
-  return __Decode_Md(rBinStrm, Offset, rInsn, Mode);
+  return __Decode_Md<Mode>(rBinStrm, Offset, rInsn);
 }
 
 /* decoder ["call('Decode_Mp')"] */
-Expression::SPType X86Architecture::Decode_Mp(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+Expression::SPType X86Architecture::Decode_Mp(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: call('Decode_Mp')
-  return __Decode_Mp(rBinStrm, Offset, rInsn, Mode);
+  return __Decode_Mp<Mode>(rBinStrm, Offset, rInsn);
 }
 
 /* decoder ["call('Decode_Mq')"] */
-Expression::SPType X86Architecture::Decode_Mq(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+Expression::SPType X86Architecture::Decode_Mq(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: call('Decode_Mq')
-  return __Decode_Mq(rBinStrm, Offset, rInsn, Mode);
+  return __Decode_Mq<Mode>(rBinStrm, Offset, rInsn);
 }
 
 /* decoder ["call('Decode_Mqo')"] */
-Expression::SPType X86Architecture::Decode_Mqo(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+Expression::SPType X86Architecture::Decode_Mqo(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: call('Decode_Mqo')
-  return __Decode_Mqo(rBinStrm, Offset, rInsn, Mode);
+  return __Decode_Mqo<Mode>(rBinStrm, Offset, rInsn);
 }
 
 /* decoder ["call('Decode_Mv')"] */
-Expression::SPType X86Architecture::Decode_Mv(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+Expression::SPType X86Architecture::Decode_Mv(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: call('Decode_Mv')
-  return __Decode_Mv(rBinStrm, Offset, rInsn, Mode);
+  return __Decode_Mv<Mode>(rBinStrm, Offset, rInsn);
 }
 
 /* decoder ["call('Decode_Mw')"] */
-Expression::SPType X86Architecture::Decode_Mw(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+Expression::SPType X86Architecture::Decode_Mw(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: call('Decode_Mw')
-  return __Decode_Mw(rBinStrm, Offset, rInsn, Mode);
+  return __Decode_Mw<Mode>(rBinStrm, Offset, rInsn);
 }
 
 /* decoder ["call('Decode_Mx')"] */
-Expression::SPType X86Architecture::Decode_Mx(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+Expression::SPType X86Architecture::Decode_Mx(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: call('Decode_Mx')
-  return __Decode_Mx(rBinStrm, Offset, rInsn, Mode);
+  return __Decode_Mx<Mode>(rBinStrm, Offset, rInsn);
 }
 
 /* decoder ["call('Decode_My')"] */
-Expression::SPType X86Architecture::Decode_My(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+Expression::SPType X86Architecture::Decode_My(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: call('Decode_My')
-  return __Decode_My(rBinStrm, Offset, rInsn, Mode);
+  return __Decode_My<Mode>(rBinStrm, Offset, rInsn);
 }
 
 /* decoder ["call('Decode_Nq')"] */
-Expression::SPType X86Architecture::Decode_Nq(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+Expression::SPType X86Architecture::Decode_Nq(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: call('Decode_Nq')
-  return __Decode_Nq(rBinStrm, Offset, rInsn, Mode);
+  return __Decode_Nq<Mode>(rBinStrm, Offset, rInsn);
 }
 
 /* decoder ["call('Decode_Ob')"] */
-Expression::SPType X86Architecture::Decode_Ob(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+Expression::SPType X86Architecture::Decode_Ob(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: call('Decode_Ob')
-  return __Decode_Ob(rBinStrm, Offset, rInsn, Mode);
+  return __Decode_Ob<Mode>(rBinStrm, Offset, rInsn);
 }
 
 /* decoder ["call('Decode_Ov')"] */
-Expression::SPType X86Architecture::Decode_Ov(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+Expression::SPType X86Architecture::Decode_Ov(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: call('Decode_Ov')
-  return __Decode_Ov(rBinStrm, Offset, rInsn, Mode);
+  return __Decode_Ov<Mode>(rBinStrm, Offset, rInsn);
 }
 
 /* decoder ["call('Decode_Pq')"] */
-Expression::SPType X86Architecture::Decode_Pq(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+Expression::SPType X86Architecture::Decode_Pq(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: call('Decode_Pq')
-  return __Decode_Pq(rBinStrm, Offset, rInsn, Mode);
+  return __Decode_Pq<Mode>(rBinStrm, Offset, rInsn);
 }
 
 /* decoder ["call('Decode_Qd')"] */
-Expression::SPType X86Architecture::Decode_Qd(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+Expression::SPType X86Architecture::Decode_Qd(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: call('Decode_Qd')
-  return __Decode_Qd(rBinStrm, Offset, rInsn, Mode);
+  return __Decode_Qd<Mode>(rBinStrm, Offset, rInsn);
 }
 
 /* decoder ["call('Decode_Qq')"] */
-Expression::SPType X86Architecture::Decode_Qq(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+Expression::SPType X86Architecture::Decode_Qq(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: call('Decode_Qq')
-  return __Decode_Qq(rBinStrm, Offset, rInsn, Mode);
+  return __Decode_Qq<Mode>(rBinStrm, Offset, rInsn);
 }
 
 /* decoder ["call('Decode_Rv')"] */
-Expression::SPType X86Architecture::Decode_Rv(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+Expression::SPType X86Architecture::Decode_Rv(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: call('Decode_Rv')
-  return __Decode_Rv(rBinStrm, Offset, rInsn, Mode);
+  return __Decode_Rv<Mode>(rBinStrm, Offset, rInsn);
 }
 
 /* decoder ["call('Decode_Ry')"] */
-Expression::SPType X86Architecture::Decode_Ry(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+Expression::SPType X86Architecture::Decode_Ry(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: call('Decode_Ry')
-  return __Decode_Ry(rBinStrm, Offset, rInsn, Mode);
+  return __Decode_Ry<Mode>(rBinStrm, Offset, rInsn);
 }
 
 /* decoder ["reg('ss')"] */
-Expression::SPType X86Architecture::Decode_SS(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+Expression::SPType X86Architecture::Decode_SS(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: reg('ss')
   return Expr::MakeId(X86_Reg_Ss, &m_CpuInfo);
 }
 
 /* decoder ["reg('st0')"] */
-Expression::SPType X86Architecture::Decode_ST0(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+Expression::SPType X86Architecture::Decode_ST0(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: reg('st0')
   return Expr::MakeId(X86_Reg_St0, &m_CpuInfo);
 }
 
 /* decoder ["reg('st1')"] */
-Expression::SPType X86Architecture::Decode_ST1(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+Expression::SPType X86Architecture::Decode_ST1(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: reg('st1')
   return Expr::MakeId(X86_Reg_St1, &m_CpuInfo);
 }
 
 /* decoder ["reg('st2')"] */
-Expression::SPType X86Architecture::Decode_ST2(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+Expression::SPType X86Architecture::Decode_ST2(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: reg('st2')
   return Expr::MakeId(X86_Reg_St2, &m_CpuInfo);
 }
 
 /* decoder ["reg('st3')"] */
-Expression::SPType X86Architecture::Decode_ST3(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+Expression::SPType X86Architecture::Decode_ST3(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: reg('st3')
   return Expr::MakeId(X86_Reg_St3, &m_CpuInfo);
 }
 
 /* decoder ["reg('st4')"] */
-Expression::SPType X86Architecture::Decode_ST4(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+Expression::SPType X86Architecture::Decode_ST4(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: reg('st4')
   return Expr::MakeId(X86_Reg_St4, &m_CpuInfo);
 }
 
 /* decoder ["reg('st5')"] */
-Expression::SPType X86Architecture::Decode_ST5(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+Expression::SPType X86Architecture::Decode_ST5(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: reg('st5')
   return Expr::MakeId(X86_Reg_St5, &m_CpuInfo);
 }
 
 /* decoder ["reg('st6')"] */
-Expression::SPType X86Architecture::Decode_ST6(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+Expression::SPType X86Architecture::Decode_ST6(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: reg('st6')
   return Expr::MakeId(X86_Reg_St6, &m_CpuInfo);
 }
 
 /* decoder ["reg('st7')"] */
-Expression::SPType X86Architecture::Decode_ST7(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+Expression::SPType X86Architecture::Decode_ST7(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: reg('st7')
   return Expr::MakeId(X86_Reg_St7, &m_CpuInfo);
 }
 
 /* decoder ["call('Decode_Sw')"] */
-Expression::SPType X86Architecture::Decode_Sw(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+Expression::SPType X86Architecture::Decode_Sw(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: call('Decode_Sw')
-  return __Decode_Sw(rBinStrm, Offset, rInsn, Mode);
+  return __Decode_Sw<Mode>(rBinStrm, Offset, rInsn);
 }
 
 /* decoder ["call('Decode_Ty')"] */
-Expression::SPType X86Architecture::Decode_Ty(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+Expression::SPType X86Architecture::Decode_Ty(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: call('Decode_Ty')
-  return __Decode_Ty(rBinStrm, Offset, rInsn, Mode);
+  return __Decode_Ty<Mode>(rBinStrm, Offset, rInsn);
 }
 
 /* decoder ["call('Decode_Uo')"] */
-Expression::SPType X86Architecture::Decode_Uo(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+Expression::SPType X86Architecture::Decode_Uo(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: call('Decode_Uo')
-  return __Decode_Uo(rBinStrm, Offset, rInsn, Mode);
+  return __Decode_Uo<Mode>(rBinStrm, Offset, rInsn);
 }
 
 /* decoder ["call('Decode_Uod')"] */
-Expression::SPType X86Architecture::Decode_Uod(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+Expression::SPType X86Architecture::Decode_Uod(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: call('Decode_Uod')
-  return __Decode_Uod(rBinStrm, Offset, rInsn, Mode);
+  return __Decode_Uod<Mode>(rBinStrm, Offset, rInsn);
 }
 
 /* decoder ["call('Decode_Uoq')"] */
-Expression::SPType X86Architecture::Decode_Uoq(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+Expression::SPType X86Architecture::Decode_Uoq(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: call('Decode_Uoq')
-  return __Decode_Uoq(rBinStrm, Offset, rInsn, Mode);
+  return __Decode_Uoq<Mode>(rBinStrm, Offset, rInsn);
 }
 
 /* decoder ["call('Decode_Uq')"] */
-Expression::SPType X86Architecture::Decode_Uq(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+Expression::SPType X86Architecture::Decode_Uq(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: call('Decode_Uq')
-  return __Decode_Uq(rBinStrm, Offset, rInsn, Mode);
+  return __Decode_Uq<Mode>(rBinStrm, Offset, rInsn);
 }
 
 /* decoder ["call('Decode_Ux')"] */
-Expression::SPType X86Architecture::Decode_Ux(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+Expression::SPType X86Architecture::Decode_Ux(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: call('Decode_Ux')
-  return __Decode_Ux(rBinStrm, Offset, rInsn, Mode);
+  return __Decode_Ux<Mode>(rBinStrm, Offset, rInsn);
 }
 
 /* decoder ["call('Decode_Vo')"] */
-Expression::SPType X86Architecture::Decode_Vo(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+Expression::SPType X86Architecture::Decode_Vo(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: call('Decode_Vo')
-  return __Decode_Vo(rBinStrm, Offset, rInsn, Mode);
+  return __Decode_Vo<Mode>(rBinStrm, Offset, rInsn);
 }
 
 /* decoder ["call('Decode_Vod')"] */
-Expression::SPType X86Architecture::Decode_Vod(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+Expression::SPType X86Architecture::Decode_Vod(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: call('Decode_Vod')
-  return __Decode_Vod(rBinStrm, Offset, rInsn, Mode);
+  return __Decode_Vod<Mode>(rBinStrm, Offset, rInsn);
 }
 
 /* decoder ["call('Decode_Voq')"] */
-Expression::SPType X86Architecture::Decode_Voq(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+Expression::SPType X86Architecture::Decode_Voq(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: call('Decode_Voq')
-  return __Decode_Voq(rBinStrm, Offset, rInsn, Mode);
+  return __Decode_Voq<Mode>(rBinStrm, Offset, rInsn);
 }
 
 /* decoder ["call('Decode_Vx')"] */
-Expression::SPType X86Architecture::Decode_Vx(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+Expression::SPType X86Architecture::Decode_Vx(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: call('Decode_Vx')
-  return __Decode_Vx(rBinStrm, Offset, rInsn, Mode);
+  return __Decode_Vx<Mode>(rBinStrm, Offset, rInsn);
 }
 
 /* decoder ["call('Decode_Vy')"] */
-Expression::SPType X86Architecture::Decode_Vy(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+Expression::SPType X86Architecture::Decode_Vy(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: call('Decode_Vy')
-  return __Decode_Vy(rBinStrm, Offset, rInsn, Mode);
+  return __Decode_Vy<Mode>(rBinStrm, Offset, rInsn);
 }
 
 /* decoder ["call('Decode_Wd')"] */
-Expression::SPType X86Architecture::Decode_Wd(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+Expression::SPType X86Architecture::Decode_Wd(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: call('Decode_Wd')
-  return __Decode_Wd(rBinStrm, Offset, rInsn, Mode);
+  return __Decode_Wd<Mode>(rBinStrm, Offset, rInsn);
 }
 
 /* decoder ["call('Decode_Wo')"] */
-Expression::SPType X86Architecture::Decode_Wo(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+Expression::SPType X86Architecture::Decode_Wo(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: call('Decode_Wo')
-  return __Decode_Wo(rBinStrm, Offset, rInsn, Mode);
+  return __Decode_Wo<Mode>(rBinStrm, Offset, rInsn);
 }
 
 /* decoder ["call('Decode_Wob')"] */
-Expression::SPType X86Architecture::Decode_Wob(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+Expression::SPType X86Architecture::Decode_Wob(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: call('Decode_Wob')
-  return __Decode_Wob(rBinStrm, Offset, rInsn, Mode);
+  return __Decode_Wob<Mode>(rBinStrm, Offset, rInsn);
 }
 
 /* decoder ["call('Decode_Wod')"] */
-Expression::SPType X86Architecture::Decode_Wod(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+Expression::SPType X86Architecture::Decode_Wod(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: call('Decode_Wod')
-  return __Decode_Wod(rBinStrm, Offset, rInsn, Mode);
+  return __Decode_Wod<Mode>(rBinStrm, Offset, rInsn);
 }
 
 /* decoder ["call('Decode_Woo')"] */
-Expression::SPType X86Architecture::Decode_Woo(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+Expression::SPType X86Architecture::Decode_Woo(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: call('Decode_Woo')
-  return __Decode_Woo(rBinStrm, Offset, rInsn, Mode);
+  return __Decode_Woo<Mode>(rBinStrm, Offset, rInsn);
 }
 
 /* decoder ["call('Decode_Woq')"] */
-Expression::SPType X86Architecture::Decode_Woq(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+Expression::SPType X86Architecture::Decode_Woq(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: call('Decode_Woq')
-  return __Decode_Woq(rBinStrm, Offset, rInsn, Mode);
+  return __Decode_Woq<Mode>(rBinStrm, Offset, rInsn);
 }
 
 /* decoder ["call('Decode_Woqo')"] */
-Expression::SPType X86Architecture::Decode_Woqo(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+Expression::SPType X86Architecture::Decode_Woqo(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: call('Decode_Woqo')
-  return __Decode_Woqo(rBinStrm, Offset, rInsn, Mode);
+  return __Decode_Woqo<Mode>(rBinStrm, Offset, rInsn);
 }
 
 /* decoder ["call('Decode_Wow')"] */
-Expression::SPType X86Architecture::Decode_Wow(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+Expression::SPType X86Architecture::Decode_Wow(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: call('Decode_Wow')
-  return __Decode_Wow(rBinStrm, Offset, rInsn, Mode);
+  return __Decode_Wow<Mode>(rBinStrm, Offset, rInsn);
 }
 
 /* decoder ["call('Decode_Wq')"] */
-Expression::SPType X86Architecture::Decode_Wq(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+Expression::SPType X86Architecture::Decode_Wq(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: call('Decode_Wq')
-  return __Decode_Wq(rBinStrm, Offset, rInsn, Mode);
+  return __Decode_Wq<Mode>(rBinStrm, Offset, rInsn);
 }
 
 /* decoder ["call('Decode_Wx')"] */
-Expression::SPType X86Architecture::Decode_Wx(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+Expression::SPType X86Architecture::Decode_Wx(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: call('Decode_Wx')
-  return __Decode_Wx(rBinStrm, Offset, rInsn, Mode);
+  return __Decode_Wx<Mode>(rBinStrm, Offset, rInsn);
 }
 
 /* decoder ["call('Decode_Wy')"] */
-Expression::SPType X86Architecture::Decode_Wy(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+Expression::SPType X86Architecture::Decode_Wy(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: call('Decode_Wy')
-  return __Decode_Wy(rBinStrm, Offset, rInsn, Mode);
+  return __Decode_Wy<Mode>(rBinStrm, Offset, rInsn);
 }
 
 /* decoder ['addr_b(decode_DS, decode_d64_rSI)'] */
-Expression::SPType X86Architecture::Decode_Xb(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+Expression::SPType X86Architecture::Decode_Xb(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: addr_b(decode_DS, decode_d64_rSI)
-  return Expr::MakeMem(8, Decode_DS(rBinStrm, Offset, rInsn, Mode), Decode_d64_rSI(rBinStrm, Offset, rInsn, Mode), true);
+  return Expr::MakeMem(8, Decode_DS<Mode>(rBinStrm, Offset, rInsn), Decode_d64_rSI<Mode>(rBinStrm, Offset, rInsn), true);
 }
 
 /* decoder ['addr_v(decode_DS, decode_d64_rSI)'] */
-Expression::SPType X86Architecture::Decode_Xv(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+Expression::SPType X86Architecture::Decode_Xv(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: addr_v(decode_DS, decode_d64_rSI)
   switch (Mode)
   {
   case X86_Bit_16:
     if ((rInsn.GetPrefix() & X86_Prefix_OpSize) == X86_Prefix_OpSize)
-      return Expr::MakeMem(32, Decode_DS(rBinStrm, Offset, rInsn, Mode), Decode_d64_rSI(rBinStrm, Offset, rInsn, Mode), true);
+      return Expr::MakeMem(32, Decode_DS<Mode>(rBinStrm, Offset, rInsn), Decode_d64_rSI<Mode>(rBinStrm, Offset, rInsn), true);
     else
-      return Expr::MakeMem(16, Decode_DS(rBinStrm, Offset, rInsn, Mode), Decode_d64_rSI(rBinStrm, Offset, rInsn, Mode), true);
+      return Expr::MakeMem(16, Decode_DS<Mode>(rBinStrm, Offset, rInsn), Decode_d64_rSI<Mode>(rBinStrm, Offset, rInsn), true);
   case X86_Bit_64:
     if ((rInsn.GetPrefix() & X86_Prefix_REX_w) == X86_Prefix_REX_w)
-      return Expr::MakeMem(64, Decode_DS(rBinStrm, Offset, rInsn, Mode), Decode_d64_rSI(rBinStrm, Offset, rInsn, Mode), true);
+      return Expr::MakeMem(64, Decode_DS<Mode>(rBinStrm, Offset, rInsn), Decode_d64_rSI<Mode>(rBinStrm, Offset, rInsn), true);
   case X86_Bit_32:
     if ((rInsn.GetPrefix() & X86_Prefix_OpSize) == X86_Prefix_OpSize)
-      return Expr::MakeMem(16, Decode_DS(rBinStrm, Offset, rInsn, Mode), Decode_d64_rSI(rBinStrm, Offset, rInsn, Mode), true);
+      return Expr::MakeMem(16, Decode_DS<Mode>(rBinStrm, Offset, rInsn), Decode_d64_rSI<Mode>(rBinStrm, Offset, rInsn), true);
     else
-      return Expr::MakeMem(32, Decode_DS(rBinStrm, Offset, rInsn, Mode), Decode_d64_rSI(rBinStrm, Offset, rInsn, Mode), true);
+      return Expr::MakeMem(32, Decode_DS<Mode>(rBinStrm, Offset, rInsn), Decode_d64_rSI<Mode>(rBinStrm, Offset, rInsn), true);
   default:
     return nullptr;
   }
@@ -5232,21 +5655,22 @@ Expression::SPType X86Architecture::Decode_Xv(BinaryStream const& rBinStrm, Offs
 }
 
 /* decoder ['addr_z(decode_DS, decode_d64_rSI)'] */
-Expression::SPType X86Architecture::Decode_Xz(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+Expression::SPType X86Architecture::Decode_Xz(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: addr_z(decode_DS, decode_d64_rSI)
   switch (Mode)
   {
   case X86_Bit_16:
     if ((rInsn.GetPrefix() & X86_Prefix_OpSize) == X86_Prefix_OpSize)
-      return Expr::MakeMem(32, Decode_DS(rBinStrm, Offset, rInsn, Mode), Decode_d64_rSI(rBinStrm, Offset, rInsn, Mode), true);
+      return Expr::MakeMem(32, Decode_DS<Mode>(rBinStrm, Offset, rInsn), Decode_d64_rSI<Mode>(rBinStrm, Offset, rInsn), true);
     else
-      return Expr::MakeMem(16, Decode_DS(rBinStrm, Offset, rInsn, Mode), Decode_d64_rSI(rBinStrm, Offset, rInsn, Mode), true);
+      return Expr::MakeMem(16, Decode_DS<Mode>(rBinStrm, Offset, rInsn), Decode_d64_rSI<Mode>(rBinStrm, Offset, rInsn), true);
   case X86_Bit_32:
     if ((rInsn.GetPrefix() & X86_Prefix_OpSize) == X86_Prefix_OpSize)
-      return Expr::MakeMem(16, Decode_DS(rBinStrm, Offset, rInsn, Mode), Decode_d64_rSI(rBinStrm, Offset, rInsn, Mode), true);
+      return Expr::MakeMem(16, Decode_DS<Mode>(rBinStrm, Offset, rInsn), Decode_d64_rSI<Mode>(rBinStrm, Offset, rInsn), true);
     else
-      return Expr::MakeMem(32, Decode_DS(rBinStrm, Offset, rInsn, Mode), Decode_d64_rSI(rBinStrm, Offset, rInsn, Mode), true);
+      return Expr::MakeMem(32, Decode_DS<Mode>(rBinStrm, Offset, rInsn), Decode_d64_rSI<Mode>(rBinStrm, Offset, rInsn), true);
   default:
     return nullptr;
   }
@@ -5254,31 +5678,33 @@ Expression::SPType X86Architecture::Decode_Xz(BinaryStream const& rBinStrm, Offs
 }
 
 /* decoder ['addr_b(decode_ES, decode_d64_rDI)'] */
-Expression::SPType X86Architecture::Decode_Yb(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+Expression::SPType X86Architecture::Decode_Yb(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: addr_b(decode_ES, decode_d64_rDI)
-  return Expr::MakeMem(8, Decode_ES(rBinStrm, Offset, rInsn, Mode), Decode_d64_rDI(rBinStrm, Offset, rInsn, Mode), true);
+  return Expr::MakeMem(8, Decode_ES<Mode>(rBinStrm, Offset, rInsn), Decode_d64_rDI<Mode>(rBinStrm, Offset, rInsn), true);
 }
 
 /* decoder ['addr_v(decode_ES, decode_d64_rDI)'] */
-Expression::SPType X86Architecture::Decode_Yv(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+Expression::SPType X86Architecture::Decode_Yv(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: addr_v(decode_ES, decode_d64_rDI)
   switch (Mode)
   {
   case X86_Bit_16:
     if ((rInsn.GetPrefix() & X86_Prefix_OpSize) == X86_Prefix_OpSize)
-      return Expr::MakeMem(32, Decode_ES(rBinStrm, Offset, rInsn, Mode), Decode_d64_rDI(rBinStrm, Offset, rInsn, Mode), true);
+      return Expr::MakeMem(32, Decode_ES<Mode>(rBinStrm, Offset, rInsn), Decode_d64_rDI<Mode>(rBinStrm, Offset, rInsn), true);
     else
-      return Expr::MakeMem(16, Decode_ES(rBinStrm, Offset, rInsn, Mode), Decode_d64_rDI(rBinStrm, Offset, rInsn, Mode), true);
+      return Expr::MakeMem(16, Decode_ES<Mode>(rBinStrm, Offset, rInsn), Decode_d64_rDI<Mode>(rBinStrm, Offset, rInsn), true);
   case X86_Bit_64:
     if ((rInsn.GetPrefix() & X86_Prefix_REX_w) == X86_Prefix_REX_w)
-      return Expr::MakeMem(64, Decode_ES(rBinStrm, Offset, rInsn, Mode), Decode_d64_rDI(rBinStrm, Offset, rInsn, Mode), true);
+      return Expr::MakeMem(64, Decode_ES<Mode>(rBinStrm, Offset, rInsn), Decode_d64_rDI<Mode>(rBinStrm, Offset, rInsn), true);
   case X86_Bit_32:
     if ((rInsn.GetPrefix() & X86_Prefix_OpSize) == X86_Prefix_OpSize)
-      return Expr::MakeMem(16, Decode_ES(rBinStrm, Offset, rInsn, Mode), Decode_d64_rDI(rBinStrm, Offset, rInsn, Mode), true);
+      return Expr::MakeMem(16, Decode_ES<Mode>(rBinStrm, Offset, rInsn), Decode_d64_rDI<Mode>(rBinStrm, Offset, rInsn), true);
     else
-      return Expr::MakeMem(32, Decode_ES(rBinStrm, Offset, rInsn, Mode), Decode_d64_rDI(rBinStrm, Offset, rInsn, Mode), true);
+      return Expr::MakeMem(32, Decode_ES<Mode>(rBinStrm, Offset, rInsn), Decode_d64_rDI<Mode>(rBinStrm, Offset, rInsn), true);
   default:
     return nullptr;
   }
@@ -5286,21 +5712,22 @@ Expression::SPType X86Architecture::Decode_Yv(BinaryStream const& rBinStrm, Offs
 }
 
 /* decoder ['addr_z(decode_ES, decode_d64_rDI)'] */
-Expression::SPType X86Architecture::Decode_Yz(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+Expression::SPType X86Architecture::Decode_Yz(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: addr_z(decode_ES, decode_d64_rDI)
   switch (Mode)
   {
   case X86_Bit_16:
     if ((rInsn.GetPrefix() & X86_Prefix_OpSize) == X86_Prefix_OpSize)
-      return Expr::MakeMem(32, Decode_ES(rBinStrm, Offset, rInsn, Mode), Decode_d64_rDI(rBinStrm, Offset, rInsn, Mode), true);
+      return Expr::MakeMem(32, Decode_ES<Mode>(rBinStrm, Offset, rInsn), Decode_d64_rDI<Mode>(rBinStrm, Offset, rInsn), true);
     else
-      return Expr::MakeMem(16, Decode_ES(rBinStrm, Offset, rInsn, Mode), Decode_d64_rDI(rBinStrm, Offset, rInsn, Mode), true);
+      return Expr::MakeMem(16, Decode_ES<Mode>(rBinStrm, Offset, rInsn), Decode_d64_rDI<Mode>(rBinStrm, Offset, rInsn), true);
   case X86_Bit_32:
     if ((rInsn.GetPrefix() & X86_Prefix_OpSize) == X86_Prefix_OpSize)
-      return Expr::MakeMem(16, Decode_ES(rBinStrm, Offset, rInsn, Mode), Decode_d64_rDI(rBinStrm, Offset, rInsn, Mode), true);
+      return Expr::MakeMem(16, Decode_ES<Mode>(rBinStrm, Offset, rInsn), Decode_d64_rDI<Mode>(rBinStrm, Offset, rInsn), true);
     else
-      return Expr::MakeMem(32, Decode_ES(rBinStrm, Offset, rInsn, Mode), Decode_d64_rDI(rBinStrm, Offset, rInsn, Mode), true);
+      return Expr::MakeMem(32, Decode_ES<Mode>(rBinStrm, Offset, rInsn), Decode_d64_rDI<Mode>(rBinStrm, Offset, rInsn), true);
   default:
     return nullptr;
   }
@@ -5308,14 +5735,16 @@ Expression::SPType X86Architecture::Decode_Yz(BinaryStream const& rBinStrm, Offs
 }
 
 /* decoder ["call('Decode_b')"] */
-Expression::SPType X86Architecture::Decode_b(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+Expression::SPType X86Architecture::Decode_b(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: call('Decode_b')
-  return __Decode_b(rBinStrm, Offset, rInsn, Mode);
+  return __Decode_b<Mode>(rBinStrm, Offset, rInsn);
 }
 
 /* decoder ["reg_d64_r('r10w', 'r10d', 'r10')"] */
-Expression::SPType X86Architecture::Decode_d64_r10(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+Expression::SPType X86Architecture::Decode_d64_r10(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: reg_d64_r('r10w', 'r10d', 'r10')
   switch (Mode)
@@ -5338,7 +5767,8 @@ Expression::SPType X86Architecture::Decode_d64_r10(BinaryStream const& rBinStrm,
 }
 
 /* decoder ["reg_d64_r('r11w', 'r11d', 'r11')"] */
-Expression::SPType X86Architecture::Decode_d64_r11(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+Expression::SPType X86Architecture::Decode_d64_r11(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: reg_d64_r('r11w', 'r11d', 'r11')
   switch (Mode)
@@ -5361,7 +5791,8 @@ Expression::SPType X86Architecture::Decode_d64_r11(BinaryStream const& rBinStrm,
 }
 
 /* decoder ["reg_d64_r('r12w', 'r12d', 'r12')"] */
-Expression::SPType X86Architecture::Decode_d64_r12(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+Expression::SPType X86Architecture::Decode_d64_r12(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: reg_d64_r('r12w', 'r12d', 'r12')
   switch (Mode)
@@ -5384,7 +5815,8 @@ Expression::SPType X86Architecture::Decode_d64_r12(BinaryStream const& rBinStrm,
 }
 
 /* decoder ["reg_d64_r('r13w', 'r13d', 'r13')"] */
-Expression::SPType X86Architecture::Decode_d64_r13(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+Expression::SPType X86Architecture::Decode_d64_r13(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: reg_d64_r('r13w', 'r13d', 'r13')
   switch (Mode)
@@ -5407,7 +5839,8 @@ Expression::SPType X86Architecture::Decode_d64_r13(BinaryStream const& rBinStrm,
 }
 
 /* decoder ["reg_d64_r('r14w', 'r14d', 'r14')"] */
-Expression::SPType X86Architecture::Decode_d64_r14(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+Expression::SPType X86Architecture::Decode_d64_r14(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: reg_d64_r('r14w', 'r14d', 'r14')
   switch (Mode)
@@ -5430,7 +5863,8 @@ Expression::SPType X86Architecture::Decode_d64_r14(BinaryStream const& rBinStrm,
 }
 
 /* decoder ["reg_d64_r('r15w', 'r15d', 'r15')"] */
-Expression::SPType X86Architecture::Decode_d64_r15(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+Expression::SPType X86Architecture::Decode_d64_r15(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: reg_d64_r('r15w', 'r15d', 'r15')
   switch (Mode)
@@ -5453,7 +5887,8 @@ Expression::SPType X86Architecture::Decode_d64_r15(BinaryStream const& rBinStrm,
 }
 
 /* decoder ["reg_d64_r('r8w', 'r8d', 'r8')"] */
-Expression::SPType X86Architecture::Decode_d64_r8(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+Expression::SPType X86Architecture::Decode_d64_r8(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: reg_d64_r('r8w', 'r8d', 'r8')
   switch (Mode)
@@ -5476,7 +5911,8 @@ Expression::SPType X86Architecture::Decode_d64_r8(BinaryStream const& rBinStrm,
 }
 
 /* decoder ["reg_d64_r('r9w', 'r9d', 'r9')"] */
-Expression::SPType X86Architecture::Decode_d64_r9(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+Expression::SPType X86Architecture::Decode_d64_r9(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: reg_d64_r('r9w', 'r9d', 'r9')
   switch (Mode)
@@ -5499,7 +5935,8 @@ Expression::SPType X86Architecture::Decode_d64_r9(BinaryStream const& rBinStrm,
 }
 
 /* decoder ["reg_d64_r('ax', 'eax', 'rax')"] */
-Expression::SPType X86Architecture::Decode_d64_rAX(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+Expression::SPType X86Architecture::Decode_d64_rAX(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: reg_d64_r('ax', 'eax', 'rax')
   switch (Mode)
@@ -5522,7 +5959,8 @@ Expression::SPType X86Architecture::Decode_d64_rAX(BinaryStream const& rBinStrm,
 }
 
 /* decoder ["reg_d64_r('bp', 'ebp', 'rbp')"] */
-Expression::SPType X86Architecture::Decode_d64_rBP(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+Expression::SPType X86Architecture::Decode_d64_rBP(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: reg_d64_r('bp', 'ebp', 'rbp')
   switch (Mode)
@@ -5545,7 +5983,8 @@ Expression::SPType X86Architecture::Decode_d64_rBP(BinaryStream const& rBinStrm,
 }
 
 /* decoder ["reg_d64_r('bx', 'ebx', 'rbx')"] */
-Expression::SPType X86Architecture::Decode_d64_rBX(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+Expression::SPType X86Architecture::Decode_d64_rBX(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: reg_d64_r('bx', 'ebx', 'rbx')
   switch (Mode)
@@ -5568,7 +6007,8 @@ Expression::SPType X86Architecture::Decode_d64_rBX(BinaryStream const& rBinStrm,
 }
 
 /* decoder ["reg_d64_r('cx', 'ecx', 'rcx')"] */
-Expression::SPType X86Architecture::Decode_d64_rCX(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+Expression::SPType X86Architecture::Decode_d64_rCX(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: reg_d64_r('cx', 'ecx', 'rcx')
   switch (Mode)
@@ -5591,7 +6031,8 @@ Expression::SPType X86Architecture::Decode_d64_rCX(BinaryStream const& rBinStrm,
 }
 
 /* decoder ["reg_d64_r('di', 'edi', 'rdi')"] */
-Expression::SPType X86Architecture::Decode_d64_rDI(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+Expression::SPType X86Architecture::Decode_d64_rDI(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: reg_d64_r('di', 'edi', 'rdi')
   switch (Mode)
@@ -5614,7 +6055,8 @@ Expression::SPType X86Architecture::Decode_d64_rDI(BinaryStream const& rBinStrm,
 }
 
 /* decoder ["reg_d64_r('dx', 'edx', 'rdx')"] */
-Expression::SPType X86Architecture::Decode_d64_rDX(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+Expression::SPType X86Architecture::Decode_d64_rDX(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: reg_d64_r('dx', 'edx', 'rdx')
   switch (Mode)
@@ -5637,7 +6079,8 @@ Expression::SPType X86Architecture::Decode_d64_rDX(BinaryStream const& rBinStrm,
 }
 
 /* decoder ["reg_d64_r('si', 'esi', 'rsi')"] */
-Expression::SPType X86Architecture::Decode_d64_rSI(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+Expression::SPType X86Architecture::Decode_d64_rSI(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: reg_d64_r('si', 'esi', 'rsi')
   switch (Mode)
@@ -5660,7 +6103,8 @@ Expression::SPType X86Architecture::Decode_d64_rSI(BinaryStream const& rBinStrm,
 }
 
 /* decoder ["reg_d64_r('sp', 'esp', 'rsp')"] */
-Expression::SPType X86Architecture::Decode_d64_rSP(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+Expression::SPType X86Architecture::Decode_d64_rSP(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: reg_d64_r('sp', 'esp', 'rsp')
   switch (Mode)
@@ -5683,7 +6127,8 @@ Expression::SPType X86Architecture::Decode_d64_rSP(BinaryStream const& rBinStrm,
 }
 
 /* decoder ["reg_z('ax', 'eax')"] */
-Expression::SPType X86Architecture::Decode_eAX(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+Expression::SPType X86Architecture::Decode_eAX(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: reg_z('ax', 'eax')
   switch (Mode)
@@ -5705,7 +6150,8 @@ Expression::SPType X86Architecture::Decode_eAX(BinaryStream const& rBinStrm, Off
 }
 
 /* decoder ["reg_z('bp', 'ebp')"] */
-Expression::SPType X86Architecture::Decode_eBP(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+Expression::SPType X86Architecture::Decode_eBP(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: reg_z('bp', 'ebp')
   switch (Mode)
@@ -5727,7 +6173,8 @@ Expression::SPType X86Architecture::Decode_eBP(BinaryStream const& rBinStrm, Off
 }
 
 /* decoder ["reg_z('bx', 'ebx')"] */
-Expression::SPType X86Architecture::Decode_eBX(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+Expression::SPType X86Architecture::Decode_eBX(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: reg_z('bx', 'ebx')
   switch (Mode)
@@ -5749,7 +6196,8 @@ Expression::SPType X86Architecture::Decode_eBX(BinaryStream const& rBinStrm, Off
 }
 
 /* decoder ["reg_z('cx', 'ecx')"] */
-Expression::SPType X86Architecture::Decode_eCX(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+Expression::SPType X86Architecture::Decode_eCX(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: reg_z('cx', 'ecx')
   switch (Mode)
@@ -5771,7 +6219,8 @@ Expression::SPType X86Architecture::Decode_eCX(BinaryStream const& rBinStrm, Off
 }
 
 /* decoder ["reg_z('di', 'edi')"] */
-Expression::SPType X86Architecture::Decode_eDI(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+Expression::SPType X86Architecture::Decode_eDI(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: reg_z('di', 'edi')
   switch (Mode)
@@ -5793,7 +6242,8 @@ Expression::SPType X86Architecture::Decode_eDI(BinaryStream const& rBinStrm, Off
 }
 
 /* decoder ["reg_z('dx', 'edx')"] */
-Expression::SPType X86Architecture::Decode_eDX(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+Expression::SPType X86Architecture::Decode_eDX(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: reg_z('dx', 'edx')
   switch (Mode)
@@ -5815,7 +6265,8 @@ Expression::SPType X86Architecture::Decode_eDX(BinaryStream const& rBinStrm, Off
 }
 
 /* decoder ["reg_z('si', 'esi')"] */
-Expression::SPType X86Architecture::Decode_eSI(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+Expression::SPType X86Architecture::Decode_eSI(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: reg_z('si', 'esi')
   switch (Mode)
@@ -5837,7 +6288,8 @@ Expression::SPType X86Architecture::Decode_eSI(BinaryStream const& rBinStrm, Off
 }
 
 /* decoder ["reg_z('sp', 'esp')"] */
-Expression::SPType X86Architecture::Decode_eSP(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+Expression::SPType X86Architecture::Decode_eSP(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: reg_z('sp', 'esp')
   switch (Mode)
@@ -5859,63 +6311,72 @@ Expression::SPType X86Architecture::Decode_eSP(BinaryStream const& rBinStrm, Off
 }
 
 /* decoder ["call('Decode_m16int')"] */
-Expression::SPType X86Architecture::Decode_m16int(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+Expression::SPType X86Architecture::Decode_m16int(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: call('Decode_m16int')
-  return __Decode_m16int(rBinStrm, Offset, rInsn, Mode);
+  return __Decode_m16int<Mode>(rBinStrm, Offset, rInsn);
 }
 
 /* decoder ["call('Decode_m32fp')"] */
-Expression::SPType X86Architecture::Decode_m32fp(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+Expression::SPType X86Architecture::Decode_m32fp(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: call('Decode_m32fp')
-  return __Decode_m32fp(rBinStrm, Offset, rInsn, Mode);
+  return __Decode_m32fp<Mode>(rBinStrm, Offset, rInsn);
 }
 
 /* decoder ["call('Decode_m32int')"] */
-Expression::SPType X86Architecture::Decode_m32int(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+Expression::SPType X86Architecture::Decode_m32int(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: call('Decode_m32int')
-  return __Decode_m32int(rBinStrm, Offset, rInsn, Mode);
+  return __Decode_m32int<Mode>(rBinStrm, Offset, rInsn);
 }
 
 /* decoder ["call('Decode_m64fp')"] */
-Expression::SPType X86Architecture::Decode_m64fp(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+Expression::SPType X86Architecture::Decode_m64fp(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: call('Decode_m64fp')
-  return __Decode_m64fp(rBinStrm, Offset, rInsn, Mode);
+  return __Decode_m64fp<Mode>(rBinStrm, Offset, rInsn);
 }
 
 /* decoder ["call('Decode_m64int')"] */
-Expression::SPType X86Architecture::Decode_m64int(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+Expression::SPType X86Architecture::Decode_m64int(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: call('Decode_m64int')
-  return __Decode_m64int(rBinStrm, Offset, rInsn, Mode);
+  return __Decode_m64int<Mode>(rBinStrm, Offset, rInsn);
 }
 
 /* decoder ["call('Decode_m80bcd')"] */
-Expression::SPType X86Architecture::Decode_m80bcd(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+Expression::SPType X86Architecture::Decode_m80bcd(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: call('Decode_m80bcd')
-  return __Decode_m80bcd(rBinStrm, Offset, rInsn, Mode);
+  return __Decode_m80bcd<Mode>(rBinStrm, Offset, rInsn);
 }
 
 /* decoder ["call('Decode_m80dec')"] */
-Expression::SPType X86Architecture::Decode_m80dec(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+Expression::SPType X86Architecture::Decode_m80dec(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: call('Decode_m80dec')
-  return __Decode_m80dec(rBinStrm, Offset, rInsn, Mode);
+  return __Decode_m80dec<Mode>(rBinStrm, Offset, rInsn);
 }
 
 /* decoder ["call('Decode_m80fp')"] */
-Expression::SPType X86Architecture::Decode_m80fp(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+Expression::SPType X86Architecture::Decode_m80fp(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: call('Decode_m80fp')
-  return __Decode_m80fp(rBinStrm, Offset, rInsn, Mode);
+  return __Decode_m80fp<Mode>(rBinStrm, Offset, rInsn);
 }
 
 /* decoder ["reg_v('r10w', 'r10d', 'r10')"] */
-Expression::SPType X86Architecture::Decode_r10(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+Expression::SPType X86Architecture::Decode_r10(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: reg_v('r10w', 'r10d', 'r10')
   switch (Mode)
@@ -5940,14 +6401,16 @@ Expression::SPType X86Architecture::Decode_r10(BinaryStream const& rBinStrm, Off
 }
 
 /* decoder ["reg('r10b')"] */
-Expression::SPType X86Architecture::Decode_r10b(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+Expression::SPType X86Architecture::Decode_r10b(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: reg('r10b')
   return Expr::MakeId(X86_Reg_R10b, &m_CpuInfo);
 }
 
 /* decoder ["reg_v('r11w', 'r11d', 'r11')"] */
-Expression::SPType X86Architecture::Decode_r11(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+Expression::SPType X86Architecture::Decode_r11(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: reg_v('r11w', 'r11d', 'r11')
   switch (Mode)
@@ -5972,14 +6435,16 @@ Expression::SPType X86Architecture::Decode_r11(BinaryStream const& rBinStrm, Off
 }
 
 /* decoder ["reg('r11b')"] */
-Expression::SPType X86Architecture::Decode_r11b(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+Expression::SPType X86Architecture::Decode_r11b(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: reg('r11b')
   return Expr::MakeId(X86_Reg_R11b, &m_CpuInfo);
 }
 
 /* decoder ["reg_v('r12w', 'r12d', 'r12')"] */
-Expression::SPType X86Architecture::Decode_r12(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+Expression::SPType X86Architecture::Decode_r12(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: reg_v('r12w', 'r12d', 'r12')
   switch (Mode)
@@ -6004,14 +6469,16 @@ Expression::SPType X86Architecture::Decode_r12(BinaryStream const& rBinStrm, Off
 }
 
 /* decoder ["reg('r12b')"] */
-Expression::SPType X86Architecture::Decode_r12b(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+Expression::SPType X86Architecture::Decode_r12b(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: reg('r12b')
   return Expr::MakeId(X86_Reg_R12b, &m_CpuInfo);
 }
 
 /* decoder ["reg_v('r13w', 'r13d', 'r13')"] */
-Expression::SPType X86Architecture::Decode_r13(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+Expression::SPType X86Architecture::Decode_r13(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: reg_v('r13w', 'r13d', 'r13')
   switch (Mode)
@@ -6036,14 +6503,16 @@ Expression::SPType X86Architecture::Decode_r13(BinaryStream const& rBinStrm, Off
 }
 
 /* decoder ["reg('r13b')"] */
-Expression::SPType X86Architecture::Decode_r13b(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+Expression::SPType X86Architecture::Decode_r13b(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: reg('r13b')
   return Expr::MakeId(X86_Reg_R13b, &m_CpuInfo);
 }
 
 /* decoder ["reg_v('r14w', 'r14d', 'r14')"] */
-Expression::SPType X86Architecture::Decode_r14(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+Expression::SPType X86Architecture::Decode_r14(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: reg_v('r14w', 'r14d', 'r14')
   switch (Mode)
@@ -6068,14 +6537,16 @@ Expression::SPType X86Architecture::Decode_r14(BinaryStream const& rBinStrm, Off
 }
 
 /* decoder ["reg('r14b')"] */
-Expression::SPType X86Architecture::Decode_r14b(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+Expression::SPType X86Architecture::Decode_r14b(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: reg('r14b')
   return Expr::MakeId(X86_Reg_R14b, &m_CpuInfo);
 }
 
 /* decoder ["reg_v('r15w', 'r15d', 'r15')"] */
-Expression::SPType X86Architecture::Decode_r15(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+Expression::SPType X86Architecture::Decode_r15(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: reg_v('r15w', 'r15d', 'r15')
   switch (Mode)
@@ -6100,14 +6571,16 @@ Expression::SPType X86Architecture::Decode_r15(BinaryStream const& rBinStrm, Off
 }
 
 /* decoder ["reg('r15b')"] */
-Expression::SPType X86Architecture::Decode_r15b(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+Expression::SPType X86Architecture::Decode_r15b(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: reg('r15b')
   return Expr::MakeId(X86_Reg_R15b, &m_CpuInfo);
 }
 
 /* decoder ["reg_v('r8w', 'r8d', 'r8')"] */
-Expression::SPType X86Architecture::Decode_r8(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+Expression::SPType X86Architecture::Decode_r8(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: reg_v('r8w', 'r8d', 'r8')
   switch (Mode)
@@ -6132,14 +6605,16 @@ Expression::SPType X86Architecture::Decode_r8(BinaryStream const& rBinStrm, Offs
 }
 
 /* decoder ["reg('r8b')"] */
-Expression::SPType X86Architecture::Decode_r8b(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+Expression::SPType X86Architecture::Decode_r8b(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: reg('r8b')
   return Expr::MakeId(X86_Reg_R8b, &m_CpuInfo);
 }
 
 /* decoder ["reg_v('r9w', 'r9d', 'r9')"] */
-Expression::SPType X86Architecture::Decode_r9(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+Expression::SPType X86Architecture::Decode_r9(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: reg_v('r9w', 'r9d', 'r9')
   switch (Mode)
@@ -6164,14 +6639,16 @@ Expression::SPType X86Architecture::Decode_r9(BinaryStream const& rBinStrm, Offs
 }
 
 /* decoder ["reg('r9b')"] */
-Expression::SPType X86Architecture::Decode_r9b(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+Expression::SPType X86Architecture::Decode_r9b(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: reg('r9b')
   return Expr::MakeId(X86_Reg_R9b, &m_CpuInfo);
 }
 
 /* decoder ["reg_v('ax', 'eax', 'rax')"] */
-Expression::SPType X86Architecture::Decode_rAX(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+Expression::SPType X86Architecture::Decode_rAX(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: reg_v('ax', 'eax', 'rax')
   switch (Mode)
@@ -6196,7 +6673,8 @@ Expression::SPType X86Architecture::Decode_rAX(BinaryStream const& rBinStrm, Off
 }
 
 /* decoder ["reg_v('bp', 'ebp', 'rbp')"] */
-Expression::SPType X86Architecture::Decode_rBP(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+Expression::SPType X86Architecture::Decode_rBP(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: reg_v('bp', 'ebp', 'rbp')
   switch (Mode)
@@ -6221,7 +6699,8 @@ Expression::SPType X86Architecture::Decode_rBP(BinaryStream const& rBinStrm, Off
 }
 
 /* decoder ["reg_v('bx', 'ebx', 'rbx')"] */
-Expression::SPType X86Architecture::Decode_rBX(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+Expression::SPType X86Architecture::Decode_rBX(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: reg_v('bx', 'ebx', 'rbx')
   switch (Mode)
@@ -6246,7 +6725,8 @@ Expression::SPType X86Architecture::Decode_rBX(BinaryStream const& rBinStrm, Off
 }
 
 /* decoder ["reg_v('cx', 'ecx', 'rcx')"] */
-Expression::SPType X86Architecture::Decode_rCX(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+Expression::SPType X86Architecture::Decode_rCX(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: reg_v('cx', 'ecx', 'rcx')
   switch (Mode)
@@ -6271,7 +6751,8 @@ Expression::SPType X86Architecture::Decode_rCX(BinaryStream const& rBinStrm, Off
 }
 
 /* decoder ["reg_v('di', 'edi', 'rdi')"] */
-Expression::SPType X86Architecture::Decode_rDI(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+Expression::SPType X86Architecture::Decode_rDI(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: reg_v('di', 'edi', 'rdi')
   switch (Mode)
@@ -6296,7 +6777,8 @@ Expression::SPType X86Architecture::Decode_rDI(BinaryStream const& rBinStrm, Off
 }
 
 /* decoder ["reg_v('dx', 'edx', 'rdx')"] */
-Expression::SPType X86Architecture::Decode_rDX(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+Expression::SPType X86Architecture::Decode_rDX(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: reg_v('dx', 'edx', 'rdx')
   switch (Mode)
@@ -6321,7 +6803,8 @@ Expression::SPType X86Architecture::Decode_rDX(BinaryStream const& rBinStrm, Off
 }
 
 /* decoder ["reg_v('si', 'esi', 'rsi')"] */
-Expression::SPType X86Architecture::Decode_rSI(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+Expression::SPType X86Architecture::Decode_rSI(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: reg_v('si', 'esi', 'rsi')
   switch (Mode)
@@ -6346,7 +6829,8 @@ Expression::SPType X86Architecture::Decode_rSI(BinaryStream const& rBinStrm, Off
 }
 
 /* decoder ["reg_v('sp', 'esp', 'rsp')"] */
-Expression::SPType X86Architecture::Decode_rSP(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+Expression::SPType X86Architecture::Decode_rSP(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: reg_v('sp', 'esp', 'rsp')
   switch (Mode)
@@ -6371,24 +6855,27 @@ Expression::SPType X86Architecture::Decode_rSP(BinaryStream const& rBinStrm, Off
 }
 
 /* decoder ["call('Decode_w')"] */
-Expression::SPType X86Architecture::Decode_w(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+Expression::SPType X86Architecture::Decode_w(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: call('Decode_w')
-  return __Decode_w(rBinStrm, Offset, rInsn, Mode);
+  return __Decode_w<Mode>(rBinStrm, Offset, rInsn);
 }
 
 /* decoder ["call('Decode_x')"] */
-Expression::SPType X86Architecture::Decode_x(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+Expression::SPType X86Architecture::Decode_x(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: call('Decode_x')
-  return __Decode_x(rBinStrm, Offset, rInsn, Mode);
+  return __Decode_x<Mode>(rBinStrm, Offset, rInsn);
 }
 
 /* operand ['op0 = decode_eAX'] */
-bool X86Architecture::Operand__eAX(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Operand__eAX(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: op0 = decode_eAX
-  auto spOprd0 = Decode_eAX(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd0 = Decode_eAX<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd0 == nullptr)
     return false;
   rInsn.AddOperand(spOprd0);
@@ -6397,16 +6884,17 @@ bool X86Architecture::Operand__eAX(BinaryStream const& rBinStrm, OffsetType Offs
 }
 
 /* operand ['op0 = decode_eAX', 'op1 = decode_DX'] */
-bool X86Architecture::Operand__eAX_DX(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Operand__eAX_DX(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: op0 = decode_eAX
-  auto spOprd0 = Decode_eAX(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd0 = Decode_eAX<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd0 == nullptr)
     return false;
   rInsn.AddOperand(spOprd0);
 
   // operand1: op1 = decode_DX
-  auto spOprd1 = Decode_DX(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd1 = Decode_DX<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd1 == nullptr)
     return false;
   rInsn.AddOperand(spOprd1);
@@ -6415,16 +6903,17 @@ bool X86Architecture::Operand__eAX_DX(BinaryStream const& rBinStrm, OffsetType O
 }
 
 /* operand ['op0 = decode_eAX', 'op1 = decode_Ib'] */
-bool X86Architecture::Operand__eAX_Ib(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Operand__eAX_Ib(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: op0 = decode_eAX
-  auto spOprd0 = Decode_eAX(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd0 = Decode_eAX<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd0 == nullptr)
     return false;
   rInsn.AddOperand(spOprd0);
 
   // operand1: op1 = decode_Ib
-  auto spOprd1 = Decode_Ib(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd1 = Decode_Ib<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd1 == nullptr)
     return false;
   rInsn.AddOperand(spOprd1);
@@ -6433,10 +6922,11 @@ bool X86Architecture::Operand__eAX_Ib(BinaryStream const& rBinStrm, OffsetType O
 }
 
 /* operand ['op0 = decode_eBP'] */
-bool X86Architecture::Operand__eBP(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Operand__eBP(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: op0 = decode_eBP
-  auto spOprd0 = Decode_eBP(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd0 = Decode_eBP<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd0 == nullptr)
     return false;
   rInsn.AddOperand(spOprd0);
@@ -6445,10 +6935,11 @@ bool X86Architecture::Operand__eBP(BinaryStream const& rBinStrm, OffsetType Offs
 }
 
 /* operand ['op0 = decode_eBX'] */
-bool X86Architecture::Operand__eBX(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Operand__eBX(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: op0 = decode_eBX
-  auto spOprd0 = Decode_eBX(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd0 = Decode_eBX<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd0 == nullptr)
     return false;
   rInsn.AddOperand(spOprd0);
@@ -6457,10 +6948,11 @@ bool X86Architecture::Operand__eBX(BinaryStream const& rBinStrm, OffsetType Offs
 }
 
 /* operand ['op0 = decode_eCX'] */
-bool X86Architecture::Operand__eCX(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Operand__eCX(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: op0 = decode_eCX
-  auto spOprd0 = Decode_eCX(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd0 = Decode_eCX<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd0 == nullptr)
     return false;
   rInsn.AddOperand(spOprd0);
@@ -6469,10 +6961,11 @@ bool X86Architecture::Operand__eCX(BinaryStream const& rBinStrm, OffsetType Offs
 }
 
 /* operand ['op0 = decode_eDI'] */
-bool X86Architecture::Operand__eDI(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Operand__eDI(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: op0 = decode_eDI
-  auto spOprd0 = Decode_eDI(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd0 = Decode_eDI<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd0 == nullptr)
     return false;
   rInsn.AddOperand(spOprd0);
@@ -6481,10 +6974,11 @@ bool X86Architecture::Operand__eDI(BinaryStream const& rBinStrm, OffsetType Offs
 }
 
 /* operand ['op0 = decode_eDX'] */
-bool X86Architecture::Operand__eDX(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Operand__eDX(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: op0 = decode_eDX
-  auto spOprd0 = Decode_eDX(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd0 = Decode_eDX<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd0 == nullptr)
     return false;
   rInsn.AddOperand(spOprd0);
@@ -6493,10 +6987,11 @@ bool X86Architecture::Operand__eDX(BinaryStream const& rBinStrm, OffsetType Offs
 }
 
 /* operand ['op0 = decode_eSI'] */
-bool X86Architecture::Operand__eSI(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Operand__eSI(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: op0 = decode_eSI
-  auto spOprd0 = Decode_eSI(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd0 = Decode_eSI<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd0 == nullptr)
     return false;
   rInsn.AddOperand(spOprd0);
@@ -6505,10 +7000,11 @@ bool X86Architecture::Operand__eSI(BinaryStream const& rBinStrm, OffsetType Offs
 }
 
 /* operand ['op0 = decode_eSP'] */
-bool X86Architecture::Operand__eSP(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Operand__eSP(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: op0 = decode_eSP
-  auto spOprd0 = Decode_eSP(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd0 = Decode_eSP<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd0 == nullptr)
     return false;
   rInsn.AddOperand(spOprd0);
@@ -6517,10 +7013,11 @@ bool X86Architecture::Operand__eSP(BinaryStream const& rBinStrm, OffsetType Offs
 }
 
 /* operand ['op0 = decode_m16int'] */
-bool X86Architecture::Operand__m16int(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Operand__m16int(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: op0 = decode_m16int
-  auto spOprd0 = Decode_m16int(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd0 = Decode_m16int<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd0 == nullptr)
     return false;
   rInsn.AddOperand(spOprd0);
@@ -6529,10 +7026,11 @@ bool X86Architecture::Operand__m16int(BinaryStream const& rBinStrm, OffsetType O
 }
 
 /* operand ['op0 = decode_m32fp'] */
-bool X86Architecture::Operand__m32fp(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Operand__m32fp(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: op0 = decode_m32fp
-  auto spOprd0 = Decode_m32fp(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd0 = Decode_m32fp<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd0 == nullptr)
     return false;
   rInsn.AddOperand(spOprd0);
@@ -6541,10 +7039,11 @@ bool X86Architecture::Operand__m32fp(BinaryStream const& rBinStrm, OffsetType Of
 }
 
 /* operand ['op0 = decode_m32int'] */
-bool X86Architecture::Operand__m32int(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Operand__m32int(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: op0 = decode_m32int
-  auto spOprd0 = Decode_m32int(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd0 = Decode_m32int<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd0 == nullptr)
     return false;
   rInsn.AddOperand(spOprd0);
@@ -6553,10 +7052,11 @@ bool X86Architecture::Operand__m32int(BinaryStream const& rBinStrm, OffsetType O
 }
 
 /* operand ['op0 = decode_m64fp'] */
-bool X86Architecture::Operand__m64fp(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Operand__m64fp(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: op0 = decode_m64fp
-  auto spOprd0 = Decode_m64fp(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd0 = Decode_m64fp<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd0 == nullptr)
     return false;
   rInsn.AddOperand(spOprd0);
@@ -6565,10 +7065,11 @@ bool X86Architecture::Operand__m64fp(BinaryStream const& rBinStrm, OffsetType Of
 }
 
 /* operand ['op0 = decode_m64int'] */
-bool X86Architecture::Operand__m64int(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Operand__m64int(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: op0 = decode_m64int
-  auto spOprd0 = Decode_m64int(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd0 = Decode_m64int<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd0 == nullptr)
     return false;
   rInsn.AddOperand(spOprd0);
@@ -6577,10 +7078,11 @@ bool X86Architecture::Operand__m64int(BinaryStream const& rBinStrm, OffsetType O
 }
 
 /* operand ['op0 = decode_m80bcd'] */
-bool X86Architecture::Operand__m80bcd(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Operand__m80bcd(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: op0 = decode_m80bcd
-  auto spOprd0 = Decode_m80bcd(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd0 = Decode_m80bcd<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd0 == nullptr)
     return false;
   rInsn.AddOperand(spOprd0);
@@ -6589,10 +7091,11 @@ bool X86Architecture::Operand__m80bcd(BinaryStream const& rBinStrm, OffsetType O
 }
 
 /* operand ['op0 = decode_m80dec'] */
-bool X86Architecture::Operand__m80dec(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Operand__m80dec(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: op0 = decode_m80dec
-  auto spOprd0 = Decode_m80dec(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd0 = Decode_m80dec<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd0 == nullptr)
     return false;
   rInsn.AddOperand(spOprd0);
@@ -6601,10 +7104,11 @@ bool X86Architecture::Operand__m80dec(BinaryStream const& rBinStrm, OffsetType O
 }
 
 /* operand ['op0 = decode_m80fp'] */
-bool X86Architecture::Operand__m80fp(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Operand__m80fp(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: op0 = decode_m80fp
-  auto spOprd0 = Decode_m80fp(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd0 = Decode_m80fp<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd0 == nullptr)
     return false;
   rInsn.AddOperand(spOprd0);
@@ -6613,10 +7117,11 @@ bool X86Architecture::Operand__m80fp(BinaryStream const& rBinStrm, OffsetType Of
 }
 
 /* operand ['op0 = decode_r10'] */
-bool X86Architecture::Operand__r10(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Operand__r10(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: op0 = decode_r10
-  auto spOprd0 = Decode_r10(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd0 = Decode_r10<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd0 == nullptr)
     return false;
   rInsn.AddOperand(spOprd0);
@@ -6625,16 +7130,17 @@ bool X86Architecture::Operand__r10(BinaryStream const& rBinStrm, OffsetType Offs
 }
 
 /* operand ['op0 = decode_r10', 'op1 = decode_Iv'] */
-bool X86Architecture::Operand__r10_Iv(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Operand__r10_Iv(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: op0 = decode_r10
-  auto spOprd0 = Decode_r10(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd0 = Decode_r10<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd0 == nullptr)
     return false;
   rInsn.AddOperand(spOprd0);
 
   // operand1: op1 = decode_Iv
-  auto spOprd1 = Decode_Iv(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd1 = Decode_Iv<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd1 == nullptr)
     return false;
   rInsn.AddOperand(spOprd1);
@@ -6643,16 +7149,17 @@ bool X86Architecture::Operand__r10_Iv(BinaryStream const& rBinStrm, OffsetType O
 }
 
 /* operand ['op0 = decode_r10', 'op1 = decode_rAX'] */
-bool X86Architecture::Operand__r10_rAX(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Operand__r10_rAX(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: op0 = decode_r10
-  auto spOprd0 = Decode_r10(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd0 = Decode_r10<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd0 == nullptr)
     return false;
   rInsn.AddOperand(spOprd0);
 
   // operand1: op1 = decode_rAX
-  auto spOprd1 = Decode_rAX(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd1 = Decode_rAX<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd1 == nullptr)
     return false;
   rInsn.AddOperand(spOprd1);
@@ -6661,16 +7168,17 @@ bool X86Architecture::Operand__r10_rAX(BinaryStream const& rBinStrm, OffsetType
 }
 
 /* operand ['op0 = decode_r10b', 'op1 = decode_Ib'] */
-bool X86Architecture::Operand__r10b_Ib(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Operand__r10b_Ib(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: op0 = decode_r10b
-  auto spOprd0 = Decode_r10b(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd0 = Decode_r10b<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd0 == nullptr)
     return false;
   rInsn.AddOperand(spOprd0);
 
   // operand1: op1 = decode_Ib
-  auto spOprd1 = Decode_Ib(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd1 = Decode_Ib<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd1 == nullptr)
     return false;
   rInsn.AddOperand(spOprd1);
@@ -6679,10 +7187,11 @@ bool X86Architecture::Operand__r10b_Ib(BinaryStream const& rBinStrm, OffsetType
 }
 
 /* operand ['op0 = decode_r11'] */
-bool X86Architecture::Operand__r11(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Operand__r11(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: op0 = decode_r11
-  auto spOprd0 = Decode_r11(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd0 = Decode_r11<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd0 == nullptr)
     return false;
   rInsn.AddOperand(spOprd0);
@@ -6691,16 +7200,17 @@ bool X86Architecture::Operand__r11(BinaryStream const& rBinStrm, OffsetType Offs
 }
 
 /* operand ['op0 = decode_r11', 'op1 = decode_Iv'] */
-bool X86Architecture::Operand__r11_Iv(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Operand__r11_Iv(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: op0 = decode_r11
-  auto spOprd0 = Decode_r11(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd0 = Decode_r11<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd0 == nullptr)
     return false;
   rInsn.AddOperand(spOprd0);
 
   // operand1: op1 = decode_Iv
-  auto spOprd1 = Decode_Iv(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd1 = Decode_Iv<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd1 == nullptr)
     return false;
   rInsn.AddOperand(spOprd1);
@@ -6709,16 +7219,17 @@ bool X86Architecture::Operand__r11_Iv(BinaryStream const& rBinStrm, OffsetType O
 }
 
 /* operand ['op0 = decode_r11', 'op1 = decode_rAX'] */
-bool X86Architecture::Operand__r11_rAX(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Operand__r11_rAX(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: op0 = decode_r11
-  auto spOprd0 = Decode_r11(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd0 = Decode_r11<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd0 == nullptr)
     return false;
   rInsn.AddOperand(spOprd0);
 
   // operand1: op1 = decode_rAX
-  auto spOprd1 = Decode_rAX(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd1 = Decode_rAX<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd1 == nullptr)
     return false;
   rInsn.AddOperand(spOprd1);
@@ -6727,16 +7238,17 @@ bool X86Architecture::Operand__r11_rAX(BinaryStream const& rBinStrm, OffsetType
 }
 
 /* operand ['op0 = decode_r11b', 'op1 = decode_Ib'] */
-bool X86Architecture::Operand__r11b_Ib(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Operand__r11b_Ib(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: op0 = decode_r11b
-  auto spOprd0 = Decode_r11b(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd0 = Decode_r11b<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd0 == nullptr)
     return false;
   rInsn.AddOperand(spOprd0);
 
   // operand1: op1 = decode_Ib
-  auto spOprd1 = Decode_Ib(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd1 = Decode_Ib<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd1 == nullptr)
     return false;
   rInsn.AddOperand(spOprd1);
@@ -6745,10 +7257,11 @@ bool X86Architecture::Operand__r11b_Ib(BinaryStream const& rBinStrm, OffsetType
 }
 
 /* operand ['op0 = decode_r12'] */
-bool X86Architecture::Operand__r12(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Operand__r12(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: op0 = decode_r12
-  auto spOprd0 = Decode_r12(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd0 = Decode_r12<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd0 == nullptr)
     return false;
   rInsn.AddOperand(spOprd0);
@@ -6757,16 +7270,17 @@ bool X86Architecture::Operand__r12(BinaryStream const& rBinStrm, OffsetType Offs
 }
 
 /* operand ['op0 = decode_r12', 'op1 = decode_Iv'] */
-bool X86Architecture::Operand__r12_Iv(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Operand__r12_Iv(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: op0 = decode_r12
-  auto spOprd0 = Decode_r12(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd0 = Decode_r12<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd0 == nullptr)
     return false;
   rInsn.AddOperand(spOprd0);
 
   // operand1: op1 = decode_Iv
-  auto spOprd1 = Decode_Iv(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd1 = Decode_Iv<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd1 == nullptr)
     return false;
   rInsn.AddOperand(spOprd1);
@@ -6775,16 +7289,17 @@ bool X86Architecture::Operand__r12_Iv(BinaryStream const& rBinStrm, OffsetType O
 }
 
 /* operand ['op0 = decode_r12', 'op1 = decode_rAX'] */
-bool X86Architecture::Operand__r12_rAX(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Operand__r12_rAX(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: op0 = decode_r12
-  auto spOprd0 = Decode_r12(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd0 = Decode_r12<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd0 == nullptr)
     return false;
   rInsn.AddOperand(spOprd0);
 
   // operand1: op1 = decode_rAX
-  auto spOprd1 = Decode_rAX(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd1 = Decode_rAX<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd1 == nullptr)
     return false;
   rInsn.AddOperand(spOprd1);
@@ -6793,16 +7308,17 @@ bool X86Architecture::Operand__r12_rAX(BinaryStream const& rBinStrm, OffsetType
 }
 
 /* operand ['op0 = decode_r12b', 'op1 = decode_Ib'] */
-bool X86Architecture::Operand__r12b_Ib(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Operand__r12b_Ib(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: op0 = decode_r12b
-  auto spOprd0 = Decode_r12b(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd0 = Decode_r12b<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd0 == nullptr)
     return false;
   rInsn.AddOperand(spOprd0);
 
   // operand1: op1 = decode_Ib
-  auto spOprd1 = Decode_Ib(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd1 = Decode_Ib<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd1 == nullptr)
     return false;
   rInsn.AddOperand(spOprd1);
@@ -6811,10 +7327,11 @@ bool X86Architecture::Operand__r12b_Ib(BinaryStream const& rBinStrm, OffsetType
 }
 
 /* operand ['op0 = decode_r13'] */
-bool X86Architecture::Operand__r13(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Operand__r13(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: op0 = decode_r13
-  auto spOprd0 = Decode_r13(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd0 = Decode_r13<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd0 == nullptr)
     return false;
   rInsn.AddOperand(spOprd0);
@@ -6823,16 +7340,17 @@ bool X86Architecture::Operand__r13(BinaryStream const& rBinStrm, OffsetType Offs
 }
 
 /* operand ['op0 = decode_r13', 'op1 = decode_Iv'] */
-bool X86Architecture::Operand__r13_Iv(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Operand__r13_Iv(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: op0 = decode_r13
-  auto spOprd0 = Decode_r13(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd0 = Decode_r13<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd0 == nullptr)
     return false;
   rInsn.AddOperand(spOprd0);
 
   // operand1: op1 = decode_Iv
-  auto spOprd1 = Decode_Iv(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd1 = Decode_Iv<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd1 == nullptr)
     return false;
   rInsn.AddOperand(spOprd1);
@@ -6841,16 +7359,17 @@ bool X86Architecture::Operand__r13_Iv(BinaryStream const& rBinStrm, OffsetType O
 }
 
 /* operand ['op0 = decode_r13', 'op1 = decode_rAX'] */
-bool X86Architecture::Operand__r13_rAX(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Operand__r13_rAX(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: op0 = decode_r13
-  auto spOprd0 = Decode_r13(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd0 = Decode_r13<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd0 == nullptr)
     return false;
   rInsn.AddOperand(spOprd0);
 
   // operand1: op1 = decode_rAX
-  auto spOprd1 = Decode_rAX(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd1 = Decode_rAX<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd1 == nullptr)
     return false;
   rInsn.AddOperand(spOprd1);
@@ -6859,16 +7378,17 @@ bool X86Architecture::Operand__r13_rAX(BinaryStream const& rBinStrm, OffsetType
 }
 
 /* operand ['op0 = decode_r13b', 'op1 = decode_Ib'] */
-bool X86Architecture::Operand__r13b_Ib(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Operand__r13b_Ib(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: op0 = decode_r13b
-  auto spOprd0 = Decode_r13b(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd0 = Decode_r13b<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd0 == nullptr)
     return false;
   rInsn.AddOperand(spOprd0);
 
   // operand1: op1 = decode_Ib
-  auto spOprd1 = Decode_Ib(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd1 = Decode_Ib<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd1 == nullptr)
     return false;
   rInsn.AddOperand(spOprd1);
@@ -6877,10 +7397,11 @@ bool X86Architecture::Operand__r13b_Ib(BinaryStream const& rBinStrm, OffsetType
 }
 
 /* operand ['op0 = decode_r14'] */
-bool X86Architecture::Operand__r14(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Operand__r14(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: op0 = decode_r14
-  auto spOprd0 = Decode_r14(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd0 = Decode_r14<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd0 == nullptr)
     return false;
   rInsn.AddOperand(spOprd0);
@@ -6889,16 +7410,17 @@ bool X86Architecture::Operand__r14(BinaryStream const& rBinStrm, OffsetType Offs
 }
 
 /* operand ['op0 = decode_r14', 'op1 = decode_Iv'] */
-bool X86Architecture::Operand__r14_Iv(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Operand__r14_Iv(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: op0 = decode_r14
-  auto spOprd0 = Decode_r14(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd0 = Decode_r14<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd0 == nullptr)
     return false;
   rInsn.AddOperand(spOprd0);
 
   // operand1: op1 = decode_Iv
-  auto spOprd1 = Decode_Iv(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd1 = Decode_Iv<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd1 == nullptr)
     return false;
   rInsn.AddOperand(spOprd1);
@@ -6907,16 +7429,17 @@ bool X86Architecture::Operand__r14_Iv(BinaryStream const& rBinStrm, OffsetType O
 }
 
 /* operand ['op0 = decode_r14', 'op1 = decode_rAX'] */
-bool X86Architecture::Operand__r14_rAX(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Operand__r14_rAX(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: op0 = decode_r14
-  auto spOprd0 = Decode_r14(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd0 = Decode_r14<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd0 == nullptr)
     return false;
   rInsn.AddOperand(spOprd0);
 
   // operand1: op1 = decode_rAX
-  auto spOprd1 = Decode_rAX(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd1 = Decode_rAX<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd1 == nullptr)
     return false;
   rInsn.AddOperand(spOprd1);
@@ -6925,16 +7448,17 @@ bool X86Architecture::Operand__r14_rAX(BinaryStream const& rBinStrm, OffsetType
 }
 
 /* operand ['op0 = decode_r14b', 'op1 = decode_Ib'] */
-bool X86Architecture::Operand__r14b_Ib(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Operand__r14b_Ib(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: op0 = decode_r14b
-  auto spOprd0 = Decode_r14b(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd0 = Decode_r14b<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd0 == nullptr)
     return false;
   rInsn.AddOperand(spOprd0);
 
   // operand1: op1 = decode_Ib
-  auto spOprd1 = Decode_Ib(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd1 = Decode_Ib<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd1 == nullptr)
     return false;
   rInsn.AddOperand(spOprd1);
@@ -6943,10 +7467,11 @@ bool X86Architecture::Operand__r14b_Ib(BinaryStream const& rBinStrm, OffsetType
 }
 
 /* operand ['op0 = decode_r15'] */
-bool X86Architecture::Operand__r15(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Operand__r15(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: op0 = decode_r15
-  auto spOprd0 = Decode_r15(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd0 = Decode_r15<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd0 == nullptr)
     return false;
   rInsn.AddOperand(spOprd0);
@@ -6955,16 +7480,17 @@ bool X86Architecture::Operand__r15(BinaryStream const& rBinStrm, OffsetType Offs
 }
 
 /* operand ['op0 = decode_r15', 'op1 = decode_Iv'] */
-bool X86Architecture::Operand__r15_Iv(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Operand__r15_Iv(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: op0 = decode_r15
-  auto spOprd0 = Decode_r15(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd0 = Decode_r15<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd0 == nullptr)
     return false;
   rInsn.AddOperand(spOprd0);
 
   // operand1: op1 = decode_Iv
-  auto spOprd1 = Decode_Iv(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd1 = Decode_Iv<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd1 == nullptr)
     return false;
   rInsn.AddOperand(spOprd1);
@@ -6973,16 +7499,17 @@ bool X86Architecture::Operand__r15_Iv(BinaryStream const& rBinStrm, OffsetType O
 }
 
 /* operand ['op0 = decode_r15', 'op1 = decode_rAX'] */
-bool X86Architecture::Operand__r15_rAX(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Operand__r15_rAX(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: op0 = decode_r15
-  auto spOprd0 = Decode_r15(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd0 = Decode_r15<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd0 == nullptr)
     return false;
   rInsn.AddOperand(spOprd0);
 
   // operand1: op1 = decode_rAX
-  auto spOprd1 = Decode_rAX(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd1 = Decode_rAX<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd1 == nullptr)
     return false;
   rInsn.AddOperand(spOprd1);
@@ -6991,16 +7518,17 @@ bool X86Architecture::Operand__r15_rAX(BinaryStream const& rBinStrm, OffsetType
 }
 
 /* operand ['op0 = decode_r15b', 'op1 = decode_Ib'] */
-bool X86Architecture::Operand__r15b_Ib(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Operand__r15b_Ib(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: op0 = decode_r15b
-  auto spOprd0 = Decode_r15b(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd0 = Decode_r15b<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd0 == nullptr)
     return false;
   rInsn.AddOperand(spOprd0);
 
   // operand1: op1 = decode_Ib
-  auto spOprd1 = Decode_Ib(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd1 = Decode_Ib<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd1 == nullptr)
     return false;
   rInsn.AddOperand(spOprd1);
@@ -7009,10 +7537,11 @@ bool X86Architecture::Operand__r15b_Ib(BinaryStream const& rBinStrm, OffsetType
 }
 
 /* operand ['op0 = decode_r8'] */
-bool X86Architecture::Operand__r8(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Operand__r8(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: op0 = decode_r8
-  auto spOprd0 = Decode_r8(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd0 = Decode_r8<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd0 == nullptr)
     return false;
   rInsn.AddOperand(spOprd0);
@@ -7021,16 +7550,17 @@ bool X86Architecture::Operand__r8(BinaryStream const& rBinStrm, OffsetType Offse
 }
 
 /* operand ['op0 = decode_r8', 'op1 = decode_Iv'] */
-bool X86Architecture::Operand__r8_Iv(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Operand__r8_Iv(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: op0 = decode_r8
-  auto spOprd0 = Decode_r8(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd0 = Decode_r8<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd0 == nullptr)
     return false;
   rInsn.AddOperand(spOprd0);
 
   // operand1: op1 = decode_Iv
-  auto spOprd1 = Decode_Iv(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd1 = Decode_Iv<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd1 == nullptr)
     return false;
   rInsn.AddOperand(spOprd1);
@@ -7039,16 +7569,17 @@ bool X86Architecture::Operand__r8_Iv(BinaryStream const& rBinStrm, OffsetType Of
 }
 
 /* operand ['op0 = decode_r8', 'op1 = decode_rAX'] */
-bool X86Architecture::Operand__r8_rAX(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Operand__r8_rAX(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: op0 = decode_r8
-  auto spOprd0 = Decode_r8(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd0 = Decode_r8<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd0 == nullptr)
     return false;
   rInsn.AddOperand(spOprd0);
 
   // operand1: op1 = decode_rAX
-  auto spOprd1 = Decode_rAX(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd1 = Decode_rAX<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd1 == nullptr)
     return false;
   rInsn.AddOperand(spOprd1);
@@ -7057,16 +7588,17 @@ bool X86Architecture::Operand__r8_rAX(BinaryStream const& rBinStrm, OffsetType O
 }
 
 /* operand ['op0 = decode_r8b', 'op1 = decode_Ib'] */
-bool X86Architecture::Operand__r8b_Ib(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Operand__r8b_Ib(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: op0 = decode_r8b
-  auto spOprd0 = Decode_r8b(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd0 = Decode_r8b<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd0 == nullptr)
     return false;
   rInsn.AddOperand(spOprd0);
 
   // operand1: op1 = decode_Ib
-  auto spOprd1 = Decode_Ib(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd1 = Decode_Ib<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd1 == nullptr)
     return false;
   rInsn.AddOperand(spOprd1);
@@ -7075,10 +7607,11 @@ bool X86Architecture::Operand__r8b_Ib(BinaryStream const& rBinStrm, OffsetType O
 }
 
 /* operand ['op0 = decode_r9'] */
-bool X86Architecture::Operand__r9(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Operand__r9(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: op0 = decode_r9
-  auto spOprd0 = Decode_r9(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd0 = Decode_r9<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd0 == nullptr)
     return false;
   rInsn.AddOperand(spOprd0);
@@ -7087,16 +7620,17 @@ bool X86Architecture::Operand__r9(BinaryStream const& rBinStrm, OffsetType Offse
 }
 
 /* operand ['op0 = decode_r9', 'op1 = decode_Iv'] */
-bool X86Architecture::Operand__r9_Iv(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Operand__r9_Iv(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: op0 = decode_r9
-  auto spOprd0 = Decode_r9(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd0 = Decode_r9<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd0 == nullptr)
     return false;
   rInsn.AddOperand(spOprd0);
 
   // operand1: op1 = decode_Iv
-  auto spOprd1 = Decode_Iv(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd1 = Decode_Iv<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd1 == nullptr)
     return false;
   rInsn.AddOperand(spOprd1);
@@ -7105,16 +7639,17 @@ bool X86Architecture::Operand__r9_Iv(BinaryStream const& rBinStrm, OffsetType Of
 }
 
 /* operand ['op0 = decode_r9', 'op1 = decode_rAX'] */
-bool X86Architecture::Operand__r9_rAX(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Operand__r9_rAX(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: op0 = decode_r9
-  auto spOprd0 = Decode_r9(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd0 = Decode_r9<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd0 == nullptr)
     return false;
   rInsn.AddOperand(spOprd0);
 
   // operand1: op1 = decode_rAX
-  auto spOprd1 = Decode_rAX(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd1 = Decode_rAX<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd1 == nullptr)
     return false;
   rInsn.AddOperand(spOprd1);
@@ -7123,16 +7658,17 @@ bool X86Architecture::Operand__r9_rAX(BinaryStream const& rBinStrm, OffsetType O
 }
 
 /* operand ['op0 = decode_r9b', 'op1 = decode_Ib'] */
-bool X86Architecture::Operand__r9b_Ib(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Operand__r9b_Ib(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: op0 = decode_r9b
-  auto spOprd0 = Decode_r9b(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd0 = Decode_r9b<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd0 == nullptr)
     return false;
   rInsn.AddOperand(spOprd0);
 
   // operand1: op1 = decode_Ib
-  auto spOprd1 = Decode_Ib(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd1 = Decode_Ib<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd1 == nullptr)
     return false;
   rInsn.AddOperand(spOprd1);
@@ -7141,10 +7677,11 @@ bool X86Architecture::Operand__r9b_Ib(BinaryStream const& rBinStrm, OffsetType O
 }
 
 /* operand ['op0 = decode_rAX'] */
-bool X86Architecture::Operand__rAX(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Operand__rAX(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: op0 = decode_rAX
-  auto spOprd0 = Decode_rAX(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd0 = Decode_rAX<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd0 == nullptr)
     return false;
   rInsn.AddOperand(spOprd0);
@@ -7153,16 +7690,17 @@ bool X86Architecture::Operand__rAX(BinaryStream const& rBinStrm, OffsetType Offs
 }
 
 /* operand ['op0 = decode_rAX', 'op1 = decode_Iv'] */
-bool X86Architecture::Operand__rAX_Iv(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Operand__rAX_Iv(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: op0 = decode_rAX
-  auto spOprd0 = Decode_rAX(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd0 = Decode_rAX<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd0 == nullptr)
     return false;
   rInsn.AddOperand(spOprd0);
 
   // operand1: op1 = decode_Iv
-  auto spOprd1 = Decode_Iv(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd1 = Decode_Iv<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd1 == nullptr)
     return false;
   rInsn.AddOperand(spOprd1);
@@ -7171,16 +7709,17 @@ bool X86Architecture::Operand__rAX_Iv(BinaryStream const& rBinStrm, OffsetType O
 }
 
 /* operand ['op0 = decode_rAX', 'op1 = decode_Iz'] */
-bool X86Architecture::Operand__rAX_Iz(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Operand__rAX_Iz(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: op0 = decode_rAX
-  auto spOprd0 = Decode_rAX(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd0 = Decode_rAX<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd0 == nullptr)
     return false;
   rInsn.AddOperand(spOprd0);
 
   // operand1: op1 = decode_Iz
-  auto spOprd1 = Decode_Iz(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd1 = Decode_Iz<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd1 == nullptr)
     return false;
   rInsn.AddOperand(spOprd1);
@@ -7189,16 +7728,17 @@ bool X86Architecture::Operand__rAX_Iz(BinaryStream const& rBinStrm, OffsetType O
 }
 
 /* operand ['op0 = decode_rAX', 'op1 = decode_Ov'] */
-bool X86Architecture::Operand__rAX_Ov(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Operand__rAX_Ov(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: op0 = decode_rAX
-  auto spOprd0 = Decode_rAX(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd0 = Decode_rAX<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd0 == nullptr)
     return false;
   rInsn.AddOperand(spOprd0);
 
   // operand1: op1 = decode_Ov
-  auto spOprd1 = Decode_Ov(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd1 = Decode_Ov<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd1 == nullptr)
     return false;
   rInsn.AddOperand(spOprd1);
@@ -7207,16 +7747,17 @@ bool X86Architecture::Operand__rAX_Ov(BinaryStream const& rBinStrm, OffsetType O
 }
 
 /* operand ['op0 = decode_rAX', 'op1 = decode_Xv'] */
-bool X86Architecture::Operand__rAX_Xv(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Operand__rAX_Xv(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: op0 = decode_rAX
-  auto spOprd0 = Decode_rAX(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd0 = Decode_rAX<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd0 == nullptr)
     return false;
   rInsn.AddOperand(spOprd0);
 
   // operand1: op1 = decode_Xv
-  auto spOprd1 = Decode_Xv(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd1 = Decode_Xv<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd1 == nullptr)
     return false;
   rInsn.AddOperand(spOprd1);
@@ -7225,16 +7766,17 @@ bool X86Architecture::Operand__rAX_Xv(BinaryStream const& rBinStrm, OffsetType O
 }
 
 /* operand ['op0 = decode_rAX', 'op1 = decode_Yv'] */
-bool X86Architecture::Operand__rAX_Yv(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Operand__rAX_Yv(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: op0 = decode_rAX
-  auto spOprd0 = Decode_rAX(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd0 = Decode_rAX<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd0 == nullptr)
     return false;
   rInsn.AddOperand(spOprd0);
 
   // operand1: op1 = decode_Yv
-  auto spOprd1 = Decode_Yv(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd1 = Decode_Yv<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd1 == nullptr)
     return false;
   rInsn.AddOperand(spOprd1);
@@ -7243,10 +7785,11 @@ bool X86Architecture::Operand__rAX_Yv(BinaryStream const& rBinStrm, OffsetType O
 }
 
 /* operand ['op0 = decode_rBP'] */
-bool X86Architecture::Operand__rBP(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Operand__rBP(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: op0 = decode_rBP
-  auto spOprd0 = Decode_rBP(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd0 = Decode_rBP<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd0 == nullptr)
     return false;
   rInsn.AddOperand(spOprd0);
@@ -7255,16 +7798,17 @@ bool X86Architecture::Operand__rBP(BinaryStream const& rBinStrm, OffsetType Offs
 }
 
 /* operand ['op0 = decode_rBP', 'op1 = decode_Iv'] */
-bool X86Architecture::Operand__rBP_Iv(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Operand__rBP_Iv(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: op0 = decode_rBP
-  auto spOprd0 = Decode_rBP(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd0 = Decode_rBP<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd0 == nullptr)
     return false;
   rInsn.AddOperand(spOprd0);
 
   // operand1: op1 = decode_Iv
-  auto spOprd1 = Decode_Iv(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd1 = Decode_Iv<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd1 == nullptr)
     return false;
   rInsn.AddOperand(spOprd1);
@@ -7273,16 +7817,17 @@ bool X86Architecture::Operand__rBP_Iv(BinaryStream const& rBinStrm, OffsetType O
 }
 
 /* operand ['op0 = decode_rBP', 'op1 = decode_rAX'] */
-bool X86Architecture::Operand__rBP_rAX(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Operand__rBP_rAX(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: op0 = decode_rBP
-  auto spOprd0 = Decode_rBP(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd0 = Decode_rBP<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd0 == nullptr)
     return false;
   rInsn.AddOperand(spOprd0);
 
   // operand1: op1 = decode_rAX
-  auto spOprd1 = Decode_rAX(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd1 = Decode_rAX<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd1 == nullptr)
     return false;
   rInsn.AddOperand(spOprd1);
@@ -7291,10 +7836,11 @@ bool X86Architecture::Operand__rBP_rAX(BinaryStream const& rBinStrm, OffsetType
 }
 
 /* operand ['op0 = decode_rBX'] */
-bool X86Architecture::Operand__rBX(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Operand__rBX(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: op0 = decode_rBX
-  auto spOprd0 = Decode_rBX(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd0 = Decode_rBX<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd0 == nullptr)
     return false;
   rInsn.AddOperand(spOprd0);
@@ -7303,16 +7849,17 @@ bool X86Architecture::Operand__rBX(BinaryStream const& rBinStrm, OffsetType Offs
 }
 
 /* operand ['op0 = decode_rBX', 'op1 = decode_Iv'] */
-bool X86Architecture::Operand__rBX_Iv(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Operand__rBX_Iv(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: op0 = decode_rBX
-  auto spOprd0 = Decode_rBX(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd0 = Decode_rBX<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd0 == nullptr)
     return false;
   rInsn.AddOperand(spOprd0);
 
   // operand1: op1 = decode_Iv
-  auto spOprd1 = Decode_Iv(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd1 = Decode_Iv<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd1 == nullptr)
     return false;
   rInsn.AddOperand(spOprd1);
@@ -7321,16 +7868,17 @@ bool X86Architecture::Operand__rBX_Iv(BinaryStream const& rBinStrm, OffsetType O
 }
 
 /* operand ['op0 = decode_rBX', 'op1 = decode_rAX'] */
-bool X86Architecture::Operand__rBX_rAX(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Operand__rBX_rAX(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: op0 = decode_rBX
-  auto spOprd0 = Decode_rBX(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd0 = Decode_rBX<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd0 == nullptr)
     return false;
   rInsn.AddOperand(spOprd0);
 
   // operand1: op1 = decode_rAX
-  auto spOprd1 = Decode_rAX(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd1 = Decode_rAX<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd1 == nullptr)
     return false;
   rInsn.AddOperand(spOprd1);
@@ -7339,10 +7887,11 @@ bool X86Architecture::Operand__rBX_rAX(BinaryStream const& rBinStrm, OffsetType
 }
 
 /* operand ['op0 = decode_rCX'] */
-bool X86Architecture::Operand__rCX(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Operand__rCX(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: op0 = decode_rCX
-  auto spOprd0 = Decode_rCX(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd0 = Decode_rCX<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd0 == nullptr)
     return false;
   rInsn.AddOperand(spOprd0);
@@ -7351,16 +7900,17 @@ bool X86Architecture::Operand__rCX(BinaryStream const& rBinStrm, OffsetType Offs
 }
 
 /* operand ['op0 = decode_rCX', 'op1 = decode_Iv'] */
-bool X86Architecture::Operand__rCX_Iv(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Operand__rCX_Iv(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: op0 = decode_rCX
-  auto spOprd0 = Decode_rCX(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd0 = Decode_rCX<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd0 == nullptr)
     return false;
   rInsn.AddOperand(spOprd0);
 
   // operand1: op1 = decode_Iv
-  auto spOprd1 = Decode_Iv(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd1 = Decode_Iv<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd1 == nullptr)
     return false;
   rInsn.AddOperand(spOprd1);
@@ -7369,16 +7919,17 @@ bool X86Architecture::Operand__rCX_Iv(BinaryStream const& rBinStrm, OffsetType O
 }
 
 /* operand ['op0 = decode_rCX', 'op1 = decode_rAX'] */
-bool X86Architecture::Operand__rCX_rAX(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Operand__rCX_rAX(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: op0 = decode_rCX
-  auto spOprd0 = Decode_rCX(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd0 = Decode_rCX<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd0 == nullptr)
     return false;
   rInsn.AddOperand(spOprd0);
 
   // operand1: op1 = decode_rAX
-  auto spOprd1 = Decode_rAX(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd1 = Decode_rAX<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd1 == nullptr)
     return false;
   rInsn.AddOperand(spOprd1);
@@ -7387,10 +7938,11 @@ bool X86Architecture::Operand__rCX_rAX(BinaryStream const& rBinStrm, OffsetType
 }
 
 /* operand ['op0 = decode_rDI'] */
-bool X86Architecture::Operand__rDI(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Operand__rDI(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: op0 = decode_rDI
-  auto spOprd0 = Decode_rDI(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd0 = Decode_rDI<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd0 == nullptr)
     return false;
   rInsn.AddOperand(spOprd0);
@@ -7399,16 +7951,17 @@ bool X86Architecture::Operand__rDI(BinaryStream const& rBinStrm, OffsetType Offs
 }
 
 /* operand ['op0 = decode_rDI', 'op1 = decode_Iv'] */
-bool X86Architecture::Operand__rDI_Iv(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Operand__rDI_Iv(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: op0 = decode_rDI
-  auto spOprd0 = Decode_rDI(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd0 = Decode_rDI<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd0 == nullptr)
     return false;
   rInsn.AddOperand(spOprd0);
 
   // operand1: op1 = decode_Iv
-  auto spOprd1 = Decode_Iv(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd1 = Decode_Iv<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd1 == nullptr)
     return false;
   rInsn.AddOperand(spOprd1);
@@ -7417,16 +7970,17 @@ bool X86Architecture::Operand__rDI_Iv(BinaryStream const& rBinStrm, OffsetType O
 }
 
 /* operand ['op0 = decode_rDI', 'op1 = decode_rAX'] */
-bool X86Architecture::Operand__rDI_rAX(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Operand__rDI_rAX(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: op0 = decode_rDI
-  auto spOprd0 = Decode_rDI(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd0 = Decode_rDI<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd0 == nullptr)
     return false;
   rInsn.AddOperand(spOprd0);
 
   // operand1: op1 = decode_rAX
-  auto spOprd1 = Decode_rAX(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd1 = Decode_rAX<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd1 == nullptr)
     return false;
   rInsn.AddOperand(spOprd1);
@@ -7435,10 +7989,11 @@ bool X86Architecture::Operand__rDI_rAX(BinaryStream const& rBinStrm, OffsetType
 }
 
 /* operand ['op0 = decode_rDX'] */
-bool X86Architecture::Operand__rDX(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Operand__rDX(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: op0 = decode_rDX
-  auto spOprd0 = Decode_rDX(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd0 = Decode_rDX<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd0 == nullptr)
     return false;
   rInsn.AddOperand(spOprd0);
@@ -7447,16 +8002,17 @@ bool X86Architecture::Operand__rDX(BinaryStream const& rBinStrm, OffsetType Offs
 }
 
 /* operand ['op0 = decode_rDX', 'op1 = decode_Iv'] */
-bool X86Architecture::Operand__rDX_Iv(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Operand__rDX_Iv(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: op0 = decode_rDX
-  auto spOprd0 = Decode_rDX(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd0 = Decode_rDX<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd0 == nullptr)
     return false;
   rInsn.AddOperand(spOprd0);
 
   // operand1: op1 = decode_Iv
-  auto spOprd1 = Decode_Iv(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd1 = Decode_Iv<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd1 == nullptr)
     return false;
   rInsn.AddOperand(spOprd1);
@@ -7465,16 +8021,17 @@ bool X86Architecture::Operand__rDX_Iv(BinaryStream const& rBinStrm, OffsetType O
 }
 
 /* operand ['op0 = decode_rDX', 'op1 = decode_rAX'] */
-bool X86Architecture::Operand__rDX_rAX(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Operand__rDX_rAX(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: op0 = decode_rDX
-  auto spOprd0 = Decode_rDX(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd0 = Decode_rDX<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd0 == nullptr)
     return false;
   rInsn.AddOperand(spOprd0);
 
   // operand1: op1 = decode_rAX
-  auto spOprd1 = Decode_rAX(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd1 = Decode_rAX<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd1 == nullptr)
     return false;
   rInsn.AddOperand(spOprd1);
@@ -7483,10 +8040,11 @@ bool X86Architecture::Operand__rDX_rAX(BinaryStream const& rBinStrm, OffsetType
 }
 
 /* operand ['op0 = decode_rSI'] */
-bool X86Architecture::Operand__rSI(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Operand__rSI(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: op0 = decode_rSI
-  auto spOprd0 = Decode_rSI(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd0 = Decode_rSI<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd0 == nullptr)
     return false;
   rInsn.AddOperand(spOprd0);
@@ -7495,16 +8053,17 @@ bool X86Architecture::Operand__rSI(BinaryStream const& rBinStrm, OffsetType Offs
 }
 
 /* operand ['op0 = decode_rSI', 'op1 = decode_Iv'] */
-bool X86Architecture::Operand__rSI_Iv(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Operand__rSI_Iv(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: op0 = decode_rSI
-  auto spOprd0 = Decode_rSI(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd0 = Decode_rSI<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd0 == nullptr)
     return false;
   rInsn.AddOperand(spOprd0);
 
   // operand1: op1 = decode_Iv
-  auto spOprd1 = Decode_Iv(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd1 = Decode_Iv<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd1 == nullptr)
     return false;
   rInsn.AddOperand(spOprd1);
@@ -7513,16 +8072,17 @@ bool X86Architecture::Operand__rSI_Iv(BinaryStream const& rBinStrm, OffsetType O
 }
 
 /* operand ['op0 = decode_rSI', 'op1 = decode_rAX'] */
-bool X86Architecture::Operand__rSI_rAX(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Operand__rSI_rAX(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: op0 = decode_rSI
-  auto spOprd0 = Decode_rSI(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd0 = Decode_rSI<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd0 == nullptr)
     return false;
   rInsn.AddOperand(spOprd0);
 
   // operand1: op1 = decode_rAX
-  auto spOprd1 = Decode_rAX(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd1 = Decode_rAX<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd1 == nullptr)
     return false;
   rInsn.AddOperand(spOprd1);
@@ -7531,10 +8091,11 @@ bool X86Architecture::Operand__rSI_rAX(BinaryStream const& rBinStrm, OffsetType
 }
 
 /* operand ['op0 = decode_rSP'] */
-bool X86Architecture::Operand__rSP(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Operand__rSP(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: op0 = decode_rSP
-  auto spOprd0 = Decode_rSP(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd0 = Decode_rSP<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd0 == nullptr)
     return false;
   rInsn.AddOperand(spOprd0);
@@ -7543,16 +8104,17 @@ bool X86Architecture::Operand__rSP(BinaryStream const& rBinStrm, OffsetType Offs
 }
 
 /* operand ['op0 = decode_rSP', 'op1 = decode_Iv'] */
-bool X86Architecture::Operand__rSP_Iv(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Operand__rSP_Iv(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: op0 = decode_rSP
-  auto spOprd0 = Decode_rSP(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd0 = Decode_rSP<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd0 == nullptr)
     return false;
   rInsn.AddOperand(spOprd0);
 
   // operand1: op1 = decode_Iv
-  auto spOprd1 = Decode_Iv(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd1 = Decode_Iv<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd1 == nullptr)
     return false;
   rInsn.AddOperand(spOprd1);
@@ -7561,20 +8123,329 @@ bool X86Architecture::Operand__rSP_Iv(BinaryStream const& rBinStrm, OffsetType O
 }
 
 /* operand ['op0 = decode_rSP', 'op1 = decode_rAX'] */
-bool X86Architecture::Operand__rSP_rAX(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Operand__rSP_rAX(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn)
 {
   // operand0: op0 = decode_rSP
-  auto spOprd0 = Decode_rSP(rBinStrm, Offset, rInsn, Mode);
+  auto spOprd0 = Decode_rSP<Mode>(rBinStrm, Offset, rInsn);
   if (spOprd0 == nullptr)
     return false;
   rInsn.AddOperand(spOprd0);
 
   // operand1: op1 = decode_rAX
-  auto spOprd1 = Decode_rAX(rBinStrm, Offset, rInsn, Mode);
-  if (spOprd1 == nullptr)
-    return false;
-  rInsn.AddOperand(spOprd1);
-
-  return true;
-}
-
+  auto spOprd1 = Decode_rAX<Mode>(rBinStrm, Offset, rInsn);
+  if (spOprd1 == nullptr)
+    return false;
+  rInsn.AddOperand(spOprd1);
+
+  return true;
+}
+
+X86_INSTANTIATE_DISASSEMBLER(Operand__3);
+X86_INSTANTIATE_DISASSEMBLER(Operand__AH_Ib);
+X86_INSTANTIATE_DISASSEMBLER(Operand__AL_DX);
+X86_INSTANTIATE_DISASSEMBLER(Operand__AL_Ib);
+X86_INSTANTIATE_DISASSEMBLER(Operand__AL_Ob);
+X86_INSTANTIATE_DISASSEMBLER(Operand__AL_Xb);
+X86_INSTANTIATE_DISASSEMBLER(Operand__AL_Yb);
+X86_INSTANTIATE_DISASSEMBLER(Operand__AX);
+X86_INSTANTIATE_DISASSEMBLER(Operand__Ap);
+X86_INSTANTIATE_DISASSEMBLER(Operand__BH_Ib);
+X86_INSTANTIATE_DISASSEMBLER(Operand__BL_Ib);
+X86_INSTANTIATE_DISASSEMBLER(Operand__By_Ey);
+X86_INSTANTIATE_DISASSEMBLER(Operand__By_Ey_Ib);
+X86_INSTANTIATE_DISASSEMBLER(Operand__CH_Ib);
+X86_INSTANTIATE_DISASSEMBLER(Operand__CL_Ib);
+X86_INSTANTIATE_DISASSEMBLER(Operand__CS);
+X86_INSTANTIATE_DISASSEMBLER(Operand__DH_Ib);
+X86_INSTANTIATE_DISASSEMBLER(Operand__DL_Ib);
+X86_INSTANTIATE_DISASSEMBLER(Operand__DS);
+X86_INSTANTIATE_DISASSEMBLER(Operand__DX_AL);
+X86_INSTANTIATE_DISASSEMBLER(Operand__DX_Xb);
+X86_INSTANTIATE_DISASSEMBLER(Operand__DX_Xz);
+X86_INSTANTIATE_DISASSEMBLER(Operand__DX_eAX);
+X86_INSTANTIATE_DISASSEMBLER(Operand__Dy_Ry);
+X86_INSTANTIATE_DISASSEMBLER(Operand__ES);
+X86_INSTANTIATE_DISASSEMBLER(Operand__Eb);
+X86_INSTANTIATE_DISASSEMBLER(Operand__Eb_1);
+X86_INSTANTIATE_DISASSEMBLER(Operand__Eb_CL);
+X86_INSTANTIATE_DISASSEMBLER(Operand__Eb_Gb);
+X86_INSTANTIATE_DISASSEMBLER(Operand__Eb_Ib);
+X86_INSTANTIATE_DISASSEMBLER(Operand__Ed);
+X86_INSTANTIATE_DISASSEMBLER(Operand__Ed_Vo);
+X86_INSTANTIATE_DISASSEMBLER(Operand__Ev);
+X86_INSTANTIATE_DISASSEMBLER(Operand__Ev_1);
+X86_INSTANTIATE_DISASSEMBLER(Operand__Ev_CL);
+X86_INSTANTIATE_DISASSEMBLER(Operand__Ev_Gv);
+X86_INSTANTIATE_DISASSEMBLER(Operand__Ev_Gv_CL);
+X86_INSTANTIATE_DISASSEMBLER(Operand__Ev_Gv_Ib);
+X86_INSTANTIATE_DISASSEMBLER(Operand__Ev_Ib);
+X86_INSTANTIATE_DISASSEMBLER(Operand__Ev_Ibs);
+X86_INSTANTIATE_DISASSEMBLER(Operand__Ev_Iz);
+X86_INSTANTIATE_DISASSEMBLER(Operand__Ew_Gw);
+X86_INSTANTIATE_DISASSEMBLER(Operand__Ew_Sw);
+X86_INSTANTIATE_DISASSEMBLER(Operand__Ey_Gy);
+X86_INSTANTIATE_DISASSEMBLER(Operand__Ey_Pq);
+X86_INSTANTIATE_DISASSEMBLER(Operand__Ey_Vo);
+X86_INSTANTIATE_DISASSEMBLER(Operand__Ey_Vo_Ib);
+X86_INSTANTIATE_DISASSEMBLER(Operand__Eyb_Vo_Ib);
+X86_INSTANTIATE_DISASSEMBLER(Operand__Eyw_Vo_Ib);
+X86_INSTANTIATE_DISASSEMBLER(Operand__FS);
+X86_INSTANTIATE_DISASSEMBLER(Operand__GS);
+X86_INSTANTIATE_DISASSEMBLER(Operand__Gb_Eb);
+X86_INSTANTIATE_DISASSEMBLER(Operand__Gb_Ev);
+X86_INSTANTIATE_DISASSEMBLER(Operand__Gv_Eb);
+X86_INSTANTIATE_DISASSEMBLER(Operand__Gv_Ed);
+X86_INSTANTIATE_DISASSEMBLER(Operand__Gv_Ev);
+X86_INSTANTIATE_DISASSEMBLER(Operand__Gv_Ev_Ibs);
+X86_INSTANTIATE_DISASSEMBLER(Operand__Gv_Ev_Iz);
+X86_INSTANTIATE_DISASSEMBLER(Operand__Gv_Ew);
+X86_INSTANTIATE_DISASSEMBLER(Operand__Gv_M);
+X86_INSTANTIATE_DISASSEMBLER(Operand__Gv_Ma);
+X86_INSTANTIATE_DISASSEMBLER(Operand__Gv_Mp);
+X86_INSTANTIATE_DISASSEMBLER(Operand__Gv_Mv);
+X86_INSTANTIATE_DISASSEMBLER(Operand__Gy_By_Ey);
+X86_INSTANTIATE_DISASSEMBLER(Operand__Gy_Eb);
+X86_INSTANTIATE_DISASSEMBLER(Operand__Gy_Ev);
+X86_INSTANTIATE_DISASSEMBLER(Operand__Gy_Ey);
+X86_INSTANTIATE_DISASSEMBLER(Operand__Gy_Ey_By);
+X86_INSTANTIATE_DISASSEMBLER(Operand__Gy_Nq);
+X86_INSTANTIATE_DISASSEMBLER(Operand__Gy_Nq_Ib);
+X86_INSTANTIATE_DISASSEMBLER(Operand__Gy_Uo);
+X86_INSTANTIATE_DISASSEMBLER(Operand__Gy_Uo_Ib);
+X86_INSTANTIATE_DISASSEMBLER(Operand__Gy_Ux);
+X86_INSTANTIATE_DISASSEMBLER(Operand__Gy_Wod);
+X86_INSTANTIATE_DISASSEMBLER(Operand__Gy_Woq);
+X86_INSTANTIATE_DISASSEMBLER(Operand__Hx_Hx_Wx);
+X86_INSTANTIATE_DISASSEMBLER(Operand__Hx_Ux_Ib);
+X86_INSTANTIATE_DISASSEMBLER(Operand__Ib);
+X86_INSTANTIATE_DISASSEMBLER(Operand__Ib_AL);
+X86_INSTANTIATE_DISASSEMBLER(Operand__Ib_eAX);
+X86_INSTANTIATE_DISASSEMBLER(Operand__Iw);
+X86_INSTANTIATE_DISASSEMBLER(Operand__Iw_Ib);
+X86_INSTANTIATE_DISASSEMBLER(Operand__Iz);
+X86_INSTANTIATE_DISASSEMBLER(Operand__Jb);
+X86_INSTANTIATE_DISASSEMBLER(Operand__Jz);
+X86_INSTANTIATE_DISASSEMBLER(Operand__M);
+X86_INSTANTIATE_DISASSEMBLER(Operand__Md);
+X86_INSTANTIATE_DISASSEMBLER(Operand__Md_Vo);
+X86_INSTANTIATE_DISASSEMBLER(Operand__Mp);
+X86_INSTANTIATE_DISASSEMBLER(Operand__Mq);
+X86_INSTANTIATE_DISASSEMBLER(Operand__Mq_Pq);
+X86_INSTANTIATE_DISASSEMBLER(Operand__Mq_Vo);
+X86_INSTANTIATE_DISASSEMBLER(Operand__Mv_Gv);
+X86_INSTANTIATE_DISASSEMBLER(Operand__Mw);
+X86_INSTANTIATE_DISASSEMBLER(Operand__Mx_Hx_Vx);
+X86_INSTANTIATE_DISASSEMBLER(Operand__Mx_Vx);
+X86_INSTANTIATE_DISASSEMBLER(Operand__My_Gy);
+X86_INSTANTIATE_DISASSEMBLER(Operand__Nq_Ib);
+X86_INSTANTIATE_DISASSEMBLER(Operand__Ob_AL);
+X86_INSTANTIATE_DISASSEMBLER(Operand__Ov_rAX);
+X86_INSTANTIATE_DISASSEMBLER(Operand__Pq_Ey);
+X86_INSTANTIATE_DISASSEMBLER(Operand__Pq_Mw_Ib);
+X86_INSTANTIATE_DISASSEMBLER(Operand__Pq_Nq);
+X86_INSTANTIATE_DISASSEMBLER(Operand__Pq_Qd);
+X86_INSTANTIATE_DISASSEMBLER(Operand__Pq_Qq);
+X86_INSTANTIATE_DISASSEMBLER(Operand__Pq_Qq_Ib);
+X86_INSTANTIATE_DISASSEMBLER(Operand__Pq_Uq);
+X86_INSTANTIATE_DISASSEMBLER(Operand__Pq_Wo);
+X86_INSTANTIATE_DISASSEMBLER(Operand__Pq_Woq);
+X86_INSTANTIATE_DISASSEMBLER(Operand__Qq_Pq);
+X86_INSTANTIATE_DISASSEMBLER(Operand__Rv);
+X86_INSTANTIATE_DISASSEMBLER(Operand__Ry);
+X86_INSTANTIATE_DISASSEMBLER(Operand__Ry_Cy);
+X86_INSTANTIATE_DISASSEMBLER(Operand__Ry_Dy);
+X86_INSTANTIATE_DISASSEMBLER(Operand__Ry_Ty);
+X86_INSTANTIATE_DISASSEMBLER(Operand__SS);
+X86_INSTANTIATE_DISASSEMBLER(Operand__ST0);
+X86_INSTANTIATE_DISASSEMBLER(Operand__ST0_ST0);
+X86_INSTANTIATE_DISASSEMBLER(Operand__ST0_ST1);
+X86_INSTANTIATE_DISASSEMBLER(Operand__ST0_ST2);
+X86_INSTANTIATE_DISASSEMBLER(Operand__ST0_ST3);
+X86_INSTANTIATE_DISASSEMBLER(Operand__ST0_ST4);
+X86_INSTANTIATE_DISASSEMBLER(Operand__ST0_ST5);
+X86_INSTANTIATE_DISASSEMBLER(Operand__ST0_ST6);
+X86_INSTANTIATE_DISASSEMBLER(Operand__ST0_ST7);
+X86_INSTANTIATE_DISASSEMBLER(Operand__ST1);
+X86_INSTANTIATE_DISASSEMBLER(Operand__ST1_ST0);
+X86_INSTANTIATE_DISASSEMBLER(Operand__ST2);
+X86_INSTANTIATE_DISASSEMBLER(Operand__ST2_ST0);
+X86_INSTANTIATE_DISASSEMBLER(Operand__ST3);
+X86_INSTANTIATE_DISASSEMBLER(Operand__ST3_ST0);
+X86_INSTANTIATE_DISASSEMBLER(Operand__ST4);
+X86_INSTANTIATE_DISASSEMBLER(Operand__ST4_ST0);
+X86_INSTANTIATE_DISASSEMBLER(Operand__ST5);
+X86_INSTANTIATE_DISASSEMBLER(Operand__ST5_ST0);
+X86_INSTANTIATE_DISASSEMBLER(Operand__ST6);
+X86_INSTANTIATE_DISASSEMBLER(Operand__ST6_ST0);
+X86_INSTANTIATE_DISASSEMBLER(Operand__ST7);
+X86_INSTANTIATE_DISASSEMBLER(Operand__ST7_ST0);
+X86_INSTANTIATE_DISASSEMBLER(Operand__Sw_Ew);
+X86_INSTANTIATE_DISASSEMBLER(Operand__Ty_Ry);
+X86_INSTANTIATE_DISASSEMBLER(Operand__Uo);
+X86_INSTANTIATE_DISASSEMBLER(Operand__Uo_Ib_Ib);
+X86_INSTANTIATE_DISASSEMBLER(Operand__Uo_Vod);
+X86_INSTANTIATE_DISASSEMBLER(Operand__Uo_Voq);
+X86_INSTANTIATE_DISASSEMBLER(Operand__Uoq_Vo);
+X86_INSTANTIATE_DISASSEMBLER(Operand__Ux_Ib);
+X86_INSTANTIATE_DISASSEMBLER(Operand__Vo_Ed);
+X86_INSTANTIATE_DISASSEMBLER(Operand__Vo_Edb_Ib);
+X86_INSTANTIATE_DISASSEMBLER(Operand__Vo_Ey);
+X86_INSTANTIATE_DISASSEMBLER(Operand__Vo_Ey_Ib);
+X86_INSTANTIATE_DISASSEMBLER(Operand__Vo_Ho_Edb_Ib);
+X86_INSTANTIATE_DISASSEMBLER(Operand__Vo_Ho_Ey);
+X86_INSTANTIATE_DISASSEMBLER(Operand__Vo_Ho_Ey_Ib);
+X86_INSTANTIATE_DISASSEMBLER(Operand__Vo_Ho_Mw_Ib);
+X86_INSTANTIATE_DISASSEMBLER(Operand__Vo_Ho_Uod_Ib);
+X86_INSTANTIATE_DISASSEMBLER(Operand__Vo_Ho_Uoq);
+X86_INSTANTIATE_DISASSEMBLER(Operand__Vo_Ho_Wd);
+X86_INSTANTIATE_DISASSEMBLER(Operand__Vo_Ho_Wo);
+X86_INSTANTIATE_DISASSEMBLER(Operand__Vo_Ho_Wo_Ib);
+X86_INSTANTIATE_DISASSEMBLER(Operand__Vo_Ho_Wod);
+X86_INSTANTIATE_DISASSEMBLER(Operand__Vo_Ho_Woq);
+X86_INSTANTIATE_DISASSEMBLER(Operand__Vo_Ho_Woq_Ib);
+X86_INSTANTIATE_DISASSEMBLER(Operand__Vo_Ho_Wq);
+X86_INSTANTIATE_DISASSEMBLER(Operand__Vo_Md_x_Ho);
+X86_INSTANTIATE_DISASSEMBLER(Operand__Vo_Mq);
+X86_INSTANTIATE_DISASSEMBLER(Operand__Vo_Mw_Ib);
+X86_INSTANTIATE_DISASSEMBLER(Operand__Vo_Nq);
+X86_INSTANTIATE_DISASSEMBLER(Operand__Vo_Uo);
+X86_INSTANTIATE_DISASSEMBLER(Operand__Vo_Uod);
+X86_INSTANTIATE_DISASSEMBLER(Operand__Vo_Uod_Ib);
+X86_INSTANTIATE_DISASSEMBLER(Operand__Vo_Uoq);
+X86_INSTANTIATE_DISASSEMBLER(Operand__Vo_Wo);
+X86_INSTANTIATE_DISASSEMBLER(Operand__Vo_Wo_Ib);
+X86_INSTANTIATE_DISASSEMBLER(Operand__Vo_Wod);
+X86_INSTANTIATE_DISASSEMBLER(Operand__Vo_Woq);
+X86_INSTANTIATE_DISASSEMBLER(Operand__Vo_Woq_Ib);
+X86_INSTANTIATE_DISASSEMBLER(Operand__Vo_Wow);
+X86_INSTANTIATE_DISASSEMBLER(Operand__Vo_Wx);
+X86_INSTANTIATE_DISASSEMBLER(Operand__Vx_Hx_Mx);
+X86_INSTANTIATE_DISASSEMBLER(Operand__Vx_Hx_Wx);
+X86_INSTANTIATE_DISASSEMBLER(Operand__Vx_Hx_Wx_Ib);
+X86_INSTANTIATE_DISASSEMBLER(Operand__Vx_Hx_Wx_Lx);
+X86_INSTANTIATE_DISASSEMBLER(Operand__Vx_Md_x_Hx);
+X86_INSTANTIATE_DISASSEMBLER(Operand__Vx_Mq_x_Hx);
+X86_INSTANTIATE_DISASSEMBLER(Operand__Vx_Mqo_Hx);
+X86_INSTANTIATE_DISASSEMBLER(Operand__Vx_Mx);
+X86_INSTANTIATE_DISASSEMBLER(Operand__Vx_Uo);
+X86_INSTANTIATE_DISASSEMBLER(Operand__Vx_Uo_b);
+X86_INSTANTIATE_DISASSEMBLER(Operand__Vx_Uo_w);
+X86_INSTANTIATE_DISASSEMBLER(Operand__Vx_Uod);
+X86_INSTANTIATE_DISASSEMBLER(Operand__Vx_Uoq);
+X86_INSTANTIATE_DISASSEMBLER(Operand__Vx_Woq);
+X86_INSTANTIATE_DISASSEMBLER(Operand__Vx_Wx);
+X86_INSTANTIATE_DISASSEMBLER(Operand__Vx_Wx_Ib);
+X86_INSTANTIATE_DISASSEMBLER(Operand__Vy_Hy_Wo_Ib);
+X86_INSTANTIATE_DISASSEMBLER(Operand__Vy_Hy_Wy);
+X86_INSTANTIATE_DISASSEMBLER(Operand__Vy_Hy_Wy_Ib);
+X86_INSTANTIATE_DISASSEMBLER(Operand__Vy_Uo);
+X86_INSTANTIATE_DISASSEMBLER(Operand__Vy_Uoq);
+X86_INSTANTIATE_DISASSEMBLER(Operand__Vy_Wod);
+X86_INSTANTIATE_DISASSEMBLER(Operand__Vy_Woo);
+X86_INSTANTIATE_DISASSEMBLER(Operand__Vy_Woq);
+X86_INSTANTIATE_DISASSEMBLER(Operand__Vy_Wy_Ib);
+X86_INSTANTIATE_DISASSEMBLER(Operand__Wo_Vy_Ib);
+X86_INSTANTIATE_DISASSEMBLER(Operand__Wob_Vo_Ib);
+X86_INSTANTIATE_DISASSEMBLER(Operand__Wod_Vo);
+X86_INSTANTIATE_DISASSEMBLER(Operand__Woq_Vo);
+X86_INSTANTIATE_DISASSEMBLER(Operand__Woqo_Vx_Ib);
+X86_INSTANTIATE_DISASSEMBLER(Operand__Wow_Vo_Ib);
+X86_INSTANTIATE_DISASSEMBLER(Operand__Wx_Vx);
+X86_INSTANTIATE_DISASSEMBLER(Operand__Xb_Yb);
+X86_INSTANTIATE_DISASSEMBLER(Operand__Xv_Yv);
+X86_INSTANTIATE_DISASSEMBLER(Operand__Yb_DX);
+X86_INSTANTIATE_DISASSEMBLER(Operand__Yz_DX);
+X86_INSTANTIATE_DISASSEMBLER(Operand__d64_r10);
+X86_INSTANTIATE_DISASSEMBLER(Operand__d64_r11);
+X86_INSTANTIATE_DISASSEMBLER(Operand__d64_r12);
+X86_INSTANTIATE_DISASSEMBLER(Operand__d64_r13);
+X86_INSTANTIATE_DISASSEMBLER(Operand__d64_r14);
+X86_INSTANTIATE_DISASSEMBLER(Operand__d64_r15);
+X86_INSTANTIATE_DISASSEMBLER(Operand__d64_r8);
+X86_INSTANTIATE_DISASSEMBLER(Operand__d64_r9);
+X86_INSTANTIATE_DISASSEMBLER(Operand__d64_rAX);
+X86_INSTANTIATE_DISASSEMBLER(Operand__d64_rBP);
+X86_INSTANTIATE_DISASSEMBLER(Operand__d64_rBX);
+X86_INSTANTIATE_DISASSEMBLER(Operand__d64_rCX);
+X86_INSTANTIATE_DISASSEMBLER(Operand__d64_rDI);
+X86_INSTANTIATE_DISASSEMBLER(Operand__d64_rDX);
+X86_INSTANTIATE_DISASSEMBLER(Operand__d64_rSI);
+X86_INSTANTIATE_DISASSEMBLER(Operand__d64_rSP);
+X86_INSTANTIATE_DISASSEMBLER(Operand__eAX);
+X86_INSTANTIATE_DISASSEMBLER(Operand__eAX_DX);
+X86_INSTANTIATE_DISASSEMBLER(Operand__eAX_Ib);
+X86_INSTANTIATE_DISASSEMBLER(Operand__eBP);
+X86_INSTANTIATE_DISASSEMBLER(Operand__eBX);
+X86_INSTANTIATE_DISASSEMBLER(Operand__eCX);
+X86_INSTANTIATE_DISASSEMBLER(Operand__eDI);
+X86_INSTANTIATE_DISASSEMBLER(Operand__eDX);
+X86_INSTANTIATE_DISASSEMBLER(Operand__eSI);
+X86_INSTANTIATE_DISASSEMBLER(Operand__eSP);
+X86_INSTANTIATE_DISASSEMBLER(Operand__m16int);
+X86_INSTANTIATE_DISASSEMBLER(Operand__m32fp);
+X86_INSTANTIATE_DISASSEMBLER(Operand__m32int);
+X86_INSTANTIATE_DISASSEMBLER(Operand__m64fp);
+X86_INSTANTIATE_DISASSEMBLER(Operand__m64int);
+X86_INSTANTIATE_DISASSEMBLER(Operand__m80bcd);
+X86_INSTANTIATE_DISASSEMBLER(Operand__m80dec);
+X86_INSTANTIATE_DISASSEMBLER(Operand__m80fp);
+X86_INSTANTIATE_DISASSEMBLER(Operand__r10);
+X86_INSTANTIATE_DISASSEMBLER(Operand__r10_Iv);
+X86_INSTANTIATE_DISASSEMBLER(Operand__r10_rAX);
+X86_INSTANTIATE_DISASSEMBLER(Operand__r10b_Ib);
+X86_INSTANTIATE_DISASSEMBLER(Operand__r11);
+X86_INSTANTIATE_DISASSEMBLER(Operand__r11_Iv);
+X86_INSTANTIATE_DISASSEMBLER(Operand__r11_rAX);
+X86_INSTANTIATE_DISASSEMBLER(Operand__r11b_Ib);
+X86_INSTANTIATE_DISASSEMBLER(Operand__r12);
+X86_INSTANTIATE_DISASSEMBLER(Operand__r12_Iv);
+X86_INSTANTIATE_DISASSEMBLER(Operand__r12_rAX);
+X86_INSTANTIATE_DISASSEMBLER(Operand__r12b_Ib);
+X86_INSTANTIATE_DISASSEMBLER(Operand__r13);
+X86_INSTANTIATE_DISASSEMBLER(Operand__r13_Iv);
+X86_INSTANTIATE_DISASSEMBLER(Operand__r13_rAX);
+X86_INSTANTIATE_DISASSEMBLER(Operand__r13b_Ib);
+X86_INSTANTIATE_DISASSEMBLER(Operand__r14);
+X86_INSTANTIATE_DISASSEMBLER(Operand__r14_Iv);
+X86_INSTANTIATE_DISASSEMBLER(Operand__r14_rAX);
+X86_INSTANTIATE_DISASSEMBLER(Operand__r14b_Ib);
+X86_INSTANTIATE_DISASSEMBLER(Operand__r15);
+X86_INSTANTIATE_DISASSEMBLER(Operand__r15_Iv);
+X86_INSTANTIATE_DISASSEMBLER(Operand__r15_rAX);
+X86_INSTANTIATE_DISASSEMBLER(Operand__r15b_Ib);
+X86_INSTANTIATE_DISASSEMBLER(Operand__r8);
+X86_INSTANTIATE_DISASSEMBLER(Operand__r8_Iv);
+X86_INSTANTIATE_DISASSEMBLER(Operand__r8_rAX);
+X86_INSTANTIATE_DISASSEMBLER(Operand__r8b_Ib);
+X86_INSTANTIATE_DISASSEMBLER(Operand__r9);
+X86_INSTANTIATE_DISASSEMBLER(Operand__r9_Iv);
+X86_INSTANTIATE_DISASSEMBLER(Operand__r9_rAX);
+X86_INSTANTIATE_DISASSEMBLER(Operand__r9b_Ib);
+X86_INSTANTIATE_DISASSEMBLER(Operand__rAX);
+X86_INSTANTIATE_DISASSEMBLER(Operand__rAX_Iv);
+X86_INSTANTIATE_DISASSEMBLER(Operand__rAX_Iz);
+X86_INSTANTIATE_DISASSEMBLER(Operand__rAX_Ov);
+X86_INSTANTIATE_DISASSEMBLER(Operand__rAX_Xv);
+X86_INSTANTIATE_DISASSEMBLER(Operand__rAX_Yv);
+X86_INSTANTIATE_DISASSEMBLER(Operand__rBP);
+X86_INSTANTIATE_DISASSEMBLER(Operand__rBP_Iv);
+X86_INSTANTIATE_DISASSEMBLER(Operand__rBP_rAX);
+X86_INSTANTIATE_DISASSEMBLER(Operand__rBX);
+X86_INSTANTIATE_DISASSEMBLER(Operand__rBX_Iv);
+X86_INSTANTIATE_DISASSEMBLER(Operand__rBX_rAX);
+X86_INSTANTIATE_DISASSEMBLER(Operand__rCX);
+X86_INSTANTIATE_DISASSEMBLER(Operand__rCX_Iv);
+X86_INSTANTIATE_DISASSEMBLER(Operand__rCX_rAX);
+X86_INSTANTIATE_DISASSEMBLER(Operand__rDI);
+X86_INSTANTIATE_DISASSEMBLER(Operand__rDI_Iv);
+X86_INSTANTIATE_DISASSEMBLER(Operand__rDI_rAX);
+X86_INSTANTIATE_DISASSEMBLER(Operand__rDX);
+X86_INSTANTIATE_DISASSEMBLER(Operand__rDX_Iv);
+X86_INSTANTIATE_DISASSEMBLER(Operand__rDX_rAX);
+X86_INSTANTIATE_DISASSEMBLER(Operand__rSI);
+X86_INSTANTIATE_DISASSEMBLER(Operand__rSI_Iv);
+X86_INSTANTIATE_DISASSEMBLER(Operand__rSI_rAX);
+X86_INSTANTIATE_DISASSEMBLER(Operand__rSP);
+X86_INSTANTIATE_DISASSEMBLER(Operand__rSP_Iv);
+X86_INSTANTIATE_DISASSEMBLER(Operand__rSP_rAX);
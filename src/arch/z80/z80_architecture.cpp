@@ -105,6 +105,13 @@ bool Z80Architecture::Translate(Address const& rVirtAddr, OffsetType& rPhysOff)
   return false;
 }
 
+bool Z80Architecture::DisassembleBlock(BinaryStream const& rBinStrm, OffsetType Offset, u8 Mode, u32 MaxInsns, bool StopOnBranch, InstructionBuffer& rInsnBuf)
+{
+  return _DisassembleBlock(rBinStrm, Offset, Mode, MaxInsns, StopOnBranch, rInsnBuf,
+    [this](BinaryStream const& rInsnStrm, OffsetType InsnOff, Instruction& rInsn, u8 InsnMode)
+  { return Z80Architecture::Disassemble(rInsnStrm, InsnOff, rInsn, InsnMode); });
+}
+
 Architecture::NamedModeVector Z80Architecture::GetModes(void) const
 {
   NamedModeVector Modes;
@@ -51,11 +51,12 @@ private:
   };
 
 public:
-  Z80Architecture(void) : Architecture(MEDUSA_ARCH_TAG('z','8','0')) {}
+  Z80Architecture(void) : Architecture(MEDUSA_ARCH_TAG('z','8','0')) { _InitializeExpressionTemplates(); }
 
   virtual std::string           GetName(void) const { return "Zilog 80"; }
   virtual bool                  Translate(Address const& rVirtAddr, OffsetType& rPhyslOff);
   virtual bool                  Disassemble(BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode);
+  virtual bool                  DisassembleBlock(BinaryStream const& rBinStrm, OffsetType Offset, u8 Mode, u32 MaxInsns, bool StopOnBranch, InstructionBuffer& rInsnBuf);
   virtual NamedModeVector       GetModes(void) const;
   virtual EEndianness           GetEndianness(void) { return LittleEndian; }
   virtual CpuInformation const* GetCpuInformation(void) const { return &m_CpuInfo; }
@@ -69,6 +70,7 @@ public:
     PrintData          & rPrintData) const;
 
 private:
+#include "z80_opcode.ipp"
 };
 
 enum Z80Identifiers
@@ -1 +1,3 @@
 /* This file has been automatically generated, you must _NOT_ edit it directly. (Wed Oct  5 22:57:00 2016) */
+Expression::SPType m_ExprTemplates[0x24];
+void _InitializeExpressionTemplates(void);
@@ -0,0 +1,180 @@
+#include "arm_architecture.hpp"
+
+#include <medusa/binary_stream.hpp>
+#include <medusa/instruction.hpp>
+
+#include <chrono>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <random>
+#include <vector>
+
+// Decodes every aligned word of a code image in ARM and Thumb mode, once with the former dispatcher which
+// tests each mask one after the other (bench_arm_dispatch.cpp, generated by gen/arch_arm.py) as a baseline
+// and once with the decision tree of ArmArchitecture::Disassemble. Both call the same handlers.
+// Since handlers build the whole instruction, the dispatch alone is also measured: both dispatchers are
+// generated a second time to only return the matched handler, they must match the same one for every word.
+// Usage: medusa_bench_arm_decode [image], the image is raw code, a random buffer is used when it is omitted.
+// The reference image is the .text section of random functions built by LLVM 14 for the mode to measure:
+//   llvm-stress -seed=1 -size=100000 -o stress.ll
+//   llc -O2 -mtriple=armv7a-none-eabi -filetype=obj stress.ll -o arm.o (thumbv7a-none-eabi for Thumb)
+//   llvm-objcopy -O binary --only-section=.text arm.o arm.bin
+// Output is one CSV line per mode, dispatcher and measure (decode or dispatch):
+// mode,dispatch,measure,source,bytes,instructions,decoded,seconds,instructions_per_second,speedup
+// where speedup is the time of the former dispatcher divided by the time of the dispatcher.
+
+using namespace medusa;
+
+bool BenchDisassembleCascade(ArmArchitecture& rArch, BinaryStream const& rBinStrm, OffsetType Offset, Instruction& rInsn, u8 Mode);
+
+typedef bool (ArmArchitecture::*BenchHandlerType)(BinaryStream const& rBinStrm, OffsetType Offset, u32 Opcode, Instruction& rInsn);
+typedef BenchHandlerType (*BenchSelectType)(BinaryStream const& rBinStrm, OffsetType Offset);
+BenchHandlerType BenchSelectArmTree(BinaryStream const& rBinStrm, OffsetType Offset);
+BenchHandlerType BenchSelectArmCascade(BinaryStream const& rBinStrm, OffsetType Offset);
+BenchHandlerType BenchSelectThumbTree(BinaryStream const& rBinStrm, OffsetType Offset);
+BenchHandlerType BenchSelectThumbCascade(BinaryStream const& rBinStrm, OffsetType Offset);
+
+static size_t const s_RandomSize = 0x400000; // 4 MiB
+static int    const s_Iterations = 4;
+
+struct Result
+{
+  u64    m_DecodedCnt;
+  double m_Seconds;
+};
+
+static Result Measure(ArmArchitecture& rArch, char const* pModeName, bool Cascade, char const* pSource, std::vector<u8> const& rBuffer, double BaselineSeconds)
+{
+  u8 Mode = rArch.GetModeByName(pModeName);
+  size_t Step = (std::string(pModeName) == "arm") ? 4 : 2;
+  MemoryBinaryStream MemBinStrm(rBuffer.data(), rBuffer.size());
+
+  u64 InsnCnt = 0, DecodedCnt = 0;
+  auto Start = std::chrono::steady_clock::now();
+  for (int i = 0; i < s_Iterations; ++i)
+  {
+    for (OffsetType Off = 0; Off + 4 <= rBuffer.size(); Off += Step)
+    {
+      Instruction Insn;
+      bool Res = Cascade
+        ? BenchDisassembleCascade(rArch, MemBinStrm, Off, Insn, Mode)
+        : rArch.Disassemble(MemBinStrm, Off, Insn, Mode);
+      if (Res)
+        ++DecodedCnt;
+      ++InsnCnt;
+    }
+  }
+  std::chrono::duration<double> Elapsed = std::chrono::steady_clock::now() - Start;
+
+  std::cout
+    << pModeName << ","
+    << (Cascade ? "cascade" : "tree") << ","
+    << "decode,"
+    << pSource << ","
+    << rBuffer.size() << ","
+    << InsnCnt << ","
+    << DecodedCnt << ","
+    << Elapsed.count() << ","
+    << InsnCnt / Elapsed.count() << ","
+    << (Cascade ? 1.0 : BaselineSeconds / Elapsed.count())
+    << std::endl;
+
+  return { DecodedCnt, Elapsed.count() };
+}
+
+static Result MeasureDispatch(char const* pModeName, bool Cascade, BenchSelectType pSelect, char const* pSource, std::vector<u8> const& rBuffer, double BaselineSeconds)
+{
+  size_t Step = (std::string(pModeName) == "arm") ? 4 : 2;
+  MemoryBinaryStream MemBinStrm(rBuffer.data(), rBuffer.size());
+
+  u64 InsnCnt = 0, DecodedCnt = 0;
+  auto Start = std::chrono::steady_clock::now();
+  for (int i = 0; i < s_Iterations; ++i)
+  {
+    for (OffsetType Off = 0; Off + 4 <= rBuffer.size(); Off += Step)
+    {
+      if (pSelect(MemBinStrm, Off) != nullptr)
+        ++DecodedCnt;
+      ++InsnCnt;
+    }
+  }
+  std::chrono::duration<double> Elapsed = std::chrono::steady_clock::now() - Start;
+
+  std::cout
+    << pModeName << ","
+    << (Cascade ? "cascade" : "tree") << ","
+    << "dispatch,"
+    << pSource << ","
+    << rBuffer.size() << ","
+    << InsnCnt << ","
+    << DecodedCnt << ","
+    << Elapsed.count() << ","
+    << InsnCnt / Elapsed.count() << ","
+    << (Cascade ? 1.0 : BaselineSeconds / Elapsed.count())
+    << std::endl;
+
+  return { DecodedCnt, Elapsed.count() };
+}
+
+static bool MeasureMode(ArmArchitecture& rArch, char const* pModeName, BenchSelectType pSelectTree, BenchSelectType pSelectCascade, char const* pSource, std::vector<u8> const& rBuffer)
+{
+  auto Baseline = Measure(rArch, pModeName, true,  pSource, rBuffer, 0.0);
+  auto Tree     = Measure(rArch, pModeName, false, pSource, rBuffer, Baseline.m_Seconds);
+
+  auto BaselineDispatch = MeasureDispatch(pModeName, true,  pSelectCascade, pSource, rBuffer, 0.0);
+  MeasureDispatch(pModeName, false, pSelectTree, pSource, rBuffer, BaselineDispatch.m_Seconds);
+
+  // both dispatchers test the same patterns in the same order, so they must decode the same words
+  if (Baseline.m_DecodedCnt != Tree.m_DecodedCnt)
+  {
+    std::cerr << pModeName << ": the decision tree decoded " << Tree.m_DecodedCnt << " instructions, the former dispatcher " << Baseline.m_DecodedCnt << std::endl;
+    return false;
+  }
+
+  size_t Step = (std::string(pModeName) == "arm") ? 4 : 2;
+  MemoryBinaryStream MemBinStrm(rBuffer.data(), rBuffer.size());
+  for (OffsetType Off = 0; Off + 4 <= rBuffer.size(); Off += Step)
+  {
+    if (pSelectTree(MemBinStrm, Off) != pSelectCascade(MemBinStrm, Off))
+    {
+      std::cerr << pModeName << ": the dispatchers select different handlers at offset " << Off << std::endl;
+      return false;
+    }
+  }
+  return true;
+}
+
+int main(int argc, char** argv)
+{
+  std::vector<u8> Buffer;
+  char const* pSource = "random";
+
+  if (argc > 1)
+  {
+    std::ifstream Image(argv[1], std::ios::binary);
+    if (!Image)
+    {
+      std::cerr << "unable to open " << argv[1] << std::endl;
+      return 1;
+    }
+    Buffer.assign(std::istreambuf_iterator<char>(Image), std::istreambuf_iterator<char>());
+    pSource = argv[1];
+  }
+  else
+  {
+    Buffer.resize(s_RandomSize);
+    std::mt19937 Rng(0x6d656475);
+    for (auto& rByte : Buffer)
+      rByte = static_cast<u8>(Rng());
+  }
+
+  ArmArchitecture Arch;
+
+  std::cout << "mode,dispatch,measure,source,bytes,instructions,decoded,seconds,instructions_per_second,speedup" << std::endl;
+  bool Res = true;
+  Res &= MeasureMode(Arch, "arm",   BenchSelectArmTree,   BenchSelectArmCascade,   pSource, Buffer);
+  Res &= MeasureMode(Arch, "thumb", BenchSelectThumbTree, BenchSelectThumbCascade, pSource, Buffer);
+
+  return Res ? 0 : 1;
+}
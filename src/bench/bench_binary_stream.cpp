@@ -0,0 +1,92 @@
+#include <medusa/binary_stream.hpp>
+
+#include <chrono>
+#include <iostream>
+#include <random>
+#include <vector>
+
+// Compares element-wise reads, bulk reads and zero-copy views on a memory stream.
+// Output is one CSV line per measure: name,endianness,element_size,bytes,seconds,mib_per_second
+
+using namespace medusa;
+
+static size_t const s_BufferSize = 0x4000000; // 64 MiB
+static int    const s_Iterations = 8;
+
+template<typename Fn>
+static void Measure(char const* pName, EEndianness Endianness, size_t ElemSize, Fn Func)
+{
+  auto Start = std::chrono::steady_clock::now();
+  for (int i = 0; i < s_Iterations; ++i)
+    Func();
+  std::chrono::duration<double> Elapsed = std::chrono::steady_clock::now() - Start;
+
+  double Bytes = static_cast<double>(s_BufferSize) * s_Iterations;
+  std::cout
+    << pName << ","
+    << (Endianness == BigEndian ? "big" : "little") << ","
+    << ElemSize << ","
+    << static_cast<u64>(Bytes) << ","
+    << Elapsed.count() << ","
+    << (Bytes / (1024.0 * 1024.0)) / Elapsed.count()
+    << std::endl;
+}
+
+template<typename T>
+static void BenchType(MemoryBinaryStream& rBinStrm, EEndianness Endianness)
+{
+  size_t const Count = s_BufferSize / sizeof(T);
+  std::vector<T> Out(Count);
+  volatile T Sink = 0;
+
+  rBinStrm.SetEndianness(Endianness);
+
+  Measure("read_element", Endianness, sizeof(T), [&]()
+  {
+    T Acc = 0;
+    for (size_t i = 0; i < Count; ++i)
+    {
+      T Val;
+      rBinStrm.Read(i * sizeof(T), Val);
+      Acc ^= Val;
+    }
+    Sink = Acc;
+  });
+
+  Measure("read_array", Endianness, sizeof(T), [&]()
+  {
+    rBinStrm.ReadArray(0, Count, Out.data());
+    Sink = Out[Count / 2];
+  });
+
+  Measure("view", Endianness, sizeof(T), [&]()
+  {
+    auto pView = rBinStrm.template View<T>(0, Count);
+    if (pView == nullptr)
+    {
+      rBinStrm.ReadArray(0, Count, Out.data());
+      pView = Out.data();
+    }
+    Sink = pView[Count / 2];
+  });
+}
+
+int main(void)
+{
+  std::vector<u8> Buffer(s_BufferSize);
+  std::mt19937 Rng(0x6d656475);
+  for (auto& rByte : Buffer)
+    rByte = static_cast<u8>(Rng());
+
+  MemoryBinaryStream MemBinStrm(Buffer.data(), Buffer.size());
+
+  std::cout << "name,endianness,element_size,bytes,seconds,mib_per_second" << std::endl;
+  for (auto Endianness : { LittleEndian, BigEndian })
+  {
+    BenchType<u16>(MemBinStrm, Endianness);
+    BenchType<u32>(MemBinStrm, Endianness);
+    BenchType<u64>(MemBinStrm, Endianness);
+  }
+
+  return 0;
+}
@@ -0,0 +1,82 @@
+#include <medusa/types.hpp>
+
+#include <chrono>
+#include <iostream>
+#include <random>
+#include <vector>
+
+// Measures BitVector arithmetic for widths handled inline (<= 64-bit) and with ap_int (128-bit).
+// The "step" measure mimics what the interpreter does for an x86 add: result and flags computation.
+// Output is one CSV line per measure: name,bit_size,operations,seconds,operations_per_second
+
+using namespace medusa;
+
+static size_t const s_ValueCount = 0x1000;
+static int    const s_Iterations = 256;
+static volatile u64   s_Sink;       // keeps the results alive
+
+template<typename Fn>
+static void Measure(char const* pName, u16 BitSize, Fn Func)
+{
+  std::mt19937_64 Rng(0x6d656475);
+  std::vector<BitVector> Values;
+  Values.reserve(s_ValueCount);
+  for (size_t i = 0; i < s_ValueCount; ++i)
+    Values.push_back(BitVector(BitSize, (ap_int(Rng()) << 64) | ap_int(Rng())));
+
+  u64 Sink = 0;
+  auto Start = std::chrono::steady_clock::now();
+  for (int i = 0; i < s_Iterations; ++i)
+    for (size_t j = 0; j + 1 < s_ValueCount; ++j)
+      Sink += Func(Values[j], Values[j + 1]);
+  std::chrono::duration<double> Elapsed = std::chrono::steady_clock::now() - Start;
+
+  u64 OpCnt = static_cast<u64>(s_Iterations) * (s_ValueCount - 1);
+  std::cout
+    << pName << ","
+    << BitSize << ","
+    << OpCnt << ","
+    << Elapsed.count() << ","
+    << OpCnt / Elapsed.count()
+    << std::endl;
+  s_Sink = Sink;
+}
+
+int main(void)
+{
+  static u16 const s_BitSizes[] = { 8, 32, 64, 128 };
+  BitVector const ShiftCount(8, static_cast<u8>(3));
+
+  std::cout << "name,bit_size,operations,seconds,operations_per_second" << std::endl;
+  for (auto BitSize : s_BitSizes)
+  {
+    Measure("add", BitSize, [](BitVector const& rLeft, BitVector const& rRight)
+    {
+      return (rLeft + rRight).IsZero() ? 1 : 0;
+    });
+
+    Measure("shift", BitSize, [&](BitVector const& rLeft, BitVector const&)
+    {
+      return rLeft.Lls(ShiftCount).Lrs(ShiftCount).IsZero() ? 1 : 0;
+    });
+
+    Measure("compare", BitSize, [](BitVector const& rLeft, BitVector const& rRight)
+    {
+      return (rLeft.UCmp(rRight) < 0 ? 1 : 0) + (rLeft.SCmp(rRight) < 0 ? 1 : 0);
+    });
+
+    Measure("step", BitSize, [](BitVector const& rLeft, BitVector const& rRight)
+    {
+      BitVector const Zero(rLeft.GetBitSize(), 0);
+      BitVector Res = rLeft + rRight;
+      bool Cf = Res.UCmp(rLeft) < 0;
+      bool Zf = Res.IsZero();
+      bool Sf = Res.SCmp(Zero) < 0;
+      bool Ls = rLeft.SCmp(Zero) < 0;
+      bool Of = Ls == (rRight.SCmp(Zero) < 0) && Sf != Ls;
+      return (Cf ? 1 : 0) + (Zf ? 2 : 0) + (Sf ? 4 : 0) + (Of ? 8 : 0);
+    });
+  }
+
+  return 0;
+}
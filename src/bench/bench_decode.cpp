@@ -0,0 +1,182 @@
+#include <medusa/binary_stream.hpp>
+#include <medusa/module.hpp>
+#include <medusa/architecture.hpp>
+#include <medusa/instruction.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <new>
+#include <random>
+#include <string>
+#include <vector>
+
+#if defined(_WIN32) || defined(WIN32)
+# include <windows.h>
+# include <psapi.h>
+#else
+# include <sys/resource.h>
+#endif
+
+// Decodes a corpus with a linear sweep for every mode exposed by the x86, arm, z80 and st62 modules.
+// Usage: medusa_bench_decode [arch:image]..., the image is raw code (e.g. the .text section of a binary)
+// and is only decoded by the given architecture, a random buffer is used for every architecture.
+// Modules are loaded from the current directory, missing ones are skipped.
+// Output is one CSV line per architecture, mode and source:
+// architecture,mode,source,bytes,attempts,decoded,seconds,instructions_per_second,bytes_per_second,allocations_per_instruction,peak_rss_kib
+// attempts counts every offset tried, the rates are given per decoded instruction.
+
+using namespace medusa;
+
+static size_t const s_RandomSize = 0x400000; // 4 MiB
+static int    const s_Iterations = 4;
+
+// Every allocation made by the process (including the modules on ELF platforms) goes through these operators
+static std::atomic<u64> s_AllocCnt(0);
+
+void* operator new(std::size_t Size)
+{
+  ++s_AllocCnt;
+  if (void* pMem = std::malloc(Size != 0 ? Size : 1))
+    return pMem;
+  throw std::bad_alloc();
+}
+
+void* operator new[](std::size_t Size)
+{
+  return operator new(Size);
+}
+
+void operator delete(void* pMem) noexcept
+{
+  std::free(pMem);
+}
+
+void operator delete[](void* pMem) noexcept
+{
+  std::free(pMem);
+}
+
+static u64 GetPeakRssInKiB(void)
+{
+#if defined(_WIN32) || defined(WIN32)
+  PROCESS_MEMORY_COUNTERS MemCnt;
+  if (!GetProcessMemoryInfo(GetCurrentProcess(), &MemCnt, sizeof(MemCnt)))
+    return 0;
+  return MemCnt.PeakWorkingSetSize / 1024;
+#else
+  rusage Usage;
+  if (getrusage(RUSAGE_SELF, &Usage) != 0)
+    return 0;
+# if defined(__APPLE__)
+  return Usage.ru_maxrss / 1024; // bytes on darwin
+# else
+  return Usage.ru_maxrss;
+# endif
+#endif
+}
+
+static void Measure(Architecture& rArch, Architecture::NamedMode const& rMode, std::string const& rSource, std::vector<u8> const& rBuffer)
+{
+  u8 Mode = std::get<1>(rMode);
+  MemoryBinaryStream MemBinStrm(rBuffer.data(), rBuffer.size());
+
+  u64 TryCnt = 0, DecodedCnt = 0;
+  u64 AllocCnt = s_AllocCnt;
+  auto Start = std::chrono::steady_clock::now();
+  for (int i = 0; i < s_Iterations; ++i)
+  {
+    // Invalid bytes are skipped one by one, like the analyzer does when it resynchronizes
+    for (OffsetType Off = 0; Off < rBuffer.size();)
+    {
+      Instruction Insn;
+      if (rArch.Disassemble(MemBinStrm, Off, Insn, Mode) && Insn.GetSize() != 0)
+      {
+        Off += Insn.GetSize();
+        ++DecodedCnt;
+      }
+      else
+        ++Off;
+      ++TryCnt;
+    }
+  }
+  std::chrono::duration<double> Elapsed = std::chrono::steady_clock::now() - Start;
+  AllocCnt = s_AllocCnt - AllocCnt;
+
+  std::cout
+    << rArch.GetName() << ","
+    << std::get<0>(rMode) << ","
+    << rSource << ","
+    << rBuffer.size() << ","
+    << TryCnt << ","
+    << DecodedCnt << ","
+    << Elapsed.count() << ","
+    << DecodedCnt / Elapsed.count() << ","
+    << (rBuffer.size() * s_Iterations) / Elapsed.count() << ","
+    << static_cast<double>(AllocCnt) / (DecodedCnt != 0 ? DecodedCnt : 1) << ","
+    << GetPeakRssInKiB()
+    << std::endl;
+}
+
+static bool ReadImage(char const* pPath, std::vector<u8>& rBuffer)
+{
+  std::ifstream Image(pPath, std::ios::binary);
+  if (!Image)
+    return false;
+  rBuffer.assign(std::istreambuf_iterator<char>(Image), std::istreambuf_iterator<char>());
+  return true;
+}
+
+int main(int argc, char** argv)
+{
+  static char const* s_ArchNames[] = { "x86", "arm", "z80", "st62" };
+
+  std::vector<u8> Random(s_RandomSize);
+  std::mt19937 Rng(0x6d656475);
+  for (auto& rByte : Random)
+    rByte = static_cast<u8>(Rng());
+
+  std::cout << "architecture,mode,source,bytes,attempts,decoded,seconds,instructions_per_second,bytes_per_second,allocations_per_instruction,peak_rss_kib" << std::endl;
+
+  int Res = 0;
+  for (auto pArchName : s_ArchNames)
+  {
+    auto pGetter = ModuleManager::Instance().LoadModule<TGetArchitecture>(".", pArchName);
+    if (pGetter == nullptr)
+    {
+      std::cerr << "unable to load the " << pArchName << " module" << std::endl;
+      continue;
+    }
+    auto pArch = pGetter();
+    auto const Modes = pArch->GetModes();
+
+    for (auto const& rMode : Modes)
+      Measure(*pArch, rMode, "random", Random);
+
+    // Real corpora are given as arch:path
+    std::string const Prefix = std::string(pArchName) + ":";
+    for (int i = 1; i < argc; ++i)
+    {
+      std::string Arg = argv[i];
+      if (Arg.compare(0, Prefix.size(), Prefix) != 0)
+        continue;
+      std::string Path = Arg.substr(Prefix.size());
+      std::vector<u8> Image;
+      if (!ReadImage(Path.c_str(), Image))
+      {
+        std::cerr << "unable to open " << Path << std::endl;
+        Res = 1;
+        continue;
+      }
+      for (auto const& rMode : Modes)
+        Measure(*pArch, rMode, Path, Image);
+    }
+
+    delete pArch;
+  }
+
+  return Res;
+}
@@ -0,0 +1,182 @@
+#include <medusa/binary_stream.hpp>
+#include <medusa/module.hpp>
+#include <medusa/architecture.hpp>
+#include <medusa/instruction.hpp>
+#include <medusa/expression_visitor.hpp>
+#include <medusa/expression_pool.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <functional>
+#include <iostream>
+#include <new>
+#include <vector>
+
+// Runs the expression passes of the analyzer and the JIT on the semantic of a block of x86 instructions
+// which mostly update flags and sub-registers. The "clone" pass is the CloneVisitor every clone-based pass
+// relied on, the other ones are transformers which only rebuild the nodes they modify.
+// The x86 module is loaded from the current directory.
+// Output is one CSV line per pass: pass,instructions,seconds,instructions_per_second,allocations_per_instruction
+
+using namespace medusa;
+
+static u32 const s_Iterations = 0x2000;
+
+static std::atomic<u64> s_AllocCnt(0);
+
+void* operator new(std::size_t Size)
+{
+  ++s_AllocCnt;
+  if (void* pMem = std::malloc(Size != 0 ? Size : 1))
+    return pMem;
+  throw std::bad_alloc();
+}
+
+void* operator new[](std::size_t Size)
+{
+  return operator new(Size);
+}
+
+void operator delete(void* pMem) noexcept
+{
+  std::free(pMem);
+}
+
+void operator delete[](void* pMem) noexcept
+{
+  std::free(pMem);
+}
+
+// add, adc, sub, xor, imul, shl, ror, cmp, test, add bl/ah, add ax/cx, mov al/[esp], push, pop, sete, inc, neg
+static u8 const s_Block[] =
+{
+  0x01, 0xd8,
+  0x11, 0xca,
+  0x29, 0xf7,
+  0x31, 0xc0,
+  0x0f, 0xaf, 0xc3,
+  0xd1, 0xe0,
+  0xc1, 0xc8, 0x08,
+  0x39, 0xd1,
+  0x85, 0xc0,
+  0x00, 0xe3,
+  0x66, 0x01, 0xc8,
+  0x8a, 0x04, 0x24,
+  0x50,
+  0x5b,
+  0x0f, 0x94, 0xc0,
+  0x40,
+  0xf7, 0xd8,
+};
+
+typedef std::function<bool(Expression::LSPType const& rSem)> PassType;
+
+static void Measure(char const* pName, std::vector<Expression::LSPType> const& rBlkSem, PassType Pass)
+{
+  u64 InsnCnt = 0;
+  bool Res = true;
+
+  u64 AllocCnt = s_AllocCnt;
+  auto Start = std::chrono::steady_clock::now();
+  for (u32 i = 0; i < s_Iterations; ++i)
+  {
+    for (auto const& rSem : rBlkSem)
+    {
+      Res &= Pass(rSem);
+      ++InsnCnt;
+    }
+  }
+  std::chrono::duration<double> Elapsed = std::chrono::steady_clock::now() - Start;
+  AllocCnt = s_AllocCnt - AllocCnt;
+
+  std::cout
+    << pName << ","
+    << InsnCnt << ","
+    << Elapsed.count() << ","
+    << InsnCnt / Elapsed.count() << ","
+    << static_cast<double>(AllocCnt) / InsnCnt
+    << std::endl;
+
+  if (!Res)
+    std::cerr << "pass " << pName << " failed" << std::endl;
+}
+
+int main(void)
+{
+  auto pGetter = ModuleManager::Instance().LoadModule<TGetArchitecture>(".", "x86");
+  if (pGetter == nullptr)
+  {
+    std::cerr << "unable to load the x86 module" << std::endl;
+    return 1;
+  }
+  auto pArch = pGetter();
+  u8 Mode = pArch->GetModeByName("32-bit");
+  auto const& rCpuInfo = *pArch->GetCpuInformation();
+
+  std::vector<Expression::LSPType> BlkSem;
+  MemoryBinaryStream MemBinStrm(s_Block, sizeof(s_Block));
+  for (OffsetType Off = 0; Off < sizeof(s_Block);)
+  {
+    Instruction Insn;
+    if (!pArch->Disassemble(MemBinStrm, Off, Insn, Mode) || Insn.GetSize() == 0)
+    {
+      std::cerr << "unable to disassemble the instruction at offset " << Off << std::endl;
+      delete pArch;
+      return 1;
+    }
+    BlkSem.push_back(Insn.GetSemantic());
+    Off += Insn.GetSize();
+  }
+
+  std::cout << "pass,instructions,seconds,instructions_per_second,allocations_per_instruction" << std::endl;
+
+  Measure("clone", BlkSem, [](Expression::LSPType const& rSem)
+  {
+    CloneVisitor CloneVst;
+    for (auto const& rspExpr : rSem)
+      if (rspExpr->Visit(&CloneVst) == nullptr)
+        return false;
+    return true;
+  });
+
+  Measure("normalize_identifier", BlkSem, [&](Expression::LSPType const& rSem)
+  {
+    NormalizeIdentifier NrmId(rCpuInfo, Mode);
+    for (auto const& rspExpr : rSem)
+      if (NrmId.Transform(rspExpr) == nullptr)
+        return false;
+    return true;
+  });
+
+  // Same passes as the LLVM emulator
+  Measure("normalize_identifier+identifier_to_variable", BlkSem, [&](Expression::LSPType const& rSem)
+  {
+    NormalizeIdentifier NrmId(rCpuInfo, Mode);
+    IdentifierToVariable Id2Var;
+    for (auto const& rspExpr : rSem)
+      if (Id2Var.Transform(NrmId.Transform(rspExpr)) == nullptr)
+        return false;
+    return true;
+  });
+
+  Measure("remove_annotations", BlkSem, [](Expression::LSPType const& rSem)
+  {
+    for (auto const& rspExpr : rSem)
+      if (SymbolicVisitor::RemoveExpressionAnnotations(rspExpr) == nullptr)
+        return false;
+    return true;
+  });
+
+  Measure("intern", BlkSem, [](Expression::LSPType const& rSem)
+  {
+    ExpressionPool ExprPool;
+    for (auto const& rspExpr : rSem)
+      if (ExprPool.Intern(rspExpr) == nullptr)
+        return false;
+    return true;
+  });
+
+  delete pArch;
+  return 0;
+}
@@ -0,0 +1,554 @@
+#include "medusa/analysis_cache.hpp"
+#include "medusa/document.hpp"
+#include "medusa/function.hpp"
+#include "medusa/util.hpp"
+#include "medusa/log.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <fstream>
+#include <sstream>
+#include <thread>
+
+#include <boost/filesystem/operations.hpp>
+
+MEDUSA_NAMESPACE_BEGIN
+
+namespace
+{
+  u64 const s_HashChunkSize = 0x400000;
+
+  // Entries are written with the host endianness, the header allows to reject foreign files
+  u32 const s_EntryMagic   = 0x4144454d; // "MEDA"
+  u32 const s_EntryVersion = 1;
+
+  template<typename Type>
+  void WriteValue(std::ostream& rOut, Type Value)
+  {
+    rOut.write(reinterpret_cast<char const*>(&Value), sizeof(Value));
+  }
+
+  void WriteString(std::ostream& rOut, std::string const& rString)
+  {
+    WriteValue<u32>(rOut, static_cast<u32>(rString.size()));
+    rOut.write(rString.data(), rString.size());
+  }
+
+  void WriteAddress(std::ostream& rOut, Address const& rAddress)
+  {
+    WriteValue<u8>(rOut, static_cast<u8>(rAddress.GetAddressingType()));
+    WriteValue<BaseType>(rOut, rAddress.GetBase());
+    WriteValue<OffsetType>(rOut, rAddress.GetOffset());
+  }
+
+  template<typename Type>
+  bool ReadValue(std::istream& rIn, Type& rValue)
+  {
+    return !!rIn.read(reinterpret_cast<char*>(&rValue), sizeof(rValue));
+  }
+
+  bool ReadString(std::istream& rIn, std::string& rString)
+  {
+    u32 Length;
+    if (!ReadValue(rIn, Length))
+      return false;
+    if (Length > 0x1000000) // corrupted entry
+      return false;
+    rString.resize(Length);
+    return !!rIn.read(&rString[0], Length);
+  }
+
+  bool ReadAddress(std::istream& rIn, Document const& rDoc, Address& rAddress)
+  {
+    u8 Type;
+    BaseType Base;
+    OffsetType Offset;
+    if (!ReadValue(rIn, Type) || !ReadValue(rIn, Base) || !ReadValue(rIn, Offset))
+      return false;
+    rAddress = rDoc.MakeAddress(Base, Offset);
+    rAddress.SetAddressingType(static_cast<Address::Type>(Type));
+    return true;
+  }
+
+  bool IsInMemoryArea(MemoryArea const& rMemArea, Address const& rAddress, OffsetType& rRelOff)
+  {
+    auto const& rBaseAddr = rMemArea.GetBaseAddress();
+    if (rAddress.GetBase() != rBaseAddr.GetBase())
+      return false;
+    if (rAddress.GetOffset() < rBaseAddr.GetOffset())
+      return false;
+    rRelOff = rAddress.GetOffset() - rBaseAddr.GetOffset();
+    return rRelOff < rMemArea.GetSize();
+  }
+
+  bool IsDefaultCellData(CellData const& rCellData)
+  {
+    return rCellData.GetType() == Cell::ValueType && rCellData.GetSubType() == ValueDetail::HexadecimalType
+      && rCellData.GetSize() == 1 && rCellData.GetFormatStyle() == 0 && rCellData.GetFlags() == 0
+      && rCellData.GetMode() == 0 && rCellData.GetArchitectureTag() == MEDUSA_ARCH_UNK;
+  }
+
+  bool IsSameBaseAddress(MemoryArea const& rMemArea, u8 Type, BaseType Base, OffsetType Offset)
+  {
+    auto const& rBaseAddr = rMemArea.GetBaseAddress();
+    return rBaseAddr.GetAddressingType() == Type && rBaseAddr.GetBase() == Base && rBaseAddr.GetOffset() == Offset;
+  }
+}
+
+AnalysisCache::AnalysisCache(Path const& rCachePath)
+  : m_CachePath(rCachePath)
+{
+  if (m_CachePath.empty())
+    return;
+
+  boost::system::error_code ErrCode;
+  boost::filesystem::create_directories(m_CachePath, ErrCode);
+  if (!boost::filesystem::is_directory(m_CachePath))
+  {
+    Log::Write("core").Level(LogWarning) << "unable to use cache directory " << m_CachePath.string() << LogEnd;
+    m_CachePath.clear();
+  }
+}
+
+std::string AnalysisCache::ComputeKey(BinaryStream const& rBinStrm, OffsetType Offset, u64 Length, u32 ThreadCount)
+{
+  if (Offset > rBinStrm.GetSize())
+    Offset = rBinStrm.GetSize();
+  Length = std::min(Length, rBinStrm.GetSize() - Offset);
+
+  auto const ChunkCount = static_cast<size_t>((Length + s_HashChunkSize - 1) / s_HashChunkSize);
+  std::vector<std::string> ChunkDigests(ChunkCount);
+  std::atomic<size_t> NextChunk(0);
+  std::atomic<bool> Failed(false);
+
+  auto Worker = [&]()
+  {
+    std::vector<u8> Buffer;
+    for (;;)
+    {
+      size_t ChunkIdx = NextChunk++;
+      if (ChunkIdx >= ChunkCount)
+        break;
+
+      OffsetType ChunkOff = Offset + ChunkIdx * s_HashChunkSize;
+      auto ChunkLen = static_cast<size_t>(std::min(s_HashChunkSize, Offset + Length - ChunkOff));
+      auto pChunk = rBinStrm.View<u8>(ChunkOff, ChunkLen);
+      if (pChunk == nullptr)
+      {
+        Buffer.resize(ChunkLen);
+        if (!rBinStrm.Read(ChunkOff, Buffer.data(), ChunkLen))
+        {
+          Failed = true;
+          break;
+        }
+        pChunk = Buffer.data();
+      }
+      ChunkDigests[ChunkIdx] = Sha1(pChunk, ChunkLen);
+    }
+  };
+
+  if (ThreadCount == 0)
+    ThreadCount = std::thread::hardware_concurrency();
+  ThreadCount = std::max<u32>(1, std::min<u32>(ThreadCount, static_cast<u32>(ChunkCount)));
+
+  if (ThreadCount == 1)
+    Worker();
+  else
+  {
+    std::vector<std::thread> Threads;
+    Threads.reserve(ThreadCount);
+    for (u32 Idx = 0; Idx < ThreadCount; ++Idx)
+      Threads.emplace_back(Worker);
+    for (auto& rThread : Threads)
+      rThread.join();
+  }
+
+  if (Failed)
+    return "";
+
+  std::ostringstream Digests;
+  Digests << Length;
+  for (auto const& rChunkDigest : ChunkDigests)
+    Digests << ':' << rChunkDigest;
+  auto const& rDigests = Digests.str();
+  return Sha1(rDigests.data(), rDigests.size());
+}
+
+bool AnalysisCache::Load(Document& rDoc, std::string const& rFileKey, bool& rComplete) const
+{
+  rComplete = false;
+  if (!IsEnabled() || rFileKey.empty())
+    return false;
+
+  std::vector<MemoryArea> MemAreas;
+  rDoc.ForEachMemoryArea([&](MemoryArea const& rMemArea)
+  {
+    MemAreas.push_back(rMemArea);
+  });
+
+  // Fast path: the whole file was already analyzed, only the file has to be hashed
+  std::ifstream FileEntry(_GetEntryPath(rFileKey, ".mdf").string(), std::ios::binary);
+  if (FileEntry.is_open())
+  {
+    u32 Magic, Version, AreaCount;
+    if (ReadValue(FileEntry, Magic) && Magic == s_EntryMagic
+      && ReadValue(FileEntry, Version) && Version == s_EntryVersion
+      && ReadValue(FileEntry, AreaCount) && AreaCount == MemAreas.size())
+    {
+      u32 LoadedAreaCount = 0;
+      for (u32 Idx = 0; Idx < AreaCount; ++Idx)
+      {
+        u8 Type;
+        BaseType Base;
+        OffsetType Offset;
+        std::string AreaKey;
+        if (!ReadValue(FileEntry, Type) || !ReadValue(FileEntry, Base) || !ReadValue(FileEntry, Offset) || !ReadString(FileEntry, AreaKey))
+          break;
+
+        auto itMemArea = std::find_if(std::begin(MemAreas), std::end(MemAreas), [&](MemoryArea const& rMemArea)
+        { return IsSameBaseAddress(rMemArea, Type, Base, Offset); });
+        if (itMemArea == std::end(MemAreas))
+          break;
+        if (!_LoadArea(rDoc, *itMemArea, AreaKey))
+          break;
+        ++LoadedAreaCount;
+      }
+
+      if (LoadedAreaCount == AreaCount)
+      {
+        Log::Write("core") << "analysis restored from cache " << rFileKey << LogEnd;
+        rComplete = true;
+        return true;
+      }
+    }
+    Log::Write("core").Level(LogWarning) << "invalid cache entry " << rFileKey << LogEnd;
+  }
+
+  // Slow path: look for memory areas shared with previously analyzed files
+  AreaEntryVector AreaEntries;
+  _GetAreaEntries(rDoc, rFileKey, AreaEntries);
+  u32 LoadedAreaCount = 0;
+  for (auto const& rAreaEntry : AreaEntries)
+  {
+    if (rAreaEntry.m_MemoryArea.GetFileSize() == 0)
+      continue;
+    if (_LoadArea(rDoc, rAreaEntry.m_MemoryArea, rAreaEntry.m_Key))
+      ++LoadedAreaCount;
+  }
+
+  if (LoadedAreaCount != 0)
+    Log::Write("core") << LoadedAreaCount << " memory area(s) restored from cache" << LogEnd;
+  return LoadedAreaCount != 0;
+}
+
+bool AnalysisCache::Store(Document const& rDoc) const
+{
+  if (!IsEnabled())
+    return false;
+
+  auto const& rBinStrm = rDoc.GetBinaryStream();
+  auto FileKey = ComputeKey(rBinStrm, 0, rBinStrm.GetSize());
+  if (FileKey.empty())
+    return false;
+
+  AreaEntryVector AreaEntries;
+  _GetAreaEntries(rDoc, FileKey, AreaEntries);
+  for (auto const& rAreaEntry : AreaEntries)
+  {
+    if (!_StoreArea(rDoc, rAreaEntry.m_MemoryArea, rAreaEntry.m_Key))
+      return false;
+  }
+
+  // The file entry is written last, so it never refers to a missing memory area entry
+  auto EntryPath = _GetEntryPath(FileKey, ".mdf");
+  auto TmpPath = EntryPath;
+  TmpPath += ".tmp";
+  {
+    std::ofstream FileEntry(TmpPath.string(), std::ios::binary | std::ios::trunc);
+    if (!FileEntry.is_open())
+    {
+      Log::Write("core").Level(LogError) << "unable to create cache entry " << TmpPath.string() << LogEnd;
+      return false;
+    }
+
+    WriteValue<u32>(FileEntry, s_EntryMagic);
+    WriteValue<u32>(FileEntry, s_EntryVersion);
+    WriteValue<u32>(FileEntry, static_cast<u32>(AreaEntries.size()));
+    for (auto const& rAreaEntry : AreaEntries)
+    {
+      WriteAddress(FileEntry, rAreaEntry.m_MemoryArea.GetBaseAddress());
+      WriteString(FileEntry, rAreaEntry.m_Key);
+    }
+    if (!FileEntry)
+      return false;
+  }
+
+  boost::system::error_code ErrCode;
+  boost::filesystem::rename(TmpPath, EntryPath, ErrCode);
+  if (ErrCode)
+  {
+    Log::Write("core").Level(LogError) << "unable to write cache entry " << EntryPath.string() << LogEnd;
+    return false;
+  }
+
+  Log::Write("core") << "analysis stored in cache " << FileKey << LogEnd;
+  return true;
+}
+
+void AnalysisCache::_GetAreaEntries(Document const& rDoc, std::string const& rFileKey, AreaEntryVector& rAreaEntries) const
+{
+  rDoc.ForEachMemoryArea([&](MemoryArea const& rMemArea)
+  {
+    rAreaEntries.push_back({ rMemArea, "" });
+  });
+
+  auto const& rBinStrm = rDoc.GetBinaryStream();
+  for (auto& rAreaEntry : rAreaEntries)
+  {
+    auto const& rMemArea = rAreaEntry.m_MemoryArea;
+    std::ostringstream Key;
+
+    // Memory areas without content (e.g. .bss) only make sense for the current file
+    if (rMemArea.GetFileSize() == 0)
+      Key << rFileKey;
+    else
+      Key << ComputeKey(rBinStrm, rMemArea.GetFileOffset(), rMemArea.GetFileSize());
+
+    // Cross references and label names hold absolute addresses, so the same content mapped elsewhere is a different entry
+    Key << ':' << rMemArea.GetBaseAddress().ToString();
+    Key << ':' << rMemArea.GetSize() << ':' << rMemArea.GetArchitectureTag() << ':' << static_cast<int>(rMemArea.GetArchitectureMode());
+
+    auto const& rKey = Key.str();
+    rAreaEntry.m_Key = Sha1(rKey.data(), rKey.size());
+  }
+}
+
+bool AnalysisCache::_LoadArea(Document& rDoc, MemoryArea const& rMemArea, std::string const& rKey) const
+{
+  std::ifstream AreaEntry(_GetEntryPath(rKey, ".mda").string(), std::ios::binary);
+  if (!AreaEntry.is_open())
+    return false;
+
+  u32 Magic, Version;
+  if (!ReadValue(AreaEntry, Magic) || Magic != s_EntryMagic)
+    return false;
+  if (!ReadValue(AreaEntry, Version) || Version != s_EntryVersion)
+    return false;
+
+  auto const& rBaseAddr = rMemArea.GetBaseAddress();
+
+  // Cells
+  u32 CellCount;
+  if (!ReadValue(AreaEntry, CellCount))
+    return false;
+  for (u32 Idx = 0; Idx < CellCount; ++Idx)
+  {
+    OffsetType RelOff;
+    u8 Type, SubType, Flags, Mode;
+    u16 Size, FormatStyle;
+    Tag ArchTag;
+    if (!ReadValue(AreaEntry, RelOff) || !ReadValue(AreaEntry, Type) || !ReadValue(AreaEntry, SubType)
+      || !ReadValue(AreaEntry, Size) || !ReadValue(AreaEntry, FormatStyle) || !ReadValue(AreaEntry, Flags)
+      || !ReadValue(AreaEntry, Mode) || !ReadValue(AreaEntry, ArchTag))
+      return false;
+    auto spCellData = std::make_shared<CellData>(Type, SubType, Size, FormatStyle, Flags, ArchTag, Mode);
+    rDoc.SetCell(rBaseAddr + RelOff, std::make_shared<Cell>(spCellData), true);
+  }
+
+  // Labels
+  u32 LabelCount;
+  if (!ReadValue(AreaEntry, LabelCount))
+    return false;
+  for (u32 Idx = 0; Idx < LabelCount; ++Idx)
+  {
+    OffsetType RelOff;
+    u16 Type, Version;
+    std::string Name;
+    if (!ReadValue(AreaEntry, RelOff) || !ReadValue(AreaEntry, Type) || !ReadValue(AreaEntry, Version) || !ReadString(AreaEntry, Name))
+      return false;
+    rDoc.AddLabel(rBaseAddr + RelOff, Label(Name, Type, Version), true);
+  }
+
+  // Cross references, destinations can be located in another memory area
+  u32 XRefCount;
+  if (!ReadValue(AreaEntry, XRefCount))
+    return false;
+  for (u32 Idx = 0; Idx < XRefCount; ++Idx)
+  {
+    OffsetType RelOff;
+    Address ToAddr;
+    if (!ReadValue(AreaEntry, RelOff) || !ReadAddress(AreaEntry, rDoc, ToAddr))
+      return false;
+    rDoc.AddCrossReference(ToAddr, rBaseAddr + RelOff);
+  }
+
+  // Multicells
+  u32 MultiCellCount;
+  if (!ReadValue(AreaEntry, MultiCellCount))
+    return false;
+  for (u32 Idx = 0; Idx < MultiCellCount; ++Idx)
+  {
+    OffsetType RelOff;
+    u8 Type;
+    u16 Size, InsnCnt;
+    std::string GraphViz;
+    if (!ReadValue(AreaEntry, RelOff) || !ReadValue(AreaEntry, Type) || !ReadValue(AreaEntry, Size)
+      || !ReadValue(AreaEntry, InsnCnt) || !ReadString(AreaEntry, GraphViz))
+      return false;
+
+    MultiCell::SPType spMultiCell;
+    if (Type == MultiCell::FunctionType)
+      spMultiCell = std::make_shared<Function>(Size, InsnCnt);
+    else
+      spMultiCell = std::make_shared<MultiCell>(Type, Size);
+
+    if (!GraphViz.empty())
+    {
+      auto spGraph = std::make_shared<Graph>();
+      if (Graph::FromGraphViz(*spGraph, GraphViz))
+        spMultiCell->SetGraph(spGraph);
+    }
+    rDoc.SetMultiCell(rBaseAddr + RelOff, spMultiCell, true);
+  }
+
+  // Comments
+  u32 CommentCount;
+  if (!ReadValue(AreaEntry, CommentCount))
+    return false;
+  for (u32 Idx = 0; Idx < CommentCount; ++Idx)
+  {
+    OffsetType RelOff;
+    std::string Comment;
+    if (!ReadValue(AreaEntry, RelOff) || !ReadString(AreaEntry, Comment))
+      return false;
+    rDoc.SetComment(rBaseAddr + RelOff, Comment);
+  }
+
+  return true;
+}
+
+bool AnalysisCache::_StoreArea(Document const& rDoc, MemoryArea const& rMemArea, std::string const& rKey) const
+{
+  auto EntryPath = _GetEntryPath(rKey, ".mda");
+  if (boost::filesystem::exists(EntryPath))
+    return true;
+
+  auto const& rBaseAddr = rMemArea.GetBaseAddress();
+
+  std::ostringstream Cells, XRefs, MultiCells, Comments;
+  u32 CellCount = 0, XRefCount = 0, MultiCellCount = 0, CommentCount = 0;
+
+  // The document moves from a cell to the next one, so multi-byte cells are read once
+  Address CurAddr = rBaseAddr;
+  OffsetType RelOff;
+  do
+  {
+    if (!IsInMemoryArea(rMemArea, CurAddr, RelOff))
+      break;
+
+    // Undefined bytes are read as 1-byte values, which is what an empty document returns anyway
+    CellData CurCellData;
+    if (rDoc.GetCellData(CurAddr, CurCellData) && CurCellData.GetType() != Cell::CellType && !IsDefaultCellData(CurCellData))
+    {
+      WriteValue<OffsetType>(Cells, RelOff);
+      WriteValue<u8>(Cells, CurCellData.GetType());
+      WriteValue<u8>(Cells, CurCellData.GetSubType());
+      WriteValue<u16>(Cells, CurCellData.GetSize());
+      WriteValue<u16>(Cells, CurCellData.GetFormatStyle());
+      WriteValue<u8>(Cells, CurCellData.GetFlags());
+      WriteValue<u8>(Cells, CurCellData.GetMode());
+      WriteValue<Tag>(Cells, CurCellData.GetArchitectureTag());
+      ++CellCount;
+    }
+
+    Address::Vector ToAddrs;
+    if (rDoc.GetCrossReferenceTo(CurAddr, ToAddrs))
+    {
+      for (auto const& rToAddr : ToAddrs)
+      {
+        WriteValue<OffsetType>(XRefs, RelOff);
+        WriteAddress(XRefs, rToAddr);
+        ++XRefCount;
+      }
+    }
+
+    auto spMultiCell = rDoc.GetMultiCell(CurAddr);
+    if (spMultiCell != nullptr)
+    {
+      u16 InsnCnt = 0;
+      if (spMultiCell->GetType() == MultiCell::FunctionType)
+        InsnCnt = std::static_pointer_cast<Function>(spMultiCell)->GetInstructionCount();
+      std::string GraphViz;
+      auto spGraph = spMultiCell->GetGraph();
+      if (spGraph != nullptr)
+        spGraph->ToGraphViz(GraphViz);
+
+      WriteValue<OffsetType>(MultiCells, RelOff);
+      WriteValue<u8>(MultiCells, spMultiCell->GetType());
+      WriteValue<u16>(MultiCells, spMultiCell->GetSize());
+      WriteValue<u16>(MultiCells, InsnCnt);
+      WriteString(MultiCells, GraphViz);
+      ++MultiCellCount;
+    }
+
+    std::string Comment;
+    if (rDoc.GetComment(CurAddr, Comment) && !Comment.empty())
+    {
+      WriteValue<OffsetType>(Comments, RelOff);
+      WriteString(Comments, Comment);
+      ++CommentCount;
+    }
+  } while (rDoc.GetNextAddress(CurAddr, CurAddr));
+
+  // Labels can be located on undefined cells, so they are not gathered with cells
+  std::ostringstream Labels;
+  u32 LabelCount = 0;
+  rDoc.ForEachLabel([&](Address const& rAddr, Label const& rLabel)
+  {
+    OffsetType RelOff;
+    if (!IsInMemoryArea(rMemArea, rAddr, RelOff))
+      return;
+    WriteValue<OffsetType>(Labels, RelOff);
+    WriteValue<u16>(Labels, rLabel.GetType());
+    WriteValue<u16>(Labels, rLabel.GetVersion());
+    WriteString(Labels, rLabel.GetName());
+    ++LabelCount;
+  });
+
+  auto TmpPath = EntryPath;
+  TmpPath += ".tmp";
+  {
+    std::ofstream AreaEntry(TmpPath.string(), std::ios::binary | std::ios::trunc);
+    if (!AreaEntry.is_open())
+    {
+      Log::Write("core").Level(LogError) << "unable to create cache entry " << TmpPath.string() << LogEnd;
+      return false;
+    }
+
+    WriteValue<u32>(AreaEntry, s_EntryMagic);
+    WriteValue<u32>(AreaEntry, s_EntryVersion);
+    WriteValue<u32>(AreaEntry, CellCount);      AreaEntry << Cells.str();
+    WriteValue<u32>(AreaEntry, LabelCount);     AreaEntry << Labels.str();
+    WriteValue<u32>(AreaEntry, XRefCount);      AreaEntry << XRefs.str();
+    WriteValue<u32>(AreaEntry, MultiCellCount); AreaEntry << MultiCells.str();
+    WriteValue<u32>(AreaEntry, CommentCount);   AreaEntry << Comments.str();
+    if (!AreaEntry)
+      return false;
+  }
+
+  boost::system::error_code ErrCode;
+  boost::filesystem::rename(TmpPath, EntryPath, ErrCode);
+  if (ErrCode)
+  {
+    Log::Write("core").Level(LogError) << "unable to write cache entry " << EntryPath.string() << LogEnd;
+    return false;
+  }
+  return true;
+}
+
+Path AnalysisCache::_GetEntryPath(std::string const& rKey, char const* pExtension) const
+{
+  return m_CachePath / (rKey + pExtension);
+}
+
+MEDUSA_NAMESPACE_END
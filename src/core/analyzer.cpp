@@ -1,13 +1,16 @@
 #include "medusa/analyzer.hpp"
+#include "medusa/analysis_cache.hpp"
 
 #include "medusa/version.hpp"
 #include "medusa/function.hpp"
 #include "medusa/character.hpp"
 #include "medusa/string.hpp"
+#include "medusa/string_scanner.hpp"
 #include "medusa/label.hpp"
 #include "medusa/log.hpp"
 #include "medusa/module.hpp"
 #include "medusa/symbolic.hpp"
+#include "medusa/user_configuration.hpp"
 #include "medusa/expression.hpp"
 #include "medusa/expression_visitor.hpp"
 
@@ -142,6 +145,29 @@ Task* Analyzer::CreateTask(std::string const& rTaskName, Document& rDoc)
     });
   }
 
+  if (rTaskName == "scan all strings")
+  {
+    return new AnalyzerTask(rTaskName, rDoc, [](Document& rDoc)
+    {
+      StringScanner Scanner(4, StringScanner::AllEncodings, true);
+      auto StrCnt = Scanner.CreateStrings(rDoc);
+      Log::Write("core") << "found " << StrCnt << " string(s)" << LogEnd;
+    });
+  }
+
+  if (rTaskName == "store analysis cache")
+  {
+    return new AnalyzerTask(rTaskName, rDoc, [](Document& rDoc)
+    {
+      UserConfiguration UserCfg;
+      AnalysisCache Cache(UserCfg.GetOption("core.cache_path"));
+      if (!Cache.IsEnabled())
+        return;
+      if (!Cache.Store(rDoc))
+        Log::Write("core").Level(LogWarning) << "unable to store the analysis in cache" << LogEnd;
+    });
+  }
+
   return nullptr;
 }
 
@@ -2,6 +2,9 @@
 #include "medusa/module.hpp"
 #include "medusa/expression_visitor.hpp"
 #include "medusa/graph.hpp"
+#include "medusa/instruction_buffer.hpp"
+
+#include <limits>
 
 namespace medusa
 {
@@ -249,35 +252,52 @@ namespace medusa
       return false;
     }
 
-    Instruction::SPType spInsn;
+    InstructionBuffer InsnBuf;
 
-    do
+    // Straight-line code is decoded by block, the address is only converted again
+    // when the block reaches the end of its memory area
+    for (;;)
     {
-      // Allocate a new instruction
-      spInsn = std::make_shared<Instruction>();
-
-      // Convert address to binary stream offset
+      MemoryArea MemArea;
       OffsetType InsnOff;
-      if (!m_rDoc.ConvertAddressToFileOffset(CurAddr, InsnOff))
+      if (!m_rDoc.GetMemoryArea(CurAddr, MemArea) || !m_rDoc.ConvertAddressToFileOffset(CurAddr, InsnOff))
       {
         ErrMsg = "failed to convert address " + CurAddr.ToString() + " to offset";
         break;
       }
+      OffsetType AreaEndOff = MemArea.GetFileOffset() + MemArea.GetFileSize();
 
-      // Try to disassemble the current instruction
-      if (!spArch->Disassemble(rBinStrm, InsnOff, *spInsn, ArchMode))
-      {
-        ErrMsg = "failed to disassemble instruction at " + CurAddr.ToString();
-        break;
-      }
+      size_t FirstInsn = InsnBuf.GetSize();
+      bool Res = spArch->DisassembleBlock(rBinStrm, InsnOff, ArchMode, std::numeric_limits<u32>::max(), true, InsnBuf);
 
-      rBasicBlock.push_back(spInsn);
+      bool LeftArea = false;
+      for (size_t InsnIdx = FirstInsn; InsnIdx < InsnBuf.GetSize(); ++InsnIdx)
+      {
+        if (InsnOff >= AreaEndOff)
+        {
+          InsnBuf.Truncate(InsnIdx);
+          LeftArea = true;
+          break;
+        }
 
-      CurAddr += spInsn->GetSize();
+        auto const& rspInsn = InsnBuf[InsnIdx];
+        rBasicBlock.push_back(rspInsn);
+        InsnOff += rspInsn->GetSize();
+        CurAddr += rspInsn->GetSize();
+      }
 
+      if (LeftArea)
+      {
+        if (InsnBuf.GetSize() != FirstInsn)
+          continue;
+        ErrMsg = "address " + CurAddr.ToString() + " is not backed by the file";
+        break;
+      }
 
-      // We continue to disassemble code until we already disassembled it
-    } while (!(spInsn->GetSubType() & (Instruction::JumpType | Instruction::CallType | Instruction::ReturnType)));
+      if (!Res)
+        ErrMsg = "failed to disassemble instruction at " + CurAddr.ToString();
+      break;
+    }
 
     // If this variable is not empty, we had an error during the disassembling
     if (!ErrMsg.empty())
@@ -4,35 +4,24 @@ namespace medusa
 {
   bool AnalyzerString::CreateUtf8String(void)
   {
-    static Utf8StringTrait Utf8Str;
-    s8 CurChar;
     OffsetType Offset;
-    u16 RawLen = 0;
     std::string StrData;
     auto const& rBinStrm = m_rDoc.GetBinaryStream();
 
     if (m_rDoc.ConvertAddressToFileOffset(m_Addr.GetOffset(), Offset) == false)
       return false;
 
-    for (;;)
+    // The terminator is located with memchr and the string is read at once
+    if (!rBinStrm.Read(Offset, StrData))
     {
-      if (!rBinStrm.Read(Offset + RawLen, CurChar))
-      {
-        Log::Write("core") << "Unable to read utf-8 string at " << m_Addr << LogEnd;
-        return false;
-      }
-
-      if (CurChar == '\0')
-        break;
-
-      StrData += CurChar;
-      ++RawLen;
+      Log::Write("core") << "Unable to read utf-8 string at " << m_Addr << LogEnd;
+      return false;
     }
 
-    if (RawLen == 0)
+    if (StrData.size() >= 0xffff)
       return false;
 
-    ++RawLen;
+    u16 RawLen = static_cast<u16>(StrData.size() + 1);
 
     auto spString = std::make_shared<String>(String::Utf8Type, RawLen);
     return m_rDoc.SetCellWithLabel(m_Addr, spString, Label(StrData, Label::String | Label::Global), true);
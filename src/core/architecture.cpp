@@ -31,6 +31,23 @@ bool Architecture::Disassemble(BinaryStream const& rBinStrm, OffsetType Offset,
   return false;
 };
 
+bool Architecture::DisassembleBlock(BinaryStream const& rBinStrm, OffsetType Offset, u8 Mode, u32 MaxInsns, bool StopOnBranch, InstructionBuffer& rInsnBuf)
+{
+  return _DisassembleBlock(rBinStrm, Offset, Mode, MaxInsns, StopOnBranch, rInsnBuf,
+    [this](BinaryStream const& rInsnStrm, OffsetType InsnOff, Instruction& rInsn, u8 InsnMode)
+  { return Disassemble(rInsnStrm, InsnOff, rInsn, InsnMode); });
+}
+
+bool Architecture::DecodeLength(BinaryStream const& rBinStrm, OffsetType Offset, u8 Mode, InsnClass& rInsnCls)
+{
+  Instruction Insn;
+  if (!Disassemble(rBinStrm, Offset, Insn, Mode))
+    return false;
+  rInsnCls.m_Length  = Insn.GetSize();
+  rInsnCls.m_SubType = Insn.GetSubType();
+  return true;
+}
+
 bool Architecture::HandleExpression(Expression::LSPType& rExprs, std::string const& rName, Instruction& rInsn, Expression::SPType spResExpr)
 {
   return true;
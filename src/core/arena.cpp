@@ -0,0 +1,64 @@
+#include "medusa/arena.hpp"
+
+#include <algorithm>
+
+MEDUSA_NAMESPACE_BEGIN
+
+size_t const Arena::MinChunkSize;
+size_t const Arena::MaxChunkSize;
+
+Arena::Arena(void)
+  : m_CurChunk(0), m_CurOff(0)
+{
+}
+
+Arena::~Arena(void)
+{
+}
+
+void* Arena::Allocate(size_t Size, size_t Align)
+{
+  for (; m_CurChunk < m_Chunks.size(); ++m_CurChunk, m_CurOff = 0)
+  {
+    auto& rChunk = m_Chunks[m_CurChunk];
+    size_t Off = (m_CurOff + Align - 1) & ~(Align - 1);
+    if (Off + Size <= rChunk.m_Size)
+    {
+      m_CurOff = Off + Size;
+      return rChunk.m_spData.get() + Off;
+    }
+  }
+
+  size_t ChunkSize = m_Chunks.empty() ? MinChunkSize : std::min(m_Chunks.back().m_Size * 2, MaxChunkSize);
+  ChunkSize = std::max(ChunkSize, Size + Align);
+  Chunk NewChunk;
+  NewChunk.m_spData.reset(new u8[ChunkSize]);
+  NewChunk.m_Size = ChunkSize;
+  m_Chunks.push_back(std::move(NewChunk));
+  m_CurChunk = m_Chunks.size() - 1;
+  m_CurOff = 0;
+  return Allocate(Size, Align);
+}
+
+void Arena::Rewind(void)
+{
+  m_CurChunk = 0;
+  m_CurOff = 0;
+}
+
+void Arena::Trim(void)
+{
+  // Chunks after the current one are only there because the arena was rewound
+  if (m_CurChunk + 1 < m_Chunks.size())
+    m_Chunks.resize(m_CurChunk + 1);
+}
+
+size_t Arena::GetReservedSize(void) const
+{
+  size_t Size = 0;
+  for (auto const& rChunk : m_Chunks)
+    Size += rChunk.m_Size;
+  return Size;
+}
+
+MEDUSA_NAMESPACE_END
@@ -0,0 +1,317 @@
+#include "medusa/binary_stream.hpp"
+
+#include <algorithm>
+
+MEDUSA_NAMESPACE_BEGIN
+
+/* binary stream */
+
+std::string const& BinaryStream::GetSha1(void) const
+{
+  if (!m_Sha1.empty())
+    return m_Sha1;
+
+  if (m_pBuffer != nullptr)
+  {
+    m_Sha1 = Sha1(m_pBuffer, static_cast<size_t>(m_Size));
+    return m_Sha1;
+  }
+
+  // Windowed stream, we have to hash it chunk by chunk
+  u64 const ChunkSize = 0x100000;
+  std::vector<u8> Chunk(static_cast<size_t>(std::min(ChunkSize, m_Size)));
+  OffsetType CurOff = 0;
+  m_Sha1 = Sha1([&](void const*& rpChunk, size_t& rChunkLength)
+  {
+    if (CurOff >= m_Size)
+      return false;
+    rChunkLength = static_cast<size_t>(std::min(ChunkSize, m_Size - CurOff));
+    if (!Read(CurOff, Chunk.data(), rChunkLength))
+      return false;
+    rpChunk = Chunk.data();
+    CurOff += rChunkLength;
+    return true;
+  });
+  return m_Sha1;
+}
+
+/* file binary stream */
+
+bool FileBinaryStream::_ReadWindow(OffsetType Position, void* pData, u64 Length) const
+{
+  std::lock_guard<MutexType> Lock(m_ViewMutex);
+
+  auto pView = _GetView(Position, Length);
+  if (pView == nullptr)
+    return false;
+
+  ::memcpy(pData, pView->m_pData + (Position - pView->m_Offset), static_cast<size_t>(Length));
+  return true;
+}
+
+u64 FileBinaryStream::_StringLength(OffsetType Position, u64 Limit) const
+{
+  std::lock_guard<MutexType> Lock(m_ViewMutex);
+
+  // Scan view after view, a string can span several of them
+  OffsetType CurPos = Position;
+  while (CurPos - Position < Limit)
+  {
+    auto pView = _GetView(CurPos, 1);
+    if (pView == nullptr)
+      return 0;
+
+    auto ViewEnd = std::min(pView->m_Offset + pView->m_Size, Position + Limit);
+    auto pCur = pView->m_pData + (CurPos - pView->m_Offset);
+    auto pEnd = static_cast<u8 const*>(::memchr(pCur, '\0', static_cast<size_t>(ViewEnd - CurPos)));
+    if (pEnd != nullptr)
+      return CurPos - Position + static_cast<u64>(pEnd - pCur);
+    CurPos = ViewEnd;
+  }
+
+  return 0;
+}
+
+FileBinaryStream::MappedView const* FileBinaryStream::_GetView(OffsetType Position, u64 Length) const
+{
+  ++m_ViewClock;
+
+  for (auto& rView : m_Views)
+  {
+    if (Position >= rView.m_Offset && Position + Length <= rView.m_Offset + rView.m_Size)
+    {
+      rView.m_LastUse = m_ViewClock;
+      return &rView;
+    }
+  }
+
+  // Map a new view which starts on the granularity and covers the whole request
+  auto const Granularity = _GetMapGranularity();
+  MappedView NewView;
+  NewView.m_Offset  = Position - (Position % Granularity);
+  NewView.m_Size    = std::max(m_WindowSize, Position + Length - NewView.m_Offset);
+  NewView.m_Size    = std::min(NewView.m_Size, m_Size - NewView.m_Offset);
+  NewView.m_LastUse = m_ViewClock;
+
+  // Evict the least recently used view if needed
+  if (m_Views.size() >= MaxViewCount)
+  {
+    auto itLru = std::min_element(std::begin(m_Views), std::end(m_Views),
+      [](MappedView const& rLhs, MappedView const& rRhs)
+    { return rLhs.m_LastUse < rRhs.m_LastUse; });
+    _UnmapRegion(itLru->m_pData, itLru->m_Size);
+    m_Views.erase(itLru);
+  }
+
+  NewView.m_pData = static_cast<u8 const*>(_MapRegion(NewView.m_Offset, NewView.m_Size));
+  if (NewView.m_pData == nullptr)
+    return nullptr;
+
+  m_Views.push_back(NewView);
+  return &m_Views.back();
+}
+
+void FileBinaryStream::_UnmapAllViews(void)
+{
+  std::lock_guard<MutexType> Lock(m_ViewMutex);
+
+  for (auto const& rView : m_Views)
+    _UnmapRegion(rView.m_pData, rView.m_Size);
+  m_Views.clear();
+  m_ViewClock = 0;
+}
+
+/* overlay binary stream */
+
+OverlayBinaryStream::OverlayBinaryStream(BinaryStream::SPType spBaseBinStrm, OffsetType BaseOffset, u64 BaseSize, u64 Size)
+  : BinaryStream()
+  , m_spBaseBinStrm(spBaseBinStrm)
+  , m_BaseOffset(BaseOffset)
+  , m_BaseSize(std::min(BaseSize, Size))
+  , m_pBaseBuffer(nullptr)
+  , m_IsDirty(false)
+{
+  auto pBaseBuf = static_cast<u8 const*>(spBaseBinStrm->GetBuffer());
+  if (pBaseBuf != nullptr)
+    m_pBaseBuffer = pBaseBuf + BaseOffset;
+
+  m_Path       = spBaseBinStrm->GetPath();
+  m_Size       = Size;
+  m_Endianness = spBaseBinStrm->GetEndianness();
+}
+
+OverlayBinaryStream::~OverlayBinaryStream(void)
+{
+  Close();
+}
+
+void OverlayBinaryStream::Close(void)
+{
+  std::lock_guard<MutexType> Lock(m_PageMutex);
+  m_DirtyPages.clear();
+  m_IsDirty = false;
+  m_Size = 0x0;
+  m_Endianness = EndianUnknown;
+}
+
+size_t OverlayBinaryStream::GetDirtyPageCount(void) const
+{
+  std::lock_guard<MutexType> Lock(m_PageMutex);
+  return m_DirtyPages.size();
+}
+
+void OverlayBinaryStream::Revert(void)
+{
+  std::lock_guard<MutexType> Lock(m_PageMutex);
+  m_DirtyPages.clear();
+  m_IsDirty = false;
+}
+
+bool OverlayBinaryStream::_ReadWindow(OffsetType Position, void* pData, u64 Length) const
+{
+  // Fast path: nothing has been copied, the underlying stream holds the whole content
+  if (!m_IsDirty.load(std::memory_order_acquire))
+    return _ReadBase(Position, static_cast<u8*>(pData), Length);
+
+  std::lock_guard<MutexType> Lock(m_PageMutex);
+
+  auto pCur = static_cast<u8*>(pData);
+  while (Length != 0)
+  {
+    u32 PageOff = static_cast<u32>(Position % PageSize);
+    u32 ReadLen = static_cast<u32>(std::min<u64>(Length, PageSize - PageOff));
+    if (!_ReadPage(Position / PageSize, PageOff, pCur, ReadLen))
+      return false;
+    Position += ReadLen;
+    pCur     += ReadLen;
+    Length   -= ReadLen;
+  }
+  return true;
+}
+
+u64 OverlayBinaryStream::_StringLength(OffsetType Position, u64 Limit) const
+{
+  if (!m_IsDirty.load(std::memory_order_acquire) && m_pBaseBuffer != nullptr)
+  {
+    // Bytes after BaseSize are zero, so they end the string
+    if (Position >= m_BaseSize)
+      return 0;
+    u64 BaseLen = std::min(Limit, m_BaseSize - Position);
+    auto pEnd = static_cast<u8 const*>(::memchr(m_pBaseBuffer + Position, '\0', static_cast<size_t>(BaseLen)));
+    if (pEnd != nullptr)
+      return static_cast<u64>(pEnd - (m_pBaseBuffer + Position));
+    return BaseLen < Limit ? BaseLen : 0;
+  }
+
+  std::lock_guard<MutexType> Lock(m_PageMutex);
+
+  u8 Page[PageSize];
+  u64 StrLen = 0;
+  while (StrLen < Limit)
+  {
+    OffsetType CurPos = Position + StrLen;
+    u32 PageOff = static_cast<u32>(CurPos % PageSize);
+    u32 ReadLen = static_cast<u32>(std::min<u64>(Limit - StrLen, PageSize - PageOff));
+    if (!_ReadPage(CurPos / PageSize, PageOff, Page, ReadLen))
+      return 0;
+    auto pEnd = static_cast<u8 const*>(::memchr(Page, '\0', ReadLen));
+    if (pEnd != nullptr)
+      return StrLen + static_cast<u64>(pEnd - Page);
+    StrLen += ReadLen;
+  }
+  return 0;
+}
+
+bool OverlayBinaryStream::_WriteWindow(OffsetType Position, void const* pData, u64 Length)
+{
+  std::lock_guard<MutexType> Lock(m_PageMutex);
+
+  auto pCur = static_cast<u8 const*>(pData);
+  while (Length != 0)
+  {
+    u64 PageIdx = Position / PageSize;
+    u32 PageOff = static_cast<u32>(Position % PageSize);
+    u32 WriteLen = static_cast<u32>(std::min<u64>(Length, PageSize - PageOff));
+
+    auto pPage = _GetDirtyPage(PageIdx);
+    if (pPage == nullptr)
+      return false;
+
+    ::memcpy(pPage + PageOff, pCur, WriteLen);
+    Position += WriteLen;
+    pCur     += WriteLen;
+    Length   -= WriteLen;
+  }
+  return true;
+}
+
+u8* OverlayBinaryStream::GetPageBuffer(u64 PageIdx)
+{
+  std::lock_guard<MutexType> Lock(m_PageMutex);
+  if (PageIdx * PageSize >= m_Size)
+    return nullptr;
+  return _GetDirtyPage(PageIdx);
+}
+
+u8 const* OverlayBinaryStream::GetReadBuffer(OffsetType Position, u64 Length) const
+{
+  u32 PageOff = static_cast<u32>(Position % PageSize);
+  if (PageOff + Length > PageSize || Position + Length > m_Size)
+    return nullptr;
+
+  if (m_IsDirty.load(std::memory_order_acquire))
+  {
+    std::lock_guard<MutexType> Lock(m_PageMutex);
+    auto itPage = m_DirtyPages.find(Position / PageSize);
+    if (itPage != std::end(m_DirtyPages))
+      return itPage->second.get() + PageOff;
+  }
+
+  if (m_pBaseBuffer == nullptr || Position + Length > m_BaseSize)
+    return nullptr;
+  return m_pBaseBuffer + Position;
+}
+
+u8* OverlayBinaryStream::_GetDirtyPage(u64 PageIdx)
+{
+  auto itPage = m_DirtyPages.find(PageIdx);
+  if (itPage != std::end(m_DirtyPages))
+    return itPage->second.get();
+
+  // First access on this page, copy it from the underlying stream
+  std::unique_ptr<u8[]> upPage(new u8[PageSize]);
+  if (!_ReadPage(PageIdx, 0, upPage.get(), PageSize))
+    return nullptr;
+  auto pPage = m_DirtyPages.emplace(PageIdx, std::move(upPage)).first->second.get();
+  m_IsDirty.store(true, std::memory_order_release);
+  return pPage;
+}
+
+bool OverlayBinaryStream::_ReadBase(OffsetType Position, u8* pData, u64 Length) const
+{
+  // The last page can go beyond the end of the stream, it's also zeroed
+  u64 BaseLen = Position < m_BaseSize ? std::min<u64>(Length, m_BaseSize - Position) : 0;
+  if (BaseLen != 0)
+  {
+    if (m_pBaseBuffer != nullptr)
+      ::memcpy(pData, m_pBaseBuffer + Position, static_cast<size_t>(BaseLen));
+    else if (!m_spBaseBinStrm->Read(m_BaseOffset + Position, pData, static_cast<size_t>(BaseLen)))
+      return false;
+  }
+  ::memset(pData + BaseLen, 0x0, static_cast<size_t>(Length - BaseLen));
+  return true;
+}
+
+bool OverlayBinaryStream::_ReadPage(u64 PageIdx, u32 PageOff, u8* pData, u32 Length) const
+{
+  auto itPage = m_DirtyPages.find(PageIdx);
+  if (itPage != std::end(m_DirtyPages))
+  {
+    ::memcpy(pData, itPage->second.get() + PageOff, Length);
+    return true;
+  }
+
+  return _ReadBase(PageIdx * PageSize + PageOff, pData, Length);
+}
+
+MEDUSA_NAMESPACE_END
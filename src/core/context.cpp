@@ -1,5 +1,7 @@
 #include "medusa/context.hpp"
 #include <iomanip>
+#include <algorithm>
+#include <cstring>
 
 MEDUSA_NAMESPACE_BEGIN
 
@@ -84,6 +86,43 @@ bool CpuContext::WriteRegister<BitVector>(u32 Reg, BitVector const& rVal)
   }
 }
 
+bool CpuContext::_ReadRegister(RegisterDescriptor const* pRegDesc, void const* pCtxt, void* pVal, u32 BitSize)
+{
+  if (pRegDesc == nullptr || pRegDesc->m_BitSize != BitSize)
+    return false;
+
+  auto RegVal = LoadRegister(*pRegDesc, pCtxt);
+  switch (BitSize)
+  {
+  case  1: *static_cast<bool*>(pVal) = RegVal != 0;           break;
+  case  8: *static_cast<u8  *>(pVal) = static_cast<u8 >(RegVal); break;
+  case 16: *static_cast<u16 *>(pVal) = static_cast<u16>(RegVal); break;
+  case 32: *static_cast<u32 *>(pVal) = static_cast<u32>(RegVal); break;
+  case 64: *static_cast<u64 *>(pVal) = RegVal;                   break;
+  default: return false;
+  }
+  return true;
+}
+
+bool CpuContext::_WriteRegister(RegisterDescriptor const* pRegDesc, void* pCtxt, void const* pVal, u32 BitSize)
+{
+  if (pRegDesc == nullptr || pRegDesc->m_BitSize != BitSize)
+    return false;
+
+  u64 RegVal;
+  switch (BitSize)
+  {
+  case  1: RegVal = *static_cast<u8  const*>(pVal) ? 1 : 0; break;
+  case  8: RegVal = *static_cast<u8  const*>(pVal);         break;
+  case 16: RegVal = *static_cast<u16 const*>(pVal);         break;
+  case 32: RegVal = *static_cast<u32 const*>(pVal);         break;
+  case 64: RegVal = *static_cast<u64 const*>(pVal);         break;
+  default: return false;
+  }
+  StoreRegister(*pRegDesc, pCtxt, RegVal);
+  return true;
+}
+
 bool CpuContext::Translate(Address const& rLogicalAddress, u64& rLinearAddress) const
 {
   std::lock_guard<std::mutex> Lock(m_CpuLock);
@@ -135,12 +174,26 @@ namespace
       return false;
     return true;
   }
+
+  // Some emulators require a raw pointer, in this case the chunk is copied once in its own memory
+  bool FlattenMemoryChunk(MemoryContext::MemoryChunk& rMemChnk)
+  {
+    auto const& rBinStrm = *rMemChnk.m_spMemStrm;
+    auto spMemStrm = std::make_shared<MemoryBinaryStream>(nullptr, rBinStrm.GetSize());
+    if (!rBinStrm.Read(0x0, spMemStrm->GetBuffer(), static_cast<size_t>(rBinStrm.GetSize())))
+      return false;
+    spMemStrm->SetEndianness(rBinStrm.GetEndianness());
+    rMemChnk.m_spMemStrm = spMemStrm;
+    return true;
+  }
 }
 
+u32 const MemoryContext::PageShift;
+u32 const MemoryContext::PageSize;
+
 template<>
 bool MemoryContext::ReadMemory<BitVector>(u64 LinAddr, BitVector& rVal) const
 {
-  std::lock_guard<decltype(m_MemoryLock)> Lock(m_MemoryLock);
   switch (rVal.GetBitSize())
   {
   default:  return false;
@@ -157,7 +210,6 @@ bool MemoryContext::ReadMemory<BitVector>(u64 LinAddr, BitVector& rVal) const
 template<>
 bool MemoryContext::WriteMemory<BitVector>(u64 LinAddr, BitVector const& rVal)
 {
-  std::lock_guard<decltype(m_MemoryLock)> Lock(m_MemoryLock);
   switch (rVal.GetBitSize())
   {
   default:  return false;
@@ -171,6 +223,30 @@ bool MemoryContext::WriteMemory<BitVector>(u64 LinAddr, BitVector const& rVal)
   }
 }
 
+namespace
+{
+  // The page number is split in 6 levels of 9 bits
+  u32 const PageTableBits   = 9;
+  u32 const PageTableLevels = 6;
+  u32 const PageTableSize   = 1 << PageTableBits;
+  u64 const PageTableMask   = PageTableSize - 1;
+}
+
+struct MemoryContext::PageTableNode
+{
+  std::unique_ptr<PageTableNode> m_Nodes[PageTableSize];
+  std::unique_ptr<Page[]>        m_spPages; // only allocated in the last level
+};
+
+MemoryContext::MemoryContext(CpuInformation const& rCpuInfo)
+  : m_rCpuInfo(rCpuInfo)
+  , m_spPageTable(new PageTableNode)
+  , m_Generation(0)
+  , m_AccessCheck(false)
+  , m_Shared(true)
+{
+}
+
 MemoryContext::~MemoryContext(void)
 {
   std::lock_guard<decltype(m_MemoryLock)> Lock(m_MemoryLock);
@@ -180,27 +256,62 @@ MemoryContext::~MemoryContext(void)
 
 bool MemoryContext::ReadMemory(u64 LinearAddress, void* pValue, u32 ValueSize) const
 {
-  std::lock_guard<decltype(m_MemoryLock)> Lock(m_MemoryLock);
-  MemoryChunk MemChnk;
-  if (!_FindMemoryChunk(LinearAddress, MemChnk))
-    return false;
+  auto Lock = _Lock();
+  auto pCurVal = static_cast<u8*>(pValue);
+
+  // The access is split on page boundaries
+  while (ValueSize != 0)
+  {
+    BinaryStream* pMemStrm;
+    u8* pRaw;
+    u64 StrmOff;
+    u32 PieceSize;
+    if (!_GetPiece(LinearAddress, ValueSize, MemoryArea::Access::Read, pMemStrm, pRaw, StrmOff, PieceSize))
+      return false;
+
+    if (pRaw != nullptr)
+      ::memcpy(pCurVal, pRaw, PieceSize);
+    else if (!pMemStrm->Read(StrmOff, pCurVal, PieceSize))
+      return false;
 
-  // LATER: Check boundary!
-  auto Offset = LinearAddress - MemChnk.m_LinearAddress;
-  memcpy(pValue, reinterpret_cast<u8 const*>(MemChnk.m_spMemStrm->GetBuffer()) + Offset, ValueSize);
+    LinearAddress += PieceSize;
+    pCurVal       += PieceSize;
+    ValueSize     -= PieceSize;
+  }
   return true;
 }
 
 bool MemoryContext::WriteMemory(u64 LinearAddress, void const* pValue, u32 ValueSize)
 {
-  std::lock_guard<decltype(m_MemoryLock)> Lock(m_MemoryLock);
-  MemoryChunk MemChnk;
-  if (!_FindMemoryChunk(LinearAddress, MemChnk))
-    return false;
+  auto Lock = _Lock();
+  auto pCurVal = static_cast<u8 const*>(pValue);
+
+  while (ValueSize != 0)
+  {
+    BinaryStream* pMemStrm;
+    u8* pRaw;
+    u64 StrmOff;
+    u32 PieceSize;
+    if (!_GetPiece(LinearAddress, ValueSize, MemoryArea::Access::Write, pMemStrm, pRaw, StrmOff, PieceSize))
+      return false;
+
+    // Overlay chunks only copy the written pages
+    if (pRaw == nullptr)
+    {
+      auto pPage = _GetPage(LinearAddress, false);
+      if (!pPage->m_Split && _MapOverlayPage(*pPage, true))
+        pRaw = pPage->m_pRaw + (static_cast<u32>(LinearAddress & (PageSize - 1)) - pPage->m_Begin);
+    }
+
+    if (pRaw != nullptr)
+      ::memcpy(pRaw, pCurVal, PieceSize);
+    else if (!pMemStrm->Write(StrmOff, pCurVal, PieceSize))
+      return false;
 
-  // LATER: Check boundary!
-  auto Offset = LinearAddress - MemChnk.m_LinearAddress;
-  memcpy(reinterpret_cast<u8 *>(MemChnk.m_spMemStrm->GetBuffer()) + Offset, pValue, ValueSize);
+    LinearAddress += PieceSize;
+    pCurVal       += PieceSize;
+    ValueSize     -= PieceSize;
+  }
   return true;
 }
 
@@ -237,10 +348,16 @@ bool MemoryContext::FindMemory(u64 LinAddr, void*& prAddress, u32& rOffset, u32&
 {
   std::lock_guard<decltype(m_MemoryLock)> Lock(m_MemoryLock);
 
-  for (MemoryChunk const& rMemChnk : m_Memories)
+  for (MemoryChunk& rMemChnk : m_Memories)
   {
     if (LinAddr >= rMemChnk.m_LinearAddress && LinAddr < (rMemChnk.m_LinearAddress + rMemChnk.m_spMemStrm->GetSize()))
     {
+      if (rMemChnk.m_spMemStrm->GetBuffer() == nullptr)
+      {
+        if (!FlattenMemoryChunk(rMemChnk))
+          return false;
+        _UpdatePages(rMemChnk.m_LinearAddress, rMemChnk.m_spMemStrm->GetSize());
+      }
       prAddress = rMemChnk.m_spMemStrm->GetBuffer();
       rOffset = LinAddr - rMemChnk.m_LinearAddress;
       rSize = rMemChnk.m_spMemStrm->GetSize();
@@ -262,6 +379,7 @@ bool MemoryContext::AllocateMemory(u64 LinAddr, u32 Size, MemoryArea::Access Fla
     *ppRawMemory = m_Memories.back().m_spMemStrm->GetBuffer();
   m_Memories.back().m_spMemStrm->Write(0x0, 0xfa, Size);
   std::sort(std::begin(m_Memories), std::end(m_Memories));
+  _UpdatePages(LinAddr, Size);
   return true;
 }
 
@@ -272,6 +390,43 @@ bool MemoryContext::ProtectMemory(u64 LinAddr, MemoryArea::Access Flags)
   if (itMemChnk == std::end(m_Memories))
     return false;
   itMemChnk->m_Flags = Flags;
+
+  // Pages mapped on this chunk take its flags, even if it covers them partially; split pages keep the flags of each chunk
+  auto ChnkSize = itMemChnk->m_spMemStrm->GetSize();
+  for (u64 PageAddr = LinAddr & ~static_cast<u64>(PageSize - 1); PageAddr < LinAddr + ChnkSize; PageAddr += PageSize)
+  {
+    auto pPage = _GetPage(PageAddr, false);
+    if (pPage != nullptr && pPage->m_pMemStrm == itMemChnk->m_spMemStrm.get())
+      pPage->m_Flags = Flags;
+  }
+  ++m_Generation;
+  return true;
+}
+
+bool MemoryContext::ProtectMemory(u64 LinAddr, u32 Size, MemoryArea::Access Flags)
+{
+  std::lock_guard<decltype(m_MemoryLock)> Lock(m_MemoryLock);
+  if (Size == 0)
+    return false;
+
+  // Every page must be mapped, split pages can't be protected since their chunks have their own flags
+  u64 FirstPageAddr = LinAddr & ~static_cast<u64>(PageSize - 1);
+  u64 EndAddr       = LinAddr + Size;
+  for (u64 PageAddr = FirstPageAddr; PageAddr < EndAddr; PageAddr += PageSize)
+  {
+    auto pPage = _GetPage(PageAddr, false);
+    if (pPage == nullptr || pPage->m_pMemStrm == nullptr || pPage->m_Split)
+      return false;
+  }
+
+  for (u64 PageAddr = FirstPageAddr; PageAddr < EndAddr; PageAddr += PageSize)
+  {
+    auto pPage = _GetPage(PageAddr, false);
+    pPage->m_Flags = Flags;
+    if ((Flags & MemoryArea::Access::Write) == MemoryArea::Access::Write && pPage->m_pRaw == nullptr)
+      _MapOverlayPage(*pPage, true);
+  }
+  ++m_Generation;
   return true;
 }
 
@@ -281,8 +436,10 @@ bool MemoryContext::FreeMemory(u64 LinAddr)
   auto itMemChnk = std::find(std::begin(m_Memories), std::end(m_Memories), LinAddr);
   if (itMemChnk == std::end(m_Memories))
     return false;
+  auto ChnkSize = itMemChnk->m_spMemStrm->GetSize();
   itMemChnk->m_spMemStrm->Close();
   m_Memories.erase(itMemChnk);
+  _UpdatePages(LinAddr, ChnkSize);
   return true;
 }
 
@@ -290,6 +447,8 @@ bool MemoryContext::MapDocument(Document const& rDoc, CpuContext const* pCpuCtxt
 {
   std::lock_guard<decltype(m_MemoryLock)> Lock(m_MemoryLock);
   bool Res = true;
+  auto spBinStrm = rDoc.GetSharedBinaryStream();
+  auto const& rBinStrm = *spBinStrm;
   rDoc.ForEachMemoryArea([&](MemoryArea const& rMemArea)
   {
     Address const& rMemAreaAddr = rMemArea.GetBaseAddress();
@@ -298,34 +457,28 @@ bool MemoryContext::MapDocument(Document const& rDoc, CpuContext const* pCpuCtxt
     auto Size                    = std::max(MemAreaSize, MemAreaFileSize); // TODO: be more careful with that
     auto Flags                   = rMemArea.GetAccess();
 
-    void* pRawMemory;
     u64 LinearAddress;
     if (pCpuCtxt->Translate(rMemAreaAddr, LinearAddress) == false)
       LinearAddress = rMemAreaAddr.GetOffset();
 
-    if (AllocateMemory(LinearAddress, Size, Flags, &pRawMemory) == false)
-    {
-      Res = false;
-      return;
-    }
-
-    ::memset(pRawMemory, 0x0, Size);
-
-    // TODO: Do we have to zero-out memory?
-    if (MemAreaFileSize == 0x0)
-      return;
-
-    OffsetType MemAreaFileOff;
-    if (rDoc.ConvertAddressToFileOffset(rMemAreaAddr, MemAreaFileOff) == false)
-      return;
+    OffsetType MemAreaFileOff = 0x0;
+    if (MemAreaFileSize != 0x0 && rDoc.ConvertAddressToFileOffset(rMemAreaAddr, MemAreaFileOff) == false)
+      MemAreaFileSize = 0x0;
 
-    if (!rDoc.GetBinaryStream().Read(MemAreaFileOff, pRawMemory, MemAreaFileSize))
+    if (MemAreaFileOff + MemAreaFileSize > rBinStrm.GetSize())
     {
-      FreeMemory(LinearAddress);
       Res = false;
       return;
     }
+
+    // Nothing is copied here, the file content is read through the overlay
+    // and only pages written later (emulation, patches) are duplicated
+    auto spOverlay = std::make_shared<OverlayBinaryStream>(spBinStrm, MemAreaFileOff, MemAreaFileSize, Size);
+    m_Memories.emplace_back(LinearAddress, spOverlay, Flags);
   });
+  std::sort(std::begin(m_Memories), std::end(m_Memories));
+  for (auto const& rMemChnk : m_Memories)
+    _UpdatePages(rMemChnk.m_LinearAddress, rMemChnk.m_spMemStrm->GetSize());
   return Res;
 }
 
@@ -343,7 +496,9 @@ std::string MemoryContext::ToString(void) const
       << ", size: " << std::hex << std::setw(8)  << std::setfill('0') << rMemChnk.m_spMemStrm->GetSize()
       << ", flags:" << std::hex << std::setw(8)  << std::setfill('0') << static_cast<int>(rMemChnk.m_Flags)
       << ", rawb: " << rMemChnk.m_spMemStrm->GetBuffer() << std::endl;
-    HexDump(oss, rMemChnk.m_spMemStrm->GetBuffer(), static_cast<u16>(rMemChnk.m_spMemStrm->GetSize()), rMemChnk.m_LinearAddress);
+    std::vector<u8> Dump(static_cast<u16>(rMemChnk.m_spMemStrm->GetSize()));
+    if (rMemChnk.m_spMemStrm->Read(0, Dump.data(), Dump.size()))
+      HexDump(oss, Dump.data(), static_cast<u16>(Dump.size()), rMemChnk.m_LinearAddress);
   }
   return oss.str();
 }
@@ -363,4 +518,301 @@ bool MemoryContext::_FindMemoryChunk(u64 LinearAddress, MemoryChunk& rFoundMemCh
   return false;
 }
 
+MemoryContext::Page const* MemoryContext::FindPage(u64 LinAddr) const
+{
+  auto Lock = _Lock();
+  auto pPage = _GetPage(LinAddr, false);
+  if (pPage == nullptr || pPage->m_pMemStrm == nullptr)
+    return nullptr;
+
+  // Overlay chunks have no buffer, reading a clean page must not copy it
+  if (pPage->m_pReadRaw == nullptr && !pPage->m_Split)
+    _MapOverlayPage(*pPage, false);
+  return pPage;
+}
+
+MemoryContext::Page const* MemoryContext::FindWritablePage(u64 LinAddr)
+{
+  auto Lock = _Lock();
+  auto pPage = _GetPage(LinAddr, false);
+  if (pPage == nullptr || pPage->m_pMemStrm == nullptr)
+    return nullptr;
+
+  if (pPage->m_pRaw == nullptr && !pPage->m_Split)
+    _MapOverlayPage(*pPage, true);
+  return pPage;
+}
+
+std::unique_lock<std::recursive_mutex> MemoryContext::_Lock(void) const
+{
+  if (!m_Shared)
+    return std::unique_lock<std::recursive_mutex>();
+  return std::unique_lock<std::recursive_mutex>(m_MemoryLock);
+}
+
+bool MemoryContext::_GetPiece(u64 LinAddr, u32 Size, MemoryArea::Access Access, BinaryStream*& rpMemStrm, u8*& rpRaw, u64& rStrmOff, u32& rPieceSize) const
+{
+  auto pPage = _GetPage(LinAddr, false);
+  if (pPage == nullptr || pPage->m_pMemStrm == nullptr)
+    return false;
+
+  u32 PageOff    = static_cast<u32>(LinAddr & (PageSize - 1));
+  u32 MaxSize    = std::min(Size, PageSize - PageOff);
+  auto ChnkFlags = pPage->m_Flags;
+
+  if (pPage->m_Split)
+  {
+    auto itMemChnk = std::find_if(std::begin(m_Memories), std::end(m_Memories), [&](MemoryChunk const& rMemChnk)
+    {
+      return LinAddr >= rMemChnk.m_LinearAddress && LinAddr < rMemChnk.m_LinearAddress + rMemChnk.m_spMemStrm->GetSize();
+    });
+    if (itMemChnk == std::end(m_Memories))
+      return false;
+
+    auto pRaw  = static_cast<u8*>(itMemChnk->m_spMemStrm->GetBuffer());
+    rpMemStrm  = itMemChnk->m_spMemStrm.get();
+    rStrmOff   = LinAddr - itMemChnk->m_LinearAddress;
+    rpRaw      = pRaw != nullptr ? pRaw + rStrmOff : nullptr;
+    rPieceSize = static_cast<u32>(std::min<u64>(MaxSize, itMemChnk->m_spMemStrm->GetSize() - rStrmOff));
+    ChnkFlags  = itMemChnk->m_Flags;
+  }
+  else
+  {
+    if (PageOff < pPage->m_Begin || PageOff >= pPage->m_End)
+      return false;
+
+    u32 MappedOff = PageOff - pPage->m_Begin;
+    rpMemStrm  = pPage->m_pMemStrm;
+    rStrmOff   = pPage->m_StrmOff + MappedOff;
+    rpRaw      = pPage->m_pRaw != nullptr ? pPage->m_pRaw + MappedOff : nullptr;
+    rPieceSize = std::min<u32>(MaxSize, pPage->m_End - PageOff);
+  }
+
+  if (m_AccessCheck && (ChnkFlags & Access) != Access)
+    return false;
+  return true;
+}
+
+MemoryContext::Page* MemoryContext::_GetPage(u64 LinAddr, bool Create) const
+{
+  u64 PageNo = LinAddr >> PageShift;
+  auto pNode = m_spPageTable.get();
+
+  for (u32 Level = PageTableLevels - 1; Level != 0; --Level)
+  {
+    auto& rspNode = pNode->m_Nodes[(PageNo >> (Level * PageTableBits)) & PageTableMask];
+    if (rspNode == nullptr)
+    {
+      if (!Create)
+        return nullptr;
+      rspNode.reset(new PageTableNode);
+    }
+    pNode = rspNode.get();
+  }
+
+  if (pNode->m_spPages == nullptr)
+  {
+    if (!Create)
+      return nullptr;
+    pNode->m_spPages.reset(new Page[PageTableSize]());
+  }
+  return &pNode->m_spPages[PageNo & PageTableMask];
+}
+
+// The raw pointers of a page are a cache of its chunk, filling them doesn't modify the memory, that's why const
+// methods are allowed to do it. A page is only mapped if it matches an overlay page, so writing an overlay page
+// through the stream always goes through the context page which maps it.
+bool MemoryContext::_MapOverlayPage(Page& rPage, bool Write) const
+{
+  static_assert(OverlayBinaryStream::PageSize == PageSize, "overlay pages must match the context pages");
+
+  auto pOvrStrm = dynamic_cast<OverlayBinaryStream*>(rPage.m_pMemStrm);
+  if (pOvrStrm == nullptr || (rPage.m_StrmOff & (PageSize - 1)) != rPage.m_Begin)
+    return false;
+
+  u32 MappedSize = rPage.m_End - rPage.m_Begin;
+  if (!Write)
+  {
+    rPage.m_pReadRaw = pOvrStrm->GetReadBuffer(rPage.m_StrmOff, MappedSize);
+    return rPage.m_pReadRaw != nullptr;
+  }
+
+  auto pOvrPage = pOvrStrm->GetPageBuffer(rPage.m_StrmOff / PageSize);
+  if (pOvrPage == nullptr)
+    return false;
+  rPage.m_pRaw     = pOvrPage + rPage.m_Begin;
+  rPage.m_pReadRaw = rPage.m_pRaw;
+
+  // Pages cached by the TLBs could still be mapped on the underlying buffer
+  ++m_Generation;
+  return true;
+}
+
+void MemoryContext::_UpdatePages(u64 LinAddr, u64 Size) const
+{
+  u64 EndAddr = LinAddr + Size;
+  for (u64 PageAddr = LinAddr & ~static_cast<u64>(PageSize - 1); PageAddr < EndAddr; PageAddr += PageSize)
+  {
+    Page NewPage = {};
+    bool Mapped  = false;
+
+    for (auto const& rMemChnk : m_Memories)
+    {
+      u64 ChnkBeg = rMemChnk.m_LinearAddress;
+      u64 ChnkEnd = ChnkBeg + rMemChnk.m_spMemStrm->GetSize();
+      u64 Beg     = std::max(ChnkBeg, PageAddr);
+      u64 End     = std::min(ChnkEnd, PageAddr + PageSize);
+      if (Beg >= End)
+        continue;
+
+      if (Mapped)
+      {
+        NewPage.m_Split = true;
+        break;
+      }
+
+      auto pRaw         = static_cast<u8*>(rMemChnk.m_spMemStrm->GetBuffer());
+      NewPage.m_pMemStrm = rMemChnk.m_spMemStrm.get();
+      NewPage.m_StrmOff  = Beg - ChnkBeg;
+      NewPage.m_pRaw     = pRaw != nullptr ? pRaw + NewPage.m_StrmOff : nullptr;
+      NewPage.m_pReadRaw = NewPage.m_pRaw;
+      NewPage.m_Begin    = static_cast<u16>(Beg - PageAddr);
+      NewPage.m_End      = static_cast<u16>(End - PageAddr);
+      NewPage.m_Flags    = rMemChnk.m_Flags;
+      Mapped = true;
+    }
+
+    auto pPage = _GetPage(PageAddr, Mapped);
+    if (pPage == nullptr)
+      continue;
+
+    // Keep the flags set by page if the same part of the chunk is still mapped (e.g. flattened overlay)
+    if (Mapped && !NewPage.m_Split && pPage->m_pMemStrm != nullptr && !pPage->m_Split
+      && pPage->m_Begin == NewPage.m_Begin && pPage->m_End == NewPage.m_End && pPage->m_StrmOff == NewPage.m_StrmOff)
+      NewPage.m_Flags = pPage->m_Flags;
+
+    *pPage = NewPage;
+  }
+  ++m_Generation;
+}
+
+MemoryTlb::MemoryTlb(void)
+  : m_pMemCtxt(nullptr)
+  , m_Generation(0)
+{
+  Flush();
+}
+
+bool MemoryTlb::Read(MemoryContext const& rMemCtxt, u64 LinAddr, void* pVal, u32 Size)
+{
+  auto pPage = _Lookup(rMemCtxt, LinAddr);
+  u32 PageOff = static_cast<u32>(LinAddr & (MemoryContext::PageSize - 1));
+  if (pPage == nullptr || pPage->m_pReadRaw == nullptr
+    || PageOff < pPage->m_Begin || PageOff + Size > pPage->m_End
+    || (rMemCtxt.HasAccessCheck() && (pPage->m_Flags & MemoryArea::Access::Read) != MemoryArea::Access::Read))
+    return rMemCtxt.ReadMemory(LinAddr, pVal, Size);
+
+  ::memcpy(pVal, pPage->m_pReadRaw + (PageOff - pPage->m_Begin), Size);
+  return true;
+}
+
+bool MemoryTlb::Write(MemoryContext& rMemCtxt, u64 LinAddr, void const* pVal, u32 Size)
+{
+  auto pPage = _LookupWritable(rMemCtxt, LinAddr);
+  u32 PageOff = static_cast<u32>(LinAddr & (MemoryContext::PageSize - 1));
+  if (pPage == nullptr || pPage->m_pRaw == nullptr
+    || PageOff < pPage->m_Begin || PageOff + Size > pPage->m_End
+    || (rMemCtxt.HasAccessCheck() && (pPage->m_Flags & MemoryArea::Access::Write) != MemoryArea::Access::Write))
+    return rMemCtxt.WriteMemory(LinAddr, pVal, Size);
+
+  ::memcpy(pPage->m_pRaw + (PageOff - pPage->m_Begin), pVal, Size);
+  return true;
+}
+
+void* MemoryTlb::GetRawMemory(MemoryContext& rMemCtxt, u64 LinAddr, u32 Size, MemoryArea::Access Access)
+{
+  bool Write = (Access & MemoryArea::Access::Write) == MemoryArea::Access::Write;
+  auto pPage = Write ? _LookupWritable(rMemCtxt, LinAddr) : _Lookup(rMemCtxt, LinAddr);
+  u32 PageOff = static_cast<u32>(LinAddr & (MemoryContext::PageSize - 1));
+  u8 const* pRaw = pPage == nullptr ? nullptr : (Write ? pPage->m_pRaw : pPage->m_pReadRaw);
+  if (pRaw != nullptr && PageOff >= pPage->m_Begin && PageOff + Size <= pPage->m_End)
+  {
+    if (rMemCtxt.HasAccessCheck() && (pPage->m_Flags & Access) != Access)
+      return nullptr;
+    return const_cast<u8*>(pRaw) + (PageOff - pPage->m_Begin);
+  }
+
+  // Slow path: the access crosses a page or the chunk must be flattened
+  void* pRawMem;
+  u32 Offset, ChnkSize;
+  MemoryArea::Access Flags;
+  if (!rMemCtxt.FindMemory(LinAddr, pRawMem, Offset, ChnkSize, Flags))
+    return nullptr;
+  if (static_cast<u64>(Offset) + Size > ChnkSize)
+    return nullptr;
+  if (rMemCtxt.HasAccessCheck())
+  {
+    for (u64 PageAddr = LinAddr & ~static_cast<u64>(MemoryContext::PageSize - 1); PageAddr < LinAddr + Size; PageAddr += MemoryContext::PageSize)
+    {
+      auto pCurPage = rMemCtxt.FindPage(PageAddr);
+      if (pCurPage == nullptr || (pCurPage->m_Flags & Access) != Access)
+        return nullptr;
+    }
+  }
+  return static_cast<u8*>(pRawMem) + Offset;
+}
+
+void MemoryTlb::Flush(void)
+{
+  for (auto& rEntry : m_Entries)
+    rEntry.m_PageAddr = 1;
+}
+
+MemoryContext::Page const* MemoryTlb::_Lookup(MemoryContext const& rMemCtxt, u64 LinAddr)
+{
+  // The page table can be modified concurrently, so the cache is only used by the owner of the context
+  if (rMemCtxt.IsShared())
+    return nullptr;
+
+  if (m_pMemCtxt != &rMemCtxt || m_Generation != rMemCtxt.GetGeneration())
+  {
+    Flush();
+    m_pMemCtxt   = &rMemCtxt;
+    m_Generation = rMemCtxt.GetGeneration();
+  }
+
+  u64 PageAddr = LinAddr & ~static_cast<u64>(MemoryContext::PageSize - 1);
+  auto& rEntry = m_Entries[(LinAddr >> MemoryContext::PageShift) % NumberOfEntries];
+  if (rEntry.m_PageAddr == PageAddr)
+    return &rEntry.m_Page;
+
+  auto pPage = rMemCtxt.FindPage(PageAddr);
+  if (pPage == nullptr || pPage->m_Split)
+    return nullptr;
+
+  rEntry.m_PageAddr = PageAddr;
+  rEntry.m_Page     = *pPage;
+  return &rEntry.m_Page;
+}
+
+MemoryContext::Page const* MemoryTlb::_LookupWritable(MemoryContext& rMemCtxt, u64 LinAddr)
+{
+  auto pPage = _Lookup(rMemCtxt, LinAddr);
+  if (pPage == nullptr || pPage->m_pRaw != nullptr || pPage->m_pReadRaw == nullptr)
+    return pPage;
+
+  // A clean overlay page is copied on the first write, other entries can't be trusted once the generation changes
+  u64 PageAddr = LinAddr & ~static_cast<u64>(MemoryContext::PageSize - 1);
+  auto pWrPage = rMemCtxt.FindWritablePage(PageAddr);
+  if (pWrPage == nullptr)
+    return nullptr;
+  Flush();
+  m_Generation = rMemCtxt.GetGeneration();
+
+  auto& rEntry = m_Entries[(LinAddr >> MemoryContext::PageShift) % NumberOfEntries];
+  rEntry.m_PageAddr = PageAddr;
+  rEntry.m_Page     = *pWrPage;
+  return &rEntry.m_Page;
+}
+
 MEDUSA_NAMESPACE_END
\ No newline at end of file
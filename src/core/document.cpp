@@ -401,6 +401,13 @@ u8 Document::GetCellType(Address const& rAddr) const
   return CurCellData.GetType();
 }
 
+bool Document::GetCellData(Address const& rAddr, CellData& rCellData) const
+{
+  if (m_spDatabase == nullptr)
+    return false;
+  return m_spDatabase->GetCellData(rAddr, rCellData);
+}
+
 u8 Document::GetCellSubType(Address const& rAddr) const
 {
   if (m_spDatabase == nullptr)
@@ -463,6 +470,39 @@ bool Document::SetCellWithLabel(Address const& rAddr, Cell::SPType spCell, Label
     Log::Write("core") << "database is null" << LogEnd;
     return false;
   }
+  Address::Vector ErasedAddresses;
+  bool Res = _SetCellWithLabel(rAddr, spCell, rLabel, Force, ErasedAddresses);
+  if (!ErasedAddresses.empty())
+    m_AddressUpdatedSignal(ErasedAddresses);
+  return Res;
+}
+
+u32 Document::SetCellsWithLabels(std::vector<CellWithLabel> const& rCellsWithLabels, bool Force)
+{
+  if (m_spDatabase == nullptr)
+  {
+    Log::Write("core") << "database is null" << LogEnd;
+    return 0;
+  }
+
+  // Subscribers are notified once for the whole batch
+  u32 SetCount = 0;
+  Address::Vector ErasedAddresses;
+  for (auto const& rCellWithLabel : rCellsWithLabels)
+  {
+    if (_SetCellWithLabel(std::get<0>(rCellWithLabel), std::get<1>(rCellWithLabel), std::get<2>(rCellWithLabel), Force, ErasedAddresses))
+      ++SetCount;
+  }
+
+  if (!ErasedAddresses.empty())
+    m_AddressUpdatedSignal(ErasedAddresses);
+  if (SetCount != 0)
+    m_DocumentUpdatedSignal();
+  return SetCount;
+}
+
+bool Document::_SetCellWithLabel(Address const& rAddr, Cell::SPType spCell, Label const& rLabel, bool Force, Address::Vector& rErasedAddresses)
+{
   Address::Vector ErasedAddresses;
   ErasedAddresses.push_back(rAddr);
   if (!m_spDatabase->SetCellData(rAddr, *spCell->GetData(), ErasedAddresses, Force))
@@ -481,6 +521,7 @@ bool Document::SetCellWithLabel(Address const& rAddr, Cell::SPType spCell, Label
         m_LabelUpdatedSignal(rErsdAddr, Label, true);
       }
     }
+  rErasedAddresses.insert(std::end(rErasedAddresses), std::begin(ErasedAddresses), std::end(ErasedAddresses));
 
   Label OldLabel;
   if (m_spDatabase->GetLabel(rAddr, OldLabel) == true)
@@ -500,7 +541,6 @@ bool Document::SetCellWithLabel(Address const& rAddr, Cell::SPType spCell, Label
     return false;
 
   m_LabelUpdatedSignal(rAddr, rLabel, false);
-  m_AddressUpdatedSignal(ErasedAddresses);
 
   return true;
 }
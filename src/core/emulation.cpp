@@ -1,10 +1,13 @@
 #include "medusa/emulation.hpp"
 #include "medusa/module.hpp"
+#include "medusa/expression_visitor.hpp"
+
+#include <set>
 
 MEDUSA_NAMESPACE_BEGIN
 
 Emulator::Emulator(CpuInformation const* pCpuInfo, CpuContext* pCpuCtxt, MemoryContext* pMemCtxt)
-  : m_pCpuInfo(pCpuInfo), m_pCpuCtxt(pCpuCtxt), m_pMemCtxt(pMemCtxt)
+  : m_pCpuInfo(pCpuInfo), m_pCpuCtxt(pCpuCtxt), m_pMemCtxt(pMemCtxt), m_PreciseFlags(false)
 {
 }
 
@@ -57,40 +60,11 @@ Emulator::ReturnType Emulator::Execute(Expression::SPType spExpr)
 
 Emulator::ReturnType Emulator::Execute(Address const& rAddress)
 {
-  if (_IsSemanticCached(rAddress))
-  {
-    auto const& rExprs = m_SemCache[rAddress];
-    return Execute(rExprs);
-  }
-
-  Expression::VSPType Exprs;
-  _Disassemble(rAddress, [&](Address const& rInsnAddr, Instruction& rCurInsn, Architecture& rCurArch, u8 CurMode) -> bool
-  {
-    auto CurAddr = rCurArch.CurrentAddress(rInsnAddr, rCurInsn);
-    Exprs.push_back(Expr::MakeSys("call_insn_cb", rInsnAddr));
-
-    // Set the current IP/PC address
-    if (!rCurArch.EmitSetExecutionAddress(Exprs, CurAddr, CurMode))
-    {
-      Log::Write("core").Level(LogError) << "unable to emit set execution address to " << CurAddr << LogEnd;
-      return false;
-    }
-
-    for (auto spExpr : rCurInsn.GetSemantic())
-      Exprs.push_back(spExpr);
-
-    Exprs.push_back(Expr::MakeSys("check_exec_hook", rInsnAddr));
-
-    // Jump, Call, Return types finish the block
-    if (rCurInsn.GetSubType() & (Instruction::JumpType | Instruction::CallType | Instruction::ReturnType))
-      return false;
-
-    return true;
-  });
-
-  if (!_CacheSemantic(rAddress, Exprs))
+  auto pExprs = _GetSemantic(rAddress);
+  if (pExprs == nullptr)
     return Error;
-
+  // A hook is allowed to modify hooks, which clears the semantic cache
+  auto Exprs = *pExprs;
   return Execute(Exprs);
 }
 
@@ -101,16 +75,19 @@ bool Emulator::AddHook(Address const& rAddress, Emulator::HookType Type, HookCal
   {
     itHook->second.m_Callback = Callback;
     itHook->second.m_Type |= Type;
+    _InvalidSemantics();
     return true;
   }
 
   m_Hooks[rAddress] = HookInformation(Type, Callback);
+  _InvalidSemantics();
   return true;
 }
 
 bool Emulator::AddHookOnInstruction(HookCallback InsnCb)
 {
   m_InsnCb = InsnCb;
+  _InvalidSemantics();
   return true;
 }
 
@@ -126,6 +103,7 @@ bool Emulator::RemoveHook(Address const& rAddress)
   if (itHook == std::end(m_Hooks))
     return false;
   m_Hooks.erase(itHook);
+  _InvalidSemantics();
   return true;
 }
 
@@ -161,6 +139,16 @@ bool Emulator::InvalidateCache(void)
   return false;
 }
 
+void Emulator::SetPreciseFlags(bool PreciseFlags)
+{
+  if (m_PreciseFlags == PreciseFlags)
+    return;
+  m_PreciseFlags = PreciseFlags;
+
+  // Cached blocks were built for the previous mode
+  _InvalidSemantics();
+}
+
 bool Emulator::_Disassemble(Address const& rAddress, DisasmCbType Cb)
 {
   Address InsnAddr = rAddress;
@@ -231,6 +219,16 @@ bool Emulator::_CacheSemantic(Address const& rAddress, Expression::VSPType& rExp
 
 bool Emulator::_InvalidSemantic(Address const& rAddress)
 {
+  // Dead flags of the predecessors were computed from the previous code of this block
+  auto itPreds = m_FlagsPreds.find(rAddress);
+  if (itPreds != std::end(m_FlagsPreds))
+  {
+    auto PredAddrs = std::move(itPreds->second);
+    m_FlagsPreds.erase(itPreds);
+    for (auto const& rPredAddr : PredAddrs)
+      m_SemCache.erase(rPredAddr);
+  }
+
   auto itCache = m_SemCache.find(rAddress);
   if (itCache == std::end(m_SemCache))
     return false;
@@ -238,4 +236,296 @@ bool Emulator::_InvalidSemantic(Address const& rAddress)
   return true;
 }
 
+void Emulator::_InvalidSemantics(void)
+{
+  m_SemCache.clear();
+  m_FlagsPreds.clear();
+  _ResetBlocks();
+}
+
+void Emulator::_ResetBlocks(void)
+{
+}
+
+Expression::VSPType const* Emulator::_GetSemantic(Address const& rAddress)
+{
+  auto itCache = m_SemCache.find(rAddress);
+  if (itCache != std::end(m_SemCache))
+    return &itCache->second;
+
+  Expression::VSPType Exprs;
+  InstructionFlagsVector InsnsFlags;
+  std::vector<Address> SuccAddrs;
+  _Disassemble(rAddress, [&](Address const& rInsnAddr, Instruction& rCurInsn, Architecture& rCurArch, u8 CurMode) -> bool
+  {
+    auto CurAddr = rCurArch.CurrentAddress(rInsnAddr, rCurInsn);
+    Exprs.push_back(Expr::MakeSys("call_insn_cb", rInsnAddr));
+
+    // Set the current IP/PC address
+    if (!rCurArch.EmitSetExecutionAddress(Exprs, CurAddr, CurMode))
+    {
+      Log::Write("core").Level(LogError) << "unable to emit set execution address to " << CurAddr << LogEnd;
+      return false;
+    }
+
+    auto const& rCurInsnSem = rCurInsn.GetSemantic();
+    InsnsFlags.push_back({ Exprs.size(), rCurInsnSem.size(), rCurInsn.GetTestedFlags(),
+      rCurInsn.GetUpdatedFlags() | rCurInsn.GetClearedFlags() | rCurInsn.GetFixedFlags() });
+    for (auto spExpr : rCurInsnSem)
+      Exprs.push_back(spExpr);
+
+    Exprs.push_back(Expr::MakeSys("check_exec_hook", rInsnAddr));
+
+    // Jump, Call, Return types finish the block
+    if (rCurInsn.GetSubType() & (Instruction::JumpType | Instruction::CallType | Instruction::ReturnType))
+    {
+      if (!m_PreciseFlags)
+        _GetStaticSuccessors(rInsnAddr, rCurInsn, rCurArch, SuccAddrs);
+      return false;
+    }
+
+    return true;
+  });
+
+  if (!m_PreciseFlags)
+  {
+    auto DeadFlagsOnExit = _GetDeadFlagsOnExit(SuccAddrs);
+    if (!DeadFlagsOnExit.empty())
+      for (auto const& rSuccAddr : SuccAddrs)
+        m_FlagsPreds[rSuccAddr].push_back(rAddress);
+    _EliminateDeadFlags(Exprs, InsnsFlags, DeadFlagsOnExit);
+  }
+
+  if (!_CacheSemantic(rAddress, Exprs))
+    return nullptr;
+
+  return &m_SemCache[rAddress];
+}
+
+// Only direct jumps have known successors: calls and returns may lead anywhere, and the target of an
+// indirect branch depends on the context
+bool Emulator::_GetStaticSuccessors(Address const& rInsnAddr, Instruction const& rInsn, Architecture const& rArch, std::vector<Address>& rSuccAddrs) const
+{
+  rSuccAddrs.clear();
+
+  auto SubType = rInsn.GetSubType();
+  if (!(SubType & Instruction::JumpType) || (SubType & (Instruction::CallType | Instruction::ReturnType)))
+    return false;
+
+  // The target is either absolute or relative to the program counter
+  auto spOprdExpr = rInsn.GetOperand(0);
+  if (spOprdExpr == nullptr)
+    return false;
+  auto NextAddr = rArch.CurrentAddress(rInsnAddr, rInsn);
+  BitVectorExpression::SPType spTgtExpr;
+  bool IsRelative = false;
+  if (spOprdExpr->GetClassKind() == Expression::Const)
+    spTgtExpr = std::static_pointer_cast<BitVectorExpression>(spOprdExpr);
+  else if (auto spBinOpExpr = expr_cast<BinaryOperationExpression>(spOprdExpr))
+  {
+    auto spPcExpr = expr_cast<IdentifierExpression>(spBinOpExpr->GetLeftExpression());
+    spTgtExpr = expr_cast<BitVectorExpression>(spBinOpExpr->GetRightExpression());
+    if (spBinOpExpr->GetOperation() != OperationExpression::OpAdd || spPcExpr == nullptr || m_pCpuInfo == nullptr
+      || spPcExpr->GetId() != m_pCpuInfo->GetRegisterByType(CpuInformation::ProgramPointerRegister, m_pCpuCtxt->GetMode()))
+      return false;
+    IsRelative = true;
+  }
+  if (spTgtExpr == nullptr)
+    return false;
+
+  auto TgtBitSize = spTgtExpr->GetBitSize();
+  if (TgtBitSize == 0 || TgtBitSize > 64)
+    return false;
+  u64 TgtOff = spTgtExpr->GetInt().ConvertTo<u64>();
+  if (IsRelative)
+    TgtOff += NextAddr.GetOffset();
+  if (TgtBitSize < 64)
+    TgtOff &= (1ULL << TgtBitSize) - 1;
+
+  Address TgtAddr = rInsnAddr;
+  TgtAddr.SetOffset(TgtOff);
+  rSuccAddrs.push_back(TgtAddr);
+  if (SubType & Instruction::ConditionalType)
+  {
+    Address FallAddr = rInsnAddr;
+    FallAddr.SetOffset(rInsnAddr.GetOffset() + rInsn.GetSize());
+    rSuccAddrs.push_back(FallAddr);
+  }
+  return true;
+}
+
+FlagLiveness::FlagSetType Emulator::_GetDeadFlagsOnExit(std::vector<Address> const& rSuccAddrs)
+{
+  FlagLiveness::FlagSetType DeadFlags;
+
+  // The instruction callback observes the flags on entry of every successor
+  if (m_InsnCb)
+    return DeadFlags;
+
+  for (auto itSuccAddr = std::begin(rSuccAddrs); itSuccAddr != std::end(rSuccAddrs); ++itSuccAddr)
+  {
+    // A hook may observe the flags when the successor is entered
+    if (m_Hooks.find(*itSuccAddr) != std::end(m_Hooks))
+      return FlagLiveness::FlagSetType();
+
+    // The successors of the successor are not followed, every flag is live at its end
+    Expression::VSPType Exprs;
+    InstructionFlagsVector InsnsFlags;
+    bool IsDisassembled = _Disassemble(*itSuccAddr, [&](Address const& rInsnAddr, Instruction& rCurInsn, Architecture& rCurArch, u8 CurMode) -> bool
+    {
+      // The hook of an instruction of the successor is a barrier, like in the block itself
+      if (rInsnAddr != *itSuccAddr && m_Hooks.find(rInsnAddr) != std::end(m_Hooks))
+        Exprs.push_back(Expr::MakeSys("check_exec_hook", rInsnAddr));
+      auto const& rCurInsnSem = rCurInsn.GetSemantic();
+      InsnsFlags.push_back({ Exprs.size(), rCurInsnSem.size(), rCurInsn.GetTestedFlags(),
+        rCurInsn.GetUpdatedFlags() | rCurInsn.GetClearedFlags() | rCurInsn.GetFixedFlags() });
+      Exprs.insert(std::end(Exprs), std::begin(rCurInsnSem), std::end(rCurInsnSem));
+      return !(rCurInsn.GetSubType() & (Instruction::JumpType | Instruction::CallType | Instruction::ReturnType));
+    });
+    if (!IsDisassembled || InsnsFlags.empty())
+      return FlagLiveness::FlagSetType();
+
+    FlagLiveness Liveness(m_pCpuInfo);
+    _WalkFlags(Exprs, InsnsFlags, Liveness, nullptr);
+
+    // A flag is dead on exit only if it's dead on entry of every successor
+    if (itSuccAddr == std::begin(rSuccAddrs))
+    {
+      DeadFlags = Liveness.GetDeadFlags();
+      continue;
+    }
+    for (auto itFlag = std::begin(DeadFlags); itFlag != std::end(DeadFlags);)
+    {
+      if (Liveness.GetDeadFlags().count(*itFlag) == 0)
+        itFlag = DeadFlags.erase(itFlag);
+      else
+        ++itFlag;
+    }
+  }
+
+  return DeadFlags;
+}
+
+void Emulator::_WalkFlags(Expression::VSPType const& rExprs, InstructionFlagsVector const& rInsnsFlags, FlagLiveness& rLiveness, std::vector<bool>* pDeadExprs) const
+{
+  auto ReadFlags = [&](Expression::SPType spExpr)
+  {
+    if (rLiveness.GetDeadFlags().empty())
+      return;
+
+    FilterVisitor FltVst([](Expression::SPType spExpr) -> Expression::SPType
+    {
+      switch (spExpr->GetClassKind())
+      {
+      case Expression::Sys: case Expression::Id: case Expression::VecId:
+        return spExpr;
+      default:
+        return nullptr;
+      }
+    });
+    spExpr->Visit(&FltVst);
+
+    for (auto spMatchedExpr : FltVst.GetMatchedExpressions())
+    {
+      switch (spMatchedExpr->GetClassKind())
+      {
+      // A system expression may observe every flag
+      case Expression::Sys:
+        if (_IsFlagsBarrier(*std::static_pointer_cast<SystemExpression>(spMatchedExpr)))
+        {
+          rLiveness.ReadAll();
+          return;
+        }
+        break;
+
+      case Expression::Id:
+        rLiveness.Read(std::static_pointer_cast<IdentifierExpression>(spMatchedExpr)->GetId());
+        break;
+
+      case Expression::VecId:
+        for (auto RegId : std::static_pointer_cast<VectorIdentifierExpression>(spMatchedExpr)->GetVector())
+          rLiveness.Read(RegId);
+        break;
+
+      default:
+        break;
+      }
+    }
+  };
+
+  // Every expression is walked, including the system expressions between instructions (e.g. hooks)
+  auto itInsnFlags = rInsnsFlags.rbegin();
+  for (size_t ExprIdx = rExprs.size(); ExprIdx-- != 0;)
+  {
+    // Tested flags are read before the instruction modifies them
+    while (itInsnFlags != rInsnsFlags.rend() && ExprIdx < itInsnFlags->m_FirstExprIdx)
+    {
+      if (itInsnFlags->m_TestedFlags != 0)
+        rLiveness.ReadAll();
+      ++itInsnFlags;
+    }
+
+    auto spExpr = rExprs[ExprIdx];
+
+    // Only unconditional assignments to a flag by a flag-modifying instruction define it
+    bool IsInInsn = itInsnFlags != rInsnsFlags.rend() && ExprIdx < itInsnFlags->m_FirstExprIdx + itInsnFlags->m_NrOfExprs;
+    if (IsInInsn && itInsnFlags->m_ModifiedFlags != 0 && spExpr->GetClassKind() == Expression::Assign)
+    {
+      auto spAssignExpr = std::static_pointer_cast<AssignmentExpression>(spExpr);
+      auto spDstExpr = spAssignExpr->GetDestinationExpression();
+      if (spDstExpr->GetClassKind() == Expression::Id)
+      {
+        auto FlagId = std::static_pointer_cast<IdentifierExpression>(spDstExpr)->GetId();
+        if (m_pCpuInfo->GetSizeOfRegisterInBit(FlagId) == 1)
+        {
+          if (!rLiveness.Write(FlagId))
+          {
+            if (pDeadExprs != nullptr)
+              (*pDeadExprs)[ExprIdx] = true;
+            continue;
+          }
+          ReadFlags(spAssignExpr->GetSourceExpression());
+          continue;
+        }
+      }
+    }
+
+    ReadFlags(spExpr);
+  }
+
+  for (; itInsnFlags != rInsnsFlags.rend(); ++itInsnFlags)
+    if (itInsnFlags->m_TestedFlags != 0)
+      rLiveness.ReadAll();
+}
+
+// Hooks and the instruction callback observe the flags, they are only called if they are set
+bool Emulator::_IsFlagsBarrier(SystemExpression const& rSysExpr) const
+{
+  auto const& rName = rSysExpr.GetName();
+  if (rName == "call_insn_cb")
+    return static_cast<bool>(m_InsnCb);
+  if (rName == "check_exec_hook")
+    return !m_Hooks.empty();
+  return true;
+}
+
+u32 Emulator::_EliminateDeadFlags(Expression::VSPType& rExprs, InstructionFlagsVector const& rInsnsFlags, FlagLiveness::FlagSetType const& rDeadFlagsOnExit) const
+{
+  if (m_pCpuInfo == nullptr)
+    return 0;
+
+  FlagLiveness Liveness(m_pCpuInfo, rDeadFlagsOnExit);
+  std::vector<bool> DeadExprs(rExprs.size(), false);
+  _WalkFlags(rExprs, rInsnsFlags, Liveness, &DeadExprs);
+
+  size_t NrOfLiveExprs = 0;
+  for (size_t ExprIdx = 0; ExprIdx < rExprs.size(); ++ExprIdx)
+    if (!DeadExprs[ExprIdx])
+      rExprs[NrOfLiveExprs++] = rExprs[ExprIdx];
+  u32 NrOfDeadExprs = static_cast<u32>(rExprs.size() - NrOfLiveExprs);
+  rExprs.resize(NrOfLiveExprs);
+
+  return NrOfDeadExprs;
+}
+
 MEDUSA_NAMESPACE_END
@@ -1,5 +1,10 @@
 #include "medusa/endian.hpp"
 
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+# include <emmintrin.h>
+# define MEDUSA_ENDIAN_USE_SSE2
+#endif
+
 MEDUSA_NAMESPACE_BEGIN
 
 bool TestEndian(EEndianness Endianness)
@@ -13,4 +18,60 @@ bool TestEndian(EEndianness Endianness)
 #endif
 }
 
+#ifdef MEDUSA_ENDIAN_USE_SSE2
+// SSE2 has no byte shuffle, so we first reorder 16-bit words then swap bytes inside each word
+static inline __m128i SwapBytesInWords(__m128i Val)
+{
+  return _mm_or_si128(_mm_slli_epi16(Val, 8), _mm_srli_epi16(Val, 8));
+}
+#endif
+
+void EndianSwapArray(u16* pData, size_t Count)
+{
+  size_t Idx = 0;
+#ifdef MEDUSA_ENDIAN_USE_SSE2
+  for (; Idx + 8 <= Count; Idx += 8)
+  {
+    auto pVec = reinterpret_cast<__m128i*>(pData + Idx);
+    _mm_storeu_si128(pVec, SwapBytesInWords(_mm_loadu_si128(pVec)));
+  }
+#endif
+  for (; Idx < Count; ++Idx)
+    EndianSwap(pData[Idx]);
+}
+
+void EndianSwapArray(u32* pData, size_t Count)
+{
+  size_t Idx = 0;
+#ifdef MEDUSA_ENDIAN_USE_SSE2
+  for (; Idx + 4 <= Count; Idx += 4)
+  {
+    auto pVec = reinterpret_cast<__m128i*>(pData + Idx);
+    auto Val = _mm_loadu_si128(pVec);
+    Val = _mm_shufflelo_epi16(Val, _MM_SHUFFLE(2, 3, 0, 1));
+    Val = _mm_shufflehi_epi16(Val, _MM_SHUFFLE(2, 3, 0, 1));
+    _mm_storeu_si128(pVec, SwapBytesInWords(Val));
+  }
+#endif
+  for (; Idx < Count; ++Idx)
+    EndianSwap(pData[Idx]);
+}
+
+void EndianSwapArray(u64* pData, size_t Count)
+{
+  size_t Idx = 0;
+#ifdef MEDUSA_ENDIAN_USE_SSE2
+  for (; Idx + 2 <= Count; Idx += 2)
+  {
+    auto pVec = reinterpret_cast<__m128i*>(pData + Idx);
+    auto Val = _mm_loadu_si128(pVec);
+    Val = _mm_shufflelo_epi16(Val, _MM_SHUFFLE(0, 1, 2, 3));
+    Val = _mm_shufflehi_epi16(Val, _MM_SHUFFLE(0, 1, 2, 3));
+    _mm_storeu_si128(pVec, SwapBytesInWords(Val));
+  }
+#endif
+  for (; Idx < Count; ++Idx)
+    EndianSwap(pData[Idx]);
+}
+
 MEDUSA_NAMESPACE_END
@@ -40,6 +40,9 @@ bool Execution::SetCpuMemContext(Address const& StartAddr)
     Log::Write("core").Level(LogError) << "unable to map document for execution" << LogEnd;
     return false;
   }
+
+  // Contexts of an execution are only used by the thread which runs it
+  m_pMemCtxt->SetShared(false);
   return true;
 }
 
@@ -177,6 +180,14 @@ bool Execution::InvalidateCache(void)
   return m_spEmul->InvalidateCache();
 }
 
+bool Execution::SetPreciseFlags(bool PreciseFlags)
+{
+  if (m_spEmul == nullptr)
+    return false;
+  m_spEmul->SetPreciseFlags(PreciseFlags);
+  return true;
+}
+
 bool Execution::HookInstruction(Emulator::HookCallback HkCb)
 {
   if (m_spEmul == nullptr)
@@ -123,6 +123,9 @@ bool BindExpression::UpdateChild(Expression::SPType spOldExpr, Expression::SPTyp
 
 Expression::CompareType BindExpression::Compare(Expression::SPType spExpr) const
 {
+  // interned expressions are identical if and only if they are the same node
+  if (spExpr.get() == this)
+    return CmpIdentical;
   auto spCmpExpr = expr_cast<BindExpression>(spExpr);
   if (spCmpExpr == nullptr)
     return CmpDifferent;
@@ -195,6 +198,8 @@ bool ConditionExpression::UpdateChild(Expression::SPType spOldExpr, Expression::
 
 Expression::CompareType ConditionExpression::Compare(Expression::SPType spExpr) const
 {
+  if (spExpr.get() == this)
+    return CmpIdentical;
   auto spCmpExpr = expr_cast<ConditionExpression>(spExpr);
   if (spCmpExpr == nullptr)
     return CmpDifferent;
@@ -308,6 +313,8 @@ bool TernaryConditionExpression::UpdateChild(Expression::SPType spOldExpr, Expre
 
 Expression::CompareType TernaryConditionExpression::Compare(Expression::SPType spExpr) const
 {
+  if (spExpr.get() == this)
+    return CmpIdentical;
   auto spCmpExpr = expr_cast<TernaryConditionExpression>(spExpr);
   if (spCmpExpr == nullptr)
     return CmpDifferent;
@@ -394,6 +401,8 @@ bool IfElseConditionExpression::UpdateChild(Expression::SPType spOldExpr, Expres
 
 Expression::CompareType IfElseConditionExpression::Compare(Expression::SPType spExpr) const
 {
+  if (spExpr.get() == this)
+    return CmpIdentical;
   auto spCmpExpr = expr_cast<IfElseConditionExpression>(spExpr);
   if (spCmpExpr == nullptr)
     return CmpDifferent;
@@ -464,6 +473,8 @@ bool WhileConditionExpression::UpdateChild(Expression::SPType spOldExpr, Express
 
 Expression::CompareType WhileConditionExpression::Compare(Expression::SPType spExpr) const
 {
+  if (spExpr.get() == this)
+    return CmpIdentical;
   auto spCmpExpr = expr_cast<WhileConditionExpression>(spExpr);
   if (spCmpExpr == nullptr)
     return CmpDifferent;
@@ -532,6 +543,8 @@ bool AssignmentExpression::UpdateChild(Expression::SPType spOldExpr, Expression:
 
 Expression::CompareType AssignmentExpression::Compare(Expression::SPType spExpr) const
 {
+  if (spExpr.get() == this)
+    return CmpIdentical;
   auto spCmpExpr = expr_cast<AssignmentExpression>(spExpr);
   if (spCmpExpr == nullptr)
     return CmpDifferent;
@@ -711,6 +724,8 @@ bool UnaryOperationExpression::UpdateChild(Expression::SPType spOldExpr, Express
 
 Expression::CompareType UnaryOperationExpression::Compare(Expression::SPType spExpr) const
 {
+  if (spExpr.get() == this)
+    return CmpIdentical;
   auto spCmpExpr = expr_cast<UnaryOperationExpression>(spExpr);
   if (spCmpExpr == nullptr)
     return CmpDifferent;
@@ -810,6 +825,8 @@ bool BinaryOperationExpression::UpdateChild(Expression::SPType spOldExpr, Expres
 
 Expression::CompareType BinaryOperationExpression::Compare(Expression::SPType spExpr) const
 {
+  if (spExpr.get() == this)
+    return CmpIdentical;
   auto spCmpExpr = expr_cast<BinaryOperationExpression>(spExpr);
   if (spCmpExpr == nullptr)
     return CmpDifferent;
@@ -1089,6 +1106,9 @@ Expression::SPType IdentifierExpression::Visit(ExpressionVisitor* pVisitor)
 
 Expression::CompareType IdentifierExpression::Compare(Expression::SPType spExpr) const
 {
+  // identifiers created with Expr::MakeId are shared
+  if (spExpr.get() == this)
+    return CmpIdentical;
   auto spCmpExpr = expr_cast<IdentifierExpression>(spExpr);
   if (spCmpExpr == nullptr)
     return CmpDifferent;
@@ -1260,6 +1280,8 @@ Expression::SPType TrackExpression::Visit(ExpressionVisitor* pVisitor)
 
 Expression::CompareType TrackExpression::Compare(Expression::SPType spExpr) const
 {
+  if (spExpr.get() == this)
+    return CmpIdentical;
   auto spCmpExpr = expr_cast<TrackExpression>(spExpr);
   if (spCmpExpr == nullptr)
   {
@@ -1504,6 +1526,8 @@ bool MemoryExpression::UpdateChild(Expression::SPType spOldExpr, Expression::SPT
 
 Expression::CompareType MemoryExpression::Compare(Expression::SPType spExpr) const
 {
+  if (spExpr.get() == this)
+    return CmpIdentical;
   auto spCmpExpr = expr_cast<MemoryExpression>(spExpr);
   if (spCmpExpr == nullptr)
     return CmpDifferent;
@@ -1626,7 +1650,9 @@ Expression::SPType Expr::MakeBoolean(bool Value)
 
 Expression::SPType Expr::MakeId(u32 Id, CpuInformation const* pCpuInfo)
 {
-  return std::make_shared<IdentifierExpression>(Id, pCpuInfo);
+  if (pCpuInfo == nullptr)
+    return std::make_shared<IdentifierExpression>(Id, pCpuInfo);
+  return pCpuInfo->GetIdentifierExpression(Id);
 }
 
 Expression::SPType Expr::MakeVecId(std::vector<u32> const& rVecId, CpuInformation const* pCpuInfo)
@@ -1699,6 +1725,148 @@ Expression::SPType Expr::MakeSys(std::string const& rName, Address const& rAddr)
   return std::make_shared<SystemExpression>(rName, rAddr);
 }
 
+// A missing child (e.g. the base of a memory access) stays missing
+Expression::SPType Expr::TransformChildren(Expression::SPType const& rspExpr, Expr::ChildTransformType const& rTransform)
+{
+  bool IsModified = false;
+  auto TransformChild = [&](Expression::SPType const& rspChildExpr, Expression::SPType& rspResExpr) -> bool
+  {
+    if (rspChildExpr == nullptr)
+    {
+      rspResExpr = nullptr;
+      return true;
+    }
+    rspResExpr = rTransform(rspChildExpr);
+    if (rspResExpr == nullptr)
+      return false;
+    if (rspResExpr != rspChildExpr)
+      IsModified = true;
+    return true;
+  };
+
+  switch (rspExpr->GetClassKind())
+  {
+  case Expression::Bind:
+  {
+    auto spBindExpr = std::static_pointer_cast<BindExpression>(rspExpr);
+    Expression::LSPType Exprs;
+    for (auto const& rspBoundExpr : spBindExpr->GetBoundExpressions())
+    {
+      Exprs.push_back(nullptr);
+      if (!TransformChild(rspBoundExpr, Exprs.back()))
+        return nullptr;
+    }
+    return IsModified ? Expr::MakeBind(Exprs) : rspExpr;
+  }
+
+  case Expression::Cond:
+  {
+    auto spCondExpr = std::static_pointer_cast<ConditionExpression>(rspExpr);
+    Expression::SPType spRefExpr, spTestExpr;
+    if (!TransformChild(spCondExpr->GetReferenceExpression(), spRefExpr)
+      || !TransformChild(spCondExpr->GetTestExpression(), spTestExpr))
+      return nullptr;
+    return IsModified ? Expr::MakeCond(spCondExpr->GetType(), spRefExpr, spTestExpr) : rspExpr;
+  }
+
+  case Expression::TernaryCond:
+  {
+    auto spTernExpr = std::static_pointer_cast<TernaryConditionExpression>(rspExpr);
+    Expression::SPType spRefExpr, spTestExpr, spTrueExpr, spFalseExpr;
+    if (!TransformChild(spTernExpr->GetReferenceExpression(), spRefExpr)
+      || !TransformChild(spTernExpr->GetTestExpression(), spTestExpr)
+      || !TransformChild(spTernExpr->GetTrueExpression(), spTrueExpr)
+      || !TransformChild(spTernExpr->GetFalseExpression(), spFalseExpr))
+      return nullptr;
+    return IsModified ? Expr::MakeTernaryCond(spTernExpr->GetType(), spRefExpr, spTestExpr, spTrueExpr, spFalseExpr) : rspExpr;
+  }
+
+  case Expression::IfElseCond:
+  {
+    auto spIfElseExpr = std::static_pointer_cast<IfElseConditionExpression>(rspExpr);
+    Expression::SPType spRefExpr, spTestExpr, spThenExpr, spElseExpr;
+    if (!TransformChild(spIfElseExpr->GetReferenceExpression(), spRefExpr)
+      || !TransformChild(spIfElseExpr->GetTestExpression(), spTestExpr)
+      || !TransformChild(spIfElseExpr->GetThenExpression(), spThenExpr)
+      || !TransformChild(spIfElseExpr->GetElseExpression(), spElseExpr))
+      return nullptr;
+    return IsModified ? Expr::MakeIfElseCond(spIfElseExpr->GetType(), spRefExpr, spTestExpr, spThenExpr, spElseExpr) : rspExpr;
+  }
+
+  case Expression::WhileCond:
+  {
+    auto spWhileExpr = std::static_pointer_cast<WhileConditionExpression>(rspExpr);
+    Expression::SPType spRefExpr, spTestExpr, spBodyExpr;
+    if (!TransformChild(spWhileExpr->GetReferenceExpression(), spRefExpr)
+      || !TransformChild(spWhileExpr->GetTestExpression(), spTestExpr)
+      || !TransformChild(spWhileExpr->GetBodyExpression(), spBodyExpr))
+      return nullptr;
+    return IsModified ? Expr::MakeWhileCond(spWhileExpr->GetType(), spRefExpr, spTestExpr, spBodyExpr) : rspExpr;
+  }
+
+  case Expression::Assign:
+  {
+    auto spAssignExpr = std::static_pointer_cast<AssignmentExpression>(rspExpr);
+    Expression::SPType spDstExpr, spSrcExpr;
+    if (!TransformChild(spAssignExpr->GetDestinationExpression(), spDstExpr)
+      || !TransformChild(spAssignExpr->GetSourceExpression(), spSrcExpr))
+      return nullptr;
+    return IsModified ? Expr::MakeAssign(spDstExpr, spSrcExpr) : rspExpr;
+  }
+
+  case Expression::UnOp:
+  {
+    auto spUnOpExpr = std::static_pointer_cast<UnaryOperationExpression>(rspExpr);
+    Expression::SPType spOprdExpr;
+    if (!TransformChild(spUnOpExpr->GetExpression(), spOprdExpr))
+      return nullptr;
+    return IsModified ? Expr::MakeUnOp(static_cast<OperationExpression::Type>(spUnOpExpr->GetOperation()), spOprdExpr) : rspExpr;
+  }
+
+  case Expression::BinOp:
+  {
+    auto spBinOpExpr = std::static_pointer_cast<BinaryOperationExpression>(rspExpr);
+    Expression::SPType spLeftExpr, spRightExpr;
+    if (!TransformChild(spBinOpExpr->GetLeftExpression(), spLeftExpr)
+      || !TransformChild(spBinOpExpr->GetRightExpression(), spRightExpr))
+      return nullptr;
+    return IsModified ? Expr::MakeBinOp(static_cast<OperationExpression::Type>(spBinOpExpr->GetOperation()), spLeftExpr, spRightExpr) : rspExpr;
+  }
+
+  case Expression::Track:
+  {
+    auto spTrkExpr = std::static_pointer_cast<TrackExpression>(rspExpr);
+    Expression::SPType spTrackedExpr;
+    if (!TransformChild(spTrkExpr->GetTrackedExpression(), spTrackedExpr))
+      return nullptr;
+    return IsModified ? Expr::MakeTrack(spTrackedExpr, spTrkExpr->GetTrackAddress(), spTrkExpr->GetTrackPosition()) : rspExpr;
+  }
+
+  case Expression::Mem:
+  {
+    auto spMemExpr = std::static_pointer_cast<MemoryExpression>(rspExpr);
+    Expression::SPType spBaseExpr, spOffExpr;
+    if (!TransformChild(spMemExpr->GetBaseExpression(), spBaseExpr)
+      || !TransformChild(spMemExpr->GetOffsetExpression(), spOffExpr))
+      return nullptr;
+    return IsModified ? Expr::MakeMem(spMemExpr->GetAccessSizeInBit(), spBaseExpr, spOffExpr, spMemExpr->IsDereferencable()) : rspExpr;
+  }
+
+  case Expression::Sym:
+  {
+    auto spSymExpr = std::static_pointer_cast<SymbolicExpression>(rspExpr);
+    Expression::SPType spSymValExpr;
+    if (!TransformChild(spSymExpr->GetExpression(), spSymValExpr))
+      return nullptr;
+    return IsModified ? Expr::MakeSym(spSymExpr->GetType(), spSymExpr->GetValue(), spSymExpr->GetAddress(), spSymValExpr) : rspExpr;
+  }
+
+  // Leaves
+  default:
+    return rspExpr;
+  }
+}
+
 bool Expr::TestKind(Expression::Kind Kind, Expression::SPType spExpr)
 {
   return spExpr->IsKindOf(Kind);
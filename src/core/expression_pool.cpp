@@ -0,0 +1,467 @@
+#include "medusa/expression_pool.hpp"
+#include "medusa/expression_visitor.hpp"
+
+#include <functional>
+
+MEDUSA_NAMESPACE_BEGIN
+
+namespace
+{
+  inline u64 MixHash(u64 Hash, u64 Value)
+  {
+    return Hash ^ (Value + 0x9e3779b97f4a7c15ULL + (Hash << 6) + (Hash >> 2));
+  }
+
+  template<typename FunctionType>
+  void ForEachChild(Expression::SPType const& rspExpr, FunctionType Func)
+  {
+    Expr::TransformChildren(rspExpr, [&](Expression::SPType const& rspChildExpr)
+    {
+      Func(rspChildExpr);
+      return rspChildExpr;
+    });
+  }
+}
+
+ExpressionPool::ExpressionPool(void)
+{
+}
+
+ExpressionPool::~ExpressionPool(void)
+{
+}
+
+// Children are interned first, a node is only rebuilt if one of them is not the interned one
+class ExpressionPool::Interner : public ExpressionTransformer
+{
+public:
+  Interner(ExpressionPool& rPool) : m_rPool(rPool) {}
+
+protected:
+  virtual Expression::SPType _PreTransform(Expression::SPType spExpr)
+  {
+    return m_rPool.Contains(spExpr) ? spExpr : nullptr;
+  }
+
+  virtual Expression::SPType _PostTransform(Expression::SPType spExpr)
+  {
+    return m_rPool._InternNode(spExpr);
+  }
+
+private:
+  ExpressionPool& m_rPool;
+};
+
+// Same traversal as Interner, but a node missing from the pool aborts the lookup instead of being inserted
+class ExpressionPool::Finder : public ExpressionTransformer
+{
+public:
+  Finder(ExpressionPool const& rPool) : m_rPool(rPool) {}
+
+protected:
+  virtual Expression::SPType _PreTransform(Expression::SPType spExpr)
+  {
+    return m_rPool.Contains(spExpr) ? spExpr : nullptr;
+  }
+
+  virtual Expression::SPType _PostTransform(Expression::SPType spExpr)
+  {
+    return m_rPool._FindNode(spExpr, m_rPool._ComputeHash(spExpr));
+  }
+
+private:
+  ExpressionPool const& m_rPool;
+};
+
+Expression::SPType ExpressionPool::Intern(Expression::SPType spExpr)
+{
+  Interner Intr(*this);
+  auto spInternedExpr = Intr.Transform(spExpr);
+  if (spInternedExpr != nullptr)
+    ++m_Nodes[spInternedExpr.get()].m_RefCount;
+  return spInternedExpr;
+}
+
+Expression::SPType ExpressionPool::Find(Expression::SPType spExpr) const
+{
+  Finder Fnd(*this);
+  return Fnd.Transform(spExpr);
+}
+
+void ExpressionPool::Release(Expression::SPType spExpr)
+{
+  Expression::VSPType Exprs;
+  Exprs.push_back(spExpr);
+  while (!Exprs.empty())
+  {
+    auto spCurExpr = Exprs.back();
+    Exprs.pop_back();
+
+    auto itNode = m_Nodes.find(spCurExpr.get());
+    if (itNode == std::end(m_Nodes))
+      continue;
+    if (--itNode->second.m_RefCount != 0)
+      continue;
+
+    auto Range = m_Buckets.equal_range(itNode->second.m_Hash);
+    for (auto itBucket = Range.first; itBucket != Range.second; ++itBucket)
+      if (itBucket->second == spCurExpr)
+      {
+        m_Buckets.erase(itBucket);
+        break;
+      }
+    m_Nodes.erase(itNode);
+
+    // The removed node no longer references its children
+    ForEachChild(spCurExpr, [&](Expression::SPType const& rspChildExpr)
+    {
+      Exprs.push_back(rspChildExpr);
+    });
+  }
+}
+
+Expression::SPType ExpressionPool::_InternNode(Expression::SPType spNodeExpr)
+{
+  auto Hash = _ComputeHash(spNodeExpr);
+
+  auto spFoundExpr = _FindNode(spNodeExpr, Hash);
+  if (spFoundExpr != nullptr)
+    return spFoundExpr;
+
+  NodeInformation NodeInfo;
+  NodeInfo.m_Hash     = Hash;
+  NodeInfo.m_BitSize  = spNodeExpr->GetBitSize();
+  NodeInfo.m_RefCount = 0;
+  m_Nodes[spNodeExpr.get()] = NodeInfo;
+  m_Buckets.insert(std::make_pair(Hash, spNodeExpr));
+  ForEachChild(spNodeExpr, [&](Expression::SPType const& rspChildExpr)
+  {
+    ++m_Nodes[rspChildExpr.get()].m_RefCount;
+  });
+  return spNodeExpr;
+}
+
+Expression::SPType ExpressionPool::_FindNode(Expression::SPType spNodeExpr, u64 Hash) const
+{
+  auto Range = m_Buckets.equal_range(Hash);
+  for (auto itBucket = Range.first; itBucket != Range.second; ++itBucket)
+    if (_IsShallowIdentical(itBucket->second, spNodeExpr))
+      return itBucket->second;
+  return nullptr;
+}
+
+bool ExpressionPool::Contains(Expression::SPType spExpr) const
+{
+  return m_Nodes.find(spExpr.get()) != std::end(m_Nodes);
+}
+
+u64 ExpressionPool::GetHash(Expression::SPType spExpr) const
+{
+  auto itNode = m_Nodes.find(spExpr.get());
+  if (itNode == std::end(m_Nodes))
+    return 0;
+  return itNode->second.m_Hash;
+}
+
+u32 ExpressionPool::GetBitSize(Expression::SPType spExpr) const
+{
+  auto itNode = m_Nodes.find(spExpr.get());
+  if (itNode == std::end(m_Nodes))
+    return 0;
+  return itNode->second.m_BitSize;
+}
+
+void ExpressionPool::Clear(void)
+{
+  m_Nodes.clear();
+  m_Buckets.clear();
+}
+
+u64 ExpressionPool::_ComputeHash(Expression::SPType spExpr) const
+{
+  std::hash<std::string> HashStr;
+  std::hash<Address>     HashAddr;
+
+  // Children are already interned, so their hash is cached
+  auto ChildHash = [&](Expression::SPType spChildExpr) -> u64
+  {
+    if (spChildExpr == nullptr)
+      return 0;
+    return m_Nodes.find(spChildExpr.get())->second.m_Hash;
+  };
+
+  u64 Hash = MixHash(0, spExpr->GetClassKind());
+
+  switch (spExpr->GetClassKind())
+  {
+  case Expression::Sys:
+  {
+    auto spSysExpr = expr_cast<SystemExpression>(spExpr);
+    Hash = MixHash(Hash, HashStr(spSysExpr->GetName()));
+    Hash = MixHash(Hash, HashAddr(spSysExpr->GetAddress()));
+    break;
+  }
+
+  case Expression::Bind:
+    for (auto const& rspExpr : expr_cast<BindExpression>(spExpr)->GetBoundExpressions())
+      Hash = MixHash(Hash, ChildHash(rspExpr));
+    break;
+
+  case Expression::Cond:
+  case Expression::TernaryCond:
+  case Expression::IfElseCond:
+  case Expression::WhileCond:
+  {
+    auto spCondExpr = expr_cast<ConditionExpression>(spExpr);
+    Hash = MixHash(Hash, spCondExpr->GetType());
+    Hash = MixHash(Hash, ChildHash(spCondExpr->GetReferenceExpression()));
+    Hash = MixHash(Hash, ChildHash(spCondExpr->GetTestExpression()));
+    if (auto spTernExpr = expr_cast<TernaryConditionExpression>(spExpr))
+    {
+      Hash = MixHash(Hash, ChildHash(spTernExpr->GetTrueExpression()));
+      Hash = MixHash(Hash, ChildHash(spTernExpr->GetFalseExpression()));
+    }
+    else if (auto spIfElseExpr = expr_cast<IfElseConditionExpression>(spExpr))
+    {
+      Hash = MixHash(Hash, ChildHash(spIfElseExpr->GetThenExpression()));
+      Hash = MixHash(Hash, ChildHash(spIfElseExpr->GetElseExpression()));
+    }
+    else if (auto spWhileExpr = expr_cast<WhileConditionExpression>(spExpr))
+      Hash = MixHash(Hash, ChildHash(spWhileExpr->GetBodyExpression()));
+    break;
+  }
+
+  case Expression::Assign:
+  {
+    auto spAssignExpr = expr_cast<AssignmentExpression>(spExpr);
+    Hash = MixHash(Hash, ChildHash(spAssignExpr->GetDestinationExpression()));
+    Hash = MixHash(Hash, ChildHash(spAssignExpr->GetSourceExpression()));
+    break;
+  }
+
+  case Expression::UnOp:
+  {
+    auto spUnOpExpr = expr_cast<UnaryOperationExpression>(spExpr);
+    Hash = MixHash(Hash, spUnOpExpr->GetOperation());
+    Hash = MixHash(Hash, ChildHash(spUnOpExpr->GetExpression()));
+    break;
+  }
+
+  case Expression::BinOp:
+  {
+    auto spBinOpExpr = expr_cast<BinaryOperationExpression>(spExpr);
+    Hash = MixHash(Hash, spBinOpExpr->GetOperation());
+    Hash = MixHash(Hash, ChildHash(spBinOpExpr->GetLeftExpression()));
+    Hash = MixHash(Hash, ChildHash(spBinOpExpr->GetRightExpression()));
+    break;
+  }
+
+  case Expression::Const:
+  {
+    auto Value = expr_cast<BitVectorExpression>(spExpr)->GetInt();
+    Hash = MixHash(Hash, Value.GetBitSize());
+    Hash = MixHash(Hash, Value.ConvertTo<u64>());
+    break;
+  }
+
+  case Expression::Id:
+  {
+    auto spIdExpr = expr_cast<IdentifierExpression>(spExpr);
+    Hash = MixHash(Hash, spIdExpr->GetId());
+    Hash = MixHash(Hash, reinterpret_cast<u64>(spIdExpr->GetCpuInformation()));
+    break;
+  }
+
+  case Expression::VecId:
+  {
+    auto spVecIdExpr = expr_cast<VectorIdentifierExpression>(spExpr);
+    for (auto Id : spVecIdExpr->GetVector())
+      Hash = MixHash(Hash, Id);
+    Hash = MixHash(Hash, reinterpret_cast<u64>(spVecIdExpr->GetCpuInformation()));
+    break;
+  }
+
+  case Expression::Track:
+  {
+    auto spTrkExpr = expr_cast<TrackExpression>(spExpr);
+    Hash = MixHash(Hash, ChildHash(spTrkExpr->GetTrackedExpression()));
+    Hash = MixHash(Hash, HashAddr(spTrkExpr->GetTrackAddress()));
+    Hash = MixHash(Hash, spTrkExpr->GetTrackPosition());
+    break;
+  }
+
+  case Expression::Var:
+  {
+    auto spVarExpr = expr_cast<VariableExpression>(spExpr);
+    Hash = MixHash(Hash, HashStr(spVarExpr->GetName()));
+    Hash = MixHash(Hash, spVarExpr->GetType());
+    Hash = MixHash(Hash, spVarExpr->GetBitSize());
+    break;
+  }
+
+  case Expression::Mem:
+  {
+    auto spMemExpr = expr_cast<MemoryExpression>(spExpr);
+    Hash = MixHash(Hash, spMemExpr->GetAccessSizeInBit());
+    Hash = MixHash(Hash, spMemExpr->IsDereferencable() ? 1 : 0);
+    Hash = MixHash(Hash, ChildHash(spMemExpr->GetBaseExpression()));
+    Hash = MixHash(Hash, ChildHash(spMemExpr->GetOffsetExpression()));
+    break;
+  }
+
+  case Expression::Sym:
+  {
+    auto spSymExpr = expr_cast<SymbolicExpression>(spExpr);
+    Hash = MixHash(Hash, spSymExpr->GetType());
+    Hash = MixHash(Hash, HashStr(spSymExpr->GetValue()));
+    Hash = MixHash(Hash, HashAddr(spSymExpr->GetAddress()));
+    Hash = MixHash(Hash, ChildHash(spSymExpr->GetExpression()));
+    break;
+  }
+
+  default:
+    break;
+  }
+
+  return Hash;
+}
+
+// Both nodes have interned children, comparing them is enough to compare the whole trees
+bool ExpressionPool::_IsShallowIdentical(Expression::SPType spLeftExpr, Expression::SPType spRightExpr) const
+{
+  if (spLeftExpr->GetClassKind() != spRightExpr->GetClassKind())
+    return false;
+
+  switch (spLeftExpr->GetClassKind())
+  {
+  case Expression::Sys:
+  {
+    auto spLeftSysExpr = expr_cast<SystemExpression>(spLeftExpr);
+    auto spRightSysExpr = expr_cast<SystemExpression>(spRightExpr);
+    return spLeftSysExpr->GetName() == spRightSysExpr->GetName()
+      && spLeftSysExpr->GetAddress() == spRightSysExpr->GetAddress();
+  }
+
+  case Expression::Bind:
+    return expr_cast<BindExpression>(spLeftExpr)->GetBoundExpressions() == expr_cast<BindExpression>(spRightExpr)->GetBoundExpressions();
+
+  case Expression::Cond:
+  case Expression::TernaryCond:
+  case Expression::IfElseCond:
+  case Expression::WhileCond:
+  {
+    auto spLeftCondExpr = expr_cast<ConditionExpression>(spLeftExpr);
+    auto spRightCondExpr = expr_cast<ConditionExpression>(spRightExpr);
+    if (spLeftCondExpr->GetType() != spRightCondExpr->GetType()
+      || spLeftCondExpr->GetReferenceExpression() != spRightCondExpr->GetReferenceExpression()
+      || spLeftCondExpr->GetTestExpression() != spRightCondExpr->GetTestExpression())
+      return false;
+    if (auto spLeftTernExpr = expr_cast<TernaryConditionExpression>(spLeftExpr))
+    {
+      auto spRightTernExpr = expr_cast<TernaryConditionExpression>(spRightExpr);
+      return spLeftTernExpr->GetTrueExpression() == spRightTernExpr->GetTrueExpression()
+        && spLeftTernExpr->GetFalseExpression() == spRightTernExpr->GetFalseExpression();
+    }
+    if (auto spLeftIfElseExpr = expr_cast<IfElseConditionExpression>(spLeftExpr))
+    {
+      auto spRightIfElseExpr = expr_cast<IfElseConditionExpression>(spRightExpr);
+      return spLeftIfElseExpr->GetThenExpression() == spRightIfElseExpr->GetThenExpression()
+        && spLeftIfElseExpr->GetElseExpression() == spRightIfElseExpr->GetElseExpression();
+    }
+    if (auto spLeftWhileExpr = expr_cast<WhileConditionExpression>(spLeftExpr))
+      return spLeftWhileExpr->GetBodyExpression() == expr_cast<WhileConditionExpression>(spRightExpr)->GetBodyExpression();
+    return true;
+  }
+
+  case Expression::Assign:
+  {
+    auto spLeftAssignExpr = expr_cast<AssignmentExpression>(spLeftExpr);
+    auto spRightAssignExpr = expr_cast<AssignmentExpression>(spRightExpr);
+    return spLeftAssignExpr->GetDestinationExpression() == spRightAssignExpr->GetDestinationExpression()
+      && spLeftAssignExpr->GetSourceExpression() == spRightAssignExpr->GetSourceExpression();
+  }
+
+  case Expression::UnOp:
+  {
+    auto spLeftUnOpExpr = expr_cast<UnaryOperationExpression>(spLeftExpr);
+    auto spRightUnOpExpr = expr_cast<UnaryOperationExpression>(spRightExpr);
+    return spLeftUnOpExpr->GetOperation() == spRightUnOpExpr->GetOperation()
+      && spLeftUnOpExpr->GetExpression() == spRightUnOpExpr->GetExpression();
+  }
+
+  case Expression::BinOp:
+  {
+    auto spLeftBinOpExpr = expr_cast<BinaryOperationExpression>(spLeftExpr);
+    auto spRightBinOpExpr = expr_cast<BinaryOperationExpression>(spRightExpr);
+    return spLeftBinOpExpr->GetOperation() == spRightBinOpExpr->GetOperation()
+      && spLeftBinOpExpr->GetLeftExpression() == spRightBinOpExpr->GetLeftExpression()
+      && spLeftBinOpExpr->GetRightExpression() == spRightBinOpExpr->GetRightExpression();
+  }
+
+  case Expression::Const:
+  {
+    auto LeftValue = expr_cast<BitVectorExpression>(spLeftExpr)->GetInt();
+    auto RightValue = expr_cast<BitVectorExpression>(spRightExpr)->GetInt();
+    return LeftValue.GetBitSize() == RightValue.GetBitSize() && LeftValue.UCmp(RightValue) == 0;
+  }
+
+  case Expression::Id:
+  {
+    auto spLeftIdExpr = expr_cast<IdentifierExpression>(spLeftExpr);
+    auto spRightIdExpr = expr_cast<IdentifierExpression>(spRightExpr);
+    return spLeftIdExpr->GetId() == spRightIdExpr->GetId()
+      && spLeftIdExpr->GetCpuInformation() == spRightIdExpr->GetCpuInformation();
+  }
+
+  case Expression::VecId:
+  {
+    auto spLeftVecIdExpr = expr_cast<VectorIdentifierExpression>(spLeftExpr);
+    auto spRightVecIdExpr = expr_cast<VectorIdentifierExpression>(spRightExpr);
+    return spLeftVecIdExpr->GetVector() == spRightVecIdExpr->GetVector()
+      && spLeftVecIdExpr->GetCpuInformation() == spRightVecIdExpr->GetCpuInformation();
+  }
+
+  case Expression::Track:
+  {
+    auto spLeftTrkExpr = expr_cast<TrackExpression>(spLeftExpr);
+    auto spRightTrkExpr = expr_cast<TrackExpression>(spRightExpr);
+    return spLeftTrkExpr->GetTrackedExpression() == spRightTrkExpr->GetTrackedExpression()
+      && spLeftTrkExpr->GetTrackAddress() == spRightTrkExpr->GetTrackAddress()
+      && spLeftTrkExpr->GetTrackPosition() == spRightTrkExpr->GetTrackPosition();
+  }
+
+  case Expression::Var:
+  {
+    auto spLeftVarExpr = expr_cast<VariableExpression>(spLeftExpr);
+    auto spRightVarExpr = expr_cast<VariableExpression>(spRightExpr);
+    return spLeftVarExpr->GetName() == spRightVarExpr->GetName()
+      && spLeftVarExpr->GetType() == spRightVarExpr->GetType()
+      && spLeftVarExpr->GetBitSize() == spRightVarExpr->GetBitSize();
+  }
+
+  case Expression::Mem:
+  {
+    auto spLeftMemExpr = expr_cast<MemoryExpression>(spLeftExpr);
+    auto spRightMemExpr = expr_cast<MemoryExpression>(spRightExpr);
+    return spLeftMemExpr->GetAccessSizeInBit() == spRightMemExpr->GetAccessSizeInBit()
+      && spLeftMemExpr->IsDereferencable() == spRightMemExpr->IsDereferencable()
+      && spLeftMemExpr->GetBaseExpression() == spRightMemExpr->GetBaseExpression()
+      && spLeftMemExpr->GetOffsetExpression() == spRightMemExpr->GetOffsetExpression();
+  }
+
+  case Expression::Sym:
+  {
+    auto spLeftSymExpr = expr_cast<SymbolicExpression>(spLeftExpr);
+    auto spRightSymExpr = expr_cast<SymbolicExpression>(spRightExpr);
+    return spLeftSymExpr->GetType() == spRightSymExpr->GetType()
+      && spLeftSymExpr->GetValue() == spRightSymExpr->GetValue()
+      && spLeftSymExpr->GetAddress() == spRightSymExpr->GetAddress()
+      && spLeftSymExpr->GetExpression() == spRightSymExpr->GetExpression();
+  }
+
+  default:
+    return false;
+  }
+}
+
+MEDUSA_NAMESPACE_END
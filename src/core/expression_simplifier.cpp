@@ -4,6 +4,160 @@
 
 MEDUSA_NAMESPACE_BEGIN
 
+namespace
+{
+  Expression::SPType GetNamedExpression(NamedExpressionType const& rNamedExprs, std::string const& rExprName)
+  {
+    auto itNamedExpr = rNamedExprs.find(rExprName);
+    if (itNamedExpr == std::end(rNamedExprs))
+      return nullptr;
+    return itNamedExpr->second;
+  }
+}
+
+RewriteEngine::RewriteEngine(u32 MaxRewriteCount)
+  : m_MaxRewriteCount(MaxRewriteCount), m_RewriteCount(0)
+{
+}
+
+void RewriteEngine::AddRule(ExpressionPattern::SPType spPattern, RewriteEngine::RewriteType Rewrite)
+{
+  Rule NewRule;
+  NewRule.m_spPattern = spPattern;
+  NewRule.m_Rewrite   = Rewrite;
+  m_Rules.push_back(NewRule);
+  m_Dispatch.clear();
+}
+
+bool RewriteEngine::Execute(Expression::SPType& rspExpr)
+{
+  m_RewriteCount = 0;
+  if (rspExpr == nullptr)
+    return true;
+
+  // Each visited node is mapped to its rewritten form, the key is kept alive so its address can't be reused
+  std::unordered_map<Expression const*, std::pair<Expression::SPType, Expression::SPType>> Results;
+  auto SetResult = [&](Expression::SPType const& rspKeyExpr, Expression::SPType const& rspResExpr)
+  {
+    Results[rspKeyExpr.get()] = std::make_pair(rspKeyExpr, rspResExpr);
+  };
+
+  // An item holding an original expression is the result of a rewrite, its result is propagated to the original one
+  struct WorkItem
+  {
+    Expression::SPType m_spExpr;
+    Expression::SPType m_spOrigExpr;
+  };
+
+  std::vector<WorkItem> Worklist;
+  Expression::VSPType Children;
+  Worklist.push_back(WorkItem{ rspExpr, nullptr });
+
+  while (!Worklist.empty())
+  {
+    auto CurItem = Worklist.back();
+
+    auto itRes = Results.find(CurItem.m_spExpr.get());
+    if (itRes != std::end(Results))
+    {
+      Worklist.pop_back();
+      if (CurItem.m_spOrigExpr != nullptr)
+        SetResult(CurItem.m_spOrigExpr, itRes->second.second);
+      continue;
+    }
+
+    // Children are rewritten first
+    Children.clear();
+    Expr::TransformChildren(CurItem.m_spExpr, [&](Expression::SPType const& rspChildExpr)
+    {
+      Children.push_back(rspChildExpr);
+      return rspChildExpr;
+    });
+    bool IsPending = false;
+    for (auto const& rspChildExpr : Children)
+    {
+      if (rspChildExpr == nullptr || Results.find(rspChildExpr.get()) != std::end(Results))
+        continue;
+      Worklist.push_back(WorkItem{ rspChildExpr, nullptr });
+      IsPending = true;
+    }
+    if (IsPending)
+      continue;
+    Worklist.pop_back();
+
+    // The node is only rebuilt if one of its children was rewritten
+    auto spNodeExpr = Expr::TransformChildren(CurItem.m_spExpr, [&](Expression::SPType const& rspChildExpr)
+    {
+      return Results[rspChildExpr.get()].second;
+    });
+
+    auto spRewrittenExpr = _ApplyRules(spNodeExpr);
+    if (spRewrittenExpr == nullptr)
+    {
+      SetResult(spNodeExpr, spNodeExpr);
+      SetResult(CurItem.m_spExpr, spNodeExpr);
+      if (CurItem.m_spOrigExpr != nullptr)
+        SetResult(CurItem.m_spOrigExpr, spNodeExpr);
+      continue;
+    }
+
+    if (++m_RewriteCount > m_MaxRewriteCount)
+      return false;
+
+    // The rewritten expression is dirty, its result becomes the result of the current node
+    if (CurItem.m_spOrigExpr != nullptr)
+      Worklist.push_back(CurItem);
+    Worklist.push_back(WorkItem{ spRewrittenExpr, CurItem.m_spExpr });
+  }
+
+  rspExpr = Results[rspExpr.get()].second;
+  return true;
+}
+
+// Rules are selected once for each kind and operation, in the order they were added
+std::vector<u32> const& RewriteEngine::_GetRules(Expression::SPType spExpr)
+{
+  auto ExprKind = spExpr->GetClassKind();
+  u32 OpType = 0xffff;
+  if (ExprKind == Expression::UnOp || ExprKind == Expression::BinOp)
+    OpType = std::static_pointer_cast<OperationExpression>(spExpr)->GetOperation();
+
+  u32 Key = (static_cast<u32>(ExprKind) << 16) | OpType;
+  auto itRules = m_Dispatch.find(Key);
+  if (itRules != std::end(m_Dispatch))
+    return itRules->second;
+
+  auto& rRules = m_Dispatch[Key];
+  for (u32 RuleIdx = 0; RuleIdx < m_Rules.size(); ++RuleIdx)
+  {
+    auto const& rspPattern = m_Rules[RuleIdx].m_spPattern;
+    auto RootKind = rspPattern->GetRootKind();
+    if (RootKind != Expression::Unknown && RootKind != ExprKind)
+      continue;
+    auto RootOp = rspPattern->GetRootOperation();
+    if (RootOp != -1 && static_cast<u32>(RootOp) != OpType)
+      continue;
+    rRules.push_back(RuleIdx);
+  }
+  return rRules;
+}
+
+Expression::SPType RewriteEngine::_ApplyRules(Expression::SPType spExpr)
+{
+  NamedExpressionType NamedExprs;
+  for (auto RuleIdx : _GetRules(spExpr))
+  {
+    auto const& rRule = m_Rules[RuleIdx];
+    NamedExprs.clear();
+    if (!rRule.m_spPattern->Filter(NamedExprs, spExpr))
+      continue;
+    auto spNewExpr = rRule.m_Rewrite(NamedExprs, spExpr);
+    if (spNewExpr != nullptr && spNewExpr != spExpr)
+      return spNewExpr;
+  }
+  return nullptr;
+}
+
 bool ExpressionSimplifier::Execute(void)
 {
   do
@@ -289,54 +443,51 @@ bool NormalizeExpression::_Finalize(void)
   return true;
 }
 
-ConstantPropagation::ConstantPropagation(Expression::SPType spExpr) : m_spExpr(spExpr)
+ConstantPropagation::ConstantPropagation(Expression::SPType& rspExpr) : m_rspExpr(rspExpr)
 {
 }
 
 bool ConstantPropagation::_RunOnce(void)
 {
-  auto FindOpWithConst = [](Expression::SPType spExpr) -> Expression::SPType
-  {
-    auto spBinOpExpr = expr_cast<BinaryOperationExpression>(spExpr);
-    if (spBinOpExpr == nullptr)
-      return nullptr;
-    if (spBinOpExpr->GetLeftExpression()->GetClassKind() != Expression::Const ||
-      spBinOpExpr->GetRightExpression()->GetClassKind() != Expression::Const)
-      return nullptr;
+  using namespace Pattern;
 
-    return spExpr;
+  auto IsConst = [](Expression::SPType spExpr)
+  {
+    return spExpr->GetClassKind() == Expression::Const;
   };
 
-  FilterVisitor FltVst(FindOpWithConst, 1);
-  m_spExpr->Visit(&FltVst);
-  auto Exprs = FltVst.GetMatchedExpressions();
-  if (Exprs.empty())
+  RewriteEngine Engine;
+  Engine.AddRule(AnyBinary<OperationExpression::OpUnk>(Callback("left", IsConst), Callback("right", IsConst)),
+    [](NamedExpressionType const& rNamedExprs, Expression::SPType spExpr) -> Expression::SPType
   {
-    m_IsDone = true;
-    return true;
-  }
-  auto spBinOpExpr = expr_cast<BinaryOperationExpression>(Exprs.front());
-  if (spBinOpExpr == nullptr)
-    return false;
-  auto spLConstExpr = expr_cast<BitVectorExpression>(spBinOpExpr->GetLeftExpression());
-  auto spRConstExpr = expr_cast<BitVectorExpression>(spBinOpExpr->GetRightExpression());
-
-  if (spLConstExpr == nullptr || spRConstExpr == nullptr)
-    return false;
+    auto spBinOpExpr = expr_cast<BinaryOperationExpression>(spExpr);
+    auto Left  = expr_cast<BitVectorExpression>(GetNamedExpression(rNamedExprs, "left"))->GetInt();
+    auto Right = expr_cast<BitVectorExpression>(GetNamedExpression(rNamedExprs, "right"))->GetInt();
 
-  u64 Res = 0;
-  u32 Bit = std::max(spLConstExpr->GetBitSize(), spRConstExpr->GetBitSize()); // NOTE: cast to the larger type
+    if (Left.GetBitSize() != Right.GetBitSize())
+      return nullptr;
 
-  switch (spBinOpExpr->GetOperation())
-  {
-  default:
-    return false;
+    BitVector Result;
+    switch (spBinOpExpr->GetOperation())
+    {
+    case OperationExpression::OpAnd: Result = Left & Right;      break;
+    case OperationExpression::OpOr:  Result = Left | Right;      break;
+    case OperationExpression::OpXor: Result = Left ^ Right;      break;
+    case OperationExpression::OpLls: Result = Left.Lls(Right);   break;
+    case OperationExpression::OpLrs: Result = Left.Lrs(Right);   break;
+    case OperationExpression::OpArs: Result = Left.Ars(Right);   break;
+    case OperationExpression::OpAdd: Result = Left + Right;      break;
+    case OperationExpression::OpSub: Result = Left - Right;      break;
+    case OperationExpression::OpMul: Result = Left * Right;      break;
+    default:
+      return nullptr;
+    }
 
-    // TODO: handle all operations...
-  }
+    return Expr::MakeBitVector(Result);
+  });
 
-  auto spConstExpr = Expr::MakeBitVector(Bit, Res);
-  return m_spExpr->UpdateChild(spBinOpExpr, spConstExpr);
+  m_IsDone = true;
+  return Engine.Execute(m_rspExpr);
 }
 
 bool ConstantPropagation::_Finalize(void)
@@ -347,8 +498,9 @@ bool ConstantPropagation::_Finalize(void)
 // TODO(wisk): lazy instanciate filters
 //std::once_flag g_InitFlt;
 
-ExpressionRewriter::ExpressionRewriter(Expression::SPType& rspExpr)
+ExpressionRewriter::ExpressionRewriter(Expression::SPType& rspExpr, bool RewriteSubExpressions)
   : m_rspExpr(rspExpr)
+  , m_RewriteSubExpressions(RewriteSubExpressions)
 {
 
 }
@@ -358,7 +510,7 @@ bool ExpressionRewriter::_RunOnce(void)
   using namespace Pattern;
 
   // Filter id = cmp + <cond>a ? * : *
-  ExpressionFilter ExprFlt_CmpA(Ternary("expr", EQ((
+  ExpressionPattern::SPType ExprPat_CmpA(Ternary("expr", EQ((
     OR(
     /**/BCAST(
     /****/LRS(
@@ -383,24 +535,35 @@ bool ExpressionRewriter::_RunOnce(void)
 
     Any("int1_0")), Any("true"), Any("false")));
 
-  while (ExprFlt_CmpA.Execute(m_rspExpr))
+  RewriteEngine::RewriteType Rewrite_CmpA =
+    [](NamedExpressionType const& rNamedExprs, Expression::SPType spExpr) -> Expression::SPType
   {
-    auto spExpr = ExprFlt_CmpA.GetExpression("expr");
-    auto spOp0 = ExprFlt_CmpA.GetExpression("op0");
-    auto spOp1 = ExprFlt_CmpA.GetExpression("op1");
-    auto spTrue = ExprFlt_CmpA.GetExpression("true");
-    auto spFalse = ExprFlt_CmpA.GetExpression("false");
-    if (spExpr == nullptr || spOp0 == nullptr || spOp1 == nullptr || spTrue == nullptr || spFalse == nullptr)
-      break;
-
-    auto spFltExpr = Expr::MakeTernaryCond(ConditionExpression::CondUgt, spOp0, spOp1, spTrue, spFalse);
-    m_rspExpr = spFltExpr;
-
-    break;
-  }
+    auto spOp0   = GetNamedExpression(rNamedExprs, "op0");
+    auto spOp1   = GetNamedExpression(rNamedExprs, "op1");
+    auto spTrue  = GetNamedExpression(rNamedExprs, "true");
+    auto spFalse = GetNamedExpression(rNamedExprs, "false");
+    if (spOp0 == nullptr || spOp1 == nullptr || spTrue == nullptr || spFalse == nullptr)
+      return nullptr;
+
+    return Expr::MakeTernaryCond(ConditionExpression::CondUgt, spOp0, spOp1, spTrue, spFalse);
+  };
 
   m_IsDone = true;
-  return true;
+
+  if (!m_RewriteSubExpressions)
+  {
+    NamedExpressionType NamedExprs;
+    if (!ExprPat_CmpA->Filter(NamedExprs, m_rspExpr))
+      return true;
+    auto spNewExpr = Rewrite_CmpA(NamedExprs, m_rspExpr);
+    if (spNewExpr != nullptr)
+      m_rspExpr = spNewExpr;
+    return true;
+  }
+
+  RewriteEngine Engine;
+  Engine.AddRule(ExprPat_CmpA, Rewrite_CmpA);
+  return Engine.Execute(m_rspExpr);
 }
 
 bool ExpressionRewriter::_Finalize(void)
@@ -8,7 +8,7 @@ MEDUSA_NAMESPACE_BEGIN
 
 bool operator==(std::pair<Expression::SPType, Expression::SPType> const& lhs, Expression::SPType const& rhs)
 {
-  return lhs.first->Compare(rhs) == Expression::CmpIdentical;
+  return lhs.first == rhs || lhs.first->Compare(rhs) == Expression::CmpIdentical;
 }
 
 Expression::SPType ExpressionVisitor::VisitSystem(SystemExpression::SPType spSysExpr)
@@ -247,6 +247,104 @@ Expression::SPType CloneVisitor::VisitSymbolic(SymbolicExpression::SPType spSymE
     spSymExpr->GetExpression() == nullptr ? nullptr : spSymExpr->GetExpression()->Visit(this));
 }
 
+Expression::SPType ExpressionTransformer::Transform(Expression::SPType spExpr)
+{
+  if (spExpr == nullptr)
+    return nullptr;
+
+  if (auto spPreExpr = _PreTransform(spExpr))
+    return spPreExpr;
+
+  auto spNodeExpr = Expr::TransformChildren(spExpr, [this](Expression::SPType const& rspChildExpr)
+  {
+    return Transform(rspChildExpr);
+  });
+  if (spNodeExpr == nullptr)
+    return nullptr;
+
+  return _PostTransform(spNodeExpr);
+}
+
+Expression::SPType ExpressionTransformer::VisitSystem(SystemExpression::SPType spSysExpr)
+{
+  return Transform(spSysExpr);
+}
+
+Expression::SPType ExpressionTransformer::VisitBind(BindExpression::SPType spBindExpr)
+{
+  return Transform(spBindExpr);
+}
+
+Expression::SPType ExpressionTransformer::VisitCondition(ConditionExpression::SPType spCondExpr)
+{
+  return Transform(spCondExpr);
+}
+
+Expression::SPType ExpressionTransformer::VisitTernaryCondition(TernaryConditionExpression::SPType spTernExpr)
+{
+  return Transform(spTernExpr);
+}
+
+Expression::SPType ExpressionTransformer::VisitIfElseCondition(IfElseConditionExpression::SPType spIfElseExpr)
+{
+  return Transform(spIfElseExpr);
+}
+
+Expression::SPType ExpressionTransformer::VisitWhileCondition(WhileConditionExpression::SPType spWhileExpr)
+{
+  return Transform(spWhileExpr);
+}
+
+Expression::SPType ExpressionTransformer::VisitAssignment(AssignmentExpression::SPType spAssignExpr)
+{
+  return Transform(spAssignExpr);
+}
+
+Expression::SPType ExpressionTransformer::VisitUnaryOperation(UnaryOperationExpression::SPType spUnOpExpr)
+{
+  return Transform(spUnOpExpr);
+}
+
+Expression::SPType ExpressionTransformer::VisitBinaryOperation(BinaryOperationExpression::SPType spBinOpExpr)
+{
+  return Transform(spBinOpExpr);
+}
+
+Expression::SPType ExpressionTransformer::VisitBitVector(BitVectorExpression::SPType spIntExpr)
+{
+  return Transform(spIntExpr);
+}
+
+Expression::SPType ExpressionTransformer::VisitIdentifier(IdentifierExpression::SPType spIdExpr)
+{
+  return Transform(spIdExpr);
+}
+
+Expression::SPType ExpressionTransformer::VisitVectorIdentifier(VectorIdentifierExpression::SPType spVecIdExpr)
+{
+  return Transform(spVecIdExpr);
+}
+
+Expression::SPType ExpressionTransformer::VisitTrack(TrackExpression::SPType spTrkExpr)
+{
+  return Transform(spTrkExpr);
+}
+
+Expression::SPType ExpressionTransformer::VisitVariable(VariableExpression::SPType spVarExpr)
+{
+  return Transform(spVarExpr);
+}
+
+Expression::SPType ExpressionTransformer::VisitMemory(MemoryExpression::SPType spMemExpr)
+{
+  return Transform(spMemExpr);
+}
+
+Expression::SPType ExpressionTransformer::VisitSymbolic(SymbolicExpression::SPType spSymExpr)
+{
+  return Transform(spSymExpr);
+}
+
 Expression::SPType FilterVisitor::VisitSystem(SystemExpression::SPType spSysExpr)
 {
   _Evaluate(spSysExpr);
@@ -663,25 +761,25 @@ Expression::SPType EvaluateVisitor::VisitBinaryOperation(BinaryOperationExpressi
     break;
 
   case OperationExpression::OpUDiv:
-    if (Right.GetUnsignedValue() == 0)
+    if (Right.IsZero())
       return nullptr;
     Result = Left.UDiv(Right);
     break;
 
   case OperationExpression::OpSDiv:
-    if (Right.GetSignedValue() == 0)
+    if (Right.IsZero())
       return nullptr;
     Result = Left.SDiv(Right);
     break;
 
   case OperationExpression::OpUMod:
-    if (Right.GetUnsignedValue() == 0)
+    if (Right.IsZero())
       return nullptr;
     Result = Left.UMod(Right);
     break;
 
   case OperationExpression::OpSMod:
-    if (Right.GetSignedValue() == 0)
+    if (Right.IsZero())
       return nullptr;
     Result = Left.SMod(Right);
     break;
@@ -897,43 +995,43 @@ bool EvaluateVisitor::_EvaluateCondition(u8 CondOp, BitVectorExpression::SPType
   switch (CondOp)
   {
   case ConditionExpression::CondEq:
-    rRes = RefVal.GetUnsignedValue() == TestVal.GetUnsignedValue();
+    rRes = RefVal.UCmp(TestVal) == 0;
     break;
 
   case ConditionExpression::CondNe:
-    rRes = RefVal.GetUnsignedValue() != TestVal.GetUnsignedValue();
+    rRes = RefVal.UCmp(TestVal) != 0;
     break;
 
   case ConditionExpression::CondUgt:
-    rRes = RefVal.GetUnsignedValue() > TestVal.GetUnsignedValue();
+    rRes = RefVal.UCmp(TestVal) > 0;
     break;
 
   case ConditionExpression::CondUge:
-    rRes = RefVal.GetUnsignedValue() >= TestVal.GetUnsignedValue();
+    rRes = RefVal.UCmp(TestVal) >= 0;
     break;
 
   case ConditionExpression::CondUlt:
-    rRes = RefVal.GetUnsignedValue() < TestVal.GetUnsignedValue();
+    rRes = RefVal.UCmp(TestVal) < 0;
     break;
 
   case ConditionExpression::CondUle:
-    rRes = RefVal.GetUnsignedValue() <= TestVal.GetUnsignedValue();
+    rRes = RefVal.UCmp(TestVal) <= 0;
     break;
 
   case ConditionExpression::CondSgt:
-    rRes = RefVal.GetSignedValue() > TestVal.GetSignedValue();
+    rRes = RefVal.SCmp(TestVal) > 0;
     break;
 
   case ConditionExpression::CondSge:
-    rRes = RefVal.GetSignedValue() >= TestVal.GetSignedValue();
+    rRes = RefVal.SCmp(TestVal) >= 0;
     break;
 
   case ConditionExpression::CondSlt:
-    rRes = RefVal.GetSignedValue() < TestVal.GetSignedValue();
+    rRes = RefVal.SCmp(TestVal) < 0;
     break;
 
   case ConditionExpression::CondSle:
-    rRes = RefVal.GetSignedValue() <= TestVal.GetSignedValue();
+    rRes = RefVal.SCmp(TestVal) <= 0;
     break;
 
   default:
@@ -1139,7 +1237,7 @@ Expression::SPType SymbolicVisitor::VisitAssignment(AssignmentExpression::SPType
     {
       auto spCurExpr = std::get<0>(rSymPair);
 
-      if (auto spIdExpr = expr_cast<IdentifierExpression>(RemoveExpressionAnnotations(spCurExpr)))
+      if (auto spIdExpr = expr_cast<IdentifierExpression>(_GetKey(spCurExpr)))
       {
         if ((spIdExpr->Compare(spNoAnnDstExpr) == Expression::CmpIdentical) || (spIdExpr->Compare(spNoAnnDstExprVst) == Expression::CmpIdentical))
         {
@@ -1245,7 +1343,7 @@ Expression::SPType SymbolicVisitor::VisitBinaryOperation(BinaryOperationExpressi
     break;
 
   case OperationExpression::OpUDiv:
-    if (Right.GetUnsignedValue() == 0)
+    if (Right.IsZero())
     {
       Log::Write("core").Level(LogError) << "unsigned division by zero" << LogEnd;
       return nullptr;
@@ -1254,7 +1352,7 @@ Expression::SPType SymbolicVisitor::VisitBinaryOperation(BinaryOperationExpressi
     break;
 
   case OperationExpression::OpSDiv:
-    if (Right.GetSignedValue() == 0)
+    if (Right.IsZero())
     {
       Log::Write("core").Level(LogError) << "signed division by zero" << LogEnd;
       return nullptr;
@@ -1263,7 +1361,7 @@ Expression::SPType SymbolicVisitor::VisitBinaryOperation(BinaryOperationExpressi
     break;
 
   case OperationExpression::OpUMod:
-    if (Right.GetUnsignedValue() == 0)
+    if (Right.IsZero())
     {
       Log::Write("core").Level(LogError) << "unsigned modulo by zero" << LogEnd;
       return nullptr;
@@ -1272,7 +1370,7 @@ Expression::SPType SymbolicVisitor::VisitBinaryOperation(BinaryOperationExpressi
     break;
 
   case OperationExpression::OpSMod:
-    if (Right.GetSignedValue() == 0)
+    if (Right.IsZero())
     {
       Log::Write("core").Level(LogError) << "signed modulo by zero" << LogEnd;
       return nullptr;
@@ -1352,11 +1450,11 @@ Expression::SPType SymbolicVisitor::VisitIdentifier(IdentifierExpression::SPType
 {
   for (auto const& rSymPair : m_SymCtxt)
   {
-    auto spCurExpr = RemoveExpressionAnnotations(rSymPair.first);
+    auto spCurExpr = _GetKey(rSymPair.first);
 
     if (auto spSymIdExpr = expr_cast<IdentifierExpression>(spCurExpr))
     {
-      if (spSymIdExpr->GetId() == spIdExpr->GetId())
+      if (spSymIdExpr == spIdExpr || spSymIdExpr->GetId() == spIdExpr->GetId())
         if (m_Update)
           return rSymPair.second;
         else
@@ -1415,7 +1513,7 @@ Expression::SPType SymbolicVisitor::VisitVariable(VariableExpression::SPType spV
 
       for (auto const& rSymPair : m_SymCtxt)
       {
-        auto spCurExpr = RemoveExpressionAnnotations(rSymPair.first);
+        auto spCurExpr = _GetKey(rSymPair.first);
         if (auto spSymVarExpr = expr_cast<VariableExpression>(spCurExpr))
         {
           if (spSymVarExpr->GetName() == spVarExpr->GetName())
@@ -1429,7 +1527,7 @@ Expression::SPType SymbolicVisitor::VisitVariable(VariableExpression::SPType spV
       m_VarPool.erase(spVarExpr->GetName());
       for (auto const& rSymPair : m_SymCtxt)
       {
-        auto spCurExpr = RemoveExpressionAnnotations(rSymPair.first);
+        auto spCurExpr = _GetKey(rSymPair.first);
         if (auto spSymVarExpr = expr_cast<VariableExpression>(spCurExpr))
         {
           if (spSymVarExpr->GetName() == spVarExpr->GetName())
@@ -1598,6 +1696,7 @@ SymbolicVisitor SymbolicVisitor::Fork(void) const
     Forked.m_SymCond.push_back(rSymCond->Clone());
 
   Forked.m_VarPool = m_VarPool;
+  Forked.m_Keys = m_Keys;
 
   Forked.m_IsSymbolic         = Forked.m_IsSymbolic;
   Forked.m_IsRelative         = Forked.m_IsRelative;
@@ -1723,10 +1822,10 @@ bool SymbolicVisitor::UpdateExpression(Expression::SPType spKeyExpr, SymbolicVis
 {
   for (auto const& rSymPair : m_SymCtxt)
   {
-    auto spCurExpr = RemoveExpressionAnnotations(rSymPair.first);
+    auto spCurExpr = _GetKey(rSymPair.first);
     if (spCurExpr == nullptr)
         continue;
-    if (spKeyExpr->Compare(spCurExpr) == Expression::CmpIdentical)
+    if (spCurExpr == spKeyExpr || spKeyExpr->Compare(spCurExpr) == Expression::CmpIdentical)
     {
       auto spClonedExpr = rSymPair.second->Clone();
       if (!updt(spClonedExpr))
@@ -1899,24 +1998,30 @@ bool SymbolicVisitor::FindAllPaths(int& rNumOfPathFound, Architecture& rArch, Sy
 
 Expression::SPType SymbolicVisitor::RemoveExpressionAnnotations(Expression::SPType spExpr)
 {
-  class RemoveTrackOrSymbolicExpression : public CloneVisitor
+  class RemoveTrackOrSymbolicExpression : public ExpressionTransformer
   {
-  public:
-    virtual Expression::SPType VisitTrack(TrackExpression::SPType spTrkExpr)
+  protected:
+    virtual Expression::SPType _PreTransform(Expression::SPType spExpr)
     {
-      return spTrkExpr->GetTrackedExpression()->Visit(this);
-    }
+      switch (spExpr->GetClassKind())
+      {
+      case Expression::Track:
+        return Transform(std::static_pointer_cast<TrackExpression>(spExpr)->GetTrackedExpression());
 
-    virtual Expression::SPType VisitSymbolic(SymbolicExpression::SPType spSymExpr)
-    {
-      auto spExpr = spSymExpr->GetExpression();
-      if (spExpr == nullptr)
-        return spSymExpr;
-      return spSymExpr->GetExpression()->Visit(this);
+      case Expression::Sym:
+      {
+        auto spSymValExpr = std::static_pointer_cast<SymbolicExpression>(spExpr)->GetExpression();
+        if (spSymValExpr == nullptr)
+          return spExpr;
+        return Transform(spSymValExpr);
+      }
+
+      default:
+        return nullptr;
+      }
     }
   } RemTrkOrSymVst;
-  auto p = spExpr->Visit(&RemTrkOrSymVst);
-  return p;
+  return RemTrkOrSymVst.Transform(spExpr);
 }
 
 Expression::SPType SymbolicVisitor::GetValue(Expression::SPType spExpr) const
@@ -1934,12 +2039,15 @@ Expression::SPType SymbolicVisitor::GetValue(Expression::SPType spExpr) const
   }
   if (spOptExprToFind != nullptr)
     spExprToFind = spOptExprToFind;
+  // Only keys are interned, a lookup which is not a key can't be found by address
+  if (auto spInternedExpr = m_Keys.Find(spExprToFind))
+    spExprToFind = spInternedExpr;
   for (auto const& rSymPair : m_SymCtxt)
   {
-    auto spCurExpr = RemoveExpressionAnnotations(rSymPair.first);
+    auto spCurExpr = _GetKey(rSymPair.first);
     if (spCurExpr == nullptr)
       continue;
-    if (spExprToFind->Compare(spCurExpr) == Expression::CmpIdentical)
+    if (spCurExpr == spExprToFind || spExprToFind->Compare(spCurExpr) == Expression::CmpIdentical)
       return rSymPair.second;
   }
 
@@ -1948,7 +2056,7 @@ Expression::SPType SymbolicVisitor::GetValue(Expression::SPType spExpr) const
   {
     for (auto const& rSymPair : m_SymCtxt)
     {
-      auto spCurExpr = RemoveExpressionAnnotations(rSymPair.first);
+      auto spCurExpr = _GetKey(rSymPair.first);
       if (spCurExpr == nullptr)
         continue;
       auto spCurMemExpr = expr_cast<MemoryExpression>(spCurExpr);
@@ -2085,7 +2193,7 @@ void SymbolicVisitor::_InsertExpression(Expression::SPType spKeyExpr, Expression
     Expression::SPType spNewKeyExpr, spNewValExpr;
     for (auto const& rSymPair : m_SymCtxt)
     {
-      auto spCurExpr = RemoveExpressionAnnotations(rSymPair.first);
+      auto spCurExpr = _GetKey(rSymPair.first);
       if (spCurExpr == nullptr)
         continue;
       auto spCurMemExpr = expr_cast<MemoryExpression>(spCurExpr);
@@ -2146,10 +2254,77 @@ bool SymbolicVisitor::_RemoveExpression(Expression::SPType spKeyExpr)
   auto itSymPair = std::find(std::begin(m_SymCtxt), std::end(m_SymCtxt), spKeyExpr);
   if (itSymPair == std::end(m_SymCtxt))
     return false;
+  m_Keys.Remove(itSymPair->first);
   m_SymCtxt.erase(itSymPair);
   return true;
 }
 
+Expression::SPType SymbolicVisitor::_GetKey(Expression::SPType spKeyExpr) const
+{
+  return m_Keys.Get(spKeyExpr);
+}
+
+SymbolicVisitor::KeyCache::KeyCache(void)
+  : m_spExprPool(std::make_shared<ExpressionPool>())
+{
+}
+
+SymbolicVisitor::KeyCache::KeyCache(KeyCache const& rKeyCache)
+  : m_spExprPool(rKeyCache.m_spExprPool)
+  , m_Keys(rKeyCache.m_Keys)
+{
+  // The copy holds its own reference on each key
+  for (auto const& rKeyPair : m_Keys)
+    if (rKeyPair.second.second != nullptr)
+      m_spExprPool->Intern(rKeyPair.second.second);
+}
+
+SymbolicVisitor::KeyCache& SymbolicVisitor::KeyCache::operator=(KeyCache Copy)
+{
+  std::swap(m_spExprPool, Copy.m_spExprPool);
+  std::swap(m_Keys, Copy.m_Keys);
+  return *this;
+}
+
+SymbolicVisitor::KeyCache::~KeyCache(void)
+{
+  for (auto const& rKeyPair : m_Keys)
+    if (rKeyPair.second.second != nullptr)
+      m_spExprPool->Release(rKeyPair.second.second);
+}
+
+Expression::SPType SymbolicVisitor::KeyCache::Get(Expression::SPType spKeyExpr)
+{
+  if (spKeyExpr == nullptr)
+    return nullptr;
+
+  auto itKey = m_Keys.find(spKeyExpr.get());
+  if (itKey != std::end(m_Keys))
+    return itKey->second.second;
+
+  auto spNoAnnKeyExpr = RemoveExpressionAnnotations(spKeyExpr);
+  if (spNoAnnKeyExpr != nullptr)
+    spNoAnnKeyExpr = m_spExprPool->Intern(spNoAnnKeyExpr);
+  m_Keys[spKeyExpr.get()] = std::make_pair(spKeyExpr, spNoAnnKeyExpr);
+  return spNoAnnKeyExpr;
+}
+
+Expression::SPType SymbolicVisitor::KeyCache::Find(Expression::SPType spExpr) const
+{
+  return m_spExprPool->Find(spExpr);
+}
+
+void SymbolicVisitor::KeyCache::Remove(Expression::SPType spKeyExpr)
+{
+  auto itKey = m_Keys.find(spKeyExpr.get());
+  if (itKey == std::end(m_Keys))
+    return;
+  auto spNoAnnKeyExpr = itKey->second.second;
+  m_Keys.erase(itKey);
+  if (spNoAnnKeyExpr != nullptr)
+    m_spExprPool->Release(spNoAnnKeyExpr);
+}
+
 bool SymbolicVisitor::_EvaluateCondition(u8 CondOp, BitVectorExpression::SPType spConstRefExpr, BitVectorExpression::SPType spConstTestExpr, bool& rRes) const
 {
   auto RefVal = spConstRefExpr->GetInt();
@@ -2158,43 +2333,43 @@ bool SymbolicVisitor::_EvaluateCondition(u8 CondOp, BitVectorExpression::SPType
   switch (CondOp)
   {
   case ConditionExpression::CondEq:
-    rRes = RefVal.GetUnsignedValue() == TestVal.GetUnsignedValue();
+    rRes = RefVal.UCmp(TestVal) == 0;
     break;
 
   case ConditionExpression::CondNe:
-    rRes = RefVal.GetUnsignedValue() != TestVal.GetUnsignedValue();
+    rRes = RefVal.UCmp(TestVal) != 0;
     break;
 
   case ConditionExpression::CondUgt:
-    rRes = RefVal.GetUnsignedValue() > TestVal.GetUnsignedValue();
+    rRes = RefVal.UCmp(TestVal) > 0;
     break;
 
   case ConditionExpression::CondUge:
-    rRes = RefVal.GetUnsignedValue() >= TestVal.GetUnsignedValue();
+    rRes = RefVal.UCmp(TestVal) >= 0;
     break;
 
   case ConditionExpression::CondUlt:
-    rRes = RefVal.GetUnsignedValue() < TestVal.GetUnsignedValue();
+    rRes = RefVal.UCmp(TestVal) < 0;
     break;
 
   case ConditionExpression::CondUle:
-    rRes = RefVal.GetUnsignedValue() <= TestVal.GetUnsignedValue();
+    rRes = RefVal.UCmp(TestVal) <= 0;
     break;
 
   case ConditionExpression::CondSgt:
-    rRes = RefVal.GetSignedValue() > TestVal.GetSignedValue();
+    rRes = RefVal.SCmp(TestVal) > 0;
     break;
 
   case ConditionExpression::CondSge:
-    rRes = RefVal.GetSignedValue() >= TestVal.GetSignedValue();
+    rRes = RefVal.SCmp(TestVal) >= 0;
     break;
 
   case ConditionExpression::CondSlt:
-    rRes = RefVal.GetSignedValue() < TestVal.GetSignedValue();
+    rRes = RefVal.SCmp(TestVal) < 0;
     break;
 
   case ConditionExpression::CondSle:
-    rRes = RefVal.GetSignedValue() <= TestVal.GetSignedValue();
+    rRes = RefVal.SCmp(TestVal) <= 0;
     break;
 
   default:
@@ -2211,58 +2386,83 @@ NormalizeIdentifier::NormalizeIdentifier(CpuInformation const& rCpuInfo, u8 Mode
 {
 }
 
-Expression::SPType NormalizeIdentifier::VisitAssignment(AssignmentExpression::SPType spAssignExpr)
+// Only the source of an assignment is normalized, a sub-register destination is extended to its register
+Expression::SPType NormalizeIdentifier::_PreTransform(Expression::SPType spExpr)
 {
-  auto spNrmSrc = spAssignExpr->GetSourceExpression()->Visit(this);
-
-  if (auto spDstId = expr_cast<IdentifierExpression>(spAssignExpr->GetDestinationExpression()))
+  switch (spExpr->GetClassKind())
   {
-    u32 Id = spDstId->GetId();
-    u32 NrmId = 0;
-    u64 Mask = 0x0;
+  case Expression::Assign:
+  {
+    auto spAssignExpr = std::static_pointer_cast<AssignmentExpression>(spExpr);
+    auto spNrmSrc = Transform(spAssignExpr->GetSourceExpression());
 
-    if (m_rCpuInfo.NormalizeRegister(Id, m_Mode, NrmId, Mask))
+    if (auto spDstId = expr_cast<IdentifierExpression>(spAssignExpr->GetDestinationExpression()))
     {
-      auto const* pCpuInfo = spDstId->GetCpuInformation();
-      u32 NrmIdBitSize = pCpuInfo->GetSizeOfRegisterInBit(NrmId);
-
-      // ExtDstId = (ExtDstId & ~Mask) | InsertBits(bit_cast(ExtSrc, NrmIdBitSize))
-      auto spExtDstId = Expr::MakeId(NrmId, pCpuInfo);
-      auto spMask = Expr::MakeBitVector(NrmIdBitSize, Mask);
-      auto spNotMask = Expr::MakeBitVector(NrmIdBitSize, ~Mask);
-      auto spBitCastSrc = Expr::MakeBinOp(OperationExpression::OpBcast, spNrmSrc, Expr::MakeBitVector(NrmIdBitSize, NrmIdBitSize));
-      auto spInsertBits = Expr::MakeBinOp(OperationExpression::OpInsertBits, spBitCastSrc, spMask);
-      auto spClearBits = Expr::MakeBinOp(OperationExpression::OpAnd, spExtDstId, spNotMask);
-      auto spExtSrc = Expr::MakeBinOp(OperationExpression::OpOr, spClearBits, spInsertBits);
-
-      return Expr::MakeAssign(spExtDstId, spExtSrc);
+      u32 Id = spDstId->GetId();
+      u32 NrmId = 0;
+      u64 Mask = 0x0;
+
+      if (m_rCpuInfo.NormalizeRegister(Id, m_Mode, NrmId, Mask))
+      {
+        auto const* pCpuInfo = spDstId->GetCpuInformation();
+        u32 NrmIdBitSize = pCpuInfo->GetSizeOfRegisterInBit(NrmId);
+
+        // ExtDstId = (ExtDstId & ~Mask) | InsertBits(bit_cast(ExtSrc, NrmIdBitSize))
+        auto spExtDstId = Expr::MakeId(NrmId, pCpuInfo);
+        auto spMask = Expr::MakeBitVector(NrmIdBitSize, Mask);
+        auto spNotMask = Expr::MakeBitVector(NrmIdBitSize, ~Mask);
+        auto spBitCastSrc = Expr::MakeBinOp(OperationExpression::OpBcast, spNrmSrc, Expr::MakeBitVector(NrmIdBitSize, NrmIdBitSize));
+        auto spInsertBits = Expr::MakeBinOp(OperationExpression::OpInsertBits, spBitCastSrc, spMask);
+        auto spClearBits = Expr::MakeBinOp(OperationExpression::OpAnd, spExtDstId, spNotMask);
+        auto spExtSrc = Expr::MakeBinOp(OperationExpression::OpOr, spClearBits, spInsertBits);
+
+        return Expr::MakeAssign(spExtDstId, spExtSrc);
+      }
     }
+
+    if (spNrmSrc == spAssignExpr->GetSourceExpression())
+      return spExpr;
+    return Expr::MakeAssign(spAssignExpr->GetDestinationExpression(), spNrmSrc);
   }
 
-  return Expr::MakeAssign(spAssignExpr->GetDestinationExpression(), spNrmSrc);
-}
+  case Expression::Id:
+  {
+    auto spIdExpr = std::static_pointer_cast<IdentifierExpression>(spExpr);
+    u32 Id = spIdExpr->GetId();
+    u32 NrmId = 0;
+    u64 Mask = 0x0;
 
-Expression::SPType NormalizeIdentifier::VisitIdentifier(IdentifierExpression::SPType spIdExpr)
-{
-  u32 Id = spIdExpr->GetId();
-  u32 NrmId = 0;
-  u64 Mask = 0x0;
+    if (!m_rCpuInfo.NormalizeRegister(Id, m_Mode, NrmId, Mask))
+      return spExpr;
+    u32 IdBitSize = m_rCpuInfo.GetSizeOfRegisterInBit(Id);
+    u32 NrmIdBitSize = m_rCpuInfo.GetSizeOfRegisterInBit(NrmId);
 
-  if (!m_rCpuInfo.NormalizeRegister(Id, m_Mode, NrmId, Mask))
-    return spIdExpr;
-  u32 IdBitSize = m_rCpuInfo.GetSizeOfRegisterInBit(Id);
-  u32 NrmIdBitSize = m_rCpuInfo.GetSizeOfRegisterInBit(NrmId);
+    auto spExtractBits = Expr::MakeBinOp(
+      OperationExpression::OpExtractBits,
+      Expr::MakeId(NrmId, spIdExpr->GetCpuInformation()),
+      Expr::MakeBitVector(NrmIdBitSize, Mask));
+    return Expr::MakeBinOp(OperationExpression::OpBcast,
+      spExtractBits, Expr::MakeBitVector(IdBitSize, IdBitSize));
+  }
 
-  auto spExtractBits = Expr::MakeBinOp(
-    OperationExpression::OpExtractBits,
-    Expr::MakeId(NrmId, spIdExpr->GetCpuInformation()),
-    Expr::MakeBitVector(NrmIdBitSize, Mask));
-  return Expr::MakeBinOp(OperationExpression::OpBcast,
-    spExtractBits, Expr::MakeBitVector(IdBitSize, IdBitSize));
+  default:
+    return nullptr;
+  }
 }
 
-Expression::SPType IdentifierToVariable::VisitIdentifier(IdentifierExpression::SPType spIdExpr)
+// Variables are copied, the JIT sets their bit size and must not modify the cached semantic they come from
+Expression::SPType IdentifierToVariable::_PreTransform(Expression::SPType spExpr)
 {
+  if (spExpr->GetClassKind() == Expression::Var)
+  {
+    auto spVarExpr = std::static_pointer_cast<VariableExpression>(spExpr);
+    return Expr::MakeVar(spVarExpr->GetName(), spVarExpr->GetType(), static_cast<u16>(spVarExpr->GetBitSize()));
+  }
+
+  if (spExpr->GetClassKind() != Expression::Id)
+    return nullptr;
+
+  auto spIdExpr = std::static_pointer_cast<IdentifierExpression>(spExpr);
   auto pCpuInfo = spIdExpr->GetCpuInformation();
   auto Id = spIdExpr->GetId();
   m_UsedId.insert(Id);
@@ -2558,7 +2758,7 @@ Expression::SPType SimplifyVisitor::VisitUnaryOperation(UnaryOperationExpression
   {
   case OperationExpression::OpNeg:
   {
-    if (spBvExpr != nullptr && spBvExpr->GetInt().GetUnsignedValue() == 0x0)
+    if (spBvExpr != nullptr && spBvExpr->GetInt().IsZero())
       return spBvExpr;
     break;
   }
@@ -2585,7 +2785,7 @@ Expression::SPType SimplifyVisitor::VisitBinaryOperation(BinaryOperationExpressi
 
   auto TestZero = [](BitVectorExpression::SPType spBv)
   {
-    return (spBv != nullptr && spBv->GetInt().GetUnsignedValue() == 0x0);
+    return (spBv != nullptr && spBv->GetInt().IsZero());
   };
 
   auto TestOne = [](BitVectorExpression::SPType spBv)
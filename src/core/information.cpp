@@ -1 +1,19 @@
-#include "medusa/information.hpp"
\ No newline at end of file
+#include "medusa/information.hpp"
+#include "medusa/expression.hpp"
+
+MEDUSA_NAMESPACE_BEGIN
+
+std::shared_ptr<Expression> CpuInformation::GetIdentifierExpression(u32 Id) const
+{
+  std::lock_guard<MutexType> Lock(m_IdExprMutex);
+
+  if (Id >= m_IdExprs.size())
+    m_IdExprs.resize(Id + 1);
+
+  auto& rspIdExpr = m_IdExprs[Id];
+  if (rspIdExpr == nullptr)
+    rspIdExpr = std::make_shared<IdentifierExpression>(Id, this);
+  return rspIdExpr;
+}
+
+MEDUSA_NAMESPACE_END
@@ -0,0 +1,35 @@
+#include "medusa/instruction_buffer.hpp"
+
+MEDUSA_NAMESPACE_BEGIN
+
+InstructionBuffer::InstructionBuffer(void)
+  : m_spArena(std::make_shared<Arena>())
+{
+}
+
+InstructionBuffer::~InstructionBuffer(void)
+{
+}
+
+Instruction::SPType InstructionBuffer::MakeInstruction(void)
+{
+  ArenaAllocator<Instruction> Alloc(m_spArena);
+  auto spDna = std::allocate_shared<CellData>(ArenaAllocator<CellData>(Alloc), Cell::InstructionType, Instruction::NoneType);
+  return std::allocate_shared<Instruction>(Alloc, spDna);
+}
+
+void InstructionBuffer::Clear(void)
+{
+  m_Insns.clear();
+
+  // Instructions stored elsewhere still use the arena memory, they only keep its used chunks alive
+  if (m_spArena.use_count() == 1)
+    m_spArena->Rewind();
+  else
+  {
+    m_spArena->Trim();
+    m_spArena = std::make_shared<Arena>();
+  }
+}
+
+MEDUSA_NAMESPACE_END
@@ -0,0 +1,955 @@
+#include "medusa/ir.hpp"
+
+#include <sstream>
+
+MEDUSA_NAMESPACE_BEGIN
+
+namespace
+{
+  char const* OperationToString(u8 OpType)
+  {
+    switch (OpType)
+    {
+    case OperationExpression::OpNot:         return "not";
+    case OperationExpression::OpNeg:         return "neg";
+    case OperationExpression::OpSwap:        return "swap";
+    case OperationExpression::OpBsf:         return "bsf";
+    case OperationExpression::OpBsr:         return "bsr";
+    case OperationExpression::OpFNeg:        return "fneg";
+    case OperationExpression::OpAnd:         return "and";
+    case OperationExpression::OpOr:          return "or";
+    case OperationExpression::OpXor:         return "xor";
+    case OperationExpression::OpLls:         return "lls";
+    case OperationExpression::OpLrs:         return "lrs";
+    case OperationExpression::OpArs:         return "ars";
+    case OperationExpression::OpRol:         return "rol";
+    case OperationExpression::OpRor:         return "ror";
+    case OperationExpression::OpAdd:         return "add";
+    case OperationExpression::OpSub:         return "sub";
+    case OperationExpression::OpMul:         return "mul";
+    case OperationExpression::OpSDiv:        return "sdiv";
+    case OperationExpression::OpUDiv:        return "udiv";
+    case OperationExpression::OpSMod:        return "smod";
+    case OperationExpression::OpUMod:        return "umod";
+    case OperationExpression::OpSext:        return "sext";
+    case OperationExpression::OpZext:        return "zext";
+    case OperationExpression::OpInsertBits:  return "insert_bits";
+    case OperationExpression::OpExtractBits: return "extract_bits";
+    case OperationExpression::OpClearBits:   return "clear_bits";
+    case OperationExpression::OpBcast:       return "bcast";
+    case OperationExpression::OpFAdd:        return "fadd";
+    case OperationExpression::OpFSub:        return "fsub";
+    case OperationExpression::OpFMul:        return "fmul";
+    case OperationExpression::OpFDiv:        return "fdiv";
+    case OperationExpression::OpFMod:        return "fmod";
+    default:                                 return "unk";
+    }
+  }
+
+  char const* ConditionToString(u8 CondType)
+  {
+    switch (CondType)
+    {
+    case ConditionExpression::CondEq:  return "eq";
+    case ConditionExpression::CondNe:  return "ne";
+    case ConditionExpression::CondUgt: return "ugt";
+    case ConditionExpression::CondUge: return "uge";
+    case ConditionExpression::CondUlt: return "ult";
+    case ConditionExpression::CondUle: return "ule";
+    case ConditionExpression::CondSgt: return "sgt";
+    case ConditionExpression::CondSge: return "sge";
+    case ConditionExpression::CondSlt: return "slt";
+    case ConditionExpression::CondSle: return "sle";
+    default:                           return "unk";
+    }
+  }
+
+  IrInstruction MakeInstruction(u8 Type, u8 Operation, u32 Dst, u32 Src0, u32 Src1, u32 Src2, u32 Imm)
+  {
+    IrInstruction Insn;
+    Insn.m_Type      = Type;
+    Insn.m_Operation = Operation;
+    Insn.m_Dst       = Dst;
+    Insn.m_Src[0]    = Src0;
+    Insn.m_Src[1]    = Src1;
+    Insn.m_Src[2]    = Src2;
+    Insn.m_Imm       = Imm;
+    return Insn;
+  }
+
+  // Returns the number of sources an instruction requires, the base of memory accesses is optional
+  u8 GetNumberOfSources(u8 Type)
+  {
+    switch (Type)
+    {
+    case IrInstruction::WriteReg:
+    case IrInstruction::WriteFlag:
+    case IrInstruction::Load:
+    case IrInstruction::AddressOf:
+    case IrInstruction::UnOp:
+      return 1;
+
+    case IrInstruction::BinOp:
+    case IrInstruction::Cmp:
+      return 2;
+
+    case IrInstruction::Store:
+    case IrInstruction::Select:
+      return 3;
+
+    default:
+      return 0;
+    }
+  }
+
+  bool HasOptionalBase(u8 Type)
+  {
+    return Type == IrInstruction::Load || Type == IrInstruction::Store || Type == IrInstruction::AddressOf;
+  }
+}
+
+// ir instruction /////////////////////////////////////////////////////////////
+
+bool IrInstruction::HasSideEffect(void) const
+{
+  switch (m_Type)
+  {
+  // A load may fault or trigger a memory hook
+  case Load:
+  case WriteReg:
+  case WriteFlag:
+  case Store:
+  case Sys:
+    return true;
+
+  default:
+    return false;
+  }
+}
+
+// ir block ///////////////////////////////////////////////////////////////////
+
+IrBlock::IrBlock(CpuInformation const* pCpuInfo)
+  : m_pCpuInfo(pCpuInfo)
+{
+}
+
+u32 IrBlock::GetValueBitSize(u32 Value) const
+{
+  if (Value >= m_ValueBitSizes.size())
+    return 0;
+  return m_ValueBitSizes[Value];
+}
+
+u32 IrBlock::EmitConst(BitVector const& rValue)
+{
+  u32 ConstIdx = static_cast<u32>(m_Consts.size());
+  m_Consts.push_back(rValue);
+  u32 Dst = _AddValue(rValue.GetBitSize());
+  m_Insns.push_back(MakeInstruction(IrInstruction::Const, 0, Dst, IrInstruction::NoValue, IrInstruction::NoValue, IrInstruction::NoValue, ConstIdx));
+  return Dst;
+}
+
+u32 IrBlock::EmitReadReg(u32 RegId)
+{
+  if (m_pCpuInfo == nullptr)
+    return IrInstruction::NoValue;
+  u32 RegSize = m_pCpuInfo->GetSizeOfRegisterInBit(RegId);
+  if (RegSize == 0)
+    return IrInstruction::NoValue;
+  u32 Dst = _AddValue(RegSize);
+  m_Insns.push_back(MakeInstruction(IrInstruction::ReadReg, 0, Dst, IrInstruction::NoValue, IrInstruction::NoValue, IrInstruction::NoValue, RegId));
+  return Dst;
+}
+
+void IrBlock::EmitWriteReg(u32 RegId, u32 SrcVal)
+{
+  u8 Type = _IsFlag(RegId) ? IrInstruction::WriteFlag : IrInstruction::WriteReg;
+  m_Insns.push_back(MakeInstruction(Type, 0, IrInstruction::NoValue, SrcVal, IrInstruction::NoValue, IrInstruction::NoValue, RegId));
+}
+
+u32 IrBlock::EmitLoad(u32 AccessSizeInBit, u32 OffVal, u32 BaseVal)
+{
+  u32 Dst = _AddValue(AccessSizeInBit);
+  m_Insns.push_back(MakeInstruction(IrInstruction::Load, 0, Dst, OffVal, BaseVal, IrInstruction::NoValue, AccessSizeInBit));
+  return Dst;
+}
+
+void IrBlock::EmitStore(u32 OffVal, u32 BaseVal, u32 SrcVal)
+{
+  m_Insns.push_back(MakeInstruction(IrInstruction::Store, 0, IrInstruction::NoValue, OffVal, BaseVal, SrcVal, GetValueBitSize(SrcVal)));
+}
+
+u32 IrBlock::EmitAddressOf(u32 AccessSizeInBit, u32 OffVal, u32 BaseVal)
+{
+  u32 Dst = _AddValue(AccessSizeInBit);
+  m_Insns.push_back(MakeInstruction(IrInstruction::AddressOf, 0, Dst, OffVal, BaseVal, IrInstruction::NoValue, AccessSizeInBit));
+  return Dst;
+}
+
+u32 IrBlock::EmitUnOp(OperationExpression::Type OpType, u32 SrcVal)
+{
+  u32 Dst = _AddValue(GetValueBitSize(SrcVal));
+  m_Insns.push_back(MakeInstruction(IrInstruction::UnOp, static_cast<u8>(OpType), Dst, SrcVal, IrInstruction::NoValue, IrInstruction::NoValue, 0));
+  return Dst;
+}
+
+u32 IrBlock::EmitBinOp(OperationExpression::Type OpType, u32 LeftVal, u32 RightVal, u32 BitSize)
+{
+  u32 Dst = _AddValue(BitSize);
+  m_Insns.push_back(MakeInstruction(IrInstruction::BinOp, static_cast<u8>(OpType), Dst, LeftVal, RightVal, IrInstruction::NoValue, 0));
+  return Dst;
+}
+
+u32 IrBlock::EmitCmp(ConditionExpression::Type CondType, u32 RefVal, u32 TestVal)
+{
+  u32 Dst = _AddValue(1);
+  m_Insns.push_back(MakeInstruction(IrInstruction::Cmp, static_cast<u8>(CondType), Dst, RefVal, TestVal, IrInstruction::NoValue, 0));
+  return Dst;
+}
+
+u32 IrBlock::EmitSelect(u32 CondVal, u32 TrueVal, u32 FalseVal)
+{
+  u32 Dst = _AddValue(GetValueBitSize(TrueVal));
+  m_Insns.push_back(MakeInstruction(IrInstruction::Select, 0, Dst, CondVal, TrueVal, FalseVal, 0));
+  return Dst;
+}
+
+void IrBlock::EmitSys(Expression::SPType spSysExpr)
+{
+  u32 SysIdx = static_cast<u32>(m_SysExprs.size());
+  m_SysExprs.push_back(spSysExpr);
+  m_Insns.push_back(MakeInstruction(IrInstruction::Sys, 0, IrInstruction::NoValue, IrInstruction::NoValue, IrInstruction::NoValue, IrInstruction::NoValue, SysIdx));
+}
+
+bool IrBlock::Verify(std::string& rError) const
+{
+  std::vector<bool> Defined(m_ValueBitSizes.size(), false);
+
+  for (u32 InsnIdx = 0; InsnIdx < m_Insns.size(); ++InsnIdx)
+  {
+    auto const& rInsn = m_Insns[InsnIdx];
+    std::string Reason;
+
+    auto IsDefined = [&](u32 Value)
+    {
+      return Value < Defined.size() && Defined[Value];
+    };
+
+    u8 SrcNo = GetNumberOfSources(rInsn.m_Type);
+    for (u8 SrcIdx = 0; SrcIdx < SrcNo && Reason.empty(); ++SrcIdx)
+    {
+      if (SrcIdx == 1 && HasOptionalBase(rInsn.m_Type) && rInsn.m_Src[1] == IrInstruction::NoValue)
+        continue;
+      if (!IsDefined(rInsn.m_Src[SrcIdx]))
+        Reason = "source is not defined";
+    }
+
+    u32 DstSize = GetValueBitSize(rInsn.m_Dst);
+    if (Reason.empty())
+    {
+      switch (rInsn.m_Type)
+      {
+      case IrInstruction::Const:
+        if (rInsn.m_Imm >= m_Consts.size())
+          Reason = "unknown constant";
+        else if (m_Consts[rInsn.m_Imm].GetBitSize() != DstSize)
+          Reason = "constant size mismatch";
+        break;
+
+      case IrInstruction::ReadReg:
+        if (m_pCpuInfo != nullptr && m_pCpuInfo->GetSizeOfRegisterInBit(rInsn.m_Imm) != DstSize)
+          Reason = "register size mismatch";
+        break;
+
+      case IrInstruction::WriteReg:
+      case IrInstruction::WriteFlag:
+        if ((rInsn.m_Type == IrInstruction::WriteFlag) != _IsFlag(rInsn.m_Imm))
+          Reason = "flag written as a register";
+        else if (m_pCpuInfo != nullptr && m_pCpuInfo->GetSizeOfRegisterInBit(rInsn.m_Imm) != GetValueBitSize(rInsn.m_Src[0]))
+          Reason = "register size mismatch";
+        break;
+
+      case IrInstruction::Load:
+      case IrInstruction::AddressOf:
+        if (rInsn.m_Imm != DstSize)
+          Reason = "access size mismatch";
+        break;
+
+      case IrInstruction::Store:
+        if (rInsn.m_Imm != GetValueBitSize(rInsn.m_Src[2]))
+          Reason = "access size mismatch";
+        break;
+
+      case IrInstruction::UnOp:
+        if (GetValueBitSize(rInsn.m_Src[0]) != DstSize)
+          Reason = "operand size mismatch";
+        break;
+
+      case IrInstruction::BinOp:
+        if (DstSize == 0)
+          Reason = "result has no size";
+        break;
+
+      case IrInstruction::Cmp:
+        if (DstSize != 1)
+          Reason = "comparison result is not a bit";
+        break;
+
+      case IrInstruction::Select:
+        if (GetValueBitSize(rInsn.m_Src[0]) != 1)
+          Reason = "condition is not a bit";
+        else if (GetValueBitSize(rInsn.m_Src[1]) != DstSize || GetValueBitSize(rInsn.m_Src[2]) != DstSize)
+          Reason = "operand size mismatch";
+        break;
+
+      case IrInstruction::Sys:
+        if (rInsn.m_Imm >= m_SysExprs.size())
+          Reason = "unknown system expression";
+        break;
+
+      default:
+        Reason = "unknown instruction";
+        break;
+      }
+    }
+
+    if (Reason.empty() && rInsn.m_Dst != IrInstruction::NoValue)
+    {
+      if (rInsn.m_Dst >= Defined.size())
+        Reason = "destination is not allocated";
+      else if (Defined[rInsn.m_Dst])
+        Reason = "destination is already defined";
+      else
+        Defined[rInsn.m_Dst] = true;
+    }
+
+    if (!Reason.empty())
+    {
+      std::ostringstream Err;
+      Err << "instruction " << InsnIdx << " (" << ToString(rInsn) << "): " << Reason;
+      rError = Err.str();
+      return false;
+    }
+  }
+
+  return true;
+}
+
+FlagLiveness::FlagLiveness(CpuInformation const* pCpuInfo, FlagSetType const& rDeadFlagsOnExit)
+  : m_pCpuInfo(pCpuInfo), m_DeadFlags(rDeadFlagsOnExit)
+{
+}
+
+bool FlagLiveness::Write(u32 FlagId)
+{
+  return m_DeadFlags.insert(FlagId).second;
+}
+
+// Without CPU information, only the same register is aliased
+void FlagLiveness::Read(u32 RegId)
+{
+  for (auto itFlag = std::begin(m_DeadFlags); itFlag != std::end(m_DeadFlags);)
+  {
+    bool IsAliased = m_pCpuInfo != nullptr ? m_pCpuInfo->IsRegisterAliased(*itFlag, RegId) : *itFlag == RegId;
+    if (IsAliased)
+      itFlag = m_DeadFlags.erase(itFlag);
+    else
+      ++itFlag;
+  }
+}
+
+u32 IrBlock::EliminateDeadFlags(FlagLiveness::FlagSetType const& rDeadFlagsOnExit)
+{
+  u32 InsnNo = static_cast<u32>(m_Insns.size());
+  std::vector<bool> Removed(InsnNo, false);
+
+  // Walk backward, a flag is dead if it's written again before being read
+  FlagLiveness Liveness(m_pCpuInfo, rDeadFlagsOnExit);
+  for (u32 InsnIdx = InsnNo; InsnIdx-- != 0;)
+  {
+    auto const& rInsn = m_Insns[InsnIdx];
+    switch (rInsn.m_Type)
+    {
+    case IrInstruction::WriteFlag:
+      if (!Liveness.Write(rInsn.m_Imm))
+        Removed[InsnIdx] = true;
+      break;
+
+    case IrInstruction::ReadReg:
+      Liveness.Read(rInsn.m_Imm);
+      break;
+
+    case IrInstruction::Sys:
+      Liveness.ReadAll();
+      break;
+
+    default:
+      break;
+    }
+  }
+
+  // Then remove the computations of these flags
+  std::vector<bool> Used(m_ValueBitSizes.size(), false);
+  for (u32 InsnIdx = InsnNo; InsnIdx-- != 0;)
+  {
+    if (Removed[InsnIdx])
+      continue;
+    auto const& rInsn = m_Insns[InsnIdx];
+    if (!rInsn.HasSideEffect() && (rInsn.m_Dst == IrInstruction::NoValue || !Used[rInsn.m_Dst]))
+    {
+      Removed[InsnIdx] = true;
+      continue;
+    }
+    for (u32 Src : rInsn.m_Src)
+      if (Src != IrInstruction::NoValue)
+        Used[Src] = true;
+  }
+
+  u32 KeptNo = 0;
+  for (u32 InsnIdx = 0; InsnIdx < InsnNo; ++InsnIdx)
+    if (!Removed[InsnIdx])
+      m_Insns[KeptNo++] = m_Insns[InsnIdx];
+  m_Insns.resize(KeptNo);
+
+  return InsnNo - KeptNo;
+}
+
+std::string IrBlock::ToString(void) const
+{
+  std::string Res;
+  for (auto const& rInsn : m_Insns)
+  {
+    Res += ToString(rInsn);
+    Res += "\n";
+  }
+  return Res;
+}
+
+std::string IrBlock::ToString(IrInstruction const& rInsn) const
+{
+  std::ostringstream Out;
+
+  auto PrintValue = [&](u32 Value)
+  {
+    if (Value == IrInstruction::NoValue)
+      Out << "%?";
+    else
+      Out << "%" << Value;
+  };
+
+  auto PrintAddress = [&]()
+  {
+    if (rInsn.m_Src[1] != IrInstruction::NoValue)
+    {
+      PrintValue(rInsn.m_Src[1]);
+      Out << ":";
+    }
+    PrintValue(rInsn.m_Src[0]);
+  };
+
+  if (rInsn.m_Dst != IrInstruction::NoValue)
+  {
+    PrintValue(rInsn.m_Dst);
+    Out << ":" << GetValueBitSize(rInsn.m_Dst) << " = ";
+  }
+
+  switch (rInsn.m_Type)
+  {
+  case IrInstruction::Const:
+    Out << "const ";
+    if (rInsn.m_Imm < m_Consts.size())
+      Out << m_Consts[rInsn.m_Imm].ToString();
+    else
+      Out << "?";
+    break;
+
+  case IrInstruction::ReadReg:
+    Out << "read_reg " << _GetRegisterName(rInsn.m_Imm);
+    break;
+
+  case IrInstruction::WriteReg:
+  case IrInstruction::WriteFlag:
+    Out << (rInsn.m_Type == IrInstruction::WriteFlag ? "write_flag " : "write_reg ") << _GetRegisterName(rInsn.m_Imm) << ", ";
+    PrintValue(rInsn.m_Src[0]);
+    break;
+
+  case IrInstruction::Load:
+    Out << "load ";
+    PrintAddress();
+    break;
+
+  case IrInstruction::Store:
+    Out << "store ";
+    PrintAddress();
+    Out << ", ";
+    PrintValue(rInsn.m_Src[2]);
+    break;
+
+  case IrInstruction::AddressOf:
+    Out << "address_of ";
+    PrintAddress();
+    break;
+
+  case IrInstruction::UnOp:
+    Out << OperationToString(rInsn.m_Operation) << " ";
+    PrintValue(rInsn.m_Src[0]);
+    break;
+
+  case IrInstruction::BinOp:
+    Out << OperationToString(rInsn.m_Operation) << " ";
+    PrintValue(rInsn.m_Src[0]);
+    Out << ", ";
+    PrintValue(rInsn.m_Src[1]);
+    break;
+
+  case IrInstruction::Cmp:
+    Out << "cmp." << ConditionToString(rInsn.m_Operation) << " ";
+    PrintValue(rInsn.m_Src[0]);
+    Out << ", ";
+    PrintValue(rInsn.m_Src[1]);
+    break;
+
+  case IrInstruction::Select:
+    Out << "select ";
+    PrintValue(rInsn.m_Src[0]);
+    Out << ", ";
+    PrintValue(rInsn.m_Src[1]);
+    Out << ", ";
+    PrintValue(rInsn.m_Src[2]);
+    break;
+
+  case IrInstruction::Sys:
+    Out << "sys ";
+    if (rInsn.m_Imm < m_SysExprs.size())
+      Out << std::static_pointer_cast<SystemExpression>(m_SysExprs[rInsn.m_Imm])->GetName();
+    else
+      Out << "?";
+    break;
+
+  default:
+    Out << "unknown";
+    break;
+  }
+
+  return Out.str();
+}
+
+void IrBlock::Clear(void)
+{
+  m_Insns.clear();
+  m_ValueBitSizes.clear();
+  m_Consts.clear();
+  m_SysExprs.clear();
+}
+
+u32 IrBlock::_AddValue(u32 BitSize)
+{
+  u32 Value = static_cast<u32>(m_ValueBitSizes.size());
+  m_ValueBitSizes.push_back(static_cast<u16>(BitSize));
+  return Value;
+}
+
+bool IrBlock::_IsFlag(u32 RegId) const
+{
+  return m_pCpuInfo != nullptr && m_pCpuInfo->GetSizeOfRegisterInBit(RegId) == 1;
+}
+
+std::string IrBlock::_GetRegisterName(u32 RegId) const
+{
+  if (m_pCpuInfo != nullptr)
+    if (auto pRegName = m_pCpuInfo->ConvertIdentifierToName(RegId))
+      return pRegName;
+  std::ostringstream Out;
+  Out << "reg" << RegId;
+  return Out.str();
+}
+
+// ir builder /////////////////////////////////////////////////////////////////
+
+IrBuilder::IrBuilder(IrBlock& rBlock)
+  : m_rBlock(rBlock)
+  , m_PredVal(IrInstruction::NoValue)
+{
+}
+
+bool IrBuilder::Lower(Expression::SPType spExpr)
+{
+  if (spExpr == nullptr)
+    return false;
+
+  switch (spExpr->GetClassKind())
+  {
+  case Expression::Sys:
+    // A hook can't be predicated, it may also modify the context
+    if (m_PredVal != IrInstruction::NoValue)
+      return false;
+    m_rBlock.EmitSys(spExpr);
+    m_Regs.clear();
+    return true;
+
+  case Expression::Bind:
+    for (auto spBoundExpr : std::static_pointer_cast<BindExpression>(spExpr)->GetBoundExpressions())
+      if (!Lower(spBoundExpr))
+        return false;
+    return true;
+
+  case Expression::Assign:
+    return _LowerAssignment(std::static_pointer_cast<AssignmentExpression>(spExpr));
+
+  case Expression::IfElseCond:
+    return _LowerIfElse(std::static_pointer_cast<IfElseConditionExpression>(spExpr));
+
+  case Expression::Var:
+  {
+    auto spVarExpr = std::static_pointer_cast<VariableExpression>(spExpr);
+    if (spVarExpr->GetType() == VariableExpression::Free)
+      m_Vars.erase(spVarExpr->GetName());
+    return true;
+  }
+
+  case Expression::Track:
+    return Lower(std::static_pointer_cast<TrackExpression>(spExpr)->GetTrackedExpression());
+
+  default:
+    return false;
+  }
+}
+
+bool IrBuilder::Lower(Expression::VSPType const& rExprs)
+{
+  for (auto const& rspExpr : rExprs)
+    if (!Lower(rspExpr))
+      return false;
+  return true;
+}
+
+bool IrBuilder::Lower(Expression::LSPType const& rExprs)
+{
+  for (auto const& rspExpr : rExprs)
+    if (!Lower(rspExpr))
+      return false;
+  return true;
+}
+
+u32 IrBuilder::_LowerValue(Expression::SPType spExpr)
+{
+  if (spExpr == nullptr)
+    return IrInstruction::NoValue;
+
+  switch (spExpr->GetClassKind())
+  {
+  case Expression::Const:
+    return m_rBlock.EmitConst(std::static_pointer_cast<BitVectorExpression>(spExpr)->GetInt());
+
+  case Expression::Id:
+    return _GetRegister(std::static_pointer_cast<IdentifierExpression>(spExpr)->GetId());
+
+  case Expression::Var:
+  {
+    auto spVarExpr = std::static_pointer_cast<VariableExpression>(spExpr);
+    if (spVarExpr->GetType() != VariableExpression::Use)
+      return IrInstruction::NoValue;
+    auto itVar = m_Vars.find(spVarExpr->GetName());
+    if (itVar == std::end(m_Vars))
+      return IrInstruction::NoValue;
+    return itVar->second;
+  }
+
+  case Expression::Mem:
+  {
+    auto spMemExpr = std::static_pointer_cast<MemoryExpression>(spExpr);
+    u32 OffVal, BaseVal;
+    if (!_LowerMemoryAddress(spMemExpr, OffVal, BaseVal))
+      return IrInstruction::NoValue;
+    if (spMemExpr->IsDereferencable())
+    {
+      // Both branches of an if/else are executed, a load could fault in the one not taken
+      if (m_PredVal != IrInstruction::NoValue)
+        return IrInstruction::NoValue;
+      return m_rBlock.EmitLoad(spMemExpr->GetAccessSizeInBit(), OffVal, BaseVal);
+    }
+    return m_rBlock.EmitAddressOf(spMemExpr->GetAccessSizeInBit(), OffVal, BaseVal);
+  }
+
+  case Expression::UnOp:
+  {
+    auto spUnOpExpr = std::static_pointer_cast<UnaryOperationExpression>(spExpr);
+    u32 SrcVal = _LowerValue(spUnOpExpr->GetExpression());
+    if (SrcVal == IrInstruction::NoValue)
+      return IrInstruction::NoValue;
+    return m_rBlock.EmitUnOp(spUnOpExpr->GetOperation(), SrcVal);
+  }
+
+  case Expression::BinOp:
+  {
+    auto spBinOpExpr = std::static_pointer_cast<BinaryOperationExpression>(spExpr);
+    u32 LeftVal = _LowerValue(spBinOpExpr->GetLeftExpression());
+    if (LeftVal == IrInstruction::NoValue)
+      return IrInstruction::NoValue;
+    u32 RightVal = _LowerValue(spBinOpExpr->GetRightExpression());
+    if (RightVal == IrInstruction::NoValue)
+      return IrInstruction::NoValue;
+
+    u32 BitSize;
+    switch (spBinOpExpr->GetOperation())
+    {
+    // The value of the right operand is the size of the result
+    case OperationExpression::OpSext:
+    case OperationExpression::OpZext:
+    case OperationExpression::OpBcast:
+    {
+      auto spSizeExpr = expr_cast<BitVectorExpression>(spBinOpExpr->GetRightExpression());
+      if (spSizeExpr == nullptr)
+        return IrInstruction::NoValue;
+      BitSize = spSizeExpr->GetInt().ConvertTo<u32>();
+      break;
+    }
+
+    default:
+      BitSize = std::max(m_rBlock.GetValueBitSize(LeftVal), m_rBlock.GetValueBitSize(RightVal));
+      break;
+    }
+    return m_rBlock.EmitBinOp(spBinOpExpr->GetOperation(), LeftVal, RightVal, BitSize);
+  }
+
+  case Expression::Cond:
+  case Expression::TernaryCond:
+  {
+    auto spCondExpr = std::static_pointer_cast<ConditionExpression>(spExpr);
+    u32 RefVal = _LowerValue(spCondExpr->GetReferenceExpression());
+    if (RefVal == IrInstruction::NoValue)
+      return IrInstruction::NoValue;
+    u32 TestVal = _LowerValue(spCondExpr->GetTestExpression());
+    if (TestVal == IrInstruction::NoValue)
+      return IrInstruction::NoValue;
+    u32 CondVal = m_rBlock.EmitCmp(spCondExpr->GetCondition(), RefVal, TestVal);
+    if (spExpr->GetClassKind() == Expression::Cond)
+      return CondVal;
+
+    auto spTernExpr = std::static_pointer_cast<TernaryConditionExpression>(spExpr);
+    u32 TrueVal = _LowerValue(spTernExpr->GetTrueExpression());
+    if (TrueVal == IrInstruction::NoValue)
+      return IrInstruction::NoValue;
+    u32 FalseVal = _LowerValue(spTernExpr->GetFalseExpression());
+    if (FalseVal == IrInstruction::NoValue)
+      return IrInstruction::NoValue;
+    return m_rBlock.EmitSelect(CondVal, TrueVal, FalseVal);
+  }
+
+  case Expression::Track:
+    return _LowerValue(std::static_pointer_cast<TrackExpression>(spExpr)->GetTrackedExpression());
+
+  default:
+    return IrInstruction::NoValue;
+  }
+}
+
+bool IrBuilder::_LowerAssignment(AssignmentExpression::SPType spAssignExpr)
+{
+  auto spDstExpr = spAssignExpr->GetDestinationExpression();
+  while (spDstExpr != nullptr && spDstExpr->GetClassKind() == Expression::Track)
+    spDstExpr = std::static_pointer_cast<TrackExpression>(spDstExpr)->GetTrackedExpression();
+  if (spDstExpr == nullptr)
+    return false;
+
+  u32 SrcVal = _LowerValue(spAssignExpr->GetSourceExpression());
+  if (SrcVal == IrInstruction::NoValue)
+    return false;
+
+  switch (spDstExpr->GetClassKind())
+  {
+  case Expression::Id:
+  {
+    u32 RegId = std::static_pointer_cast<IdentifierExpression>(spDstExpr)->GetId();
+    auto pCpuInfo = m_rBlock.GetCpuInformation();
+    if (pCpuInfo == nullptr || pCpuInfo->GetSizeOfRegisterInBit(RegId) != m_rBlock.GetValueBitSize(SrcVal))
+      return false;
+    _SetRegister(RegId, SrcVal);
+    return true;
+  }
+
+  case Expression::Var:
+  {
+    auto spVarExpr = std::static_pointer_cast<VariableExpression>(spDstExpr);
+    if (spVarExpr->GetType() != VariableExpression::Use)
+      return false;
+    m_Vars[spVarExpr->GetName()] = SrcVal;
+    return true;
+  }
+
+  case Expression::Mem:
+  {
+    auto spMemExpr = std::static_pointer_cast<MemoryExpression>(spDstExpr);
+    if (!spMemExpr->IsDereferencable() || spMemExpr->GetAccessSizeInBit() != m_rBlock.GetValueBitSize(SrcVal))
+      return false;
+    // Stores can't be merged with Select, the memory would be accessed even if the branch is not taken
+    if (m_PredVal != IrInstruction::NoValue)
+      return false;
+    u32 OffVal, BaseVal;
+    if (!_LowerMemoryAddress(spMemExpr, OffVal, BaseVal))
+      return false;
+    m_rBlock.EmitStore(OffVal, BaseVal, SrcVal);
+    return true;
+  }
+
+  default:
+    return false;
+  }
+}
+
+bool IrBuilder::_LowerIfElse(IfElseConditionExpression::SPType spIfElseExpr)
+{
+  u32 RefVal = _LowerValue(spIfElseExpr->GetReferenceExpression());
+  if (RefVal == IrInstruction::NoValue)
+    return false;
+  u32 TestVal = _LowerValue(spIfElseExpr->GetTestExpression());
+  if (TestVal == IrInstruction::NoValue)
+    return false;
+  u32 CondVal = m_rBlock.EmitCmp(spIfElseExpr->GetCondition(), RefVal, TestVal);
+
+  // m_PredRegs contains the deferred writes of the enclosing branches, so a read of an aliased
+  // register can be detected in the nested ones
+  u32 OuterPredVal = m_PredVal;
+  std::set<u32> OuterPredRegs = m_PredRegs;
+  RegisterMapType PrevRegs = m_Regs;
+  VariableMapType PrevVars = m_Vars;
+
+  std::set<u32> WrittenRegs;
+  auto LowerBranch = [&](Expression::SPType spBranchExpr, u32 BranchCondVal)
+  {
+    m_Regs = PrevRegs;
+    m_Vars = PrevVars;
+    m_PredRegs = OuterPredRegs;
+    if (spBranchExpr == nullptr)
+      return true;
+    m_PredVal = OuterPredVal == IrInstruction::NoValue
+      ? BranchCondVal
+      : m_rBlock.EmitBinOp(OperationExpression::OpAnd, OuterPredVal, BranchCondVal, 1);
+    bool Res = Lower(spBranchExpr);
+    WrittenRegs.insert(std::begin(m_PredRegs), std::end(m_PredRegs));
+    return Res;
+  };
+
+  bool Res = LowerBranch(spIfElseExpr->GetThenExpression(), CondVal);
+  RegisterMapType ThenRegs = m_Regs;
+  VariableMapType ThenVars = m_Vars;
+  if (Res && spIfElseExpr->GetElseExpression() != nullptr)
+    Res = LowerBranch(spIfElseExpr->GetElseExpression(), m_rBlock.EmitUnOp(OperationExpression::OpNot, CondVal));
+  else
+    LowerBranch(nullptr, IrInstruction::NoValue);
+  RegisterMapType ElseRegs = m_Regs;
+  VariableMapType ElseVars = m_Vars;
+
+  m_PredVal = OuterPredVal;
+  m_PredRegs = OuterPredRegs;
+  m_Regs = PrevRegs;
+  m_Vars = PrevVars;
+  if (!Res)
+    return false;
+
+  auto pCpuInfo = m_rBlock.GetCpuInformation();
+
+  // Writes of aliased registers can't be merged independently
+  for (u32 RegId : WrittenRegs)
+    for (u32 OtherRegId : WrittenRegs)
+      if (RegId != OtherRegId && pCpuInfo->IsRegisterAliased(RegId, OtherRegId))
+        return false;
+
+  for (u32 RegId : WrittenRegs)
+  {
+    u32 PrevVal = IrInstruction::NoValue;
+    auto GetBranchValue = [&](RegisterMapType const& rBranchRegs)
+    {
+      auto itReg = rBranchRegs.find(RegId);
+      if (itReg != std::end(rBranchRegs))
+        return itReg->second;
+      if (PrevVal == IrInstruction::NoValue)
+        PrevVal = _GetRegister(RegId);
+      return PrevVal;
+    };
+
+    u32 ThenVal = GetBranchValue(ThenRegs);
+    u32 ElseVal = GetBranchValue(ElseRegs);
+    if (ThenVal == IrInstruction::NoValue || ElseVal == IrInstruction::NoValue)
+      return false;
+    _SetRegister(RegId, ThenVal == ElseVal ? ThenVal : m_rBlock.EmitSelect(CondVal, ThenVal, ElseVal));
+  }
+
+  std::set<std::string> VarNames;
+  for (auto const& rVar : ThenVars)
+    VarNames.insert(rVar.first);
+  for (auto const& rVar : ElseVars)
+    VarNames.insert(rVar.first);
+  for (auto const& rVarName : VarNames)
+  {
+    auto itThenVar = ThenVars.find(rVarName);
+    auto itElseVar = ElseVars.find(rVarName);
+    u32 ThenVal = itThenVar != std::end(ThenVars) ? itThenVar->second : IrInstruction::NoValue;
+    u32 ElseVal = itElseVar != std::end(ElseVars) ? itElseVar->second : IrInstruction::NoValue;
+
+    // A variable allocated in a single branch is only meaningful in this one
+    if (ThenVal == ElseVal || ElseVal == IrInstruction::NoValue)
+      m_Vars[rVarName] = ThenVal;
+    else if (ThenVal == IrInstruction::NoValue)
+      m_Vars[rVarName] = ElseVal;
+    else
+      m_Vars[rVarName] = m_rBlock.EmitSelect(CondVal, ThenVal, ElseVal);
+  }
+
+  return true;
+}
+
+bool IrBuilder::_LowerMemoryAddress(MemoryExpression::SPType spMemExpr, u32& rOffVal, u32& rBaseVal)
+{
+  rBaseVal = IrInstruction::NoValue;
+  if (auto spBaseExpr = spMemExpr->GetBaseExpression())
+  {
+    rBaseVal = _LowerValue(spBaseExpr);
+    if (rBaseVal == IrInstruction::NoValue)
+      return false;
+  }
+  rOffVal = _LowerValue(spMemExpr->GetOffsetExpression());
+  return rOffVal != IrInstruction::NoValue;
+}
+
+u32 IrBuilder::_GetRegister(u32 RegId)
+{
+  auto itReg = m_Regs.find(RegId);
+  if (itReg != std::end(m_Regs))
+    return itReg->second;
+
+  auto pCpuInfo = m_rBlock.GetCpuInformation();
+  if (pCpuInfo == nullptr)
+    return IrInstruction::NoValue;
+
+  // Writes in a branch are deferred, the register file doesn't contain them yet
+  for (u32 WrittenRegId : m_PredRegs)
+    if (pCpuInfo->IsRegisterAliased(WrittenRegId, RegId))
+      return IrInstruction::NoValue;
+
+  u32 Val = m_rBlock.EmitReadReg(RegId);
+  if (Val != IrInstruction::NoValue)
+    m_Regs[RegId] = Val;
+  return Val;
+}
+
+void IrBuilder::_SetRegister(u32 RegId, u32 Val)
+{
+  auto pCpuInfo = m_rBlock.GetCpuInformation();
+  for (auto itReg = std::begin(m_Regs); itReg != std::end(m_Regs);)
+  {
+    if (pCpuInfo->IsRegisterAliased(itReg->first, RegId))
+      itReg = m_Regs.erase(itReg);
+    else
+      ++itReg;
+  }
+  m_Regs[RegId] = Val;
+
+  if (m_PredVal == IrInstruction::NoValue)
+    m_rBlock.EmitWriteReg(RegId, Val);
+  else
+    m_PredRegs.insert(RegId);
+}
+
+MEDUSA_NAMESPACE_END
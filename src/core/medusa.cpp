@@ -4,11 +4,13 @@
 #include "medusa/xref.hpp"
 #include "medusa/log.hpp"
 #include "medusa/user_configuration.hpp"
+#include "medusa/analysis_cache.hpp"
 
 #include <cstring>
 #include <cstdlib>
 #include <list>
 #include <algorithm>
+#include <future>
 #include <boost/filesystem/operations.hpp>
 #include <boost/format.hpp>
 
@@ -96,14 +98,21 @@ bool Medusa::Start(
   if (!StartAnalyzer)
     return true;
 
+  _StartAnalyzer(spDatabase, spOperatingSystem);
+  return true;
+}
+
+void Medusa::_StartAnalyzer(Database::SPType spDatabase, OperatingSystem::SPType spOperatingSystem)
+{
   /* Disassemble the file with the default analyzer */
   AddTask(m_Analyzer.CreateTask("disassemble all functions", m_Document));
 
   /* Analyze the stack for each functions */
   //AddTask(m_Analyzer.CreateAnalyzeStackAllFunctionsTask(m_Document));
 
-  /* Find all strings using the previous analyze */
-  AddTask(m_Analyzer.CreateTask("find all strings", m_Document));
+  /* Find all strings, either by scanning memory areas or by using the previous analyze */
+  UserConfiguration UserCfg;
+  AddTask(m_Analyzer.CreateTask(UserCfg.GetOption("core.string_analysis") == "labels" ? "find all strings" : "scan all strings", m_Document));
 
   /* Analyze all functions */
   if (spOperatingSystem)
@@ -117,8 +126,6 @@ bool Medusa::Start(
       spOperatingSystem->AnalyzeFunction(m_Document, rAddr);
     });
   }
-
-  return true;
 }
 
 bool Medusa::IgnoreDatabasePath(
@@ -169,6 +176,16 @@ bool Medusa::NewDocument(
       ModPath = ".";
     rModMgr.LoadModules(ModPath, *spBinStrm);
 
+    /* Hash the file while modules are selected and the file is mapped */
+    AnalysisCache Cache(UserCfg.GetOption("core.cache_path"));
+    bool UseCache = StartAnalyzer && Cache.IsEnabled();
+    std::future<std::string> FileKey;
+    if (UseCache)
+      FileKey = std::async(std::launch::async, [spBinStrm]()
+      {
+        return AnalysisCache::ComputeKey(*spBinStrm, 0, spBinStrm->GetSize());
+      });
+
     auto const& AllLdrs = rModMgr.GetLoaders();
     if (AllLdrs.empty())
     {
@@ -227,8 +244,21 @@ bool Medusa::NewDocument(
 
     if (!BeforeStart())
       return false;
-    if (!Start(spBinStrm, spCurDb, spCurLdr, spCurArchs, spCurOs, StartAnalyzer))
+    if (!Start(spBinStrm, spCurDb, spCurLdr, spCurArchs, spCurOs, StartAnalyzer && !UseCache))
       return false;
+
+    /* Analyze the file only if the cache doesn't already know it */
+    if (UseCache)
+    {
+      bool Complete = false;
+      Cache.Load(m_Document, FileKey.get(), Complete);
+      if (!Complete)
+      {
+        _StartAnalyzer(spCurDb, spCurOs);
+        AddTask(m_Analyzer.CreateTask("store analysis cache", m_Document));
+      }
+    }
+
     if (!AfterStart())
       return false;
 
@@ -0,0 +1,571 @@
+#include "medusa/string_scanner.hpp"
+#include "medusa/document.hpp"
+#include "medusa/string.hpp"
+#include "medusa/log.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <thread>
+#include <unordered_map>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+# include <emmintrin.h>
+# define MEDUSA_STRING_SCANNER_USE_SSE2
+#endif
+
+#if defined(MEDUSA_STRING_SCANNER_USE_SSE2) && defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+# include <immintrin.h>
+# define MEDUSA_STRING_SCANNER_USE_AVX2
+#endif
+
+#ifdef _MSC_VER
+# include <intrin.h>
+#endif
+
+MEDUSA_NAMESPACE_BEGIN
+
+// Each bit describes one byte of the scanned window, 64 bytes per word
+struct StringScanner::Classification
+{
+  std::vector<u64> m_Printable; // ascii printable, tab, line feed or carriage return
+  std::vector<u64> m_Zero;
+  std::vector<u64> m_High;      // byte >= 0x80, may be part of an utf-8 sequence
+};
+
+namespace
+{
+  u64 const s_ChunkSize = 0x100000; // must be a multiple of 64
+
+  inline u32 CountTrailingZeros(u64 Word)
+  {
+#ifdef _MSC_VER
+    unsigned long Idx;
+    _BitScanForward64(&Idx, Word);
+    return static_cast<u32>(Idx);
+#else
+    return static_cast<u32>(__builtin_ctzll(Word));
+#endif
+  }
+
+  inline bool TestBit(std::vector<u64> const& rBits, u64 Pos)
+  {
+    return ((rBits[Pos / 64] >> (Pos % 64)) & 1) != 0;
+  }
+
+  inline u64 WordAt(std::vector<u64> const& rBits, u64 Idx)
+  {
+    return Idx < rBits.size() ? rBits[Idx] : 0;
+  }
+
+  // Returns the first position in [Pos, End) whose bit is set in the word returned by rWordAt
+  template<typename WordFunction>
+  u64 FindSetBit(WordFunction const& rWordAt, u64 Pos, u64 End)
+  {
+    while (Pos < End)
+    {
+      u64 Idx = Pos / 64;
+      u64 Word = rWordAt(Idx) >> (Pos % 64);
+      if (Word != 0)
+        return std::min(Pos + CountTrailingZeros(Word), End);
+      Pos = (Idx + 1) * 64;
+    }
+    return End;
+  }
+
+  inline bool IsPrintable(u8 Byte)
+  {
+    return (Byte >= 0x20 && Byte < 0x7f) || Byte == '\t' || Byte == '\n' || Byte == '\r';
+  }
+
+  void ClassifyScalar(u8 const* pData, u64 Begin, u64 End, StringScanner::Classification& rCls)
+  {
+    for (u64 Pos = Begin; Pos < End; ++Pos)
+    {
+      u64 Bit = 1ULL << (Pos % 64);
+      u8 Byte = pData[Pos];
+      if (IsPrintable(Byte))
+        rCls.m_Printable[Pos / 64] |= Bit;
+      if (Byte == 0x00)
+        rCls.m_Zero[Pos / 64] |= Bit;
+      if (Byte >= 0x80)
+        rCls.m_High[Pos / 64] |= Bit;
+    }
+  }
+
+#ifdef MEDUSA_STRING_SCANNER_USE_SSE2
+  // Classifies whole 64-byte blocks and returns the number of classified bytes
+  u64 ClassifySse2(u8 const* pData, u64 Length, StringScanner::Classification& rCls)
+  {
+    __m128i const Space   = _mm_set1_epi8(0x1f);
+    __m128i const Delete  = _mm_set1_epi8(0x7f);
+    __m128i const Tab     = _mm_set1_epi8('\t');
+    __m128i const LnFeed  = _mm_set1_epi8('\n');
+    __m128i const CarRet  = _mm_set1_epi8('\r');
+    __m128i const NulChar = _mm_setzero_si128();
+
+    u64 Block = 0;
+    for (; Block + 64 <= Length; Block += 64)
+    {
+      u64 Printable = 0, Zero = 0, High = 0;
+      for (u32 Part = 0; Part < 4; ++Part)
+      {
+        __m128i Bytes = _mm_loadu_si128(reinterpret_cast<__m128i const*>(pData + Block + Part * 16));
+        // Signed comparison: bytes >= 0x80 are negative and so not printable
+        __m128i Prt = _mm_andnot_si128(_mm_cmpeq_epi8(Bytes, Delete), _mm_cmpgt_epi8(Bytes, Space));
+        Prt = _mm_or_si128(Prt, _mm_cmpeq_epi8(Bytes, Tab));
+        Prt = _mm_or_si128(Prt, _mm_cmpeq_epi8(Bytes, LnFeed));
+        Prt = _mm_or_si128(Prt, _mm_cmpeq_epi8(Bytes, CarRet));
+        Printable |= static_cast<u64>(static_cast<u16>(_mm_movemask_epi8(Prt))) << (Part * 16);
+        Zero      |= static_cast<u64>(static_cast<u16>(_mm_movemask_epi8(_mm_cmpeq_epi8(Bytes, NulChar)))) << (Part * 16);
+        High      |= static_cast<u64>(static_cast<u16>(_mm_movemask_epi8(Bytes))) << (Part * 16);
+      }
+      rCls.m_Printable[Block / 64] = Printable;
+      rCls.m_Zero[Block / 64]      = Zero;
+      rCls.m_High[Block / 64]      = High;
+    }
+    return Block;
+  }
+#endif
+
+#ifdef MEDUSA_STRING_SCANNER_USE_AVX2
+  __attribute__((target("avx2")))
+  u64 ClassifyAvx2(u8 const* pData, u64 Length, StringScanner::Classification& rCls)
+  {
+    __m256i const Space   = _mm256_set1_epi8(0x1f);
+    __m256i const Delete  = _mm256_set1_epi8(0x7f);
+    __m256i const Tab     = _mm256_set1_epi8('\t');
+    __m256i const LnFeed  = _mm256_set1_epi8('\n');
+    __m256i const CarRet  = _mm256_set1_epi8('\r');
+    __m256i const NulChar = _mm256_setzero_si256();
+
+    u64 Block = 0;
+    for (; Block + 64 <= Length; Block += 64)
+    {
+      u64 Printable = 0, Zero = 0, High = 0;
+      for (u32 Part = 0; Part < 2; ++Part)
+      {
+        __m256i Bytes = _mm256_loadu_si256(reinterpret_cast<__m256i const*>(pData + Block + Part * 32));
+        __m256i Prt = _mm256_andnot_si256(_mm256_cmpeq_epi8(Bytes, Delete), _mm256_cmpgt_epi8(Bytes, Space));
+        Prt = _mm256_or_si256(Prt, _mm256_cmpeq_epi8(Bytes, Tab));
+        Prt = _mm256_or_si256(Prt, _mm256_cmpeq_epi8(Bytes, LnFeed));
+        Prt = _mm256_or_si256(Prt, _mm256_cmpeq_epi8(Bytes, CarRet));
+        Printable |= static_cast<u64>(static_cast<u32>(_mm256_movemask_epi8(Prt))) << (Part * 32);
+        Zero      |= static_cast<u64>(static_cast<u32>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(Bytes, NulChar)))) << (Part * 32);
+        High      |= static_cast<u64>(static_cast<u32>(_mm256_movemask_epi8(Bytes))) << (Part * 32);
+      }
+      rCls.m_Printable[Block / 64] = Printable;
+      rCls.m_Zero[Block / 64]      = Zero;
+      rCls.m_High[Block / 64]      = High;
+    }
+    return Block;
+  }
+
+  bool HasAvx2(void)
+  {
+    static bool const s_HasAvx2 = __builtin_cpu_supports("avx2") != 0;
+    return s_HasAvx2;
+  }
+#endif
+
+  void Classify(u8 const* pData, u64 Length, StringScanner::Classification& rCls)
+  {
+    auto const WordCount = static_cast<size_t>((Length + 63) / 64);
+    rCls.m_Printable.assign(WordCount, 0);
+    rCls.m_Zero.assign(WordCount, 0);
+    rCls.m_High.assign(WordCount, 0);
+
+    u64 Done = 0;
+#if defined(MEDUSA_STRING_SCANNER_USE_AVX2)
+    if (HasAvx2())
+      Done = ClassifyAvx2(pData, Length, rCls);
+    else
+      Done = ClassifySse2(pData, Length, rCls);
+#elif defined(MEDUSA_STRING_SCANNER_USE_SSE2)
+    Done = ClassifySse2(pData, Length, rCls);
+#endif
+    ClassifyScalar(pData, Done, Length, rCls);
+  }
+
+  // Returns the length of the valid utf-8 multibyte sequence at pData, or 0 if it's invalid
+  u32 Utf8SequenceLength(u8 const* pData, u64 Limit)
+  {
+    u8 Lead = pData[0];
+    u32 Len;
+    u8 Min = 0x80, Max = 0xbf;
+
+    if      (Lead >= 0xc2 && Lead <= 0xdf) Len = 2;
+    else if (Lead >= 0xe0 && Lead <= 0xef) Len = 3;
+    else if (Lead >= 0xf0 && Lead <= 0xf4) Len = 4;
+    else return 0;
+
+    // Reject overlong forms, surrogates and code points above U+10FFFF
+    if      (Lead == 0xe0) Min = 0xa0;
+    else if (Lead == 0xed) Max = 0x9f;
+    else if (Lead == 0xf0) Min = 0x90;
+    else if (Lead == 0xf4) Max = 0x8f;
+
+    if (Len > Limit)
+      return 0;
+    if (pData[1] < Min || pData[1] > Max)
+      return 0;
+    for (u32 Idx = 2; Idx < Len; ++Idx)
+      if (pData[Idx] < 0x80 || pData[Idx] > 0xbf)
+        return 0;
+    return Len;
+  }
+}
+
+StringScanner::StringScanner(u32 MinLength, u8 Encodings, bool TerminatedOnly)
+  : m_MinLength(MinLength)
+  , m_Encodings(Encodings)
+  , m_TerminatedOnly(TerminatedOnly)
+  , m_ThreadCount(0)
+{
+}
+
+StringScanner::CandidateVector StringScanner::Scan(BinaryStream const& rBinStrm, OffsetType Offset, u64 Length) const
+{
+  CandidateVector Candidates;
+
+  if (Offset >= rBinStrm.GetSize())
+    return Candidates;
+  Length = std::min(Length, rBinStrm.GetSize() - Offset);
+  if (Length == 0)
+    return Candidates;
+
+  auto const ChunkCount = static_cast<size_t>((Length + s_ChunkSize - 1) / s_ChunkSize);
+  std::vector<CandidateVector> ChunkCandidates(ChunkCount);
+  std::atomic<size_t> NextChunk(0);
+
+  auto Worker = [&]()
+  {
+    std::vector<u8> Buffer;
+    for (;;)
+    {
+      size_t ChunkIdx = NextChunk++;
+      if (ChunkIdx >= ChunkCount)
+        break;
+
+      // The window starts a bit earlier to know if a string began in the previous chunk,
+      // and ends later to let strings starting in this chunk go beyond it
+      OffsetType ChunkOff  = Offset + ChunkIdx * s_ChunkSize;
+      u64        ChunkLen  = std::min(s_ChunkSize, Offset + Length - ChunkOff);
+      OffsetType WindowOff = ChunkIdx == 0 ? ChunkOff : ChunkOff - 64;
+      u64        WindowLen = std::min(ChunkOff + ChunkLen + MaxRawLength + 2, Offset + Length) - WindowOff;
+
+      auto pWindow = rBinStrm.View<u8>(WindowOff, static_cast<size_t>(WindowLen));
+      if (pWindow == nullptr)
+      {
+        Buffer.resize(static_cast<size_t>(WindowLen));
+        if (!rBinStrm.Read(WindowOff, Buffer.data(), Buffer.size()))
+        {
+          Log::Write("core").Level(LogWarning) << "unable to read chunk at offset " << WindowOff << LogEnd;
+          continue;
+        }
+        pWindow = Buffer.data();
+      }
+
+      _ScanChunk(pWindow, WindowOff, WindowLen, ChunkOff, ChunkLen, ChunkCandidates[ChunkIdx]);
+    }
+  };
+
+  u32 ThreadCount = m_ThreadCount != 0 ? m_ThreadCount : std::thread::hardware_concurrency();
+  ThreadCount = std::max<u32>(1, std::min<u32>(ThreadCount, static_cast<u32>(ChunkCount)));
+
+  if (ThreadCount == 1)
+    Worker();
+  else
+  {
+    std::vector<std::thread> Threads;
+    Threads.reserve(ThreadCount);
+    for (u32 Idx = 0; Idx < ThreadCount; ++Idx)
+      Threads.emplace_back(Worker);
+    for (auto& rThread : Threads)
+      rThread.join();
+  }
+
+  // Chunks are already ordered, so only their content needs to be sorted
+  for (auto& rChunkCandidates : ChunkCandidates)
+  {
+    std::stable_sort(std::begin(rChunkCandidates), std::end(rChunkCandidates),
+      [](Candidate const& rLhs, Candidate const& rRhs)
+    { return rLhs.m_Offset < rRhs.m_Offset; });
+    std::move(std::begin(rChunkCandidates), std::end(rChunkCandidates), std::back_inserter(Candidates));
+  }
+
+  return Candidates;
+}
+
+void StringScanner::_ScanChunk(u8 const* pWindow, OffsetType WindowOffset, u64 WindowLength,
+  OffsetType ChunkOffset, u64 ChunkLength, CandidateVector& rCandidates) const
+{
+  Classification Cls;
+  Classify(pWindow, WindowLength, Cls);
+
+  u64 ChunkBegin = ChunkOffset - WindowOffset;
+  u64 ChunkEnd   = ChunkBegin + ChunkLength;
+
+  if (m_Encodings & (AsciiEncoding | Utf8Encoding))
+    _ScanBytes(Cls, pWindow, WindowOffset, WindowLength, ChunkBegin, ChunkEnd, rCandidates);
+  if (m_Encodings & Utf16LeEncoding)
+    _ScanWords(Cls, pWindow, WindowOffset, WindowLength, ChunkBegin, ChunkEnd, false, rCandidates);
+  if (m_Encodings & Utf16BeEncoding)
+    _ScanWords(Cls, pWindow, WindowOffset, WindowLength, ChunkBegin, ChunkEnd, true, rCandidates);
+
+  if ((m_Encodings & Utf16LeEncoding) && (m_Encodings & Utf16BeEncoding))
+  {
+    // The same bytes can be read as a BE string at p and a LE string at p + 1,
+    // LE is preferred unless only the BE string is terminated
+    std::unordered_map<OffsetType, size_t> LeStrings;
+    for (size_t Idx = 0; Idx < rCandidates.size(); ++Idx)
+      if (rCandidates[Idx].m_Encoding == Utf16LeEncoding)
+        LeStrings[rCandidates[Idx].m_Offset] = Idx;
+
+    for (auto& rBeStr : rCandidates)
+    {
+      if (rBeStr.m_Encoding != Utf16BeEncoding)
+        continue;
+      auto itLeStr = LeStrings.find(rBeStr.m_Offset + 1);
+      if (itLeStr == std::end(LeStrings))
+        continue;
+      auto& rLeStr = rCandidates[itLeStr->second];
+      if (rLeStr.m_RawLength != rBeStr.m_RawLength)
+        continue;
+      if (rBeStr.m_Terminated && !rLeStr.m_Terminated)
+        rLeStr.m_RawLength = 0;
+      else
+        rBeStr.m_RawLength = 0;
+    }
+
+    rCandidates.erase(std::remove_if(std::begin(rCandidates), std::end(rCandidates),
+      [](Candidate const& rCandidate) { return rCandidate.m_RawLength == 0; }),
+      std::end(rCandidates));
+  }
+}
+
+void StringScanner::_ScanBytes(Classification const& rCls, u8 const* pWindow, OffsetType WindowOffset, u64 WindowLength,
+  u64 ChunkBegin, u64 ChunkEnd, CandidateVector& rCandidates) const
+{
+  bool const AllowUtf8 = (m_Encodings & Utf8Encoding) != 0;
+
+  auto ValidAt = [&](u64 Idx) -> u64
+  {
+    u64 Word = WordAt(rCls.m_Printable, Idx);
+    if (AllowUtf8)
+      Word |= WordAt(rCls.m_High, Idx);
+    return Word;
+  };
+  auto InvalidAt = [&](u64 Idx) -> u64 { return ~ValidAt(Idx); };
+  auto IsValid   = [&](u64 Pos) { return ((ValidAt(Pos / 64) >> (Pos % 64)) & 1) != 0; };
+
+  auto Emit = [&](u64 Begin, u64 End, bool HasMultiByte, bool Terminated)
+  {
+    u8 Enc = HasMultiByte ? Utf8Encoding : AsciiEncoding;
+    if (!(m_Encodings & Enc))
+      return;
+    if (m_TerminatedOnly && !Terminated)
+      return;
+
+    u32 CharCount = 0;
+    for (u64 Pos = Begin; Pos < End; ++Pos)
+      if ((pWindow[Pos] & 0xc0) != 0x80)
+        ++CharCount;
+    if (CharCount == 0 || CharCount < m_MinLength)
+      return;
+
+    Candidate NewCandidate;
+    NewCandidate.m_Offset     = WindowOffset + Begin;
+    NewCandidate.m_RawLength  = static_cast<u32>(End - Begin);
+    NewCandidate.m_Encoding   = Enc;
+    NewCandidate.m_Terminated = Terminated;
+    NewCandidate.m_Value.assign(reinterpret_cast<char const*>(pWindow + Begin), static_cast<size_t>(End - Begin));
+    rCandidates.push_back(std::move(NewCandidate));
+  };
+
+  // Skip the string which started in the previous chunk
+  u64 Pos = ChunkBegin;
+  if (Pos != 0 && IsValid(Pos - 1))
+    Pos = FindSetBit(InvalidAt, Pos, WindowLength);
+
+  while (Pos < ChunkEnd)
+  {
+    u64 Begin = FindSetBit(ValidAt, Pos, ChunkEnd);
+    if (Begin >= ChunkEnd)
+      break;
+    u64 RunEnd = FindSetBit(InvalidAt, Begin, WindowLength);
+    u64 End = std::min(RunEnd, Begin + MaxRawLength - 1);
+    Pos = RunEnd;
+
+    // Split the run on invalid utf-8 sequences
+    u64 SegBegin = Begin;
+    bool HasMultiByte = false;
+    for (u64 Cur = Begin; Cur < End;)
+    {
+      if (pWindow[Cur] < 0x80)
+      {
+        ++Cur;
+        continue;
+      }
+
+      u32 SeqLen = Utf8SequenceLength(pWindow + Cur, End - Cur);
+      if (SeqLen == 0)
+      {
+        Emit(SegBegin, Cur, HasMultiByte, false);
+        SegBegin = ++Cur;
+        HasMultiByte = false;
+        continue;
+      }
+      Cur += SeqLen;
+      HasMultiByte = true;
+    }
+
+    bool Terminated = End == RunEnd && End < WindowLength && TestBit(rCls.m_Zero, End);
+    Emit(SegBegin, End, HasMultiByte, Terminated);
+  }
+}
+
+void StringScanner::_ScanWords(Classification const& rCls, u8 const* pWindow, OffsetType WindowOffset, u64 WindowLength,
+  u64 ChunkBegin, u64 ChunkEnd, bool BigEndian, CandidateVector& rCandidates) const
+{
+  // A character at position p is valid if its low byte is printable and its high byte is null
+  auto const& rLowBits  = BigEndian ? rCls.m_Zero      : rCls.m_Printable;
+  auto const& rHighBits = BigEndian ? rCls.m_Printable : rCls.m_Zero;
+  auto CharAt = [&](u64 Idx) -> u64
+  {
+    u64 Next = (WordAt(rHighBits, Idx) >> 1) | (WordAt(rHighBits, Idx + 1) << 63);
+    return WordAt(rLowBits, Idx) & Next;
+  };
+
+  for (u64 Parity = 0; Parity < 2; ++Parity)
+  {
+    u64 const ParityMask = Parity == 0 ? 0x5555555555555555ULL : 0xaaaaaaaaaaaaaaaaULL;
+    auto ValidAt   = [&](u64 Idx) -> u64 { return  CharAt(Idx) & ParityMask; };
+    auto InvalidAt = [&](u64 Idx) -> u64 { return ~CharAt(Idx) & ParityMask; };
+
+    u64 Pos = ChunkBegin + ((ChunkBegin & 1) != Parity ? 1 : 0);
+    if (Pos >= 2 && ((ValidAt((Pos - 2) / 64) >> ((Pos - 2) % 64)) & 1) != 0)
+      Pos = FindSetBit(InvalidAt, Pos, WindowLength);
+
+    while (Pos < ChunkEnd)
+    {
+      u64 Begin = FindSetBit(ValidAt, Pos, ChunkEnd);
+      if (Begin >= ChunkEnd)
+        break;
+      u64 RunEnd = FindSetBit(InvalidAt, Begin, WindowLength);
+      u64 End = std::min<u64>(RunEnd, Begin + ((MaxRawLength - 2) & ~1ULL));
+      Pos = RunEnd;
+
+      u64 CharCount = (End - Begin) / 2;
+      bool Terminated = End == RunEnd && End + 1 < WindowLength
+        && TestBit(rCls.m_Zero, End) && TestBit(rCls.m_Zero, End + 1);
+      if (CharCount == 0 || CharCount < m_MinLength)
+        continue;
+      if (m_TerminatedOnly && !Terminated)
+        continue;
+
+      Candidate NewCandidate;
+      NewCandidate.m_Offset     = WindowOffset + Begin;
+      NewCandidate.m_RawLength  = static_cast<u32>(End - Begin);
+      NewCandidate.m_Encoding   = BigEndian ? Utf16BeEncoding : Utf16LeEncoding;
+      NewCandidate.m_Terminated = Terminated;
+      NewCandidate.m_Value.reserve(static_cast<size_t>(CharCount));
+      for (u64 Cur = Begin; Cur < End; Cur += 2)
+        NewCandidate.m_Value += static_cast<char>(pWindow[Cur + (BigEndian ? 1 : 0)]);
+      rCandidates.push_back(std::move(NewCandidate));
+    }
+  }
+}
+
+u32 StringScanner::CreateStrings(Document& rDoc) const
+{
+  struct Region
+  {
+    OffsetType m_FileOffset;
+    u32        m_FileSize;
+    Address    m_BaseAddress;
+  };
+  std::vector<Region> Regions;
+
+  rDoc.ForEachMemoryArea([&](MemoryArea const& rMemArea)
+  {
+    if (rMemArea.GetFileSize() == 0)
+      return;
+    if (!to_bool(rMemArea.GetAccess() & MemoryArea::Access::Read))
+      return;
+    Regions.push_back({ rMemArea.GetFileOffset(), rMemArea.GetFileSize(), rMemArea.GetBaseAddress() });
+  });
+
+  // Strings are forced, so they must not overwrite any instruction, even one which starts before them.
+  // Instructions of a region are gathered in one cell walk as sorted [begin, end) offsets.
+  typedef std::pair<u64, u64> CodeRangeType;
+  auto GetCodeRanges = [&](Region const& rRegion)
+  {
+    std::vector<CodeRangeType> CodeRanges;
+    Address CurAddr = rRegion.m_BaseAddress;
+    do
+    {
+      if (CurAddr.GetBase() != rRegion.m_BaseAddress.GetBase() || CurAddr.GetOffset() < rRegion.m_BaseAddress.GetOffset())
+        break;
+      u64 RelOff = CurAddr.GetOffset() - rRegion.m_BaseAddress.GetOffset();
+      if (RelOff >= rRegion.m_FileSize)
+        break;
+      CellData CurCellData;
+      if (rDoc.GetCellData(CurAddr, CurCellData) && CurCellData.GetType() == Cell::InstructionType)
+        CodeRanges.push_back(CodeRangeType(RelOff, RelOff + std::max<u64>(CurCellData.GetSize(), 1)));
+    } while (rDoc.GetNextAddress(CurAddr, CurAddr));
+    return CodeRanges;
+  };
+  auto OverlapsCode = [](std::vector<CodeRangeType> const& rCodeRanges, u64 RelOff, u32 CellLen)
+  {
+    auto itRange = std::upper_bound(std::begin(rCodeRanges), std::end(rCodeRanges), RelOff,
+      [](u64 Off, CodeRangeType const& rRange) { return Off < rRange.second; });
+    return itRange != std::end(rCodeRanges) && itRange->first < RelOff + CellLen;
+  };
+
+  u32 StringCount = 0;
+  auto const& rBinStrm = rDoc.GetBinaryStream();
+  for (auto const& rRegion : Regions)
+  {
+    auto Candidates = Scan(rBinStrm, rRegion.m_FileOffset, rRegion.m_FileSize);
+    if (Candidates.empty())
+      continue;
+    auto CodeRanges = GetCodeRanges(rRegion);
+
+    std::vector<Document::CellWithLabel> NewStrings;
+    NewStrings.reserve(Candidates.size());
+    for (auto const& rCandidate : Candidates)
+    {
+      u8 SubType;
+      u32 CharSize;
+      switch (rCandidate.m_Encoding)
+      {
+      case AsciiEncoding:
+      case Utf8Encoding:    SubType = String::Utf8Type;  CharSize = 1; break;
+      case Utf16LeEncoding: SubType = String::Utf16Type; CharSize = 2; break;
+      default:              continue;
+      }
+
+      u32 CellLen = rCandidate.m_RawLength + (rCandidate.m_Terminated ? CharSize : 0);
+      if (CellLen > MaxRawLength)
+        continue;
+
+      u64 RelOff = rCandidate.m_Offset - rRegion.m_FileOffset;
+      if (OverlapsCode(CodeRanges, RelOff, CellLen))
+        continue;
+      Address StrAddr = rRegion.m_BaseAddress + RelOff;
+      if (rDoc.GetCellType(StrAddr) == Cell::StringType)
+        continue;
+
+      NewStrings.push_back(std::make_tuple(
+        StrAddr,
+        std::make_shared<String>(SubType, static_cast<u16>(CellLen)),
+        Label(rCandidate.m_Value, Label::String | Label::Global)));
+    }
+
+    StringCount += rDoc.SetCellsWithLabels(NewStrings, true);
+  }
+
+  return StringCount;
+}
+
+MEDUSA_NAMESPACE_END
@@ -178,17 +178,17 @@ Expression::LSPType Symbolic::Context::BacktrackRegister(Address const& RegAddr,
   TrackedIdPropagation TrkIdProp(Exprs, RegId);
   TrkIdProp.Execute();
 
-  for (auto spExpr : Exprs)
+  for (auto& rspExpr : Exprs)
   {
-    std::string s0 = spExpr->ToString();
+    std::string s0 = rspExpr->ToString();
     Log::Write("core").Level(LogDebug) << "expr: " << s0 << LogEnd;
-    NormalizeExpression NormExpr(spExpr);
+    NormalizeExpression NormExpr(rspExpr);
     NormExpr.Execute();
-    std::string s1 = spExpr->ToString();
+    std::string s1 = rspExpr->ToString();
     Log::Write("dbg").Level(LogDebug) << "after ne: " << s1 << LogEnd;
-    ConstantPropagation ConstProp(spExpr);
+    ConstantPropagation ConstProp(rspExpr);
     ConstProp.Execute();
-    std::string s2 = spExpr->ToString();
+    std::string s2 = rspExpr->ToString();
     Log::Write("dbg").Level(LogDebug) << "after cp: " << s2 << LogEnd;
   }
 
@@ -11,35 +11,53 @@ std::string BitVector::ToString(u16 Base) const
   case 16: Out << "0x" << std::setw(m_BitSize / 8 * 2) << std::hex; break;
   default: break;
   }
-  Out << std::setfill('0') << GetUnsignedValue();
+  Out << std::setfill('0');
+  if (_IsSmall())
+    Out << m_SmallValue;
+  else
+    Out << GetUnsignedValue();
   return Out.str();
 }
 
 void BitVector::SignExtend(u16 NewBitSize)
 {
+  if (m_BitSize == 0)
+  {
+    _Resize(NewBitSize);
+    return;
+  }
+
+  if (_IsSmall() && NewBitSize <= 64)
+  {
+    m_SmallValue = static_cast<u64>(_GetSmallSignedValue()) & _MakeMask(NewBitSize);
+    m_BitSize = NewBitSize;
+    return;
+  }
+
   u16 Pos = m_BitSize - 1;
 
   if (!((GetUnsignedValue() >> Pos) & 1))
   {
-    m_BitSize = NewBitSize;
+    _Resize(NewBitSize);
     return;
   }
   ap_int InsertedBits = ((ap_int(1) << NewBitSize) - 1) - ((ap_int(1) << Pos) - 1);
-  m_Value |= InsertedBits;
+  ap_int Value = _GetValue() | InsertedBits;
   m_BitSize = NewBitSize;
+  m_SmallValue = 0;
+  m_Value = 0;
+  _SetValue(Value);
 }
 
 void BitVector::ZeroExtend(u16 NewBitSize)
 {
   //assert(NewBitSize > m_BitSize);
-  m_BitSize = NewBitSize;
+  _Resize(NewBitSize);
 }
 
 void BitVector::BitCast(u16 NewBitSize)
 {
-  m_BitSize = NewBitSize;
-  ap_int Mask = (ap_int(1) << m_BitSize) - 1;
-  m_Value &= Mask;
+  _Resize(NewBitSize);
 }
 
 ap_int BitVector::GetSignedValue(void) const
@@ -47,6 +65,9 @@ ap_int BitVector::GetSignedValue(void) const
   if (m_BitSize == 0)
     return 0;
 
+  if (_IsSmall())
+    return _GetSmallSignedValue();
+
   // If the value is positive, we don't need to do anything
   if (!((GetUnsignedValue() >> (m_BitSize - 1)) & 1))
     return m_Value;
@@ -61,6 +82,9 @@ ap_uint BitVector::GetUnsignedValue(void) const
   if (m_BitSize == 0)
     return 0;
 
+  if (_IsSmall())
+    return m_SmallValue;
+
   // If the value is positive, we don't need to do anything
   if (!m_Value.backend().sign())
     return m_Value;
@@ -71,22 +95,44 @@ ap_uint BitVector::GetUnsignedValue(void) const
   return NegValue;
 }
 
+int BitVector::UCmp(BitVector const& rVal) const
+{
+  if (_IsSmall() && rVal._IsSmall())
+    return m_SmallValue < rVal.m_SmallValue ? -1 : (m_SmallValue > rVal.m_SmallValue ? 1 : 0);
+  return GetUnsignedValue().compare(rVal.GetUnsignedValue());
+}
+
+int BitVector::SCmp(BitVector const& rVal) const
+{
+  if (_IsSmall() && rVal._IsSmall())
+  {
+    s64 Left = _GetSmallSignedValue(), Right = rVal._GetSmallSignedValue();
+    return Left < Right ? -1 : (Left > Right ? 1 : 0);
+  }
+  return GetSignedValue().compare(rVal.GetSignedValue());
+}
+
 BitVector BitVector::Not(void) const
 {
-  BitVector Tmp(m_BitSize, ~m_Value);
-  Tmp._Adjust();
-  return Tmp;
+  if (_IsSmall())
+    return BitVector(m_BitSize, ~m_SmallValue);
+  return BitVector(m_BitSize, ~m_Value);
 }
 
 BitVector BitVector::Neg(void) const
 {
-  BitVector Tmp(m_BitSize, -m_Value);
-  Tmp._Adjust();
-  return Tmp;
+  if (_IsSmall())
+    return BitVector(m_BitSize, ~m_SmallValue + 1);
+  return BitVector(m_BitSize, -m_Value);
 }
 
 BitVector& BitVector::PreInc(void)
 {
+  if (_IsSmall())
+  {
+    m_SmallValue = (m_SmallValue + 1) & _MakeMask(m_BitSize);
+    return *this;
+  }
   ++m_Value;
   _Adjust();
   return *this;
@@ -94,13 +140,17 @@ BitVector& BitVector::PreInc(void)
 
 BitVector BitVector::PostInc(void)
 {
-  BitVector Tmp(m_BitSize, m_Value + 1);
-  Tmp._Adjust();
-  return Tmp;
+  BitVector Tmp(*this);
+  return Tmp.PreInc();
 }
 
 BitVector& BitVector::PreDec(void)
 {
+  if (_IsSmall())
+  {
+    m_SmallValue = (m_SmallValue - 1) & _MakeMask(m_BitSize);
+    return *this;
+  }
   --m_Value;
   _Adjust();
   return *this;
@@ -108,9 +158,8 @@ BitVector& BitVector::PreDec(void)
 
 BitVector BitVector::PostDec(void)
 {
-  BitVector Tmp(m_BitSize, m_Value - 1);
-  Tmp._Adjust();
-  return Tmp;
+  BitVector Tmp(*this);
+  return Tmp.PreDec();
 }
 
 BitVector BitVector::Bsf(void) const
@@ -120,8 +169,19 @@ BitVector BitVector::Bsf(void) const
 
 BitVector BitVector::Lsb(void) const
 {
-  if (m_Value.is_zero())
+  if (IsZero())
     return BitVector(m_BitSize, 0);
+  if (_IsSmall())
+  {
+    u64 Value = m_SmallValue;
+    u16 Idx = 0;
+    while (!(Value & 1))
+    {
+      Value >>= 1;
+      ++Idx;
+    }
+    return BitVector(m_BitSize, Idx);
+  }
   return BitVector(m_BitSize, boost::multiprecision::lsb(m_Value));
 }
 
@@ -132,9 +192,17 @@ BitVector BitVector::Bsr(void) const
 
 BitVector BitVector::Msb(void) const
 {
-  if (m_Value.is_zero())
+  if (IsZero())
     // Avoid "No bits were set in the operand."
     return BitVector(m_BitSize, 0);
+  if (_IsSmall())
+  {
+    u64 Value = m_SmallValue;
+    u16 Idx = 0;
+    while (Value >>= 1)
+      ++Idx;
+    return BitVector(m_BitSize, Idx);
+  }
   if (m_Value.backend().sign())
     // HACK(KS): to avoid "Testing individual bits in negative values is not supported - results are undefined."
     return BitVector(m_BitSize, boost::multiprecision::msb(boost::multiprecision::abs(m_Value)));
@@ -175,189 +243,200 @@ BitVector BitVector::Swap(void) const
   }
 }
 
+// Both operands fit in a u64, the result is computed with the builtin operator
+#define MEDUSA_BV_SMALL_OP(Op)                                                   \
+  if (_IsSmall() && rVal._IsSmall())                                             \
+    return BitVector(m_BitSize, m_SmallValue Op rVal.m_SmallValue)
+
+#define MEDUSA_BV_SMALL_OP_ASSIGN(Op)                                            \
+  if (_IsSmall() && rVal._IsSmall())                                             \
+  {                                                                              \
+    m_SmallValue = (m_SmallValue Op rVal.m_SmallValue) & _MakeMask(m_BitSize);   \
+    return *this;                                                                \
+  }
+
 BitVector BitVector::Add(BitVector const& rVal) const
 {
   //assert(m_BitSize == rVal.GetBitSize());
-  BitVector Tmp(m_BitSize, m_Value + rVal.m_Value);
-  Tmp._Adjust();
-  return Tmp;
+  MEDUSA_BV_SMALL_OP(+);
+  return BitVector(m_BitSize, _GetValue() + rVal._GetValue());
 }
 
 BitVector& BitVector::AddAssign(BitVector const& rVal)
 {
-  m_Value += rVal.m_Value;
-  _Adjust();
+  MEDUSA_BV_SMALL_OP_ASSIGN(+);
+  _SetValue(_GetValue() + rVal._GetValue());
   return *this;
 }
 
 BitVector BitVector::Sub(BitVector const& rVal) const
 {
   //assert(m_BitSize == rVal.GetBitSize());
-  BitVector Tmp(m_BitSize, m_Value - rVal.m_Value);
-  Tmp._Adjust();
-  return Tmp;
+  MEDUSA_BV_SMALL_OP(-);
+  return BitVector(m_BitSize, _GetValue() - rVal._GetValue());
 }
 
 BitVector& BitVector::SubAssign(BitVector const& rVal)
 {
-  m_Value -= rVal.m_Value;
-  _Adjust();
+  MEDUSA_BV_SMALL_OP_ASSIGN(-);
+  _SetValue(_GetValue() - rVal._GetValue());
   return *this;
 }
 
 BitVector BitVector::Mul(BitVector const& rVal) const
 {
   //assert(m_BitSize == rVal.GetBitSize());
-  BitVector Tmp(m_BitSize, m_Value * rVal.m_Value);
-  Tmp._Adjust();
-  return Tmp;
+  MEDUSA_BV_SMALL_OP(*);
+  return BitVector(m_BitSize, _GetValue() * rVal._GetValue());
 }
 
 BitVector& BitVector::MulAssign(BitVector const& rVal)
 {
-  m_Value *= rVal.m_Value;
-  _Adjust();
+  MEDUSA_BV_SMALL_OP_ASSIGN(*);
+  _SetValue(_GetValue() * rVal._GetValue());
   return *this;
 }
 
 BitVector BitVector::UDiv(BitVector const& rVal) const
 {
   //assert(m_BitSize == rVal.GetBitSize());
-  BitVector Tmp(m_BitSize, m_Value / rVal.m_Value);
-  Tmp._Adjust();
-  return Tmp;
+  // Division by zero is left to ap_int which throws
+  if (!rVal.IsZero())
+    MEDUSA_BV_SMALL_OP(/);
+  return BitVector(m_BitSize, _GetValue() / rVal._GetValue());
 }
 
 BitVector& BitVector::UDivAssign(BitVector const& rVal)
 {
-  BitVector Tmp = UDiv(rVal);
-  m_Value = Tmp.m_Value;
-  _Adjust();
+  *this = UDiv(rVal);
   return *this;
 }
 
 BitVector BitVector::SDiv(BitVector const& rVal) const
 {
   //assert(m_BitSize == rVal.GetBitSize());
-  BitVector Tmp(m_BitSize, GetSignedValue() / rVal.GetSignedValue());
-  Tmp._Adjust();
-  return Tmp;
+  if (_IsSmall() && rVal._IsSmall() && !rVal.IsZero())
+  {
+    s64 Left = _GetSmallSignedValue(), Right = rVal._GetSmallSignedValue();
+    // INT64_MIN / -1 overflows, the truncated result is INT64_MIN itself
+    if (Right == -1)
+      return BitVector(m_BitSize, ~static_cast<u64>(Left) + 1);
+    return BitVector(m_BitSize, Left / Right);
+  }
+  return BitVector(m_BitSize, GetSignedValue() / rVal.GetSignedValue());
 }
 
 BitVector& BitVector::SDivAssign(BitVector const& rVal)
 {
-  BitVector Tmp = SDiv(rVal);
-  m_Value = Tmp.m_Value;
-  _Adjust();
+  *this = SDiv(rVal);
   return *this;
 }
 
 BitVector BitVector::UMod(BitVector const& rVal) const
 {
   //assert(m_BitSize == rVal.GetBitSize());
-  BitVector Tmp(m_BitSize, m_Value % rVal.m_Value);
-  Tmp._Adjust();
-  return Tmp;
+  if (!rVal.IsZero())
+    MEDUSA_BV_SMALL_OP(%);
+  return BitVector(m_BitSize, _GetValue() % rVal._GetValue());
 }
 
 BitVector& BitVector::UModAssign(BitVector const& rVal)
 {
-  BitVector Tmp = UMod(rVal);
-  m_Value = Tmp.m_Value;
-  _Adjust();
+  *this = UMod(rVal);
   return *this;
 }
 
 BitVector BitVector::SMod(BitVector const& rVal) const
 {
   //assert(m_BitSize == rVal.GetBitSize());
-  BitVector Tmp(m_BitSize, GetSignedValue() % rVal.GetSignedValue());
-  Tmp._Adjust();
-  return Tmp;
+  if (_IsSmall() && rVal._IsSmall() && !rVal.IsZero())
+  {
+    s64 Left = _GetSmallSignedValue(), Right = rVal._GetSmallSignedValue();
+    if (Right == -1)
+      return BitVector(m_BitSize, 0);
+    return BitVector(m_BitSize, Left % Right);
+  }
+  return BitVector(m_BitSize, GetSignedValue() % rVal.GetSignedValue());
 }
 
 BitVector& BitVector::SModAssign(BitVector const& rVal)
 {
-  BitVector Tmp = SMod(rVal);
-  m_Value = Tmp.m_Value;
-  _Adjust();
+  *this = SMod(rVal);
   return *this;
 }
 
 BitVector BitVector::And(BitVector const& rVal) const
 {
   //assert(m_BitSize == rVal.GetBitSize());
-  BitVector Tmp(m_BitSize, m_Value & rVal.m_Value);
-  Tmp._Adjust();
-  return Tmp;
+  MEDUSA_BV_SMALL_OP(&);
+  return BitVector(m_BitSize, _GetValue() & rVal._GetValue());
 }
 
 BitVector& BitVector::AndAssign(BitVector const& rVal)
 {
-  m_Value &= rVal.m_Value;
-  _Adjust();
+  MEDUSA_BV_SMALL_OP_ASSIGN(&);
+  _SetValue(_GetValue() & rVal._GetValue());
   return *this;
 }
 
 BitVector BitVector::Or(BitVector const& rVal) const
 {
   //assert(m_BitSize == rVal.GetBitSize());
-  BitVector Tmp(m_BitSize, m_Value | rVal.m_Value);
-  Tmp._Adjust();
-  return Tmp;
+  MEDUSA_BV_SMALL_OP(|);
+  return BitVector(m_BitSize, _GetValue() | rVal._GetValue());
 }
 
 BitVector& BitVector::OrAssign(BitVector const& rVal)
 {
-  m_Value |= rVal.m_Value;
-  _Adjust();
+  MEDUSA_BV_SMALL_OP_ASSIGN(|);
+  _SetValue(_GetValue() | rVal._GetValue());
   return *this;
 }
 
 BitVector BitVector::Xor(BitVector const& rVal) const
 {
   //assert(m_BitSize == rVal.GetBitSize());
-  BitVector Tmp(m_BitSize, m_Value ^ rVal.m_Value);
-  Tmp._Adjust();
-  return Tmp;
+  MEDUSA_BV_SMALL_OP(^);
+  return BitVector(m_BitSize, _GetValue() ^ rVal._GetValue());
 }
 
 BitVector& BitVector::XorAssign(BitVector const& rVal)
 {
-  m_Value ^= rVal.m_Value;
-  _Adjust();
+  MEDUSA_BV_SMALL_OP_ASSIGN(^);
+  _SetValue(_GetValue() ^ rVal._GetValue());
   return *this;
 }
 
+#undef MEDUSA_BV_SMALL_OP_ASSIGN
+#undef MEDUSA_BV_SMALL_OP
+
 BitVector BitVector::Lls(BitVector const& rVal) const
 {
   //assert(m_BitSize == rVal.GetBitSize());
-  BitVector Tmp(m_BitSize, m_Value << rVal.ConvertTo<u32>());
-  Tmp._Adjust();
-  return Tmp;
+  u32 Count = rVal.ConvertTo<u32>();
+  if (_IsSmall())
+    return BitVector(m_BitSize, Count >= 64 ? 0 : m_SmallValue << Count);
+  return BitVector(m_BitSize, m_Value << Count);
 }
 
 BitVector& BitVector::LlsAssign(BitVector const& rVal)
 {
-  BitVector Tmp = Lls(rVal);
-  m_Value = Tmp.m_Value;
-  _Adjust();
+  *this = Lls(rVal);
   return *this;
 }
 
 BitVector BitVector::Lrs(BitVector const& rVal) const
 {
   //assert(m_BitSize == rVal.GetBitSize());
-  BitVector Tmp(m_BitSize, m_Value >> rVal.ConvertTo<u32>());
-  Tmp._Adjust();
-  return Tmp;
+  u32 Count = rVal.ConvertTo<u32>();
+  if (_IsSmall())
+    return BitVector(m_BitSize, Count >= 64 ? 0 : m_SmallValue >> Count);
+  return BitVector(m_BitSize, m_Value >> Count);
 }
 
 BitVector& BitVector::LrsAssign(BitVector const& rVal)
 {
-  BitVector Tmp = Lrs(rVal);
-  m_Value = Tmp.m_Value;
-  _Adjust();
+  *this = Lrs(rVal);
   return *this;
 }
 
@@ -365,6 +444,13 @@ BitVector BitVector::Ars(BitVector const& rVal) const
 {
   //assert(m_BitSize == rVal.GetBitSize());
   u32 Count = rVal.ConvertTo<u32>();
+  if (_IsSmall())
+  {
+    if (m_BitSize == 0)
+      return *this;
+    s64 Value = _GetSmallSignedValue();
+    return BitVector(m_BitSize, Value >> (Count >= m_BitSize ? m_BitSize - 1 : Count));
+  }
   u32 ShiftedBitSize = Count > m_BitSize ? 1 : m_BitSize - Count;
   ap_int ShiftedValue = m_Value;
   if (Count > m_BitSize)
@@ -373,15 +459,12 @@ BitVector BitVector::Ars(BitVector const& rVal) const
     ShiftedValue >>= Count;
   BitVector Tmp(ShiftedBitSize, ShiftedValue);
   Tmp.SignExtend(m_BitSize);
-  Tmp._Adjust();
   return Tmp;
 }
 
 BitVector& BitVector::ArsAssign(BitVector const& rVal)
 {
-  BitVector Tmp = Ars(rVal);
-  m_Value = Tmp.m_Value;
-  _Adjust();
+  *this = Ars(rVal);
   return *this;
 }
 
@@ -389,16 +472,18 @@ BitVector BitVector::Rol(BitVector const& rVal) const
 {
   //assert(m_BitSize == rVal.GetBitSize());
   u32 Count = rVal.ConvertTo<u32>() % m_BitSize;
-  BitVector Tmp(m_BitSize, (m_Value << Count) | (m_Value >> (m_BitSize - Count)));
-  Tmp._Adjust();
-  return Tmp;
+  if (_IsSmall())
+  {
+    if (Count == 0)
+      return *this;
+    return BitVector(m_BitSize, (m_SmallValue << Count) | (m_SmallValue >> (m_BitSize - Count)));
+  }
+  return BitVector(m_BitSize, (m_Value << Count) | (m_Value >> (m_BitSize - Count)));
 }
 
 BitVector& BitVector::RolAssign(BitVector const& rVal)
 {
-  BitVector Tmp = Rol(rVal);
-  m_Value = Tmp.m_Value;
-  _Adjust();
+  *this = Rol(rVal);
   return *this;
 }
 
@@ -406,16 +491,18 @@ BitVector BitVector::Ror(BitVector const& rVal) const
 {
   //assert(m_BitSize == rVal.GetBitSize());
   u32 Count = rVal.ConvertTo<u32>() % m_BitSize;
-  BitVector Tmp(m_BitSize, (m_Value >> Count) | (m_Value << (m_BitSize - Count)));
-  Tmp._Adjust();
-  return Tmp;
+  if (_IsSmall())
+  {
+    if (Count == 0)
+      return *this;
+    return BitVector(m_BitSize, (m_SmallValue >> Count) | (m_SmallValue << (m_BitSize - Count)));
+  }
+  return BitVector(m_BitSize, (m_Value >> Count) | (m_Value << (m_BitSize - Count)));
 }
 
 BitVector& BitVector::RorAssign(BitVector const& rVal)
 {
-  BitVector Tmp = Ror(rVal);
-  m_Value = Tmp.m_Value;
-  _Adjust();
+  *this = Ror(rVal);
   return *this;
 }
 
@@ -435,8 +522,7 @@ BitVector BitVector::FAdd(BitVector const& rVal) const
 BitVector& BitVector::FAddAssign(BitVector const& rVal)
 {
   BitVector Tmp = FAdd(rVal);
-  m_Value = Tmp.m_Value;
-  _Adjust();
+  *this = Tmp;
   return *this;
 }
 
@@ -456,8 +542,7 @@ BitVector BitVector::FSub(BitVector const& rVal) const
 BitVector& BitVector::FSubAssign(BitVector const& rVal)
 {
   BitVector Tmp = FSub(rVal);
-  m_Value = Tmp.m_Value;
-  _Adjust();
+  *this = Tmp;
   return *this;
 }
 
@@ -477,8 +562,7 @@ BitVector BitVector::FMul(BitVector const& rVal) const
 BitVector& BitVector::FMulAssign(BitVector const& rVal)
 {
   BitVector Tmp = FMul(rVal);
-  m_Value = Tmp.m_Value;
-  _Adjust();
+  *this = Tmp;
   return *this;
 }
 
@@ -498,8 +582,7 @@ BitVector BitVector::FDiv(BitVector const& rVal) const
 BitVector& BitVector::FDivAssign(BitVector const& rVal)
 {
   BitVector Tmp = FDiv(rVal);
-  m_Value = Tmp.m_Value;
-  _Adjust();
+  *this = Tmp;
   return *this;
 }
 
@@ -519,13 +602,67 @@ BitVector BitVector::FMod(BitVector const& rVal) const
 BitVector& BitVector::FModAssign(BitVector const& rVal)
 {
   BitVector Tmp = FMod(rVal);
-  m_Value = Tmp.m_Value;
-  _Adjust();
+  *this = Tmp;
   return *this;
 }
 
+s64 BitVector::_GetSmallSignedValue(void) const
+{
+  if (m_BitSize == 0 || m_BitSize >= 64 || !((m_SmallValue >> (m_BitSize - 1)) & 1))
+    return static_cast<s64>(m_SmallValue);
+  return static_cast<s64>(m_SmallValue | ~_MakeMask(m_BitSize));
+}
+
+void BitVector::_SetValue(ap_int const& rValue)
+{
+  if (!_IsSmall())
+  {
+    m_Value = rValue;
+    _Adjust();
+    return;
+  }
+
+  // Keep the two's complement of the lowest 64-bit
+  static ap_int const s_LowMask(~static_cast<u64>(0));
+  u64 Low = (boost::multiprecision::abs(rValue) & s_LowMask).convert_to<u64>();
+  if (rValue.sign() < 0)
+    Low = ~Low + 1;
+  m_SmallValue = Low & _MakeMask(m_BitSize);
+}
+
+void BitVector::_Resize(u16 NewBitSize)
+{
+  if (NewBitSize <= 64)
+  {
+    if (!_IsSmall())
+    {
+      ap_int Value = m_Value;
+      m_Value = 0;
+      m_BitSize = NewBitSize;
+      _SetValue(Value);
+      return;
+    }
+    m_BitSize = NewBitSize;
+    m_SmallValue &= _MakeMask(NewBitSize);
+    return;
+  }
+
+  if (_IsSmall())
+  {
+    m_Value = m_SmallValue;
+    m_SmallValue = 0;
+  }
+  m_BitSize = NewBitSize;
+  _Adjust();
+}
+
 void BitVector::_Adjust(void)
 {
+  if (_IsSmall())
+  {
+    m_SmallValue &= _MakeMask(m_BitSize);
+    return;
+  }
   ap_int Mask = (ap_int(1) << m_BitSize) - 1;
   m_Value = Mask & GetUnsignedValue();
 }
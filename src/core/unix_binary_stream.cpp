@@ -2,6 +2,7 @@
 #include <sys/stat.h>
 #include <fcntl.h>
 #include <unistd.h>
+#include <cerrno>
 #include <cstdlib>
 #include "medusa/binary_stream.hpp"
 #include <boost/filesystem/operations.hpp>
@@ -23,13 +24,15 @@ BinaryStream::~BinaryStream(void)
 
 /* file binary stream */
 
-FileBinaryStream::FileBinaryStream(boost::filesystem::path const& rFilePath)
+FileBinaryStream::FileBinaryStream(boost::filesystem::path const& rFilePath, u64 WindowSize)
 : BinaryStream()
 , m_FileHandle(-1)
 , m_MapHandle()
+, m_WindowSize(0x0)
+, m_ViewClock(0x0)
 {
   m_pBuffer = MAP_FAILED;
-  Open(rFilePath);
+  Open(rFilePath, WindowSize);
 }
 
 FileBinaryStream::~FileBinaryStream(void)
@@ -37,7 +40,7 @@ FileBinaryStream::~FileBinaryStream(void)
   Close();
 }
 
-void FileBinaryStream::Open(boost::filesystem::path const& rFilePath)
+void FileBinaryStream::Open(boost::filesystem::path const& rFilePath, u64 WindowSize)
 {
   m_Path = rFilePath;
   m_FileHandle = open(rFilePath.string().c_str(), O_RDONLY);
@@ -53,34 +56,86 @@ void FileBinaryStream::Open(boost::filesystem::path const& rFilePath)
     throw Exception_System("fstat");
 
   m_Size = sb.st_size;
+  m_WindowSize = WindowSize;
+
+  if (m_WindowSize == 0x0)
+  {
+    m_pBuffer = MAP_FAILED;
+    if (static_cast<u64>(static_cast<size_t>(m_Size)) == m_Size)
+      m_pBuffer = mmap(
+          NULL,
+          static_cast<size_t>(m_Size),
+          PROT_READ,
+          MAP_SHARED,
+          m_FileHandle,
+          0);
+
+    if (m_pBuffer != MAP_FAILED)
+      return;
+
+    // The file doesn't fit in the address space, fall back to sliding views
+    if (static_cast<u64>(static_cast<size_t>(m_Size)) == m_Size && errno != ENOMEM)
+      throw Exception_System("mmap");
+    m_WindowSize = DefaultWindowSize;
+  }
+
+  // Windowed mode: nothing is mapped until the first read
+  auto const Granularity = _GetMapGranularity();
+  m_WindowSize = (m_WindowSize + Granularity - 1) / Granularity * Granularity;
+  m_pBuffer = nullptr;
+}
+
+void FileBinaryStream::Close(void)
+{
+  _UnmapAllViews();
+  if (m_pBuffer != MAP_FAILED && m_pBuffer != nullptr)
+    munmap(m_pBuffer, static_cast<size_t>(m_Size));
+  m_pBuffer = nullptr;
+  if (m_FileHandle != -1)
+    close(m_FileHandle);
+  m_FileHandle = -1;
+  m_Size = 0;
+  m_WindowSize = 0;
+}
 
-  m_pBuffer = mmap(
+u64 FileBinaryStream::_GetMapGranularity(void)
+{
+  static u64 const s_PageSize = static_cast<u64>(::sysconf(_SC_PAGESIZE));
+  return s_PageSize;
+}
+
+void const* FileBinaryStream::_MapRegion(OffsetType Offset, u64 Size) const
+{
+  void* pData = mmap(
       NULL,
-      m_Size,
+      static_cast<size_t>(Size),
       PROT_READ,
       MAP_SHARED,
       m_FileHandle,
-      0);
+      static_cast<off_t>(Offset));
+
+  if (pData == MAP_FAILED)
+    return nullptr;
 
-  if (m_pBuffer == MAP_FAILED)
-    throw Exception_System("mmap");
+  // Views are mostly swept linearly (disassembly, strings, hashing), so let
+  // the kernel read ahead aggressively
+  ::madvise(pData, static_cast<size_t>(Size), MADV_SEQUENTIAL);
+  ::madvise(pData, static_cast<size_t>(Size), MADV_WILLNEED);
+  return pData;
 }
 
-void FileBinaryStream::Close(void)
+void FileBinaryStream::_UnmapRegion(void const* pData, u64 Size) const
 {
-  if (m_pBuffer != MAP_FAILED)
-    munmap(m_pBuffer, m_Size);
-  if (m_FileHandle != -1)
-    close(m_FileHandle);
-  m_Size = 0;
+  munmap(const_cast<void*>(pData), static_cast<size_t>(Size));
 }
 
 /* memory binary stream */
 
-MemoryBinaryStream::MemoryBinaryStream(void const* pMem, u32 MemSize)
+MemoryBinaryStream::MemoryBinaryStream(void const* pMem, u64 MemSize, OpenMode Mode)
   : BinaryStream()
+  , m_IsOwner(false)
 {
-  Open(pMem, MemSize);
+  Open(pMem, MemSize, Mode);
 }
 
 MemoryBinaryStream::~MemoryBinaryStream(void)
@@ -88,21 +143,32 @@ MemoryBinaryStream::~MemoryBinaryStream(void)
   Close();
 }
 
-void MemoryBinaryStream::Open(void const* pMem, u32 MemSize)
+void MemoryBinaryStream::Open(void const* pMem, u64 MemSize, OpenMode Mode)
 {
   m_Path = boost::filesystem::unique_path();
-  m_pBuffer = ::malloc(MemSize);
+  m_Size = MemSize;
+
+  if (Mode == ViewMode && pMem != nullptr)
+  {
+    m_pBuffer = const_cast<void*>(pMem);
+    m_IsOwner = false;
+    return;
+  }
+
+  m_pBuffer = ::malloc(static_cast<size_t>(MemSize));
   if (m_pBuffer == nullptr)
     throw Exception_System("open");
+  m_IsOwner = true;
 
-  m_Size = MemSize;
   if (pMem != nullptr)
-    ::memcpy(m_pBuffer, pMem, MemSize);
+    ::memcpy(m_pBuffer, pMem, static_cast<size_t>(MemSize));
 }
 
 void MemoryBinaryStream::Close(void)
 {
-  ::free(m_pBuffer);
+  if (m_IsOwner)
+    ::free(m_pBuffer);
+  m_IsOwner = false;
   m_pBuffer = nullptr;
   m_Size = 0x0;
   m_Endianness = EndianUnknown;
@@ -99,6 +99,8 @@ std::unordered_map<std::string, std::string> const& UserConfiguration::_GetDefau
   {
     { "core.modules_path", "." },
     { "core.log_level", "default" },
+    { "core.cache_path", "" }, // empty means the analysis cache is disabled
+    { "core.string_analysis", "scan" }, // "scan" sweeps every memory area, "labels" only checks labeled data
 
     { "color.background_listing", "#1e1e1e" },
     { "color.background_address", "#626262" },
@@ -74,25 +74,36 @@ std::string Base64Decode(std::string const &rBase64Data)
 }
 
 
-std::string Sha1(void const *pData, size_t Length)
+static std::string Sha1DigestToString(boost::uuids::detail::sha1& rSha1)
 {
   std::ostringstream Result;
-  boost::uuids::detail::sha1 Sha1;
   unsigned int Digest[5];
 
-  Result << std::hex << std::setfill('0') << std::setw(2);
+  Result << std::hex << std::setfill('0');
+
+  rSha1.get_digest(Digest);
+  for (int i = 0; i < 5; ++i)
+    Result << std::setw(8) << Digest[i];
+
+  return Result.str();
+}
 
+std::string Sha1(void const *pData, size_t Length)
+{
+  boost::uuids::detail::sha1 Sha1;
   Sha1.process_bytes(pData, Length);
-  Sha1.get_digest(Digest);
-  for (int i = 0; i < 4; ++i)
-  {
-    Result << ((Digest[i] >> 24) & 0xFF);
-    Result << ((Digest[i] >> 16) & 0xFF);
-    Result << ((Digest[i] >>  8) & 0xFF);
-    Result << ((Digest[i] >>  0) & 0xFF);
-  }
+  return Sha1DigestToString(Sha1);
+}
+
+std::string Sha1(std::function<bool(void const*& rpChunk, size_t& rChunkLength)> const& rNextChunk)
+{
+  boost::uuids::detail::sha1 Sha1;
+  void const* pChunk;
+  size_t ChunkLength;
 
-  return std::move(Result.str());
+  while (rNextChunk(pChunk, ChunkLength))
+    Sha1.process_bytes(pChunk, ChunkLength);
+  return Sha1DigestToString(Sha1);
 }
 
 Id Sha1(std::string const &rName)
@@ -19,12 +19,14 @@ BinaryStream::~BinaryStream(void)
 
 /* file binary stream */
 
-FileBinaryStream::FileBinaryStream(boost::filesystem::path const& rFilePath)
+FileBinaryStream::FileBinaryStream(boost::filesystem::path const& rFilePath, u64 WindowSize)
 : BinaryStream()
 , m_FileHandle(INVALID_HANDLE_VALUE)
 , m_MapHandle(nullptr)
+, m_WindowSize(0x0)
+, m_ViewClock(0x0)
 {
-  Open(rFilePath);
+  Open(rFilePath, WindowSize);
 }
 
 FileBinaryStream::~FileBinaryStream(void)
@@ -32,9 +34,9 @@ FileBinaryStream::~FileBinaryStream(void)
   Close();
 }
 
-void FileBinaryStream::Open(boost::filesystem::path const& rFilePath)
+void FileBinaryStream::Open(boost::filesystem::path const& rFilePath, u64 WindowSize)
 {
-  if (m_pBuffer != nullptr)
+  if (m_pBuffer != nullptr || !m_Views.empty())
     throw Exception("Binary stream: close the current file first before opening a new one");
 
   m_Path       = rFilePath;
@@ -60,7 +62,8 @@ void FileBinaryStream::Open(boost::filesystem::path const& rFilePath)
   if (GetFileSizeEx(m_FileHandle, &FileSize) == FALSE)
     throw Exception_System("GetFileSizeEx");
 
-  m_Size = static_cast<u32>(FileSize.QuadPart);
+  m_Size = static_cast<u64>(FileSize.QuadPart);
+  m_WindowSize = WindowSize;
 
   m_MapHandle = CreateFileMappingW(
       m_FileHandle,
@@ -74,19 +77,34 @@ void FileBinaryStream::Open(boost::filesystem::path const& rFilePath)
   if (m_MapHandle == nullptr)
     throw Exception_System("CreateFileMappingW");
 
-  m_pBuffer = MapViewOfFile(
-      m_MapHandle,
-      FILE_MAP_READ,
-      0, 0,
-      0
-      );
+  if (m_WindowSize == 0x0)
+  {
+    if (static_cast<u64>(static_cast<SIZE_T>(m_Size)) == m_Size)
+      m_pBuffer = MapViewOfFile(
+          m_MapHandle,
+          FILE_MAP_READ,
+          0, 0,
+          0
+          );
+
+    if (m_pBuffer != nullptr)
+      return;
+
+    // The file doesn't fit in the address space, fall back to sliding views
+    if (static_cast<u64>(static_cast<SIZE_T>(m_Size)) == m_Size && GetLastError() != ERROR_NOT_ENOUGH_MEMORY)
+      throw Exception_System("MapViewOfFile");
+    m_WindowSize = DefaultWindowSize;
+  }
 
-  if (m_pBuffer == nullptr)
-    throw Exception_System("MapViewOfFile");
+  // Windowed mode: nothing is mapped until the first read
+  auto const Granularity = _GetMapGranularity();
+  m_WindowSize = (m_WindowSize + Granularity - 1) / Granularity * Granularity;
+  m_pBuffer = nullptr;
 }
 
 void FileBinaryStream::Close(void)
 {
+  _UnmapAllViews();
   if (m_pBuffer != nullptr)
   {
     UnmapViewOfFile(m_pBuffer);
@@ -104,14 +122,48 @@ void FileBinaryStream::Close(void)
   }
 
   m_Size = 0;
+  m_WindowSize = 0;
+}
+
+u64 FileBinaryStream::_GetMapGranularity(void)
+{
+  SYSTEM_INFO SysInfo;
+  GetSystemInfo(&SysInfo);
+  return static_cast<u64>(SysInfo.dwAllocationGranularity);
+}
+
+void const* FileBinaryStream::_MapRegion(OffsetType Offset, u64 Size) const
+{
+  void* pData = MapViewOfFile(
+      m_MapHandle,
+      FILE_MAP_READ,
+      static_cast<DWORD>(Offset >> 32), static_cast<DWORD>(Offset & 0xffffffff),
+      static_cast<SIZE_T>(Size)
+      );
+
+  if (pData == nullptr)
+    return nullptr;
+
+  // Views are mostly swept linearly, so prefetch them
+  WIN32_MEMORY_RANGE_ENTRY Range;
+  Range.VirtualAddress = pData;
+  Range.NumberOfBytes  = static_cast<SIZE_T>(Size);
+  PrefetchVirtualMemory(GetCurrentProcess(), 1, &Range, 0);
+  return pData;
+}
+
+void FileBinaryStream::_UnmapRegion(void const* pData, u64 Size) const
+{
+  UnmapViewOfFile(pData);
 }
 
 /* memory binary stream */
 
-MemoryBinaryStream::MemoryBinaryStream(void const* pMem, u32 MemSize)
+MemoryBinaryStream::MemoryBinaryStream(void const* pMem, u64 MemSize, OpenMode Mode)
   : BinaryStream()
+  , m_IsOwner(false)
 {
-  Open(pMem, MemSize);
+  Open(pMem, MemSize, Mode);
 }
 
 MemoryBinaryStream::~MemoryBinaryStream(void)
@@ -119,20 +171,32 @@ MemoryBinaryStream::~MemoryBinaryStream(void)
   Close();
 }
 
-void MemoryBinaryStream::Open(void const* pMem, u32 MemSize)
+void MemoryBinaryStream::Open(void const* pMem, u64 MemSize, OpenMode Mode)
 {
   m_Path = boost::filesystem::unique_path();
-  m_pBuffer = ::malloc(MemSize);
+  m_Size = MemSize;
+
+  if (Mode == ViewMode && pMem != nullptr)
+  {
+    m_pBuffer = const_cast<void*>(pMem);
+    m_IsOwner = false;
+    return;
+  }
+
+  m_pBuffer = ::malloc(static_cast<size_t>(MemSize));
   if (m_pBuffer == nullptr)
    throw Exception_System("malloc");
-  m_Size = MemSize;
+  m_IsOwner = true;
+
   if (pMem != nullptr)
-    ::memcpy(m_pBuffer, pMem, MemSize);
+    ::memcpy(m_pBuffer, pMem, static_cast<size_t>(MemSize));
 }
 
 void MemoryBinaryStream::Close(void)
 {
-  ::free(m_pBuffer);
+  if (m_IsOwner)
+    ::free(m_pBuffer);
+  m_IsOwner = false;
   m_pBuffer = nullptr;
   m_Size = 0x0;
   m_Endianness = EndianUnknown;
@@ -4,9 +4,11 @@
 #include <medusa/log.hpp>
 #include <medusa/util.hpp>
 
+#include <algorithm>
 #include <sstream>
 #include <string>
 #include <thread>
+#include <vector>
 
 #include <boost/algorithm/string.hpp>
 #include <boost/uuid/uuid_io.hpp>
@@ -102,7 +104,7 @@ bool TextDatabase::Open(boost::filesystem::path const& rDatabasePath)
         auto const RawBinStr = Base64Decode(CurLine);
         if (RawBinStr.empty())
           return false;
-        SetBinaryStream(std::make_shared<MemoryBinaryStream>(RawBinStr.c_str(), static_cast<u32>(RawBinStr.size())));
+        SetBinaryStream(std::make_shared<MemoryBinaryStream>(RawBinStr.c_str(), RawBinStr.size()));
       }
       break;
     case ArchitectureState:
@@ -325,8 +327,21 @@ bool TextDatabase::Flush(void)
   // Save binary stream
   {
     TextFile << "## BinaryStream\n";
-    std::string Base64Data = Base64Encode(m_spBinStrm->GetBuffer(), m_spBinStrm->GetSize());
-    TextFile << Base64Data << "\n" << std::flush;
+    // Windowed streams don't expose their buffer, so the stream is encoded by chunks on a single line
+    // Each chunk but the last one is a multiple of 3 bytes to avoid padding in the middle of the line
+    std::vector<u8> Chunk(3 * 0x10000);
+    u64 const StrmSize = m_spBinStrm->GetSize();
+    for (u64 Off = 0; Off < StrmSize; Off += Chunk.size())
+    {
+      auto ChunkSize = static_cast<size_t>(std::min<u64>(Chunk.size(), StrmSize - Off));
+      if (!m_spBinStrm->Read(Off, Chunk.data(), ChunkSize))
+      {
+        Log::Write("db_text") << "unable to read binary stream at " << Off << LogEnd;
+        return false;
+      }
+      TextFile << Base64Encode(Chunk.data(), static_cast<u32>(ChunkSize));
+    }
+    TextFile << "\n" << std::flush;
   }
 
   // Save architecture tag
@@ -0,0 +1,615 @@
+#include "compiled_block.hpp"
+#include <medusa/expression_visitor.hpp>
+
+namespace
+{
+  inline u64 MakeMask(u32 BitSize)
+  {
+    return BitSize >= 64 ? ~static_cast<u64>(0) : (static_cast<u64>(1) << BitSize) - 1;
+  }
+
+  inline s64 SignExtend(u64 Val, u32 BitSize)
+  {
+    if (BitSize == 0 || BitSize >= 64 || !((Val >> (BitSize - 1)) & 1))
+      return static_cast<s64>(Val);
+    return static_cast<s64>(Val | ~MakeMask(BitSize));
+  }
+
+  inline u64 ScanForward(u64 Val)
+  {
+    if (Val == 0)
+      return 0;
+    u64 Idx = 0;
+    while (!(Val & 1))
+    {
+      Val >>= 1;
+      ++Idx;
+    }
+    return Idx;
+  }
+
+  inline u64 ScanReverse(u64 Val)
+  {
+    u64 Idx = 0;
+    while (Val >>= 1)
+      ++Idx;
+    return Idx;
+  }
+
+  inline u64 SwapBytes(u64 Val, u32 BitSize)
+  {
+    switch (BitSize)
+    {
+    case 16: case 32: case 64:
+    {
+      u64 Res = 0;
+      for (u32 i = 0; i < BitSize / 8; ++i)
+      {
+        Res = (Res << 8) | (Val & 0xff);
+        Val >>= 8;
+      }
+      return Res;
+    }
+
+    default:
+      return Val;
+    }
+  }
+}
+
+CompiledBlock::CompiledBlock(CpuContext const& rCpuCtxt)
+  : m_rCpuCtxt(rCpuCtxt), m_rCpuInfo(rCpuCtxt.GetCpuInformation())
+{
+}
+
+bool CompiledBlock::Compile(Expression::VSPType const& rExprs)
+{
+  for (auto spExpr : rExprs)
+  {
+    if (spExpr->GetClassKind() == Expression::Sys)
+    {
+      auto spSysExpr = std::static_pointer_cast<SystemExpression>(spExpr);
+      auto const& rName = spSysExpr->GetName();
+      if (rName == "call_insn_cb")
+      {
+        m_Addrs.push_back(spSysExpr->GetAddress());
+        _Emit(InsnCb, 0, 0, NoValue, NoValue, NoValue, NoValue, m_Addrs.size() - 1);
+        continue;
+      }
+      if (rName == "check_exec_hook")
+      {
+        _Emit(ExecHook, 0, 0, NoValue);
+        continue;
+      }
+      if (rName == "stop")
+      {
+        _Emit(Stop, 0, 0, NoValue);
+        continue;
+      }
+    }
+
+    auto NrOfOps = m_Ops.size();
+    if (_CompileStatement(spExpr))
+      continue;
+    m_Ops.resize(NrOfOps);
+
+    // Variables of the block only live in its values, the tree walker can't access them
+    FilterVisitor VarFlt([](Expression::SPType spExpr) -> Expression::SPType
+    {
+      return spExpr->GetClassKind() == Expression::Var ? spExpr : nullptr;
+    }, 1);
+    spExpr->Visit(&VarFlt);
+    if (!VarFlt.GetMatchedExpressions().empty())
+      return false;
+
+    m_Exprs.push_back(spExpr);
+    _Emit(Walk, 0, 0, NoValue, NoValue, NoValue, NoValue, m_Exprs.size() - 1);
+  }
+
+  m_Vars.clear();
+  return true;
+}
+
+bool CompiledBlock::ComputeUnaryOperation(Operation const& rOp, u64 Val, u64& rRes)
+{
+  u32 BitSize = rOp.m_BitSize;
+  switch (rOp.m_Type)
+  {
+  case OperationExpression::OpNot:  rRes = ~Val;                      break;
+  case OperationExpression::OpNeg:  rRes = ~Val + 1;                  break;
+  case OperationExpression::OpSwap: rRes = SwapBytes(Val, BitSize);   break;
+  case OperationExpression::OpBsf:  rRes = ScanForward(Val);          break;
+  case OperationExpression::OpBsr:  rRes = ScanReverse(Val);          break;
+  default:                          return false;
+  }
+  rRes &= MakeMask(BitSize);
+  return true;
+}
+
+bool CompiledBlock::ComputeBinaryOperation(Operation const& rOp, u64 Left, u64 Right, u64& rRes)
+{
+  // Like BitVector, the result has the bit size of the left operand except for extensions and bit casts
+  u32 LeftBitSize = rOp.m_SrcBitSize[0];
+  u32 RightBitSize = rOp.m_SrcBitSize[1];
+  u32 Count = static_cast<u32>(Right);
+
+  switch (rOp.m_Type)
+  {
+  case OperationExpression::OpAnd: rRes = Left & Right; break;
+  case OperationExpression::OpOr:  rRes = Left | Right; break;
+  case OperationExpression::OpXor: rRes = Left ^ Right; break;
+  case OperationExpression::OpAdd: rRes = Left + Right; break;
+  case OperationExpression::OpSub: rRes = Left - Right; break;
+  case OperationExpression::OpMul: rRes = Left * Right; break;
+
+  case OperationExpression::OpLls: rRes = Count >= 64 ? 0 : Left << Count; break;
+  case OperationExpression::OpLrs: rRes = Count >= 64 ? 0 : Left >> Count; break;
+
+  case OperationExpression::OpArs:
+    rRes = static_cast<u64>(SignExtend(Left, LeftBitSize) >> (Count >= LeftBitSize ? LeftBitSize - 1 : Count));
+    break;
+
+  case OperationExpression::OpRol:
+    Count %= LeftBitSize;
+    rRes = Count == 0 ? Left : (Left << Count) | (Left >> (LeftBitSize - Count));
+    break;
+
+  case OperationExpression::OpRor:
+    Count %= LeftBitSize;
+    rRes = Count == 0 ? Left : (Left >> Count) | (Left << (LeftBitSize - Count));
+    break;
+
+  case OperationExpression::OpUDiv:
+    if (Right == 0)
+      return false;
+    rRes = Left / Right;
+    break;
+
+  case OperationExpression::OpUMod:
+    if (Right == 0)
+      return false;
+    rRes = Left % Right;
+    break;
+
+  case OperationExpression::OpSDiv:
+  {
+    if (Right == 0)
+      return false;
+    s64 SLeft = SignExtend(Left, LeftBitSize), SRight = SignExtend(Right, RightBitSize);
+    rRes = SRight == -1 ? ~static_cast<u64>(SLeft) + 1 : static_cast<u64>(SLeft / SRight);
+    break;
+  }
+
+  case OperationExpression::OpSMod:
+  {
+    if (Right == 0)
+      return false;
+    s64 SLeft = SignExtend(Left, LeftBitSize), SRight = SignExtend(Right, RightBitSize);
+    rRes = SRight == -1 ? 0 : static_cast<u64>(SLeft % SRight);
+    break;
+  }
+
+  case OperationExpression::OpSext:
+    rRes = static_cast<u64>(SignExtend(Left, LeftBitSize));
+    break;
+
+  case OperationExpression::OpZext:
+  case OperationExpression::OpBcast:
+    rRes = Left;
+    break;
+
+  case OperationExpression::OpInsertBits:
+    rRes = ((Left << ScanForward(Right)) & MakeMask(LeftBitSize)) & Right;
+    break;
+
+  case OperationExpression::OpExtractBits:
+    rRes = (Left & Right) >> ScanForward(Right);
+    break;
+
+  case OperationExpression::OpClearBits:
+    rRes = Left & (~Right & MakeMask(RightBitSize));
+    break;
+
+  default:
+    return false;
+  }
+
+  rRes &= MakeMask(rOp.m_BitSize);
+  return true;
+}
+
+bool CompiledBlock::Compare(Operation const& rOp, u64 Ref, u64 Test)
+{
+  s64 SRef = SignExtend(Ref, rOp.m_SrcBitSize[0]);
+  s64 STest = SignExtend(Test, rOp.m_SrcBitSize[1]);
+
+  switch (rOp.m_Type)
+  {
+  case ConditionExpression::CondEq:  return Ref == Test;
+  case ConditionExpression::CondNe:  return Ref != Test;
+  case ConditionExpression::CondUgt: return Ref >  Test;
+  case ConditionExpression::CondUge: return Ref >= Test;
+  case ConditionExpression::CondUlt: return Ref <  Test;
+  case ConditionExpression::CondUle: return Ref <= Test;
+  case ConditionExpression::CondSgt: return SRef >  STest;
+  case ConditionExpression::CondSge: return SRef >= STest;
+  case ConditionExpression::CondSlt: return SRef <  STest;
+  case ConditionExpression::CondSle: return SRef <= STest;
+  default:                           return false;
+  }
+}
+
+bool CompiledBlock::_CompileStatement(Expression::SPType spExpr)
+{
+  switch (spExpr->GetClassKind())
+  {
+  case Expression::Assign:
+    return _CompileAssignment(std::static_pointer_cast<AssignmentExpression>(spExpr));
+
+  case Expression::IfElseCond:
+  {
+    auto spIfElseExpr = std::static_pointer_cast<IfElseConditionExpression>(spExpr);
+    size_t ElseJumpIdx;
+    if (!_CompileCondition(spIfElseExpr, ElseJumpIdx))
+      return false;
+    if (!_CompileStatement(spIfElseExpr->GetThenExpression()))
+      return false;
+    auto spElseExpr = spIfElseExpr->GetElseExpression();
+    if (spElseExpr == nullptr)
+    {
+      _PatchJump(ElseJumpIdx);
+      return true;
+    }
+    auto EndJumpIdx = _Emit(Jump, 0, 0, NoValue);
+    _PatchJump(ElseJumpIdx);
+    if (!_CompileStatement(spElseExpr))
+      return false;
+    _PatchJump(EndJumpIdx);
+    return true;
+  }
+
+  case Expression::WhileCond:
+  {
+    auto spWhileExpr = std::static_pointer_cast<WhileConditionExpression>(spExpr);
+    auto LoopIdx = m_Ops.size();
+    size_t EndJumpIdx;
+    if (!_CompileCondition(spWhileExpr, EndJumpIdx))
+      return false;
+    if (!_CompileStatement(spWhileExpr->GetBodyExpression()))
+      return false;
+    _Emit(Jump, 0, 0, NoValue, NoValue, NoValue, NoValue, LoopIdx);
+    _PatchJump(EndJumpIdx);
+    return true;
+  }
+
+  case Expression::Bind:
+  {
+    auto spBindExpr = std::static_pointer_cast<BindExpression>(spExpr);
+    for (auto spBoundExpr : spBindExpr->GetBoundExpressions())
+      if (!_CompileStatement(spBoundExpr))
+        return false;
+    return true;
+  }
+
+  case Expression::Track:
+    return _CompileStatement(std::static_pointer_cast<TrackExpression>(spExpr)->GetTrackedExpression());
+
+  case Expression::Var:
+  {
+    auto spVarExpr = std::static_pointer_cast<VariableExpression>(spExpr);
+    switch (spVarExpr->GetType())
+    {
+    case VariableExpression::Alloc:
+      m_Vars[spVarExpr->GetName()] = Variable{ _AddValue(0), 0 };
+      return true;
+
+    case VariableExpression::Free:
+      m_Vars.erase(spVarExpr->GetName());
+      return true;
+
+    default:
+      return false;
+    }
+  }
+
+  default:
+    return false;
+  }
+}
+
+bool CompiledBlock::_CompileAssignment(AssignmentExpression::SPType spAssignExpr)
+{
+  auto spDstExpr = spAssignExpr->GetDestinationExpression();
+  while (spDstExpr->GetClassKind() == Expression::Track)
+    spDstExpr = std::static_pointer_cast<TrackExpression>(spDstExpr)->GetTrackedExpression();
+
+  // Vector identifiers transfer several values
+  if (spDstExpr->GetClassKind() == Expression::VecId)
+    return false;
+
+  u32 SrcVal = _CompileValue(spAssignExpr->GetSourceExpression());
+  if (SrcVal == NoValue)
+    return false;
+  u32 SrcBitSize = m_ValueBitSizes[SrcVal];
+
+  switch (spDstExpr->GetClassKind())
+  {
+  case Expression::Id:
+  {
+    auto RegId = std::static_pointer_cast<IdentifierExpression>(spDstExpr)->GetId();
+    if (!_IsRegisterSupported(RegId, SrcBitSize))
+      return false;
+    u32 RegDescIdx = _AddRegisterDescriptor(RegId, SrcBitSize);
+    if (RegDescIdx != NoValue)
+      _Emit(StoreReg, 0, SrcBitSize, NoValue, SrcVal, NoValue, NoValue, RegDescIdx);
+    else
+      _Emit(WriteReg, 0, SrcBitSize, NoValue, SrcVal, NoValue, NoValue, RegId);
+    return true;
+  }
+
+  case Expression::Mem:
+  {
+    auto spMemExpr = std::static_pointer_cast<MemoryExpression>(spDstExpr);
+    if (!spMemExpr->IsDereferencable())
+      return false;
+    if (SrcBitSize != 8 && SrcBitSize != 16 && SrcBitSize != 32 && SrcBitSize != 64)
+      return false;
+    u32 OffVal, BaseVal;
+    if (!_CompileAddress(spMemExpr, OffVal, BaseVal))
+      return false;
+    _Emit(Store, 0, SrcBitSize, NoValue, OffVal, BaseVal, SrcVal);
+    return true;
+  }
+
+  case Expression::Var:
+  {
+    auto spVarExpr = std::static_pointer_cast<VariableExpression>(spDstExpr);
+    if (spVarExpr->GetType() != VariableExpression::Use)
+      return false;
+    auto itVar = m_Vars.find(spVarExpr->GetName());
+    if (itVar == std::end(m_Vars))
+      return false;
+    auto& rVar = itVar->second;
+    // The variable keeps the bit size of its first assignment
+    if (rVar.m_BitSize == 0)
+    {
+      rVar.m_BitSize = SrcBitSize;
+      m_ValueBitSizes[rVar.m_Value] = static_cast<u16>(SrcBitSize);
+    }
+    else if (rVar.m_BitSize != SrcBitSize)
+      return false;
+    _Emit(Move, 0, SrcBitSize, rVar.m_Value, SrcVal);
+    return true;
+  }
+
+  default:
+    return false;
+  }
+}
+
+bool CompiledBlock::_CompileCondition(ConditionExpression::SPType spCondExpr, size_t& rJumpIdx)
+{
+  auto CondType = spCondExpr->GetType();
+  if (CondType < ConditionExpression::CondEq || CondType > ConditionExpression::CondSle)
+    return false;
+
+  u32 RefVal = _CompileValue(spCondExpr->GetReferenceExpression());
+  if (RefVal == NoValue)
+    return false;
+  u32 TestVal = _CompileValue(spCondExpr->GetTestExpression());
+  if (TestVal == NoValue)
+    return false;
+
+  rJumpIdx = _Emit(JumpIfNot, static_cast<u8>(CondType), 0, NoValue, RefVal, TestVal);
+  return true;
+}
+
+bool CompiledBlock::_CompileAddress(MemoryExpression::SPType spMemExpr, u32& rOffVal, u32& rBaseVal)
+{
+  rOffVal = _CompileValue(spMemExpr->GetOffsetExpression());
+  if (rOffVal == NoValue)
+    return false;
+
+  rBaseVal = NoValue;
+  auto spBaseExpr = spMemExpr->GetBaseExpression();
+  if (spBaseExpr == nullptr)
+    return true;
+  rBaseVal = _CompileValue(spBaseExpr);
+  return rBaseVal != NoValue;
+}
+
+u32 CompiledBlock::_CompileValue(Expression::SPType spExpr)
+{
+  switch (spExpr->GetClassKind())
+  {
+  case Expression::Const:
+  {
+    auto Const = std::static_pointer_cast<BitVectorExpression>(spExpr)->GetInt();
+    if (Const.GetBitSize() == 0 || Const.GetBitSize() > 64)
+      return NoValue;
+    return _AddValue(Const.GetBitSize(), Const.ConvertTo<u64>());
+  }
+
+  case Expression::Id:
+  {
+    auto spIdExpr = std::static_pointer_cast<IdentifierExpression>(spExpr);
+    auto RegId = spIdExpr->GetId();
+    auto BitSize = spIdExpr->GetBitSize();
+    if (!_IsRegisterSupported(RegId, BitSize))
+      return NoValue;
+    u32 Val = _AddValue(BitSize);
+    u32 RegDescIdx = _AddRegisterDescriptor(RegId, BitSize);
+    if (RegDescIdx != NoValue)
+      _Emit(LoadReg, 0, BitSize, Val, NoValue, NoValue, NoValue, RegDescIdx);
+    else
+      _Emit(ReadReg, 0, BitSize, Val, NoValue, NoValue, NoValue, RegId);
+    return Val;
+  }
+
+  case Expression::Var:
+  {
+    auto spVarExpr = std::static_pointer_cast<VariableExpression>(spExpr);
+    if (spVarExpr->GetType() != VariableExpression::Use)
+      return NoValue;
+    auto itVar = m_Vars.find(spVarExpr->GetName());
+    if (itVar == std::end(m_Vars) || itVar->second.m_BitSize == 0)
+      return NoValue;
+    return itVar->second.m_Value;
+  }
+
+  case Expression::Track:
+    return _CompileValue(std::static_pointer_cast<TrackExpression>(spExpr)->GetTrackedExpression());
+
+  case Expression::Mem:
+  {
+    auto spMemExpr = std::static_pointer_cast<MemoryExpression>(spExpr);
+    auto AccessBitSize = spMemExpr->GetAccessSizeInBit();
+    u32 OffVal, BaseVal;
+    if (spMemExpr->IsDereferencable())
+    {
+      if (AccessBitSize != 8 && AccessBitSize != 16 && AccessBitSize != 32 && AccessBitSize != 64)
+        return NoValue;
+      if (!_CompileAddress(spMemExpr, OffVal, BaseVal))
+        return NoValue;
+      u32 Val = _AddValue(AccessBitSize);
+      _Emit(Load, 0, AccessBitSize, Val, OffVal, BaseVal);
+      return Val;
+    }
+
+    if (AccessBitSize == 0 || AccessBitSize > 64)
+      return NoValue;
+    if (!_CompileAddress(spMemExpr, OffVal, BaseVal))
+      return NoValue;
+    u32 Val = _AddValue(AccessBitSize);
+    _Emit(AddressOf, 0, AccessBitSize, Val, OffVal, BaseVal);
+    return Val;
+  }
+
+  case Expression::UnOp:
+  {
+    auto spUnOpExpr = std::static_pointer_cast<UnaryOperationExpression>(spExpr);
+    auto OpType = spUnOpExpr->GetOperation();
+    switch (OpType)
+    {
+    case OperationExpression::OpNot: case OperationExpression::OpNeg: case OperationExpression::OpSwap:
+    case OperationExpression::OpBsf: case OperationExpression::OpBsr:
+      break;
+    default:
+      return NoValue;
+    }
+
+    u32 SrcVal = _CompileValue(spUnOpExpr->GetExpression());
+    if (SrcVal == NoValue)
+      return NoValue;
+    u32 BitSize = m_ValueBitSizes[SrcVal];
+    u32 Val = _AddValue(BitSize);
+    _Emit(UnOp, static_cast<u8>(OpType), BitSize, Val, SrcVal);
+    return Val;
+  }
+
+  case Expression::BinOp:
+  {
+    auto spBinOpExpr = std::static_pointer_cast<BinaryOperationExpression>(spExpr);
+    auto OpType = spBinOpExpr->GetOperation();
+    if (OpType < OperationExpression::OpAnd || OpType > OperationExpression::OpBcast)
+      return NoValue;
+
+    u32 LeftVal = _CompileValue(spBinOpExpr->GetLeftExpression());
+    if (LeftVal == NoValue)
+      return NoValue;
+    u32 RightVal = _CompileValue(spBinOpExpr->GetRightExpression());
+    if (RightVal == NoValue)
+      return NoValue;
+
+    u32 BitSize = m_ValueBitSizes[LeftVal];
+    if (OpType == OperationExpression::OpSext || OpType == OperationExpression::OpZext || OpType == OperationExpression::OpBcast)
+    {
+      // The new bit size must be known to give a width to the result
+      auto spRightExpr = spBinOpExpr->GetRightExpression();
+      if (spRightExpr->GetClassKind() != Expression::Const)
+        return NoValue;
+      BitSize = std::static_pointer_cast<BitVectorExpression>(spRightExpr)->GetInt().ConvertTo<u16>();
+      if (BitSize == 0 || BitSize > 64)
+        return NoValue;
+    }
+
+    u32 Val = _AddValue(BitSize);
+    _Emit(BinOp, static_cast<u8>(OpType), BitSize, Val, LeftVal, RightVal);
+    return Val;
+  }
+
+  case Expression::TernaryCond:
+  {
+    auto spTernExpr = std::static_pointer_cast<TernaryConditionExpression>(spExpr);
+    size_t FalseJumpIdx;
+    if (!_CompileCondition(spTernExpr, FalseJumpIdx))
+      return NoValue;
+
+    u32 TrueVal = _CompileValue(spTernExpr->GetTrueExpression());
+    if (TrueVal == NoValue)
+      return NoValue;
+    u32 BitSize = m_ValueBitSizes[TrueVal];
+    u32 Val = _AddValue(BitSize);
+    _Emit(Move, 0, BitSize, Val, TrueVal);
+    auto EndJumpIdx = _Emit(Jump, 0, 0, NoValue);
+
+    _PatchJump(FalseJumpIdx);
+    u32 FalseVal = _CompileValue(spTernExpr->GetFalseExpression());
+    // Both results must have the same width
+    if (FalseVal == NoValue || m_ValueBitSizes[FalseVal] != BitSize)
+      return NoValue;
+    _Emit(Move, 0, BitSize, Val, FalseVal);
+    _PatchJump(EndJumpIdx);
+    return Val;
+  }
+
+  default:
+    return NoValue;
+  }
+}
+
+u32 CompiledBlock::_AddValue(u32 BitSize, u64 InitValue)
+{
+  m_Values.push_back(InitValue);
+  m_ValueBitSizes.push_back(static_cast<u16>(BitSize));
+  return static_cast<u32>(m_Values.size() - 1);
+}
+
+size_t CompiledBlock::_Emit(u8 Code, u8 Type, u32 BitSize, u32 Dst, u32 Src0, u32 Src1, u32 Src2, u64 Imm)
+{
+  Operation Op;
+  Op.m_Code          = Code;
+  Op.m_Type          = Type;
+  Op.m_BitSize       = static_cast<u16>(BitSize);
+  Op.m_SrcBitSize[0] = Src0 != NoValue ? m_ValueBitSizes[Src0] : 0;
+  Op.m_SrcBitSize[1] = Src1 != NoValue ? m_ValueBitSizes[Src1] : 0;
+  Op.m_Dst           = Dst;
+  Op.m_Src[0]        = Src0;
+  Op.m_Src[1]        = Src1;
+  Op.m_Src[2]        = Src2;
+  Op.m_Imm           = Imm;
+  m_Ops.push_back(Op);
+  return m_Ops.size() - 1;
+}
+
+bool CompiledBlock::_IsRegisterSupported(u32 RegId, u32 BitSize) const
+{
+  if (m_rCpuInfo.GetSizeOfRegisterInBit(RegId) != BitSize)
+    return false;
+  switch (BitSize)
+  {
+  case 1: case 8: case 16: case 32: case 64:
+    return true;
+  default:
+    return false;
+  }
+}
+
+u32 CompiledBlock::_AddRegisterDescriptor(u32 RegId, u32 BitSize)
+{
+  auto pRegDesc = m_rCpuCtxt.GetRegisterDescriptor(RegId);
+  if (pRegDesc == nullptr || pRegDesc->m_BitSize != BitSize)
+    return NoValue;
+  m_RegDescs.push_back(*pRegDesc);
+  return static_cast<u32>(m_RegDescs.size() - 1);
+}
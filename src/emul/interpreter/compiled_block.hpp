@@ -0,0 +1,113 @@
+#ifndef EMUL_INTERPRETER_COMPILED_BLOCK_HPP
+#define EMUL_INTERPRETER_COMPILED_BLOCK_HPP
+
+#include <medusa/namespace.hpp>
+#include <medusa/types.hpp>
+#include <medusa/address.hpp>
+#include <medusa/expression.hpp>
+#include <medusa/information.hpp>
+#include <medusa/context.hpp>
+
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+MEDUSA_NAMESPACE_USE
+
+//! CompiledBlock holds the semantic of a basic block compiled once into an array of pre-decoded operations.
+//! Every value is a u64 slot of the block with a bit size known at compile time, registers and memory
+//! accesses have their width resolved and system expressions are decoded, so executing the block doesn't
+//! allocate. Branches are compiled to jumps: only the taken branch is evaluated, like the tree walker does.
+//! Registers described by the cpu context are directly accessed in the context with a load and a mask.
+//! An expression which can't be compiled (vector identifiers, floating point operations, values larger than
+//! 64-bit...) is kept as a Walk operation and is evaluated by the tree walker of the interpreter.
+class CompiledBlock
+{
+public:
+  typedef std::shared_ptr<CompiledBlock> SPType;
+
+  static u32 const NoValue = 0xffffffff;
+
+  enum Code : u8
+  {
+    ReadReg,   //!< %dst = register Imm
+    WriteReg,  //!< register Imm = %src0
+    LoadReg,   //!< %dst = context[descriptors[Imm]]
+    StoreReg,  //!< context[descriptors[Imm]] = %src0
+    Load,      //!< %dst = memory[%src1:%src0]
+    Store,     //!< memory[%src1:%src0] = %src2
+    AddressOf, //!< %dst = linear address of %src1:%src0
+    UnOp,      //!< %dst = Type %src0
+    BinOp,     //!< %dst = %src0 Type %src1
+    Move,      //!< %dst = %src0
+    JumpIfNot, //!< if !(%src0 Type %src1) goto Imm
+    Jump,      //!< goto Imm
+    InsnCb,    //!< call the instruction callback with addresses[Imm]
+    ExecHook,  //!< call the hook on execution of the current address
+    Stop,      //!< stop the execution
+    Walk,      //!< evaluate expressions[Imm] with the tree walker
+  };
+
+  struct Operation
+  {
+    u8  m_Code;
+    u8  m_Type;          // OperationExpression::Type or ConditionExpression::Type
+    u16 m_BitSize;       // Bit size of the result, or of the accessed register or memory
+    u16 m_SrcBitSize[2];
+    u32 m_Dst;
+    u32 m_Src[3];
+    u64 m_Imm;
+  };
+
+  typedef std::vector<Operation> OperationVector;
+
+  CompiledBlock(CpuContext const& rCpuCtxt);
+
+  //! This method returns false if the block must be entirely evaluated by the tree walker.
+  bool Compile(Expression::VSPType const& rExprs);
+
+  OperationVector const& GetOperations(void)  const { return m_Ops; }
+  u64*                   GetValues(void)            { return m_Values.data(); }
+  Address const&         GetAddress(u64 Idx)  const { return m_Addrs[static_cast<size_t>(Idx)]; }
+  Expression::SPType     GetExpression(u64 Idx) const { return m_Exprs[static_cast<size_t>(Idx)]; }
+  CpuContext::RegisterDescriptor const& GetRegisterDescriptor(u64 Idx) const { return m_RegDescs[static_cast<size_t>(Idx)]; }
+
+  //! These methods compute an operation like BitVector does for values up to 64-bit.
+  //! Values are zero-extended to 64-bit, they return false on division by zero.
+  static bool ComputeUnaryOperation(Operation const& rOp, u64 Val, u64& rRes);
+  static bool ComputeBinaryOperation(Operation const& rOp, u64 Left, u64 Right, u64& rRes);
+  static bool Compare(Operation const& rOp, u64 Ref, u64 Test);
+
+private:
+  bool _CompileStatement(Expression::SPType spExpr);
+  bool _CompileAssignment(AssignmentExpression::SPType spAssignExpr);
+  bool _CompileCondition(ConditionExpression::SPType spCondExpr, size_t& rJumpIdx);
+  bool _CompileAddress(MemoryExpression::SPType spMemExpr, u32& rOffVal, u32& rBaseVal);
+  u32  _CompileValue(Expression::SPType spExpr);
+
+  u32    _AddValue(u32 BitSize, u64 InitValue = 0);
+  size_t _Emit(u8 Code, u8 Type, u32 BitSize, u32 Dst, u32 Src0 = NoValue, u32 Src1 = NoValue, u32 Src2 = NoValue, u64 Imm = 0);
+  void   _PatchJump(size_t JumpIdx) { m_Ops[JumpIdx].m_Imm = m_Ops.size(); }
+  bool   _IsRegisterSupported(u32 RegId, u32 BitSize) const;
+  u32    _AddRegisterDescriptor(u32 RegId, u32 BitSize);
+
+  struct Variable
+  {
+    u32 m_Value;
+    u32 m_BitSize; // 0 until the variable is assigned
+  };
+  typedef std::unordered_map<std::string, Variable> VariableMapType;
+
+  CpuContext const&     m_rCpuCtxt;
+  CpuInformation const& m_rCpuInfo;
+  OperationVector       m_Ops;
+  std::vector<u64>      m_Values;
+  std::vector<u16>      m_ValueBitSizes;
+  std::vector<Address>  m_Addrs;
+  Expression::VSPType   m_Exprs;
+  VariableMapType       m_Vars;
+  std::vector<CpuContext::RegisterDescriptor> m_RegDescs;
+};
+
+#endif // !EMUL_INTERPRETER_COMPILED_BLOCK_HPP
@@ -18,8 +18,9 @@ Emulator::ReturnType InterpreterEmulator::Execute(Expression::VSPType const& rEx
 {
   for (Expression::SPType spExpr : rExprs)
   {
-    if (auto spSys = expr_cast<SystemExpression>(spExpr))
+    if (spExpr->GetClassKind() == Expression::Sys)
     {
+      auto spSys = std::static_pointer_cast<SystemExpression>(spExpr);
       if (spSys->GetName() == "call_insn_cb")
       {
         if (m_InsnCb)
@@ -50,12 +51,236 @@ Emulator::ReturnType InterpreterEmulator::Execute(Expression::VSPType const& rEx
       }
     }
 
-    InterpreterExpressionVisitor Visitor(m_Hooks, m_pCpuCtxt, m_pMemCtxt, m_Vars);
-    auto spCurExpr = spExpr->Visit(&Visitor);
-    if (spCurExpr == nullptr)
+    auto EmulRet = _Walk(spExpr);
+    if (EmulRet != Continue)
+      return EmulRet;
+  }
+
+  return Continue;
+}
+
+Emulator::ReturnType InterpreterEmulator::Execute(Address const& rAddress)
+{
+  // Keep a reference since a hook is allowed to invalidate the cache
+  CompiledBlock::SPType spBlk;
+  auto itBlk = m_CompiledBlocks.find(rAddress);
+  if (itBlk != std::end(m_CompiledBlocks))
+    spBlk = itBlk->second;
+  else
+  {
+    auto pExprs = _GetSemantic(rAddress);
+    if (pExprs == nullptr)
+      return Error;
+    spBlk = std::make_shared<CompiledBlock>(*m_pCpuCtxt);
+    if (!spBlk->Compile(*pExprs))
+      spBlk = nullptr;
+    m_CompiledBlocks[rAddress] = spBlk;
+  }
+
+  if (spBlk == nullptr)
+    return Emulator::Execute(rAddress);
+
+  return _Execute(*spBlk);
+}
+
+bool InterpreterEmulator::InvalidateCache(void)
+{
+  _InvalidSemantics();
+  return true;
+}
+
+void InterpreterEmulator::_ResetBlocks(void)
+{
+  // Execute keeps a reference on the running block
+  m_CompiledBlocks.clear();
+}
+
+namespace
+{
+  template<typename _Ty>
+  bool ReadRegisterValue(CpuContext const& rCpuCtxt, u32 Reg, u32 BitSize, u64& rVal)
+  {
+    _Ty RegVal = 0;
+    if (!rCpuCtxt.ReadRegister(Reg, &RegVal, BitSize))
+      return false;
+    rVal = RegVal;
+    return true;
+  }
+
+  template<typename _Ty>
+  bool WriteRegisterValue(CpuContext& rCpuCtxt, u32 Reg, u32 BitSize, u64 Val)
+  {
+    auto RegVal = static_cast<_Ty>(Val);
+    return rCpuCtxt.WriteRegister(Reg, &RegVal, BitSize);
+  }
+
+  template<typename _Ty>
+  bool ReadMemoryValue(MemoryTlb& rMemTlb, MemoryContext const& rMemCtxt, u64 LinAddr, u64& rVal)
+  {
+    _Ty MemVal = 0;
+    if (!rMemTlb.Read(rMemCtxt, LinAddr, &MemVal, sizeof(MemVal)))
+      return false;
+    rVal = MemVal;
+    return true;
+  }
+
+  template<typename _Ty>
+  bool WriteMemoryValue(MemoryTlb& rMemTlb, MemoryContext& rMemCtxt, u64 LinAddr, u64 Val)
+  {
+    auto MemVal = static_cast<_Ty>(Val);
+    return rMemTlb.Write(rMemCtxt, LinAddr, &MemVal, sizeof(MemVal));
+  }
+}
+
+Emulator::ReturnType InterpreterEmulator::_Execute(CompiledBlock& rBlk)
+{
+  auto const& rOps = rBlk.GetOperations();
+  u64* pVals = rBlk.GetValues();
+  size_t NrOfOps = rOps.size();
+  auto pCpuCtxtAddr = m_pCpuCtxt->GetContextAddress();
+
+  for (size_t OpIdx = 0; OpIdx < NrOfOps;)
+  {
+    auto const& rOp = rOps[OpIdx++];
+    switch (rOp.m_Code)
+    {
+    case CompiledBlock::ReadReg:
+    {
+      auto Reg = static_cast<u32>(rOp.m_Imm);
+      bool Res = false;
+      switch (rOp.m_BitSize)
+      {
+      case  1:
+      case  8: Res = ReadRegisterValue< u8>(*m_pCpuCtxt, Reg, rOp.m_BitSize, pVals[rOp.m_Dst]); break;
+      case 16: Res = ReadRegisterValue<u16>(*m_pCpuCtxt, Reg, rOp.m_BitSize, pVals[rOp.m_Dst]); break;
+      case 32: Res = ReadRegisterValue<u32>(*m_pCpuCtxt, Reg, rOp.m_BitSize, pVals[rOp.m_Dst]); break;
+      case 64: Res = ReadRegisterValue<u64>(*m_pCpuCtxt, Reg, rOp.m_BitSize, pVals[rOp.m_Dst]); break;
+      }
+      if (!Res)
+      {
+        Log::Write("emul_interpreter").Level(LogError) << "unable to read register " << m_pCpuCtxt->GetCpuInformation().ConvertIdentifierToName(Reg) << LogEnd;
+        return Error;
+      }
+      break;
+    }
+
+    case CompiledBlock::LoadReg:
+      pVals[rOp.m_Dst] = CpuContext::LoadRegister(rBlk.GetRegisterDescriptor(rOp.m_Imm), pCpuCtxtAddr);
+      break;
+
+    case CompiledBlock::StoreReg:
+      CpuContext::StoreRegister(rBlk.GetRegisterDescriptor(rOp.m_Imm), pCpuCtxtAddr, pVals[rOp.m_Src[0]]);
+      break;
+
+    case CompiledBlock::WriteReg:
+    {
+      auto Reg = static_cast<u32>(rOp.m_Imm);
+      auto Val = pVals[rOp.m_Src[0]];
+      bool Res = false;
+      switch (rOp.m_BitSize)
+      {
+      case  1:
+      case  8: Res = WriteRegisterValue< u8>(*m_pCpuCtxt, Reg, rOp.m_BitSize, Val); break;
+      case 16: Res = WriteRegisterValue<u16>(*m_pCpuCtxt, Reg, rOp.m_BitSize, Val); break;
+      case 32: Res = WriteRegisterValue<u32>(*m_pCpuCtxt, Reg, rOp.m_BitSize, Val); break;
+      case 64: Res = WriteRegisterValue<u64>(*m_pCpuCtxt, Reg, rOp.m_BitSize, Val); break;
+      }
+      if (!Res)
+      {
+        Log::Write("emul_interpreter").Level(LogError) << "unable to write register " << m_pCpuCtxt->GetCpuInformation().ConvertIdentifierToName(Reg) << LogEnd;
+        return Error;
+      }
+      break;
+    }
+
+    case CompiledBlock::Load:
+    {
+      u64 Base = rOp.m_Src[1] != CompiledBlock::NoValue ? pVals[rOp.m_Src[1]] : 0;
+      if (!_ReadMemory(Base, pVals[rOp.m_Src[0]], rOp.m_BitSize, pVals[rOp.m_Dst]))
+        return Error;
+      break;
+    }
+
+    case CompiledBlock::Store:
+    {
+      u64 Base = rOp.m_Src[1] != CompiledBlock::NoValue ? pVals[rOp.m_Src[1]] : 0;
+      if (!_WriteMemory(Base, pVals[rOp.m_Src[0]], rOp.m_BitSize, pVals[rOp.m_Src[2]]))
+        return Error;
+      break;
+    }
+
+    case CompiledBlock::AddressOf:
     {
-      std::cout << m_pCpuCtxt->ToString() << std::endl;
-      std::cout << spExpr->ToString() << std::endl;
+      u64 Base = rOp.m_Src[1] != CompiledBlock::NoValue ? pVals[rOp.m_Src[1]] : 0;
+      u64 LinAddr = _GetLinearAddress(Base, pVals[rOp.m_Src[0]]);
+      pVals[rOp.m_Dst] = rOp.m_BitSize >= 64 ? LinAddr : LinAddr & ((static_cast<u64>(1) << rOp.m_BitSize) - 1);
+      break;
+    }
+
+    case CompiledBlock::UnOp:
+      if (!CompiledBlock::ComputeUnaryOperation(rOp, pVals[rOp.m_Src[0]], pVals[rOp.m_Dst]))
+      {
+        Log::Write("emul_interpreter").Level(LogError) << "unknown unary operator" << LogEnd;
+        return Error;
+      }
+      break;
+
+    case CompiledBlock::BinOp:
+      if (!CompiledBlock::ComputeBinaryOperation(rOp, pVals[rOp.m_Src[0]], pVals[rOp.m_Src[1]], pVals[rOp.m_Dst]))
+      {
+        Log::Write("emul_interpreter").Level(LogError) << "division by zero" << LogEnd;
+        return Error;
+      }
+      break;
+
+    case CompiledBlock::Move:
+      pVals[rOp.m_Dst] = pVals[rOp.m_Src[0]];
+      break;
+
+    case CompiledBlock::JumpIfNot:
+      if (!CompiledBlock::Compare(rOp, pVals[rOp.m_Src[0]], pVals[rOp.m_Src[1]]))
+        OpIdx = static_cast<size_t>(rOp.m_Imm);
+      break;
+
+    case CompiledBlock::Jump:
+      OpIdx = static_cast<size_t>(rOp.m_Imm);
+      break;
+
+    case CompiledBlock::InsnCb:
+      if (m_InsnCb)
+      {
+        auto EmulRet = m_InsnCb(m_pCpuCtxt, m_pMemCtxt, rBlk.GetAddress(rOp.m_Imm));
+        if (EmulRet != Continue)
+          return EmulRet;
+      }
+      break;
+
+    case CompiledBlock::ExecHook:
+    {
+      Address CurAddr;
+      if (!m_pCpuCtxt->GetAddress(CpuContext::AddressExecution, CurAddr))
+        return Error;
+      // HACK(KS):
+      CurAddr.SetBase(0x0);
+      auto EmulRet = CallHookOnExecutionIfNeeded(CurAddr);
+      if (EmulRet != Continue)
+        return EmulRet;
+      break;
+    }
+
+    case CompiledBlock::Stop:
+      return Error;
+
+    case CompiledBlock::Walk:
+    {
+      auto EmulRet = _Walk(rBlk.GetExpression(rOp.m_Imm));
+      if (EmulRet != Continue)
+        return EmulRet;
+      break;
+    }
+
+    default:
+      Log::Write("emul_interpreter").Level(LogError) << "unknown compiled operation" << LogEnd;
       return Error;
     }
   }
@@ -63,6 +288,60 @@ Emulator::ReturnType InterpreterEmulator::Execute(Expression::VSPType const& rEx
   return Continue;
 }
 
+Emulator::ReturnType InterpreterEmulator::_Walk(Expression::SPType spExpr)
+{
+  InterpreterExpressionVisitor Visitor(m_Hooks, m_pCpuCtxt, m_pMemCtxt, m_Vars);
+  auto spCurExpr = spExpr->Visit(&Visitor);
+  if (spCurExpr == nullptr)
+  {
+    std::cout << m_pCpuCtxt->ToString() << std::endl;
+    std::cout << spExpr->ToString() << std::endl;
+    return Error;
+  }
+  return Continue;
+}
+
+bool InterpreterEmulator::_ReadMemory(u64 Base, u64 Offset, u32 BitSize, u64& rVal)
+{
+  u64 LinAddr = _GetLinearAddress(Base, Offset);
+  bool Res = false;
+  switch (BitSize)
+  {
+  case  8: Res = ReadMemoryValue< u8>(m_MemTlb, *m_pMemCtxt, LinAddr, rVal); break;
+  case 16: Res = ReadMemoryValue<u16>(m_MemTlb, *m_pMemCtxt, LinAddr, rVal); break;
+  case 32: Res = ReadMemoryValue<u32>(m_MemTlb, *m_pMemCtxt, LinAddr, rVal); break;
+  case 64: Res = ReadMemoryValue<u64>(m_MemTlb, *m_pMemCtxt, LinAddr, rVal); break;
+  }
+  if (!Res)
+    Log::Write("emul_interpreter").Level(LogError) << "unable to read memory at address: " << LinAddr << LogEnd;
+  return Res;
+}
+
+bool InterpreterEmulator::_WriteMemory(u64 Base, u64 Offset, u32 BitSize, u64 Val)
+{
+  u64 LinAddr = _GetLinearAddress(Base, Offset);
+  bool Res = false;
+  switch (BitSize)
+  {
+  case  8: Res = WriteMemoryValue< u8>(m_MemTlb, *m_pMemCtxt, LinAddr, Val); break;
+  case 16: Res = WriteMemoryValue<u16>(m_MemTlb, *m_pMemCtxt, LinAddr, Val); break;
+  case 32: Res = WriteMemoryValue<u32>(m_MemTlb, *m_pMemCtxt, LinAddr, Val); break;
+  case 64: Res = WriteMemoryValue<u64>(m_MemTlb, *m_pMemCtxt, LinAddr, Val); break;
+  }
+  if (!Res)
+    Log::Write("emul_interpreter").Level(LogError) << "unable to write memory at address: " << LinAddr << LogEnd;
+  return Res;
+}
+
+u64 InterpreterEmulator::_GetLinearAddress(u64 Base, u64 Offset) const
+{
+  Address Addr(static_cast<BaseType>(Base), Offset);
+  u64 LinAddr = 0;
+  if (!m_pCpuCtxt->Translate(Addr, LinAddr))
+    LinAddr = Offset;
+  return LinAddr;
+}
+
 InterpreterEmulator::InterpreterExpressionVisitor::~InterpreterExpressionVisitor(void)
 {
   if (!m_Values.empty())
@@ -271,6 +550,22 @@ Expression::SPType InterpreterEmulator::InterpreterExpressionVisitor::VisitBinar
   auto LeftVal = m_Values.back();
   m_Values.pop_back();
 
+  // Report a division by zero like the compiled operations instead of letting the bit vector throw
+  switch (spBinOpExpr->GetOperation())
+  {
+    case OperationExpression::OpSDiv: case OperationExpression::OpUDiv:
+    case OperationExpression::OpSMod: case OperationExpression::OpUMod:
+      if (RightVal.IsZero())
+      {
+        Log::Write("emul_interpreter").Level(LogError) << "division by zero" << LogEnd;
+        return nullptr;
+      }
+      break;
+
+    default:
+      break;
+  }
+
   switch (spBinOpExpr->GetOperation())
   {
     case OperationExpression::OpAnd:
@@ -696,43 +991,43 @@ bool InterpreterEmulator::InterpreterExpressionVisitor::_EvaluateComparison(u8 C
   switch (CondOp)
   {
   case ConditionExpression::CondEq:
-    rRes = RefVal.GetUnsignedValue() == TestVal.GetUnsignedValue();
+    rRes = RefVal.UCmp(TestVal) == 0;
     break;
 
   case ConditionExpression::CondNe:
-    rRes = RefVal.GetUnsignedValue() != TestVal.GetUnsignedValue();
+    rRes = RefVal.UCmp(TestVal) != 0;
     break;
 
   case ConditionExpression::CondUgt:
-    rRes = RefVal.GetUnsignedValue() > TestVal.GetUnsignedValue();
+    rRes = RefVal.UCmp(TestVal) > 0;
     break;
 
   case ConditionExpression::CondUge:
-    rRes = RefVal.GetUnsignedValue() >= TestVal.GetUnsignedValue();
+    rRes = RefVal.UCmp(TestVal) >= 0;
     break;
 
   case ConditionExpression::CondUlt:
-    rRes = RefVal.GetUnsignedValue() < TestVal.GetUnsignedValue();
+    rRes = RefVal.UCmp(TestVal) < 0;
     break;
 
   case ConditionExpression::CondUle:
-    rRes = RefVal.GetUnsignedValue() <= TestVal.GetUnsignedValue();
+    rRes = RefVal.UCmp(TestVal) <= 0;
     break;
 
   case ConditionExpression::CondSgt:
-    rRes = RefVal.GetSignedValue() > TestVal.GetSignedValue();
+    rRes = RefVal.SCmp(TestVal) > 0;
     break;
 
   case ConditionExpression::CondSge:
-    rRes = RefVal.GetSignedValue() >= TestVal.GetSignedValue();
+    rRes = RefVal.SCmp(TestVal) >= 0;
     break;
 
   case ConditionExpression::CondSlt:
-    rRes = RefVal.GetSignedValue() < TestVal.GetSignedValue();
+    rRes = RefVal.SCmp(TestVal) < 0;
     break;
 
   case ConditionExpression::CondSle:
-    rRes = RefVal.GetSignedValue() <= TestVal.GetSignedValue();
+    rRes = RefVal.SCmp(TestVal) <= 0;
     break;
 
   default:
@@ -3,6 +3,8 @@
 
 #include <medusa/emulation.hpp>
 
+#include "compiled_block.hpp"
+
 #if defined(_WIN32) || defined(WIN32)
 # ifdef emul_interpreter_EXPORTS
 #  define EMUL_INTERPRETER_EXPORT __declspec(dllexport)
@@ -26,10 +28,25 @@ public:
   virtual std::string GetName(void) const { return "interpreter"; }
 
   virtual ReturnType Execute(Expression::VSPType const& rExprs);
+  virtual ReturnType Execute(Address const& rAddress);
+
+  virtual bool InvalidateCache(void);
 
 protected:
+  virtual void _ResetBlocks(void);
+
+  ReturnType _Execute(CompiledBlock& rBlk);
+  ReturnType _Walk(Expression::SPType spExpr);
+  bool       _ReadMemory(u64 Base, u64 Offset, u32 BitSize, u64& rVal);
+  bool       _WriteMemory(u64 Base, u64 Offset, u32 BitSize, u64 Val);
+  u64        _GetLinearAddress(u64 Base, u64 Offset) const;
+
   std::unordered_map<std::string, BitVector> m_Vars;
 
+  // Blocks are compiled once from the semantic cache, nullptr means the block is only interpreted by the tree walker
+  typedef std::unordered_map<Address, CompiledBlock::SPType> CompiledBlockCacheType;
+  CompiledBlockCacheType m_CompiledBlocks;
+
 private:
   class InterpreterExpressionVisitor : public ExpressionVisitor
   {
@@ -15,8 +15,22 @@
 
 #include <llvm/Support/DynamicLibrary.h>
 
+#include <llvm/Analysis/BasicAliasAnalysis.h>
+#include <llvm/Transforms/InstCombine/InstCombine.h>
+#include <llvm/Transforms/Scalar/GVN.h>
+#include <llvm/Transforms/Utils.h>
+
+#include <algorithm>
+
 MEDUSA_NAMESPACE_USE
 
+// LLVM doesn't provide a global context anymore, this one is shared by all JIT'ed modules
+static llvm::LLVMContext& GetLlvmContext(void)
+{
+  static llvm::LLVMContext s_LlvmCtxt;
+  return s_LlvmCtxt;
+}
+
 // This function allows the JIT'ed code to read from a register
 extern "C" EMUL_LLVM_EXPORT bool JitReadRegister(CpuContext* pCpuCtxt, u32 Reg, void* pVal, u32 BitSize)
 {
@@ -57,30 +71,10 @@ extern "C" EMUL_LLVM_EXPORT u64 JitTranslateAddress(u8* pCpuCtxtObj, BaseType Ba
 static llvm::Function* s_pTranslateAddressFunc;
 
 // This function allows the JIT'ed code to access to memory
-extern "C" EMUL_LLVM_EXPORT void* JitGetMemory(u8* pCpuCtxtObj, u8* pMemCtxtObj, BaseType Base, OffsetType Offset, u32 BitSize)
+extern "C" EMUL_LLVM_EXPORT void* JitGetMemory(u8* pEmulObj, BaseType Base, OffsetType Offset, u32 BitSize, u8 Access)
 {
-  auto pCpuCtxt = reinterpret_cast<CpuContext*>(pCpuCtxtObj);
-  auto pMemCtxt = reinterpret_cast<MemoryContext*>(pMemCtxtObj);
-  void* pMemory;
-
-  Address CurAddr(Base, Offset);
-  u64 LinAddr;
-  if (!pCpuCtxt->Translate(CurAddr, LinAddr))
-  {
-    Log::Write("emul_llvm").Level(LogWarning) << "unable to translate address " << CurAddr << LogEnd;
-    return nullptr;
-  }
-
-  u32 MemOff;
-  u32 MemSize;
-  MemoryArea::Access Flags;
-  if (!pMemCtxt->FindMemory(LinAddr, pMemory, MemOff, MemSize, Flags))
-  {
-    Log::Write("emul_llvm").Level(LogWarning) << "invalid memory access: linear address: " << LinAddr << LogEnd;
-    return nullptr;
-  }
-
-  return reinterpret_cast<u8*>(pMemory) + MemOff;
+  auto pEmul = reinterpret_cast<LlvmEmulator*>(pEmulObj);
+  return pEmul->GetMemory(Address(Base, Offset), BitSize, static_cast<MemoryArea::Access>(Access));
 }
 
 static llvm::Function* s_pGetMemoryFunc = nullptr;
@@ -149,7 +143,8 @@ extern "C" EMUL_LLVM_EXPORT __m128 __udivti3(__m128 a, __m128 b)
 
 LlvmEmulator::LlvmEmulator(CpuInformation const* pCpuInfo, CpuContext* pCpuCtxt, MemoryContext *pMemCtxt)
   : Emulator(pCpuInfo, pCpuCtxt, pMemCtxt)
-  , m_Builder(llvm::getGlobalContext())
+  , m_Builder(GetLlvmContext())
+  , m_BlocksGeneration(0), m_NrOfFunctions(0)
 {
   llvm::InitializeNativeTarget();
   llvm::InitializeNativeTargetAsmPrinter();
@@ -169,232 +164,411 @@ Emulator::ReturnType LlvmEmulator::Execute(Address const& rAddress)
   Address ExecAddr = rAddress;
   if (!m_pCpuCtxt->SetAddress(CpuContext::AddressExecution, ExecAddr))
     return Error;
-  u64 LinAddr;
-  if (!m_pCpuCtxt->Translate(ExecAddr, LinAddr))
+
+  auto pBlk = _GetBlock(ExecAddr);
+  if (pBlk == nullptr)
     return Error;
 
-  // Check if the code to be executed is already JIT'ed
-  auto pCode = m_FunctionCache[LinAddr];
-  if (pCode == nullptr)
+  // Blocks are chained until a hook stops the execution, so the loop of the caller is only
+  // run every MaxChainedBlocks blocks
+  auto BlksGen = m_BlocksGeneration;
+  for (u32 NrOfBlks = 1;; ++NrOfBlks)
   {
-    Expression::VSPType Exprs;
-    Expression::LSPType JitExprs;
+    auto pCode = pBlk->m_pCode;
+    bool IsTrace = pBlk->m_pTraceCode != nullptr;
+    if (IsTrace)
+      pCode = pBlk->m_pTraceCode;
+    else if (++pBlk->m_ExecCount == HotBlockThreshold && !_FormTrace(*pBlk))
+      pBlk->m_ExecCount = 0;
+
+    // call_insn_cb and check_exec_hook can return something else than Continue
+    auto EmulRet = static_cast<ReturnType>(pCode(reinterpret_cast<u8*>(m_pCpuCtxt), reinterpret_cast<u8*>(m_pMemCtxt)));
+    if (EmulRet != Continue)
+      return EmulRet;
+
+    Address NextAddr;
+    if (!m_pCpuCtxt->GetAddress(CpuContext::AddressExecution, NextAddr))
+      return Error;
 
-    // Disassemble code and retrieve semantic
-    _Disassemble(ExecAddr, [&](Address const& rInsnAddr, Instruction& rCurInsn, Architecture& rCurArch, u8 CurMode)
+    if (!m_Hooks.empty())
     {
-      // Check if we have a hook before updating the current address
-      if (m_Hooks.find(rInsnAddr) != std::end(m_Hooks))
-      {
-        Exprs.push_back(Expr::MakeSys("jit_restore_ctxt", rInsnAddr));
-        Exprs.push_back(Expr::MakeSys("check_exec_hook", rInsnAddr));
-      }
+      Address HookAddr = NextAddr;
+      HookAddr.SetBase(0x0); // HACK(KS)
+      EmulRet = CallHookOnExecutionIfNeeded(HookAddr);
+      if (EmulRet != Continue)
+        return EmulRet;
+
+      // The hook is allowed to modify the execution address
+      if (!m_pCpuCtxt->GetAddress(CpuContext::AddressExecution, NextAddr))
+        return Error;
+    }
 
-      if (m_InsnCb)
-      {
-        Exprs.push_back(Expr::MakeSys("call_insn_cb", rInsnAddr));
-      }
+    // Blocks are no longer valid if a hook modified the cache
+    if (BlksGen != m_BlocksGeneration || NrOfBlks == MaxChainedBlocks)
+      break;
 
-      // Set the current IP/PC address
-      auto CurAddr = rCurArch.CurrentAddress(rInsnAddr, rCurInsn);
-      if (!rCurArch.EmitSetExecutionAddress(Exprs, CurAddr, CurMode))
-        return false;
+    // A trace can be left before its last block, so its exit is resolved without the links of its tail
+    pBlk = IsTrace ? _GetBlock(NextAddr) : _FollowLink(*pBlk, NextAddr);
+    // The caller reports the block which can't be translated
+    if (pBlk == nullptr)
+      break;
+  }
 
-      // Check for missing instruction semantic
-      auto const& rCurInsnSem = rCurInsn.GetSemantic();
-      if (rCurInsnSem.empty())
-      {
-        Log::Write("emul_llvm").Level(LogError) << "failed to find instruction semantic at " << rInsnAddr << LogEnd;
-        Log::Write("emul_llvm").Level(LogError) << "details: " << rCurInsn.ToString() << LogEnd;
-        Exprs.clear();
-        return false;
-      }
+  return Continue;
+}
 
-      for (auto spExpr : rCurInsnSem)
-      {
-        if (auto spSysExpr = expr_cast<SystemExpression>(spExpr))
-        {
-          auto const& rSysName = spSysExpr->GetName();
-          // Don't bother to continue if a "stop" is asked
-          if (rSysName == "stop")
-          {
-            Log::Write("emul_llvm").Level(LogWarning) << "stop asked at " << rInsnAddr << LogEnd;
-            Exprs.clear();
-            return false;
-          }
-        }
+bool LlvmEmulator::InvalidateCache(void)
+{
+  m_JitHelper = LlvmJitHelper();
+  _ResetBlocks();
+  return true;
+}
 
-        Exprs.push_back(spExpr);
-      }
+LlvmEmulator::TranslatedBlock* LlvmEmulator::_GetBlock(Address const& rAddress)
+{
+  u64 LinAddr;
+  if (!m_pCpuCtxt->Translate(rAddress, LinAddr))
+    return nullptr;
+
+  // Check if the code to be executed is already JIT'ed
+  auto itBlk = m_Blocks.find(LinAddr);
+  if (itBlk != std::end(m_Blocks))
+    return &itBlk->second;
+
+  TranslatedBlock Blk;
+  Blk.m_Addr        = rAddress;
+  Blk.m_pCode       = nullptr;
+  Blk.m_pTraceCode  = nullptr;
+  Blk.m_Links[0]    = { Address(), nullptr };
+  Blk.m_Links[1]    = { Address(), nullptr };
+  Blk.m_LastLinkIdx = 0;
+  Blk.m_ExecCount   = 0;
+
+  if (!_TranslateBlock(rAddress, Blk.m_JitExprs))
+    return nullptr;
 
-      // Jump, Call, Return types finish the block
-      if (rCurInsn.GetSubType() & (Instruction::JumpType | Instruction::CallType | Instruction::ReturnType))
-        return false;
+  Blk.m_pCode = _CompileBlocks(rAddress.ToString(), { &Blk });
+  if (Blk.m_pCode == nullptr)
+    return nullptr;
 
-      return true;
-    });
+  // References to elements of an unordered_map stay valid when it's rehashed, so links aren't broken
+  return &(m_Blocks[LinAddr] = std::move(Blk));
+}
 
-    if (Exprs.empty())
+LlvmEmulator::TranslatedBlock* LlvmEmulator::_FollowLink(TranslatedBlock& rBlk, Address const& rNextAddr)
+{
+  for (u8 LinkIdx = 0; LinkIdx < 2; ++LinkIdx)
+  {
+    auto const& rLink = rBlk.m_Links[LinkIdx];
+    if (rLink.m_pBlock != nullptr && rLink.m_Addr == rNextAddr)
     {
-      Log::Write("emul_llvm").Level(LogError) << "failed to disassemble code at " << ExecAddr << LogEnd;
-      Exprs.clear();
-      return Error;
+      rBlk.m_LastLinkIdx = LinkIdx;
+      return rLink.m_pBlock;
     }
+  }
 
-    // Instruction callback must be called. To do so, we have to disable JIT optimization
-    if (m_InsnCb)
-    {
-      Log::Write("emul_llvm").Level(LogDebug) << "instruction hook detected, disable optimization" << LogEnd;
+  auto pNextBlk = _GetBlock(rNextAddr);
+  if (pNextBlk == nullptr)
+    return nullptr;
+
+  // Fill an empty link, otherwise replace the one which wasn't followed last time
+  u8 LinkIdx;
+  if (rBlk.m_Links[0].m_pBlock == nullptr)
+    LinkIdx = 0;
+  else if (rBlk.m_Links[1].m_pBlock == nullptr)
+    LinkIdx = 1;
+  else
+    LinkIdx = rBlk.m_LastLinkIdx ^ 1;
+  rBlk.m_Links[LinkIdx] = { rNextAddr, pNextBlk };
+  rBlk.m_LastLinkIdx = LinkIdx;
+  return pNextBlk;
+}
 
-      for (auto spExpr : Exprs)
-        JitExprs.push_back(spExpr);
+bool LlvmEmulator::_TranslateBlock(Address const& rAddress, Expression::LSPType& rJitExprs)
+{
+  Expression::VSPType Exprs;
+  InstructionFlagsVector InsnsFlags;
+  std::vector<Address> SuccAddrs;
+
+  // Disassemble code and retrieve semantic
+  _Disassemble(rAddress, [&](Address const& rInsnAddr, Instruction& rCurInsn, Architecture& rCurArch, u8 CurMode)
+  {
+    // Check if we have a hook before updating the current address, Execute calls the hook of the
+    // first instruction when the block is reached so it's called once per visit
+    if (rInsnAddr != rAddress && m_Hooks.find(rInsnAddr) != std::end(m_Hooks))
+    {
+      Exprs.push_back(Expr::MakeSys("jit_restore_ctxt", rInsnAddr));
+      Exprs.push_back(Expr::MakeSys("check_exec_hook", rInsnAddr));
     }
 
-    // ...if not, we can freely make expressions more JIT friendly
-    else
+    if (m_InsnCb)
     {
-      Log::Write("emul_llvm").Level(LogDebug) << "no instruction hook detected, enable optimization" << LogEnd;
+      Exprs.push_back(Expr::MakeSys("call_insn_cb", rInsnAddr));
+    }
 
-      // This visitor will normalize id if needed
-      NormalizeIdentifier NrmId(m_pCpuCtxt->GetCpuInformation(), m_pCpuCtxt->GetMode());
+    // Set the current IP/PC address
+    auto CurAddr = rCurArch.CurrentAddress(rInsnAddr, rCurInsn);
+    if (!rCurArch.EmitSetExecutionAddress(Exprs, CurAddr, CurMode))
+      return false;
 
-      // This visitor will replace id to variable
-      IdentifierToVariable Id2Var;
+    // Check for missing instruction semantic
+    auto const& rCurInsnSem = rCurInsn.GetSemantic();
+    if (rCurInsnSem.empty())
+    {
+      Log::Write("emul_llvm").Level(LogError) << "failed to find instruction semantic at " << rInsnAddr << LogEnd;
+      Log::Write("emul_llvm").Level(LogError) << "details: " << rCurInsn.ToString() << LogEnd;
+      Exprs.clear();
+      return false;
+    }
 
-      // Change the code to make it more JIT friendly
-      for (auto spExpr : Exprs)
+    InsnsFlags.push_back({ Exprs.size(), rCurInsnSem.size(), rCurInsn.GetTestedFlags(),
+      rCurInsn.GetUpdatedFlags() | rCurInsn.GetClearedFlags() | rCurInsn.GetFixedFlags() });
+    for (auto spExpr : rCurInsnSem)
+    {
+      if (spExpr->GetClassKind() == Expression::Sys)
       {
-        if (auto spSysExpr = expr_cast<SystemExpression>(spExpr))
-        {
-          auto const& rSysName = spSysExpr->GetName();
-          // jit_restore_ctxt forces id in variable to be write back in context
-          if (rSysName == "jit_restore_ctxt")
-          {
-            for (auto Id : Id2Var.GetUsedId())
-            {
-              auto const& rCpuInfo = m_pCpuCtxt->GetCpuInformation();
-              auto IdName = rCpuInfo.ConvertIdentifierToName(Id);
-              JitExprs.push_back(Expr::MakeAssign(
-                Expr::MakeId(Id, &rCpuInfo),
-                Expr::MakeVar(IdName, VariableExpression::Use)));
-            }
-            continue;
-          }
-        }
-
-        // Normalize Id (e.g. al → eax in 32-bit, al → rax in 64-bit)
-        auto spNrmExpr = spExpr->Visit(&NrmId);
-        if (spNrmExpr == nullptr)
-        {
-          Log::Write("emul_llvm").Level(LogError) << "failed to normalize id with expression: " << spExpr->ToString() << LogEnd;
-          Exprs.clear();
-          return Error;
-        }
-
-        // Id to var
-        auto spId2Var = spNrmExpr->Visit(&Id2Var);
-        if (spId2Var == nullptr)
+        auto spSysExpr = std::static_pointer_cast<SystemExpression>(spExpr);
+        auto const& rSysName = spSysExpr->GetName();
+        // Don't bother to continue if a "stop" is asked
+        if (rSysName == "stop")
         {
-          Log::Write("emul_llvm").Level(LogError) << "failed to convert id to var with expression: " << spNrmExpr->ToString() << LogEnd;
+          Log::Write("emul_llvm").Level(LogWarning) << "stop asked at " << rInsnAddr << LogEnd;
           Exprs.clear();
-          return Error;
+          return false;
         }
-        JitExprs.push_back(spId2Var);
       }
 
-      // For each used id, we must allocate and free a variable
-      auto const& rCpuInfo = m_pCpuCtxt->GetCpuInformation();
-      for (auto Id : Id2Var.GetUsedId())
+      Exprs.push_back(spExpr);
+    }
+
+    // Jump, Call, Return types finish the block
+    if (rCurInsn.GetSubType() & (Instruction::JumpType | Instruction::CallType | Instruction::ReturnType))
+    {
+      if (!m_PreciseFlags)
+        _GetStaticSuccessors(rInsnAddr, rCurInsn, rCurArch, SuccAddrs);
+      return false;
+    }
+
+    return true;
+  });
+
+  if (Exprs.empty())
+  {
+    Log::Write("emul_llvm").Level(LogError) << "failed to disassemble code at " << rAddress << LogEnd;
+    return false;
+  }
+
+  if (!m_PreciseFlags)
+    _EliminateDeadFlags(Exprs, InsnsFlags, _GetDeadFlagsOnExit(SuccAddrs));
+
+  // Instruction callback must be called. To do so, we have to disable JIT optimization
+  if (m_InsnCb)
+  {
+    Log::Write("emul_llvm").Level(LogDebug) << "instruction hook detected, disable optimization" << LogEnd;
+
+    // The JIT sets the bit size of variables, the cached semantic must not be modified
+    for (auto spExpr : Exprs)
+      rJitExprs.push_back(spExpr->Clone());
+    return true;
+  }
+
+  // ...if not, we can freely make expressions more JIT friendly
+  Log::Write("emul_llvm").Level(LogDebug) << "no instruction hook detected, enable optimization" << LogEnd;
+
+  // This visitor will normalize id if needed
+  NormalizeIdentifier NrmId(m_pCpuCtxt->GetCpuInformation(), m_pCpuCtxt->GetMode());
+
+  // This visitor will replace id to variable
+  IdentifierToVariable Id2Var;
+
+  // Change the code to make it more JIT friendly
+  for (auto spExpr : Exprs)
+  {
+    if (spExpr->GetClassKind() == Expression::Sys)
+    {
+      auto spSysExpr = std::static_pointer_cast<SystemExpression>(spExpr);
+      auto const& rSysName = spSysExpr->GetName();
+      // jit_restore_ctxt forces id in variable to be write back in context
+      if (rSysName == "jit_restore_ctxt")
       {
-        auto pIdName = rCpuInfo.ConvertIdentifierToName(Id);
-        auto IdBitSize = rCpuInfo.GetSizeOfRegisterInBit(Id);
-        if (pIdName == nullptr || IdBitSize == 0)
+        for (auto Id : Id2Var.GetUsedId())
         {
-          Log::Write("emul_llvm").Level(LogError) << "invalid id: " << Id << LogEnd;
-          Exprs.clear();
-          return Error;
+          auto const& rCpuInfo = m_pCpuCtxt->GetCpuInformation();
+          auto IdName = rCpuInfo.ConvertIdentifierToName(Id);
+          rJitExprs.push_back(Expr::MakeAssign(
+            Expr::MakeId(Id, &rCpuInfo),
+            Expr::MakeVar(IdName, VariableExpression::Use)));
         }
+        continue;
+      }
+    }
 
-        // Copy id value to register (2)
-        JitExprs.push_front(Expr::MakeAssign(
-          Expr::MakeVar(pIdName, VariableExpression::Use),
-          Expr::MakeId(Id, &rCpuInfo)));
-
-        // Allocate variable (1)
-        JitExprs.push_front(Expr::MakeVar(pIdName, VariableExpression::Alloc, IdBitSize));
+    // Normalize Id (e.g. al → eax in 32-bit, al → rax in 64-bit)
+    auto spNrmExpr = spExpr->Visit(&NrmId);
+    if (spNrmExpr == nullptr)
+    {
+      Log::Write("emul_llvm").Level(LogError) << "failed to normalize id with expression: " << spExpr->ToString() << LogEnd;
+      return false;
+    }
 
-        // Copy variable to id (3)
-        JitExprs.push_back(Expr::MakeAssign(
-          Expr::MakeId(Id, &rCpuInfo),
-          Expr::MakeVar(pIdName, VariableExpression::Use)));
+    // Id to var
+    auto spId2Var = spNrmExpr->Visit(&Id2Var);
+    if (spId2Var == nullptr)
+    {
+      Log::Write("emul_llvm").Level(LogError) << "failed to convert id to var with expression: " << spNrmExpr->ToString() << LogEnd;
+      return false;
+    }
+    rJitExprs.push_back(spId2Var);
+  }
 
-        // Free variable (4)
-        JitExprs.push_back(Expr::MakeVar(pIdName, VariableExpression::Free));
-      }
+  // For each used id, we must allocate and free a variable
+  auto const& rCpuInfo = m_pCpuCtxt->GetCpuInformation();
+  for (auto Id : Id2Var.GetUsedId())
+  {
+    auto pIdName = rCpuInfo.ConvertIdentifierToName(Id);
+    auto IdBitSize = rCpuInfo.GetSizeOfRegisterInBit(Id);
+    if (pIdName == nullptr || IdBitSize == 0)
+    {
+      Log::Write("emul_llvm").Level(LogError) << "invalid id: " << Id << LogEnd;
+      return false;
     }
 
-    // Create a new LLVM function
-    auto pExecFunc = m_JitHelper.CreateFunction(ExecAddr.ToString());
+    // Copy id value to register (2)
+    rJitExprs.push_front(Expr::MakeAssign(
+      Expr::MakeVar(pIdName, VariableExpression::Use),
+      Expr::MakeId(Id, &rCpuInfo)));
 
-    // Expose its parameters: CpuCtxt and MemCtxt
-    auto itParam = pExecFunc->arg_begin();
-    auto pCpuCtxtObjParam = itParam++;
-    auto pMemCtxtObjParam = itParam;
+    // Allocate variable (1)
+    rJitExprs.push_front(Expr::MakeVar(pIdName, VariableExpression::Alloc, IdBitSize));
 
-    // Insert a new basic block
-    auto pBscBlk = llvm::BasicBlock::Create(llvm::getGlobalContext(), llvm::StringRef("entry_") + ExecAddr.ToString(), pExecFunc);
-    m_Builder.SetInsertPoint(pBscBlk);
+    // Copy variable to id (3)
+    rJitExprs.push_back(Expr::MakeAssign(
+      Expr::MakeId(Id, &rCpuInfo),
+      Expr::MakeVar(pIdName, VariableExpression::Use)));
 
-    // This visitor will now emit code into the basic block using the LLVM builder
-    LlvmExpressionVisitor EmitLlvm(
-      this,
-      m_Hooks,
-      m_pCpuCtxt, m_pMemCtxt,
-      m_Vars,
-      m_Builder,
-      pCpuCtxtObjParam, pMemCtxtObjParam);
+    // Free variable (4)
+    rJitExprs.push_back(Expr::MakeVar(pIdName, VariableExpression::Free));
+  }
+
+  return true;
+}
+
+LlvmEmulator::BasicBlockCode LlvmEmulator::_CompileBlocks(std::string const& rFnName, std::vector<TranslatedBlock const*> const& rBlks)
+{
+  // A block can be compiled several times (traces, hook modifications), so the name must be unique
+  auto FnName = rFnName + "_" + std::to_string(m_NrOfFunctions++);
+
+  // Create a new LLVM function
+  auto pExecFunc = m_JitHelper.CreateFunction(FnName);
+
+  // Expose its parameters: CpuCtxt and MemCtxt
+  auto itParam = pExecFunc->arg_begin();
+  auto pCpuCtxtObjParam = itParam++;
+  auto pMemCtxtObjParam = itParam;
+
+  // Insert a new basic block
+  auto pBscBlk = llvm::BasicBlock::Create(GetLlvmContext(), llvm::StringRef("entry_") + FnName, pExecFunc);
+  m_Builder.SetInsertPoint(pBscBlk);
+
+  // This visitor will now emit code into the basic block using the LLVM builder
+  LlvmExpressionVisitor EmitLlvm(
+    this,
+    m_Hooks,
+    m_pCpuCtxt, m_pMemCtxt,
+    m_Vars,
+    m_Builder,
+    pCpuCtxtObjParam, pMemCtxtObjParam);
+
+  for (size_t BlkIdx = 0; BlkIdx < rBlks.size(); ++BlkIdx)
+  {
+    auto const& rBlk = *rBlks[BlkIdx];
 
     // Emit the code for each expression
-    for (auto spExpr : JitExprs)
+    for (auto spExpr : rBlk.m_JitExprs)
     {
       //Log::Write("emul_llvm") << "compile expression: " << spExpr->ToString() << LogEnd;
       if (spExpr->Visit(&EmitLlvm) == nullptr)
       {
-        Log::Write("emul_llvm").Level(LogError) << "failed to JIT expression at " << ExecAddr << LogEnd;
-        Exprs.clear();
-        return Error;
+        Log::Write("emul_llvm").Level(LogError) << "failed to JIT expression at " << rBlk.m_Addr << LogEnd;
+        return nullptr;
       }
     }
 
-    m_Builder.CreateRet(llvm::ConstantInt::getIntegerValue(llvm::Type::getInt8Ty(llvm::getGlobalContext()), llvm::APInt(8, Emulator::Continue)));
-    //pExecFunc->dump();
-    pCode = m_JitHelper.GetFunctionCode(ExecAddr.ToString());
-    if (pCode == nullptr)
+    // In a trace, the next block is executed only if it's the expected one
+    if (BlkIdx + 1 < rBlks.size())
     {
-      Log::Write("emul_llvm").Level(LogError) << "failed to JIT code for function " << pExecFunc->getName().data() << LogEnd;
-      Exprs.clear();
-      return Error;
+      if (Expr::MakeSys("jit_check_exec_addr", rBlks[BlkIdx + 1]->m_Addr)->Visit(&EmitLlvm) == nullptr)
+        return nullptr;
     }
-    m_FunctionCache[LinAddr] = pCode;
   }
 
-  if (!pCode(reinterpret_cast<u8*>(m_pCpuCtxt), reinterpret_cast<u8*>(m_pMemCtxt)))
-    return Error;
-
-  Address NextAddr;
-  if (!m_pCpuCtxt->GetAddress(CpuContext::AddressExecution, NextAddr))
-    return Error;
-  NextAddr.SetBase(0x0); // HACK(KS)
-  return CallHookOnExecutionIfNeeded(NextAddr);
+  m_Builder.CreateRet(llvm::ConstantInt::getIntegerValue(llvm::Type::getInt8Ty(GetLlvmContext()), llvm::APInt(8, Emulator::Continue)));
+  //pExecFunc->dump();
+  auto pCode = m_JitHelper.GetFunctionCode(FnName);
+  if (pCode == nullptr)
+    Log::Write("emul_llvm").Level(LogError) << "failed to JIT code for function " << pExecFunc->getName().data() << LogEnd;
+  return pCode;
 }
 
-bool LlvmEmulator::InvalidateCache(void)
+bool LlvmEmulator::_FormTrace(TranslatedBlock& rHeadBlk)
 {
-  m_JitHelper = LlvmJitHelper();
-  m_FunctionCache.clear();
+  // Follow the links taken last time, hooks are called between blocks so a trace can't contain a hooked
+  // block (except at its head) and it can't loop
+  std::vector<TranslatedBlock const*> TraceBlks;
+  for (auto pCurBlk = &rHeadBlk; pCurBlk != nullptr && TraceBlks.size() < MaxTraceBlocks; pCurBlk = pCurBlk->m_Links[pCurBlk->m_LastLinkIdx].m_pBlock)
+  {
+    if (std::find(std::begin(TraceBlks), std::end(TraceBlks), pCurBlk) != std::end(TraceBlks))
+      break;
+    if (pCurBlk != &rHeadBlk && _IsHooked(pCurBlk->m_Addr))
+      break;
+    // Guards only check the program pointer
+    if (pCurBlk->m_Addr.GetBase() != rHeadBlk.m_Addr.GetBase())
+      break;
+    TraceBlks.push_back(pCurBlk);
+  }
+
+  if (TraceBlks.size() < 2)
+    return false;
+
+  auto pTraceCode = _CompileBlocks("trace_" + rHeadBlk.m_Addr.ToString(), TraceBlks);
+  if (pTraceCode == nullptr)
+    return false;
+
+  Log::Write("emul_llvm").Level(LogDebug) << "trace of " << TraceBlks.size() << " blocks formed at " << rHeadBlk.m_Addr << LogEnd;
+  rHeadBlk.m_pTraceCode = pTraceCode;
   return true;
 }
 
+bool LlvmEmulator::_IsHooked(Address const& rAddress) const
+{
+  Address HookAddr = rAddress;
+  HookAddr.SetBase(0x0); // HACK(KS)
+  return m_Hooks.find(HookAddr) != std::end(m_Hooks);
+}
+
+void LlvmEmulator::_ResetBlocks(void)
+{
+  // JIT'ed code is only released with the JIT helper, since a hook may be running it
+  m_Blocks.clear();
+  ++m_BlocksGeneration;
+}
+
+void* LlvmEmulator::GetMemory(Address const& rAddress, u32 AccessSizeInBit, MemoryArea::Access Access)
+{
+  u64 LinAddr;
+  if (!m_pCpuCtxt->Translate(rAddress, LinAddr))
+  {
+    Log::Write("emul_llvm").Level(LogWarning) << "unable to translate address " << rAddress << LogEnd;
+    return nullptr;
+  }
+
+  // JIT'ed code accesses the memory directly, so the access must be in a single chunk
+  auto pMemory = m_MemTlb.GetRawMemory(*m_pMemCtxt, LinAddr, std::max<u32>(AccessSizeInBit / 8, 1), Access);
+  if (pMemory == nullptr)
+    Log::Write("emul_llvm").Level(LogWarning) << "invalid memory access: linear address: " << LinAddr << LogEnd;
+  return pMemory;
+}
+
 LlvmEmulator::LlvmJitHelper::LlvmJitHelper(void)
 : m_pCurMod(nullptr)
 {
@@ -422,11 +596,11 @@ llvm::Function* LlvmEmulator::LlvmJitHelper::CreateFunction(std::string const& r
   static llvm::FunctionType* s_pExecFuncType = nullptr;
   if (s_pExecFuncType == nullptr)
   {
-    auto pBytePtrType = llvm::Type::getInt8PtrTy(llvm::getGlobalContext());
+    auto pBytePtrType = llvm::Type::getInt8PtrTy(GetLlvmContext());
     std::vector<llvm::Type*> Params;
     Params.push_back(pBytePtrType);
     Params.push_back(pBytePtrType);
-    s_pExecFuncType = llvm::FunctionType::get(llvm::Type::getInt8Ty(llvm::getGlobalContext()), Params, false);
+    s_pExecFuncType = llvm::FunctionType::get(llvm::Type::getInt8Ty(GetLlvmContext()), Params, false);
   }
 
   if (m_pCurMod == nullptr)
@@ -450,7 +624,7 @@ LlvmEmulator::BasicBlockCode LlvmEmulator::LlvmJitHelper::GetFunctionCode(std::s
   // target lays out data structures.
   //FPM->add(new llvm::DataLayout(*EE->getDataLayout()));
   // Provide basic AliasAnalysis support for GVN.
-  FPM->add(llvm::createBasicAliasAnalysisPass());
+  FPM->add(llvm::createBasicAAWrapperPass());
   // Promote allocas to registers.
   FPM->add(llvm::createPromoteMemoryToRegisterPass());
   // Do simple "peephole" optimizations and bit-twiddling optzns.
@@ -477,14 +651,14 @@ LlvmEmulator::BasicBlockCode LlvmEmulator::LlvmJitHelper::GetFunctionCode(std::s
 
 void LlvmEmulator::LlvmJitHelper::_CreateModule(std::string const& rModName)
 {
-  m_pCurMod = new llvm::Module("medusa-llvm-emulator-module-" + rModName, llvm::getGlobalContext());
+  m_pCurMod = new llvm::Module("medusa-llvm-emulator-module-" + rModName, GetLlvmContext());
 
   // Create the engine builder
   std::string ErrStr;
   auto EE = llvm::EngineBuilder(std::unique_ptr<llvm::Module>(m_pCurMod)).setErrorStr(&ErrStr).create();
   m_ModuleExecEngineMap[m_pCurMod] = EE;
 
-  auto& rCtxt = llvm::getGlobalContext();
+  auto& rCtxt = GetLlvmContext();
 
   // Initialize ReadRegister function type
   {
@@ -530,11 +704,11 @@ void LlvmEmulator::LlvmJitHelper::_CreateModule(std::string const& rModName)
   // Initialize GetMemory function type
   {
     static std::vector<llvm::Type*> Params{
-      llvm::Type::getInt8PtrTy(rCtxt),   // pCpuCtxt
-      llvm::Type::getInt8PtrTy(rCtxt),  // pMemCtxt
-      llvm::Type::getInt16Ty(rCtxt),   // Base
-      llvm::Type::getInt64Ty(rCtxt),  // Offset
-      llvm::Type::getInt32Ty(rCtxt), // AccessBitSize
+      llvm::Type::getInt8PtrTy(rCtxt),   // pEmul
+      llvm::Type::getInt16Ty(rCtxt),    // Base
+      llvm::Type::getInt64Ty(rCtxt),   // Offset
+      llvm::Type::getInt32Ty(rCtxt),  // AccessBitSize
+      llvm::Type::getInt8Ty(rCtxt),  // Access
     };
     static auto pGetMemoryFuncType = llvm::FunctionType::get(llvm::Type::getInt8PtrTy(rCtxt), Params, false);
     s_pGetMemoryFunc = llvm::Function::Create(pGetMemoryFuncType, llvm::GlobalValue::ExternalLinkage, "JitGetMemory", m_pCurMod);
@@ -644,6 +818,25 @@ Expression::SPType LlvmEmulator::LlvmExpressionVisitor::VisitSystem(SystemExpres
     return spSysExpr;
   }
 
+  // Between blocks of a trace, the trace is left if the next block isn't the expected one
+  if (rSysName == "jit_check_exec_addr")
+  {
+    auto const& rCpuInfo = m_pCpuCtxt->GetCpuInformation();
+    auto PcReg = rCpuInfo.GetRegisterByType(CpuInformation::ProgramPointerRegister, m_pCpuCtxt->GetMode());
+    auto PcBitSize = rCpuInfo.GetSizeOfRegisterInBit(PcReg);
+    if (PcReg == 0 || PcBitSize == 0)
+    {
+      Log::Write("emul_llvm").Level(LogError) << "unable to find the program pointer register" << LogEnd;
+      return nullptr;
+    }
+
+    auto pPcVal = _EmitReadRegister(PcReg, rCpuInfo);
+    _EmitReturn(m_rBuilder.CreateICmpNE(pPcVal, _MakeInteger(BitVector(PcBitSize, spSysExpr->GetAddress().GetOffset()))),
+      Emulator::Continue);
+
+    return spSysExpr;
+  }
+
   Log::Write("emul_llvm").Level(LogWarning) << "unhandled system expression: " << rSysName << LogEnd;
   return spSysExpr;
 }
@@ -697,7 +890,7 @@ Expression::SPType LlvmEmulator::LlvmExpressionVisitor::VisitTernaryCondition(Te
 Expression::SPType LlvmEmulator::LlvmExpressionVisitor::VisitIfElseCondition(IfElseConditionExpression::SPType spIfElseExpr)
 {
   auto pBbOrig = m_rBuilder.GetInsertBlock();
-  auto& rCtxt  = llvm::getGlobalContext();
+  auto& rCtxt  = GetLlvmContext();
   auto pFunc   = pBbOrig->getParent();
 
   auto pBbCond = llvm::BasicBlock::Create(rCtxt, "cond", pFunc);
@@ -752,7 +945,7 @@ Expression::SPType LlvmEmulator::LlvmExpressionVisitor::VisitIfElseCondition(IfE
 Expression::SPType LlvmEmulator::LlvmExpressionVisitor::VisitWhileCondition(WhileConditionExpression::SPType spWhileExpr)
 {
   auto pBbOrig = m_rBuilder.GetInsertBlock();
-  auto& rCtxt = llvm::getGlobalContext();
+  auto& rCtxt = GetLlvmContext();
   auto pFunc = pBbOrig->getParent();
 
   auto pBbCond = llvm::BasicBlock::Create(rCtxt, "cond", pFunc);
@@ -1137,8 +1330,13 @@ Expression::SPType LlvmEmulator::LlvmExpressionVisitor::VisitVariable(VariableEx
     switch (spVarExpr->GetType())
     {
     case VariableExpression::Alloc:
-      m_rVars[spVarExpr->GetName()] = std::make_tuple(spVarExpr->GetBitSize(), m_rBuilder.CreateAlloca(_BitSizeToLlvmType(spVarExpr->GetBitSize()), nullptr, spVarExpr->GetName()));
+    {
+      // Only allocas of the entry block are promoted to registers, it matters for blocks of a trace
+      auto& rEntryBlk = m_rBuilder.GetInsertBlock()->getParent()->getEntryBlock();
+      llvm::IRBuilder<> EntryBuilder(&rEntryBlk, rEntryBlk.begin());
+      m_rVars[spVarExpr->GetName()] = std::make_tuple(spVarExpr->GetBitSize(), EntryBuilder.CreateAlloca(_BitSizeToLlvmType(spVarExpr->GetBitSize()), nullptr, spVarExpr->GetName()));
       break;
+    }
 
     case VariableExpression::Free:
       m_rVars.erase(spVarExpr->GetName());
@@ -1158,7 +1356,7 @@ Expression::SPType LlvmEmulator::LlvmExpressionVisitor::VisitVariable(VariableEx
       if (itVar == std::end(m_rVars))
         return nullptr;
       spVarExpr->SetBitSize(std::get<0>(itVar->second));
-      m_ValueStack.push(m_rBuilder.CreateLoad(std::get<1>(itVar->second), "read_var"));
+      m_ValueStack.push(m_rBuilder.CreateLoad(_BitSizeToLlvmType(std::get<0>(itVar->second)), std::get<1>(itVar->second), "read_var"));
       break;
     }
     else
@@ -1227,15 +1425,16 @@ Expression::SPType LlvmEmulator::LlvmExpressionVisitor::VisitMemory(MemoryExpres
   llvm::Value* pPtrVal = nullptr;
   if (m_State != Read || spMemExpr->IsDereferencable())
   {
+    auto Access = m_State == Read ? MemoryArea::Access::Read : MemoryArea::Access::Write;
     auto pRawMemVal = m_rBuilder.CreateCall(
       s_pGetMemoryFunc,
       {
-        m_pCpuCtxtObjParam,
-        m_pMemCtxtObjParam,
+        _MakePointer(8, m_pEmul),
         pBaseVal, pOffVal,
-        pAccBitSizeVal
+        pAccBitSizeVal,
+        _MakeInteger(BitVector(8, static_cast<u8>(Access)))
       }, "get_memory");
-    pPtrVal = m_rBuilder.CreateBitCast(pRawMemVal, llvm::Type::getIntNPtrTy(llvm::getGlobalContext(), AccBitSize));
+    pPtrVal = m_rBuilder.CreateBitCast(pRawMemVal, llvm::Type::getIntNPtrTy(GetLlvmContext(), AccBitSize));
     _EmitReturnIfNull(pPtrVal, Emulator::Error);
   }
 
@@ -1263,12 +1462,12 @@ Expression::SPType LlvmEmulator::LlvmExpressionVisitor::VisitMemory(MemoryExpres
 
     if (m_NrOfValueToRead == 0)
     {
-      auto pVal = m_rBuilder.CreateLoad(pPtrVal, "read_mem");
+      auto pVal = m_rBuilder.CreateLoad(_BitSizeToLlvmType(AccBitSize), pPtrVal, "read_mem");
       m_ValueStack.push(pVal);
     }
     while (m_NrOfValueToRead != 0)
     {
-      auto pVal = m_rBuilder.CreateLoad(pPtrVal, "read_mem");
+      auto pVal = m_rBuilder.CreateLoad(_BitSizeToLlvmType(AccBitSize), pPtrVal, "read_mem");
       m_ValueStack.push(pVal);
       // FIXME(KS):
       //m_rBuilder.CreateAdd(pPtrVal, _MakeInteger(BitVector(AccBitSize, AccBitSize / 8)), "inc_ptr");
@@ -1321,23 +1520,23 @@ llvm::Value* LlvmEmulator::LlvmExpressionVisitor::_MakeInteger(BitVector const&
   if (rInt.GetBitSize() > 64)
   {
     // Skip "0x"
-    return llvm::ConstantInt::get(llvm::getGlobalContext(), llvm::APInt(rInt.GetBitSize(), rInt.ToString().c_str() + 2, 16));
+    return llvm::ConstantInt::get(GetLlvmContext(), llvm::APInt(rInt.GetBitSize(), rInt.ToString().c_str() + 2, 16));
     Log::Write("emul_llvm").Level(LogError) << "unsupported int size " << rInt.GetBitSize() << LogEnd;
     return nullptr;
   }
-  return llvm::ConstantInt::get(llvm::getGlobalContext(), llvm::APInt(rInt.GetBitSize(), rInt.ConvertTo<u64>()));
+  return llvm::ConstantInt::get(GetLlvmContext(), llvm::APInt(rInt.GetBitSize(), rInt.ConvertTo<u64>()));
 }
 
 llvm::Value* LlvmEmulator::LlvmExpressionVisitor::_MakePointer(u32 Bits, void* pPointer, s32 Offset) const
 {
   //src: http://llvm.1065342.n5.nabble.com/Creating-Pointer-Constants-td31886.html
-  auto pConstInt = llvm::ConstantInt::get(llvm::Type::getInt64Ty(llvm::getGlobalContext()), reinterpret_cast<u64>(pPointer));
-  auto pPtr = llvm::ConstantExpr::getIntToPtr(pConstInt, llvm::PointerType::getIntNPtrTy(llvm::getGlobalContext(), Bits));
+  auto pConstInt = llvm::ConstantInt::get(llvm::Type::getInt64Ty(GetLlvmContext()), reinterpret_cast<u64>(pPointer));
+  auto pPtr = llvm::ConstantExpr::getIntToPtr(pConstInt, llvm::PointerType::getIntNPtrTy(GetLlvmContext(), Bits));
 
   if (Offset == 0x0)
     return pPtr;
 
-  return m_rBuilder.CreateGEP(pPtr, _MakeInteger(BitVector(Offset)));
+  return m_rBuilder.CreateGEP(_BitSizeToLlvmType(Bits), pPtr, _MakeInteger(BitVector(Offset)));
 }
 
 llvm::Value* LlvmEmulator::LlvmExpressionVisitor::_MakePointer(u32 Bits, llvm::Value* pPointerValue, s32 Offset) const
@@ -1345,10 +1544,10 @@ llvm::Value* LlvmEmulator::LlvmExpressionVisitor::_MakePointer(u32 Bits, llvm::V
   if (Offset != 0x0)
   {
     //src: http://llvm.1065342.n5.nabble.com/Creating-Pointer-Constants-td31886.html
-    pPointerValue = m_rBuilder.CreateGEP(pPointerValue, _MakeInteger(BitVector(Offset)));
+    pPointerValue = m_rBuilder.CreateGEP(pPointerValue->getType()->getPointerElementType(), pPointerValue, _MakeInteger(BitVector(Offset)));
   }
 
-  return m_rBuilder.CreateBitCast(pPointerValue, llvm::PointerType::getIntNPtrTy(llvm::getGlobalContext(), Bits));
+  return m_rBuilder.CreateBitCast(pPointerValue, llvm::PointerType::getIntNPtrTy(GetLlvmContext(), Bits));
 }
 
 llvm::Type* LlvmEmulator::LlvmExpressionVisitor::_BitVectorToLlvmType(BitVector const& rInt) const
@@ -1358,7 +1557,7 @@ llvm::Type* LlvmEmulator::LlvmExpressionVisitor::_BitVectorToLlvmType(BitVector
 
 llvm::Type* LlvmEmulator::LlvmExpressionVisitor::_BitSizeToLlvmType(u16 BitSize) const
 {
-  return llvm::Type::getIntNTy(llvm::getGlobalContext(), BitSize);
+  return llvm::Type::getIntNTy(GetLlvmContext(), BitSize);
 }
 
 llvm::Value* LlvmEmulator::LlvmExpressionVisitor::_CallIntrinsic(
@@ -1444,13 +1643,24 @@ llvm::Value* LlvmEmulator::LlvmExpressionVisitor::_EmitReadRegister(u32 Reg, Cpu
   // We need the register bit size to declare its type
   auto RegBitSize = rCpuInfo.GetSizeOfRegisterInBit(Reg);
 
+  // If the register is described, it's directly loaded from the context
+  auto pRegDesc = m_pCpuCtxt->GetRegisterDescriptor(Reg);
+  if (pRegDesc != nullptr && pRegDesc->m_BitSize == RegBitSize)
+  {
+    auto pContPtrVal = _MakePointer(pRegDesc->m_ContainerSize * 8, static_cast<u8*>(m_pCpuCtxt->GetContextAddress()) + pRegDesc->m_Offset);
+    llvm::Value* pContVal = m_rBuilder.CreateLoad(_BitSizeToLlvmType(pRegDesc->m_ContainerSize * 8), pContPtrVal, RegName + "_cont");
+    if (pRegDesc->m_Shift != 0)
+      pContVal = m_rBuilder.CreateLShr(pContVal, pRegDesc->m_Shift);
+    return m_rBuilder.CreateTruncOrBitCast(pContVal, _BitSizeToLlvmType(RegBitSize), RegName + "_val");
+  }
+
   // Make values for function parameters
   auto pRegVal = _MakeInteger(BitVector(32, Reg));
   auto pBitSize = _MakeInteger(BitVector(32, RegBitSize));
 
   // Allocate the result on the stack
   auto pRegAlloca = m_rBuilder.CreateAlloca(_BitSizeToLlvmType(RegBitSize), nullptr, RegName + "_alloc");
-  auto pRegPtrVal = m_rBuilder.CreateBitCast(pRegAlloca, llvm::Type::getIntNPtrTy(llvm::getGlobalContext(), 8));
+  auto pRegPtrVal = m_rBuilder.CreateBitCast(pRegAlloca, llvm::Type::getIntNPtrTy(GetLlvmContext(), 8));
 
   // Call ReadRegister wrapper
   auto pCallVal = m_rBuilder.CreateCall(
@@ -1463,7 +1673,7 @@ llvm::Value* LlvmEmulator::LlvmExpressionVisitor::_EmitReadRegister(u32 Reg, Cpu
     }, RegName + "_read");
 
   // Return the result
-  auto pRegResVal = m_rBuilder.CreateLoad(pRegAlloca, RegName + "_val");
+  auto pRegResVal = m_rBuilder.CreateLoad(pRegAlloca->getAllocatedType(), pRegAlloca, RegName + "_val");
   return pRegResVal;
 }
 
@@ -1474,6 +1684,29 @@ bool LlvmEmulator::LlvmExpressionVisitor::_EmitWriteRegister(u32 Reg, CpuInforma
   // We need the register bit size to declare its type
   auto RegBitSize = rCpuInfo.GetSizeOfRegisterInBit(Reg);
 
+  // If the register is described, it's directly stored in the context
+  auto pRegDesc = m_pCpuCtxt->GetRegisterDescriptor(Reg);
+  if (pRegDesc != nullptr && pRegDesc->m_BitSize == RegBitSize)
+  {
+    auto ContBitSize = pRegDesc->m_ContainerSize * 8;
+    auto pContPtrVal = _MakePointer(ContBitSize, static_cast<u8*>(m_pCpuCtxt->GetContextAddress()) + pRegDesc->m_Offset);
+    llvm::Value* pNewContVal = m_rBuilder.CreateZExtOrBitCast(pVal, _BitSizeToLlvmType(ContBitSize));
+    if (pRegDesc->m_Shift != 0)
+      pNewContVal = m_rBuilder.CreateShl(pNewContVal, pRegDesc->m_Shift);
+
+    // The other bits of the container are kept
+    if (!(pRegDesc->m_Flags & CpuContext::RegisterDescriptor::ClearContainer) && ContBitSize != RegBitSize)
+    {
+      auto Mask = (RegBitSize < 64 ? (1ULL << RegBitSize) - 1 : ~0ULL) << pRegDesc->m_Shift;
+      auto pContVal = m_rBuilder.CreateLoad(_BitSizeToLlvmType(ContBitSize), pContPtrVal, RegName + "_cont");
+      auto pKeptVal = m_rBuilder.CreateAnd(pContVal, _MakeInteger(BitVector(ContBitSize, ~Mask)));
+      pNewContVal = m_rBuilder.CreateOr(pKeptVal, pNewContVal);
+    }
+
+    m_rBuilder.CreateStore(pNewContVal, pContPtrVal);
+    return true;
+  }
+
   // Make values for function parameters
   auto pRegVal = _MakeInteger(BitVector(32, Reg));
   auto pBitSize = _MakeInteger(BitVector(32, RegBitSize));
@@ -1481,7 +1714,7 @@ bool LlvmEmulator::LlvmExpressionVisitor::_EmitWriteRegister(u32 Reg, CpuInforma
   // Allocate the new value on the stack
   auto pRegAlloca = m_rBuilder.CreateAlloca(_BitSizeToLlvmType(RegBitSize), nullptr, RegName + "_alloc");
   auto pStoreReg = m_rBuilder.CreateStore(pVal, pRegAlloca);
-  auto pRegPtrVal = m_rBuilder.CreateBitCast(pRegAlloca, llvm::Type::getIntNPtrTy(llvm::getGlobalContext(), 8), RegName + "_ptr");
+  auto pRegPtrVal = m_rBuilder.CreateBitCast(pRegAlloca, llvm::Type::getIntNPtrTy(GetLlvmContext(), 8), RegName + "_ptr");
 
   // Call WriteRegister wrapper
   auto pCallVal = m_rBuilder.CreateCall(
@@ -1500,7 +1733,7 @@ bool LlvmEmulator::LlvmExpressionVisitor::_EmitWriteRegister(u32 Reg, CpuInforma
 void LlvmEmulator::LlvmExpressionVisitor::_EmitReturn(llvm::Value* pCondVal, llvm::Value* pRetVal)
 {
   auto pBbOrig = m_rBuilder.GetInsertBlock();
-  auto& rCtxt = llvm::getGlobalContext();
+  auto& rCtxt = GetLlvmContext();
   auto pFunc = pBbOrig->getParent();
 
   auto pBbRet = llvm::BasicBlock::Create(rCtxt, "ret", pFunc);
@@ -1521,7 +1754,7 @@ void LlvmEmulator::LlvmExpressionVisitor::_EmitReturn(llvm::Value* pCondVal, Emu
 
 void LlvmEmulator::LlvmExpressionVisitor::_EmitReturnIfNull(llvm::Value* pChkVal, Emulator::ReturnType RetVal)
 {
-  auto& rCtxt = llvm::getGlobalContext();
+  auto& rCtxt = GetLlvmContext();
 
   auto pChkValInt = m_rBuilder.CreatePtrToInt(pChkVal, llvm::Type::getIntNTy(rCtxt, sizeof(void*) * 8));
   auto pNullPtrInt = _MakeInteger(BitVector(sizeof(void*) * 8, 0));
@@ -1546,11 +1779,11 @@ llvm::Value* LlvmEmulator::LlvmExpressionVisitor::_EmitFloatingPointBinaryOperat
   switch (LeftBits)
   {
   case 32:
-    pFloatType = llvm::Type::getFloatTy(llvm::getGlobalContext());
+    pFloatType = llvm::Type::getFloatTy(GetLlvmContext());
     break;
 
   case 64:
-    pFloatType = llvm::Type::getDoubleTy(llvm::getGlobalContext());
+    pFloatType = llvm::Type::getDoubleTy(GetLlvmContext());
     break;
 
   default:
@@ -55,18 +55,57 @@ public:
 
   virtual bool InvalidateCache(void);
 
+  //! This method returns the host memory of the access, or nullptr if it's not mapped or not allowed.
+  void* GetMemory(Address const& rAddress, u32 AccessSizeInBit, MemoryArea::Access Access);
+
 private:
-  typedef bool (*BasicBlockCode)(u8* pCpuCtxtObj, u8* pMemCtxtObj);
+  // JIT'ed code returns an Emulator::ReturnType
+  typedef u8 (*BasicBlockCode)(u8* pCpuCtxtObj, u8* pMemCtxtObj);
 
   llvm::IRBuilder<>             m_Builder;
 
   typedef std::unordered_map<std::string, std::tuple<u32, llvm::Value*>> VarMapType;
   VarMapType m_Vars;
 
+  // A translated block is linked to the blocks executed after it, so Execute finds the next block
+  // without translating the execution address. When a block becomes hot, the blocks which followed it
+  // are fused into a trace: a single function which checks the execution address between blocks.
+  struct TranslatedBlock
+  {
+    struct Link
+    {
+      Address          m_Addr;
+      TranslatedBlock* m_pBlock;
+    };
+
+    Address             m_Addr;
+    Expression::LSPType m_JitExprs;
+    BasicBlockCode      m_pCode;
+    BasicBlockCode      m_pTraceCode; // nullptr if no trace starts with this block
+    Link                m_Links[2];   // Both successors of a conditional branch can be linked
+    u8                  m_LastLinkIdx;
+    u32                 m_ExecCount;
+  };
+
+  static u32 const MaxChainedBlocks = 0x1000; // Execute gives the control back after this number of blocks
+  static u32 const HotBlockThreshold = 0x40;  // Number of executions before forming a trace
+  static u32 const MaxTraceBlocks = 0x10;
+
+  TranslatedBlock* _GetBlock(Address const& rAddress);
+  TranslatedBlock* _FollowLink(TranslatedBlock& rBlk, Address const& rNextAddr);
+  bool             _TranslateBlock(Address const& rAddress, Expression::LSPType& rJitExprs);
+  BasicBlockCode   _CompileBlocks(std::string const& rFnName, std::vector<TranslatedBlock const*> const& rBlks);
+  bool             _FormTrace(TranslatedBlock& rHeadBlk);
+  bool             _IsHooked(Address const& rAddress) const;
+  //! Translated blocks depend on hooks, so they're translated again when hooks are modified.
+  virtual void     _ResetBlocks(void);
+
   // TODO: Implement InvalidateCache to handle self-modifying code
   // TODO: Implement a method in CpuContext to get the current address (we can't always rely on CpuInformation::ProgramPointerRegister)
-  typedef std::unordered_map<u64, BasicBlockCode>   FunctionCacheType;
-  FunctionCacheType             m_FunctionCache;
+  typedef std::unordered_map<u64, TranslatedBlock> TranslatedBlockMapType;
+  TranslatedBlockMapType        m_Blocks;           // Indexed by linear address
+  u32                           m_BlocksGeneration; // Incremented when blocks are dropped, even by a hook
+  u32                           m_NrOfFunctions;    // Makes names of JIT'ed functions unique
 
   class LlvmJitHelper
   {
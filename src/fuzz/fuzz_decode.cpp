@@ -0,0 +1,343 @@
+#include <medusa/binary_stream.hpp>
+#include <medusa/module.hpp>
+#include <medusa/architecture.hpp>
+#include <medusa/instruction.hpp>
+#include <medusa/instruction_buffer.hpp>
+
+#include <boost/filesystem.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <iterator>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+
+// Differential fuzzing of the decoders: every input is decoded with Disassemble, DisassembleBlock and
+// DecodeLength, the three paths must agree on the instruction boundaries and on the control flow type.
+// The first byte of an input selects the architecture and the mode, the remaining bytes are the code.
+//
+// Built with MEDUSA_FUZZ_WITH_LIBFUZZER, the harness exposes LLVMFuzzerTestOneInput. Otherwise it runs
+// offline: medusa_fuzz_decode [-runs=N] [-seed=N] [-max_len=N] [-artifact_prefix=P] [file|dir]...
+// given files and directories are replayed first (e.g. previous artifacts), then every opcode of every
+// generated table is used as seed, then -runs random mutations of these seeds are decoded.
+// Inputs which produce a mismatch or are abnormally slow to decode are written to <prefix><kind>-<arch>-<mode>-<hash>.
+
+using namespace medusa;
+
+struct FuzzTarget
+{
+  Architecture* m_pArch;
+  std::string   m_ArchName;
+  std::string   m_ModeName;
+  u8            m_Mode;
+  double        m_AvgDecodeTime; //!< moving average in seconds, used to detect slow paths
+};
+
+static std::vector<FuzzTarget> s_Targets;
+static std::string             s_ArtifactPrefix = "./";
+static u32         const       s_MaxBlockInsns  = 16;
+static double      const       s_SlowFactor     = 200.0;
+static double      const       s_SlowFloor      = 0.0005; // 500 µs
+
+static u32 const s_ControlFlowTypes = Instruction::JumpType | Instruction::CallType | Instruction::ReturnType;
+
+//! What the decoding paths are compared on
+struct DecodedInsn
+{
+  u16 m_Size;
+  u32 m_Opcode;
+  u32 m_SubType;
+};
+
+static bool LoadTargets(void)
+{
+  static char const* s_ArchNames[] = { "x86", "arm", "z80", "st62" };
+
+  for (auto pArchName : s_ArchNames)
+  {
+    auto pGetter = ModuleManager::Instance().LoadModule<TGetArchitecture>(".", pArchName);
+    if (pGetter == nullptr)
+    {
+      std::cerr << "unable to load the " << pArchName << " module" << std::endl;
+      continue;
+    }
+    auto pArch = pGetter();
+    for (auto const& rMode : pArch->GetModes())
+    {
+      FuzzTarget Tgt = { pArch, pArchName, std::get<0>(rMode), std::get<1>(rMode), 0.0 };
+      s_Targets.push_back(Tgt);
+    }
+  }
+  return !s_Targets.empty();
+}
+
+static std::string HashInput(u8 const* pData, size_t Size)
+{
+  // FNV-1a
+  u64 Hash = 0xcbf29ce484222325ULL;
+  for (size_t i = 0; i < Size; ++i)
+  {
+    Hash ^= pData[i];
+    Hash *= 0x100000001b3ULL;
+  }
+  std::ostringstream Oss;
+  Oss << std::hex << std::setw(16) << std::setfill('0') << Hash;
+  return Oss.str();
+}
+
+static void SaveArtifact(char const* pKind, FuzzTarget const& rTgt, u8 const* pData, size_t Size)
+{
+  std::string Path = s_ArtifactPrefix + pKind + "-" + rTgt.m_ArchName + "-" + rTgt.m_ModeName + "-" + HashInput(pData, Size);
+  std::ofstream Artifact(Path, std::ios::binary);
+  Artifact.write(reinterpret_cast<char const*>(pData), Size);
+  std::cerr << pKind << ": " << rTgt.m_ArchName << "/" << rTgt.m_ModeName << " saved to " << Path << std::endl;
+}
+
+// Returns false if the decoding paths disagree
+static bool CheckInput(u8 const* pData, size_t Size)
+{
+  if (Size < 2 || s_Targets.empty())
+    return true;
+
+  auto& rTgt = s_Targets[pData[0] % s_Targets.size()];
+  MemoryBinaryStream MemBinStrm(pData + 1, Size - 1);
+  std::ostringstream Error;
+
+  // Reference: sequential decoding with Disassemble
+  std::vector<DecodedInsn> RefInsns;
+  bool RefRes = true;
+  OffsetType Off = 0;
+  while (RefInsns.size() < s_MaxBlockInsns)
+  {
+    Instruction Insn;
+    auto Start = std::chrono::steady_clock::now();
+    bool Res = rTgt.m_pArch->Disassemble(MemBinStrm, Off, Insn, rTgt.m_Mode);
+    std::chrono::duration<double> Elapsed = std::chrono::steady_clock::now() - Start;
+
+    if (rTgt.m_AvgDecodeTime != 0.0 && Elapsed.count() > std::max(rTgt.m_AvgDecodeTime * s_SlowFactor, s_SlowFloor))
+      SaveArtifact("slow", rTgt, pData, Size);
+    rTgt.m_AvgDecodeTime = rTgt.m_AvgDecodeTime == 0.0 ? Elapsed.count() : (rTgt.m_AvgDecodeTime * 63.0 + Elapsed.count()) / 64.0;
+
+    if (!Res || Insn.GetSize() == 0)
+    {
+      RefRes = false;
+      break;
+    }
+
+    if (Off + Insn.GetSize() > Size - 1)
+      Error << "instruction at " << Off << " is " << Insn.GetSize() << " bytes long but only " << (Size - 1 - Off) << " bytes are available\n";
+
+    // The length only decoder must agree on every instruction the full decoder accepts
+    Architecture::InsnClass InsnCls;
+    if (!rTgt.m_pArch->DecodeLength(MemBinStrm, Off, rTgt.m_Mode, InsnCls))
+      Error << "DecodeLength failed at " << Off << "\n";
+    else
+    {
+      if (InsnCls.m_Length != Insn.GetSize())
+        Error << "DecodeLength returned " << InsnCls.m_Length << " bytes at " << Off << ", Disassemble " << Insn.GetSize() << "\n";
+      if ((InsnCls.m_SubType & s_ControlFlowTypes) != (Insn.GetSubType() & s_ControlFlowTypes))
+        Error << "DecodeLength returned type " << static_cast<u32>(InsnCls.m_SubType) << " at " << Off << ", Disassemble " << Insn.GetSubType() << "\n";
+    }
+
+    Off += Insn.GetSize();
+    DecodedInsn RefInsn = { static_cast<u16>(Insn.GetSize()), Insn.GetOpcode(), Insn.GetSubType() };
+    RefInsns.push_back(RefInsn);
+  }
+
+  // The batch decoder must produce the same instructions
+  InstructionBuffer InsnBuf;
+  bool BlkRes = rTgt.m_pArch->DisassembleBlock(MemBinStrm, 0, rTgt.m_Mode, s_MaxBlockInsns, false, InsnBuf);
+  if (BlkRes != RefRes)
+    Error << "DisassembleBlock returned " << BlkRes << ", Disassemble " << RefRes << "\n";
+  if (InsnBuf.GetSize() != RefInsns.size())
+    Error << "DisassembleBlock decoded " << InsnBuf.GetSize() << " instructions, Disassemble " << RefInsns.size() << "\n";
+  else
+  {
+    for (size_t i = 0; i < RefInsns.size(); ++i)
+    {
+      auto const& rBlkInsn = *InsnBuf[i];
+      if (rBlkInsn.GetSize() != RefInsns[i].m_Size || rBlkInsn.GetOpcode() != RefInsns[i].m_Opcode || rBlkInsn.GetSubType() != RefInsns[i].m_SubType)
+        Error << "DisassembleBlock and Disassemble disagree on instruction " << i << "\n";
+    }
+  }
+
+  if (Error.tellp() == 0)
+    return true;
+
+  std::cerr << Error.str();
+  SaveArtifact("mismatch", rTgt, pData, Size);
+  return false;
+}
+
+#if defined(MEDUSA_FUZZ_LIBFUZZER)
+
+extern "C" int LLVMFuzzerInitialize(int* pArgc, char*** pArgv)
+{
+  if (!LoadTargets())
+    std::abort();
+  return 0;
+}
+
+extern "C" int LLVMFuzzerTestOneInput(u8 const* pData, size_t Size)
+{
+  // libFuzzer keeps the input as a crash artifact
+  if (!CheckInput(pData, Size))
+    std::abort();
+  return 0;
+}
+
+#else
+
+// Escape sequences which lead to a nested opcode table, each of them is followed by every possible byte
+static std::vector<std::vector<u8>> GetTableSeeds(std::string const& rArchName)
+{
+  std::vector<std::vector<u8>> Escapes(1); // the first level table has no escape
+
+  if (rArchName == "x86")
+  {
+    Escapes.insert(std::end(Escapes), {
+      { 0x0f }, { 0x0f, 0x38 }, { 0x0f, 0x3a },                   // 2 and 3 bytes opcodes
+      { 0x66, 0x0f }, { 0xf2, 0x0f }, { 0xf3, 0x0f },             // mandatory prefixes
+      { 0x66, 0x0f, 0x38 }, { 0xf2, 0x0f, 0x38 }, { 0x66, 0x0f, 0x3a },
+      { 0x0f, 0x0f, 0x00, 0x00 }, { 0x0f, 0x0f, 0xc0 },            // 3DNow! (the opcode is the last byte)
+      { 0xd8 }, { 0xd9 }, { 0xda }, { 0xdb }, { 0xdc }, { 0xdd }, { 0xde }, { 0xdf }, // x87
+      { 0x48 }, { 0x66 }, { 0x67 }, { 0xf0 },                     // REX.w, size and lock prefixes
+    });
+  }
+  else if (rArchName == "z80")
+  {
+    Escapes.insert(std::end(Escapes), {
+      { 0xcb }, { 0xed }, { 0xdd }, { 0xfd }, { 0xdd, 0xcb, 0x00 }, { 0xfd, 0xcb, 0x00 },
+    });
+  }
+
+  std::vector<std::vector<u8>> Seeds;
+  for (auto const& rEscape : Escapes)
+  {
+    for (u32 Byte = 0; Byte < 0x100; ++Byte)
+    {
+      auto Seed = rEscape;
+      Seed.push_back(static_cast<u8>(Byte));
+      Seeds.push_back(Seed);
+    }
+  }
+
+  // Fixed width encodings (arm, thumb) keep their opcode in the high bits of a little endian word
+  if (rArchName == "arm")
+  {
+    for (u32 Byte = 0; Byte < 0x100; ++Byte)
+    {
+      Seeds.push_back({ 0x00, static_cast<u8>(Byte) });
+      Seeds.push_back({ 0x00, 0x00, 0x00, static_cast<u8>(Byte) });
+    }
+  }
+
+  return Seeds;
+}
+
+static bool ReplayFile(boost::filesystem::path const& rPath)
+{
+  std::ifstream File(rPath.string(), std::ios::binary);
+  std::vector<u8> Input((std::istreambuf_iterator<char>(File)), std::istreambuf_iterator<char>());
+  return CheckInput(Input.data(), Input.size());
+}
+
+int main(int argc, char** argv)
+{
+  u64    Runs   = 100000;
+  u32    Seed   = 0x6d656475;
+  size_t MaxLen = 64;
+  std::vector<std::string> Paths;
+
+  for (int i = 1; i < argc; ++i)
+  {
+    std::string Arg = argv[i];
+    if      (Arg.compare(0, 6, "-runs=") == 0)            Runs   = std::strtoull(Arg.c_str() + 6, nullptr, 0);
+    else if (Arg.compare(0, 6, "-seed=") == 0)            Seed   = static_cast<u32>(std::strtoul(Arg.c_str() + 6, nullptr, 0));
+    else if (Arg.compare(0, 9, "-max_len=") == 0)         MaxLen = std::max<size_t>(std::strtoul(Arg.c_str() + 9, nullptr, 0), 2);
+    else if (Arg.compare(0, 17, "-artifact_prefix=") == 0) s_ArtifactPrefix = Arg.substr(17);
+    else                                                   Paths.push_back(Arg);
+  }
+
+  if (!LoadTargets())
+    return 1;
+
+  u64 FailCnt = 0, InputCnt = 0;
+
+  // Regression cases
+  for (auto const& rPath : Paths)
+  {
+    boost::filesystem::path CurPath(rPath);
+    if (boost::filesystem::is_directory(CurPath))
+    {
+      for (boost::filesystem::directory_iterator itFile(CurPath), itEnd; itFile != itEnd; ++itFile)
+      {
+        if (!boost::filesystem::is_regular_file(itFile->path()))
+          continue;
+        ++InputCnt;
+        if (!ReplayFile(itFile->path()))
+          ++FailCnt;
+      }
+    }
+    else
+    {
+      ++InputCnt;
+      if (!ReplayFile(CurPath))
+        ++FailCnt;
+    }
+  }
+
+  // Every opcode of every table, with a random tail for the operands
+  std::mt19937 Rng(Seed);
+  std::vector<std::vector<u8>> Corpus;
+  for (size_t TgtIdx = 0; TgtIdx < s_Targets.size(); ++TgtIdx)
+  {
+    for (auto const& rTableSeed : GetTableSeeds(s_Targets[TgtIdx].m_ArchName))
+    {
+      std::vector<u8> Input;
+      Input.push_back(static_cast<u8>(TgtIdx));
+      Input.insert(std::end(Input), std::begin(rTableSeed), std::end(rTableSeed));
+      size_t const InputLen = std::max<size_t>(MaxLen, Input.size() + 16);
+      while (Input.size() < InputLen)
+        Input.push_back(static_cast<u8>(Rng()));
+      ++InputCnt;
+      if (!CheckInput(Input.data(), Input.size()))
+        ++FailCnt;
+      Corpus.push_back(std::move(Input));
+    }
+  }
+
+  // Mutations: flip some bytes of a seed and decode from a random position
+  for (u64 Run = 0; Run < Runs && !Corpus.empty(); ++Run)
+  {
+    auto Input = Corpus[Rng() % Corpus.size()];
+    u32 MutCnt = 1 + Rng() % 4;
+    for (u32 i = 0; i < MutCnt; ++i)
+    {
+      size_t Pos = 1 + Rng() % (Input.size() - 1);
+      switch (Rng() % 3)
+      {
+      case 0: Input[Pos] = static_cast<u8>(Rng());     break;
+      case 1: Input[Pos] ^= static_cast<u8>(1 << (Rng() % 8)); break;
+      case 2: Input.erase(std::begin(Input) + 1, std::begin(Input) + Pos); break;
+      }
+      if (Input.size() < 2)
+        Input.push_back(static_cast<u8>(Rng()));
+    }
+    ++InputCnt;
+    if (!CheckInput(Input.data(), Input.size()))
+      ++FailCnt;
+  }
+
+  std::cout << "targets: " << s_Targets.size() << ", inputs: " << InputCnt << ", mismatches: " << FailCnt << std::endl;
+  return FailCnt == 0 ? 0 : 1;
+}
+
+#endif
@@ -309,17 +309,19 @@ private:
 
       if (rPhdr.p_type == PT_DYNAMIC)
       {
+        // NOTE: Dyn, Rel and Rela only contain fields as wide as Addr, so they are
+        // read as arrays of Addr which are swapped at once if needed
+        typedef typename ElfType::Addr AddrType;
         std::unique_ptr<u8[]> upDynamic(new u8[rPhdr.p_filesz]);
-        if (!rBinStrm.Read(rPhdr.p_offset, upDynamic.get(), rPhdr.p_filesz))
+        if (!rBinStrm.ReadArray(rPhdr.p_offset, rPhdr.p_filesz / sizeof(AddrType), reinterpret_cast<AddrType*>(upDynamic.get()), Endianness))
         {
           Log::Write("ldr_elf") << "Can't read DYN" << LogEnd;
           continue;
         }
 
         for (typename ElfType::Dyn *pDyn = reinterpret_cast<typename ElfType::Dyn*>(upDynamic.get());
-          reinterpret_cast<u8*>(pDyn) < upDynamic.get() + rPhdr.p_filesz; ++pDyn)
+          reinterpret_cast<u8*>(pDyn + 1) <= upDynamic.get() + rPhdr.p_filesz; ++pDyn)
         {
-          ElfType::EndianSwap(*pDyn, Endianness);
           switch (pDyn->d_tag)
           {
           case DT_JMPREL:   JmpRelTbl   = pDyn->d_un.d_ptr;                   break;
@@ -371,7 +373,7 @@ private:
         std::unique_ptr<char[]> upDynSymStr(new char[DynStrSz]);
         std::unique_ptr<u8[]>   upRelocA(new u8[RelaSz]);
 
-        if (!rBinStrm.Read(JmpRelTblOff, upReloc.get(), JmpRelSz))
+        if (!rBinStrm.ReadArray(JmpRelTblOff, JmpRelSz / sizeof(AddrType), reinterpret_cast<AddrType*>(upReloc.get()), Endianness))
         {
           Log::Write("ldr_elf") << "Can't read REL" << LogEnd;
           return;
@@ -381,7 +383,7 @@ private:
           Log::Write("ldr_elf") << "Can't read DYNSTR" << LogEnd;
           return;
         }
-        if (!rBinStrm.Read(RelaTblOff, upRelocA.get(), RelaSz))
+        if (!rBinStrm.ReadArray(RelaTblOff, RelaSz / sizeof(AddrType), reinterpret_cast<AddrType*>(upRelocA.get()), Endianness))
         {
           Log::Write("ldr_elf") << "Can't read RELA" << LogEnd;
           return;
@@ -397,8 +399,6 @@ private:
             auto pRel = reinterpret_cast<typename ElfType::Rel*>(upReloc.get());
             for (u32 i = 0; i < JmpRelSz / sizeof(*pRel); ++pRel, ++i)
             {
-              ElfType::EndianSwap(*pRel, Endianness);
-
               typename ElfType::Sym CurSym;
               u32 SymIdx;
               if (bit == 32)
@@ -452,8 +452,6 @@ private:
             auto pRela = reinterpret_cast<typename ElfType::Rela*>(upReloc.get());
             for (u32 i = 0; i < JmpRelSz / sizeof(*pRela); ++pRela, ++i)
             {
-              ElfType::EndianSwap(*pRela, Endianness);
-
               typename ElfType::Sym CurSym;
               u32 SymIdx;
               if (bit == 32)
@@ -510,8 +508,6 @@ private:
           auto pRela = reinterpret_cast<typename ElfType::Rela*>(upRelocA.get());
           for (u32 i = 0; i < RelaSz / sizeof(*pRela); ++i, ++pRela)
           {
-            ElfType::EndianSwap(*pRela, Endianness);
-
             typename ElfType::Sym CurSym;
             u32     SymIdx    = pRela->r_info >> (sizeof(pRela->r_info) * 8 / 2);
             OffsetType CurSymOff = SymTblOff + SymIdx * sizeof(CurSym);
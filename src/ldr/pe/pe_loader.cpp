@@ -260,7 +260,7 @@ template<int bit> void PeLoader::_MapSections(Document& rDoc, Architecture::VSPT
 
   // TODO: check this
   // ref: https://code.google.com/p/corkami/wiki/PE#SizeOfHeaders
-  auto HdrLen = std::min<u32>(0x1000, rBinStrm.GetSize());
+  auto HdrLen = static_cast<u32>(std::min<u64>(0x1000, rBinStrm.GetSize()));
 
   if (!rDoc.AddMemoryArea(MemoryArea::CreateMapped(
     "hdr", MemoryArea::Access::Read | MemoryArea::Access::Write,
@@ -471,55 +471,90 @@ template<int bit> void PeLoader::_ResolveExports(Document& rDoc, u64 ImageBase,
     return;
   }
 
-  for (u32 i = 0; i < ExpDir.NumberOfFunctions; ++i)
+  // Counts come from the file, so tables are checked against the stream before being allocated
+  auto IsTableInStream = [&](OffsetType TblOff, u32 Count, u32 ElemSize)
   {
-    u16 Ord;
-    if (!rBinStrm.Read(OrdOff + i * sizeof(Ord), Ord))
+    u64 TblSize = static_cast<u64>(Count) * ElemSize;
+    return TblSize <= rBinStrm.GetSize() && TblOff <= rBinStrm.GetSize() - TblSize;
+  };
+  if (!IsTableInStream(FuncOff, ExpDir.NumberOfFunctions, sizeof(u32)))
+  {
+    Log::Write("ldr_pe") << "function rvas are out of file" << LogEnd;
+    return;
+  }
+  if (!IsTableInStream(NameOff, ExpDir.NumberOfNames, sizeof(u32)) || !IsTableInStream(OrdOff, ExpDir.NumberOfNames, sizeof(u16)))
+  {
+    Log::Write("ldr_pe") << "export names are out of file" << LogEnd;
+    return;
+  }
+
+  // Export tables are read at once, PE is always little endian
+  // Names and ordinals are parallel tables, an ordinal indexes the function table
+  std::vector<u32> FuncRvas(ExpDir.NumberOfFunctions);
+  std::vector<u32> NameRvas(ExpDir.NumberOfNames);
+  std::vector<u16> Ordinals(ExpDir.NumberOfNames);
+  if (!rBinStrm.ReadArray(FuncOff, FuncRvas.size(), FuncRvas.data(), LittleEndian))
+  {
+    Log::Write("ldr_pe") << "unable to read function rvas" << LogEnd;
+    return;
+  }
+  if (!rBinStrm.ReadArray(NameOff, NameRvas.size(), NameRvas.data(), LittleEndian))
+  {
+    Log::Write("ldr_pe") << "unable to read export name rvas" << LogEnd;
+    return;
+  }
+  if (!rBinStrm.ReadArray(OrdOff, Ordinals.size(), Ordinals.data(), LittleEndian))
+  {
+    Log::Write("ldr_pe") << "unable to read ordinals" << LogEnd;
+    return;
+  }
+
+  auto AddExport = [&](u32 FuncRva, std::string const& rSymName, u32 Ord)
+  {
+    Address SymAddr(Address::LinearType, 0x0, ImageBase + FuncRva, 0x10, bit);
+    rDoc.AddLabel(
+      SymAddr,
+       // We assume we only export function which is definitely false,
+       // but improve the analysis (false positive should be negligible)
+      Label(rSymName, Label::Exported | Label::Function));
+    rDoc.BindDetailId(SymAddr, 0, Sha1(rSymName));
+
+    Log::Write("ldr_pe") << "found export name: \"" << rSymName << "\", ordinal: " << Ord << LogEnd;
+  };
+
+  // Exported by name
+  std::vector<bool> IsNamed(FuncRvas.size(), false);
+  for (u32 i = 0; i < ExpDir.NumberOfNames; ++i)
+  {
+    u16 Ord = Ordinals[i];
+    if (Ord >= FuncRvas.size())
     {
-      Log::Write("ldr_pe") << "unable to read ordinal: " << i << LogEnd;
-      return;
+      Log::Write("ldr_pe") << "invalid export ordinal: " << Ord << LogEnd;
+      continue;
     }
 
-    u32 FuncRva;
-    if (!rBinStrm.Read(FuncOff + Ord * sizeof(FuncRva), FuncRva))
+    OffsetType SymNameOff;
+    if (!rDoc.ConvertAddressToFileOffset(ImageBase + NameRvas[i], SymNameOff))
     {
-      Log::Write("ldr_pe") << "unable to read function rva: " << i << LogEnd;
-      return;
+      Log::Write("ldr_pe") << "unable to convert export name address to offset" << LogEnd;
+      continue;
     }
-
     std::string SymName;
-    // Function name if available
-    if (i < ExpDir.NumberOfNames)
+    if (!rBinStrm.Read(SymNameOff, SymName))
     {
-      u32 SymNameRva;
-      if (!rBinStrm.Read(NameOff + i * sizeof(SymNameRva), SymNameRva))
-      {
-        Log::Write("ldr_pe") << "unable to read export name rva: " << i << LogEnd;
-        return;
-      }
-      OffsetType SymNameOff;
-      if (!rDoc.ConvertAddressToFileOffset(ImageBase + SymNameRva, SymNameOff))
-      {
-        Log::Write("ldr_pe") << "unable to convert export name address to offset" << LogEnd;
-        return;
-      }
-      if (!rBinStrm.Read(SymNameOff, SymName))
-      {
-        Log::Write("ldr_pe") << "unable to read export name" << LogEnd;
-        return;
-      }
+      Log::Write("ldr_pe") << "unable to read export name" << LogEnd;
+      continue;
     }
-    else
-      SymName = (boost::format("ord_%d") % (Ord + ExpDir.Base)).str();
 
-    Address SymAddr(Address::LinearType, 0x0, ImageBase + FuncRva, 0x10, bit);
-    rDoc.AddLabel(
-      SymAddr,
-       // We assume we only export function which is definitely false,
-       // but improve the analysis (false positive should be negligible)
-      Label(SymName, Label::Exported | Label::Function));
-    rDoc.BindDetailId(SymAddr, 0, Sha1(SymName));
+    IsNamed[Ord] = true;
+    AddExport(FuncRvas[Ord], SymName, Ord);
+  }
 
-    Log::Write("ldr_pe") << "found export name: \"" << SymName << "\", ordinal: " << Ord << LogEnd;
+  // Exported by ordinal only, a null rva is an unused entry
+  for (u32 Ord = 0; Ord < FuncRvas.size(); ++Ord)
+  {
+    if (IsNamed[Ord] || FuncRvas[Ord] == 0)
+      continue;
+    AddExport(FuncRvas[Ord], (boost::format("ord_%d") % (Ord + ExpDir.Base)).str(), Ord);
   }
 }
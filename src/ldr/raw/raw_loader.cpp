@@ -12,10 +12,12 @@ bool RawLoader::IsCompatible(BinaryStream const& rBinStrm)
 
 bool RawLoader::Map(Document& rDoc, Architecture::VSPType const& rArchs)
 {
+  // Memory areas are limited to 32-bit, so only the first 4 GiB are mapped
+  auto RawSize = static_cast<u32>(std::min<u64>(rDoc.GetBinaryStream().GetSize(), 0xffffffff));
   return rDoc.AddMemoryArea(MemoryArea::CreateMapped(
     "raw", MemoryArea::Access::Execute | MemoryArea::Access::Read | MemoryArea::Access::Write,
-    0x0, rDoc.GetBinaryStream().GetSize(),
-    Address(Address::LinearType, 0x0), rDoc.GetBinaryStream().GetSize()
+    0x0, RawSize,
+    Address(Address::LinearType, 0x0), RawSize
     ));
 }
 
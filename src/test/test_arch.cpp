@@ -5,8 +5,22 @@
 #include <medusa/module.hpp>
 #include <medusa/architecture.hpp>
 #include <medusa/instruction.hpp>
+#include <medusa/context.hpp>
 
-TEST_CASE("disassemble", "[arch_arm]")
+#include "arm_architecture.hpp"
+
+#include <cstdio>
+#include <vector>
+
+// Former ARM dispatcher, generated by gen/arch_arm.py in src/bench/bench_arm_dispatch.cpp
+bool BenchDisassembleCascade(ArmArchitecture& rArch, medusa::BinaryStream const& rBinStrm, medusa::OffsetType Offset, medusa::Instruction& rInsn, medusa::u8 Mode);
+typedef bool (ArmArchitecture::*BenchHandlerType)(medusa::BinaryStream const& rBinStrm, medusa::OffsetType Offset, medusa::u32 Opcode, medusa::Instruction& rInsn);
+BenchHandlerType BenchSelectArmTree(medusa::BinaryStream const& rBinStrm, medusa::OffsetType Offset);
+BenchHandlerType BenchSelectArmCascade(medusa::BinaryStream const& rBinStrm, medusa::OffsetType Offset);
+BenchHandlerType BenchSelectThumbTree(medusa::BinaryStream const& rBinStrm, medusa::OffsetType Offset);
+BenchHandlerType BenchSelectThumbCascade(medusa::BinaryStream const& rBinStrm, medusa::OffsetType Offset);
+
+TEST_CASE("disassemble arm", "[arch_arm]")
 {
   INFO("Testing ARM architecture");
 
@@ -43,10 +57,63 @@ TEST_CASE("disassemble", "[arch_arm]")
     INFO("e710019f is ldr r1, [pc,r1], decoded as: " << Data.GetTexts());
   }
 
+  {
+    // 4770 bx lr ; b510 push {r4, lr}
+    medusa::MemoryBinaryStream MemBinStrm("\x70\x47\x10\xb5\x00\xbf", 6);
+    medusa::Instruction BxInsn, PushInsn;
+    CHECK(pArmDisasm->Disassemble(MemBinStrm, 0x0, BxInsn, ThumbMode));
+    CHECK(BxInsn.GetSize() == 2);
+    CHECK(std::string(BxInsn.GetFormat()).compare(0, 2, "BX") == 0);
+    CHECK(pArmDisasm->Disassemble(MemBinStrm, 0x2, PushInsn, ThumbMode));
+    CHECK(PushInsn.GetSize() == 2);
+    CHECK(std::string(PushInsn.GetFormat()).compare(0, 4, "PUSH") == 0);
+  }
+
+  {
+    // f591f000 pldw [r1]
+    medusa::MemoryBinaryStream MemBinStrm("\x00\xf0\x91\xf5", 4);
+    medusa::Instruction Insn;
+    CHECK(pArmDisasm->Disassemble(MemBinStrm, 0x0, Insn, ArmMode));
+    CHECK(std::string(Insn.GetFormat()).compare(0, 6, "PLD{R}") == 0);
+  }
+
+  {
+    // the decision tree must select the same handler and decode like the cascade it replaced
+    std::vector<medusa::u8> Buffer(0x40000);
+    medusa::u32 Seed = 0x6d656475;
+    for (auto& rByte : Buffer)
+    {
+      Seed = Seed * 1103515245 + 12345;
+      rByte = static_cast<medusa::u8>(Seed >> 16);
+    }
+    medusa::MemoryBinaryStream MemBinStrm(Buffer.data(), Buffer.size());
+    ArmArchitecture Arch;
+
+    for (auto Mode : { ArmMode, ThumbMode })
+    {
+      auto pSelectTree    = Mode == ArmMode ? BenchSelectArmTree    : BenchSelectThumbTree;
+      auto pSelectCascade = Mode == ArmMode ? BenchSelectArmCascade : BenchSelectThumbCascade;
+      for (medusa::OffsetType Off = 0; Off + 4 <= Buffer.size(); Off += 2)
+      {
+        medusa::Instruction TreeInsn, CascadeInsn;
+        bool TreeRes = Arch.Disassemble(MemBinStrm, Off, TreeInsn, Mode);
+        bool CascadeRes = BenchDisassembleCascade(Arch, MemBinStrm, Off, CascadeInsn, Mode);
+        bool SameHandler = pSelectTree(MemBinStrm, Off) == pSelectCascade(MemBinStrm, Off);
+        if (!SameHandler || TreeRes != CascadeRes || (TreeRes && TreeInsn.ToString() != CascadeInsn.ToString()))
+        {
+          INFO("mode " << static_cast<int>(Mode) << ", offset " << Off << ": " << TreeInsn.ToString() << " / " << CascadeInsn.ToString());
+          CHECK(SameHandler);
+          CHECK(TreeRes == CascadeRes);
+          CHECK(TreeInsn.ToString() == CascadeInsn.ToString());
+        }
+      }
+    }
+  }
+
   delete pArmDisasm;
 }
 
-TEST_CASE("disassemble", "[arch_x86]")
+TEST_CASE("disassemble x86", "[arch_x86]")
 {
   INFO("Testing x86 architecture");
 
@@ -321,10 +388,229 @@ TEST_CASE("disassemble", "[arch_x86]")
     }
   }
 
+  {
+    INFO("Testing length decoding");
+
+    auto const pLengthTest =
+      "\x55"                                     // push rbp
+      "\x48\x89\xE5"                             // mov rbp, rsp
+      "\x48\x83\xEC\x20"                         // sub rsp, 0x20
+      "\x66\xC7\x44\x24\x08\x34\x12"             // mov word [rsp+8], 0x1234
+      "\x48\xB8\x88\x77\x66\x55\x44\x33\x22\x11" // mov rax, 0x1122334455667788
+      "\xF3\x0F\x58\x05\xB8\x2A\x0B\x08"         // addss xmm0, oword ds:[xxx]
+      "\x0F\x84\x10\x00\x00\x00"                 // je +0x10
+      "\xE8\x00\x00\x00\x00"                     // call +0
+      "\xFF\x24\xC5\x00\x10\x00\x00"             // jmp [rax*8+0x1000]
+      "\xC2\x08\x00"                             // ret 8
+      ;
+    medusa::u32 const LengthTestSize = 1 + 3 + 4 + 7 + 10 + 8 + 6 + 5 + 7 + 3;
+
+    medusa::MemoryBinaryStream MBS(pLengthTest, LengthTestSize);
+    for (auto Mode : { X86_16_Mode, X86_32_Mode, X86_64_Mode })
+    {
+      for (medusa::OffsetType Off = 0; Off < LengthTestSize; ++Off)
+      {
+        medusa::Instruction Insn;
+        medusa::Architecture::InsnClass InsnCls;
+        if (!pX86Disasm->Disassemble(MBS, Off, Insn, Mode))
+          continue;
+        CHECK(pX86Disasm->DecodeLength(MBS, Off, Mode, InsnCls));
+        CHECK(InsnCls.m_Length == Insn.GetSize());
+        CHECK(InsnCls.m_SubType == Insn.GetSubType());
+      }
+    }
+  }
+
   delete pX86Disasm;
 }
 
-TEST_CASE("disassemble", "[arch_st62]")
+TEST_CASE("opcode tables", "[arch_x86]")
+{
+  INFO("Testing x86 decode tables against the decoding of the former per-opcode handlers");
+
+  auto& rModMgr = medusa::ModuleManager::Instance();
+  auto pX86Getter = rModMgr.LoadModule<medusa::TGetArchitecture>(".", "x86");
+  REQUIRE(pX86Getter != nullptr);
+  auto pX86Disasm = pX86Getter();
+
+  // Digests of every opcode of a map decoded with a given prefix: name, opcode, length, prefix, operands,
+  // flags and semantic are hashed. They were generated with the handlers that the tables replaced, where
+  // two bugs were fixed first: far pointers (ptr16:16 / ptr16:32) and pusha/popa being decoded in 64-bit.
+  // Since then, an immediate which follows a ModR/M or another immediate is read after them (e.g. pshufw, enter).
+  struct OpcodeMapDigest
+  {
+    char const*  m_pModeName;
+    medusa::u8   m_Prefix; // 0x00 if none
+    medusa::u8   m_Map;    // index in s_Maps
+    medusa::u64  m_Digest;
+  };
+  static OpcodeMapDigest const s_OpcodeMapDigests[] =
+  {
+    { "16-bit", 0x00, 0, 0x660acc496706c401ULL },
+    { "16-bit", 0x00, 1, 0xaed606f6e29ee8deULL },
+    { "16-bit", 0x00, 2, 0x629436384766dd51ULL },
+    { "16-bit", 0x00, 3, 0xa4618d08d02d0a91ULL },
+    { "16-bit", 0x66, 0, 0x4a9da8ef5af37e71ULL },
+    { "16-bit", 0x66, 1, 0xaed3a4f3f71a087dULL },
+    { "16-bit", 0x66, 2, 0x067b784d82ed4059ULL },
+    { "16-bit", 0x66, 3, 0xa4c0574de092fe67ULL },
+    { "16-bit", 0xf2, 0, 0x4d037f2a30ad4584ULL },
+    { "16-bit", 0xf2, 1, 0x51765e162a02228cULL },
+    { "16-bit", 0xf2, 2, 0xaef5eb4e0c61aa91ULL },
+    { "16-bit", 0xf2, 3, 0x379601ac5e5511b3ULL },
+    { "16-bit", 0xf3, 0, 0x9ca3c674743587baULL },
+    { "16-bit", 0xf3, 1, 0xf6705fa2ce76d5daULL },
+    { "16-bit", 0xf3, 2, 0x009f1b54802de18bULL },
+    { "16-bit", 0xf3, 3, 0x2f7b42a8faf0da7fULL },
+    { "32-bit", 0x00, 0, 0xc81483d875f03d7cULL },
+    { "32-bit", 0x00, 1, 0xd93aa9af0dfa712eULL },
+    { "32-bit", 0x00, 2, 0xe288a0a1e4139b9cULL },
+    { "32-bit", 0x00, 3, 0xc1bea7d4dd2216c8ULL },
+    { "32-bit", 0x66, 0, 0x643ea00bbf6f1752ULL },
+    { "32-bit", 0x66, 1, 0x3f1230696e26c7e9ULL },
+    { "32-bit", 0x66, 2, 0x371fcf6d5a2ef118ULL },
+    { "32-bit", 0x66, 3, 0x45bda1f7f6a335bbULL },
+    { "32-bit", 0xf2, 0, 0x23b080e4d01d2e69ULL },
+    { "32-bit", 0xf2, 1, 0x73646d66d6c99d39ULL },
+    { "32-bit", 0xf2, 2, 0x232b921c58b91f64ULL },
+    { "32-bit", 0xf2, 3, 0xc585c56a76ae0004ULL },
+    { "32-bit", 0xf3, 0, 0x98736a7c23698accULL },
+    { "32-bit", 0xf3, 1, 0x4ff45a47345a1024ULL },
+    { "32-bit", 0xf3, 2, 0xb7dd18aa96bfcb8cULL },
+    { "32-bit", 0xf3, 3, 0xcdb9fe695f73d402ULL },
+    { "64-bit", 0x00, 0, 0xa2a521edcf08ce92ULL },
+    { "64-bit", 0x00, 1, 0xc688169067433374ULL },
+    { "64-bit", 0x00, 2, 0x6b3df98d8bdf9db7ULL },
+    { "64-bit", 0x00, 3, 0x2df99de24f8123e9ULL },
+    { "64-bit", 0x66, 0, 0xa80f7a03bc17d6b2ULL },
+    { "64-bit", 0x66, 1, 0xd26ababfad256c29ULL },
+    { "64-bit", 0x66, 2, 0xc9aae852b335a475ULL },
+    { "64-bit", 0x66, 3, 0x8021c7dad91c0b59ULL },
+    { "64-bit", 0xf2, 0, 0x1fb00f0f69cb1482ULL },
+    { "64-bit", 0xf2, 1, 0x85742e31e9e9b150ULL },
+    { "64-bit", 0xf2, 2, 0xed37771cb6708ea1ULL },
+    { "64-bit", 0xf2, 3, 0x945d7b6a4ad11a6bULL },
+    { "64-bit", 0xf3, 0, 0x193c64df696a5b07ULL },
+    { "64-bit", 0xf3, 1, 0x9fa6f1c438962bd6ULL },
+    { "64-bit", 0xf3, 2, 0x30145dac87cd722bULL },
+    { "64-bit", 0xf3, 3, 0xa8b48e9ef5924aedULL },
+    { "64-bit", 0x48, 0, 0x3582dd0af3162339ULL },
+    { "64-bit", 0x48, 1, 0x41e5cd5527457866ULL },
+    { "64-bit", 0x48, 2, 0x3fa052c2375a6653ULL },
+    { "64-bit", 0x48, 3, 0xd61915441b2272a1ULL }
+  };
+
+  // One byte, 0f, 0f 38 and 0f 3a opcode maps
+  static std::vector<medusa::u8> const s_Maps[] = { {}, { 0x0f }, { 0x0f, 0x38 }, { 0x0f, 0x3a } };
+
+  for (auto const& rMapDigest : s_OpcodeMapDigests)
+  {
+    auto Mode = pX86Disasm->GetModeByName(rMapDigest.m_pModeName);
+    REQUIRE(Mode != 0);
+
+    medusa::u64 Digest = 0xcbf29ce484222325ULL; // FNV-1a
+    auto Hash = [&](std::string const& rStr)
+    {
+      for (auto Chr : rStr)
+        Digest = (Digest ^ static_cast<medusa::u8>(Chr)) * 0x100000001b3ULL;
+    };
+
+    for (medusa::u32 Opcode = 0; Opcode < 0x100; ++Opcode)
+      for (medusa::u32 ModRm = 0; ModRm < 0x100; ++ModRm)
+      {
+        // Every register form (FPU and group opcodes use the whole ModR/M), every reg field with
+        // a memory operand and each addressing form once
+        if ((ModRm & 0xc0) != 0xc0 && (ModRm & 0xc7) != 0x00 && ModRm != 0x04 && ModRm != 0x05 && ModRm != 0x40 && ModRm != 0x80)
+          continue;
+
+        std::vector<medusa::u8> Bytes;
+        if (rMapDigest.m_Prefix != 0x00)
+          Bytes.push_back(rMapDigest.m_Prefix);
+        auto const& rMap = s_Maps[rMapDigest.m_Map];
+        Bytes.insert(std::end(Bytes), std::begin(rMap), std::end(rMap));
+        Bytes.push_back(static_cast<medusa::u8>(Opcode));
+        Bytes.push_back(static_cast<medusa::u8>(ModRm));
+        // SIB, displacement and immediate
+        for (medusa::u8 Trailer = 0x11; Trailer != 0xdd; Trailer += 0x11)
+          Bytes.push_back(Trailer);
+
+        medusa::MemoryBinaryStream MBS(Bytes.data(), static_cast<medusa::u32>(Bytes.size()));
+        medusa::Instruction Insn;
+        if (!pX86Disasm->Disassemble(MBS, 0x0, Insn, Mode))
+        {
+          Hash("!");
+          continue;
+        }
+        Hash(Insn.ToString());
+        char Flags[0x40];
+        std::snprintf(Flags, sizeof(Flags), "%x %x %x %x %x", Insn.GetSubType(),
+          Insn.GetTestedFlags(), Insn.GetUpdatedFlags(), Insn.GetClearedFlags(), Insn.GetFixedFlags());
+        Hash(Flags);
+        for (auto const& rspExpr : Insn.GetSemantic())
+          Hash(rspExpr->ToString());
+      }
+
+    INFO("Mode: " << rMapDigest.m_pModeName << ", prefix: " << std::hex << static_cast<medusa::u32>(rMapDigest.m_Prefix)
+      << ", opcode map: " << static_cast<medusa::u32>(rMapDigest.m_Map));
+    CHECK(Digest == rMapDigest.m_Digest);
+  }
+
+  delete pX86Disasm;
+}
+
+TEST_CASE("cpu context registers", "[arch_x86]")
+{
+  INFO("Testing x86 register descriptors");
+
+  auto& rModMgr = medusa::ModuleManager::Instance();
+  auto pX86Getter = rModMgr.LoadModule<medusa::TGetArchitecture>(".", "x86");
+  REQUIRE(pX86Getter != nullptr);
+  auto pX86Arch = pX86Getter();
+  auto pCpuCtxt = pX86Arch->MakeCpuContext();
+  REQUIRE(pCpuCtxt != nullptr);
+  auto const& rCpuInfo = pCpuCtxt->GetCpuInformation();
+
+  auto Rax = rCpuInfo.ConvertNameToIdentifier("rax");
+  auto Eax = rCpuInfo.ConvertNameToIdentifier("eax");
+  auto Ax  = rCpuInfo.ConvertNameToIdentifier("ax");
+  auto Ah  = rCpuInfo.ConvertNameToIdentifier("ah");
+  auto Al  = rCpuInfo.ConvertNameToIdentifier("al");
+  auto Zf  = rCpuInfo.ConvertNameToIdentifier("zf");
+
+  medusa::u64 RaxVal = 0x1122334455667788ULL;
+  REQUIRE(pCpuCtxt->WriteRegister(Rax, RaxVal));
+  medusa::u8 Byte = 0xaa;
+  REQUIRE(pCpuCtxt->WriteRegister(Ah, Byte));
+  REQUIRE(pCpuCtxt->ReadRegister(Al, Byte));
+  CHECK(Byte == 0x88);
+  medusa::u16 Word;
+  REQUIRE(pCpuCtxt->ReadRegister(Ax, Word));
+  CHECK(Word == 0xaa88);
+  REQUIRE(pCpuCtxt->ReadRegister(Rax, RaxVal));
+  CHECK(RaxVal == 0x112233445566aa88ULL);
+
+  // Writing a 32-bit register clears the upper part
+  medusa::u32 EaxVal = 0xdeadbeef;
+  REQUIRE(pCpuCtxt->WriteRegister(Eax, EaxVal));
+  REQUIRE(pCpuCtxt->ReadRegister(Rax, RaxVal));
+  CHECK(RaxVal == 0xdeadbeefULL);
+  CHECK_FALSE(pCpuCtxt->ReadRegister(Eax, RaxVal));
+
+  auto pAhDesc = pCpuCtxt->GetRegisterDescriptor(Ah);
+  REQUIRE(pAhDesc != nullptr);
+  CHECK(medusa::CpuContext::LoadRegister(*pAhDesc, pCpuCtxt->GetContextAddress()) == 0xbe);
+  auto pZfDesc = pCpuCtxt->GetRegisterDescriptor(Zf);
+  REQUIRE(pZfDesc != nullptr);
+  medusa::CpuContext::StoreRegister(*pZfDesc, pCpuCtxt->GetContextAddress(), 1);
+  bool Flag = false;
+  REQUIRE(pCpuCtxt->ReadRegister(Zf, Flag));
+  CHECK(Flag);
+
+  delete pCpuCtxt;
+  delete pX86Arch;
+}
+
+TEST_CASE("disassemble st62", "[arch_st62]")
 {
   INFO("Testing ST62 architecture");
 
@@ -4,8 +4,18 @@
 #include <medusa/medusa.hpp>
 #include <medusa/detail.hpp>
 #include <medusa/disassembly_view.hpp>
+#include <medusa/string_scanner.hpp>
+#include <medusa/analysis_cache.hpp>
+#include <medusa/user_configuration.hpp>
+#include <medusa/instruction_buffer.hpp>
+#include <medusa/module.hpp>
+#include <medusa/function.hpp>
+
+#include <boost/filesystem/operations.hpp>
 
 #include <iostream>
+#include <fstream>
+#include <mutex>
 
 class TextFullDisassemblyView : public medusa::FullDisassemblyView
 {
@@ -111,6 +121,806 @@ TEST_CASE("big number", "[core]")
   CHECK(Int1.GetSignedValue() == -1);
 }
 
+TEST_CASE("small and wide bit vector", "[core]")
+{
+  using namespace medusa;
+
+  // 64-bit values stay inline, overflow wraps around
+  BitVector Max64(64, 0xffffffffffffffffULL);
+  CHECK((Max64 + BitVector(64, 1)).IsZero());
+  CHECK(Max64.GetSignedValue() == -1);
+  CHECK(Max64.SCmp(BitVector(64, 0)) < 0);
+  CHECK(Max64.UCmp(BitVector(64, 0)) > 0);
+  CHECK(BitVector(8, 0x80).Ars(BitVector(8, 7)).GetUnsignedValue() == 0xff);
+  CHECK(BitVector(32, 0x80000001).Rol(BitVector(32, 1)).GetUnsignedValue() == 3);
+
+  // Crossing 64-bit switches to ap_int and back
+  BitVector Ext = Max64;
+  Ext.SignExtend(128);
+  CHECK(Ext.GetUnsignedValue() == (ap_int(1) << 128) - 1);
+  Ext.BitCast(32);
+  CHECK(Ext.GetUnsignedValue() == 0xffffffff);
+  BitVector Wide(128, ap_int(1) << 100);
+  CHECK(Wide.Lrs(BitVector(128, 100)).GetUnsignedValue() == 1);
+  CHECK((Wide - BitVector(128, 1)).UCmp(Wide) < 0);
+}
+
+TEST_CASE("windowed binary stream", "[core]")
+{
+  using namespace medusa;
+
+  // Create a file which spans several views, with a string across a view boundary
+  auto TmpPath = boost::filesystem::temp_directory_path() / boost::filesystem::unique_path();
+  std::vector<u8> Content(0x30000);
+  for (size_t i = 0; i < Content.size(); ++i)
+    Content[i] = static_cast<u8>(i * 7 + 1);
+  ::memcpy(&Content[0x10000 - 3], "medusa", 7);
+  {
+    std::ofstream TmpFile(TmpPath.string(), std::ios::binary);
+    TmpFile.write(reinterpret_cast<char const*>(Content.data()), Content.size());
+  }
+
+  {
+    FileBinaryStream WholeStrm(TmpPath);
+    FileBinaryStream WndStrm(TmpPath, 0x10000);
+    REQUIRE_FALSE(WholeStrm.IsWindowed());
+    REQUIRE(WndStrm.IsWindowed());
+    CHECK(WndStrm.GetSize() == Content.size());
+
+    u32 WholeVal, WndVal;
+    CHECK(WholeStrm.Read(0xfffe, WholeVal));
+    CHECK(WndStrm.Read(0xfffe, WndVal));
+    CHECK(WholeVal == WndVal);
+
+    std::string Str;
+    CHECK(WndStrm.Read(0x10000 - 3, Str));
+    CHECK(Str == "medusa");
+    CHECK(WndStrm.StringLength(0x10000 - 3) == 6);
+
+    CHECK_FALSE(WndStrm.Read(Content.size() - 2, WndVal));
+    CHECK(WholeStrm.GetSha1() == WndStrm.GetSha1());
+  }
+
+  boost::filesystem::remove(TmpPath);
+}
+
+TEST_CASE("binary stream bulk read", "[core]")
+{
+  using namespace medusa;
+
+  u8 const Raw[] = { 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f, 0x10, 0x11 };
+  MemoryBinaryStream MemBinStrm(Raw, sizeof(Raw));
+
+  for (auto Endianness : { LittleEndian, BigEndian })
+  {
+    MemBinStrm.SetEndianness(Endianness);
+
+    u16 Arr16[9];
+    u32 Arr32[4];
+    u64 Arr64[2];
+    REQUIRE(MemBinStrm.ReadArray(0, 9, Arr16));
+    REQUIRE(MemBinStrm.Read(2, Arr32));
+    REQUIRE(MemBinStrm.ReadArray(1, 2, Arr64));
+
+    for (u32 i = 0; i < 9; ++i)
+    {
+      u16 Val;
+      REQUIRE(MemBinStrm.Read(i * 2, Val));
+      CHECK(Arr16[i] == Val);
+    }
+    for (u32 i = 0; i < 4; ++i)
+    {
+      u32 Val;
+      REQUIRE(MemBinStrm.Read(2 + i * 4, Val));
+      CHECK(Arr32[i] == Val);
+    }
+    for (u32 i = 0; i < 2; ++i)
+    {
+      u64 Val;
+      REQUIRE(MemBinStrm.Read(1 + i * 8, Val));
+      CHECK(Arr64[i] == Val);
+    }
+
+    CHECK_FALSE(MemBinStrm.ReadArray(4, 8, Arr16));
+  }
+
+  MemBinStrm.SetEndianness(BigEndian);
+  CHECK(MemBinStrm.View<u32>(0, 4) == nullptr);
+  CHECK(MemBinStrm.View<u8>(0, sizeof(Raw)) != nullptr);
+
+  MemBinStrm.SetEndianness(LittleEndian);
+  auto pView = MemBinStrm.View<u32>(0, 4);
+  REQUIRE(pView != nullptr);
+  CHECK(pView[1] == 0x07060504);
+  CHECK(MemBinStrm.View<u32>(4, 4) == nullptr);
+}
+
+TEST_CASE("binary stream overlay", "[core]")
+{
+  using namespace medusa;
+
+  std::vector<u8> Raw(0x3000 + 0x64);
+  for (size_t i = 0; i < Raw.size(); ++i)
+    Raw[i] = static_cast<u8>(i + 1);
+
+  auto spViewBinStrm = std::make_shared<MemoryBinaryStream>(Raw.data(), Raw.size(), MemoryBinaryStream::ViewMode);
+  auto& ViewBinStrm = *spViewBinStrm;
+  CHECK(ViewBinStrm.GetBuffer() == Raw.data());
+  CHECK_FALSE(ViewBinStrm.IsOwner());
+
+  OverlayBinaryStream Overlay(spViewBinStrm, 0x10, Raw.size() - 0x10, 0x5000);
+  Overlay.SetEndianness(LittleEndian);
+  CHECK(Overlay.GetSize() == 0x5000);
+  CHECK(Overlay.IsWindowed());
+
+  u8 Byte;
+  REQUIRE(Overlay.Read(0x2000, Byte));
+  CHECK(Byte == Raw[0x2010]);
+  REQUIRE(Overlay.Read(0x4000, Byte));
+  CHECK(Byte == 0x00);
+  CHECK(Overlay.StringLength(0x0) == 0xef);
+  CHECK(Overlay.StringLength(0x3050) == 0x4);
+
+  // Writes crossing a page boundary only copy both pages
+  u32 const Patch = 0xdeadbeef;
+  REQUIRE(Overlay.Write(0xffe, Patch));
+  CHECK(Overlay.GetDirtyPageCount() == 2);
+  u32 Val;
+  REQUIRE(Overlay.Read(0xffe, Val));
+  CHECK(Val == Patch);
+  REQUIRE(Overlay.Read(0xffd, Byte));
+  CHECK(Byte == Raw[0x100d]);
+  CHECK(Raw[0x100e] == 0x0f);
+
+  REQUIRE(Overlay.Write(0x2100, 0, 0x10));
+  CHECK(Overlay.GetDirtyPageCount() == 3);
+  CHECK(Overlay.StringLength(0x20f0) == 0x10);
+  CHECK_FALSE(Overlay.Write(0x4ffe, Patch));
+
+  Overlay.Revert();
+  CHECK(Overlay.GetDirtyPageCount() == 0);
+  REQUIRE(Overlay.Read(0xffe, Byte));
+  CHECK(Byte == Raw[0x100e]);
+
+  // A view writes directly in the caller memory
+  REQUIRE(ViewBinStrm.Write(0x0, Patch));
+  CHECK(Raw[0] == static_cast<u8>(Patch));
+
+  // The overlay keeps its base stream alive
+  std::weak_ptr<MemoryBinaryStream> wpViewBinStrm = spViewBinStrm;
+  spViewBinStrm.reset();
+  REQUIRE_FALSE(wpViewBinStrm.expired());
+  REQUIRE(Overlay.Read(0x10, Byte));
+  CHECK(Byte == Raw[0x20]);
+}
+
+TEST_CASE("memory context pages", "[core]")
+{
+  using namespace medusa;
+
+  auto& rModMgr = ModuleManager::Instance();
+  auto pX86Getter = rModMgr.LoadModule<TGetArchitecture>(".", "x86");
+  REQUIRE(pX86Getter != nullptr);
+  auto pX86Arch = pX86Getter();
+
+  MemoryContext MemCtxt(*pX86Arch->GetCpuInformation());
+  MemCtxt.SetShared(false);
+  REQUIRE(MemCtxt.AllocateMemory(0x10000, 0x2000, MemoryArea::Access::Read | MemoryArea::Access::Write, nullptr));
+  // Unaligned chunk which shares its first page with the previous one
+  REQUIRE(MemCtxt.AllocateMemory(0x12000, 0x800, MemoryArea::Access::Read, nullptr));
+  REQUIRE(MemCtxt.AllocateMemory(0x12800, 0x100, MemoryArea::Access::Read | MemoryArea::Access::Write, nullptr));
+
+  auto pPage = MemCtxt.FindPage(0x10010);
+  REQUIRE(pPage != nullptr);
+  CHECK(pPage->m_Begin == 0x0);
+  CHECK(pPage->m_End == MemoryContext::PageSize);
+  CHECK_FALSE(pPage->m_Split);
+  REQUIRE(MemCtxt.FindPage(0x12900) != nullptr);
+  CHECK(MemCtxt.FindPage(0x12900)->m_Split);
+  CHECK(MemCtxt.FindPage(0x13000) == nullptr);
+
+  // Accesses crossing a page are split
+  u32 const Val = 0xdeadbeef;
+  REQUIRE(MemCtxt.WriteMemory(0x10ffe, Val));
+  u32 ReadVal = 0;
+  REQUIRE(MemCtxt.ReadMemory(0x10ffe, ReadVal));
+  CHECK(ReadVal == Val);
+  REQUIRE(MemCtxt.WriteMemory(0x127fe, Val));
+  REQUIRE(MemCtxt.ReadMemory(0x127fe, ReadVal));
+  CHECK(ReadVal == Val);
+  CHECK_FALSE(MemCtxt.ReadMemory(0x128fe, ReadVal));
+  CHECK_FALSE(MemCtxt.ReadMemory(0xfffe, ReadVal));
+
+  // Flags are only checked if requested
+  MemCtxt.SetAccessCheck(true);
+  CHECK_FALSE(MemCtxt.WriteMemory(0x12000, Val));
+  REQUIRE(MemCtxt.ProtectMemory(0x11000, 0x10, MemoryArea::Access::Read));
+  CHECK(MemCtxt.WriteMemory(0x10ffc, Val));
+  CHECK_FALSE(MemCtxt.WriteMemory(0x10ffe, Val));
+  CHECK_FALSE(MemCtxt.ProtectMemory(0x12000, 0x1000, MemoryArea::Access::Write));
+
+  MemoryTlb MemTlb;
+  auto Gen = MemCtxt.GetGeneration();
+  CHECK(MemTlb.Read(MemCtxt, 0x10ffe, &ReadVal, sizeof(ReadVal)));
+  CHECK(MemTlb.Write(MemCtxt, 0x10010, &Val, sizeof(Val)));
+  CHECK_FALSE(MemTlb.Write(MemCtxt, 0x11010, &Val, sizeof(Val)));
+  CHECK(MemTlb.GetRawMemory(MemCtxt, 0x11010, 4, MemoryArea::Access::Write) == nullptr);
+  REQUIRE(MemCtxt.ProtectMemory(0x11000, 0x10, MemoryArea::Access::Read | MemoryArea::Access::Write));
+  CHECK(MemCtxt.GetGeneration() != Gen);
+  CHECK(MemTlb.Write(MemCtxt, 0x11010, &Val, sizeof(Val)));
+  REQUIRE(MemCtxt.ReadMemory(0x11010, ReadVal));
+  CHECK(ReadVal == Val);
+
+  REQUIRE(MemCtxt.FreeMemory(0x12800));
+  CHECK_FALSE(MemCtxt.FindPage(0x12000)->m_Split);
+  CHECK_FALSE(MemTlb.Read(MemCtxt, 0x12800, &ReadVal, sizeof(ReadVal)));
+
+  delete pX86Arch;
+}
+
+TEST_CASE("string scanner", "[core]")
+{
+  using namespace medusa;
+
+  std::vector<u8> Raw(0x100000 + 0x100, 0x01);
+  auto Put = [&](size_t Offset, char const* pStr, size_t Len)
+  {
+    std::copy(pStr, pStr + Len, Raw.begin() + Offset);
+  };
+  Put(3,   "hello world\0", 12);
+  Put(100, "caf\xc3\xa9 au lait\0", 14);
+  Put(200, "w\0i\0d\0e\0\0\0", 10);
+  Put(301, "\0b\0i\0g\0e\0n\0d\0\0", 14);
+  Put(0x100000 - 5, "across chunks\0", 14);
+
+  MemoryBinaryStream MemBinStrm(Raw.data(), Raw.size());
+  StringScanner Scanner;
+  Scanner.SetThreadCount(2);
+
+  auto Candidates = Scanner.Scan(MemBinStrm, 0, MemBinStrm.GetSize());
+  REQUIRE(Candidates.size() == 5);
+
+  CHECK(Candidates[0].m_Offset == 3);
+  CHECK(Candidates[0].m_Encoding == StringScanner::AsciiEncoding);
+  CHECK(Candidates[0].m_Value == "hello world");
+  CHECK(Candidates[0].m_Terminated);
+
+  CHECK(Candidates[1].m_Offset == 100);
+  CHECK(Candidates[1].m_Encoding == StringScanner::Utf8Encoding);
+  CHECK(Candidates[1].m_Value == "caf\xc3\xa9 au lait");
+
+  CHECK(Candidates[2].m_Offset == 200);
+  CHECK(Candidates[2].m_Encoding == StringScanner::Utf16LeEncoding);
+  CHECK(Candidates[2].m_RawLength == 8);
+  CHECK(Candidates[2].m_Value == "wide");
+
+  CHECK(Candidates[3].m_Offset == 301);
+  CHECK(Candidates[3].m_Encoding == StringScanner::Utf16BeEncoding);
+  CHECK(Candidates[3].m_Value == "bigend");
+
+  CHECK(Candidates[4].m_Offset == 0x100000 - 5);
+  CHECK(Candidates[4].m_Value == "across chunks");
+
+  Scanner.SetEncodings(StringScanner::AsciiEncoding);
+  Scanner.SetMinLength(12);
+  Candidates = Scanner.Scan(MemBinStrm, 0, MemBinStrm.GetSize());
+  REQUIRE(Candidates.size() == 1);
+  CHECK(Candidates[0].m_Value == "across chunks");
+}
+
+TEST_CASE("string scanner keeps code", "[core]")
+{
+  using namespace medusa;
+
+  static u8 const Raw[] =
+  {
+    'a', 'b', 'c', 'd', 'e', 'f', 'g', 'h', 0x00,
+    0x90, 0x90, 0x90,
+    'm', 'e', 'd', 'u', 's', 'a', 0x00,
+    0x90,
+    'b', 'e', 'f', 'o', 'r', 'e', 0x00,
+  };
+
+  Medusa Core;
+  REQUIRE(Core.NewDocument(std::make_shared<MemoryBinaryStream>(Raw, sizeof(Raw)), false, Medusa::IgnoreDatabasePath,
+    [](BinaryStream::SPType&, Database::SPType& rspDb, Loader::SPType& rspLdr, Architecture::VSPType& rspArchs, OperatingSystem::SPType&)
+  {
+    auto& rModMgr = ModuleManager::Instance();
+    if (rModMgr.GetDatabases().empty())
+      return false;
+    rspDb = rModMgr.GetDatabases().front();
+    for (auto spLdr : rModMgr.GetLoaders())
+      if (spLdr->GetName() == "Raw file")
+        rspLdr = spLdr;
+    rspArchs = rModMgr.GetArchitectures();
+    return rspLdr != nullptr;
+  }));
+  auto& rDoc = Core.GetDocument();
+  auto MakeAddr = [&](OffsetType Offset) { return rDoc.MakeAddress(0x0, Offset); };
+
+  // The first instruction is inside a string, the second one starts before a string
+  Tag const ArchTag = MEDUSA_ARCH_TAG('x', '8', '6');
+  REQUIRE(rDoc.SetCell(MakeAddr(0x2), std::make_shared<Cell>(std::make_shared<CellData>(Cell::InstructionType, 0, 2, 0, 0, ArchTag, 1)), true));
+  REQUIRE(rDoc.SetCell(MakeAddr(0x13), std::make_shared<Cell>(std::make_shared<CellData>(Cell::InstructionType, 0, 3, 0, 0, ArchTag, 1)), true));
+
+  StringScanner Scanner(4, StringScanner::AsciiEncoding);
+  CHECK(Scanner.CreateStrings(rDoc) == 1);
+  CHECK(rDoc.GetCellType(MakeAddr(0xc)) == Cell::StringType);
+  CHECK(rDoc.GetCellType(MakeAddr(0x0)) != Cell::StringType);
+  CHECK(rDoc.GetCellType(MakeAddr(0x14)) != Cell::StringType);
+  CHECK(rDoc.ContainsCode(MakeAddr(0x2)));
+  CHECK(rDoc.ContainsCode(MakeAddr(0x13)));
+}
+
+TEST_CASE("string scanner new document", "[core]")
+{
+  using namespace medusa;
+
+  static u8 const Raw[] =
+  {
+    0xc3,
+    'm', 'e', 'd', 'u', 's', 'a', 0x00,
+  };
+
+  // Raw files have no label, so only the scanner can find the string
+  Medusa Core;
+  REQUIRE(Core.NewDocument(std::make_shared<MemoryBinaryStream>(Raw, sizeof(Raw)), true, Medusa::IgnoreDatabasePath,
+    [](BinaryStream::SPType&, Database::SPType& rspDb, Loader::SPType& rspLdr, Architecture::VSPType& rspArchs, OperatingSystem::SPType&)
+  {
+    auto& rModMgr = ModuleManager::Instance();
+    if (rModMgr.GetDatabases().empty())
+      return false;
+    rspDb = rModMgr.GetDatabases().front();
+    for (auto spLdr : rModMgr.GetLoaders())
+      if (spLdr->GetName() == "Raw file")
+        rspLdr = spLdr;
+    rspArchs = rModMgr.GetArchitectures();
+    return rspLdr != nullptr;
+  }));
+  Core.WaitForTasks();
+
+  auto& rDoc = Core.GetDocument();
+  CHECK(rDoc.GetCellType(rDoc.MakeAddress(0x0, 0x1)) == Cell::StringType);
+  CHECK(rDoc.GetLabelFromAddress(rDoc.MakeAddress(0x0, 0x1)).GetName() == "medusa");
+}
+
+TEST_CASE("analysis cache key", "[core]")
+{
+  using namespace medusa;
+
+  std::vector<u8> Raw(0x400000 * 3 + 0x123);
+  for (size_t i = 0; i < Raw.size(); ++i)
+    Raw[i] = static_cast<u8>(i * 7 + (i >> 12));
+  MemoryBinaryStream MemBinStrm(Raw.data(), Raw.size());
+
+  auto Key = AnalysisCache::ComputeKey(MemBinStrm, 0, MemBinStrm.GetSize(), 1);
+  CHECK(Key.size() == 40);
+  CHECK(AnalysisCache::ComputeKey(MemBinStrm, 0, MemBinStrm.GetSize(), 4) == Key);
+  CHECK(AnalysisCache::ComputeKey(MemBinStrm, 0, MemBinStrm.GetSize() - 1, 4) != Key);
+  CHECK(AnalysisCache::ComputeKey(MemBinStrm, 0x10, 0x100) == AnalysisCache::ComputeKey(MemoryBinaryStream(Raw.data() + 0x10, 0x100), 0, 0x100));
+
+  Raw[0x400000 * 2 + 1] ^= 1;
+  MemoryBinaryStream ModBinStrm(Raw.data(), Raw.size());
+  CHECK(AnalysisCache::ComputeKey(ModBinStrm, 0, ModBinStrm.GetSize()) != Key);
+}
+
+TEST_CASE("memory context overlay pages", "[core]")
+{
+  using namespace medusa;
+
+  static u8 const Raw[] = { 0x55, 0x89, 0xe5, 0x31, 0xc0, 0x5d, 0xc3 };
+
+  Medusa Core;
+  REQUIRE(Core.NewDocument(std::make_shared<MemoryBinaryStream>(Raw, sizeof(Raw)), false, Medusa::IgnoreDatabasePath,
+    [](BinaryStream::SPType&, Database::SPType& rspDb, Loader::SPType& rspLdr, Architecture::VSPType& rspArchs, OperatingSystem::SPType&)
+  {
+    auto& rModMgr = ModuleManager::Instance();
+    if (rModMgr.GetDatabases().empty())
+      return false;
+    rspDb = rModMgr.GetDatabases().front();
+    for (auto spLdr : rModMgr.GetLoaders())
+      if (spLdr->GetName() == "Raw file")
+        rspLdr = spLdr;
+    rspArchs = rModMgr.GetArchitectures();
+    return rspLdr != nullptr;
+  }));
+
+  auto spArch = ModuleManager::Instance().GetArchitecture(MEDUSA_ARCH_TAG('x', '8', '6'));
+  REQUIRE(spArch != nullptr);
+  std::unique_ptr<CpuContext> upCpuCtxt(spArch->MakeCpuContext());
+  std::unique_ptr<MemoryContext> upMemCtxt(spArch->MakeMemoryContext());
+  upMemCtxt->SetShared(false);
+  REQUIRE(upMemCtxt->MapDocument(Core.GetDocument(), upCpuCtxt.get()));
+
+  OverlayBinaryStream* pOvrStrm = nullptr;
+  upMemCtxt->ForEachMemoryChunk([&](MemoryContext::MemoryChunk const& rMemChnk)
+  {
+    pOvrStrm = dynamic_cast<OverlayBinaryStream*>(rMemChnk.m_spMemStrm.get());
+  });
+  REQUIRE(pOvrStrm != nullptr);
+
+  // The document is mapped through an overlay, its clean pages are read from the document buffer
+  auto pDocBuf = static_cast<u8 const*>(Core.GetDocument().GetBinaryStream().GetBuffer());
+  auto pPage = upMemCtxt->FindPage(0x0);
+  REQUIRE(pPage != nullptr);
+  CHECK(pPage->m_pRaw == nullptr);
+  CHECK(pPage->m_pReadRaw == pDocBuf);
+
+  MemoryTlb MemTlb;
+  u32 ReadVal = 0;
+  REQUIRE(MemTlb.Read(*upMemCtxt, 0x1, &ReadVal, sizeof(ReadVal)));
+  CHECK(ReadVal == 0xc031e589);
+  CHECK(MemTlb.GetRawMemory(*upMemCtxt, 0x0, 1, MemoryArea::Access::Read) == pDocBuf);
+  CHECK(pOvrStrm->GetDirtyPageCount() == 0);
+
+  // The first write copies the page, then every access goes to the copy
+  u32 const Val = 0xdeadbeef;
+  REQUIRE(MemTlb.Write(*upMemCtxt, 0x1, &Val, sizeof(Val)));
+  CHECK(pOvrStrm->GetDirtyPageCount() == 1);
+  pPage = upMemCtxt->FindPage(0x0);
+  REQUIRE(pPage->m_pRaw != nullptr);
+  CHECK(pPage->m_pReadRaw == pPage->m_pRaw);
+  REQUIRE(upMemCtxt->ReadMemory(0x1, ReadVal));
+  CHECK(ReadVal == Val);
+  REQUIRE(MemTlb.Read(*upMemCtxt, 0x3, &ReadVal, sizeof(ReadVal)));
+  CHECK(ReadVal == 0xc35ddead);
+  CHECK(MemTlb.GetRawMemory(*upMemCtxt, 0x0, 1, MemoryArea::Access::Read) == pPage->m_pRaw);
+  CHECK(pDocBuf[1] == 0x89);
+}
+
+TEST_CASE("analysis cache roundtrip", "[core]")
+{
+  using namespace medusa;
+
+  static u8 const Raw[] =
+  {
+    0x55, 0x89, 0xe5, 0x31, 0xc0, 0x5d, 0xc3,  // push ebp; mov ebp, esp; xor eax, eax; pop ebp; ret
+    'm', 'e', 'd', 'u', 's', 'a', 0x00,
+    0x00, 0x10, 0x00, 0x00,
+  };
+  Tag const ArchTag = MEDUSA_ARCH_TAG('x', '8', '6');
+
+  auto CachePath = boost::filesystem::temp_directory_path() / boost::filesystem::unique_path();
+  REQUIRE(boost::filesystem::create_directories(CachePath));
+  AnalysisCache Cache(CachePath);
+
+  // Both documents map the file at 0x0 with the raw loader
+  auto NewRawDocument = [&](Medusa& rCore)
+  {
+    return rCore.NewDocument(std::make_shared<MemoryBinaryStream>(Raw, sizeof(Raw)), false, Medusa::IgnoreDatabasePath,
+      [](BinaryStream::SPType&, Database::SPType& rspDb, Loader::SPType& rspLdr, Architecture::VSPType& rspArchs, OperatingSystem::SPType&)
+    {
+      auto& rModMgr = ModuleManager::Instance();
+      if (rModMgr.GetDatabases().empty())
+        return false;
+      rspDb = rModMgr.GetDatabases().front();
+      for (auto spLdr : rModMgr.GetLoaders())
+        if (spLdr->GetName() == "Raw file")
+          rspLdr = spLdr;
+      rspArchs = rModMgr.GetArchitectures();
+      return rspLdr != nullptr;
+    });
+  };
+
+  Medusa StoredCore;
+  REQUIRE(NewRawDocument(StoredCore));
+  auto& rStoredDoc = StoredCore.GetDocument();
+  auto MakeAddr = [&](OffsetType Offset) { return rStoredDoc.MakeAddress(0x0, Offset); };
+
+  static u16 const InsnSizes[] = { 1, 2, 2, 1, 1 };
+  OffsetType InsnOff = 0;
+  for (auto InsnSize : InsnSizes)
+  {
+    auto spInsnData = std::make_shared<CellData>(Cell::InstructionType, 0, InsnSize, 0, 0, ArchTag, 1);
+    REQUIRE(rStoredDoc.SetCell(MakeAddr(InsnOff), std::make_shared<Cell>(spInsnData), true));
+    InsnOff += InsnSize;
+  }
+  REQUIRE(rStoredDoc.SetCell(MakeAddr(0x7), std::make_shared<String>(String::Utf8Type, 7), true));
+  REQUIRE(rStoredDoc.SetCell(MakeAddr(0xe), std::make_shared<Value>(ValueDetail::HexadecimalType, 4), true));
+  REQUIRE(rStoredDoc.AddLabel(MakeAddr(0x0), Label("start", Label::Code | Label::Exported)));
+  REQUIRE(rStoredDoc.AddLabel(MakeAddr(0x7), Label("name", Label::String | Label::Global)));
+  REQUIRE(rStoredDoc.AddCrossReference(MakeAddr(0x0), MakeAddr(0xe)));
+  REQUIRE(rStoredDoc.SetComment(MakeAddr(0x3), "return 0"));
+  REQUIRE(rStoredDoc.SetMultiCell(MakeAddr(0x0), std::make_shared<Function>(7, 5), true));
+  REQUIRE(rStoredDoc.SetMultiCell(MakeAddr(0x7), std::make_shared<MultiCell>(MultiCell::StructType, 11), true));
+  REQUIRE(Cache.Store(rStoredDoc));
+
+  Medusa LoadedCore;
+  REQUIRE(NewRawDocument(LoadedCore));
+  auto& rLoadedDoc = LoadedCore.GetDocument();
+  bool Complete = false;
+  REQUIRE(Cache.Load(rLoadedDoc, AnalysisCache::ComputeKey(rLoadedDoc.GetBinaryStream(), 0, sizeof(Raw)), Complete));
+  CHECK(Complete);
+
+  for (OffsetType Offset = 0; Offset < sizeof(Raw); ++Offset)
+  {
+    INFO("offset " << Offset);
+    auto CurAddr = MakeAddr(Offset);
+
+    CellData StoredData, LoadedData;
+    REQUIRE(rStoredDoc.GetCellData(CurAddr, StoredData));
+    REQUIRE(rLoadedDoc.GetCellData(CurAddr, LoadedData));
+    CHECK(LoadedData.Dump() == StoredData.Dump());
+
+    auto StoredLbl = rStoredDoc.GetLabelFromAddress(CurAddr);
+    auto LoadedLbl = rLoadedDoc.GetLabelFromAddress(CurAddr);
+    CHECK(LoadedLbl.GetName() == StoredLbl.GetName());
+    CHECK(LoadedLbl.GetType() == StoredLbl.GetType());
+
+    Address::Vector StoredTo, LoadedTo;
+    rStoredDoc.GetCrossReferenceTo(CurAddr, StoredTo);
+    rLoadedDoc.GetCrossReferenceTo(CurAddr, LoadedTo);
+    CHECK(LoadedTo == StoredTo);
+
+    std::string StoredCmt, LoadedCmt;
+    rStoredDoc.GetComment(CurAddr, StoredCmt);
+    rLoadedDoc.GetComment(CurAddr, LoadedCmt);
+    CHECK(LoadedCmt == StoredCmt);
+
+    auto spStoredMultiCell = rStoredDoc.GetMultiCell(CurAddr);
+    auto spLoadedMultiCell = rLoadedDoc.GetMultiCell(CurAddr);
+    REQUIRE((spLoadedMultiCell == nullptr) == (spStoredMultiCell == nullptr));
+    if (spStoredMultiCell == nullptr)
+      continue;
+    CHECK(spLoadedMultiCell->GetType() == spStoredMultiCell->GetType());
+    CHECK(spLoadedMultiCell->GetSize() == spStoredMultiCell->GetSize());
+    if (spStoredMultiCell->GetType() == MultiCell::FunctionType)
+      CHECK(std::static_pointer_cast<Function>(spLoadedMultiCell)->GetInstructionCount() == 5);
+  }
+
+  boost::filesystem::remove_all(CachePath);
+}
+
+TEST_CASE("analysis cache base address", "[core]")
+{
+  using namespace medusa;
+
+  static u8 const Raw[] =
+  {
+    0xe8, 0x00, 0x00, 0x00, 0x00,  // call $+5
+    0xc3,                          // ret
+  };
+
+  // Maps the whole file at a fixed base address
+  class BasedLoader : public Loader
+  {
+  public:
+    BasedLoader(OffsetType Base) : m_Base(Base) {}
+    std::string GetName(void) const { return "Based file"; }
+    u8 GetDepth(void) const { return 0; }
+    bool IsCompatible(BinaryStream const& rBinStrm) { return true; }
+    bool Map(Document& rDoc, Architecture::VSPType const& rArchs)
+    {
+      return rDoc.AddMemoryArea(MemoryArea::CreateMapped("based", MemoryArea::Access::Execute | MemoryArea::Access::Read,
+        0x0, sizeof(Raw), Address(Address::LinearType, m_Base), sizeof(Raw)));
+    }
+    bool Map(Document& rDoc, Architecture::VSPType const& rArchs, Address const& rImgBase) { return false; }
+    void FilterAndConfigureArchitectures(Architecture::VSPType& rArchs) const {}
+
+  private:
+    OffsetType m_Base;
+  };
+
+  auto CachePath = boost::filesystem::temp_directory_path() / boost::filesystem::unique_path();
+  REQUIRE(boost::filesystem::create_directories(CachePath));
+  AnalysisCache Cache(CachePath);
+
+  auto NewBasedDocument = [&](Medusa& rCore, OffsetType Base)
+  {
+    return rCore.NewDocument(std::make_shared<MemoryBinaryStream>(Raw, sizeof(Raw)), false, Medusa::IgnoreDatabasePath,
+      [&](BinaryStream::SPType&, Database::SPType& rspDb, Loader::SPType& rspLdr, Architecture::VSPType& rspArchs, OperatingSystem::SPType&)
+    {
+      auto& rModMgr = ModuleManager::Instance();
+      if (rModMgr.GetDatabases().empty())
+        return false;
+      rspDb = rModMgr.GetDatabases().front();
+      rspLdr = std::make_shared<BasedLoader>(Base);
+      rspArchs = rModMgr.GetArchitectures();
+      return true;
+    });
+  };
+
+  Medusa StoredCore;
+  REQUIRE(NewBasedDocument(StoredCore, 0x1000));
+  auto& rStoredDoc = StoredCore.GetDocument();
+  REQUIRE(rStoredDoc.AddLabel(rStoredDoc.MakeAddress(0x0, 0x1005), Label("sub_1005", Label::Code | Label::Global)));
+  REQUIRE(rStoredDoc.AddCrossReference(rStoredDoc.MakeAddress(0x0, 0x1005), rStoredDoc.MakeAddress(0x0, 0x1000)));
+  REQUIRE(Cache.Store(rStoredDoc));
+
+  // The same bytes at another base must not inherit absolute addresses
+  Medusa MovedCore;
+  REQUIRE(NewBasedDocument(MovedCore, 0x2000));
+  auto& rMovedDoc = MovedCore.GetDocument();
+  bool Complete = true;
+  CHECK_FALSE(Cache.Load(rMovedDoc, AnalysisCache::ComputeKey(rMovedDoc.GetBinaryStream(), 0, sizeof(Raw)), Complete));
+  CHECK_FALSE(Complete);
+  Address::Vector ToAddrs;
+  CHECK_FALSE(rMovedDoc.GetCrossReferenceTo(rMovedDoc.MakeAddress(0x0, 0x2000), ToAddrs));
+  CHECK_FALSE(rMovedDoc.GetCrossReferenceTo(rMovedDoc.MakeAddress(0x0, 0x1000), ToAddrs));
+  CHECK(rMovedDoc.GetLabelFromAddress(rMovedDoc.MakeAddress(0x0, 0x2005)).GetType() == Label::Unknown);
+
+  // The same bytes at the same base still hit
+  Medusa SameCore;
+  REQUIRE(NewBasedDocument(SameCore, 0x1000));
+  auto& rSameDoc = SameCore.GetDocument();
+  REQUIRE(Cache.Load(rSameDoc, AnalysisCache::ComputeKey(rSameDoc.GetBinaryStream(), 0, sizeof(Raw)), Complete));
+  CHECK(Complete);
+  REQUIRE(rSameDoc.GetCrossReferenceTo(rSameDoc.MakeAddress(0x0, 0x1000), ToAddrs));
+  REQUIRE(ToAddrs.size() == 1);
+  CHECK(ToAddrs.front() == rSameDoc.MakeAddress(0x0, 0x1005));
+  CHECK(rSameDoc.GetLabelFromAddress(rSameDoc.MakeAddress(0x0, 0x1005)).GetName() == "sub_1005");
+
+  boost::filesystem::remove_all(CachePath);
+}
+
+TEST_CASE("analysis cache new document", "[core]")
+{
+  using namespace medusa;
+
+  static u8 const Raw[] =
+  {
+    0x55, 0x89, 0xe5, 0x31, 0xc0, 0x5d, 0xc3,  // push ebp; mov ebp, esp; xor eax, eax; pop ebp; ret
+  };
+
+  // NewDocument reads the cache path from the user configuration, the previous value is restored on exit
+  struct CachePathOption
+  {
+    CachePathOption(Path const& rCachePath)
+    {
+      m_UserCfg.GetOption("core.cache_path", m_OldValue);
+      m_UserCfg.SetOption("core.cache_path", rCachePath.string());
+    }
+    ~CachePathOption(void) { m_UserCfg.SetOption("core.cache_path", m_OldValue); }
+
+    UserConfiguration m_UserCfg;
+    std::string       m_OldValue;
+  };
+
+  auto CachePath = boost::filesystem::temp_directory_path() / boost::filesystem::unique_path();
+  REQUIRE(boost::filesystem::create_directories(CachePath));
+  CachePathOption CacheOpt(CachePath);
+
+  auto NewRawDocument = [&](Medusa& rCore)
+  {
+    return rCore.NewDocument(std::make_shared<MemoryBinaryStream>(Raw, sizeof(Raw)), true, Medusa::IgnoreDatabasePath,
+      [](BinaryStream::SPType&, Database::SPType& rspDb, Loader::SPType& rspLdr, Architecture::VSPType& rspArchs, OperatingSystem::SPType&)
+    {
+      auto& rModMgr = ModuleManager::Instance();
+      if (rModMgr.GetDatabases().empty())
+        return false;
+      rspDb = rModMgr.GetDatabases().front();
+      for (auto spLdr : rModMgr.GetLoaders())
+        if (spLdr->GetName() == "Raw file")
+          rspLdr = spLdr;
+      rspArchs = rModMgr.GetArchitectures();
+      return rspLdr != nullptr;
+    });
+  };
+
+  auto FileKey = AnalysisCache::ComputeKey(MemoryBinaryStream(Raw, sizeof(Raw)), 0, sizeof(Raw));
+  auto FileEntryPath = CachePath / (FileKey + ".mdf");
+
+  // A miss queues the store task after the analysis
+  {
+    Medusa MissCore;
+    REQUIRE(NewRawDocument(MissCore));
+    MissCore.WaitForTasks();
+  }
+  REQUIRE(boost::filesystem::exists(FileEntryPath));
+
+  // A complete hit neither analyzes nor stores the file again, so its entry is left untouched
+  std::time_t const OldTime = 0x10000000;
+  boost::filesystem::last_write_time(FileEntryPath, OldTime);
+  {
+    Medusa HitCore;
+    REQUIRE(NewRawDocument(HitCore));
+    HitCore.WaitForTasks();
+  }
+  CHECK(boost::filesystem::last_write_time(FileEntryPath) == OldTime);
+
+  // Without the file entry, the memory area is reused but the file is analyzed and stored again
+  REQUIRE(boost::filesystem::remove(FileEntryPath));
+  {
+    Medusa PartialCore;
+    REQUIRE(NewRawDocument(PartialCore));
+    PartialCore.WaitForTasks();
+  }
+  CHECK(boost::filesystem::exists(FileEntryPath));
+
+  boost::filesystem::remove_all(CachePath);
+}
+
+TEST_CASE("analysis cache store order", "[core]")
+{
+  using namespace medusa;
+
+  // NewDocument queues the analysis before the store task, so the cache is written once the analysis is done
+  class NamedTask : public Task
+  {
+  public:
+    NamedTask(std::string const& rName, std::vector<std::string>& rRunNames, std::mutex& rMutex)
+      : m_Name(rName), m_rRunNames(rRunNames), m_rMutex(rMutex) {}
+    std::string GetName(void) const { return m_Name; }
+    void Run(void)
+    {
+      std::this_thread::sleep_for(std::chrono::milliseconds(10));
+      std::lock_guard<std::mutex> Lock(m_rMutex);
+      m_rRunNames.push_back(m_Name);
+    }
+
+  private:
+    std::string               m_Name;
+    std::vector<std::string>& m_rRunNames;
+    std::mutex&               m_rMutex;
+  };
+
+  std::vector<std::string> const Expected = { "disassemble all functions", "scan all strings", "store analysis cache" };
+  std::vector<std::string> RunNames, NotifiedNames;
+  std::mutex Mutex;
+  {
+    TaskManager TaskMgr([&](Task const* pTask)
+    {
+      std::lock_guard<std::mutex> Lock(Mutex);
+      NotifiedNames.push_back(pTask->GetName());
+    });
+    for (auto const& rName : Expected)
+      REQUIRE(TaskMgr.AddTask(new NamedTask(rName, RunNames, Mutex)));
+    TaskMgr.Wait();
+  }
+
+  CHECK(RunNames == Expected);
+  CHECK(NotifiedNames == Expected);
+}
+
+TEST_CASE("arena", "[core]")
+{
+  using namespace medusa;
+
+  Arena Mem;
+  for (u16 i = 0; i < 0x100; ++i)
+    REQUIRE(Mem.Allocate(0x40, 8) != nullptr);
+  REQUIRE(Mem.GetReservedSize() > 0x1000);
+
+  // Only the first chunk is used after a rewind, the other ones must be released by a trim
+  Mem.Rewind();
+  Mem.Allocate(0x40, 8);
+  Mem.Trim();
+  CHECK(Mem.GetReservedSize() == 0x1000);
+}
+
+TEST_CASE("instruction buffer", "[core]")
+{
+  using namespace medusa;
+
+  Instruction::SPType spKeptInsn;
+  {
+    InstructionBuffer InsnBuf;
+    for (u16 i = 0; i < 0x400; ++i)
+    {
+      auto spInsn = InsnBuf.MakeInstruction();
+      spInsn->Size() = (i % 15) + 1;
+      InsnBuf.PushBack(spInsn);
+    }
+    REQUIRE(InsnBuf.GetSize() == 0x400);
+    CHECK(InsnBuf[0x123]->GetSize() == (0x123 % 15) + 1);
+    CHECK(InsnBuf.Back()->GetType() == Cell::InstructionType);
+
+    InsnBuf.Truncate(0x10);
+    CHECK(InsnBuf.GetSize() == 0x10);
+
+    spKeptInsn = InsnBuf[3];
+    InsnBuf.Clear();
+    CHECK(InsnBuf.IsEmpty());
+
+    // The arena must not be rewound while an instruction is still referenced
+    auto spNewInsn = InsnBuf.MakeInstruction();
+    CHECK(spNewInsn.get() != spKeptInsn.get());
+  }
+
+  // The instruction outlives its buffer
+  CHECK(spKeptInsn->GetSize() == 4);
+}
+
 TEST_CASE("structure", "[core]")
 {
   INFO("Testing structure");
@@ -6,8 +6,370 @@
 #include <medusa/emulation.hpp>
 #include <medusa/execution.hpp>
 
+#include <cstring>
+#include <functional>
 #include <iostream>
 
+namespace
+{
+  using namespace medusa;
+
+  Architecture::SPType GetX86Architecture(void)
+  {
+    static Architecture::SPType s_spX86Arch;
+    if (s_spX86Arch != nullptr)
+      return s_spX86Arch;
+
+    auto& rModMgr = ModuleManager::Instance();
+    auto pX86Getter = rModMgr.LoadModule<TGetArchitecture>(".", "x86");
+    if (pX86Getter == nullptr)
+      return nullptr;
+    s_spX86Arch = Architecture::SPType(pX86Getter());
+    // Emulators find the architecture of the decoded code with the module manager
+    rModMgr.RegisterArchitecture(s_spX86Arch);
+    return s_spX86Arch;
+  }
+
+  // Emulates raw 32-bit x86 code mapped at 0x1000, the stack is mapped at 0x4000
+  class X86Emulation
+  {
+  public:
+    X86Emulation(std::vector<u8> const& rCode, char const* pEmulatorType = "interpreter")
+      : m_pCpuCtxt(nullptr), m_pMemCtxt(nullptr), m_pEmul(nullptr), m_CodeSize(static_cast<u32>(rCode.size())), m_UseTreeWalker(false)
+    {
+      m_spArch = GetX86Architecture();
+      if (m_spArch == nullptr)
+        return;
+      auto pGetEmulator = ModuleManager::Instance().LoadModule<TGetEmulator>(".", pEmulatorType);
+      if (pGetEmulator == nullptr)
+        return;
+
+      m_pCpuCtxt = m_spArch->MakeCpuContext();
+      m_pMemCtxt = m_spArch->MakeMemoryContext();
+      m_pCpuCtxt->SetMode(m_spArch->GetModeByName("32-bit"));
+      void* pCode = nullptr;
+      m_pMemCtxt->AllocateMemory(0x1000, 0x1000, MemoryArea::Access::Execute | MemoryArea::Access::Read, &pCode);
+      m_pMemCtxt->AllocateMemory(0x4000, 0x1000, MemoryArea::Access::Read | MemoryArea::Access::Write, nullptr);
+      std::memcpy(pCode, rCode.data(), rCode.size());
+      SetRegister("esp", 0x4800);
+      SetAddress(0x1000);
+
+      m_pEmul = pGetEmulator(m_spArch->GetCpuInformation(), m_pCpuCtxt, m_pMemCtxt);
+    }
+
+    ~X86Emulation(void)
+    {
+      delete m_pEmul;
+      delete m_pMemCtxt;
+      delete m_pCpuCtxt;
+    }
+
+    bool IsValid(void) const { return m_pEmul != nullptr; }
+    Emulator& GetEmulator(void) { return *m_pEmul; }
+    CpuContext& GetCpuContext(void) { return *m_pCpuCtxt; }
+    MemoryContext& GetMemoryContext(void) { return *m_pMemCtxt; }
+
+    template<typename _RegTy>
+    bool SetRegister(char const* pRegName, _RegTy Val)
+    {
+      return m_pCpuCtxt->WriteRegister(m_spArch->GetCpuInformation()->ConvertNameToIdentifier(pRegName), Val);
+    }
+
+    template<typename _RegTy>
+    _RegTy GetRegister(char const* pRegName) const
+    {
+      _RegTy Val = 0;
+      m_pCpuCtxt->ReadRegister(m_spArch->GetCpuInformation()->ConvertNameToIdentifier(pRegName), Val);
+      return Val;
+    }
+
+    //! This method makes Step bypass the compiled blocks of the emulator and use its tree walker.
+    void SetTreeWalker(bool UseTreeWalker) { m_UseTreeWalker = UseTreeWalker; }
+
+    std::string GetStack(void) const
+    {
+      std::string Stack(0x1000, '\0');
+      m_pMemCtxt->ReadMemory(0x4000, &Stack[0], static_cast<u32>(Stack.size()));
+      return Stack;
+    }
+
+    void SetAddress(u32 Offset)
+    {
+      m_pCpuCtxt->SetAddress(CpuContext::AddressExecution, Address(Address::LinearType, 0x0, Offset, 16, 32));
+    }
+
+    u32 GetAddress(void) const
+    {
+      Address CurAddr;
+      m_pCpuCtxt->GetAddress(CpuContext::AddressExecution, CurAddr);
+      return static_cast<u32>(CurAddr.GetOffset());
+    }
+
+    //! This method executes the block at the current address.
+    Emulator::ReturnType Step(void)
+    {
+      Address CurAddr;
+      m_pCpuCtxt->GetAddress(CpuContext::AddressExecution, CurAddr);
+      if (m_UseTreeWalker)
+        return m_pEmul->Emulator::Execute(CurAddr);
+      return m_pEmul->Execute(CurAddr);
+    }
+
+    //! This method executes blocks until the end of the code is reached.
+    Emulator::ReturnType Run(u32 MaxNrOfBlocks = 0x1000)
+    {
+      for (u32 BlkNo = 0; BlkNo < MaxNrOfBlocks; ++BlkNo)
+      {
+        if (GetAddress() >= 0x1000 + m_CodeSize)
+          return Emulator::Stop;
+        auto Res = Step();
+        if (Res != Emulator::Continue && Res != Emulator::Break)
+          return Res;
+      }
+      return Emulator::Break;
+    }
+
+  private:
+    Architecture::SPType m_spArch;
+    CpuContext*          m_pCpuCtxt;
+    MemoryContext*       m_pMemCtxt;
+    Emulator*            m_pEmul;
+    u32                  m_CodeSize;
+    bool                 m_UseTreeWalker;
+  };
+}
+
+TEST_CASE("precise flags", "[emul]")
+{
+  using namespace medusa;
+
+  static std::vector<u8> const Code =
+  {
+    0x01, 0xd8, // add eax, ebx
+    0xeb, 0x00, // jmp 0x1004
+    0x29, 0xca, // sub edx, ecx
+    0xeb, 0x00, // jmp 0x1008
+    0x01, 0xd8, // add eax, ebx
+    0xeb, 0x00, // jmp 0x100c
+    0x11, 0xfe, // adc esi, edi
+    0x39, 0xd1, // cmp ecx, edx
+  };
+
+  auto Emulate = [](bool PreciseFlags, bool OnlyFirstBlock) -> std::string
+  {
+    X86Emulation X86Emul(Code);
+    REQUIRE(X86Emul.IsValid());
+    X86Emul.GetEmulator().SetPreciseFlags(PreciseFlags);
+    X86Emul.SetRegister<u32>("eax", 0xffffffff);
+    X86Emul.SetRegister<u32>("ebx", 0xffffffff);
+    X86Emul.SetRegister<u32>("ecx", 3);
+    X86Emul.SetRegister<u32>("edx", 5);
+
+    if (OnlyFirstBlock)
+    {
+      REQUIRE(X86Emul.Step() == Emulator::Continue);
+      return X86Emul.GetRegister<bool>("cf") ? "cf" : "";
+    }
+
+    CHECK(X86Emul.Run() == Emulator::Stop);
+    INFO("adc reads the carry of the add executed in the previous block");
+    CHECK(X86Emul.GetRegister<u32>("esi") == 1);
+    return X86Emul.GetCpuContext().ToString();
+  };
+
+  CHECK(Emulate(false, false) == Emulate(true, false));
+
+  INFO("The carry of the first add is overwritten by the sub of the next block");
+  CHECK(Emulate(true, true) == "cf");
+  CHECK(Emulate(false, true) == "");
+}
+
+TEST_CASE("hooks observe precise flags", "[emul]")
+{
+  using namespace medusa;
+
+  static std::vector<u8> const Code =
+  {
+    0x01, 0xd8, // add eax, ebx
+    0xeb, 0x00, // jmp 0x1004
+    0x29, 0xca, // sub edx, ecx
+    0xc3,       // ret
+  };
+
+  X86Emulation X86Emul(Code);
+  REQUIRE(X86Emul.IsValid());
+  auto& rEmul = X86Emul.GetEmulator();
+  CHECK(!rEmul.HasPreciseFlags());
+
+  auto StepFirstBlock = [&]()
+  {
+    X86Emul.SetAddress(0x1000);
+    X86Emul.SetRegister<u32>("eax", 0xffffffff);
+    X86Emul.SetRegister<u32>("ebx", 0xffffffff);
+    X86Emul.SetRegister<bool>("cf", false);
+    REQUIRE(X86Emul.Step() == Emulator::Continue);
+  };
+
+  INFO("The first block is cached without the carry of add");
+  StepFirstBlock();
+  CHECK(!X86Emul.GetRegister<bool>("cf"));
+
+  // The hooks are added once the first block is cached
+  bool HookCarry = false;
+  Address SuccAddr(Address::LinearType, 0x0, 0x1004, 16, 32);
+  REQUIRE(rEmul.AddHook(SuccAddr, Emulator::HookOnExecute, [&](CpuContext* pCpuCtxt, MemoryContext*, Address const&)
+  {
+    auto const* pCpuInfo = &pCpuCtxt->GetCpuInformation();
+    pCpuCtxt->ReadRegister(pCpuInfo->ConvertNameToIdentifier("cf"), HookCarry);
+    return Emulator::Continue;
+  }));
+  StepFirstBlock();
+  CHECK(HookCarry);
+  REQUIRE(rEmul.RemoveHook(SuccAddr));
+
+  bool InsnCarry = false;
+  REQUIRE(rEmul.AddHookOnInstruction([&](CpuContext* pCpuCtxt, MemoryContext*, Address const& rAddr)
+  {
+    if (rAddr.GetOffset() == 0x1002)
+    {
+      auto const* pCpuInfo = &pCpuCtxt->GetCpuInformation();
+      pCpuCtxt->ReadRegister(pCpuInfo->ConvertNameToIdentifier("cf"), InsnCarry);
+    }
+    return Emulator::Continue;
+  }));
+  StepFirstBlock();
+  CHECK(InsnCarry);
+}
+
+TEST_CASE("compiled block", "[emul]")
+{
+  using namespace medusa;
+
+  // Runs the same code with the compiled blocks and with the tree walker of the interpreter
+  struct Outcome
+  {
+    Emulator::ReturnType m_Ret;
+    std::string          m_CpuCtxt;
+    std::string          m_Stack;
+  };
+  auto Emulate = [](std::vector<u8> const& rCode, bool UseTreeWalker, std::function<void (X86Emulation&)> Init) -> Outcome
+  {
+    X86Emulation X86Emul(rCode);
+    REQUIRE(X86Emul.IsValid());
+    X86Emul.SetTreeWalker(UseTreeWalker);
+    X86Emul.SetRegister<u32>("eax", 0x7fffffff);
+    X86Emul.SetRegister<u32>("ebx", 1);
+    X86Emul.SetRegister<u32>("edx", 3);
+    Init(X86Emul);
+    Outcome Res;
+    Res.m_Ret = X86Emul.Run();
+    Res.m_CpuCtxt = X86Emul.GetCpuContext().ToString();
+    Res.m_Stack = X86Emul.GetStack();
+    return Res;
+  };
+  auto Compare = [&](std::vector<u8> const& rCode, std::function<void (X86Emulation&)> Init) -> Emulator::ReturnType
+  {
+    auto Compiled = Emulate(rCode, false, Init);
+    auto Walked = Emulate(rCode, true, Init);
+    CHECK(Compiled.m_Ret == Walked.m_Ret);
+    CHECK(Compiled.m_CpuCtxt == Walked.m_CpuCtxt);
+    CHECK(Compiled.m_Stack == Walked.m_Stack);
+    return Compiled.m_Ret;
+  };
+  auto NoInit = [](X86Emulation&) {};
+
+  SECTION("conditional")
+  {
+    static std::vector<u8> const Code =
+    {
+      0xb9, 0x05, 0x00, 0x00, 0x00, // mov ecx, 5
+      0x51,                         // push ecx
+      0x83, 0xf9, 0x03,             // cmp ecx, 3
+      0x0f, 0x92, 0xc0,             // setb al
+      0x0f, 0x4f, 0xd1,             // cmovg edx, ecx
+      0x83, 0xd3, 0x00,             // adc ebx, 0
+      0x49,                         // dec ecx
+      0x75, 0xf0,                   // jnz 0x1005
+    };
+    CHECK(Compare(Code, NoInit) == Emulator::Stop);
+  }
+
+  SECTION("division")
+  {
+    static std::vector<u8> const Code =
+    {
+      0xf7, 0xf1, // div ecx
+      0x50,       // push eax
+      0x52,       // push edx
+    };
+    CHECK(Compare(Code, [](X86Emulation& rX86Emul) { rX86Emul.SetRegister<u32>("ecx", 7); }) == Emulator::Stop);
+    INFO("Both paths must report the division by zero");
+    CHECK(Compare(Code, [](X86Emulation& rX86Emul) { rX86Emul.SetRegister<u32>("ecx", 0); }) == Emulator::Error);
+  }
+
+  SECTION("walk operation")
+  {
+    // 128-bit registers can't be compiled, the block mixes tree walker and compiled operations
+    static std::vector<u8> const Code =
+    {
+      0x66, 0x0f, 0x6e, 0xc8, // movd xmm1, eax
+      0x01, 0xd8,             // add eax, ebx
+      0x0f, 0x28, 0xc1,       // movaps xmm0, xmm1
+      0x50,                   // push eax
+      0x66, 0x0f, 0x6e, 0xd0, // movd xmm2, eax
+    };
+    CHECK(Compare(Code, NoInit) == Emulator::Stop);
+  }
+}
+
+TEST_CASE("execution hook", "[emul]")
+{
+  using namespace medusa;
+
+  static std::vector<u8> const Code =
+  {
+    0xb9, 0x00, 0x01, 0x00, 0x00, // mov ecx, 0x100
+    0x40,                         // inc eax
+    0xeb, 0x02,                   // jmp 0x100a
+    0x90,                         // nop
+    0x90,                         // nop
+    0x43,                         // inc ebx
+    0x49,                         // dec ecx
+    0x75, 0xf7,                   // jnz 0x1005
+  };
+
+  // Blocks of the loop are chained and become hot, each visit must still call the hooks once. When only the
+  // loop head is hooked, the loop becomes a trace.
+  for (auto pEmulatorType : { "interpreter", "llvm" })
+  for (auto HookInc : { true, false })
+  {
+    INFO("Using emulator type: " << pEmulatorType << ", hook on inc ebx: " << HookInc);
+    X86Emulation X86Emul(Code, pEmulatorType);
+    if (!X86Emul.IsValid())
+    {
+      WARN("Emulator " << pEmulatorType << " is not available");
+      break;
+    }
+
+    u32 NrOfLoopVisits = 0, NrOfIncVisits = 0;
+    auto& rEmul = X86Emul.GetEmulator();
+    // The loop head is reached in the middle of the first block, then as the target of jnz
+    REQUIRE(rEmul.AddHook(Address(Address::LinearType, 0x0, 0x1005, 16, 32), Emulator::HookOnExecute,
+      [&](CpuContext*, MemoryContext*, Address const&) { ++NrOfLoopVisits; return Emulator::Continue; }));
+    if (HookInc)
+      REQUIRE(rEmul.AddHook(Address(Address::LinearType, 0x0, 0x100a, 16, 32), Emulator::HookOnExecute,
+        [&](CpuContext*, MemoryContext*, Address const&) { ++NrOfIncVisits; return Emulator::Continue; }));
+    // Chained blocks only give the control back on a hook, so the end of the code must be hooked
+    REQUIRE(rEmul.AddHook(Address(Address::LinearType, 0x0, 0x1000 + static_cast<u32>(Code.size()), 16, 32), Emulator::HookOnExecute,
+      [&](CpuContext*, MemoryContext*, Address const&) { return Emulator::Stop; }));
+
+    CHECK(X86Emul.Run() == Emulator::Stop);
+    CHECK(X86Emul.GetRegister<u32>("ebx") == 0x100);
+    CHECK(NrOfLoopVisits == 0x100);
+    CHECK(NrOfIncVisits == (HookInc ? 0x100 : 0));
+  }
+}
+
 //TEST_CASE("arm", "[emul_interpreter_arm]")
 //{
 //  using namespace medusa;
@@ -5,6 +5,10 @@
 #include <medusa/expression_filter.hpp>
 #include <medusa/expression_visitor.hpp>
 #include <medusa/expression_simplifier.hpp>
+#include <medusa/expression_pool.hpp>
+#include <medusa/ir.hpp>
+#include <medusa/binary_stream.hpp>
+#include <medusa/instruction.hpp>
 #include <medusa/module.hpp>
 #include <medusa/architecture.hpp>
 
@@ -58,6 +62,201 @@ TEST_CASE("const", "[expr]")
   CHECK(spConstExpr != nullptr);
 }
 
+TEST_CASE("shared identifier", "[expr]")
+{
+  auto& rModMgr = ModuleManager::Instance();
+  auto pX86Getter = rModMgr.LoadModule<TGetArchitecture>(".", "x86");
+  REQUIRE(pX86Getter != nullptr);
+  auto pX86Disasm = pX86Getter();
+
+  auto const pCpuInfo = pX86Disasm->GetCpuInformation();
+  auto EAX = pCpuInfo->ConvertNameToIdentifier("eax");
+  auto EBX = pCpuInfo->ConvertNameToIdentifier("ebx");
+
+  INFO("Identifiers created with the same CpuInformation are shared");
+  auto spEaxExpr = Expr::MakeId(EAX, pCpuInfo);
+  CHECK(spEaxExpr == Expr::MakeId(EAX, pCpuInfo));
+  CHECK(spEaxExpr != Expr::MakeId(EBX, pCpuInfo));
+  CHECK(spEaxExpr->Compare(spEaxExpr->Clone()) == Expression::CmpIdentical);
+
+  delete pX86Disasm;
+}
+
+TEST_CASE("expression pool", "[expr]")
+{
+  ExpressionPool ExprPool;
+
+  auto MakeTree = [](u16 BitSize)
+  {
+    auto spOffExpr = Expr::MakeBinOp(OperationExpression::OpAdd, Expr::MakeVar("base", VariableExpression::Use, 32), Expr::MakeBitVector(BitSize, 0x10));
+    return Expr::MakeAssign(Expr::MakeVar("res", VariableExpression::Use, 32), Expr::MakeMem(32, nullptr, spOffExpr));
+  };
+
+  auto spFirstExpr  = ExprPool.Intern(MakeTree(32));
+  auto spSecondExpr = ExprPool.Intern(MakeTree(32));
+  INFO("Structurally identical trees are interned as the same node");
+  CHECK(spFirstExpr == spSecondExpr);
+  CHECK(ExprPool.Contains(spFirstExpr));
+  CHECK(ExprPool.GetSize() == 6);
+  CHECK(spFirstExpr->Compare(spSecondExpr) == Expression::CmpIdentical);
+
+  auto spOtherExpr = ExprPool.Intern(MakeTree(16));
+  INFO("Interning is exact, bitvectors of different size are different nodes");
+  CHECK(spOtherExpr != spFirstExpr);
+  CHECK(ExprPool.GetHash(spOtherExpr) != ExprPool.GetHash(spFirstExpr));
+
+  auto spMemExpr = expr_cast<MemoryExpression>(expr_cast<AssignmentExpression>(spFirstExpr)->GetSourceExpression());
+  REQUIRE(spMemExpr != nullptr);
+  CHECK(ExprPool.Contains(spMemExpr->GetOffsetExpression()));
+  CHECK(ExprPool.GetBitSize(spMemExpr) == 32);
+  CHECK(ExprPool.GetHash(spFirstExpr) == ExprPool.GetHash(spSecondExpr));
+
+  INFO("Lookups don't intern anything");
+  CHECK(ExprPool.GetSize() == 10);
+  CHECK(ExprPool.Find(MakeTree(32)) == spFirstExpr);
+  CHECK(ExprPool.Find(MakeTree(8)) == nullptr);
+  CHECK(ExprPool.GetSize() == 10);
+
+  INFO("Nodes are removed once they are unreferenced, shared children are kept");
+  ExprPool.Release(spOtherExpr);
+  CHECK(ExprPool.GetSize() == 6);
+  ExprPool.Release(spFirstExpr);
+  CHECK(ExprPool.GetSize() == 6);
+  ExprPool.Release(spSecondExpr);
+  CHECK(ExprPool.GetSize() == 0);
+
+  spFirstExpr = ExprPool.Intern(MakeTree(32));
+  ExprPool.Clear();
+  CHECK(ExprPool.GetSize() == 0);
+  CHECK(!ExprPool.Contains(spFirstExpr));
+}
+
+TEST_CASE("rewrite engine", "[expr]")
+{
+  using namespace Pattern;
+
+  auto IsZero = [](Expression::SPType spExpr)
+  {
+    auto spBvExpr = expr_cast<BitVectorExpression>(spExpr);
+    return spBvExpr != nullptr && spBvExpr->GetInt().IsZero();
+  };
+
+  RewriteEngine Engine;
+  Engine.AddRule(ADD(Any("x"), Callback(IsZero)), [](NamedExpressionType const& rNamedExprs, Expression::SPType)
+  {
+    return rNamedExprs.at("x");
+  });
+
+  auto spVarExpr = Expr::MakeVar("x", VariableExpression::Use, 32);
+  auto spMemExpr = Expr::MakeMem(32, nullptr, Expr::MakeBitVector(32, 0x1000));
+  auto spExpr = Expr::MakeAssign(spMemExpr,
+    Expr::MakeBinOp(OperationExpression::OpAdd,
+      Expr::MakeBinOp(OperationExpression::OpAdd, spVarExpr, Expr::MakeBitVector(32, 0)),
+      Expr::MakeBitVector(32, 0)));
+
+  REQUIRE(Engine.Execute(spExpr));
+  CHECK(Engine.GetRewriteCount() == 2);
+  CHECK(spExpr->ToString() == "(Mem32(bv32(0x00001000)) = Var32[use] x)");
+  auto spAssignExpr = expr_cast<AssignmentExpression>(spExpr);
+  REQUIRE(spAssignExpr != nullptr);
+  INFO("Unchanged subtrees are not rebuilt");
+  CHECK(spAssignExpr->GetDestinationExpression() == spMemExpr);
+  CHECK(spAssignExpr->GetSourceExpression() == spVarExpr);
+
+  auto spConstExpr = Expr::MakeBinOp(OperationExpression::OpMul,
+    Expr::MakeBinOp(OperationExpression::OpAdd, Expr::MakeBitVector(32, 1), Expr::MakeBitVector(32, 2)),
+    Expr::MakeBinOp(OperationExpression::OpLls, Expr::MakeBitVector(32, 1), Expr::MakeBitVector(32, 4)));
+  ConstantPropagation ConstProp(spConstExpr);
+  REQUIRE(ConstProp.Execute());
+  CHECK(spConstExpr->ToString() == "bv32(0x00000030)");
+}
+
+TEST_CASE("expression rewriter", "[expr]")
+{
+  // Unsigned comparison as produced by the x86 semantic of cmp + ja
+  auto MakeCmpA = []()
+  {
+    auto spOp0 = Expr::MakeVar("op0", VariableExpression::Use, 32);
+    auto spOp1 = Expr::MakeVar("op1", VariableExpression::Use, 32);
+    auto spRes = Expr::MakeVar("res", VariableExpression::Use, 32);
+    auto spCarry = Expr::MakeBinOp(OperationExpression::OpXor,
+      Expr::MakeBinOp(OperationExpression::OpXor, Expr::MakeBinOp(OperationExpression::OpXor, spOp0, spOp1), spRes),
+      Expr::MakeBinOp(OperationExpression::OpAnd,
+        Expr::MakeBinOp(OperationExpression::OpXor, spOp0, spRes),
+        Expr::MakeBinOp(OperationExpression::OpXor, spOp0, spOp1)));
+    auto spCf = Expr::MakeBinOp(OperationExpression::OpBcast,
+      Expr::MakeBinOp(OperationExpression::OpLrs, spCarry, Expr::MakeBitVector(32, 31)),
+      Expr::MakeBitVector(32, 1));
+    auto spZf = Expr::MakeTernaryCond(ConditionExpression::CondEq, spRes, Expr::MakeBitVector(32, 0),
+      Expr::MakeBitVector(1, 1), Expr::MakeBitVector(1, 0));
+    return Expr::MakeTernaryCond(ConditionExpression::CondEq,
+      Expr::MakeBinOp(OperationExpression::OpOr, spCf, spZf), Expr::MakeBitVector(1, 0),
+      Expr::MakeBitVector(32, 0x1000), Expr::MakeBitVector(32, 0x2000));
+  };
+
+  auto spExpr = MakeCmpA();
+  ExpressionRewriter RootRewriter(spExpr);
+  REQUIRE(RootRewriter.Execute());
+  auto spTernExpr = expr_cast<TernaryConditionExpression>(spExpr);
+  REQUIRE(spTernExpr != nullptr);
+  CHECK(spTernExpr->GetType() == ConditionExpression::CondUgt);
+
+  // Sub-expressions are only rewritten on request
+  auto spVarExpr = Expr::MakeVar("dst", VariableExpression::Use, 32);
+  auto spAssignExpr = Expr::MakeAssign(spVarExpr, MakeCmpA());
+  auto spOrigExpr = spAssignExpr;
+  ExpressionRewriter RootOnlyRewriter(spAssignExpr);
+  REQUIRE(RootOnlyRewriter.Execute());
+  CHECK(spAssignExpr == spOrigExpr);
+
+  ExpressionRewriter SubExprRewriter(spAssignExpr, true);
+  REQUIRE(SubExprRewriter.Execute());
+  auto spSrcExpr = expr_cast<TernaryConditionExpression>(expr_cast<AssignmentExpression>(spAssignExpr)->GetSourceExpression());
+  REQUIRE(spSrcExpr != nullptr);
+  CHECK(spSrcExpr->GetType() == ConditionExpression::CondUgt);
+}
+
+TEST_CASE("expression transformer", "[expr]")
+{
+  class ReplaceVariable : public ExpressionTransformer
+  {
+  protected:
+    virtual Expression::SPType _PreTransform(Expression::SPType spExpr)
+    {
+      if (spExpr->GetClassKind() != Expression::Var)
+        return nullptr;
+      if (std::static_pointer_cast<VariableExpression>(spExpr)->GetName() != "x")
+        return nullptr;
+      return Expr::MakeBitVector(32, 0x10);
+    }
+  } RplVar;
+
+  auto spMemExpr = Expr::MakeMem(32, nullptr, Expr::MakeVar("y", VariableExpression::Use, 32));
+  auto spAddExpr = Expr::MakeBinOp(OperationExpression::OpAdd, Expr::MakeVar("x", VariableExpression::Use, 32), Expr::MakeBitVector(32, 1));
+  auto spExpr = Expr::MakeAssign(spMemExpr, spAddExpr);
+
+  auto spResExpr = RplVar.Transform(spExpr);
+  REQUIRE(spResExpr != nullptr);
+  CHECK(spResExpr->ToString() == "(Mem32(Var32[use] y) = (bv32(0x00000010) + bv32(0x00000001)))");
+  CHECK(spExpr->ToString() == "(Mem32(Var32[use] y) = (Var32[use] x + bv32(0x00000001)))");
+  auto spAssignExpr = expr_cast<AssignmentExpression>(spResExpr);
+  REQUIRE(spAssignExpr != nullptr);
+  INFO("Unchanged subtrees are not rebuilt");
+  CHECK(spAssignExpr->GetDestinationExpression() == spMemExpr);
+  CHECK(spAssignExpr->GetSourceExpression() != spAddExpr);
+  CHECK(RplVar.Transform(spMemExpr) == spMemExpr);
+  CHECK(spMemExpr->Visit(&RplVar) == spMemExpr);
+
+  INFO("Variables produced by IdentifierToVariable are not shared with the input");
+  IdentifierToVariable Id2Var;
+  auto spVarExpr = Expr::MakeVar("z", VariableExpression::Use);
+  auto spId2VarExpr = expr_cast<VariableExpression>(Id2Var.Transform(spVarExpr));
+  REQUIRE(spId2VarExpr != nullptr);
+  CHECK(spId2VarExpr != spVarExpr);
+  spId2VarExpr->SetBitSize(32);
+  CHECK(spVarExpr->GetBitSize() == 0);
+}
+
 TEST_CASE("x86 id normalization", "[expr]")
 {
   auto& rModMgr = ModuleManager::Instance();
@@ -83,7 +282,8 @@ TEST_CASE("x86 id normalization", "[expr]")
   spExpr = spExpr->Visit(&NrmId);
   std::cout << "assign (id normalized): " << spExpr->ToString() << std::endl;
 
-  EvaluateVisitor EvalVst(Document(), 0x0, X86_32_Mode, false);
+  Document Doc;
+  EvaluateVisitor EvalVst(Doc, 0x0, X86_32_Mode, false);
   EvalVst.SetId(EAX, spEaxExpr);
   EvalVst.SetId(EBX, spEbxExpr);
   spExpr->Visit(&EvalVst);
@@ -116,7 +316,8 @@ TEST_CASE("x86-64 id normalization", "[expr]")
   spExpr = spExpr->Visit(&NrmId);
   std::cout << "assign (id normalized): " << spExpr->ToString() << std::endl;
 
-  EvaluateVisitor EvalVst(Document(), 0x0, X86_64_Mode, false);
+  Document Doc;
+  EvaluateVisitor EvalVst(Doc, 0x0, X86_64_Mode, false);
   EvalVst.SetId(RAX, Expr::MakeBitVector(64, 0xffffffffffffffff));
   spExpr->Visit(&EvalVst);
   auto spRes = expr_cast<BitVectorExpression>(EvalVst.GetResultExpression());
@@ -174,7 +375,8 @@ TEST_CASE("x86 id normalization, track and evaluation", "[expr]")
   auto spNrmExpr = spExpr->Visit(&NrmId);
   std::cout << "oper (id normalized): " << spNrmExpr->ToString() << std::endl;
 
-  SymbolicVisitor SymVst(Document(), X86_32_Mode);
+  Document Doc;
+  SymbolicVisitor SymVst(Doc, X86_32_Mode);
 
   SymVst.UpdateAddress(*pX86Disasm, Address(Address::LogicalType, 0x0, 0x0, 16, 32));
   auto spInitEbx = Expr::MakeAssign(
@@ -198,6 +400,81 @@ TEST_CASE("x86 id normalization, track and evaluation", "[expr]")
   delete pX86Disasm;
 }
 
+TEST_CASE("ir lowering", "[expr]")
+{
+  auto& rModMgr = ModuleManager::Instance();
+  auto pX86Getter = rModMgr.LoadModule<TGetArchitecture>(".", "x86");
+  REQUIRE(pX86Getter != nullptr);
+  auto pX86Disasm = pX86Getter();
+
+  auto const X86_32_Mode = pX86Disasm->GetModeByName("32-bit");
+  REQUIRE(X86_32_Mode != 0);
+
+  // add eax, ebx; sub edx, ecx; mov al, [esp]; push eax; cmp ecx, edx; cmovz eax, ebx
+  static u8 const s_Block[] = { 0x01, 0xd8, 0x29, 0xca, 0x8a, 0x04, 0x24, 0x50, 0x39, 0xd1, 0x0f, 0x44, 0xc3 };
+  MemoryBinaryStream MemBinStrm(s_Block, sizeof(s_Block));
+
+  auto LowerBlock = [&](IrBlock& rBlk, bool AddHook)
+  {
+    IrBuilder Bld(rBlk);
+    for (OffsetType Off = 0; Off < sizeof(s_Block);)
+    {
+      Instruction Insn;
+      REQUIRE(pX86Disasm->Disassemble(MemBinStrm, Off, Insn, X86_32_Mode));
+      REQUIRE(Insn.GetSize() != 0);
+      if (AddHook)
+        REQUIRE(Bld.Lower(Expr::MakeSys("call_insn_cb", Address())));
+      REQUIRE(Bld.Lower(Insn.GetSemantic()));
+      Off += Insn.GetSize();
+    }
+  };
+
+  std::string Err;
+
+  // Hooks may read the flags, only the computations which are not used are removed
+  IrBlock HookBlk(pX86Disasm->GetCpuInformation());
+  LowerBlock(HookBlk, true);
+  INFO(HookBlk.ToString());
+  REQUIRE(HookBlk.Verify(Err));
+  auto HookRemovedNo = HookBlk.EliminateDeadFlags();
+  REQUIRE(HookBlk.Verify(Err));
+
+  IrBlock Blk(pX86Disasm->GetCpuInformation());
+  LowerBlock(Blk, false);
+  REQUIRE(Blk.Verify(Err));
+  auto InsnNo = Blk.GetInstructions().size();
+  auto RemovedNo = Blk.EliminateDeadFlags();
+  std::cout << "ir (dead flags eliminated):" << std::endl << Blk.ToString() << std::endl;
+  REQUIRE(Blk.Verify(Err));
+  CHECK(RemovedNo > HookRemovedNo);
+  CHECK(Blk.GetInstructions().size() == InsnNo - RemovedNo);
+
+  // Only the flags of cmp are left
+  size_t WriteFlagNo = 0;
+  for (auto const& rInsn : Blk.GetInstructions())
+    if (rInsn.m_Type == IrInstruction::WriteFlag)
+      ++WriteFlagNo;
+  CHECK(WriteFlagNo == 6);
+
+  // Memory can't be accessed under if/else, only registers are merged
+  auto const pCpuInfo = pX86Disasm->GetCpuInformation();
+  auto spEax = Expr::MakeId(pCpuInfo->ConvertNameToIdentifier("eax"), pCpuInfo);
+  auto spEbx = Expr::MakeId(pCpuInfo->ConvertNameToIdentifier("ebx"), pCpuInfo);
+  auto spMem = Expr::MakeMem(32, nullptr, spEbx);
+  auto LowerIfElse = [&](Expression::SPType spThenExpr)
+  {
+    IrBlock PredBlk(pCpuInfo);
+    IrBuilder PredBld(PredBlk);
+    return PredBld.Lower(Expr::MakeIfElseCond(ConditionExpression::CondEq, spEax, Expr::MakeBitVector(32, 0), spThenExpr, nullptr));
+  };
+  CHECK(LowerIfElse(Expr::MakeAssign(spEax, spEbx)));
+  CHECK_FALSE(LowerIfElse(Expr::MakeAssign(spMem, spEbx)));
+  CHECK_FALSE(LowerIfElse(Expr::MakeAssign(spEax, spMem)));
+  CHECK(LowerIfElse(Expr::MakeAssign(spEax, Expr::MakeMem(32, nullptr, spEbx, false))));
+
+  delete pX86Disasm;
+}
+
 TEST_CASE("variable", "[expr]")
 {
   auto spAllocVarExpr = Expr::MakeVar("test", VariableExpression::Alloc, 32);
@@ -279,7 +556,8 @@ TEST_CASE("push pop", "[expr]")
     spAllocVar_PoppedVal, spReadVar_PoppedVar, spIncStk, spReadStk, spFreeVar_PoppedVal,
   };
 
-  SymbolicVisitor SymVst(Document(), X86_32_Mode);
+  Document Doc;
+  SymbolicVisitor SymVst(Doc, X86_32_Mode);
 
   SymVst.UpdateAddress(*pX86Disasm, Address(Address::LinearType, 0x0, 0x0, 16, 32));
   for (auto const& rspExpr : PushFF)
@@ -3,6 +3,9 @@
 
 #include <medusa/loader.hpp>
 #include <medusa/module.hpp>
+#include <medusa/medusa.hpp>
+
+#include <cstring>
 
 TEST_CASE("", "[ldr_boot_sector]")
 {
@@ -24,6 +27,83 @@ TEST_CASE("", "[ldr_pe]")
 {
 }
 
+TEST_CASE("exports", "[ldr_pe]")
+{
+  using namespace medusa;
+
+  // Minimal PE32 image, the only section .text (rva 0x1000) contains the export directory (rva 0x1100)
+  // Names are sorted and index the function table through the ordinal table, the second function has no name
+  std::vector<u8> Image(0x400);
+  auto Write16 = [&](u32 Off, u16 Val) { Image[Off] = Val & 0xff; Image[Off + 1] = Val >> 8; };
+  auto Write32 = [&](u32 Off, u32 Val) { Write16(Off, Val & 0xffff); Write16(Off + 2, Val >> 16); };
+  auto WriteStr = [&](u32 Off, char const* pStr) { std::memcpy(&Image[Off], pStr, std::strlen(pStr) + 1); };
+
+  Write16(0x000, 0x5a4d);                       // e_magic
+  Write32(0x03c, 0x40);                         // e_lfanew
+  Write32(0x040, 0x00004550);                   // Signature
+  Write16(0x044, 0x014c);                       // Machine: i386
+  Write16(0x046, 1);                            // NumberOfSections
+  Write16(0x054, 0xe0);                         // SizeOfOptionalHeader
+  Write16(0x056, 0x0102);                       // Characteristics
+  Write16(0x058, 0x010b);                       // Magic: PE32
+  Write32(0x068, 0x1030);                       // AddressOfEntryPoint
+  Write32(0x074, 0x400000);                     // ImageBase
+  Write32(0x078, 0x1000);                       // SectionAlignment
+  Write32(0x07c, 0x200);                        // FileAlignment
+  Write32(0x090, 0x2000);                       // SizeOfImage
+  Write32(0x094, 0x200);                        // SizeOfHeaders
+  Write32(0x0b4, 16);                           // NumberOfRvaAndSizes
+  Write32(0x0b8, 0x1100); Write32(0x0bc, 0x80); // DataDirectory[EXPORT]
+  Write32(0x0c0, 0x1180); Write32(0x0c4, 0x14); // DataDirectory[IMPORT], empty
+
+  WriteStr(0x138, ".text");
+  Write32(0x140, 0x200);                        // VirtualSize
+  Write32(0x144, 0x1000);                       // VirtualAddress
+  Write32(0x148, 0x200);                        // SizeOfRawData
+  Write32(0x14c, 0x200);                        // PointerToRawData
+  Write32(0x15c, 0x60000020);                   // Characteristics: code, execute, read
+
+  Write32(0x310, 1);                            // Base
+  Write32(0x314, 3);                            // NumberOfFunctions
+  Write32(0x318, 2);                            // NumberOfNames
+  Write32(0x31c, 0x1140);                       // AddressOfFunctions
+  Write32(0x320, 0x1150);                       // AddressOfNames
+  Write32(0x324, 0x1158);                       // AddressOfNameOrdinals
+  Write32(0x340, 0x1000); Write32(0x344, 0x1010); Write32(0x348, 0x1020);
+  Write32(0x350, 0x1160); Write32(0x354, 0x1170);
+  Write16(0x358, 2); Write16(0x35a, 0);
+  WriteStr(0x360, "alpha");
+  WriteStr(0x370, "beta");
+
+  Medusa Core;
+  REQUIRE(Core.NewDocument(
+    std::make_shared<MemoryBinaryStream>(Image.data(), static_cast<u32>(Image.size())), false,
+    Medusa::IgnoreDatabasePath,
+    [](BinaryStream::SPType&, Database::SPType& rspDb, Loader::SPType& rspLdr, Architecture::VSPType& rspArchs, OperatingSystem::SPType&)
+  {
+    auto& rModMgr = ModuleManager::Instance();
+    if (rModMgr.GetDatabases().empty())
+      return false;
+    rspDb = rModMgr.GetDatabases().front();
+    for (auto spLdr : rModMgr.GetLoaders())
+      if (spLdr->GetName() == "PE")
+        rspLdr = spLdr;
+    rspArchs = rModMgr.GetArchitectures();
+    return rspLdr != nullptr;
+  }));
+
+  auto const& rDoc = Core.GetDocument();
+  auto GetExport = [&](u64 Rva)
+  {
+    return rDoc.GetLabelFromAddress(Address(Address::LinearType, 0x0, 0x400000 + Rva, 0x10, 32)).GetName();
+  };
+  CHECK(GetExport(0x1000) == "beta");
+  CHECK(GetExport(0x1010) == "ord_2");
+  CHECK(GetExport(0x1020) == "alpha");
+
+  Core.WaitForTasks();
+}
+
 TEST_CASE("", "[ldr_raw]")
 {
 }
@@ -140,6 +140,7 @@ void PydusaExecution(py::module& rMod)
     .def("set_emulator", &Execution::SetEmulator)
     .def("execute", &Execution::Execute)
     .def("invalidate_cache", &Execution::InvalidateCache)
+    .def("set_precise_flags", &Execution::SetPreciseFlags)
     .def("map_module", pydusa::Execution_MapModule)
     .def("hook_instruction", &Execution::HookInstruction)
     .def("hook_address", pydusa::Execution_HookAddress)